@@ -10,6 +10,20 @@ find_package(tomlplusplus REQUIRED)
 find_package(fmt REQUIRED)
 
 
+#-----------------------------------------------------------------------
+# Threading
+
+find_package(Threads REQUIRED)
+
+
+#-----------------------------------------------------------------------
+# Benchmark framework
+
+if (OPENASSETIO_ENABLE_BENCHMARKS)
+    find_package(benchmark REQUIRED)
+endif ()
+
+
 #-----------------------------------------------------------------------
 # Python
 
@@ -19,7 +33,7 @@ if (OPENASSETIO_ENABLE_PYTHON)
 
     list(APPEND _components Interpreter)
     list(APPEND _components Development.Module)
-    if (OPENASSETIO_ENABLE_TESTS)
+    if (OPENASSETIO_ENABLE_TESTS OR OPENASSETIO_ENABLE_BENCHMARKS)
         list(APPEND _components Development.Embed)
     endif ()
 
@@ -40,6 +40,8 @@ class OpenAssetIOConan(ConanFile):
         self.requires("catch2/2.13.8")
         # Mocking library
         self.requires("trompeloeil/42")
+        # Benchmark framework
+        self.requires("benchmark/1.8.3")
         # TODO(DF): fmt v10 forcibly exports the symbol for its
         #  `format_error` exception in GCC, making it not a true private
         #  dependency. So pin to v9 for now.
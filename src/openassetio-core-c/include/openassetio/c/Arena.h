@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers)
+
+#include <openassetio/c/export.h>
+
+#include "./StringView.h"
+#include "./errors.h"
+#include "./namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_Arena oa_Arena
+ *
+ * C API for grouping the lifetime of many result objects.
+ *
+ * Functions that take an arena allocate the objects they return (e.g.
+ * one @ref oa_trait_TraitsData per batch element) within it, rather
+ * than individually. Such objects are then all destroyed, in one go,
+ * by @ref oa_Arena_dtor, and must not be passed to their own type's
+ * `dtor` function.
+ *
+ * This suits hosts that manage memory per frame or per batch, avoiding
+ * a separate allocation and destructor call for every result.
+ *
+ * An arena is not thread-safe. It may be used for any number of calls,
+ * but not by multiple calls concurrently.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_Arena_aliases Aliases
+ *
+ * @{
+ */
+#define oa_Arena_t OPENASSETIO_NS(Arena_t)
+#define oa_Arena_h OPENASSETIO_NS(Arena_h)
+#define oa_Arena_ctor OPENASSETIO_NS(Arena_ctor)
+#define oa_Arena_dtor OPENASSETIO_NS(Arena_dtor)
+
+/// @}
+// oa_Arena_aliases
+
+/**
+ * Opaque handle type representing an arena.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct oa_Arena_t* oa_Arena_h;
+
+/**
+ * Constructor function.
+ *
+ * The caller is responsible for deallocating via
+ * @ref oa_Arena_dtor.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for the handle of the new arena.
+ * @param blockSize Size, in bytes, of each block of memory allocated by
+ * the arena, or zero to use a default size. Objects larger than this
+ * are allocated in a block of their own.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_Arena_ctor(oa_StringView* err, oa_Arena_h* out,
+                                                     size_t blockSize);
+
+/**
+ * Destructor function.
+ *
+ * Destroys all objects allocated within the arena, and then the arena
+ * itself. Handles to objects within the arena, and the arena's handle,
+ * should not be used after calling this function.
+ *
+ * @param handle Opaque handle representing the arena.
+ */
+OPENASSETIO_CORE_C_EXPORT void oa_Arena_dtor(oa_Arena_h handle);
+
+/// @}
+// oa_Arena
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers)
+
+#include "./namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_BatchBuffers oa_BatchBuffers
+ *
+ * C API for passing batches of variable-length data in flat buffers.
+ *
+ * Batch functions of the C API take their inputs as a single
+ * @fqcref{ConstStringTable} "string table", rather than an array of
+ * individually allocated strings, and write their results to
+ * caller-allocated buffers, rather than calling a callback per
+ * element.
+ *
+ * Alongside its results, a batch function writes a code for each
+ * element to a caller-allocated `int` array. The code is
+ * @fqcref{ErrorCode_kOK} "kOK" if the element succeeded, one of the
+ * `OPENASSETIO_BatchErrorCode_*` values (see
+ * @fqref{errors.BatchElementError.ErrorCode} "BatchElementError
+ * codes") if the element failed, or @fqcref{ErrorCode_kLengthError}
+ * "kLengthError" if the element's result did not fit in the remaining
+ * capacity of the output buffer. The messages of failed elements are
+ * written to a single @ref oa_BatchElementErrors.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_BatchBuffers_aliases Aliases
+ *
+ * @{
+ */
+#define oa_ConstStringTable OPENASSETIO_NS(ConstStringTable)
+#define oa_ByteTable OPENASSETIO_NS(ByteTable)
+
+/// @}
+// oa_BatchBuffers_aliases
+
+/**
+ * Immutable table of strings stored in a single buffer.
+ *
+ * The strings are concatenated in `data`, without separators or
+ * null-termination. String `i` spans the bytes from `offsets[i]` up to
+ * (but not including) `offsets[i + 1]`, hence `offsets` must have
+ * `count + 1` elements, the first of which is zero.
+ *
+ * For example, the strings "abc" and "de" are represented as
+ *
+ * @code{.c}
+ * const size_t offsets[] = {0, 3, 5};
+ * oa_ConstStringTable table = {"abcde", offsets, 2};
+ * @endcode
+ *
+ * The underlying buffers are expected to remain valid for at least as
+ * long as the table is in use.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Immutable buffer storing the concatenated string data.
+  const char* const data;
+  /// Offsets of the start of each string, plus the end of the last.
+  const size_t* const offsets;
+  /// Number of strings in the table.
+  const size_t count;
+} oa_ConstStringTable;
+
+/**
+ * Mutable table of byte strings useful for batch out-parameters.
+ *
+ * The caller allocates a `char*` buffer, along with two `size_t`
+ * arrays with one element per batch element, and initializes the table
+ * with the capacity of the buffer and a used size of zero, e.g.
+ *
+ * @code{.c}
+ * char data[4096];
+ * size_t offsets[kBatchSize];
+ * size_t sizes[kBatchSize];
+ *
+ * oa_ByteTable results {
+ *   4096, data, 0, offsets, sizes
+ * };
+ * @endcode
+ *
+ * The callee appends the result of each element to `data`, in any
+ * order, records its position in `offsets` and `sizes`, and increments
+ * `size` by the number of bytes used.
+ *
+ * If an element's result does not fit in the remaining capacity, then
+ * nothing is appended for that element, its code is set to
+ * @fqcref{ErrorCode_kLengthError} "kLengthError", and its entry in
+ * `sizes` is set to the number of bytes required. The caller may then
+ * retry only those elements, with a sufficiently large buffer.
+ *
+ * Entries of `offsets` and `sizes` are otherwise unspecified for
+ * elements that failed.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Number of bytes available for storage in the buffer.
+  const size_t capacity;
+  /// Writeable buffer storing the concatenated element data.
+  char* const data;
+  /// Number of bytes used for storage in the buffer.
+  size_t size;
+  /// Offset of each element's data within the buffer.
+  size_t* const offsets;
+  /// Number of bytes of each element's data.
+  size_t* const sizes;
+} oa_ByteTable;
+
+/// @}
+// oa_BatchBuffers
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers)
+
+#include "./BatchBuffers.h"
+#include "./StringView.h"
+#include "./errors.h"
+#include "./namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_BatchBuffersInline oa_BatchBuffersInline
+ *
+ * Optional header-only accessors for reading batch buffers.
+ *
+ * The buffers of @ref oa_BatchBuffers and @ref oa_BatchElementErrors
+ * have a stable, public layout, so can be read without calling into the
+ * OpenAssetIO library. These accessors are `static inline`, such that
+ * reading results in a tight loop compiles down to a few loads, with
+ * no function call or error code overhead.
+ *
+ * As such, they perform no validation. It is the caller's
+ * responsibility to ensure indices are in range and, for output
+ * buffers, that the element succeeded (i.e. its code is
+ * @fqcref{ErrorCode_kOK} "kOK").
+ *
+ * Mutation of opaque types (e.g. @ref oa_trait_TraitsData) remains
+ * exclusively via the exported C API.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_BatchBuffersInline_aliases Aliases
+ *
+ * @{
+ */
+#define oa_ConstStringTable_at OPENASSETIO_NS(ConstStringTable_at)
+#define oa_ByteTable_at OPENASSETIO_NS(ByteTable_at)
+#define oa_BatchElementErrors_size OPENASSETIO_NS(BatchElementErrors_size)
+#define oa_BatchElementErrors_message OPENASSETIO_NS(BatchElementErrors_message)
+
+/// @}
+// oa_BatchBuffersInline_aliases
+
+/**
+ * Get a view of a string in a string table.
+ *
+ * @param table String table.
+ * @param idx Index of the string, which must be less than
+ * `table->count`.
+ * @return View of the string, valid for as long as the table's
+ * underlying buffer.
+ */
+static inline oa_ConstStringView oa_ConstStringTable_at(const oa_ConstStringTable* table,
+                                                        const size_t idx) {
+  const oa_ConstStringView view = {table->data + table->offsets[idx],
+                                    table->offsets[idx + 1] - table->offsets[idx]};
+  return view;
+}
+
+/**
+ * Get a view of an element's data in a byte table.
+ *
+ * @param table Byte table, populated by a batch function.
+ * @param idx Index of the element, which must be within the batch and
+ * must have succeeded.
+ * @return View of the element's data, valid for as long as the table's
+ * underlying buffer.
+ */
+static inline oa_ConstStringView oa_ByteTable_at(const oa_ByteTable* table, const size_t idx) {
+  const oa_ConstStringView view = {table->data + table->offsets[idx], table->sizes[idx]};
+  return view;
+}
+
+/**
+ * Get the number of error records that were stored.
+ *
+ * This may be less than `batchErrors->count` if there was insufficient
+ * capacity to store all records.
+ *
+ * @param batchErrors Batch element errors, populated by a batch
+ * function.
+ * @return Number of valid entries in `batchErrors->records`.
+ */
+static inline size_t oa_BatchElementErrors_size(const oa_BatchElementErrors* batchErrors) {
+  return batchErrors->count < batchErrors->capacity ? batchErrors->count
+                                                    : batchErrors->capacity;
+}
+
+/**
+ * Get a view of the message of an error record.
+ *
+ * @param batchErrors Batch element errors, populated by a batch
+ * function.
+ * @param recordIdx Index of the record, which must be less than
+ * @ref oa_BatchElementErrors_size. Note that this is not the index of
+ * the element within the batch, which is instead given by the
+ * record's `index`.
+ * @return View of the (possibly truncated) message, valid for as long
+ * as the underlying `messages` buffer.
+ */
+static inline oa_ConstStringView oa_BatchElementErrors_message(
+    const oa_BatchElementErrors* batchErrors, const size_t recordIdx) {
+  const oa_BatchElementErrorRecord* record = &batchErrors->records[recordIdx];
+  const oa_ConstStringView view = {batchErrors->messages + record->messageOffset,
+                                   record->messageSize};
+  return view;
+}
+
+/// @}
+// oa_BatchBuffersInline
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
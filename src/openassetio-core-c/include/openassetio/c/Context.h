@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+
+#include <openassetio/c/export.h>
+
+#include "./StringView.h"
+#include "./errors.h"
+#include "./namespace.h"
+#include "./trait/TraitsData.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_Context oa_Context
+ *
+ * C API for the \fqref{Context} "Context C++ type".
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_Context_aliases Aliases
+ *
+ * @{
+ */
+#define oa_Context_t OPENASSETIO_NS(Context_t)
+#define oa_Context_h OPENASSETIO_NS(Context_h)
+#define oa_Context_dtor OPENASSETIO_NS(Context_dtor)
+#define oa_Context_locale OPENASSETIO_NS(Context_locale)
+#define oa_Context_setLocale OPENASSETIO_NS(Context_setLocale)
+#define oa_Context_hasManagerState OPENASSETIO_NS(Context_hasManagerState)
+
+/// @}
+// oa_Context_aliases
+
+/**
+ * Opaque handle type representing a shared pointer to a
+ * @fqref{Context} "Context".
+ *
+ * Contexts are created by
+ * @fqcref{hostApi_Manager_createContext} "createContext",
+ * @fqcref{hostApi_Manager_createChildContext} "createChildContext" or
+ * @fqcref{hostApi_Manager_contextFromPersistenceToken}
+ * "contextFromPersistenceToken".
+ *
+ * A Context handle may be used for any number of API calls, and
+ * should be retained and reused by hosts where appropriate, rather
+ * than creating a new Context for each call. This allows the @ref
+ * manager to correlate calls, and avoids the overhead of creating new
+ * @ref manager_state.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct oa_Context_t* oa_Context_h;
+
+/**
+ * Destructor function.
+ *
+ * Releases the @fqref{Context} "Context" pointer represented by the
+ * handle. The handle should not be used after calling this function.
+ */
+OPENASSETIO_CORE_C_EXPORT void oa_Context_dtor(oa_Context_h handle);
+
+/**
+ * Retrieve the @fqref{Context.locale} "locale" of the Context.
+ *
+ * The TraitsData is shared with the Context, rather than copied, so
+ * modifications made via the returned handle will be reflected in the
+ * Context.
+ *
+ * The caller is responsible for deallocating the returned handle via
+ * @fqcref{trait_TraitsData_dtor} "dtor".
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for the handle of the locale.
+ * @param handle Opaque handle representing the Context.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_Context_locale(oa_StringView* err,
+                                                         oa_trait_TraitsData_h* out,
+                                                         oa_Context_h handle);
+
+/**
+ * Set the @fqref{Context.locale} "locale" of the Context.
+ *
+ * The TraitsData is shared with the Context, rather than copied, so
+ * subsequent modifications made via the `locale` handle will be
+ * reflected in the Context. The `locale` handle remains owned by the
+ * caller.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param handle Opaque handle representing the Context.
+ * @param locale Opaque handle to the TraitsData to use as the locale.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_Context_setLocale(oa_StringView* err,
+                                                            oa_Context_h handle,
+                                                            oa_trait_TraitsData_h locale);
+
+/**
+ * Query whether the Context holds @fqref{Context.managerState}
+ * "manager state".
+ *
+ * Manager state is opaque to the host, and is only present if the
+ * manager has the @fqref{hostApi.Manager.Capability.kStatefulContexts}
+ * "kStatefulContexts" capability.
+ *
+ * @param handle Opaque handle representing the Context.
+ * @return Whether the Context has manager state.
+ */
+OPENASSETIO_CORE_C_EXPORT bool oa_Context_hasManagerState(oa_Context_h handle);
+
+/// @}
+// oa_Context
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -48,10 +48,16 @@ extern "C" {
 #define oa_InfoDictionary_getInt OPENASSETIO_NS(InfoDictionary_getInt)
 #define oa_InfoDictionary_getFloat OPENASSETIO_NS(InfoDictionary_getFloat)
 #define oa_InfoDictionary_getStr OPENASSETIO_NS(InfoDictionary_getStr)
+#define oa_InfoDictionary_getStrView OPENASSETIO_NS(InfoDictionary_getStrView)
 #define oa_InfoDictionary_setBool OPENASSETIO_NS(InfoDictionary_setBool)
 #define oa_InfoDictionary_setInt OPENASSETIO_NS(InfoDictionary_setInt)
 #define oa_InfoDictionary_setFloat OPENASSETIO_NS(InfoDictionary_setFloat)
 #define oa_InfoDictionary_setStr OPENASSETIO_NS(InfoDictionary_setStr)
+#define oa_InfoDictionary_Entry OPENASSETIO_NS(InfoDictionary_Entry)
+#define oa_InfoDictionary_Iterator OPENASSETIO_NS(InfoDictionary_Iterator)
+#define oa_InfoDictionary_begin OPENASSETIO_NS(InfoDictionary_begin)
+#define oa_InfoDictionary_next OPENASSETIO_NS(InfoDictionary_next)
+#define oa_InfoDictionary_entries OPENASSETIO_NS(InfoDictionary_entries)
 
 /// @}
 // oa_InfoDictionary_aliases
@@ -204,6 +210,24 @@ OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_InfoDictionary_getStr(oa_StringView* e
                                                                 oa_StringView* out,
                                                                 oa_InfoDictionary_h handle,
                                                                 oa_ConstStringView key);
+
+/**
+ * Retrieve a borrowed view of a string value in the map.
+ *
+ * Unlike @fqcref{InfoDictionary_getStr} "getStr()", the value is not
+ * copied. Instead `out` refers directly to the map's storage, and is
+ * only valid until the map is next modified or destroyed.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Storage for view of retrieved value.
+ * @param handle Opaque handle to InfoDictionary.
+ * @param key Key of entry to query.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_InfoDictionary_getStrView(oa_StringView* error,
+                                                                    oa_ConstStringView* out,
+                                                                    oa_InfoDictionary_h handle,
+                                                                    oa_ConstStringView key);
 /// @}
 // Accessors
 
@@ -273,6 +297,118 @@ OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_InfoDictionary_setStr(oa_StringView* e
 
 /// @}
 // Mutators
+
+/**
+ * @name Iteration
+ *
+ * Functions to enumerate the entries of a `InfoDictionary`, without
+ * knowing its keys in advance.
+ *
+ * Entries refer directly to the keys and string values stored in the
+ * map, so no allocation or copying of strings takes place. As a
+ * consequence, entries (and iterators) are invalidated by any
+ * subsequent modification of the map, and by its destruction.
+ *
+ * The order of entries is unspecified.
+ *
+ * @{
+ */
+
+/**
+ * A single key/value entry of a `InfoDictionary`.
+ *
+ * If `type` is @ref oa_InfoDictionary_ValueType_kStr then the value
+ * is given by `strValue`, otherwise it is given by the corresponding
+ * member of `value`.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Key of the entry.
+  oa_ConstStringView key;
+  /// Type of the entry's value.
+  oa_InfoDictionary_ValueType type;
+  /// Value, if not a string.
+  union {
+    /// Value, if of type `kBool`.
+    bool boolValue;
+    /// Value, if of type `kInt`.
+    int64_t intValue;
+    /// Value, if of type `kFloat`.
+    double floatValue;
+  } value;
+  /// Value, if a string.
+  oa_ConstStringView strValue;
+} oa_InfoDictionary_Entry;
+
+/**
+ * Cursor over the entries of a `InfoDictionary`.
+ *
+ * Storage is provided by the caller (e.g. on the stack), and its
+ * members should be treated as opaque. It is initialised by
+ * @fqcref{InfoDictionary_begin} "begin()" and advanced by
+ * @fqcref{InfoDictionary_next} "next()".
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Reserved, for layout compatibility.
+  size_t bucket;
+  /// Index of the next entry.
+  size_t index;
+} oa_InfoDictionary_Iterator;
+
+/**
+ * Initialise a cursor at the first entry of the map.
+ *
+ * @param[out] out Storage for cursor.
+ * @param handle Opaque handle to InfoDictionary.
+ */
+OPENASSETIO_CORE_C_EXPORT void oa_InfoDictionary_begin(oa_InfoDictionary_Iterator* out,
+                                                       oa_InfoDictionary_h handle);  // noexcept
+
+/**
+ * Retrieve the entry at a cursor, and advance the cursor.
+ *
+ * For example
+ *
+ * @code{.c}
+ * oa_InfoDictionary_Iterator iter;
+ * oa_InfoDictionary_Entry entry;
+ *
+ * oa_InfoDictionary_begin(&iter, handle);
+ * while (oa_InfoDictionary_next(&entry, &iter, handle)) {
+ *   ...
+ * }
+ * @endcode
+ *
+ * @param[out] out Storage for retrieved entry.
+ * @param iterator Cursor initialised by
+ * @fqcref{InfoDictionary_begin} "begin()" for the same `handle`.
+ * @param handle Opaque handle to InfoDictionary.
+ * @return `true` if an entry was retrieved, `false` if the cursor had
+ * reached the end of the map, in which case `out` is unmodified.
+ */
+OPENASSETIO_CORE_C_EXPORT bool oa_InfoDictionary_next(oa_InfoDictionary_Entry* out,
+                                                      oa_InfoDictionary_Iterator* iterator,
+                                                      oa_InfoDictionary_h handle);  // noexcept
+
+/**
+ * Retrieve all entries of the map into a caller-allocated array.
+ *
+ * If the array has insufficient capacity then only the first
+ * `capacity` entries (in iteration order) are retrieved. The total
+ * number of entries is available via @fqcref{InfoDictionary_size}
+ * "size()".
+ *
+ * @param[out] out Storage for retrieved entries.
+ * @param capacity Number of elements in `out`.
+ * @param handle Opaque handle to InfoDictionary.
+ * @return Number of entries retrieved.
+ */
+OPENASSETIO_CORE_C_EXPORT size_t oa_InfoDictionary_entries(
+    oa_InfoDictionary_Entry* out, size_t capacity, oa_InfoDictionary_h handle);  // noexcept
+
+/// @}
+// Iteration
 /// @}
 // oa_InfoDictionary
 /// @}
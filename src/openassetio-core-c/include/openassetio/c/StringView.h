@@ -45,6 +45,13 @@ extern "C" {
  * The underlying buffer is expected to remain valid for at least as
  * long as the `ConstStringView` is in use.
  *
+ * When used as an out-parameter, a `ConstStringView` is "borrowed":
+ * the callee points it at storage owned by the object being queried,
+ * rather than copying into a caller-provided buffer. No copy takes
+ * place, and no capacity need be guessed, but the view is only valid
+ * until the object is next modified or destroyed. The caller should
+ * copy the data if it is needed beyond that point.
+ *
  * Since the struct stores the used size, null-termination is not
  * required, facilitating a wider range of string sources (e.g. from
  * non-C based languages). This also avoids the need to re-measure the
@@ -2,6 +2,8 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <stddef.h>  // NOLINT(modernize-deprecated-headers)
+
 #include <openassetio/errors/errorCodes.h>
 
 #include "./namespace.h"
@@ -34,6 +36,8 @@ extern "C" {
 #define oa_ErrorCode_kOutOfRange OPENASSETIO_NS(ErrorCode_kOutOfRange)
 #define oa_ErrorCode_kLengthError OPENASSETIO_NS(ErrorCode_kLengthError)
 #define oa_ErrorCode OPENASSETIO_NS(ErrorCode)
+#define oa_BatchElementErrorRecord OPENASSETIO_NS(BatchElementErrorRecord)
+#define oa_BatchElementErrors OPENASSETIO_NS(BatchElementErrors)
 
 /// @}
 // oa_ErrorCode_aliases
@@ -54,6 +58,67 @@ typedef enum {
   oa_ErrorCode_kLengthError
 } oa_ErrorCode;
 
+/**
+ * A single failed element of a batch, mirroring
+ * @fqref{errors.BatchElementError} "BatchElementError".
+ *
+ * @see oa_BatchElementErrors
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Index of the element within the batch.
+  size_t index;
+  /// One of the `OPENASSETIO_BatchErrorCode_*` values.
+  int code;
+  /// Offset of the error message within the message buffer.
+  size_t messageOffset;
+  /// Number of bytes of the error message.
+  size_t messageSize;
+} oa_BatchElementErrorRecord;
+
+/**
+ * Caller-allocated storage for the errors of a batch function.
+ *
+ * Only failed elements are recorded, as an array of records, with the
+ * messages of all records concatenated in a single shared buffer. This
+ * means a partially failing batch requires no allocation per element.
+ *
+ * The caller initializes the storage with its capacities and with
+ * sizes of zero, e.g.
+ *
+ * @code{.c}
+ * oa_BatchElementErrorRecord records[kBatchSize];
+ * char messages[4096];
+ *
+ * oa_BatchElementErrors errors {
+ *   kBatchSize, records, 0, 4096, messages, 0
+ * };
+ * @endcode
+ *
+ * The callee appends a record per failed element, in any order, and
+ * increments `count`. `count` is incremented even if there is no
+ * capacity left for the record, so that the caller can detect that
+ * records were dropped. Sizing `records` to the number of elements in
+ * the batch guarantees that all errors are recorded.
+ *
+ * Messages are truncated to fit the remaining capacity of `messages`.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Number of records available for storage.
+  const size_t capacity;
+  /// Writeable array of records.
+  oa_BatchElementErrorRecord* const records;
+  /// Number of errors that occurred, which may exceed `capacity`.
+  size_t count;
+  /// Number of bytes available for storage in `messages`.
+  const size_t messagesCapacity;
+  /// Writeable buffer storing the concatenated error messages.
+  char* const messages;
+  /// Number of bytes used for storage in `messages`.
+  size_t messagesSize;
+} oa_BatchElementErrors;
+
 /// @}
 // oa_ErrorCode
 /// @}
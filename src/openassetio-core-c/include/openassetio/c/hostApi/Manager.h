@@ -2,14 +2,20 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+
 #include <openassetio/c/export.h>
 
+#include "../Arena.h"
+#include "../BatchBuffers.h"
+#include "../Context.h"
 #include "../InfoDictionary.h"
 #include "../StringView.h"
 #include "../errors.h"
 #include "../managerApi/HostSession.h"
 #include "../managerApi/ManagerInterface.h"
 #include "../namespace.h"
+#include "../trait/TraitsData.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +46,16 @@ extern "C" {
 #define oa_hostApi_Manager_identifier OPENASSETIO_NS(hostApi_Manager_identifier)
 #define oa_hostApi_Manager_displayName OPENASSETIO_NS(hostApi_Manager_displayName)
 #define oa_hostApi_Manager_info OPENASSETIO_NS(hostApi_Manager_info)
+#define oa_hostApi_Manager_createContext OPENASSETIO_NS(hostApi_Manager_createContext)
+#define oa_hostApi_Manager_createChildContext OPENASSETIO_NS(hostApi_Manager_createChildContext)
+#define oa_hostApi_Manager_persistenceTokenForContext \
+  OPENASSETIO_NS(hostApi_Manager_persistenceTokenForContext)
+#define oa_hostApi_Manager_contextFromPersistenceToken \
+  OPENASSETIO_NS(hostApi_Manager_contextFromPersistenceToken)
+#define oa_hostApi_Manager_entityExists OPENASSETIO_NS(hostApi_Manager_entityExists)
+#define oa_hostApi_Manager_resolve OPENASSETIO_NS(hostApi_Manager_resolve)
+#define oa_hostApi_Manager_resolveInArena OPENASSETIO_NS(hostApi_Manager_resolveInArena)
+#define oa_hostApi_Manager_entityTraits OPENASSETIO_NS(hostApi_Manager_entityTraits)
 
 /// @}
 // oa_hostApi_Manager_aliases
@@ -139,6 +155,211 @@ OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_info(oa_StringView* er
                                                                oa_InfoDictionary_h out,
                                                                oa_hostApi_Manager_h handle);
 
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.createContext} "createContext"
+ * member function.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for the handle of the new Context, which
+ * should be released by @fqcref{Context_dtor} "dtor" when no longer
+ * in use.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_createContext(
+    oa_StringView* err, oa_Context_h* out, oa_hostApi_Manager_h handle);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.createChildContext} "createChildContext"
+ * member function.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for the handle of the new Context, which
+ * should be released by @fqcref{Context_dtor} "dtor" when no longer
+ * in use.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param parentContext Context to derive the new Context from.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_createChildContext(
+    oa_StringView* err, oa_Context_h* out, oa_hostApi_Manager_h handle,
+    oa_Context_h parentContext);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.persistenceTokenForContext}
+ * "persistenceTokenForContext" member function.
+ *
+ * An `out` parameter with insufficient capacity will result in
+ * nothing being written, `out->size` being set to the size of the
+ * token, and a @fqcref{ErrorCode_kLengthError} "kLengthError" error
+ * code.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for the persistence token.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param context Context to derive a persistence token for.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_persistenceTokenForContext(
+    oa_StringView* err, oa_StringView* out, oa_hostApi_Manager_h handle, oa_Context_h context);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.contextFromPersistenceToken}
+ * "contextFromPersistenceToken" member function.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for the handle of the new Context, which
+ * should be released by @fqcref{Context_dtor} "dtor" when no longer
+ * in use.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param token Persistence token previously returned by
+ * @fqcref{hostApi_Manager_persistenceTokenForContext}
+ * "persistenceTokenForContext".
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_contextFromPersistenceToken(
+    oa_StringView* err, oa_Context_h* out, oa_hostApi_Manager_h handle, oa_ConstStringView token);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.entityExists} "entityExists"
+ * member function.
+ *
+ * Results are written to caller-allocated buffers, with one element
+ * per entity reference, as described in @ref oa_BatchBuffers. Strings
+ * that are not valid entity references for the manager fail with an
+ * `OPENASSETIO_BatchErrorCode_kInvalidEntityReference` code.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] outElementCodes Storage for the code of each element.
+ * @param[out] outErrors Storage for the code and message of each
+ * element that failed with a batch element error (see @ref
+ * oa_BatchElementErrors).
+ * @param[out] outExists Storage for whether each entity exists, for
+ * each element that succeeded.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity reference strings to query.
+ * @param context The calling context.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise, in which case the whole batch failed.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_entityExists(
+    oa_StringView* err, int* outElementCodes, oa_BatchElementErrors* outErrors, bool* outExists,
+    oa_hostApi_Manager_h handle, oa_ConstStringTable entityReferences, oa_Context_h context);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.resolve} "resolve"
+ * member function.
+ *
+ * Results are written to caller-allocated buffers, with one element
+ * per entity reference, as described in @ref oa_BatchBuffers. Strings
+ * that are not valid entity references for the manager fail with an
+ * `OPENASSETIO_BatchErrorCode_kInvalidEntityReference` code.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] outElementCodes Storage for the code of each element.
+ * @param[out] outErrors Storage for the code and message of each
+ * element that failed with a batch element error (see @ref
+ * oa_BatchElementErrors).
+ * @param[out] outTraitsDatas Storage for the resolved data of each
+ * element that succeeded, as a @fqref{trait.TraitsData} "TraitsData"
+ * in the binary format of @fqref{trait.serialization}
+ * "serialization".
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity reference strings to resolve.
+ * @param traitSet IDs of the traits to resolve.
+ * @param resolveAccess Value of the @fqref{access.ResolveAccess}
+ * "ResolveAccess" enumeration.
+ * @param context The calling context.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise, in which case the whole batch failed.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_resolve(
+    oa_StringView* err, int* outElementCodes, oa_BatchElementErrors* outErrors,
+    oa_ByteTable* outTraitsDatas, oa_hostApi_Manager_h handle,
+    oa_ConstStringTable entityReferences, oa_ConstStringTable traitSet, int resolveAccess,
+    oa_Context_h context);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.resolve} "resolve"
+ * member function, returning TraitsData handles allocated in an
+ * arena.
+ *
+ * As @ref oa_hostApi_Manager_resolve, except that the result of each
+ * successful element is returned as a handle to a
+ * @fqref{trait.TraitsData} "TraitsData", rather than serialised to a
+ * caller-allocated buffer. The TraitsData are owned by `arena`, and
+ * are destroyed by @ref oa_Arena_dtor, so must not be passed to
+ * @fqcref{trait_TraitsData_dtor} "dtor".
+ *
+ * Avoids serialisation, and retrying elements that did not fit in the
+ * output buffer, at the cost of the results being opaque.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] outElementCodes Storage for the code of each element.
+ * @param[out] outErrors Storage for the code and message of each
+ * element that failed with a batch element error (see @ref
+ * oa_BatchElementErrors).
+ * @param[out] outTraitsDatas Storage for a handle to the resolved data
+ * of each element. Entries are unspecified for elements that failed.
+ * @param arena Arena in which to allocate the results.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity reference strings to resolve.
+ * @param traitSet IDs of the traits to resolve.
+ * @param resolveAccess Value of the @fqref{access.ResolveAccess}
+ * "ResolveAccess" enumeration.
+ * @param context The calling context.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise, in which case the whole batch failed.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_resolveInArena(
+    oa_StringView* err, int* outElementCodes, oa_BatchElementErrors* outErrors,
+    oa_trait_TraitsData_h* outTraitsDatas, oa_Arena_h arena, oa_hostApi_Manager_h handle,
+    oa_ConstStringTable entityReferences, oa_ConstStringTable traitSet, int resolveAccess,
+    oa_Context_h context);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.entityTraits} "entityTraits"
+ * member function.
+ *
+ * Results are written to caller-allocated buffers, with one element
+ * per entity reference, as described in @ref oa_BatchBuffers. Strings
+ * that are not valid entity references for the manager fail with an
+ * `OPENASSETIO_BatchErrorCode_kInvalidEntityReference` code.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] outElementCodes Storage for the code of each element.
+ * @param[out] outErrors Storage for the code and message of each
+ * element that failed with a batch element error (see @ref
+ * oa_BatchElementErrors).
+ * @param[out] outTraitSets Storage for the trait set of each element
+ * that succeeded, as a @fqref{trait.TraitsData} "TraitsData" with
+ * those traits (and no properties) in the binary format of
+ * @fqref{trait.serialization} "serialization".
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity reference strings to query.
+ * @param entityTraitsAccess Value of the
+ * @fqref{access.EntityTraitsAccess} "EntityTraitsAccess" enumeration.
+ * @param context The calling context.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise, in which case the whole batch failed.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_entityTraits(
+    oa_StringView* err, int* outElementCodes, oa_BatchElementErrors* outErrors,
+    oa_ByteTable* outTraitSets, oa_hostApi_Manager_h handle, oa_ConstStringTable entityReferences,
+    int entityTraitsAccess, oa_Context_h context);
+
 /// @}
 // oa_hostApi_Manager
 /// @}
@@ -2,6 +2,9 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+
+#include "../BatchBuffers.h"
 #include "../InfoDictionary.h"
 #include "../StringView.h"
 #include "../errors.h"
@@ -132,6 +135,107 @@ typedef struct {
    */
   oa_ErrorCode (*info)(oa_StringView* err, oa_InfoDictionary_h out,
                        oa_managerApi_CManagerInterface_h handle);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.entityExists} "entityExists"
+   * member function.
+   *
+   * Results are written to caller-allocated buffers, with one element
+   * per entity reference, as described in @ref oa_BatchBuffers.
+   *
+   * May be `NULL` if the manager does not support this function.
+   *
+   * @todo Provide the Context and HostSession.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] outElementCodes Storage for the code of each element.
+   * @param[out] outErrors Storage for the code and message of each
+   * element that failed with a batch element error (see @ref
+   * oa_BatchElementErrors).
+   * @param[out] outExists Storage for whether each entity exists, for
+   * each element that succeeded.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param entityReferences Entity references to query.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise, in which case the whole batch failed.
+   */
+  oa_ErrorCode (*entityExists)(oa_StringView* err, int* outElementCodes,
+                               oa_BatchElementErrors* outErrors, bool* outExists,
+                               oa_managerApi_CManagerInterface_h handle,
+                               oa_ConstStringTable entityReferences);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.resolve} "resolve"
+   * member function.
+   *
+   * Results are written to caller-allocated buffers, with one element
+   * per entity reference, as described in @ref oa_BatchBuffers.
+   *
+   * May be `NULL` if the manager does not support this function.
+   *
+   * @todo Provide the Context and HostSession.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] outElementCodes Storage for the code of each element.
+   * @param[out] outErrors Storage for the code and message of each
+   * element that failed with a batch element error (see @ref
+   * oa_BatchElementErrors).
+   * @param[out] outTraitsDatas Storage for the resolved data of each
+   * element that succeeded, as a @fqref{trait.TraitsData}
+   * "TraitsData" in the binary format of
+   * @fqref{trait.serialization} "serialization".
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param entityReferences Entity references to resolve.
+   * @param traitSet IDs of the traits to resolve.
+   * @param resolveAccess Value of the
+   * @fqref{access.ResolveAccess} "ResolveAccess" enumeration.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise, in which case the whole batch failed.
+   */
+  oa_ErrorCode (*resolve)(oa_StringView* err, int* outElementCodes,
+                          oa_BatchElementErrors* outErrors, oa_ByteTable* outTraitsDatas,
+                          oa_managerApi_CManagerInterface_h handle,
+                          oa_ConstStringTable entityReferences, oa_ConstStringTable traitSet,
+                          int resolveAccess);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.entityTraits} "entityTraits"
+   * member function.
+   *
+   * Results are written to caller-allocated buffers, with one element
+   * per entity reference, as described in @ref oa_BatchBuffers.
+   *
+   * May be `NULL` if the manager does not support this function.
+   *
+   * @todo Provide the Context and HostSession.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] outElementCodes Storage for the code of each element.
+   * @param[out] outErrors Storage for the code and message of each
+   * element that failed with a batch element error (see @ref
+   * oa_BatchElementErrors).
+   * @param[out] outTraitSets Storage for the trait set of each element
+   * that succeeded, as a @fqref{trait.TraitsData} "TraitsData" with
+   * those traits (and no properties) in the binary format of
+   * @fqref{trait.serialization} "serialization".
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param entityReferences Entity references to query.
+   * @param entityTraitsAccess Value of the
+   * @fqref{access.EntityTraitsAccess} "EntityTraitsAccess"
+   * enumeration.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise, in which case the whole batch failed.
+   */
+  oa_ErrorCode (*entityTraits)(oa_StringView* err, int* outElementCodes,
+                               oa_BatchElementErrors* outErrors, oa_ByteTable* outTraitSets,
+                               oa_managerApi_CManagerInterface_h handle,
+                               oa_ConstStringTable entityReferences, int entityTraitsAccess);
 } oa_managerApi_CManagerInterface_s;
 
 /// @}
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include "../StringView.h"
+#include "../errors.h"
+#include "../managerApi/CManagerInterface.h"
+#include "../namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_pluginSystem_CManagerPlugin oa_pluginSystem_CManagerPlugin
+ *
+ * C API that shared libraries must implement in order to provide a
+ * @ref manager plugin to the C plugin system.
+ *
+ * A plugin library exposes a single entry point function, named by
+ * @ref OPENASSETIO_C_PLUGIN_ENTRY_POINT_NAME, that returns a pointer to
+ * a @fqcref{pluginSystem_CManagerPlugin_s} "plugin suite". The plugin
+ * suite is then used to create instances of the
+ * @fqcref{managerApi_CManagerInterface_s} "ManagerInterface suite".
+ *
+ * Since only C linkage and C types are involved, plugins can be
+ * written in any language able to expose a C ABI.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_pluginSystem_CManagerPlugin_aliases Aliases
+ *
+ * @{
+ */
+#define oa_pluginSystem_CManagerPlugin_s OPENASSETIO_NS(pluginSystem_CManagerPlugin_s)
+#define oa_pluginSystem_CPluginEntryPoint OPENASSETIO_NS(pluginSystem_CPluginEntryPoint)
+
+/// @}
+// oa_pluginSystem_CManagerPlugin_aliases
+
+/**
+ * Name of the entry point function that a C plugin library must
+ * expose.
+ *
+ * The name incorporates the ABI version of the OpenAssetIO C API that
+ * the plugin was built against, i.e. `openassetio_vX_Y_plugin`, such
+ * that libraries built against an incompatible version are not loaded.
+ *
+ * The function must have the signature of @ref
+ * oa_pluginSystem_CPluginEntryPoint.
+ *
+ * @see OPENASSETIO_C_PLUGIN_ENTRY_POINT
+ *
+ * @hideinitializer
+ */
+#define OPENASSETIO_C_PLUGIN_ENTRY_POINT_NAME OPENASSETIO_NS(plugin)
+
+/// @cond
+#if defined(_WIN32)
+#define OPENASSETIO_DETAIL_C_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define OPENASSETIO_DETAIL_C_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+#define OPENASSETIO_DETAIL_C_PLUGIN_LINKAGE extern "C"
+#else
+#define OPENASSETIO_DETAIL_C_PLUGIN_LINKAGE
+#endif
+/// @endcond
+
+/**
+ * Define the entry point of a C plugin library.
+ *
+ * This should be used exactly once, at global scope, in the plugin's
+ * shared library, e.g.
+ *
+ * @code{.c}
+ * static const oa_pluginSystem_CManagerPlugin_s kPlugin = {
+ *     &myPluginIdentifier, &myPluginInstantiate};
+ *
+ * OPENASSETIO_C_PLUGIN_ENTRY_POINT(kPlugin)
+ * @endcode
+ *
+ * @param plugin A @fqcref{pluginSystem_CManagerPlugin_s} "plugin
+ * suite" with static storage duration.
+ *
+ * @hideinitializer
+ */
+#define OPENASSETIO_C_PLUGIN_ENTRY_POINT(plugin)                                        \
+  OPENASSETIO_DETAIL_C_PLUGIN_LINKAGE OPENASSETIO_DETAIL_C_PLUGIN_EXPORT                \
+  const oa_pluginSystem_CManagerPlugin_s* OPENASSETIO_C_PLUGIN_ENTRY_POINT_NAME(void) { \
+    return &(plugin);                                                                   \
+  }
+
+/**
+ * Function pointer suite provided by @ref manager plugins built
+ * against the C API.
+ *
+ * The suite is retrieved once, when the plugin library is loaded. It
+ * must remain valid for as long as the library is loaded, i.e. should
+ * have static storage duration.
+ *
+ * Plugin libraries are never unloaded once a plugin suite has been
+ * retrieved, since instances created by the plugin may still be in
+ * use.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /**
+   * Retrieve the identifier of the @ref manager provided by this
+   * plugin.
+   *
+   * This must match the identifier reported by instances of the
+   * @fqcref{managerApi_CManagerInterface_s} "ManagerInterface suite"
+   * created by @ref instantiate. If several plugins share an
+   * identifier, the first one encountered is used.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] out Storage for the identifier string, if no error
+   * occurred.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*identifier)(oa_StringView* err, oa_StringView* out);
+
+  /**
+   * Create a new instance of the @ref manager provided by this plugin.
+   *
+   * Ownership of the handle is transferred to the caller, which will
+   * release it via the suite's `dtor` function.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] outHandle Storage for the opaque handle of the new
+   * instance.
+   * @param[out] outSuite Storage for the function pointer suite to
+   * use with the new instance.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*instantiate)(oa_StringView* err, oa_managerApi_CManagerInterface_h* outHandle,
+                              oa_managerApi_CManagerInterface_s* outSuite);
+} oa_pluginSystem_CManagerPlugin_s;
+
+/**
+ * Signature of the entry point function that a C plugin library must
+ * expose.
+ *
+ * @return Plugin suite, or `NULL` if the plugin is unavailable.
+ *
+ * @see OPENASSETIO_C_PLUGIN_ENTRY_POINT_NAME
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef const oa_pluginSystem_CManagerPlugin_s* (*oa_pluginSystem_CPluginEntryPoint)(void);
+
+/// @}
+// oa_pluginSystem_CManagerPlugin
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+#include <stddef.h>   // NOLINT(modernize-deprecated-headers)
+#include <stdint.h>   // NOLINT(modernize-deprecated-headers)
+
+#include <openassetio/c/export.h>
+
+#include "../BatchBuffers.h"
+#include "../StringView.h"
+#include "../errors.h"
+#include "../namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_trait_TraitsData oa_trait_TraitsData
+ *
+ * C API for the @fqref{trait.TraitsData} "TraitsData C++ type".
+ *
+ * Trait properties are read and written in bulk, via arrays of
+ * property records, so that a whole TraitsData can be populated or
+ * queried in a single call.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_trait_TraitsData_aliases Aliases
+ *
+ * @{
+ */
+#define oa_trait_TraitsData_t OPENASSETIO_NS(trait_TraitsData_t)
+#define oa_trait_TraitsData_h OPENASSETIO_NS(trait_TraitsData_h)
+#define oa_trait_TraitsData_ValueType_kBool OPENASSETIO_NS(trait_TraitsData_ValueType_kBool)
+#define oa_trait_TraitsData_ValueType_kInt OPENASSETIO_NS(trait_TraitsData_ValueType_kInt)
+#define oa_trait_TraitsData_ValueType_kFloat OPENASSETIO_NS(trait_TraitsData_ValueType_kFloat)
+#define oa_trait_TraitsData_ValueType_kStr OPENASSETIO_NS(trait_TraitsData_ValueType_kStr)
+#define oa_trait_TraitsData_ValueType OPENASSETIO_NS(trait_TraitsData_ValueType)
+#define oa_trait_TraitsData_PrimitiveValue OPENASSETIO_NS(trait_TraitsData_PrimitiveValue)
+#define oa_trait_TraitsData_PropertyKey OPENASSETIO_NS(trait_TraitsData_PropertyKey)
+#define oa_trait_TraitsData_PropertyRecord OPENASSETIO_NS(trait_TraitsData_PropertyRecord)
+#define oa_trait_TraitsData_ctor OPENASSETIO_NS(trait_TraitsData_ctor)
+#define oa_trait_TraitsData_dtor OPENASSETIO_NS(trait_TraitsData_dtor)
+#define oa_trait_TraitsData_deserialize OPENASSETIO_NS(trait_TraitsData_deserialize)
+#define oa_trait_TraitsData_serialize OPENASSETIO_NS(trait_TraitsData_serialize)
+#define oa_trait_TraitsData_addTraits OPENASSETIO_NS(trait_TraitsData_addTraits)
+#define oa_trait_TraitsData_setProperties OPENASSETIO_NS(trait_TraitsData_setProperties)
+#define oa_trait_TraitsData_getProperties OPENASSETIO_NS(trait_TraitsData_getProperties)
+#define oa_trait_TraitsData_getStrView OPENASSETIO_NS(trait_TraitsData_getStrView)
+
+/// @}
+// oa_trait_TraitsData_aliases
+
+/**
+ * Opaque handle type representing a shared pointer to a
+ * @fqref{trait.TraitsData} "TraitsData".
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct oa_trait_TraitsData_t* oa_trait_TraitsData_h;
+
+/**
+ * Enumeration of the available types of trait property values.
+ *
+ * The set of possible types is dictated by the
+ * @fqref{trait.property.Value} "property value variant", so this enum
+ * is exhaustive.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef enum {
+  /// Boolean value type
+  oa_trait_TraitsData_ValueType_kBool = 1,
+  /// Integer value type
+  oa_trait_TraitsData_ValueType_kInt,
+  /// Floating point value type
+  oa_trait_TraitsData_ValueType_kFloat,
+  /// String value type
+  oa_trait_TraitsData_ValueType_kStr
+} oa_trait_TraitsData_ValueType;
+
+/**
+ * Storage for a non-string trait property value.
+ *
+ * The active member is determined by an accompanying
+ * @ref oa_trait_TraitsData_ValueType.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef union {
+  /// Value, if of type `kBool`.
+  bool boolValue;
+  /// Value, if of type `kInt`.
+  int64_t intValue;
+  /// Value, if of type `kFloat`.
+  double floatValue;
+} oa_trait_TraitsData_PrimitiveValue;
+
+/**
+ * Identifies a single trait property.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// ID of the trait.
+  oa_ConstStringView traitId;
+  /// Key of the property within the trait.
+  oa_ConstStringView key;
+} oa_trait_TraitsData_PropertyKey;
+
+/**
+ * A trait property along with its value.
+ *
+ * If `type` is @ref oa_trait_TraitsData_ValueType_kStr then the value
+ * is given by `strValue`, otherwise it is given by the corresponding
+ * member of `value`.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Property to which the value belongs.
+  oa_trait_TraitsData_PropertyKey property;
+  /// Type of the value.
+  oa_trait_TraitsData_ValueType type;
+  /// Value, if not a string.
+  oa_trait_TraitsData_PrimitiveValue value;
+  /// Value, if a string.
+  oa_ConstStringView strValue;
+} oa_trait_TraitsData_PropertyRecord;
+
+/**
+ * Constructor function, creating an empty TraitsData.
+ *
+ * The caller is responsible for deallocating via `dtor`.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Opaque handle to TraitsData.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_ctor(oa_StringView* err,
+                                                                oa_trait_TraitsData_h* out);
+
+/**
+ * Destructor function.
+ *
+ * Releases the TraitsData pointer represented by the handle. The
+ * handle should not be used after calling this function.
+ *
+ * @param handle Opaque handle to TraitsData.
+ */
+OPENASSETIO_CORE_C_EXPORT void oa_trait_TraitsData_dtor(oa_trait_TraitsData_h handle);
+
+/**
+ * Constructor function, creating a TraitsData from the binary format
+ * of @fqref{trait.serialization} "serialization".
+ *
+ * The caller is responsible for deallocating via `dtor`.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Opaque handle to TraitsData.
+ * @param bytes Serialised TraitsData.
+ * @return Error code. A malformed buffer will result in a
+ * @fqcref{ErrorCode_kException} "kException" error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_deserialize(oa_StringView* err,
+                                                                       oa_trait_TraitsData_h* out,
+                                                                       oa_ConstStringView bytes);
+
+/**
+ * Write the TraitsData in the binary format of
+ * @fqref{trait.serialization} "serialization".
+ *
+ * An `out` parameter with insufficient capacity will result in
+ * nothing being written, `out->size` being set to the number of bytes
+ * required, and a @fqcref{ErrorCode_kLengthError} "kLengthError"
+ * error code.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for serialised bytes.
+ * @param handle Opaque handle to TraitsData.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_serialize(oa_StringView* err,
+                                                                     oa_StringView* out,
+                                                                     oa_trait_TraitsData_h handle);
+
+/**
+ * Add traits, without any properties.
+ *
+ * Traits that are already present are unaffected.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitIds IDs of traits to add.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_addTraits(
+    oa_StringView* err, oa_trait_TraitsData_h handle, oa_ConstStringTable traitIds);
+
+/**
+ * Set the values of multiple trait properties.
+ *
+ * Traits are added as required, and existing values are overwritten,
+ * even if the previous value had a different type. Records are applied
+ * in order, so later records take precedence.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param handle Opaque handle to TraitsData.
+ * @param records Array of properties and values to set.
+ * @param count Number of elements in `records`.
+ * @return Error code. An unknown value type will result in a
+ * @fqcref{ErrorCode_kException} "kException" error code, with records
+ * before it having been applied.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_setProperties(
+    oa_StringView* err, oa_trait_TraitsData_h handle,
+    const oa_trait_TraitsData_PropertyRecord* records, size_t count);
+
+/**
+ * Get the values of multiple trait properties.
+ *
+ * Each of the `out` arrays must have `count` elements, and the string
+ * table must have storage for `count` elements (see @ref
+ * oa_BatchBuffers).
+ *
+ * The code of each element is @fqcref{ErrorCode_kOK} "kOK" if the
+ * value was retrieved, @fqcref{ErrorCode_kOutOfRange} "kOutOfRange" if
+ * the property is not set, or @fqcref{ErrorCode_kLengthError}
+ * "kLengthError" if the value is a string that did not fit in the
+ * remaining capacity of `outStrValues`.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] outCodes Storage for the code of each element.
+ * @param[out] outTypes Storage for the type of each retrieved value.
+ * @param[out] outValues Storage for each retrieved non-string value.
+ * @param[out] outStrValues Storage for each retrieved string value.
+ * @param handle Opaque handle to TraitsData.
+ * @param properties Array of properties to query.
+ * @param count Number of elements in `properties`.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_getProperties(
+    oa_StringView* err, int* outCodes, oa_trait_TraitsData_ValueType* outTypes,
+    oa_trait_TraitsData_PrimitiveValue* outValues, oa_ByteTable* outStrValues,
+    oa_trait_TraitsData_h handle, const oa_trait_TraitsData_PropertyKey* properties,
+    size_t count);
+
+/**
+ * Retrieve a borrowed view of a string trait property value.
+ *
+ * The value is not copied. Instead `out` refers directly to the
+ * TraitsData's storage, and is only valid until the TraitsData is
+ * next modified or destroyed.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for view of retrieved value.
+ * @param handle Opaque handle to TraitsData.
+ * @param property Property to query.
+ * @return Error code. An unset property will result in a
+ * @fqcref{ErrorCode_kOutOfRange} "kOutOfRange" error code, and a value
+ * that is not a string will result in a
+ * @fqcref{ErrorCode_kBadVariantAccess} "kBadVariantAccess" error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_getStrView(
+    oa_StringView* err, oa_ConstStringView* out, oa_trait_TraitsData_h handle,
+    oa_trait_TraitsData_PropertyKey property);
+
+/// @}
+// oa_trait_TraitsData
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+
+#include <openassetio/c/Arena.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+
+#include "errors.hpp"
+#include "handles/Arena.hpp"
+
+namespace errors = openassetio::errors;
+namespace handles = openassetio::handles;
+
+extern "C" {
+
+oa_ErrorCode oa_Arena_ctor(oa_StringView* err, oa_Arena_h* out, const std::size_t blockSize) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    *out = handles::Arena::toHandle(new openassetio::Arena{blockSize});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+void oa_Arena_dtor(oa_Arena_h handle) { delete handles::Arena::release(handle); }
+}  // extern "C"
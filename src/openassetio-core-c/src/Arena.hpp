@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Bump allocator owning objects created on behalf of the C API.
+ *
+ * Memory is carved out of large blocks, and objects are destroyed in
+ * reverse order of creation when the arena is destroyed, rather than
+ * individually.
+ *
+ * Not thread-safe.
+ */
+class Arena {
+ public:
+  /// Default size, in bytes, of each block of memory.
+  static constexpr std::size_t kDefaultBlockSize = 16 * 1024;
+
+  /**
+   * Construct an empty arena.
+   *
+   * @param blockSize Size of each block of memory, or zero for
+   * @ref kDefaultBlockSize.
+   */
+  explicit Arena(std::size_t blockSize = kDefaultBlockSize)
+      : blockSize_{blockSize == 0 ? kDefaultBlockSize : blockSize} {}
+
+  Arena(const Arena&) = delete;
+  Arena(Arena&&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  ~Arena() {
+    for (auto cleanup = cleanups_.rbegin(); cleanup != cleanups_.rend(); ++cleanup) {
+      cleanup->fn(cleanup->ptr);
+    }
+  }
+
+  /**
+   * Construct an object within the arena.
+   *
+   * @return Pointer to the object, valid for the lifetime of the
+   * arena.
+   */
+  template <class T, class... Args>
+  T* make(Args&&... args) {
+    // Ensure registering the destructor cannot fail after construction.
+    cleanups_.reserve(cleanups_.size() + 1);
+    T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      cleanups_.push_back({[](void* ptr) { static_cast<T*>(ptr)->~T(); }, obj});
+    }
+    return obj;
+  }
+
+  /**
+   * Construct an object within the arena and return a C handle to it.
+   *
+   * The handle is released, using the converter, when the arena is
+   * destroyed.
+   *
+   * @tparam Converter @ref handles::Converter for the object's type.
+   * @return Handle to the object, valid for the lifetime of the arena.
+   */
+  template <class Converter, class... Args>
+  auto makeHandle(Args&&... args) {
+    using Type = std::remove_pointer_t<decltype(Converter::toInstance(nullptr))>;
+    Type* obj = make<Type>(std::forward<Args>(args)...);
+
+    cleanups_.reserve(cleanups_.size() + 1);
+    auto handle = Converter::toHandle(obj);
+    // Run before the object's destructor, since cleanups are reversed.
+    cleanups_.push_back({[](void* ptr) { Converter::release(static_cast<decltype(handle)>(ptr)); },
+                         static_cast<void*>(handle)});
+    return handle;
+  }
+
+ private:
+  /// Allocate uninitialised, suitably aligned, storage.
+  void* allocate(const std::size_t size, const std::size_t alignment) {
+    void* ptr = current_;
+    if (ptr == nullptr || std::align(alignment, size, ptr, remaining_) == nullptr) {
+      // Oversized allocations get a block of their own.
+      const std::size_t blockSize = std::max(blockSize_, size + alignment);
+      blocks_.push_back(std::make_unique<std::byte[]>(blockSize));
+      ptr = blocks_.back().get();
+      remaining_ = blockSize;
+      std::align(alignment, size, ptr, remaining_);
+    }
+    current_ = static_cast<std::byte*>(ptr) + size;
+    remaining_ -= size;
+    return ptr;
+  }
+
+  /// Function to call on destruction of the arena.
+  struct Cleanup {
+    void (*fn)(void*);
+    void* ptr;
+  };
+
+  std::size_t blockSize_;
+  std::vector<std::unique_ptr<std::byte[]>> blocks_;
+  void* current_{nullptr};
+  std::size_t remaining_{0};
+  std::vector<Cleanup> cleanups_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
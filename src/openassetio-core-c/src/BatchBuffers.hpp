@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/c/BatchBuffers.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/export.h>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Owning storage for a C string table.
+ */
+class StringTable {
+ public:
+  /**
+   * Construct from a range of elements, each converted to a string by
+   * the given function.
+   */
+  template <class Range, class ToString>
+  StringTable(const Range& range, const ToString& toString) {
+    offsets_.reserve(range.size() + 1);
+    offsets_.push_back(0);
+    for (const auto& element : range) {
+      data_ += toString(element);
+      offsets_.push_back(data_.size());
+    }
+  }
+
+  /// Get a C view of the table, valid for the lifetime of this object.
+  [[nodiscard]] oa_ConstStringTable view() const {
+    return {data_.data(), offsets_.data(), offsets_.size() - 1};
+  }
+
+ private:
+  Str data_;
+  std::vector<std::size_t> offsets_;
+};
+
+/**
+ * Get an element of a C string table.
+ *
+ * @param table Table to query.
+ * @param idx Index of element, which must be less than `count`.
+ * @return View of the string.
+ */
+inline std::string_view stringTableElement(const oa_ConstStringTable& table,
+                                           const std::size_t idx) {
+  return {table.data + table.offsets[idx], table.offsets[idx + 1] - table.offsets[idx]};
+}
+
+/**
+ * Owning storage for a C byte table.
+ */
+class ByteTable {
+ public:
+  /**
+   * Allocate storage.
+   *
+   * @param count Number of elements.
+   * @param capacity Number of bytes available for element data.
+   */
+  ByteTable(const std::size_t count, const std::size_t capacity)
+      : data_(capacity), offsets_(count), sizes_(count) {}
+
+  /**
+   * Get a C view of the (currently empty) table, valid for the
+   * lifetime of this object.
+   */
+  [[nodiscard]] oa_ByteTable view() {
+    return {data_.size(), data_.data(), 0, offsets_.data(), sizes_.data()};
+  }
+
+  /**
+   * Get an element written via a view.
+   *
+   * @param idx Index of element.
+   * @return View of the element's data.
+   * @exception errors.InputValidationException If the position that
+   * was recorded for the element is outside of the buffer.
+   */
+  [[nodiscard]] std::string_view element(const std::size_t idx) const {
+    if (offsets_[idx] > data_.size() || sizes_[idx] > data_.size() - offsets_[idx]) {
+      throw errors::InputValidationException{"Byte table element is out of bounds"};
+    }
+    return {data_.data() + offsets_[idx], sizes_[idx]};
+  }
+
+  /// Get the number of bytes recorded for an element, e.g. the number
+  /// required, if it didn't fit.
+  [[nodiscard]] std::size_t elementSize(const std::size_t idx) const { return sizes_[idx]; }
+
+ private:
+  std::vector<char> data_;
+  std::vector<std::size_t> offsets_;
+  std::vector<std::size_t> sizes_;
+};
+
+/**
+ * Append an element to a C byte table.
+ *
+ * If there is insufficient remaining capacity, then nothing is
+ * appended and the required size is recorded for the element instead.
+ *
+ * @param table Table to append to.
+ * @param idx Index of element.
+ * @param bytes Data of element.
+ * @return Whether the element was appended.
+ */
+inline bool appendByteTableElement(oa_ByteTable* table, const std::size_t idx,
+                                   const std::string_view bytes) {
+  table->sizes[idx] = bytes.size();
+  if (bytes.size() > table->capacity - table->size) {
+    return false;
+  }
+  table->offsets[idx] = table->size;
+  if (!bytes.empty()) {
+    std::memcpy(table->data + table->size, bytes.data(), bytes.size());
+  }
+  table->size += bytes.size();
+  return true;
+}
+
+/**
+ * Owning storage for C batch element errors.
+ */
+class BatchElementErrors {
+ public:
+  /**
+   * Allocate storage.
+   *
+   * @param capacity Number of records.
+   * @param messagesCapacity Number of bytes available for messages.
+   */
+  BatchElementErrors(const std::size_t capacity, const std::size_t messagesCapacity)
+      : records_(capacity), messages_(messagesCapacity) {}
+
+  /**
+   * Get a C view of the (currently empty) storage, valid for the
+   * lifetime of this object.
+   */
+  [[nodiscard]] oa_BatchElementErrors view() {
+    return {records_.size(), records_.data(), 0, messages_.size(), messages_.data(), 0};
+  }
+
+ private:
+  std::vector<oa_BatchElementErrorRecord> records_;
+  std::vector<char> messages_;
+};
+
+/**
+ * Append an error to C batch element error storage.
+ *
+ * The message is truncated to the remaining capacity, if necessary. If
+ * there is no capacity for the record, only the count is incremented.
+ *
+ * @param batchErrors Storage to append to.
+ * @param idx Index of element.
+ * @param error Error of element.
+ */
+inline void appendBatchElementError(oa_BatchElementErrors* batchErrors, const std::size_t idx,
+                                    const errors::BatchElementError& error) {
+  const std::size_t recordIdx = batchErrors->count++;
+  if (recordIdx >= batchErrors->capacity) {
+    return;
+  }
+  const std::size_t messageSize =
+      std::min(error.message.size(), batchErrors->messagesCapacity - batchErrors->messagesSize);
+
+  oa_BatchElementErrorRecord& record = batchErrors->records[recordIdx];
+  record.index = idx;
+  record.code = static_cast<int>(error.code);
+  record.messageOffset = batchErrors->messagesSize;
+  record.messageSize = messageSize;
+
+  if (messageSize != 0) {
+    std::memcpy(batchErrors->messages + batchErrors->messagesSize, error.message.data(),
+                messageSize);
+  }
+  batchErrors->messagesSize += messageSize;
+}
+
+/**
+ * Call a function for each error recorded in C batch element error
+ * storage.
+ *
+ * @param batchErrors Storage written by a C API function.
+ * @param batchSize Number of elements in the batch.
+ * @param visitor Callable taking the index of the element and its
+ * BatchElementError.
+ * @exception errors.InputValidationException If records were dropped
+ * for lack of capacity, or a record is out of bounds.
+ */
+template <class Visitor>
+void forEachBatchElementError(const oa_BatchElementErrors& batchErrors,
+                              const std::size_t batchSize, const Visitor& visitor) {
+  if (batchErrors.count > batchErrors.capacity) {
+    throw errors::InputValidationException{"Batch element errors exceed the storage capacity"};
+  }
+  for (std::size_t recordIdx = 0; recordIdx < batchErrors.count; ++recordIdx) {
+    const oa_BatchElementErrorRecord& record = batchErrors.records[recordIdx];
+    if (record.index >= batchSize || record.messageOffset > batchErrors.messagesSize ||
+        record.messageSize > batchErrors.messagesSize - record.messageOffset) {
+      throw errors::InputValidationException{"Batch element error is out of bounds"};
+    }
+    visitor(record.index, errors::BatchElementError{
+                              static_cast<errors::BatchElementError::ErrorCode>(record.code),
+                              Str{batchErrors.messages + record.messageOffset,
+                                  record.messageSize}});
+  }
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
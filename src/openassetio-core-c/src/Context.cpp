@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <openassetio/c/Context.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/trait/TraitsData.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "errors.hpp"
+#include "handles/Context.hpp"
+#include "handles/trait/TraitsData.hpp"
+
+namespace errors = openassetio::errors;
+namespace handles = openassetio::handles;
+namespace trait = openassetio::trait;
+
+extern "C" {
+
+void oa_Context_dtor(oa_Context_h handle) { delete handles::SharedContext::release(handle); }
+
+oa_ErrorCode oa_Context_locale(oa_StringView* err, oa_trait_TraitsData_h* out,
+                               oa_Context_h handle) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const openassetio::ContextPtr& context = *handles::SharedContext::toInstance(handle);
+    *out = handles::trait::SharedTraitsData::toHandle(new trait::TraitsDataPtr{context->locale});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_Context_setLocale(oa_StringView* err, oa_Context_h handle,
+                                  oa_trait_TraitsData_h locale) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const trait::TraitsDataPtr& traitsData = *handles::trait::SharedTraitsData::toInstance(locale);
+    if (!traitsData) {
+      throw errors::InputValidationException{"Locale must not be null"};
+    }
+    (*handles::SharedContext::toInstance(handle))->locale = traitsData;
+    return oa_ErrorCode_kOK;
+  });
+}
+
+bool oa_Context_hasManagerState(oa_Context_h handle) {
+  return static_cast<bool>((*handles::SharedContext::toInstance(handle))->managerState);
+}
+}  // extern "C"
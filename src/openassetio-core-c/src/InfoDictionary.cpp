@@ -1,6 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <iterator>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
@@ -111,6 +115,62 @@ oa_ErrorCode set(oa_StringView *err, oa_InfoDictionary_h handle, const oa_ConstS
     return oa_ErrorCode_kOK;
   });
 }
+
+/**
+ * Get the C enumeration value corresponding to the type held by a
+ * InfoDictionary value.
+ *
+ * @param value Value to query.
+ * @return Type of value.
+ */
+oa_InfoDictionary_ValueType valueTypeOf(const openassetio::InfoDictionaryValue &value) {
+  return std::visit(
+      [](auto &&typedValue) {
+        using ValueType = std::decay_t<decltype(typedValue)>;
+        if constexpr (std::is_same_v<ValueType, openassetio::Bool>) {
+          return oa_InfoDictionary_ValueType_kBool;
+        } else if constexpr (std::is_same_v<ValueType, openassetio::Int>) {
+          return oa_InfoDictionary_ValueType_kInt;
+        } else if constexpr (std::is_same_v<ValueType, openassetio::Float>) {
+          return oa_InfoDictionary_ValueType_kFloat;
+        } else if constexpr (std::is_same_v<ValueType, openassetio::Str>) {
+          return oa_InfoDictionary_ValueType_kStr;
+        } else {
+          static_assert(kAlwaysFalse<ValueType>, "Unhandled variant type");
+        }
+      },
+      value);
+}
+
+/**
+ * Write a map entry to a C entry out-parameter.
+ *
+ * Views in the written entry refer directly to the map's storage.
+ *
+ * @param out Storage for entry.
+ * @param entry Key/value pair of map.
+ */
+void writeEntry(oa_InfoDictionary_Entry *out, const InfoDictionary::value_type &entry) {
+  const auto &[key, value] = entry;
+  const oa_InfoDictionary_ValueType type = valueTypeOf(value);
+  const openassetio::Str *str = std::get_if<openassetio::Str>(&value);
+
+  // Members of C string views are const, so the entry cannot be
+  // assigned to, and must instead be constructed in place.
+  auto *cEntry = new (out) oa_InfoDictionary_Entry{
+      {key.data(), key.size()},
+      type,
+      {},
+      str != nullptr ? oa_ConstStringView{str->data(), str->size()} : oa_ConstStringView{}};
+
+  if (const auto *boolValue = std::get_if<openassetio::Bool>(&value)) {
+    cEntry->value.boolValue = *boolValue;
+  } else if (const auto *intValue = std::get_if<openassetio::Int>(&value)) {
+    cEntry->value.intValue = *intValue;
+  } else if (const auto *floatValue = std::get_if<openassetio::Float>(&value)) {
+    cEntry->value.floatValue = *floatValue;
+  }
+}
 }  // namespace
 
 extern "C" {
@@ -123,7 +183,7 @@ oa_ErrorCode oa_InfoDictionary_ctor(oa_StringView *err, oa_InfoDictionary_h *out
 }
 
 void oa_InfoDictionary_dtor(oa_InfoDictionary_h handle) {
-  delete handles::InfoDictionary::toInstance(handle);
+  delete handles::InfoDictionary::release(handle);
 }
 
 std::size_t oa_InfoDictionary_size(oa_InfoDictionary_h handle) {
@@ -134,24 +194,7 @@ oa_ErrorCode oa_InfoDictionary_typeOf(oa_StringView *err, oa_InfoDictionary_Valu
                                       oa_InfoDictionary_h handle, const oa_ConstStringView key) {
   return catchCommonExceptionAsCode(err, [&] {
     const InfoDictionary *infoDictionary = handles::InfoDictionary::toInstance(handle);
-
-    std::visit(
-        [&out](auto &&value) {
-          using ValueType = std::decay_t<decltype(value)>;
-          if constexpr (std::is_same_v<ValueType, openassetio::Bool>) {
-            *out = oa_InfoDictionary_ValueType_kBool;
-          } else if constexpr (std::is_same_v<ValueType, openassetio::Int>) {
-            *out = oa_InfoDictionary_ValueType_kInt;
-          } else if constexpr (std::is_same_v<ValueType, openassetio::Float>) {
-            *out = oa_InfoDictionary_ValueType_kFloat;
-          } else if constexpr (std::is_same_v<ValueType, openassetio::Str>) {
-            *out = oa_InfoDictionary_ValueType_kStr;
-          } else {
-            static_assert(kAlwaysFalse<ValueType>, "Unhandled variant type");
-          }
-        },
-        infoDictionary->at({key.data, key.size}));
-
+    *out = valueTypeOf(infoDictionary->at({key.data, key.size}));
     return oa_ErrorCode_kOK;
   });
 }
@@ -190,6 +233,23 @@ oa_ErrorCode oa_InfoDictionary_getStr(oa_StringView *err, oa_StringView *out,
   return oa_ErrorCode_kOK;
 }
 
+oa_ErrorCode oa_InfoDictionary_getStrView(oa_StringView *err, oa_ConstStringView *out,
+                                          oa_InfoDictionary_h handle,
+                                          const oa_ConstStringView key) {
+  const InfoDictionary *infoDictionary = handles::InfoDictionary::toInstance(handle);
+
+  return catchCommonExceptionAsCode(err, [&] {
+    const auto *str = std::get_if<openassetio::Str>(&infoDictionary->at({key.data, key.size}));
+    if (str == nullptr) {
+      openassetio::assignStringView(err, "Invalid value type");
+      return oa_ErrorCode_kBadVariantAccess;
+    }
+    openassetio::borrowStringView(out, *str);
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
 oa_ErrorCode oa_InfoDictionary_setBool(oa_StringView *err, oa_InfoDictionary_h handle,
                                        const oa_ConstStringView key,
                                        const openassetio::Bool value) {
@@ -215,4 +275,39 @@ oa_ErrorCode oa_InfoDictionary_setStr(oa_StringView *err, oa_InfoDictionary_h ha
     return oa_ErrorCode_kOK;
   });
 }
+
+void oa_InfoDictionary_begin(oa_InfoDictionary_Iterator *out,
+                             [[maybe_unused]] oa_InfoDictionary_h handle) {
+  out->bucket = 0;
+  out->index = 0;
+}
+
+bool oa_InfoDictionary_next(oa_InfoDictionary_Entry *out, oa_InfoDictionary_Iterator *iterator,
+                            oa_InfoDictionary_h handle) {
+  // Store an index in the cursor, rather than an iterator, since the
+  // layout of iterators is implementation defined (e.g. checked
+  // iterators in MSVC debug builds).
+  const InfoDictionary *infoDictionary = handles::InfoDictionary::toInstance(handle);
+
+  if (iterator->index >= infoDictionary->size()) {
+    return false;
+  }
+  auto entry = infoDictionary->cbegin();
+  std::advance(entry, iterator->index);
+  writeEntry(out, *entry);
+  ++iterator->index;
+  return true;
+}
+
+std::size_t oa_InfoDictionary_entries(oa_InfoDictionary_Entry *out, const std::size_t capacity,
+                                      oa_InfoDictionary_h handle) {
+  oa_InfoDictionary_Iterator iterator;
+  oa_InfoDictionary_begin(&iterator, handle);
+
+  std::size_t count = 0;
+  while (count < capacity && oa_InfoDictionary_next(&out[count], &iterator, handle)) {
+    ++count;
+  }
+  return count;
+}
 }  // extern "C"
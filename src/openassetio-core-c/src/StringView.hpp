@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <new>
+#include <string_view>
 
 #include <openassetio/c/StringView.h>
 #include <openassetio/export.h>
@@ -23,5 +25,19 @@ inline void assignStringView(oa_StringView* dest, const std::string_view src) {
   dest->size = std::min(src.size(), dest->capacity);
   strncpy(dest->data, src.data(), dest->size);
 }
+
+/**
+ * Point a destination C ConstStringView at a source string, without
+ * copying.
+ *
+ * The members of a ConstStringView are const, so it cannot be
+ * assigned to, and is instead constructed in place.
+ *
+ * @param dest Target view.
+ * @param src Source string, which must outlive the view.
+ */
+inline void borrowStringView(oa_ConstStringView* dest, const std::string_view src) {
+  new (dest) oa_ConstStringView{src.data(), src.size()};
+}
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
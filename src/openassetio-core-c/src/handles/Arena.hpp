@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <openassetio/c/Arena.h>
+#include <openassetio/export.h>
+
+#include "../Arena.hpp"
+#include "Converter.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace handles {
+using Arena = Converter<Arena, oa_Arena_h>;
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -4,6 +4,13 @@
 
 #include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
 
+#if defined(OPENASSETIO_C_CHECKED_HANDLES)
+#include <cstdint>
+#include <typeinfo>
+
+#include "HandleRegistry.hpp"
+#endif
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 /**
@@ -13,11 +20,56 @@ namespace handles {
 /**
  * Convert between C++ types and C opaque handles for those types.
  *
+ * By default handles are simply reinterpreted pointers. If built with
+ * `OPENASSETIO_C_CHECKED_HANDLES` defined (see the
+ * `OPENASSETIO_ENABLE_C_CHECKED_HANDLES` CMake option), handles are
+ * instead issued by the @ref HandleRegistry, such that use of a
+ * released (or otherwise invalid) handle aborts with a diagnostic
+ * rather than invoking undefined behaviour.
+ *
+ * Every handle created via @ref toHandle should eventually be passed
+ * to @ref release, including handles that are only borrowed for the
+ * duration of a call.
+ *
  * @tparam Type C++ type.
  * @tparam Handle Opaque handle type.
  */
 template <class Type, class Handle>
 struct Converter {
+#if defined(OPENASSETIO_C_CHECKED_HANDLES)
+  static_assert(sizeof(Handle) >= sizeof(HandleRegistry::Value),
+                "Checked C handles require 64-bit pointers");
+
+  static Handle toHandle(Type* ptr) {
+    if (ptr == nullptr) {
+      return nullptr;
+    }
+    // Constness is restored on conversion back to an instance.
+    void* mutablePtr = const_cast<void*>(static_cast<const void*>(ptr));
+    return reinterpret_cast<Handle>(
+        static_cast<std::uintptr_t>(HandleRegistry::acquire(mutablePtr, typeid(Type))));
+  }
+
+  static Type* toInstance(Handle handle) {
+    if (handle == nullptr) {
+      return nullptr;
+    }
+    return static_cast<Type*>(HandleRegistry::lookup(toValue(handle), typeid(Type)));
+  }
+
+  static Type* release(Handle handle) {
+    if (handle == nullptr) {
+      return nullptr;
+    }
+    return static_cast<Type*>(HandleRegistry::release(toValue(handle), typeid(Type)));
+  }
+
+ private:
+  static HandleRegistry::Value toValue(Handle handle) {
+    return static_cast<HandleRegistry::Value>(reinterpret_cast<std::uintptr_t>(handle));
+  }
+
+#else
   /**
    * Convert a pointer to a C++ instance to a handle.
    *
@@ -33,6 +85,19 @@ struct Converter {
    * @return Pointer to C++ instance.
    */
   static Type* toInstance(Handle handle) { return reinterpret_cast<Type*>(handle); }
+
+  /**
+   * Convert a handle back to the underlying C++ instance, invalidating
+   * the handle.
+   *
+   * Ownership of the instance is unaffected, i.e. the caller must
+   * still destroy the instance if appropriate.
+   *
+   * @param handle Handle to unpack.
+   * @return Pointer to C++ instance.
+   */
+  static Type* release(Handle handle) { return reinterpret_cast<Type*>(handle); }
+#endif
 };
 }  // namespace handles
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <typeinfo>
+
+#include <fmt/core.h>
+
+#include "HandleRegistry.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace handles {
+namespace {
+/*
+ * Handle values are encoded as `(generation << 32) | (index + 1)`,
+ * such that a zero value is never a valid handle. A slot's generation
+ * is odd whilst a handle to it is live, and is incremented both when
+ * the slot is acquired and when it is released.
+ *
+ * The free list head is similarly encoded as `(tag << 32) | (index +
+ * 1)`, where the tag is incremented on every update to avoid ABA
+ * problems.
+ */
+constexpr std::size_t kChunkBits = 12;
+constexpr std::size_t kChunkSize = std::size_t{1} << kChunkBits;
+constexpr std::size_t kMaxChunks = 4096;
+constexpr std::size_t kMaxSlots = kChunkSize * kMaxChunks;
+constexpr std::uint64_t kLowMask = 0xFFFFFFFF;
+
+struct Slot {
+  std::atomic<std::uint32_t> generation{0};
+  std::atomic<void*> ptr{nullptr};
+  std::atomic<const std::type_info*> type{nullptr};
+  /// Encoded index of the next free slot, if this slot is free.
+  std::atomic<std::uint32_t> nextFree{0};
+};
+
+std::array<std::atomic<Slot*>, kMaxChunks> gChunks{};
+std::atomic<std::size_t> gNextFreshIdx{0};
+std::atomic<std::uint64_t> gFreeHead{0};
+
+Slot* slotAt(const std::size_t idx) {
+  std::atomic<Slot*>& chunkPtr = gChunks[idx >> kChunkBits];
+  Slot* chunk = chunkPtr.load(std::memory_order_acquire);
+  if (chunk == nullptr) {
+    // Chunks are never freed, since a stale handle may refer to them.
+    auto* newChunk = new Slot[kChunkSize];
+    if (chunkPtr.compare_exchange_strong(chunk, newChunk, std::memory_order_acq_rel)) {
+      chunk = newChunk;
+    } else {
+      delete[] newChunk;
+    }
+  }
+  return &chunk[idx & (kChunkSize - 1)];
+}
+
+const char* statusName(const HandleRegistry::Status status) {
+  switch (status) {
+    case HandleRegistry::Status::kOk:
+      return "valid";
+    case HandleRegistry::Status::kInvalid:
+      return "invalid";
+    case HandleRegistry::Status::kStale:
+      return "stale (already released)";
+    case HandleRegistry::Status::kWrongType:
+      return "of the wrong type";
+  }
+  return "unknown";
+}
+
+[[noreturn]] void fail(const char* operation, const HandleRegistry::Status status,
+                       const HandleRegistry::Value value, const std::type_info& type) {
+  fmt::print(stderr, "OpenAssetIO: {} of C handle {:#018x} for {} failed: handle is {}\n",
+             operation, value, type.name(), statusName(status));
+  std::fflush(stderr);
+  std::abort();
+}
+
+std::size_t popFree() {
+  std::uint64_t head = gFreeHead.load(std::memory_order_acquire);
+  while (true) {
+    const std::uint64_t encodedIdx = head & kLowMask;
+    if (encodedIdx == 0) {
+      return kMaxSlots;
+    }
+    const std::size_t idx = encodedIdx - 1;
+    const std::uint64_t next = slotAt(idx)->nextFree.load(std::memory_order_relaxed);
+    const std::uint64_t newHead = (((head >> 32) + 1) << 32) | next;
+    if (gFreeHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel)) {
+      return idx;
+    }
+  }
+}
+
+void pushFree(const std::size_t idx) {
+  Slot* slot = slotAt(idx);
+  std::uint64_t head = gFreeHead.load(std::memory_order_relaxed);
+  while (true) {
+    slot->nextFree.store(static_cast<std::uint32_t>(head & kLowMask), std::memory_order_relaxed);
+    const std::uint64_t newHead = (((head >> 32) + 1) << 32) | (idx + 1);
+    if (gFreeHead.compare_exchange_weak(head, newHead, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+      return;
+    }
+  }
+}
+
+/**
+ * Validate a handle value, returning the slot it refers to if valid.
+ */
+HandleRegistry::Status decode(const HandleRegistry::Value value, const std::type_info& type,
+                              Slot** outSlot) {
+  const std::uint64_t encodedIdx = value & kLowMask;
+  const auto generation = static_cast<std::uint32_t>(value >> 32);
+
+  if (encodedIdx == 0 || (generation & 1U) == 0) {
+    return HandleRegistry::Status::kInvalid;
+  }
+  const std::size_t idx = encodedIdx - 1;
+  if (idx >= gNextFreshIdx.load(std::memory_order_acquire) || idx >= kMaxSlots) {
+    return HandleRegistry::Status::kInvalid;
+  }
+
+  Slot* slot = slotAt(idx);
+  if (slot->generation.load(std::memory_order_acquire) != generation) {
+    return HandleRegistry::Status::kStale;
+  }
+  if (*slot->type.load(std::memory_order_relaxed) != type) {
+    return HandleRegistry::Status::kWrongType;
+  }
+  *outSlot = slot;
+  return HandleRegistry::Status::kOk;
+}
+}  // namespace
+
+HandleRegistry::Value HandleRegistry::acquire(void* ptr, const std::type_info& type) {
+  std::size_t idx = popFree();
+  if (idx == kMaxSlots) {
+    idx = gNextFreshIdx.fetch_add(1, std::memory_order_relaxed);
+    if (idx >= kMaxSlots) {
+      fmt::print(stderr, "OpenAssetIO: C handle registry exhausted ({} live handles)\n",
+                 kMaxSlots);
+      std::fflush(stderr);
+      std::abort();
+    }
+  }
+
+  Slot* slot = slotAt(idx);
+  slot->ptr.store(ptr, std::memory_order_relaxed);
+  slot->type.store(&type, std::memory_order_relaxed);
+  // Publish, making the generation odd.
+  const std::uint32_t generation = slot->generation.fetch_add(1, std::memory_order_release) + 1;
+
+  return (static_cast<Value>(generation) << 32) | (idx + 1);
+}
+
+HandleRegistry::Status HandleRegistry::check(const Value value, const std::type_info& type) {
+  Slot* slot = nullptr;
+  return decode(value, type, &slot);
+}
+
+void* HandleRegistry::lookup(const Value value, const std::type_info& type) {
+  Slot* slot = nullptr;
+  if (const Status status = decode(value, type, &slot); status != Status::kOk) {
+    fail("Lookup", status, value, type);
+  }
+  return slot->ptr.load(std::memory_order_relaxed);
+}
+
+void* HandleRegistry::release(const Value value, const std::type_info& type) {
+  Slot* slot = nullptr;
+  if (const Status status = decode(value, type, &slot); status != Status::kOk) {
+    fail("Release", status, value, type);
+  }
+
+  // Retrieve the pointer before the slot can be recycled.
+  void* ptr = slot->ptr.load(std::memory_order_relaxed);
+
+  // Guard against a concurrent release of the same handle.
+  auto generation = static_cast<std::uint32_t>(value >> 32);
+  if (!slot->generation.compare_exchange_strong(generation, generation + 1,
+                                                std::memory_order_acq_rel)) {
+    fail("Release", Status::kStale, value, type);
+  }
+
+  pushFree((value & kLowMask) - 1);
+  return ptr;
+}
+}  // namespace handles
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
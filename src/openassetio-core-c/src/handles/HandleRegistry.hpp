@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstdint>
+#include <typeinfo>
+
+#include <openassetio/c/export.h>
+#include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace handles {
+/**
+ * Process-wide table of live C handles, used to validate handles when
+ * the `OPENASSETIO_ENABLE_C_CHECKED_HANDLES` build option is enabled
+ * (see @ref Converter).
+ *
+ * Each registered pointer occupies a slot, and its handle encodes the
+ * slot index along with the slot's generation count. The generation is
+ * bumped when the handle is released, so stale or double-released
+ * handles are detected in O(1), without dereferencing the pointer.
+ *
+ * Slots are allocated in fixed-size chunks that are never freed, and
+ * recycled via a tagged lock-free free list, so no operation takes a
+ * lock.
+ *
+ * Validation is best-effort with respect to concurrent use of the same
+ * handle, e.g. a lookup racing a release of the same handle, which is
+ * an error in the caller regardless.
+ */
+class OPENASSETIO_CORE_C_EXPORT HandleRegistry {
+ public:
+  /// Encoded handle value. Zero is never a valid handle.
+  using Value = std::uint64_t;
+
+  /// Result of validating a handle.
+  enum class Status {
+    /// The handle is live and of the expected type.
+    kOk,
+    /// The handle was never issued by the registry.
+    kInvalid,
+    /// The handle has been released.
+    kStale,
+    /// The handle is live but refers to a different C++ type.
+    kWrongType
+  };
+
+  /**
+   * Register a pointer, returning a new handle value for it.
+   *
+   * Aborts if the registry is exhausted.
+   *
+   * @param ptr Pointer to register.
+   * @param type C++ type of the pointee.
+   * @return Handle value, to be passed to @ref lookup and @ref release.
+   */
+  static Value acquire(void* ptr, const std::type_info& type);
+
+  /**
+   * Validate a handle value, without side effects.
+   *
+   * @param value Handle value.
+   * @param type Expected C++ type of the pointee.
+   * @return Validation status.
+   */
+  static Status check(Value value, const std::type_info& type);
+
+  /**
+   * Get the pointer registered for a handle value.
+   *
+   * Aborts with a diagnostic if the handle is not valid.
+   *
+   * @param value Handle value.
+   * @param type Expected C++ type of the pointee.
+   * @return Registered pointer.
+   */
+  static void* lookup(Value value, const std::type_info& type);
+
+  /**
+   * Unregister a handle value, returning its pointer.
+   *
+   * Aborts with a diagnostic if the handle is not valid, e.g. if it has
+   * already been released.
+   *
+   * @param value Handle value.
+   * @param type Expected C++ type of the pointee.
+   * @return Previously registered pointer.
+   */
+  static void* release(Value value, const std::type_info& type);
+};
+}  // namespace handles
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
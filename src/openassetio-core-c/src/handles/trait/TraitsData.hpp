@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <openassetio/c/trait/TraitsData.h>
+#include <openassetio/export.h>
+
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../Converter.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace handles::trait {
+using SharedTraitsData = Converter<openassetio::trait::TraitsDataPtr, oa_trait_TraitsData_h>;
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
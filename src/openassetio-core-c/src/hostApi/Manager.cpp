@@ -1,30 +1,125 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include <openassetio/c/Arena.h>
+#include <openassetio/c/BatchBuffers.h>
+#include <openassetio/c/Context.h>
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/hostApi/Manager.h>
 #include <openassetio/c/managerApi/ManagerInterface.h>
 #include <openassetio/c/namespace.h>
+#include <openassetio/c/trait/TraitsData.h>
 
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/serialization.hpp>
 
+#include "../BatchBuffers.hpp"
 #include "../StringView.hpp"
 #include "../errors.hpp"
+#include "../handles/Arena.hpp"
+#include "../handles/Context.hpp"
 #include "../handles/InfoDictionary.hpp"
 #include "../handles/hostApi/Manager.hpp"
 #include "../handles/managerApi/HostSession.hpp"
 #include "../handles/managerApi/ManagerInterface.hpp"
+#include "../handles/trait/TraitsData.hpp"
 #include "openassetio/c/managerApi/HostSession.h"
 
 namespace errors = openassetio::errors;
 namespace handles = openassetio::handles;
 namespace hostApi = openassetio::hostApi;
 namespace managerApi = openassetio::managerApi;
+namespace access = openassetio::access;
+namespace trait = openassetio::trait;
+
+namespace {
+/**
+ * Entity references that were successfully created from a C string
+ * table, along with the index of each in the table.
+ */
+struct ValidEntityReferences {
+  openassetio::EntityReferences entityReferences;
+  std::vector<std::size_t> indices;
+};
+
+/// Record a batch element error in C out-parameters.
+void writeBatchElementError(int* outElementCodes, oa_BatchElementErrors* outErrors,
+                            const std::size_t idx, const errors::BatchElementError& error) {
+  outElementCodes[idx] = static_cast<int>(error.code);
+  openassetio::appendBatchElementError(outErrors, idx, error);
+}
+
+/**
+ * Create entity references from a C string table, recording an error
+ * for those that are not valid for the manager.
+ */
+ValidEntityReferences validEntityReferences(const hostApi::ManagerPtr& manager,
+                                            const oa_ConstStringTable& entityReferences,
+                                            int* outElementCodes,
+                                            oa_BatchElementErrors* outErrors) {
+  ValidEntityReferences valid;
+  valid.entityReferences.reserve(entityReferences.count);
+  valid.indices.reserve(entityReferences.count);
+
+  for (std::size_t idx = 0; idx < entityReferences.count; ++idx) {
+    openassetio::Str refStr{openassetio::stringTableElement(entityReferences, idx)};
+    if (std::optional<openassetio::EntityReference> entityReference =
+            manager->createEntityReferenceIfValid(std::move(refStr))) {
+      valid.entityReferences.push_back(std::move(*entityReference));
+      valid.indices.push_back(idx);
+    } else {
+      writeBatchElementError(
+          outElementCodes, outErrors, idx,
+          errors::BatchElementError{errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+                                    "Invalid entity reference"});
+    }
+  }
+  return valid;
+}
+
+/// Record a successfully retrieved TraitsData in C out-parameters.
+void writeTraitsData(int* outElementCodes, oa_ByteTable* outTraitsDatas, const std::size_t idx,
+                     const trait::TraitsData& traitsData) {
+  const trait::serialization::Bytes bytes = trait::serialization::serialize(traitsData);
+  const bool fits = openassetio::appendByteTableElement(
+      outTraitsDatas, idx, {reinterpret_cast<const char*>(bytes.data()), bytes.size()});
+  outElementCodes[idx] = fits ? oa_ErrorCode_kOK : oa_ErrorCode_kLengthError;
+}
+
+/// Convert a C access value to the given strong enumeration, for
+/// enumerations of read and write access.
+template <class Access>
+Access toReadWriteAccess(const int access) {
+  for (const Access candidate : {Access::kRead, Access::kWrite}) {
+    if (static_cast<int>(candidate) == access) {
+      return candidate;
+    }
+  }
+  throw errors::InputValidationException{"Invalid access value: " + std::to_string(access)};
+}
+
+/// Get the Context held by a C handle.
+const openassetio::ContextPtr& toContext(oa_Context_h context) {
+  return *handles::SharedContext::toInstance(context);
+}
+}  // namespace
 
 extern "C" {
 
@@ -47,7 +142,7 @@ oa_ErrorCode oa_hostApi_Manager_ctor(oa_StringView* err, oa_hostApi_Manager_h* h
 }
 
 void oa_hostApi_Manager_dtor(oa_hostApi_Manager_h handle) {
-  delete handles::hostApi::SharedManager::toInstance(handle);
+  delete handles::hostApi::SharedManager::release(handle);
 }
 
 oa_ErrorCode oa_hostApi_Manager_identifier(oa_StringView* err, oa_StringView* out,
@@ -81,4 +176,176 @@ oa_ErrorCode oa_hostApi_Manager_info(oa_StringView* err, oa_InfoDictionary_h out
     return oa_ErrorCode_kOK;
   });
 }
+
+oa_ErrorCode oa_hostApi_Manager_createContext(oa_StringView* err, oa_Context_h* out,
+                                              oa_hostApi_Manager_h handle) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+
+    *out = handles::SharedContext::toHandle(new openassetio::ContextPtr{manager->createContext()});
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_createChildContext(oa_StringView* err, oa_Context_h* out,
+                                                   oa_hostApi_Manager_h handle,
+                                                   oa_Context_h parentContext) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+
+    *out = handles::SharedContext::toHandle(
+        new openassetio::ContextPtr{manager->createChildContext(toContext(parentContext))});
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_persistenceTokenForContext(oa_StringView* err,
+                                                           oa_StringView* out,
+                                                           oa_hostApi_Manager_h handle,
+                                                           oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    const openassetio::Str token = manager->persistenceTokenForContext(toContext(context));
+
+    out->size = token.size();
+    if (token.size() > out->capacity) {
+      openassetio::assignStringView(err, "Insufficient storage for return value");
+      return oa_ErrorCode_kLengthError;
+    }
+    token.copy(out->data, token.size());
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_contextFromPersistenceToken(oa_StringView* err,
+                                                            oa_Context_h* out,
+                                                            oa_hostApi_Manager_h handle,
+                                                            oa_ConstStringView token) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+
+    *out = handles::SharedContext::toHandle(new openassetio::ContextPtr{
+        manager->contextFromPersistenceToken(openassetio::Str{token.data, token.size})});
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_entityExists(oa_StringView* err, int* outElementCodes,
+                                             oa_BatchElementErrors* outErrors, bool* outExists,
+                                             oa_hostApi_Manager_h handle,
+                                             oa_ConstStringTable entityReferences,
+                                             oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    const ValidEntityReferences valid =
+        validEntityReferences(manager, entityReferences, outElementCodes, outErrors);
+
+    manager->entityExists(
+        valid.entityReferences, toContext(context),
+        [&](const std::size_t idx, const bool exists) {
+          outElementCodes[valid.indices[idx]] = oa_ErrorCode_kOK;
+          outExists[valid.indices[idx]] = exists;
+        },
+        [&](const std::size_t idx, const errors::BatchElementError& error) {
+          writeBatchElementError(outElementCodes, outErrors, valid.indices[idx], error);
+        });
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_resolve(oa_StringView* err, int* outElementCodes,
+                                        oa_BatchElementErrors* outErrors,
+                                        oa_ByteTable* outTraitsDatas, oa_hostApi_Manager_h handle,
+                                        oa_ConstStringTable entityReferences,
+                                        oa_ConstStringTable traitSet, int resolveAccess,
+                                        oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    const auto access = toReadWriteAccess<access::ResolveAccess>(resolveAccess);
+
+    trait::TraitSet traitIds;
+    for (std::size_t idx = 0; idx < traitSet.count; ++idx) {
+      traitIds.emplace(openassetio::stringTableElement(traitSet, idx));
+    }
+
+    const ValidEntityReferences valid =
+        validEntityReferences(manager, entityReferences, outElementCodes, outErrors);
+
+    manager->resolve(
+        valid.entityReferences, traitIds, access, toContext(context),
+        [&](const std::size_t idx, const trait::TraitsDataPtr& traitsData) {
+          writeTraitsData(outElementCodes, outTraitsDatas, valid.indices[idx], *traitsData);
+        },
+        [&](const std::size_t idx, const errors::BatchElementError& error) {
+          writeBatchElementError(outElementCodes, outErrors, valid.indices[idx], error);
+        });
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_resolveInArena(
+    oa_StringView* err, int* outElementCodes, oa_BatchElementErrors* outErrors,
+    oa_trait_TraitsData_h* outTraitsDatas, oa_Arena_h arena, oa_hostApi_Manager_h handle,
+    oa_ConstStringTable entityReferences, oa_ConstStringTable traitSet, int resolveAccess,
+    oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    openassetio::Arena* resultsArena = handles::Arena::toInstance(arena);
+    const auto access = toReadWriteAccess<access::ResolveAccess>(resolveAccess);
+
+    trait::TraitSet traitIds;
+    for (std::size_t idx = 0; idx < traitSet.count; ++idx) {
+      traitIds.emplace(openassetio::stringTableElement(traitSet, idx));
+    }
+
+    const ValidEntityReferences valid =
+        validEntityReferences(manager, entityReferences, outElementCodes, outErrors);
+
+    manager->resolve(
+        valid.entityReferences, traitIds, access, toContext(context),
+        [&](const std::size_t idx, trait::TraitsDataPtr traitsData) {
+          const std::size_t elementIdx = valid.indices[idx];
+          outTraitsDatas[elementIdx] =
+              resultsArena->makeHandle<handles::trait::SharedTraitsData>(std::move(traitsData));
+          outElementCodes[elementIdx] = oa_ErrorCode_kOK;
+        },
+        [&](const std::size_t idx, const errors::BatchElementError& error) {
+          writeBatchElementError(outElementCodes, outErrors, valid.indices[idx], error);
+        });
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_entityTraits(oa_StringView* err, int* outElementCodes,
+                                             oa_BatchElementErrors* outErrors,
+                                             oa_ByteTable* outTraitSets,
+                                             oa_hostApi_Manager_h handle,
+                                             oa_ConstStringTable entityReferences,
+                                             int entityTraitsAccess, oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    const auto access = toReadWriteAccess<access::EntityTraitsAccess>(entityTraitsAccess);
+    const ValidEntityReferences valid =
+        validEntityReferences(manager, entityReferences, outElementCodes, outErrors);
+
+    manager->entityTraits(
+        valid.entityReferences, access, toContext(context),
+        [&](const std::size_t idx, const trait::TraitSet& traitIds) {
+          writeTraitsData(outElementCodes, outTraitSets, valid.indices[idx],
+                          *trait::TraitsData::make(traitIds));
+        },
+        [&](const std::size_t idx, const errors::BatchElementError& error) {
+          writeBatchElementError(outElementCodes, outErrors, valid.indices[idx], error);
+        });
+
+    return oa_ErrorCode_kOK;
+  });
+}
 }  // extern "C"
@@ -1,12 +1,23 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 
+#include <cstddef>
+#include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "CManagerInterfaceAdapter.hpp"
 
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
+#include "../BatchBuffers.hpp"
 #include "../errors.hpp"
 #include "../handles/InfoDictionary.hpp"
 
@@ -16,6 +27,119 @@ namespace managerApi {
 
 constexpr size_t kStringBufferSize = 500;
 
+namespace {
+/// Initial number of bytes of result storage per batch element.
+constexpr std::size_t kByteTableElementSize = 256;
+
+/// Create a C string table of a subset of entity references.
+StringTable entityReferencesTable(const EntityReferences& entityReferences,
+                                  const std::vector<std::size_t>& indices) {
+  return StringTable{indices, [&](const std::size_t idx) -> const Str& {
+                       return entityReferences[idx].toString();
+                     }};
+}
+
+/**
+ * Get the message of each element of a batch from C batch element
+ * error storage, defaulting to an empty message for elements that
+ * have no error recorded.
+ */
+std::vector<Str> batchElementErrorMessages(const oa_BatchElementErrors& batchErrors,
+                                           const std::size_t batchSize) {
+  std::vector<Str> messages(batchSize);
+  forEachBatchElementError(batchErrors, batchSize,
+                           [&](const std::size_t idx, errors::BatchElementError error) {
+                             messages[idx] = std::move(error.message);
+                           });
+  return messages;
+}
+
+/// Deserialise a TraitsData written to a C byte table.
+trait::TraitsDataPtr deserializeElement(const std::string_view bytes) {
+  return trait::serialization::deserialize(reinterpret_cast<const std::byte*>(bytes.data()),
+                                           bytes.size());
+}
+
+/**
+ * Call a batch suite function whose results are written to a C byte
+ * table, and dispatch its results to callbacks.
+ *
+ * Elements whose results did not fit are retried with exactly the
+ * capacity the suite function reported that they require.
+ *
+ * @param entityReferences Entity references of the batch.
+ * @param suiteFunction Callable taking the element codes, errors,
+ * results and entity references out-/in-parameters, which
+ * returns the error code of the suite function.
+ * @param successCallback Callable taking the index and serialised
+ * data of a successful element.
+ * @param errorCallback Callback for failed elements.
+ * @exception errors.OpenAssetIOException If the suite function fails,
+ * or reports insufficient capacity for an element that it was given
+ * its required capacity for.
+ */
+template <class SuiteFunction, class SuccessCallback>
+void callByteTableSuiteFunction(const EntityReferences& entityReferences,
+                                const SuiteFunction& suiteFunction,
+                                const SuccessCallback& successCallback,
+                                const ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  std::vector<std::size_t> pending(entityReferences.size());
+  std::iota(pending.begin(), pending.end(), std::size_t{0});
+  std::size_t capacity = pending.size() * kByteTableElementSize;
+  bool isRetry = false;
+
+  while (!pending.empty()) {
+    // Buffer for error message.
+    char errorMessageBuffer[kStringBufferSize];
+    // Error message.
+    oa_StringView errorMessage{kStringBufferSize, errorMessageBuffer, 0};
+
+    const StringTable refsTable = entityReferencesTable(entityReferences, pending);
+    std::vector<int> elementCodes(pending.size(), OPENASSETIO_BatchErrorCode_kUnknown);
+    BatchElementErrors elementErrors{pending.size(), pending.size() * kStringBufferSize};
+    oa_BatchElementErrors elementErrorsView = elementErrors.view();
+    ByteTable results{pending.size(), capacity};
+    oa_ByteTable resultsView = results.view();
+
+    // Execute corresponding suite function.
+    const oa_ErrorCode errorCode =
+        suiteFunction(&errorMessage, elementCodes.data(), &elementErrorsView, &resultsView,
+                      refsTable.view());
+
+    // Convert error code/message to exception.
+    errors::throwIfError(errorCode, errorMessage);
+
+    std::vector<Str> elementMessages =
+        batchElementErrorMessages(elementErrorsView, pending.size());
+
+    std::vector<std::size_t> retry;
+    std::size_t retryCapacity = 0;
+    for (std::size_t idx = 0; idx < pending.size(); ++idx) {
+      if (elementCodes[idx] == oa_ErrorCode_kOK) {
+        successCallback(pending[idx], results.element(idx));
+      } else if (elementCodes[idx] == oa_ErrorCode_kLengthError) {
+        if (isRetry) {
+          throw errors::OpenAssetIOException{
+              "Manager reported insufficient capacity for a result, despite being given the "
+              "capacity it required"};
+        }
+        retry.push_back(pending[idx]);
+        retryCapacity += results.elementSize(idx);
+      } else {
+        errorCallback(
+            pending[idx],
+            errors::BatchElementError{
+                static_cast<errors::BatchElementError::ErrorCode>(elementCodes[idx]),
+                std::move(elementMessages[idx])});
+      }
+    }
+    pending = std::move(retry);
+    capacity = retryCapacity;
+    isRetry = true;
+  }
+}
+}  // namespace
+
 CManagerInterfaceAdapter::CManagerInterfaceAdapter(oa_managerApi_CManagerInterface_h handle,
                                                    oa_managerApi_CManagerInterface_s suite)
     : handle_{handle}, suite_{suite} {}
@@ -74,6 +198,8 @@ InfoDictionary CManagerInterfaceAdapter::info() {
 
   // Execute corresponding suite function.
   const oa_ErrorCode errorCode = suite_.info(&errorMessage, infoDictHandle, handle_);
+  // Handle was only borrowed for the duration of the call.
+  handles::InfoDictionary::release(infoDictHandle);
 
   // Convert error code/message to exception.
   errors::throwIfError(errorCode, errorMessage);
@@ -104,23 +230,94 @@ bool CManagerInterfaceAdapter::isEntityReferenceString(
 }
 
 void CManagerInterfaceAdapter::entityExists(
-    [[maybe_unused]] const EntityReferences& entityReferences,
+    const EntityReferences& entityReferences, [[maybe_unused]] const ContextConstPtr& context,
+    [[maybe_unused]] const HostSessionPtr& hostSession,
+    const ManagerInterface::ExistsSuccessCallback& successCallback,
+    const ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  if (suite_.entityExists == nullptr) {
+    throw errors::NotImplementedException{"Not implemented"};
+  }
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, errorMessageBuffer, 0};
+
+  std::vector<std::size_t> indices(entityReferences.size());
+  std::iota(indices.begin(), indices.end(), std::size_t{0});
+  const StringTable refsTable = entityReferencesTable(entityReferences, indices);
+
+  // Return value storage.
+  std::vector<int> elementCodes(indices.size(), OPENASSETIO_BatchErrorCode_kUnknown);
+  BatchElementErrors elementErrors{indices.size(), indices.size() * kStringBufferSize};
+  oa_BatchElementErrors elementErrorsView = elementErrors.view();
+  const auto exists = std::make_unique<bool[]>(indices.size());
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode =
+      suite_.entityExists(&errorMessage, elementCodes.data(), &elementErrorsView, exists.get(),
+                          handle_, refsTable.view());
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  std::vector<Str> elementMessages = batchElementErrorMessages(elementErrorsView, indices.size());
+
+  for (std::size_t idx = 0; idx < indices.size(); ++idx) {
+    if (elementCodes[idx] == oa_ErrorCode_kOK) {
+      successCallback(idx, exists[idx]);
+    } else {
+      errorCallback(idx, errors::BatchElementError{
+                             static_cast<errors::BatchElementError::ErrorCode>(elementCodes[idx]),
+                             std::move(elementMessages[idx])});
+    }
+  }
+}
+
+void CManagerInterfaceAdapter::entityTraits(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
     [[maybe_unused]] const ContextConstPtr& context,
     [[maybe_unused]] const HostSessionPtr& hostSession,
-    [[maybe_unused]] const ManagerInterface::ExistsSuccessCallback& successCallback,
-    [[maybe_unused]] const ManagerInterface::BatchElementErrorCallback& errorCallback) {
-  throw errors::NotImplementedException{"Not implemented"};
+    const ManagerInterface::EntityTraitsSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (suite_.entityTraits == nullptr) {
+    throw errors::NotImplementedException{"Not implemented"};
+  }
+  callByteTableSuiteFunction(
+      entityReferences,
+      [&](oa_StringView* err, int* outElementCodes, oa_BatchElementErrors* outErrors,
+          oa_ByteTable* outTraitSets, const oa_ConstStringTable refsTable) {
+        return suite_.entityTraits(err, outElementCodes, outErrors, outTraitSets, handle_,
+                                   refsTable, static_cast<int>(entityTraitsAccess));
+      },
+      [&](const std::size_t idx, const std::string_view bytes) {
+        successCallback(idx, deserializeElement(bytes)->traitSet());
+      },
+      errorCallback);
 }
 
 void CManagerInterfaceAdapter::resolve(
-    [[maybe_unused]] const EntityReferences& entityReferences,
-    [[maybe_unused]] const trait::TraitSet& traitSet,
-    [[maybe_unused]] const access::ResolveAccess resolveAccess,
-    [[maybe_unused]] const ContextConstPtr& context,
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, [[maybe_unused]] const ContextConstPtr& context,
     [[maybe_unused]] const HostSessionPtr& hostSession,
-    [[maybe_unused]] const ManagerInterface::ResolveSuccessCallback& successCallback,
-    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) {
-  throw errors::NotImplementedException{"Not implemented"};
+    const ManagerInterface::ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (suite_.resolve == nullptr) {
+    throw errors::NotImplementedException{"Not implemented"};
+  }
+  const StringTable traitSetTable{traitSet, [](const trait::TraitId& traitId) -> const Str& {
+                                    return traitId;
+                                  }};
+  callByteTableSuiteFunction(
+      entityReferences,
+      [&](oa_StringView* err, int* outElementCodes, oa_BatchElementErrors* outErrors,
+          oa_ByteTable* outTraitsDatas, const oa_ConstStringTable refsTable) {
+        return suite_.resolve(err, outElementCodes, outErrors, outTraitsDatas, handle_,
+                              refsTable, traitSetTable.view(), static_cast<int>(resolveAccess));
+      },
+      [&](const std::size_t idx, const std::string_view bytes) {
+        successCallback(idx, deserializeElement(bytes));
+      },
+      errorCallback);
 }
 
 void CManagerInterfaceAdapter::preflight(
@@ -20,7 +20,7 @@ namespace managerApi {
  * ManagerInterface implementation wrapping a manager plugin defined via
  * the C API.
  */
-class OPENASSETIO_CORE_C_EXPORT CManagerInterfaceAdapter : ManagerInterface {
+class OPENASSETIO_CORE_C_EXPORT CManagerInterfaceAdapter : public ManagerInterface {
  public:
   /**
    * Construct from a provided opaque handle and C function pointer
@@ -64,15 +64,20 @@ class OPENASSETIO_CORE_C_EXPORT CManagerInterfaceAdapter : ManagerInterface {
   [[nodiscard]] bool isEntityReferenceString(const Str& someString,
                                              const HostSessionPtr& hostSession) override;
 
-  /// Wrap the C suite's `entityExists` function.
-  /// @todo Implement C API. Currently throws `runtime_error`.
+  /// Wrap the C suite's `entityExists` function, if provided.
   void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
                     const HostSessionPtr& hostSession,
                     const ExistsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override;
 
-  /// Wrap the C suite's `resolve` function.
-  /// @todo Implement C API. Currently throws `runtime_error`.
+  /// Wrap the C suite's `entityTraits` function, if provided.
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+
+  /// Wrap the C suite's `resolve` function, if provided.
   void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
                access::ResolveAccess resolveAccess, const ContextConstPtr& context,
                const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
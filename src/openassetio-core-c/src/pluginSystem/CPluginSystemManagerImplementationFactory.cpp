@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <fmt/format.h>
+
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/managerApi/CManagerInterface.h>
+#include <openassetio/c/pluginSystem/CManagerPlugin.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../errors.hpp"
+#include "../managerApi/CManagerInterfaceAdapter.hpp"
+#include "CPluginSystemManagerImplementationFactory.hpp"
+
+/// @cond
+#define OPENASSETIO_DETAIL_STRINGIFY_IMPL(token) #token
+#define OPENASSETIO_DETAIL_STRINGIFY(token) OPENASSETIO_DETAIL_STRINGIFY_IMPL(token)
+/// @endcond
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+namespace {
+#if defined(_WIN32)
+constexpr char kPathListSeparator = ';';
+constexpr std::string_view kLibraryExtension = ".dll";
+#elif defined(__APPLE__)
+constexpr char kPathListSeparator = ':';
+constexpr std::string_view kLibraryExtension = ".dylib";
+#else
+constexpr char kPathListSeparator = ':';
+constexpr std::string_view kLibraryExtension = ".so";
+#endif
+
+/// Name of the entry point function that plugins must expose.
+constexpr const char* kEntryPointName =
+    OPENASSETIO_DETAIL_STRINGIFY(OPENASSETIO_C_PLUGIN_ENTRY_POINT_NAME);
+
+/// Storage capacity for strings returned from plugin suite functions.
+constexpr std::size_t kStringBufferSize = 500;
+
+/**
+ * Load a shared library, returning its handle, or `nullptr` and
+ * populating `error` on failure.
+ */
+void* openLibrary(const std::filesystem::path& path, Str& error) {
+#if defined(_WIN32)
+  HMODULE handle = LoadLibraryW(path.c_str());
+  if (!handle) {
+    error = fmt::format("error code {}", GetLastError());
+  }
+  return reinterpret_cast<void*>(handle);
+#else
+  // Symbols are kept local, so that plugins with clashing symbols
+  // don't interfere with one another.
+  void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (!handle) {
+    const char* message = dlerror();
+    error = message ? message : "unknown error";
+  }
+  return handle;
+#endif
+}
+
+void* findSymbol(void* handle, const char* name) {
+#if defined(_WIN32)
+  return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name));
+#else
+  return dlsym(handle, name);
+#endif
+}
+
+void closeLibrary(void* handle) {
+#if defined(_WIN32)
+  FreeLibrary(static_cast<HMODULE>(handle));
+#else
+  dlclose(handle);
+#endif
+}
+}  // namespace
+
+CPluginSystemManagerImplementationFactoryPtr CPluginSystemManagerImplementationFactory::make(
+    log::LoggerInterfacePtr logger) {
+  const char* paths = std::getenv(kPluginEnvVar);
+  return make(paths ? paths : "", std::move(logger));
+}
+
+CPluginSystemManagerImplementationFactoryPtr CPluginSystemManagerImplementationFactory::make(
+    Str paths, log::LoggerInterfacePtr logger) {
+  return CPluginSystemManagerImplementationFactoryPtr{
+      new CPluginSystemManagerImplementationFactory{std::move(paths), std::move(logger)}};
+}
+
+CPluginSystemManagerImplementationFactory::CPluginSystemManagerImplementationFactory(
+    Str paths, log::LoggerInterfacePtr logger)
+    : ManagerImplementationFactoryInterface{std::move(logger)}, paths_{std::move(paths)} {}
+
+CPluginSystemManagerImplementationFactory::~CPluginSystemManagerImplementationFactory() = default;
+
+Identifiers CPluginSystemManagerImplementationFactory::identifiers() {
+  const std::lock_guard lock{mutex_};
+  scan();
+  return identifiers_;
+}
+
+managerApi::ManagerInterfacePtr CPluginSystemManagerImplementationFactory::instantiate(
+    const Identifier& identifier) {
+  oa_pluginSystem_CManagerPlugin_s plugin;
+  {
+    const std::lock_guard lock{mutex_};
+    scan();
+    const auto iter = plugins_.find(identifier);
+    if (iter == plugins_.end()) {
+      throw errors::InputValidationException{fmt::format(
+          "CPluginSystem: No plug-in registered with the identifier '{}'", identifier)};
+    }
+    plugin = iter->second;
+  }
+
+  logger_->debug(fmt::format("Instantiating {}", identifier));
+
+  char errorMessageBuffer[kStringBufferSize];
+  oa_StringView errorMessage{kStringBufferSize, errorMessageBuffer, 0};
+  oa_managerApi_CManagerInterface_h handle = nullptr;
+  oa_managerApi_CManagerInterface_s suite{};
+
+  const oa_ErrorCode errorCode = plugin.instantiate(&errorMessage, &handle, &suite);
+  errors::throwIfError(errorCode, errorMessage);
+
+  return std::make_shared<managerApi::CManagerInterfaceAdapter>(handle, suite);
+}
+
+void CPluginSystemManagerImplementationFactory::scan() {
+  if (scanned_) {
+    return;
+  }
+  scanned_ = true;
+
+  if (paths_.empty()) {
+    logger_->warning(fmt::format(
+        "No search paths specified, no plugins will load - check ${} is set.", kPluginEnvVar));
+    return;
+  }
+
+  logger_->debug(fmt::format("CPluginSystem: Searching {}", paths_));
+
+  const std::string_view paths{paths_};
+  std::size_t start = 0;
+  while (start <= paths.size()) {
+    const std::size_t end = std::min(paths.find(kPathListSeparator, start), paths.size());
+    const std::filesystem::path path{paths.substr(start, end - start)};
+    start = end + 1;
+
+    std::error_code errorCode;
+    if (path.empty() || !std::filesystem::is_directory(path, errorCode)) {
+      logger_->debug(fmt::format("CPluginSystem: Skipping as not a directory {}", path.string()));
+      continue;
+    }
+
+    std::vector<std::filesystem::path> libraryPaths;
+    try {
+      for (const std::filesystem::directory_entry& entry :
+           std::filesystem::directory_iterator{path}) {
+        if (entry.path().extension() == kLibraryExtension) {
+          libraryPaths.push_back(entry.path());
+        }
+      }
+    } catch (const std::filesystem::filesystem_error& exc) {
+      logger_->warning(
+          fmt::format("CPluginSystem: Error searching {}: {}", path.string(), exc.what()));
+    }
+
+    // Directory iteration order is unspecified, so sort for
+    // consistent precedence between runs.
+    std::sort(libraryPaths.begin(), libraryPaths.end());
+    for (const std::filesystem::path& libraryPath : libraryPaths) {
+      load(libraryPath.string());
+    }
+  }
+}
+
+void CPluginSystemManagerImplementationFactory::load(const Str& path) {
+  logger_->debug(fmt::format("CPluginSystem: Attempting to load {}", path));
+
+  Str error;
+  void* handle = openLibrary(path, error);
+  if (!handle) {
+    logger_->error(fmt::format("CPluginSystem: Error loading {}: {}", path, error));
+    return;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  const auto entryPoint =
+      reinterpret_cast<oa_pluginSystem_CPluginEntryPoint>(findSymbol(handle, kEntryPointName));
+  if (!entryPoint) {
+    // The search path is shared with other plugin systems, so this is
+    // expected and not an error.
+    closeLibrary(handle);
+    logger_->debug(fmt::format("CPluginSystem: No '{}' entry point in {}, skipping",
+                               kEntryPointName, path));
+    return;
+  }
+
+  // From here on the library is never closed, since the plugin suite
+  // (or instances it created) may still be in use elsewhere.
+  const oa_pluginSystem_CManagerPlugin_s* plugin = entryPoint();
+  if (!plugin || !plugin->identifier || !plugin->instantiate) {
+    logger_->error(fmt::format("CPluginSystem: Incomplete plugin returned by {}", path));
+    return;
+  }
+
+  char errorMessageBuffer[kStringBufferSize];
+  oa_StringView errorMessage{kStringBufferSize, errorMessageBuffer, 0};
+  char identifierBuffer[kStringBufferSize];
+  oa_StringView identifierView{kStringBufferSize, identifierBuffer, 0};
+
+  if (plugin->identifier(&errorMessage, &identifierView) != oa_ErrorCode_kOK) {
+    logger_->error(fmt::format("CPluginSystem: Error querying identifier of {}: {}", path,
+                               std::string_view{errorMessage.data, errorMessage.size}));
+    return;
+  }
+  Identifier identifier{identifierView.data, identifierView.size};
+
+  if (plugins_.count(identifier) != 0) {
+    logger_->debug(fmt::format(
+        "CPluginSystem: Skipping '{}' defined in '{}'. Already registered", identifier, path));
+    return;
+  }
+
+  logger_->debug(
+      fmt::format("CPluginSystem: Registered plug-in '{}' from '{}'", identifier, path));
+  identifiers_.push_back(identifier);
+  plugins_.emplace(std::move(identifier), *plugin);
+}
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include <openassetio/c/export.h>
+#include <openassetio/export.h>
+
+#include <openassetio/c/pluginSystem/CManagerPlugin.h>
+
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+OPENASSETIO_DECLARE_PTR(CPluginSystemManagerImplementationFactory)
+
+/**
+ * A factory to manage @ref manager plugins implemented against the C
+ * API, loaded from shared libraries.
+ *
+ * Plugin libraries expose an entry point named by
+ * `OPENASSETIO_C_PLUGIN_ENTRY_POINT_NAME`, returning an
+ * `oa_pluginSystem_CManagerPlugin_s` suite. Instances created by the
+ * plugin are wrapped in a @ref managerApi.CManagerInterfaceAdapter
+ * "CManagerInterfaceAdapter".
+ *
+ * This allows hosts to use managers written in any language able to
+ * expose a C ABI, without requiring an embedded Python interpreter or
+ * a matching C++ ABI.
+ *
+ * The factory loads plugins from libraries found under paths specified
+ * in the `OPENASSETIO_PLUGIN_PATH` env var, which is shared with the
+ * Python and C++ plugin systems. Libraries that do not expose the
+ * entry point are ignored. Libraries are only loaded on the first call
+ * to @ref identifiers or @ref instantiate.
+ */
+class OPENASSETIO_CORE_C_EXPORT CPluginSystemManagerImplementationFactory final
+    : public hostApi::ManagerImplementationFactoryInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(CPluginSystemManagerImplementationFactory)
+
+  /// The environment variable to read the plugin search path from.
+  static constexpr const char* kPluginEnvVar = "OPENASSETIO_PLUGIN_PATH";
+
+  /**
+   * Construct a new instance, searching paths from the @ref
+   * kPluginEnvVar environment variable.
+   *
+   * @param logger Logger used to report information about plugin
+   * loading.
+   */
+  static CPluginSystemManagerImplementationFactoryPtr make(log::LoggerInterfacePtr logger);
+
+  /**
+   * Construct a new instance, searching the supplied paths.
+   *
+   * @param paths Paths to search for plugins, delimited by the
+   * platform's path list separator.
+   *
+   * @param logger Logger used to report information about plugin
+   * loading.
+   */
+  static CPluginSystemManagerImplementationFactoryPtr make(Str paths,
+                                                           log::LoggerInterfacePtr logger);
+
+  ~CPluginSystemManagerImplementationFactory() override;
+
+  /**
+   * All identifiers known to the factory.
+   *
+   * If several plugins share an identifier, the first one encountered
+   * is used. Earlier search paths take precedence over later ones, and
+   * libraries within a path are visited in lexical order.
+   */
+  [[nodiscard]] Identifiers identifiers() override;
+
+  /**
+   * Creates an instance of the @fqref{managerApi.ManagerInterface}
+   * "ManagerInterface" with the specified identifier.
+   *
+   * @param identifier The identifier of the ManagerInterface to
+   * instantiate.
+   *
+   * @return Newly created `ManagerInterface`.
+   *
+   * @throws errors.InputValidationException If the requested
+   * identifier has not been registered by a manager plugin.
+   *
+   * @throws errors.OpenAssetIOException If the plugin fails to create
+   * an instance.
+   */
+  [[nodiscard]] managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override;
+
+ private:
+  CPluginSystemManagerImplementationFactory(Str paths, log::LoggerInterfacePtr logger);
+
+  /// Scan for plugins, if not done already. Must hold `mutex_`.
+  void scan();
+
+  /// Load a library and register its plugin, if it has one.
+  void load(const Str& path);
+
+  const Str paths_;
+  std::mutex mutex_;
+  bool scanned_{false};
+  Identifiers identifiers_;
+  std::unordered_map<Identifier, oa_pluginSystem_CManagerPlugin_s> plugins_;
+};
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
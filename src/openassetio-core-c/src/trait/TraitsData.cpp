@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include <openassetio/c/BatchBuffers.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/trait/TraitsData.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/trait/serialization.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../BatchBuffers.hpp"
+#include "../StringView.hpp"
+#include "../errors.hpp"
+#include "../handles/trait/TraitsData.hpp"
+
+namespace errors = openassetio::errors;
+namespace handles = openassetio::handles;
+namespace trait = openassetio::trait;
+
+namespace {
+// Helper for static_assert.
+template <class... T>
+[[maybe_unused]] constexpr bool kAlwaysFalse = false;
+
+/// Get the TraitsData held by a C handle.
+const trait::TraitsDataPtr &toTraitsData(oa_trait_TraitsData_h handle) {
+  return *handles::trait::SharedTraitsData::toInstance(handle);
+}
+
+/// Convert a C property record to a property value.
+trait::property::Value toValue(const oa_trait_TraitsData_PropertyRecord &record) {
+  switch (record.type) {
+    case oa_trait_TraitsData_ValueType_kBool:
+      return record.value.boolValue;
+    case oa_trait_TraitsData_ValueType_kInt:
+      return openassetio::Int{record.value.intValue};
+    case oa_trait_TraitsData_ValueType_kFloat:
+      return record.value.floatValue;
+    case oa_trait_TraitsData_ValueType_kStr:
+      return openassetio::Str{record.strValue.data, record.strValue.size};
+  }
+  throw errors::InputValidationException{"Invalid property value type: " +
+                                         std::to_string(static_cast<int>(record.type))};
+}
+}  // namespace
+
+extern "C" {
+
+oa_ErrorCode oa_trait_TraitsData_ctor(oa_StringView *err, oa_trait_TraitsData_h *out) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    *out = handles::trait::SharedTraitsData::toHandle(
+        new trait::TraitsDataPtr{trait::TraitsData::make()});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+void oa_trait_TraitsData_dtor(oa_trait_TraitsData_h handle) {
+  delete handles::trait::SharedTraitsData::release(handle);
+}
+
+oa_ErrorCode oa_trait_TraitsData_deserialize(oa_StringView *err, oa_trait_TraitsData_h *out,
+                                             const oa_ConstStringView bytes) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    *out = handles::trait::SharedTraitsData::toHandle(new trait::TraitsDataPtr{
+        trait::serialization::deserialize(reinterpret_cast<const std::byte *>(bytes.data),
+                                          bytes.size)});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_serialize(oa_StringView *err, oa_StringView *out,
+                                           oa_trait_TraitsData_h handle) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const trait::serialization::Bytes bytes =
+        trait::serialization::serialize(*toTraitsData(handle));
+
+    out->size = bytes.size();
+    if (bytes.size() > out->capacity) {
+      openassetio::assignStringView(err, "Insufficient storage for return value");
+      return oa_ErrorCode_kLengthError;
+    }
+    if (!bytes.empty()) {
+      std::memcpy(out->data, bytes.data(), bytes.size());
+    }
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_addTraits(oa_StringView *err, oa_trait_TraitsData_h handle,
+                                           const oa_ConstStringTable traitIds) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const trait::TraitsDataPtr &traitsData = toTraitsData(handle);
+    for (std::size_t idx = 0; idx < traitIds.count; ++idx) {
+      traitsData->addTrait(trait::TraitId{openassetio::stringTableElement(traitIds, idx)});
+    }
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_setProperties(oa_StringView *err, oa_trait_TraitsData_h handle,
+                                               const oa_trait_TraitsData_PropertyRecord *records,
+                                               const std::size_t count) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const trait::TraitsDataPtr &traitsData = toTraitsData(handle);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      const oa_trait_TraitsData_PropertyRecord &record = records[idx];
+      traitsData->setTraitProperty(
+          trait::TraitId{record.property.traitId.data, record.property.traitId.size},
+          trait::property::Key{record.property.key.data, record.property.key.size},
+          toValue(record));
+    }
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_getProperties(oa_StringView *err, int *outCodes,
+                                               oa_trait_TraitsData_ValueType *outTypes,
+                                               oa_trait_TraitsData_PrimitiveValue *outValues,
+                                               oa_ByteTable *outStrValues,
+                                               oa_trait_TraitsData_h handle,
+                                               const oa_trait_TraitsData_PropertyKey *properties,
+                                               const std::size_t count) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const trait::TraitsDataPtr &traitsData = toTraitsData(handle);
+    // Reused across elements to avoid an allocation per lookup.
+    trait::TraitId traitId;
+    trait::property::Key key;
+
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      traitId.assign(properties[idx].traitId.data, properties[idx].traitId.size);
+      key.assign(properties[idx].key.data, properties[idx].key.size);
+
+      const trait::property::Value *value = traitsData->getTraitPropertyView(traitId, key);
+      if (value == nullptr) {
+        outCodes[idx] = oa_ErrorCode_kOutOfRange;
+        continue;
+      }
+
+      outCodes[idx] = std::visit(
+          [&](const auto &typedValue) {
+            using ValueType = std::decay_t<decltype(typedValue)>;
+            if constexpr (std::is_same_v<ValueType, openassetio::Bool>) {
+              outTypes[idx] = oa_trait_TraitsData_ValueType_kBool;
+              outValues[idx].boolValue = typedValue;
+            } else if constexpr (std::is_same_v<ValueType, openassetio::Int>) {
+              outTypes[idx] = oa_trait_TraitsData_ValueType_kInt;
+              outValues[idx].intValue = typedValue;
+            } else if constexpr (std::is_same_v<ValueType, openassetio::Float>) {
+              outTypes[idx] = oa_trait_TraitsData_ValueType_kFloat;
+              outValues[idx].floatValue = typedValue;
+            } else if constexpr (std::is_same_v<ValueType, openassetio::Str>) {
+              outTypes[idx] = oa_trait_TraitsData_ValueType_kStr;
+              if (!openassetio::appendByteTableElement(outStrValues, idx, typedValue)) {
+                return oa_ErrorCode_kLengthError;
+              }
+            } else {
+              static_assert(kAlwaysFalse<ValueType>, "Unhandled variant type");
+            }
+            return oa_ErrorCode_kOK;
+          },
+          *value);
+    }
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_getStrView(oa_StringView *err, oa_ConstStringView *out,
+                                            oa_trait_TraitsData_h handle,
+                                            const oa_trait_TraitsData_PropertyKey property) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const trait::property::Value *value = toTraitsData(handle)->getTraitPropertyView(
+        trait::TraitId{property.traitId.data, property.traitId.size},
+        trait::property::Key{property.key.data, property.key.size});
+    if (value == nullptr) {
+      openassetio::assignStringView(err, "Invalid key");
+      return oa_ErrorCode_kOutOfRange;
+    }
+
+    const auto *str = std::get_if<openassetio::Str>(value);
+    if (str == nullptr) {
+      openassetio::assignStringView(err, "Invalid value type");
+      return oa_ErrorCode_kBadVariantAccess;
+    }
+    openassetio::borrowStringView(out, *str);
+
+    return oa_ErrorCode_kOK;
+  });
+}
+}  // extern "C"
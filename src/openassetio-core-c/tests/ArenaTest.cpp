@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <openassetio/c/Arena.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/typedefs.hpp>
+
+// Private headers.
+#include <Arena.hpp>
+#include <handles/Arena.hpp>
+#include <handles/Converter.hpp>
+
+namespace {
+/// Type that records the order in which instances are destroyed.
+struct Recorder {
+  Recorder(std::vector<int>* destroyed, int id) : destroyed_{destroyed}, id_{id} {}
+  Recorder(const Recorder&) = delete;
+  Recorder(Recorder&&) = delete;
+  Recorder& operator=(const Recorder&) = delete;
+  Recorder& operator=(Recorder&&) = delete;
+  ~Recorder() { destroyed_->push_back(id_); }
+
+  std::vector<int>* destroyed_;
+  int id_;
+};
+
+/// Over-aligned type, to check alignment of allocations.
+struct alignas(64) OverAligned {
+  char data[3];
+};
+}  // namespace
+
+SCENARIO("Allocating objects in an arena") {
+  GIVEN("an arena with a small block size") {
+    std::vector<int> destroyed;
+    auto arena = std::make_unique<openassetio::Arena>(32);
+
+    WHEN("many objects are allocated") {
+      std::vector<Recorder*> recorders;
+      for (int id = 0; id < 100; ++id) {
+        recorders.push_back(arena->make<Recorder>(&destroyed, id));
+      }
+
+      THEN("objects are distinct and intact") {
+        for (int id = 0; id < 100; ++id) {
+          CHECK(recorders[static_cast<std::size_t>(id)]->id_ == id);
+        }
+      }
+
+      AND_WHEN("the arena is destroyed") {
+        arena.reset();
+
+        THEN("objects are destroyed in reverse order of creation") {
+          REQUIRE(destroyed.size() == 100);
+          CHECK(destroyed.front() == 99);
+          CHECK(destroyed.back() == 0);
+        }
+      }
+    }
+
+    WHEN("over-aligned and oversized objects are allocated") {
+      arena->make<char>('a');
+      const auto* overAligned = arena->make<OverAligned>();
+      const auto* oversized = arena->make<std::array<char, 1024>>();
+
+      THEN("allocations are suitably aligned") {
+        CHECK(reinterpret_cast<std::uintptr_t>(overAligned) % alignof(OverAligned) == 0);
+        CHECK(oversized != nullptr);
+      }
+    }
+  }
+
+  GIVEN("an arena") {
+    openassetio::Arena arena;
+
+    WHEN("an object is allocated along with a C handle") {
+      using StubCppTypeHandle = struct StubCppTypeUnusedOpaqueType*;
+      using Converter = openassetio::handles::Converter<openassetio::Str, StubCppTypeHandle>;
+
+      StubCppTypeHandle handle = arena.makeHandle<Converter>("some string");
+
+      THEN("the handle refers to the object") {
+        CHECK(*Converter::toInstance(handle) == "some string");
+      }
+    }
+  }
+}
+
+SCENARIO("Constructing and destroying an arena using the C API") {
+  openassetio::Str errStorage(500, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+  WHEN("an arena is constructed with the default block size") {
+    oa_Arena_h handle;
+    const oa_ErrorCode code = oa_Arena_ctor(&actualErrorMsg, &handle, 0);
+
+    THEN("a valid arena is returned") {
+      REQUIRE(code == oa_ErrorCode_kOK);
+      std::vector<int> destroyed;
+      openassetio::handles::Arena::toInstance(handle)->make<Recorder>(&destroyed, 1);
+
+      AND_WHEN("the arena is destroyed") {
+        oa_Arena_dtor(handle);
+
+        THEN("its objects are destroyed") { CHECK(destroyed == std::vector<int>{1}); }
+      }
+    }
+  }
+}
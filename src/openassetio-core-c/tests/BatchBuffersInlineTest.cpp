@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/c/BatchBuffers.h>
+#include <openassetio/c/BatchBuffersInline.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+
+#include <catch2/catch.hpp>
+
+#include "StringViewReporting.hpp"
+
+SCENARIO("Reading batch buffers using inline accessors") {
+  GIVEN("a string table") {
+    const std::vector<std::size_t> offsets{0, 3, 3, 5};
+    const oa_ConstStringTable table{"abcde", offsets.data(), offsets.size() - 1};
+
+    THEN("each string can be viewed") {
+      CHECK(oa_ConstStringTable_at(&table, 0) == std::string_view{"abc"});
+      CHECK(oa_ConstStringTable_at(&table, 1) == std::string_view{});
+      CHECK(oa_ConstStringTable_at(&table, 2) == std::string_view{"de"});
+    }
+  }
+
+  GIVEN("a byte table populated out of order") {
+    char data[] = "defabc";
+    std::vector<std::size_t> offsets{3, 0};
+    std::vector<std::size_t> sizes{3, 3};
+    const oa_ByteTable table{sizeof(data), data, 6, offsets.data(), sizes.data()};
+
+    THEN("each element's data can be viewed") {
+      CHECK(oa_ByteTable_at(&table, 0) == std::string_view{"abc"});
+      CHECK(oa_ByteTable_at(&table, 1) == std::string_view{"def"});
+    }
+  }
+
+  GIVEN("batch element errors that overflowed their capacity") {
+    char messages[] = "first errorsecond error";
+    oa_BatchElementErrorRecord records[] = {{2, 1, 0, 11}, {5, 1, 11, 12}};
+    const oa_BatchElementErrors batchErrors{2, records, 3, sizeof(messages), messages, 23};
+
+    THEN("only the stored records are counted") {
+      CHECK(oa_BatchElementErrors_size(&batchErrors) == 2);
+    }
+
+    THEN("each record's message can be viewed") {
+      CHECK(oa_BatchElementErrors_message(&batchErrors, 0) == std::string_view{"first error"});
+      CHECK(oa_BatchElementErrors_message(&batchErrors, 1) == std::string_view{"second error"});
+    }
+  }
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+
+#include <openassetio/c/Context.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/trait/TraitsData.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+// Private headers.
+#include <handles/Context.hpp>
+#include <handles/trait/TraitsData.hpp>
+
+#include "StringViewReporting.hpp"
+
+namespace handles = openassetio::handles;
+namespace trait = openassetio::trait;
+
+namespace {
+/// Default storage capacity for StringView C strings.
+constexpr std::size_t kStrStorageCapacity = 500;
+}  // namespace
+
+SCENARIO("Accessing the locale of a Context") {
+  // Storage for error messages coming from C API functions.
+  openassetio::Str errStorage(kStrStorageCapacity, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+  GIVEN("a Context and its C handle") {
+    openassetio::ContextPtr context =
+        openassetio::Context::make(trait::TraitsData::make({"aTrait"}));
+    oa_Context_h contextHandle = handles::SharedContext::toHandle(&context);
+
+    WHEN("the locale is retrieved") {
+      oa_trait_TraitsData_h localeHandle;
+      const oa_ErrorCode code = oa_Context_locale(&actualErrorMsg, &localeHandle, contextHandle);
+
+      THEN("the handle shares the Context's locale") {
+        REQUIRE(code == oa_ErrorCode_kOK);
+        const trait::TraitsDataPtr& locale =
+            *handles::trait::SharedTraitsData::toInstance(localeHandle);
+        CHECK(locale == context->locale);
+      }
+
+      oa_trait_TraitsData_dtor(localeHandle);
+    }
+
+    WHEN("the locale is set") {
+      const trait::TraitsDataPtr expected = trait::TraitsData::make({"anotherTrait"});
+      oa_trait_TraitsData_h localeHandle =
+          handles::trait::SharedTraitsData::toHandle(new trait::TraitsDataPtr{expected});
+
+      const oa_ErrorCode code = oa_Context_setLocale(&actualErrorMsg, contextHandle, localeHandle);
+
+      THEN("the Context shares the given locale") {
+        REQUIRE(code == oa_ErrorCode_kOK);
+        CHECK(context->locale == expected);
+      }
+
+      oa_trait_TraitsData_dtor(localeHandle);
+    }
+
+    WHEN("the locale is set to a null TraitsData") {
+      const trait::TraitsDataPtr initialLocale = context->locale;
+      oa_trait_TraitsData_h localeHandle =
+          handles::trait::SharedTraitsData::toHandle(new trait::TraitsDataPtr{});
+
+      const oa_ErrorCode code = oa_Context_setLocale(&actualErrorMsg, contextHandle, localeHandle);
+
+      THEN("an error is returned and the locale is unmodified") {
+        CHECK(code == oa_ErrorCode_kException);
+        CHECK(actualErrorMsg == "Locale must not be null");
+        CHECK(context->locale == initialLocale);
+      }
+
+      oa_trait_TraitsData_dtor(localeHandle);
+    }
+
+    handles::SharedContext::release(contextHandle);
+  }
+
+  GIVEN("a locale retrieved from a Context that is then destroyed") {
+    oa_Context_h contextHandle = handles::SharedContext::toHandle(new openassetio::ContextPtr{
+        openassetio::Context::make(trait::TraitsData::make({"aTrait"}))});
+    oa_trait_TraitsData_h localeHandle;
+    REQUIRE(oa_Context_locale(&actualErrorMsg, &localeHandle, contextHandle) == oa_ErrorCode_kOK);
+
+    oa_Context_dtor(contextHandle);
+
+    THEN("the locale handle remains valid") {
+      CHECK((*handles::trait::SharedTraitsData::toInstance(localeHandle))->hasTrait("aTrait"));
+    }
+
+    oa_trait_TraitsData_dtor(localeHandle);
+  }
+}
+
+SCENARIO("Querying the manager state of a Context") {
+  GIVEN("a Context without manager state") {
+    openassetio::ContextPtr context = openassetio::Context::make();
+    oa_Context_h contextHandle = handles::SharedContext::toHandle(&context);
+
+    THEN("the Context has no manager state") {
+      CHECK(!oa_Context_hasManagerState(contextHandle));
+    }
+
+    handles::SharedContext::release(contextHandle);
+  }
+
+  GIVEN("a Context with manager state") {
+    openassetio::ContextPtr context = openassetio::Context::make(
+        trait::TraitsData::make(), std::make_shared<openassetio::managerApi::ManagerStateBase>());
+    oa_Context_h contextHandle = handles::SharedContext::toHandle(&context);
+
+    THEN("the Context has manager state") { CHECK(oa_Context_hasManagerState(contextHandle)); }
+
+    handles::SharedContext::release(contextHandle);
+  }
+}
@@ -1,5 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
 #include <openassetio/c/errors.h>
@@ -446,6 +451,54 @@ SCENARIO("InfoDictionary string return with insufficient buffer capacity") {
   }
 }
 
+SCENARIO("InfoDictionary borrowed string view retrieval") {
+  GIVEN("a populated C++ InfoDictionary and its C handle") {
+    const InfoDictionaryFixture fixture{};
+    const auto& infoDictionaryHandle = fixture.infoDictionaryHandle_;
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStrStorageCapacity, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    oa_ConstStringView actualValue{nullptr, 0};
+
+    WHEN("a view of a string value is retrieved") {
+      const openassetio::Str& keyStr = InfoDictionaryFixture::kStrKey;
+      const oa_ErrorCode actualErrorCode = oa_InfoDictionary_getStrView(
+          &actualErrorMsg, &actualValue, infoDictionaryHandle, {keyStr.data(), keyStr.size()});
+
+      THEN("the view refers to the value stored in the map") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOK);
+        CHECK(actualValue == InfoDictionaryFixture::kStrValue);
+        CHECK(actualValue.data ==
+              std::get<openassetio::Str>(fixture.infoDictionary_.at(keyStr)).data());
+      }
+    }
+
+    WHEN("a view of a non-string value is retrieved") {
+      const openassetio::Str& keyStr = InfoDictionaryFixture::kIntKey;
+      const oa_ErrorCode actualErrorCode = oa_InfoDictionary_getStrView(
+          &actualErrorMsg, &actualValue, infoDictionaryHandle, {keyStr.data(), keyStr.size()});
+
+      THEN("error code and message is set") {
+        CHECK(actualErrorCode == oa_ErrorCode_kBadVariantAccess);
+        CHECK(actualErrorMsg == "Invalid value type");
+      }
+    }
+
+    WHEN("a view of a non-existent value is retrieved") {
+      const openassetio::Str& keyStr = InfoDictionaryFixture::kNonExistentKeyStr;
+      const oa_ErrorCode actualErrorCode = oa_InfoDictionary_getStrView(
+          &actualErrorMsg, &actualValue, infoDictionaryHandle, {keyStr.data(), keyStr.size()});
+
+      THEN("error code and message is set") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOutOfRange);
+        CHECK(actualErrorMsg == "Invalid key");
+      }
+    }
+  }
+}
+
 /**
  * Fixture for a specific C API mutator function, specialised by return
  * data type.
@@ -559,3 +612,109 @@ TEMPLATE_TEST_CASE_METHOD(MutatorFixture, "InfoDictionary mutated via C API", ""
     }
   }
 }
+
+namespace {
+/**
+ * Convert a C entry, as retrieved from an iterator, to a C++ key/value
+ * pair.
+ */
+InfoDictionary::value_type toKeyValue(const oa_InfoDictionary_Entry& entry) {
+  openassetio::Str key{entry.key.data, entry.key.size};
+  switch (entry.type) {
+    case oa_InfoDictionary_ValueType_kBool:
+      return {std::move(key), entry.value.boolValue};
+    case oa_InfoDictionary_ValueType_kInt:
+      return {std::move(key), openassetio::Int{entry.value.intValue}};
+    case oa_InfoDictionary_ValueType_kFloat:
+      return {std::move(key), entry.value.floatValue};
+    case oa_InfoDictionary_ValueType_kStr:
+      return {std::move(key), openassetio::Str{entry.strValue.data, entry.strValue.size}};
+  }
+  FAIL("Unexpected value type");
+  return {};
+}
+}  // namespace
+
+SCENARIO("InfoDictionary iteration") {
+  GIVEN("a populated InfoDictionary") {
+    InfoDictionaryFixture fixture;
+    const InfoDictionary& infoDictionary = fixture.infoDictionary_;
+    oa_InfoDictionary_h infoDictionaryHandle = fixture.infoDictionaryHandle_;
+
+    WHEN("entries are retrieved using a cursor") {
+      InfoDictionary actual;
+      oa_InfoDictionary_Iterator iterator;
+      oa_InfoDictionary_Entry entry{};
+
+      oa_InfoDictionary_begin(&iterator, infoDictionaryHandle);
+      while (oa_InfoDictionary_next(&entry, &iterator, infoDictionaryHandle)) {
+        CHECK(actual.insert(toKeyValue(entry)).second);
+      }
+
+      THEN("each entry is retrieved exactly once") { CHECK(actual == infoDictionary); }
+
+      THEN("string views refer to the map's storage") {
+        const openassetio::Str& expectedKey = InfoDictionaryFixture::kStrKey;
+        oa_InfoDictionary_begin(&iterator, infoDictionaryHandle);
+        while (oa_InfoDictionary_next(&entry, &iterator, infoDictionaryHandle)) {
+          if (std::string_view{entry.key.data, entry.key.size} == expectedKey) {
+            CHECK(entry.strValue.data ==
+                  std::get<openassetio::Str>(infoDictionary.at(expectedKey)).data());
+          }
+        }
+      }
+
+      AND_WHEN("the exhausted cursor is advanced again") {
+        const bool hasEntry = oa_InfoDictionary_next(&entry, &iterator, infoDictionaryHandle);
+
+        THEN("no entry is retrieved") { CHECK_FALSE(hasEntry); }
+      }
+    }
+
+    WHEN("all entries are retrieved in bulk") {
+      std::vector<oa_InfoDictionary_Entry> entries(infoDictionary.size(),
+                                                   oa_InfoDictionary_Entry{});
+      const std::size_t count =
+          oa_InfoDictionary_entries(entries.data(), entries.size(), infoDictionaryHandle);
+
+      THEN("each entry is retrieved exactly once") {
+        REQUIRE(count == infoDictionary.size());
+        InfoDictionary actual;
+        for (const oa_InfoDictionary_Entry& entry : entries) {
+          CHECK(actual.insert(toKeyValue(entry)).second);
+        }
+        CHECK(actual == infoDictionary);
+      }
+    }
+
+    WHEN("entries are retrieved in bulk with insufficient capacity") {
+      std::vector<oa_InfoDictionary_Entry> entries(infoDictionary.size() - 1,
+                                                   oa_InfoDictionary_Entry{});
+      const std::size_t count =
+          oa_InfoDictionary_entries(entries.data(), entries.size(), infoDictionaryHandle);
+
+      THEN("entries are retrieved up to the capacity") {
+        REQUIRE(count == entries.size());
+        for (const oa_InfoDictionary_Entry& entry : entries) {
+          const auto [key, value] = toKeyValue(entry);
+          CHECK(infoDictionary.at(key) == value);
+        }
+      }
+    }
+  }
+
+  GIVEN("an empty InfoDictionary") {
+    InfoDictionary infoDictionary;
+    oa_InfoDictionary_h infoDictionaryHandle = handles::InfoDictionary::toHandle(&infoDictionary);
+
+    WHEN("entries are retrieved using a cursor") {
+      oa_InfoDictionary_Iterator iterator;
+      oa_InfoDictionary_Entry entry{};
+      oa_InfoDictionary_begin(&iterator, infoDictionaryHandle);
+
+      THEN("no entry is retrieved") {
+        CHECK_FALSE(oa_InfoDictionary_next(&entry, &iterator, infoDictionaryHandle));
+      }
+    }
+  }
+}
@@ -106,3 +106,19 @@ SCENARIO("Creating and querying a C API immutable ConstStringView") {
     }
   }
 }
+
+SCENARIO("Borrowing a C++ string as a C API ConstStringView") {
+  GIVEN("A C++ string and an empty ConstStringView") {
+    const openassetio::Str expectedStr = "some string";
+    oa_ConstStringView actualStringView{nullptr, 0};
+
+    WHEN("borrowStringView is used to point the ConstStringView at the C++ string") {
+      openassetio::borrowStringView(&actualStringView, expectedStr);
+
+      THEN("ConstStringView refers to the C++ string's storage") {
+        CHECK(actualStringView.data == expectedStr.data());
+        CHECK(actualStringView.size == expectedStr.size());
+      }
+    }
+  }
+}
@@ -1,12 +1,20 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+#include <vector>
+
 #include <openassetio/c/StringView.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/namespace.h>
 
 #include <catch2/catch.hpp>
 
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
 // private headers
+#include <BatchBuffers.hpp>
 #include <errors.hpp>
 
 #include "StringViewReporting.hpp"
@@ -121,3 +129,59 @@ SCENARIO("Decorating an exception-throwing C++ function to instead return an err
     }
   }
 }
+
+SCENARIO("Batch element error records") {
+  using openassetio::errors::BatchElementError;
+  using Records = std::vector<std::pair<std::size_t, BatchElementError>>;
+
+  const BatchElementError error1{BatchElementError::ErrorCode::kInvalidEntityReference, "abc"};
+  const BatchElementError error2{BatchElementError::ErrorCode::kEntityAccessError, "defgh"};
+
+  const auto collect = [](const oa_BatchElementErrors& errorsView, const std::size_t batchSize) {
+    Records records;
+    openassetio::forEachBatchElementError(
+        errorsView, batchSize, [&](const std::size_t idx, BatchElementError error) {
+          records.emplace_back(idx, std::move(error));
+        });
+    return records;
+  };
+
+  GIVEN("storage with sufficient capacity") {
+    openassetio::BatchElementErrors errors{2, 8};
+    oa_BatchElementErrors errorsView = errors.view();
+
+    WHEN("errors are appended") {
+      openassetio::appendBatchElementError(&errorsView, 4, error1);
+      openassetio::appendBatchElementError(&errorsView, 1, error2);
+
+      THEN("a record per error is written, sharing the message buffer") {
+        CHECK(errorsView.count == 2);
+        CHECK(errorsView.messagesSize == 8);
+        CHECK(collect(errorsView, 5) == Records{{4, error1}, {1, error2}});
+      }
+
+      THEN("records for elements outside of the batch are rejected") {
+        CHECK_THROWS_AS(collect(errorsView, 4),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("storage with insufficient capacity") {
+    openassetio::BatchElementErrors errors{1, 3};
+    oa_BatchElementErrors errorsView = errors.view();
+
+    WHEN("errors are appended") {
+      openassetio::appendBatchElementError(&errorsView, 0, error2);
+      openassetio::appendBatchElementError(&errorsView, 1, error1);
+
+      THEN("messages are truncated and the count includes dropped records") {
+        CHECK(errorsView.count == 2);
+        CHECK(errorsView.messagesSize == 3);
+        CHECK(errorsView.records[0].messageSize == 3);
+        CHECK_THROWS_AS(collect(errorsView, 2),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+}
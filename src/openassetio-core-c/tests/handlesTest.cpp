@@ -5,6 +5,7 @@
 
 // Private headers
 #include <handles/Converter.hpp>
+#include <handles/HandleRegistry.hpp>
 
 SCENARIO("Converting to/from C++ instances and C opaque handles") {
   GIVEN("A C++ type") {
@@ -62,3 +63,90 @@ SCENARIO("Converting to/from C++ instances and C opaque handles") {
     }
   }
 }
+
+SCENARIO("Converting handles back to C++ instances on release") {
+  GIVEN("a C handle converted from a C++ instance") {
+    struct StubCppType {};
+    using StubCppTypeHandle = struct StubCppTypeUnusedOpaqueType*;
+    using Converter = openassetio::handles::Converter<StubCppType, StubCppTypeHandle>;
+
+    StubCppType expectedCppInstance;
+    StubCppTypeHandle handle = Converter::toHandle(&expectedCppInstance);
+
+    WHEN("the handle is released") {
+      StubCppType* actualCppInstance = Converter::release(handle);
+
+      THEN("the original instance is returned") {
+        CHECK(actualCppInstance == &expectedCppInstance);
+      }
+    }
+  }
+
+  GIVEN("a null C handle") {
+    using StubCppTypeHandle = struct StubCppTypeUnusedOpaqueType*;
+    using Converter = openassetio::handles::Converter<int, StubCppTypeHandle>;
+
+    THEN("converting and releasing give null pointers") {
+      CHECK(Converter::toHandle(nullptr) == nullptr);
+      CHECK(Converter::toInstance(nullptr) == nullptr);
+      CHECK(Converter::release(nullptr) == nullptr);
+    }
+  }
+}
+
+SCENARIO("Validating C handles using the handle registry") {
+  using openassetio::handles::HandleRegistry;
+  using Status = HandleRegistry::Status;
+
+  GIVEN("a pointer registered with the handle registry") {
+    int instance = 0;
+    const HandleRegistry::Value value = HandleRegistry::acquire(&instance, typeid(int));
+
+    THEN("the handle is valid and refers to the pointer") {
+      CHECK(value != 0);
+      CHECK(HandleRegistry::check(value, typeid(int)) == Status::kOk);
+      CHECK(HandleRegistry::lookup(value, typeid(int)) == &instance);
+    }
+
+    THEN("the handle is invalid for a different type") {
+      CHECK(HandleRegistry::check(value, typeid(float)) == Status::kWrongType);
+      CHECK(HandleRegistry::release(value, typeid(int)) == &instance);
+    }
+
+    WHEN("the handle is released") {
+      void* released = HandleRegistry::release(value, typeid(int));
+
+      THEN("the pointer is returned") { CHECK(released == &instance); }
+
+      THEN("the handle is stale") {
+        CHECK(HandleRegistry::check(value, typeid(int)) == Status::kStale);
+      }
+
+      AND_WHEN("another pointer is registered") {
+        int otherInstance = 0;
+        const HandleRegistry::Value otherValue =
+            HandleRegistry::acquire(&otherInstance, typeid(int));
+
+        THEN("the released handle remains stale") {
+          CHECK(otherValue != value);
+          CHECK(HandleRegistry::check(value, typeid(int)) == Status::kStale);
+          CHECK(HandleRegistry::check(otherValue, typeid(int)) == Status::kOk);
+        }
+
+        HandleRegistry::release(otherValue, typeid(int));
+      }
+    }
+  }
+
+  GIVEN("handle values that were never issued by the registry") {
+    THEN("the handles are invalid") {
+      CHECK(HandleRegistry::check(0, typeid(int)) == Status::kInvalid);
+      // Even generation, i.e. never live.
+      CHECK(HandleRegistry::check((HandleRegistry::Value{2} << 32) | 1, typeid(int)) ==
+            Status::kInvalid);
+      // Index beyond any allocated slot.
+      CHECK(HandleRegistry::check((HandleRegistry::Value{1} << 32) | 0xFFFFFFFF, typeid(int)) ==
+            Status::kInvalid);
+    }
+  }
+}
@@ -1,27 +1,45 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <openassetio/c/Arena.h>
+#include <openassetio/c/BatchBuffers.h>
+#include <openassetio/c/Context.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/hostApi/Manager.h>
 #include <openassetio/c/managerApi/HostSession.h>
 #include <openassetio/c/managerApi/ManagerInterface.h>
 #include <openassetio/c/namespace.h>
+#include <openassetio/c/trait/TraitsData.h>
 
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
 
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
 #include <openassetio/typedefs.hpp>
 
 // Private headers.
+#include <BatchBuffers.hpp>
+#include <handles/Context.hpp>
 #include <handles/InfoDictionary.hpp>
 #include <handles/hostApi/Manager.hpp>
 #include <handles/managerApi/HostSession.hpp>
 #include <handles/managerApi/ManagerInterface.hpp>
+#include <handles/trait/TraitsData.hpp>
 
 #include "../StringViewReporting.hpp"
 
@@ -51,6 +69,10 @@ struct MockManagerInterface : trompeloeil::mock_interface<managerApi::ManagerInt
   IMPLEMENT_MOCK7(resolve);
   IMPLEMENT_MOCK7(preflight);
   IMPLEMENT_MOCK7(register_);  // NOLINT(readability-identifier-naming)
+  IMPLEMENT_MOCK1(createState);
+  IMPLEMENT_MOCK2(createChildState);
+  IMPLEMENT_MOCK2(persistenceTokenForState);
+  IMPLEMENT_MOCK2(stateFromPersistenceToken);
 };
 /**
  * Mock implementation of a HostInterface.
@@ -374,3 +396,261 @@ SCENARIO("A host calls Manager::info") {
     }
   }
 }
+
+SCENARIO("A host calls Manager::resolve") {
+  namespace trait = openassetio::trait;
+  using openassetio::errors::BatchElementError;
+  using trompeloeil::_;
+
+  GIVEN("a Manager, a Context and their C handles") {
+    // Create mock ManagerInterface to inject and assert on.
+    const managerApi::ManagerInterfacePtr mockManagerInterfacePtr =
+        std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = static_cast<MockManagerInterface&>(*mockManagerInterfacePtr);
+    // Create a HostSession with our mock HostInterface
+    const managerApi::HostSessionPtr hostSessionPtr = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>());
+
+    // Create the Manager under test.
+    hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterfacePtr, hostSessionPtr);
+    // Create the handle for the Manager under test.
+    oa_hostApi_Manager_h managerHandle = handles::hostApi::SharedManager::toHandle(&manager);
+
+    openassetio::ContextPtr context = openassetio::Context::make();
+    oa_Context_h contextHandle = handles::SharedContext::toHandle(&context);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStringBufferSize, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    // Entity references "ref1", "ref2", "ref3", "notARef".
+    const std::vector<std::size_t> refOffsets{0, 4, 8, 12, 19};
+    const oa_ConstStringTable refs{"ref1ref2ref3notARef", refOffsets.data(),
+                                   refOffsets.size() - 1};
+    const std::vector<std::size_t> traitOffsets{0, 6};
+    const oa_ConstStringTable traitSet{"aTrait", traitOffsets.data(), 1};
+
+    // Storage for results.
+    std::vector<int> elementCodes(refs.count);
+    openassetio::BatchElementErrors errors{refs.count, kStringBufferSize};
+    oa_BatchElementErrors errorsView = errors.view();
+
+    const trait::TraitsDataPtr expectedTraitsData = trait::TraitsData::make({"aTrait"});
+    const trait::serialization::Bytes expectedBytes =
+        trait::serialization::serialize(*expectedTraitsData);
+
+    // Sufficient capacity for a single result.
+    openassetio::ByteTable results{refs.count, expectedBytes.size()};
+    oa_ByteTable resultsView = results.view();
+
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(false);
+    ALLOW_CALL(mockManagerInterface, isEntityReferenceString(_, _))
+        .RETURN(_1.rfind("ref", 0) == 0);
+
+    AND_GIVEN("ManagerInterface::resolve() succeeds for two elements and fails for another") {
+      REQUIRE_CALL(mockManagerInterface, resolve(_, trait::TraitSet{"aTrait"}, _, _, _, _, _))
+          .LR_WITH(_1.size() == 3)
+          .LR_WITH(_4 == context)
+          .LR_SIDE_EFFECT(_6(0, expectedTraitsData))
+          .LR_SIDE_EFFECT(_7(1, BatchElementError{
+                                    BatchElementError::ErrorCode::kEntityResolutionError,
+                                    "some error"}))
+          .LR_SIDE_EFFECT(_6(2, expectedTraitsData));
+
+      WHEN("the Manager C API is used to resolve the entity references") {
+        const oa_ErrorCode code = oa_hostApi_Manager_resolve(
+            &actualErrorMsg, elementCodes.data(), &errorsView, &resultsView,
+            managerHandle, refs, traitSet, 0, contextHandle);
+
+        THEN("results that fit are written, with codes for each element") {
+          CHECK(code == oa_ErrorCode_kOK);
+          CHECK(elementCodes[0] == oa_ErrorCode_kOK);
+          CHECK(elementCodes[1] == OPENASSETIO_BatchErrorCode_kEntityResolutionError);
+          CHECK(elementCodes[2] == oa_ErrorCode_kLengthError);
+          CHECK(elementCodes[3] == OPENASSETIO_BatchErrorCode_kInvalidEntityReference);
+
+          const std::string_view actualBytes = results.element(0);
+          CHECK(*trait::serialization::deserialize(
+                    reinterpret_cast<const std::byte*>(actualBytes.data()), actualBytes.size()) ==
+                *expectedTraitsData);
+          CHECK(results.elementSize(2) == expectedBytes.size());
+
+          std::map<std::size_t, BatchElementError> actualErrors;
+          openassetio::forEachBatchElementError(
+              errorsView, refs.count, [&](const std::size_t idx, BatchElementError error) {
+                actualErrors.emplace(idx, std::move(error));
+              });
+          CHECK(actualErrors ==
+                std::map<std::size_t, BatchElementError>{
+                    {1, BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError,
+                                          "some error"}},
+                    {3, BatchElementError{BatchElementError::ErrorCode::kInvalidEntityReference,
+                                          "Invalid entity reference"}}});
+        }
+      }
+
+      WHEN("the Manager C API is used to resolve the entity references into an arena") {
+        oa_Arena_h arena;
+        REQUIRE(oa_Arena_ctor(&actualErrorMsg, &arena, 0) == oa_ErrorCode_kOK);
+        std::vector<oa_trait_TraitsData_h> traitsDatas(refs.count);
+
+        const oa_ErrorCode code = oa_hostApi_Manager_resolveInArena(
+            &actualErrorMsg, elementCodes.data(), &errorsView, traitsDatas.data(), arena,
+            managerHandle, refs, traitSet, 0, contextHandle);
+
+        THEN("results are returned as handles, with codes for each element") {
+          CHECK(code == oa_ErrorCode_kOK);
+          CHECK(elementCodes[0] == oa_ErrorCode_kOK);
+          CHECK(elementCodes[1] == OPENASSETIO_BatchErrorCode_kEntityResolutionError);
+          CHECK(elementCodes[2] == oa_ErrorCode_kOK);
+          CHECK(elementCodes[3] == OPENASSETIO_BatchErrorCode_kInvalidEntityReference);
+
+          CHECK(**handles::trait::SharedTraitsData::toInstance(traitsDatas[0]) ==
+                *expectedTraitsData);
+          CHECK(**handles::trait::SharedTraitsData::toInstance(traitsDatas[2]) ==
+                *expectedTraitsData);
+        }
+
+        oa_Arena_dtor(arena);
+      }
+    }
+
+    WHEN("the Manager C API is used to resolve with an invalid access") {
+      const oa_ErrorCode code = oa_hostApi_Manager_resolve(
+          &actualErrorMsg, elementCodes.data(), &errorsView, &resultsView, managerHandle,
+          refs, traitSet, 42, contextHandle);
+
+      THEN("generic exception error code and message is set") {
+        CHECK(code == oa_ErrorCode_kException);
+        CHECK(actualErrorMsg == "Invalid access value: 42");
+      }
+    }
+  }
+}
+
+SCENARIO("A host creates and persists Contexts using the Manager C API") {
+  using trompeloeil::_;
+
+  GIVEN("a Manager supporting stateful contexts and its C handle") {
+    // Create mock ManagerInterface to inject and assert on.
+    const managerApi::ManagerInterfacePtr mockManagerInterfacePtr =
+        std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = static_cast<MockManagerInterface&>(*mockManagerInterfacePtr);
+    // Create a HostSession with our mock HostInterface
+    const managerApi::HostSessionPtr hostSessionPtr = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>());
+
+    // Create the Manager under test.
+    hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterfacePtr, hostSessionPtr);
+    // Create the handle for the Manager under test.
+    oa_hostApi_Manager_h managerHandle = handles::hostApi::SharedManager::toHandle(&manager);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStringBufferSize, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    ALLOW_CALL(mockManagerInterface, hasCapability(_))
+        .RETURN(_1 == managerApi::ManagerInterface::Capability::kStatefulContexts);
+
+    const managerApi::ManagerStateBasePtr state = std::make_shared<managerApi::ManagerStateBase>();
+    const openassetio::Str token = "a token";
+
+    WHEN("a Context is created using the C API") {
+      REQUIRE_CALL(mockManagerInterface, createState(hostSessionPtr)).RETURN(state);
+
+      oa_Context_h contextHandle;
+      const oa_ErrorCode code =
+          oa_hostApi_Manager_createContext(&actualErrorMsg, &contextHandle, managerHandle);
+
+      THEN("the Context holds the manager's state") {
+        REQUIRE(code == oa_ErrorCode_kOK);
+        const openassetio::ContextPtr& context =
+            *handles::SharedContext::toInstance(contextHandle);
+        CHECK(context->managerState == state);
+        CHECK(oa_Context_hasManagerState(contextHandle));
+
+        AND_WHEN("a child Context is created using the C API") {
+          const managerApi::ManagerStateBasePtr childState =
+              std::make_shared<managerApi::ManagerStateBase>();
+          REQUIRE_CALL(mockManagerInterface, createChildState(state, hostSessionPtr))
+              .RETURN(childState);
+
+          oa_Context_h childContextHandle;
+          const oa_ErrorCode childCode = oa_hostApi_Manager_createChildContext(
+              &actualErrorMsg, &childContextHandle, managerHandle, contextHandle);
+
+          THEN("the child Context holds the child state and a copy of the locale") {
+            REQUIRE(childCode == oa_ErrorCode_kOK);
+            const openassetio::ContextPtr& childContext =
+                *handles::SharedContext::toInstance(childContextHandle);
+            CHECK(childContext->managerState == childState);
+            CHECK(childContext->locale != context->locale);
+            CHECK(*childContext->locale == *context->locale);
+          }
+
+          oa_Context_dtor(childContextHandle);
+        }
+      }
+
+      oa_Context_dtor(contextHandle);
+    }
+
+    AND_GIVEN("a Context holding manager state") {
+      openassetio::ContextPtr context =
+          openassetio::Context::make(openassetio::trait::TraitsData::make(), state);
+      oa_Context_h contextHandle = handles::SharedContext::toHandle(&context);
+
+      REQUIRE_CALL(mockManagerInterface, persistenceTokenForState(state, hostSessionPtr))
+          .RETURN(token);
+
+      WHEN("a persistence token is retrieved into sufficient storage") {
+        openassetio::Str tokenStorage(kStringBufferSize, '\0');
+        oa_StringView actualToken{tokenStorage.size(), tokenStorage.data(), 0};
+
+        const oa_ErrorCode code = oa_hostApi_Manager_persistenceTokenForContext(
+            &actualErrorMsg, &actualToken, managerHandle, contextHandle);
+
+        THEN("the token is written") {
+          CHECK(code == oa_ErrorCode_kOK);
+          CHECK(actualToken == token);
+        }
+      }
+
+      WHEN("a persistence token is retrieved into insufficient storage") {
+        openassetio::Str tokenStorage(2, '\0');
+        oa_StringView actualToken{tokenStorage.size(), tokenStorage.data(), 0};
+
+        const oa_ErrorCode code = oa_hostApi_Manager_persistenceTokenForContext(
+            &actualErrorMsg, &actualToken, managerHandle, contextHandle);
+
+        THEN("a length error is returned along with the required size") {
+          CHECK(code == oa_ErrorCode_kLengthError);
+          CHECK(actualErrorMsg == "Insufficient storage for return value");
+          CHECK(actualToken.size == token.size());
+        }
+      }
+
+      handles::SharedContext::release(contextHandle);
+    }
+
+    WHEN("a Context is restored from a persistence token using the C API") {
+      REQUIRE_CALL(mockManagerInterface, stateFromPersistenceToken(token, hostSessionPtr))
+          .RETURN(state);
+
+      oa_Context_h contextHandle;
+      const oa_ErrorCode code = oa_hostApi_Manager_contextFromPersistenceToken(
+          &actualErrorMsg, &contextHandle, managerHandle, {token.data(), token.size()});
+
+      THEN("the Context holds the restored state") {
+        REQUIRE(code == oa_ErrorCode_kOK);
+        CHECK((*handles::SharedContext::toInstance(contextHandle))->managerState == state);
+      }
+
+      oa_Context_dtor(contextHandle);
+    }
+
+    handles::hostApi::SharedManager::release(managerHandle);
+  }
+}
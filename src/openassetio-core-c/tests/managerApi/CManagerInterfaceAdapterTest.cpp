@@ -1,5 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <map>
+#include <string_view>
+#include <utility>
+
+#include <openassetio/c/BatchBuffers.h>
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/namespace.h>
@@ -7,7 +13,16 @@
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
 
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
+
 // private headers
+#include <BatchBuffers.hpp>
+#include <StringView.hpp>
 #include <handles/InfoDictionary.hpp>
 #include <managerApi/CManagerInterfaceAdapter.hpp>
 
@@ -236,3 +251,137 @@ SCENARIO("A host calls CManagerInterfaceAdapter::info") {
     }
   }
 }
+
+SCENARIO("A host calls CManagerInterfaceAdapter::resolve") {
+  namespace trait = openassetio::trait;
+  using openassetio::EntityReference;
+  using openassetio::errors::BatchElementError;
+
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto const suite = mockManagerInterfaceSuite();
+
+    // Expect the destructor to be called, i.e. when cManagerInterface
+    // goes out of scope.
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+    const openassetio::EntityReferences entityReferences{
+        EntityReference{"ref1"}, EntityReference{"ref2"}, EntityReference{"ref3"}};
+
+    // Result whose serialisation exceeds the initial capacity.
+    const trait::TraitsDataPtr largeTraitsData = trait::TraitsData::make({"aTrait"});
+    largeTraitsData->setTraitProperty("aTrait", "aProp", openassetio::Str(2048, 'x'));
+    const trait::serialization::Bytes largeBytes =
+        trait::serialization::serialize(*largeTraitsData);
+    const trait::serialization::Bytes smallBytes =
+        trait::serialization::serialize(*trait::TraitsData::make({"aTrait"}));
+
+    const auto asChars = [](const trait::serialization::Bytes &bytes) {
+      return std::string_view{reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+    };
+
+    AND_GIVEN(
+        "the C suite's resolve() call succeeds for one element, fails for another, and has "
+        "insufficient capacity for the last") {
+      using trompeloeil::_;
+
+      REQUIRE_CALL(mockImpl, resolve(_, _, _, _, handle, _, _, 0))
+          .LR_WITH(_6.count == 3)
+          .LR_WITH(std::string_view{_6.data, _6.offsets[3]} == "ref1ref2ref3")
+          .LR_WITH(_7.count == 1)
+          .LR_WITH(openassetio::stringTableElement(_7, 0) == "aTrait")
+          .LR_SIDE_EFFECT(openassetio::appendByteTableElement(_4, 0, asChars(smallBytes)))
+          .LR_SIDE_EFFECT(_2[0] = oa_ErrorCode_kOK)
+          .LR_SIDE_EFFECT(openassetio::appendBatchElementError(
+              _3, 1,
+              BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError,
+                                "some error"}))
+          .LR_SIDE_EFFECT(_2[1] = OPENASSETIO_BatchErrorCode_kEntityResolutionError)
+          .LR_SIDE_EFFECT(
+              _2[2] = openassetio::appendByteTableElement(_4, 2, asChars(largeBytes))
+                          ? oa_ErrorCode_kOK
+                          : oa_ErrorCode_kLengthError)
+          .RETURN(oa_ErrorCode_kOK);
+
+      AND_GIVEN("the C suite's resolve() call succeeds when retried for the last element") {
+        REQUIRE_CALL(mockImpl, resolve(_, _, _, _, handle, _, _, 0))
+            .LR_WITH(_6.count == 1)
+            .LR_WITH(openassetio::stringTableElement(_6, 0) == "ref3")
+            .LR_WITH(_4->capacity == largeBytes.size())
+            .LR_SIDE_EFFECT(openassetio::appendByteTableElement(_4, 0, asChars(largeBytes)))
+            .LR_SIDE_EFFECT(_2[0] = oa_ErrorCode_kOK)
+            .RETURN(oa_ErrorCode_kOK);
+
+        WHEN("the entity references are resolved") {
+          std::map<std::size_t, trait::TraitsDataPtr> successes;
+          std::map<std::size_t, BatchElementError> failures;
+
+          cManagerInterface.resolve(
+              entityReferences, {"aTrait"}, openassetio::access::ResolveAccess::kRead, nullptr,
+              nullptr,
+              [&](std::size_t idx, trait::TraitsDataPtr traitsData) {
+                successes.emplace(idx, std::move(traitsData));
+              },
+              [&](std::size_t idx, BatchElementError error) {
+                failures.emplace(idx, std::move(error));
+              });
+
+          THEN("the results of all elements are given to the appropriate callbacks") {
+            REQUIRE(successes.size() == 2);
+            CHECK(*successes.at(0) == *trait::TraitsData::make({"aTrait"}));
+            CHECK(*successes.at(2) == *largeTraitsData);
+            REQUIRE(failures.size() == 1);
+            CHECK(failures.at(1) == BatchElementError{
+                                      BatchElementError::ErrorCode::kEntityResolutionError,
+                                      "some error"});
+          }
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite's resolve() call fails") {
+      using trompeloeil::_;
+
+      REQUIRE_CALL(mockImpl, resolve(_, _, _, _, handle, _, _, _))
+          .LR_SIDE_EFFECT(openassetio::assignStringView(_1, "some error happened"))
+          .RETURN(oa_ErrorCode_kUnknown);
+
+      WHEN("the entity references are resolved") {
+        THEN("an exception is thrown with expected error message") {
+          REQUIRE_THROWS_MATCHES(
+              cManagerInterface.resolve(
+                  entityReferences, {"aTrait"}, openassetio::access::ResolveAccess::kRead,
+                  nullptr, nullptr, [](auto...) { FAIL_CHECK("Unexpected success"); },
+                  [](auto...) { FAIL_CHECK("Unexpected error"); }),
+              std::runtime_error, Catch::Message("1: some error happened"));
+        }
+      }
+    }
+  }
+
+  GIVEN("A CManagerInterfaceAdapter wrapping a function suite without resolve()") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+    suite.resolve = nullptr;
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+    WHEN("the entity references are resolved") {
+      THEN("NotImplementedException is thrown") {
+        CHECK_THROWS_AS(cManagerInterface.resolve(
+                            {EntityReference{"ref1"}}, {"aTrait"},
+                            openassetio::access::ResolveAccess::kRead, nullptr, nullptr,
+                            [](auto...) {}, [](auto...) {}),
+                        openassetio::errors::NotImplementedException);
+      }
+    }
+  }
+}
@@ -32,6 +32,19 @@ struct MockCManagerInterfaceImpl {
 
   MAKE_MOCK3(info, oa_ErrorCode(oa_StringView *, oa_InfoDictionary_h,
                                 oa_managerApi_CManagerInterface_h));
+
+  MAKE_MOCK6(entityExists,
+             oa_ErrorCode(oa_StringView *, int *, oa_BatchElementErrors *, bool *,
+                          oa_managerApi_CManagerInterface_h, oa_ConstStringTable));
+
+  MAKE_MOCK8(resolve,
+             oa_ErrorCode(oa_StringView *, int *, oa_BatchElementErrors *, oa_ByteTable *,
+                          oa_managerApi_CManagerInterface_h, oa_ConstStringTable,
+                          oa_ConstStringTable, int));
+
+  MAKE_MOCK7(entityTraits,
+             oa_ErrorCode(oa_StringView *, int *, oa_BatchElementErrors *, oa_ByteTable *,
+                          oa_managerApi_CManagerInterface_h, oa_ConstStringTable, int));
 };
 
 /**
@@ -66,6 +79,30 @@ inline oa_managerApi_CManagerInterface_s mockManagerInterfaceSuite() {
       [](oa_StringView *err, oa_InfoDictionary_h out, oa_managerApi_CManagerInterface_h handle) {
         MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
         return api->info(err, out, handle);
+      },
+      // entityExists
+      [](oa_StringView *err, int *outElementCodes, oa_BatchElementErrors *outErrors,
+         bool *outExists, oa_managerApi_CManagerInterface_h handle,
+         oa_ConstStringTable entityReferences) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->entityExists(err, outElementCodes, outErrors, outExists, handle,
+                                 entityReferences);
+      },
+      // resolve
+      [](oa_StringView *err, int *outElementCodes, oa_BatchElementErrors *outErrors,
+         oa_ByteTable *outTraitsDatas, oa_managerApi_CManagerInterface_h handle,
+         oa_ConstStringTable entityReferences, oa_ConstStringTable traitSet, int resolveAccess) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->resolve(err, outElementCodes, outErrors, outTraitsDatas, handle,
+                            entityReferences, traitSet, resolveAccess);
+      },
+      // entityTraits
+      [](oa_StringView *err, int *outElementCodes, oa_BatchElementErrors *outErrors,
+         oa_ByteTable *outTraitSets, oa_managerApi_CManagerInterface_h handle,
+         oa_ConstStringTable entityReferences, int entityTraitsAccess) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->entityTraits(err, outElementCodes, outErrors, outTraitSets, handle,
+                                 entityReferences, entityTraitsAccess);
       }};
 }
 }  // namespace test
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+// Private headers.
+#include <pluginSystem/CPluginSystemManagerImplementationFactory.hpp>
+
+namespace {
+namespace pluginSystem = openassetio::pluginSystem;
+using openassetio::Identifier;
+using openassetio::Identifiers;
+using openassetio::Str;
+
+/**
+ * Root directory of the test plugin libraries, containing `pathA` and
+ * `pathB` subdirectories, see tests/CMakeLists.txt.
+ */
+const Str kPluginRoot{OPENASSETIO_CORE_C_TEST_PLUGIN_DIR};
+const Str kPathA = kPluginRoot + "/pathA";
+const Str kPathB = kPluginRoot + "/pathB";
+
+#if defined(_WIN32)
+constexpr char kPathSeparator = ';';
+#else
+constexpr char kPathSeparator = ':';
+#endif
+
+const Identifier kManagerPluginId = "org.openassetio.test.cPluginSystem.managerPlugin";
+const Identifier kManagerPluginBId = "org.openassetio.test.cPluginSystem.managerPluginB";
+
+struct RecordingLoggerInterface : openassetio::log::LoggerInterface {
+  void log(Severity severity, const Str& message) override {
+    messages.emplace_back(severity, message);
+  }
+
+  [[nodiscard]] bool logged(Severity severity) const {
+    return std::any_of(messages.begin(), messages.end(),
+                       [&](const auto& message) { return message.first == severity; });
+  }
+
+  std::vector<std::pair<Severity, Str>> messages;
+};
+
+Identifiers sorted(Identifiers identifiers) {
+  std::sort(identifiers.begin(), identifiers.end());
+  return identifiers;
+}
+}  // namespace
+
+SCENARIO("Instantiating managers from C plugins") {
+  GIVEN("a C manager implementation factory searching multiple paths") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto factory = pluginSystem::CPluginSystemManagerImplementationFactory::make(
+        kPathB + kPathSeparator + kPathA, logger);
+
+    THEN("manager plugins from all paths are listed") {
+      CHECK(sorted(factory->identifiers()) == Identifiers{kManagerPluginId, kManagerPluginBId});
+    }
+
+    THEN("libraries without an entry point are skipped without error") {
+      CHECK(!factory->identifiers().empty());
+      CHECK(!logger->logged(RecordingLoggerInterface::Severity::kError));
+    }
+
+    WHEN("a manager is instantiated") {
+      const openassetio::managerApi::ManagerInterfacePtr managerInterface =
+          factory->instantiate(kManagerPluginId);
+
+      THEN("the interface from the leftmost path is returned") {
+        CHECK(managerInterface->identifier() == kManagerPluginId);
+        CHECK(managerInterface->displayName() == "Plugin B");
+      }
+    }
+
+    WHEN("an unknown manager is instantiated") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(factory->instantiate("unknown"),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a C manager implementation factory with no search paths") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto factory = pluginSystem::CPluginSystemManagerImplementationFactory::make("", logger);
+
+    THEN("no plugins are listed and a warning is logged") {
+      CHECK(factory->identifiers().empty());
+      CHECK(logger->logged(RecordingLoggerInterface::Severity::kWarning));
+    }
+  }
+}
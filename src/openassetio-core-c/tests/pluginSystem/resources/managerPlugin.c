@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Test C manager plugin.
+ *
+ * Written in plain C to ensure the plugin API has no C++ dependencies.
+ *
+ * Built multiple times into different plugin search paths, with the
+ * identifier and display name given by the
+ * OPENASSETIO_TEST_PLUGIN_IDENTIFIER and
+ * OPENASSETIO_TEST_PLUGIN_DISPLAY_NAME compile definitions, such that
+ * precedence of search paths can be verified.
+ */
+#include <stddef.h>
+#include <string.h>
+
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/managerApi/CManagerInterface.h>
+#include <openassetio/c/pluginSystem/CManagerPlugin.h>
+
+/// Copy a null-terminated string into a StringView, if it fits.
+static oa_ErrorCode writeStr(oa_StringView* err, oa_StringView* out, const char* str) {
+  const size_t size = strlen(str);
+  if (size > out->capacity) {
+    const char* msg = "Insufficient storage";
+    err->size = strlen(msg) < err->capacity ? strlen(msg) : err->capacity;
+    memcpy(err->data, msg, err->size);
+    return oa_ErrorCode_kLengthError;
+  }
+  memcpy(out->data, str, size);
+  out->size = size;
+  return oa_ErrorCode_kOK;
+}
+
+static void managerDtor(oa_managerApi_CManagerInterface_h handle) { (void)handle; }
+
+static oa_ErrorCode managerIdentifier(oa_StringView* err, oa_StringView* out,
+                                      oa_managerApi_CManagerInterface_h handle) {
+  (void)handle;
+  return writeStr(err, out, OPENASSETIO_TEST_PLUGIN_IDENTIFIER);
+}
+
+static oa_ErrorCode managerDisplayName(oa_StringView* err, oa_StringView* out,
+                                       oa_managerApi_CManagerInterface_h handle) {
+  (void)handle;
+  return writeStr(err, out, OPENASSETIO_TEST_PLUGIN_DISPLAY_NAME);
+}
+
+static oa_ErrorCode pluginIdentifier(oa_StringView* err, oa_StringView* out) {
+  return writeStr(err, out, OPENASSETIO_TEST_PLUGIN_IDENTIFIER);
+}
+
+static oa_ErrorCode pluginInstantiate(oa_StringView* err,
+                                      oa_managerApi_CManagerInterface_h* outHandle,
+                                      oa_managerApi_CManagerInterface_s* outSuite) {
+  (void)err;
+  // Stateless, so any non-null handle will do.
+  static char instance;
+  *outHandle = (oa_managerApi_CManagerInterface_h)&instance;
+
+  memset(outSuite, 0, sizeof(*outSuite));
+  outSuite->dtor = &managerDtor;
+  outSuite->identifier = &managerIdentifier;
+  outSuite->displayName = &managerDisplayName;
+  return oa_ErrorCode_kOK;
+}
+
+static const oa_pluginSystem_CManagerPlugin_s kPlugin = {&pluginIdentifier, &pluginInstantiate};
+
+OPENASSETIO_C_PLUGIN_ENTRY_POINT(kPlugin)
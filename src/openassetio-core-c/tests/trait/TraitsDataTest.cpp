@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/c/BatchBuffers.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/trait/TraitsData.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
+#include <openassetio/typedefs.hpp>
+
+// Private headers.
+#include <BatchBuffers.hpp>
+#include <handles/trait/TraitsData.hpp>
+
+#include "../StringViewReporting.hpp"
+
+namespace handles = openassetio::handles;
+namespace trait = openassetio::trait;
+
+namespace {
+/// Default storage capacity for StringView C strings.
+constexpr std::size_t kStrStorageCapacity = 500;
+
+/// Construct a C string view of a string literal.
+oa_ConstStringView view(const std::string_view str) { return {str.data(), str.size()}; }
+}  // namespace
+
+SCENARIO("TraitsData construction, serialisation and destruction") {
+  // Storage for error messages coming from C API functions.
+  openassetio::Str errStorage(kStrStorageCapacity, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+  GIVEN("a populated TraitsData and its serialisation") {
+    const trait::TraitsDataPtr expected = trait::TraitsData::make({"aTrait", "anotherTrait"});
+    expected->setTraitProperty("aTrait", "aProp", openassetio::Str{"a value"});
+    const trait::serialization::Bytes bytes = trait::serialization::serialize(*expected);
+    const oa_ConstStringView bytesView{reinterpret_cast<const char*>(bytes.data()),
+                                       bytes.size()};
+
+    WHEN("a TraitsData handle is deserialised using the C API") {
+      oa_trait_TraitsData_h handle;
+      const oa_ErrorCode code =
+          oa_trait_TraitsData_deserialize(&actualErrorMsg, &handle, bytesView);
+
+      THEN("the handle holds an equal TraitsData") {
+        REQUIRE(code == oa_ErrorCode_kOK);
+        CHECK(**handles::trait::SharedTraitsData::toInstance(handle) == *expected);
+
+        AND_WHEN("the handle is serialised into sufficient storage") {
+          openassetio::Str storage(bytes.size(), '\0');
+          oa_StringView out{storage.size(), storage.data(), 0};
+          const oa_ErrorCode serializeCode =
+              oa_trait_TraitsData_serialize(&actualErrorMsg, &out, handle);
+
+          THEN("the serialisation is written") {
+            CHECK(serializeCode == oa_ErrorCode_kOK);
+            CHECK(std::string_view{out.data, out.size} ==
+                  std::string_view{bytesView.data, bytesView.size});
+          }
+        }
+
+        AND_WHEN("the handle is serialised into insufficient storage") {
+          openassetio::Str storage(bytes.size() - 1, '\0');
+          oa_StringView out{storage.size(), storage.data(), 0};
+          const oa_ErrorCode serializeCode =
+              oa_trait_TraitsData_serialize(&actualErrorMsg, &out, handle);
+
+          THEN("the required size is reported with a length error") {
+            CHECK(serializeCode == oa_ErrorCode_kLengthError);
+            CHECK(out.size == bytes.size());
+            CHECK(actualErrorMsg == "Insufficient storage for return value");
+          }
+        }
+
+        oa_trait_TraitsData_dtor(handle);
+      }
+    }
+
+    WHEN("a truncated buffer is deserialised using the C API") {
+      oa_trait_TraitsData_h handle = nullptr;
+      const oa_ErrorCode code = oa_trait_TraitsData_deserialize(
+          &actualErrorMsg, &handle, {bytesView.data, bytesView.size - 1});
+
+      THEN("an exception error code is returned and no handle is created") {
+        CHECK(code == oa_ErrorCode_kException);
+        CHECK(handle == nullptr);
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsData bulk property access") {
+  // Storage for error messages coming from C API functions.
+  openassetio::Str errStorage(kStrStorageCapacity, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+  GIVEN("a TraitsData handle constructed using the C API") {
+    oa_trait_TraitsData_h handle;
+    REQUIRE(oa_trait_TraitsData_ctor(&actualErrorMsg, &handle) == oa_ErrorCode_kOK);
+    const trait::TraitsDataPtr& traitsData = *handles::trait::SharedTraitsData::toInstance(handle);
+
+    WHEN("traits are added") {
+      const std::vector<std::size_t> offsets{0, 6, 11};
+      const oa_ConstStringTable traitIds{"aTraitempty", offsets.data(), 2};
+      const oa_ErrorCode code = oa_trait_TraitsData_addTraits(&actualErrorMsg, handle, traitIds);
+
+      THEN("the TraitsData has the traits") {
+        CHECK(code == oa_ErrorCode_kOK);
+        CHECK(traitsData->traitSet() == trait::TraitSet{"aTrait", "empty"});
+      }
+    }
+
+    WHEN("properties of each type are set in bulk") {
+      std::vector<oa_trait_TraitsData_PropertyRecord> records{
+          {{view("aTrait"), view("aBool")}, oa_trait_TraitsData_ValueType_kBool, {}, {}},
+          {{view("aTrait"), view("anInt")}, oa_trait_TraitsData_ValueType_kInt, {}, {}},
+          {{view("aTrait"), view("aFloat")}, oa_trait_TraitsData_ValueType_kFloat, {}, {}},
+          {{view("anotherTrait"), view("aStr")},
+           oa_trait_TraitsData_ValueType_kStr,
+           {},
+           view("a string")}};
+      records[0].value.boolValue = true;
+      records[1].value.intValue = 123;
+      records[2].value.floatValue = 0.5;
+
+      const oa_ErrorCode code = oa_trait_TraitsData_setProperties(&actualErrorMsg, handle,
+                                                                  records.data(), records.size());
+
+      THEN("the TraitsData has the expected properties") {
+        REQUIRE(code == oa_ErrorCode_kOK);
+
+        const trait::TraitsDataPtr expected = trait::TraitsData::make();
+        expected->setTraitProperty("aTrait", "aBool", true);
+        expected->setTraitProperty("aTrait", "anInt", openassetio::Int{123});
+        expected->setTraitProperty("aTrait", "aFloat", 0.5);
+        expected->setTraitProperty("anotherTrait", "aStr", openassetio::Str{"a string"});
+        CHECK(*traitsData == *expected);
+      }
+
+      AND_WHEN("the properties, and an unset property, are retrieved in bulk") {
+        const std::vector<oa_trait_TraitsData_PropertyKey> properties{
+            {view("aTrait"), view("aBool")},
+            {view("aTrait"), view("anInt")},
+            {view("aTrait"), view("aFloat")},
+            {view("anotherTrait"), view("aStr")},
+            {view("aTrait"), view("unset")}};
+
+        std::vector<int> codes(properties.size());
+        std::vector<oa_trait_TraitsData_ValueType> types(properties.size());
+        std::vector<oa_trait_TraitsData_PrimitiveValue> values(properties.size());
+        openassetio::ByteTable strValues{properties.size(), kStrStorageCapacity};
+        oa_ByteTable strValuesView = strValues.view();
+
+        const oa_ErrorCode getCode = oa_trait_TraitsData_getProperties(
+            &actualErrorMsg, codes.data(), types.data(), values.data(), &strValuesView, handle,
+            properties.data(), properties.size());
+
+        THEN("the values and their types are written, with codes for each element") {
+          REQUIRE(getCode == oa_ErrorCode_kOK);
+          CHECK(codes == std::vector<int>{oa_ErrorCode_kOK, oa_ErrorCode_kOK, oa_ErrorCode_kOK,
+                                          oa_ErrorCode_kOK, oa_ErrorCode_kOutOfRange});
+          CHECK(types[0] == oa_trait_TraitsData_ValueType_kBool);
+          CHECK(values[0].boolValue == true);
+          CHECK(types[1] == oa_trait_TraitsData_ValueType_kInt);
+          CHECK(values[1].intValue == 123);
+          CHECK(types[2] == oa_trait_TraitsData_ValueType_kFloat);
+          CHECK(values[2].floatValue == 0.5);
+          CHECK(types[3] == oa_trait_TraitsData_ValueType_kStr);
+          CHECK(strValues.element(3) == "a string");
+        }
+      }
+
+      AND_WHEN("a string property is retrieved into insufficient storage") {
+        const oa_trait_TraitsData_PropertyKey property{view("anotherTrait"), view("aStr")};
+
+        int elementCode{};
+        oa_trait_TraitsData_ValueType type{};
+        oa_trait_TraitsData_PrimitiveValue value{};
+        openassetio::ByteTable strValues{1, 2};
+        oa_ByteTable strValuesView = strValues.view();
+
+        const oa_ErrorCode getCode = oa_trait_TraitsData_getProperties(
+            &actualErrorMsg, &elementCode, &type, &value, &strValuesView, handle, &property, 1);
+
+        THEN("the required size is reported with a length error") {
+          CHECK(getCode == oa_ErrorCode_kOK);
+          CHECK(elementCode == oa_ErrorCode_kLengthError);
+          CHECK(strValues.elementSize(0) == std::string_view{"a string"}.size());
+          CHECK(strValuesView.size == 0);
+        }
+      }
+    }
+
+    WHEN("a property with an invalid type is set") {
+      const std::vector<oa_trait_TraitsData_PropertyRecord> records{
+          {{view("aTrait"), view("aProp")}, static_cast<oa_trait_TraitsData_ValueType>(0), {},
+           {}}};
+
+      const oa_ErrorCode code = oa_trait_TraitsData_setProperties(&actualErrorMsg, handle,
+                                                                  records.data(), records.size());
+
+      THEN("an exception error code and message is set") {
+        CHECK(code == oa_ErrorCode_kException);
+        CHECK(actualErrorMsg == "Invalid property value type: 0");
+      }
+    }
+
+    oa_trait_TraitsData_dtor(handle);
+  }
+}
+
+SCENARIO("TraitsData borrowed string view retrieval") {
+  // Storage for error messages coming from C API functions.
+  openassetio::Str errStorage(kStrStorageCapacity, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+  GIVEN("a TraitsData with string and non-string properties, and its C handle") {
+    trait::TraitsDataPtr traitsData = trait::TraitsData::make();
+    traitsData->setTraitProperty("aTrait", "aStr", openassetio::Str{"a string"});
+    traitsData->setTraitProperty("aTrait", "anInt", openassetio::Int{1});
+    oa_trait_TraitsData_h handle = handles::trait::SharedTraitsData::toHandle(&traitsData);
+
+    oa_ConstStringView actualValue{nullptr, 0};
+
+    WHEN("a view of a string property is retrieved") {
+      const oa_ErrorCode code = oa_trait_TraitsData_getStrView(
+          &actualErrorMsg, &actualValue, handle, {view("aTrait"), view("aStr")});
+
+      THEN("the view refers to the value stored in the TraitsData") {
+        CHECK(code == oa_ErrorCode_kOK);
+        CHECK(actualValue == "a string");
+        CHECK(actualValue.data == std::get<openassetio::Str>(*traitsData->getTraitPropertyView(
+                                                                 "aTrait", "aStr"))
+                                      .data());
+      }
+    }
+
+    WHEN("a view of a non-string property is retrieved") {
+      const oa_ErrorCode code = oa_trait_TraitsData_getStrView(
+          &actualErrorMsg, &actualValue, handle, {view("aTrait"), view("anInt")});
+
+      THEN("error code and message is set") {
+        CHECK(code == oa_ErrorCode_kBadVariantAccess);
+        CHECK(actualErrorMsg == "Invalid value type");
+      }
+    }
+
+    WHEN("a view of an unset property is retrieved") {
+      const oa_ErrorCode code = oa_trait_TraitsData_getStrView(
+          &actualErrorMsg, &actualValue, handle, {view("aTrait"), view("unset")});
+
+      THEN("error code and message is set") {
+        CHECK(code == oa_ErrorCode_kOutOfRange);
+        CHECK(actualErrorMsg == "Invalid key");
+      }
+    }
+  }
+}
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace benchmarks {
+
+/// Prefix of entity references understood by @ref NullManagerInterface.
+inline constexpr std::string_view kNullManagerPrefix = "null://";
+
+/**
+ * Manager that does as little as possible, such that benchmarks measure
+ * the overhead of the API layer rather than of the manager plugin.
+ *
+ * Every entity exists, resolves to an empty TraitsData with the
+ * requested traits, and has an empty management policy.
+ */
+class NullManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  explicit NullManagerInterface(const bool advertisePrefix = false)
+      : advertisePrefix_{advertisePrefix} {}
+
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.benchmark.null"; }
+
+  [[nodiscard]] Str displayName() const override { return "Null Manager"; }
+
+  [[nodiscard]] bool hasCapability(const Capability capability) override {
+    switch (capability) {
+      case Capability::kEntityReferenceIdentification:
+      case Capability::kManagementPolicyQueries:
+      case Capability::kEntityTraitIntrospection:
+      case Capability::kExistenceQueries:
+      case Capability::kResolution:
+      case Capability::kStatefulContexts:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  [[nodiscard]] InfoDictionary info() override {
+    if (!advertisePrefix_) {
+      return {};
+    }
+    return {{Str{constants::kInfoKey_EntityReferencesMatchPrefix}, Str{kNullManagerPrefix}}};
+  }
+
+  void initialize([[maybe_unused]] InfoDictionary managerSettings,
+                  [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {}
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, [[maybe_unused]] const access::PolicyAccess policyAccess,
+      [[maybe_unused]] const ContextConstPtr& context,
+      [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    trait::TraitsDatas policies;
+    policies.reserve(traitSets.size());
+    for (std::size_t idx = 0; idx < traitSets.size(); ++idx) {
+      policies.push_back(trait::TraitsData::make());
+    }
+    return policies;
+  }
+
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString,
+      [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return someString.compare(0, kNullManagerPrefix.size(), kNullManagerPrefix) == 0;
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return std::make_shared<managerApi::ManagerStateBase>();
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createChildState(
+      [[maybe_unused]] const managerApi::ManagerStateBasePtr& parentState,
+      [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return std::make_shared<managerApi::ManagerStateBase>();
+  }
+
+  void entityExists(const EntityReferences& entityReferences,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      successCallback(idx, true);
+    }
+  }
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               [[maybe_unused]] const access::ResolveAccess resolveAccess,
+               [[maybe_unused]] const ContextConstPtr& context,
+               [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               [[maybe_unused]] const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      successCallback(idx, trait::TraitsData::make(traitSet));
+    }
+  }
+
+ private:
+  bool advertisePrefix_;
+};
+
+/// Host that identifies itself, and nothing more.
+class NullHostInterface final : public hostApi::HostInterface {
+ public:
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.benchmark"; }
+  [[nodiscard]] Str displayName() const override { return "Benchmark Host"; }
+};
+
+/// Logger that discards all messages.
+class NullLogger final : public log::LoggerInterface {
+ public:
+  void log([[maybe_unused]] Severity severity, [[maybe_unused]] const Str& message) override {}
+};
+
+/**
+ * Construct and initialize a Manager wrapping the given manager plugin.
+ */
+inline hostApi::ManagerPtr makeManager(managerApi::ManagerInterfacePtr managerInterface) {
+  auto hostSession = managerApi::HostSession::make(
+      managerApi::Host::make(std::make_shared<NullHostInterface>()),
+      std::make_shared<NullLogger>());
+  auto manager = hostApi::Manager::make(std::move(managerInterface), std::move(hostSession));
+  manager->initialize({});
+  return manager;
+}
+
+/**
+ * Construct a batch of distinct entity references understood by
+ * @ref NullManagerInterface.
+ */
+inline EntityReferences makeEntityReferences(const std::size_t count) {
+  EntityReferences refs;
+  refs.reserve(count);
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    refs.emplace_back(Str{kNullManagerPrefix} + "asset" + std::to_string(idx));
+  }
+  return refs;
+}
+}  // namespace benchmarks
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
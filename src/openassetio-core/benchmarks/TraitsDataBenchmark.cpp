@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <benchmark/benchmark.h>
+
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include <testSupport/AllocationCounter.hpp>
+
+namespace {
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::testSupport::AllocationCounter;
+using openassetio::trait::TraitSet;
+using openassetio::trait::TraitsData;
+using openassetio::trait::TraitsDataPtr;
+using openassetio::trait::property::Value;
+
+const TraitSet kTraitSet{"openassetio-mediacreation:content.LocatableContent",
+                         "openassetio-mediacreation:managementPolicy.Managed",
+                         "openassetio-mediacreation:timeDomain.FrameRanged"};
+
+/// Populate traits data with properties typical of a resolve result.
+TraitsDataPtr makePopulated() {
+  auto traitsData = TraitsData::make(kTraitSet);
+  traitsData->setTraitProperty("openassetio-mediacreation:content.LocatableContent", "location",
+                               Str{"file:///mnt/projects/show/seq/shot/plate.%04d.exr"});
+  traitsData->setTraitProperty("openassetio-mediacreation:content.LocatableContent",
+                               "isTemplated", true);
+  traitsData->setTraitProperty("openassetio-mediacreation:timeDomain.FrameRanged", "startFrame",
+                               Int{1001});
+  traitsData->setTraitProperty("openassetio-mediacreation:timeDomain.FrameRanged", "endFrame",
+                               Int{1100});
+  return traitsData;
+}
+
+void BM_TraitsData_construct(benchmark::State& state) {
+  const AllocationCounter allocations;
+  for ([[maybe_unused]] auto _ : state) {
+    auto traitsData = TraitsData::make(kTraitSet);
+    benchmark::DoNotOptimize(traitsData);
+  }
+  state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations.count()),
+                                                benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TraitsData_construct);
+
+void BM_TraitsData_setTraitProperty(benchmark::State& state) {
+  const auto traitsData = TraitsData::make(kTraitSet);
+  Int frame = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    traitsData->setTraitProperty("openassetio-mediacreation:timeDomain.FrameRanged",
+                                 "startFrame", ++frame);
+  }
+}
+BENCHMARK(BM_TraitsData_setTraitProperty);
+
+void BM_TraitsData_getTraitProperty(benchmark::State& state) {
+  const auto traitsData = makePopulated();
+  Value value;
+  const AllocationCounter allocations;
+  for ([[maybe_unused]] auto _ : state) {
+    const bool found = traitsData->getTraitProperty(
+        &value, "openassetio-mediacreation:timeDomain.FrameRanged", "startFrame");
+    benchmark::DoNotOptimize(found);
+    benchmark::DoNotOptimize(value);
+  }
+  state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations.count()),
+                                                benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TraitsData_getTraitProperty);
+
+void BM_TraitsData_copy(benchmark::State& state) {
+  const TraitsDataPtr traitsData = makePopulated();
+  const AllocationCounter allocations;
+  for ([[maybe_unused]] auto _ : state) {
+    auto copy = TraitsData::make(traitsData);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations.count()),
+                                                benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TraitsData_copy);
+
+void BM_TraitsData_compare(benchmark::State& state) {
+  const auto lhs = makePopulated();
+  const auto rhs = makePopulated();
+  for ([[maybe_unused]] auto _ : state) {
+    const bool equal = *lhs == *rhs;
+    benchmark::DoNotOptimize(equal);
+  }
+}
+BENCHMARK(BM_TraitsData_compare);
+}  // namespace
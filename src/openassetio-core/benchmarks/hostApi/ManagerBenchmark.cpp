@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/SyntheticManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include <testSupport/AllocationCounter.hpp>
+
+#include "../NullManagerInterface.hpp"
+
+namespace {
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::benchmarks::kNullManagerPrefix;
+using openassetio::benchmarks::makeEntityReferences;
+using openassetio::benchmarks::NullManagerInterface;
+using openassetio::hostApi::Manager;
+using openassetio::hostApi::ManagerPtr;
+using openassetio::managerApi::SyntheticManagerInterface;
+using openassetio::trait::TraitSet;
+
+const TraitSet kTraitSet{"openassetio-mediacreation:content.LocatableContent"};
+
+/// Construct and initialize a Manager wrapping a null manager plugin.
+ManagerPtr makeManager(const bool advertisePrefix = false) {
+  return openassetio::benchmarks::makeManager(
+      std::make_shared<NullManagerInterface>(advertisePrefix));
+}
+
+void BM_Manager_resolve_single(benchmark::State& state) {
+  const auto manager = makeManager();
+  const auto context = manager->createContext();
+  const EntityReference ref{Str{kNullManagerPrefix} + "asset"};
+  for ([[maybe_unused]] auto _ : state) {
+    auto result = manager->resolve(ref, kTraitSet, ResolveAccess::kRead, context);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Manager_resolve_single);
+
+void BM_Manager_resolve_singleVariant(benchmark::State& state) {
+  const auto manager = makeManager();
+  const auto context = manager->createContext();
+  const EntityReference ref{Str{kNullManagerPrefix} + "asset"};
+  for ([[maybe_unused]] auto _ : state) {
+    auto result = manager->resolve(ref, kTraitSet, ResolveAccess::kRead, context,
+                                   Manager::BatchElementErrorPolicyTag::kVariant);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Manager_resolve_singleVariant);
+
+void BM_Manager_resolve_batch(benchmark::State& state) {
+  const auto manager = makeManager();
+  const auto context = manager->createContext();
+  const auto refs = makeEntityReferences(static_cast<std::size_t>(state.range(0)));
+  const openassetio::testSupport::AllocationCounter allocations;
+  for ([[maybe_unused]] auto _ : state) {
+    auto results = manager->resolve(refs, kTraitSet, ResolveAccess::kRead, context);
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations.count()),
+                                                benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_Manager_resolve_batch)->RangeMultiplier(8)->Range(1, 4096);
+
+/// Benchmark resolving a batch of `state.range(0)` entities from the
+/// synthetic manager, with `state.range(1)` properties per trait, such
+/// that the cost of marshalling larger results can be seen.
+void BM_Manager_resolve_synthetic(benchmark::State& state) {
+  const auto manager = openassetio::benchmarks::makeManager(SyntheticManagerInterface::make());
+  manager->initialize({{Str{SyntheticManagerInterface::kSettingsKey_PropertyCount},
+                        Int{state.range(1)}}});
+  const auto context = manager->createContext();
+
+  EntityReferences refs;
+  for (std::int64_t idx = 0; idx < state.range(0); ++idx) {
+    refs.emplace_back(Str{SyntheticManagerInterface::kDefaultPrefix} + std::to_string(idx));
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto results = manager->resolve(refs, kTraitSet, ResolveAccess::kRead, context);
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Manager_resolve_synthetic)
+    ->ArgNames({"batch", "properties"})
+    ->ArgsProduct({{1, 64, 4096}, {1, 16}});
+
+void BM_Manager_createContext(benchmark::State& state) {
+  const auto manager = makeManager();
+  for ([[maybe_unused]] auto _ : state) {
+    auto context = manager->createContext();
+    benchmark::DoNotOptimize(context);
+  }
+}
+BENCHMARK(BM_Manager_createContext);
+
+void BM_Manager_createChildContext(benchmark::State& state) {
+  const auto manager = makeManager();
+  const auto parentContext = manager->createContext();
+  for ([[maybe_unused]] auto _ : state) {
+    auto context = manager->createChildContext(parentContext);
+    benchmark::DoNotOptimize(context);
+  }
+}
+BENCHMARK(BM_Manager_createChildContext);
+
+/// Benchmark entity reference identification, where `state.range(0)`
+/// toggles whether the manager advertises a prefix.
+void BM_Manager_isEntityReferenceString(benchmark::State& state) {
+  const auto manager = makeManager(state.range(0) != 0);
+  const Str someString = Str{kNullManagerPrefix} + "asset";
+  for ([[maybe_unused]] auto _ : state) {
+    const bool isRef = manager->isEntityReferenceString(someString);
+    benchmark::DoNotOptimize(isRef);
+  }
+}
+BENCHMARK(BM_Manager_isEntityReferenceString)->ArgName("prefix")->Arg(0)->Arg(1);
+}  // namespace
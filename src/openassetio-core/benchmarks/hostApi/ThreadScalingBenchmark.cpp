@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of concurrent host usage, where many threads share one
+ * Manager, such that contention on shared state (e.g. the reference
+ * counts of the shared `HostSession`, `Context` and locale pointers,
+ * and any locks) limits throughput as the thread count scales.
+ *
+ * Each benchmark is run from 1 to 64 threads. Alongside the aggregate
+ * `items_per_second`, an `efficiency` counter reports the mean
+ * per-thread throughput as a fraction of the single-threaded
+ * throughput, such that 1 is perfect scaling.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../NullManagerInterface.hpp"
+
+namespace {
+using Clock = std::chrono::steady_clock;
+using openassetio::ContextConstPtr;
+using openassetio::ContextPtr;
+using openassetio::Int;
+using openassetio::access::ResolveAccess;
+using openassetio::benchmarks::makeEntityReferences;
+using openassetio::benchmarks::NullManagerInterface;
+using openassetio::errors::BatchElementError;
+using openassetio::hostApi::ManagerPtr;
+using openassetio::trait::TraitSet;
+using openassetio::trait::TraitsDataPtr;
+using openassetio::trait::property::Value;
+
+const TraitSet kTraitSet{"openassetio-mediacreation:content.LocatableContent"};
+
+constexpr int kMaxThreads = 64;
+
+/// Manager shared by all threads, as in a host.
+const ManagerPtr& sharedManager() {
+  static const ManagerPtr manager =
+      openassetio::benchmarks::makeManager(std::make_shared<NullManagerInterface>());
+  return manager;
+}
+
+/// Context shared by all threads, with a populated locale.
+const ContextPtr& sharedContext() {
+  static const ContextPtr context = [] {
+    ContextPtr newContext = sharedManager()->createContext();
+    newContext->locale->setTraitProperty("openassetio-benchmark:locale.Frame", "frame",
+                                         Int{1001});
+    return newContext;
+  }();
+  return context;
+}
+
+/**
+ * Single-threaded throughput of a benchmark, used to report the
+ * scaling efficiency of its multi-threaded runs.
+ *
+ * `ThreadRange` runs the single-threaded case first, so its throughput
+ * is known by the time multi-threaded cases run.
+ */
+class ScalingBaseline {
+ public:
+  /**
+   * Report the `efficiency` of this thread of the run, i.e. its
+   * throughput relative to the single-threaded run with the same
+   * `key`, typically the benchmark's argument.
+   */
+  void report(benchmark::State& state, const Clock::time_point start, const std::int64_t key) {
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    const double throughput = static_cast<double>(state.iterations()) / elapsed.count();
+    state.SetItemsProcessed(state.iterations());
+
+    const std::lock_guard lock{mutex_};
+    if (state.threads() == 1) {
+      baselines_[key] = throughput;
+    }
+    if (const auto iter = baselines_.find(key); iter != baselines_.end()) {
+      state.counters["efficiency"] =
+          benchmark::Counter(throughput / iter->second, benchmark::Counter::kAvgThreads);
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::map<std::int64_t, double> baselines_;
+};
+
+/// Resolve a single entity per call, where `state.range(0)` toggles
+/// whether all threads share a Context or each have their own.
+void BM_concurrent_resolve(benchmark::State& state) {
+  static ScalingBaseline baseline;
+  const ManagerPtr& manager = sharedManager();
+  const bool isContextShared = state.range(0) != 0;
+  const ContextConstPtr context = isContextShared ? sharedContext() : manager->createContext();
+  const auto refs = makeEntityReferences(1);
+
+  const Clock::time_point start = Clock::now();
+  for ([[maybe_unused]] auto _ : state) {
+    manager->resolve(
+        refs, kTraitSet, ResolveAccess::kRead, context,
+        [](std::size_t, TraitsDataPtr traitsData) { benchmark::DoNotOptimize(traitsData); },
+        [](std::size_t, const BatchElementError&) { std::abort(); });
+  }
+  baseline.report(state, start, state.range(0));
+}
+BENCHMARK(BM_concurrent_resolve)
+    ->ArgName("sharedContext")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, kMaxThreads)
+    ->UseRealTime();
+
+/// Create child contexts of a Context shared by all threads.
+void BM_concurrent_createChildContext(benchmark::State& state) {
+  static ScalingBaseline baseline;
+  const ManagerPtr& manager = sharedManager();
+  const ContextPtr& parentContext = sharedContext();
+
+  const Clock::time_point start = Clock::now();
+  for ([[maybe_unused]] auto _ : state) {
+    auto context = manager->createChildContext(parentContext);
+    benchmark::DoNotOptimize(context);
+  }
+  baseline.report(state, start, 0);
+}
+BENCHMARK(BM_concurrent_createChildContext)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+/// Read a property of the locale of a Context shared by all threads,
+/// where `state.range(0)` toggles whether the locale pointer is copied
+/// first, as is common when passing it between functions.
+void BM_concurrent_TraitsData_read(benchmark::State& state) {
+  static ScalingBaseline baseline;
+  const ContextPtr& context = sharedContext();
+  const bool isPointerCopied = state.range(0) != 0;
+  Value value;
+
+  const Clock::time_point start = Clock::now();
+  if (isPointerCopied) {
+    for ([[maybe_unused]] auto _ : state) {
+      const TraitsDataPtr locale = context->locale;
+      const bool found =
+          locale->getTraitProperty(&value, "openassetio-benchmark:locale.Frame", "frame");
+      benchmark::DoNotOptimize(found);
+      benchmark::DoNotOptimize(value);
+    }
+  } else {
+    for ([[maybe_unused]] auto _ : state) {
+      const bool found =
+          context->locale->getTraitProperty(&value, "openassetio-benchmark:locale.Frame", "frame");
+      benchmark::DoNotOptimize(found);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  baseline.report(state, start, state.range(0));
+}
+BENCHMARK(BM_concurrent_TraitsData_read)
+    ->ArgName("copyPointer")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, kMaxThreads)
+    ->UseRealTime();
+}  // namespace
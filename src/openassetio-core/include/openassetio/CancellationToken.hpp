@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+OPENASSETIO_DECLARE_PTR(CancellationToken)
+
+/**
+ * A flag, optionally with a deadline, signalling that the results of
+ * an in-flight API call are no longer required.
+ *
+ * A @ref host attaches a token to a @ref Context, then calls
+ * @ref cancel when, e.g., the user navigates away, or the token
+ * expires automatically once its deadline passes.
+ *
+ * A @ref manager may poll @ref isCancelled periodically during long
+ * running batch operations, and stop early if it returns `true`. Any
+ * elements of the batch not yet reported when the manager returns are
+ * reported to the host with a
+ * @fqref{errors.BatchElementError.ErrorCode.kCancelled} "kCancelled"
+ * error by the @fqref{hostApi.Manager} "Manager". Managers therefore
+ * need not report these elements themselves.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT CancellationToken final {
+ public:
+  OPENASSETIO_ALIAS_PTR(CancellationToken)
+
+  /// Clock used for deadlines.
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Construct a token that is cancelled only on request.
+   *
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   */
+  [[nodiscard]] static CancellationTokenPtr make();
+
+  /**
+   * Construct a token that is cancelled on request or once the given
+   * deadline passes, whichever is sooner.
+   *
+   * @param deadline Time after which the token is cancelled.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   */
+  [[nodiscard]] static CancellationTokenPtr make(Clock::time_point deadline);
+
+  /**
+   * Construct a token that is cancelled on request or once the given
+   * parent token is cancelled, whichever is sooner.
+   *
+   * Cancelling the child does not cancel the parent. This allows a
+   * single call to be stopped independently of others sharing the
+   * parent token.
+   *
+   * @param parent Token whose cancellation cancels this token. The
+   * child shares its deadline, if any.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If `parent` is null.
+   */
+  [[nodiscard]] static CancellationTokenPtr makeChild(CancellationTokenConstPtr parent);
+
+  /**
+   * Request cancellation.
+   *
+   * Subsequent calls have no effect.
+   */
+  void cancel();
+
+  /**
+   * @return Whether cancellation has been requested, or the deadline
+   * (if any) has passed.
+   */
+  [[nodiscard]] bool isCancelled() const;
+
+  /// @return Deadline of this token, if any.
+  [[nodiscard]] std::optional<Clock::time_point> deadline() const;
+
+ private:
+  CancellationToken(std::optional<Clock::time_point> deadline,
+                    CancellationTokenConstPtr parent);
+
+  std::atomic<bool> cancelled_{false};
+  const std::optional<Clock::time_point> deadline_;
+  const CancellationTokenConstPtr parent_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
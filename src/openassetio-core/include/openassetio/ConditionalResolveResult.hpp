@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <openassetio/export.h>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Result of a conditional resolution of a single entity.
+ *
+ * @see @fqref{hostApi.Manager.resolveIfChanged}
+ * "Manager.resolveIfChanged"
+ */
+struct ConditionalResolveResult {
+  /// Resolved data, or null if unchanged since the given generation.
+  trait::TraitsDataPtr traitsData;
+  /// Opaque token identifying the current generation of the data.
+  Str generationToken;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
 #include <memory>
 
 #include <openassetio/export.h>
@@ -8,6 +9,7 @@
 #include <openassetio/typedefs.hpp>
 
 OPENASSETIO_FWD_DECLARE(managerApi, ManagerStateBase)
+OPENASSETIO_FWD_DECLARE(CancellationToken)
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -39,6 +41,20 @@ class OPENASSETIO_CORE_EXPORT Context final {
  public:
   OPENASSETIO_ALIAS_PTR(Context)
 
+  /**
+   * Relative urgency of calls made using a context.
+   *
+   * @see @ref priority
+   */
+  enum class Priority {
+    /// Bulk work that can yield to other calls, e.g. validation.
+    kBackground,
+    /// Default priority.
+    kNormal,
+    /// Calls that a user is actively waiting on, e.g. UI lookups.
+    kInteractive
+  };
+
   /**
    * In many situations, the @ref trait_set of the desired @ref entity
    * itself is not entirely sufficient information to realize many
@@ -64,6 +80,35 @@ class OPENASSETIO_CORE_EXPORT Context final {
    */
   managerApi::ManagerStateBasePtr managerState;
 
+  /**
+   * Optional token used by the @ref host to signal that the results of
+   * calls using this context are no longer required, e.g. because a
+   * deadline has passed.
+   *
+   * Child contexts created with
+   * @fqref{hostApi.Manager.createChildContext} "createChildContext"
+   * share the token of their parent.
+   *
+   * @see @ref CancellationToken
+   */
+  CancellationTokenPtr cancellationToken;
+
+  /**
+   * Urgency of calls made using this context.
+   *
+   * If the @ref hostApi.Manager "Manager" is configured to schedule
+   * requests (see @fqref{hostApi.Manager.make} "Manager.make"),
+   * batches made with a @ref Priority.kBackground "kBackground"
+   * context are dispatched in chunks that yield to concurrent calls of
+   * higher priority. Manager plugins may also consult the priority
+   * when queueing work against their backend.
+   *
+   * Child contexts created with
+   * @fqref{hostApi.Manager.createChildContext} "createChildContext"
+   * inherit the priority of their parent.
+   */
+  Priority priority = Priority::kNormal;
+
   /**
    * Constructs a new context.
    *
@@ -74,6 +119,61 @@ class OPENASSETIO_CORE_EXPORT Context final {
   [[nodiscard]] static ContextPtr make(trait::TraitsDataPtr locale = trait::TraitsData::make(),
                                        managerApi::ManagerStateBasePtr managerState = nullptr);
 
+  /**
+   * Estimate the memory used by this context, in bytes.
+   *
+   * This includes the context itself and its @ref locale. The manager
+   * state is opaque, and the cancellation token is shared, so neither
+   * is included.
+   *
+   * @return Approximate number of bytes used.
+   *
+   * @see @fqref{trait.TraitsData.memoryUsage} "TraitsData.memoryUsage"
+   */
+  [[nodiscard]] std::size_t memoryUsage() const;
+
+  /**
+   * Return a fingerprint of the @ref locale and @ref managerState of
+   * this context, suitable for use as a cache key.
+   *
+   * The fingerprint combines the @ref locale's
+   * @fqref{trait.TraitsData.hash} "hash", which is maintained
+   * incrementally as the locale is modified, with the identity of the
+   * @ref managerState. It is therefore a constant-time operation, and
+   * always reflects the current state of the context, without needing
+   * to be invalidated. Contexts with equal locales and the same manager
+   * state have equal fingerprints. The cancellation token is not
+   * included.
+   *
+   * As with any hash, differing contexts may share a fingerprint, so
+   * caches must still compare the locale on a match. The fingerprint is
+   * only consistent within a single process.
+   *
+   * @return Fingerprint of this context.
+   */
+  [[nodiscard]] std::size_t fingerprint() const;
+
+  /**
+   * Take an immutable snapshot of this context, that can be shared
+   * between threads.
+   *
+   * Members of a `const` Context cannot be reassigned, but its @ref
+   * locale could still be modified through any other Context sharing
+   * it. The snapshot therefore holds its own copy of the @ref locale,
+   * which is cheap, since @fqref{trait.TraitsData} "TraitsData" storage
+   * is copy-on-write. Later modification of this context does not
+   * affect the snapshot. The @ref managerState and @ref
+   * cancellationToken are shared, and the @ref priority is copied.
+   *
+   * Mutable children of the snapshot can be derived using
+   * @fqref{hostApi.Manager.createChildContext} "createChildContext".
+   *
+   * @warning The locale of the snapshot must not be modified.
+   *
+   * @return Immutable snapshot of this context.
+   */
+  [[nodiscard]] ContextConstPtr freeze() const;
+
  private:
   Context(trait::TraitsDataPtr locale, managerApi::ManagerStateBasePtr managerState);
 };
@@ -2,6 +2,9 @@
 // Copyright 2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -31,6 +34,11 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
  * reference. See
  * @fqref{errors.BatchElementError.ErrorCode.kInvalidEntityReference}
  * "kInvalidEntityReference".
+ *
+ * The string is held in immutable, reference-counted storage, so
+ * copying an EntityReference (e.g. when copying a batch of
+ * references between API layers) shares the string rather than
+ * duplicating it. A moved-from EntityReference holds an empty string.
  */
 class EntityReference final {
  public:
@@ -38,7 +46,7 @@ class EntityReference final {
    * Constructs an EntityReference around the supplied string.
    */
   explicit EntityReference(Str entityReferenceString)
-      : entityReferenceString_(std::move(entityReferenceString)) {}
+      : entityReferenceString_(std::make_shared<const Str>(std::move(entityReferenceString))) {}
 
   /**
    * Compare the contents of this reference with another for equality.
@@ -48,22 +56,54 @@ class EntityReference final {
    * @return `true` if contents are equal, `false` otherwise.
    */
   bool operator==(const EntityReference& other) const {
-    return other.entityReferenceString_ == entityReferenceString_;
+    return other.entityReferenceString_ == entityReferenceString_ ||
+           other.toString() == toString();
   }
 
+  /**
+   * Compare the contents of this reference with another for
+   * inequality.
+   *
+   * @param other Entity reference to compare against.
+   *
+   * @return `true` if contents differ, `false` otherwise.
+   */
+  bool operator!=(const EntityReference& other) const { return !(*this == other); }
+
   /**
    * @return The string representation of this entity reference.
    */
-  [[nodiscard]] const Str& toString() const { return entityReferenceString_; }
+  [[nodiscard]] const Str& toString() const {
+    if (!entityReferenceString_) {
+      static const Str kEmpty;
+      return kEmpty;
+    }
+    return *entityReferenceString_;
+  }
 
  private:
-  Str entityReferenceString_;
+  /// Shared between copies. Null only once moved-from.
+  std::shared_ptr<const Str> entityReferenceString_;
 };
 
 static_assert(std::is_move_constructible_v<EntityReference>);
 static_assert(std::is_move_assignable_v<EntityReference>);
+static_assert(std::is_nothrow_copy_constructible_v<EntityReference>);
 
 /// A list of entity references, used or batch-first functions.
 using EntityReferences = std::vector<EntityReference>;
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
+
+namespace std {
+/**
+ * Hash of an @ref EntityReference, consistent with its equality
+ * operator, allowing use as a key in unordered containers.
+ */
+template <>
+struct hash<openassetio::EntityReference> {
+  std::size_t operator()(const openassetio::EntityReference& entityReference) const noexcept {
+    return std::hash<openassetio::Str>{}(entityReference.toString());
+  }
+};
+}  // namespace std
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * A batch of entity reference strings, stored contiguously in a single
+ * buffer alongside an array of offsets.
+ *
+ * This is a compact alternative to @ref EntityReferences for very
+ * large batches, requiring only two allocations regardless of the
+ * number of references, and giving linear memory access when
+ * iterating.
+ *
+ * Elements are accessed as `std::string_view`s into the buffer, which
+ * are invalidated if the batch is modified or destroyed.
+ *
+ * Batch methods of @fqref{hostApi.Manager} "Manager" that accept
+ * EntityReferenceBatch convert to @ref EntityReferences once, at the
+ * boundary with the manager plugin.
+ *
+ * As with @ref EntityReference, the strings should have been validated
+ * by the target @ref manager, e.g. via
+ * @fqref{hostApi.Manager.isEntityReferenceString}
+ * "isEntityReferenceString".
+ */
+class OPENASSETIO_CORE_EXPORT EntityReferenceBatch final {
+ public:
+  /// Construct an empty batch.
+  EntityReferenceBatch();
+
+  /**
+   * Construct a batch holding copies of the given references' strings.
+   *
+   * @param entityReferences References to copy.
+   */
+  explicit EntityReferenceBatch(const EntityReferences& entityReferences);
+
+  /**
+   * Pre-allocate storage.
+   *
+   * @param count Expected number of references.
+   * @param totalLength Expected total length of all reference strings.
+   */
+  void reserve(std::size_t count, std::size_t totalLength);
+
+  /**
+   * Append an entity reference string to the end of the batch.
+   *
+   * @param entityReferenceString String to copy into the batch.
+   */
+  void append(std::string_view entityReferenceString);
+
+  /// @return Number of references in the batch.
+  [[nodiscard]] std::size_t size() const;
+
+  /// @return Whether the batch holds no references.
+  [[nodiscard]] bool empty() const;
+
+  /**
+   * Access an entity reference string without bounds checking.
+   *
+   * @param index Index of the reference in the batch.
+   * @return View of the reference string within the batch's buffer.
+   */
+  [[nodiscard]] std::string_view operator[](std::size_t index) const;
+
+  /**
+   * Construct an @ref EntityReference for an element of the batch.
+   *
+   * @param index Index of the reference in the batch.
+   * @return Newly constructed entity reference.
+   * @exception errors.InputValidationException If `index` is out of
+   * range.
+   */
+  [[nodiscard]] EntityReference entityReference(std::size_t index) const;
+
+  /// @return An @ref EntityReference for each element of the batch.
+  [[nodiscard]] EntityReferences toEntityReferences() const;
+
+  /**
+   * Compare the contents of this batch with another for equality.
+   *
+   * @param other Batch to compare against.
+   * @return `true` if both batches hold the same strings, in the same
+   * order.
+   */
+  bool operator==(const EntityReferenceBatch& other) const;
+
+ private:
+  /// Concatenation of all reference strings.
+  Str buffer_;
+  /// Start of each reference in `buffer_`, plus a trailing end offset.
+  std::vector<std::size_t> offsets_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
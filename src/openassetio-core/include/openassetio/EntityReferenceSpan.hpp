@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * A non-owning, read-only view of a contiguous range of
+ * @ref EntityReference "entity references".
+ *
+ * This allows a sub-range of a larger batch, or references held in
+ * some other contiguous container, to be given to batch methods of
+ * @fqref{hostApi.Manager} "Manager" without first copying them into a
+ * new @ref EntityReferences. A single reference can be viewed as a
+ * batch of one via its address.
+ *
+ * The viewed references are not copied, so must outlive the span.
+ */
+class EntityReferenceSpan final {
+ public:
+  /// Iterator over the viewed references.
+  using const_iterator = const EntityReference*;
+
+  /// Construct an empty span.
+  constexpr EntityReferenceSpan() noexcept = default;
+
+  /**
+   * Construct a span viewing a contiguous range of references.
+   *
+   * @param data Pointer to the first reference.
+   * @param size Number of references.
+   */
+  constexpr EntityReferenceSpan(const EntityReference* data, const std::size_t size) noexcept
+      : data_{data}, size_{size} {}
+
+  /**
+   * Construct a span viewing all elements of a list of references.
+   *
+   * @param entityReferences References to view.
+   */
+  // NOLINTNEXTLINE(*-explicit-constructor,*-explicit-conversions)
+  EntityReferenceSpan(const EntityReferences& entityReferences) noexcept
+      : data_{entityReferences.data()}, size_{entityReferences.size()} {}
+
+  /// @return Pointer to the first viewed reference.
+  [[nodiscard]] constexpr const EntityReference* data() const noexcept { return data_; }
+
+  /// @return Number of viewed references.
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+
+  /// @return Whether no references are viewed.
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+  /// @return Iterator to the first viewed reference.
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return data_; }
+
+  /// @return Iterator past the last viewed reference.
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return data_ + size_; }
+
+  /**
+   * Access a viewed reference without bounds checking.
+   *
+   * @param index Index of the reference in the span.
+   * @return The reference.
+   */
+  [[nodiscard]] constexpr const EntityReference& operator[](const std::size_t index) const {
+    return data_[index];
+  }
+
+  /**
+   * Get a span viewing a sub-range of this span.
+   *
+   * @param offset Index of the first reference of the sub-range.
+   * @param count Number of references in the sub-range.
+   * @return Span viewing the sub-range.
+   * @exception errors.InputValidationException If the sub-range is
+   * out of range.
+   */
+  [[nodiscard]] EntityReferenceSpan subspan(const std::size_t offset,
+                                            const std::size_t count) const {
+    if (offset > size_ || count > size_ - offset) {
+      throw errors::InputValidationException{"Sub-range of entity references is out of range."};
+    }
+    return EntityReferenceSpan{data_ + offset, count};
+  }
+
+  /// @return A copy of the viewed references.
+  [[nodiscard]] EntityReferences toEntityReferences() const { return {begin(), end()}; }
+
+ private:
+  const EntityReference* data_{nullptr};
+  std::size_t size_{0};
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a compact, string-keyed associative container.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * A map from string keys to values, stored as a single vector of
+ * key/value pairs sorted by key.
+ *
+ * Maps in the API, such as @fqref{InfoDictionary} "InfoDictionary",
+ * typically hold a few tens of entries, are built once and then
+ * queried or copied. For these, a sorted vector is considerably
+ * cheaper than a hash map: construction and copying perform a single
+ * allocation for the entries (plus any long strings), lookup is a
+ * binary search over contiguous memory, and there is no per-node or
+ * bucket overhead. Insertion and erasure are linear in the number of
+ * entries, so this container is not suited to large, frequently
+ * modified maps.
+ *
+ * The interface mirrors the commonly used subset of
+ * `std::unordered_map`, so existing code continues to compile.
+ * Lookup accepts any string-like key without constructing a string.
+ * Iteration is in key order.
+ *
+ * Keys must not be modified via iterators, since this would break the
+ * ordering of entries. As with `std::vector`, iterators and references
+ * are invalidated by insertion and erasure.
+ *
+ * @tparam T Type of mapped value.
+ */
+template <class T>
+class FlatStrMap final {
+ public:
+  using key_type = std::string;
+  using mapped_type = T;
+  using value_type = std::pair<std::string, T>;
+  using size_type = std::size_t;
+  using iterator = typename std::vector<value_type>::iterator;
+  using const_iterator = typename std::vector<value_type>::const_iterator;
+
+  /// Construct an empty map.
+  FlatStrMap() = default;
+
+  /**
+   * Construct from a list of entries.
+   *
+   * If a key is duplicated, the first entry with that key is kept.
+   */
+  FlatStrMap(const std::initializer_list<value_type> entries) {
+    insert(entries.begin(), entries.end());
+  }
+
+  /**
+   * Construct from a range of entries.
+   *
+   * If a key is duplicated, the first entry with that key is kept.
+   */
+  template <class InputIt>
+  FlatStrMap(const InputIt first, const InputIt last) {
+    insert(first, last);
+  }
+
+  /**
+   * @name Iteration
+   * @{
+   */
+  [[nodiscard]] iterator begin() noexcept { return entries_.begin(); }
+  [[nodiscard]] const_iterator begin() const noexcept { return entries_.begin(); }
+  [[nodiscard]] const_iterator cbegin() const noexcept { return entries_.cbegin(); }
+  [[nodiscard]] iterator end() noexcept { return entries_.end(); }
+  [[nodiscard]] const_iterator end() const noexcept { return entries_.end(); }
+  [[nodiscard]] const_iterator cend() const noexcept { return entries_.cend(); }
+  /// @}
+
+  /// @return Whether the map has no entries.
+  [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+  /// @return Number of entries.
+  [[nodiscard]] size_type size() const noexcept { return entries_.size(); }
+
+  /// Remove all entries, retaining allocated capacity.
+  void clear() noexcept { entries_.clear(); }
+
+  /**
+   * Pre-allocate storage for a number of entries.
+   *
+   * @param count Number of entries to reserve.
+   */
+  void reserve(const size_type count) { entries_.reserve(count); }
+
+  /**
+   * @param key Key to find.
+   * @return Iterator to the entry with the given key, or @ref end if
+   * there is none.
+   */
+  [[nodiscard]] iterator find(const std::string_view key) {
+    const iterator iter = lowerBound(key);
+    return iter != entries_.end() && iter->first == key ? iter : entries_.end();
+  }
+
+  /// @copydoc find
+  [[nodiscard]] const_iterator find(const std::string_view key) const {
+    return const_cast<FlatStrMap*>(this)->find(key);  // NOLINT(*-const-cast)
+  }
+
+  /**
+   * @param key Key to find.
+   * @return Number of entries with the given key, i.e. 0 or 1.
+   */
+  [[nodiscard]] size_type count(const std::string_view key) const {
+    return find(key) == entries_.end() ? 0 : 1;
+  }
+
+  /**
+   * @param key Key to find.
+   * @return Value of the entry with the given key.
+   * @exception std::out_of_range If there is no such entry.
+   */
+  [[nodiscard]] T& at(const std::string_view key) {
+    const iterator iter = find(key);
+    if (iter == entries_.end()) {
+      throw std::out_of_range{"FlatStrMap::at"};
+    }
+    return iter->second;
+  }
+
+  /// @copydoc at
+  [[nodiscard]] const T& at(const std::string_view key) const {
+    return const_cast<FlatStrMap*>(this)->at(key);  // NOLINT(*-const-cast)
+  }
+
+  /**
+   * Access the value of the entry with the given key, inserting a
+   * default constructed value if there is none.
+   *
+   * @param key Key to find.
+   * @return Value of the entry.
+   */
+  T& operator[](const std::string_view key) { return try_emplace(key).first->second; }
+
+  /**
+   * Insert an entry, if there is no entry with the same key.
+   *
+   * @param entry Key and value to insert.
+   * @return Iterator to the entry with the key, and whether the entry
+   * was inserted.
+   */
+  std::pair<iterator, bool> insert(value_type entry) {
+    const iterator iter = lowerBound(entry.first);
+    if (iter != entries_.end() && iter->first == entry.first) {
+      return {iter, false};
+    }
+    return {entries_.insert(iter, std::move(entry)), true};
+  }
+
+  /**
+   * Insert a range of entries, skipping those whose key is already
+   * present (or duplicated earlier in the range).
+   *
+   * The range is appended and then sorted as a whole, rather than
+   * inserting each entry in turn.
+   */
+  template <class InputIt>
+  void insert(const InputIt first, const InputIt last) {
+    entries_.insert(entries_.end(), first, last);
+    // A stable sort keeps existing entries, then earlier entries of
+    // the range, ahead of later ones with the same key.
+    std::stable_sort(entries_.begin(), entries_.end(),
+                     [](const value_type& lhs, const value_type& rhs) {
+                       return lhs.first < rhs.first;
+                     });
+    entries_.erase(std::unique(entries_.begin(), entries_.end(),
+                               [](const value_type& lhs, const value_type& rhs) {
+                                 return lhs.first == rhs.first;
+                               }),
+                   entries_.end());
+  }
+
+  /**
+   * Construct an entry in place, and insert it if there is no entry
+   * with the same key.
+   *
+   * @return Iterator to the entry with the key, and whether the entry
+   * was inserted.
+   */
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  /**
+   * Insert an entry with a value constructed from the given arguments,
+   * if there is no entry with the same key.
+   *
+   * Unlike @ref emplace, neither the key nor the value are constructed
+   * if the key is already present.
+   *
+   * @return Iterator to the entry with the key, and whether the entry
+   * was inserted.
+   */
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const std::string_view key, Args&&... args) {
+    const iterator iter = lowerBound(key);
+    if (iter != entries_.end() && iter->first == key) {
+      return {iter, false};
+    }
+    return {entries_.emplace(iter, std::piecewise_construct, std::forward_as_tuple(key),
+                             std::forward_as_tuple(std::forward<Args>(args)...)),
+            true};
+  }
+
+  /**
+   * Insert an entry, or assign to the value of the existing entry with
+   * the same key.
+   *
+   * @return Iterator to the entry with the key, and whether the entry
+   * was inserted.
+   */
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(std::string key, M&& value) {
+    const iterator iter = lowerBound(key);
+    if (iter != entries_.end() && iter->first == key) {
+      iter->second = std::forward<M>(value);
+      return {iter, false};
+    }
+    return {entries_.emplace(iter, std::move(key), std::forward<M>(value)), true};
+  }
+
+  /**
+   * Remove the entry with the given key, if any.
+   *
+   * @param key Key to remove.
+   * @return Number of entries removed, i.e. 0 or 1.
+   */
+  size_type erase(const std::string_view key) {
+    const iterator iter = find(key);
+    if (iter == entries_.end()) {
+      return 0;
+    }
+    entries_.erase(iter);
+    return 1;
+  }
+
+  /**
+   * Remove the entry at the given position.
+   *
+   * @param pos Iterator to the entry to remove.
+   * @return Iterator to the following entry.
+   */
+  iterator erase(const const_iterator pos) { return entries_.erase(pos); }
+
+  /**
+   * Move entries from another map whose keys are not present in this
+   * map. Entries with keys already present are left in the source.
+   *
+   * @param source Map to take entries from.
+   */
+  void merge(FlatStrMap& source) {
+    std::vector<value_type> taken;
+    std::vector<value_type> kept;
+    for (value_type& entry : source.entries_) {
+      (find(entry.first) == entries_.end() ? taken : kept).push_back(std::move(entry));
+    }
+    // Entries remain sorted, since order is preserved.
+    source.entries_ = std::move(kept);
+    insert(std::make_move_iterator(taken.begin()), std::make_move_iterator(taken.end()));
+  }
+
+  /// Compare entries, which are in key order.
+  friend bool operator==(const FlatStrMap& lhs, const FlatStrMap& rhs) {
+    return lhs.entries_ == rhs.entries_;
+  }
+
+  friend bool operator!=(const FlatStrMap& lhs, const FlatStrMap& rhs) { return !(lhs == rhs); }
+
+ private:
+  [[nodiscard]] iterator lowerBound(const std::string_view key) {
+    return std::lower_bound(entries_.begin(), entries_.end(), key,
+                            [](const value_type& entry, const std::string_view target) {
+                              return entry.first < target;
+                            });
+  }
+
+  std::vector<value_type> entries_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
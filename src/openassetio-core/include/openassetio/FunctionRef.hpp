@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a non-owning reference to a callable.
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+
+template <class Signature>
+class FunctionRef;
+
+/**
+ * A non-owning, type-erased reference to a callable with the given
+ * signature.
+ *
+ * Unlike `std::function`, constructing a FunctionRef never allocates,
+ * regardless of the size of the callable's captures. The referenced
+ * callable is not copied, so must outlive the FunctionRef, and any
+ * copies of it.
+ *
+ * A FunctionRef is trivially copyable and two pointers in size, so it
+ * is stored inline by `std::function`, i.e. without allocating. It can
+ * therefore be passed as any of the batch API callback types, such as
+ * @fqref{hostApi.Manager.ResolveSuccessCallback}
+ * "ResolveSuccessCallback", to avoid an allocation when the callback
+ * has large captures, e.g.
+ *
+ * @code
+ * const auto onSuccess = [&](std::size_t idx, trait::TraitsDataPtr data) { ... };
+ * manager->resolve(
+ *     entityReferences, traitSet, access::ResolveAccess::kRead, context,
+ *     FunctionRef<void(std::size_t, trait::TraitsDataPtr)>{onSuccess}, errorCallback);
+ * @endcode
+ *
+ * This is only safe for synchronous calls, since the callback must not
+ * be retained beyond the lifetime of the callable.
+ *
+ * @tparam R Return type.
+ * @tparam Args Argument types.
+ */
+template <class R, class... Args>
+class FunctionRef<R(Args...)> {
+ public:
+  /**
+   * Construct a reference to the given callable.
+   *
+   * @param callable Callable to reference. Must outlive this instance.
+   */
+  template <class Callable,
+            class = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, FunctionRef> &&
+                                     std::is_invocable_r_v<R, Callable&, Args...>>>
+  // NOLINTNEXTLINE(*-explicit-constructor,*-explicit-conversions)
+  FunctionRef(Callable&& callable) noexcept
+      : callable_{const_cast<void*>(static_cast<const void*>(std::addressof(callable)))},
+        invoke_{&invoke<std::remove_reference_t<Callable>>} {}
+
+  /// Call the referenced callable.
+  R operator()(Args... args) const { return invoke_(callable_, std::forward<Args>(args)...); }
+
+ private:
+  template <class Callable>
+  static R invoke(void* callable, Args... args) {
+    if constexpr (std::is_void_v<R>) {
+      std::invoke(*static_cast<Callable*>(callable), std::forward<Args>(args)...);
+    } else {
+      return std::invoke(*static_cast<Callable*>(callable), std::forward<Args>(args)...);
+    }
+  }
+
+  void* callable_;
+  R (*invoke_)(void*, Args...);
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -2,9 +2,9 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
 
-#include <unordered_map>
 #include <variant>
 
+#include <openassetio/FlatStrMap.hpp>
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
 
@@ -15,7 +15,12 @@ using InfoDictionaryValue = std::variant<Bool, Int, Float, Str>;
 /**
  * Dictionary type used for @fqref{managerApi.ManagerInterface.info}
  * "ManagerInterface.info".
+ *
+ * Info dictionaries are small and frequently copied, so are stored as
+ * a sorted, contiguous array of entries rather than a hash map.
+ *
+ * @see FlatStrMap
  */
-using InfoDictionary = std::unordered_map<Str, InfoDictionaryValue>;
+using InfoDictionary = FlatStrMap<InfoDictionaryValue>;
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
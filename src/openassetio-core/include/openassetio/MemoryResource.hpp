@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+OPENASSETIO_DECLARE_PTR(MemoryResourceInterface)
+
+/**
+ * An abstract source of memory, allowing a @ref host to direct
+ * allocations made by the library to its own arena, pool or tracking
+ * allocator.
+ *
+ * This mirrors `std::pmr::memory_resource`, which is not available on
+ * all supported platforms. Hosts with an existing
+ * `std::pmr::memory_resource` can trivially adapt it.
+ *
+ * A resource is supplied to a @fqref{hostApi.ManagerFactory}
+ * "ManagerFactory" or @fqref{managerApi.HostSession} "HostSession",
+ * and is then made current by the @fqref{hostApi.Manager} "Manager"
+ * for the duration of API calls that produce
+ * @fqref{trait.TraitsData} "TraitsData", using a
+ * @ref ScopedMemoryResource.
+ *
+ * Memory is deallocated through the resource it was allocated from,
+ * so the resource must outlive all objects allocated from it, which
+ * may in turn outlive the API call, session and manager. Since
+ * objects may be destroyed on any thread, implementations must be
+ * thread-safe.
+ *
+ * @see ScopedMemoryResource
+ */
+class OPENASSETIO_CORE_EXPORT MemoryResourceInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(MemoryResourceInterface)
+
+  virtual ~MemoryResourceInterface() = 0;
+
+  /**
+   * Allocate memory.
+   *
+   * @param bytes Number of bytes to allocate.
+   * @param alignment Required alignment, a power of two.
+   * @return Pointer to the allocated memory, never null.
+   * @exception std::bad_alloc If the memory cannot be allocated.
+   */
+  virtual void* allocate(std::size_t bytes, std::size_t alignment) = 0;
+
+  /**
+   * Deallocate memory previously returned by @ref allocate.
+   *
+   * @param ptr Pointer to the memory to deallocate.
+   * @param bytes Number of bytes, as given to @ref allocate.
+   * @param alignment Alignment, as given to @ref allocate.
+   */
+  virtual void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) noexcept = 0;
+};
+
+/**
+ * Make a memory resource current on the calling thread for the
+ * lifetime of this object, restoring the previous one on destruction.
+ *
+ * Whilst current, the resource is used for the storage of
+ * @fqref{trait.TraitsData} "TraitsData" instances constructed on the
+ * calling thread, including the storage of their traits and
+ * properties, and of any copy taken when modifying an instance that
+ * shares storage with another. Property values that are strings
+ * allocate their buffers from the global heap as usual.
+ *
+ * The current resource is not propagated to other threads, e.g. those
+ * of a manager's own thread pool.
+ *
+ * Scopes must be destroyed in the reverse order of construction.
+ */
+class OPENASSETIO_CORE_EXPORT ScopedMemoryResource final {
+ public:
+  /**
+   * Make a resource current.
+   *
+   * @param resource Resource to make current, or null to leave the
+   * current resource (if any) unchanged. The resource is not owned,
+   * and must outlive all allocations made from it.
+   */
+  explicit ScopedMemoryResource(MemoryResourceInterface* resource) noexcept;
+  ~ScopedMemoryResource();
+
+  ScopedMemoryResource(const ScopedMemoryResource&) = delete;
+  ScopedMemoryResource& operator=(const ScopedMemoryResource&) = delete;
+  ScopedMemoryResource(ScopedMemoryResource&&) = delete;
+  ScopedMemoryResource& operator=(ScopedMemoryResource&&) = delete;
+
+  /**
+   * @return The resource current on the calling thread, or null if
+   * allocations use the global heap.
+   */
+  [[nodiscard]] static MemoryResourceInterface* current() noexcept;
+
+ private:
+  MemoryResourceInterface* previous_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
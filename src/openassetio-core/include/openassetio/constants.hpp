@@ -44,6 +44,119 @@ inline constexpr std::string_view kInfoKey_Icon = "icon";
 inline constexpr std::string_view kInfoKey_EntityReferencesMatchPrefix =
     "entityReferencesMatchPrefix";
 
+/**
+ * Newline-separated list of prefixes, any of which identify an entity
+ * reference of a particular manager.
+ *
+ * Use this in place of @ref kInfoKey_EntityReferencesMatchPrefix for
+ * managers that accept several schemes, for the same purpose.
+ */
+inline constexpr std::string_view kInfoKey_EntityReferencesMatchPrefixes =
+    "entityReferencesMatchPrefixes";
+
+/**
+ * Regular expression (ECMAScript syntax) that, when matched against
+ * the start of a string, identifies an entity reference of a
+ * particular manager.
+ *
+ * This may be combined with @ref kInfoKey_EntityReferencesMatchPrefix
+ * or @ref kInfoKey_EntityReferencesMatchPrefixes, in which case a
+ * string is an entity reference if it matches any of them. Literal
+ * prefixes are cheaper to evaluate, so should be preferred where
+ * sufficient.
+ */
+inline constexpr std::string_view kInfoKey_EntityReferencesMatchPattern =
+    "entityReferencesMatchPattern";
+
+// Management policy
+
+/**
+ * Whether the manager's response to
+ * @fqref{hostApi.Manager.managementPolicy} "managementPolicy" depends
+ * on the @ref Context.
+ *
+ * Management policy is memoised by the @fqref{hostApi.Manager}
+ * "Manager" for the lifetime of a session. By default, results are
+ * shared between all calls with the same trait set and access mode,
+ * regardless of the Context. If this field is `true`, then the
+ * Context's locale and manager state are also taken into account.
+ */
+inline constexpr std::string_view kInfoKey_IsManagementPolicyContextSensitive =
+    "isManagementPolicyContextSensitive";
+
+// Caching
+
+/**
+ * Whether the manager caches the results of
+ * @fqref{managerApi.ManagerInterface.resolve} "resolve" itself.
+ *
+ * If this field is `true`, host-side caches of resolve results, i.e.
+ * a @fqref{hostApi.ResolveCache} "ResolveCache" given to
+ * @fqref{hostApi.Manager.make} "Manager.make" or a
+ * @fqref{hostApi.CachingManagerInterface} "CachingManagerInterface",
+ * are bypassed, since they would duplicate the manager's own caching
+ * and may serve data that the manager knows to be stale.
+ */
+inline constexpr std::string_view kInfoKey_IsResolveCached = "isResolveCached";
+
+/**
+ * Token identifying the current state of the manager's data, as a
+ * `Str`.
+ *
+ * Whenever the token differs from that seen previously, a shared or
+ * persistent tier of a @fqref{hostApi.ResolveCache} "ResolveCache"
+ * given to @fqref{hostApi.Manager.make} "Manager.make" is cleared, in
+ * all processes using it, since its entries may be stale. Managers
+ * should change the token when, e.g., their backend is updated or
+ * their configuration changes.
+ */
+inline constexpr std::string_view kInfoKey_ResolveCacheToken = "resolveCacheToken";
+
+// Concurrency
+
+/**
+ * Whether the manager's batch methods may be called concurrently from
+ * multiple threads.
+ *
+ * If this field is `true`, the API may split large batches into chunks
+ * that are dispatched to the manager in parallel. See
+ * @fqref{hostApi.Manager.make} "Manager.make".
+ */
+inline constexpr std::string_view kInfoKey_IsThreadSafe = "isThreadSafe";
+
+/**
+ * Newline-separated list of names of @ref managerApi.ManagerInterface
+ * "ManagerInterface" methods that may be called concurrently from
+ * multiple threads, with each other and with any other method.
+ *
+ * Use this in place of @ref kInfoKey_IsThreadSafe for managers where
+ * only some methods are thread-safe, e.g. `"resolve\nentityExists"`.
+ * The `register_` method is named `register`. Asynchronous variants
+ * share the name of their synchronous method.
+ *
+ * Hosts can use @fqref{hostApi.SynchronizedManagerInterface}
+ * "SynchronizedManagerInterface" to serialise only the remaining
+ * methods.
+ */
+inline constexpr std::string_view kInfoKey_ThreadSafeMethods = "threadSafeMethods";
+
+// Batching
+
+/**
+ * Maximum number of elements the manager wishes to receive in a single
+ * call to `resolve`, `entityExists` or `entityTraits`, as an `Int`.
+ *
+ * If this field is positive, @fqref{hostApi.Manager} "Manager" splits
+ * larger batches into consecutive calls of at most this size, so
+ * managers with, e.g., a limit on query parameters need not re-chunk
+ * batches themselves. Element indices are reported relative to the
+ * host's original batch.
+ *
+ * Hosts that issue many small batches can use a
+ * @fqref{hostApi.ResolveCoalescer} "ResolveCoalescer" to merge them.
+ */
+inline constexpr std::string_view kInfoKey_MaxBatchSize = "maxBatchSize";
+
 /// @}
 }  // namespace constants
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
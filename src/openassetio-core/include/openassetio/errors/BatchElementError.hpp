@@ -126,6 +126,13 @@ class BatchElementError final {
      * the manager.
      */
     kInvalidTraitSet = OPENASSETIO_BatchErrorCode_kInvalidTraitSet,
+
+    /**
+     * Error code used when the operation was cancelled, via the
+     * @ref CancellationToken of the @ref Context, before the element
+     * was processed.
+     */
+    kCancelled = OPENASSETIO_BatchErrorCode_kCancelled,
   };
 
   /**
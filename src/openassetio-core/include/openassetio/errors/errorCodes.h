@@ -47,3 +47,6 @@
 
 /// Failure due to a TraitSet being unknown to the manager
 #define OPENASSETIO_BatchErrorCode_kInvalidTraitSet (OPENASSETIO_BatchErrorCode_BEGIN + 6)
+
+/// Failure due to the operation being cancelled before the element was processed.
+#define OPENASSETIO_BatchErrorCode_kCancelled (OPENASSETIO_BatchErrorCode_BEGIN + 7)
@@ -2,6 +2,9 @@
 // Copyright 2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -94,9 +97,37 @@ struct OPENASSETIO_CORE_EXPORT UnhandledException : OpenAssetIOException {
  * @ref BatchElementError is emitted by the manager.
  */
 struct OPENASSETIO_CORE_EXPORT BatchElementException : OpenAssetIOException {
+  /**
+   * Callable producing the full exception message from the index and
+   * error of the exception.
+   */
+  using MessageFormatter = std::function<std::string(std::size_t, const BatchElementError&)>;
+
   BatchElementException(std::size_t idx, BatchElementError err, const std::string& message)
       : OpenAssetIOException{message}, index{idx}, error{std::move(err)} {}
 
+  /**
+   * Construct with a message that is formatted lazily, on the first
+   * call to @ref what.
+   *
+   * This avoids the cost of formatting when the exception is caught
+   * and handled based only on its @ref error code, e.g. for expected
+   * failures such as missing optional entities.
+   *
+   * @param idx Index of the batch element that caused the error.
+   * @param err Error emitted for the batch element.
+   * @param formatMessage Callable producing the full message. It is
+   * called at most once, even if the exception is copied.
+   */
+  BatchElementException(std::size_t idx, BatchElementError err, MessageFormatter formatMessage);
+
+  /**
+   * @return Full exception message, formatted on first call if the
+   * message is lazy. If formatting fails, then the message of the
+   * @ref error is returned instead.
+   */
+  [[nodiscard]] const char* what() const noexcept override;
+
   /**
    * Index describing which batch element has caused an error.
    */
@@ -106,6 +137,11 @@ struct OPENASSETIO_CORE_EXPORT BatchElementException : OpenAssetIOException {
    * Object describing the nature of the specific error.
    */
   BatchElementError error;
+
+ private:
+  struct LazyMessage;
+  /// Lazily formatted message, if any, shared between copies.
+  std::shared_ptr<LazyMessage> lazyMessage_;
 };
 
 /// List of all OpenAssetIO-specific exceptions. Useful for
@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide low-overhead auditing of API coverage.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(ApiAuditor)
+
+/**
+ * A process-wide count of the calls made to each method of the @ref
+ * Manager and @ref managerApi.ManagerInterface "ManagerInterface"
+ * APIs.
+ *
+ * This is a native counterpart to the Python `openassetio._core.audit`
+ * module, for determining the extent of API usage by a host or plugin.
+ * Unlike the Python decorators, it sees calls made from both C++ and
+ * Python, and is cheap enough to leave enabled in production: when
+ * disabled, recording a call costs a single relaxed atomic load, and
+ * when enabled, an additional relaxed increment of a counter that is
+ * sharded by thread, so concurrent calls from many threads do not
+ * contend.
+ *
+ * Calls to every @ref Manager are counted. Calls to a manager plugin
+ * are counted if it is wrapped in an @ref AuditingManagerInterface.
+ * Each public method is counted once per call, regardless of overload,
+ * i.e. convenience overloads are counted as their batch counterpart.
+ * As for the Python auditor, calls that the Manager makes to its own
+ * public methods, e.g. `createEntityReference` querying
+ * `isEntityReferenceString`, are also counted.
+ *
+ * Auditing is initially enabled if the `OPENASSETIO_AUDIT` environment
+ * variable is set to a value other than `0`, as for the Python
+ * auditor.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT ApiAuditor final {
+ public:
+  OPENASSETIO_ALIAS_PTR(ApiAuditor)
+
+  /// APIs whose methods are counted.
+  enum class Api : std::size_t { kManager, kManagerInterface };
+
+  /// Names of APIs, indexed by @ref Api.
+  static constexpr std::array kApiNames{"Manager", "ManagerInterface"};
+
+  /**
+   * Methods that are counted, across all of the @ref Api "APIs".
+   *
+   * Not all methods are present in every API.
+   */
+  enum class Method : std::size_t {
+    kAreEntityReferenceStrings,
+    kContextFromPersistenceToken,
+    kContextsFromPersistenceTokens,
+    kCreateChildContext,
+    kCreateChildState,
+    kCreateContext,
+    kCreateEntityReference,
+    kCreateEntityReferenceIfValid,
+    kCreateState,
+    kDefaultEntityReference,
+    kDisplayName,
+    kEntityExistenceFilter,
+    kEntityExists,
+    kEntityExistsAsync,
+    kEntityTraits,
+    kEntityTraitsAsync,
+    kEntityTraitsStream,
+    kFlushCaches,
+    kFlushCachesWithPrefix,
+    kFlushEntityCaches,
+    kGetWithRelationship,
+    kGetWithRelationships,
+    kGetWithRelationshipsMatrix,
+    kHasCapability,
+    kIdentifier,
+    kInfo,
+    kInitialize,
+    kInitializeAsync,
+    kIsEntityReferenceString,
+    kManagementPolicy,
+    kPersistenceTokenForContext,
+    kPersistenceTokenForState,
+    kPrefetch,
+    kPreflight,
+    kPreflightAsync,
+    kRegister,
+    kRegisterAsync,
+    kResetState,
+    kResolve,
+    kResolveAsync,
+    kResolveColumnar,
+    kResolveHeterogeneous,
+    kResolveIfChanged,
+    kResolveProjected,
+    kResolveStream,
+    kSettings,
+    kStateFromPersistenceToken,
+    kTraverseRelationships,
+    kUpdateTerminology
+  };
+
+  /// Names of methods, indexed by @ref Method.
+  static constexpr std::array kMethodNames{"areEntityReferenceStrings",
+                                           "contextFromPersistenceToken",
+                                           "contextsFromPersistenceTokens",
+                                           "createChildContext",
+                                           "createChildState",
+                                           "createContext",
+                                           "createEntityReference",
+                                           "createEntityReferenceIfValid",
+                                           "createState",
+                                           "defaultEntityReference",
+                                           "displayName",
+                                           "entityExistenceFilter",
+                                           "entityExists",
+                                           "entityExistsAsync",
+                                           "entityTraits",
+                                           "entityTraitsAsync",
+                                           "entityTraitsStream",
+                                           "flushCaches",
+                                           "flushCachesWithPrefix",
+                                           "flushEntityCaches",
+                                           "getWithRelationship",
+                                           "getWithRelationships",
+                                           "getWithRelationshipsMatrix",
+                                           "hasCapability",
+                                           "identifier",
+                                           "info",
+                                           "initialize",
+                                           "initializeAsync",
+                                           "isEntityReferenceString",
+                                           "managementPolicy",
+                                           "persistenceTokenForContext",
+                                           "persistenceTokenForState",
+                                           "prefetch",
+                                           "preflight",
+                                           "preflightAsync",
+                                           "register",
+                                           "registerAsync",
+                                           "resetState",
+                                           "resolve",
+                                           "resolveAsync",
+                                           "resolveColumnar",
+                                           "resolveHeterogeneous",
+                                           "resolveIfChanged",
+                                           "resolveProjected",
+                                           "resolveStream",
+                                           "settings",
+                                           "stateFromPersistenceToken",
+                                           "traverseRelationships",
+                                           "updateTerminology"};
+
+  /**
+   * Number of calls keyed by API name, then method name.
+   *
+   * Only methods that have been called are present.
+   */
+  using Coverage = std::map<Str, std::map<Str, std::uint64_t>>;
+
+  /// @return The process-wide auditor.
+  [[nodiscard]] static const ApiAuditorPtr& instance();
+
+  /// Destructor.
+  ~ApiAuditor();
+
+  /// @return Whether calls are currently being counted.
+  [[nodiscard]] bool isEnabled() const { return isEnabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * Set whether calls are counted.
+   *
+   * Counts recorded so far are retained whilst disabled.
+   *
+   * @param enabled Whether to count calls.
+   */
+  void setEnabled(bool enabled);
+
+  /**
+   * Count a call to a method, if enabled.
+   *
+   * @param api API of which the method was called.
+   * @param method Method that was called.
+   */
+  void recordCall(Api api, Method method);
+
+  /**
+   * @param api API of the method.
+   * @param method Method to query.
+   * @return Number of calls to the method counted so far.
+   */
+  [[nodiscard]] std::uint64_t callCount(Api api, Method method) const;
+
+  /**
+   * Get the number of calls to each method that has been called.
+   *
+   * Counts are read without synchronisation, so calls made
+   * concurrently may or may not be included.
+   *
+   * @return Number of calls keyed by API name, then method name.
+   */
+  [[nodiscard]] Coverage coverage() const;
+
+  /**
+   * Discard all counts recorded so far.
+   *
+   * Calls made concurrently may or may not be discarded.
+   */
+  void reset();
+
+ private:
+  ApiAuditor();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  std::atomic<bool> isEnabled_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
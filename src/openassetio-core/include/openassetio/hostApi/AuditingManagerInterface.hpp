@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a manager plugin middleware layer that audits API coverage.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ProxyManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(AuditingManagerInterface)
+
+/**
+ * A @ref managerApi.ProxyManagerInterface "ProxyManagerInterface" that
+ * counts each call to the proxied manager plugin with the process-wide
+ * @ref ApiAuditor.
+ *
+ * Unlike the @ref Manager, which is always audited, calls to a plugin
+ * are only audited if the host wraps it in this layer, e.g. before
+ * passing it to @ref Manager.make. This allows a host to determine the
+ * subset of the @ref managerApi.ManagerInterface "ManagerInterface"
+ * that it, and the @ref Manager convenience methods, make use of.
+ *
+ * When the auditor is disabled, the overhead of this layer is a
+ * single relaxed atomic load per call.
+ */
+class OPENASSETIO_CORE_EXPORT AuditingManagerInterface final
+    : public managerApi::ProxyManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(AuditingManagerInterface)
+
+  /**
+   * Construct an auditing layer around a manager plugin.
+   *
+   * @param proxied Manager plugin to audit.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If `proxied` is null.
+   */
+  [[nodiscard]] static AuditingManagerInterfacePtr make(managerApi::ManagerInterfacePtr proxied);
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] StrMap updateTerminology(StrMap terms,
+                                         const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override;
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+  void flushEntityCaches(const EntityReferences& entityReferences,
+                         const managerApi::HostSessionPtr& hostSession) override;
+  void flushCachesWithPrefix(const Str& prefix,
+                             const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] managerApi::ManagerStateBasePtr createChildState(
+      const managerApi::ManagerStateBasePtr& parentState,
+      const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] Str persistenceTokenForState(
+      const managerApi::ManagerStateBasePtr& state,
+      const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] managerApi::ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool resetState(const managerApi::ManagerStateBasePtr& state,
+                                const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(
+      const std::vector<Str>& someStrings, const managerApi::HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  [[nodiscard]] managerApi::EntityExistenceFilterConstPtr entityExistenceFilter(
+      const managerApi::HostSessionPtr& hostSession) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void resolveHeterogeneous(const EntityReferences& entityReferences,
+                            const trait::TraitSets& traitSets,
+                            const std::vector<std::size_t>& traitSetIndices,
+                            access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const ResolveSuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void resolveProjected(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                        const trait::PropertyProjection& propertyProjection,
+                        access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                        const managerApi::HostSessionPtr& hostSession,
+                        const ResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback) override;
+  void resolveColumnar(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                       access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                       const managerApi::HostSessionPtr& hostSession,
+                       trait::TraitsDataTable& results,
+                       const BatchElementErrorCallback& errorCallback) override;
+  void resolveIfChanged(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                        access::ResolveAccess resolveAccess,
+                        const std::vector<Str>& generationTokens, const ContextConstPtr& context,
+                        const managerApi::HostSessionPtr& hostSession,
+                        const ConditionalResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                                  access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const managerApi::HostSessionPtr& hostSession,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback) override;
+  void traverseRelationships(const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& relationshipTraitsDatas,
+                             const trait::TraitSet& resultTraitSet, std::size_t maxDepth,
+                             access::RelationsAccess relationsAccess,
+                             const ContextConstPtr& context,
+                             const managerApi::HostSessionPtr& hostSession,
+                             const RelationshipTraversalSuccessCallback& successCallback,
+                             const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void entityExistsAsync(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         ExistsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void entityTraitsAsync(const EntityReferences& entityReferences,
+                         access::EntityTraitsAccess entityTraitsAccess,
+                         const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         EntityTraitsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                    access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    ResolveSuccessCallback successCallback,
+                    BatchElementErrorCallback errorCallback,
+                    CompletionCallback completionCallback) override;
+  void preflightAsync(const EntityReferences& entityReferences,
+                      const trait::TraitsDatas& traitsHints,
+                      access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                      const managerApi::HostSessionPtr& hostSession,
+                      PreflightSuccessCallback successCallback,
+                      BatchElementErrorCallback errorCallback,
+                      CompletionCallback completionCallback) override;
+  void registerAsync(const EntityReferences& entityReferences,
+                     const trait::TraitsDatas& entityTraitsDatas,
+                     access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                     const managerApi::HostSessionPtr& hostSession,
+                     RegisterSuccessCallback successCallback,
+                     BatchElementErrorCallback errorCallback,
+                     CompletionCallback completionCallback) override;
+
+ private:
+  explicit AuditingManagerInterface(managerApi::ManagerInterfacePtr proxied);
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
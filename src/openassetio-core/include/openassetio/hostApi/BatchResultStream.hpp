@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide incremental, bounded delivery of batch results.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <variant>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Stream of results from a batch operation, delivered in the order the
+ * manager produces them.
+ *
+ * Each element is a pair of the index of the entity in the batch and
+ * either the successful result or the error for that entity.
+ *
+ * At most the configured buffer size of results are held by the
+ * stream. Once the buffer is full, the producer blocks until the
+ * consumer retrieves a result, so memory use stays flat regardless of
+ * batch size. The exception is results delivered synchronously on the
+ * thread that created the stream (i.e. before the stream has been
+ * returned to the consumer), which cannot be blocked without
+ * deadlock and so are always buffered.
+ *
+ * If the consumer destroys the stream before it is exhausted, any
+ * remaining results are discarded, without blocking the producer.
+ *
+ * Streams are created by, e.g., @ref Manager.resolveStream.
+ *
+ * @tparam T Type of successful result.
+ */
+template <class T>
+class BatchResultStream final {
+ public:
+  /// Result for a single entity.
+  using Result = std::variant<errors::BatchElementError, T>;
+  /// Index of an entity in the batch, paired with its result.
+  using Element = std::pair<std::size_t, Result>;
+
+  /// Default maximum number of buffered results.
+  static constexpr std::size_t kDefaultBufferSize = 256;
+
+ private:
+  struct State {
+    std::mutex mutex;
+    std::condition_variable readable;
+    std::condition_variable writable;
+    std::deque<Element> buffer;
+    std::size_t bufferSize = 0;
+    std::thread::id creatorThread;
+    bool closed = false;
+    bool cancelled = false;
+    std::exception_ptr exception;
+  };
+
+ public:
+  /**
+   * Producer handle, used to write results into the stream.
+   *
+   * Cheap to copy, and may outlive the stream.
+   */
+  class Writer final {
+   public:
+    /**
+     * Write a result, blocking whilst the buffer is full.
+     *
+     * @param index Index of the entity in the batch.
+     * @param result Result for the entity.
+     * @return `false` if the consumer has destroyed the stream, in
+     * which case the result is discarded.
+     */
+    bool write(const std::size_t index, Result result) const {
+      std::unique_lock lock{state_->mutex};
+      if (std::this_thread::get_id() != state_->creatorThread) {
+        state_->writable.wait(lock, [this] {
+          return state_->cancelled || state_->buffer.size() < state_->bufferSize;
+        });
+      }
+      if (state_->cancelled) {
+        return false;
+      }
+      state_->buffer.emplace_back(index, std::move(result));
+      state_->readable.notify_one();
+      return true;
+    }
+
+    /**
+     * Signal that no further results will be written.
+     *
+     * @param exception Exception that failed the batch, if any, to be
+     * rethrown to the consumer once buffered results are exhausted.
+     */
+    void close(std::exception_ptr exception = nullptr) const {
+      const std::lock_guard lock{state_->mutex};
+      state_->closed = true;
+      state_->exception = std::move(exception);
+      state_->readable.notify_all();
+    }
+
+   private:
+    friend class BatchResultStream;
+    explicit Writer(std::shared_ptr<State> state) : state_{std::move(state)} {}
+    std::shared_ptr<State> state_;
+  };
+
+  /**
+   * Construct an empty, open stream.
+   *
+   * @param bufferSize Maximum number of buffered results.
+   * @exception errors.InputValidationException If the buffer size is
+   * zero.
+   */
+  explicit BatchResultStream(const std::size_t bufferSize = kDefaultBufferSize)
+      : state_{std::make_shared<State>()} {
+    if (bufferSize == 0) {
+      throw errors::InputValidationException{"Stream buffer size must be non-zero"};
+    }
+    state_->bufferSize = bufferSize;
+    state_->creatorThread = std::this_thread::get_id();
+  }
+
+  /// Discard any remaining results, unblocking the producer.
+  ~BatchResultStream() {
+    if (!state_) {
+      return;
+    }
+    const std::lock_guard lock{state_->mutex};
+    state_->cancelled = true;
+    state_->buffer.clear();
+    state_->writable.notify_all();
+  }
+
+  BatchResultStream(const BatchResultStream&) = delete;
+  BatchResultStream& operator=(const BatchResultStream&) = delete;
+  BatchResultStream(BatchResultStream&&) noexcept = default;
+  BatchResultStream& operator=(BatchResultStream&&) = delete;
+
+  /// @return A handle for writing results into this stream.
+  [[nodiscard]] Writer writer() const { return Writer{state_}; }
+
+  /**
+   * Retrieve the next result, blocking until one is available.
+   *
+   * @return The next result, or an empty optional once all results
+   * have been retrieved.
+   * @exception std::exception If the batch failed as a whole, the
+   * exception is rethrown once all results produced before the failure
+   * have been retrieved.
+   */
+  std::optional<Element> next() {
+    std::unique_lock lock{state_->mutex};
+    state_->readable.wait(lock, [this] { return state_->closed || !state_->buffer.empty(); });
+    if (state_->buffer.empty()) {
+      if (state_->exception) {
+        std::rethrow_exception(std::exchange(state_->exception, nullptr));
+      }
+      return std::nullopt;
+    }
+    Element element = std::move(state_->buffer.front());
+    state_->buffer.pop_front();
+    state_->writable.notify_one();
+    return element;
+  }
+
+ private:
+  std::shared_ptr<State> state_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
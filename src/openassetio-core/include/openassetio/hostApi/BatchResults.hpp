@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a reusable container for the results of batch operations.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/trait/collection.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Caller-owned storage for the results of a batch operation.
+ *
+ * Results are held as a structure-of-arrays: a bitmap of which
+ * elements succeeded, a dense vector of values, and a sparse list of
+ * errors. Errors are expected to be rare, so no per-element storage is
+ * reserved for them.
+ *
+ * The container is intended to be reused across many batches, e.g.
+ * once per frame. @ref reset retains previously allocated capacity, so
+ * once a container has grown to the size of the largest batch, further
+ * batches do not allocate.
+ *
+ * Elements that have been neither set nor errored (i.e. if the manager
+ * failed to report a result) are reported as unsuccessful, with no
+ * associated error.
+ *
+ * @tparam T Type of successful result. Must be default constructible.
+ */
+template <class T>
+class BatchResults final {
+ public:
+  /// Error for a particular element of the batch.
+  using IndexedError = std::pair<std::size_t, errors::BatchElementError>;
+
+  /**
+   * Discard existing results and prepare for a batch of the given
+   * size, retaining allocated capacity.
+   *
+   * @param size Number of elements in the batch.
+   */
+  void reset(const std::size_t size) {
+    succeeded_.assign(size, false);
+    values_.assign(size, T{});
+    errors_.clear();
+  }
+
+  /**
+   * Pre-allocate storage for batches up to the given size.
+   *
+   * @param capacity Number of elements to reserve.
+   */
+  void reserve(const std::size_t capacity) {
+    succeeded_.reserve(capacity);
+    values_.reserve(capacity);
+  }
+
+  /// @return Number of elements in the batch.
+  [[nodiscard]] std::size_t size() const { return values_.size(); }
+
+  /// @return Whether all elements in the batch succeeded.
+  [[nodiscard]] bool allSucceeded() const {
+    return std::all_of(succeeded_.begin(), succeeded_.end(), [](const bool flag) { return flag; });
+  }
+
+  /**
+   * @param index Index of element.
+   * @return Whether the element succeeded.
+   */
+  [[nodiscard]] bool succeeded(const std::size_t index) const { return succeeded_[index]; }
+
+  /**
+   * @param index Index of element.
+   * @return Value of element. Default constructed if the element did
+   * not succeed.
+   */
+  [[nodiscard]] const T& value(const std::size_t index) const { return values_[index]; }
+
+  /// @return Values of all elements, that are only meaningful where
+  /// @ref succeeded.
+  [[nodiscard]] const std::vector<T>& values() const { return values_; }
+
+  /**
+   * @param index Index of element.
+   * @return Error for the element, or `nullptr` if it did not error.
+   */
+  [[nodiscard]] const errors::BatchElementError* error(const std::size_t index) const {
+    const auto iter = std::find_if(errors_.begin(), errors_.end(),
+                                   [index](const auto& entry) { return entry.first == index; });
+    return iter == errors_.end() ? nullptr : &iter->second;
+  }
+
+  /// @return All errors, in the order they were reported.
+  [[nodiscard]] const std::vector<IndexedError>& indexedErrors() const { return errors_; }
+
+  /**
+   * Record a successful result.
+   *
+   * @param index Index of element.
+   * @param value Value of element.
+   */
+  void setValue(const std::size_t index, T value) {
+    values_[index] = std::move(value);
+    succeeded_[index] = true;
+  }
+
+  /**
+   * Record an error.
+   *
+   * @param index Index of element.
+   * @param error Error for the element.
+   */
+  void setError(const std::size_t index, errors::BatchElementError error) {
+    errors_.emplace_back(index, std::move(error));
+  }
+
+ private:
+  std::vector<bool> succeeded_;
+  std::vector<T> values_;
+  std::vector<IndexedError> errors_;
+};
+
+/// Reusable container for @ref Manager.resolve results.
+using ResolveResults = BatchResults<trait::TraitsDataPtr>;
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a manager plugin middleware layer that caches resolves.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ProxyManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(ResolveCache)
+OPENASSETIO_DECLARE_PTR(CachingManagerInterface)
+
+/**
+ * A @ref managerApi.ProxyManagerInterface "ProxyManagerInterface" that
+ * serves `resolve` results from a @ref ResolveCache where possible.
+ *
+ * This provides the same caching as supplying a ResolveCache to @ref
+ * Manager.make "Manager.make", but as a composable layer, e.g. so
+ * that it can be placed outside of other layers such that cache hits
+ * bypass them entirely, or so that a cache can be shared by several
+ * manager plugins.
+ *
+ * Successful results of both `resolve` and `resolveAsync` are cached,
+ * errors are not. The cache is cleared by `flushCaches`, which is
+ * then forwarded to the proxied manager. Similarly, `flushEntityCaches`
+ * and `flushCachesWithPrefix` discard only the matching entries before
+ * being forwarded. Entries for entities that the
+ * proxied manager notifies have changed, via the host session given
+ * to `initialize`, are discarded. See @ref
+ * managerApi.HostSession.notifyEntitiesChanged
+ * "HostSession.notifyEntitiesChanged".
+ *
+ * If, once initialized, the proxied manager declares that it caches
+ * resolve results itself, via the @ref
+ * constants.kInfoKey_IsResolveCached "kInfoKey_IsResolveCached" info
+ * key, the cache is bypassed.
+ */
+class OPENASSETIO_CORE_EXPORT CachingManagerInterface final
+    : public managerApi::ProxyManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(CachingManagerInterface)
+
+  /**
+   * Construct a caching layer around a manager plugin.
+   *
+   * @param proxied Manager plugin to forward cache misses to.
+   * @param resolveCache Cache of resolve results.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If either argument is
+   * null.
+   */
+  [[nodiscard]] static CachingManagerInterfacePtr make(managerApi::ManagerInterfacePtr proxied,
+                                                       ResolveCachePtr resolveCache);
+
+  /// Unsubscribes from entity change notifications.
+  ~CachingManagerInterface() override;
+
+  CachingManagerInterface(const CachingManagerInterface&) = delete;
+  CachingManagerInterface(CachingManagerInterface&&) noexcept = delete;
+  CachingManagerInterface& operator=(const CachingManagerInterface&) = delete;
+  CachingManagerInterface& operator=(CachingManagerInterface&&) noexcept = delete;
+
+  /// @return Cache of resolve results.
+  [[nodiscard]] const ResolveCachePtr& resolveCache() const;
+
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+  void flushEntityCaches(const EntityReferences& entityReferences,
+                         const managerApi::HostSessionPtr& hostSession) override;
+  void flushCachesWithPrefix(const Str& prefix,
+                             const managerApi::HostSessionPtr& hostSession) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                    access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    ResolveSuccessCallback successCallback,
+                    BatchElementErrorCallback errorCallback,
+                    CompletionCallback completionCallback) override;
+
+ private:
+  CachingManagerInterface(managerApi::ManagerInterfacePtr proxied, ResolveCachePtr resolveCache);
+
+  ResolveCachePtr resolveCache_;
+  /// Whether the proxied manager declared that it caches resolve
+  /// results itself on initialization.
+  std::atomic<bool> isResolveCached_{false};
+
+  /// Guards the entity change subscription.
+  std::mutex subscriptionMutex_;
+  /// Host session subscribed to for entity change notifications.
+  std::weak_ptr<managerApi::HostSession> subscribedHostSession_;
+  std::size_t entityChangeSubscriptionId_ = 0;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
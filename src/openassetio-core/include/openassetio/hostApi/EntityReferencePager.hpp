@@ -3,6 +3,14 @@
 
 #pragma once
 
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <optional>
+
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/typedefs.hpp>
 
@@ -36,8 +44,21 @@ OPENASSETIO_DECLARE_PTR(EntityReferencePager)
  * Destruction of this object is a signal to the manager that the
  * connection query is finished. For this reason you should avoid
  * keeping hold of this object for longer than necessary.
+ *
+ * Optionally, pages can be read ahead on a background thread, so that
+ * the next pages are fetched whilst the host is processing the current
+ * one. In this mode, the underlying @ref
+ * managerApi.EntityReferencePagerInterface "pager interface" is called
+ * from a thread other than the one that created the pager, though
+ * never concurrently. The first page is requested immediately upon
+ * construction.
+ *
+ * Pages can also be requested asynchronously, so that many pagers can
+ * be advanced concurrently without blocking a thread per pager. See
+ * @ref hasNextAsync, @ref getAsync and @ref nextAsync.
  */
-class OPENASSETIO_CORE_EXPORT EntityReferencePager final {
+class OPENASSETIO_CORE_EXPORT EntityReferencePager final
+    : public std::enable_shared_from_this<EntityReferencePager> {
  public:
   OPENASSETIO_ALIAS_PTR(EntityReferencePager)
   using Page = EntityReferences;
@@ -51,11 +72,14 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePager final {
    *
    * @param pagerInterface Implementation of the underlying pager.
    * @param hostSession The API session.
+   * @param prefetchDepth Number of pages to read ahead of the current
+   * page on a background thread. If zero, pages are fetched on demand,
+   * on the calling thread.
    * @return Newly created instance wrapped in a `std::shared_ptr`.
    */
   [[nodiscard]] static EntityReferencePager::Ptr make(
       managerApi::EntityReferencePagerInterfacePtr pagerInterface,
-      managerApi::HostSessionPtr hostSession);
+      managerApi::HostSessionPtr hostSession, std::size_t prefetchDepth = 0);
 
   /**
    * Deleted copy constructor.
@@ -89,6 +113,8 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePager final {
    * the page.
    *
    * @return `true` if another page is available, `false` otherwise.
+   * @exception std::exception If read-ahead is enabled, any exception
+   * raised by the manager whilst fetching the current page.
    */
   bool hasNext();
 
@@ -99,24 +125,172 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePager final {
    * list will be returned.
    *
    * @return The current page's list of entity references.
+   * @exception std::exception If read-ahead is enabled, any exception
+   * raised by the manager whilst fetching the current page.
    */
   Page get();
 
+  /**
+   * Replace the contents of a list with the current page of data.
+   *
+   * Equivalent to @ref get, but reuses the storage of the given list,
+   * so that hosts iterating many pages need not allocate a new list
+   * per page.
+   *
+   * @param page List to populate with the current page's entity
+   * references.
+   * @exception std::exception If read-ahead is enabled, any exception
+   * raised by the manager whilst fetching the current page.
+   */
+  void get(Page& page);
+
   /**
    * Advance the page.
    *
    * Advancing beyond the last page is not an error, but will result in
    * all subsequent calls to @ref get to return an empty page, whilst
    * @ref hasNext will continue to return `false`.
+   *
+   * @exception std::exception If read-ahead is enabled, any exception
+   * raised by the manager whilst fetching the current page.
    */
   void next();
 
+  /**
+   * Return an estimate of the number of entity references remaining,
+   * from the current page onward, if the manager provides one.
+   *
+   * Before the page has been advanced, this is the size of the whole
+   * result set, allowing hosts to pre-size containers. It is a hint
+   * only, and the number of entity references actually returned may
+   * differ.
+   *
+   * If read-ahead is enabled, already fetched pages are counted
+   * exactly.
+   *
+   * @return Estimated number of remaining entity references, if known.
+   * @exception std::exception If read-ahead is enabled, any exception
+   * raised by the manager whilst fetching the current page.
+   */
+  std::optional<std::size_t> sizeHint();
+
+  /**
+   * Return all remaining entity references, from the current page
+   * onward, in a single list.
+   *
+   * This is more efficient than accumulating pages via @ref get and
+   * @ref next, particularly if the manager supports retrieving the
+   * full result set in one call.
+   *
+   * Afterwards, the pager is left on the page following the last page
+   * whose entity references were (wholly or partially) returned. If
+   * `maxItems` truncated a page, the rest of that page is discarded.
+   *
+   * If read-ahead is enabled, already fetched pages are used before
+   * the manager is asked for the remainder.
+   *
+   * @param maxItems Maximum number of entity references to return.
+   * @return Entity references from the current page onward, up to
+   * `maxItems`.
+   * @exception std::exception If read-ahead is enabled, any exception
+   * raised by the manager whilst fetching a page.
+   */
+  Page drainAll(std::size_t maxItems = std::numeric_limits<std::size_t>::max());
+
+  /**
+   * @name Asynchronous Paging
+   *
+   * Non-blocking variants of @ref hasNext, @ref get and @ref next.
+   *
+   * Each operation is provided in two forms. The first takes callbacks,
+   * and returns as soon as the operation has been started. The second
+   * returns a `std::future` that is fulfilled with the result, or holds
+   * the exception that failed the operation.
+   *
+   * Callbacks may be called on any thread. The success callback, if
+   * called, is called before the completion callback, which is called
+   * exactly once. Callbacks must not throw.
+   *
+   * The pager is kept alive until the operation completes, so hosts
+   * may release their reference whilst an operation is in progress.
+   * As for the synchronous methods, operations must not be started
+   * concurrently on the same pager, i.e. hosts must wait for one
+   * operation to complete before starting the next.
+   *
+   * If read-ahead is disabled, the manager's @ref
+   * managerApi.EntityReferencePagerInterface.hasNextAsync
+   * "asynchronous implementation" is used, which by default adapts
+   * its synchronous implementation on a shared pool of worker threads.
+   * If read-ahead is enabled, buffered pages are returned from a
+   * worker thread.
+   *
+   * @{
+   */
+
+  /**
+   * Callback signature used to signal completion of an asynchronous
+   * paging operation.
+   *
+   * Receives a null pointer if the operation succeeded, or the
+   * exception that failed it otherwise.
+   */
+  using CompletionCallback = std::function<void(std::exception_ptr)>;
+
+  /// Callback signature used for a successful @ref hasNextAsync.
+  using HasNextSuccessCallback = std::function<void(bool)>;
+
+  /// Callback signature used for a successful @ref getAsync.
+  using GetSuccessCallback = std::function<void(Page)>;
+
+  /**
+   * Asynchronous, callback-based variant of @ref hasNext.
+   */
+  void hasNextAsync(HasNextSuccessCallback successCallback, CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref hasNext.
+   *
+   * @return Future of whether another page is available.
+   */
+  [[nodiscard]] std::future<bool> hasNextAsync();
+
+  /**
+   * Asynchronous, callback-based variant of @ref get.
+   */
+  void getAsync(GetSuccessCallback successCallback, CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref get.
+   *
+   * @return Future current page's list of entity references.
+   */
+  [[nodiscard]] std::future<Page> getAsync();
+
+  /**
+   * Asynchronous, callback-based variant of @ref next.
+   */
+  void nextAsync(CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref next.
+   *
+   * @return Future fulfilled once the page has been advanced.
+   */
+  [[nodiscard]] std::future<void> nextAsync();
+
+  /// @}
+
  private:
   EntityReferencePager(managerApi::EntityReferencePagerInterfacePtr pagerInterface,
-                       managerApi::HostSessionPtr hostSession);
+                       managerApi::HostSessionPtr hostSession, std::size_t prefetchDepth);
+
+  struct Prefetcher;
 
   managerApi::EntityReferencePagerInterfacePtr pagerInterface_;
   managerApi::HostSessionPtr hostSession_;
+  /// Read-ahead state, shared with background fetches. Null if
+  /// read-ahead is disabled.
+  std::shared_ptr<Prefetcher> prefetcher_;
 };
 static_assert(!std::is_default_constructible_v<EntityReferencePager>);
 static_assert(!std::is_copy_constructible_v<EntityReferencePager>);
@@ -2,6 +2,8 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 
 #include <openassetio/export.h>
@@ -34,6 +36,11 @@ OPENASSETIO_DECLARE_PTR(HostInterface)
  * This allows the API to insert suitable house-keeping and auditing
  * functionality in between.
  *
+ * Hosts that manage their own threads, e.g. via TBB or a bespoke
+ * pool, may override @ref submit and @ref parallelFor so that
+ * managers schedule concurrent work on the host's scheduler, rather
+ * than oversubscribing cores with threads of their own.
+ *
  * @note OpenAssetIO makes use of shared pointers to facilitate object
  * lifetime management across multiple languages. Instances passed into
  * API methods via shared pointer may have their lifetimes extended
@@ -105,6 +112,53 @@ class OPENASSETIO_CORE_EXPORT HostInterface {
    */
   [[nodiscard]] virtual InfoDictionary info();
   /// @}
+
+  /**
+   * @name Task Scheduling
+   *
+   * Managers that parallelise work internally, e.g. by issuing
+   * concurrent queries for the elements of a batch, may schedule it
+   * on the host's scheduler via the @fqref{managerApi.Host} "Host".
+   * The default implementations use a process-wide pool of
+   * OpenAssetIO worker threads, sized by the hardware concurrency.
+   *
+   * @{
+   */
+
+  /// Task to run on the host's scheduler.
+  using Task = std::function<void()>;
+
+  /// Body of a parallel loop, called with each index of the loop.
+  using ParallelForBody = std::function<void(std::size_t)>;
+
+  /**
+   * Queue a task to run asynchronously on the host's scheduler.
+   *
+   * The task may be run on any thread, including, once this call has
+   * returned, the calling thread.
+   *
+   * This must be thread-safe.
+   *
+   * @param task Task to run. Must not throw.
+   */
+  virtual void submit(Task task);
+
+  /**
+   * Call `body` with each index in `[0, count)`, potentially
+   * concurrently, blocking until all calls have completed.
+   *
+   * Implementations should allow the calling thread to participate in
+   * the work, such that nested calls, e.g. from within a task that is
+   * itself running on the host's scheduler, do not deadlock.
+   *
+   * This must be thread-safe.
+   *
+   * @param count Number of indices.
+   * @param body Function to call with each index. If any call throws,
+   * the first exception is rethrown once all calls have completed.
+   */
+  virtual void parallelFor(std::size_t count, const ParallelForBody& body);
+  /// @}
 };
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
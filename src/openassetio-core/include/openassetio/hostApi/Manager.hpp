@@ -2,25 +2,40 @@
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <exception>
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/ConditionalResolveResult.hpp>
 #include <openassetio/EntityReference.hpp>
+#include <openassetio/EntityReferenceBatch.hpp>
+#include <openassetio/EntityReferenceSpan.hpp>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/access.hpp>
 #include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/BatchResultStream.hpp>
+#include <openassetio/hostApi/BatchResults.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/hostApi/ManagerMetrics.hpp>
 #include <openassetio/internal.hpp>
+#include <openassetio/trait/TraitsDataTable.hpp>
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
 OPENASSETIO_FWD_DECLARE(managerApi, ManagerInterface)
 OPENASSETIO_FWD_DECLARE(managerApi, HostSession)
+OPENASSETIO_FWD_DECLARE(managerApi, ManagerStateBase)
 OPENASSETIO_FWD_DECLARE(Context)
 
 namespace openassetio {
@@ -34,6 +49,16 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace hostApi {
 
 OPENASSETIO_DECLARE_PTR(Manager)
+OPENASSETIO_DECLARE_PTR(ResolveCache)
+class DefaultEntityReferenceCache;
+class EntityReferenceMatcher;
+class EntityReferenceStringCache;
+class EntityTraitsCache;
+class ManagementPolicyCache;
+class ManagerStatePool;
+class PendingResolveTable;
+class PersistenceTokenCache;
+class RequestScheduler;
 
 /**
  * The Manager is the Host facing representation of an @ref
@@ -59,17 +84,145 @@ OPENASSETIO_DECLARE_PTR(Manager)
  * The Manager API is threadsafe and can be called from multiple
  * threads concurrently.
  */
-class OPENASSETIO_CORE_EXPORT Manager final {
+class OPENASSETIO_CORE_EXPORT Manager final : public std::enable_shared_from_this<Manager> {
  public:
   OPENASSETIO_ALIAS_PTR(Manager)
 
+  /**
+   * Optional behaviour of a Manager, fixed on construction.
+   *
+   * Every option defaults to disabled, such that each call is
+   * forwarded to the manager plugin as-is.
+   */
+  struct Options {
+    /**
+     * Optional cache of @ref resolve results. If not provided, or the
+     * manager plugin declares that it caches results itself via the
+     * @ref constants.kInfoKey_IsResolveCached "kInfoKey_IsResolveCached"
+     * info key, every resolve is forwarded to the manager plugin.
+     * Entries for entities that the manager plugin notifies have
+     * changed, via @ref managerApi.HostSession.notifyEntitiesChanged
+     * "HostSession.notifyEntitiesChanged", are discarded.
+     */
+    ResolveCachePtr resolveCache;
+    /**
+     * If non-zero, and the manager plugin declares itself thread-safe
+     * via the @ref constants.kInfoKey_IsThreadSafe
+     * "kInfoKey_IsThreadSafe" info key, @ref resolve batches larger
+     * than this are split into chunks of this size that are
+     * dispatched to the plugin concurrently, via
+     * @fqref{hostApi.HostInterface.parallelFor} "the host's scheduler".
+     */
+    std::size_t resolveChunkSize = 0;
+    /**
+     * If non-zero, and the manager plugin does not provide an entity
+     * reference prefix, up to this many @ref isEntityReferenceString
+     * results are memoised, so repeated queries for the same string
+     * don't call into the plugin.
+     */
+    std::size_t entityReferenceStringCacheCapacity = 0;
+    /**
+     * If `true`, repeated entity references within a single @ref
+     * resolve, @ref entityTraits or @ref entityExists batch are only
+     * sent to the manager plugin once, and the result is reported for
+     * every occurrence. This is useful when batches are assembled
+     * from, e.g., scene graphs with many shared references.
+     */
+    bool deduplicateEntityReferences = false;
+    /**
+     * If non-zero, @ref EntityReferencePager "pagers" returned from
+     * relationship queries read this many pages ahead on a background
+     * thread, so that the host can process one page whilst the next is
+     * fetched.
+     */
+    std::size_t pagerPrefetchDepth = 0;
+    /**
+     * If non-zero, the manager states of released Contexts, created by
+     * @ref createContext, are retained, up to this many, for reuse by
+     * subsequently created Contexts. Pooled states are only reused if
+     * the manager plugin approves, via
+     * @fqref{managerApi.ManagerInterface.resetState} "resetState". This
+     * is useful for hosts that create many short-lived Contexts, where
+     * manager states are expensive to create.
+     */
+    std::size_t managerStatePoolCapacity = 0;
+    /**
+     * If non-zero, the manager states restored by @ref
+     * contextFromPersistenceToken are retained, for up to this many
+     * distinct tokens, such that Contexts restored from an identical
+     * token share the same manager state, rather than each
+     * round-tripping to the manager plugin. The token of such a
+     * Context is then also known without querying the manager plugin.
+     * Restored states should therefore be treated as immutable.
+     */
+    std::size_t persistenceTokenCacheCapacity = 0;
+    /**
+     * Optional registry to which the outcome and duration of every
+     * batch API call is recorded. See @ref ManagerMetrics.
+     */
+    ManagerMetricsPtr metrics;
+    /**
+     * If non-zero, calls to the manager plugin keyed by entity
+     * reference are scheduled by the @fqref{Context.priority}
+     * "priority" of their Context. Batches made with a @ref
+     * Context.Priority.kBackground "kBackground" context are
+     * dispatched in chunks of at most this size, and each chunk waits
+     * until no calls of higher priority are in flight. Similarly, @ref
+     * Context.Priority.kNormal "kNormal" calls wait for @ref
+     * Context.Priority.kInteractive "kInteractive" calls. This
+     * prevents, e.g., a bulk validation from delaying a user's lookup
+     * by more than a single chunk.
+     */
+    std::size_t backgroundChunkSize = 0;
+    /**
+     * If non-zero, up to this many @ref entityTraits results are
+     * memoised, keyed by entity reference, access mode and Context, so
+     * repeated queries, e.g. for validation or UI decoration, don't
+     * call into the plugin. Entries are discarded by @ref flushCaches
+     * and on notification of entity changes, as for the resolve cache.
+     */
+    std::size_t entityTraitsCacheCapacity = 0;
+    /**
+     * If non-zero, up to this many @ref defaultEntityReference results
+     * are memoised, keyed by trait set, access mode and Context, so
+     * that, e.g., save dialogs don't wait on the plugin each time they
+     * are opened. Entries are discarded by @ref flushCaches, including
+     * those for a specific entity if it is the cached default, and on
+     * any notification of entity changes, since a change to any entity
+     * may alter a default.
+     */
+    std::size_t defaultEntityReferenceCacheCapacity = 0;
+  };
+
   /**
    * Constructs a new Manager wrapping the supplied manager interface
-   * and host session.
+   * and host session, with default @ref Options.
+   *
+   * @param managerInterface Manager plugin implementation.
+   * @param hostSession The API session.
    */
   [[nodiscard]] static ManagerPtr make(managerApi::ManagerInterfacePtr managerInterface,
                                        managerApi::HostSessionPtr hostSession);
 
+  /**
+   * Constructs a new Manager wrapping the supplied manager interface
+   * and host session.
+   *
+   * @param managerInterface Manager plugin implementation.
+   * @param hostSession The API session.
+   * @param options Optional behaviour of the Manager.
+   */
+  [[nodiscard]] static ManagerPtr make(managerApi::ManagerInterfacePtr managerInterface,
+                                       managerApi::HostSessionPtr hostSession, Options options);
+
+  /// Unsubscribes from the host session's entity change notifications.
+  ~Manager();
+
+  Manager(const Manager&) = delete;
+  Manager(Manager&&) noexcept = delete;
+  Manager& operator=(const Manager&) = delete;
+  Manager& operator=(Manager&&) noexcept = delete;
+
   /**
    * @name Asset Management System Identification
    *
@@ -171,6 +324,7 @@ class OPENASSETIO_CORE_EXPORT Manager final {
      * methods:
      * - @ref getWithRelationship
      * - @ref getWithRelationships
+     * - @ref getWithRelationshipsMatrix
      */
     kRelationshipQueries = internal::capability::manager::Capability::kRelationshipQueries,
     /**
@@ -211,6 +365,10 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    * call, whose return value remains constant once the manager has been
    * initialized.
    *
+   * Once initialized, the result is served from a snapshot of the
+   * manager's capabilities taken during @ref initialize (and refreshed
+   * by @ref flushCaches), rather than querying the manager.
+   *
    * For information on what methods belong to which capability set,
    * @see @ref Capability.
    *
@@ -234,6 +392,10 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    * There are certain well-known keys that may be set by the
    * Manager. They include things such as
    * openassetio.constants.kInfoKey_EntityReferencesMatchPrefix.
+   *
+   * Once initialized, the result is served from a snapshot taken
+   * during @ref initialize (and refreshed by @ref flushCaches), rather
+   * than querying the manager.
    */
   [[nodiscard]] InfoDictionary info();
 
@@ -251,6 +413,11 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    * openassetio.hostApi.terminology API provides more utility for far
    * less effort.
    *
+   * The manager's substitutions for the most recently given terms are
+   * cached, so repeated calls with the same terms (e.g. by each
+   * terminology Mapper of a session) only query the manager once. The
+   * cache is discarded by @ref initialize and @ref flushCaches.
+   *
    * @see @ref openassetio.hostApi.terminology "terminology"
    * @see @ref openassetio.hostApi.terminology.Mapper.replaceTerms
    * "Mapper.replaceTerms"
@@ -323,15 +490,151 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    */
   void initialize(InfoDictionary managerSettings);
 
+  /**
+   * Prepares the Manager for interaction with a host, in the
+   * background.
+   *
+   * This performs the same work as @ref initialize, but on a dedicated
+   * thread, returning immediately. This allows hosts to proceed with
+   * other startup work whilst the manager connects to its backend.
+   *
+   * Any subsequent call to this Manager that requires initialization
+   * blocks until initialization has completed, so hosts need not
+   * explicitly wait before use. Identification methods (@ref
+   * identifier and @ref displayName) do not block. If initialization
+   * fails, the error is re-thrown by the returned future, by @ref
+   * waitForInitialization, and by every subsequent call that requires
+   * initialization, until the Manager is successfully re-initialized.
+   *
+   * Calling this, or @ref initialize, whilst a previous asynchronous
+   * initialization is pending first waits for it to complete. A new
+   * initialization supersedes the failure of a previous one. The
+   * Manager is kept alive until initialization has completed.
+   *
+   * @param managerSettings Settings to initialize the manager with.
+   *
+   * @return A future that becomes ready once initialization has
+   * completed, re-throwing any error on `get()`.
+   */
+  [[nodiscard]] std::shared_future<void> initializeAsync(InfoDictionary managerSettings);
+
+  /**
+   * Blocks until any pending @ref initializeAsync has completed.
+   *
+   * This is a no-op if asynchronous initialization was never started.
+   *
+   * @throws Any error raised during the most recent asynchronous
+   * initialization.
+   */
+  void waitForInitialization();
+
   /**
    * Clears any internal caches.
    *
    * Only applicable if the manager makes use of any caching, otherwise
    * it is a no-op.  In caching interfaces, this should cause any
    * retained data to be discarded to ensure future queries are fresh.
+   *
+   * This also clears the @ref ResolveCache, if one was provided on
+   * construction, and any results memoised by the Manager itself, e.g.
+   * of @ref managementPolicy.
    */
   void flushCaches();
 
+  /**
+   * Clears any internal caches relating to the given entities.
+   *
+   * Use this rather than @ref flushCaches when only specific entities
+   * are known to have changed, e.g. after publishing them, so that
+   * cached data for other entities is retained.
+   *
+   * This discards the entities' entries from the @ref ResolveCache, if
+   * one was provided on construction, and is forwarded to the manager.
+   * Managers that do not support targeted flushing flush all of their
+   * caches instead.
+   *
+   * @param entityReferences Entities whose data may have changed.
+   */
+  void flushCaches(const EntityReferences& entityReferences);
+
+  /**
+   * Clears any internal caches relating to entities whose reference
+   * begins with the given prefix.
+   *
+   * Use this rather than @ref flushCaches when only a subtree of
+   * entities is known to have changed, e.g. `asset://shot010/` after
+   * publishing to that shot.
+   *
+   * This discards matching entries from the @ref ResolveCache, if one
+   * was provided on construction, and is forwarded to the manager.
+   * Managers that do not support targeted flushing flush all of their
+   * caches instead.
+   *
+   * @param prefix Prefix of the references of entities whose data may
+   * have changed.
+   */
+  void flushCachesWithPrefix(const Str& prefix);
+
+  /**
+   * Retrieve and reset statistics of the batch API calls made since
+   * the previous call to this method.
+   *
+   * This provides per-method latency histograms, broken down by batch
+   * size, over successive intervals, e.g. for periodic reporting
+   * without an external profiler.
+   *
+   * Statistics are only available if a @ref ManagerMetrics registry
+   * was provided on construction. Since the registry's own counters
+   * are monotonic, resetting only affects subsequent calls to this
+   * method, and not other consumers of the registry. The first call
+   * returns statistics since the Manager was constructed.
+   *
+   * @return Statistics of the interval, or an empty optional if no
+   * registry was provided.
+   */
+  [[nodiscard]] std::optional<ManagerMetrics::Snapshot> statistics();
+
+  /**
+   * Approximate memory used by the caches held by a Manager, in bytes.
+   *
+   * Each field is zero if the corresponding cache is not configured.
+   *
+   * @see memoryUsage
+   */
+  struct MemoryUsage {
+    /// @ref ResolveCache provided on construction, if any.
+    std::size_t resolveCache;
+    /// Memoised @ref managementPolicy results.
+    std::size_t managementPolicyCache;
+    /// Memoised @ref isEntityReferenceString results.
+    std::size_t entityReferenceStringCache;
+    /// Memoised manager states restored from persistence tokens,
+    /// excluding the (opaque) states themselves.
+    std::size_t persistenceTokenCache;
+    /// Memoised @ref entityTraits results.
+    std::size_t entityTraitsCache;
+    /// Memoised @ref defaultEntityReference results.
+    std::size_t defaultEntityReferenceCache;
+    /// Sum of the above.
+    std::size_t total;
+  };
+
+  /**
+   * Estimate the memory used by the caches held by this Manager.
+   *
+   * This allows hosts to budget cache capacities and to monitor
+   * growth in long-running sessions. Memory held by the manager plugin
+   * itself, including any manager states, is not known to the Manager
+   * so is not included.
+   *
+   * Cached entries may share storage with instances held elsewhere,
+   * which is included in full, so this is an upper bound on the memory
+   * that would be released by @ref flushCaches.
+   *
+   * @return Approximate number of bytes used by each cache.
+   */
+  [[nodiscard]] MemoryUsage memoryUsage() const;
+
   /**
    * @}
    */
@@ -424,7 +727,17 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    *
    * @param context The calling context.
    *
+   * @note Results are memoised per trait set and access mode, until
+   * @ref flushCaches is called or the manager is re-initialized, so
+   * only trait sets not previously queried are forwarded to the
+   * manager. The Context is only taken into account if the manager
+   * sets @ref constants.kInfoKey_IsManagementPolicyContextSensitive
+   * in its @ref info dictionary.
+   *
    * @return a `TraitsData` for each element in @p traitSets.
+   *
+   * @exception errors.OpenAssetIOException If the manager returns the
+   * wrong number of results.
    */
   [[nodiscard]] trait::TraitsDatas managementPolicy(const trait::TraitSets& traitSets,
                                                     access::PolicyAccess policyAccess,
@@ -447,6 +760,10 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    *  The @fqref{Context.locale} "locale" will be initialized with an
    *  empty @fqref{trait.TraitsData} "TraitsData" instance.
    *
+   *  If a manager state pool was configured on construction, the
+   *  manager state of a previously released Context may be reused,
+   *  subject to the approval of the manager plugin.
+   *
    *  @warning Contexts should never be directly constructed, always
    *  use this method or @ref createChildContext to create a new one.
    *
@@ -464,8 +781,16 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    *  modified independently. Useful when performing multiple operations
    *  in parallel.
    *
-   *  @note The locale is deep-copied so that the child's locale can be
-   *  freely modified without affecting the parent.
+   *  @note The locale is copied so that the child's locale can be
+   *  freely modified without affecting the parent. The copy is cheap,
+   *  since @fqref{trait.TraitsData} "TraitsData" storage is
+   *  copy-on-write. The cancellation token and priority are inherited
+   *  from the parent.
+   *
+   *  The parent may be an immutable snapshot, as created by
+   *  @fqref{Context.freeze} "Context.freeze", in which case a single
+   *  snapshot can be shared by many threads, each deriving their own
+   *  mutable children from it.
    *
    *  @warning Contexts should never be directly constructed, always
    *  use this method or @ref createContext to create a new one.
@@ -480,7 +805,7 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    *  @see @ref createContext
    *  @see @fqref{Context} "Context"
    */
-  ContextPtr createChildContext(const ContextPtr& parentContext);
+  ContextPtr createChildContext(const ContextConstPtr& parentContext);
 
   /**
    *  Returns a serializable token that represents the supplied
@@ -550,6 +875,30 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    */
   ContextPtr contextFromPersistenceToken(const Str& token);
 
+  /**
+   * Returns a @ref Context for each of the supplied persistence
+   * tokens, as per @ref contextFromPersistenceToken.
+   *
+   * This is more efficient than multiple calls to @ref
+   * contextFromPersistenceToken when many tokens must be restored,
+   * since the manager is queried only once for each distinct token.
+   * Contexts for identical tokens share the same manager state.
+   *
+   * @param tokens Tokens previously returned from @ref
+   * persistenceTokenForContext by this manager.
+   *
+   * @return A context for each token, in the same order as the
+   * supplied tokens.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kStatefulContexts.
+   *
+   * @see @ref contextFromPersistenceToken
+   */
+  std::vector<ContextPtr> contextsFromPersistenceTokens(const std::vector<Str>& tokens);
+
   /**
    * @}
    */
@@ -581,8 +930,39 @@ class OPENASSETIO_CORE_EXPORT Manager final {
      * emit an exception at the first encountered @ref
      * errors.BatchElementError provided by the @ref ManagerInterface.
      * This exception may not be in index order.
+     *
+     * The exception is not thrown through the @ref manager plugin.
+     * Instead, it is thrown once the plugin returns, and any results
+     * reported after the error are discarded. The plugin is given the
+     * caller's Context unmodified, so is not asked to stop early.
      */
     struct Exception {};
+    /**
+     * Expected policy overloads behave as @ref Exception overloads,
+     * stopping at the first encountered @ref errors.BatchElementError,
+     * but return the error, along with the index of the element, rather
+     * than throwing it.
+     *
+     * The @ref manager plugin is asked to stop at the first error via
+     * the @ref CancellationToken of a Context it is given in place of
+     * the caller's. The token is a child of the caller's token, if any.
+     *
+     * This avoids the cost of exception handling where failures are
+     * expected, whilst allowing the manager to stop early.
+     */
+    struct Expected {};
+    /**
+     * Error summary policy overloads, when used in a batch context, will
+     * be exhaustive for all elements in the batch, as with @ref Variant
+     * overloads, but store successful results compactly and only
+     * materialise a @ref errors.BatchElementError for each failed
+     * element.
+     *
+     * This is intended for very large batches where failures are rare,
+     * such as existence audits, where a per-element variant would
+     * dominate memory usage.
+     */
+    struct ErrorSummary {};
 
     /**
      * Static instantiation of the @ref Variant dispatch tag, to avoid
@@ -594,8 +974,25 @@ class OPENASSETIO_CORE_EXPORT Manager final {
      * the need to construct a new object to resolve dispatch methods.
      */
     static constexpr Exception kException{};
+    /**
+     * Static instantiation of the @ref Expected dispatch tag, to avoid
+     * the need to construct a new object to resolve dispatch methods.
+     */
+    static constexpr Expected kExpected{};
+    /**
+     * Static instantiation of the @ref ErrorSummary dispatch tag, to
+     * avoid the need to construct a new object to resolve dispatch
+     * methods.
+     */
+    static constexpr ErrorSummary kErrorSummary{};
   };
 
+  /**
+   * Error for a particular element of a batch, as returned by
+   * @ref BatchElementErrorPolicyTag::Expected overloads.
+   */
+  using IndexedBatchElementError = std::pair<std::size_t, errors::BatchElementError>;
+
   /**
    * Callback signature used for an unsuccessful operation on an
    * element in a batch.
@@ -662,6 +1059,27 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    */
   [[nodiscard]] bool isEntityReferenceString(const Str& someString);
 
+  /**
+   * Determines, for each of a batch of strings, whether it matches the
+   * pattern of an @ref entity_reference.
+   *
+   * This is a batch variant of @ref isEntityReferenceString, that
+   * calls into the manager plugin at most once. Prefer this when
+   * classifying many strings, e.g. when scanning a directory or scene.
+   *
+   * @param someStrings The strings to be inspected.
+   *
+   * @return A list of the same length as `someStrings`, with `true`
+   * for each string that should be considered an @ref
+   * entity_reference.
+   *
+   * @throw errors::OpenAssetIOException If the manager plugin returns
+   * a result of the wrong length.
+   *
+   * @see @ref isEntityReferenceString
+   */
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(const std::vector<Str>& someStrings);
+
   /**
    * Create an @ref EntityReference object wrapping a given
    * @ref entity_reference string.
@@ -705,6 +1123,20 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    */
   using ExistsSuccessCallback = std::function<void(std::size_t, bool)>;
 
+  /**
+   * Result of an entity existence query, as returned by
+   * @ref BatchElementErrorPolicyTag::ErrorSummary overloads.
+   */
+  struct ExistsSummary {
+    /**
+     * Existence of each entity, by index, packed as a bitmap. Elements
+     * that failed are `false`.
+     */
+    std::vector<bool> exists;
+    /// Errors for the elements that failed, in index order.
+    std::vector<IndexedBatchElementError> errors;
+  };
+
   /**
    * Called to determine if each @ref entity_reference supplied
    * points to an entity that exists in the @ref
@@ -728,6 +1160,14 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    * definition of 'exists' in some cases too, as it better explains
    * the use-case of the call.
    *
+   * If the manager provides an
+   * @fqref{managerApi.ManagerInterface.entityExistenceFilter}
+   * "entityExistenceFilter", entities that it reports definitely do
+   * not exist are reported as such without calling the manager. The
+   * filter may not contain newly registered entities, so it is no
+   * longer used once any entity is registered through this Manager,
+   * until it is reloaded by @ref flushCaches.
+   *
    * @param entityReferences Entity references to query.
    *
    * @param context The calling context.
@@ -758,6 +1198,75 @@ class OPENASSETIO_CORE_EXPORT Manager final {
                     const ExistsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback);
 
+  /**
+   * Determine if the supplied @ref entity_reference "entity references"
+   * point to entities that exist, given a contiguous batch of
+   * references.
+   *
+   * See documentation for the <!--
+   * --> @ref entityExists(const EntityReferences&, <!--
+   * --> const ContextConstPtr&, const ExistsSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback&)
+   * "EntityReferences variation" for details.
+   *
+   * @param entityReferences Entity references to query.
+   * @param context The calling context.
+   * @param successCallback Callback called for each successful check.
+   * @param errorCallback Callback called for each failed check.
+   */
+  void entityExists(const EntityReferenceBatch& entityReferences, const ContextConstPtr& context,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Determine if the supplied @ref entity_reference "entity references"
+   * point to entities that exist, given a view of a contiguous range
+   * of references.
+   *
+   * This avoids the need to copy a sub-range of a larger batch, or
+   * references held in another container, into a new list. The
+   * references are copied once, at the boundary with the manager
+   * plugin.
+   *
+   * See documentation for the <!--
+   * --> @ref entityExists(const EntityReferences&, <!--
+   * --> const ContextConstPtr&, const ExistsSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback&)
+   * "EntityReferences variation" for details.
+   *
+   * @param entityReferences Entity references to query.
+   * @param context The calling context.
+   * @param successCallback Callback called for each successful check.
+   * @param errorCallback Callback called for each failed check.
+   */
+  void entityExists(EntityReferenceSpan entityReferences, const ContextConstPtr& context,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Determine if the supplied @ref entity_reference "entity references"
+   * point to entities that exist, summarising any errors.
+   *
+   * See documentation for the <!--
+   * --> @ref entityExists(const EntityReferences&, <!--
+   * --> const ContextConstPtr&, const ExistsSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback&)
+   * "callback variation" for details.
+   *
+   * Existence is stored as a bitmap, and a @fqref{errors.BatchElementError}
+   * "BatchElementError" is only stored for elements that failed, such
+   * that memory usage for large, mostly successful, batches is a small
+   * fraction of that of a per-element result.
+   *
+   * @param entityReferences Entity references to query.
+   * @param context The calling context.
+   * @param errorPolicyTag Error policy tag, selecting this overload.
+   * @return Existence of each entity and errors for those that failed.
+   */
+  ExistsSummary entityExists(const EntityReferences& entityReferences,
+                             const ContextConstPtr& context,
+                             const BatchElementErrorPolicyTag::ErrorSummary& errorPolicyTag);
+
   /**
    * Callback signature used for a successful entity trait set query.
    */
@@ -896,7 +1405,20 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    *
    * This call will block until all resolutions are complete and
    * callbacks have been called. Callbacks will be called on the
-   * same thread that called `resolve`
+   * same thread that called `resolve`, unless the batch is split into
+   * concurrent chunks (see @ref make). In that case callbacks may be
+   * called on worker threads, but never concurrently.
+   *
+   * If a @ref ResolveCache was provided on construction, results for
+   * previously resolved entities are served from the cache, and only
+   * the remainder are forwarded to the manager plugin.
+   *
+   * If the @p context holds a @ref CancellationToken, then once it is
+   * cancelled any entities not yet resolved are given to the
+   * `errorCallback` with a
+   * @fqref{errors.BatchElementError.ErrorCode.kCancelled} "kCancelled"
+   * error. The same applies to all other callback-based batch
+   * methods.
    *
    * @param entityReferences Entity references to query.
    *
@@ -934,6 +1456,57 @@ class OPENASSETIO_CORE_EXPORT Manager final {
                const ResolveSuccessCallback& successCallback,
                const BatchElementErrorCallback& errorCallback);
 
+  /**
+   * Resolve a contiguous batch of entity references.
+   *
+   * See documentation for the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "EntityReferences variation" for details.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The trait IDs to resolve.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param successCallback Callback called for each successful
+   * resolution.
+   * @param errorCallback Callback called for each failed resolution.
+   */
+  void resolve(const EntityReferenceBatch& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Resolve a view of a contiguous range of entity references.
+   *
+   * This avoids the need to copy a sub-range of a larger batch, or
+   * references held in another container, into a new list. Elements
+   * served by the resolve cache are never copied, and the remainder
+   * are copied once, at the boundary with the manager plugin.
+   *
+   * See documentation for the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "EntityReferences variation" for details.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The trait IDs to resolve.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param successCallback Callback called for each successful
+   * resolution.
+   * @param errorCallback Callback called for each failed resolution.
+   */
+  void resolve(EntityReferenceSpan entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback);
+
   /**
    * Provides a @fqref{trait.TraitsData} "TraitsData" populated with the
    * available data for the requested set of traits for the given @ref
@@ -1134,58 +1707,323 @@ class OPENASSETIO_CORE_EXPORT Manager final {
       const BatchElementErrorPolicyTag::Variant& errorPolicyTag);
 
   /**
-   * Callback signature used for a successful default entity reference query.
-   */
-  using DefaultEntityReferenceSuccessCallback =
-      std::function<void(std::size_t, std::optional<EntityReference>)>;
-
-  /**
-   * Called to determine an @ref EntityReference considered to be a
-   * sensible default for each of the given entity @ref trait_set
-   * "trait sets" and context.
+   * Provides either a populated @fqref{trait.TraitsData} "TraitsData"
+   * for each given @ref entity_reference, or the first
+   * @fqref{errors.BatchElementError} "BatchElementError" encountered.
    *
-   * This can be used to ensure dialogs, prompts or publish locations
-   * default to some sensible value, avoiding the need for a user to
-   * re-enter such information. There may be situations where there is
-   * no meaningful default, so the caller should be robust to this
-   * situation.
+   * This is equivalent to the exception policy overload, except that
+   * the error is returned rather than thrown. Errors that are not
+   * specific to an entity will be thrown as an exception, failing the
+   * whole batch.
    *
-   * @param traitSets  The relevant trait sets for the type of entities
-   * required, these will be interpreted in conjunction with the context
-   * to determine the most sensible default.
+   * @param entityReferences Entity references to query.
    *
-   * @param defaultEntityAccess Intended usage of the returned entity
-   * reference(s).
+   * @param traitSet The trait IDs to resolve for the supplied list of
+   * entity references. Only traits applicable to the supplied entity
+   * references will be set in the resulting data.
+   *
+   * @param resolveAccess The intended usage of the data.
    *
    * @param context The calling context.
    *
-   * @param successCallback Callback that will be called for each
-   * successful default retrieved for each of the given sets in @p
-   * traitSets. It will be given the corresponding index of the trait
-   * set in @p traitSets along with the default entity reference. If the
-   * query is well-formed, but there is no available default entity
-   * reference, then the `optional` entity reference will not contain a
-   * value. The callback will be called on the same thread that
-   * initiated the call to `defaultEntityReference`.
+   * @param errorPolicyTag  Parameter for selecting the appropriate
+   * overload (tag dispatch idiom). See @ref
+   * BatchElementErrorPolicyTag::Expected.
    *
-   * @param errorCallback Callback that will be called for each failure
-   * to retrieve a sensible default entity reference. It will be given
-   * the corresponding index for each of the given sets in @p traitSets
-   * along with a populated @fqref{errors.BatchElementError}
-   * "BatchElementError" (see @fqref{errors.BatchElementError.ErrorCode}
-   * "ErrorCodes"). The
-   * @fqref{errors.BatchElementError.ErrorCode.kEntityAccessError}
-   * "kEntityAccessError" error will be used if no suitable default
-   * reference exists, and the
-   * @fqref{errors.BatchElementError.ErrorCode.kInvalidTraitSet}
-   * "kInvalidTraitSet" error will be used if the requested trait set is
-   * not recognised by the manager. The callback will be called on the
-   * same thread that initiated the call to `defaultEntityReference`.
+   * @return Either the first error encountered, along with the index of
+   * the element it relates to, or a list of populated data objects.
    *
    * @throws errors.NotImplementedException Thrown when this method is
    * not implemented by the manager. Check that this method is
    * implemented before use by calling @ref hasCapability with @ref
-   * Capability.kDefaultEntityReferences.
+   * Capability.kResolution.
+   *
+   * @see @ref Capability.kResolution
+   */
+  std::variant<IndexedBatchElementError, std::vector<trait::TraitsDataPtr>> resolve(
+      const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+      access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+      const BatchElementErrorPolicyTag::Expected& errorPolicyTag);
+
+  /**
+   * Populates a caller-owned @ref BatchResults container with either
+   * the resolved @fqref{trait.TraitsData} "TraitsData" or a
+   * @fqref{errors.BatchElementError} "BatchElementError" for each
+   * given @ref entity_reference.
+   *
+   * The container is @ref BatchResults.reset "reset" to the size of
+   * the batch before resolving. Hosts that reuse the same container for
+   * repeated batches avoid reallocating result storage each time.
+   *
+   * Errors that are not specific to an entity will be thrown as an
+   * exception, failing the whole batch. In this case the contents of
+   * the container are unspecified.
+   *
+   * See documentation for the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "callback variation" for more details on resolution behaviour.
+   *
+   * @param entityReferences Entity references to query.
+   *
+   * @param traitSet The trait IDs to resolve for the supplied list of
+   * entity references. Only traits applicable to the supplied entity
+   * references will be set in the resulting data.
+   *
+   * @param resolveAccess The intended usage of the data.
+   *
+   * @param context The calling context.
+   *
+   * @param[out] results Container to populate with results.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kResolution.
+   *
+   * @see @ref Capability.kResolution
+   */
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               ResolveResults& results);
+
+  /**
+   * As the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "callback variation" of `resolve`, but with a trait set per
+   * entity.
+   *
+   * This allows a heterogeneous batch, e.g. the images, geometry and
+   * cameras of a scene, to be resolved in a single call, rather than
+   * one call per trait set. Trait sets are given as a table, with each
+   * entity referring to its trait set by index.
+   *
+   * Managers that don't support mixed batches natively resolve each
+   * group of entities sharing a trait set in turn. The @ref
+   * ResolveCache, if any, is used as for `resolve`.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSets Table of the distinct trait sets to resolve.
+   * @param traitSetIndices Index into @p traitSets of the trait set
+   * to resolve for each entity.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param successCallback Callback that will be called for each
+   * successful resolution.
+   * @param errorCallback Callback that will be called for each failed
+   * resolution.
+   *
+   * @throws errors.InputValidationException If the number of indices
+   * differs from the number of entity references, or an index is out
+   * of range.
+   *
+   * @see @ref Capability.kResolution
+   */
+  void resolveHeterogeneous(const EntityReferences& entityReferences,
+                            const trait::TraitSets& traitSets,
+                            const std::vector<std::size_t>& traitSetIndices,
+                            access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                            const ResolveSuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * As the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "callback variation" of `resolve`, but requests only a subset of
+   * the properties of the given traits.
+   *
+   * For example, a host that only requires the `location` of a
+   * `LocatableContent` trait can say so, allowing the manager to avoid
+   * fetching and transferring its other properties.
+   *
+   * The projection is a hint: managers that don't support it populate
+   * every property, so hosts must tolerate additional properties.
+   * Traits in the trait set that are not in the projection are
+   * populated in full.
+   *
+   * The @ref ResolveCache, if any, is bypassed, since projected
+   * results are incomplete.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The trait IDs to resolve.
+   * @param propertyProjection The property keys required of each
+   * trait.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param successCallback Callback that will be called for each
+   * successful resolution.
+   * @param errorCallback Callback that will be called for each failed
+   * resolution.
+   *
+   * @see @ref Capability.kResolution
+   */
+  void resolveProjected(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                        const trait::PropertyProjection& propertyProjection,
+                        access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                        const ResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * As the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "callback variation" of `resolve`, but populates a columnar table
+   * of results, rather than providing a @ref trait.TraitsData
+   * "TraitsData" per entity.
+   *
+   * The table holds a column per property, so a property can be
+   * scanned across all entities with linear access. Managers that
+   * support it write their results straight into the table, otherwise
+   * results are copied in as they are received.
+   *
+   * The table is reset to have a row per entity reference, retaining
+   * its columns and capacity, so may be reused across many batches.
+   * Row `i` holds the traits and properties of `entityReferences[i]`,
+   * such that @ref trait.TraitsDataTable.row "row(i)" matches the
+   * result of `resolve`. The rows of entities that failed to resolve
+   * are left empty. This includes entities with a property whose type
+   * does not match that of the table's existing column, e.g. from a
+   * previous batch, which fail with a @ref
+   * errors.BatchElementError.ErrorCode.kUnknown "kUnknown" error.
+   *
+   * The @ref ResolveCache, if any, is bypassed, and entity references
+   * are not deduplicated. Large batches are split according to the
+   * manager's maximum batch size, as for `resolve`.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The trait IDs to resolve.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param results Table to populate.
+   * @param errorCallback Callback that will be called for each failed
+   * resolution.
+   *
+   * @see @ref Capability.kResolution
+   */
+  void resolveColumnar(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                       access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                       trait::TraitsDataTable& results,
+                       const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Callback signature used for a successful conditional resolution.
+   */
+  using ConditionalResolveSuccessCallback =
+      std::function<void(std::size_t, ConditionalResolveResult)>;
+
+  /**
+   * As the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "callback variation" of `resolve`, but omits the data of entities
+   * that are unchanged since a previous resolution.
+   *
+   * This is intended for hosts that periodically re-resolve entities
+   * to detect updates, e.g. to check for newer versions. Each result
+   * holds an opaque generation token, analogous to an HTTP ETag, which
+   * the host passes back on the next call. Entities whose data is
+   * unchanged since that generation are reported with null data,
+   * avoiding the cost of transferring and processing it.
+   *
+   * Tokens are only meaningful when compared with tokens for the same
+   * entity, traits, access mode and locale.
+   *
+   * Managers that don't support conditional resolution natively still
+   * report unchanged entities, but must resolve them in full to do so.
+   * The @ref ResolveCache, if any, is bypassed, since the purpose of
+   * the call is to detect changes.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The trait IDs to resolve.
+   * @param resolveAccess The intended usage of the data.
+   * @param generationTokens Token from the previous resolution of each
+   * entity, or an empty string if there was none.
+   * @param context The calling context.
+   * @param successCallback Callback that will be called for each
+   * successful resolution, with the index of the entity reference and
+   * its result, whose data is null if unchanged.
+   * @param errorCallback Callback that will be called for each failed
+   * resolution.
+   *
+   * @throws errors.InputValidationException If the number of
+   * generation tokens differs from the number of entity references.
+   *
+   * @see @ref Capability.kResolution
+   */
+  void resolveIfChanged(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                        access::ResolveAccess resolveAccess,
+                        const std::vector<Str>& generationTokens, const ContextConstPtr& context,
+                        const ConditionalResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Callback signature used for a successful default entity reference query.
+   */
+  using DefaultEntityReferenceSuccessCallback =
+      std::function<void(std::size_t, std::optional<EntityReference>)>;
+
+  /**
+   * Called to determine an @ref EntityReference considered to be a
+   * sensible default for each of the given entity @ref trait_set
+   * "trait sets" and context.
+   *
+   * This can be used to ensure dialogs, prompts or publish locations
+   * default to some sensible value, avoiding the need for a user to
+   * re-enter such information. There may be situations where there is
+   * no meaningful default, so the caller should be robust to this
+   * situation.
+   *
+   * Results may be served from a cache, if configured on construction
+   * (see @ref make).
+   *
+   * @param traitSets  The relevant trait sets for the type of entities
+   * required, these will be interpreted in conjunction with the context
+   * to determine the most sensible default.
+   *
+   * @param defaultEntityAccess Intended usage of the returned entity
+   * reference(s).
+   *
+   * @param context The calling context.
+   *
+   * @param successCallback Callback that will be called for each
+   * successful default retrieved for each of the given sets in @p
+   * traitSets. It will be given the corresponding index of the trait
+   * set in @p traitSets along with the default entity reference. If the
+   * query is well-formed, but there is no available default entity
+   * reference, then the `optional` entity reference will not contain a
+   * value. The callback will be called on the same thread that
+   * initiated the call to `defaultEntityReference`.
+   *
+   * @param errorCallback Callback that will be called for each failure
+   * to retrieve a sensible default entity reference. It will be given
+   * the corresponding index for each of the given sets in @p traitSets
+   * along with a populated @fqref{errors.BatchElementError}
+   * "BatchElementError" (see @fqref{errors.BatchElementError.ErrorCode}
+   * "ErrorCodes"). The
+   * @fqref{errors.BatchElementError.ErrorCode.kEntityAccessError}
+   * "kEntityAccessError" error will be used if no suitable default
+   * reference exists, and the
+   * @fqref{errors.BatchElementError.ErrorCode.kInvalidTraitSet}
+   * "kInvalidTraitSet" error will be used if the requested trait set is
+   * not recognised by the manager. The callback will be called on the
+   * same thread that initiated the call to `defaultEntityReference`.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kDefaultEntityReferences.
    *
    * @see @ref Capability.kDefaultEntityReferences
    */
@@ -1195,6 +2033,41 @@ class OPENASSETIO_CORE_EXPORT Manager final {
                               const DefaultEntityReferenceSuccessCallback& successCallback,
                               const BatchElementErrorCallback& errorCallback);
 
+  /**
+   * Warm the resolve cache with entities that are expected to be
+   * resolved soon, e.g. all those referenced by a scene file that is
+   * being opened.
+   *
+   * The entities are resolved for read in the background, via the
+   * host's scheduler (see @fqref{hostApi.HostInterface.submit}
+   * "HostInterface.submit"), and the results retained in the resolve
+   * cache given on construction. This allows the host to overlap, e.g.,
+   * file parsing with asset resolution.
+   *
+   * Whilst the prefetch is in flight, a @ref resolve that misses the
+   * cache for the same entity, trait set, access and context waits for
+   * the prefetched result, rather than resolving the entity again. The
+   * same is true in reverse, so a prefetch never duplicates work that
+   * is already in progress.
+   *
+   * If the Manager has no resolve cache, but the manager plugin
+   * declares that it caches results itself, via the
+   * @ref constants.kInfoKey_IsResolveCached "kInfoKey_IsResolveCached"
+   * info key, the entities are still resolved, to warm the plugin's
+   * cache. Otherwise, there is nothing to warm, and this is a no-op.
+   *
+   * @param entityReferences Entities to resolve.
+   * @param traitSet Traits that will later be resolved.
+   * @param context The calling context. A snapshot is taken (see
+   * @fqref{Context.freeze} "Context.freeze"), so later modification of
+   * the context does not affect the prefetch.
+   * @return Future that is fulfilled once the prefetch completes,
+   * which may be discarded. Element errors are not reported, but an
+   * exception that fails the whole batch is held by the future.
+   */
+  std::future<void> prefetch(const EntityReferences& entityReferences,
+                             const trait::TraitSet& traitSet, const ContextConstPtr& context);
+
   /// @}
 
   /**
@@ -1385,6 +2258,148 @@ class OPENASSETIO_CORE_EXPORT Manager final {
                             const RelationshipQuerySuccessCallback& successCallback,
                             const BatchElementErrorCallback& errorCallback,
                             const trait::TraitSet& resultTraitSet = {});
+
+  /**
+   * Queries entity references that are related to each of the input
+   * references by each of the relationships defined by a set of traits
+   * and their properties.
+   *
+   * This is a many-to-many combination of @ref getWithRelationship and
+   * @ref getWithRelationships, allowing, for example, all dependencies
+   * of many entities to be queried with a single call. Managers that
+   * support it may satisfy the whole query at once, otherwise it is
+   * equivalent to calling @ref getWithRelationships for each entity.
+   *
+   * Results are indexed in row-major order, i.e. the result for the
+   * entity at index `e` in @p entityReferences and the relationship at
+   * index `r` in @p relationshipTraitsDatas is reported with the index
+   * `e * relationshipTraitsDatas.size() + r`.
+   *
+   * @param entityReferences A list of @ref entity_reference to query
+   * the specified relationships for.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * query.
+   *
+   * @param pageSize The size of each page of data. The page size is
+   * fixed for the lifetime of pager object given to the @p
+   * successCallback. Must be greater than zero.
+   *
+   * @param relationsAccess The intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param successCallback Callback that will be called for each
+   * successful relationship query. It will be given the row-major
+   * index of the entity and relationship, as described above, as well
+   * as a pager capable of returning pages of related entities. The
+   * callback will be called on the same thread that initiated the call
+   * to `getWithRelationshipsMatrix`.
+   *
+   * @param errorCallback Callback that will be called for each failed
+   * relationship query. It will be given the row-major index of the
+   * entity and relationship along with a populated BatchElementError
+   * (see @fqref{errors.BatchElementError.ErrorCode} "ErrorCodes"). The
+   * callback will be called on the same thread that initiated the call
+   * to `getWithRelationshipsMatrix`.
+   *
+   * @param resultTraitSet A hint as to what traits the returned
+   * entities should have.
+   *
+   * @throws errors.InputValidationException if @p pageSize is zero.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kRelationshipQueries.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  size_t pageSize, access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback,
+                                  const trait::TraitSet& resultTraitSet = {});
+
+  /**
+   * Callback signature used for a successful relationship traversal.
+   *
+   * Given the index of the input entity reference and the entities
+   * reached, grouped by the hop at which they were first reached.
+   */
+  using RelationshipTraversalSuccessCallback =
+      std::function<void(std::size_t, std::vector<EntityReferences>)>;
+
+  /**
+   * Follow a chain of relationships from each of the input references,
+   * up to a maximum number of hops.
+   *
+   * Hop `h` (from zero) follows `relationshipTraitsDatas[h]`. Once the
+   * chain is exhausted its last relationship is repeated, so a single
+   * relationship traverses recursively, e.g. to gather all transitive
+   * dependencies of an entity.
+   *
+   * Each entity is reported once, at the hop at which it is first
+   * reached. The input entity itself is not reported, and cycles are
+   * not followed. Trailing hops that reach no new entities are
+   * omitted, so the traversal may be shorter than @p maxDepth.
+   *
+   * Managers may implement the traversal natively, e.g. as a single
+   * graph query. Otherwise, the traversal is performed host-side
+   * with a single batched @ref getWithRelationship call per hop,
+   * covering all input references at once.
+   *
+   * @param entityReferences A list of @ref entity_reference to start
+   * traversals from.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * follow, one per hop. Must not be empty.
+   *
+   * @param maxDepth The maximum number of hops to follow.
+   *
+   * @param relationsAccess The intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param successCallback Callback that will be called for each
+   * successful traversal. It will be given the index of the input
+   * entity reference, along with the reached entities for each hop.
+   * The callback will be called on the same thread that initiated the
+   * call to `traverseRelationships`.
+   *
+   * @param errorCallback Callback that will be called for each failed
+   * traversal, i.e. where any entity reached from the input entity
+   * could not be queried. It will be given the index of the input
+   * entity reference along with a populated BatchElementError (see
+   * @fqref{errors.BatchElementError.ErrorCode} "ErrorCodes"). The
+   * callback will be called on the same thread that initiated the
+   * call to `traverseRelationships`.
+   *
+   * @param resultTraitSet A hint as to what traits the returned
+   * entities should have. Entities not matching the hint are neither
+   * reported nor traversed through.
+   *
+   * @throws errors.InputValidationException if @p
+   * relationshipTraitsDatas is empty.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kRelationshipQueries.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  void traverseRelationships(const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& relationshipTraitsDatas,
+                             std::size_t maxDepth, access::RelationsAccess relationsAccess,
+                             const ContextConstPtr& context,
+                             const RelationshipTraversalSuccessCallback& successCallback,
+                             const BatchElementErrorCallback& errorCallback,
+                             const trait::TraitSet& resultTraitSet = {});
   /// @}
 
   /**
@@ -1777,6 +2792,51 @@ class OPENASSETIO_CORE_EXPORT Manager final {
       access::PublishingAccess publishingAccess, const ContextConstPtr& context,
       const BatchElementErrorPolicyTag::Variant& errorPolicyTag);
 
+  /**
+   * This call signals your intent as a host application to do some
+   * work to create data in relation to each supplied @ref
+   * entity_reference.
+   *
+   * This is equivalent to the exception policy overload, except that
+   * the first @fqref{errors.BatchElementError} "BatchElementError"
+   * encountered is returned rather than thrown. Errors that are not
+   * specific to an entity will be thrown as an exception.
+   *
+   * @param entityReferences The entity references to preflight prior
+   * to registration.
+   *
+   * @param traitsHints @ref trait_set for each entity,
+   * determining the type of entity to publish, complete with any
+   * properties that can be provided at this time.
+   *
+   * @param publishingAccess Whether to perform a generic
+   * @fqref{access.PublishAccess.kWrite} "write" to an entity or to
+   * (explicitly) @fqref{access.PublishAccess.kCreateRelated} "create a
+   * related" entity.
+   *
+   * @param context The calling context. The same calling context is
+   * used for each entity reference.
+   *
+   * @param errorPolicyTag  Parameter for selecting the appropriate
+   * overload (tag dispatch idiom). See @ref
+   * BatchElementErrorPolicyTag::Expected.
+   *
+   * @return Either the first error encountered, along with the index of
+   * the element it relates to, or updated references to use for future
+   * interactions as part of the publishing operation.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kPublishing.
+   *
+   * @see @ref Capability.kPublishing
+   */
+  std::variant<IndexedBatchElementError, EntityReferences> preflight(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+      access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+      const BatchElementErrorPolicyTag::Expected& errorPolicyTag);
+
   /**
    * Callback signature used for a successful register operation on a
    * particular entity.
@@ -2110,16 +3170,346 @@ class OPENASSETIO_CORE_EXPORT Manager final {
       access::PublishingAccess publishingAccess, const ContextConstPtr& context,
       const BatchElementErrorPolicyTag::Variant& errorPolicyTag);
 
+  /**
+   * Register should be used to 'publish' new entities either when
+   * originating new data within the application process, or
+   * referencing some existing file, media or information.
+   *
+   * This is equivalent to the exception policy overload, except that
+   * the first @fqref{errors.BatchElementError} "BatchElementError"
+   * encountered is returned rather than thrown. Errors that are not
+   * specific to an entity will be thrown as an exception.
+   *
+   * @param entityReferences Entity references to register to.
+   *
+   * @param entityTraitsDatas The data to register for each entity.
+   * NOTE: All supplied instances should have the same trait set,
+   * batching with varying traits is not supported.
+   *
+   * @param publishingAccess Whether to perform a generic
+   * @fqref{access.PublishAccess.kWrite} "write" to an entity or to
+   * (explicitly) @fqref{access.PublishAccess.kCreateRelated} "create a
+   * related" entity.
+   *
+   * @param context Context The calling context.
+   *
+   * @param errorPolicyTag  Parameter for selecting the appropriate
+   * overload (tag dispatch idiom). See @ref
+   * BatchElementErrorPolicyTag::Expected.
+   *
+   * @return Either the first error encountered, along with the index of
+   * the element it relates to, or updated references to use for future
+   * interactions with the resulting new entities.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kPublishing.
+   *
+   * @see @ref Capability.kPublishing
+   */
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  std::variant<IndexedBatchElementError, EntityReferences> register_(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& entityTraitsDatas,
+      access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+      const BatchElementErrorPolicyTag::Expected& errorPolicyTag);
+
+  /// @}
+
+  /**
+   * @name Asynchronous Batch Operations
+   *
+   * Non-blocking variants of the batch entity operations, allowing
+   * hosts to overlap multiple batches with other work, e.g. to keep a
+   * UI thread responsive or to interleave queries with I/O.
+   *
+   * Each operation is provided in two forms. The first takes success,
+   * error and completion callbacks, and returns as soon as the
+   * operation has been started. The second returns a `std::future`
+   * that is fulfilled with a list of per-entity results, in the same
+   * order as the input, or holds the exception that failed the whole
+   * batch.
+   *
+   * Unlike their synchronous counterparts, callbacks may be called on
+   * any thread, though never concurrently with each other. The
+   * completion callback is called exactly once, after all other
+   * callbacks. Callbacks must not throw.
+   *
+   * By default, managers adapt their synchronous implementations by
+   * running them on a shared pool of worker threads. Managers with
+   * natively asynchronous backends may provide truly non-blocking
+   * implementations.
+   *
+   * All arguments are copied as needed, so they need not outlive the
+   * call.
+   *
+   * @see @fqref{managerApi.ManagerInterface.resolveAsync}
+   * "ManagerInterface.resolveAsync"
+   *
+   * @{
+   */
+
+  /**
+   * Callback signature used to signal completion of an asynchronous
+   * batch operation.
+   *
+   * Receives a null pointer if the batch completed, or the exception
+   * that failed the whole batch otherwise.
+   */
+  using CompletionCallback = std::function<void(std::exception_ptr)>;
+
+  /**
+   * Asynchronous, callback-based variant of @ref entityExists.
+   */
+  void entityExistsAsync(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                         ExistsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref entityExists.
+   *
+   * @return Future list of existence results or errors.
+   */
+  [[nodiscard]] std::future<std::vector<std::variant<errors::BatchElementError, bool>>>
+  entityExistsAsync(const EntityReferences& entityReferences, const ContextConstPtr& context);
+
+  /**
+   * Asynchronous, callback-based variant of @ref entityTraits.
+   */
+  void entityTraitsAsync(const EntityReferences& entityReferences,
+                         access::EntityTraitsAccess entityTraitsAccess,
+                         const ContextConstPtr& context,
+                         EntityTraitsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref entityTraits.
+   *
+   * @return Future list of trait sets or errors.
+   */
+  [[nodiscard]] std::future<std::vector<std::variant<errors::BatchElementError, trait::TraitSet>>>
+  entityTraitsAsync(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess,
+                    const ContextConstPtr& context);
+
+  /**
+   * Asynchronous, callback-based variant of @ref resolve.
+   *
+   * If a @ref ResolveCache was provided on construction, cached
+   * results are given to the success callback before this function
+   * returns.
+   */
+  void resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                    access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                    ResolveSuccessCallback successCallback,
+                    BatchElementErrorCallback errorCallback,
+                    CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref resolve.
+   *
+   * @return Future list of resolved data or errors.
+   */
+  [[nodiscard]] std::future<
+      std::vector<std::variant<errors::BatchElementError, trait::TraitsDataPtr>>>
+  resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context);
+
+  /**
+   * Streaming variant of @ref entityTraits.
+   *
+   * Results are made available as the manager produces them, rather
+   * than once the whole batch is complete. See @ref BatchResultStream.
+   *
+   * @param entityReferences Entity references to query.
+   * @param entityTraitsAccess Entity traits access mode.
+   * @param context The calling context.
+   * @param bufferSize Maximum number of results to buffer before
+   * blocking the manager.
+   * @return Stream of `(index, result)` pairs.
+   */
+  [[nodiscard]] BatchResultStream<trait::TraitSet> entityTraitsStream(
+      const EntityReferences& entityReferences, access::EntityTraitsAccess entityTraitsAccess,
+      const ContextConstPtr& context,
+      std::size_t bufferSize = BatchResultStream<trait::TraitSet>::kDefaultBufferSize);
+
+  /**
+   * Streaming variant of @ref resolve.
+   *
+   * Results are made available as the manager produces them, rather
+   * than once the whole batch is complete, allowing downstream
+   * processing to begin before the batch is finished. See
+   * @ref BatchResultStream.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The trait IDs to resolve.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param bufferSize Maximum number of results to buffer before
+   * blocking the manager.
+   * @return Stream of `(index, result)` pairs.
+   */
+  [[nodiscard]] BatchResultStream<trait::TraitsDataPtr> resolveStream(
+      const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+      access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+      std::size_t bufferSize = BatchResultStream<trait::TraitsDataPtr>::kDefaultBufferSize);
+
+  /**
+   * Asynchronous, callback-based variant of @ref preflight.
+   */
+  void preflightAsync(const EntityReferences& entityReferences,
+                      const trait::TraitsDatas& traitsHints,
+                      access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                      PreflightSuccessCallback successCallback,
+                      BatchElementErrorCallback errorCallback,
+                      CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref preflight.
+   *
+   * @return Future list of working references or errors.
+   */
+  [[nodiscard]] std::future<std::vector<std::variant<errors::BatchElementError, EntityReference>>>
+  preflightAsync(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context);
+
+  /**
+   * Asynchronous, callback-based variant of @ref register_.
+   */
+  void registerAsync(const EntityReferences& entityReferences,
+                     const trait::TraitsDatas& entityTraitsDatas,
+                     access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                     RegisterSuccessCallback successCallback,
+                     BatchElementErrorCallback errorCallback,
+                     CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous, future-returning variant of @ref register_.
+   *
+   * @return Future list of registered references or errors.
+   */
+  [[nodiscard]] std::future<std::vector<std::variant<errors::BatchElementError, EntityReference>>>
+  registerAsync(const EntityReferences& entityReferences,
+                const trait::TraitsDatas& entityTraitsDatas,
+                access::PublishingAccess publishingAccess, const ContextConstPtr& context);
+
   /// @}
 
  private:
-  explicit Manager(managerApi::ManagerInterfacePtr managerInterface,
-                   managerApi::HostSessionPtr hostSession);
+  Manager(managerApi::ManagerInterfacePtr managerInterface,
+          managerApi::HostSessionPtr hostSession, Options options);
+
+  /// Create a manager state for a new Context, reusing a pooled state
+  /// if configured and approved by the manager plugin.
+  managerApi::ManagerStateBasePtr createManagerState();
+
+  /// Restore a manager state from a non-empty persistence token,
+  /// consulting the persistence token cache, if configured.
+  managerApi::ManagerStateBasePtr restoreManagerState(const Str& token);
+
+  /// Initialize the manager plugin and derive state from its info.
+  void initializeInterface(InfoDictionary managerSettings);
+
+  /// Capabilities and info of an initialized manager plugin.
+  struct InterfaceSnapshot;
+
+  /// Discard the cached result of updateTerminology, if any.
+  void clearTerminology();
+
+  /// Query the manager plugin's capabilities and info, given that the
+  /// required capabilities have already been verified.
+  [[nodiscard]] std::shared_ptr<const InterfaceSnapshot> snapshotInterface() const;
+
+  /// Stop answering entityExists from the manager's existence filter,
+  /// since it may not contain newly registered entities, until it is
+  /// reloaded by flushCaches or re-initialization.
+  void dropEntityExistenceFilter();
+
+  /// Block until any pending asynchronous initialization completes.
+  void awaitInitialization();
+
+  /// Serve a resolve from the resolve cache where possible, forwarding
+  /// only the remainder to the manager plugin.
+  void resolveCached(EntityReferenceSpan entityReferences, const trait::TraitSet& traitSet,
+                     access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                     const ResolveSuccessCallback& successCallback,
+                     const BatchElementErrorCallback& errorCallback);
+
+  /// Forward a resolve to the manager plugin, honouring cancellation
+  /// and deduplicating entity references if configured.
+  void forwardResolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                      access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                      const ResolveSuccessCallback& successCallback,
+                      const BatchElementErrorCallback& errorCallback);
+
+  /// Dispatch a resolve to the manager plugin, in parallel chunks if
+  /// appropriate, and in chunks no larger than the plugin's maximum
+  /// batch size.
+  void dispatchResolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                       access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                       const ResolveSuccessCallback& successCallback,
+                       const BatchElementErrorCallback& errorCallback);
+
+  /// Maximum number of elements to dispatch to the plugin at once
+  /// for a call with the given context, or zero if unlimited.
+  [[nodiscard]] std::size_t chunkSizeFor(const ContextConstPtr& context) const;
 
   managerApi::ManagerInterfacePtr managerInterface_;
   managerApi::HostSessionPtr hostSession_;
-
-  std::optional<openassetio::Str> entityReferencePrefix_;
+  ResolveCachePtr resolveCache_;
+  /// Resolves in flight, for coalescing concurrent cache misses, if
+  /// resolveCache_ is set.
+  std::shared_ptr<PendingResolveTable> pendingResolves_;
+  /// Subscription that invalidates the resolve, entity traits and
+  /// default entity reference caches, or zero.
+  std::size_t entityChangeSubscriptionId_ = 0;
+  ManagerMetricsPtr metrics_;
+  std::size_t resolveChunkSize_;
+  bool deduplicateEntityReferences_;
+  std::size_t pagerPrefetchDepth_;
+  /// Whether the plugin declared itself thread-safe on initialization.
+  bool isThreadSafe_ = false;
+  /// Whether the plugin declared that it caches resolve results
+  /// itself on initialization, so the resolve cache is bypassed.
+  bool isResolveCached_ = false;
+  /// Maximum batch size the plugin declared on initialization, or zero
+  /// if unlimited.
+  std::size_t maxBatchSize_ = 0;
+  /// Maximum chunk size of background priority batches, or zero if
+  /// requests are not scheduled.
+  std::size_t backgroundChunkSize_;
+  /// Scheduler of calls by priority, if configured.
+  std::shared_ptr<RequestScheduler> requestScheduler_;
+
+  /// Native recogniser of entity references, if the plugin's info
+  /// dictionary provided sufficient information.
+  std::shared_ptr<const EntityReferenceMatcher> entityReferenceMatcher_;
+  std::shared_ptr<EntityReferenceStringCache> entityReferenceStringCache_;
+  std::shared_ptr<ManagementPolicyCache> managementPolicyCache_;
+  std::shared_ptr<ManagerStatePool> managerStatePool_;
+  std::shared_ptr<PersistenceTokenCache> persistenceTokenCache_;
+  std::shared_ptr<EntityTraitsCache> entityTraitsCache_;
+  std::shared_ptr<DefaultEntityReferenceCache> defaultEntityReferenceCache_;
+  /// Terms most recently given to updateTerminology, and the plugin's
+  /// substitutions for them, if any.
+  std::optional<std::pair<StrMap, StrMap>> terminology_;
+  std::mutex terminologyMutex_;
+  /// Snapshot of metrics_ at the previous call to statistics(), if
+  /// metrics_ is set. Held by pointer since snapshots are large.
+  std::unique_ptr<ManagerMetrics::Snapshot> statisticsBaseline_;
+  std::mutex statisticsMutex_;
+  /// Set once initialized. Accessed atomically, since it is refreshed
+  /// by flushCaches, which may be concurrent with other calls.
+  std::shared_ptr<const InterfaceSnapshot> interfaceSnapshot_;
+
+  /// Whether an asynchronous initialization may be in progress, or
+  /// has failed, to avoid locking on every call once initialized.
+  std::atomic<bool> isInitializing_{false};
+  std::mutex initializationMutex_;
+  /// Most recent asynchronous initialization, if any.
+  std::shared_future<void> initialization_;
 };
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
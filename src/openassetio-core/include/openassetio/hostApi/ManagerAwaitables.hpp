@@ -0,0 +1,362 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide C++20 coroutine awaitables for asynchronous Manager
+ * operations.
+ *
+ * This header is only functional when compiled as C++20 (or later)
+ * with coroutine support, in which case it defines
+ * `OPENASSETIO_HAS_COROUTINES`. Otherwise it is empty, so may be
+ * included unconditionally.
+ */
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#define OPENASSETIO_HAS_COROUTINES 1
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Callable used to resume a coroutine awaiting a Manager operation.
+ *
+ * This allows the host to choose where awaiting coroutines continue,
+ * e.g. by posting the handle to an event loop or a pool of worker
+ * threads. If empty, the coroutine is resumed directly on whichever
+ * thread completed the operation.
+ */
+using ManagerAwaitableResumer = std::function<void(std::coroutine_handle<>)>;
+
+/**
+ * Awaitable for an asynchronous batch operation of a @ref Manager.
+ *
+ * Awaiting starts the operation, suspending the awaiting coroutine
+ * without blocking a thread. The coroutine is resumed, via the
+ * @ref ManagerAwaitableResumer, once the whole batch is complete,
+ * with a list of per-entity results in the same order as the input.
+ * If the whole batch fails, the exception is rethrown into the
+ * coroutine.
+ *
+ * If the operation completes before the coroutine suspends, e.g.
+ * because all results were cached, the coroutine continues without
+ * suspending.
+ *
+ * Instances are created by the `awaitXxx` functions, such as
+ * @ref awaitResolve, and must be awaited at most once.
+ *
+ * @tparam Value Type of a successful per-entity result.
+ */
+template <class Value>
+class ManagerBatchAwaitable {
+ public:
+  /// Per-entity results of the batch.
+  using Results = std::vector<std::variant<errors::BatchElementError, Value>>;
+  /// Callback to store a successful per-entity result.
+  using SuccessCallback = std::function<void(std::size_t, Value)>;
+  /// Operation to start, given the callbacks to report results with.
+  using Start = std::function<void(SuccessCallback, Manager::BatchElementErrorCallback,
+                                   Manager::CompletionCallback)>;
+
+  /**
+   * Construct an awaitable for an operation.
+   *
+   * @param batchSize Number of elements in the batch.
+   * @param start Operation to start when awaited.
+   * @param resumer Callable used to resume the awaiting coroutine.
+   */
+  ManagerBatchAwaitable(const std::size_t batchSize, Start start, ManagerAwaitableResumer resumer)
+      : state_{std::make_shared<State>()}, start_{std::move(start)} {
+    state_->results.resize(batchSize);
+    state_->resumer = std::move(resumer);
+  }
+
+  /// Never ready until started.
+  [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+  /**
+   * Start the operation.
+   *
+   * @param handle Awaiting coroutine.
+   * @return Whether to suspend, i.e. `false` if the operation
+   * completed synchronously.
+   */
+  bool await_suspend(const std::coroutine_handle<> handle) {
+    state_->handle = handle;
+    start_(
+        [state = state_](const std::size_t idx, Value value) {
+          state->results[idx] = std::move(value);
+        },
+        [state = state_](const std::size_t idx, errors::BatchElementError error) {
+          state->results[idx] = std::move(error);
+        },
+        [state = state_](std::exception_ptr exception) {
+          state->exception = std::move(exception);
+          // If the awaiting coroutine has already suspended, it is our
+          // responsibility to resume it.
+          if (state->completedOrSuspended.exchange(true, std::memory_order_acq_rel)) {
+            if (state->resumer) {
+              state->resumer(state->handle);
+            } else {
+              state->handle.resume();
+            }
+          }
+        });
+    // If the operation has already completed, continue without
+    // suspending.
+    return !state_->completedOrSuspended.exchange(true, std::memory_order_acq_rel);
+  }
+
+  /**
+   * Get the results of the operation.
+   *
+   * @return Per-entity results.
+   * @exception Any exception that failed the whole batch.
+   */
+  Results await_resume() {
+    if (state_->exception) {
+      std::rethrow_exception(state_->exception);
+    }
+    return std::move(state_->results);
+  }
+
+ private:
+  /// State shared with the operation's callbacks.
+  struct State {
+    Results results;
+    std::exception_ptr exception;
+    std::coroutine_handle<> handle;
+    ManagerAwaitableResumer resumer;
+    std::atomic<bool> completedOrSuspended{false};
+  };
+
+  std::shared_ptr<State> state_;
+  Start start_;
+};
+
+/**
+ * Awaitable for a singular asynchronous operation of a @ref Manager.
+ *
+ * Equivalent to a @ref ManagerBatchAwaitable of one element, resuming
+ * the awaiting coroutine with the result for that element.
+ *
+ * @tparam Value Type of a successful result.
+ */
+template <class Value>
+class ManagerAwaitable {
+ public:
+  /// Result of the operation.
+  using Result = std::variant<errors::BatchElementError, Value>;
+
+  /// Wrap a batch of one.
+  explicit ManagerAwaitable(ManagerBatchAwaitable<Value> batchAwaitable)
+      : batchAwaitable_{std::move(batchAwaitable)} {}
+
+  /// Never ready until started.
+  [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+  /// See @ref ManagerBatchAwaitable::await_suspend.
+  bool await_suspend(const std::coroutine_handle<> handle) {
+    return batchAwaitable_.await_suspend(handle);
+  }
+
+  /**
+   * Get the result of the operation.
+   *
+   * @return Result or error.
+   * @exception Any exception that failed the whole operation.
+   */
+  Result await_resume() { return std::move(batchAwaitable_.await_resume().front()); }
+
+ private:
+  ManagerBatchAwaitable<Value> batchAwaitable_;
+};
+
+/**
+ * @name Coroutine Variants of Asynchronous Operations
+ *
+ * Awaitable variants of the asynchronous batch operations of
+ * @ref Manager, for use from C++20 coroutines, e.g.
+ *
+ * @code
+ * for (auto& result : co_await hostApi::awaitResolve(
+ *          manager, refs, traitSet, access::ResolveAccess::kRead, context)) {
+ *   ...
+ * }
+ * @endcode
+ *
+ * Suspended coroutines do not occupy a thread, so many operations may
+ * be in flight at once. The thread that runs the operation is
+ * determined by the manager, and, by default, the host's scheduler.
+ * See @fqref{hostApi.HostInterface.submit} "HostInterface.submit".
+ *
+ * Each operation is started when awaited, not when the awaitable is
+ * created. As with the other asynchronous variants, all arguments are
+ * copied as needed, so they need not outlive the call.
+ *
+ * @{
+ */
+
+/// Awaitable variant of @ref Manager::entityExistsAsync.
+inline ManagerBatchAwaitable<bool> awaitEntityExists(ManagerPtr manager,
+                                                     EntityReferences entityReferences,
+                                                     ContextConstPtr context,
+                                                     ManagerAwaitableResumer resumer = {}) {
+  const std::size_t batchSize = entityReferences.size();
+  return {batchSize,
+          [manager = std::move(manager), entityReferences = std::move(entityReferences),
+           context = std::move(context)](auto success, auto error, auto completion) {
+            manager->entityExistsAsync(entityReferences, context, std::move(success),
+                                       std::move(error), std::move(completion));
+          },
+          std::move(resumer)};
+}
+
+/// Awaitable variant of @ref Manager::entityExistsAsync for a single
+/// entity.
+inline ManagerAwaitable<bool> awaitEntityExists(ManagerPtr manager,
+                                                const EntityReference& entityReference,
+                                                ContextConstPtr context,
+                                                ManagerAwaitableResumer resumer = {}) {
+  return ManagerAwaitable<bool>{awaitEntityExists(std::move(manager),
+                                                  EntityReferences{entityReference},
+                                                  std::move(context), std::move(resumer))};
+}
+
+/// Awaitable variant of @ref Manager::entityTraitsAsync.
+inline ManagerBatchAwaitable<trait::TraitSet> awaitEntityTraits(
+    ManagerPtr manager, EntityReferences entityReferences,
+    const access::EntityTraitsAccess entityTraitsAccess, ContextConstPtr context,
+    ManagerAwaitableResumer resumer = {}) {
+  const std::size_t batchSize = entityReferences.size();
+  return {batchSize,
+          [manager = std::move(manager), entityReferences = std::move(entityReferences),
+           entityTraitsAccess, context = std::move(context)](auto success, auto error,
+                                                             auto completion) {
+            manager->entityTraitsAsync(entityReferences, entityTraitsAccess, context,
+                                       std::move(success), std::move(error),
+                                       std::move(completion));
+          },
+          std::move(resumer)};
+}
+
+/// Awaitable variant of @ref Manager::entityTraitsAsync for a single
+/// entity.
+inline ManagerAwaitable<trait::TraitSet> awaitEntityTraits(
+    ManagerPtr manager, const EntityReference& entityReference,
+    const access::EntityTraitsAccess entityTraitsAccess, ContextConstPtr context,
+    ManagerAwaitableResumer resumer = {}) {
+  return ManagerAwaitable<trait::TraitSet>{
+      awaitEntityTraits(std::move(manager), EntityReferences{entityReference},
+                        entityTraitsAccess, std::move(context), std::move(resumer))};
+}
+
+/// Awaitable variant of @ref Manager::resolveAsync.
+inline ManagerBatchAwaitable<trait::TraitsDataPtr> awaitResolve(
+    ManagerPtr manager, EntityReferences entityReferences, trait::TraitSet traitSet,
+    const access::ResolveAccess resolveAccess, ContextConstPtr context,
+    ManagerAwaitableResumer resumer = {}) {
+  const std::size_t batchSize = entityReferences.size();
+  return {batchSize,
+          [manager = std::move(manager), entityReferences = std::move(entityReferences),
+           traitSet = std::move(traitSet), resolveAccess,
+           context = std::move(context)](auto success, auto error, auto completion) {
+            manager->resolveAsync(entityReferences, traitSet, resolveAccess, context,
+                                  std::move(success), std::move(error), std::move(completion));
+          },
+          std::move(resumer)};
+}
+
+/// Awaitable variant of @ref Manager::resolveAsync for a single
+/// entity.
+inline ManagerAwaitable<trait::TraitsDataPtr> awaitResolve(
+    ManagerPtr manager, const EntityReference& entityReference, trait::TraitSet traitSet,
+    const access::ResolveAccess resolveAccess, ContextConstPtr context,
+    ManagerAwaitableResumer resumer = {}) {
+  return ManagerAwaitable<trait::TraitsDataPtr>{
+      awaitResolve(std::move(manager), EntityReferences{entityReference}, std::move(traitSet),
+                   resolveAccess, std::move(context), std::move(resumer))};
+}
+
+/// Awaitable variant of @ref Manager::preflightAsync.
+inline ManagerBatchAwaitable<EntityReference> awaitPreflight(
+    ManagerPtr manager, EntityReferences entityReferences, trait::TraitsDatas traitsHints,
+    const access::PublishingAccess publishingAccess, ContextConstPtr context,
+    ManagerAwaitableResumer resumer = {}) {
+  const std::size_t batchSize = entityReferences.size();
+  return {batchSize,
+          [manager = std::move(manager), entityReferences = std::move(entityReferences),
+           traitsHints = std::move(traitsHints), publishingAccess,
+           context = std::move(context)](auto success, auto error, auto completion) {
+            manager->preflightAsync(entityReferences, traitsHints, publishingAccess, context,
+                                    std::move(success), std::move(error), std::move(completion));
+          },
+          std::move(resumer)};
+}
+
+/// Awaitable variant of @ref Manager::preflightAsync for a single
+/// entity.
+inline ManagerAwaitable<EntityReference> awaitPreflight(
+    ManagerPtr manager, const EntityReference& entityReference, trait::TraitsDataPtr traitsHint,
+    const access::PublishingAccess publishingAccess, ContextConstPtr context,
+    ManagerAwaitableResumer resumer = {}) {
+  return ManagerAwaitable<EntityReference>{
+      awaitPreflight(std::move(manager), EntityReferences{entityReference},
+                     trait::TraitsDatas{std::move(traitsHint)}, publishingAccess,
+                     std::move(context), std::move(resumer))};
+}
+
+/// Awaitable variant of @ref Manager::registerAsync.
+inline ManagerBatchAwaitable<EntityReference> awaitRegister(
+    ManagerPtr manager, EntityReferences entityReferences, trait::TraitsDatas entityTraitsDatas,
+    const access::PublishingAccess publishingAccess, ContextConstPtr context,
+    ManagerAwaitableResumer resumer = {}) {
+  const std::size_t batchSize = entityReferences.size();
+  return {batchSize,
+          [manager = std::move(manager), entityReferences = std::move(entityReferences),
+           entityTraitsDatas = std::move(entityTraitsDatas), publishingAccess,
+           context = std::move(context)](auto success, auto error, auto completion) {
+            manager->registerAsync(entityReferences, entityTraitsDatas, publishingAccess,
+                                   context, std::move(success), std::move(error),
+                                   std::move(completion));
+          },
+          std::move(resumer)};
+}
+
+/// Awaitable variant of @ref Manager::registerAsync for a single
+/// entity.
+inline ManagerAwaitable<EntityReference> awaitRegister(
+    ManagerPtr manager, const EntityReference& entityReference,
+    trait::TraitsDataPtr entityTraitsData, const access::PublishingAccess publishingAccess,
+    ContextConstPtr context, ManagerAwaitableResumer resumer = {}) {
+  return ManagerAwaitable<EntityReference>{
+      awaitRegister(std::move(manager), EntityReferences{entityReference},
+                    trait::TraitsDatas{std::move(entityTraitsData)}, publishingAccess,
+                    std::move(context), std::move(resumer))};
+}
+
+/// @}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+#endif  // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
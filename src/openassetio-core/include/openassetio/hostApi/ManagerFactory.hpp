@@ -2,20 +2,24 @@
 // Copyright 2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
 
 #include <openassetio/export.h>
 #include <openassetio/InfoDictionary.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
 #include <openassetio/typedefs.hpp>
 
 OPENASSETIO_FWD_DECLARE(hostApi, HostInterface)
-OPENASSETIO_FWD_DECLARE(hostApi, Manager)
-OPENASSETIO_FWD_DECLARE(hostApi, ManagerImplementationFactoryInterface)
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
 OPENASSETIO_FWD_DECLARE(managerApi, ManagerInterface)
+OPENASSETIO_FWD_DECLARE(MemoryResourceInterface)
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -42,27 +46,56 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
   /**
    * Simple struct containing the default configuration details of a
    * potential @ref manager implementation.
+   *
+   * @see @fqref{hostApi.ManagerImplementationFactoryInterface.ManagerDetail}
+   * "ManagerImplementationFactoryInterface.ManagerDetail"
+   */
+  using ManagerDetail = ManagerImplementationFactoryInterface::ManagerDetail;
+  /// Mapping of manager identifier to its configuration details.
+  using ManagerDetails = std::unordered_map<Identifier, ManagerDetail>;
+
+  /**
+   * Configuration of a @ref ResolveCache for the default manager.
+   *
+   * @see @ref defaultManagerForInterface(std::string_view, <!--
+   * --> const HostInterfacePtr&, <!--
+   * --> const ManagerImplementationFactoryInterfacePtr&, <!--
+   * --> const log::LoggerInterfacePtr&) "defaultManagerForInterface"
    */
-  struct ManagerDetail {
+  struct ResolveCacheConfig {
+    /// Maximum number of entries to retain in each process.
+    std::size_t capacity;
+    /// Configuration of the tier shared between processes, if any.
+    std::optional<ResolveCache::SharedTier> sharedTier;
     /**
-     * Identifier of the manager.
+     * Compare all fields in this instance and another for by-value
+     * equality.
      *
-     * @see @fqref{hostApi.Manager.identifier} "Manager.identifier"
-     */
-    Identifier identifier;
-    /**
-     * Human readable display name of the manager, suitable for
-     * presenting in a UI.
+     * @param other Other instance to compare against.
      *
-     * @see @fqref{hostApi.Manager.displayName} "Manager.displayName"
+     * @return `true` if all fields compare equal, `false` otherwise.
      */
-    Str displayName;
+    bool operator==(const ResolveCacheConfig& other) const {
+      return capacity == other.capacity && sharedTier == other.sharedTier;
+    }
+  };
+
+  /**
+   * Simple struct containing the parsed contents of a default manager
+   * TOML configuration file.
+   *
+   * @see @ref loadDefaultManagerConfig
+   */
+  struct DefaultManagerConfig {
+    /// Identifier of the manager to instantiate.
+    Identifier identifier;
     /**
-     * Arbitrary key-value information supplied by the manager.
-     *
-     * @see @fqref{hostApi.Manager.info} "Manager.info"
+     * Settings to initialize the manager with, with any `${config_dir}`
+     * substitutions already applied.
      */
-    InfoDictionary info;
+    InfoDictionary settings;
+    /// Resolve cache to give the manager, if any.
+    std::optional<ResolveCacheConfig> resolveCache;
     /**
      * Compare all fields in this instance and another for by-value
      * equality.
@@ -71,13 +104,11 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
      *
      * @return `true` if all fields compare equal, `false` otherwise.
      */
-    bool operator==(const ManagerDetail& other) const {
-      return identifier == other.identifier && displayName == other.displayName &&
-             info == other.info;
+    bool operator==(const DefaultManagerConfig& other) const {
+      return identifier == other.identifier && settings == other.settings &&
+             resolveCache == other.resolveCache;
     }
   };
-  /// Mapping of manager identifier to its configuration details.
-  using ManagerDetails = std::unordered_map<Identifier, ManagerDetail>;
 
   /**
    * The name of the env var used to define the default manager config TOML file.
@@ -107,6 +138,31 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
       ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
       log::LoggerInterfacePtr logger);
 
+  /**
+   * Construct an instance of this class, whose managers allocate data
+   * returned to the host from the given memory resource.
+   *
+   * @param hostInterface The @ref host "host's" implementation of the
+   * `HostInterface`.
+   *
+   * @param managerImplementationFactory The factory that will be used to
+   * instantiate managers.
+   *
+   * @param logger The logger instance that will be used for all
+   * messaging from the factory and instantiated @fqref{hostApi.Manager}
+   * "Manager" instances.
+   *
+   * @param memoryResource Resource supplied to the
+   * @fqref{managerApi.HostSession} "HostSession" of managers created by
+   * @ref createManager, or null to use the global heap. This must
+   * outlive any data allocated from it, see @ref
+   * MemoryResourceInterface.
+   */
+  [[nodiscard]] static ManagerFactoryPtr make(
+      HostInterfacePtr hostInterface,
+      ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
+      log::LoggerInterfacePtr logger, MemoryResourceInterfacePtr memoryResource);
+
   /**
    * All identifiers known to the factory.
    *
@@ -145,9 +201,12 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
    *
    * @param identifier Unique manager identifier.
    *
+   * @param managerOptions Optional behaviour of the manager.
+   *
    * @return Newly instantiated manager.
    */
-  [[nodiscard]] ManagerPtr createManager(const Identifier& identifier) const;
+  [[nodiscard]] ManagerPtr createManager(const Identifier& identifier,
+                                         Manager::Options managerOptions = {}) const;
 
   /**
    * Create a @fqref{hostApi.Manager} "Manager" instance for the @ref
@@ -172,12 +231,14 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
    * messaging from the factory and instantiated @fqref{hostApi.Manager}
    * "Manager" instances.
    *
+   * @param managerOptions Optional behaviour of the manager.
+   *
    * @return Newly instantiated manager.
    */
   [[nodiscard]] static ManagerPtr createManagerForInterface(
       const Identifier& identifier, const HostInterfacePtr& hostInterface,
       const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
-      const log::LoggerInterfacePtr& logger);
+      const log::LoggerInterfacePtr& logger, Manager::Options managerOptions = {});
 
   /**
    * Creates the default @fqref{hostApi.Manager} "Manager" as defined by
@@ -232,12 +293,28 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
    *
    * [manager.settings]  # Optional
    * some_setting = "value"
+   *
+   * [manager.resolve_cache]  # Optional
+   * capacity = 10000
+   * # Optional shared tier, either in shared memory...
+   * shared_name = "studio_resolves"
+   * # ...or in a file, persisting across runs.
+   * path = "${config_dir}/resolves.cache"
+   * slot_count = 65536
+   * slot_size = 1024  # Optional
+   * time_to_live = 3600  # Optional, in seconds
    * @endcode
    *
    * Any occurrences of `${config_dir}` within TOML string values will
    * be substituted with the absolute path to the directory containing
    * the TOML file, before being passed on to the manager settings.
    *
+   * If a `resolve_cache` table is present, the manager is given a @ref
+   * ResolveCache. See @ref ResolveCache.SharedTier for details of the
+   * shared and persistent tiers, and @ref
+   * constants.kInfoKey_ResolveCacheToken for how managers can
+   * invalidate them.
+   *
    * @param configPath Path to the TOML config file, compatible with
    * <a href="https://en.cppreference.com/w/cpp/io/basic_ifstream/open">
    * `std::ifstream::open`</a>. Relative paths resolve to a
@@ -268,14 +345,117 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
       const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
       const log::LoggerInterfacePtr& logger);
 
+  /**
+   * Creates a @fqref{hostApi.Manager} "Manager" as defined by a
+   * previously loaded configuration.
+   *
+   * This allows hosts that create many managers from the same
+   * configuration to avoid any filesystem access after the first
+   * load.
+   *
+   * @param config Configuration, as returned by @ref
+   * loadDefaultManagerConfig.
+   *
+   * @param hostInterface The @ref host "host's" implementation of the
+   * `HostInterface`.
+   *
+   * @param managerImplementationFactory The factory that will be used
+   * to instantiate managers.
+   *
+   * @param logger The logger instance that will be used for all
+   * messaging from the instantiated @fqref{hostApi.Manager} "Manager"
+   * instances.
+   *
+   * @param managerOptions Optional behaviour of the manager. The
+   * configured resolve cache, if any, replaces that of these options.
+   *
+   * @return A manager initialized with the configured settings, and
+   * the configured resolve cache, if any.
+   */
+  [[nodiscard]] static ManagerPtr defaultManagerForInterface(
+      const DefaultManagerConfig& config, const HostInterfacePtr& hostInterface,
+      const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+      const log::LoggerInterfacePtr& logger, Manager::Options managerOptions = {});
+
+  /**
+   * Loads and parses a default manager TOML configuration file.
+   *
+   * See @ref defaultManagerForInterface(std::string_view, <!--
+   * -->const HostInterfacePtr&,<!--
+   * -->const ManagerImplementationFactoryInterfacePtr&,<!--
+   * -->const log::LoggerInterfacePtr&) "defaultManagerForInterface"
+   * for the expected structure of the file.
+   *
+   * Parsed configurations are cached process-wide, keyed on the
+   * absolute path of the file, and re-used for as long as the file's
+   * modification time and size are unchanged. This cache is also used
+   * by the path-based overloads of @ref defaultManagerForInterface.
+   *
+   * @param configPath Path to the TOML config file.
+   *
+   * @return The parsed configuration.
+   *
+   * @throws errors.InputValidationException if the config file does
+   * not exist at the path provided in @p configPath.
+   *
+   * @throws errors.ConfigurationException if there are errors whilst
+   * loading the TOML file.
+   */
+  [[nodiscard]] static DefaultManagerConfig loadDefaultManagerConfig(std::string_view configPath);
+
+  /**
+   * Retrieves a shared, initialized @fqref{hostApi.Manager} "Manager"
+   * for the given configuration, using this factory's host interface,
+   * implementation factory and logger.
+   *
+   * @see @ref sharedManagerForInterface
+   */
+  [[nodiscard]] ManagerPtr sharedManager(const DefaultManagerConfig& config) const;
+
+  /**
+   * Retrieves a shared, initialized @fqref{hostApi.Manager} "Manager"
+   * for the given configuration.
+   *
+   * Managers are shared process-wide between all callers that provide
+   * the same manager identifier and settings, from a host with the
+   * same identifier. A new manager is only created and initialized if
+   * no other caller currently holds one, so initialization cost is
+   * paid once for as long as the manager is in use. Once all callers
+   * have released it, the manager is destroyed as normal.
+   *
+   * This is opt-in, since callers share all manager state, including
+   * cached data and any configuration applied after initialization.
+   * In particular, the shared manager uses the host interface and
+   * logger of the caller that created it.
+   *
+   * @param config Configuration, as returned by @ref
+   * loadDefaultManagerConfig.
+   *
+   * @param hostInterface The @ref host "host's" implementation of the
+   * `HostInterface`.
+   *
+   * @param managerImplementationFactory The factory that will be used
+   * to instantiate the manager, if required.
+   *
+   * @param logger The logger instance that will be used for all
+   * messaging from the manager, if instantiated.
+   *
+   * @return A shared, initialized manager.
+   */
+  [[nodiscard]] static ManagerPtr sharedManagerForInterface(
+      const DefaultManagerConfig& config, const HostInterfacePtr& hostInterface,
+      const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+      const log::LoggerInterfacePtr& logger);
+
  private:
   ManagerFactory(HostInterfacePtr hostInterface,
                  ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
-                 log::LoggerInterfacePtr logger);
+                 log::LoggerInterfacePtr logger, MemoryResourceInterfacePtr memoryResource);
 
   const HostInterfacePtr hostInterface_;
   const ManagerImplementationFactoryInterfacePtr managerImplementationFactory_;
   const log::LoggerInterfacePtr logger_;
+  const MemoryResourceInterfacePtr memoryResource_;
 };
 
 }  // namespace hostApi
@@ -3,9 +3,11 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/InfoDictionary.hpp>
 #include <openassetio/typedefs.hpp>
 
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
@@ -41,6 +43,44 @@ class OPENASSETIO_CORE_EXPORT ManagerImplementationFactoryInterface {
  public:
   OPENASSETIO_ALIAS_PTR(ManagerImplementationFactoryInterface)
 
+  /**
+   * Simple struct containing the default configuration details of a
+   * potential @ref manager implementation.
+   */
+  struct ManagerDetail {
+    /**
+     * Identifier of the manager.
+     *
+     * @see @fqref{hostApi.Manager.identifier} "Manager.identifier"
+     */
+    Identifier identifier;
+    /**
+     * Human readable display name of the manager, suitable for
+     * presenting in a UI.
+     *
+     * @see @fqref{hostApi.Manager.displayName} "Manager.displayName"
+     */
+    Str displayName;
+    /**
+     * Arbitrary key-value information supplied by the manager.
+     *
+     * @see @fqref{hostApi.Manager.info} "Manager.info"
+     */
+    InfoDictionary info;
+    /**
+     * Compare all fields in this instance and another for by-value
+     * equality.
+     *
+     * @param other Other instance to compare against.
+     *
+     * @return `true` if all fields compare equal, `false` otherwise.
+     */
+    bool operator==(const ManagerDetail& other) const {
+      return identifier == other.identifier && displayName == other.displayName &&
+             info == other.info;
+    }
+  };
+
   /**
    * Construct an instance of this class.
    *
@@ -71,6 +111,27 @@ class OPENASSETIO_CORE_EXPORT ManagerImplementationFactoryInterface {
   [[nodiscard]] virtual managerApi::ManagerInterfacePtr instantiate(
       const Identifier& identifier) = 0;
 
+  /**
+   * Details of the \fqref{managerApi.ManagerInterface}
+   * "ManagerInterface" with the specified identifier, if they can be
+   * determined without instantiating it.
+   *
+   * Factories able to obtain this metadata cheaply, for example from a
+   * statically declared plugin manifest, should override this method,
+   * so that hosts listing the available managers avoid the cost of
+   * instantiating each one.
+   *
+   * The default implementation returns no details, in which case the
+   * caller must fall back to @ref instantiate.
+   *
+   * @param identifier The identifier of the ManagerInterface to
+   * describe.
+   *
+   * @return Details of the ManagerInterface, as it would report them
+   * once instantiated, or an empty value if unknown.
+   */
+  [[nodiscard]] virtual std::optional<ManagerDetail> details(const Identifier& identifier);
+
  protected:
   /// Logger instance that should be used for all logging.
   // Allow violation of no protected members, since this is const and
@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide low-overhead counters and latency histograms of Manager
+ * API calls.
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(ManagerMetrics)
+
+/**
+ * A registry of metrics describing the batch API calls made via a
+ * @ref Manager.
+ *
+ * When supplied to @ref Manager.make, every call to a batch method
+ * (e.g. @ref Manager.resolve) is counted, along with the number of
+ * its elements that succeeded, the number that failed broken down by
+ * @fqref{errors.BatchElementError.ErrorCode} "error code", whether
+ * the call failed with an exception, and the wall-clock duration of
+ * the call, in a histogram of exponentially sized buckets. Durations
+ * are additionally broken down by the size of the batch, in
+ * exponentially sized batch size buckets, so that, e.g., the latency
+ * of interactive single-element queries is not masked by that of
+ * large batches.
+ *
+ * Recording is lock-free: counters are relaxed atomics, partitioned
+ * into a number of cache-line aligned shards, with each thread
+ * recording to its own shard, so concurrent calls from many threads
+ * do not contend. Hence the cost of recording is a handful of
+ * uncontended atomic increments per call.
+ *
+ * A @ref snapshot aggregates all shards. Since shards are read
+ * without synchronisation, a snapshot taken whilst calls are in
+ * flight may include some, but not all, counters of a concurrently
+ * recorded call. Counters are monotonic and never reset, as is
+ * expected by monitoring systems, such that the snapshot can be
+ * exported via, e.g., @ref toPrometheusText. Statistics of an
+ * interval can instead be computed using @ref Snapshot.since, as is
+ * done by @ref Manager.statistics.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT ManagerMetrics final {
+ public:
+  OPENASSETIO_ALIAS_PTR(ManagerMetrics)
+
+  /// Batch API methods of the @ref Manager that are measured.
+  enum class Method : std::size_t {
+    kEntityExists,
+    kEntityTraits,
+    kResolve,
+    kDefaultEntityReference,
+    kGetWithRelationship,
+    kGetWithRelationships,
+    kGetWithRelationshipsMatrix,
+    kTraverseRelationships,
+    kPreflight,
+    kRegister
+  };
+
+  /// Names of methods, indexed by @ref Method.
+  static constexpr std::array kMethodNames{"entityExists",
+                                           "entityTraits",
+                                           "resolve",
+                                           "defaultEntityReference",
+                                           "getWithRelationship",
+                                           "getWithRelationships",
+                                           "getWithRelationshipsMatrix",
+                                           "traverseRelationships",
+                                           "preflight",
+                                           "register"};
+
+  /// Number of distinct @fqref{errors.BatchElementError.ErrorCode}
+  /// "error codes" that are counted.
+  static constexpr std::size_t kErrorCodeCount = 8;
+
+  /**
+   * Number of latency histogram buckets with a finite upper bound.
+   *
+   * The upper bound of bucket `n` is 2^n microseconds, i.e. the
+   * finite buckets span 1µs to ~33.5s. An additional final bucket
+   * counts calls exceeding the largest finite bound.
+   */
+  static constexpr std::size_t kLatencyBucketCount = 26;
+
+  /**
+   * Number of batch size buckets with a finite upper bound.
+   *
+   * The upper bound of bucket `n` is 4^n elements, i.e. the finite
+   * buckets span 1 to 4096 elements. An additional final bucket
+   * counts calls with larger batches.
+   */
+  static constexpr std::size_t kBatchSizeBucketCount = 7;
+
+  /// Default number of independently updated shards.
+  static constexpr std::size_t kDefaultShardCount = 16;
+
+  /// Count per error code, indexed by @ref errorCodeIndex.
+  using ErrorCounts = std::array<std::uint64_t, kErrorCodeCount>;
+
+  /// Number of calls per latency bucket (non-cumulative), where the
+  /// final element counts calls exceeding every finite bucket.
+  using LatencyBuckets = std::array<std::uint64_t, kLatencyBucketCount + 1>;
+
+  /// Aggregated durations of calls of a single method with batches
+  /// of a similar size.
+  struct BatchSizeStatistics {
+    /// Number of calls.
+    std::uint64_t calls;
+    /// Number of calls per latency bucket.
+    LatencyBuckets latencyBuckets;
+    /// Sum of the duration of all calls.
+    std::chrono::nanoseconds totalLatency;
+  };
+
+  /// Aggregated metrics of a single method.
+  struct MethodStatistics {
+    /// Number of calls, including those that raised an exception.
+    std::uint64_t calls;
+    /// Number of calls that failed with an exception.
+    std::uint64_t exceptions;
+    /// Number of elements reported via the success callback.
+    std::uint64_t successes;
+    /// Number of elements reported via the error callback, per code.
+    ErrorCounts errors;
+    /// Number of calls per latency bucket, for all batch sizes.
+    LatencyBuckets latencyBuckets;
+    /// Sum of the duration of all calls.
+    std::chrono::nanoseconds totalLatency;
+    /// Durations of calls, indexed by @ref batchSizeBucketIndex.
+    std::array<BatchSizeStatistics, kBatchSizeBucketCount + 1> batchSizes;
+  };
+
+  /// Aggregated metrics of all methods.
+  struct Snapshot {
+    /// Metrics per method, indexed by @ref Method.
+    std::array<MethodStatistics, kMethodNames.size()> methods;
+
+    /// @return Metrics of the given method.
+    [[nodiscard]] const MethodStatistics& at(Method method) const;
+
+    /**
+     * Compute the metrics recorded in the interval between an earlier
+     * snapshot of the same registry and this one.
+     *
+     * @param earlier Snapshot taken before this one.
+     * @return Difference between the counters of the snapshots.
+     */
+    [[nodiscard]] Snapshot since(const Snapshot& earlier) const;
+  };
+
+  /**
+   * Construct a new registry, with all counters zero.
+   *
+   * @param shardCount Number of independently updated shards. Threads
+   * are distributed between shards round-robin, so contention is
+   * avoided if this is at least the number of threads making calls.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the shard count is
+   * zero.
+   */
+  [[nodiscard]] static ManagerMetricsPtr make(std::size_t shardCount = kDefaultShardCount);
+
+  /// Defaulted destructor.
+  ~ManagerMetrics();
+
+  /**
+   * @return Index of the given error code in @ref ErrorCounts. Codes
+   * that are not known are attributed to `kUnknown`.
+   */
+  [[nodiscard]] static std::size_t errorCodeIndex(errors::BatchElementError::ErrorCode code);
+
+  /// @return Upper bound of the finite latency bucket at the given
+  /// index.
+  [[nodiscard]] static constexpr std::chrono::nanoseconds latencyBucketUpperBound(
+      const std::size_t bucketIndex) {
+    return std::chrono::microseconds{std::int64_t{1} << bucketIndex};
+  }
+
+  /// @return Upper bound of the finite batch size bucket at the given
+  /// index.
+  [[nodiscard]] static constexpr std::size_t batchSizeBucketUpperBound(
+      const std::size_t bucketIndex) {
+    return std::size_t{1} << (2 * bucketIndex);
+  }
+
+  /// @return Index of the batch size bucket counting calls with
+  /// batches of the given size.
+  [[nodiscard]] static std::size_t batchSizeBucketIndex(std::size_t batchSize);
+
+  /**
+   * Estimate a quantile of call durations from a latency histogram.
+   *
+   * As with HDR histograms, the estimate is the upper bound of the
+   * bucket containing the quantile, so is at most a factor of two
+   * larger than the true value. If the quantile lies in the final,
+   * unbounded, bucket, the largest finite bound is returned.
+   *
+   * @param latencyBuckets Histogram, e.g. from @ref MethodStatistics
+   * or @ref BatchSizeStatistics.
+   * @param quantile Quantile to estimate, in the range [0, 1].
+   * @return Estimated duration, or zero if the histogram is empty.
+   * @exception errors.InputValidationException If the quantile is out
+   * of range.
+   */
+  [[nodiscard]] static std::chrono::nanoseconds latencyQuantile(
+      const LatencyBuckets& latencyBuckets, double quantile);
+
+  /**
+   * Record a single call.
+   *
+   * This is called by the @ref Manager, but may also be used to
+   * record calls made by other means.
+   *
+   * @param method Method that was called.
+   * @param latency Duration of the call.
+   * @param successes Number of elements that succeeded.
+   * @param errors Number of elements that failed, per error code.
+   * @param raisedException Whether the call failed with an exception.
+   * @param batchSize Number of elements in the batch.
+   */
+  void record(Method method, std::chrono::nanoseconds latency, std::uint64_t successes,
+              const ErrorCounts& errors, bool raisedException, std::size_t batchSize = 1);
+
+  /// @return Metrics aggregated from all threads since construction.
+  [[nodiscard]] Snapshot snapshot() const;
+
+  /**
+   * Format a snapshot in the Prometheus text exposition format.
+   *
+   * Only methods that have been called are included. Each series is
+   * labelled with the `manager` identifier and `method` name. Call
+   * durations are exported as a histogram in seconds.
+   *
+   * @param snapshot Metrics to format.
+   * @param managerIdentifier Value of the `manager` label, typically
+   * the @ref Manager.identifier "identifier" of the manager.
+   * @return Text suitable for serving from a metrics endpoint.
+   */
+  [[nodiscard]] static Str toPrometheusText(const Snapshot& snapshot,
+                                            const Identifier& managerIdentifier);
+
+ private:
+  explicit ManagerMetrics(std::size_t shardCount);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a utility to replay recorded manager traffic.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(Manager)
+OPENASSETIO_DECLARE_PTR(ManagerTrafficReplayer)
+
+/**
+ * Replays a log of manager traffic, as written by a @ref
+ * RecordingManagerInterface, against a Manager.
+ *
+ * Calls are replayed in the order they were recorded, each issued no
+ * earlier than its recorded start time divided by the replay rate.
+ * This allows a manager plugin to be benchmarked, or load tested at
+ * an accelerated rate, using traffic captured from a production host.
+ *
+ * A new Context is created for each context in the log, with the
+ * recorded locale. Calls are replayed synchronously on the calling
+ * thread, including those that were recorded as asynchronous or
+ * concurrent, so if the manager cannot keep up with the requested
+ * rate, calls are issued late rather than overlapping. Relationship
+ * query results are discarded without paging.
+ *
+ * Publishing calls (`preflight` and `register`) are skipped unless
+ * explicitly enabled, since they may modify the manager's data.
+ */
+class OPENASSETIO_CORE_EXPORT ManagerTrafficReplayer final {
+ public:
+  OPENASSETIO_ALIAS_PTR(ManagerTrafficReplayer)
+
+  /// Outcome of replaying the calls to a single method.
+  struct MethodReport {
+    /// Number of calls that were replayed.
+    std::size_t calls;
+    /// Number of calls that were skipped, e.g. publishing calls.
+    std::size_t skipped;
+    /// Number of replayed calls that raised an exception.
+    std::size_t exceptions;
+    /// Number of elements for which the success callback was called.
+    std::size_t successes;
+    /// Number of elements for which the error callback was called.
+    std::size_t errors;
+    /// Total duration of the replayed calls when they were recorded.
+    std::chrono::nanoseconds recordedDuration;
+    /// Total duration of the replayed calls.
+    std::chrono::nanoseconds replayedDuration;
+  };
+
+  /// Reports keyed by method name, where `register_` is `register`.
+  using Report = std::map<Str, MethodReport>;
+
+  /**
+   * Construct a replayer for a Manager.
+   *
+   * @param manager Initialized Manager to replay calls to.
+   * @param rate Multiple of the recorded rate at which to issue calls,
+   * or zero to issue each call as soon as the previous completes.
+   * @param replayPublishing Whether to replay `preflight` and
+   * `register` calls, rather than skipping them.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If `manager` is null or
+   * `rate` is negative.
+   */
+  [[nodiscard]] static ManagerTrafficReplayerPtr make(ManagerPtr manager, double rate = 1.0,
+                                                      bool replayPublishing = false);
+
+  /**
+   * Replay a log of manager traffic.
+   *
+   * @param logPath Path of the log to replay.
+   * @return Report of the replayed calls, containing an entry for each
+   * method that appears in the log.
+   * @exception errors.InputValidationException If the log cannot be
+   * read, or is not a valid manager traffic log.
+   */
+  [[nodiscard]] Report replay(const Str& logPath) const;
+
+ private:
+  ManagerTrafficReplayer(ManagerPtr manager, double rate, bool replayPublishing);
+
+  ManagerPtr manager_;
+  double rate_;
+  bool replayPublishing_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
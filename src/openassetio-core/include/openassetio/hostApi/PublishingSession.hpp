@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a pipelined publishing workflow.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/hostApi/BatchResultStream.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(PublishingSession)
+
+/**
+ * Pipelines the @ref Manager.preflight "preflight", write and @ref
+ * Manager.register_ "register" steps of publishing many entities.
+ *
+ * Publishing is otherwise two full batch round-trips, with the host
+ * writing all of its data in between. For publishes of many small
+ * items, e.g. per-frame caches, this class instead allows the steps to
+ * overlap:
+ *
+ * - @ref preflight is issued to the manager in chunks, and the
+ *   working references are streamed to the host as each chunk
+ *   completes, so writing can begin before the whole batch is
+ *   preflighted.
+ * - Items are given to @ref register_ as soon as their data is
+ *   written. Once a chunk's worth of items are pending, they are
+ *   registered as one asynchronous batch, which the manager may commit
+ *   as a single transaction, whilst the host continues writing.
+ * - @ref finish registers any remaining items, waits for all
+ *   registrations to complete, and returns the final references.
+ *
+ * All operations use the publishing access mode and @ref Context
+ * given on construction.
+ *
+ * All member functions are thread-safe, so items may be registered
+ * from multiple writer threads.
+ */
+class OPENASSETIO_CORE_EXPORT PublishingSession final {
+ public:
+  OPENASSETIO_ALIAS_PTR(PublishingSession)
+
+  /// Result of registering a single entity.
+  using Element = BatchResultStream<EntityReference>::Element;
+
+  /// Default number of entities in each preflight and register batch.
+  static constexpr std::size_t kDefaultChunkSize = 256;
+
+  /**
+   * Construct a session publishing through the given manager.
+   *
+   * @param manager Manager to publish through.
+   * @param publishingAccess Access mode of the publish.
+   * @param context The calling context.
+   * @param chunkSize Number of entities in each preflight and register
+   * batch.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the manager or
+   * context is null or the chunk size is zero.
+   */
+  [[nodiscard]] static PublishingSessionPtr make(ManagerPtr manager,
+                                                 access::PublishingAccess publishingAccess,
+                                                 ContextConstPtr context,
+                                                 std::size_t chunkSize = kDefaultChunkSize);
+
+  /// Defaulted destructor. Pending registrations are not waited for.
+  ~PublishingSession();
+
+  /**
+   * Preflight entities in chunks, streaming the working references.
+   *
+   * Each chunk is preflighted once the previous chunk completes, and
+   * its results made available on the returned stream as they are
+   * produced. Indices are relative to the given batch.
+   *
+   * @param entityReferences Entity references to preflight.
+   * @param traitsHints Hints for each entity, as for @ref
+   * Manager.preflight.
+   * @param bufferSize Maximum number of results to buffer before
+   * blocking the manager.
+   * @return Stream of `(index, working reference or error)` pairs.
+   * @exception errors.InputValidationException If the batches differ
+   * in length.
+   */
+  [[nodiscard]] BatchResultStream<EntityReference> preflight(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+      std::size_t bufferSize = BatchResultStream<EntityReference>::kDefaultBufferSize);
+
+  /**
+   * Queue a written entity for registration.
+   *
+   * Once a chunk's worth of entities are queued, they are registered
+   * as one batch, asynchronously. This function does not block on the
+   * manager.
+   *
+   * @param index Host-defined index of the entity, e.g. its index in
+   * the preflighted batch, used to identify its result.
+   * @param workingReference Reference returned by @ref preflight.
+   * @param entityTraitsData Data to register.
+   */
+  void register_(std::size_t index, const EntityReference& workingReference,
+                 const trait::TraitsDataPtr& entityTraitsData);
+
+  /**
+   * Register any queued entities, and wait for all registrations to
+   * complete.
+   *
+   * The session may continue to be used afterwards.
+   *
+   * @return Final references or errors for each entity given to @ref
+   * register_ since the previous call, ordered by index.
+   * @exception std::exception If the manager failed a registration
+   * batch as a whole, the first such exception is rethrown, and the
+   * results of the remaining batches are discarded.
+   */
+  std::vector<Element> finish();
+
+ private:
+  PublishingSession(ManagerPtr manager, access::PublishingAccess publishingAccess,
+                    ContextConstPtr context, std::size_t chunkSize);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
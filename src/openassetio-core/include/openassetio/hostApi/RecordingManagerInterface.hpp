@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a manager plugin middleware layer that records host traffic.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ProxyManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(RecordingManagerInterface)
+
+/**
+ * A @ref managerApi.ProxyManagerInterface "ProxyManagerInterface" that
+ * records every batch call made to the proxied manager plugin to a
+ * compact binary log, for later replay by a @ref
+ * ManagerTrafficReplayer.
+ *
+ * This allows new versions of a manager plugin, or of OpenAssetIO
+ * itself, to be benchmarked against real traffic captured from a
+ * production host, rather than a synthetic load.
+ *
+ * For each call, the method, its arguments (entity references, trait
+ * sets, access modes, relationship and publishing data, and page
+ * sizes), the start time and duration of the call, whether it raised
+ * an exception, and the number of elements reported via its callbacks
+ * are recorded. Contexts are assigned an ID on first use, at which
+ * point their locale is recorded. Manager states are not recorded,
+ * since they are opaque to OpenAssetIO.
+ *
+ * Asynchronous calls are recorded as their synchronous counterpart,
+ * timed from the initial call until completion is signalled.
+ *
+ * Records are buffered, and only flushed to disk on @ref flush or when
+ * the layer is destroyed. Records are written as calls complete, so
+ * the log of concurrent calls is ordered by completion, not start.
+ *
+ * Records are serialised under a lock, so this layer does not affect
+ * the thread-safety of the proxied manager, but calls made
+ * concurrently will contend.
+ */
+class OPENASSETIO_CORE_EXPORT RecordingManagerInterface final
+    : public managerApi::ProxyManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RecordingManagerInterface)
+
+  /**
+   * Construct a recording layer around a manager plugin.
+   *
+   * @param proxied Manager plugin to record calls to.
+   * @param logPath Path of the log file to write. Any existing file is
+   * overwritten.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If `proxied` is null,
+   * or the file cannot be opened for writing.
+   */
+  [[nodiscard]] static RecordingManagerInterfacePtr make(managerApi::ManagerInterfacePtr proxied,
+                                                         const Str& logPath);
+
+  /// Flush any buffered records to disk.
+  void flush();
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                                  access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const managerApi::HostSessionPtr& hostSession,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void entityExistsAsync(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         ExistsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void entityTraitsAsync(const EntityReferences& entityReferences,
+                         access::EntityTraitsAccess entityTraitsAccess,
+                         const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         EntityTraitsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                    access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    ResolveSuccessCallback successCallback,
+                    BatchElementErrorCallback errorCallback,
+                    CompletionCallback completionCallback) override;
+  void preflightAsync(const EntityReferences& entityReferences,
+                      const trait::TraitsDatas& traitsHints,
+                      access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                      const managerApi::HostSessionPtr& hostSession,
+                      PreflightSuccessCallback successCallback,
+                      BatchElementErrorCallback errorCallback,
+                      CompletionCallback completionCallback) override;
+  void registerAsync(const EntityReferences& entityReferences,
+                     const trait::TraitsDatas& entityTraitsDatas,
+                     access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                     const managerApi::HostSessionPtr& hostSession,
+                     RegisterSuccessCallback successCallback,
+                     BatchElementErrorCallback errorCallback,
+                     CompletionCallback completionCallback) override;
+
+ private:
+  class Log;
+  struct Call;
+
+  RecordingManagerInterface(managerApi::ManagerInterfacePtr proxied, std::shared_ptr<Log> log);
+
+  /// Invoke `func` with the success and error callbacks wrapped to
+  /// count elements, recording the call on return or exception.
+  template <class SuccessCallback, class Func>
+  void recorded(std::shared_ptr<Call> call, const SuccessCallback& successCallback,
+                const BatchElementErrorCallback& errorCallback, const Func& func);
+
+  /// Invoke `func` with the success, error and completion callbacks
+  /// wrapped to count elements and record the call on completion.
+  template <class SuccessCallback, class Func>
+  void recordedAsync(std::shared_ptr<Call> call, SuccessCallback successCallback,
+                     BatchElementErrorCallback errorCallback,
+                     CompletionCallback completionCallback, const Func& func);
+
+  /// Shared with in-flight asynchronous calls.
+  std::shared_ptr<Log> log_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide the host side of an out-of-process manager.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(RemoteManagerInterface)
+
+class SharedMemoryChannel;
+
+/**
+ * A @ref managerApi.ManagerInterface "ManagerInterface" that forwards
+ * calls to manager plugins running in other processes, each served by
+ * a @ref RemoteManagerServer.
+ *
+ * This isolates the host from crashes in the plugin, and allows a
+ * plugin that cannot run calls concurrently, e.g. due to the Python
+ * GIL, to be scaled across several worker processes.
+ *
+ * Each channel connects to one server, and carries one call at a time.
+ * Concurrent calls are spread across idle channels, so the manager is
+ * reported as thread-safe. All servers are assumed to host the same
+ * manager. @ref initialize and the cache flushing methods are sent to
+ * every server.
+ *
+ * If a channel fails, e.g. because its worker crashed, it is dropped,
+ * and the call raises an @ref errors.OpenAssetIOException
+ * "OpenAssetIOException". Calls continue on any remaining channels.
+ * Exceptions raised by a remote plugin are raised as an
+ * `OpenAssetIOException` with the same message.
+ *
+ * Stateful contexts and relationship queries are not supported, and
+ * are not reported as capabilities.
+ */
+class OPENASSETIO_CORE_EXPORT RemoteManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RemoteManagerInterface)
+
+  /**
+   * Connect to one or more servers and query their manager.
+   *
+   * @param channelNames Names of the servers' channels.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If no channels are
+   * given, or a channel cannot be connected to.
+   * @exception errors.OpenAssetIOException If a server fails to
+   * describe its manager.
+   */
+  [[nodiscard]] static RemoteManagerInterfacePtr make(const std::vector<Str>& channelNames);
+
+  /// Disconnects from all servers.
+  ~RemoteManagerInterface() override;
+
+  RemoteManagerInterface(const RemoteManagerInterface&) = delete;
+  RemoteManagerInterface(RemoteManagerInterface&&) noexcept = delete;
+  RemoteManagerInterface& operator=(const RemoteManagerInterface&) = delete;
+  RemoteManagerInterface& operator=(RemoteManagerInterface&&) noexcept = delete;
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override;
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+  void flushEntityCaches(const EntityReferences& entityReferences,
+                         const managerApi::HostSessionPtr& hostSession) override;
+  void flushCachesWithPrefix(const Str& prefix,
+                             const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& traitsHints, access::PublishingAccess publishingAccess,
+                 const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+ private:
+  using ChannelPtr = std::unique_ptr<SharedMemoryChannel>;
+  using Bytes = std::vector<std::byte>;
+
+  explicit RemoteManagerInterface(std::vector<ChannelPtr> channels);
+
+  /// Query the manager's identity and capabilities from a server.
+  void describe();
+
+  /**
+   * Send a request over an idle channel, blocking until one is free,
+   * and return the body of the response.
+   *
+   * @exception errors.OpenAssetIOException If the channel fails, or
+   * the remote plugin raised an exception.
+   */
+  Bytes call(const Bytes& request);
+
+  /// Send a request over every channel, once all are idle.
+  void broadcast(const Bytes& request);
+
+  /// Take an idle channel, blocking until one is free.
+  SharedMemoryChannel* acquire();
+
+  /// Return a channel to the pool, or drop it if it failed.
+  void release(SharedMemoryChannel* channel, bool isHealthy);
+
+  /// Exchange a request and response over a channel, then release it.
+  Bytes exchange(SharedMemoryChannel* channel, const Bytes& request);
+
+  Identifier identifier_;
+  Str displayName_;
+  InfoDictionary info_;
+  std::uint32_t capabilities_{0};
+
+  std::mutex mutex_;
+  std::condition_variable idleCondition_;
+  std::vector<ChannelPtr> channels_;
+  std::vector<SharedMemoryChannel*> idleChannels_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
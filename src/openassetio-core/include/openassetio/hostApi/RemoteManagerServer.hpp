@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide the worker side of an out-of-process manager.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(RemoteManagerServer)
+
+class SharedMemoryChannel;
+
+/**
+ * Serves requests from a @ref RemoteManagerInterface in another
+ * process, by forwarding them to a manager plugin in this one.
+ *
+ * Requests and results are exchanged over a named shared memory
+ * channel, with @ref trait.TraitsData "TraitsData" in their binary
+ * serialisation. The channel is created on construction, such that a
+ * client may connect to it before @ref serve is called.
+ *
+ * A server handles one request at a time, from a single client. Run
+ * several, each with its own channel, to serve requests in parallel,
+ * or to serve several host processes from one worker.
+ *
+ * Each request is given a new @ref Context with the locale sent by the
+ * client, and a new manager state if the plugin supports stateful
+ * contexts. Exceptions raised by the plugin are sent to the client.
+ *
+ * Only supported on POSIX platforms.
+ */
+class OPENASSETIO_CORE_EXPORT RemoteManagerServer final {
+ public:
+  OPENASSETIO_ALIAS_PTR(RemoteManagerServer)
+
+  /// Default size of the channel's buffer in each direction, in bytes.
+  static constexpr std::size_t kDefaultCapacity = std::size_t{1} << 20U;
+
+  /**
+   * Create a server and its channel.
+   *
+   * @param managerInterface Manager plugin to serve.
+   * @param hostSession Host session given to the plugin.
+   * @param channelName Name of the channel, used by clients to
+   * connect. Should be short, and contain no slashes.
+   * @param capacity Size of the channel's buffer in each direction,
+   * in bytes. Larger messages are streamed through it.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the channel cannot
+   * be created, e.g. the name is already in use.
+   * @exception errors.NotImplementedException If the platform is not
+   * supported.
+   */
+  [[nodiscard]] static RemoteManagerServerPtr make(
+      managerApi::ManagerInterfacePtr managerInterface, managerApi::HostSessionPtr hostSession,
+      const Str& channelName, std::size_t capacity = kDefaultCapacity);
+
+  /// Closes and removes the channel.
+  ~RemoteManagerServer();
+
+  RemoteManagerServer(const RemoteManagerServer&) = delete;
+  RemoteManagerServer(RemoteManagerServer&&) noexcept = delete;
+  RemoteManagerServer& operator=(const RemoteManagerServer&) = delete;
+  RemoteManagerServer& operator=(RemoteManagerServer&&) noexcept = delete;
+
+  /**
+   * Serve requests until the channel is closed, either by @ref stop,
+   * by the client, or by the client's process exiting.
+   */
+  void serve();
+
+  /// Close the channel, such that @ref serve returns. Thread-safe.
+  void stop();
+
+ private:
+  RemoteManagerServer(managerApi::ManagerInterfacePtr managerInterface,
+                      managerApi::HostSessionPtr hostSession,
+                      std::unique_ptr<SharedMemoryChannel> channel);
+
+  managerApi::ManagerInterfacePtr managerInterface_;
+  managerApi::HostSessionPtr hostSession_;
+  std::unique_ptr<SharedMemoryChannel> channel_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
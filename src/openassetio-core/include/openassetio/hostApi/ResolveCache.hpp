@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a bounded, thread-safe cache of resolve results.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(Context)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(ResolveCache)
+
+/**
+ * A read-through cache of @ref Manager.resolve results.
+ *
+ * When supplied to @ref Manager.make, successful resolve results are
+ * retained, such that subsequent resolves of the same entity can be
+ * serviced without calling into the @ref manager plugin. This is
+ * particularly beneficial for plugins implemented in Python, where
+ * each call must acquire the GIL.
+ *
+ * Results are keyed on the entity reference, requested trait set,
+ * access mode and @ref Context (specifically, the contents of its
+ * locale and the identity of its manager state). Errors are never
+ * cached.
+ *
+ * The cache is bounded: once full, the least recently used entries
+ * are evicted. Entries are partitioned into a number of independently
+ * locked shards, to reduce contention when resolving from multiple
+ * threads. Note that the capacity is divided evenly between shards,
+ * so eviction may occur before the total capacity is reached.
+ *
+ * Optionally, a second tier can be shared by all processes on the same
+ * host, e.g. concurrent render processes on a farm node resolving the
+ * same references, such that a result resolved by one process serves
+ * the others. See @ref SharedTier.
+ *
+ * The cache is cleared by @ref Manager.flushCaches. Since the cache
+ * cannot know when data changes in the backend, hosts should call
+ * `flushCaches` whenever stale data is unacceptable, e.g. after
+ * publishing, unless the manager notifies of changes to specific
+ * entities, via @ref managerApi.HostSession.notifyEntitiesChanged
+ * "HostSession.notifyEntitiesChanged", in which case only their
+ * entries are discarded. See @ref invalidate.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT ResolveCache final {
+ public:
+  OPENASSETIO_ALIAS_PTR(ResolveCache)
+
+  /// Default number of independently locked shards.
+  static constexpr std::size_t kDefaultShardCount = 16;
+
+  /// Cache usage statistics.
+  struct Statistics {
+    /// Number of lookups that found a cached entry.
+    std::size_t hits;
+    /// Number of lookups that did not find a cached entry.
+    std::size_t misses;
+    /// Number of entries evicted to make room for new entries.
+    std::size_t evictions;
+    /// Number of hits found in the shared tier, included in `hits`.
+    std::size_t sharedHits;
+  };
+
+  /// Default maximum size of an entry in the shared tier, in bytes.
+  static constexpr std::size_t kDefaultSharedSlotSize = 1024;
+
+  /**
+   * Configuration of a cache tier shared between processes, held in a
+   * named shared memory segment. Only supported on POSIX platforms.
+   *
+   * Lookups that miss the process-local tier consult the shared tier,
+   * and results are written to both. The shared tier is a fixed-size,
+   * lock-free hash table, where new entries overwrite old ones once
+   * full.
+   *
+   * Results are keyed on the contents of the entity reference, trait
+   * set, access mode and locale, so only resolves whose @ref Context
+   * has no manager state are shared, since manager state is only
+   * meaningful within a process. They are also keyed on the identity
+   * of the manager (see @ref setManagerIdentity), so processes using
+   * different managers, or settings, do not share results. Results
+   * larger than `slotSize` are only cached locally.
+   *
+   * Clearing the cache, e.g. via @ref Manager.flushCaches, clears the
+   * shared tier for all processes, and all managers. Likewise, the
+   * validity token (see @ref setValidityToken) is shared by all
+   * managers using the tier.
+   *
+   * The segment outlives the processes using it, until removed from
+   * the system, e.g. on reboot. Processes sharing the tier must be in
+   * the same PID namespace, since a process recognises abandoned
+   * writes by the exit of the process that made them.
+   *
+   * If a `path` is given, the tier is instead held in a memory-mapped
+   * file, which persists across reboots, such that new processes
+   * start with a warm cache. Since entries may then be arbitrarily
+   * old, a `timeToLive` and/or a manager-supplied validity token (see
+   * @ref setValidityToken) should be used to discard stale entries.
+   * A new file is readable and writable by its owner only. Since any
+   * process that can write to the file provides results trusted by
+   * every other, sharing it between users is an explicit opt-in, by
+   * creating the file, or changing its permissions, beforehand.
+   */
+  struct SharedTier {
+    /// Name of the shared memory segment. Should be short, and contain
+    /// no slashes. Ignored if `path` is set.
+    Str name;
+    /// Maximum number of entries.
+    std::size_t slotCount;
+    /// Maximum size of an encoded entry, in bytes.
+    std::size_t slotSize = kDefaultSharedSlotSize;
+    /// Path of a file holding the tier, if non-empty.
+    Str path;
+    /// Age after which entries are ignored, or zero if they never
+    /// expire.
+    std::chrono::seconds timeToLive{0};
+
+    /**
+     * Compare all fields in this instance and another for by-value
+     * equality.
+     */
+    bool operator==(const SharedTier& other) const {
+      return name == other.name && slotCount == other.slotCount &&
+             slotSize == other.slotSize && path == other.path &&
+             timeToLive == other.timeToLive;
+    }
+  };
+
+  /**
+   * Construct a new, empty cache.
+   *
+   * @param capacity Maximum number of entries to retain.
+   * @param shardCount Number of independently locked shards.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If either argument is
+   * zero.
+   */
+  [[nodiscard]] static ResolveCachePtr make(std::size_t capacity,
+                                            std::size_t shardCount = kDefaultShardCount);
+
+  /**
+   * Construct a new cache, with a tier shared with other processes.
+   *
+   * @param capacity Maximum number of entries to retain in this
+   * process.
+   * @param sharedTier Configuration of the shared tier. Other
+   * processes using the same name share its entries.
+   * @param shardCount Number of independently locked shards.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If any size is zero,
+   * or the shared tier cannot be opened, e.g. it exists with a
+   * different slot count or size.
+   * @exception errors.NotImplementedException If shared memory or, for
+   * a file-backed tier, memory-mapped files are not supported on this
+   * platform.
+   */
+  [[nodiscard]] static ResolveCachePtr make(std::size_t capacity, const SharedTier& sharedTier,
+                                            std::size_t shardCount = kDefaultShardCount);
+
+  /// Defaulted destructor.
+  ~ResolveCache();
+
+  /// @return Maximum number of entries to retain.
+  [[nodiscard]] std::size_t capacity() const;
+
+  /// @return Number of entries currently retained.
+  [[nodiscard]] std::size_t size() const;
+
+  /// @return Usage statistics since construction.
+  [[nodiscard]] Statistics statistics() const;
+
+  /**
+   * Estimate the memory used by this cache, in bytes.
+   *
+   * This includes the cached keys and results, and container
+   * overheads, but not the shared tier. Cached results share storage with the copies returned
+   * by @ref lookup until either is modified, in which case the shared
+   * storage is included in full.
+   *
+   * @return Approximate number of bytes used.
+   */
+  [[nodiscard]] std::size_t memoryUsage() const;
+
+  /**
+   * Discard all entries, including those of the shared tier, if any.
+   */
+  void clear();
+
+  /**
+   * Set the identity of the manager whose results are cached.
+   *
+   * Called by @ref Manager.initialize. Entries of the shared tier are
+   * only shared with caches given the same identity. If the identity
+   * differs from that previously given, the entries of this process
+   * are discarded.
+   *
+   * @param identifier Identifier of the manager.
+   * @param settings Settings the manager was initialized with.
+   */
+  void setManagerIdentity(const Identifier& identifier, const InfoDictionary& settings);
+
+  /**
+   * Discard all entries, as for @ref clear, if the token differs from
+   * that previously given, by this or any other process sharing the
+   * shared tier.
+   *
+   * Called by @ref Manager.initialize with the manager's @ref
+   * constants.kInfoKey_ResolveCacheToken "resolve cache token", if
+   * any. Without a shared tier, the first token given has no effect.
+   *
+   * @param token Opaque token identifying the state of the manager's
+   * data.
+   */
+  void setValidityToken(std::string_view token);
+
+  /**
+   * Discard the entries for the given entities, including those of
+   * the shared tier, if any.
+   *
+   * Called by @ref Manager "Managers" given this cache when their
+   * manager notifies that entities have changed, via @ref
+   * managerApi.HostSession.notifyEntitiesChanged
+   * "HostSession.notifyEntitiesChanged", so that unaffected entries
+   * remain cached.
+   *
+   * This visits every entry, so for large numbers of changes, prefer
+   * a single call with all of the changed entities.
+   *
+   * @param entityReferences Changed entities.
+   * @param traitSet Traits whose data changed. Only entries resolving
+   * at least one of these traits are discarded. If empty, all entries
+   * for the entities are discarded.
+   */
+  void invalidate(const EntityReferences& entityReferences, const trait::TraitSet& traitSet = {});
+
+  /**
+   * Discard the entries for all entities whose reference begins with
+   * the given prefix, including those of the shared tier, if any.
+   *
+   * Called by @ref Manager.flushCachesWithPrefix, e.g. to invalidate
+   * a subtree of entities following a publish.
+   *
+   * @param prefix Prefix of the entity references to discard. If
+   * empty, all entries are discarded.
+   */
+  void invalidatePrefix(std::string_view prefix);
+
+  /**
+   * Retrieve a cached resolve result.
+   *
+   * @param entityReference Resolved entity.
+   * @param traitSet Resolved traits.
+   * @param resolveAccess Access mode of resolve.
+   * @param context Context of resolve.
+   * @return A new TraitsData holding a copy of the cached result, or
+   * `nullptr` if no matching entry is cached.
+   */
+  [[nodiscard]] trait::TraitsDataPtr lookup(const EntityReference& entityReference,
+                                            const trait::TraitSet& traitSet,
+                                            access::ResolveAccess resolveAccess,
+                                            const ContextConstPtr& context);
+
+  /**
+   * Cache a resolve result, replacing any existing entry.
+   *
+   * A copy of the data is retained, so subsequent modification of the
+   * given instance does not affect the cache.
+   *
+   * @param entityReference Resolved entity.
+   * @param traitSet Resolved traits.
+   * @param resolveAccess Access mode of resolve.
+   * @param context Context of resolve.
+   * @param traitsData Result of resolve.
+   */
+  void insert(const EntityReference& entityReference, const trait::TraitSet& traitSet,
+              access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+              const trait::TraitsDataConstPtr& traitsData);
+
+ private:
+  ResolveCache(std::size_t capacity, std::size_t shardCount, const SharedTier* sharedTier);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
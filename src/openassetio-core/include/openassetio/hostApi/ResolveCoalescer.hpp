@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide coalescing of concurrent singular resolve requests.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <variant>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(ResolveCoalescer)
+
+/**
+ * Front-end to a @ref Manager that coalesces concurrent singular
+ * resolve requests into batches.
+ *
+ * Many @ref manager "managers" are far cheaper per-entity when
+ * resolving in batches, but hosts often resolve one entity at a time
+ * from many threads. This class collects singular requests made
+ * within a short time window into a single batch @ref Manager.resolve
+ * call, then distributes the results to the waiting callers.
+ *
+ * Requests are only coalesced if they share the same trait set and
+ * access mode, and equivalent @ref Context "Contexts" (i.e. equal
+ * locales and the same manager state).
+ *
+ * The first request of a batch waits for up to the configured window
+ * for further requests to arrive, or until the batch is full, before
+ * making the batch call on its own thread. Other requests in the batch
+ * block until their result is available. There is no background
+ * thread. Note that this means coalescing adds up to one window of
+ * latency to each request.
+ *
+ * If the manager fails the whole batch by throwing an exception, then
+ * that exception is rethrown to every caller in the batch.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT ResolveCoalescer final {
+ public:
+  OPENASSETIO_ALIAS_PTR(ResolveCoalescer)
+
+  /// Default time to wait for a batch to fill.
+  static constexpr std::chrono::microseconds kDefaultWindow{500};
+
+  /// Default maximum number of entities in a batch.
+  static constexpr std::size_t kDefaultMaxBatchSize = 256;
+
+  /**
+   * Construct a coalescer wrapping the given manager.
+   *
+   * @param manager Manager to resolve through.
+   * @param window Maximum time to wait for a batch to fill.
+   * @param maxBatchSize Maximum number of entities in a batch.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the manager is
+   * null or the maximum batch size is zero.
+   */
+  [[nodiscard]] static ResolveCoalescerPtr make(ManagerPtr manager,
+                                                std::chrono::microseconds window = kDefaultWindow,
+                                                std::size_t maxBatchSize = kDefaultMaxBatchSize);
+
+  /// Defaulted destructor.
+  ~ResolveCoalescer();
+
+  /**
+   * Resolve a single entity, coalescing with concurrent requests.
+   *
+   * @param entityReference Entity to resolve.
+   * @param traitSet Traits to resolve.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param errorPolicyTag See @ref Manager.BatchElementErrorPolicyTag.
+   * @return Resolved data.
+   * @exception errors.BatchElementException If the entity failed to
+   * resolve.
+   *
+   * @see @ref Manager.resolve
+   */
+  trait::TraitsDataPtr resolve(
+      const EntityReference& entityReference, const trait::TraitSet& traitSet,
+      access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+      const Manager::BatchElementErrorPolicyTag::Exception& errorPolicyTag = {});
+
+  /**
+   * Resolve a single entity, coalescing with concurrent requests.
+   *
+   * @param entityReference Entity to resolve.
+   * @param traitSet Traits to resolve.
+   * @param resolveAccess The intended usage of the data.
+   * @param context The calling context.
+   * @param errorPolicyTag See @ref Manager.BatchElementErrorPolicyTag.
+   * @return Resolved data, or the error that prevented resolution.
+   *
+   * @see @ref Manager.resolve
+   */
+  std::variant<errors::BatchElementError, trait::TraitsDataPtr> resolve(
+      const EntityReference& entityReference, const trait::TraitSet& traitSet,
+      access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+      const Manager::BatchElementErrorPolicyTag::Variant& errorPolicyTag);
+
+ private:
+  ResolveCoalescer(ManagerPtr manager, std::chrono::microseconds window,
+                   std::size_t maxBatchSize);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a manager plugin middleware layer that retries failed
+ * queries.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ProxyManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(RetryingManagerInterface)
+
+/**
+ * A @ref managerApi.ProxyManagerInterface "ProxyManagerInterface" that
+ * retries read-only batch queries that fail with an exception, e.g.
+ * due to an intermittent network error in the manager's backend.
+ *
+ * Only queries without side effects are retried, i.e.
+ * `managementPolicy`, `entityExists`, `entityTraits`, `resolve`,
+ * `defaultEntityReference` and the relationship queries. An attempt
+ * is only retried if
+ * - no result has yet been reported for any element of the batch,
+ *   since the host could otherwise receive duplicate results.
+ * - the exception is not an @ref errors.InputValidationException
+ *   "InputValidationException" or @ref errors.NotImplementedException
+ *   "NotImplementedException", since retrying will not help.
+ * - the @ref Context's @ref CancellationToken, if any, has not been
+ *   cancelled.
+ *
+ * Once the maximum number of attempts is reached, the last exception
+ * is propagated to the caller.
+ *
+ * Asynchronous variants of retried queries use the default @ref
+ * managerApi.ManagerInterface "ManagerInterface" implementation, i.e.
+ * the retrying synchronous method is run on a background thread.
+ */
+class OPENASSETIO_CORE_EXPORT RetryingManagerInterface final
+    : public managerApi::ProxyManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RetryingManagerInterface)
+
+  /// Default maximum number of attempts of each query.
+  static constexpr std::size_t kDefaultMaxAttempts = 3;
+
+  /**
+   * Construct a retrying layer around a manager plugin.
+   *
+   * @param proxied Manager plugin to forward to.
+   * @param maxAttempts Maximum number of attempts of each query,
+   * including the first.
+   * @param retryDelay Time to wait between attempts.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If `proxied` is null
+   * or `maxAttempts` is zero.
+   */
+  [[nodiscard]] static RetryingManagerInterfacePtr make(
+      managerApi::ManagerInterfacePtr proxied, std::size_t maxAttempts = kDefaultMaxAttempts,
+      std::chrono::milliseconds retryDelay = std::chrono::milliseconds{0});
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                                  access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const managerApi::HostSessionPtr& hostSession,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback) override;
+  void traverseRelationships(const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& relationshipTraitsDatas,
+                             const trait::TraitSet& resultTraitSet, std::size_t maxDepth,
+                             access::RelationsAccess relationsAccess,
+                             const ContextConstPtr& context,
+                             const managerApi::HostSessionPtr& hostSession,
+                             const RelationshipTraversalSuccessCallback& successCallback,
+                             const BatchElementErrorCallback& errorCallback) override;
+  void entityExistsAsync(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         ExistsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void entityTraitsAsync(const EntityReferences& entityReferences,
+                         access::EntityTraitsAccess entityTraitsAccess,
+                         const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         EntityTraitsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                    access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    ResolveSuccessCallback successCallback,
+                    BatchElementErrorCallback errorCallback,
+                    CompletionCallback completionCallback) override;
+
+ private:
+  RetryingManagerInterface(managerApi::ManagerInterfacePtr proxied, std::size_t maxAttempts,
+                           std::chrono::milliseconds retryDelay);
+
+  /**
+   * Invoke `func` until it succeeds or should not be retried.
+   *
+   * `func` is given a flag that must be set once a result has been
+   * reported to the caller.
+   */
+  template <class Func>
+  decltype(auto) retry(const char* methodName, const ContextConstPtr& context,
+                       const managerApi::HostSessionPtr& hostSession, const Func& func) const;
+
+  const std::size_t maxAttempts_;
+  const std::chrono::milliseconds retryDelay_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a manager plugin that routes entity references to one of
+ * several child manager plugins.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(RoutingManagerInterface)
+
+class EntityReferenceMatcher;
+
+/**
+ * A @ref managerApi.ManagerInterface "ManagerInterface" that presents
+ * several child manager plugins as one, routing each entity reference
+ * to the child that recognises it.
+ *
+ * This allows a host to hold a single @ref Manager for, e.g., several
+ * asset management systems split by show, rather than splitting
+ * batches between managers by hand.
+ *
+ * On @ref initialize, each child is initialized with the same
+ * settings, then its @ref managerApi.ManagerInterface.info "info"
+ * dictionary is queried for the
+ * @ref constants.kInfoKey_EntityReferencesMatchPrefix "prefix",
+ * @ref constants.kInfoKey_EntityReferencesMatchPrefixes "prefixes"
+ * and/or @ref constants.kInfoKey_EntityReferencesMatchPattern
+ * "pattern" identifying its entity references. Every child must
+ * declare at least one of these. Where more than one child recognises
+ * a reference, the first given on construction is chosen.
+ *
+ * Batch queries keyed by entity reference are partitioned by child.
+ * The sub-batches are dispatched in parallel, via the host's
+ * scheduler (see @fqref{hostApi.HostInterface.parallelFor}
+ * "HostInterface.parallelFor"), and results are reported against the
+ * caller's original indices. Callbacks are never called concurrently.
+ * References that no child recognises are reported as a @ref
+ * errors.BatchElementError.ErrorCode.kInvalidEntityReference
+ * "kInvalidEntityReference" error. If a sub-batch fails with an
+ * exception, the exception is propagated to the caller once the other
+ * sub-batches are complete.
+ *
+ * Queries that are not keyed by entity reference, i.e.
+ * `managementPolicy` and `defaultEntityReference`, are forwarded to
+ * the first (primary) child. Cache flushes are forwarded to all
+ * children, with entity-specific flushes partitioned as above.
+ *
+ * Manager state is not supported, i.e. the
+ * @ref managerApi.ManagerInterface.Capability.kStatefulContexts
+ * "kStatefulContexts" and
+ * @ref managerApi.ManagerInterface.Capability.kCustomTerminology
+ * "kCustomTerminology" capabilities are not advertised. Any other
+ * capability is advertised if any child has it.
+ */
+class OPENASSETIO_CORE_EXPORT RoutingManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RoutingManagerInterface)
+
+  /**
+   * Construct a routing manager plugin.
+   *
+   * @param children Manager plugins to route to, in order of
+   * precedence. The first is the primary child.
+   * @param identifier Identifier of the routing manager.
+   * @param displayName Display name of the routing manager.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If there are no
+   * children, or any is null.
+   */
+  [[nodiscard]] static RoutingManagerInterfacePtr make(
+      std::vector<managerApi::ManagerInterfacePtr> children,
+      Identifier identifier = "org.openassetio.routing", Str displayName = "Routing Manager");
+
+  ~RoutingManagerInterface() override;
+
+  /// @return The child manager plugins, in order of precedence.
+  [[nodiscard]] const std::vector<managerApi::ManagerInterfacePtr>& children() const;
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+
+  /**
+   * Initialize all children, then configure routing from their
+   * @ref managerApi.ManagerInterface.info "info" dictionaries.
+   *
+   * @exception errors.ConfigurationException If a child does not
+   * declare how to recognise its entity references.
+   */
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+  void flushEntityCaches(const EntityReferences& entityReferences,
+                         const managerApi::HostSessionPtr& hostSession) override;
+  void flushCachesWithPrefix(const Str& prefix,
+                             const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+ private:
+  /// Entity references routed to a single child.
+  struct Partition;
+
+  RoutingManagerInterface(std::vector<managerApi::ManagerInterfacePtr> children,
+                          Identifier identifier, Str displayName);
+
+  /**
+   * @return Index of the child recognising the reference, or the
+   * number of children if none do.
+   */
+  [[nodiscard]] std::size_t route(const Str& entityReferenceString) const;
+
+  /**
+   * Partition entity references by child, reporting unrecognised
+   * references to `errorCallback`.
+   */
+  [[nodiscard]] std::vector<Partition> partition(
+      const EntityReferences& entityReferences,
+      const BatchElementErrorCallback& errorCallback) const;
+
+  /**
+   * Partition a batch by child and invoke `func` for each partition,
+   * in parallel, with success and error callbacks that map results
+   * back to the caller's indices.
+   */
+  template <class SuccessCallback, class Func>
+  void dispatch(const EntityReferences& entityReferences,
+                const managerApi::HostSessionPtr& hostSession,
+                const SuccessCallback& successCallback,
+                const BatchElementErrorCallback& errorCallback, const Func& func) const;
+
+  const std::vector<managerApi::ManagerInterfacePtr> children_;
+  const Identifier identifier_;
+  const Str displayName_;
+  std::vector<std::unique_ptr<EntityReferenceMatcher>> matchers_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a manager plugin middleware layer that times batch methods.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ProxyManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(TimingManagerInterface)
+
+/**
+ * A @ref managerApi.ProxyManagerInterface "ProxyManagerInterface" that
+ * records the number of calls to, and the wall-clock time spent in,
+ * each batch method of the proxied manager plugin.
+ *
+ * This allows hosts to attribute time spent in asset management to
+ * individual API methods, e.g. to determine whether a @ref
+ * ResolveCache is worthwhile, without instrumenting the plugin.
+ *
+ * Asynchronous methods are recorded separately from their synchronous
+ * counterparts, and are timed from the initial call until completion
+ * is signalled. Calls are recorded whether they succeed or fail.
+ *
+ * Timings are updated atomically, so this layer does not affect the
+ * thread-safety of the proxied manager.
+ */
+class OPENASSETIO_CORE_EXPORT TimingManagerInterface final
+    : public managerApi::ProxyManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(TimingManagerInterface)
+
+  /// Timings of a single method.
+  struct MethodStatistics {
+    /// Number of calls that have completed.
+    std::size_t calls;
+    /// Total wall-clock time spent in completed calls.
+    std::chrono::nanoseconds totalDuration;
+  };
+
+  /// Timings keyed by method name, where `register_` is `register`.
+  using Statistics = std::map<Str, MethodStatistics>;
+
+  /**
+   * Construct a timing layer around a manager plugin.
+   *
+   * @param proxied Manager plugin to time.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If `proxied` is null.
+   */
+  [[nodiscard]] static TimingManagerInterfacePtr make(managerApi::ManagerInterfacePtr proxied);
+
+  /**
+   * Get timings since construction or the last @ref resetStatistics.
+   *
+   * All timed methods are included, whether or not they have been
+   * called.
+   *
+   * @return Timings keyed by method name.
+   */
+  [[nodiscard]] Statistics statistics() const;
+
+  /// Discard all timings recorded so far.
+  void resetStatistics();
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                                  access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const managerApi::HostSessionPtr& hostSession,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback) override;
+  void traverseRelationships(const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& relationshipTraitsDatas,
+                             const trait::TraitSet& resultTraitSet, std::size_t maxDepth,
+                             access::RelationsAccess relationsAccess,
+                             const ContextConstPtr& context,
+                             const managerApi::HostSessionPtr& hostSession,
+                             const RelationshipTraversalSuccessCallback& successCallback,
+                             const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void entityExistsAsync(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         ExistsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void entityTraitsAsync(const EntityReferences& entityReferences,
+                         access::EntityTraitsAccess entityTraitsAccess,
+                         const ContextConstPtr& context,
+                         const managerApi::HostSessionPtr& hostSession,
+                         EntityTraitsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                    access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    ResolveSuccessCallback successCallback,
+                    BatchElementErrorCallback errorCallback,
+                    CompletionCallback completionCallback) override;
+  void preflightAsync(const EntityReferences& entityReferences,
+                      const trait::TraitsDatas& traitsHints,
+                      access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                      const managerApi::HostSessionPtr& hostSession,
+                      PreflightSuccessCallback successCallback,
+                      BatchElementErrorCallback errorCallback,
+                      CompletionCallback completionCallback) override;
+  void registerAsync(const EntityReferences& entityReferences,
+                     const trait::TraitsDatas& entityTraitsDatas,
+                     access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                     const managerApi::HostSessionPtr& hostSession,
+                     RegisterSuccessCallback successCallback,
+                     BatchElementErrorCallback errorCallback,
+                     CompletionCallback completionCallback) override;
+
+ private:
+  explicit TimingManagerInterface(managerApi::ManagerInterfacePtr proxied);
+
+  struct Counters;
+
+  /// Invoke `func`, recording its duration against `method`.
+  template <class Func>
+  decltype(auto) timed(std::size_t method, const Func& func);
+
+  /// Wrap a completion callback to record the duration of an
+  /// asynchronous call against `method`.
+  [[nodiscard]] CompletionCallback timedCompletion(std::size_t method,
+                                                   CompletionCallback completionCallback);
+
+  /// Shared with in-flight asynchronous calls.
+  std::shared_ptr<Counters> counters_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
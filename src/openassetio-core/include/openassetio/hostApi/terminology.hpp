@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide utilities for a @ref host that simplify the integration of a
+ * @ref manager "manager's" custom terminology into its user-facing
+ * components.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+OPENASSETIO_DECLARE_PTR(Manager)
+
+/**
+ * Terminology mapping, allowing managers to customize terminology used
+ * within the host application.
+ *
+ * This is a native equivalent of the Python @ref
+ * openassetio.hostApi.terminology module.
+ */
+namespace terminology {
+OPENASSETIO_DECLARE_PTR(Mapper)
+
+/**
+ * @name Terminology dict keys
+ * @{
+ */
+inline constexpr std::string_view kTerm_Asset = "asset";
+inline constexpr std::string_view kTerm_Assets = "assets";
+inline constexpr std::string_view kTerm_Manager = "manager";
+inline constexpr std::string_view kTerm_Publish = "publish";
+inline constexpr std::string_view kTerm_Publishing = "publishing";
+inline constexpr std::string_view kTerm_Published = "published";
+inline constexpr std::string_view kTerm_Shot = "shot";
+inline constexpr std::string_view kTerm_Shots = "shots";
+/**
+ * @}
+ */
+
+/**
+ * Default terminology for the API.
+ *
+ * Hosts may choose to add additional terminology keys when
+ * constructing a @ref Mapper, but there is no expectation that any
+ * given manager would customize keys other than these.
+ *
+ * @return Map of terms to their default values.
+ */
+OPENASSETIO_CORE_EXPORT StrMap defaultTerminology();
+
+/**
+ * A string containing terminology tokens, parsed ahead of time so that
+ * it can be cheaply rendered by any number of @ref Mapper "Mappers".
+ *
+ * Tokens are as per Python format convention, e.g. `"{publish} to
+ * {manager}..."`. Any braces that do not delimit a token are discarded.
+ *
+ * Hosts with many user-facing strings (e.g. large menus) should parse
+ * each string once, then render it via @ref Mapper.replaceTerms for
+ * each manager.
+ */
+class OPENASSETIO_CORE_EXPORT Template final {
+ public:
+  /**
+   * Parse a string containing terminology tokens.
+   *
+   * @param sourceStr String to parse.
+   */
+  explicit Template(std::string_view sourceStr);
+
+ private:
+  friend class Mapper;
+
+  /// Location of a token's key within text_.
+  struct Token {
+    std::size_t offset;
+    std::size_t length;
+  };
+
+  /// Source string with all braces removed.
+  Str text_;
+  std::vector<Token> tokens_;
+};
+
+/**
+ * Provides string substitution methods and lookups to determine the
+ * correct terminology for the supplied @ref manager.
+ *
+ * The manager is queried once, on construction, and the result is
+ * held for the lifetime of the Mapper. The @ref Manager additionally
+ * caches the result of @ref Manager.updateTerminology "updateTerminology",
+ * so constructing further Mappers with the same terminology during a
+ * session does not query the manager plugin again.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT Mapper final {
+ public:
+  OPENASSETIO_ALIAS_PTR(Mapper)
+
+  /**
+   * Construct a new Mapper using terminology overrides defined by the
+   * supplied Manager.
+   *
+   * If the manager has the @ref Manager.Capability.kCustomTerminology
+   * "kCustomTerminology" capability, it is given the chance to update
+   * the terms. The @ref kTerm_Manager term is then set to the
+   * manager's display name.
+   *
+   * @param manager Manager whose terminology should be applied.
+   * @param terminology Terms that will be substituted by this instance.
+   * Hosts may add to the @ref defaultTerminology to allow managers to
+   * customize additional host-specific terms.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the manager is null.
+   */
+  [[nodiscard]] static MapperPtr make(const ManagerPtr& manager,
+                                      StrMap terminology = defaultTerminology());
+
+  /**
+   * Substitute terminology tokens in the input string with the terms
+   * appropriate to the manager.
+   *
+   * As for the Python `Mapper`, if any token is not a known term, then
+   * no tokens are substituted. In either case, any braces are removed.
+   *
+   * @warning Escaping brace literals with `{{` is not supported.
+   *
+   * @param sourceStr String to substitute.
+   * @return The input string with terms substituted.
+   */
+  [[nodiscard]] Str replaceTerms(std::string_view sourceStr) const;
+
+  /**
+   * Substitute terminology tokens in a pre-parsed string.
+   *
+   * @param sourceTemplate Parsed string to substitute.
+   * @return The string with terms substituted.
+   *
+   * @see replaceTerms(std::string_view) const
+   */
+  [[nodiscard]] Str replaceTerms(const Template& sourceTemplate) const;
+
+  /**
+   * Substitute terminology tokens in each of a batch of strings.
+   *
+   * @param sourceStrs Strings to substitute.
+   * @return The input strings with terms substituted, in the same
+   * order.
+   *
+   * @see replaceTerms(std::string_view) const
+   */
+  [[nodiscard]] std::vector<Str> replaceTerms(const std::vector<Str>& sourceStrs) const;
+
+  /**
+   * Substitute terminology tokens in each of a batch of pre-parsed
+   * strings.
+   *
+   * @param sourceTemplates Parsed strings to substitute.
+   * @return The strings with terms substituted, in the same order.
+   *
+   * @see replaceTerms(std::string_view) const
+   */
+  [[nodiscard]] std::vector<Str> replaceTerms(const std::vector<Template>& sourceTemplates) const;
+
+  /**
+   * Get the term corresponding to the supplied key.
+   *
+   * @param key Key of term, e.g. @ref kTerm_Asset.
+   * @param defaultValue Value to return if the key is unknown.
+   * @return The term, or the supplied default if the key is unknown.
+   */
+  [[nodiscard]] Str term(std::string_view key, std::string_view defaultValue = {}) const;
+
+  /// @return All terms known to this instance.
+  [[nodiscard]] const StrMap& terminology() const { return terminology_; }
+
+ private:
+  explicit Mapper(StrMap terminology);
+
+  StrMap terminology_;
+};
+}  // namespace terminology
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
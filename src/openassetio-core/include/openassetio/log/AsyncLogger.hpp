@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide asynchronous delivery of log messages.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(AsyncLogger)
+
+/**
+ * A logger that queues messages for delivery to an upstream logger on
+ * a background thread.
+ *
+ * Logging threads push messages into a bounded lock-free queue, and so
+ * never wait on (or contend for) the upstream logger, e.g. a @ref
+ * ConsoleLogger writing to stderr. The upstream logger is only ever
+ * called from the background thread, so messages logged concurrently
+ * are not interleaved.
+ *
+ * If the queue is full, messages are either dropped or the logging
+ * thread blocks until there is space, depending on the configured
+ * @ref OverflowPolicy. The number of dropped messages is reported to
+ * the upstream logger as a warning once space is available.
+ *
+ * Messages queued when the logger is destroyed are delivered before
+ * destruction completes.
+ *
+ * @note The upstream logger's @ref isSeverityLogged is called on the
+ * logging threads, so must be thread-safe.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT AsyncLogger final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(AsyncLogger)
+
+  /// Behaviour when logging a message whilst the queue is full.
+  enum class OverflowPolicy {
+    /// Discard the message.
+    kDrop,
+    /// Wait for the background thread to make space for the message.
+    kBlock
+  };
+
+  /// Default maximum number of queued messages.
+  static constexpr std::size_t kDefaultCapacity = 8192;
+
+  /**
+   * Creates a new instance of the AsyncLogger.
+   *
+   * @param upstreamLogger A logger that will receive messages on the
+   * background thread.
+   * @param capacity Maximum number of queued messages. Rounded up to
+   * the next power of two.
+   * @param overflowPolicy Behaviour when the queue is full.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the upstream logger
+   * is null or the capacity is zero.
+   */
+  [[nodiscard]] static AsyncLoggerPtr make(LoggerInterfacePtr upstreamLogger,
+                                           std::size_t capacity = kDefaultCapacity,
+                                           OverflowPolicy overflowPolicy = OverflowPolicy::kDrop);
+
+  /// Delivers any queued messages, then stops the background thread.
+  ~AsyncLogger() override;
+
+  /**
+   * Returns the logger wrapped by this logger.
+   */
+  [[nodiscard]] LoggerInterfacePtr upstreamLogger() const;
+
+  /**
+   * Queues a message for delivery to the @ref upstreamLogger.
+   */
+  void log(Severity severity, const Str& message) override;
+
+  /**
+   * Queues a message and its fields for delivery to the @ref
+   * upstreamLogger.
+   */
+  void logStructured(Severity severity, const Str& message, const InfoDictionary& fields) override;
+
+  /**
+   * Returns whether messages of the given severity would be presented
+   * by the @ref upstreamLogger.
+   */
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
+  /**
+   * Blocks until all messages queued before the call have been
+   * delivered to the @ref upstreamLogger.
+   */
+  void flush();
+
+  /**
+   * Returns the total number of messages dropped because the queue
+   * was full.
+   */
+  [[nodiscard]] std::size_t droppedCount() const;
+
+ private:
+  AsyncLogger(LoggerInterfacePtr upstreamLogger, std::size_t capacity,
+              OverflowPolicy overflowPolicy);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(BufferedLogger)
+/**
+ * The BufferedLogger is a wrapper for a logger that, whilst a @ref
+ * Scope is active on the calling thread, collects messages in a
+ * thread-local buffer, relaying them to the upstream logger together
+ * when the scope ends.
+ *
+ * This is intended for messages logged once per element of a batch,
+ * e.g. from within `resolve` callbacks, where the per-message cost of
+ * the upstream logger (such as acquiring the Python GIL, or locking a
+ * console stream) would otherwise be paid many times over, interleaved
+ * with the work of the batch.
+ *
+ * The @ref hostApi.Manager "Manager" opens a scope around each of its
+ * batch API calls, so hosts need only wrap their logger in a
+ * BufferedLogger to benefit.
+ *
+ * Outside of a scope, or on threads other than the one that opened
+ * the scope, messages are relayed immediately.
+ *
+ * The upstream logger receives buffered messages on the thread that
+ * opened the scope, in the order they were logged.
+ */
+class OPENASSETIO_CORE_EXPORT BufferedLogger final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(BufferedLogger)
+
+  /// Default maximum number of messages buffered by a scope.
+  static constexpr std::size_t kDefaultMaxBufferedMessages = 1000;
+
+  /// A message held by a @ref Scope until it is relayed.
+  struct Message {
+    Severity severity;
+    Str message;
+    InfoDictionary fields;
+  };
+
+  /**
+   * A scope guard that buffers messages logged to a BufferedLogger on
+   * the current thread until the scope ends.
+   *
+   * If the logger is not a BufferedLogger, or the current thread
+   * already has an active scope for the logger, the scope has no
+   * effect, such that it is safe to open unconditionally and to nest.
+   *
+   * A scope must be destroyed on the thread that constructed it.
+   */
+  class OPENASSETIO_CORE_EXPORT Scope {
+   public:
+    /**
+     * Begins buffering messages logged to the given logger on the
+     * current thread.
+     *
+     * @param logger Logger to buffer messages for, if it is a
+     * BufferedLogger.
+     */
+    explicit Scope(const LoggerInterfacePtr& logger);
+
+    /// Relays any buffered messages to the upstream logger.
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) noexcept = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) noexcept = delete;
+
+    /**
+     * Relays any buffered messages to the upstream logger, without
+     * ending the scope.
+     */
+    void flush();
+
+   private:
+    friend class BufferedLogger;
+
+    /// Logger being buffered, or null if the scope has no effect.
+    BufferedLoggerPtr logger_;
+    /// Next outermost active scope on this thread.
+    Scope* outerScope_{nullptr};
+    std::vector<Message> messages_;
+  };
+
+  /**
+   * Creates a new instance of the BufferedLogger.
+   *
+   * @param upstreamLogger A logger that will receive the messages.
+   * @param maxBufferedMessages Maximum number of messages to buffer
+   * within a scope, after which buffered messages are relayed early.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the upstream logger
+   * is null or the maximum number of buffered messages is zero.
+   */
+  [[nodiscard]] static BufferedLoggerPtr make(
+      LoggerInterfacePtr upstreamLogger,
+      std::size_t maxBufferedMessages = kDefaultMaxBufferedMessages);
+
+  /**
+   * Returns the logger wrapped by this logger.
+   */
+  [[nodiscard]] LoggerInterfacePtr upstreamLogger() const;
+
+  /**
+   * Buffers the message if a @ref Scope is active on the current
+   * thread, otherwise relays it to the @ref upstreamLogger.
+   */
+  void log(Severity severity, const Str& message) override;
+
+  /**
+   * Buffers the message and fields if a @ref Scope is active on the
+   * current thread, otherwise relays them to the @ref upstreamLogger.
+   */
+  void logStructured(Severity severity, const Str& message, const InfoDictionary& fields) override;
+
+  /**
+   * Returns whether messages of the given severity would be presented
+   * by the @ref upstreamLogger.
+   */
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
+ private:
+  BufferedLogger(LoggerInterfacePtr upstreamLogger, std::size_t maxBufferedMessages);
+
+  /// Innermost scope for this logger on the current thread, if any.
+  Scope* activeScope() const;
+
+  void buffer(Scope& scope, Message message);
+
+  void relay(const Message& message);
+
+  LoggerInterfacePtr upstreamLogger_;
+  std::size_t maxBufferedMessages_;
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
 
+#include <chrono>
+#include <memory>
+
 #include <openassetio/export.h>
 #include <openassetio/log/LoggerInterface.hpp>
 
@@ -11,6 +14,19 @@ namespace log {
 OPENASSETIO_DECLARE_PTR(ConsoleLogger)
 /**
  * A logger that sends messages to the console (stderr).
+ *
+ * Each message is written to stderr with a single write, so messages
+ * logged concurrently, by any ConsoleLogger instance, are not
+ * interleaved.
+ *
+ * Optionally, messages can be buffered and written periodically, to
+ * reduce the number of writes when logging verbosely. Buffered
+ * messages are written immediately for messages of
+ * @ref Severity.kWarning "kWarning" severity or above, on @ref flush,
+ * once the flush interval has elapsed, or when the logger is
+ * destroyed.
+ *
+ * All member functions are thread-safe.
  */
 class OPENASSETIO_CORE_EXPORT ConsoleLogger final : public LoggerInterface {
  public:
@@ -21,17 +37,41 @@ class OPENASSETIO_CORE_EXPORT ConsoleLogger final : public LoggerInterface {
    *
    * @param shouldColorOutput When true, messages will be colored based on
    * their severity.
+   * @param flushInterval Maximum time that messages are buffered
+   * before being written. Zero disables buffering, i.e. each message is
+   * written immediately.
+   * @exception errors.InputValidationException If the flush interval
+   * is negative.
    */
-  [[nodiscard]] ConsoleLoggerPtr static make(bool shouldColorOutput = true);
+  [[nodiscard]] ConsoleLoggerPtr static make(
+      bool shouldColorOutput = true,
+      std::chrono::milliseconds flushInterval = std::chrono::milliseconds{0});
+
+  /// Writes any buffered messages.
+  ~ConsoleLogger() override;
+
+  ConsoleLogger(const ConsoleLogger&) = delete;
+  ConsoleLogger(ConsoleLogger&&) noexcept = delete;
+  ConsoleLogger& operator=(const ConsoleLogger&) = delete;
+  ConsoleLogger& operator=(ConsoleLogger&&) noexcept = delete;
 
   /**
    */
   void log(Severity severity, const Str& message) override;
 
+  /**
+   * Writes any buffered messages to stderr.
+   */
+  void flush();
+
  private:
-  explicit ConsoleLogger(bool shouldColorOutput);
+  ConsoleLogger(bool shouldColorOutput, std::chrono::milliseconds flushInterval);
 
   bool shouldColorOutput_;
+
+  /// Pending output and its flushing thread, if buffering.
+  class Buffer;
+  std::unique_ptr<Buffer> buffer_;
 };
 }  // namespace log
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <fstream>
+#include <mutex>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(JsonLinesLogger)
+/**
+ * A logger that appends messages to a file as JSON lines, i.e. one
+ * JSON object per line, for consumption by log processing tools.
+ *
+ * Each line has the form
+ *
+ * @code{.json}
+ * {"timestamp":1700000000123456,"severity":"debugApi","thread":42,
+ *  "message":"...","fields":{"method":"resolve","batchSize":100}}
+ * @endcode
+ *
+ * Where `timestamp` is the time the message was logged, in
+ * microseconds since the Unix epoch, `thread` is an opaque identifier
+ * of the logging thread, and `fields` holds any fields provided to
+ * @ref logStructured.
+ *
+ * Writes are buffered, and only flushed to disk for messages of
+ * @ref Severity.kWarning "kWarning" severity or above, on @ref flush,
+ * or when the logger is destroyed. This keeps high-volume
+ * @ref Severity.kDebugApi "kDebugApi" logging cheap.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT JsonLinesLogger final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(JsonLinesLogger)
+
+  /**
+   * Creates a new instance of the JsonLinesLogger.
+   *
+   * @param path Path of the file to append to. The file is created if
+   * it does not exist.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the file cannot be
+   * opened for writing.
+   */
+  [[nodiscard]] static JsonLinesLoggerPtr make(const Str& path);
+
+  /**
+   * Writes a line with no fields.
+   */
+  void log(Severity severity, const Str& message) override;
+
+  /**
+   * Writes a line, including the supplied fields.
+   */
+  void logStructured(Severity severity, const Str& message, const InfoDictionary& fields) override;
+
+  /**
+   * Flushes any buffered lines to disk.
+   */
+  void flush();
+
+ private:
+  explicit JsonLinesLogger(std::ofstream stream);
+
+  std::mutex mutex_;
+  std::ofstream stream_;
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
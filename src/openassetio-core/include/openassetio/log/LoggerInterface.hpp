@@ -2,6 +2,7 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #include <array>
 
+#include <openassetio/InfoDictionary.hpp>
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
 
@@ -57,6 +58,62 @@ class OPENASSETIO_CORE_EXPORT LoggerInterface {
    */
   virtual void log(Severity severity, const Str& message) = 0;
 
+  /**
+   * Logs a message to the user, along with machine-readable key/value
+   * fields describing the context of the message, e.g. the API method
+   * being called, a batch size or an elapsed time.
+   *
+   * Loggers that write to a structured sink, such as @ref
+   * JsonLinesLogger, should override this to retain the fields
+   * separately from the message.
+   *
+   * The default implementation appends the fields to the message, as
+   * `message [key=value, ...]` in key order, and calls @ref log, such
+   * that loggers implementing only @ref log still receive the fields.
+   *
+   * @param severity One of the severity constants defined in @ref
+   * Severity.
+   *
+   * @param message The message string to be logged.
+   *
+   * @param fields Key/value fields associated with the message.
+   */
+  virtual void logStructured(Severity severity, const Str& message, const InfoDictionary& fields);
+
+  /**
+   * Returns whether messages of the given severity would be presented
+   * to the user.
+   *
+   * This allows callers to avoid the cost of constructing messages
+   * that would otherwise be discarded, see @ref logLazily.
+   *
+   * The default implementation returns true for all severities.
+   * Loggers that filter messages should override this.
+   *
+   * @param severity One of the severity constants defined in @ref
+   * Severity.
+   */
+  [[nodiscard]] virtual bool isSeverityLogged(Severity severity) const;
+
+  /**
+   * Logs a message constructed on demand, only if messages of the
+   * given severity would be presented to the user.
+   *
+   * @param severity One of the severity constants defined in @ref
+   * Severity.
+   *
+   * @param messageFn Callable taking no arguments, returning the
+   * message to be logged.
+   *
+   * @see isSeverityLogged
+   */
+  template <class MessageFn>
+  void logLazily(const Severity severity, const MessageFn& messageFn) {
+    if (isSeverityLogged(severity)) {
+      log(severity, messageFn());
+    }
+  }
+
   /**
    * @name Conveniences
    * @{
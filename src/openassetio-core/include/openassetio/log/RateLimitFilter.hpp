@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(RateLimitFilter)
+/**
+ * The RateLimitFilter is a wrapper for a logger that caps the number
+ * of messages relayed within a time interval, per severity.
+ *
+ * This protects hosts against floods of messages, e.g. a manager
+ * warning about every element of a large batch, where the cost of
+ * logging can exceed the cost of the work being logged.
+ *
+ * Once the cap for a severity is reached, further messages of that
+ * severity are suppressed until the interval elapses, except that,
+ * optionally, one in every `sampleInterval` suppressed messages is
+ * still relayed, to give a flavour of what is being suppressed.
+ *
+ * The number of suppressed messages is reported to the upstream
+ * logger, with the same severity, when the next message of that
+ * severity is logged after the interval has elapsed, or when the
+ * filter is destroyed.
+ *
+ * Counting is lock-free, so the filter adds little overhead to
+ * concurrent logging. Counts at interval boundaries are approximate
+ * under contention.
+ */
+class OPENASSETIO_CORE_EXPORT RateLimitFilter final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RateLimitFilter)
+
+  /// Default maximum number of messages of each severity per interval.
+  static constexpr std::size_t kDefaultMaxMessagesPerInterval = 100;
+
+  /// Default duration of each interval.
+  static constexpr std::chrono::milliseconds kDefaultInterval{1000};
+
+  /**
+   * Creates a new instance of the RateLimitFilter.
+   *
+   * @param upstreamLogger A logger that will receive messages within
+   * the rate limit.
+   * @param maxMessagesPerInterval Maximum number of messages of each
+   * severity to relay within each interval.
+   * @param interval Duration of each interval.
+   * @param sampleInterval If non-zero, relay one in every
+   * `sampleInterval` messages that would otherwise be suppressed.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the upstream logger
+   * is null or the interval is not positive.
+   */
+  [[nodiscard]] static RateLimitFilterPtr make(
+      LoggerInterfacePtr upstreamLogger,
+      std::size_t maxMessagesPerInterval = kDefaultMaxMessagesPerInterval,
+      std::chrono::milliseconds interval = kDefaultInterval,
+      std::size_t sampleInterval = 0);
+
+  /// Reports any outstanding suppressed message counts.
+  ~RateLimitFilter() override;
+
+  RateLimitFilter(const RateLimitFilter&) = delete;
+  RateLimitFilter(RateLimitFilter&&) noexcept = delete;
+  RateLimitFilter& operator=(const RateLimitFilter&) = delete;
+  RateLimitFilter& operator=(RateLimitFilter&&) noexcept = delete;
+
+  /**
+   * Returns the logger wrapped by the filter.
+   */
+  [[nodiscard]] LoggerInterfacePtr upstreamLogger() const;
+
+  /**
+   * Relays the message to the @ref upstreamLogger, if within the rate
+   * limit for its severity.
+   */
+  void log(Severity severity, const Str& message) override;
+
+  /**
+   * Relays the message and fields to the @ref upstreamLogger, if
+   * within the rate limit for its severity.
+   */
+  void logStructured(Severity severity, const Str& message, const InfoDictionary& fields) override;
+
+  /**
+   * Returns whether messages of the given severity would be presented
+   * by the @ref upstreamLogger.
+   *
+   * Messages may still be suppressed by the rate limit.
+   */
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
+  /**
+   * Returns the total number of messages suppressed, across all
+   * severities, since the filter was created.
+   */
+  [[nodiscard]] std::size_t suppressedCount() const;
+
+ private:
+  RateLimitFilter(LoggerInterfacePtr upstreamLogger, std::size_t maxMessagesPerInterval,
+                  std::chrono::milliseconds interval, std::size_t sampleInterval);
+
+  /// Counters for messages of a single severity.
+  struct SeverityState {
+    std::atomic<std::int64_t> intervalStart{0};
+    std::atomic<std::size_t> count{0};
+    std::atomic<std::size_t> suppressed{0};
+  };
+
+  /// Whether a message of the given severity should be relayed.
+  bool shouldRelay(Severity severity);
+
+  void reportSuppressed(Severity severity, std::size_t suppressed);
+
+  LoggerInterfacePtr upstreamLogger_;
+  std::size_t maxMessagesPerInterval_;
+  std::chrono::milliseconds interval_;
+  std::size_t sampleInterval_;
+  std::array<SeverityState, kSeverityNames.size()> states_;
+  std::atomic<std::size_t> suppressedCount_{0};
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
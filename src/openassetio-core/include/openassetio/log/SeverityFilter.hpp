@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
 
+#include <atomic>
+#include <optional>
+
 #include <openassetio/export.h>
 #include <openassetio/log/LoggerInterface.hpp>
 
@@ -13,6 +16,11 @@ OPENASSETIO_DECLARE_PTR(SeverityFilter)
  * The SeverityFilter is a wrapper for a logger that drops messages
  * below a requested severity. More severe messages are relayed.
  *
+ * The filter severity can be changed whilst other threads are logging.
+ * A process-wide override can also be set, using @ref
+ * setGlobalSeverityOverride, to change the verbosity of all filters at
+ * runtime, e.g. to enable diagnostics in a long-running process.
+ *
  * @envvar **OPENASSETIO_LOGGING_SEVERITY** *[int]* If set, the default
  * displaySeverity for the filter is set to the value of the env var.
  */
@@ -58,20 +66,66 @@ class OPENASSETIO_CORE_EXPORT SeverityFilter final : public LoggerInterface {
    * Returns the minimum severity of message that will be passed on to the
    * @ref upstreamLogger.
    *
+   * This does not take into account any @ref
+   * setGlobalSeverityOverride "global override".
+   *
    * @see @fqref{log.LoggerInterface.Severity} "LoggerInterface.Severity"
    */
   [[nodiscard]] LoggerInterface::Severity getSeverity() const;
 
+  /**
+   * Sets a minimum severity to be used by all filters in the process,
+   * in place of their own severity.
+   *
+   * This is lock-free, and so is safe to call from a signal handler,
+   * allowing a host to change the verbosity of a running process.
+   *
+   * @param severity The minimum severity, or an empty optional to
+   * restore the severity of each filter.
+   */
+  static void setGlobalSeverityOverride(std::optional<LoggerInterface::Severity> severity);
+
+  /**
+   * Returns the minimum severity used by all filters in the process,
+   * if set.
+   */
+  [[nodiscard]] static std::optional<LoggerInterface::Severity> globalSeverityOverride();
+
+  /**
+   * Returns the minimum severity of message that will currently be
+   * passed on to the @ref upstreamLogger, i.e. the @ref
+   * setGlobalSeverityOverride "global override", if set, otherwise
+   * this filter's severity.
+   *
+   * Unlike @ref isSeverityLogged, this does not consult the upstream
+   * logger, and so is a cheap, lock-free check suitable for discarding
+   * messages before any work is done to log them.
+   */
+  [[nodiscard]] LoggerInterface::Severity effectiveSeverity() const;
+
   /**
    * @}
    */
 
   void log(Severity severity, const Str& message) override;
 
+  /**
+   * Relays the message and fields to the @ref upstreamLogger, if the
+   * severity is at or above the filter's severity.
+   */
+  void logStructured(Severity severity, const Str& message, const InfoDictionary& fields) override;
+
+  /**
+   * Returns whether messages of the given severity are at or above the
+   * filter's severity, and would be presented by the @ref
+   * upstreamLogger.
+   */
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
  private:
   explicit SeverityFilter(LoggerInterfacePtr upstreamLogger);
 
-  Severity minSeverity_ = Severity::kWarning;
+  std::atomic<Severity> minSeverity_{Severity::kWarning};
   LoggerInterfacePtr upstreamLogger_;
 };
 }  // namespace log
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+OPENASSETIO_DECLARE_PTR(EntityExistenceFilter)
+
+/**
+ * Approximate, compact snapshot of the set of entities that exist,
+ * i.e. a Bloom filter of entity reference strings.
+ *
+ * A @ref manager may provide a filter via
+ * @ref ManagerInterface.entityExistenceFilter
+ * "ManagerInterface.entityExistenceFilter", so that the
+ * @fqref{hostApi.Manager} "Manager" can answer
+ * @fqref{hostApi.Manager.entityExists} "entityExists" host-side for
+ * entities that definitely do not exist, without calling the manager.
+ *
+ * A filter may report that it @ref mayContain an entity that was
+ * never inserted (a false positive), at approximately the rate given
+ * on construction, but never the reverse.
+ *
+ * Entities should only be inserted whilst the filter is being built,
+ * before it is provided to the Manager. Thereafter, @ref mayContain
+ * may be called concurrently from any thread.
+ */
+class OPENASSETIO_CORE_EXPORT EntityExistenceFilter final {
+ public:
+  OPENASSETIO_ALIAS_PTR(EntityExistenceFilter)
+
+  /**
+   * Construct an empty filter, sized for the expected number of
+   * entities.
+   *
+   * @param expectedCount Number of entities that are expected to be
+   * inserted. Inserting more than this increases the false positive
+   * rate.
+   * @param falsePositiveRate Desired probability that @ref mayContain
+   * returns `true` for an entity that was not inserted. Must be
+   * between 0 and 1, exclusive.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the false positive
+   * rate is out of range.
+   */
+  [[nodiscard]] static EntityExistenceFilterPtr make(std::size_t expectedCount,
+                                                     double falsePositiveRate = 0.01);
+
+  /**
+   * Insert an entity.
+   *
+   * @param entityReferenceString String of a reference to an entity
+   * that exists.
+   */
+  void insert(std::string_view entityReferenceString);
+
+  /**
+   * Query whether an entity may exist.
+   *
+   * @param entityReferenceString String of a reference to query.
+   * @return `false` if the entity was definitely not inserted, `true`
+   * if it may have been.
+   */
+  [[nodiscard]] bool mayContain(std::string_view entityReferenceString) const;
+
+  /// @return Number of bits in the filter.
+  [[nodiscard]] std::size_t bitCount() const;
+
+  /// @return Number of bits set per entity.
+  [[nodiscard]] std::size_t hashCount() const;
+
+  /// @return Approximate number of bytes used by this filter.
+  [[nodiscard]] std::size_t memoryUsage() const;
+
+ private:
+  EntityExistenceFilter(std::size_t bitCount, std::size_t hashCount);
+
+  std::vector<std::uint64_t> words_;
+  std::size_t bitCount_;
+  std::size_t hashCount_;
+};
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
 #include <vector>
 
 #include <openassetio/export.h>
@@ -103,6 +107,21 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePagerInterface {
    */
   virtual Page get(const HostSessionPtr&) = 0;
 
+  /**
+   * Replace the contents of a caller-owned list with the current page
+   * of data.
+   *
+   * Equivalent to @ref get, but allows the host to reuse the list's
+   * storage from page to page. The default implementation assigns the
+   * result of @ref get. Managers able to populate the list directly
+   * are encouraged to override it.
+   *
+   * @param page List to populate with the current page's entity
+   * references.
+   * @param hostSession The API session.
+   */
+  virtual void getInto(Page& page, const HostSessionPtr& hostSession);
+
   /**
    * Advance the page.
    *
@@ -114,6 +133,45 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePagerInterface {
    */
   virtual void next(const HostSessionPtr&) = 0;
 
+  /**
+   * Return an estimate of the number of entity references remaining,
+   * from the current page onward.
+   *
+   * Before the page has been advanced, this is the size of the whole
+   * result set. Hosts may use it to, e.g., pre-size containers, so it
+   * should be cheap to compute. It is a hint only, and the number of
+   * entity references actually returned may differ.
+   *
+   * The default implementation returns an empty optional, signifying
+   * that the size is unknown.
+   *
+   * @param hostSession The API session.
+   * @return Estimated number of remaining entity references, if known.
+   */
+  virtual std::optional<std::size_t> sizeHint(const HostSessionPtr& hostSession);
+
+  /**
+   * Return all remaining entity references, from the current page
+   * onward, in a single list.
+   *
+   * Once drained, the pager should be left on the page following the
+   * last page whose entity references were (wholly or partially)
+   * returned. If `maxItems` truncated a page, the rest of that page
+   * is discarded.
+   *
+   * The default implementation traverses the pages one by one, via
+   * @ref get, @ref hasNext and @ref next, reserving space for any
+   * @ref sizeHint up front. Managers that can retrieve
+   * the full result set more efficiently (e.g. in a single query, into
+   * a single pre-sized list) are encouraged to override it.
+   *
+   * @param maxItems Maximum number of entity references to return.
+   * @param hostSession The API session.
+   * @return Entity references from the current page onward, up to
+   * `maxItems`.
+   */
+  virtual Page drainAll(std::size_t maxItems, const HostSessionPtr& hostSession);
+
   /**
    * Close the paging query.
    *
@@ -127,6 +185,75 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePagerInterface {
    * from this function is nonetheless discouraged.
    */
   virtual void close(const HostSessionPtr& hostSession);
+
+  /**
+   * @name Asynchronous Paging
+   *
+   * Non-blocking variants of @ref hasNext, @ref get and @ref next.
+   *
+   * The default implementations adapt the corresponding synchronous
+   * method by running it on a shared pool of worker threads. This
+   * means existing implementations support asynchronous usage without
+   * modification.
+   *
+   * Managers with natively asynchronous (e.g. network) backends are
+   * encouraged to override these methods, so that a page request in
+   * flight does not occupy a thread.
+   *
+   * Implementations must return promptly. Callbacks may be called on
+   * any thread. The success callback, if called, must be called
+   * before the completion callback. The completion callback must be
+   * called exactly once, with either a null pointer on success or the
+   * exception that failed the operation.
+   *
+   * The host will not start another operation on this pager until the
+   * completion callback has been called, and guarantees that this
+   * instance will outlive the operation.
+   *
+   * @{
+   */
+
+  /**
+   * Callback signature used to signal completion of an asynchronous
+   * paging operation.
+   *
+   * Receives a null pointer if the operation succeeded, or the
+   * exception that failed it otherwise.
+   */
+  using CompletionCallback = std::function<void(std::exception_ptr)>;
+
+  /// Callback signature used for a successful @ref hasNextAsync.
+  using HasNextSuccessCallback = std::function<void(bool)>;
+
+  /// Callback signature used for a successful @ref getAsync.
+  using GetSuccessCallback = std::function<void(Page)>;
+
+  /**
+   * Asynchronous variant of @ref hasNext.
+   *
+   * @see @ref hasNext
+   */
+  virtual void hasNextAsync(const HostSessionPtr& hostSession,
+                            HasNextSuccessCallback successCallback,
+                            CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous variant of @ref get.
+   *
+   * @see @ref get
+   */
+  virtual void getAsync(const HostSessionPtr& hostSession, GetSuccessCallback successCallback,
+                        CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous variant of @ref next.
+   *
+   * @see @ref next
+   */
+  virtual void nextAsync(const HostSessionPtr& hostSession,
+                         CompletionCallback completionCallback);
+
+  /// @}
 };
 static_assert(!std::is_copy_constructible_v<EntityReferencePagerInterface>);
 static_assert(!std::is_copy_assignable_v<EntityReferencePagerInterface>);
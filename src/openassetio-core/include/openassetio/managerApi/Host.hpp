@@ -2,7 +2,11 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 #include <openassetio/export.h>
 #include <openassetio/InfoDictionary.hpp>
@@ -32,6 +36,16 @@ OPENASSETIO_DECLARE_PTR(Host)
  * current host through the @fqref{managerApi.HostSession.host}
  * "HostSession.host" method
  *
+ * The host's @ref identifier, @ref displayName and @ref info are
+ * queried from the host once, on first use, and subsequently served
+ * from memory. This avoids a round-trip to the host, which may be
+ * implemented in another language, for each query. Call @ref refresh
+ * if the host's information may have changed.
+ *
+ * Managers that parallelise work internally should schedule it via
+ * @ref submit or @ref parallelFor, such that it cooperates with the
+ * host's own threading, rather than creating threads of their own.
+ *
  * @todo Add auditing functionality.
  */
 class OPENASSETIO_CORE_EXPORT Host final {
@@ -81,6 +95,49 @@ class OPENASSETIO_CORE_EXPORT Host final {
    */
   [[nodiscard]] InfoDictionary info();
 
+  /**
+   * Discard the stored host information, such that it is queried from
+   * the host again on next use.
+   */
+  void refresh();
+
+  /**
+   * @}
+   */
+
+  /**
+   * @name Task Scheduling
+   *
+   * @{
+   */
+
+  /// Task to run on the host's scheduler.
+  using Task = std::function<void()>;
+
+  /// Body of a parallel loop, called with each index of the loop.
+  using ParallelForBody = std::function<void(std::size_t)>;
+
+  /**
+   * Queue a task to run asynchronously on the host's scheduler.
+   *
+   * @param task Task to run. Must not throw.
+   */
+  void submit(Task task);
+
+  /**
+   * Call `body` with each index in `[0, count)`, potentially
+   * concurrently on the host's scheduler, blocking until all calls
+   * have completed.
+   *
+   * The calling thread may participate in the work, so this is safe to
+   * call from within a task already running on the host's scheduler.
+   *
+   * @param count Number of indices.
+   * @param body Function to call with each index. If any call throws,
+   * the first exception is rethrown once all calls have completed.
+   */
+  void parallelFor(std::size_t count, const ParallelForBody& body);
+
   /**
    * @}
    */
@@ -88,6 +145,11 @@ class OPENASSETIO_CORE_EXPORT Host final {
  private:
   explicit Host(hostApi::HostInterfacePtr hostInterface);
   hostApi::HostInterfacePtr hostInterface_;
+
+  mutable std::mutex mutex_;
+  mutable std::optional<Identifier> identifier_;
+  mutable std::optional<Str> displayName_;
+  std::optional<InfoDictionary> info_;
 };
 
 }  // namespace managerApi
@@ -2,12 +2,20 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
+OPENASSETIO_FWD_DECLARE(MemoryResourceInterface)
 OPENASSETIO_FWD_DECLARE(managerApi, Host)
 
 namespace openassetio {
@@ -32,6 +40,13 @@ OPENASSETIO_DECLARE_PTR(HostSession)
  *     session.
  *   - A concrete instance of the @fqref{log.LoggerInterface}
  *     "LoggerInterface", to be used for all message reporting.
+ *   - A channel through which the manager can notify the host that
+ *     entities have changed, so that host-side caches can discard
+ *     precisely the affected data, rather than being flushed
+ *     entirely. See @ref notifyEntitiesChanged.
+ *   - Optionally, the host's @ref MemoryResourceInterface
+ *     "memory resource", from which data returned to the host is
+ *     allocated. See @ref memoryResource.
  *
  * @see @fqref{managerApi.Host} "Host"
  * @see @fqref{log.LoggerInterface} "LoggerInterface"
@@ -45,6 +60,19 @@ class OPENASSETIO_CORE_EXPORT HostSession final {
    */
   [[nodiscard]] static HostSessionPtr make(HostPtr host, log::LoggerInterfacePtr logger);
 
+  /**
+   * Constructs a new HostSession holding the supplied host, whose
+   * API calls allocate from the given memory resource.
+   *
+   * @param host The host that initiated the API session.
+   * @param logger The logger associated with this session.
+   * @param memoryResource Resource to allocate data returned to the
+   * host from, or null to use the global heap. This must outlive any
+   * data allocated from it, see @ref MemoryResourceInterface.
+   */
+  [[nodiscard]] static HostSessionPtr make(HostPtr host, log::LoggerInterfacePtr logger,
+                                           MemoryResourceInterfacePtr memoryResource);
+
   /**
    * @return The host that initiated the API session.
    */
@@ -55,10 +83,88 @@ class OPENASSETIO_CORE_EXPORT HostSession final {
    */
   [[nodiscard]] const log::LoggerInterfacePtr& logger() const;
 
+  /**
+   * The memory resource from which data returned to the host is
+   * allocated.
+   *
+   * The @fqref{hostApi.Manager} "Manager" makes this current, using a
+   * @ref ScopedMemoryResource, whilst calling the manager for
+   * @fqref{trait.TraitsData} "TraitsData". Managers need not use it
+   * directly.
+   *
+   * @return The memory resource, or null if the global heap is used.
+   */
+  [[nodiscard]] const MemoryResourceInterfacePtr& memoryResource() const;
+
+  /**
+   * @name Entity Change Notification
+   *
+   * @{
+   */
+
+  /**
+   * Callback invoked when entities have changed.
+   *
+   * Called with the changed entity references, and the traits whose
+   * data changed, or an empty set if any data may have changed.
+   */
+  using EntityChangeCallback =
+      std::function<void(const EntityReferences&, const trait::TraitSet&)>;
+
+  /// Identifies a subscription, for later unsubscription.
+  using SubscriptionId = std::size_t;
+
+  /**
+   * Notify subscribers that entities have changed in the backend, such
+   * that any cached data for them is stale.
+   *
+   * Called by the manager, e.g. in response to a publish or an event
+   * from its backend. Subscribers, such as a @fqref{hostApi.Manager}
+   * "Manager"'s @fqref{hostApi.ResolveCache} "ResolveCache", are
+   * called synchronously, on the calling thread.
+   *
+   * @param entityReferences Changed entities.
+   * @param traitSet Traits whose data changed, or empty if any data
+   * may have changed.
+   */
+  void notifyEntitiesChanged(const EntityReferences& entityReferences,
+                             const trait::TraitSet& traitSet = {}) const;
+
+  /**
+   * Subscribe to notifications of changed entities.
+   *
+   * The callback must be thread-safe, and should not subscribe or
+   * unsubscribe, since it may be called concurrently from any thread
+   * the manager notifies from.
+   *
+   * @param callback Callback to invoke for each notification.
+   * @return Identifier of the subscription.
+   */
+  SubscriptionId subscribeToEntityChanges(EntityChangeCallback callback);
+
+  /**
+   * Remove a subscription. Unknown identifiers are ignored.
+   *
+   * @param subscriptionId Identifier returned by @ref
+   * subscribeToEntityChanges.
+   */
+  void unsubscribeFromEntityChanges(SubscriptionId subscriptionId);
+
+  /**
+   * @}
+   */
+
  private:
-  explicit HostSession(HostPtr host, log::LoggerInterfacePtr logger);
+  HostSession(HostPtr host, log::LoggerInterfacePtr logger,
+              MemoryResourceInterfacePtr memoryResource);
   HostPtr host_;
   log::LoggerInterfacePtr logger_;
+  MemoryResourceInterfacePtr memoryResource_;
+
+  mutable std::mutex subscribersMutex_;
+  std::vector<std::pair<SubscriptionId, std::shared_ptr<const EntityChangeCallback>>>
+      subscribers_;
+  SubscriptionId nextSubscriptionId_ = 1;
 };
 }  // namespace managerApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
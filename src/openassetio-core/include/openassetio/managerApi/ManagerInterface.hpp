@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <exception>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -11,14 +12,17 @@
 #include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/ConditionalResolveResult.hpp>
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/access.hpp>
 #include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/internal.hpp>
+#include <openassetio/trait/TraitsDataTable.hpp>
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
+OPENASSETIO_FWD_DECLARE(managerApi, EntityExistenceFilter)
 OPENASSETIO_FWD_DECLARE(managerApi, EntityReferencePagerInterface)
 OPENASSETIO_FWD_DECLARE(managerApi, ManagerStateBase)
 OPENASSETIO_FWD_DECLARE(managerApi, HostSession)
@@ -539,6 +543,41 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
    */
   virtual void flushCaches(const HostSessionPtr& hostSession);
 
+  /**
+   * Clears any internal caches relating to the given entities.
+   *
+   * Called when the host knows that only specific entities may have
+   * changed, e.g. after publishing them, so that caches of other
+   * entities may be retained.
+   *
+   * The default implementation calls @ref flushCaches, discarding all
+   * retained data. Caching interfaces should override this where they
+   * can discard data selectively.
+   *
+   * @param entityReferences Entities whose data may have changed.
+   * @param hostSession The API session.
+   */
+  virtual void flushEntityCaches(const EntityReferences& entityReferences,
+                                 const HostSessionPtr& hostSession);
+
+  /**
+   * Clears any internal caches relating to entities whose reference
+   * begins with the given prefix.
+   *
+   * Called when the host knows that only a subtree of entities may
+   * have changed, e.g. `asset://shot010/` after publishing to that
+   * shot.
+   *
+   * The default implementation calls @ref flushCaches, discarding all
+   * retained data. Caching interfaces should override this where they
+   * can discard data selectively.
+   *
+   * @param prefix Prefix of the references of entities whose data may
+   * have changed.
+   * @param hostSession The API session.
+   */
+  virtual void flushCachesWithPrefix(const Str& prefix, const HostSessionPtr& hostSession);
+
   /**
    * @}
    */
@@ -792,6 +831,46 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
    */
   [[nodiscard]] virtual ManagerStateBasePtr stateFromPersistenceToken(
       const Str& token, const HostSessionPtr& hostSession);
+
+  /**
+   * Prepare a previously used state for reuse by a new @ref Context.
+   *
+   * Hosts may configure the @fqref{hostApi.Manager} "Manager" to pool
+   * the states of released Contexts (see
+   * @fqref{hostApi.Manager.make} "Manager.make"), so that managers
+   * whose states are expensive to create, e.g. because they wrap a
+   * database transaction or snapshot handle, need not create a new one
+   * for every call to @fqref{hostApi.Manager.createContext}
+   * "createContext".
+   *
+   * Before a pooled state is reused, it is passed to this method. The
+   * implementation should reset it to be equivalent to a newly created
+   * state, and return `true`, or return `false` if the state cannot be
+   * reused, e.g. because the underlying transaction has expired, in
+   * which case it is discarded and @ref createState is called instead.
+   *
+   * Only states created by @ref createState are pooled. This method
+   * may be called from any thread, though never concurrently for the
+   * same state.
+   *
+   * The default implementation returns `false`, i.e. states are never
+   * reused.
+   *
+   * @param state State, previously returned by @ref createState, that
+   * is no longer referenced by any Context.
+   *
+   * @param hostSession openassetio.managerApi.HostSession, The host
+   * session that maps to the caller. This should be used for all
+   * logging and provides access to the openassetio.managerApi.Host
+   * object representing the process that initiated the API session.
+   *
+   * @return Whether the state has been reset and may be reused.
+   *
+   * @see @ref Capability.kStatefulContexts
+   * @see @ref createState
+   */
+  [[nodiscard]] virtual bool resetState(const ManagerStateBasePtr& state,
+                                        const HostSessionPtr& hostSession);
   /**
    * @}
    */
@@ -880,6 +959,33 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
   [[nodiscard]] virtual bool isEntityReferenceString(const Str& someString,
                                                      const HostSessionPtr& hostSession);
 
+  /**
+   * Determines, for each of a batch of strings, whether it matches the
+   * pattern of an @ref entity_reference.
+   *
+   * This is a batch variant of @ref isEntityReferenceString, allowing
+   * hosts to classify many strings at once with a single call into the
+   * manager. This is particularly beneficial when bridging languages,
+   * e.g. for Python plugins, where each call must acquire the GIL.
+   *
+   * The default implementation calls @ref isEntityReferenceString for
+   * each string. Managers may override this to provide a more
+   * efficient implementation, but the result must be consistent with
+   * that of @ref isEntityReferenceString.
+   *
+   * @param someStrings The strings to be inspected.
+   *
+   * @param hostSession HostSession The API session.
+   *
+   * @return A list of the same length as `someStrings`, with `true`
+   * for each string that should be considered an @ref
+   * entity_reference.
+   *
+   * @see @ref isEntityReferenceString
+   */
+  [[nodiscard]] virtual std::vector<bool> areEntityReferenceStrings(
+      const std::vector<Str>& someStrings, const HostSessionPtr& hostSession);
+
   /**
    * Callback signature used for a successful entity existence query.
    */
@@ -941,6 +1047,30 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
                             const ExistsSuccessCallback& successCallback,
                             const BatchElementErrorCallback& errorCallback);
 
+  /**
+   * Provide an approximate snapshot of the entities that exist, used
+   * to answer @ref entityExists queries host-side for entities that
+   * definitely do not exist.
+   *
+   * The filter is queried once the manager is initialized, and again
+   * whenever the host flushes caches. Entities that the filter reports
+   * they @ref EntityExistenceFilter.mayContain "may contain" are
+   * still queried via @ref entityExists.
+   *
+   * The default implementation returns a null pointer, i.e. all
+   * existence queries are forwarded to the manager. Managers that
+   * can cheaply enumerate their entities may override this to reduce
+   * the cost of bulk existence checks, such as those made by hosts
+   * validating a scene.
+   *
+   * @param hostSession The API session.
+   *
+   * @return Filter containing every entity that exists, or a null
+   * pointer if none is available.
+   */
+  [[nodiscard]] virtual EntityExistenceFilterConstPtr entityExistenceFilter(
+      const HostSessionPtr& hostSession);
+
   /**
    * Callback signature used for a successful entity trait set query.
    */
@@ -1087,6 +1217,25 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
    * would correspond to an exception whereas a client error (4xx) would
    * correspond to a `BatchElementError`.
    *
+   * If the @p context holds a @ref CancellationToken, long running
+   * implementations may poll it and return early once it is
+   * cancelled. Entities that have not been reported will then be
+   * reported to the host as cancelled, so need not be given to the
+   * @p errorCallback. The same applies to all other batch methods.
+   *
+   * @note Python implementations may alternatively return a `list` of
+   * `(index, result)` tuples, where each `result` is either a
+   * `TraitsData` or a `BatchElementError`, rather than calling a
+   * callback for each element, which avoids the significant overhead
+   * of crossing the language boundary per element for large batches.
+   * The returned results are given to the callbacks, in order, once
+   * the call returns. Calling the callbacks and returning results can
+   * be combined. This also applies to @ref entityExists, @ref
+   * entityTraits, @ref defaultEntityReference, @ref preflight and
+   * @ref register_ "register". Note that returned results are only
+   * dispatched when the implementation is called via C++, e.g. via
+   * the @fqref{hostApi.Manager} "Manager".
+   *
    * @param entityReferences Entity references to query.
    *
    * @param traitSet The traits to resolve for the supplied list of
@@ -1127,6 +1276,185 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
                        const ResolveSuccessCallback& successCallback,
                        const BatchElementErrorCallback& errorCallback);
 
+  /**
+   * As @ref resolve, but requests that only a subset of the properties
+   * of the given traits be populated.
+   *
+   * This allows managers to avoid the cost of fetching and
+   * transferring data that the host doesn't need, e.g. when the host
+   * only requires the `location` property of a `LocatableContent`
+   * trait.
+   *
+   * The projection is a hint. Managers should populate at least the
+   * projected properties of the listed traits, and may omit their
+   * other properties. Traits that are in @p traitSet, but not in the
+   * projection, must be populated as for @ref resolve. Hosts must
+   * tolerate additional properties being populated.
+   *
+   * The default implementation ignores the projection and calls @ref
+   * resolve.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The traits to resolve.
+   * @param propertyProjection The properties required of each trait.
+   * @param resolveAccess The host's intended usage of the data.
+   * @param context The calling context.
+   * @param hostSession The API session.
+   * @param successCallback Callback to be called for each successful
+   * resolution, as for @ref resolve.
+   * @param errorCallback Callback to be called for each failed
+   * resolution, as for @ref resolve.
+   *
+   * @see @ref Capability.kResolution
+   */
+  virtual void resolveProjected(const EntityReferences& entityReferences,
+                                const trait::TraitSet& traitSet,
+                                const trait::PropertyProjection& propertyProjection,
+                                access::ResolveAccess resolveAccess,
+                                const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                                const ResolveSuccessCallback& successCallback,
+                                const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * As @ref resolve, but populating a columnar table of results,
+   * rather than providing a @ref trait.TraitsData "TraitsData" per
+   * entity.
+   *
+   * Since all entities in a batch are resolved for the same trait
+   * set, their properties can be held as a column per property, see
+   * @ref trait.TraitsDataTable "TraitsDataTable". Managers that
+   * retrieve data in bulk (e.g. as the rows of a database query) can
+   * write values straight into the table, avoiding the cost of
+   * constructing a TraitsData per entity. Hosts can then scan a
+   * property across all entities with linear access.
+   *
+   * Upon entry, the table has a row per entity reference, and holds
+   * the requested traits. It may already have columns, e.g. from a
+   * previous batch. Managers should set the properties of row `i` for
+   * `entityReferences[i]`, adding columns as required, and add any
+   * traits that have no properties to the row. The rows of entities
+   * that fail to resolve should be left unset, and the error reported
+   * via the error callback. This includes entities with a property
+   * value that the table rejects, since its existing column holds a
+   * different type.
+   *
+   * The default implementation calls @ref resolve, and copies each
+   * result into the table.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The traits to resolve.
+   * @param resolveAccess The host's intended usage of the data.
+   * @param context The calling context.
+   * @param hostSession The API session.
+   * @param results Table to populate, with a row per entity reference.
+   * @param errorCallback Callback to be called for each failed
+   * resolution, as for @ref resolve.
+   *
+   * @see @ref Capability.kResolution
+   */
+  virtual void resolveColumnar(const EntityReferences& entityReferences,
+                               const trait::TraitSet& traitSet,
+                               access::ResolveAccess resolveAccess,
+                               const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                               trait::TraitsDataTable& results,
+                               const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * As @ref resolve, but with a trait set per entity, allowing a
+   * single call to resolve entities of many kinds.
+   *
+   * Trait sets are given as a table, with each entity referring to
+   * its trait set by index, so that large batches need only hold a
+   * few distinct trait sets. For example, a host loading a scene of
+   * images, geometry and cameras can resolve them all at once, rather
+   * than making a call per trait set.
+   *
+   * The default implementation groups the entities by trait set, and
+   * calls @ref resolve once per group. Managers that can resolve a
+   * mixed batch in a single query should override this method.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSets Table of the distinct traits to resolve.
+   * @param traitSetIndices Index into @p traitSets of the traits to
+   * resolve for each entity. Must be the same length as @p
+   * entityReferences.
+   * @param resolveAccess The host's intended usage of the data.
+   * @param context The calling context.
+   * @param hostSession The API session.
+   * @param successCallback Callback to be called for each successful
+   * resolution, as for @ref resolve.
+   * @param errorCallback Callback to be called for each failed
+   * resolution, as for @ref resolve.
+   *
+   * @throws errors.InputValidationException If the number of indices
+   * differs from the number of entity references, or an index is out
+   * of range.
+   *
+   * @see @ref Capability.kResolution
+   */
+  virtual void resolveHeterogeneous(const EntityReferences& entityReferences,
+                                    const trait::TraitSets& traitSets,
+                                    const std::vector<std::size_t>& traitSetIndices,
+                                    access::ResolveAccess resolveAccess,
+                                    const ContextConstPtr& context,
+                                    const HostSessionPtr& hostSession,
+                                    const ResolveSuccessCallback& successCallback,
+                                    const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Callback signature used for a successful conditional resolution.
+   */
+  using ConditionalResolveSuccessCallback =
+      std::function<void(std::size_t, ConditionalResolveResult)>;
+
+  /**
+   * As @ref resolve, but omits the data of entities that are unchanged
+   * since a previous resolution.
+   *
+   * This allows hosts that periodically re-resolve entities in order
+   * to detect updates to avoid the cost of transferring, allocating
+   * and processing data that hasn't changed.
+   *
+   * Each successful result holds an opaque token identifying the
+   * generation of the entity's resolved data, analogous to an HTTP
+   * ETag. Hosts pass the token from the previous resolution of each
+   * entity in @p generationTokens. If the entity's data is unchanged
+   * since that generation, the result's data must be null, otherwise
+   * it must be populated as for @ref resolve. Tokens must change
+   * whenever the data that would be resolved for the same arguments
+   * changes, and are only meaningful when compared with tokens for
+   * the same entity, traits, access mode and locale.
+   *
+   * The default implementation calls @ref resolve, and derives a
+   * token from a hash of the resolved data, such that hosts benefit
+   * from reduced processing, but not reduced transfer. Managers with
+   * a cheap means of determining a generation, e.g. a version number
+   * or modification time, should override this method to avoid
+   * fetching unchanged data at all.
+   *
+   * @param entityReferences Entity references to query.
+   * @param traitSet The traits to resolve.
+   * @param resolveAccess The host's intended usage of the data.
+   * @param generationTokens Token from the previous resolution of each
+   * entity, or an empty string if there was none. Must be the same
+   * length as @p entityReferences.
+   * @param context The calling context.
+   * @param hostSession The API session.
+   * @param successCallback Callback to be called for each successful
+   * resolution, as for @ref resolve.
+   * @param errorCallback Callback to be called for each failed
+   * resolution, as for @ref resolve.
+   *
+   * @see @ref Capability.kResolution
+   */
+  virtual void resolveIfChanged(const EntityReferences& entityReferences,
+                                const trait::TraitSet& traitSet,
+                                access::ResolveAccess resolveAccess,
+                                const std::vector<Str>& generationTokens,
+                                const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                                const ConditionalResolveSuccessCallback& successCallback,
+                                const BatchElementErrorCallback& errorCallback);
+
   /**
    * Callback signature used for a successful default entity reference
    * query.
@@ -1414,6 +1742,158 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
                                     const RelationshipQuerySuccessCallback& successCallback,
                                     const BatchElementErrorCallback& errorCallback);
 
+  /**
+   * Queries entity references that are related to each of the input
+   * references by each of the relationships defined by a set of traits
+   * and their properties.
+   *
+   * This is a many-to-many combination of @ref getWithRelationship and
+   * @ref getWithRelationships, allowing, for example, a dependency
+   * graph to be built with a single call, rather than one call per
+   * entity. Managers backed by a database may then satisfy the whole
+   * query with a single round-trip.
+   *
+   * Results are indexed in row-major order, i.e. the result for the
+   * entity at index `e` in @p entityReferences and the relationship at
+   * index `r` in @p relationshipTraitsDatas is reported with the index
+   * `e * relationshipTraitsDatas.size() + r`.
+   *
+   * The default implementation calls @ref getWithRelationships for
+   * each entity in turn, mapping indices accordingly. Managers may
+   * override this to provide a more efficient implementation.
+   *
+   * @param entityReferences A list of @ref entity_reference to query
+   * the specified relationships for.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * query.
+   *
+   * @param resultTraitSet A hint as to what traits the returned
+   * entities should have.
+   *
+   * @param pageSize The size of each page of data. The page size is
+   * fixed for the lifetime of pager object given to the @p
+   * successCallback. Guaranteed to be greater than zero.
+   *
+   * @param relationsAccess The host's intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param hostSession The host session that maps to the caller, this
+   * should be used for all logging and provides access to the Host
+   * object representing the process that initiated the API session.
+   *
+   * @param successCallback Callback that should be called for each
+   * successful relationship query. It should be given the row-major
+   * index of the entity and relationship, as described above, as well
+   * as a pager capable of returning pages of related entities. The
+   * callback should be called on the same thread that initiated the
+   * call to `getWithRelationshipsMatrix`.
+   *
+   * @param errorCallback Callback that should be called for each failed
+   * relationship query. It should be given the row-major index of the
+   * entity and relationship along with a populated BatchElementError
+   * (see @fqref{errors.BatchElementError.ErrorCode} "ErrorCodes"). The
+   * callback should be called on the same thread that initiated the
+   * call to `getWithRelationshipsMatrix`.
+   *
+   * @throws errors.NotImplementedException by default, via @ref
+   * getWithRelationships, when relationship queries are not
+   * implemented by the manager.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  virtual void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                          const trait::TraitsDatas& relationshipTraitsDatas,
+                                          const trait::TraitSet& resultTraitSet, size_t pageSize,
+                                          access::RelationsAccess relationsAccess,
+                                          const ContextConstPtr& context,
+                                          const HostSessionPtr& hostSession,
+                                          const RelationshipQuerySuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Callback signature used for a successful relationship traversal.
+   *
+   * Receives the entities first reached at each hop, in order of hop.
+   */
+  using RelationshipTraversalSuccessCallback =
+      std::function<void(std::size_t, std::vector<EntityReferences>)>;
+
+  /**
+   * Follows relationships from each of the input references over
+   * multiple hops, e.g. to compute the dependency closure of a shot.
+   *
+   * The relationship followed at hop `h` (counting from zero) is
+   * `relationshipTraitsDatas[min(h, relationshipTraitsDatas.size() - 1)]`,
+   * i.e. a chain of relationships is followed in turn, with the last
+   * repeated until @p maxDepth hops have been made. A single
+   * relationship therefore describes a recursive traversal.
+   *
+   * Each entity is reported at most once per input reference, at the
+   * hop that first reached it. The input reference itself is not
+   * reported, and cycles are not followed. Traversal of an input
+   * reference stops early once a hop reaches no new entities, and
+   * trailing hops that reached nothing are omitted from the result.
+   *
+   * The default implementation traverses breadth-first, making a single
+   * @ref getWithRelationship call per hop for the combined frontier of
+   * all input references, and draining each pager in full. Managers
+   * backed by a database are encouraged to override this to satisfy
+   * the whole traversal server-side, e.g. with a recursive query.
+   *
+   * @param entityReferences A list of @ref entity_reference to
+   * traverse from.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * follow, as described above. Guaranteed to be non-empty.
+   *
+   * @param resultTraitSet A hint as to what traits the entities
+   * reached at each hop should have. Entities that are filtered out
+   * are not traversed further.
+   *
+   * @param maxDepth Maximum number of hops to make.
+   *
+   * @param relationsAccess The host's intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param hostSession The host session that maps to the caller, this
+   * should be used for all logging and provides access to the Host
+   * object representing the process that initiated the API session.
+   *
+   * @param successCallback Callback that should be called for each
+   * input reference that was traversed successfully. It should be
+   * given the corresponding index of the entity reference in @p
+   * entityReferences along with the entities first reached at each
+   * hop. The callback should be called on the same thread that
+   * initiated the call to `traverseRelationships`.
+   *
+   * @param errorCallback Callback that should be called for each input
+   * reference whose traversal failed, including where the failure was
+   * for an entity reached from it. It should be given the
+   * corresponding index of the entity reference in @p entityReferences
+   * along with a populated BatchElementError (see
+   * @fqref{errors.BatchElementError.ErrorCode} "ErrorCodes"). The
+   * callback should be called on the same thread that initiated the
+   * call to `traverseRelationships`.
+   *
+   * @throws errors.NotImplementedException by default, via @ref
+   * getWithRelationship, when relationship queries are not
+   * implemented by the manager.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  virtual void traverseRelationships(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+      const trait::TraitSet& resultTraitSet, std::size_t maxDepth,
+      access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+      const HostSessionPtr& hostSession,
+      const RelationshipTraversalSuccessCallback& successCallback,
+      const BatchElementErrorCallback& errorCallback);
+
   /// @}
   /**
    * @name Publishing
@@ -1708,6 +2188,109 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
                          const BatchElementErrorCallback& errorCallback);
 
   /// @}
+
+  /**
+   * @name Asynchronous Batch Operations
+   *
+   * Non-blocking variants of the batch entity operations.
+   *
+   * The default implementations adapt the corresponding synchronous
+   * method by running it on a shared pool of worker threads. This
+   * means existing implementations support asynchronous usage
+   * without modification, but note that the synchronous method may
+   * then be called concurrently from multiple threads.
+   *
+   * Managers with natively asynchronous backends may override these
+   * methods to avoid occupying a worker thread for the duration of the
+   * operation.
+   *
+   * Implementations must return promptly. Success and error callbacks
+   * may be called on any thread, but must not be called concurrently
+   * with each other. The completion callback must be called exactly
+   * once, after all other callbacks, with either a null pointer on
+   * success or the exception that failed the whole batch. Exceptions
+   * must not be thrown from these methods once the operation has been
+   * started, i.e. they can only be used for up-front validation.
+   *
+   * The caller guarantees that this instance will outlive the
+   * operation, i.e. until the completion callback has been called.
+   *
+   * @{
+   */
+
+  /**
+   * Callback signature used to signal completion of an asynchronous
+   * batch operation.
+   *
+   * Receives a null pointer if the batch completed, or the exception
+   * that failed the whole batch otherwise.
+   */
+  using CompletionCallback = std::function<void(std::exception_ptr)>;
+
+  /**
+   * Asynchronous variant of @ref entityExists.
+   *
+   * @see @ref entityExists
+   */
+  virtual void entityExistsAsync(const EntityReferences& entityReferences,
+                                 const ContextConstPtr& context,
+                                 const HostSessionPtr& hostSession,
+                                 ExistsSuccessCallback successCallback,
+                                 BatchElementErrorCallback errorCallback,
+                                 CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous variant of @ref entityTraits.
+   *
+   * @see @ref entityTraits
+   */
+  virtual void entityTraitsAsync(const EntityReferences& entityReferences,
+                                 access::EntityTraitsAccess entityTraitsAccess,
+                                 const ContextConstPtr& context,
+                                 const HostSessionPtr& hostSession,
+                                 EntityTraitsSuccessCallback successCallback,
+                                 BatchElementErrorCallback errorCallback,
+                                 CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous variant of @ref resolve.
+   *
+   * @see @ref resolve
+   */
+  virtual void resolveAsync(const EntityReferences& entityReferences,
+                            const trait::TraitSet& traitSet, access::ResolveAccess resolveAccess,
+                            const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                            ResolveSuccessCallback successCallback,
+                            BatchElementErrorCallback errorCallback,
+                            CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous variant of @ref preflight.
+   *
+   * @see @ref preflight
+   */
+  virtual void preflightAsync(const EntityReferences& entityReferences,
+                              const trait::TraitsDatas& traitsHints,
+                              access::PublishingAccess publishingAccess,
+                              const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                              PreflightSuccessCallback successCallback,
+                              BatchElementErrorCallback errorCallback,
+                              CompletionCallback completionCallback);
+
+  /**
+   * Asynchronous variant of @ref register_.
+   *
+   * @see @ref register_
+   */
+  virtual void registerAsync(const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& entityTraitsDatas,
+                             access::PublishingAccess publishingAccess,
+                             const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                             RegisterSuccessCallback successCallback,
+                             BatchElementErrorCallback errorCallback,
+                             CompletionCallback completionCallback);
+
+  /// @}
  protected:
   /**
    * Create an @ref EntityReference object wrapping a given @ref
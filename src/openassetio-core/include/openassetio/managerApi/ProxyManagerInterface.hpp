@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a base class for manager plugin middleware.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+OPENASSETIO_DECLARE_PTR(ProxyManagerInterface)
+
+/**
+ * A @ref ManagerInterface that forwards all calls to another.
+ *
+ * This is a convenience base class for middleware, i.e. layers that
+ * wrap a manager plugin in order to add behaviour, such as caching or
+ * instrumentation, without the plugin's involvement. Subclasses need
+ * only override the methods they wish to augment, calling the base
+ * class implementation (or @ref proxied directly) to continue down
+ * the chain. Since a proxy is itself a ManagerInterface, layers can be
+ * stacked arbitrarily, and the outermost given to @ref hostApi.Manager
+ * "Manager.make".
+ *
+ * All methods, including the asynchronous variants, forward to the
+ * same method of the proxied manager. Note that this means a subclass
+ * that overrides a synchronous batch method, e.g. `resolve`, will not
+ * see calls to the asynchronous variant, e.g. `resolveAsync`. Layers
+ * that must intercept both should also override the asynchronous
+ * variant, typically by calling the default @ref ManagerInterface
+ * implementation, which runs the (overridden) synchronous method on a
+ * background thread.
+ *
+ * Layers should take care to preserve the thread-safety declared by
+ * the proxied manager in its @ref info dictionary, since that is
+ * forwarded unchanged.
+ */
+class OPENASSETIO_CORE_EXPORT ProxyManagerInterface : public ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(ProxyManagerInterface)
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] StrMap updateTerminology(StrMap terms, const HostSessionPtr& hostSession) override;
+  [[nodiscard]] InfoDictionary settings(const HostSessionPtr& hostSession) override;
+  void initialize(InfoDictionary managerSettings, const HostSessionPtr& hostSession) override;
+  void flushCaches(const HostSessionPtr& hostSession) override;
+  void flushEntityCaches(const EntityReferences& entityReferences,
+                         const HostSessionPtr& hostSession) override;
+  void flushCachesWithPrefix(const Str& prefix, const HostSessionPtr& hostSession) override;
+  [[nodiscard]] trait::TraitsDatas managementPolicy(const trait::TraitSets& traitSets,
+                                                    access::PolicyAccess policyAccess,
+                                                    const ContextConstPtr& context,
+                                                    const HostSessionPtr& hostSession) override;
+  [[nodiscard]] ManagerStateBasePtr createState(const HostSessionPtr& hostSession) override;
+  [[nodiscard]] ManagerStateBasePtr createChildState(const ManagerStateBasePtr& parentState,
+                                                     const HostSessionPtr& hostSession) override;
+  [[nodiscard]] Str persistenceTokenForState(const ManagerStateBasePtr& state,
+                                             const HostSessionPtr& hostSession) override;
+  [[nodiscard]] ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool resetState(const ManagerStateBasePtr& state,
+                                const HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(const Str& someString,
+                                             const HostSessionPtr& hostSession) override;
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(
+      const std::vector<Str>& someStrings, const HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  [[nodiscard]] EntityExistenceFilterConstPtr entityExistenceFilter(
+      const HostSessionPtr& hostSession) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void resolveHeterogeneous(const EntityReferences& entityReferences,
+                            const trait::TraitSets& traitSets,
+                            const std::vector<std::size_t>& traitSetIndices,
+                            access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                            const HostSessionPtr& hostSession,
+                            const ResolveSuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void resolveProjected(const EntityReferences& entityReferences,
+                        const trait::TraitSet& traitSet,
+                        const trait::PropertyProjection& propertyProjection,
+                        access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                        const HostSessionPtr& hostSession,
+                        const ResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback) override;
+  void resolveColumnar(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                       access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                       const HostSessionPtr& hostSession, trait::TraitsDataTable& results,
+                       const BatchElementErrorCallback& errorCallback) override;
+  void resolveIfChanged(const EntityReferences& entityReferences,
+                        const trait::TraitSet& traitSet, access::ResolveAccess resolveAccess,
+                        const std::vector<Str>& generationTokens, const ContextConstPtr& context,
+                        const HostSessionPtr& hostSession,
+                        const ConditionalResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                           access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+                           const HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  const trait::TraitSet& resultTraitSet, std::size_t pageSize,
+                                  access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const HostSessionPtr& hostSession,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback) override;
+  void traverseRelationships(const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& relationshipTraitsDatas,
+                             const trait::TraitSet& resultTraitSet, std::size_t maxDepth,
+                             access::RelationsAccess relationsAccess,
+                             const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                             const RelationshipTraversalSuccessCallback& successCallback,
+                             const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const HostSessionPtr& hostSession, const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  void entityExistsAsync(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                         const HostSessionPtr& hostSession, ExistsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void entityTraitsAsync(const EntityReferences& entityReferences,
+                         access::EntityTraitsAccess entityTraitsAccess,
+                         const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                         EntityTraitsSuccessCallback successCallback,
+                         BatchElementErrorCallback errorCallback,
+                         CompletionCallback completionCallback) override;
+  void resolveAsync(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+                    access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession, ResolveSuccessCallback successCallback,
+                    BatchElementErrorCallback errorCallback,
+                    CompletionCallback completionCallback) override;
+  void preflightAsync(const EntityReferences& entityReferences,
+                      const trait::TraitsDatas& traitsHints,
+                      access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                      const HostSessionPtr& hostSession, PreflightSuccessCallback successCallback,
+                      BatchElementErrorCallback errorCallback,
+                      CompletionCallback completionCallback) override;
+  void registerAsync(const EntityReferences& entityReferences,
+                     const trait::TraitsDatas& entityTraitsDatas,
+                     access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                     const HostSessionPtr& hostSession, RegisterSuccessCallback successCallback,
+                     BatchElementErrorCallback errorCallback,
+                     CompletionCallback completionCallback) override;
+
+ protected:
+  /**
+   * Construct a proxy that forwards to the given manager plugin.
+   *
+   * @param proxied Manager plugin to forward to.
+   * @exception errors.InputValidationException If `proxied` is null.
+   */
+  explicit ProxyManagerInterface(ManagerInterfacePtr proxied);
+
+  /// @return Manager plugin that calls are forwarded to.
+  [[nodiscard]] const ManagerInterfacePtr& proxied() const;
+
+ private:
+  ManagerInterfacePtr proxied_;
+};
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a built-in manager plugin that synthesises data on demand.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+OPENASSETIO_DECLARE_PTR(SyntheticManagerInterface)
+
+/**
+ * A @ref ManagerInterface that deterministically synthesises data for
+ * any entity reference with a given prefix, rather than querying a
+ * backend.
+ *
+ * This allows library benchmarks and host throughput tests to isolate
+ * the overhead of OpenAssetIO (or of a host's integration) from the
+ * cost of any real manager plugin, by configuring the manager to do as
+ * little, or as much, work as required.
+ *
+ * Behaviour is configured via the settings dictionary given to @ref
+ * initialize, using the `kSettingsKey_*` keys below:
+ *
+ * - Every reference with the prefix exists, and @ref resolve populates
+ *   every requested trait with a number of string properties of a
+ *   given size. Property keys are `p0`, `p1`, etc., and values are
+ *   derived from a hash of the entity reference, trait and key, so
+ *   that repeated runs resolve identical data.
+ * - @ref entityTraits reports a configurable trait set, empty by
+ *   default, for every reference with the prefix.
+ * - A latency can be simulated, per batch and per element, by
+ *   sleeping the calling thread.
+ * - References without the prefix result in a @ref BatchElementError
+ *   of type `kInvalidEntityReference`.
+ *
+ * Management policy queries return an empty @fqref{TraitsData}
+ * "TraitsData", i.e. the manager claims not to manage any entity
+ * type, since core has no knowledge of the `ManagedTrait`.
+ *
+ * All methods are thread-safe, and the manager declares as much in
+ * its @ref info dictionary.
+ */
+class OPENASSETIO_CORE_EXPORT SyntheticManagerInterface final : public ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(SyntheticManagerInterface)
+
+  /// Identifier of this manager.
+  static constexpr std::string_view kIdentifier = "org.openassetio.synthetic";
+
+  /// Setting for the prefix of valid entity references (`Str`).
+  static constexpr std::string_view kSettingsKey_Prefix = "prefix";
+  /// Setting for the number of properties per resolved trait (`Int`).
+  static constexpr std::string_view kSettingsKey_PropertyCount = "propertyCount";
+  /// Setting for the length of each resolved property value (`Int`).
+  static constexpr std::string_view kSettingsKey_PropertySize = "propertySize";
+  /// Setting for the trait set reported by entityTraits, as a
+  /// newline-separated list of trait IDs (`Str`).
+  static constexpr std::string_view kSettingsKey_EntityTraitSet = "entityTraitSet";
+  /// Setting for simulated latency per batch call, in µs (`Int`).
+  static constexpr std::string_view kSettingsKey_CallLatencyMicroseconds =
+      "callLatencyMicroseconds";
+  /// Setting for simulated latency per batch element, in µs (`Int`).
+  static constexpr std::string_view kSettingsKey_ElementLatencyMicroseconds =
+      "elementLatencyMicroseconds";
+
+  /// Default for @ref kSettingsKey_Prefix.
+  static constexpr std::string_view kDefaultPrefix = "synthetic://";
+  /// Default for @ref kSettingsKey_PropertyCount.
+  static constexpr Int kDefaultPropertyCount = 1;
+  /// Default for @ref kSettingsKey_PropertySize.
+  static constexpr Int kDefaultPropertySize = 16;
+
+  /**
+   * Construct a synthetic manager, configured with the default
+   * settings until @ref initialize is called.
+   *
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   */
+  [[nodiscard]] static SyntheticManagerInterfacePtr make();
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] InfoDictionary settings(const HostSessionPtr& hostSession) override;
+
+  /**
+   * Configure the manager.
+   *
+   * Settings that are not provided revert to their defaults.
+   *
+   * @exception errors.ConfigurationException If a setting is unknown,
+   * is of the wrong type, or is out of range. The existing settings
+   * are retained in this case.
+   */
+  void initialize(InfoDictionary managerSettings, const HostSessionPtr& hostSession) override;
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(const trait::TraitSets& traitSets,
+                                                    access::PolicyAccess policyAccess,
+                                                    const ContextConstPtr& context,
+                                                    const HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(const Str& someString,
+                                             const HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+
+ private:
+  SyntheticManagerInterface();
+
+  struct Settings {
+    Str prefix{kDefaultPrefix};
+    std::size_t propertyCount = kDefaultPropertyCount;
+    std::size_t propertySize = kDefaultPropertySize;
+    trait::TraitSet entityTraitSet;
+    std::chrono::microseconds callLatency{0};
+    std::chrono::microseconds elementLatency{0};
+  };
+
+  /// Sleep for the simulated latency of a batch of `batchSize`.
+  void simulateLatency(std::size_t batchSize) const;
+
+  /// Whether `entityReference` has the configured prefix.
+  [[nodiscard]] bool isValid(const EntityReference& entityReference) const;
+
+  /// Settings are only modified by initialize, which must not be
+  /// called concurrently with other methods.
+  Settings settings_;
+};
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
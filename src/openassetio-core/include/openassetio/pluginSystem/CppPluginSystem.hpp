@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/pluginSystem/CppPluginSystemPlugin.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+OPENASSETIO_DECLARE_PTR(CppPluginSystem)
+
+/**
+ * Loads C++ plugins from shared libraries found on a search path.
+ *
+ * Each shared library (`.so`, `.dylib` or `.dll`, as appropriate for
+ * the platform) found directly within a search path is loaded, and if
+ * it exposes the entry point defined by @ref
+ * OPENASSETIO_CPP_PLUGIN_ENTRY_POINT, the plugin it provides is
+ * registered with its identifier. Once a plugin has registered an
+ * identifier, any subsequent registrations with that identifier are
+ * skipped.
+ *
+ * Since the entry point name incorporates the core library's ABI
+ * version, libraries built against an incompatible version of
+ * OpenAssetIO are rejected.
+ *
+ * @note Loaded libraries are never unloaded, since objects created by
+ * plugins (e.g. manager states) may outlive the plugin system.
+ */
+class OPENASSETIO_CORE_EXPORT CppPluginSystem final {
+ public:
+  OPENASSETIO_ALIAS_PTR(CppPluginSystem)
+
+  /**
+   * Construct a new instance.
+   *
+   * @param logger Logger used to report plugin loading progress and
+   * non-critical errors.
+   */
+  static CppPluginSystemPtr make(log::LoggerInterfacePtr logger);
+
+  /// Clears any previously loaded plugins.
+  void reset();
+
+  /**
+   * Searches the supplied paths for plugin libraries.
+   *
+   * Only the first instance of any given plugin identifier will be
+   * used, and subsequent registrations ignored. This means entries to
+   * the left of the paths list take precedence over ones to the right.
+   * Libraries within the same directory are loaded in alphabetical
+   * order.
+   *
+   * @param paths A list of paths to search, delimited by the platform's
+   * path list separator (`:` or `;` on Windows).
+   */
+  void scan(std::string_view paths);
+
+  /**
+   * Returns the identifiers known to the plugin system.
+   *
+   * If @ref scan has not been called, then this will be empty.
+   */
+  [[nodiscard]] Identifiers identifiers() const;
+
+  /**
+   * Retrieves the plugin that provides the given identifier.
+   *
+   * @exception errors.InputValidationException Thrown if no plugin
+   * provides the specified identifier.
+   */
+  [[nodiscard]] CppPluginSystemPluginPtr plugin(const Identifier& identifier) const;
+
+ private:
+  explicit CppPluginSystem(log::LoggerInterfacePtr logger);
+
+  void load(const Str& path);
+
+  log::LoggerInterfacePtr logger_;
+  // Identifiers in registration order.
+  Identifiers identifiers_;
+  std::unordered_map<Identifier, CppPluginSystemPluginPtr> plugins_;
+  std::unordered_map<Identifier, Str> paths_;
+};
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <openassetio/export.h>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
+OPENASSETIO_FWD_DECLARE(pluginSystem, CppPluginSystem)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+OPENASSETIO_DECLARE_PTR(CppPluginSystemManagerImplementationFactory)
+
+/**
+ * A factory to manage @ref CppPluginSystemManagerPlugin derived
+ * plugins, loaded from shared libraries. Not usually used directly by
+ * a @ref host, which instead uses the @fqref{hostApi.ManagerFactory}
+ * "ManagerFactory".
+ *
+ * This allows C++ hosts to use C++ managers without requiring an
+ * embedded Python interpreter.
+ *
+ * The factory loads plugins from libraries found under paths specified
+ * in the `OPENASSETIO_PLUGIN_PATH` env var, which is shared with the
+ * Python plugin system. Libraries are only loaded on the first call to
+ * @ref identifiers or @ref instantiate.
+ *
+ * @see @ref CppPluginSystem
+ */
+class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerImplementationFactory final
+    : public hostApi::ManagerImplementationFactoryInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(CppPluginSystemManagerImplementationFactory)
+
+  /// The environment variable to read the plugin search path from.
+  static constexpr const char* kPluginEnvVar = "OPENASSETIO_PLUGIN_PATH";
+
+  /**
+   * Construct a new instance, searching paths from the @ref
+   * kPluginEnvVar environment variable.
+   *
+   * @param logger Logger used to report information about plugin
+   * loading.
+   */
+  static CppPluginSystemManagerImplementationFactoryPtr make(log::LoggerInterfacePtr logger);
+
+  /**
+   * Construct a new instance, searching the supplied paths.
+   *
+   * @param paths Paths to search for plugins, delimited by the
+   * platform's path list separator.
+   *
+   * @param logger Logger used to report information about plugin
+   * loading.
+   */
+  static CppPluginSystemManagerImplementationFactoryPtr make(Str paths,
+                                                             log::LoggerInterfacePtr logger);
+
+  ~CppPluginSystemManagerImplementationFactory() override;
+
+  /**
+   * All identifiers known to the factory.
+   *
+   * Only plugins derived from @ref CppPluginSystemManagerPlugin are
+   * included.
+   */
+  [[nodiscard]] Identifiers identifiers() override;
+
+  /**
+   * Creates an instance of the @fqref{managerApi.ManagerInterface}
+   * "ManagerInterface" with the specified identifier.
+   *
+   * @param identifier The identifier of the ManagerInterface to
+   * instantiate.
+   *
+   * @return Newly created `ManagerInterface`.
+   *
+   * @throws errors.InputValidationException If the requested
+   * identifier has not been registered by a manager plugin.
+   */
+  [[nodiscard]] managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override;
+
+ private:
+  CppPluginSystemManagerImplementationFactory(Str paths, log::LoggerInterfacePtr logger);
+
+  /// Scan for plugins, if not done already.
+  const CppPluginSystemPtr& pluginSystem();
+
+  const Str paths_;
+  std::mutex mutex_;
+  CppPluginSystemPtr pluginSystem_;
+};
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/pluginSystem/CppPluginSystemPlugin.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(managerApi, ManagerInterface)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+OPENASSETIO_DECLARE_PTR(CppPluginSystemManagerPlugin)
+
+/**
+ * Base class for C++ plugins that provide a @ref
+ * asset_management_system implementation.
+ *
+ * Instances are created by the factory returned by a plugin library's
+ * entry point, and used by the @ref
+ * CppPluginSystemManagerImplementationFactory to construct the
+ * library's @fqref{managerApi.ManagerInterface} "ManagerInterface".
+ */
+class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerPlugin : public CppPluginSystemPlugin {
+ public:
+  OPENASSETIO_ALIAS_PTR(CppPluginSystemManagerPlugin)
+
+  ~CppPluginSystemManagerPlugin() override;
+
+  /**
+   * Constructs an instance of the
+   * @fqref{managerApi.ManagerInterface} "ManagerInterface".
+   *
+   * @return ManagerInterface instance
+   */
+  [[nodiscard]] virtual managerApi::ManagerInterfacePtr interface() = 0;
+};
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+/// @cond
+#define OPENASSETIO_DETAIL_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define OPENASSETIO_DETAIL_CONCAT(lhs, rhs) OPENASSETIO_DETAIL_CONCAT_IMPL(lhs, rhs)
+#define OPENASSETIO_DETAIL_STRINGIFY_IMPL(token) #token
+#define OPENASSETIO_DETAIL_STRINGIFY(token) OPENASSETIO_DETAIL_STRINGIFY_IMPL(token)
+
+#if defined(_WIN32)
+#define OPENASSETIO_DETAIL_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define OPENASSETIO_DETAIL_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+/// @endcond
+
+/**
+ * Name of the entry point function that a C++ plugin library must
+ * expose.
+ *
+ * The name incorporates the ABI version of the OpenAssetIO core
+ * library that the plugin was built against, such that libraries
+ * built against an incompatible version are not loaded.
+ *
+ * @see OPENASSETIO_CPP_PLUGIN_ENTRY_POINT
+ */
+#define OPENASSETIO_CPP_PLUGIN_ENTRY_POINT_NAME \
+  OPENASSETIO_DETAIL_CONCAT(openassetioPlugin_, OPENASSETIO_CORE_ABI_VERSION)
+
+/**
+ * Define the entry point of a C++ plugin library.
+ *
+ * This should be used exactly once, at global scope, in the plugin's
+ * shared library, e.g.
+ *
+ * @code{.cpp}
+ * OPENASSETIO_CPP_PLUGIN_ENTRY_POINT(MyManagerPlugin::make)
+ * @endcode
+ *
+ * @param pluginFactory A function taking no arguments, and returning
+ * a pointer to an instance of a class derived from @ref
+ * openassetio.pluginSystem.CppPluginSystemPlugin
+ * "CppPluginSystemPlugin".
+ */
+#define OPENASSETIO_CPP_PLUGIN_ENTRY_POINT(pluginFactory)                                  \
+  extern "C" OPENASSETIO_DETAIL_PLUGIN_EXPORT ::openassetio::pluginSystem::PluginFactory \
+  OPENASSETIO_CPP_PLUGIN_ENTRY_POINT_NAME() noexcept {                                   \
+    return []() -> ::openassetio::pluginSystem::CppPluginSystemPluginPtr {               \
+      return pluginFactory();                                                            \
+    };                                                                                   \
+  }
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+OPENASSETIO_DECLARE_PTR(CppPluginSystemPlugin)
+
+/**
+ * The base class that defines a plugin of the C++ plugin system.
+ *
+ * Plugins are provided by shared libraries that expose an entry point
+ * (see @ref OPENASSETIO_CPP_PLUGIN_ENTRY_POINT), which returns a
+ * factory function that constructs an instance of a class derived
+ * from this.
+ *
+ * @see @ref CppPluginSystem
+ */
+class OPENASSETIO_CORE_EXPORT CppPluginSystemPlugin {
+ public:
+  OPENASSETIO_ALIAS_PTR(CppPluginSystemPlugin)
+
+  virtual ~CppPluginSystemPlugin();
+
+  /**
+   * Identifier that uniquely identifies this plugin. If there are
+   * duplicate plugins with the same identifier, the first one
+   * encountered will be used, and all others will be ignored.
+   */
+  [[nodiscard]] virtual Identifier identifier() const = 0;
+};
+
+/// Type of the factory function returned by a plugin's entry point.
+using PluginFactory = CppPluginSystemPluginPtr (*)();
+
+/// Name of the entry point function that plugins must expose.
+inline constexpr const char* kPluginEntryPointName =
+    OPENASSETIO_DETAIL_STRINGIFY(OPENASSETIO_CPP_PLUGIN_ENTRY_POINT_NAME);
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/export.h>
+#include <openassetio/trace/TracerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trace {
+OPENASSETIO_DECLARE_PTR(RingBufferTracer)
+/**
+ * A tracer that retains the most recently ended spans in memory.
+ *
+ * This is useful for in-process diagnostics, e.g. inspecting where
+ * time was spent after a slow operation, without exporting to an
+ * external tracing system.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT RingBufferTracer final : public TracerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RingBufferTracer)
+
+  /// Default maximum number of retained spans.
+  static constexpr std::size_t kDefaultCapacity = 1024;
+
+  /// An ended span.
+  struct Span {
+    /// Name of the span.
+    Str name;
+    /// Attributes provided when the span was begun and ended.
+    InfoDictionary attributes;
+    /// Time at which the span was begun.
+    std::chrono::system_clock::time_point startTime;
+    /// Time between the span being begun and ended.
+    std::chrono::nanoseconds duration;
+  };
+
+  /**
+   * Creates a new instance of the RingBufferTracer.
+   *
+   * @param capacity Maximum number of ended spans to retain, after
+   * which the oldest are discarded.
+   * @return Newly created instance wrapped in a `std::shared_ptr`.
+   * @exception errors.InputValidationException If the capacity is
+   * zero.
+   */
+  [[nodiscard]] static RingBufferTracerPtr make(std::size_t capacity = kDefaultCapacity);
+
+  SpanId beginSpan(const Str& name, const InfoDictionary& attributes) override;
+
+  void endSpan(SpanId spanId, const InfoDictionary& attributes) override;
+
+  /**
+   * Returns the retained spans, oldest first.
+   */
+  [[nodiscard]] std::vector<Span> spans() const;
+
+  /**
+   * Discards all retained spans.
+   */
+  void clear();
+
+ private:
+  explicit RingBufferTracer(std::size_t capacity);
+
+  /// A span that has begun but not yet ended.
+  struct ActiveSpan {
+    Span span;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  std::size_t capacity_;
+  mutable std::mutex mutex_;
+  SpanId nextSpanId_{0};
+  std::unordered_map<SpanId, ActiveSpan> activeSpans_;
+  std::deque<Span> spans_;
+};
+}  // namespace trace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstdint>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ This namespace contains code relevant to tracing the execution of
+ API calls.
+
+ @ref host "Host" authors can provide an implementation of @ref
+ TracerInterface, in order to export spans describing OpenAssetIO API
+ calls to a distributed tracing system, such as OpenTelemetry.
+*/
+namespace trace {
+OPENASSETIO_DECLARE_PTR(TracerInterface)
+/**
+ * An abstract base class that defines the receiving interface for
+ * spans describing the execution of API calls.
+ *
+ * A span is begun when an API call is made, and ended when it
+ * completes, with attributes describing the call, e.g. the manager
+ * involved and batch size, and its outcome, e.g. counts of successful
+ * and failed batch elements.
+ *
+ * The begin and end of a span are reported on the same thread, and
+ * spans on any one thread are ended in the reverse order to which they
+ * were begun. Implementations can therefore use a thread-local stack to
+ * determine the parent of a span, including any span that is active in
+ * the host's tracing system when the API call is made.
+ *
+ * A tracer is installed process-wide using @ref setGlobalTracer. When
+ * no tracer is installed, the only overhead of tracing is a check for
+ * the global tracer at the start of each API call.
+ *
+ * @note Implementations must be thread-safe, since API calls may be
+ * made concurrently from multiple threads.
+ */
+class OPENASSETIO_CORE_EXPORT TracerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(TracerInterface)
+
+  /// Identifier of a span, unique among a tracer's active spans.
+  using SpanId = std::uint64_t;
+
+  virtual ~TracerInterface() = 0;
+
+  /**
+   * Begins a span.
+   *
+   * @param name Name of the span, e.g. `"Manager.resolve"`.
+   *
+   * @param attributes Key/value attributes describing the span.
+   *
+   * @return Identifier for the span, to be provided to @ref endSpan.
+   */
+  virtual SpanId beginSpan(const Str& name, const InfoDictionary& attributes) = 0;
+
+  /**
+   * Ends a span.
+   *
+   * @param spanId Identifier of the span, as returned by @ref
+   * beginSpan.
+   *
+   * @param attributes Further key/value attributes describing the
+   * span, e.g. its outcome.
+   */
+  virtual void endSpan(SpanId spanId, const InfoDictionary& attributes) = 0;
+
+  /**
+   * Sets the tracer used for all API calls in the process.
+   *
+   * @param tracer The tracer, or null to disable tracing.
+   */
+  static void setGlobalTracer(TracerInterfacePtr tracer);
+
+  /**
+   * Returns the tracer used for all API calls in the process, if set.
+   */
+  [[nodiscard]] static TracerInterfacePtr globalTracer();
+};
+}  // namespace trace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
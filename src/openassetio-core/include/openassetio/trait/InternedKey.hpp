@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide interned handles for trait IDs and property keys.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/property.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+namespace property {
+/**
+ * A lightweight handle to an interned @ref Key string.
+ *
+ * Interning a string stores a single canonical copy of it in a
+ * process-wide registry. Any two handles constructed from equal
+ * strings refer to the same canonical copy, so comparison and hashing
+ * of handles is a pointer operation, rather than a string comparison.
+ *
+ * This makes handles well suited to hot code paths that repeatedly
+ * query the same @ref TraitsData properties. Typically a handle is
+ * constructed once, e.g. at static initialisation time by a trait
+ * view, and reused thereafter.
+ *
+ * @code
+ * static const trait::InternedTraitId kTraitId{"openassetio-mediacreation:content.LocatableContent"};
+ * static const trait::property::InternedKey kLocationKey{"location"};
+ *
+ * traitsData->getTraitProperty(&value, kTraitId, kLocationKey);
+ * @endcode
+ *
+ * Interned strings are never released, so the registry will grow with
+ * each unique string that is interned. This is appropriate for the
+ * bounded vocabulary of trait IDs and property keys, but interning
+ * arbitrary data should be avoided.
+ *
+ * Handles are trivially copyable, and interning is thread-safe. Each
+ * thread caches the strings it recently interned or found, so that
+ * repeated lookups of the same strings do not contend on the registry.
+ */
+class OPENASSETIO_CORE_EXPORT InternedKey final {
+ public:
+  /**
+   * Intern the given string, returning a handle to the canonical copy.
+   *
+   * @param key String to intern.
+   */
+  explicit InternedKey(const Key& key);
+
+  /**
+   * Retrieve a handle to a previously interned string, without
+   * interning it if it is not yet known.
+   *
+   * Unlike interning, this does not grow the registry, so is suitable
+   * for arbitrary, e.g. user-supplied, strings.
+   *
+   * @param key String to look up.
+   *
+   * @return Handle to the interned string, or an empty optional if
+   * the string has never been interned.
+   */
+  [[nodiscard]] static std::optional<InternedKey> find(const Key& key);
+
+  /**
+   * @return The canonical interned string.
+   */
+  [[nodiscard]] const Key& str() const { return *key_; }
+
+  /**
+   * Compare handles for equality.
+   *
+   * Equivalent to comparing the underlying strings, but only requires
+   * a pointer comparison.
+   */
+  bool operator==(const InternedKey& other) const { return key_ == other.key_; }
+
+  /// @see operator==
+  bool operator!=(const InternedKey& other) const { return key_ != other.key_; }
+
+  /**
+   * Provide a strict weak ordering of handles.
+   *
+   * Note that this ordering is arbitrary, i.e. it does not correspond
+   * to the lexicographical ordering of the underlying strings, and may
+   * differ between runs of the same program.
+   */
+  bool operator<(const InternedKey& other) const { return std::less<>{}(key_, other.key_); }
+
+ private:
+  explicit InternedKey(const Key* key) : key_{key} {}
+
+  // Owned by the process-wide registry.
+  const Key* key_;
+};
+}  // namespace property
+
+/**
+ * Interned handle for a @ref TraitId.
+ *
+ * @see property::InternedKey
+ */
+using InternedTraitId = property::InternedKey;
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+/**
+ * Hash for interned handles, allowing their use as keys in unordered
+ * containers.
+ */
+namespace std {
+template <>
+struct hash<openassetio::trait::property::InternedKey> {
+  std::size_t operator()(const openassetio::trait::property::InternedKey& key) const noexcept {
+    return std::hash<const void*>{}(&key.str());
+  }
+};
+}  // namespace std
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a compact bitset representation of trait sets.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+OPENASSETIO_DECLARE_PTR(TraitRegistry)
+OPENASSETIO_DECLARE_PTR(TraitsData)
+
+/**
+ * A compact representation of a @ref TraitSet, where each trait is
+ * represented by a single bit.
+ *
+ * The mapping of trait ID to bit position is provided by a @ref
+ * TraitRegistry. Bitsets are only meaningful, and comparable, when
+ * created from the same registry.
+ *
+ * Set algebra (subset, intersection, union tests) operates on whole
+ * machine words, so is far cheaper than the equivalent operations on
+ * a @ref TraitSet. This makes bitsets well suited to checking, e.g.,
+ * whether the traits of a @fqref{hostApi.Manager.managementPolicy}
+ * "managementPolicy" or @fqref{hostApi.Manager.entityTraits}
+ * "entityTraits" result satisfy a host's requirements.
+ */
+class OPENASSETIO_CORE_EXPORT TraitBitSet final {
+ public:
+  /// Construct an empty bitset.
+  TraitBitSet() = default;
+
+  /**
+   * Set the bit at the given position.
+   *
+   * @param index Bit position, as given by @ref TraitRegistry.index.
+   */
+  void set(std::size_t index);
+
+  /**
+   * Clear the bit at the given position.
+   *
+   * @param index Bit position, as given by @ref TraitRegistry.index.
+   */
+  void reset(std::size_t index);
+
+  /**
+   * @param index Bit position, as given by @ref TraitRegistry.index.
+   * @return Whether the bit at the given position is set.
+   */
+  [[nodiscard]] bool test(std::size_t index) const;
+
+  /// @return Number of set bits, i.e. number of traits.
+  [[nodiscard]] std::size_t count() const;
+
+  /// @return Whether no bits are set.
+  [[nodiscard]] bool empty() const { return words_.empty(); }
+
+  /**
+   * @return Whether all the bits set in this instance are also set in
+   * the other.
+   */
+  [[nodiscard]] bool isSubsetOf(const TraitBitSet& other) const;
+
+  /**
+   * @return Whether any bit is set in both this instance and the
+   * other.
+   */
+  [[nodiscard]] bool intersects(const TraitBitSet& other) const;
+
+  /// Set union.
+  TraitBitSet& operator|=(const TraitBitSet& other);
+
+  /// Set intersection.
+  TraitBitSet& operator&=(const TraitBitSet& other);
+
+  /// Compare for equality.
+  bool operator==(const TraitBitSet& other) const { return words_ == other.words_; }
+
+  /// Compare for inequality.
+  bool operator!=(const TraitBitSet& other) const { return words_ != other.words_; }
+
+ private:
+  friend class TraitRegistry;
+  using Word = std::uint64_t;
+  /// Remove trailing zero words, keeping the representation canonical.
+  void trim();
+
+  std::vector<Word> words_;
+};
+
+/**
+ * Mapping between trait IDs and bit positions in a @ref TraitBitSet.
+ *
+ * Bit positions are allocated sequentially as new trait IDs are
+ * encountered, and are stable for the lifetime of the registry.
+ * Typically, a host will hold a single registry for the duration of
+ * an API session, so that bitsets can be freely compared.
+ *
+ * All member functions are thread-safe.
+ */
+class OPENASSETIO_CORE_EXPORT TraitRegistry final {
+ public:
+  OPENASSETIO_ALIAS_PTR(TraitRegistry)
+
+  /**
+   * Construct an empty registry.
+   */
+  [[nodiscard]] static TraitRegistryPtr make();
+
+  /// Defaulted destructor.
+  ~TraitRegistry();
+
+  /**
+   * Get the bit position of a trait, allocating one if the trait has
+   * not been seen before.
+   *
+   * @param traitId ID of trait.
+   * @return Bit position.
+   */
+  std::size_t index(const TraitId& traitId);
+
+  /**
+   * Get the bit position of a trait, without allocating one.
+   *
+   * @param traitId ID of trait.
+   * @return Bit position, or an empty optional if the trait is not
+   * known to the registry.
+   */
+  [[nodiscard]] std::optional<std::size_t> find(const TraitId& traitId) const;
+
+  /**
+   * Get the trait ID for a bit position.
+   *
+   * @param index Bit position.
+   * @return ID of trait.
+   * @exception errors.InputValidationException If the position has
+   * not been allocated.
+   */
+  [[nodiscard]] TraitId traitId(std::size_t index) const;
+
+  /// @return Number of traits known to the registry.
+  [[nodiscard]] std::size_t size() const;
+
+  /**
+   * Convert a trait set to a bitset, registering any new trait IDs.
+   *
+   * @param traitSet Traits to convert.
+   * @return Equivalent bitset.
+   */
+  TraitBitSet toBitSet(const TraitSet& traitSet);
+
+  /**
+   * Convert the traits held by a TraitsData to a bitset, registering
+   * any new trait IDs.
+   *
+   * @param traitsData Traits to convert.
+   * @return Equivalent bitset.
+   */
+  TraitBitSet toBitSet(const TraitsData& traitsData);
+
+  /**
+   * Convert a bitset to a trait set.
+   *
+   * @param bitSet Bitset to convert.
+   * @return Equivalent trait set.
+   * @exception errors.InputValidationException If the bitset has a
+   * bit set that has not been allocated by this registry.
+   */
+  [[nodiscard]] TraitSet toTraitSet(const TraitBitSet& bitSet) const;
+
+ private:
+  TraitRegistry();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
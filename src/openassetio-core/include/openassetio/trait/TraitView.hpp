@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide statically typed trait views, described at compile time.
+ */
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/InternedKey.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/property.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+/**
+ * Compile-time description of a trait property, for use with
+ * @ref TraitView.
+ *
+ * @tparam T Type of the property's value. Must be one of the
+ * alternatives of @ref property::Value.
+ */
+template <class T>
+struct TraitPropertyDescriptor {
+  static_assert(std::is_same_v<T, Bool> || std::is_same_v<T, Int> ||
+                    std::is_same_v<T, Float> || std::is_same_v<T, Str>,
+                "Trait property type must be one of the property::Value alternatives");
+
+  /// Type of the property's value.
+  using Type = T;
+
+  /// Key of the property.
+  std::string_view key;
+};
+
+/**
+ * A statically typed view on a @ref TraitsData, for the trait given
+ * by a compile-time descriptor.
+ *
+ * The descriptor is a type with a `static constexpr std::string_view
+ * kId` member holding the trait's ID, and a `static constexpr`
+ * @ref TraitPropertyDescriptor member for each property, e.g.
+ *
+ * @code
+ * struct LocatableContentTrait {
+ *   static constexpr std::string_view kId{
+ *       "openassetio-mediacreation:content.LocatableContent"};
+ *   static constexpr trait::TraitPropertyDescriptor<Str> kLocation{"location"};
+ * };
+ * using LocatableContentView = trait::TraitView<LocatableContentTrait>;
+ *
+ * LocatableContentView view{traitsData};
+ * if (const Str* location = view.getView<LocatableContentTrait::kLocation>()) {
+ *   ...
+ * }
+ * @endcode
+ *
+ * Properties are named by template argument, so their value types
+ * are known at compile time, and mismatched types fail to compile.
+ * The trait ID and each property key are interned once per process,
+ * on first use, so access requires only pointer comparisons and a
+ * check of the stored value's type, rather than string lookups.
+ *
+ * This complements the runtime-extensible, code-generated views,
+ * which look up properties by string on every access.
+ *
+ * @tparam Descriptor Compile-time description of the trait.
+ */
+template <class Descriptor>
+class TraitView {
+ public:
+  /// Value type of the property with the given descriptor.
+  template <const auto& kProperty>
+  using PropertyType = typename std::decay_t<decltype(kProperty)>::Type;
+
+  /**
+   * Construct a view on the given data.
+   *
+   * @param traitsData Data to view. Must not be null.
+   */
+  explicit TraitView(TraitsDataPtr traitsData) : traitsData_{std::move(traitsData)} {}
+
+  /// @return The trait's ID.
+  [[nodiscard]] static constexpr std::string_view id() { return Descriptor::kId; }
+
+  /// @return Whether the viewed data has this trait.
+  [[nodiscard]] bool isImbued() const { return traitsData_->hasTrait(internedId()); }
+
+  /// Add this trait to the viewed data, if it does not already have it.
+  void imbue() const { traitsData_->addTrait(internedId()); }
+
+  /**
+   * Get a view of the value of a property, without copying it.
+   *
+   * @tparam kProperty Descriptor of the property to query.
+   * @return Pointer to the stored value, or `nullptr` if it is unset,
+   * or set with a value of the wrong type. The pointer is invalidated
+   * by any subsequent modification of the viewed data.
+   */
+  template <const auto& kProperty>
+  [[nodiscard]] const PropertyType<kProperty>* getView() const {
+    const property::Value* value =
+        traitsData_->getTraitPropertyView(internedId(), internedKey<kProperty>());
+    return value ? std::get_if<PropertyType<kProperty>>(value) : nullptr;
+  }
+
+  /**
+   * Get the value of a property.
+   *
+   * @tparam kProperty Descriptor of the property to query.
+   * @param[out] out Storage for the result, only written to if the
+   * property is set with a value of the correct type.
+   * @return Status of the property.
+   */
+  template <const auto& kProperty>
+  TraitPropertyStatus get(PropertyType<kProperty>* out) const {
+    const property::Value* value =
+        traitsData_->getTraitPropertyView(internedId(), internedKey<kProperty>());
+    if (!value) {
+      return TraitPropertyStatus::kMissing;
+    }
+    const auto* typedValue = std::get_if<PropertyType<kProperty>>(value);
+    if (!typedValue) {
+      return TraitPropertyStatus::kInvalidValue;
+    }
+    *out = *typedValue;
+    return TraitPropertyStatus::kFound;
+  }
+
+  /**
+   * Get the value of a property.
+   *
+   * @tparam kProperty Descriptor of the property to query.
+   * @return The value, or an empty optional if it is unset, or set
+   * with a value of the wrong type.
+   */
+  template <const auto& kProperty>
+  [[nodiscard]] std::optional<PropertyType<kProperty>> get() const {
+    if (const auto* value = getView<kProperty>()) {
+      return *value;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * Set the value of a property, imbuing the trait if needed.
+   *
+   * @tparam kProperty Descriptor of the property to set.
+   * @param value Value to set.
+   */
+  template <const auto& kProperty>
+  void set(PropertyType<kProperty> value) const {
+    traitsData_->setTraitProperty(internedId(), internedKey<kProperty>(), std::move(value));
+  }
+
+  /// @return The viewed data.
+  [[nodiscard]] const TraitsDataPtr& traitsData() const { return traitsData_; }
+
+ private:
+  static const InternedTraitId& internedId() {
+    static const InternedTraitId kInternedId{TraitId{Descriptor::kId}};
+    return kInternedId;
+  }
+
+  template <const auto& kProperty>
+  static const property::InternedKey& internedKey() {
+    static const property::InternedKey kInternedKey{property::Key{kProperty.key}};
+    return kInternedKey;
+  }
+
+  TraitsDataPtr traitsData_;
+};
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
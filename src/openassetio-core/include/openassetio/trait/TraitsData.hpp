@@ -6,10 +6,13 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <unordered_set>
 
 #include <openassetio/export.h>
+#include <openassetio/FunctionRef.hpp>
+#include <openassetio/trait/InternedKey.hpp>
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/trait/property.hpp>
 
@@ -82,10 +85,35 @@ class OPENASSETIO_CORE_EXPORT TraitsData final {
   /**
    * Construct such that this instance is a deep copy of the other.
    *
+   * The copy is made lazily: the new instance shares the other's
+   * storage until either instance is modified, at which point the
+   * modified instance takes a private copy. Copying an instance that
+   * is subsequently only read from is therefore cheap.
+   *
    * @param other The instance to copy.
    */
   [[nodiscard]] static TraitsDataPtr make(const TraitsDataConstPtr& other);
 
+  /**
+   * Construct many empty instances, with no traits, in a single
+   * allocation.
+   *
+   * This is more efficient than repeated calls to @ref make() when
+   * many instances are required at once, for example when a @ref
+   * manager populates the results of a large batch
+   * @fqref{managerApi.ManagerInterface.resolve} "resolve".
+   * Construction and destruction of such batches are significantly
+   * cheaper, since the instances share a single block of memory.
+   *
+   * Note that the shared memory block is only released once all of
+   * the returned instances have been destroyed.
+   *
+   * @param count Number of instances to create.
+   *
+   * @return List of `count` newly constructed instances.
+   */
+  [[nodiscard]] static TraitsDatas makeMany(std::size_t count);
+
   /**
    * Defaulted destructor.
    */
@@ -104,6 +132,17 @@ class OPENASSETIO_CORE_EXPORT TraitsData final {
    */
   [[nodiscard]] bool hasTrait(const trait::TraitId& traitId) const;
 
+  /**
+   * Return whether this instance has the given trait.
+   *
+   * Equivalent to the string overload, but avoids the cost of
+   * looking up the interned ID.
+   *
+   * @param traitId Interned ID of trait to check for.
+   * @return `true` if trait is present, `false` otherwise.
+   */
+  [[nodiscard]] bool hasTrait(const trait::InternedTraitId& traitId) const;
+
   /**
    * Add the specified trait to this instance.
    *
@@ -113,6 +152,15 @@ class OPENASSETIO_CORE_EXPORT TraitsData final {
    */
   void addTrait(const trait::TraitId& traitId);
 
+  /**
+   * Add the specified trait to this instance.
+   *
+   * If this instance already has this trait, it is a no-op.
+   *
+   * @param traitId Interned ID of the trait to add.
+   */
+  void addTrait(const trait::InternedTraitId& traitId);
+
   /**
    * Add the specified traits to this instance.
    *
@@ -138,6 +186,58 @@ class OPENASSETIO_CORE_EXPORT TraitsData final {
   bool getTraitProperty(trait::property::Value* out, const trait::TraitId& traitId,
                         const trait::property::Key& propertyKey) const;
 
+  /**
+   * Get the value of a given trait property, if the property has
+   * been set.
+   *
+   * Equivalent to the string overload, but lookup only requires
+   * pointer comparisons. Prefer this overload in hot code paths.
+   *
+   * @param[out] out Storage for result, only written to if the property
+   * is set.
+   * @param traitId Interned ID of trait to query.
+   * @param propertyKey Interned key of trait's property to query.
+   * @return `true` if value was found, `false` if it is unset.
+   */
+  bool getTraitProperty(trait::property::Value* out, const trait::InternedTraitId& traitId,
+                        const trait::property::InternedKey& propertyKey) const;
+
+  /**
+   * Get a view of the value of a given trait property, if the
+   * property has been set.
+   *
+   * Unlike @ref getTraitProperty, the value is not copied. This is
+   * particularly beneficial for string values, which can then be read
+   * without a heap allocation, e.g.
+   *
+   * @code
+   * if (const auto* value = traitsData->getTraitPropertyView(kTraitId, kKey)) {
+   *   if (const auto* str = std::get_if<openassetio::Str>(value)) {
+   *     ...
+   *   }
+   * }
+   * @endcode
+   *
+   * @warning The returned pointer is invalidated by any subsequent
+   * modification of this instance, and by its destruction.
+   *
+   * @param traitId ID of trait to query.
+   * @param propertyKey Key of trait's property to query.
+   * @return Pointer to the stored value, or `nullptr` if it is unset.
+   */
+  [[nodiscard]] const trait::property::Value* getTraitPropertyView(
+      const trait::TraitId& traitId, const trait::property::Key& propertyKey) const;
+
+  /**
+   * Get a view of the value of a given trait property, if the
+   * property has been set.
+   *
+   * @see getTraitPropertyView(const trait::TraitId&, const trait::property::Key&) const
+   */
+  [[nodiscard]] const trait::property::Value* getTraitPropertyView(
+      const trait::InternedTraitId& traitId,
+      const trait::property::InternedKey& propertyKey) const;
+
   /**
    * Set the value of given trait property.
    *
@@ -151,6 +251,56 @@ class OPENASSETIO_CORE_EXPORT TraitsData final {
   void setTraitProperty(const trait::TraitId& traitId, const trait::property::Key& propertyKey,
                         trait::property::Value propertyValue);
 
+  /**
+   * Set the value of given trait property.
+   *
+   * Equivalent to the string overload, but avoids the cost of
+   * interning the trait ID and property key.
+   *
+   * @param traitId Interned ID of trait to update.
+   * @param propertyKey Interned key of property to set.
+   * @param propertyValue Value to set.
+   */
+  void setTraitProperty(const trait::InternedTraitId& traitId,
+                        const trait::property::InternedKey& propertyKey,
+                        trait::property::Value propertyValue);
+
+  /**
+   * Set the values of multiple properties of a trait in a single call.
+   *
+   * Equivalent to calling @ref setTraitProperty for each element,
+   * but storage is reserved up front, making this more efficient when
+   * populating many properties.
+   *
+   * If the instance does not yet have this trait, it will be
+   * added by this call. If a key appears more than once, the last
+   * value wins.
+   *
+   * @code
+   * traitsData->setTraitProperties(kTraitId, {{"path", Str{"/a/b"}}, {"frame", Int{3}}});
+   * @endcode
+   *
+   * @param traitId ID of trait to update.
+   * @param properties Keys and associated values of properties to set.
+   */
+  void setTraitProperties(const trait::TraitId& traitId,
+                          const trait::property::KeyValues& properties);
+
+  /**
+   * Get the keys and values of all properties set for a trait in a
+   * single call.
+   *
+   * The supplied buffer is cleared before being populated, so
+   * existing capacity can be reused across calls to avoid
+   * reallocation. The order of the results is unspecified.
+   *
+   * @param[out] out Storage for result.
+   * @param traitId ID of trait to query.
+   * @return `true` if this instance has the trait, `false` otherwise.
+   * Note that a trait may be present without any properties set.
+   */
+  bool getTraitProperties(trait::property::KeyValues* out, const trait::TraitId& traitId) const;
+
   /**
    * Returns the properties set for a given trait.
    *
@@ -159,9 +309,157 @@ class OPENASSETIO_CORE_EXPORT TraitsData final {
    */
   [[nodiscard]] trait::property::KeySet traitPropertyKeys(const trait::TraitId& traitId) const;
 
+  /**
+   * Returns the properties set for a given trait.
+   *
+   * @see traitPropertyKeys(const trait::TraitId&) const
+   */
+  [[nodiscard]] trait::property::KeySet traitPropertyKeys(
+      const trait::InternedTraitId& traitId) const;
+
+  /// How @ref merge treats properties set in both instances.
+  enum class MergePolicy {
+    /// Values from the other instance replace existing values.
+    kOverwrite,
+    /// Existing values are kept.
+    kKeepExisting
+  };
+
+  /**
+   * Add the traits and properties of another instance to this one.
+   *
+   * This is equivalent to adding each of the other's traits, and
+   * setting each of its properties in turn (subject to the policy),
+   * but without interning or intermediate containers. Since both
+   * instances hold their traits and properties sorted, the cost is
+   * linear in their combined number of properties. If the other's
+   * traits and properties are already present, no allocation is made.
+   *
+   * Merging into an empty instance shares the other's storage, as
+   * for a copy, until either is modified.
+   *
+   * @code
+   * // Compose a locale from the least to most specific layer.
+   * const TraitsDataPtr locale = TraitsData::make(studioDefaults);
+   * locale->merge(*shotLocale);
+   * locale->merge(*taskLocale);
+   * @endcode
+   *
+   * @param other Instance whose traits and properties to add.
+   * @param policy How to treat properties set in both instances.
+   */
+  void merge(const TraitsData& other, MergePolicy policy = MergePolicy::kOverwrite);
+
+  /**
+   * @name Iteration
+   *
+   * Visit the traits and properties of this instance without
+   * constructing intermediate containers. These are preferable to
+   * @ref traitSet and @ref traitPropertyKeys when simply inspecting
+   * the contents of an instance.
+   *
+   * The order of visitation is unspecified. The visitor must not
+   * modify this instance. Visitors are taken as a @ref FunctionRef,
+   * so are not copied, and iteration does not allocate regardless of
+   * the size of their captures.
+   *
+   * @{
+   */
+
+  /// Callback type for @ref forEachTrait.
+  using TraitVisitor = FunctionRef<void(const trait::TraitId&)>;
+
+  /// Callback type for @ref forEachProperty.
+  using PropertyVisitor =
+      FunctionRef<void(const trait::property::Key&, const trait::property::Value&)>;
+
+  /// Callback type for the interned overload of @ref forEachTrait.
+  using InternedTraitVisitor = FunctionRef<void(const trait::InternedTraitId&)>;
+
+  /// Callback type for the interned overload of @ref forEachProperty.
+  using InternedPropertyVisitor =
+      FunctionRef<void(const trait::property::InternedKey&, const trait::property::Value&)>;
+
+  /**
+   * Call the given visitor with the ID of each trait held by this
+   * instance, including traits with no properties set.
+   *
+   * @param visitor Callable to receive each trait ID.
+   */
+  void forEachTrait(const TraitVisitor& visitor) const;
+
+  /**
+   * Call the given visitor with the interned ID of each trait held by
+   * this instance, including traits with no properties set.
+   *
+   * Equivalent to the string overload, but IDs can then be used to
+   * query other instances without further lookup.
+   *
+   * @param visitor Callable to receive each interned trait ID.
+   */
+  void forEachTrait(const InternedTraitVisitor& visitor) const;
+
+  /**
+   * Call the given visitor with the key and value of each property set
+   * for the given trait.
+   *
+   * If this instance does not have the trait, or the trait has no
+   * properties set, then the visitor is not called.
+   *
+   * @param traitId ID of trait to query.
+   * @param visitor Callable to receive each property key and value.
+   */
+  void forEachProperty(const trait::TraitId& traitId, const PropertyVisitor& visitor) const;
+
+  /**
+   * Call the given visitor with the interned key and value of each
+   * property set for the given trait.
+   *
+   * @see forEachProperty(const trait::TraitId&, const PropertyVisitor&) const
+   *
+   * @param traitId Interned ID of trait to query.
+   * @param visitor Callable to receive each property key and value.
+   */
+  void forEachProperty(const trait::InternedTraitId& traitId,
+                       const InternedPropertyVisitor& visitor) const;
+
+  /**
+   * @}
+   */
+
+  /**
+   * Return a hash of the traits and property values of this instance.
+   *
+   * The hash is maintained incrementally as the instance is modified,
+   * so this is a constant-time operation. Instances that compare
+   * equal have equal hashes. Note that the hash is only consistent
+   * within a single process.
+   *
+   * @see std::hash<openassetio::trait::TraitsData>
+   */
+  [[nodiscard]] std::size_t hash() const;
+
+  /**
+   * Estimate the memory used by this instance, in bytes.
+   *
+   * This includes the instance itself and its storage of traits and
+   * properties, including container overheads and the buffers of
+   * string values. Trait IDs and property keys are interned, so are
+   * shared process-wide and not included.
+   *
+   * Copies share storage until modified, so storage shared with other
+   * instances is included in full by each.
+   *
+   * @return Approximate number of bytes used.
+   */
+  [[nodiscard]] std::size_t memoryUsage() const;
+
   /**
    * Compares instances based on their trait and property values.
    *
+   * Instances with differing @ref hash "hashes" are rejected without
+   * comparing their contents.
+   *
    * @param other The instance to compare to.
    */
   bool operator==(const TraitsData& other) const;
@@ -171,9 +469,36 @@ class OPENASSETIO_CORE_EXPORT TraitsData final {
   explicit TraitsData(const trait::TraitSet& traitSet);
   TraitsData(const TraitsData& other);
 
+  struct Block;
+  struct Arena;
+
   class Impl;
-  std::unique_ptr<Impl> impl_;
+  /// Return storage for reading, which may be a shared empty instance.
+  [[nodiscard]] const Impl& impl() const;
+  /// Return storage safe to modify, copying shared storage if needed.
+  Impl& mutableImpl();
+  /**
+   * Storage, potentially shared with copies of this instance. Null
+   * until first modified.
+   */
+  std::shared_ptr<Impl> impl_;
 };
 }  // namespace trait
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
+
+/**
+ * Hash of the contents of a TraitsData, allowing its use in unordered
+ * containers, e.g. for memoising results keyed on TraitsData.
+ *
+ * Note that TraitsData is mutable, so an instance must not be modified
+ * whilst being used as a key.
+ */
+namespace std {
+template <>
+struct hash<openassetio::trait::TraitsData> {
+  std::size_t operator()(const openassetio::trait::TraitsData& traitsData) const {
+    return traitsData.hash();
+  }
+};
+}  // namespace std
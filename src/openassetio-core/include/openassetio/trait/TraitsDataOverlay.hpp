@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a read-only view layering several TraitsData.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/InternedKey.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+/**
+ * A read-only view of a stack of @ref TraitsData layers, as if they
+ * had been merged, but without copying any of them.
+ *
+ * The view has the union of the traits of its layers. The value of a
+ * property is taken from the highest (i.e. last added) layer in which
+ * it is set, matching the result of successively @ref
+ * TraitsData.merge "merging" each layer with the default
+ * @ref TraitsData.MergePolicy.kOverwrite "kOverwrite" policy.
+ *
+ * This suits composing, e.g., a locale from studio, shot and task
+ * layers, where only a handful of properties are read, or where the
+ * layers are shared by many views. Lookups cost a search of each
+ * layer, so where the result is read extensively, prefer @ref flatten.
+ *
+ * Layers are held, not copied, so modifications to a layer are visible
+ * through the view. None of the functions of this class should be
+ * considered thread-safe, except for concurrent reads.
+ */
+class OPENASSETIO_CORE_EXPORT TraitsDataOverlay final {
+ public:
+  /// Layers, in increasing order of precedence.
+  using Layers = std::vector<TraitsDataConstPtr>;
+
+  /// Construct a view with no layers, i.e. no traits.
+  TraitsDataOverlay() = default;
+
+  /**
+   * Construct a view of the given layers.
+   *
+   * @param layers Layers, in increasing order of precedence.
+   * @exception errors.InputValidationException If any layer is null.
+   */
+  explicit TraitsDataOverlay(Layers layers);
+
+  /**
+   * Add a layer, taking precedence over all existing layers.
+   *
+   * @param layer Layer to add.
+   * @exception errors.InputValidationException If the layer is null.
+   */
+  void addLayer(TraitsDataConstPtr layer);
+
+  /// @return Layers, in increasing order of precedence.
+  [[nodiscard]] const Layers& layers() const { return layers_; }
+
+  /**
+   * Return whether any layer has the given trait.
+   *
+   * @param traitId ID of trait to check for.
+   */
+  [[nodiscard]] bool hasTrait(const TraitId& traitId) const;
+
+  /// @see hasTrait(const TraitId&) const
+  [[nodiscard]] bool hasTrait(const InternedTraitId& traitId) const;
+
+  /**
+   * Get a view of the value of a trait property from the highest layer
+   * in which it is set.
+   *
+   * @warning The returned pointer is invalidated by any subsequent
+   * modification or destruction of the layer holding it.
+   *
+   * @param traitId ID of trait to query.
+   * @param propertyKey Key of trait's property to query.
+   * @return Pointer to the stored value, or `nullptr` if it is unset in
+   * every layer.
+   */
+  [[nodiscard]] const property::Value* getTraitPropertyView(
+      const TraitId& traitId, const property::Key& propertyKey) const;
+
+  /// @see getTraitPropertyView(const TraitId&, const property::Key&) const
+  [[nodiscard]] const property::Value* getTraitPropertyView(
+      const InternedTraitId& traitId, const property::InternedKey& propertyKey) const;
+
+  /**
+   * Get the value of a trait property from the highest layer in which
+   * it is set.
+   *
+   * @param[out] out Storage for result, only written to if the property
+   * is set.
+   * @param traitId ID of trait to query.
+   * @param propertyKey Key of trait's property to query.
+   * @return `true` if value was found, `false` if it is unset in every
+   * layer.
+   */
+  bool getTraitProperty(property::Value* out, const TraitId& traitId,
+                        const property::Key& propertyKey) const;
+
+  /// @return The union of the trait IDs of all layers.
+  [[nodiscard]] TraitSet traitSet() const;
+
+  /**
+   * Call the given visitor once with the ID of each trait held by any
+   * layer.
+   *
+   * The order of visitation is unspecified.
+   *
+   * @param visitor Callable to receive each trait ID.
+   */
+  void forEachTrait(const TraitsData::TraitVisitor& visitor) const;
+
+  /**
+   * Call the given visitor once with the key and effective value of
+   * each property set for the given trait in any layer.
+   *
+   * The order of visitation is unspecified.
+   *
+   * @param traitId ID of trait to query.
+   * @param visitor Callable to receive each property key and value.
+   */
+  void forEachProperty(const TraitId& traitId,
+                       const TraitsData::PropertyVisitor& visitor) const;
+
+  /**
+   * Construct a new instance holding the traits and effective
+   * property values of this view.
+   *
+   * The lowest layer is copied lazily, i.e. storage is shared until
+   * modified, and higher layers are merged into it.
+   *
+   * @return Newly constructed instance.
+   */
+  [[nodiscard]] TraitsDataPtr flatten() const;
+
+ private:
+  /// Whether a layer above the given index has the property set.
+  [[nodiscard]] bool isShadowed(std::size_t layerIdx, const InternedTraitId& traitId,
+                                const property::InternedKey& propertyKey) const;
+
+  Layers layers_;
+};
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a columnar container for the traits and properties of many
+ * entities that share a trait set.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+OPENASSETIO_DECLARE_PTR(TraitsData)
+
+/**
+ * A table of trait property values for a batch of entities that share
+ * a trait set, stored as a structure-of-arrays.
+ *
+ * Rather than a @ref TraitsData per entity, the table holds a single
+ * trait set, plus a column per trait property. Each column has a
+ * fixed type, a contiguous array of values with an element per row,
+ * and a validity bitmap recording which rows have a value set. This
+ * means a property can be scanned across all entities with linear
+ * access, and large batches need not allocate per entity.
+ *
+ * The traits that each row actually has are tracked separately, via a
+ * membership bitmap per trait, so that, e.g., the rows of entities
+ * that failed to resolve have no traits.
+ *
+ * The schema (i.e. the list of columns) grows on demand, as
+ * properties are set. Values of a column are only meaningful for rows
+ * whose validity bit is set.
+ *
+ * The table is intended to be reused across many batches. @ref reset
+ * retains the schema and previously allocated capacity, so once a
+ * table has grown to the size of the largest batch, further batches of
+ * fixed-width properties do not allocate.
+ *
+ * Per-row @ref TraitsData can be constructed via @ref row, for
+ * compatibility with code expecting the usual representation.
+ *
+ * None of the functions of this class should be considered
+ * thread-safe, except for concurrent reads.
+ *
+ * @see @fqref{hostApi.Manager.resolveColumnar} "Manager.resolveColumnar"
+ */
+class OPENASSETIO_CORE_EXPORT TraitsDataTable final {
+ public:
+  /**
+   * Storage of the values of a column holding properties of type `T`.
+   *
+   * Booleans are stored as one byte per row, with value 0 or 1, so
+   * that they are contiguous in memory.
+   */
+  template <class T>
+  using Column = std::vector<std::conditional_t<std::is_same_v<T, Bool>, std::uint8_t, T>>;
+
+  /// Construct an empty table, with no traits and no rows.
+  TraitsDataTable() = default;
+
+  /**
+   * Construct an empty table with the given traits.
+   *
+   * @param traitSet Traits of the batch.
+   */
+  explicit TraitsDataTable(TraitSet traitSet);
+
+  /**
+   * @return Traits of the batch, i.e. those given on construction or
+   * via @ref addTraits, plus any held by a row.
+   */
+  [[nodiscard]] const TraitSet& traitSet() const { return traitSet_; }
+
+  /**
+   * Add traits of the batch.
+   *
+   * Rows are unaffected, see @ref addTrait.
+   *
+   * @param traitSet Traits to add.
+   */
+  void addTraits(const TraitSet& traitSet);
+
+  /**
+   * Give a row a trait, e.g. one with no properties.
+   *
+   * Setting a property value implicitly gives the row its trait.
+   *
+   * @param row Index of row. Must be less than @ref rowCount.
+   * @param traitId ID of trait.
+   */
+  void addTrait(std::size_t row, const TraitId& traitId);
+
+  /**
+   * @param row Index of row.
+   * @param traitId ID of trait.
+   * @return Whether the row has the trait.
+   */
+  [[nodiscard]] bool hasTrait(std::size_t row, const TraitId& traitId) const;
+
+  /**
+   * Discard all values and resize to the given number of rows,
+   * retaining the traits, columns and allocated capacity.
+   *
+   * @param rowCount Number of rows, i.e. entities in the batch.
+   */
+  void reset(std::size_t rowCount);
+
+  /// @return Number of rows.
+  [[nodiscard]] std::size_t rowCount() const { return rowCount_; }
+
+  /// @return Number of columns, i.e. distinct trait properties.
+  [[nodiscard]] std::size_t columnCount() const { return columns_.size(); }
+
+  /**
+   * Add a column for a trait property of type `T`, if not already
+   * present.
+   *
+   * The trait is added to the table's traits, if not already present.
+   *
+   * @tparam T Type of property, one of the alternatives of @ref
+   * property::Value.
+   * @param traitId ID of trait.
+   * @param propertyKey Key of property.
+   * @return Index of the column.
+   * @exception errors.InputValidationException If the property already
+   * has a column of a different type.
+   */
+  template <class T>
+  std::size_t addColumn(const TraitId& traitId, const property::Key& propertyKey) {
+    return addColumn(traitId, propertyKey, ColumnValues{std::in_place_type<Column<T>>});
+  }
+
+  /**
+   * Find the column for a trait property.
+   *
+   * @param traitId ID of trait.
+   * @param propertyKey Key of property.
+   * @return Index of the column, if present.
+   */
+  [[nodiscard]] std::optional<std::size_t> findColumn(const TraitId& traitId,
+                                                      const property::Key& propertyKey) const;
+
+  /**
+   * @param column Index of column.
+   * @return ID of the trait whose property the column holds.
+   */
+  [[nodiscard]] const TraitId& columnTraitId(std::size_t column) const;
+
+  /**
+   * @param column Index of column.
+   * @return Key of the property the column holds.
+   */
+  [[nodiscard]] const property::Key& columnPropertyKey(std::size_t column) const;
+
+  /**
+   * Set the value of a property for a row, and give the row the
+   * property's trait.
+   *
+   * @param row Index of row. Must be less than @ref rowCount.
+   * @param column Index of column.
+   * @param value Value of property.
+   * @return `false`, leaving the row unchanged, if the type of the
+   * value does not match the type of the column.
+   */
+  bool setValue(std::size_t row, std::size_t column, property::Value value);
+
+  /**
+   * Access the values of a column.
+   *
+   * Values are only meaningful for rows that are @ref isValid "valid".
+   *
+   * @tparam T Type of property held by the column.
+   * @param column Index of column.
+   * @return Values of the column, an element per row.
+   * @exception errors.InputValidationException If the column does not
+   * hold properties of type `T`.
+   */
+  template <class T>
+  [[nodiscard]] const Column<T>& values(const std::size_t column) const {
+    if (const auto* typedValues = std::get_if<Column<T>>(&columns_[column].values)) {
+      return *typedValues;
+    }
+    throwTypeMismatch(column);
+  }
+
+  /**
+   * @param row Index of row.
+   * @param column Index of column.
+   * @return Whether the row has a value for the column's property.
+   */
+  [[nodiscard]] bool isValid(std::size_t row, std::size_t column) const;
+
+  /**
+   * Access the validity bitmap of a column.
+   *
+   * Bit `row % 64` of word `row / 64` is set if the row has a value
+   * for the column's property.
+   *
+   * @param column Index of column.
+   * @return Validity bitmap of the column.
+   */
+  [[nodiscard]] const std::vector<std::uint64_t>& validity(std::size_t column) const;
+
+  /**
+   * Replace the values of a row with the properties of a @ref
+   * TraitsData.
+   *
+   * Columns are added for properties that don't yet have one, and the
+   * traits of the TraitsData are added to the table's traits.
+   *
+   * @param row Index of row. Must be less than @ref rowCount.
+   * @param traitsData Traits and properties of the row.
+   * @return `false`, leaving the row empty, if a property's type does
+   * not match the type of its existing column.
+   */
+  bool setRow(std::size_t row, const TraitsData& traitsData);
+
+  /**
+   * Replace the values of consecutive rows with the rows of another
+   * table.
+   *
+   * Columns are added for properties that don't yet have one, and the
+   * traits of the other table are added to this table's traits.
+   *
+   * @param firstRow Index of the row to receive the first row of the
+   * other table.
+   * @param other Table to copy rows from.
+   * @return Indices of the rows of this table that are left empty,
+   * since they would hold a value of a column whose type does not
+   * match the type of the corresponding existing column.
+   * @exception errors.InputValidationException If the rows don't fit
+   * within this table.
+   */
+  std::vector<std::size_t> setRows(std::size_t firstRow, const TraitsDataTable& other);
+
+  /**
+   * Construct a @ref TraitsData holding the traits and properties of a
+   * row.
+   *
+   * @param row Index of row.
+   * @return Newly constructed TraitsData.
+   */
+  [[nodiscard]] TraitsDataPtr row(std::size_t row) const;
+
+ private:
+  using ColumnValues = std::variant<Column<Bool>, Column<Int>, Column<Float>, Column<Str>>;
+  static_assert(std::variant_size_v<ColumnValues> == std::variant_size_v<property::Value>);
+
+  struct TraitRows {
+    TraitId traitId;
+    /// Bitmap of the rows that have the trait.
+    std::vector<std::uint64_t> membership;
+  };
+
+  struct ColumnData {
+    TraitId traitId;
+    /// Index of the trait's entry in traitRows_.
+    std::size_t traitIdx;
+    property::Key propertyKey;
+    /// Values, whose alternative corresponds to that of the property
+    /// type in property::Value.
+    ColumnValues values;
+    std::vector<std::uint64_t> validity;
+  };
+
+  std::size_t addColumn(const TraitId& traitId, const property::Key& propertyKey,
+                        ColumnValues prototype);
+
+  /**
+   * Find the column for a trait property, starting the search at a
+   * given column, since consecutive lookups tend to be for consecutive
+   * columns.
+   */
+  [[nodiscard]] std::optional<std::size_t> findColumnFrom(const TraitId& traitId,
+                                                          const property::Key& propertyKey,
+                                                          std::size_t start) const;
+
+  /// Find the membership of a trait.
+  [[nodiscard]] std::optional<std::size_t> findTrait(const TraitId& traitId) const;
+
+  /// Find the membership of a trait, adding it if not yet present.
+  std::size_t traitIndex(const TraitId& traitId);
+
+  /// Remove all values and traits of a row.
+  void clearRow(std::size_t row);
+
+  [[noreturn]] void throwTypeMismatch(std::size_t column) const;
+
+  TraitSet traitSet_;
+  std::size_t rowCount_ = 0;
+  std::vector<TraitRows> traitRows_;
+  std::vector<ColumnData> columns_;
+};
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
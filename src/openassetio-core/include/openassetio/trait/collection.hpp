@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -26,6 +28,27 @@ namespace trait {
  */
 using TraitSet = std::unordered_set<TraitId>;
 
+/**
+ * Hash function object for a @ref TraitSet.
+ *
+ * Allows trait sets to be used as keys in unordered containers, e.g.
+ * `std::unordered_map<TraitSet, TraitsDataPtr, TraitSetHash>`. The
+ * hash is independent of the iteration order of the set.
+ */
+struct OPENASSETIO_CORE_EXPORT TraitSetHash {
+  std::size_t operator()(const TraitSet& traitSet) const noexcept;
+};
+
+/**
+ * A subset of the properties of some traits, keyed by trait ID.
+ *
+ * Used to request that only particular properties of a trait are
+ * populated, e.g. only the `location` of a `LocatableContent` trait.
+ * Traits that are not present are unrestricted. A trait mapped to an
+ * empty set of keys requires no properties.
+ */
+using PropertyProjection = std::unordered_map<TraitId, property::KeySet>;
+
 /**
  * An ordered list of trait sets.
  */
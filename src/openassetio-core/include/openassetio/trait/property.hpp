@@ -7,7 +7,9 @@
 
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
@@ -49,6 +51,15 @@ using Value = std::variant<Bool, Int, Float, Str>;
  */
 using KeySet = std::unordered_set<Key>;
 
+/// A property key paired with a value for that property.
+using KeyValue = std::pair<Key, Value>;
+
+/**
+ * A list of property key/value pairs, used for bulk access of the
+ * properties of a trait.
+ */
+using KeyValues = std::vector<KeyValue>;
+
 }  // namespace property
 
 /**
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Provide a binary wire format for @ref TraitsData.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/FunctionRef.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+/**
+ * Binary serialisation of @ref TraitsData.
+ *
+ * The wire format is compact, versioned and independent of host
+ * endianness, such that a buffer can be written to disk, sent to
+ * another process, or passed across the C ABI as an opaque block of
+ * bytes.
+ *
+ * A buffer begins with a fixed 8 byte header: the four byte magic
+ * `OATD`, a little-endian `uint16` format version (currently
+ * @ref kFormatVersion), and a `uint16` that is reserved and must be
+ * zero. The header is followed by the payload.
+ *
+ * For a single @ref TraitsData, the payload is a single record. For
+ * @ref TraitsDatas, the payload is a `uint32` record count, followed by
+ * each record prefixed by its `uint32` length in bytes, allowing
+ * records to be skipped without being parsed.
+ *
+ * A record is a `uint32` trait count followed by, for each trait, the
+ * trait ID string, a `uint32` property count and, for each property,
+ * the key string, a `uint8` type tag and the value. Strings are a
+ * `uint32` length followed by UTF-8 bytes (not null terminated). Ints
+ * are `int64`, Floats are IEEE 754 `binary64`, and Bools are a single
+ * byte. All multi-byte integers are little-endian.
+ *
+ * The order of traits and properties within a record is unspecified.
+ */
+namespace serialization {
+/// Serialised byte buffer.
+using Bytes = std::vector<std::byte>;
+
+/// Current version of the binary format.
+constexpr std::uint16_t kFormatVersion = 1;
+
+/**
+ * Serialise a TraitsData to a new buffer.
+ *
+ * @param traitsData Instance to serialise.
+ * @return Serialised bytes.
+ */
+OPENASSETIO_CORE_EXPORT Bytes serialize(const TraitsData& traitsData);
+
+/**
+ * Serialise a list of TraitsData to a new buffer.
+ *
+ * @param traitsDatas Instances to serialise. Must not contain null
+ * pointers.
+ * @return Serialised bytes.
+ * @exception errors.InputValidationException If a list element is
+ * null.
+ */
+OPENASSETIO_CORE_EXPORT Bytes serialize(const TraitsDatas& traitsDatas);
+
+/**
+ * Deserialise a TraitsData from a buffer created by @ref serialize.
+ *
+ * @param data Start of buffer.
+ * @param size Size of buffer in bytes.
+ * @return New TraitsData instance.
+ * @exception errors.InputValidationException If the buffer is
+ * malformed or of an unsupported version.
+ */
+OPENASSETIO_CORE_EXPORT TraitsDataPtr deserialize(const std::byte* data, std::size_t size);
+
+/**
+ * Deserialise a list of TraitsData from a buffer created by @ref
+ * serialize.
+ *
+ * @param data Start of buffer.
+ * @param size Size of buffer in bytes.
+ * @return New TraitsData instances.
+ * @exception errors.InputValidationException If the buffer is
+ * malformed or of an unsupported version.
+ */
+OPENASSETIO_CORE_EXPORT TraitsDatas deserializeMany(const std::byte* data, std::size_t size);
+
+/**
+ * A read-only, zero-copy view of a single serialised TraitsData
+ * record.
+ *
+ * The view does not own the underlying buffer, which must outlive it.
+ * The buffer is validated on construction, so queries will not throw.
+ *
+ * String arguments and results refer directly to the buffer, so
+ * inspecting a record requires no allocation, other than when
+ * extracting string property values.
+ */
+class OPENASSETIO_CORE_EXPORT TraitsDataView final {
+ public:
+  /// Callback type for @ref forEachTrait.
+  using TraitVisitor = FunctionRef<void(std::string_view)>;
+
+  /**
+   * Construct a view of a buffer created by @ref serialize.
+   *
+   * @param data Start of buffer.
+   * @param size Size of buffer in bytes.
+   * @exception errors.InputValidationException If the buffer is
+   * malformed or of an unsupported version.
+   */
+  TraitsDataView(const std::byte* data, std::size_t size);
+
+  /// @return Number of traits in the record.
+  [[nodiscard]] std::size_t traitCount() const { return traitCount_; }
+
+  /**
+   * @param traitId ID of trait to query.
+   * @return Whether the record contains the trait.
+   */
+  [[nodiscard]] bool hasTrait(std::string_view traitId) const;
+
+  /**
+   * Call the given visitor with the ID of each trait in the record.
+   *
+   * @param visitor Callable to receive each trait ID.
+   */
+  void forEachTrait(const TraitVisitor& visitor) const;
+
+  /**
+   * Extract the value of a property.
+   *
+   * @param[out] out Storage for value, if property is found.
+   * @param traitId ID of trait to query.
+   * @param propertyKey Key of property to query.
+   * @return Whether the property was found.
+   */
+  bool getTraitProperty(property::Value* out, std::string_view traitId,
+                        std::string_view propertyKey) const;
+
+  /**
+   * Construct a TraitsData instance holding a copy of the viewed data.
+   *
+   * @return New TraitsData instance.
+   */
+  [[nodiscard]] TraitsDataPtr toTraitsData() const;
+
+ private:
+  friend class TraitsDatasView;
+  struct RecordTag {};
+  TraitsDataView(RecordTag, const std::byte* record, std::size_t size);
+
+  const std::byte* record_;
+  std::size_t size_;
+  std::size_t traitCount_;
+};
+
+/**
+ * A read-only, zero-copy view of a serialised list of TraitsData
+ * records.
+ *
+ * The view does not own the underlying buffer, which must outlive it.
+ * The buffer is validated on construction, so element access will not
+ * throw, other than for out of range indices.
+ */
+class OPENASSETIO_CORE_EXPORT TraitsDatasView final {
+ public:
+  /**
+   * Construct a view of a buffer created by @ref serialize.
+   *
+   * @param data Start of buffer.
+   * @param size Size of buffer in bytes.
+   * @exception errors.InputValidationException If the buffer is
+   * malformed or of an unsupported version.
+   */
+  TraitsDatasView(const std::byte* data, std::size_t size);
+
+  /// @return Number of records.
+  [[nodiscard]] std::size_t size() const { return records_.size(); }
+
+  /**
+   * @param index Index of record.
+   * @return View of record.
+   * @exception errors.InputValidationException If the index is out of
+   * range.
+   */
+  [[nodiscard]] TraitsDataView at(std::size_t index) const;
+
+ private:
+  struct Record {
+    const std::byte* data;
+    std::size_t size;
+  };
+  std::vector<Record> records_;
+};
+}  // namespace serialization
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include <openassetio/FlatStrMap.hpp>
 #include <openassetio/export.h>
 
 namespace openassetio {
@@ -51,8 +52,12 @@ using Str = std::string;
 
 /**
  * Map/Dict of string to string.
+ *
+ * Stored as a sorted, contiguous array of entries.
+ *
+ * @see FlatStrMap
  */
-using StrMap = std::unordered_map<Str, Str>;
+using StrMap = FlatStrMap<Str>;
 
 /**
  * @}
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <utility>
+
+#include <openassetio/CancellationToken.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+CancellationTokenPtr CancellationToken::make() {
+  return std::shared_ptr<CancellationToken>(new CancellationToken(std::nullopt, nullptr));
+}
+
+CancellationTokenPtr CancellationToken::make(const Clock::time_point deadline) {
+  return std::shared_ptr<CancellationToken>(new CancellationToken(deadline, nullptr));
+}
+
+CancellationTokenPtr CancellationToken::makeChild(CancellationTokenConstPtr parent) {
+  if (!parent) {
+    throw errors::InputValidationException{"CancellationToken parent cannot be null"};
+  }
+  std::optional<Clock::time_point> deadline = parent->deadline();
+  return std::shared_ptr<CancellationToken>(new CancellationToken(deadline, std::move(parent)));
+}
+
+CancellationToken::CancellationToken(const std::optional<Clock::time_point> deadline,
+                                     CancellationTokenConstPtr parent)
+    : deadline_{deadline}, parent_{std::move(parent)} {}
+
+void CancellationToken::cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+bool CancellationToken::isCancelled() const {
+  if (cancelled_.load(std::memory_order_relaxed)) {
+    return true;
+  }
+  if (parent_ && parent_->isCancelled()) {
+    return true;
+  }
+  return deadline_ && Clock::now() >= *deadline_;
+}
+
+std::optional<CancellationToken::Clock::time_point> CancellationToken::deadline() const {
+  return deadline_;
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
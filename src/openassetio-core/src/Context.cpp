@@ -1,7 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <cstdint>
+#include <functional>
+
 #include <openassetio/Context.hpp>
 
+#include "trait/hashing.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 ContextPtr Context::make(trait::TraitsDataPtr locale,
@@ -11,5 +16,25 @@ ContextPtr Context::make(trait::TraitsDataPtr locale,
 
 Context::Context(trait::TraitsDataPtr locale_, managerApi::ManagerStateBasePtr managerState_)
     : locale{std::move(locale_)}, managerState{std::move(managerState_)} {}
+
+std::size_t Context::memoryUsage() const {
+  return sizeof(Context) + (locale ? locale->memoryUsage() : 0);
+}
+
+ContextConstPtr Context::freeze() const {
+  ContextPtr snapshot =
+      make(locale ? trait::TraitsData::make(locale) : trait::TraitsDataPtr{}, managerState);
+  snapshot->cancellationToken = cancellationToken;
+  snapshot->priority = priority;
+  return snapshot;
+}
+
+std::size_t Context::fingerprint() const {
+  // NOLINTBEGIN(readability-magic-numbers)
+  std::uint64_t combined = locale ? locale->hash() : 0U;
+  combined = combined * 31U + std::hash<const void*>{}(managerState.get());
+  // NOLINTEND(readability-magic-numbers)
+  return trait::mixHash(combined);
+}
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/EntityReferenceBatch.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+EntityReferenceBatch::EntityReferenceBatch() : offsets_{0} {}
+
+EntityReferenceBatch::EntityReferenceBatch(const EntityReferences& entityReferences)
+    : EntityReferenceBatch{} {
+  std::size_t totalLength = 0;
+  for (const EntityReference& entityReference : entityReferences) {
+    totalLength += entityReference.toString().size();
+  }
+  reserve(entityReferences.size(), totalLength);
+  for (const EntityReference& entityReference : entityReferences) {
+    append(entityReference.toString());
+  }
+}
+
+void EntityReferenceBatch::reserve(const std::size_t count, const std::size_t totalLength) {
+  offsets_.reserve(count + 1);
+  buffer_.reserve(totalLength);
+}
+
+void EntityReferenceBatch::append(const std::string_view entityReferenceString) {
+  buffer_.append(entityReferenceString);
+  offsets_.push_back(buffer_.size());
+}
+
+std::size_t EntityReferenceBatch::size() const { return offsets_.size() - 1; }
+
+bool EntityReferenceBatch::empty() const { return size() == 0; }
+
+std::string_view EntityReferenceBatch::operator[](const std::size_t index) const {
+  return std::string_view{buffer_}.substr(offsets_[index], offsets_[index + 1] - offsets_[index]);
+}
+
+EntityReference EntityReferenceBatch::entityReference(const std::size_t index) const {
+  if (index >= size()) {
+    throw errors::InputValidationException{
+        fmt::format("Index {} out of range for batch of size {}", index, size())};
+  }
+  return EntityReference{Str{(*this)[index]}};
+}
+
+EntityReferences EntityReferenceBatch::toEntityReferences() const {
+  EntityReferences entityReferences;
+  entityReferences.reserve(size());
+  for (std::size_t index = 0; index < size(); ++index) {
+    entityReferences.emplace_back(Str{(*this)[index]});
+  }
+  return entityReferences;
+}
+
+bool EntityReferenceBatch::operator==(const EntityReferenceBatch& other) const {
+  return offsets_ == other.offsets_ && buffer_ == other.buffer_;
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
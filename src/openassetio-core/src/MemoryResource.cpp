@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <openassetio/MemoryResource.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local MemoryResourceInterface* tCurrentResource = nullptr;
+}  // namespace
+
+MemoryResourceInterface::~MemoryResourceInterface() = default;
+
+ScopedMemoryResource::ScopedMemoryResource(MemoryResourceInterface* resource) noexcept
+    : previous_{tCurrentResource} {
+  if (resource != nullptr) {
+    tCurrentResource = resource;
+  }
+}
+
+ScopedMemoryResource::~ScopedMemoryResource() { tCurrentResource = previous_; }
+
+MemoryResourceInterface* ScopedMemoryResource::current() noexcept { return tCurrentResource; }
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
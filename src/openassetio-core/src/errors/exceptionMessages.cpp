@@ -4,6 +4,7 @@
 #include "exceptionMessages.hpp"
 
 #include <cassert>
+#include <utility>
 
 #include <fmt/core.h>
 
@@ -11,7 +12,7 @@ namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace errors {
 
-Str errorCodeName(BatchElementError::ErrorCode code) {
+std::string_view errorCodeName(BatchElementError::ErrorCode code) {
   switch (code) {
     case BatchElementError::ErrorCode::kUnknown:
       return "unknown";
@@ -27,6 +28,8 @@ Str errorCodeName(BatchElementError::ErrorCode code) {
       return "invalidPreflightHint";
     case BatchElementError::ErrorCode::kInvalidTraitSet:
       return "invalidTraitSet";
+    case BatchElementError::ErrorCode::kCancelled:
+      return "cancelled";
   }
 
   assert(false);  // Impossible case.
@@ -46,17 +49,22 @@ std::string createBatchElementExceptionMessage(const BatchElementError& err, siz
    *
    * Ends up looking something like : "entityAccessError: Could not
    * access Entity [index=2] [access=read] [entity=bal:///entityRef]"
+   *
+   * Formatted in a single pass, to avoid intermediate strings.
    */
-  const auto errorCodeStr = fmt::format("{}:", errorCodeName(err.code));
-  const auto errorMessageStr = err.message.empty() ? "" : fmt::format(" {}", err.message);
-
-  // Data elements
-  const auto indexStr = fmt::format(" [index={}]", index);
-  const auto accessStr = fmt::format(" [access={}]", access::kAccessNames[access]);
-  const auto entityReferenceStr = fmt::format(" [entity={}]", entityReference.toString());
+  return fmt::format("{}:{}{} [index={}] [access={}] [entity={}]", errorCodeName(err.code),
+                     err.message.empty() ? "" : " ", err.message, index,
+                     access::kAccessNames[access], entityReference.toString());
+}
 
-  return fmt::format("{}{}{}{}{}", errorCodeStr, errorMessageStr, indexStr, accessStr,
-                     entityReferenceStr);
+BatchElementException createBatchElementException(BatchElementError err, size_t index,
+                                                  EntityReference entityReference,
+                                                  internal::access::Access access) {
+  return {index, std::move(err),
+          [entityReference = std::move(entityReference), access](
+              const std::size_t errIndex, const BatchElementError& error) {
+            return createBatchElementExceptionMessage(error, errIndex, entityReference, access);
+          }};
 }
 }  // namespace errors
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
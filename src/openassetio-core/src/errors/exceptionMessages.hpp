@@ -4,22 +4,33 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/access.hpp>
 #include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/internal.hpp>
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace errors {
 /**Get an error code name as a printable string*/
-Str errorCodeName(BatchElementError::ErrorCode code);
+std::string_view errorCodeName(BatchElementError::ErrorCode code);
 
 /**Construct a full message to place into a convenience exception.*/
 std::string createBatchElementExceptionMessage(const BatchElementError& err, size_t index,
                                                const EntityReference& entityReference,
                                                internal::access::Access access);
+
+/**
+ * Construct a convenience exception for a batch element error, whose
+ * message is only formatted (by createBatchElementExceptionMessage) if
+ * it is retrieved.
+ */
+BatchElementException createBatchElementException(BatchElementError err, size_t index,
+                                                  EntityReference entityReference,
+                                                  internal::access::Access access);
 }  // namespace errors
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
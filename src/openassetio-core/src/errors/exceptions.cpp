@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <exception>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace errors {
+/**
+ * Message of a BatchElementException, formatted on first use.
+ *
+ * Held by pointer so that copies of the exception, e.g. via
+ * `std::exception_ptr`, share the result, and copying remains
+ * non-throwing.
+ */
+struct BatchElementException::LazyMessage {
+  explicit LazyMessage(MessageFormatter formatter) : formatMessage{std::move(formatter)} {}
+
+  MessageFormatter formatMessage;
+  std::once_flag formatted;
+  std::string message;
+};
+
+BatchElementException::BatchElementException(const std::size_t idx, BatchElementError err,
+                                             MessageFormatter formatMessage)
+    : OpenAssetIOException{""},
+      index{idx},
+      error{std::move(err)},
+      lazyMessage_{std::make_shared<LazyMessage>(std::move(formatMessage))} {}
+
+const char* BatchElementException::what() const noexcept {
+  if (!lazyMessage_) {
+    return OpenAssetIOException::what();
+  }
+  try {
+    std::call_once(lazyMessage_->formatted, [this] {
+      lazyMessage_->message = lazyMessage_->formatMessage(index, error);
+    });
+  } catch (const std::exception&) {
+    // Formatting is retried on the next call.
+    return error.message.c_str();
+  }
+  return lazyMessage_->message.c_str();
+}
+}  // namespace errors
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
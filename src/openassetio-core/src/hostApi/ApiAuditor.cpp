@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/hostApi/ApiAuditor.hpp>
+
+#include "../internal/threadIndex.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+/// Number of independently updated shards.
+constexpr std::size_t kShardCount = 16;
+
+/**
+ * Counts of all methods of all APIs, updated by a subset of threads.
+ *
+ * Aligned to (a typical) cache line size, so that threads recording
+ * to different shards don't falsely share.
+ */
+struct alignas(64) Shard {  // NOLINT(readability-magic-numbers)
+  std::array<std::array<std::atomic<std::uint64_t>, ApiAuditor::kMethodNames.size()>,
+             ApiAuditor::kApiNames.size()>
+      counts{};
+};
+
+/// Whether the environment requests auditing, as for the Python
+/// auditor.
+bool isEnabledByEnvironment() {
+  const char* envValue = std::getenv("OPENASSETIO_AUDIT");
+  return envValue != nullptr && std::string_view{envValue} != "0";
+}
+}  // namespace
+
+class ApiAuditor::Impl {
+ public:
+  Impl() {
+    shards_.reserve(kShardCount);
+    for (std::size_t idx = 0; idx < kShardCount; ++idx) {
+      shards_.push_back(std::make_unique<Shard>());
+    }
+  }
+
+  void record(const Api api, const Method method) {
+    Shard& shard = *shards_[internal::threadIndex() % shards_.size()];
+    shard.counts[static_cast<std::size_t>(api)][static_cast<std::size_t>(method)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] std::uint64_t count(const std::size_t apiIdx, const std::size_t methodIdx) const {
+    std::uint64_t total = 0;
+    for (const auto& shard : shards_) {
+      total += shard->counts[apiIdx][methodIdx].load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  void reset() {
+    for (const auto& shard : shards_) {
+      for (auto& apiCounts : shard->counts) {
+        for (auto& methodCount : apiCounts) {
+          methodCount.store(0, std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+ private:
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+const ApiAuditorPtr& ApiAuditor::instance() {
+  static const ApiAuditorPtr kInstance{new ApiAuditor};
+  return kInstance;
+}
+
+ApiAuditor::ApiAuditor()
+    : impl_{std::make_unique<Impl>()}, isEnabled_{isEnabledByEnvironment()} {}
+
+ApiAuditor::~ApiAuditor() = default;
+
+void ApiAuditor::setEnabled(const bool enabled) {
+  isEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void ApiAuditor::recordCall(const Api api, const Method method) {
+  if (isEnabled()) {
+    impl_->record(api, method);
+  }
+}
+
+std::uint64_t ApiAuditor::callCount(const Api api, const Method method) const {
+  return impl_->count(static_cast<std::size_t>(api), static_cast<std::size_t>(method));
+}
+
+ApiAuditor::Coverage ApiAuditor::coverage() const {
+  Coverage result;
+  for (std::size_t apiIdx = 0; apiIdx < kApiNames.size(); ++apiIdx) {
+    for (std::size_t methodIdx = 0; methodIdx < kMethodNames.size(); ++methodIdx) {
+      if (const std::uint64_t count = impl_->count(apiIdx, methodIdx); count != 0) {
+        result[kApiNames[apiIdx]][kMethodNames[methodIdx]] = count;
+      }
+    }
+  }
+  return result;
+}
+
+void ApiAuditor::reset() { impl_->reset(); }
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,373 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <openassetio/hostApi/ApiAuditor.hpp>
+#include <openassetio/hostApi/AuditingManagerInterface.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+void recordCall(const ApiAuditor::Method method) {
+  ApiAuditor::instance()->recordCall(ApiAuditor::Api::kManagerInterface, method);
+}
+}  // namespace
+
+AuditingManagerInterfacePtr AuditingManagerInterface::make(
+    managerApi::ManagerInterfacePtr proxied) {
+  return AuditingManagerInterfacePtr{new AuditingManagerInterface{std::move(proxied)}};
+}
+
+AuditingManagerInterface::AuditingManagerInterface(managerApi::ManagerInterfacePtr proxied)
+    : ProxyManagerInterface{std::move(proxied)} {}
+
+Identifier AuditingManagerInterface::identifier() const {
+  recordCall(ApiAuditor::Method::kIdentifier);
+  return ProxyManagerInterface::identifier();
+}
+
+Str AuditingManagerInterface::displayName() const {
+  recordCall(ApiAuditor::Method::kDisplayName);
+  return ProxyManagerInterface::displayName();
+}
+
+bool AuditingManagerInterface::hasCapability(const Capability capability) {
+  recordCall(ApiAuditor::Method::kHasCapability);
+  return ProxyManagerInterface::hasCapability(capability);
+}
+
+InfoDictionary AuditingManagerInterface::info() {
+  recordCall(ApiAuditor::Method::kInfo);
+  return ProxyManagerInterface::info();
+}
+
+StrMap AuditingManagerInterface::updateTerminology(StrMap terms,
+                                                   const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kUpdateTerminology);
+  return ProxyManagerInterface::updateTerminology(std::move(terms), hostSession);
+}
+
+InfoDictionary AuditingManagerInterface::settings(const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kSettings);
+  return ProxyManagerInterface::settings(hostSession);
+}
+
+void AuditingManagerInterface::initialize(InfoDictionary managerSettings,
+                                          const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kInitialize);
+  ProxyManagerInterface::initialize(std::move(managerSettings), hostSession);
+}
+
+void AuditingManagerInterface::flushCaches(const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kFlushCaches);
+  ProxyManagerInterface::flushCaches(hostSession);
+}
+
+void AuditingManagerInterface::flushEntityCaches(const EntityReferences& entityReferences,
+                                                 const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kFlushEntityCaches);
+  ProxyManagerInterface::flushEntityCaches(entityReferences, hostSession);
+}
+
+void AuditingManagerInterface::flushCachesWithPrefix(
+    const Str& prefix, const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kFlushCachesWithPrefix);
+  ProxyManagerInterface::flushCachesWithPrefix(prefix, hostSession);
+}
+
+trait::TraitsDatas AuditingManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kManagementPolicy);
+  return ProxyManagerInterface::managementPolicy(traitSets, policyAccess, context, hostSession);
+}
+
+managerApi::ManagerStateBasePtr AuditingManagerInterface::createState(
+    const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kCreateState);
+  return ProxyManagerInterface::createState(hostSession);
+}
+
+managerApi::ManagerStateBasePtr AuditingManagerInterface::createChildState(
+    const managerApi::ManagerStateBasePtr& parentState,
+    const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kCreateChildState);
+  return ProxyManagerInterface::createChildState(parentState, hostSession);
+}
+
+Str AuditingManagerInterface::persistenceTokenForState(
+    const managerApi::ManagerStateBasePtr& state, const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kPersistenceTokenForState);
+  return ProxyManagerInterface::persistenceTokenForState(state, hostSession);
+}
+
+managerApi::ManagerStateBasePtr AuditingManagerInterface::stateFromPersistenceToken(
+    const Str& token, const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kStateFromPersistenceToken);
+  return ProxyManagerInterface::stateFromPersistenceToken(token, hostSession);
+}
+
+bool AuditingManagerInterface::resetState(const managerApi::ManagerStateBasePtr& state,
+                                          const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kResetState);
+  return ProxyManagerInterface::resetState(state, hostSession);
+}
+
+bool AuditingManagerInterface::isEntityReferenceString(
+    const Str& someString, const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kIsEntityReferenceString);
+  return ProxyManagerInterface::isEntityReferenceString(someString, hostSession);
+}
+
+std::vector<bool> AuditingManagerInterface::areEntityReferenceStrings(
+    const std::vector<Str>& someStrings, const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kAreEntityReferenceStrings);
+  return ProxyManagerInterface::areEntityReferenceStrings(someStrings, hostSession);
+}
+
+void AuditingManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                            const ContextConstPtr& context,
+                                            const managerApi::HostSessionPtr& hostSession,
+                                            const ExistsSuccessCallback& successCallback,
+                                            const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kEntityExists);
+  ProxyManagerInterface::entityExists(entityReferences, context, hostSession, successCallback,
+                                      errorCallback);
+}
+
+managerApi::EntityExistenceFilterConstPtr AuditingManagerInterface::entityExistenceFilter(
+    const managerApi::HostSessionPtr& hostSession) {
+  recordCall(ApiAuditor::Method::kEntityExistenceFilter);
+  return ProxyManagerInterface::entityExistenceFilter(hostSession);
+}
+
+void AuditingManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                            const access::EntityTraitsAccess entityTraitsAccess,
+                                            const ContextConstPtr& context,
+                                            const managerApi::HostSessionPtr& hostSession,
+                                            const EntityTraitsSuccessCallback& successCallback,
+                                            const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kEntityTraits);
+  ProxyManagerInterface::entityTraits(entityReferences, entityTraitsAccess, context, hostSession,
+                                      successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                       const trait::TraitSet& traitSet,
+                                       const access::ResolveAccess resolveAccess,
+                                       const ContextConstPtr& context,
+                                       const managerApi::HostSessionPtr& hostSession,
+                                       const ResolveSuccessCallback& successCallback,
+                                       const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kResolve);
+  ProxyManagerInterface::resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                                 successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::resolveHeterogeneous(
+    const EntityReferences& entityReferences, const trait::TraitSets& traitSets,
+    const std::vector<std::size_t>& traitSetIndices, const access::ResolveAccess resolveAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kResolveHeterogeneous);
+  ProxyManagerInterface::resolveHeterogeneous(entityReferences, traitSets, traitSetIndices,
+                                              resolveAccess, context, hostSession, successCallback,
+                                              errorCallback);
+}
+
+void AuditingManagerInterface::resolveProjected(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const trait::PropertyProjection& propertyProjection, const access::ResolveAccess resolveAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kResolveProjected);
+  ProxyManagerInterface::resolveProjected(entityReferences, traitSet, propertyProjection,
+                                          resolveAccess, context, hostSession, successCallback,
+                                          errorCallback);
+}
+
+void AuditingManagerInterface::resolveColumnar(const EntityReferences& entityReferences,
+                                               const trait::TraitSet& traitSet,
+                                               const access::ResolveAccess resolveAccess,
+                                               const ContextConstPtr& context,
+                                               const managerApi::HostSessionPtr& hostSession,
+                                               trait::TraitsDataTable& results,
+                                               const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kResolveColumnar);
+  ProxyManagerInterface::resolveColumnar(entityReferences, traitSet, resolveAccess, context,
+                                         hostSession, results, errorCallback);
+}
+
+void AuditingManagerInterface::resolveIfChanged(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const std::vector<Str>& generationTokens,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const ConditionalResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kResolveIfChanged);
+  ProxyManagerInterface::resolveIfChanged(entityReferences, traitSet, resolveAccess,
+                                          generationTokens, context, hostSession, successCallback,
+                                          errorCallback);
+}
+
+void AuditingManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kDefaultEntityReference);
+  ProxyManagerInterface::defaultEntityReference(traitSets, defaultEntityAccess, context,
+                                                hostSession, successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kGetWithRelationship);
+  ProxyManagerInterface::getWithRelationship(entityReferences, relationshipTraitsData,
+                                             resultTraitSet, pageSize, relationsAccess, context,
+                                             hostSession, successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kGetWithRelationships);
+  ProxyManagerInterface::getWithRelationships(entityReference, relationshipTraitsDatas,
+                                              resultTraitSet, pageSize, relationsAccess, context,
+                                              hostSession, successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kGetWithRelationshipsMatrix);
+  ProxyManagerInterface::getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                    resultTraitSet, pageSize, relationsAccess,
+                                                    context, hostSession, successCallback,
+                                                    errorCallback);
+}
+
+void AuditingManagerInterface::traverseRelationships(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t maxDepth,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipTraversalSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kTraverseRelationships);
+  ProxyManagerInterface::traverseRelationships(entityReferences, relationshipTraitsDatas,
+                                               resultTraitSet, maxDepth, relationsAccess, context,
+                                               hostSession, successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::preflight(const EntityReferences& entityReferences,
+                                         const trait::TraitsDatas& traitsHints,
+                                         const access::PublishingAccess publishingAccess,
+                                         const ContextConstPtr& context,
+                                         const managerApi::HostSessionPtr& hostSession,
+                                         const PreflightSuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kPreflight);
+  ProxyManagerInterface::preflight(entityReferences, traitsHints, publishingAccess, context,
+                                   hostSession, successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::register_(const EntityReferences& entityReferences,
+                                         const trait::TraitsDatas& entityTraitsDatas,
+                                         const access::PublishingAccess publishingAccess,
+                                         const ContextConstPtr& context,
+                                         const managerApi::HostSessionPtr& hostSession,
+                                         const RegisterSuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback) {
+  recordCall(ApiAuditor::Method::kRegister);
+  ProxyManagerInterface::register_(entityReferences, entityTraitsDatas, publishingAccess, context,
+                                   hostSession, successCallback, errorCallback);
+}
+
+void AuditingManagerInterface::entityExistsAsync(const EntityReferences& entityReferences,
+                                                 const ContextConstPtr& context,
+                                                 const managerApi::HostSessionPtr& hostSession,
+                                                 ExistsSuccessCallback successCallback,
+                                                 BatchElementErrorCallback errorCallback,
+                                                 CompletionCallback completionCallback) {
+  recordCall(ApiAuditor::Method::kEntityExistsAsync);
+  ProxyManagerInterface::entityExistsAsync(entityReferences, context, hostSession,
+                                           std::move(successCallback), std::move(errorCallback),
+                                           std::move(completionCallback));
+}
+
+void AuditingManagerInterface::entityTraitsAsync(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    EntityTraitsSuccessCallback successCallback, BatchElementErrorCallback errorCallback,
+    CompletionCallback completionCallback) {
+  recordCall(ApiAuditor::Method::kEntityTraitsAsync);
+  ProxyManagerInterface::entityTraitsAsync(entityReferences, entityTraitsAccess, context,
+                                           hostSession, std::move(successCallback),
+                                           std::move(errorCallback),
+                                           std::move(completionCallback));
+}
+
+void AuditingManagerInterface::resolveAsync(const EntityReferences& entityReferences,
+                                            const trait::TraitSet& traitSet,
+                                            const access::ResolveAccess resolveAccess,
+                                            const ContextConstPtr& context,
+                                            const managerApi::HostSessionPtr& hostSession,
+                                            ResolveSuccessCallback successCallback,
+                                            BatchElementErrorCallback errorCallback,
+                                            CompletionCallback completionCallback) {
+  recordCall(ApiAuditor::Method::kResolveAsync);
+  ProxyManagerInterface::resolveAsync(entityReferences, traitSet, resolveAccess, context,
+                                      hostSession, std::move(successCallback),
+                                      std::move(errorCallback), std::move(completionCallback));
+}
+
+void AuditingManagerInterface::preflightAsync(const EntityReferences& entityReferences,
+                                              const trait::TraitsDatas& traitsHints,
+                                              const access::PublishingAccess publishingAccess,
+                                              const ContextConstPtr& context,
+                                              const managerApi::HostSessionPtr& hostSession,
+                                              PreflightSuccessCallback successCallback,
+                                              BatchElementErrorCallback errorCallback,
+                                              CompletionCallback completionCallback) {
+  recordCall(ApiAuditor::Method::kPreflightAsync);
+  ProxyManagerInterface::preflightAsync(entityReferences, traitsHints, publishingAccess, context,
+                                        hostSession, std::move(successCallback),
+                                        std::move(errorCallback), std::move(completionCallback));
+}
+
+void AuditingManagerInterface::registerAsync(const EntityReferences& entityReferences,
+                                             const trait::TraitsDatas& entityTraitsDatas,
+                                             const access::PublishingAccess publishingAccess,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             RegisterSuccessCallback successCallback,
+                                             BatchElementErrorCallback errorCallback,
+                                             CompletionCallback completionCallback) {
+  recordCall(ApiAuditor::Method::kRegisterAsync);
+  ProxyManagerInterface::registerAsync(entityReferences, entityTraitsDatas, publishingAccess,
+                                       context, hostSession, std::move(successCallback),
+                                       std::move(errorCallback), std::move(completionCallback));
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
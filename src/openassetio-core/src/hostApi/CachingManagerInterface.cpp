@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/CachingManagerInterface.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+/**
+ * Determine whether a manager plugin's info dictionary declares that
+ * it caches resolve results itself.
+ */
+bool isResolveCachedFromInfo(const InfoDictionary& info) {
+  const auto iter = info.find(constants::kInfoKey_IsResolveCached);
+  if (iter == info.end()) {
+    return false;
+  }
+  const auto* isResolveCached = std::get_if<Bool>(&iter->second);
+  return isResolveCached && *isResolveCached;
+}
+}  // namespace
+
+CachingManagerInterfacePtr CachingManagerInterface::make(managerApi::ManagerInterfacePtr proxied,
+                                                         ResolveCachePtr resolveCache) {
+  if (!resolveCache) {
+    throw errors::InputValidationException{"Resolve cache cannot be null"};
+  }
+  return CachingManagerInterfacePtr{
+      new CachingManagerInterface{std::move(proxied), std::move(resolveCache)}};
+}
+
+CachingManagerInterface::CachingManagerInterface(managerApi::ManagerInterfacePtr proxied,
+                                                 ResolveCachePtr resolveCache)
+    : ProxyManagerInterface{std::move(proxied)}, resolveCache_{std::move(resolveCache)} {}
+
+const ResolveCachePtr& CachingManagerInterface::resolveCache() const { return resolveCache_; }
+
+CachingManagerInterface::~CachingManagerInterface() {
+  if (const managerApi::HostSessionPtr hostSession = subscribedHostSession_.lock()) {
+    hostSession->unsubscribeFromEntityChanges(entityChangeSubscriptionId_);
+  }
+}
+
+void CachingManagerInterface::initialize(InfoDictionary managerSettings,
+                                         const managerApi::HostSessionPtr& hostSession) {
+  proxied()->initialize(std::move(managerSettings), hostSession);
+  isResolveCached_ = isResolveCachedFromInfo(proxied()->info());
+
+  // Track changes notified through the latest session.
+  const std::lock_guard lock{subscriptionMutex_};
+  const managerApi::HostSessionPtr subscribed = subscribedHostSession_.lock();
+  if (subscribed == hostSession) {
+    return;
+  }
+  if (subscribed) {
+    subscribed->unsubscribeFromEntityChanges(entityChangeSubscriptionId_);
+  }
+  entityChangeSubscriptionId_ = hostSession->subscribeToEntityChanges(
+      [resolveCache = resolveCache_](const EntityReferences& entityReferences,
+                                     const trait::TraitSet& traitSet) {
+        resolveCache->invalidate(entityReferences, traitSet);
+      });
+  subscribedHostSession_ = hostSession;
+}
+
+void CachingManagerInterface::flushCaches(const managerApi::HostSessionPtr& hostSession) {
+  resolveCache_->clear();
+  proxied()->flushCaches(hostSession);
+}
+
+void CachingManagerInterface::flushEntityCaches(const EntityReferences& entityReferences,
+                                                const managerApi::HostSessionPtr& hostSession) {
+  resolveCache_->invalidate(entityReferences);
+  proxied()->flushEntityCaches(entityReferences, hostSession);
+}
+
+void CachingManagerInterface::flushCachesWithPrefix(
+    const Str& prefix, const managerApi::HostSessionPtr& hostSession) {
+  resolveCache_->invalidatePrefix(prefix);
+  proxied()->flushCachesWithPrefix(prefix, hostSession);
+}
+
+void CachingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                      const trait::TraitSet& traitSet,
+                                      const access::ResolveAccess resolveAccess,
+                                      const ContextConstPtr& context,
+                                      const managerApi::HostSessionPtr& hostSession,
+                                      const ResolveSuccessCallback& successCallback,
+                                      const BatchElementErrorCallback& errorCallback) {
+  if (isResolveCached_) {
+    proxied()->resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                       successCallback, errorCallback);
+    return;
+  }
+
+  // Serve what we can from the cache, batching up the remainder,
+  // retaining a mapping back to the caller's indices.
+  EntityReferences missedRefs;
+  std::vector<std::size_t> missedIndices;
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (trait::TraitsDataPtr cached =
+            resolveCache_->lookup(entityReferences[idx], traitSet, resolveAccess, context)) {
+      successCallback(idx, std::move(cached));
+    } else {
+      missedRefs.push_back(entityReferences[idx]);
+      missedIndices.push_back(idx);
+    }
+  }
+
+  if (missedRefs.empty()) {
+    return;
+  }
+
+  proxied()->resolve(
+      missedRefs, traitSet, resolveAccess, context, hostSession,
+      [&](const std::size_t missedIdx, trait::TraitsDataPtr data) {
+        resolveCache_->insert(missedRefs[missedIdx], traitSet, resolveAccess, context, data);
+        successCallback(missedIndices[missedIdx], std::move(data));
+      },
+      [&](const std::size_t missedIdx, errors::BatchElementError error) {
+        errorCallback(missedIndices[missedIdx], std::move(error));
+      });
+}
+
+void CachingManagerInterface::resolveAsync(const EntityReferences& entityReferences,
+                                           const trait::TraitSet& traitSet,
+                                           const access::ResolveAccess resolveAccess,
+                                           const ContextConstPtr& context,
+                                           const managerApi::HostSessionPtr& hostSession,
+                                           ResolveSuccessCallback successCallback,
+                                           BatchElementErrorCallback errorCallback,
+                                           CompletionCallback completionCallback) {
+  if (isResolveCached_) {
+    proxied()->resolveAsync(entityReferences, traitSet, resolveAccess, context, hostSession,
+                            std::move(successCallback), std::move(errorCallback),
+                            std::move(completionCallback));
+    return;
+  }
+
+  // As for the synchronous resolve, serve what we can from the cache
+  // and forward the remainder, mapping indices back to the caller's.
+  auto missedRefs = std::make_shared<EntityReferences>();
+  auto missedIndices = std::make_shared<std::vector<std::size_t>>();
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (trait::TraitsDataPtr cached =
+            resolveCache_->lookup(entityReferences[idx], traitSet, resolveAccess, context)) {
+      successCallback(idx, std::move(cached));
+    } else {
+      missedRefs->push_back(entityReferences[idx]);
+      missedIndices->push_back(idx);
+    }
+  }
+
+  if (missedRefs->empty()) {
+    completionCallback(nullptr);
+    return;
+  }
+
+  proxied()->resolveAsync(
+      *missedRefs, traitSet, resolveAccess, context, hostSession,
+      [resolveCache = resolveCache_, missedRefs, missedIndices, traitSet, resolveAccess, context,
+       successCallback = std::move(successCallback)](const std::size_t missedIdx,
+                                                     trait::TraitsDataPtr data) {
+        resolveCache->insert((*missedRefs)[missedIdx], traitSet, resolveAccess, context, data);
+        successCallback((*missedIndices)[missedIdx], std::move(data));
+      },
+      [missedIndices, errorCallback = std::move(errorCallback)](const std::size_t missedIdx,
+                                                                errors::BatchElementError error) {
+        errorCallback((*missedIndices)[missedIdx], std::move(error));
+      },
+      std::move(completionCallback));
+}
+
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
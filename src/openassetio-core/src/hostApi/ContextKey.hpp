@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * The Context-dependent part of a cache key.
+ *
+ * The locale is held by (copy-on-write) value, so later modification of
+ * the caller's Context doesn't affect lookup. The manager state is
+ * held weakly, so the cache doesn't extend its lifetime, whilst still
+ * distinguishing a new state that happens to reuse the same address.
+ *
+ * A default-constructed key represents no Context, e.g. for caches
+ * whose results do not depend on it.
+ */
+struct ContextKey {
+  ContextKey() = default;
+
+  explicit ContextKey(const ContextConstPtr& context) {
+    if (!context) {
+      return;
+    }
+    if (context->locale) {
+      locale = trait::TraitsData::make(context->locale);
+    }
+    managerState = context->managerState;
+    hasManagerState = context->managerState != nullptr;
+    hash = context->fingerprint();
+  }
+
+  bool operator==(const ContextKey& other) const {
+    if (hash != other.hash || hasManagerState != other.hasManagerState) {
+      return false;
+    }
+    if (managerState.owner_before(other.managerState) ||
+        other.managerState.owner_before(managerState)) {
+      return false;
+    }
+    if (!locale || !other.locale) {
+      return locale == other.locale;
+    }
+    return *locale == *other.locale;
+  }
+
+  /**
+   * Whether the manager state has been destroyed, in which case no
+   * future Context can match this key.
+   */
+  [[nodiscard]] bool isExpired() const { return hasManagerState && managerState.expired(); }
+
+  /// Heap bytes owned by this key.
+  [[nodiscard]] std::size_t heapBytes() const { return locale ? locale->memoryUsage() : 0; }
+
+  trait::TraitsDataConstPtr locale;
+  std::weak_ptr<managerApi::ManagerStateBase> managerState;
+  bool hasManagerState = false;
+  /// Context::fingerprint, or zero if there is no Context.
+  std::size_t hash = 0;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "DefaultEntityReferenceCache.hpp"
+
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+
+#include "../internal/footprint.hpp"
+#include "../trait/hashing.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+DefaultEntityReferenceCache::Key::Key(const trait::TraitSet& traitSet_,
+                                      const access::DefaultEntityAccess defaultEntityAccess_,
+                                      const ContextConstPtr& context_)
+    : traitSet{traitSet_}, defaultEntityAccess{defaultEntityAccess_}, context{context_} {
+  // NOLINTBEGIN(readability-magic-numbers)
+  std::uint64_t combined = trait::TraitSetHash{}(traitSet);
+  combined = combined * 31U + static_cast<std::uint64_t>(defaultEntityAccess);
+  combined = combined * 31U + context.hash;
+  // NOLINTEND(readability-magic-numbers)
+  hash = trait::mixHash(combined);
+}
+
+bool DefaultEntityReferenceCache::Key::operator==(const Key& other) const {
+  return hash == other.hash && defaultEntityAccess == other.defaultEntityAccess &&
+         traitSet == other.traitSet && context == other.context;
+}
+
+DefaultEntityReferenceCache::DefaultEntityReferenceCache(const std::size_t capacity)
+    : entries_{capacity} {}
+
+std::optional<DefaultEntityReferenceCache::Value> DefaultEntityReferenceCache::lookup(
+    const trait::TraitSet& traitSet, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context) {
+  const Key key{traitSet, defaultEntityAccess, context};
+  const std::lock_guard lock{mutex_};
+  const Value* cached = entries_.find(key);
+  if (cached == nullptr) {
+    return std::nullopt;
+  }
+  return *cached;
+}
+
+void DefaultEntityReferenceCache::insert(const trait::TraitSet& traitSet,
+                                         const access::DefaultEntityAccess defaultEntityAccess,
+                                         const ContextConstPtr& context, Value value) {
+  Key key{traitSet, defaultEntityAccess, context};
+  const std::lock_guard lock{mutex_};
+  entries_.insert(std::move(key), std::move(value));
+}
+
+template <class Predicate>
+void DefaultEntityReferenceCache::eraseIf(const Predicate& predicate) {
+  entries_.eraseIf([&predicate](const Key&, const Value& value) {
+    return value && predicate(value->toString());
+  });
+}
+
+void DefaultEntityReferenceCache::invalidate(const EntityReferences& entityReferences) {
+  std::unordered_set<std::string_view> refs;
+  for (const EntityReference& entityReference : entityReferences) {
+    refs.insert(entityReference.toString());
+  }
+  const std::lock_guard lock{mutex_};
+  eraseIf([&refs](const Str& ref) { return refs.count(ref) != 0; });
+}
+
+void DefaultEntityReferenceCache::invalidatePrefix(const std::string_view prefix) {
+  const std::lock_guard lock{mutex_};
+  eraseIf([prefix](const Str& ref) {
+    return std::string_view{ref}.substr(0, prefix.size()) == prefix;
+  });
+}
+
+void DefaultEntityReferenceCache::clear() {
+  const std::lock_guard lock{mutex_};
+  entries_.clear();
+}
+
+std::size_t DefaultEntityReferenceCache::memoryUsage() {
+  namespace footprint = internal::footprint;
+  const std::lock_guard lock{mutex_};
+  std::size_t bytes = sizeof(DefaultEntityReferenceCache) + entries_.heapBytes();
+  for (const auto& [key, value] : entries_.entries()) {
+    bytes += footprint::heapBytes(key.traitSet) + key.context.heapBytes() +
+             (value ? footprint::heapBytes(value->toString()) : 0);
+  }
+  return bytes;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
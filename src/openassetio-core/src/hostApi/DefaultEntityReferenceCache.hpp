@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "ContextKey.hpp"
+#include "LruCache.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Bounded, thread-safe memo of defaultEntityReference results.
+ *
+ * Results are keyed by trait set, access mode and Context. A result
+ * may be an empty optional, i.e. the manager has no default for the
+ * trait set. Once full, the least recently used entries are evicted.
+ */
+class DefaultEntityReferenceCache {
+ public:
+  /// Cached result: the default entity, if any.
+  using Value = std::optional<EntityReference>;
+
+  explicit DefaultEntityReferenceCache(std::size_t capacity);
+
+  /// @return Cached result, if any.
+  std::optional<Value> lookup(const trait::TraitSet& traitSet,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context);
+
+  /// Cache a result, replacing any existing entry.
+  void insert(const trait::TraitSet& traitSet, access::DefaultEntityAccess defaultEntityAccess,
+              const ContextConstPtr& context, Value value);
+
+  /// Discard entries whose default is one of the given entities.
+  void invalidate(const EntityReferences& entityReferences);
+
+  /// Discard entries whose default's reference starts with a prefix.
+  void invalidatePrefix(std::string_view prefix);
+
+  /// Discard all entries.
+  void clear();
+
+  /// @return Approximate number of bytes used by this cache.
+  [[nodiscard]] std::size_t memoryUsage();
+
+ private:
+  struct Key {
+    Key(const trait::TraitSet& traitSet_, access::DefaultEntityAccess defaultEntityAccess_,
+        const ContextConstPtr& context_);
+
+    bool operator==(const Key& other) const;
+
+    trait::TraitSet traitSet;
+    access::DefaultEntityAccess defaultEntityAccess;
+    ContextKey context;
+    std::size_t hash = 0;
+  };
+
+  /// Erase entries whose default is an entity whose reference matches
+  /// a predicate. Must be called with mutex_ held.
+  template <class Predicate>
+  void eraseIf(const Predicate& predicate);
+
+  std::mutex mutex_;
+  LruCache<Key, Value> entries_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
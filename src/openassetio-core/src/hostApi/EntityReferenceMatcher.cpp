@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "EntityReferenceMatcher.hpp"
+
+#include <algorithm>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+void EntityReferenceMatcher::addPrefix(const std::string_view prefix) {
+  std::uint32_t nodeIdx = 0;
+  for (const char chr : prefix) {
+    if (const std::optional<std::uint32_t> childIdx = child(nodeIdx, chr)) {
+      nodeIdx = *childIdx;
+      continue;
+    }
+    const auto newIdx = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    nodes_[nodeIdx].children.emplace_back(chr, newIdx);
+    nodeIdx = newIdx;
+  }
+  nodes_[nodeIdx].terminal = true;
+}
+
+void EntityReferenceMatcher::setPattern(const Str& pattern) {
+  pattern_.emplace(pattern, std::regex::ECMAScript | std::regex::optimize);
+}
+
+bool EntityReferenceMatcher::empty() const {
+  return nodes_.size() == 1 && !nodes_.front().terminal && !pattern_;
+}
+
+bool EntityReferenceMatcher::matches(const std::string_view someString) const {
+  std::uint32_t nodeIdx = 0;
+  if (nodes_[nodeIdx].terminal) {
+    return true;
+  }
+  for (const char chr : someString) {
+    const std::optional<std::uint32_t> childIdx = child(nodeIdx, chr);
+    if (!childIdx) {
+      break;
+    }
+    nodeIdx = *childIdx;
+    if (nodes_[nodeIdx].terminal) {
+      return true;
+    }
+  }
+
+  return pattern_ && std::regex_search(someString.begin(), someString.end(), *pattern_,
+                                       std::regex_constants::match_continuous);
+}
+
+std::optional<std::uint32_t> EntityReferenceMatcher::child(const std::uint32_t nodeIdx,
+                                                           const char chr) const {
+  const auto& children = nodes_[nodeIdx].children;
+  const auto iter = std::find_if(children.begin(), children.end(),
+                                 [chr](const auto& entry) { return entry.first == chr; });
+  if (iter == children.end()) {
+    return std::nullopt;
+  }
+  return iter->second;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
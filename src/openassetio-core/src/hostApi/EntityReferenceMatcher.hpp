@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <regex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Native recogniser for entity reference strings, configured from a
+ * manager's info dictionary.
+ *
+ * A string matches if it begins with any of a set of literal prefixes,
+ * or if the start of the string matches a regular expression.
+ *
+ * Prefixes are held in a trie, so the cost of matching is bounded by
+ * the length of the longest prefix, regardless of the number of
+ * prefixes.
+ *
+ * Matching is thread-safe.
+ */
+class EntityReferenceMatcher {
+ public:
+  /// Add a literal prefix.
+  void addPrefix(std::string_view prefix);
+
+  /**
+   * Set a regular expression (ECMAScript syntax) to match against the
+   * start of strings.
+   *
+   * @exception std::regex_error If the pattern is invalid.
+   */
+  void setPattern(const Str& pattern);
+
+  /// @return Whether no prefixes or pattern have been configured.
+  [[nodiscard]] bool empty() const;
+
+  /// @return Whether the string is recognised as an entity reference.
+  [[nodiscard]] bool matches(std::string_view someString) const;
+
+ private:
+  struct Node {
+    /// Child node indices, keyed by next character.
+    std::vector<std::pair<char, std::uint32_t>> children;
+    /// Whether a prefix ends at this node.
+    bool terminal = false;
+  };
+
+  [[nodiscard]] std::optional<std::uint32_t> child(std::uint32_t nodeIdx, char chr) const;
+
+  std::vector<Node> nodes_{1};
+  std::optional<std::regex> pattern_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
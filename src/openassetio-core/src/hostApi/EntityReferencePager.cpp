@@ -1,5 +1,17 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
@@ -7,40 +19,477 @@
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 
+#include "../internal/ThreadPool.hpp"
+#include "../internal/hostScheduler.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace hostApi {
+namespace {
+/// Close the pager interface, logging rather than propagating errors.
+void closePagerInterface(const managerApi::EntityReferencePagerInterfacePtr& pagerInterface,
+                         const managerApi::HostSessionPtr& hostSession) {
+  try {
+    pagerInterface->close(hostSession);
+  } catch (const std::exception& ex) {
+    hostSession->logger()->error(ex.what());
+  } catch (...) {
+    hostSession->logger()->error(
+        "Unknown non-exception object caught during destruction of EntityReferencePager");
+  }
+}
+
+/**
+ * Wrap a completion callback such that the pager is kept alive until
+ * the operation completes.
+ */
+EntityReferencePager::CompletionCallback retainUntilComplete(
+    EntityReferencePager::Ptr pager, EntityReferencePager::CompletionCallback completionCallback) {
+  return [pager = std::move(pager),
+          completionCallback = std::move(completionCallback)](std::exception_ptr exception) {
+    completionCallback(std::move(exception));
+  };
+}
+
+/**
+ * Start an asynchronous paging operation, returning a future fulfilled
+ * with its result.
+ *
+ * @param start Callable taking success and completion callbacks, that
+ * starts the operation.
+ */
+template <class Value, class Start>
+std::future<Value> startWithFuture(const Start& start) {
+  struct State {
+    Value value;
+    std::promise<Value> promise;
+  };
+  auto state = std::make_shared<State>();
+  std::future<Value> future = state->promise.get_future();
+
+  start([state](Value value) { state->value = std::move(value); },
+        [state](std::exception_ptr exception) {
+          if (exception) {
+            state->promise.set_exception(std::move(exception));
+          } else {
+            state->promise.set_value(std::move(state->value));
+          }
+        });
+  return future;
+}
+}  // namespace
+
+/**
+ * Read-ahead state, shared between the host's thread and background
+ * fetches queued on the default thread pool.
+ *
+ * Fetched pages are buffered, the first being the current page. The
+ * pager interface is only ever called by whichever thread has claimed
+ * the fetch (i.e. set `fetching`), so calls are never concurrent.
+ *
+ * If the current page is required before a queued background fetch
+ * has started, e.g. because the pool is busy, the host's thread
+ * claims the fetch itself rather than waiting.
+ *
+ * If the pager is destroyed whilst a background fetch is in progress,
+ * closing the interface is deferred to the fetching thread, rather
+ * than blocking destruction (which may, e.g., hold the Python GIL
+ * needed by the fetch).
+ */
+struct EntityReferencePager::Prefetcher {
+  Prefetcher(managerApi::EntityReferencePagerInterfacePtr wrappedInterface,
+             managerApi::HostSessionPtr session, const std::size_t pageDepth)
+      : pagerInterface{std::move(wrappedInterface)},
+        hostSession{std::move(session)},
+        depth{pageDepth} {}
+
+  /// @return Whether further pages should be fetched. Requires lock.
+  [[nodiscard]] bool wantsMore() const {
+    return !stopped && !exhausted && !exception && pages.size() <= depth;
+  }
+
+  /**
+   * Queue a background fetch, if one is wanted and not already queued
+   * or in progress. Requires lock.
+   */
+  static void schedule(const std::shared_ptr<Prefetcher>& self) {
+    if (self->queued || self->fetching || !self->wantsMore()) {
+      return;
+    }
+    self->queued = true;
+    internal::ThreadPool::defaultPool().submit([self] {
+      std::unique_lock lock{self->mutex};
+      self->queued = false;
+      if (!self->fetching) {
+        self->fetch(lock, std::numeric_limits<std::size_t>::max());
+      }
+    });
+  }
+
+  /**
+   * Fetch up to `maxPages` pages, whilst more are wanted. Requires
+   * lock, which is released whilst calling the pager interface.
+   */
+  void fetch(std::unique_lock<std::mutex>& lock, std::size_t maxPages) {
+    fetching = true;
+    for (; maxPages > 0 && wantsMore(); --maxPages) {
+      const bool advance = std::exchange(started, true);
+      lock.unlock();
+
+      Page page;
+      bool more = false;
+      std::exception_ptr error;
+      try {
+        if (advance) {
+          pagerInterface->next(hostSession);
+        }
+        page = pagerInterface->get(hostSession);
+        more = pagerInterface->hasNext(hostSession);
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      lock.lock();
+      if (error) {
+        exception = std::move(error);
+        break;
+      }
+      lastPageSize = page.size();
+      pages.push_back(std::move(page));
+      exhausted = !more;
+      fetched.notify_all();
+    }
+    fetching = false;
+    // If the pager was destroyed during the fetch, close on its behalf.
+    if (stopped && pagerInterface) {
+      closePagerInterface(pagerInterface, hostSession);
+      pagerInterface.reset();
+    }
+    fetched.notify_all();
+  }
+
+  /**
+   * Block until the current page has been fetched, or there are no
+   * more pages. Requires lock.
+   *
+   * @exception std::exception If fetching the current page failed.
+   */
+  void awaitCurrent(std::unique_lock<std::mutex>& lock) {
+    while (pages.empty() && !exhausted && !exception) {
+      if (fetching) {
+        fetched.wait(lock);
+      } else {
+        fetch(lock, 1);
+      }
+    }
+    if (pages.empty() && exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  /**
+   * Drain buffered pages, then the remainder from the pager interface,
+   * up to `maxItems` entity references. Requires lock, which is
+   * released whilst calling the pager interface.
+   *
+   * If the remainder was truncated, the interface is left on a page
+   * not yet retrieved, so read-ahead can resume from there.
+   *
+   * @exception std::exception If fetching a page failed.
+   */
+  Page drain(std::unique_lock<std::mutex>& lock, const std::size_t maxItems) {
+    fetched.wait(lock, [this] { return !fetching; });
+
+    Page entityReferences;
+    while (!pages.empty() && entityReferences.size() < maxItems) {
+      Page& page = pages.front();
+      const std::size_t remaining = maxItems - entityReferences.size();
+      const auto count = static_cast<Page::difference_type>(std::min(page.size(), remaining));
+      entityReferences.insert(entityReferences.end(), std::make_move_iterator(page.begin()),
+                              std::make_move_iterator(page.begin() + count));
+      pages.pop_front();
+    }
+    if (entityReferences.size() == maxItems || (pages.empty() && exhausted)) {
+      return entityReferences;
+    }
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+
+    const std::size_t requested = maxItems - entityReferences.size();
+    fetching = true;
+    const bool advance = std::exchange(started, true);
+    lock.unlock();
+
+    Page remainder;
+    std::exception_ptr error;
+    try {
+      if (advance) {
+        pagerInterface->next(hostSession);
+      }
+      remainder = pagerInterface->drainAll(requested, hostSession);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    fetching = false;
+    fetched.notify_all();
+    if (error) {
+      exception = error;
+      std::rethrow_exception(error);
+    }
+    if (remainder.size() < requested) {
+      exhausted = true;
+    } else {
+      // The interface now sits on a page that has not been retrieved.
+      started = false;
+    }
+
+    if (entityReferences.empty()) {
+      return remainder;
+    }
+    entityReferences.insert(entityReferences.end(), std::make_move_iterator(remainder.begin()),
+                            std::make_move_iterator(remainder.end()));
+    return entityReferences;
+  }
+
+  /**
+   * Estimate the number of entity references remaining, from the
+   * current page onward. Requires lock, which is released whilst
+   * calling the pager interface.
+   *
+   * Buffered pages are counted exactly. The interface's own hint
+   * covers its current page onward, which is either the last buffered
+   * page or, if none are buffered, a page already consumed by the
+   * host.
+   *
+   * @exception std::exception If the interface failed to provide a
+   * hint.
+   */
+  std::optional<std::size_t> sizeHint(std::unique_lock<std::mutex>& lock) {
+    fetched.wait(lock, [this] { return !fetching; });
+
+    std::size_t buffered = 0;
+    for (const Page& page : pages) {
+      buffered += page.size();
+    }
+    if (exhausted) {
+      return buffered;
+    }
+    if (exception) {
+      return std::nullopt;
+    }
+
+    fetching = true;
+    lock.unlock();
+
+    std::optional<std::size_t> hint;
+    std::exception_ptr error;
+    try {
+      hint = pagerInterface->sizeHint(hostSession);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    fetching = false;
+    fetched.notify_all();
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    if (!hint || !started) {
+      return hint;
+    }
+    if (!pages.empty()) {
+      return buffered - pages.back().size() + *hint;
+    }
+    return *hint - std::min(*hint, lastPageSize);
+  }
+
+  managerApi::EntityReferencePagerInterfacePtr pagerInterface;
+  const managerApi::HostSessionPtr hostSession;
+  const std::size_t depth;
+
+  std::mutex mutex;
+  std::condition_variable fetched;
+  std::deque<Page> pages;
+  std::exception_ptr exception;
+  /// Whether the interface has been queried for its first page.
+  bool started = false;
+  /// Whether the last fetched page is the final page.
+  bool exhausted = false;
+  /// Size of the last page fetched via the interface.
+  std::size_t lastPageSize = 0;
+  bool queued = false;
+  bool fetching = false;
+  bool stopped = false;
+};
 
 typename EntityReferencePager::Ptr EntityReferencePager::make(
     managerApi::EntityReferencePagerInterfacePtr pagerInterface,
-    managerApi::HostSessionPtr hostSession) {
-  return EntityReferencePager::Ptr{
-      new EntityReferencePager{std::move(pagerInterface), std::move(hostSession)}};
+    managerApi::HostSessionPtr hostSession, const std::size_t prefetchDepth) {
+  return EntityReferencePager::Ptr{new EntityReferencePager{
+      std::move(pagerInterface), std::move(hostSession), prefetchDepth}};
 }
 
 EntityReferencePager::EntityReferencePager(
     managerApi::EntityReferencePagerInterfacePtr pagerInterface,
-    managerApi::HostSessionPtr hostSession)
-    : pagerInterface_(std::move(pagerInterface)), hostSession_(std::move(hostSession)) {}
+    managerApi::HostSessionPtr hostSession, const std::size_t prefetchDepth)
+    : pagerInterface_(std::move(pagerInterface)), hostSession_(std::move(hostSession)) {
+  if (prefetchDepth > 0) {
+    prefetcher_ = std::make_shared<Prefetcher>(pagerInterface_, hostSession_, prefetchDepth);
+    const std::lock_guard lock{prefetcher_->mutex};
+    Prefetcher::schedule(prefetcher_);
+  }
+}
 
 EntityReferencePager::~EntityReferencePager() {
-  try {
-    pagerInterface_->close(hostSession_);
-  } catch (const std::exception& ex) {
-    hostSession_->logger()->error(ex.what());
-  } catch (...) {
-    hostSession_->logger()->error(
-        "Unknown non-exception object caught during destruction of EntityReferencePager");
+  if (prefetcher_) {
+    const std::lock_guard lock{prefetcher_->mutex};
+    prefetcher_->stopped = true;
+    if (prefetcher_->fetching) {
+      // The fetching thread will close the interface once done.
+      return;
+    }
+    prefetcher_->pagerInterface.reset();
   }
+  closePagerInterface(pagerInterface_, hostSession_);
 }
 
-bool EntityReferencePager::hasNext() { return pagerInterface_->hasNext(hostSession_); }
+bool EntityReferencePager::hasNext() {
+  if (!prefetcher_) {
+    return pagerInterface_->hasNext(hostSession_);
+  }
+  std::unique_lock lock{prefetcher_->mutex};
+  prefetcher_->awaitCurrent(lock);
+  return prefetcher_->pages.size() > 1 ||
+         (!prefetcher_->pages.empty() && !prefetcher_->exhausted);
+}
 
 typename EntityReferencePager::Page EntityReferencePager::get() {
-  return pagerInterface_->get(hostSession_);
+  if (!prefetcher_) {
+    return pagerInterface_->get(hostSession_);
+  }
+  std::unique_lock lock{prefetcher_->mutex};
+  prefetcher_->awaitCurrent(lock);
+  return prefetcher_->pages.empty() ? Page{} : prefetcher_->pages.front();
 }
 
-void EntityReferencePager::next() { pagerInterface_->next(hostSession_); }
+void EntityReferencePager::get(Page& page) {
+  if (!prefetcher_) {
+    pagerInterface_->getInto(page, hostSession_);
+    return;
+  }
+  std::unique_lock lock{prefetcher_->mutex};
+  prefetcher_->awaitCurrent(lock);
+  if (prefetcher_->pages.empty()) {
+    page.clear();
+    return;
+  }
+  const Page& current = prefetcher_->pages.front();
+  page.assign(current.begin(), current.end());
+}
+
+void EntityReferencePager::next() {
+  if (!prefetcher_) {
+    pagerInterface_->next(hostSession_);
+    return;
+  }
+  std::unique_lock lock{prefetcher_->mutex};
+  prefetcher_->awaitCurrent(lock);
+  if (!prefetcher_->pages.empty()) {
+    prefetcher_->pages.pop_front();
+  }
+  Prefetcher::schedule(prefetcher_);
+}
+
+std::optional<std::size_t> EntityReferencePager::sizeHint() {
+  if (!prefetcher_) {
+    return pagerInterface_->sizeHint(hostSession_);
+  }
+  std::unique_lock lock{prefetcher_->mutex};
+  std::optional<std::size_t> hint = prefetcher_->sizeHint(lock);
+  Prefetcher::schedule(prefetcher_);
+  return hint;
+}
+
+typename EntityReferencePager::Page EntityReferencePager::drainAll(const std::size_t maxItems) {
+  if (!prefetcher_) {
+    return pagerInterface_->drainAll(maxItems, hostSession_);
+  }
+  std::unique_lock lock{prefetcher_->mutex};
+  Page entityReferences = prefetcher_->drain(lock, maxItems);
+  Prefetcher::schedule(prefetcher_);
+  return entityReferences;
+}
+
+void EntityReferencePager::hasNextAsync(HasNextSuccessCallback successCallback,
+                                        CompletionCallback completionCallback) {
+  if (!prefetcher_) {
+    pagerInterface_->hasNextAsync(
+        hostSession_, std::move(successCallback),
+        retainUntilComplete(shared_from_this(), std::move(completionCallback)));
+    return;
+  }
+  internal::runOnHostScheduler(
+      hostSession_,
+      [self = shared_from_this(), successCallback = std::move(successCallback)] {
+        successCallback(self->hasNext());
+      },
+      std::move(completionCallback));
+}
+
+std::future<bool> EntityReferencePager::hasNextAsync() {
+  return startWithFuture<bool>([&](auto success, auto completion) {
+    hasNextAsync(std::move(success), std::move(completion));
+  });
+}
+
+void EntityReferencePager::getAsync(GetSuccessCallback successCallback,
+                                    CompletionCallback completionCallback) {
+  if (!prefetcher_) {
+    pagerInterface_->getAsync(
+        hostSession_, std::move(successCallback),
+        retainUntilComplete(shared_from_this(), std::move(completionCallback)));
+    return;
+  }
+  internal::runOnHostScheduler(
+      hostSession_,
+      [self = shared_from_this(), successCallback = std::move(successCallback)] {
+        successCallback(self->get());
+      },
+      std::move(completionCallback));
+}
+
+std::future<EntityReferencePager::Page> EntityReferencePager::getAsync() {
+  return startWithFuture<Page>([&](auto success, auto completion) {
+    getAsync(std::move(success), std::move(completion));
+  });
+}
+
+void EntityReferencePager::nextAsync(CompletionCallback completionCallback) {
+  if (!prefetcher_) {
+    pagerInterface_->nextAsync(
+        hostSession_, retainUntilComplete(shared_from_this(), std::move(completionCallback)));
+    return;
+  }
+  internal::runOnHostScheduler(
+      hostSession_, [self = shared_from_this()] { self->next(); }, std::move(completionCallback));
+}
+
+std::future<void> EntityReferencePager::nextAsync() {
+  auto promise = std::make_shared<std::promise<void>>();
+  std::future<void> future = promise->get_future();
+  nextAsync([promise](std::exception_ptr exception) {
+    if (exception) {
+      promise->set_exception(std::move(exception));
+    } else {
+      promise->set_value();
+    }
+  });
+  return future;
+}
 
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "EntityReferenceStringCache.hpp"
+
+#include "../internal/footprint.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+EntityReferenceStringCache::EntityReferenceStringCache(const std::size_t capacity)
+    : capacity_{capacity} {}
+
+std::optional<bool> EntityReferenceStringCache::lookup(const std::string_view someString) {
+  const std::lock_guard lock{mutex_};
+  const auto iter = index_.find(someString);
+  if (iter == index_.end()) {
+    return std::nullopt;
+  }
+  entries_.splice(entries_.begin(), entries_, iter->second);
+  return iter->second->second;
+}
+
+void EntityReferenceStringCache::insert(const Str& someString, const bool isEntityReference) {
+  const std::lock_guard lock{mutex_};
+  if (const auto iter = index_.find(someString); iter != index_.end()) {
+    iter->second->second = isEntityReference;
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    return;
+  }
+
+  while (entries_.size() >= capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+
+  entries_.emplace_front(someString, isEntityReference);
+  index_.emplace(entries_.front().first, entries_.begin());
+}
+
+void EntityReferenceStringCache::clear() {
+  const std::lock_guard lock{mutex_};
+  index_.clear();
+  entries_.clear();
+}
+
+std::size_t EntityReferenceStringCache::memoryUsage() {
+  namespace footprint = internal::footprint;
+  const std::lock_guard lock{mutex_};
+  std::size_t bytes = sizeof(EntityReferenceStringCache) + footprint::hashTableBytes(index_);
+  for (const auto& [someString, isEntityReference] : entries_) {
+    bytes += footprint::listNodeBytes<Entries::value_type>() + footprint::heapBytes(someString);
+  }
+  return bytes;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Bounded, thread-safe memo of isEntityReferenceString results.
+ *
+ * Both positive and negative results are retained. Once full, the
+ * least recently used entries are evicted.
+ */
+class EntityReferenceStringCache {
+ public:
+  explicit EntityReferenceStringCache(std::size_t capacity);
+
+  /// @return Cached result, if any.
+  std::optional<bool> lookup(std::string_view someString);
+
+  /// Cache a result, replacing any existing entry.
+  void insert(const Str& someString, bool isEntityReference);
+
+  /// Discard all entries.
+  void clear();
+
+  /// @return Approximate number of bytes used by this cache.
+  [[nodiscard]] std::size_t memoryUsage();
+
+ private:
+  using Entries = std::list<std::pair<Str, bool>>;
+
+  const std::size_t capacity_;
+  std::mutex mutex_;
+  Entries entries_;
+  // Keys are views of the (address-stable) list node strings.
+  std::unordered_map<std::string_view, Entries::iterator> index_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
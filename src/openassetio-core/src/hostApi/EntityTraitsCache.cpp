@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "EntityTraitsCache.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+#include <utility>
+
+#include "../internal/footprint.hpp"
+#include "../trait/hashing.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+EntityTraitsCache::Key::Key(const EntityReference& entityReference_,
+                            const access::EntityTraitsAccess entityTraitsAccess_,
+                            const ContextConstPtr& context_)
+    : entityReference{entityReference_},
+      entityTraitsAccess{entityTraitsAccess_},
+      context{context_} {
+  // NOLINTBEGIN(readability-magic-numbers)
+  std::uint64_t combined = std::hash<Str>{}(entityReference.toString());
+  combined = combined * 31U + static_cast<std::uint64_t>(entityTraitsAccess);
+  combined = combined * 31U + context.hash;
+  // NOLINTEND(readability-magic-numbers)
+  hash = trait::mixHash(combined);
+}
+
+bool EntityTraitsCache::Key::operator==(const Key& other) const {
+  return hash == other.hash && entityTraitsAccess == other.entityTraitsAccess &&
+         entityReference == other.entityReference && context == other.context;
+}
+
+EntityTraitsCache::EntityTraitsCache(const std::size_t capacity) : entries_{capacity} {}
+
+std::optional<trait::TraitSet> EntityTraitsCache::lookup(
+    const EntityReference& entityReference, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context) {
+  const Key key{entityReference, entityTraitsAccess, context};
+  const std::lock_guard lock{mutex_};
+  const trait::TraitSet* cached = entries_.find(key);
+  if (cached == nullptr) {
+    return std::nullopt;
+  }
+  return *cached;
+}
+
+void EntityTraitsCache::insert(const EntityReference& entityReference,
+                               const access::EntityTraitsAccess entityTraitsAccess,
+                               const ContextConstPtr& context, trait::TraitSet traitSet) {
+  Key key{entityReference, entityTraitsAccess, context};
+  const std::lock_guard lock{mutex_};
+  entries_.insert(std::move(key), std::move(traitSet));
+}
+
+template <class Predicate>
+void EntityTraitsCache::eraseIf(const Predicate& predicate) {
+  entries_.eraseIf([&predicate](const Key& key, const trait::TraitSet&) {
+    return predicate(key.entityReference.toString());
+  });
+}
+
+void EntityTraitsCache::invalidate(const EntityReferences& entityReferences) {
+  std::unordered_set<std::string_view> refs;
+  for (const EntityReference& entityReference : entityReferences) {
+    refs.insert(entityReference.toString());
+  }
+  const std::lock_guard lock{mutex_};
+  eraseIf([&refs](const Str& ref) { return refs.count(ref) != 0; });
+}
+
+void EntityTraitsCache::invalidatePrefix(const std::string_view prefix) {
+  const std::lock_guard lock{mutex_};
+  eraseIf([prefix](const Str& ref) {
+    return std::string_view{ref}.substr(0, prefix.size()) == prefix;
+  });
+}
+
+void EntityTraitsCache::clear() {
+  const std::lock_guard lock{mutex_};
+  entries_.clear();
+}
+
+std::size_t EntityTraitsCache::memoryUsage() {
+  namespace footprint = internal::footprint;
+  const std::lock_guard lock{mutex_};
+  std::size_t bytes = sizeof(EntityTraitsCache) + entries_.heapBytes();
+  for (const auto& [key, traitSet] : entries_.entries()) {
+    bytes += footprint::heapBytes(key.entityReference.toString()) + key.context.heapBytes() +
+             footprint::heapBytes(traitSet);
+  }
+  return bytes;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "ContextKey.hpp"
+#include "LruCache.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Bounded, thread-safe memo of entityTraits results.
+ *
+ * Results are keyed by entity reference, access mode and Context, as
+ * for the ResolveCache, since the traits an entity has for write may
+ * differ from those it has for read. Once full, the least recently
+ * used entries are evicted.
+ */
+class EntityTraitsCache {
+ public:
+  explicit EntityTraitsCache(std::size_t capacity);
+
+  /// @return Cached result, if any.
+  std::optional<trait::TraitSet> lookup(const EntityReference& entityReference,
+                                        access::EntityTraitsAccess entityTraitsAccess,
+                                        const ContextConstPtr& context);
+
+  /// Cache a result, replacing any existing entry.
+  void insert(const EntityReference& entityReference,
+              access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+              trait::TraitSet traitSet);
+
+  /// Discard entries for the given entities, under any access mode or
+  /// Context.
+  void invalidate(const EntityReferences& entityReferences);
+
+  /// Discard entries for entities whose reference starts with a
+  /// prefix.
+  void invalidatePrefix(std::string_view prefix);
+
+  /// Discard all entries.
+  void clear();
+
+  /// @return Approximate number of bytes used by this cache.
+  [[nodiscard]] std::size_t memoryUsage();
+
+ private:
+  struct Key {
+    Key(const EntityReference& entityReference_, access::EntityTraitsAccess entityTraitsAccess_,
+        const ContextConstPtr& context_);
+
+    bool operator==(const Key& other) const;
+
+    EntityReference entityReference;
+    access::EntityTraitsAccess entityTraitsAccess;
+    ContextKey context;
+    std::size_t hash = 0;
+  };
+
+  /// Erase entries matching a predicate on their entity reference.
+  /// Must be called with mutex_ held.
+  template <class Predicate>
+  void eraseIf(const Predicate& predicate);
+
+  std::mutex mutex_;
+  LruCache<Key, trait::TraitSet> entries_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,12 +1,25 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/typedefs.hpp>
 
+#include "../internal/ThreadPool.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace hostApi {
 InfoDictionary HostInterface::info() { return {}; }
+
+void HostInterface::submit(Task task) {
+  internal::ThreadPool::defaultPool().submit(std::move(task));
+}
+
+void HostInterface::parallelFor(const std::size_t count, const ParallelForBody& body) {
+  internal::ThreadPool::defaultPool().parallelFor(count, body);
+}
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
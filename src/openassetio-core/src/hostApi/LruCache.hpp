@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include <openassetio/export.h>
+
+#include "../internal/footprint.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Bounded map from Context-dependent keys to cached results, evicting
+ * the least recently used entries once full.
+ *
+ * Entries are held in a list ordered most to least recently used,
+ * indexed by a hash map referencing the (address-stable) list nodes,
+ * so each key is stored once.
+ *
+ * `Key` must be equality comparable, and have a precomputed `hash`
+ * member and a `context` member of type ContextKey. Entries whose
+ * manager state has been destroyed can never be hit again, so are
+ * periodically pruned, rather than waiting to be evicted.
+ *
+ * Not thread-safe: callers must synchronise access.
+ */
+template <class Key, class Value>
+class LruCache {
+ public:
+  using Entries = std::list<std::pair<Key, Value>>;
+
+  explicit LruCache(const std::size_t capacity) : capacity_{capacity} {}
+
+  /// @return Cached value, now most recently used, or `nullptr`.
+  Value* find(const Key& key) {
+    const auto iter = index_.find(key);
+    if (iter == index_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    return &iter->second->second;
+  }
+
+  /**
+   * Cache a value, replacing any existing entry.
+   *
+   * @return Number of entries evicted to make room.
+   */
+  std::size_t insert(Key key, Value value) {
+    if (const auto iter = index_.find(key); iter != index_.end()) {
+      iter->second->second = std::move(value);
+      entries_.splice(entries_.begin(), entries_, iter->second);
+      return 0;
+    }
+
+    // Prune at most once per `capacity_` insertions, so the cost of a
+    // full scan is amortised.
+    if (++insertsSincePrune_ >= capacity_) {
+      insertsSincePrune_ = 0;
+      eraseIf([](const Key& cachedKey, const Value&) { return cachedKey.context.isExpired(); });
+    }
+
+    std::size_t evicted = 0;
+    while (entries_.size() >= capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+      ++evicted;
+    }
+
+    entries_.emplace_front(std::move(key), std::move(value));
+    index_.emplace(entries_.front().first, entries_.begin());
+    return evicted;
+  }
+
+  /// Erase entries for which `predicate(key, value)` returns true.
+  template <class Predicate>
+  void eraseIf(const Predicate& predicate) {
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+      if (predicate(iter->first, iter->second)) {
+        index_.erase(iter->first);
+        iter = entries_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+  void clear() {
+    index_.clear();
+    entries_.clear();
+  }
+
+  [[nodiscard]] std::size_t size() const { return entries_.size(); }
+
+  [[nodiscard]] const Entries& entries() const { return entries_; }
+
+  /// Heap bytes of the containers, excluding those owned by keys and
+  /// values.
+  [[nodiscard]] std::size_t heapBytes() const {
+    namespace footprint = internal::footprint;
+    return footprint::hashTableBytes(index_) +
+           entries_.size() * footprint::listNodeBytes<typename Entries::value_type>();
+  }
+
+ private:
+  using KeyRef = std::reference_wrapper<const Key>;
+
+  struct KeyRefHash {
+    std::size_t operator()(const KeyRef& key) const noexcept { return key.get().hash; }
+  };
+
+  struct KeyRefEqual {
+    bool operator()(const KeyRef& lhs, const KeyRef& rhs) const { return lhs.get() == rhs.get(); }
+  };
+
+  const std::size_t capacity_;
+  std::size_t insertsSincePrune_ = 0;
+  Entries entries_;
+  std::unordered_map<KeyRef, typename Entries::iterator, KeyRefHash, KeyRefEqual> index_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "ManagementPolicyCache.hpp"
+
+#include <cstdint>
+#include <utility>
+
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../internal/footprint.hpp"
+#include "../trait/hashing.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+ManagementPolicyCache::Key::Key(const trait::TraitSet& traitSet_,
+                                const access::PolicyAccess policyAccess_, ContextKey context_)
+    : traitSet{traitSet_}, policyAccess{policyAccess_}, context{std::move(context_)} {
+  // NOLINTBEGIN(readability-magic-numbers)
+  std::uint64_t combined = trait::TraitSetHash{}(traitSet);
+  combined = combined * 31U + static_cast<std::uint64_t>(policyAccess);
+  combined = combined * 31U + context.hash;
+  // NOLINTEND(readability-magic-numbers)
+  hash = trait::mixHash(combined);
+}
+
+bool ManagementPolicyCache::Key::operator==(const Key& other) const {
+  return hash == other.hash && policyAccess == other.policyAccess &&
+         traitSet == other.traitSet && context == other.context;
+}
+
+ManagementPolicyCache::ManagementPolicyCache(const bool isContextSensitive,
+                                             const std::size_t capacity)
+    : isContextSensitive_{isContextSensitive}, entries_{capacity} {}
+
+trait::TraitsDataPtr ManagementPolicyCache::lookup(const trait::TraitSet& traitSet,
+                                                   const access::PolicyAccess policyAccess,
+                                                   const ContextConstPtr& context) {
+  const Key key = makeKey(traitSet, policyAccess, context);
+  const std::lock_guard lock{mutex_};
+  const trait::TraitsDataConstPtr* cached = entries_.find(key);
+  if (cached == nullptr) {
+    return nullptr;
+  }
+  // Copy-on-write, so this is cheap.
+  return trait::TraitsData::make(*cached);
+}
+
+void ManagementPolicyCache::insert(const trait::TraitSet& traitSet,
+                                   const access::PolicyAccess policyAccess,
+                                   const ContextConstPtr& context,
+                                   const trait::TraitsDataConstPtr& policy) {
+  Key key = makeKey(traitSet, policyAccess, context);
+  trait::TraitsDataConstPtr value = trait::TraitsData::make(policy);
+  const std::lock_guard lock{mutex_};
+  entries_.insert(std::move(key), std::move(value));
+}
+
+void ManagementPolicyCache::clear() {
+  const std::lock_guard lock{mutex_};
+  entries_.clear();
+}
+
+std::size_t ManagementPolicyCache::memoryUsage() {
+  namespace footprint = internal::footprint;
+  const std::lock_guard lock{mutex_};
+  std::size_t bytes = sizeof(ManagementPolicyCache) + entries_.heapBytes();
+  for (const auto& [key, policy] : entries_.entries()) {
+    bytes += footprint::heapBytes(key.traitSet) + key.context.heapBytes() + policy->memoryUsage();
+  }
+  return bytes;
+}
+
+ManagementPolicyCache::Key ManagementPolicyCache::makeKey(const trait::TraitSet& traitSet,
+                                                          const access::PolicyAccess policyAccess,
+                                                          const ContextConstPtr& context) const {
+  return {traitSet, policyAccess, isContextSensitive_ ? ContextKey{context} : ContextKey{}};
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+#include <openassetio/access.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "ContextKey.hpp"
+#include "LruCache.hpp"
+
+OPENASSETIO_FWD_DECLARE(Context)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Thread-safe memo of managementPolicy results, per trait set.
+ *
+ * Results are keyed on the trait set and access mode. If the manager
+ * has declared its policy to be context-sensitive, the key also
+ * includes the contents of the Context's locale and the identity of
+ * its manager state.
+ *
+ * Policy is expected to be static for a session, but a
+ * context-sensitive memo may see many distinct Contexts, e.g. one per
+ * shot or task, so it is bounded. Once full, the least recently used
+ * entries are evicted.
+ */
+class ManagementPolicyCache {
+ public:
+  /// Default maximum number of entries.
+  static constexpr std::size_t kDefaultCapacity = 1024;
+
+  explicit ManagementPolicyCache(bool isContextSensitive,
+                                 std::size_t capacity = kDefaultCapacity);
+
+  /// @return Copy of the cached policy, or `nullptr` if not cached.
+  trait::TraitsDataPtr lookup(const trait::TraitSet& traitSet, access::PolicyAccess policyAccess,
+                              const ContextConstPtr& context);
+
+  /// Cache a copy of a policy, replacing any existing entry.
+  void insert(const trait::TraitSet& traitSet, access::PolicyAccess policyAccess,
+              const ContextConstPtr& context, const trait::TraitsDataConstPtr& policy);
+
+  /// Discard all entries.
+  void clear();
+
+  /// @return Approximate number of bytes used by this cache.
+  [[nodiscard]] std::size_t memoryUsage();
+
+ private:
+  struct Key {
+    Key(const trait::TraitSet& traitSet_, access::PolicyAccess policyAccess_,
+        ContextKey context_);
+
+    bool operator==(const Key& other) const;
+
+    trait::TraitSet traitSet;
+    access::PolicyAccess policyAccess;
+    ContextKey context;
+    std::size_t hash = 0;
+  };
+
+  [[nodiscard]] Key makeKey(const trait::TraitSet& traitSet, access::PolicyAccess policyAccess,
+                            const ContextConstPtr& context) const;
+
+  const bool isContextSensitive_;
+  std::mutex mutex_;
+  LruCache<Key, trait::TraitsDataConstPtr> entries_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,31 +1,78 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
+#include <algorithm>
 #include <array>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <regex>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
+#include <openassetio/EntityReferenceBatch.hpp>
+#include <openassetio/EntityReferenceSpan.hpp>
+#include <openassetio/FunctionRef.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/MemoryResource.hpp>
 #include <openassetio/constants.hpp>
 #include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ApiAuditor.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerMetrics.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
 #include <openassetio/internal.hpp>
+#include <openassetio/log/BufferedLogger.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/EntityExistenceFilter.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trace/TracerInterface.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/typedefs.hpp>
 
 #include "../errors/exceptionMessages.hpp"
+#include "DefaultEntityReferenceCache.hpp"
+#include "EntityReferenceMatcher.hpp"
+#include "EntityReferenceStringCache.hpp"
+#include "EntityTraitsCache.hpp"
+#include "ManagementPolicyCache.hpp"
+#include "ManagerStatePool.hpp"
+#include "PendingResolveTable.hpp"
+#include "PersistenceTokenCache.hpp"
+#include "RequestScheduler.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace {
 
+/// Capabilities that all manager plugins must support.
+constexpr std::array kRequiredCapabilities = {
+    managerApi::ManagerInterface::Capability::kEntityReferenceIdentification,
+    managerApi::ManagerInterface::Capability::kManagementPolicyQueries,
+    managerApi::ManagerInterface::Capability::kEntityTraitIntrospection,
+};
+
 /**
  * Validate the supplied ManagerInterface supports all required
  * capabilities, or throw a ConfigurationException.
@@ -37,12 +84,6 @@ namespace {
 void verifyRequiredCapabilities(const managerApi::ManagerInterfacePtr &interface) {
   using managerApi::ManagerInterface;
 
-  static constexpr std::array kRequiredCapabilities = {
-      ManagerInterface::Capability::kEntityReferenceIdentification,
-      ManagerInterface::Capability::kManagementPolicyQueries,
-      ManagerInterface::Capability::kEntityTraitIntrospection,
-  };
-
   std::vector<std::string> missingCapabilities;
   for (const ManagerInterface::Capability capability : kRequiredCapabilities) {
     if (!interface->hasCapability(capability)) {
@@ -62,6 +103,11 @@ void verifyRequiredCapabilities(const managerApi::ManagerInterfacePtr &interface
   throw errors::ConfigurationException(msg);
 }
 
+/// Count a call to a public Manager method with the ApiAuditor.
+void auditCall(const hostApi::ApiAuditor::Method method) {
+  hostApi::ApiAuditor::instance()->recordCall(hostApi::ApiAuditor::Api::kManager, method);
+}
+
 /**
  * Extract the entity reference prefix from a manager plugin's info
  * dictionary, if available.
@@ -69,14 +115,16 @@ void verifyRequiredCapabilities(const managerApi::ManagerInterfacePtr &interface
 std::optional<Str> entityReferencePrefixFromInfo(const log::LoggerInterfacePtr &logger,
                                                  const InfoDictionary &info) {
   // Check if the info dict has the prefix key.
-  if (auto iter = info.find(Str{constants::kInfoKey_EntityReferencesMatchPrefix});
+  if (auto iter = info.find(constants::kInfoKey_EntityReferencesMatchPrefix);
       iter != info.end()) {
     if (const auto *prefixPtr = std::get_if<openassetio::Str>(&iter->second)) {
-      logger->debugApi(
-          fmt::format("Entity reference prefix '{}' provided by manager's info() dict. Subsequent"
-                      " calls to isEntityReferenceString will use this prefix rather than call the"
-                      " manager's implementation.",
-                      *prefixPtr));
+      logger->logLazily(log::LoggerInterface::Severity::kDebugApi, [&] {
+        return fmt::format(
+            "Entity reference prefix '{}' provided by manager's info() dict. Subsequent calls to"
+            " isEntityReferenceString will use this prefix rather than call the manager's"
+            " implementation.",
+            *prefixPtr);
+      });
 
       return *prefixPtr;
     }
@@ -87,141 +135,1896 @@ std::optional<Str> entityReferencePrefixFromInfo(const log::LoggerInterfacePtr &
   // Prefix string not found, so return unset optional.
   return {};
 }
+
+/**
+ * Construct a native entity reference recogniser from a manager
+ * plugin's info dictionary, if it provides prefix(es) and/or a
+ * pattern.
+ */
+std::shared_ptr<const hostApi::EntityReferenceMatcher> entityReferenceMatcherFromInfo(
+    const log::LoggerInterfacePtr &logger, const InfoDictionary &info) {
+  auto matcher = std::make_shared<hostApi::EntityReferenceMatcher>();
+
+  if (const std::optional<Str> prefix = entityReferencePrefixFromInfo(logger, info)) {
+    matcher->addPrefix(*prefix);
+  }
+
+  if (auto iter = info.find(constants::kInfoKey_EntityReferencesMatchPrefixes);
+      iter != info.end()) {
+    if (const auto *prefixesPtr = std::get_if<Str>(&iter->second)) {
+      std::string_view remaining = *prefixesPtr;
+      while (!remaining.empty()) {
+        const std::size_t end = std::min(remaining.find('\n'), remaining.size());
+        if (end > 0) {
+          matcher->addPrefix(remaining.substr(0, end));
+        }
+        remaining.remove_prefix(std::min(end + 1, remaining.size()));
+      }
+    } else {
+      logger->warning(
+          "Entity reference prefixes given but are an invalid type: should be a string.");
+    }
+  }
+
+  if (auto iter = info.find(constants::kInfoKey_EntityReferencesMatchPattern);
+      iter != info.end()) {
+    if (const auto *patternPtr = std::get_if<Str>(&iter->second)) {
+      try {
+        matcher->setPattern(*patternPtr);
+      } catch (const std::regex_error &exc) {
+        logger->warning(fmt::format(
+            "Entity reference pattern '{}' is invalid and will be ignored: {}", *patternPtr,
+            exc.what()));
+      }
+    } else {
+      logger->warning(
+          "Entity reference pattern given but is an invalid type: should be a string.");
+    }
+  }
+
+  if (matcher->empty()) {
+    return nullptr;
+  }
+  return matcher;
+}
+
+/**
+ * Determine whether a manager plugin has declared itself thread-safe
+ * in its info dictionary.
+ */
+bool isThreadSafeFromInfo(const InfoDictionary &info) {
+  const auto iter = info.find(constants::kInfoKey_IsThreadSafe);
+  if (iter == info.end()) {
+    return false;
+  }
+  const auto *isThreadSafe = std::get_if<Bool>(&iter->second);
+  return isThreadSafe && *isThreadSafe;
+}
+
+/**
+ * Determine whether a manager plugin's info dictionary declares that
+ * management policy depends on the Context.
+ */
+bool isManagementPolicyContextSensitiveFromInfo(const InfoDictionary &info) {
+  const auto iter = info.find(constants::kInfoKey_IsManagementPolicyContextSensitive);
+  if (iter == info.end()) {
+    return false;
+  }
+  const auto *isContextSensitive = std::get_if<Bool>(&iter->second);
+  return isContextSensitive && *isContextSensitive;
+}
+
+/**
+ * Determine whether a manager plugin's info dictionary declares that
+ * it caches resolve results itself.
+ */
+bool isResolveCachedFromInfo(const InfoDictionary &info) {
+  const auto iter = info.find(constants::kInfoKey_IsResolveCached);
+  if (iter == info.end()) {
+    return false;
+  }
+  const auto *isResolveCached = std::get_if<Bool>(&iter->second);
+  return isResolveCached && *isResolveCached;
+}
+
+/**
+ * Determine the maximum batch size declared in a manager plugin's info
+ * dictionary, or zero if there is no maximum.
+ */
+std::size_t maxBatchSizeFromInfo(const InfoDictionary &info) {
+  const auto iter = info.find(constants::kInfoKey_MaxBatchSize);
+  if (iter == info.end()) {
+    return 0;
+  }
+  const auto *maxBatchSize = std::get_if<Int>(&iter->second);
+  return maxBatchSize && *maxBatchSize > 0 ? static_cast<std::size_t>(*maxBatchSize) : 0;
+}
+
+/**
+ * Validate that parallel batch argument lists are of the same length,
+ * or throw an InputValidationException.
+ */
+void verifyBatchLengths(const std::size_t numEntityReferences, const std::size_t numOther,
+                        const std::string_view otherDescription) {
+  if (numEntityReferences == numOther) {
+    return;
+  }
+  std::string message = "Parameter lists must be of the same length: ";
+  message += std::to_string(numEntityReferences);
+  message += " entity references vs. ";
+  message += std::to_string(numOther);
+  message += " ";
+  message += otherDescription;
+  message += ".";
+  throw errors::InputValidationException{message};
+}
+
+/**
+ * Determine whether cancellation has been requested via the Context's
+ * CancellationToken, if any.
+ */
+bool isCancelled(const ContextConstPtr &context) {
+  return context && context->cancellationToken && context->cancellationToken->isCancelled();
+}
+
+/// Signature of a batch callback type.
+template <class Callback>
+struct CallbackSignature;
+
+template <class R, class... Args>
+struct CallbackSignature<std::function<R(Args...)>> {
+  using Type = R(Args...);
+};
+
+/**
+ * Wrap a callable as the given batch callback type, without
+ * allocating, regardless of the size of its captures.
+ *
+ * The callable is referenced rather than copied, so the callback must
+ * not outlive it. This is the case when passing a temporary callable
+ * to a synchronous dispatch, since the temporary lives until the
+ * dispatch returns.
+ */
+template <class Callback, class Callable>
+Callback borrowCallback(const Callable &callable) {
+  return Callback{FunctionRef<typename CallbackSignature<Callback>::Type>{callable}};
+}
+
+/**
+ * Report the given elements of a batch as cancelled.
+ */
+void reportCancelled(const std::vector<bool> &reported,
+                     const hostApi::Manager::BatchElementErrorCallback &errorCallback) {
+  for (std::size_t idx = 0; idx < reported.size(); ++idx) {
+    if (!reported[idx]) {
+      errorCallback(
+          idx, errors::BatchElementError{errors::BatchElementError::ErrorCode::kCancelled,
+                                         "Operation was cancelled"});
+    }
+  }
+}
+
+/**
+ * Dispatch a batch to the manager plugin, honouring the Context's
+ * CancellationToken, if any.
+ *
+ * If cancellation has already been requested, the plugin is not
+ * called. Otherwise, once the plugin returns, if cancellation has
+ * since been requested then any elements the plugin did not report
+ * are reported as cancelled. This allows plugins to simply stop early.
+ *
+ * Elements are only tracked if the Context has a token, so there is
+ * no overhead otherwise.
+ */
+template <class SuccessCallback, class Dispatch>
+void dispatchCancellable(const ContextConstPtr &context, const std::size_t batchSize,
+                         const SuccessCallback &successCallback,
+                         const hostApi::Manager::BatchElementErrorCallback &errorCallback,
+                         const Dispatch &dispatch) {
+  if (!context || !context->cancellationToken) {
+    dispatch(successCallback, errorCallback);
+    return;
+  }
+
+  std::vector<bool> reported(batchSize, false);
+  if (!context->cancellationToken->isCancelled()) {
+    dispatch(borrowCallback<SuccessCallback>([&](const std::size_t idx, auto value) {
+               reported[idx] = true;
+               successCallback(idx, std::move(value));
+             }),
+             borrowCallback<hostApi::Manager::BatchElementErrorCallback>(
+                 [&](const std::size_t idx, errors::BatchElementError error) {
+                   reported[idx] = true;
+                   errorCallback(idx, std::move(error));
+                 }));
+    if (!context->cancellationToken->isCancelled()) {
+      return;
+    }
+  }
+  reportCancelled(reported, errorCallback);
+}
+
+/// Number of cached resolve callbacks in progress on this thread.
+thread_local std::size_t tlsResolveCallbackDepth = 0;
+
+/// Marks the current thread as within a cached resolve callback, for
+/// the lifetime of the scope.
+struct CallbackScope {
+  CallbackScope() { ++tlsResolveCallbackDepth; }
+  CallbackScope(const CallbackScope &) = delete;
+  CallbackScope &operator=(const CallbackScope &) = delete;
+  ~CallbackScope() { --tlsResolveCallbackDepth; }
+};
+
+/**
+ * Admit a call to the manager plugin with the scheduler, if any.
+ *
+ * @return Admission to hold for the duration of the call, if
+ * scheduled.
+ */
+std::optional<hostApi::RequestScheduler::Admission> admit(hostApi::RequestScheduler *scheduler,
+                                                          const ContextConstPtr &context) {
+  if (!scheduler) {
+    return std::nullopt;
+  }
+  return scheduler->admit(context);
+}
+
+/**
+ * Dispatch a batch to the manager plugin in consecutive chunks of at
+ * most `maxBatchSize` elements, mapping the indices reported for each
+ * chunk back to the full batch.
+ *
+ * If `maxBatchSize` is zero, or the batch is no larger, it is
+ * dispatched as-is. Each chunk is admitted by the `scheduler`, if
+ * any, before dispatch. Further chunks are not dispatched once the
+ * Context's CancellationToken is cancelled.
+ */
+template <class SuccessCallback, class Dispatch>
+void dispatchChunked(const std::size_t maxBatchSize, hostApi::RequestScheduler *scheduler,
+                     const EntityReferences &entityReferences, const ContextConstPtr &context,
+                     const SuccessCallback &successCallback,
+                     const hostApi::Manager::BatchElementErrorCallback &errorCallback,
+                     const Dispatch &dispatch) {
+  if (maxBatchSize == 0 || entityReferences.size() <= maxBatchSize) {
+    const auto admission = admit(scheduler, context);
+    dispatch(entityReferences, successCallback, errorCallback);
+    return;
+  }
+
+  for (std::size_t begin = 0; begin < entityReferences.size(); begin += maxBatchSize) {
+    const auto admission = admit(scheduler, context);
+    if (isCancelled(context)) {
+      return;
+    }
+    const std::size_t end = std::min(begin + maxBatchSize, entityReferences.size());
+    const EntityReferences chunk(entityReferences.begin() + static_cast<std::ptrdiff_t>(begin),
+                                 entityReferences.begin() + static_cast<std::ptrdiff_t>(end));
+    dispatch(chunk,
+             borrowCallback<SuccessCallback>([&](const std::size_t chunkElementIdx, auto value) {
+               successCallback(begin + chunkElementIdx, std::move(value));
+             }),
+             borrowCallback<hostApi::Manager::BatchElementErrorCallback>(
+                 [&](const std::size_t chunkElementIdx, errors::BatchElementError error) {
+                   errorCallback(begin + chunkElementIdx, std::move(error));
+                 }));
+  }
+}
+
+/**
+ * Dispatch a batch, stopping at the first element error.
+ *
+ * Rather than throwing from the error callback, which would unwind
+ * through the manager plugin (and any language bindings), the first
+ * error is recorded and results reported after it are discarded.
+ *
+ * If `shouldStopManager` is set, the plugin is also asked to stop via
+ * the CancellationToken of a Context it is given in place of the
+ * caller's. The token is a child of the caller's token, if any, so
+ * that the caller can still cancel the call. Otherwise, the caller's
+ * Context is passed through unmodified.
+ *
+ * @return The first error, if any.
+ */
+template <class Value, class Dispatch>
+std::optional<hostApi::Manager::IndexedBatchElementError> dispatchFailFast(
+    const ContextConstPtr &context, const bool shouldStopManager, std::vector<Value> &results,
+    const Dispatch &dispatch) {
+  ContextPtr stopContext;
+  if (shouldStopManager && context) {
+    stopContext = Context::make(context->locale, context->managerState);
+    stopContext->cancellationToken = context->cancellationToken
+                                         ? CancellationToken::makeChild(context->cancellationToken)
+                                         : CancellationToken::make();
+    stopContext->priority = context->priority;
+  }
+
+  std::optional<hostApi::Manager::IndexedBatchElementError> firstError;
+  dispatch(
+      stopContext ? stopContext : context,
+      [&](const std::size_t idx, Value value) {
+        if (!firstError) {
+          results[idx] = std::move(value);
+        }
+      },
+      [&](const std::size_t idx, errors::BatchElementError error) {
+        if (firstError) {
+          return;
+        }
+        firstError.emplace(idx, std::move(error));
+        if (stopContext) {
+          stopContext->cancellationToken->cancel();
+        }
+      });
+  return firstError;
+}
+
+/**
+ * Copy a result for reporting against a repeated entity reference.
+ */
+template <class Value>
+Value copyForDuplicate(const Value &value) {
+  return value;
+}
+
+/**
+ * Copy resolved data for reporting against a repeated entity
+ * reference.
+ *
+ * The data is copied (cheaply, as it is copy-on-write), rather than
+ * shared, so that modification of the result for one element by the
+ * caller doesn't affect another.
+ */
+trait::TraitsDataPtr copyForDuplicate(const trait::TraitsDataPtr &value) {
+  return value ? trait::TraitsData::make(value) : nullptr;
+}
+
+/**
+ * Dispatch a batch to the manager plugin with repeated entity
+ * references removed, reporting each result against every occurrence.
+ *
+ * If disabled, or if there are no repeated references, the batch is
+ * dispatched unmodified.
+ */
+template <class SuccessCallback, class Dispatch>
+void dispatchDeduplicated(const bool enabled, const EntityReferences &entityReferences,
+                          const SuccessCallback &successCallback,
+                          const hostApi::Manager::BatchElementErrorCallback &errorCallback,
+                          const Dispatch &dispatch) {
+  if (!enabled) {
+    dispatch(entityReferences, successCallback, errorCallback);
+    return;
+  }
+
+  static constexpr std::size_t kNoIdx = std::numeric_limits<std::size_t>::max();
+
+  // Occurrences of each unique reference are chained together, from
+  // the index of the first occurrence, via `nextIdxs`.
+  std::unordered_map<std::reference_wrapper<const EntityReference>, std::size_t,
+                     std::hash<EntityReference>, std::equal_to<EntityReference>>
+      uniqueIdxs;
+  uniqueIdxs.reserve(entityReferences.size());
+  std::vector<std::size_t> firstIdxs;
+  std::vector<std::size_t> lastIdxs;
+  std::vector<std::size_t> nextIdxs(entityReferences.size(), kNoIdx);
+
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const auto [iter, inserted] = uniqueIdxs.try_emplace(entityReferences[idx], firstIdxs.size());
+    if (inserted) {
+      firstIdxs.push_back(idx);
+      lastIdxs.push_back(idx);
+    } else {
+      nextIdxs[lastIdxs[iter->second]] = idx;
+      lastIdxs[iter->second] = idx;
+    }
+  }
+
+  if (firstIdxs.size() == entityReferences.size()) {
+    dispatch(entityReferences, successCallback, errorCallback);
+    return;
+  }
+
+  EntityReferences uniqueRefs;
+  uniqueRefs.reserve(firstIdxs.size());
+  for (const std::size_t idx : firstIdxs) {
+    uniqueRefs.push_back(entityReferences[idx]);
+  }
+
+  dispatch(uniqueRefs,
+           borrowCallback<SuccessCallback>([&](const std::size_t uniqueIdx, auto value) {
+             const std::size_t firstIdx = firstIdxs[uniqueIdx];
+             for (std::size_t idx = nextIdxs[firstIdx]; idx != kNoIdx; idx = nextIdxs[idx]) {
+               successCallback(idx, copyForDuplicate(value));
+             }
+             successCallback(firstIdx, std::move(value));
+           }),
+           borrowCallback<hostApi::Manager::BatchElementErrorCallback>(
+               [&](const std::size_t uniqueIdx, errors::BatchElementError error) {
+                 const std::size_t firstIdx = firstIdxs[uniqueIdx];
+                 for (std::size_t idx = nextIdxs[firstIdx]; idx != kNoIdx; idx = nextIdxs[idx]) {
+                   errorCallback(idx, error);
+                 }
+                 errorCallback(firstIdx, std::move(error));
+               }));
+}
+
+/**
+ * Dispatch a batch to the manager plugin, omitting elements whose
+ * result is known host-side, and mapping the indices reported for the
+ * remainder back to the full batch.
+ *
+ * `lookup` is given each element, e.g. entity reference, and returns
+ * its result if known, which is reported immediately. If no results
+ * are known, the batch is dispatched as-is.
+ */
+template <class Element, class SuccessCallback, class Lookup, class Dispatch>
+void dispatchUnknown(const std::vector<Element> &elements, const SuccessCallback &successCallback,
+                     const hostApi::Manager::BatchElementErrorCallback &errorCallback,
+                     const Lookup &lookup, const Dispatch &dispatch) {
+  std::vector<std::size_t> unknownIdxs;
+  for (std::size_t idx = 0; idx < elements.size(); ++idx) {
+    if (auto value = lookup(elements[idx])) {
+      successCallback(idx, std::move(*value));
+    } else {
+      unknownIdxs.push_back(idx);
+    }
+  }
+
+  if (unknownIdxs.empty()) {
+    return;
+  }
+  if (unknownIdxs.size() == elements.size()) {
+    dispatch(elements, successCallback, errorCallback);
+    return;
+  }
+
+  std::vector<Element> unknownElements;
+  unknownElements.reserve(unknownIdxs.size());
+  for (const std::size_t idx : unknownIdxs) {
+    unknownElements.push_back(elements[idx]);
+  }
+
+  dispatch(unknownElements,
+           borrowCallback<SuccessCallback>([&](const std::size_t unknownIdx, auto value) {
+             successCallback(unknownIdxs[unknownIdx], std::move(value));
+           }),
+           borrowCallback<hostApi::Manager::BatchElementErrorCallback>(
+               [&](const std::size_t unknownIdx, errors::BatchElementError error) {
+                 errorCallback(unknownIdxs[unknownIdx], std::move(error));
+               }));
+}
+
+/**
+ * Trace of a single batch API call, along with the number of successes
+ * and errors reported via the callbacks it provides.
+ *
+ * The call is logged as structured messages at kDebugApi severity on
+ * construction and destruction, reported as a span to the global
+ * tracer, if set, and recorded to the manager's metrics, if provided.
+ *
+ * If kDebugApi messages would not be logged, there is no global
+ * tracer and no metrics, the trace is disabled and provides the
+ * caller's callbacks unmodified, so the only overhead is the
+ * `isSeverityLogged` query and global tracer check.
+ */
+template <class SuccessCallback>
+class BatchCallTrace {
+ public:
+  BatchCallTrace(const log::LoggerInterfacePtr &logger, hostApi::ManagerMetrics *metrics,
+                 const hostApi::ManagerMetrics::Method method, const hostApi::Manager &manager,
+                 const std::size_t batchSize, const SuccessCallback &successCallback,
+                 const hostApi::Manager::BatchElementErrorCallback &errorCallback)
+      : successCallback_{successCallback},
+        errorCallback_{errorCallback},
+        tracer_{trace::TracerInterface::globalTracer()},
+        metrics_{metrics},
+        method_{method},
+        batchSize_{batchSize} {
+    if (logger->isSeverityLogged(log::LoggerInterface::Severity::kDebugApi)) {
+      logger_ = logger.get();
+    }
+    if (!isEnabled()) {
+      return;
+    }
+    tracedSuccessCallback_.emplace([this](const std::size_t idx, auto value) {
+      ++successCount_;
+      successCallback_(idx, std::move(value));
+    });
+    tracedErrorCallback_.emplace([this](const std::size_t idx, errors::BatchElementError error) {
+      ++errorCounts_[hostApi::ManagerMetrics::errorCodeIndex(error.code)];
+      errorCallback_(idx, std::move(error));
+    });
+    uncaughtExceptionCount_ = std::uncaught_exceptions();
+
+    if (!logger_ && !tracer_) {
+      start_ = std::chrono::steady_clock::now();
+      return;
+    }
+    const Str methodName{hostApi::ManagerMetrics::kMethodNames[static_cast<std::size_t>(method)]};
+    fields_ = {{"method", methodName},
+               {"manager", manager.identifier()},
+               {"batchSize", static_cast<Int>(batchSize)}};
+    if (logger_) {
+      logger_->logStructured(log::LoggerInterface::Severity::kDebugApi, "-> " + methodName,
+                             fields_);
+    }
+    if (tracer_) {
+      spanId_ = tracer_->beginSpan("Manager." + methodName, fields_);
+    }
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  ~BatchCallTrace() {
+    if (!isEnabled()) {
+      return;
+    }
+    using Milliseconds = std::chrono::duration<Float, std::milli>;
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    const bool raisedException = std::uncaught_exceptions() > uncaughtExceptionCount_;
+    std::size_t errorCount = 0;
+    for (const std::uint64_t codeErrorCount : errorCounts_) {
+      errorCount += codeErrorCount;
+    }
+    if (countUnreportedAsSuccesses_ && !raisedException) {
+      successCount_ = batchSize_ - errorCount;
+    }
+    if (metrics_) {
+      metrics_->record(method_, elapsed, successCount_, errorCounts_, raisedException,
+                       batchSize_);
+    }
+    if (!logger_ && !tracer_) {
+      return;
+    }
+    try {
+      InfoDictionary outcomeFields{
+          {"elapsedMs", Milliseconds{elapsed}.count()},
+          {"successCount", static_cast<Int>(successCount_)},
+          {"errorCount", static_cast<Int>(errorCount)},
+          {"outcome", Str{raisedException ? "exception" : "returned"}}};
+      if (tracer_) {
+        tracer_->endSpan(spanId_, outcomeFields);
+      }
+      if (logger_) {
+        fields_.merge(outcomeFields);
+        logger_->logStructured(log::LoggerInterface::Severity::kDebugApi,
+                               "<- " + std::get<Str>(fields_["method"]), fields_);
+      }
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+      // Tracing must not mask the outcome of the call, nor throw
+      // during unwinding.
+    }
+  }
+
+  BatchCallTrace(const BatchCallTrace &) = delete;
+  BatchCallTrace(BatchCallTrace &&) noexcept = delete;
+  BatchCallTrace &operator=(const BatchCallTrace &) = delete;
+  BatchCallTrace &operator=(BatchCallTrace &&) noexcept = delete;
+
+  /// Success callback to dispatch the batch with.
+  [[nodiscard]] const SuccessCallback &successCallback() const {
+    return tracedSuccessCallback_ ? *tracedSuccessCallback_ : successCallback_;
+  }
+
+  /// Error callback to dispatch the batch with.
+  [[nodiscard]] const hostApi::Manager::BatchElementErrorCallback &errorCallback() const {
+    return tracedErrorCallback_ ? *tracedErrorCallback_ : errorCallback_;
+  }
+
+  /**
+   * Count elements that are not reported as errors as successes, for
+   * calls whose results are not reported via the success callback.
+   */
+  void countUnreportedAsSuccesses() { countUnreportedAsSuccesses_ = true; }
+
+ private:
+  [[nodiscard]] bool isEnabled() const { return logger_ || tracer_ || metrics_; }
+
+  const SuccessCallback &successCallback_;
+  const hostApi::Manager::BatchElementErrorCallback &errorCallback_;
+  std::optional<SuccessCallback> tracedSuccessCallback_;
+  std::optional<hostApi::Manager::BatchElementErrorCallback> tracedErrorCallback_;
+  log::LoggerInterface *logger_{nullptr};
+  trace::TracerInterfacePtr tracer_;
+  hostApi::ManagerMetrics *metrics_;
+  hostApi::ManagerMetrics::Method method_;
+  std::size_t batchSize_;
+  trace::TracerInterface::SpanId spanId_{0};
+  InfoDictionary fields_;
+  int uncaughtExceptionCount_{0};
+  std::chrono::steady_clock::time_point start_;
+  std::size_t successCount_{0};
+  hostApi::ManagerMetrics::ErrorCounts errorCounts_{};
+  bool countUnreportedAsSuccesses_{false};
+};
 }  // namespace
 
 namespace hostApi {
 
+struct Manager::InterfaceSnapshot {
+  std::bitset<managerApi::ManagerInterface::kCapabilityNames.size()> capabilities;
+  InfoDictionary info;
+  managerApi::EntityExistenceFilterConstPtr entityExistenceFilter;
+};
+
 ManagerPtr Manager::make(managerApi::ManagerInterfacePtr managerInterface,
                          managerApi::HostSessionPtr hostSession) {
+  return make(std::move(managerInterface), std::move(hostSession), Options{});
+}
+
+ManagerPtr Manager::make(managerApi::ManagerInterfacePtr managerInterface,
+                         managerApi::HostSessionPtr hostSession, Options options) {
   return std::shared_ptr<Manager>(
-      new Manager(std::move(managerInterface), std::move(hostSession)));
+      new Manager(std::move(managerInterface), std::move(hostSession), std::move(options)));
 }
 
 Manager::Manager(managerApi::ManagerInterfacePtr managerInterface,
-                 managerApi::HostSessionPtr hostSession)
-    : managerInterface_{std::move(managerInterface)}, hostSession_{std::move(hostSession)} {}
+                 managerApi::HostSessionPtr hostSession, Options options)
+    : managerInterface_{std::move(managerInterface)},
+      hostSession_{std::move(hostSession)},
+      resolveCache_{std::move(options.resolveCache)},
+      metrics_{std::move(options.metrics)},
+      resolveChunkSize_{options.resolveChunkSize},
+      deduplicateEntityReferences_{options.deduplicateEntityReferences},
+      pagerPrefetchDepth_{options.pagerPrefetchDepth},
+      backgroundChunkSize_{options.backgroundChunkSize},
+      managementPolicyCache_{std::make_shared<ManagementPolicyCache>(false)} {
+  if (metrics_) {
+    statisticsBaseline_ = std::make_unique<ManagerMetrics::Snapshot>(metrics_->snapshot());
+  }
+  if (options.entityReferenceStringCacheCapacity > 0) {
+    entityReferenceStringCache_ =
+        std::make_shared<EntityReferenceStringCache>(options.entityReferenceStringCacheCapacity);
+  }
+  if (options.managerStatePoolCapacity > 0) {
+    managerStatePool_ = std::make_shared<ManagerStatePool>(options.managerStatePoolCapacity);
+  }
+  if (options.persistenceTokenCacheCapacity > 0) {
+    persistenceTokenCache_ =
+        std::make_shared<PersistenceTokenCache>(options.persistenceTokenCacheCapacity);
+  }
+  if (backgroundChunkSize_ > 0) {
+    requestScheduler_ = std::make_shared<RequestScheduler>();
+  }
+  if (options.entityTraitsCacheCapacity > 0) {
+    entityTraitsCache_ = std::make_shared<EntityTraitsCache>(options.entityTraitsCacheCapacity);
+  }
+  if (options.defaultEntityReferenceCacheCapacity > 0) {
+    defaultEntityReferenceCache_ =
+        std::make_shared<DefaultEntityReferenceCache>(options.defaultEntityReferenceCacheCapacity);
+  }
+  if (resolveCache_) {
+    pendingResolves_ = std::make_shared<PendingResolveTable>();
+  }
+  if (resolveCache_ || entityTraitsCache_ || defaultEntityReferenceCache_) {
+    // Any change may alter an entity's trait set, so traits are
+    // invalidated regardless of which traits changed. Similarly, any
+    // change, e.g. creation of an entity, may alter a default.
+    entityChangeSubscriptionId_ = hostSession_->subscribeToEntityChanges(
+        [resolveCache = resolveCache_, entityTraitsCache = entityTraitsCache_,
+         defaultEntityReferenceCache = defaultEntityReferenceCache_](
+            const EntityReferences &entityReferences, const trait::TraitSet &traitSet) {
+          if (resolveCache) {
+            resolveCache->invalidate(entityReferences, traitSet);
+          }
+          if (entityTraitsCache) {
+            entityTraitsCache->invalidate(entityReferences);
+          }
+          if (defaultEntityReferenceCache) {
+            defaultEntityReferenceCache->clear();
+          }
+        });
+  }
+}
 
-Identifier Manager::identifier() const { return managerInterface_->identifier(); }
+Manager::~Manager() {
+  if (entityChangeSubscriptionId_ != 0) {
+    hostSession_->unsubscribeFromEntityChanges(entityChangeSubscriptionId_);
+  }
+}
 
-Str Manager::displayName() const { return managerInterface_->displayName(); }
+Identifier Manager::identifier() const {
+  auditCall(ApiAuditor::Method::kIdentifier);
+  return managerInterface_->identifier();
+}
+
+Str Manager::displayName() const {
+  auditCall(ApiAuditor::Method::kDisplayName);
+  return managerInterface_->displayName();
+}
 
 bool Manager::hasCapability(Capability capability) {
+  auditCall(ApiAuditor::Method::kHasCapability);
+  awaitInitialization();
+  if (const auto snapshot = std::atomic_load(&interfaceSnapshot_)) {
+    return snapshot->capabilities.test(static_cast<std::size_t>(capability));
+  }
   return managerInterface_->hasCapability(
       static_cast<managerApi::ManagerInterface::Capability>(capability));
 }
 
-InfoDictionary Manager::info() { return managerInterface_->info(); }
+InfoDictionary Manager::info() {
+  auditCall(ApiAuditor::Method::kInfo);
+  awaitInitialization();
+  if (const auto snapshot = std::atomic_load(&interfaceSnapshot_)) {
+    return snapshot->info;
+  }
+  return managerInterface_->info();
+}
 
 StrMap Manager::updateTerminology(StrMap terms) {
-  return managerInterface_->updateTerminology(std::move(terms), hostSession_);
+  auditCall(ApiAuditor::Method::kUpdateTerminology);
+  awaitInitialization();
+  {
+    const std::lock_guard lock{terminologyMutex_};
+    if (terminology_ && terminology_->first == terms) {
+      return terminology_->second;
+    }
+  }
+  // Don't hold the lock whilst calling the plugin, which may be slow.
+  StrMap updatedTerms = managerInterface_->updateTerminology(terms, hostSession_);
+  const std::lock_guard lock{terminologyMutex_};
+  terminology_.emplace(std::move(terms), updatedTerms);
+  return updatedTerms;
+}
+
+InfoDictionary Manager::settings() {
+  auditCall(ApiAuditor::Method::kSettings);
+  awaitInitialization();
+  return managerInterface_->settings(hostSession_);
+}
+
+void Manager::initialize(InfoDictionary managerSettings) {
+  auditCall(ApiAuditor::Method::kInitialize);
+  {
+    // Serialise with any asynchronous initialization, without
+    // re-throwing its failure, which this initialization supersedes.
+    const std::lock_guard lock{initializationMutex_};
+    if (initialization_.valid()) {
+      initialization_.wait();
+    }
+  }
+  initializeInterface(std::move(managerSettings));
+
+  // Clear any failed asynchronous initialization, unless another has
+  // since been started.
+  const std::lock_guard lock{initializationMutex_};
+  if (initialization_.valid() &&
+      initialization_.wait_for(std::chrono::seconds{0}) == std::future_status::ready) {
+    initialization_ = {};
+    isInitializing_.store(false, std::memory_order_release);
+  }
+}
+
+std::shared_future<void> Manager::initializeAsync(InfoDictionary managerSettings) {
+  auditCall(ApiAuditor::Method::kInitializeAsync);
+  const std::lock_guard lock{initializationMutex_};
+  // Serialise with any previous asynchronous initialization. Its
+  // failure, if any, is not re-thrown, since this initialization
+  // supersedes it; it remains available via the future returned for
+  // that attempt.
+  if (initialization_.valid()) {
+    initialization_.wait();
+  }
+  std::promise<void> promise;
+  initialization_ = promise.get_future().share();
+  // A dedicated thread, rather than the shared thread pool, since
+  // initialization may block for extended periods. The thread holds a
+  // reference to this Manager, so that destruction need not wait for
+  // it, which could otherwise deadlock with e.g. a Python GIL.
+  std::thread{[self = shared_from_this(), promise = std::move(promise),
+               managerSettings = std::move(managerSettings)]() mutable {
+    try {
+      self->initializeInterface(std::move(managerSettings));
+      promise.set_value();
+    } catch (...) {
+      promise.set_exception(std::current_exception());
+    }
+  }}.detach();
+  isInitializing_.store(true, std::memory_order_release);
+  return initialization_;
+}
+
+void Manager::waitForInitialization() {
+  std::shared_future<void> initialization;
+  {
+    const std::lock_guard lock{initializationMutex_};
+    initialization = initialization_;
+  }
+  if (initialization.valid()) {
+    initialization.get();
+  }
+}
+
+void Manager::awaitInitialization() {
+  if (!isInitializing_.load(std::memory_order_acquire)) {
+    return;
+  }
+  const std::lock_guard lock{initializationMutex_};
+  // Re-throw any failure, leaving the flag set so that every
+  // subsequent call also does, until successfully re-initialized.
+  initialization_.get();
+  isInitializing_.store(false, std::memory_order_release);
 }
 
-InfoDictionary Manager::settings() { return managerInterface_->settings(hostSession_); }
+void Manager::initializeInterface(InfoDictionary managerSettings) {
+  if (resolveCache_) {
+    // Before the settings are moved from.
+    resolveCache_->setManagerIdentity(managerInterface_->identifier(), managerSettings);
+  }
+  managerInterface_->initialize(std::move(managerSettings), hostSession_);
+
+  // Verify the manager has required capabilities. This must only be
+  // done after initialization, to ensure we can support proxy interface
+  // implementations that need initializing to configure the proxied
+  // implementation
+  verifyRequiredCapabilities(managerInterface_);
+
+  const std::shared_ptr<const InterfaceSnapshot> snapshot = snapshotInterface();
+  std::atomic_store(&interfaceSnapshot_, snapshot);
+  const InfoDictionary& info = snapshot->info;
+  entityReferenceMatcher_ = entityReferenceMatcherFromInfo(hostSession_->logger(), info);
+  isThreadSafe_ = isThreadSafeFromInfo(info);
+  isResolveCached_ = isResolveCachedFromInfo(info);
+  if (resolveCache_) {
+    if (const auto iter = info.find(constants::kInfoKey_ResolveCacheToken);
+        iter != info.end()) {
+      if (const auto* token = std::get_if<Str>(&iter->second)) {
+        resolveCache_->setValidityToken(*token);
+      }
+    }
+  }
+  maxBatchSize_ = maxBatchSizeFromInfo(info);
+  // Policy may depend on settings, so start afresh.
+  managementPolicyCache_ =
+      std::make_shared<ManagementPolicyCache>(isManagementPolicyContextSensitiveFromInfo(info));
+  // Previously pooled states may not reflect the new settings.
+  if (managerStatePool_) {
+    managerStatePool_->clear();
+  }
+  if (persistenceTokenCache_) {
+    persistenceTokenCache_->clear();
+  }
+  clearTerminology();
+}
+
+void Manager::flushCaches() {
+  auditCall(ApiAuditor::Method::kFlushCaches);
+  awaitInitialization();
+  if (resolveCache_) {
+    resolveCache_->clear();
+  }
+  if (entityReferenceStringCache_) {
+    entityReferenceStringCache_->clear();
+  }
+  managementPolicyCache_->clear();
+  if (managerStatePool_) {
+    managerStatePool_->clear();
+  }
+  if (persistenceTokenCache_) {
+    persistenceTokenCache_->clear();
+  }
+  if (entityTraitsCache_) {
+    entityTraitsCache_->clear();
+  }
+  if (defaultEntityReferenceCache_) {
+    defaultEntityReferenceCache_->clear();
+  }
+  clearTerminology();
+  managerInterface_->flushCaches(hostSession_);
+  // Only refresh if initialized, since the manager plugin must not be
+  // queried beforehand. This also reloads the existence filter.
+  if (std::atomic_load(&interfaceSnapshot_)) {
+    std::atomic_store(&interfaceSnapshot_, snapshotInterface());
+  }
+}
+
+void Manager::flushCaches(const EntityReferences& entityReferences) {
+  auditCall(ApiAuditor::Method::kFlushCaches);
+  awaitInitialization();
+  if (resolveCache_) {
+    resolveCache_->invalidate(entityReferences);
+  }
+  if (entityTraitsCache_) {
+    entityTraitsCache_->invalidate(entityReferences);
+  }
+  if (defaultEntityReferenceCache_) {
+    defaultEntityReferenceCache_->invalidate(entityReferences);
+  }
+  managerInterface_->flushEntityCaches(entityReferences, hostSession_);
+}
+
+void Manager::flushCachesWithPrefix(const Str& prefix) {
+  auditCall(ApiAuditor::Method::kFlushCachesWithPrefix);
+  awaitInitialization();
+  if (resolveCache_) {
+    resolveCache_->invalidatePrefix(prefix);
+  }
+  if (entityTraitsCache_) {
+    entityTraitsCache_->invalidatePrefix(prefix);
+  }
+  if (defaultEntityReferenceCache_) {
+    defaultEntityReferenceCache_->invalidatePrefix(prefix);
+  }
+  managerInterface_->flushCachesWithPrefix(prefix, hostSession_);
+}
+
+std::optional<ManagerMetrics::Snapshot> Manager::statistics() {
+  if (!metrics_) {
+    return std::nullopt;
+  }
+  // Only the baseline is locked, so recording remains lock-free.
+  const std::lock_guard lock{statisticsMutex_};
+  const ManagerMetrics::Snapshot current = metrics_->snapshot();
+  ManagerMetrics::Snapshot interval = current.since(*statisticsBaseline_);
+  *statisticsBaseline_ = current;
+  return interval;
+}
+
+Manager::MemoryUsage Manager::memoryUsage() const {
+  MemoryUsage usage{};
+  if (resolveCache_) {
+    usage.resolveCache = resolveCache_->memoryUsage();
+  }
+  usage.managementPolicyCache = managementPolicyCache_->memoryUsage();
+  if (entityReferenceStringCache_) {
+    usage.entityReferenceStringCache = entityReferenceStringCache_->memoryUsage();
+  }
+  if (persistenceTokenCache_) {
+    usage.persistenceTokenCache = persistenceTokenCache_->memoryUsage();
+  }
+  if (entityTraitsCache_) {
+    usage.entityTraitsCache = entityTraitsCache_->memoryUsage();
+  }
+  if (defaultEntityReferenceCache_) {
+    usage.defaultEntityReferenceCache = defaultEntityReferenceCache_->memoryUsage();
+  }
+  usage.total = usage.resolveCache + usage.managementPolicyCache +
+                usage.entityReferenceStringCache + usage.persistenceTokenCache +
+                usage.entityTraitsCache + usage.defaultEntityReferenceCache;
+  return usage;
+}
+
+void Manager::clearTerminology() {
+  const std::lock_guard lock{terminologyMutex_};
+  terminology_.reset();
+}
+
+std::shared_ptr<const Manager::InterfaceSnapshot> Manager::snapshotInterface() const {
+  using managerApi::ManagerInterface;
+  auto snapshot = std::make_shared<InterfaceSnapshot>();
+  for (std::size_t idx = 0; idx < snapshot->capabilities.size(); ++idx) {
+    const auto capability = static_cast<ManagerInterface::Capability>(idx);
+    // Required capabilities are known to be present, else
+    // initialization would have failed.
+    const bool isRequired = std::find(kRequiredCapabilities.begin(), kRequiredCapabilities.end(),
+                                      capability) != kRequiredCapabilities.end();
+    snapshot->capabilities.set(idx, isRequired || managerInterface_->hasCapability(capability));
+  }
+  snapshot->info = managerInterface_->info();
+  snapshot->entityExistenceFilter = managerInterface_->entityExistenceFilter(hostSession_);
+  return snapshot;
+}
+
+void Manager::dropEntityExistenceFilter() {
+  std::shared_ptr<const InterfaceSnapshot> snapshot = std::atomic_load(&interfaceSnapshot_);
+  // Retry if the snapshot is concurrently replaced, e.g. by a flush.
+  while (snapshot && snapshot->entityExistenceFilter) {
+    auto unfiltered = std::make_shared<InterfaceSnapshot>(*snapshot);
+    unfiltered->entityExistenceFilter = nullptr;
+    if (std::atomic_compare_exchange_strong(
+            &interfaceSnapshot_, &snapshot,
+            std::shared_ptr<const InterfaceSnapshot>{std::move(unfiltered)})) {
+      return;
+    }
+  }
+}
+
+trait::TraitsDatas Manager::managementPolicy(const trait::TraitSets &traitSets,
+                                             const access::PolicyAccess policyAccess,
+                                             const ContextConstPtr &context) {
+  auditCall(ApiAuditor::Method::kManagementPolicy);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  trait::TraitsDatas policies(traitSets.size());
+  trait::TraitSets uncachedTraitSets;
+  std::vector<std::size_t> uncachedIdxs;
+  for (std::size_t idx = 0; idx < traitSets.size(); ++idx) {
+    policies[idx] = managementPolicyCache_->lookup(traitSets[idx], policyAccess, context);
+    if (!policies[idx]) {
+      uncachedTraitSets.push_back(traitSets[idx]);
+      uncachedIdxs.push_back(idx);
+    }
+  }
+
+  if (uncachedIdxs.empty()) {
+    return policies;
+  }
+
+  // Avoid needlessly passing a copy if nothing was cached.
+  const trait::TraitSets &queriedTraitSets =
+      uncachedIdxs.size() == traitSets.size() ? traitSets : uncachedTraitSets;
+  trait::TraitsDatas queried =
+      managerInterface_->managementPolicy(queriedTraitSets, policyAccess, context, hostSession_);
+
+  if (queried.size() != uncachedIdxs.size()) {
+    throw errors::OpenAssetIOException{
+        fmt::format("Manager '{}' returned {} results from managementPolicy, expected {}",
+                    managerInterface_->identifier(), queried.size(), uncachedIdxs.size())};
+  }
+
+  for (std::size_t queriedIdx = 0; queriedIdx < queried.size(); ++queriedIdx) {
+    trait::TraitsDataPtr &policy = queried[queriedIdx];
+    if (policy) {
+      managementPolicyCache_->insert(queriedTraitSets[queriedIdx], policyAccess, context, policy);
+    }
+    policies[uncachedIdxs[queriedIdx]] = std::move(policy);
+  }
+  return policies;
+}
+
+ContextPtr Manager::createContext() {
+  auditCall(ApiAuditor::Method::kCreateContext);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  ContextPtr context = Context::make();
+  if (hasCapability(Capability::kStatefulContexts)) {
+    context->managerState = createManagerState();
+  }
+  context->locale = trait::TraitsData::make();
+  return context;
+}
+
+managerApi::ManagerStateBasePtr Manager::createManagerState() {
+  if (!managerStatePool_) {
+    return managerInterface_->createState(hostSession_);
+  }
+  // Reuse a released state, if the plugin allows, otherwise make a
+  // new one. Either way, it returns to the pool once released.
+  while (managerApi::ManagerStateBasePtr state = managerStatePool_->acquire()) {
+    if (managerInterface_->resetState(state, hostSession_)) {
+      return managerStatePool_->lease(std::move(state));
+    }
+  }
+  return managerStatePool_->lease(managerInterface_->createState(hostSession_));
+}
+
+ContextPtr Manager::createChildContext(const ContextConstPtr &parentContext) {
+  auditCall(ApiAuditor::Method::kCreateChildContext);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  // Copy-construct the locale so changes made to the child context
+  // don't affect the parent (and vice versa).
+  ContextPtr context = Context::make(trait::TraitsData::make(parentContext->locale));
+  context->cancellationToken = parentContext->cancellationToken;
+  context->priority = parentContext->priority;
+  if (parentContext->managerState) {
+    context->managerState =
+        managerInterface_->createChildState(parentContext->managerState, hostSession_);
+  }
+  return context;
+}
+
+Str Manager::persistenceTokenForContext(const ContextPtr &context) {
+  auditCall(ApiAuditor::Method::kPersistenceTokenForContext);
+  awaitInitialization();
+  if (context->managerState) {
+    if (persistenceTokenCache_) {
+      if (std::optional<Str> token = persistenceTokenCache_->lookupToken(context->managerState)) {
+        return *std::move(token);
+      }
+    }
+    return managerInterface_->persistenceTokenForState(context->managerState, hostSession_);
+  }
+  return "";
+}
+
+ContextPtr Manager::contextFromPersistenceToken(const Str &token) {
+  auditCall(ApiAuditor::Method::kContextFromPersistenceToken);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  ContextPtr context = Context::make();
+  if (!token.empty()) {
+    context->managerState = restoreManagerState(token);
+  }
+  return context;
+}
+
+std::vector<ContextPtr> Manager::contextsFromPersistenceTokens(const std::vector<Str> &tokens) {
+  auditCall(ApiAuditor::Method::kContextsFromPersistenceTokens);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  std::vector<ContextPtr> contexts;
+  contexts.reserve(tokens.size());
+  // Restore each distinct token once, even if uncached.
+  std::unordered_map<std::string_view, managerApi::ManagerStateBasePtr> states;
+  for (const Str &token : tokens) {
+    ContextPtr context = Context::make();
+    if (!token.empty()) {
+      auto [iter, isNew] = states.try_emplace(token);
+      if (isNew) {
+        iter->second = restoreManagerState(token);
+      }
+      context->managerState = iter->second;
+    }
+    contexts.push_back(std::move(context));
+  }
+  return contexts;
+}
+
+managerApi::ManagerStateBasePtr Manager::restoreManagerState(const Str &token) {
+  if (!persistenceTokenCache_) {
+    return managerInterface_->stateFromPersistenceToken(token, hostSession_);
+  }
+  if (managerApi::ManagerStateBasePtr state = persistenceTokenCache_->lookupState(token)) {
+    return state;
+  }
+  managerApi::ManagerStateBasePtr state =
+      managerInterface_->stateFromPersistenceToken(token, hostSession_);
+  if (!state) {
+    return state;
+  }
+  return persistenceTokenCache_->insert(token, std::move(state));
+}
+
+bool Manager::isEntityReferenceString(const Str &someString) {
+  auditCall(ApiAuditor::Method::kIsEntityReferenceString);
+  awaitInitialization();
+  if (entityReferenceMatcher_) {
+    return entityReferenceMatcher_->matches(someString);
+  }
+
+  if (!entityReferenceStringCache_) {
+    return managerInterface_->isEntityReferenceString(someString, hostSession_);
+  }
+
+  if (const std::optional<bool> cached = entityReferenceStringCache_->lookup(someString)) {
+    return *cached;
+  }
+  const bool isEntityReference =
+      managerInterface_->isEntityReferenceString(someString, hostSession_);
+  entityReferenceStringCache_->insert(someString, isEntityReference);
+  return isEntityReference;
+}
+
+std::vector<bool> Manager::areEntityReferenceStrings(const std::vector<Str> &someStrings) {
+  auditCall(ApiAuditor::Method::kAreEntityReferenceStrings);
+  awaitInitialization();
+  if (entityReferenceMatcher_) {
+    std::vector<bool> result;
+    result.reserve(someStrings.size());
+    for (const Str &someString : someStrings) {
+      result.push_back(entityReferenceMatcher_->matches(someString));
+    }
+    return result;
+  }
+
+  const auto queryManager = [&](const std::vector<Str> &strings) {
+    std::vector<bool> result = managerInterface_->areEntityReferenceStrings(strings, hostSession_);
+    if (result.size() != strings.size()) {
+      throw errors::OpenAssetIOException{fmt::format(
+          "Manager '{}' returned {} results from areEntityReferenceStrings, expected {}",
+          managerInterface_->identifier(), result.size(), strings.size())};
+    }
+    return result;
+  };
+
+  if (!entityReferenceStringCache_) {
+    return queryManager(someStrings);
+  }
+
+  // Serve what we can from the cache, batching up the remainder,
+  // retaining a mapping back to the caller's indices.
+  std::vector<bool> result(someStrings.size());
+  std::vector<Str> missedStrings;
+  std::vector<std::size_t> missedIndices;
+  for (std::size_t idx = 0; idx < someStrings.size(); ++idx) {
+    if (const std::optional<bool> cached = entityReferenceStringCache_->lookup(someStrings[idx])) {
+      result[idx] = *cached;
+    } else {
+      missedStrings.push_back(someStrings[idx]);
+      missedIndices.push_back(idx);
+    }
+  }
+
+  if (missedStrings.empty()) {
+    return result;
+  }
+
+  const std::vector<bool> missedResult = queryManager(missedStrings);
+  for (std::size_t missedIdx = 0; missedIdx < missedStrings.size(); ++missedIdx) {
+    result[missedIndices[missedIdx]] = missedResult[missedIdx];
+    entityReferenceStringCache_->insert(missedStrings[missedIdx], missedResult[missedIdx]);
+  }
+  return result;
+}
+
+const Str kCreateEntityReferenceErrorMessage = "Invalid entity reference: ";
+
+EntityReference Manager::createEntityReference(Str entityReferenceString) {
+  auditCall(ApiAuditor::Method::kCreateEntityReference);
+  awaitInitialization();
+  if (!isEntityReferenceString(entityReferenceString)) {
+    throw errors::InputValidationException{kCreateEntityReferenceErrorMessage +
+                                           entityReferenceString};
+  }
+  return EntityReference{std::move(entityReferenceString)};
+}
+
+std::optional<EntityReference> Manager::createEntityReferenceIfValid(Str entityReferenceString) {
+  auditCall(ApiAuditor::Method::kCreateEntityReferenceIfValid);
+  awaitInitialization();
+  if (!isEntityReferenceString(entityReferenceString)) {
+    return {};
+  }
+  return EntityReference{std::move(entityReferenceString)};
+}
+
+void Manager::entityExists(const EntityReferences &entityReferences,
+                           const ContextConstPtr &context,
+                           const ExistsSuccessCallback &successCallback,
+                           const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kEntityExists);
+  awaitInitialization();
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(),
+                       ManagerMetrics::Method::kEntityExists, *this, entityReferences.size(),
+                       successCallback, errorCallback};
+  const auto dispatch = [&](const EntityReferences &unknownEntityReferences,
+                            const ExistsSuccessCallback &unknownSuccessCallback,
+                            const BatchElementErrorCallback &unknownErrorCallback) {
+    dispatchDeduplicated(
+        deduplicateEntityReferences_, unknownEntityReferences, unknownSuccessCallback,
+        unknownErrorCallback,
+        [&](const EntityReferences &uniqueEntityReferences,
+            const ExistsSuccessCallback &uniqueSuccessCallback,
+            const BatchElementErrorCallback &uniqueErrorCallback) {
+          dispatchChunked(
+              chunkSizeFor(context), requestScheduler_.get(), uniqueEntityReferences, context,
+              uniqueSuccessCallback, uniqueErrorCallback,
+              [&](const EntityReferences &chunk, const ExistsSuccessCallback &chunkSuccessCallback,
+                  const BatchElementErrorCallback &chunkErrorCallback) {
+                managerInterface_->entityExists(chunk, context, hostSession_,
+                                                chunkSuccessCallback, chunkErrorCallback);
+              });
+        });
+  };
+
+  const auto snapshot = std::atomic_load(&interfaceSnapshot_);
+  const managerApi::EntityExistenceFilterConstPtr filter =
+      snapshot ? snapshot->entityExistenceFilter : nullptr;
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const ExistsSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        if (!filter) {
+          dispatch(entityReferences, trackedSuccessCallback, trackedErrorCallback);
+          return;
+        }
+        // Definite negatives are answered host-side.
+        dispatchUnknown(
+            entityReferences, trackedSuccessCallback, trackedErrorCallback,
+            [&](const EntityReference &entityReference) -> std::optional<bool> {
+              if (filter->mayContain(entityReference.toString())) {
+                return std::nullopt;
+              }
+              return false;
+            },
+            dispatch);
+      });
+}
+
+void Manager::entityExists(const EntityReferenceBatch &entityReferences,
+                           const ContextConstPtr &context,
+                           const ExistsSuccessCallback &successCallback,
+                           const BatchElementErrorCallback &errorCallback) {
+  awaitInitialization();
+  entityExists(entityReferences.toEntityReferences(), context, successCallback, errorCallback);
+}
+
+void Manager::entityExists(const EntityReferenceSpan entityReferences,
+                           const ContextConstPtr &context,
+                           const ExistsSuccessCallback &successCallback,
+                           const BatchElementErrorCallback &errorCallback) {
+  entityExists(entityReferences.toEntityReferences(), context, successCallback, errorCallback);
+}
+
+Manager::ExistsSummary Manager::entityExists(
+    const EntityReferences &entityReferences, const ContextConstPtr &context,
+    [[maybe_unused]] const BatchElementErrorPolicyTag::ErrorSummary &errorPolicyTag) {
+  ExistsSummary summary;
+  summary.exists.resize(entityReferences.size(), false);
+
+  entityExists(
+      entityReferences, context,
+      [&summary](const std::size_t index, const bool exists) { summary.exists[index] = exists; },
+      [&summary](const std::size_t index, errors::BatchElementError error) {
+        summary.errors.emplace_back(index, std::move(error));
+      });
+
+  // Errors may be reported out of order, e.g. by deduplication.
+  std::stable_sort(summary.errors.begin(), summary.errors.end(),
+                   [](const IndexedBatchElementError &lhs, const IndexedBatchElementError &rhs) {
+                     return lhs.first < rhs.first;
+                   });
+  return summary;
+}
+
+void Manager::entityTraits(const EntityReferences &entityReferences,
+                           const access::EntityTraitsAccess entityTraitsAccess,
+                           const ContextConstPtr &context,
+                           const EntityTraitsSuccessCallback &successCallback,
+                           const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kEntityTraits);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(),
+                       ManagerMetrics::Method::kEntityTraits, *this, entityReferences.size(),
+                       successCallback, errorCallback};
+  const auto dispatch = [&](const EntityReferences &uncachedEntityReferences,
+                            const EntityTraitsSuccessCallback &uncachedSuccessCallback,
+                            const BatchElementErrorCallback &uncachedErrorCallback) {
+    dispatchDeduplicated(
+        deduplicateEntityReferences_, uncachedEntityReferences, uncachedSuccessCallback,
+        uncachedErrorCallback,
+        [&](const EntityReferences &uniqueEntityReferences,
+            const EntityTraitsSuccessCallback &uniqueSuccessCallback,
+            const BatchElementErrorCallback &uniqueErrorCallback) {
+          dispatchChunked(chunkSizeFor(context), requestScheduler_.get(),
+                          uniqueEntityReferences, context, uniqueSuccessCallback,
+                          uniqueErrorCallback,
+                          [&](const EntityReferences &chunk,
+                              const EntityTraitsSuccessCallback &chunkSuccessCallback,
+                              const BatchElementErrorCallback &chunkErrorCallback) {
+                            managerInterface_->entityTraits(chunk, entityTraitsAccess, context,
+                                                            hostSession_, chunkSuccessCallback,
+                                                            chunkErrorCallback);
+                          });
+        });
+  };
+
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const EntityTraitsSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        if (!entityTraitsCache_) {
+          dispatch(entityReferences, trackedSuccessCallback, trackedErrorCallback);
+          return;
+        }
+        dispatchUnknown(
+            entityReferences, trackedSuccessCallback, trackedErrorCallback,
+            [&](const EntityReference &entityReference) {
+              return entityTraitsCache_->lookup(entityReference, entityTraitsAccess, context);
+            },
+            [&](const EntityReferences &uncachedEntityReferences,
+                const EntityTraitsSuccessCallback &uncachedSuccessCallback,
+                const BatchElementErrorCallback &uncachedErrorCallback) {
+              dispatch(uncachedEntityReferences,
+                       borrowCallback<EntityTraitsSuccessCallback>(
+                           [&](const std::size_t uncachedIdx, trait::TraitSet traitSet) {
+                             entityTraitsCache_->insert(uncachedEntityReferences[uncachedIdx],
+                                                        entityTraitsAccess, context, traitSet);
+                             uncachedSuccessCallback(uncachedIdx, std::move(traitSet));
+                           }),
+                       uncachedErrorCallback);
+            });
+      });
+}
+
+void Manager::resolve(const EntityReferences &entityReferences, const trait::TraitSet &traitSet,
+                      const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
+                      const ResolveSuccessCallback &successCallback,
+                      const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kResolve);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  // Traced here, rather than in forwardResolve, so that cache hits are
+  // included.
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kResolve,
+                       *this, entityReferences.size(), successCallback, errorCallback};
+  const ResolveSuccessCallback &tracedSuccessCallback = trace.successCallback();
+  const BatchElementErrorCallback &tracedErrorCallback = trace.errorCallback();
+
+  if (!resolveCache_ || isResolveCached_) {
+    forwardResolve(entityReferences, traitSet, resolveAccess, context, tracedSuccessCallback,
+                   tracedErrorCallback);
+    return;
+  }
+  resolveCached(entityReferences, traitSet, resolveAccess, context, tracedSuccessCallback,
+                tracedErrorCallback);
+}
+
+void Manager::resolve(const EntityReferenceSpan entityReferences, const trait::TraitSet &traitSet,
+                      const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
+                      const ResolveSuccessCallback &successCallback,
+                      const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kResolve);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kResolve,
+                       *this, entityReferences.size(), successCallback, errorCallback};
+
+  if (!resolveCache_ || isResolveCached_) {
+    forwardResolve(entityReferences.toEntityReferences(), traitSet, resolveAccess, context,
+                   trace.successCallback(), trace.errorCallback());
+    return;
+  }
+  resolveCached(entityReferences, traitSet, resolveAccess, context, trace.successCallback(),
+                trace.errorCallback());
+}
+
+void Manager::resolveCached(const EntityReferenceSpan entityReferences,
+                            const trait::TraitSet &traitSet,
+                            const access::ResolveAccess resolveAccess,
+                            const ContextConstPtr &context,
+                            const ResolveSuccessCallback &successCallback,
+                            const BatchElementErrorCallback &errorCallback) {
+  // Callers' callbacks may themselves resolve, in which case waiting
+  // on another call's fetch could wait on this one, so don't.
+  const bool mayWait = tlsResolveCallbackDepth == 0;
+
+  // Serve what we can from the cache, claiming the remainder, or
+  // waiting on those that are already in flight, retaining a mapping
+  // back to the caller's indices.
+  EntityReferences missedRefs;
+  std::vector<std::size_t> missedIndices;
+  std::vector<PendingResolveTable::EntryPtr> ownedEntries;
+  std::vector<std::pair<std::size_t, PendingResolveTable::EntryPtr>> awaitedEntries;
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (trait::TraitsDataPtr cached =
+            resolveCache_->lookup(entityReferences[idx], traitSet, resolveAccess, context)) {
+      const CallbackScope callbackScope;
+      successCallback(idx, std::move(cached));
+      continue;
+    }
+    PendingResolveTable::Claim claim = pendingResolves_->claim(
+        ResolveCacheKey{entityReferences[idx], traitSet, resolveAccess, context});
+    if (!claim.isOwner && mayWait) {
+      awaitedEntries.emplace_back(idx, std::move(claim.entry));
+      continue;
+    }
+    missedRefs.push_back(entityReferences[idx]);
+    missedIndices.push_back(idx);
+    ownedEntries.push_back(claim.isOwner ? std::move(claim.entry) : nullptr);
+  }
+
+  // Complete owned entries, including any abandoned due to an
+  // exception or cancellation, so that waiters fall back to resolving
+  // for themselves.
+  const auto completeOwned = [&](const std::size_t missedIdx,
+                                 PendingResolveTable::Outcome outcome) {
+    if (const PendingResolveTable::EntryPtr &entry = ownedEntries[missedIdx]) {
+      pendingResolves_->complete(entry, std::move(outcome));
+    }
+  };
+  try {
+    if (!missedRefs.empty()) {
+      forwardResolve(
+          missedRefs, traitSet, resolveAccess, context,
+          borrowCallback<ResolveSuccessCallback>(
+              [&](const std::size_t missedIdx, trait::TraitsDataPtr data) {
+                resolveCache_->insert(missedRefs[missedIdx], traitSet, resolveAccess, context,
+                                      data);
+                completeOwned(missedIdx, trait::TraitsData::make(data));
+                const CallbackScope callbackScope;
+                successCallback(missedIndices[missedIdx], std::move(data));
+              }),
+          borrowCallback<BatchElementErrorCallback>(
+              [&](const std::size_t missedIdx, errors::BatchElementError error) {
+                completeOwned(missedIdx, error);
+                const CallbackScope callbackScope;
+                errorCallback(missedIndices[missedIdx], std::move(error));
+              }));
+    }
+  } catch (...) {
+    for (std::size_t missedIdx = 0; missedIdx < ownedEntries.size(); ++missedIdx) {
+      completeOwned(missedIdx, std::nullopt);
+    }
+    throw;
+  }
+  for (std::size_t missedIdx = 0; missedIdx < ownedEntries.size(); ++missedIdx) {
+    completeOwned(missedIdx, std::nullopt);
+  }
 
-void Manager::initialize(InfoDictionary managerSettings) {
-  managerInterface_->initialize(std::move(managerSettings), hostSession_);
+  // Report the results of other calls' fetches, resolving any they
+  // abandoned.
+  EntityReferences abandonedRefs;
+  std::vector<std::size_t> abandonedIndices;
+  for (auto &[idx, entry] : awaitedEntries) {
+    PendingResolveTable::Outcome outcome = entry->wait();
+    if (!outcome) {
+      abandonedRefs.push_back(entityReferences[idx]);
+      abandonedIndices.push_back(idx);
+      continue;
+    }
+    const CallbackScope callbackScope;
+    if (auto *data = std::get_if<trait::TraitsDataPtr>(&*outcome)) {
+      // Each caller is given its own copy, as for cache hits.
+      successCallback(idx, trait::TraitsData::make(*data));
+    } else {
+      errorCallback(idx, std::get<errors::BatchElementError>(*std::move(outcome)));
+    }
+  }
 
-  // Verify the manager has required capabilities. This must only be
-  // done after initialization, to ensure we can support proxy interface
-  // implementations that need initializing to configure the proxied
-  // implementation
-  verifyRequiredCapabilities(managerInterface_);
+  if (abandonedRefs.empty()) {
+    return;
+  }
 
-  entityReferencePrefix_ =
-      entityReferencePrefixFromInfo(hostSession_->logger(), managerInterface_->info());
+  forwardResolve(
+      abandonedRefs, traitSet, resolveAccess, context,
+      borrowCallback<ResolveSuccessCallback>(
+          [&](const std::size_t abandonedIdx, trait::TraitsDataPtr data) {
+            resolveCache_->insert(abandonedRefs[abandonedIdx], traitSet, resolveAccess, context,
+                                  data);
+            const CallbackScope callbackScope;
+            successCallback(abandonedIndices[abandonedIdx], std::move(data));
+          }),
+      borrowCallback<BatchElementErrorCallback>(
+          [&](const std::size_t abandonedIdx, errors::BatchElementError error) {
+            const CallbackScope callbackScope;
+            errorCallback(abandonedIndices[abandonedIdx], std::move(error));
+          }));
 }
 
-void Manager::flushCaches() { managerInterface_->flushCaches(hostSession_); }
+std::future<void> Manager::prefetch(const EntityReferences &entityReferences,
+                                    const trait::TraitSet &traitSet,
+                                    const ContextConstPtr &context) {
+  auditCall(ApiAuditor::Method::kPrefetch);
+  awaitInitialization();
+  auto promise = std::make_shared<std::promise<void>>();
+  std::future<void> future = promise->get_future();
+  if (entityReferences.empty() || (!resolveCache_ && !isResolveCached_)) {
+    promise->set_value();
+    return future;
+  }
 
-trait::TraitsDatas Manager::managementPolicy(const trait::TraitSets &traitSets,
-                                             const access::PolicyAccess policyAccess,
-                                             const ContextConstPtr &context) {
-  return managerInterface_->managementPolicy(traitSets, policyAccess, context, hostSession_);
+  hostSession_->host()->submit([manager = shared_from_this(), entityReferences, traitSet,
+                                context = context ? context->freeze() : context, promise] {
+    try {
+      manager->resolve(
+          entityReferences, traitSet, access::ResolveAccess::kRead, context,
+          [](std::size_t, const trait::TraitsDataPtr &) {},
+          [](std::size_t, const errors::BatchElementError &) {});
+      promise->set_value();
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  });
+  return future;
 }
 
-ContextPtr Manager::createContext() {
-  ContextPtr context = Context::make();
-  if (hasCapability(Capability::kStatefulContexts)) {
-    context->managerState = managerInterface_->createState(hostSession_);
+void Manager::resolveHeterogeneous(const EntityReferences &entityReferences,
+                                   const trait::TraitSets &traitSets,
+                                   const std::vector<std::size_t> &traitSetIndices,
+                                   const access::ResolveAccess resolveAccess,
+                                   const ContextConstPtr &context,
+                                   const ResolveSuccessCallback &successCallback,
+                                   const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kResolveHeterogeneous);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  verifyBatchLengths(entityReferences.size(), traitSetIndices.size(), "trait set indices");
+  for (const std::size_t traitSetIdx : traitSetIndices) {
+    if (traitSetIdx >= traitSets.size()) {
+      throw errors::InputValidationException{fmt::format(
+          "Trait set index {} is out of range for {} trait sets.", traitSetIdx, traitSets.size())};
+    }
   }
-  context->locale = trait::TraitsData::make();
-  return context;
-}
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kResolve,
+                       *this, entityReferences.size(), successCallback, errorCallback};
+  const ResolveSuccessCallback &tracedSuccessCallback = trace.successCallback();
+  const BatchElementErrorCallback &tracedErrorCallback = trace.errorCallback();
+
+  // Not deduplicated, since duplicates may be given different trait
+  // sets.
+  const auto forward = [&](const EntityReferences &refs, const std::vector<std::size_t> &indices,
+                           const ResolveSuccessCallback &forwardSuccessCallback,
+                           const BatchElementErrorCallback &forwardErrorCallback) {
+    dispatchCancellable(
+        context, refs.size(), forwardSuccessCallback, forwardErrorCallback,
+        [&](const ResolveSuccessCallback &trackedSuccessCallback,
+            const BatchElementErrorCallback &trackedErrorCallback) {
+          // Chunks are dispatched consecutively, so track the offset
+          // of each in order to pass the corresponding indices.
+          std::size_t offset = 0;
+          dispatchChunked(
+              chunkSizeFor(context), requestScheduler_.get(), refs, context,
+              trackedSuccessCallback, trackedErrorCallback,
+              [&](const EntityReferences &chunk,
+                  const ResolveSuccessCallback &chunkSuccessCallback,
+                  const BatchElementErrorCallback &chunkErrorCallback) {
+                const auto first = indices.begin() + static_cast<std::ptrdiff_t>(offset);
+                const std::vector<std::size_t> chunkIndices(
+                    first, first + static_cast<std::ptrdiff_t>(chunk.size()));
+                offset += chunk.size();
+                managerInterface_->resolveHeterogeneous(chunk, traitSets, chunkIndices,
+                                                        resolveAccess, context, hostSession_,
+                                                        chunkSuccessCallback, chunkErrorCallback);
+              });
+        });
+  };
 
-ContextPtr Manager::createChildContext(const ContextPtr &parentContext) {
-  // Copy-construct the locale so changes made to the child context
-  // don't affect the parent (and vice versa).
-  ContextPtr context = Context::make(trait::TraitsData::make(parentContext->locale));
-  if (parentContext->managerState) {
-    context->managerState =
-        managerInterface_->createChildState(parentContext->managerState, hostSession_);
+  if (!resolveCache_ || isResolveCached_) {
+    forward(entityReferences, traitSetIndices, tracedSuccessCallback, tracedErrorCallback);
+    return;
   }
-  return context;
-}
 
-Str Manager::persistenceTokenForContext(const ContextPtr &context) {
-  if (context->managerState) {
-    return managerInterface_->persistenceTokenForState(context->managerState, hostSession_);
+  // As for resolve, serve what we can from the cache, retaining a
+  // mapping back to the caller's indices.
+  EntityReferences missedRefs;
+  std::vector<std::size_t> missedTraitSetIndices;
+  std::vector<std::size_t> missedIndices;
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (trait::TraitsDataPtr cached = resolveCache_->lookup(
+            entityReferences[idx], traitSets[traitSetIndices[idx]], resolveAccess, context)) {
+      tracedSuccessCallback(idx, std::move(cached));
+    } else {
+      missedRefs.push_back(entityReferences[idx]);
+      missedTraitSetIndices.push_back(traitSetIndices[idx]);
+      missedIndices.push_back(idx);
+    }
   }
-  return "";
-}
 
-ContextPtr Manager::contextFromPersistenceToken(const Str &token) {
-  ContextPtr context = Context::make();
-  if (!token.empty()) {
-    context->managerState = managerInterface_->stateFromPersistenceToken(token, hostSession_);
+  if (missedRefs.empty()) {
+    return;
   }
-  return context;
-}
 
-bool Manager::isEntityReferenceString(const Str &someString) {
-  if (!entityReferencePrefix_) {
-    return managerInterface_->isEntityReferenceString(someString, hostSession_);
-  }
+  forward(
+      missedRefs, missedTraitSetIndices,
+      borrowCallback<ResolveSuccessCallback>(
+          [&](const std::size_t missedIdx, trait::TraitsDataPtr data) {
+            resolveCache_->insert(missedRefs[missedIdx],
+                                  traitSets[missedTraitSetIndices[missedIdx]], resolveAccess,
+                                  context, data);
+            tracedSuccessCallback(missedIndices[missedIdx], std::move(data));
+          }),
+      borrowCallback<BatchElementErrorCallback>(
+          [&](const std::size_t missedIdx, errors::BatchElementError error) {
+            tracedErrorCallback(missedIndices[missedIdx], std::move(error));
+          }));
+}
 
-  return someString.rfind(*entityReferencePrefix_, 0) != Str::npos;
+void Manager::resolveProjected(const EntityReferences &entityReferences,
+                               const trait::TraitSet &traitSet,
+                               const trait::PropertyProjection &propertyProjection,
+                               const access::ResolveAccess resolveAccess,
+                               const ContextConstPtr &context,
+                               const ResolveSuccessCallback &successCallback,
+                               const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kResolveProjected);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kResolve,
+                       *this, entityReferences.size(), successCallback, errorCallback};
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const ResolveSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        dispatchDeduplicated(
+            deduplicateEntityReferences_, entityReferences, trackedSuccessCallback,
+            trackedErrorCallback,
+            [&](const EntityReferences &uniqueEntityReferences,
+                const ResolveSuccessCallback &uniqueSuccessCallback,
+                const BatchElementErrorCallback &uniqueErrorCallback) {
+              dispatchChunked(chunkSizeFor(context), requestScheduler_.get(),
+                              uniqueEntityReferences, context, uniqueSuccessCallback,
+                              uniqueErrorCallback,
+                              [&](const EntityReferences &chunk,
+                                  const ResolveSuccessCallback &chunkSuccessCallback,
+                                  const BatchElementErrorCallback &chunkErrorCallback) {
+                                managerInterface_->resolveProjected(
+                                    chunk, traitSet, propertyProjection, resolveAccess,
+                                    context, hostSession_, chunkSuccessCallback,
+                                    chunkErrorCallback);
+                              });
+            });
+      });
 }
 
-const Str kCreateEntityReferenceErrorMessage = "Invalid entity reference: ";
+void Manager::resolveColumnar(const EntityReferences &entityReferences,
+                              const trait::TraitSet &traitSet,
+                              const access::ResolveAccess resolveAccess,
+                              const ContextConstPtr &context, trait::TraitsDataTable &results,
+                              const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kResolveColumnar);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  // Results are written to the table, rather than reported via a
+  // success callback, so successes are inferred from the errors.
+  const ResolveSuccessCallback unusedSuccessCallback;
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kResolve,
+                       *this, entityReferences.size(), unusedSuccessCallback, errorCallback};
+  trace.countUnreportedAsSuccesses();
+  const BatchElementErrorCallback &tracedErrorCallback = trace.errorCallback();
+  results.reset(entityReferences.size());
+  results.addTraits(traitSet);
+
+  const auto reportCancelledFrom = [&](const std::size_t begin) {
+    for (std::size_t idx = begin; idx < entityReferences.size(); ++idx) {
+      tracedErrorCallback(
+          idx, errors::BatchElementError{errors::BatchElementError::ErrorCode::kCancelled,
+                                         "Operation was cancelled"});
+    }
+  };
 
-EntityReference Manager::createEntityReference(Str entityReferenceString) {
-  if (!isEntityReferenceString(entityReferenceString)) {
-    throw errors::InputValidationException{kCreateEntityReferenceErrorMessage +
-                                           entityReferenceString};
+  const std::size_t maxChunkSize = chunkSizeFor(context);
+  if (maxChunkSize == 0 || entityReferences.size() <= maxChunkSize) {
+    const auto admission = admit(requestScheduler_.get(), context);
+    if (isCancelled(context)) {
+      reportCancelledFrom(0);
+      return;
+    }
+    managerInterface_->resolveColumnar(entityReferences, traitSet, resolveAccess, context,
+                                       hostSession_, results, tracedErrorCallback);
+    return;
   }
-  return EntityReference{std::move(entityReferenceString)};
-}
 
-std::optional<EntityReference> Manager::createEntityReferenceIfValid(Str entityReferenceString) {
-  if (!isEntityReferenceString(entityReferenceString)) {
-    return {};
+  // Each chunk is resolved into a scratch table, then copied into
+  // place, so that the manager need not know the chunk's offset.
+  trait::TraitsDataTable chunkResults{traitSet};
+  for (std::size_t begin = 0; begin < entityReferences.size(); begin += maxChunkSize) {
+    const auto admission = admit(requestScheduler_.get(), context);
+    if (isCancelled(context)) {
+      reportCancelledFrom(begin);
+      return;
+    }
+    const std::size_t end = std::min(begin + maxChunkSize, entityReferences.size());
+    const EntityReferences chunk(entityReferences.begin() + static_cast<std::ptrdiff_t>(begin),
+                                 entityReferences.begin() + static_cast<std::ptrdiff_t>(end));
+    chunkResults.reset(chunk.size());
+    managerInterface_->resolveColumnar(
+        chunk, traitSet, resolveAccess, context, hostSession_, chunkResults,
+        [&](const std::size_t chunkElementIdx, errors::BatchElementError error) {
+          tracedErrorCallback(begin + chunkElementIdx, std::move(error));
+        });
+    for (const std::size_t idx : results.setRows(begin, chunkResults)) {
+      tracedErrorCallback(idx, errors::BatchElementError{
+                                   errors::BatchElementError::ErrorCode::kUnknown,
+                                   "Property type does not match that of its results column"});
+    }
   }
-  return EntityReference{std::move(entityReferenceString)};
-}
-
-void Manager::entityExists(const EntityReferences &entityReferences,
-                           const ContextConstPtr &context,
-                           const ExistsSuccessCallback &successCallback,
-                           const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->entityExists(entityReferences, context, hostSession_, successCallback,
-                                  errorCallback);
 }
 
-void Manager::entityTraits(const EntityReferences &entityReferences,
-                           const access::EntityTraitsAccess entityTraitsAccess,
-                           const ContextConstPtr &context,
-                           const EntityTraitsSuccessCallback &successCallback,
-                           const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->entityTraits(entityReferences, entityTraitsAccess, context, hostSession_,
-                                  successCallback, errorCallback);
+void Manager::resolveIfChanged(const EntityReferences &entityReferences,
+                               const trait::TraitSet &traitSet,
+                               const access::ResolveAccess resolveAccess,
+                               const std::vector<Str> &generationTokens,
+                               const ContextConstPtr &context,
+                               const ConditionalResolveSuccessCallback &successCallback,
+                               const BatchElementErrorCallback &errorCallback) {
+  auditCall(ApiAuditor::Method::kResolveIfChanged);
+  const ScopedMemoryResource memoryScope{hostSession_->memoryResource().get()};
+  awaitInitialization();
+  verifyBatchLengths(entityReferences.size(), generationTokens.size(), "generation tokens");
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kResolve,
+                       *this, entityReferences.size(), successCallback, errorCallback};
+  // Not deduplicated, since duplicates may be given different tokens.
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const ConditionalResolveSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        // Chunks are dispatched consecutively, so track the offset of
+        // each in order to pass the corresponding tokens.
+        std::size_t offset = 0;
+        dispatchChunked(
+            chunkSizeFor(context), requestScheduler_.get(), entityReferences, context,
+            trackedSuccessCallback, trackedErrorCallback,
+            [&](const EntityReferences &chunk,
+                const ConditionalResolveSuccessCallback &chunkSuccessCallback,
+                const BatchElementErrorCallback &chunkErrorCallback) {
+              const auto first = generationTokens.begin() + static_cast<std::ptrdiff_t>(offset);
+              const std::vector<Str> chunkTokens(
+                  first, first + static_cast<std::ptrdiff_t>(chunk.size()));
+              offset += chunk.size();
+              managerInterface_->resolveIfChanged(chunk, traitSet, resolveAccess, chunkTokens,
+                                                  context, hostSession_, chunkSuccessCallback,
+                                                  chunkErrorCallback);
+            });
+      });
 }
 
-void Manager::resolve(const EntityReferences &entityReferences, const trait::TraitSet &traitSet,
-                      const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
+void Manager::resolve(const EntityReferenceBatch &entityReferences,
+                      const trait::TraitSet &traitSet, const access::ResolveAccess resolveAccess,
+                      const ContextConstPtr &context,
                       const ResolveSuccessCallback &successCallback,
                       const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->resolve(entityReferences, traitSet, resolveAccess, context, hostSession_,
-                             successCallback, errorCallback);
+  awaitInitialization();
+  resolve(entityReferences.toEntityReferences(), traitSet, resolveAccess, context,
+          successCallback, errorCallback);
+}
+
+void Manager::forwardResolve(const EntityReferences &entityReferences,
+                             const trait::TraitSet &traitSet,
+                             const access::ResolveAccess resolveAccess,
+                             const ContextConstPtr &context,
+                             const ResolveSuccessCallback &successCallback,
+                             const BatchElementErrorCallback &errorCallback) {
+  dispatchCancellable(
+      context, entityReferences.size(), successCallback, errorCallback,
+      [&](const ResolveSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        dispatchDeduplicated(
+            deduplicateEntityReferences_, entityReferences, trackedSuccessCallback,
+            trackedErrorCallback,
+            [&](const EntityReferences &uniqueEntityReferences,
+                const ResolveSuccessCallback &uniqueSuccessCallback,
+                const BatchElementErrorCallback &uniqueErrorCallback) {
+              dispatchResolve(uniqueEntityReferences, traitSet, resolveAccess, context,
+                              uniqueSuccessCallback, uniqueErrorCallback);
+            });
+      });
+}
+
+std::size_t Manager::chunkSizeFor(const ContextConstPtr &context) const {
+  if (backgroundChunkSize_ == 0 || !context ||
+      context->priority != Context::Priority::kBackground) {
+    return maxBatchSize_;
+  }
+  return maxBatchSize_ == 0 ? backgroundChunkSize_ : std::min(backgroundChunkSize_, maxBatchSize_);
+}
+
+void Manager::dispatchResolve(const EntityReferences &entityReferences,
+                              const trait::TraitSet &traitSet,
+                              const access::ResolveAccess resolveAccess,
+                              const ContextConstPtr &context,
+                              const ResolveSuccessCallback &successCallback,
+                              const BatchElementErrorCallback &errorCallback) {
+  if (!isThreadSafe_ || resolveChunkSize_ == 0 || entityReferences.size() <= resolveChunkSize_) {
+    dispatchChunked(chunkSizeFor(context), requestScheduler_.get(), entityReferences, context,
+                    successCallback, errorCallback,
+                    [&](const EntityReferences &chunk,
+                        const ResolveSuccessCallback &chunkSuccessCallback,
+                        const BatchElementErrorCallback &chunkErrorCallback) {
+                      managerInterface_->resolve(chunk, traitSet, resolveAccess, context,
+                                                 hostSession_, chunkSuccessCallback,
+                                                 chunkErrorCallback);
+                    });
+    return;
+  }
+
+  // Parallel chunks must also respect the plugin's maximum batch size,
+  // and the background chunk size, if scheduled.
+  const std::size_t maxChunkSize = chunkSizeFor(context);
+  const std::size_t chunkSize =
+      maxChunkSize == 0 ? resolveChunkSize_ : std::min(resolveChunkSize_, maxChunkSize);
+
+  // Callers' callbacks are not expected to be thread-safe, so
+  // serialise them.
+  std::mutex callbackMutex;
+  const std::size_t chunkCount = (entityReferences.size() + chunkSize - 1) / chunkSize;
+
+  // Run on the host's scheduler, so as to cooperate with its own
+  // threading.
+  hostSession_->host()->parallelFor(chunkCount, [&](const std::size_t chunkIdx) {
+    const auto admission = admit(requestScheduler_.get(), context);
+    // Don't start further chunks once cancelled.
+    if (isCancelled(context)) {
+      return;
+    }
+    const std::size_t begin = chunkIdx * chunkSize;
+    const std::size_t end = std::min(begin + chunkSize, entityReferences.size());
+    const EntityReferences chunk(entityReferences.begin() + static_cast<std::ptrdiff_t>(begin),
+                                 entityReferences.begin() + static_cast<std::ptrdiff_t>(end));
+
+    managerInterface_->resolve(
+        chunk, traitSet, resolveAccess, context, hostSession_,
+        borrowCallback<ResolveSuccessCallback>(
+            [&](const std::size_t chunkElementIdx, trait::TraitsDataPtr data) {
+              const std::lock_guard lock{callbackMutex};
+              successCallback(begin + chunkElementIdx, std::move(data));
+            }),
+        borrowCallback<BatchElementErrorCallback>(
+            [&](const std::size_t chunkElementIdx, errors::BatchElementError error) {
+              const std::lock_guard lock{callbackMutex};
+              errorCallback(begin + chunkElementIdx, std::move(error));
+            }));
+  });
 }
 
 // Singular Except
@@ -230,15 +2033,16 @@ trait::TraitsDataPtr hostApi::Manager::resolve(
     const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
     [[maybe_unused]] const BatchElementErrorPolicyTag::Exception &errorPolicyTag) {
   trait::TraitsDataPtr resolveResult;
+  // Viewed as a batch of one, so that cache hits don't allocate.
   resolve(
-      {entityReference}, traitSet, resolveAccess, context,
+      EntityReferenceSpan{&entityReference, 1}, traitSet, resolveAccess, context,
       [&resolveResult]([[maybe_unused]] std::size_t index, trait::TraitsDataPtr data) {
         resolveResult = std::move(data);
       },
       [&entityReference, resolveAccess](std::size_t index, errors::BatchElementError error) {
-        auto msg = errors::createBatchElementExceptionMessage(
-            error, index, entityReference, static_cast<internal::access::Access>(resolveAccess));
-        throw errors::BatchElementException(index, std::move(error), msg);
+        throw errors::createBatchElementException(
+            std::move(error), index, entityReference,
+            static_cast<internal::access::Access>(resolveAccess));
       });
 
   return resolveResult;
@@ -251,7 +2055,7 @@ std::variant<errors::BatchElementError, trait::TraitsDataPtr> hostApi::Manager::
     [[maybe_unused]] const BatchElementErrorPolicyTag::Variant &errorPolicyTag) {
   std::variant<errors::BatchElementError, trait::TraitsDataPtr> resolveResult;
   resolve(
-      {entityReference}, traitSet, resolveAccess, context,
+      EntityReferenceSpan{&entityReference, 1}, traitSet, resolveAccess, context,
       [&resolveResult]([[maybe_unused]] std::size_t index, trait::TraitsDataPtr data) {
         resolveResult = std::move(data);
       },
@@ -270,19 +2074,43 @@ std::vector<trait::TraitsDataPtr> hostApi::Manager::resolve(
   std::vector<trait::TraitsDataPtr> resolveResult;
   resolveResult.resize(entityReferences.size());
 
-  resolve(
-      entityReferences, traitSet, resolveAccess, context,
-      [&resolveResult](std::size_t index, trait::TraitsDataPtr data) {
-        resolveResult[index] = std::move(data);
-      },
-      [&entityReferences, resolveAccess](std::size_t index, errors::BatchElementError error) {
-        // Implemented as if FAILFAST is true.
-        auto msg = errors::createBatchElementExceptionMessage(
-            error, index, entityReferences[index],
-            static_cast<internal::access::Access>(resolveAccess));
-        throw errors::BatchElementException(index, std::move(error), msg);
-      });
+  // Implemented as if FAILFAST is true, but with the caller's Context,
+  // so the manager isn't asked to stop early.
+  if (auto firstError = dispatchFailFast(
+          context, /*shouldStopManager=*/false, resolveResult,
+          [&](const ContextConstPtr &dispatchContext,
+              const ResolveSuccessCallback &successCallback,
+              const BatchElementErrorCallback &errorCallback) {
+            resolve(entityReferences, traitSet, resolveAccess, dispatchContext, successCallback,
+                    errorCallback);
+          })) {
+    auto &[index, error] = *firstError;
+    throw errors::createBatchElementException(
+        std::move(error), index, entityReferences[index],
+        static_cast<internal::access::Access>(resolveAccess));
+  }
+  return resolveResult;
+}
+
+// Multi expected
+std::variant<Manager::IndexedBatchElementError, std::vector<trait::TraitsDataPtr>>
+hostApi::Manager::resolve(
+    const EntityReferences &entityReferences, const trait::TraitSet &traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
+    [[maybe_unused]] const BatchElementErrorPolicyTag::Expected &errorPolicyTag) {
+  std::vector<trait::TraitsDataPtr> resolveResult;
+  resolveResult.resize(entityReferences.size());
 
+  // Implemented as if FAILFAST is true.
+  if (auto firstError = dispatchFailFast(
+          context, /*shouldStopManager=*/true, resolveResult,
+          [&](const ContextConstPtr &stopContext, const ResolveSuccessCallback &successCallback,
+              const BatchElementErrorCallback &errorCallback) {
+            resolve(entityReferences, traitSet, resolveAccess, stopContext, successCallback,
+                    errorCallback);
+          })) {
+    return std::move(*firstError);
+  }
   return resolveResult;
 }
 
@@ -293,7 +2121,9 @@ hostApi::Manager::resolve(
     const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
     [[maybe_unused]] const BatchElementErrorPolicyTag::Variant &errorPolicyTag) {
   std::vector<std::variant<errors::BatchElementError, trait::TraitsDataPtr>> resolveResult;
-  resolveResult.resize(entityReferences.size());
+  // Fill with (cheap) null pointers rather than default-constructed
+  // errors, which each carry a message string.
+  resolveResult.resize(entityReferences.size(), trait::TraitsDataPtr{});
   resolve(
       entityReferences, traitSet, resolveAccess, context,
       [&resolveResult](std::size_t index, trait::TraitsDataPtr data) {
@@ -306,13 +2136,65 @@ hostApi::Manager::resolve(
   return resolveResult;
 }
 
+// Multi output container
+void hostApi::Manager::resolve(const EntityReferences &entityReferences,
+                               const trait::TraitSet &traitSet,
+                               const access::ResolveAccess resolveAccess,
+                               const ContextConstPtr &context, ResolveResults &results) {
+  results.reset(entityReferences.size());
+  resolve(
+      entityReferences, traitSet, resolveAccess, context,
+      [&results](std::size_t index, trait::TraitsDataPtr data) {
+        results.setValue(index, std::move(data));
+      },
+      [&results](std::size_t index, errors::BatchElementError error) {
+        results.setError(index, std::move(error));
+      });
+}
+
 void Manager::defaultEntityReference(const trait::TraitSets &traitSets,
                                      const access::DefaultEntityAccess defaultEntityAccess,
                                      const ContextConstPtr &context,
                                      const DefaultEntityReferenceSuccessCallback &successCallback,
                                      const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession_,
-                                            successCallback, errorCallback);
+  auditCall(ApiAuditor::Method::kDefaultEntityReference);
+  awaitInitialization();
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(),
+                       ManagerMetrics::Method::kDefaultEntityReference, *this, traitSets.size(),
+                       successCallback, errorCallback};
+  dispatchCancellable(
+      context, traitSets.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const DefaultEntityReferenceSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        if (!defaultEntityReferenceCache_) {
+          managerInterface_->defaultEntityReference(traitSets, defaultEntityAccess, context,
+                                                    hostSession_, trackedSuccessCallback,
+                                                    trackedErrorCallback);
+          return;
+        }
+        dispatchUnknown(
+            traitSets, trackedSuccessCallback, trackedErrorCallback,
+            [&](const trait::TraitSet &traitSet) {
+              return defaultEntityReferenceCache_->lookup(traitSet, defaultEntityAccess,
+                                                          context);
+            },
+            [&](const trait::TraitSets &uncachedTraitSets,
+                const DefaultEntityReferenceSuccessCallback &uncachedSuccessCallback,
+                const BatchElementErrorCallback &uncachedErrorCallback) {
+              managerInterface_->defaultEntityReference(
+                  uncachedTraitSets, defaultEntityAccess, context, hostSession_,
+                  borrowCallback<DefaultEntityReferenceSuccessCallback>(
+                      [&](const std::size_t uncachedIdx,
+                          std::optional<EntityReference> entityReference) {
+                        defaultEntityReferenceCache_->insert(uncachedTraitSets[uncachedIdx],
+                                                             defaultEntityAccess, context,
+                                                             entityReference);
+                        uncachedSuccessCallback(uncachedIdx, std::move(entityReference));
+                      }),
+                  uncachedErrorCallback);
+            });
+      });
 }
 
 void Manager::getWithRelationship(const EntityReferences &entityReferences,
@@ -322,25 +2204,39 @@ void Manager::getWithRelationship(const EntityReferences &entityReferences,
                                   const Manager::RelationshipQuerySuccessCallback &successCallback,
                                   const Manager::BatchElementErrorCallback &errorCallback,
                                   const trait::TraitSet &resultTraitSet) {
+  auditCall(ApiAuditor::Method::kGetWithRelationship);
+  awaitInitialization();
   if (pageSize == 0) {
     throw errors::InputValidationException{"pageSize must be greater than zero."};
   }
 
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(),
+                       ManagerMetrics::Method::kGetWithRelationship, *this,
+                       entityReferences.size(), successCallback, errorCallback};
+
   /* The ManagerInterface signature provides an `EntityReferencePagerInterfacePtr`
    * in the callback type, as we don't want to force the manager to
    * construct a host type (`EntityReferencePager`), as it shouldn't
    * have any knowledge about that.
    * This callback does the converting construction and forwards through.
    */
-  const auto convertingPagerSuccessCallback =
-      [&hostSession = this->hostSession_, &successCallback](
-          std::size_t idx, managerApi::EntityReferencePagerInterfacePtr pagerInterface) {
-        auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface), hostSession);
-        successCallback(idx, std::move(pager));
-      };
-  managerInterface_->getWithRelationship(entityReferences, relationshipTraitsData, resultTraitSet,
-                                         pageSize, relationsAccess, context, hostSession_,
-                                         convertingPagerSuccessCallback, errorCallback);
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const RelationshipQuerySuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        const auto convertingPagerSuccessCallback =
+            [&hostSession = this->hostSession_, prefetchDepth = this->pagerPrefetchDepth_,
+             &trackedSuccessCallback](
+                std::size_t idx, managerApi::EntityReferencePagerInterfacePtr pagerInterface) {
+              auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface),
+                                                               hostSession, prefetchDepth);
+              trackedSuccessCallback(idx, std::move(pager));
+            };
+        managerInterface_->getWithRelationship(
+            entityReferences, relationshipTraitsData, resultTraitSet, pageSize, relationsAccess,
+            context, hostSession_, convertingPagerSuccessCallback, trackedErrorCallback);
+      });
 }
 
 void Manager::getWithRelationships(
@@ -349,25 +2245,102 @@ void Manager::getWithRelationships(
     const Manager::RelationshipQuerySuccessCallback &successCallback,
     const Manager::BatchElementErrorCallback &errorCallback,
     const trait::TraitSet &resultTraitSet) {
+  auditCall(ApiAuditor::Method::kGetWithRelationships);
+  awaitInitialization();
   if (pageSize == 0) {
     throw errors::InputValidationException{"pageSize must be greater than zero."};
   }
 
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(),
+                       ManagerMetrics::Method::kGetWithRelationships, *this,
+                       relationshipTraitsDatas.size(), successCallback, errorCallback};
+
   /* The ManagerInterface signature provides an `EntityReferencePagerInterfacePtr`
    * in the callback type, as we don't want to force the manager to
    * construct a host type (`EntityReferencePager`), as it shouldn't
    * have any knowledge about that.
    * This callback does the converting construction and forwards through.
    */
-  const auto convertingPagerSuccessCallback =
-      [&hostSession = this->hostSession_, &successCallback](
-          std::size_t idx, managerApi::EntityReferencePagerInterfacePtr pagerInterface) {
-        auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface), hostSession);
-        successCallback(idx, std::move(pager));
-      };
-  managerInterface_->getWithRelationships(entityReference, relationshipTraitsDatas, resultTraitSet,
-                                          pageSize, relationsAccess, context, hostSession_,
-                                          convertingPagerSuccessCallback, errorCallback);
+  dispatchCancellable(
+      context, relationshipTraitsDatas.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const RelationshipQuerySuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        const auto convertingPagerSuccessCallback =
+            [&hostSession = this->hostSession_, prefetchDepth = this->pagerPrefetchDepth_,
+             &trackedSuccessCallback](
+                std::size_t idx, managerApi::EntityReferencePagerInterfacePtr pagerInterface) {
+              auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface),
+                                                               hostSession, prefetchDepth);
+              trackedSuccessCallback(idx, std::move(pager));
+            };
+        managerInterface_->getWithRelationships(
+            entityReference, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
+            context, hostSession_, convertingPagerSuccessCallback, trackedErrorCallback);
+      });
+}
+
+void Manager::getWithRelationshipsMatrix(
+    const EntityReferences &entityReferences, const trait::TraitsDatas &relationshipTraitsDatas,
+    size_t pageSize, const access::RelationsAccess relationsAccess, const ContextConstPtr &context,
+    const Manager::RelationshipQuerySuccessCallback &successCallback,
+    const Manager::BatchElementErrorCallback &errorCallback,
+    const trait::TraitSet &resultTraitSet) {
+  auditCall(ApiAuditor::Method::kGetWithRelationshipsMatrix);
+  awaitInitialization();
+  if (pageSize == 0) {
+    throw errors::InputValidationException{"pageSize must be greater than zero."};
+  }
+
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(),
+                       ManagerMetrics::Method::kGetWithRelationshipsMatrix, *this,
+                       entityReferences.size() * relationshipTraitsDatas.size(), successCallback,
+                       errorCallback};
+  dispatchCancellable(
+      context, entityReferences.size() * relationshipTraitsDatas.size(), trace.successCallback(),
+      trace.errorCallback(),
+      [&](const RelationshipQuerySuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        const auto convertingPagerSuccessCallback =
+            [&hostSession = this->hostSession_, prefetchDepth = this->pagerPrefetchDepth_,
+             &trackedSuccessCallback](
+                std::size_t idx, managerApi::EntityReferencePagerInterfacePtr pagerInterface) {
+              auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface),
+                                                               hostSession, prefetchDepth);
+              trackedSuccessCallback(idx, std::move(pager));
+            };
+        managerInterface_->getWithRelationshipsMatrix(
+            entityReferences, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
+            context, hostSession_, convertingPagerSuccessCallback, trackedErrorCallback);
+      });
+}
+
+void Manager::traverseRelationships(
+    const EntityReferences &entityReferences, const trait::TraitsDatas &relationshipTraitsDatas,
+    const std::size_t maxDepth, const access::RelationsAccess relationsAccess,
+    const ContextConstPtr &context,
+    const Manager::RelationshipTraversalSuccessCallback &successCallback,
+    const Manager::BatchElementErrorCallback &errorCallback,
+    const trait::TraitSet &resultTraitSet) {
+  auditCall(ApiAuditor::Method::kTraverseRelationships);
+  awaitInitialization();
+  if (relationshipTraitsDatas.empty()) {
+    throw errors::InputValidationException{"relationshipTraitsDatas must not be empty."};
+  }
+
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(),
+                       ManagerMetrics::Method::kTraverseRelationships, *this,
+                       entityReferences.size(), successCallback, errorCallback};
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const RelationshipTraversalSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        managerInterface_->traverseRelationships(
+            entityReferences, relationshipTraitsDatas, resultTraitSet, maxDepth, relationsAccess,
+            context, hostSession_, trackedSuccessCallback, trackedErrorCallback);
+      });
 }
 
 void Manager::preflight(const EntityReferences &entityReferences,
@@ -376,22 +2349,27 @@ void Manager::preflight(const EntityReferences &entityReferences,
                         const ContextConstPtr &context,
                         const PreflightSuccessCallback &successCallback,
                         const BatchElementErrorCallback &errorCallback) {
-  if (entityReferences.size() != traitsHints.size()) {
-    std::string message = "Parameter lists must be of the same length: ";
-    message += std::to_string(entityReferences.size());
-    message += " entity references vs. ";
-    message += std::to_string(traitsHints.size());
-    message += " traits hints.";
-    throw errors::InputValidationException{message};
-  }
-  managerInterface_->preflight(entityReferences, traitsHints, publishingAccess, context,
-                               hostSession_, successCallback, errorCallback);
+  auditCall(ApiAuditor::Method::kPreflight);
+  awaitInitialization();
+  verifyBatchLengths(entityReferences.size(), traitsHints.size(), "traits hints");
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kPreflight,
+                       *this, entityReferences.size(), successCallback, errorCallback};
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const PreflightSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        const auto admission = admit(requestScheduler_.get(), context);
+        managerInterface_->preflight(entityReferences, traitsHints, publishingAccess, context,
+                                     hostSession_, trackedSuccessCallback, trackedErrorCallback);
+      });
 }
 
 EntityReference Manager::preflight(
     const EntityReference &entityReference, const trait::TraitsDataPtr &traitsHint,
     const access::PublishingAccess publishingAccess, const ContextConstPtr &context,
     [[maybe_unused]] const Manager::BatchElementErrorPolicyTag::Exception &errorPolicyTag) {
+  awaitInitialization();
   EntityReference result{""};
   preflight(
       {entityReference}, {traitsHint}, publishingAccess, context,
@@ -399,10 +2377,9 @@ EntityReference Manager::preflight(
         result = std::move(preflightedRef);
       },
       [&entityReference, publishingAccess](std::size_t index, errors::BatchElementError error) {
-        auto msg = errors::createBatchElementExceptionMessage(
-            error, index, entityReference,
+        throw errors::createBatchElementException(
+            std::move(error), index, entityReference,
             static_cast<internal::access::Access>(publishingAccess));
-        throw errors::BatchElementException(index, std::move(error), msg);
       });
 
   return result;
@@ -412,6 +2389,7 @@ std::variant<errors::BatchElementError, EntityReference> Manager::preflight(
     const EntityReference &entityReference, const trait::TraitsDataPtr &traitsHint,
     const access::PublishingAccess publishingAccess, const ContextConstPtr &context,
     [[maybe_unused]] const Manager::BatchElementErrorPolicyTag::Variant &errorPolicyTag) {
+  awaitInitialization();
   std::variant<errors::BatchElementError, EntityReference> result;
   preflight(
       {entityReference}, {traitsHint}, publishingAccess, context,
@@ -429,22 +2407,46 @@ EntityReferences Manager::preflight(
     const EntityReferences &entityReferences, const trait::TraitsDatas &traitsHints,
     access::PublishingAccess publishingAccess, const ContextConstPtr &context,
     [[maybe_unused]] const Manager::BatchElementErrorPolicyTag::Exception &errorPolicyTag) {
+  awaitInitialization();
   EntityReferences results;
   results.resize(entityReferences.size(), EntityReference{""});
 
-  preflight(
-      entityReferences, traitsHints, publishingAccess, context,
-      [&results](std::size_t index, EntityReference preflightedRef) {
-        results[index] = std::move(preflightedRef);
-      },
-      [&entityReferences, publishingAccess](std::size_t index, errors::BatchElementError error) {
-        // Implemented as if FAILFAST is true.
-        auto msg = errors::createBatchElementExceptionMessage(
-            error, index, entityReferences[index],
-            static_cast<internal::access::Access>(publishingAccess));
-        throw errors::BatchElementException(index, std::move(error), msg);
-      });
+  // Implemented as if FAILFAST is true, but with the caller's Context,
+  // so the manager isn't asked to stop early.
+  if (auto firstError = dispatchFailFast(
+          context, /*shouldStopManager=*/false, results,
+          [&](const ContextConstPtr &dispatchContext,
+              const PreflightSuccessCallback &successCallback,
+              const BatchElementErrorCallback &errorCallback) {
+            preflight(entityReferences, traitsHints, publishingAccess, dispatchContext,
+                      successCallback, errorCallback);
+          })) {
+    auto &[index, error] = *firstError;
+    throw errors::createBatchElementException(
+        std::move(error), index, entityReferences[index],
+        static_cast<internal::access::Access>(publishingAccess));
+  }
+  return results;
+}
+
+std::variant<Manager::IndexedBatchElementError, EntityReferences> Manager::preflight(
+    const EntityReferences &entityReferences, const trait::TraitsDatas &traitsHints,
+    access::PublishingAccess publishingAccess, const ContextConstPtr &context,
+    [[maybe_unused]] const Manager::BatchElementErrorPolicyTag::Expected &errorPolicyTag) {
+  awaitInitialization();
+  EntityReferences results;
+  results.resize(entityReferences.size(), EntityReference{""});
 
+  // Implemented as if FAILFAST is true.
+  if (auto firstError = dispatchFailFast(
+          context, /*shouldStopManager=*/true, results,
+          [&](const ContextConstPtr &stopContext, const PreflightSuccessCallback &successCallback,
+              const BatchElementErrorCallback &errorCallback) {
+            preflight(entityReferences, traitsHints, publishingAccess, stopContext,
+                      successCallback, errorCallback);
+          })) {
+    return std::move(*firstError);
+  }
   return results;
 }
 
@@ -452,6 +2454,7 @@ std::vector<std::variant<errors::BatchElementError, EntityReference>> Manager::p
     const EntityReferences &entityReferences, const trait::TraitsDatas &traitsHints,
     const access::PublishingAccess publishingAccess, const ContextConstPtr &context,
     [[maybe_unused]] const Manager::BatchElementErrorPolicyTag::Variant &errorPolicyTag) {
+  awaitInitialization();
   std::vector<std::variant<errors::BatchElementError, EntityReference>> results;
   results.resize(entityReferences.size());
   preflight(
@@ -472,16 +2475,27 @@ void Manager::register_(const EntityReferences &entityReferences,
                         const ContextConstPtr &context,
                         const RegisterSuccessCallback &successCallback,
                         const BatchElementErrorCallback &errorCallback) {
-  if (entityReferences.size() != entityTraitsDatas.size()) {
-    std::string message = "Parameter lists must be of the same length: ";
-    message += std::to_string(entityReferences.size());
-    message += " entity references vs. ";
-    message += std::to_string(entityTraitsDatas.size());
-    message += " traits datas.";
-    throw errors::InputValidationException{message};
-  }
-  return managerInterface_->register_(entityReferences, entityTraitsDatas, publishingAccess,
-                                      context, hostSession_, successCallback, errorCallback);
+  auditCall(ApiAuditor::Method::kRegister);
+  awaitInitialization();
+  verifyBatchLengths(entityReferences.size(), entityTraitsDatas.size(), "traits datas");
+  const log::BufferedLogger::Scope logScope{hostSession_->logger()};
+  BatchCallTrace trace{hostSession_->logger(), metrics_.get(), ManagerMetrics::Method::kRegister,
+                       *this, entityReferences.size(), successCallback, errorCallback};
+  dispatchCancellable(
+      context, entityReferences.size(), trace.successCallback(), trace.errorCallback(),
+      [&](const RegisterSuccessCallback &trackedSuccessCallback,
+          const BatchElementErrorCallback &trackedErrorCallback) {
+        const auto admission = admit(requestScheduler_.get(), context);
+        managerInterface_->register_(
+            entityReferences, entityTraitsDatas, publishingAccess, context, hostSession_,
+            [&](const std::size_t idx, EntityReference registeredReference) {
+              // Before the caller sees the reference, so that it can
+              // immediately query its existence. Cheap once dropped.
+              dropEntityExistenceFilter();
+              trackedSuccessCallback(idx, std::move(registeredReference));
+            },
+            trackedErrorCallback);
+      });
 }
 
 // Singular Except
@@ -496,10 +2510,9 @@ EntityReference hostApi::Manager::register_(
         result = std::move(registeredRef);
       },
       [&entityReference, publishingAccess](std::size_t index, errors::BatchElementError error) {
-        auto msg = errors::createBatchElementExceptionMessage(
-            error, index, entityReference,
+        throw errors::createBatchElementException(
+            std::move(error), index, entityReference,
             static_cast<internal::access::Access>(publishingAccess));
-        throw errors::BatchElementException(index, std::move(error), msg);
       });
 
   return result;
@@ -528,22 +2541,45 @@ std::vector<EntityReference> hostApi::Manager::register_(
     const EntityReferences &entityReferences, const trait::TraitsDatas &entityTraitsDatas,
     const access::PublishingAccess publishingAccess, const ContextConstPtr &context,
     [[maybe_unused]] const BatchElementErrorPolicyTag::Exception &errorPolicyTag) {
-  std::vector<EntityReference> result;
+  EntityReferences result;
   result.resize(entityReferences.size(), EntityReference{""});
 
-  register_(
-      entityReferences, entityTraitsDatas, publishingAccess, context,
-      [&result](std::size_t index, EntityReference registeredRef) {
-        result[index] = std::move(registeredRef);
-      },
-      [&entityReferences, publishingAccess](std::size_t index, errors::BatchElementError error) {
-        // Implemented as if FAILFAST is true.
-        auto msg = errors::createBatchElementExceptionMessage(
-            error, index, entityReferences[index],
-            static_cast<internal::access::Access>(publishingAccess));
-        throw errors::BatchElementException(index, std::move(error), msg);
-      });
+  // Implemented as if FAILFAST is true, but with the caller's Context,
+  // so the manager isn't asked to stop early.
+  if (auto firstError = dispatchFailFast(
+          context, /*shouldStopManager=*/false, result,
+          [&](const ContextConstPtr &dispatchContext,
+              const RegisterSuccessCallback &successCallback,
+              const BatchElementErrorCallback &errorCallback) {
+            register_(entityReferences, entityTraitsDatas, publishingAccess, dispatchContext,
+                      successCallback, errorCallback);
+          })) {
+    auto &[index, error] = *firstError;
+    throw errors::createBatchElementException(
+        std::move(error), index, entityReferences[index],
+        static_cast<internal::access::Access>(publishingAccess));
+  }
+  return result;
+}
+
+// Multi expected
+std::variant<Manager::IndexedBatchElementError, EntityReferences> hostApi::Manager::register_(
+    const EntityReferences &entityReferences, const trait::TraitsDatas &entityTraitsDatas,
+    const access::PublishingAccess publishingAccess, const ContextConstPtr &context,
+    [[maybe_unused]] const BatchElementErrorPolicyTag::Expected &errorPolicyTag) {
+  EntityReferences result;
+  result.resize(entityReferences.size(), EntityReference{""});
 
+  // Implemented as if FAILFAST is true.
+  if (auto firstError = dispatchFailFast(
+          context, /*shouldStopManager=*/true, result,
+          [&](const ContextConstPtr &stopContext, const RegisterSuccessCallback &successCallback,
+              const BatchElementErrorCallback &errorCallback) {
+            register_(entityReferences, entityTraitsDatas, publishingAccess, stopContext,
+                      successCallback, errorCallback);
+          })) {
+    return std::move(*firstError);
+  }
   return result;
 }
 
@@ -566,6 +2602,297 @@ std::vector<std::variant<errors::BatchElementError, EntityReference>> hostApi::M
   return result;
 }
 
+namespace {
+/**
+ * Wrap a completion callback such that the manager interface is kept
+ * alive until the asynchronous operation completes.
+ */
+Manager::CompletionCallback retainUntilComplete(managerApi::ManagerInterfacePtr managerInterface,
+                                                Manager::CompletionCallback completionCallback) {
+  return [managerInterface = std::move(managerInterface),
+          completionCallback = std::move(completionCallback)](std::exception_ptr exception) {
+    completionCallback(std::move(exception));
+  };
+}
+
+/**
+ * If cancellation has already been requested, report all elements of
+ * a batch as cancelled and complete, rather than start the operation.
+ *
+ * @return Whether the batch was cancelled.
+ */
+bool completeIfCancelled(const ContextConstPtr &context, const std::size_t batchSize,
+                         const Manager::BatchElementErrorCallback &errorCallback,
+                         const Manager::CompletionCallback &completionCallback) {
+  if (!isCancelled(context)) {
+    return false;
+  }
+  reportCancelled(std::vector<bool>(batchSize, false), errorCallback);
+  completionCallback(nullptr);
+  return true;
+}
+
+/**
+ * Construct success/error/completion callbacks that accumulate results
+ * and fulfil a future, then pass them to the given function to start
+ * the operation.
+ */
+template <class Value, class Start>
+std::future<std::vector<std::variant<errors::BatchElementError, Value>>> startWithFuture(
+    const std::size_t batchSize, const Start &start) {
+  using Results = std::vector<std::variant<errors::BatchElementError, Value>>;
+  struct State {
+    Results results;
+    std::promise<Results> promise;
+  };
+  auto state = std::make_shared<State>();
+  state->results.resize(batchSize);
+  std::future<Results> future = state->promise.get_future();
+
+  start([state](std::size_t idx, Value value) { state->results[idx] = std::move(value); },
+        [state](std::size_t idx, errors::BatchElementError error) {
+          state->results[idx] = std::move(error);
+        },
+        [state](std::exception_ptr exception) {
+          if (exception) {
+            state->promise.set_exception(std::move(exception));
+          } else {
+            state->promise.set_value(std::move(state->results));
+          }
+        });
+  return future;
+}
+
+/**
+ * Construct success/error/completion callbacks that write results into
+ * a new stream, then pass them to the given function to start the
+ * operation.
+ */
+template <class Value, class Start>
+BatchResultStream<Value> startWithStream(const std::size_t bufferSize, const Start &start) {
+  BatchResultStream<Value> stream{bufferSize};
+  auto writer = stream.writer();
+  start([writer](std::size_t idx, Value value) { writer.write(idx, std::move(value)); },
+        [writer](std::size_t idx, errors::BatchElementError error) {
+          writer.write(idx, std::move(error));
+        },
+        [writer](std::exception_ptr exception) { writer.close(std::move(exception)); });
+  return stream;
+}
+}  // namespace
+
+void Manager::entityExistsAsync(const EntityReferences &entityReferences,
+                                const ContextConstPtr &context,
+                                ExistsSuccessCallback successCallback,
+                                BatchElementErrorCallback errorCallback,
+                                CompletionCallback completionCallback) {
+  auditCall(ApiAuditor::Method::kEntityExistsAsync);
+  awaitInitialization();
+  if (completeIfCancelled(context, entityReferences.size(), errorCallback, completionCallback)) {
+    return;
+  }
+  managerInterface_->entityExistsAsync(
+      entityReferences, context, hostSession_, std::move(successCallback),
+      std::move(errorCallback),
+      retainUntilComplete(managerInterface_, std::move(completionCallback)));
+}
+
+std::future<std::vector<std::variant<errors::BatchElementError, bool>>>
+Manager::entityExistsAsync(const EntityReferences &entityReferences,
+                           const ContextConstPtr &context) {
+  awaitInitialization();
+  return startWithFuture<bool>(entityReferences.size(), [&](auto success, auto error,
+                                                            auto completion) {
+    entityExistsAsync(entityReferences, context, std::move(success), std::move(error),
+                      std::move(completion));
+  });
+}
+
+void Manager::entityTraitsAsync(const EntityReferences &entityReferences,
+                                const access::EntityTraitsAccess entityTraitsAccess,
+                                const ContextConstPtr &context,
+                                EntityTraitsSuccessCallback successCallback,
+                                BatchElementErrorCallback errorCallback,
+                                CompletionCallback completionCallback) {
+  auditCall(ApiAuditor::Method::kEntityTraitsAsync);
+  awaitInitialization();
+  if (completeIfCancelled(context, entityReferences.size(), errorCallback, completionCallback)) {
+    return;
+  }
+  managerInterface_->entityTraitsAsync(
+      entityReferences, entityTraitsAccess, context, hostSession_, std::move(successCallback),
+      std::move(errorCallback),
+      retainUntilComplete(managerInterface_, std::move(completionCallback)));
+}
+
+std::future<std::vector<std::variant<errors::BatchElementError, trait::TraitSet>>>
+Manager::entityTraitsAsync(const EntityReferences &entityReferences,
+                           const access::EntityTraitsAccess entityTraitsAccess,
+                           const ContextConstPtr &context) {
+  awaitInitialization();
+  return startWithFuture<trait::TraitSet>(
+      entityReferences.size(), [&](auto success, auto error, auto completion) {
+        entityTraitsAsync(entityReferences, entityTraitsAccess, context, std::move(success),
+                          std::move(error), std::move(completion));
+      });
+}
+
+BatchResultStream<trait::TraitSet> Manager::entityTraitsStream(
+    const EntityReferences &entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr &context, const std::size_t bufferSize) {
+  auditCall(ApiAuditor::Method::kEntityTraitsStream);
+  awaitInitialization();
+  return startWithStream<trait::TraitSet>(
+      bufferSize, [&](auto success, auto error, auto completion) {
+        entityTraitsAsync(entityReferences, entityTraitsAccess, context, std::move(success),
+                          std::move(error), std::move(completion));
+      });
+}
+
+void Manager::resolveAsync(const EntityReferences &entityReferences,
+                           const trait::TraitSet &traitSet,
+                           const access::ResolveAccess resolveAccess,
+                           const ContextConstPtr &context, ResolveSuccessCallback successCallback,
+                           BatchElementErrorCallback errorCallback,
+                           CompletionCallback completionCallback) {
+  auditCall(ApiAuditor::Method::kResolveAsync);
+  awaitInitialization();
+  if (completeIfCancelled(context, entityReferences.size(), errorCallback, completionCallback)) {
+    return;
+  }
+  if (!resolveCache_ || isResolveCached_) {
+    managerInterface_->resolveAsync(
+        entityReferences, traitSet, resolveAccess, context, hostSession_,
+        std::move(successCallback), std::move(errorCallback),
+        retainUntilComplete(managerInterface_, std::move(completionCallback)));
+    return;
+  }
+
+  // As for the synchronous resolve, serve what we can from the cache
+  // and forward the remainder, mapping indices back to the caller's.
+  auto missedRefs = std::make_shared<EntityReferences>();
+  auto missedIndices = std::make_shared<std::vector<std::size_t>>();
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (trait::TraitsDataPtr cached =
+            resolveCache_->lookup(entityReferences[idx], traitSet, resolveAccess, context)) {
+      successCallback(idx, std::move(cached));
+    } else {
+      missedRefs->push_back(entityReferences[idx]);
+      missedIndices->push_back(idx);
+    }
+  }
+
+  if (missedRefs->empty()) {
+    completionCallback(nullptr);
+    return;
+  }
+
+  managerInterface_->resolveAsync(
+      *missedRefs, traitSet, resolveAccess, context, hostSession_,
+      [resolveCache = resolveCache_, missedRefs, missedIndices, traitSet, resolveAccess, context,
+       successCallback = std::move(successCallback)](const std::size_t missedIdx,
+                                                     trait::TraitsDataPtr data) {
+        resolveCache->insert((*missedRefs)[missedIdx], traitSet, resolveAccess, context, data);
+        successCallback((*missedIndices)[missedIdx], std::move(data));
+      },
+      [missedIndices, errorCallback = std::move(errorCallback)](const std::size_t missedIdx,
+                                                                errors::BatchElementError error) {
+        errorCallback((*missedIndices)[missedIdx], std::move(error));
+      },
+      retainUntilComplete(managerInterface_, std::move(completionCallback)));
+}
+
+std::future<std::vector<std::variant<errors::BatchElementError, trait::TraitsDataPtr>>>
+Manager::resolveAsync(const EntityReferences &entityReferences, const trait::TraitSet &traitSet,
+                      const access::ResolveAccess resolveAccess, const ContextConstPtr &context) {
+  awaitInitialization();
+  return startWithFuture<trait::TraitsDataPtr>(
+      entityReferences.size(), [&](auto success, auto error, auto completion) {
+        resolveAsync(entityReferences, traitSet, resolveAccess, context, std::move(success),
+                     std::move(error), std::move(completion));
+      });
+}
+
+BatchResultStream<trait::TraitsDataPtr> Manager::resolveStream(
+    const EntityReferences &entityReferences, const trait::TraitSet &traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
+    const std::size_t bufferSize) {
+  auditCall(ApiAuditor::Method::kResolveStream);
+  awaitInitialization();
+  return startWithStream<trait::TraitsDataPtr>(
+      bufferSize, [&](auto success, auto error, auto completion) {
+        resolveAsync(entityReferences, traitSet, resolveAccess, context, std::move(success),
+                     std::move(error), std::move(completion));
+      });
+}
+
+void Manager::preflightAsync(const EntityReferences &entityReferences,
+                             const trait::TraitsDatas &traitsHints,
+                             const access::PublishingAccess publishingAccess,
+                             const ContextConstPtr &context,
+                             PreflightSuccessCallback successCallback,
+                             BatchElementErrorCallback errorCallback,
+                             CompletionCallback completionCallback) {
+  auditCall(ApiAuditor::Method::kPreflightAsync);
+  awaitInitialization();
+  verifyBatchLengths(entityReferences.size(), traitsHints.size(), "traits hints");
+  if (completeIfCancelled(context, entityReferences.size(), errorCallback, completionCallback)) {
+    return;
+  }
+  managerInterface_->preflightAsync(
+      entityReferences, traitsHints, publishingAccess, context, hostSession_,
+      std::move(successCallback), std::move(errorCallback),
+      retainUntilComplete(managerInterface_, std::move(completionCallback)));
+}
+
+std::future<std::vector<std::variant<errors::BatchElementError, EntityReference>>>
+Manager::preflightAsync(const EntityReferences &entityReferences,
+                        const trait::TraitsDatas &traitsHints,
+                        const access::PublishingAccess publishingAccess,
+                        const ContextConstPtr &context) {
+  awaitInitialization();
+  return startWithFuture<EntityReference>(
+      entityReferences.size(), [&](auto success, auto error, auto completion) {
+        preflightAsync(entityReferences, traitsHints, publishingAccess, context,
+                       std::move(success), std::move(error), std::move(completion));
+      });
+}
+
+void Manager::registerAsync(const EntityReferences &entityReferences,
+                            const trait::TraitsDatas &entityTraitsDatas,
+                            const access::PublishingAccess publishingAccess,
+                            const ContextConstPtr &context,
+                            RegisterSuccessCallback successCallback,
+                            BatchElementErrorCallback errorCallback,
+                            CompletionCallback completionCallback) {
+  auditCall(ApiAuditor::Method::kRegisterAsync);
+  awaitInitialization();
+  verifyBatchLengths(entityReferences.size(), entityTraitsDatas.size(), "traits datas");
+  if (completeIfCancelled(context, entityReferences.size(), errorCallback, completionCallback)) {
+    return;
+  }
+  // Results may arrive after this Manager is destroyed, so drop the
+  // filter up front rather than on the first success.
+  dropEntityExistenceFilter();
+  managerInterface_->registerAsync(
+      entityReferences, entityTraitsDatas, publishingAccess, context, hostSession_,
+      std::move(successCallback), std::move(errorCallback),
+      retainUntilComplete(managerInterface_, std::move(completionCallback)));
+}
+
+std::future<std::vector<std::variant<errors::BatchElementError, EntityReference>>>
+Manager::registerAsync(const EntityReferences &entityReferences,
+                       const trait::TraitsDatas &entityTraitsDatas,
+                       const access::PublishingAccess publishingAccess,
+                       const ContextConstPtr &context) {
+  awaitInitialization();
+  return startWithFuture<EntityReference>(
+      entityReferences.size(), [&](auto success, auto error, auto completion) {
+        registerAsync(entityReferences, entityTraitsDatas, publishingAccess, context,
+                      std::move(success), std::move(error), std::move(completion));
+      });
+}
+
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -1,25 +1,234 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <filesystem>
+#include <mutex>
+#include <optional>
 #include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
 
+#include <fmt/format.h>
 #include <toml++/toml.h>
 
+#include <openassetio/MemoryResource.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trace/TracerInterface.hpp>
 #include <openassetio/typedefs.hpp>
 #include "openassetio/InfoDictionary.hpp"
 
+#include "SharedManagerRegistry.hpp"
+
 namespace {
 constexpr std::string_view kConfigDirVar = "${config_dir}";
+
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::hostApi::ManagerFactory;
+namespace errors = openassetio::errors;
+namespace trace = openassetio::trace;
+
+/**
+ * A span reported to the global tracer, if set, for the lifetime of
+ * the instance, recording whether it ended due to an exception.
+ */
+class ScopedSpan {
+ public:
+  ScopedSpan(const std::string_view name, const InfoDictionary& attributes)
+      : tracer_{trace::TracerInterface::globalTracer()} {
+    if (!tracer_) {
+      return;
+    }
+    spanId_ = tracer_->beginSpan(Str{name}, attributes);
+    uncaughtExceptionCount_ = std::uncaught_exceptions();
+  }
+
+  ~ScopedSpan() {
+    if (!tracer_) {
+      return;
+    }
+    try {
+      const bool isUnwinding = std::uncaught_exceptions() > uncaughtExceptionCount_;
+      tracer_->endSpan(spanId_, {{"outcome", Str{isUnwinding ? "exception" : "returned"}}});
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+      // Tracing must not mask the outcome of the call, nor throw
+      // during unwinding.
+    }
+  }
+
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan(ScopedSpan&&) noexcept = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(ScopedSpan&&) noexcept = delete;
+
+ private:
+  trace::TracerInterfacePtr tracer_;
+  trace::TracerInterface::SpanId spanId_{0};
+  int uncaughtExceptionCount_{0};
+};
+
+/// Parsed config, along with the file details it was parsed from.
+struct ConfigCacheEntry {
+  std::filesystem::file_time_type modified;
+  std::uintmax_t size;
+  ManagerFactory::DefaultManagerConfig config;
+};
+
+/// Process-wide cache of parsed configs, keyed on absolute path.
+struct ConfigCache {
+  std::mutex mutex;
+  std::unordered_map<Str, ConfigCacheEntry> entries;
+};
+
+ConfigCache& configCache() {
+  static ConfigCache cache;
+  return cache;
+}
+
+/**
+ * Read a positive integer from a resolve cache config table, or
+ * `fallback` if it is absent.
+ */
+std::size_t positiveIntegerOr(const toml::table& table, const std::string_view key,
+                              const std::size_t fallback) {
+  const toml::node* node = table.get(key);
+  if (!node) {
+    return fallback;
+  }
+  const std::optional<std::int64_t> value = node->value<std::int64_t>();
+  if (!value || *value <= 0) {
+    Str msg = "Resolve cache '";
+    msg += key;
+    msg += "' must be a positive integer.";
+    throw errors::ConfigurationException(msg);
+  }
+  return static_cast<std::size_t>(*value);
+}
+
+/**
+ * Parse a `[manager.resolve_cache]` table.
+ */
+template <class SubstituteConfigDir>
+ManagerFactory::ResolveCacheConfig parseResolveCacheConfig(
+    const toml::table& table, const SubstituteConfigDir& substituteConfigDir) {
+  using openassetio::hostApi::ResolveCache;
+  ManagerFactory::ResolveCacheConfig cacheConfig{positiveIntegerOr(table, "capacity", 0), {}};
+  if (cacheConfig.capacity == 0) {
+    throw errors::ConfigurationException("Resolve cache 'capacity' must be specified.");
+  }
+
+  const std::optional<std::string> sharedName = table["shared_name"].value<std::string>();
+  const std::optional<std::string> path = table["path"].value<std::string>();
+  if (!sharedName && !path) {
+    return cacheConfig;
+  }
+  if (sharedName && path) {
+    throw errors::ConfigurationException(
+        "Resolve cache must not specify both 'shared_name' and 'path'.");
+  }
+  ResolveCache::SharedTier sharedTier{
+      sharedName.value_or(""), positiveIntegerOr(table, "slot_count", 0),
+      positiveIntegerOr(table, "slot_size", ResolveCache::kDefaultSharedSlotSize),
+      path ? substituteConfigDir(*path) : Str{},
+      std::chrono::seconds{
+          static_cast<std::chrono::seconds::rep>(positiveIntegerOr(table, "time_to_live", 0))}};
+  if (sharedTier.slotCount == 0) {
+    throw errors::ConfigurationException(
+        "Resolve cache 'slot_count' must be specified for a shared tier.");
+  }
+  cacheConfig.sharedTier = std::move(sharedTier);
+  return cacheConfig;
+}
+
+/**
+ * Load and parse a TOML config file, substituting `${config_dir}` in
+ * string settings.
+ */
+ManagerFactory::DefaultManagerConfig parseDefaultManagerConfig(
+    const std::string_view configPath) {
+  if (!std::filesystem::exists(configPath)) {
+    Str msg = "Could not load default manager config from '";
+    msg += configPath;
+    msg += "', file does not exist.";
+    throw errors::InputValidationException(msg);
+  }
+
+  if (std::filesystem::is_directory(configPath)) {
+    Str msg = "Could not load default manager config from '";
+    msg += configPath;
+    msg += "', must be a TOML file not a directory.";
+    throw errors::InputValidationException(msg);
+  }
+
+  toml::parse_result config;
+  try {
+    config = toml::parse_file(configPath);
+  } catch (const std::exception& exc) {
+    std::string msg = "Error parsing config file. ";
+    msg += exc.what();
+    throw errors::ConfigurationException{msg};
+  }
+  const std::string_view identifier = config["manager"]["identifier"].value_or("");
+
+  // Function to substitute ${config_dir} with the absolute,
+  // canonicalised directory of the TOML config file.
+  const auto substituteConfigDir =
+      [configDir =
+           std::filesystem::canonical(configPath).parent_path().string()](std::string str) {
+        // Adapted from https://en.cppreference.com/w/cpp/string/basic_string/replace
+        for (std::string::size_type pos{};
+             (pos = str.find(kConfigDirVar, pos)) != std::string::npos;
+             pos += configDir.length()) {
+          str.replace(pos, kConfigDirVar.length(), configDir);
+        }
+        return str;
+      };
+
+  InfoDictionary settings;
+  if (toml::table* settingsTable = config["manager"]["settings"].as_table()) {
+    // It'd be nice to use settingsTable::for_each, a lambda and
+    // w/constexpr to filter supported types, filter, but it ends up
+    // being somewhat verbose due to the number of types supported by
+    // the variant.
+    for (const auto& [key, val] : *settingsTable) {
+      if (val.is_integer()) {
+        settings.insert({Str{key}, val.as_integer()->get()});
+      } else if (val.is_floating_point()) {
+        settings.insert({Str{key}, val.as_floating_point()->get()});
+      } else if (val.is_string()) {
+        settings.insert({Str{key}, substituteConfigDir(val.as_string()->get())});
+      } else if (val.is_boolean()) {
+        settings.insert({Str{key}, val.as_boolean()->get()});
+      } else {
+        Str msg = "Unsupported value type for '";
+        msg += key.str();
+        msg += "'.";
+        throw errors::ConfigurationException(msg);
+      }
+    }
+  }
+
+  std::optional<ManagerFactory::ResolveCacheConfig> resolveCache;
+  if (const toml::table* cacheTable = config["manager"]["resolve_cache"].as_table()) {
+    resolveCache = parseResolveCacheConfig(*cacheTable, substituteConfigDir);
+  }
+
+  return {Str{identifier}, std::move(settings), std::move(resolveCache)};
+}
 }  // namespace
 
 namespace openassetio {
@@ -32,23 +241,34 @@ ManagerFactoryPtr ManagerFactory::make(
     HostInterfacePtr hostInterface,
     ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
     log::LoggerInterfacePtr logger) {
-  return openassetio::hostApi::ManagerFactoryPtr{new ManagerFactory{
-      std::move(hostInterface), std::move(managerImplementationFactory), std::move(logger)}};
+  return make(std::move(hostInterface), std::move(managerImplementationFactory),
+              std::move(logger), nullptr);
+}
+
+ManagerFactoryPtr ManagerFactory::make(
+    HostInterfacePtr hostInterface,
+    ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
+    log::LoggerInterfacePtr logger, MemoryResourceInterfacePtr memoryResource) {
+  return openassetio::hostApi::ManagerFactoryPtr{
+      new ManagerFactory{std::move(hostInterface), std::move(managerImplementationFactory),
+                         std::move(logger), std::move(memoryResource)}};
 }
 
 ManagerFactory::ManagerFactory(
     HostInterfacePtr hostInterface,
     ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
-    log::LoggerInterfacePtr logger)
+    log::LoggerInterfacePtr logger, MemoryResourceInterfacePtr memoryResource)
     : hostInterface_{std::move(hostInterface)},
       managerImplementationFactory_{std::move(managerImplementationFactory)},
-      logger_{std::move(logger)} {}
+      logger_{std::move(logger)},
+      memoryResource_{std::move(memoryResource)} {}
 
 Identifiers ManagerFactory::identifiers() const {
   return managerImplementationFactory_->identifiers();
 }
 
 ManagerFactory::ManagerDetails ManagerFactory::availableManagers() const {
+  const ScopedSpan span{"ManagerFactory.availableManagers", {}};
   const Identifiers& ids = identifiers();
   if (ids.empty()) {
     return {};
@@ -57,6 +277,13 @@ ManagerFactory::ManagerDetails ManagerFactory::availableManagers() const {
   ManagerDetails managerDetails;
 
   for (const Identifier& identifier : ids) {
+    // Avoid instantiating the manager, if the factory already knows
+    // its details.
+    if (std::optional<ManagerDetail> detail = managerImplementationFactory_->details(identifier)) {
+      managerDetails.insert({identifier, *std::move(detail)});
+      continue;
+    }
+
     const managerApi::ManagerInterfacePtr managerInterface =
         managerImplementationFactory_->instantiate(identifier);
 
@@ -67,18 +294,24 @@ ManagerFactory::ManagerDetails ManagerFactory::availableManagers() const {
   return managerDetails;
 }
 
-ManagerPtr ManagerFactory::createManager(const Identifier& identifier) const {
-  return createManagerForInterface(identifier, hostInterface_, managerImplementationFactory_,
-                                   logger_);
+ManagerPtr ManagerFactory::createManager(const Identifier& identifier,
+                                         Manager::Options managerOptions) const {
+  const ScopedSpan span{"ManagerFactory.createManager", {{"manager", identifier}}};
+  return Manager::make(managerImplementationFactory_->instantiate(identifier),
+                       managerApi::HostSession::make(managerApi::Host::make(hostInterface_),
+                                                     logger_, memoryResource_),
+                       std::move(managerOptions));
 }
 
 ManagerPtr ManagerFactory::createManagerForInterface(
     const Identifier& identifier, const HostInterfacePtr& hostInterface,
     const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
-    const log::LoggerInterfacePtr& logger) {
+    const log::LoggerInterfacePtr& logger, Manager::Options managerOptions) {
+  const ScopedSpan span{"ManagerFactory.createManager", {{"manager", identifier}}};
   return Manager::make(
       managerImplementationFactory->instantiate(identifier),
-      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger));
+      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger),
+      std::move(managerOptions));
 }
 
 ManagerPtr ManagerFactory::defaultManagerForInterface(
@@ -96,12 +329,12 @@ ManagerPtr ManagerFactory::defaultManagerForInterface(
     logger->log(log::LoggerInterface::Severity::kDebug, msg);
     return nullptr;
   }
-  {
+  logger->logLazily(log::LoggerInterface::Severity::kDebug, [] {
     Str msg = "Retrieved default manager config file path from '";
     msg += kDefaultManagerConfigEnvVarName;
     msg += "'";
-    logger->log(log::LoggerInterface::Severity::kDebug, msg);
-  }
+    return msg;
+  });
 
   return defaultManagerForInterface(configPath, hostInterface, managerImplementationFactory,
                                     logger);
@@ -111,83 +344,108 @@ ManagerPtr ManagerFactory::defaultManagerForInterface(
     const std::string_view configPath, const HostInterfacePtr& hostInterface,
     const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
     const log::LoggerInterfacePtr& logger) {
-  {
+  logger->logLazily(log::LoggerInterface::Severity::kDebug, [&] {
     Str msg = "Loading default manager config at '";
     msg += configPath;
     msg += "'";
-    logger->log(log::LoggerInterface::Severity::kDebug, msg);
-  }
+    return msg;
+  });
 
-  if (!std::filesystem::exists(configPath)) {
-    Str msg = "Could not load default manager config from '";
-    msg += configPath;
-    msg += "', file does not exist.";
-    throw errors::InputValidationException(msg);
-  }
+  return defaultManagerForInterface(loadDefaultManagerConfig(configPath), hostInterface,
+                                    managerImplementationFactory, logger);
+}
 
-  if (std::filesystem::is_directory(configPath)) {
-    Str msg = "Could not load default manager config from '";
-    msg += configPath;
-    msg += "', must be a TOML file not a directory.";
-    throw errors::InputValidationException(msg);
-  }
+ManagerPtr ManagerFactory::defaultManagerForInterface(
+    const DefaultManagerConfig& config, const HostInterfacePtr& hostInterface,
+    const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+    const log::LoggerInterfacePtr& logger, Manager::Options managerOptions) {
+  const ScopedSpan span{"ManagerFactory.defaultManager", {{"manager", config.identifier}}};
+  const managerApi::HostSessionPtr hostSession =
+      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger);
 
-  toml::parse_result config;
-  try {
-    config = toml::parse_file(configPath);
-  } catch (const std::exception& exc) {
-    std::string msg = "Error parsing config file. ";
-    msg += exc.what();
-    throw errors::ConfigurationException{msg};
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+  const auto start = std::chrono::steady_clock::now();
+
+  if (config.resolveCache) {
+    const ResolveCacheConfig& cacheConfig = *config.resolveCache;
+    managerOptions.resolveCache =
+        cacheConfig.sharedTier ? ResolveCache::make(cacheConfig.capacity, *cacheConfig.sharedTier)
+                               : ResolveCache::make(cacheConfig.capacity);
   }
-  const std::string_view identifier = config["manager"]["identifier"].value_or("");
 
-  // Function to substitute ${config_dir} with the absolute,
-  // canonicalised directory of the TOML config file.
-  const auto substituteConfigDir =
-      [configDir =
-           std::filesystem::canonical(configPath).parent_path().string()](std::string str) {
-        // Adapted from https://en.cppreference.com/w/cpp/string/basic_string/replace
-        for (std::string::size_type pos{};
-             (pos = str.find(kConfigDirVar, pos)) != std::string::npos;
-             pos += configDir.length()) {
-          str.replace(pos, kConfigDirVar.length(), configDir);
-        }
-        return str;
-      };
+  ManagerPtr manager = Manager::make(managerImplementationFactory->instantiate(config.identifier),
+                                     hostSession, std::move(managerOptions));
+  const auto instantiated = std::chrono::steady_clock::now();
 
-  InfoDictionary settings;
-  if (toml::table* settingsTable = config["manager"]["settings"].as_table()) {
-    // It'd be nice to use settingsTable::for_each, a lambda and
-    // w/constexpr to filter supported types, filter, but it ends up
-    // being somewhat verbose due to the number of types supported by
-    // the variant.
-    for (const auto& [key, val] : *settingsTable) {
-      if (val.is_integer()) {
-        settings.insert({Str{key}, val.as_integer()->get()});
-      } else if (val.is_floating_point()) {
-        settings.insert({Str{key}, val.as_floating_point()->get()});
-      } else if (val.is_string()) {
-        settings.insert({Str{key}, substituteConfigDir(val.as_string()->get())});
-      } else if (val.is_boolean()) {
-        settings.insert({Str{key}, val.as_boolean()->get()});
-      } else {
-        Str msg = "Unsupported value type for '";
-        msg += key.str();
-        msg += "'.";
-        throw errors::ConfigurationException(msg);
-      }
+  manager->initialize(config.settings);
+
+  const auto initialized = std::chrono::steady_clock::now();
+
+  logger->logLazily(log::LoggerInterface::Severity::kDebugApi, [&] {
+    return fmt::format("ManagerFactory: Instantiated '{}' in {:.3f}ms, initialized in {:.3f}ms",
+                       config.identifier, Milliseconds{instantiated - start}.count(),
+                       Milliseconds{initialized - instantiated}.count());
+  });
+  return manager;
+}
+
+ManagerFactory::DefaultManagerConfig ManagerFactory::loadDefaultManagerConfig(
+    const std::string_view configPath) {
+  const ScopedSpan span{"ManagerFactory.loadDefaultManagerConfig",
+                        {{"configPath", Str{configPath}}}};
+  // Avoid throwing here, deferring to parseDefaultManagerConfig to
+  // report a sensible error for missing/invalid paths.
+  std::error_code errorCode;
+  Str absolutePath = std::filesystem::absolute(configPath, errorCode).string();
+  if (errorCode) {
+    return parseDefaultManagerConfig(configPath);
+  }
+  const std::filesystem::file_time_type modified =
+      std::filesystem::last_write_time(absolutePath, errorCode);
+  if (errorCode) {
+    return parseDefaultManagerConfig(configPath);
+  }
+  // Fails for directories.
+  const std::uintmax_t size = std::filesystem::file_size(absolutePath, errorCode);
+  if (errorCode) {
+    return parseDefaultManagerConfig(configPath);
+  }
+
+  ConfigCache& cache = configCache();
+  {
+    const std::lock_guard lock{cache.mutex};
+    if (const auto iter = cache.entries.find(absolutePath);
+        iter != cache.entries.end() && iter->second.modified == modified &&
+        iter->second.size == size) {
+      return iter->second.config;
     }
   }
 
-  const managerApi::HostSessionPtr hostSession =
-      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger);
+  // Parse outside the lock, so slow filesystems don't serialise
+  // unrelated loads. Concurrent loads of the same file may both
+  // parse, which is harmless.
+  DefaultManagerConfig config = parseDefaultManagerConfig(configPath);
 
-  ManagerPtr manager = Manager::make(
-      managerImplementationFactory->instantiate(Identifier(identifier)), hostSession);
+  const std::lock_guard lock{cache.mutex};
+  cache.entries.insert_or_assign(std::move(absolutePath),
+                                 ConfigCacheEntry{modified, size, config});
+  return config;
+}
 
-  manager->initialize(settings);
-  return manager;
+ManagerPtr ManagerFactory::sharedManager(const DefaultManagerConfig& config) const {
+  return sharedManagerForInterface(config, hostInterface_, managerImplementationFactory_,
+                                   logger_);
+}
+
+ManagerPtr ManagerFactory::sharedManagerForInterface(
+    const DefaultManagerConfig& config, const HostInterfacePtr& hostInterface,
+    const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+    const log::LoggerInterfacePtr& logger) {
+  return SharedManagerRegistry::instance().acquire(
+      hostInterface->identifier(), config.identifier, config.settings, [&] {
+        return defaultManagerForInterface(config, hostInterface, managerImplementationFactory,
+                                          logger);
+      });
 }
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
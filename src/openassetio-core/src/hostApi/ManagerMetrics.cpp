@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ManagerMetrics.hpp>
+
+#include "../internal/threadIndex.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+using ErrorCode = errors::BatchElementError::ErrorCode;
+
+/// Names of error codes, as used for Prometheus labels, indexed by
+/// ManagerMetrics::errorCodeIndex.
+constexpr std::array<std::string_view, ManagerMetrics::kErrorCodeCount> kErrorCodeNames{
+    "unknown",
+    "invalidEntityReference",
+    "malformedEntityReference",
+    "entityAccessError",
+    "entityResolutionError",
+    "invalidPreflightHint",
+    "invalidTraitSet",
+    "cancelled"};
+
+static_assert(static_cast<std::size_t>(ErrorCode::kCancelled) -
+                      static_cast<std::size_t>(ErrorCode::kUnknown) + 1 ==
+                  ManagerMetrics::kErrorCodeCount,
+              "Error codes must be contiguous and all be counted");
+
+/**
+ * Duration counters of a single method and batch size bucket within a
+ * single shard.
+ *
+ * The number of calls is not counted separately, since it is the sum
+ * of the latency buckets.
+ */
+struct BatchSizeCounters {
+  std::array<std::atomic<std::uint64_t>, ManagerMetrics::kLatencyBucketCount + 1> latencyBuckets;
+  std::atomic<std::int64_t> totalLatencyNs;
+};
+
+/**
+ * Counters of a single method within a single shard.
+ *
+ * Durations are only counted per batch size bucket, and aggregated
+ * for the method when a snapshot is taken, to minimise the cost of
+ * recording.
+ */
+struct MethodCounters {
+  std::atomic<std::uint64_t> exceptions;
+  std::atomic<std::uint64_t> successes;
+  std::array<std::atomic<std::uint64_t>, ManagerMetrics::kErrorCodeCount> errors;
+  std::array<BatchSizeCounters, ManagerMetrics::kBatchSizeBucketCount + 1> batchSizes;
+};
+
+/**
+ * Counters of all methods, updated by a subset of threads.
+ *
+ * Aligned to (a typical) cache line size, so that threads recording
+ * to different shards don't falsely share.
+ */
+struct alignas(64) Shard {  // NOLINT(readability-magic-numbers)
+  std::array<MethodCounters, ManagerMetrics::kMethodNames.size()> methods;
+};
+
+std::size_t latencyBucketIndex(const std::chrono::nanoseconds latency) {
+  std::size_t bucketIndex = 0;
+  while (bucketIndex < ManagerMetrics::kLatencyBucketCount &&
+         latency > ManagerMetrics::latencyBucketUpperBound(bucketIndex)) {
+    ++bucketIndex;
+  }
+  return bucketIndex;
+}
+
+/// Subtract each element of `earlier` from `later`.
+template <std::size_t N>
+std::array<std::uint64_t, N> difference(const std::array<std::uint64_t, N>& later,
+                                        const std::array<std::uint64_t, N>& earlier) {
+  std::array<std::uint64_t, N> result{};
+  for (std::size_t idx = 0; idx < N; ++idx) {
+    result[idx] = later[idx] - earlier[idx];
+  }
+  return result;
+}
+
+void increment(std::atomic<std::uint64_t>& counter, const std::uint64_t amount = 1) {
+  counter.fetch_add(amount, std::memory_order_relaxed);
+}
+
+/// Escape a Prometheus label value.
+std::string escapeLabelValue(const std::string_view value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char chr : value) {
+    switch (chr) {
+      case '\\':
+        escaped += R"(\\)";
+        break;
+      case '"':
+        escaped += R"(\")";
+        break;
+      case '\n':
+        escaped += R"(\n)";
+        break;
+      default:
+        escaped += chr;
+    }
+  }
+  return escaped;
+}
+}  // namespace
+
+class ManagerMetrics::Impl {
+ public:
+  explicit Impl(const std::size_t shardCount) {
+    shards_.reserve(shardCount);
+    for (std::size_t idx = 0; idx < shardCount; ++idx) {
+      // Value-initialised, so all counters are zero.
+      shards_.push_back(std::make_unique<Shard>());
+    }
+  }
+
+  void record(const Method method, const std::chrono::nanoseconds latency,
+              const std::uint64_t successes, const ErrorCounts& errors,
+              const bool raisedException, const std::size_t batchSize) {
+    Shard& shard = *shards_[internal::threadIndex() % shards_.size()];
+    MethodCounters& counters = shard.methods[static_cast<std::size_t>(method)];
+
+    if (raisedException) {
+      increment(counters.exceptions);
+    }
+    if (successes != 0) {
+      increment(counters.successes, successes);
+    }
+    for (std::size_t codeIdx = 0; codeIdx < errors.size(); ++codeIdx) {
+      if (errors[codeIdx] != 0) {
+        increment(counters.errors[codeIdx], errors[codeIdx]);
+      }
+    }
+    BatchSizeCounters& batchSizeCounters = counters.batchSizes[batchSizeBucketIndex(batchSize)];
+    increment(batchSizeCounters.latencyBuckets[latencyBucketIndex(latency)]);
+    batchSizeCounters.totalLatencyNs.fetch_add(latency.count(), std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] Snapshot snapshot() const {
+    Snapshot aggregated{};
+    for (const auto& shard : shards_) {
+      for (std::size_t methodIdx = 0; methodIdx < kMethodNames.size(); ++methodIdx) {
+        const MethodCounters& counters = shard->methods[methodIdx];
+        MethodStatistics& statistics = aggregated.methods[methodIdx];
+
+        statistics.exceptions += counters.exceptions.load(std::memory_order_relaxed);
+        statistics.successes += counters.successes.load(std::memory_order_relaxed);
+        for (std::size_t codeIdx = 0; codeIdx < kErrorCodeCount; ++codeIdx) {
+          statistics.errors[codeIdx] += counters.errors[codeIdx].load(std::memory_order_relaxed);
+        }
+        for (std::size_t sizeIdx = 0; sizeIdx < counters.batchSizes.size(); ++sizeIdx) {
+          const BatchSizeCounters& batchSizeCounters = counters.batchSizes[sizeIdx];
+          BatchSizeStatistics& batchSizeStatistics = statistics.batchSizes[sizeIdx];
+          for (std::size_t bucketIdx = 0; bucketIdx < batchSizeCounters.latencyBuckets.size();
+               ++bucketIdx) {
+            const std::uint64_t calls =
+                batchSizeCounters.latencyBuckets[bucketIdx].load(std::memory_order_relaxed);
+            batchSizeStatistics.latencyBuckets[bucketIdx] += calls;
+            batchSizeStatistics.calls += calls;
+          }
+          batchSizeStatistics.totalLatency += std::chrono::nanoseconds{
+              batchSizeCounters.totalLatencyNs.load(std::memory_order_relaxed)};
+        }
+      }
+    }
+
+    // Aggregate durations over all batch sizes.
+    for (MethodStatistics& statistics : aggregated.methods) {
+      for (const BatchSizeStatistics& batchSizeStatistics : statistics.batchSizes) {
+        statistics.calls += batchSizeStatistics.calls;
+        for (std::size_t bucketIdx = 0; bucketIdx < statistics.latencyBuckets.size();
+             ++bucketIdx) {
+          statistics.latencyBuckets[bucketIdx] += batchSizeStatistics.latencyBuckets[bucketIdx];
+        }
+        statistics.totalLatency += batchSizeStatistics.totalLatency;
+      }
+    }
+    return aggregated;
+  }
+
+ private:
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+const ManagerMetrics::MethodStatistics& ManagerMetrics::Snapshot::at(const Method method) const {
+  return methods.at(static_cast<std::size_t>(method));
+}
+
+ManagerMetrics::Snapshot ManagerMetrics::Snapshot::since(const Snapshot& earlier) const {
+  Snapshot interval{};
+  for (std::size_t methodIdx = 0; methodIdx < methods.size(); ++methodIdx) {
+    const MethodStatistics& later = methods[methodIdx];
+    const MethodStatistics& before = earlier.methods[methodIdx];
+    MethodStatistics& statistics = interval.methods[methodIdx];
+
+    statistics.calls = later.calls - before.calls;
+    statistics.exceptions = later.exceptions - before.exceptions;
+    statistics.successes = later.successes - before.successes;
+    statistics.errors = difference(later.errors, before.errors);
+    statistics.latencyBuckets = difference(later.latencyBuckets, before.latencyBuckets);
+    statistics.totalLatency = later.totalLatency - before.totalLatency;
+    for (std::size_t sizeIdx = 0; sizeIdx < statistics.batchSizes.size(); ++sizeIdx) {
+      const BatchSizeStatistics& laterBatchSize = later.batchSizes[sizeIdx];
+      const BatchSizeStatistics& beforeBatchSize = before.batchSizes[sizeIdx];
+      BatchSizeStatistics& batchSizeStatistics = statistics.batchSizes[sizeIdx];
+
+      batchSizeStatistics.calls = laterBatchSize.calls - beforeBatchSize.calls;
+      batchSizeStatistics.latencyBuckets =
+          difference(laterBatchSize.latencyBuckets, beforeBatchSize.latencyBuckets);
+      batchSizeStatistics.totalLatency =
+          laterBatchSize.totalLatency - beforeBatchSize.totalLatency;
+    }
+  }
+  return interval;
+}
+
+ManagerMetricsPtr ManagerMetrics::make(const std::size_t shardCount) {
+  if (shardCount == 0) {
+    throw errors::InputValidationException{"ManagerMetrics shard count must be non-zero"};
+  }
+  return std::shared_ptr<ManagerMetrics>(new ManagerMetrics(shardCount));
+}
+
+ManagerMetrics::ManagerMetrics(const std::size_t shardCount)
+    : impl_{std::make_unique<Impl>(shardCount)} {}
+
+ManagerMetrics::~ManagerMetrics() = default;
+
+std::size_t ManagerMetrics::errorCodeIndex(const errors::BatchElementError::ErrorCode code) {
+  const std::size_t codeIdx =
+      static_cast<std::size_t>(code) - static_cast<std::size_t>(ErrorCode::kUnknown);
+  // Out-of-range codes wrap around to large values.
+  return codeIdx < kErrorCodeCount ? codeIdx : 0;
+}
+
+std::size_t ManagerMetrics::batchSizeBucketIndex(const std::size_t batchSize) {
+  std::size_t bucketIndex = 0;
+  while (bucketIndex < kBatchSizeBucketCount &&
+         batchSize > batchSizeBucketUpperBound(bucketIndex)) {
+    ++bucketIndex;
+  }
+  return bucketIndex;
+}
+
+std::chrono::nanoseconds ManagerMetrics::latencyQuantile(const LatencyBuckets& latencyBuckets,
+                                                         const double quantile) {
+  if (!(quantile >= 0.0 && quantile <= 1.0)) {
+    throw errors::InputValidationException{
+        fmt::format("Latency quantile must be in the range [0, 1], got {}", quantile)};
+  }
+  std::uint64_t calls = 0;
+  for (const std::uint64_t bucketCalls : latencyBuckets) {
+    calls += bucketCalls;
+  }
+  if (calls == 0) {
+    return std::chrono::nanoseconds{0};
+  }
+  // Rank of the call at the quantile, counting from one.
+  const double exactRank = std::ceil(quantile * static_cast<double>(calls));
+  const auto rank = std::max(std::uint64_t{1}, static_cast<std::uint64_t>(exactRank));
+
+  std::uint64_t cumulative = 0;
+  for (std::size_t bucketIdx = 0; bucketIdx < kLatencyBucketCount; ++bucketIdx) {
+    cumulative += latencyBuckets[bucketIdx];
+    if (cumulative >= rank) {
+      return latencyBucketUpperBound(bucketIdx);
+    }
+  }
+  return latencyBucketUpperBound(kLatencyBucketCount - 1);
+}
+
+void ManagerMetrics::record(const Method method, const std::chrono::nanoseconds latency,
+                            const std::uint64_t successes, const ErrorCounts& errors,
+                            const bool raisedException, const std::size_t batchSize) {
+  impl_->record(method, latency, successes, errors, raisedException, batchSize);
+}
+
+ManagerMetrics::Snapshot ManagerMetrics::snapshot() const { return impl_->snapshot(); }
+
+Str ManagerMetrics::toPrometheusText(const Snapshot& snapshot,
+                                     const Identifier& managerIdentifier) {
+  using Seconds = std::chrono::duration<double>;
+  const std::string manager = escapeLabelValue(managerIdentifier);
+
+  fmt::memory_buffer text;
+  auto out = std::back_inserter(text);
+
+  // Write a metric family, with a sample per called method, using the
+  // given function to write the sample(s) for a method.
+  const auto writeFamily = [&](const std::string_view name, const std::string_view type,
+                               const std::string_view help, const auto& writeSamples) {
+    fmt::format_to(out, "# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+    for (std::size_t methodIdx = 0; methodIdx < kMethodNames.size(); ++methodIdx) {
+      const MethodStatistics& statistics = snapshot.methods[methodIdx];
+      if (statistics.calls == 0) {
+        continue;
+      }
+      const std::string labels =
+          fmt::format(R"(manager="{}",method="{}")", manager, kMethodNames[methodIdx]);
+      writeSamples(name, labels, statistics);
+    }
+  };
+
+  writeFamily("openassetio_manager_calls_total", "counter", "Number of Manager API calls.",
+              [&](auto name, const auto& labels, const MethodStatistics& statistics) {
+                fmt::format_to(out, "{}{{{}}} {}\n", name, labels, statistics.calls);
+              });
+
+  writeFamily("openassetio_manager_call_exceptions_total", "counter",
+              "Number of Manager API calls that failed with an exception.",
+              [&](auto name, const auto& labels, const MethodStatistics& statistics) {
+                fmt::format_to(out, "{}{{{}}} {}\n", name, labels, statistics.exceptions);
+              });
+
+  writeFamily("openassetio_manager_elements_total", "counter",
+              "Number of batch elements processed by Manager API calls, by outcome.",
+              [&](auto name, const auto& labels, const MethodStatistics& statistics) {
+                fmt::format_to(out, "{}{{{},outcome=\"success\"}} {}\n", name, labels,
+                               statistics.successes);
+                for (std::size_t codeIdx = 0; codeIdx < kErrorCodeCount; ++codeIdx) {
+                  fmt::format_to(out, "{}{{{},outcome=\"{}\"}} {}\n", name, labels,
+                                 kErrorCodeNames[codeIdx], statistics.errors[codeIdx]);
+                }
+              });
+
+  writeFamily(
+      "openassetio_manager_call_duration_seconds", "histogram",
+      "Duration of Manager API calls.",
+      [&](auto name, const auto& labels, const MethodStatistics& statistics) {
+        std::uint64_t cumulative = 0;
+        for (std::size_t bucketIdx = 0; bucketIdx < kLatencyBucketCount; ++bucketIdx) {
+          cumulative += statistics.latencyBuckets[bucketIdx];
+          fmt::format_to(out, "{}_bucket{{{},le=\"{}\"}} {}\n", name, labels,
+                         Seconds{latencyBucketUpperBound(bucketIdx)}.count(), cumulative);
+        }
+        cumulative += statistics.latencyBuckets[kLatencyBucketCount];
+        fmt::format_to(out, "{}_bucket{{{},le=\"+Inf\"}} {}\n", name, labels, cumulative);
+        fmt::format_to(out, "{}_sum{{{}}} {}\n", name, labels,
+                       Seconds{statistics.totalLatency}.count());
+        fmt::format_to(out, "{}_count{{{}}} {}\n", name, labels, cumulative);
+      });
+
+  return fmt::to_string(text);
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
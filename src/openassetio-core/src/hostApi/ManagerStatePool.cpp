@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "ManagerStatePool.hpp"
+
+#include <utility>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+ManagerStatePool::ManagerStatePool(const std::size_t capacity) : capacity_{capacity} {}
+
+managerApi::ManagerStateBasePtr ManagerStatePool::acquire() {
+  const std::lock_guard lock{mutex_};
+  if (states_.empty()) {
+    return nullptr;
+  }
+  managerApi::ManagerStateBasePtr state = std::move(states_.back());
+  states_.pop_back();
+  return state;
+}
+
+managerApi::ManagerStateBasePtr ManagerStatePool::lease(managerApi::ManagerStateBasePtr state) {
+  if (!state) {
+    return state;
+  }
+  managerApi::ManagerStateBase* const rawState = state.get();
+  return managerApi::ManagerStateBasePtr{
+      rawState, [pool = weak_from_this(), state = std::move(state)](
+                    managerApi::ManagerStateBase*) mutable {
+        if (const std::shared_ptr<ManagerStatePool> strongPool = pool.lock()) {
+          strongPool->release(std::move(state));
+        }
+      }};
+}
+
+void ManagerStatePool::clear() {
+  std::vector<managerApi::ManagerStateBasePtr> states;
+  {
+    const std::lock_guard lock{mutex_};
+    states.swap(states_);
+  }
+  // States are destroyed here, outside of the lock.
+}
+
+void ManagerStatePool::release(managerApi::ManagerStateBasePtr state) {
+  {
+    const std::lock_guard lock{mutex_};
+    if (states_.size() < capacity_) {
+      states_.push_back(std::move(state));
+      return;
+    }
+  }
+  // Pool is full, so the state is destroyed here, outside of the lock.
+}
+
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Bounded, thread-safe pool of manager states, for reuse by new
+ * Contexts.
+ *
+ * States are leased out wrapped in a `shared_ptr` whose deleter
+ * returns the state to the pool, rather than destroying it, once the
+ * last reference is released. Once full, further released states are
+ * destroyed. If the pool itself has been destroyed by then, states are
+ * simply destroyed.
+ */
+class ManagerStatePool : public std::enable_shared_from_this<ManagerStatePool> {
+ public:
+  explicit ManagerStatePool(std::size_t capacity);
+
+  /// @return A released state, if any, which is removed from the pool.
+  managerApi::ManagerStateBasePtr acquire();
+
+  /// Wrap a state such that it is returned to the pool on release.
+  managerApi::ManagerStateBasePtr lease(managerApi::ManagerStateBasePtr state);
+
+  /// Discard all released states.
+  void clear();
+
+ private:
+  void release(managerApi::ManagerStateBasePtr state);
+
+  const std::size_t capacity_;
+  std::mutex mutex_;
+  std::vector<managerApi::ManagerStateBasePtr> states_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerTrafficReplayer.hpp>
+
+#include "managerTraffic.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+using Clock = std::chrono::steady_clock;
+using managerTraffic::Bytes;
+using managerTraffic::Decoder;
+using managerTraffic::Method;
+
+[[noreturn]] void throwInvalidLog(const Str& logPath, const std::string_view reason) {
+  Str msg = "ManagerTrafficReplayer: '";
+  msg += logPath;
+  msg += "' is not a valid manager traffic log: ";
+  msg += reason;
+  throw errors::InputValidationException{msg};
+}
+
+/// Read exactly `size` bytes, returning false if the stream is
+/// exhausted before the first byte, and throwing if it is exhausted
+/// part way through.
+bool readExactly(std::ifstream& stream, std::byte* data, const std::size_t size,
+                 const Str& logPath) {
+  stream.read(reinterpret_cast<char*>(data),  // NOLINT(*-reinterpret-cast)
+              static_cast<std::streamsize>(size));
+  const auto count = static_cast<std::size_t>(stream.gcount());
+  if (count == size) {
+    return true;
+  }
+  if (count == 0) {
+    return false;
+  }
+  throwInvalidLog(logPath, "record is truncated");
+}
+
+/// Invoke `func`, adding its duration and whether it raised to
+/// `report`.
+template <class Func>
+void timed(ManagerTrafficReplayer::MethodReport& report, const Func& func) {
+  ++report.calls;
+  const Clock::time_point start = Clock::now();
+  try {
+    func();
+  } catch (const std::exception&) {
+    ++report.exceptions;
+  }
+  report.replayedDuration += Clock::now() - start;
+}
+}  // namespace
+
+ManagerTrafficReplayerPtr ManagerTrafficReplayer::make(ManagerPtr manager, const double rate,
+                                                       const bool replayPublishing) {
+  if (!manager) {
+    throw errors::InputValidationException{"ManagerTrafficReplayer: Manager cannot be null"};
+  }
+  if (!(rate >= 0)) {
+    throw errors::InputValidationException{"ManagerTrafficReplayer: Rate cannot be negative"};
+  }
+  return ManagerTrafficReplayerPtr{
+      new ManagerTrafficReplayer{std::move(manager), rate, replayPublishing}};
+}
+
+ManagerTrafficReplayer::ManagerTrafficReplayer(ManagerPtr manager, const double rate,
+                                               const bool replayPublishing)
+    : manager_{std::move(manager)}, rate_{rate}, replayPublishing_{replayPublishing} {}
+
+ManagerTrafficReplayer::Report ManagerTrafficReplayer::replay(const Str& logPath) const {
+  std::ifstream stream{logPath, std::ios::in | std::ios::binary};
+  if (!stream) {
+    Str msg = "ManagerTrafficReplayer: Could not open '";
+    msg += logPath;
+    msg += "' for reading.";
+    throw errors::InputValidationException{msg};
+  }
+
+  std::array<std::byte, managerTraffic::kHeaderSize> header{};
+  if (!readExactly(stream, header.data(), header.size(), logPath)) {
+    throwInvalidLog(logPath, "header is missing");
+  }
+  Decoder headerDecoder{header.data(), header.size()};
+  for (const char chr : managerTraffic::kMagic) {
+    if (headerDecoder.readUInt<std::uint8_t>() != static_cast<std::uint8_t>(chr)) {
+      throwInvalidLog(logPath, "header is invalid");
+    }
+  }
+  if (headerDecoder.readUInt<std::uint16_t>() != managerTraffic::kFormatVersion) {
+    throwInvalidLog(logPath, "format version is unsupported");
+  }
+
+  Report report;
+  std::unordered_map<std::uint32_t, ContextConstPtr> contexts;
+  Bytes record;
+
+  const Clock::time_point replayStart = Clock::now();
+  std::array<std::byte, sizeof(std::uint32_t)> lengthBytes{};
+  while (readExactly(stream, lengthBytes.data(), lengthBytes.size(), logPath)) {
+    record.resize(Decoder{lengthBytes.data(), lengthBytes.size()}.readLength());
+    if (!readExactly(stream, record.data(), record.size(), logPath) && !record.empty()) {
+      throwInvalidLog(logPath, "record is truncated");
+    }
+    Decoder decoder{record.data(), record.size()};
+
+    const auto kind = decoder.readEnum<managerTraffic::RecordKind>();
+    if (kind == managerTraffic::RecordKind::kContext) {
+      const auto contextId = decoder.readUInt<std::uint32_t>();
+      ContextPtr context = manager_->createContext();
+      if (trait::TraitsDataPtr locale = decoder.readTraitsData()) {
+        context->locale = std::move(locale);
+      }
+      contexts.insert_or_assign(contextId, std::move(context));
+      continue;
+    }
+    if (kind != managerTraffic::RecordKind::kCall) {
+      throwInvalidLog(logPath, "record kind is unknown");
+    }
+
+    const auto method = decoder.readEnum<Method>();
+    if (method >= Method::kCount) {
+      throwInvalidLog(logPath, "method is unknown");
+    }
+    [[maybe_unused]] const auto flags = decoder.readUInt<std::uint8_t>();
+    const auto start = std::chrono::nanoseconds{decoder.readUInt<std::uint64_t>()};
+    const auto duration = std::chrono::nanoseconds{decoder.readUInt<std::uint64_t>()};
+    const auto contextId = decoder.readUInt<std::uint32_t>();
+    [[maybe_unused]] const auto elementCount = decoder.readUInt<std::uint32_t>();
+
+    ContextConstPtr context;
+    if (contextId != 0) {
+      const auto contextIter = contexts.find(contextId);
+      if (contextIter == contexts.end()) {
+        throwInvalidLog(logPath, "call refers to an unknown context");
+      }
+      context = contextIter->second;
+    }
+
+    MethodReport& methodReport =
+        report[Str{managerTraffic::kMethodNames[static_cast<std::size_t>(method)]}];
+    if (!replayPublishing_ && (method == Method::kPreflight || method == Method::kRegister)) {
+      ++methodReport.skipped;
+      continue;
+    }
+
+    if (rate_ > 0) {
+      std::this_thread::sleep_until(
+          replayStart + std::chrono::duration_cast<Clock::duration>(
+                            std::chrono::duration<double, std::nano>{
+                                static_cast<double>(start.count()) / rate_}));
+    }
+    methodReport.recordedDuration += duration;
+
+    const auto onSuccess = [&methodReport](std::size_t, const auto&) {
+      ++methodReport.successes;
+    };
+    const auto onError = [&methodReport](std::size_t, const errors::BatchElementError&) {
+      ++methodReport.errors;
+    };
+
+    // Arguments are decoded before each call is timed, so that a
+    // malformed record is reported rather than counted as an exception.
+    switch (method) {
+      case Method::kManagementPolicy: {
+        const trait::TraitSets traitSets = decoder.readTraitSets();
+        const auto policyAccess = decoder.readEnum<access::PolicyAccess>();
+        timed(methodReport, [&] {
+          methodReport.successes +=
+              manager_->managementPolicy(traitSets, policyAccess, context).size();
+        });
+        break;
+      }
+      case Method::kEntityExists: {
+        const EntityReferences entityReferences = decoder.readEntityReferences();
+        timed(methodReport, [&] {
+          manager_->entityExists(entityReferences, context, onSuccess, onError);
+        });
+        break;
+      }
+      case Method::kEntityTraits: {
+        const EntityReferences entityReferences = decoder.readEntityReferences();
+        const auto entityTraitsAccess = decoder.readEnum<access::EntityTraitsAccess>();
+        timed(methodReport, [&] {
+          manager_->entityTraits(entityReferences, entityTraitsAccess, context, onSuccess,
+                                 onError);
+        });
+        break;
+      }
+      case Method::kResolve: {
+        const EntityReferences entityReferences = decoder.readEntityReferences();
+        const trait::TraitSet traitSet = decoder.readTraitSet();
+        const auto resolveAccess = decoder.readEnum<access::ResolveAccess>();
+        timed(methodReport, [&] {
+          manager_->resolve(entityReferences, traitSet, resolveAccess, context, onSuccess,
+                            onError);
+        });
+        break;
+      }
+      case Method::kDefaultEntityReference: {
+        const trait::TraitSets traitSets = decoder.readTraitSets();
+        const auto defaultEntityAccess = decoder.readEnum<access::DefaultEntityAccess>();
+        timed(methodReport, [&] {
+          manager_->defaultEntityReference(traitSets, defaultEntityAccess, context, onSuccess,
+                                           onError);
+        });
+        break;
+      }
+      case Method::kGetWithRelationship: {
+        const EntityReferences entityReferences = decoder.readEntityReferences();
+        const trait::TraitsDataPtr relationshipTraitsData = decoder.readTraitsData();
+        const trait::TraitSet resultTraitSet = decoder.readTraitSet();
+        const std::size_t pageSize = decoder.readUInt<std::uint64_t>();
+        const auto relationsAccess = decoder.readEnum<access::RelationsAccess>();
+        timed(methodReport, [&] {
+          manager_->getWithRelationship(entityReferences, relationshipTraitsData, pageSize,
+                                        relationsAccess, context, onSuccess, onError,
+                                        resultTraitSet);
+        });
+        break;
+      }
+      case Method::kGetWithRelationships: {
+        const EntityReference entityReference{Str{decoder.readStr()}};
+        const trait::TraitsDatas relationshipTraitsDatas = decoder.readTraitsDatas();
+        const trait::TraitSet resultTraitSet = decoder.readTraitSet();
+        const std::size_t pageSize = decoder.readUInt<std::uint64_t>();
+        const auto relationsAccess = decoder.readEnum<access::RelationsAccess>();
+        timed(methodReport, [&] {
+          manager_->getWithRelationships(entityReference, relationshipTraitsDatas, pageSize,
+                                         relationsAccess, context, onSuccess, onError,
+                                         resultTraitSet);
+        });
+        break;
+      }
+      case Method::kGetWithRelationshipsMatrix: {
+        const EntityReferences entityReferences = decoder.readEntityReferences();
+        const trait::TraitsDatas relationshipTraitsDatas = decoder.readTraitsDatas();
+        const trait::TraitSet resultTraitSet = decoder.readTraitSet();
+        const std::size_t pageSize = decoder.readUInt<std::uint64_t>();
+        const auto relationsAccess = decoder.readEnum<access::RelationsAccess>();
+        timed(methodReport, [&] {
+          manager_->getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                               pageSize, relationsAccess, context, onSuccess,
+                                               onError, resultTraitSet);
+        });
+        break;
+      }
+      case Method::kPreflight: {
+        const EntityReferences entityReferences = decoder.readEntityReferences();
+        const trait::TraitsDatas traitsHints = decoder.readTraitsDatas();
+        const auto publishingAccess = decoder.readEnum<access::PublishingAccess>();
+        timed(methodReport, [&] {
+          manager_->preflight(entityReferences, traitsHints, publishingAccess, context,
+                              onSuccess, onError);
+        });
+        break;
+      }
+      case Method::kRegister: {
+        const EntityReferences entityReferences = decoder.readEntityReferences();
+        const trait::TraitsDatas entityTraitsDatas = decoder.readTraitsDatas();
+        const auto publishingAccess = decoder.readEnum<access::PublishingAccess>();
+        timed(methodReport, [&] {
+          manager_->register_(entityReferences, entityTraitsDatas, publishingAccess, context,
+                              onSuccess, onError);
+        });
+        break;
+      }
+      case Method::kCount:
+        break;
+    }
+  }
+  return report;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
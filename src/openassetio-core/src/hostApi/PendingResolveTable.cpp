@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "PendingResolveTable.hpp"
+
+#include <utility>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+PendingResolveTable::Entry::Entry(ResolveCacheKey key) : key_{std::move(key)} {}
+
+PendingResolveTable::Outcome PendingResolveTable::Entry::wait() {
+  std::unique_lock lock{mutex_};
+  completed_.wait(lock, [this] { return isComplete_; });
+  return outcome_;
+}
+
+PendingResolveTable::Claim PendingResolveTable::claim(ResolveCacheKey key) {
+  const std::lock_guard lock{mutex_};
+  if (const auto iter = entries_.find(key); iter != entries_.end()) {
+    return {iter->second, false};
+  }
+  auto entry = std::make_shared<Entry>(key);
+  entries_.emplace(std::move(key), entry);
+  return {std::move(entry), true};
+}
+
+void PendingResolveTable::complete(const EntryPtr& entry, Outcome outcome) {
+  {
+    const std::lock_guard lock{mutex_};
+    if (const auto iter = entries_.find(entry->key_);
+        iter != entries_.end() && iter->second == entry) {
+      entries_.erase(iter);
+    }
+  }
+  {
+    const std::lock_guard lock{entry->mutex_};
+    if (entry->isComplete_) {
+      return;
+    }
+    entry->isComplete_ = true;
+    entry->outcome_ = std::move(outcome);
+  }
+  entry->completed_.notify_all();
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
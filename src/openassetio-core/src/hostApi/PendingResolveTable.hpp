@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <variant>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "ResolveCacheKey.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Thread-safe table of resolves in flight, such that concurrent
+ * requests for the same key can wait on a single fetch, rather than
+ * each forwarding to the manager plugin.
+ *
+ * The first caller to @ref claim a key owns its entry, and must
+ * @ref complete it once the result is known, or the fetch is
+ * abandoned. Subsequent callers may wait on the entry until then.
+ */
+class PendingResolveTable {
+ public:
+  /// Result of a fetch, or empty if it was abandoned.
+  using Outcome = std::optional<std::variant<errors::BatchElementError, trait::TraitsDataPtr>>;
+
+  /// A fetch in flight.
+  class Entry {
+   public:
+    explicit Entry(ResolveCacheKey key);
+
+    /// Block until the entry is completed. @return Its outcome.
+    [[nodiscard]] Outcome wait();
+
+   private:
+    friend class PendingResolveTable;
+
+    const ResolveCacheKey key_;
+    std::mutex mutex_;
+    std::condition_variable completed_;
+    bool isComplete_ = false;
+    Outcome outcome_;
+  };
+  using EntryPtr = std::shared_ptr<Entry>;
+
+  /// Entry for a key, and whether the caller owns it.
+  struct Claim {
+    EntryPtr entry;
+    bool isOwner;
+  };
+
+  /**
+   * Claim the entry for a key, creating it if there is none in flight.
+   *
+   * @return The entry, owned by the caller if newly created.
+   */
+  [[nodiscard]] Claim claim(ResolveCacheKey key);
+
+  /**
+   * Complete an owned entry, removing it from the table and waking any
+   * waiters. Entries that are already complete are ignored.
+   */
+  void complete(const EntryPtr& entry, Outcome outcome);
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<ResolveCacheKey, EntryPtr, ResolveCacheKeyHash> entries_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "PersistenceTokenCache.hpp"
+
+#include <iterator>
+
+#include "../internal/footprint.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+PersistenceTokenCache::PersistenceTokenCache(const std::size_t capacity) : capacity_{capacity} {}
+
+managerApi::ManagerStateBasePtr PersistenceTokenCache::lookupState(const Str& token) {
+  const std::lock_guard lock{mutex_};
+  const auto iter = tokenIndex_.find(token);
+  if (iter == tokenIndex_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, iter->second);
+  return iter->second->second;
+}
+
+std::optional<Str> PersistenceTokenCache::lookupToken(
+    const managerApi::ManagerStateBaseConstPtr& state) {
+  const std::lock_guard lock{mutex_};
+  const auto iter = stateIndex_.find(state.get());
+  if (iter == stateIndex_.end()) {
+    return std::nullopt;
+  }
+  entries_.splice(entries_.begin(), entries_, iter->second);
+  return iter->second->first;
+}
+
+managerApi::ManagerStateBasePtr PersistenceTokenCache::insert(
+    const Str& token, managerApi::ManagerStateBasePtr state) {
+  Entries evicted;
+  const std::lock_guard lock{mutex_};
+  if (const auto iter = tokenIndex_.find(token); iter != tokenIndex_.end()) {
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    return iter->second->second;
+  }
+
+  while (entries_.size() >= capacity_) {
+    tokenIndex_.erase(entries_.back().first);
+    stateIndex_.erase(entries_.back().second.get());
+    // Defer destruction of evicted states until the lock is released.
+    evicted.splice(evicted.begin(), entries_, std::prev(entries_.end()));
+  }
+
+  entries_.emplace_front(token, std::move(state));
+  tokenIndex_.emplace(token, entries_.begin());
+  stateIndex_.emplace(entries_.front().second.get(), entries_.begin());
+  return entries_.front().second;
+}
+
+void PersistenceTokenCache::clear() {
+  Entries entries;
+  {
+    const std::lock_guard lock{mutex_};
+    tokenIndex_.clear();
+    stateIndex_.clear();
+    entries.swap(entries_);
+  }
+}
+
+std::size_t PersistenceTokenCache::memoryUsage() {
+  namespace footprint = internal::footprint;
+  const std::lock_guard lock{mutex_};
+  std::size_t bytes = sizeof(PersistenceTokenCache) + footprint::hashTableBytes(tokenIndex_) +
+                      footprint::hashTableBytes(stateIndex_);
+  // Tokens are held by both the entries and the token index.
+  for (const auto& [token, state] : entries_) {
+    bytes += footprint::listNodeBytes<Entries::value_type>() + 2 * footprint::heapBytes(token);
+  }
+  return bytes;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
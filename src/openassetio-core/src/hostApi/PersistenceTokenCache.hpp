@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include <openassetio/export.h>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Bounded, thread-safe memo of manager states restored from
+ * persistence tokens.
+ *
+ * States are retained, so that Contexts restored from the same token
+ * share the same state, and can be mapped back to their token without
+ * a further round-trip to the manager. Once full, the least recently
+ * used entries are evicted.
+ */
+class PersistenceTokenCache {
+ public:
+  explicit PersistenceTokenCache(std::size_t capacity);
+
+  /// @return Cached state for the token, or `nullptr` if not cached.
+  managerApi::ManagerStateBasePtr lookupState(const Str& token);
+
+  /// @return Token the cached state was restored from, if any.
+  std::optional<Str> lookupToken(const managerApi::ManagerStateBaseConstPtr& state);
+
+  /**
+   * Cache a state restored from a token.
+   *
+   * @return The cached state, which is an existing state if another
+   * thread cached one for the same token first.
+   */
+  managerApi::ManagerStateBasePtr insert(const Str& token, managerApi::ManagerStateBasePtr state);
+
+  /// Discard all entries.
+  void clear();
+
+  /**
+   * @return Approximate number of bytes used by this cache, excluding
+   * the (opaque) cached states.
+   */
+  [[nodiscard]] std::size_t memoryUsage();
+
+ private:
+  using Entries = std::list<std::pair<Str, managerApi::ManagerStateBasePtr>>;
+
+  const std::size_t capacity_;
+  std::mutex mutex_;
+  Entries entries_;
+  std::unordered_map<Str, Entries::iterator> tokenIndex_;
+  // Cached states are kept alive by the entries, so their addresses
+  // are unique for as long as they are indexed.
+  std::unordered_map<const managerApi::ManagerStateBase*, Entries::iterator> stateIndex_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/PublishingSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+/**
+ * State shared with in-flight manager calls, which may outlive the
+ * session.
+ */
+struct State {
+  State(ManagerPtr managerIn, const access::PublishingAccess publishingAccessIn,
+        ContextConstPtr contextIn, const std::size_t chunkSizeIn)
+      : manager{std::move(managerIn)},
+        publishingAccess{publishingAccessIn},
+        context{std::move(contextIn)},
+        chunkSize{chunkSizeIn} {}
+
+  const ManagerPtr manager;
+  const access::PublishingAccess publishingAccess;
+  const ContextConstPtr context;
+  const std::size_t chunkSize;
+
+  std::mutex mutex;
+  /// Signalled when a registration batch completes.
+  std::condition_variable completed;
+  std::size_t inFlightCount = 0;
+  std::vector<PublishingSession::Element> results;
+  std::exception_ptr exception;
+};
+
+/// Entities queued for registration as a single batch.
+struct RegisterBatch {
+  std::vector<std::size_t> indices;
+  EntityReferences entityReferences;
+  trait::TraitsDatas entityTraitsDatas;
+};
+
+/// A preflight batch, issued to the manager in chunks.
+struct PreflightBatch {
+  EntityReferences entityReferences;
+  trait::TraitsDatas traitsHints;
+  /// Set once the consumer has destroyed the stream.
+  std::atomic<bool> isAbandoned{false};
+};
+
+using Writer = BatchResultStream<EntityReference>::Writer;
+
+/**
+ * Preflight the chunk of the batch starting at `offset`, then, once
+ * complete, the following chunk, and so on.
+ */
+void preflightFrom(const std::shared_ptr<State>& state,
+                   const std::shared_ptr<PreflightBatch>& batch, const std::size_t offset,
+                   const Writer& writer) {
+  const std::size_t size = batch->entityReferences.size();
+  if (offset >= size || batch->isAbandoned.load(std::memory_order_relaxed)) {
+    writer.close();
+    return;
+  }
+  const std::size_t end = std::min(offset + state->chunkSize, size);
+  const auto first = static_cast<std::ptrdiff_t>(offset);
+  const auto last = static_cast<std::ptrdiff_t>(end);
+  const EntityReferences entityReferences{batch->entityReferences.begin() + first,
+                                          batch->entityReferences.begin() + last};
+  const trait::TraitsDatas traitsHints{batch->traitsHints.begin() + first,
+                                       batch->traitsHints.begin() + last};
+
+  const auto write = [batch, writer, offset](const std::size_t idx, auto result) {
+    if (!writer.write(offset + idx, std::move(result))) {
+      batch->isAbandoned.store(true, std::memory_order_relaxed);
+    }
+  };
+  try {
+    state->manager->preflightAsync(
+        entityReferences, traitsHints, state->publishingAccess, state->context,
+        [write](const std::size_t idx, EntityReference entityReference) {
+          write(idx, std::move(entityReference));
+        },
+        [write](const std::size_t idx, errors::BatchElementError error) {
+          write(idx, std::move(error));
+        },
+        [state, batch, end, writer](std::exception_ptr exception) {
+          if (exception) {
+            writer.close(std::move(exception));
+            return;
+          }
+          preflightFrom(state, batch, end, writer);
+        });
+  } catch (...) {
+    writer.close(std::current_exception());
+  }
+}
+
+/// Register a batch asynchronously, collecting its results.
+void dispatchRegister(const std::shared_ptr<State>& state, RegisterBatch batch) {
+  auto indices = std::make_shared<const std::vector<std::size_t>>(std::move(batch.indices));
+  const auto record = [state, indices](const std::size_t idx, auto result) {
+    const std::lock_guard lock{state->mutex};
+    state->results.emplace_back((*indices)[idx], std::move(result));
+  };
+  const auto complete = [state](std::exception_ptr exception) {
+    const std::lock_guard lock{state->mutex};
+    if (exception && !state->exception) {
+      state->exception = std::move(exception);
+    }
+    --state->inFlightCount;
+    state->completed.notify_all();
+  };
+  try {
+    state->manager->registerAsync(
+        batch.entityReferences, batch.entityTraitsDatas, state->publishingAccess,
+        state->context,
+        [record](const std::size_t idx, EntityReference entityReference) {
+          record(idx, std::move(entityReference));
+        },
+        [record](const std::size_t idx, errors::BatchElementError error) {
+          record(idx, std::move(error));
+        },
+        complete);
+  } catch (...) {
+    complete(std::current_exception());
+  }
+}
+}  // namespace
+
+class PublishingSession::Impl {
+ public:
+  Impl(ManagerPtr manager, const access::PublishingAccess publishingAccess,
+       ContextConstPtr context, const std::size_t chunkSize)
+      : state_{std::make_shared<State>(std::move(manager), publishingAccess, std::move(context),
+                                       chunkSize)} {}
+
+  BatchResultStream<EntityReference> preflight(const EntityReferences& entityReferences,
+                                               const trait::TraitsDatas& traitsHints,
+                                               const std::size_t bufferSize) {
+    if (entityReferences.size() != traitsHints.size()) {
+      throw errors::InputValidationException{
+          "PublishingSession: Parameter lists must be of the same length: " +
+          std::to_string(entityReferences.size()) + " entity references vs. " +
+          std::to_string(traitsHints.size()) + " traits hints."};
+    }
+    BatchResultStream<EntityReference> stream{bufferSize};
+    auto batch = std::make_shared<PreflightBatch>();
+    batch->entityReferences = entityReferences;
+    batch->traitsHints = traitsHints;
+    preflightFrom(state_, batch, 0, stream.writer());
+    return stream;
+  }
+
+  void register_(const std::size_t index, const EntityReference& workingReference,
+                 const trait::TraitsDataPtr& entityTraitsData) {
+    RegisterBatch batch;
+    {
+      const std::lock_guard lock{state_->mutex};
+      pending_.indices.push_back(index);
+      pending_.entityReferences.push_back(workingReference);
+      pending_.entityTraitsDatas.push_back(entityTraitsData);
+      if (pending_.indices.size() < state_->chunkSize) {
+        return;
+      }
+      batch = std::exchange(pending_, {});
+      ++state_->inFlightCount;
+    }
+    dispatchRegister(state_, std::move(batch));
+  }
+
+  std::vector<Element> finish() {
+    RegisterBatch batch;
+    {
+      const std::lock_guard lock{state_->mutex};
+      batch = std::exchange(pending_, {});
+      if (!batch.indices.empty()) {
+        ++state_->inFlightCount;
+      }
+    }
+    if (!batch.indices.empty()) {
+      dispatchRegister(state_, std::move(batch));
+    }
+
+    std::vector<Element> results;
+    {
+      std::unique_lock lock{state_->mutex};
+      state_->completed.wait(lock, [this] { return state_->inFlightCount == 0; });
+      results = std::exchange(state_->results, {});
+      if (std::exception_ptr exception = std::exchange(state_->exception, nullptr)) {
+        std::rethrow_exception(exception);
+      }
+    }
+    std::stable_sort(results.begin(), results.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    return results;
+  }
+
+ private:
+  std::shared_ptr<State> state_;
+  /// Entities awaiting registration, guarded by the state's mutex.
+  RegisterBatch pending_;
+};
+
+PublishingSessionPtr PublishingSession::make(ManagerPtr manager,
+                                             const access::PublishingAccess publishingAccess,
+                                             ContextConstPtr context,
+                                             const std::size_t chunkSize) {
+  if (!manager) {
+    throw errors::InputValidationException{"PublishingSession requires a Manager"};
+  }
+  if (!context) {
+    throw errors::InputValidationException{"PublishingSession requires a Context"};
+  }
+  if (chunkSize == 0) {
+    throw errors::InputValidationException{"PublishingSession chunk size must be non-zero"};
+  }
+  return std::shared_ptr<PublishingSession>(new PublishingSession(
+      std::move(manager), publishingAccess, std::move(context), chunkSize));
+}
+
+PublishingSession::PublishingSession(ManagerPtr manager,
+                                     const access::PublishingAccess publishingAccess,
+                                     ContextConstPtr context, const std::size_t chunkSize)
+    : impl_{std::make_unique<Impl>(std::move(manager), publishingAccess, std::move(context),
+                                   chunkSize)} {}
+
+PublishingSession::~PublishingSession() = default;
+
+BatchResultStream<EntityReference> PublishingSession::preflight(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+    const std::size_t bufferSize) {
+  return impl_->preflight(entityReferences, traitsHints, bufferSize);
+}
+
+void PublishingSession::register_(const std::size_t index,
+                                  const EntityReference& workingReference,
+                                  const trait::TraitsDataPtr& entityTraitsData) {
+  impl_->register_(index, workingReference, entityTraitsData);
+}
+
+std::vector<PublishingSession::Element> PublishingSession::finish() {
+  return impl_->finish();
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,528 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/RecordingManagerInterface.hpp>
+
+#include "managerTraffic.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+using Clock = std::chrono::steady_clock;
+using managerTraffic::Bytes;
+using managerTraffic::Encoder;
+using managerTraffic::Method;
+
+/// Number of context IDs retained before expired contexts are pruned.
+constexpr std::size_t kMinContextPruneThreshold = 1024;
+
+std::uint64_t nanosecondsBetween(const Clock::time_point from, const Clock::time_point until) {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(until - from).count());
+}
+}  // namespace
+
+/// A call in progress.
+struct RecordingManagerInterface::Call {
+  /// Encode the arguments of the call using `encodeArgs`, then start
+  /// timing the call.
+  template <class EncodeArgs>
+  Call(const Method method_, ContextConstPtr context_, const EncodeArgs& encodeArgs)
+      : method{method_}, context{std::move(context_)} {
+    Encoder encoder{&args};
+    encodeArgs(encoder);
+    start = Clock::now();
+  }
+
+  void countElement() { elementCount.fetch_add(1, std::memory_order_relaxed); }
+
+  Method method;
+  ContextConstPtr context;
+  Bytes args;
+  Clock::time_point start;
+  std::atomic<std::uint32_t> elementCount{0};
+};
+
+/// Log file, and the state required to write to it.
+class RecordingManagerInterface::Log {
+ public:
+  explicit Log(std::ofstream stream) : stream_{std::move(stream)}, origin_{Clock::now()} {}
+
+  ~Log() { stream_.flush(); }
+
+  Log(const Log&) = delete;
+  Log(Log&&) noexcept = delete;
+  Log& operator=(const Log&) = delete;
+  Log& operator=(Log&&) noexcept = delete;
+
+  /// Write a record of a call that has just completed.
+  void write(const Call& call, const std::uint8_t flags) {
+    const Clock::time_point end = Clock::now();
+
+    const std::lock_guard lock{mutex_};
+    const std::uint32_t contextId = contextIdFor(call.context);
+
+    record_.clear();
+    Encoder encoder{&record_};
+    encoder.writeEnum(managerTraffic::RecordKind::kCall);
+    encoder.writeEnum(call.method);
+    encoder.writeUInt(flags);
+    encoder.writeUInt(nanosecondsBetween(origin_, call.start));
+    encoder.writeUInt(nanosecondsBetween(call.start, end));
+    encoder.writeUInt(contextId);
+    encoder.writeUInt(call.elementCount.load(std::memory_order_relaxed));
+    record_.insert(record_.end(), call.args.begin(), call.args.end());
+    writeRecord();
+  }
+
+  void flush() {
+    const std::lock_guard lock{mutex_};
+    stream_.flush();
+  }
+
+ private:
+  /// Get the ID of a context, writing a context record if it has not
+  /// been seen before. The mutex must be held.
+  std::uint32_t contextIdFor(const ContextConstPtr& context) {
+    if (!context) {
+      return 0;
+    }
+    // The address of an expired context may be reused, so also check
+    // that the context is the same instance.
+    if (const auto iter = contextIds_.find(context.get());
+        iter != contextIds_.end() && iter->second.first.lock() == context) {
+      return iter->second.second;
+    }
+
+    const std::uint32_t contextId = nextContextId_++;
+    contextIds_.insert_or_assign(context.get(), std::make_pair(context, contextId));
+    if (contextIds_.size() > contextPruneThreshold_) {
+      for (auto iter = contextIds_.begin(); iter != contextIds_.end();) {
+        iter = iter->second.first.expired() ? contextIds_.erase(iter) : std::next(iter);
+      }
+      contextPruneThreshold_ = std::max(kMinContextPruneThreshold, 2 * contextIds_.size());
+    }
+
+    record_.clear();
+    Encoder encoder{&record_};
+    encoder.writeEnum(managerTraffic::RecordKind::kContext);
+    encoder.writeUInt(contextId);
+    encoder.writeTraitsData(context->locale);
+    writeRecord();
+    return contextId;
+  }
+
+  /// Write the length-prefixed record buffer. The mutex must be held.
+  void writeRecord() {
+    Bytes length;
+    Encoder{&length}.writeLength(record_.size());
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    stream_.write(reinterpret_cast<const char*>(length.data()),
+                  static_cast<std::streamsize>(length.size()));
+    stream_.write(reinterpret_cast<const char*>(record_.data()),
+                  static_cast<std::streamsize>(record_.size()));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+  }
+
+  std::mutex mutex_;
+  std::ofstream stream_;
+  const Clock::time_point origin_;
+  /// Reused between records to avoid reallocation.
+  Bytes record_;
+  std::unordered_map<const Context*, std::pair<std::weak_ptr<const Context>, std::uint32_t>>
+      contextIds_;
+  std::uint32_t nextContextId_{1};
+  std::size_t contextPruneThreshold_{kMinContextPruneThreshold};
+};
+
+RecordingManagerInterfacePtr RecordingManagerInterface::make(
+    managerApi::ManagerInterfacePtr proxied, const Str& logPath) {
+  std::ofstream stream{logPath, std::ios::out | std::ios::trunc | std::ios::binary};
+  if (!stream) {
+    Str msg = "RecordingManagerInterface: Could not open '";
+    msg += logPath;
+    msg += "' for writing.";
+    throw errors::InputValidationException{msg};
+  }
+
+  Bytes header;
+  Encoder encoder{&header};
+  for (const char chr : managerTraffic::kMagic) {
+    encoder.writeUInt(static_cast<std::uint8_t>(chr));
+  }
+  encoder.writeUInt(managerTraffic::kFormatVersion);
+  encoder.writeUInt(std::uint16_t{0});
+  stream.write(reinterpret_cast<const char*>(header.data()),  // NOLINT(*-reinterpret-cast)
+               static_cast<std::streamsize>(header.size()));
+
+  return RecordingManagerInterfacePtr{new RecordingManagerInterface{
+      std::move(proxied), std::make_shared<Log>(std::move(stream))}};
+}
+
+RecordingManagerInterface::RecordingManagerInterface(managerApi::ManagerInterfacePtr proxied,
+                                                     std::shared_ptr<Log> log)
+    : ProxyManagerInterface{std::move(proxied)}, log_{std::move(log)} {}
+
+void RecordingManagerInterface::flush() { log_->flush(); }
+
+template <class SuccessCallback, class Func>
+void RecordingManagerInterface::recorded(std::shared_ptr<Call> call,
+                                         const SuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback,
+                                         const Func& func) {
+  const SuccessCallback countingSuccessCallback = [&call = *call, &successCallback](
+                                                      const std::size_t idx, auto value) {
+    call.countElement();
+    successCallback(idx, std::move(value));
+  };
+  const BatchElementErrorCallback countingErrorCallback =
+      [&call = *call, &errorCallback](const std::size_t idx, errors::BatchElementError error) {
+        call.countElement();
+        errorCallback(idx, std::move(error));
+      };
+  try {
+    func(countingSuccessCallback, countingErrorCallback);
+  } catch (...) {
+    log_->write(*call, managerTraffic::kRaisedException);
+    throw;
+  }
+  log_->write(*call, 0);
+}
+
+template <class SuccessCallback, class Func>
+void RecordingManagerInterface::recordedAsync(std::shared_ptr<Call> call,
+                                              SuccessCallback successCallback,
+                                              BatchElementErrorCallback errorCallback,
+                                              CompletionCallback completionCallback,
+                                              const Func& func) {
+  SuccessCallback countingSuccessCallback =
+      [call, successCallback = std::move(successCallback)](const std::size_t idx, auto value) {
+        call->countElement();
+        successCallback(idx, std::move(value));
+      };
+  BatchElementErrorCallback countingErrorCallback =
+      [call, errorCallback = std::move(errorCallback)](const std::size_t idx,
+                                                       errors::BatchElementError error) {
+        call->countElement();
+        errorCallback(idx, std::move(error));
+      };
+  CompletionCallback recordingCompletionCallback =
+      [log = log_, call, completionCallback = std::move(completionCallback)](
+          std::exception_ptr exception) {
+        std::uint8_t flags = managerTraffic::kAsync;
+        if (exception) {
+          flags |= managerTraffic::kRaisedException;
+        }
+        log->write(*call, flags);
+        completionCallback(std::move(exception));
+      };
+  func(std::move(countingSuccessCallback), std::move(countingErrorCallback),
+       std::move(recordingCompletionCallback));
+}
+
+trait::TraitsDatas RecordingManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  Call call{Method::kManagementPolicy, context, [&](Encoder& args) {
+              args.writeTraitSets(traitSets);
+              args.writeEnum(policyAccess);
+            }};
+  trait::TraitsDatas policies;
+  try {
+    policies = proxied()->managementPolicy(traitSets, policyAccess, context, hostSession);
+  } catch (...) {
+    log_->write(call, managerTraffic::kRaisedException);
+    throw;
+  }
+  call.elementCount = static_cast<std::uint32_t>(policies.size());
+  log_->write(call, 0);
+  return policies;
+}
+
+void RecordingManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             const ExistsSuccessCallback& successCallback,
+                                             const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(
+               Method::kEntityExists, context,
+               [&](Encoder& args) { args.writeEntityReferences(entityReferences); }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->entityExists(entityReferences, context, hostSession, success, error);
+           });
+}
+
+void RecordingManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                             const access::EntityTraitsAccess entityTraitsAccess,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             const EntityTraitsSuccessCallback& successCallback,
+                                             const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kEntityTraits, context,
+                                  [&](Encoder& args) {
+                                    args.writeEntityReferences(entityReferences);
+                                    args.writeEnum(entityTraitsAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->entityTraits(entityReferences, entityTraitsAccess, context, hostSession,
+                                     success, error);
+           });
+}
+
+void RecordingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                        const trait::TraitSet& traitSet,
+                                        const access::ResolveAccess resolveAccess,
+                                        const ContextConstPtr& context,
+                                        const managerApi::HostSessionPtr& hostSession,
+                                        const ResolveSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kResolve, context,
+                                  [&](Encoder& args) {
+                                    args.writeEntityReferences(entityReferences);
+                                    args.writeTraitSet(traitSet);
+                                    args.writeEnum(resolveAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                                success, error);
+           });
+}
+
+void RecordingManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kDefaultEntityReference, context,
+                                  [&](Encoder& args) {
+                                    args.writeTraitSets(traitSets);
+                                    args.writeEnum(defaultEntityAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->defaultEntityReference(traitSets, defaultEntityAccess, context,
+                                               hostSession, success, error);
+           });
+}
+
+void RecordingManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kGetWithRelationship, context,
+                                  [&](Encoder& args) {
+                                    args.writeEntityReferences(entityReferences);
+                                    args.writeTraitsData(relationshipTraitsData);
+                                    args.writeTraitSet(resultTraitSet);
+                                    args.writeUInt(static_cast<std::uint64_t>(pageSize));
+                                    args.writeEnum(relationsAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->getWithRelationship(entityReferences, relationshipTraitsData,
+                                            resultTraitSet, pageSize, relationsAccess, context,
+                                            hostSession, success, error);
+           });
+}
+
+void RecordingManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kGetWithRelationships, context,
+                                  [&](Encoder& args) {
+                                    args.writeStr(entityReference.toString());
+                                    args.writeTraitsDatas(relationshipTraitsDatas);
+                                    args.writeTraitSet(resultTraitSet);
+                                    args.writeUInt(static_cast<std::uint64_t>(pageSize));
+                                    args.writeEnum(relationsAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->getWithRelationships(entityReference, relationshipTraitsDatas,
+                                             resultTraitSet, pageSize, relationsAccess, context,
+                                             hostSession, success, error);
+           });
+}
+
+void RecordingManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kGetWithRelationshipsMatrix, context,
+                                  [&](Encoder& args) {
+                                    args.writeEntityReferences(entityReferences);
+                                    args.writeTraitsDatas(relationshipTraitsDatas);
+                                    args.writeTraitSet(resultTraitSet);
+                                    args.writeUInt(static_cast<std::uint64_t>(pageSize));
+                                    args.writeEnum(relationsAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                   resultTraitSet, pageSize, relationsAccess,
+                                                   context, hostSession, success, error);
+           });
+}
+
+void RecordingManagerInterface::preflight(const EntityReferences& entityReferences,
+                                          const trait::TraitsDatas& traitsHints,
+                                          const access::PublishingAccess publishingAccess,
+                                          const ContextConstPtr& context,
+                                          const managerApi::HostSessionPtr& hostSession,
+                                          const PreflightSuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kPreflight, context,
+                                  [&](Encoder& args) {
+                                    args.writeEntityReferences(entityReferences);
+                                    args.writeTraitsDatas(traitsHints);
+                                    args.writeEnum(publishingAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->preflight(entityReferences, traitsHints, publishingAccess, context,
+                                  hostSession, success, error);
+           });
+}
+
+void RecordingManagerInterface::register_(const EntityReferences& entityReferences,
+                                          const trait::TraitsDatas& entityTraitsDatas,
+                                          const access::PublishingAccess publishingAccess,
+                                          const ContextConstPtr& context,
+                                          const managerApi::HostSessionPtr& hostSession,
+                                          const RegisterSuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback) {
+  recorded(std::make_shared<Call>(Method::kRegister, context,
+                                  [&](Encoder& args) {
+                                    args.writeEntityReferences(entityReferences);
+                                    args.writeTraitsDatas(entityTraitsDatas);
+                                    args.writeEnum(publishingAccess);
+                                  }),
+           successCallback, errorCallback, [&](const auto& success, const auto& error) {
+             proxied()->register_(entityReferences, entityTraitsDatas, publishingAccess, context,
+                                  hostSession, success, error);
+           });
+}
+
+void RecordingManagerInterface::entityExistsAsync(const EntityReferences& entityReferences,
+                                                  const ContextConstPtr& context,
+                                                  const managerApi::HostSessionPtr& hostSession,
+                                                  ExistsSuccessCallback successCallback,
+                                                  BatchElementErrorCallback errorCallback,
+                                                  CompletionCallback completionCallback) {
+  recordedAsync(std::make_shared<Call>(
+                    Method::kEntityExists, context,
+                    [&](Encoder& args) { args.writeEntityReferences(entityReferences); }),
+                std::move(successCallback), std::move(errorCallback),
+                std::move(completionCallback), [&](auto success, auto error, auto completion) {
+                  proxied()->entityExistsAsync(entityReferences, context, hostSession,
+                                               std::move(success), std::move(error),
+                                               std::move(completion));
+                });
+}
+
+void RecordingManagerInterface::entityTraitsAsync(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    EntityTraitsSuccessCallback successCallback, BatchElementErrorCallback errorCallback,
+    CompletionCallback completionCallback) {
+  recordedAsync(std::make_shared<Call>(Method::kEntityTraits, context,
+                                       [&](Encoder& args) {
+                                         args.writeEntityReferences(entityReferences);
+                                         args.writeEnum(entityTraitsAccess);
+                                       }),
+                std::move(successCallback), std::move(errorCallback),
+                std::move(completionCallback), [&](auto success, auto error, auto completion) {
+                  proxied()->entityTraitsAsync(entityReferences, entityTraitsAccess, context,
+                                               hostSession, std::move(success), std::move(error),
+                                               std::move(completion));
+                });
+}
+
+void RecordingManagerInterface::resolveAsync(const EntityReferences& entityReferences,
+                                             const trait::TraitSet& traitSet,
+                                             const access::ResolveAccess resolveAccess,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             ResolveSuccessCallback successCallback,
+                                             BatchElementErrorCallback errorCallback,
+                                             CompletionCallback completionCallback) {
+  recordedAsync(std::make_shared<Call>(Method::kResolve, context,
+                                       [&](Encoder& args) {
+                                         args.writeEntityReferences(entityReferences);
+                                         args.writeTraitSet(traitSet);
+                                         args.writeEnum(resolveAccess);
+                                       }),
+                std::move(successCallback), std::move(errorCallback),
+                std::move(completionCallback), [&](auto success, auto error, auto completion) {
+                  proxied()->resolveAsync(entityReferences, traitSet, resolveAccess, context,
+                                          hostSession, std::move(success), std::move(error),
+                                          std::move(completion));
+                });
+}
+
+void RecordingManagerInterface::preflightAsync(const EntityReferences& entityReferences,
+                                               const trait::TraitsDatas& traitsHints,
+                                               const access::PublishingAccess publishingAccess,
+                                               const ContextConstPtr& context,
+                                               const managerApi::HostSessionPtr& hostSession,
+                                               PreflightSuccessCallback successCallback,
+                                               BatchElementErrorCallback errorCallback,
+                                               CompletionCallback completionCallback) {
+  recordedAsync(std::make_shared<Call>(Method::kPreflight, context,
+                                       [&](Encoder& args) {
+                                         args.writeEntityReferences(entityReferences);
+                                         args.writeTraitsDatas(traitsHints);
+                                         args.writeEnum(publishingAccess);
+                                       }),
+                std::move(successCallback), std::move(errorCallback),
+                std::move(completionCallback), [&](auto success, auto error, auto completion) {
+                  proxied()->preflightAsync(entityReferences, traitsHints, publishingAccess,
+                                            context, hostSession, std::move(success),
+                                            std::move(error), std::move(completion));
+                });
+}
+
+void RecordingManagerInterface::registerAsync(const EntityReferences& entityReferences,
+                                              const trait::TraitsDatas& entityTraitsDatas,
+                                              const access::PublishingAccess publishingAccess,
+                                              const ContextConstPtr& context,
+                                              const managerApi::HostSessionPtr& hostSession,
+                                              RegisterSuccessCallback successCallback,
+                                              BatchElementErrorCallback errorCallback,
+                                              CompletionCallback completionCallback) {
+  recordedAsync(std::make_shared<Call>(Method::kRegister, context,
+                                       [&](Encoder& args) {
+                                         args.writeEntityReferences(entityReferences);
+                                         args.writeTraitsDatas(entityTraitsDatas);
+                                         args.writeEnum(publishingAccess);
+                                       }),
+                std::move(successCallback), std::move(errorCallback),
+                std::move(completionCallback), [&](auto success, auto error, auto completion) {
+                  proxied()->registerAsync(entityReferences, entityTraitsDatas, publishingAccess,
+                                           context, hostSession, std::move(success),
+                                           std::move(error), std::move(completion));
+                });
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
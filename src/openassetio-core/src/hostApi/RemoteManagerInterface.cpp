@@ -0,0 +1,372 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/RemoteManagerInterface.hpp>
+
+#include "SharedMemoryChannel.hpp"
+#include "remoteManagerProtocol.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+using remoteManager::Decoder;
+using remoteManager::Encoder;
+using remoteManager::Event;
+using remoteManager::Request;
+using remoteManager::Status;
+
+void writeContext(Encoder& encoder, const ContextConstPtr& context) {
+  encoder.writeTraitsData(context ? context->locale : nullptr);
+}
+
+/**
+ * Decode the events of a batch response, passing each success value,
+ * decoded by `readValue`, to `successCallback`.
+ */
+template <class ReadValue, class SuccessCallback>
+void readEvents(Decoder& decoder, const ReadValue& readValue,
+                const SuccessCallback& successCallback,
+                const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  const std::size_t count = decoder.readLength();
+  const auto [data, size] = decoder.readBlob();
+  Decoder events{data, size};
+  for (std::size_t eventIdx = 0; eventIdx < count; ++eventIdx) {
+    const auto event = events.readEnum<Event>();
+    const std::size_t index = events.readUInt<std::uint32_t>();
+    if (event == Event::kSuccess) {
+      successCallback(index, readValue(events));
+    } else {
+      const auto code =
+          static_cast<errors::BatchElementError::ErrorCode>(events.readUInt<std::uint32_t>());
+      errorCallback(index, errors::BatchElementError{code, Str{events.readStr()}});
+    }
+  }
+}
+
+EntityReference readEntityReference(Decoder& decoder) {
+  return EntityReference{Str{decoder.readStr()}};
+}
+}  // namespace
+
+RemoteManagerInterfacePtr RemoteManagerInterface::make(const std::vector<Str>& channelNames) {
+  if (channelNames.empty()) {
+    throw errors::InputValidationException{"RemoteManagerInterface: No channels given"};
+  }
+  std::vector<ChannelPtr> channels;
+  channels.reserve(channelNames.size());
+  for (const Str& channelName : channelNames) {
+    channels.push_back(SharedMemoryChannel::open(channelName));
+  }
+  RemoteManagerInterfacePtr managerInterface{new RemoteManagerInterface{std::move(channels)}};
+  managerInterface->describe();
+  return managerInterface;
+}
+
+RemoteManagerInterface::RemoteManagerInterface(std::vector<ChannelPtr> channels)
+    : channels_{std::move(channels)} {
+  idleChannels_.reserve(channels_.size());
+  for (const ChannelPtr& channel : channels_) {
+    idleChannels_.push_back(channel.get());
+  }
+}
+
+RemoteManagerInterface::~RemoteManagerInterface() = default;
+
+void RemoteManagerInterface::describe() {
+  Bytes request;
+  Encoder{&request}.writeEnum(Request::kDescribe);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  identifier_ = Str{decoder.readStr()};
+  displayName_ = Str{decoder.readStr()};
+  info_ = decoder.readInfoDictionary();
+  // Calls are spread across channels, each served independently.
+  info_.insert_or_assign(Str{constants::kInfoKey_IsThreadSafe}, true);
+  capabilities_ = decoder.readUInt<std::uint32_t>();
+}
+
+SharedMemoryChannel* RemoteManagerInterface::acquire() {
+  std::unique_lock lock{mutex_};
+  idleCondition_.wait(lock, [this] { return !idleChannels_.empty() || channels_.empty(); });
+  if (channels_.empty()) {
+    throw errors::OpenAssetIOException{"RemoteManagerInterface: No remote managers available"};
+  }
+  SharedMemoryChannel* channel = idleChannels_.back();
+  idleChannels_.pop_back();
+  return channel;
+}
+
+void RemoteManagerInterface::release(SharedMemoryChannel* channel, const bool isHealthy) {
+  ChannelPtr dropped;
+  {
+    const std::lock_guard lock{mutex_};
+    if (isHealthy) {
+      idleChannels_.push_back(channel);
+    } else {
+      const auto iter = std::find_if(
+          channels_.begin(), channels_.end(),
+          [channel](const ChannelPtr& candidate) { return candidate.get() == channel; });
+      dropped = std::move(*iter);
+      channels_.erase(iter);
+    }
+  }
+  idleCondition_.notify_all();
+}
+
+RemoteManagerInterface::Bytes RemoteManagerInterface::exchange(SharedMemoryChannel* channel,
+                                                               const Bytes& request) {
+  Bytes response;
+  if (!channel->send(request) || !channel->receive(&response)) {
+    release(channel, false);
+    throw errors::OpenAssetIOException{
+        "RemoteManagerInterface: Lost connection to remote manager"};
+  }
+  release(channel, true);
+
+  Decoder decoder{response.data(), response.size()};
+  if (decoder.readEnum<Status>() == Status::kException) {
+    throw errors::OpenAssetIOException{Str{decoder.readStr()}};
+  }
+  // Strip the status, leaving the body.
+  response.erase(response.begin());
+  return response;
+}
+
+RemoteManagerInterface::Bytes RemoteManagerInterface::call(const Bytes& request) {
+  return exchange(acquire(), request);
+}
+
+void RemoteManagerInterface::broadcast(const Bytes& request) {
+  std::vector<SharedMemoryChannel*> channels;
+  {
+    std::unique_lock lock{mutex_};
+    idleCondition_.wait(lock, [this] { return idleChannels_.size() == channels_.size(); });
+    if (channels_.empty()) {
+      throw errors::OpenAssetIOException{"RemoteManagerInterface: No remote managers available"};
+    }
+    channels.swap(idleChannels_);
+  }
+  std::optional<errors::OpenAssetIOException> firstError;
+  for (SharedMemoryChannel* channel : channels) {
+    try {
+      exchange(channel, request);
+    } catch (const errors::OpenAssetIOException& exc) {
+      if (!firstError) {
+        firstError = exc;
+      }
+    }
+  }
+  if (firstError) {
+    throw *firstError;
+  }
+}
+
+Identifier RemoteManagerInterface::identifier() const { return identifier_; }
+
+Str RemoteManagerInterface::displayName() const { return displayName_; }
+
+bool RemoteManagerInterface::hasCapability(const Capability capability) {
+  return (capabilities_ & remoteManager::capabilityBit(capability)) != 0;
+}
+
+InfoDictionary RemoteManagerInterface::info() { return info_; }
+
+InfoDictionary RemoteManagerInterface::settings(
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Bytes request;
+  Encoder{&request}.writeEnum(Request::kSettings);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  return decoder.readInfoDictionary();
+}
+
+void RemoteManagerInterface::initialize(
+    InfoDictionary managerSettings,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kInitialize);
+  encoder.writeInfoDictionary(managerSettings);
+  broadcast(request);
+  // Identity and capabilities may depend on the settings.
+  describe();
+}
+
+void RemoteManagerInterface::flushCaches(
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Bytes request;
+  Encoder{&request}.writeEnum(Request::kFlushCaches);
+  broadcast(request);
+}
+
+void RemoteManagerInterface::flushEntityCaches(
+    const EntityReferences& entityReferences,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kFlushEntityCaches);
+  encoder.writeEntityReferences(entityReferences);
+  broadcast(request);
+}
+
+void RemoteManagerInterface::flushCachesWithPrefix(
+    const Str& prefix, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kFlushCachesWithPrefix);
+  encoder.writeStr(prefix);
+  broadcast(request);
+}
+
+trait::TraitsDatas RemoteManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kManagementPolicy);
+  encoder.writeTraitSets(traitSets);
+  encoder.writeEnum(policyAccess);
+  writeContext(encoder, context);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  return decoder.readTraitsDatas();
+}
+
+bool RemoteManagerInterface::isEntityReferenceString(
+    const Str& someString, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kIsEntityReferenceString);
+  encoder.writeStr(someString);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  return decoder.readUInt<std::uint8_t>() != 0;
+}
+
+void RemoteManagerInterface::entityExists(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const ExistsSuccessCallback& successCallback, const BatchElementErrorCallback& errorCallback) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kEntityExists);
+  encoder.writeEntityReferences(entityReferences);
+  writeContext(encoder, context);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  readEvents(
+      decoder, [](Decoder& events) { return events.readUInt<std::uint8_t>() != 0; },
+      successCallback, errorCallback);
+}
+
+void RemoteManagerInterface::entityTraits(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const EntityTraitsSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kEntityTraits);
+  encoder.writeEntityReferences(entityReferences);
+  encoder.writeEnum(entityTraitsAccess);
+  writeContext(encoder, context);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  readEvents(
+      decoder, [](Decoder& events) { return events.readTraitSet(); }, successCallback,
+      errorCallback);
+}
+
+void RemoteManagerInterface::resolve(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kResolve);
+  encoder.writeEntityReferences(entityReferences);
+  encoder.writeTraitSet(traitSet);
+  encoder.writeEnum(resolveAccess);
+  writeContext(encoder, context);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  readEvents(
+      decoder, [](Decoder& events) { return events.readTraitsData(); }, successCallback,
+      errorCallback);
+}
+
+void RemoteManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kDefaultEntityReference);
+  encoder.writeTraitSets(traitSets);
+  encoder.writeEnum(defaultEntityAccess);
+  writeContext(encoder, context);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  readEvents(
+      decoder,
+      [](Decoder& events) -> std::optional<EntityReference> {
+        if (events.readUInt<std::uint8_t>() == 0) {
+          return std::nullopt;
+        }
+        return readEntityReference(events);
+      },
+      successCallback, errorCallback);
+}
+
+void RemoteManagerInterface::preflight(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+    const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const PreflightSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kPreflight);
+  encoder.writeEntityReferences(entityReferences);
+  encoder.writeTraitsDatas(traitsHints);
+  encoder.writeEnum(publishingAccess);
+  writeContext(encoder, context);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  readEvents(decoder, readEntityReference, successCallback, errorCallback);
+}
+
+void RemoteManagerInterface::register_(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& entityTraitsDatas,
+    const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const RegisterSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  Bytes request;
+  Encoder encoder{&request};
+  encoder.writeEnum(Request::kRegister);
+  encoder.writeEntityReferences(entityReferences);
+  encoder.writeTraitsDatas(entityTraitsDatas);
+  encoder.writeEnum(publishingAccess);
+  writeContext(encoder, context);
+  const Bytes response = call(request);
+  Decoder decoder{response.data(), response.size()};
+  readEvents(decoder, readEntityReference, successCallback, errorCallback);
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/RemoteManagerServer.hpp>
+
+#include "SharedMemoryChannel.hpp"
+#include "remoteManagerProtocol.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+using managerApi::ManagerInterface;
+using remoteManager::Bytes;
+using remoteManager::Decoder;
+using remoteManager::Encoder;
+using remoteManager::Event;
+using remoteManager::Request;
+using remoteManager::Status;
+
+/**
+ * Encoder of the results of a batch method, counting the events as
+ * they are reported.
+ */
+class EventWriter {
+ public:
+  /// Callback that encodes a success value with `writeValue`.
+  template <class Value, class WriteValue>
+  auto success(const WriteValue& writeValue) {
+    return [this, &writeValue](const std::size_t index, Value value) {
+      begin(Event::kSuccess, index);
+      writeValue(encoder_, value);
+    };
+  }
+
+  ManagerInterface::BatchElementErrorCallback error() {
+    return [this](const std::size_t index, const errors::BatchElementError& batchElementError) {
+      begin(Event::kError, index);
+      encoder_.writeUInt(static_cast<std::uint32_t>(batchElementError.code));
+      encoder_.writeStr(batchElementError.message);
+    };
+  }
+
+  void writeTo(Encoder& response) const {
+    response.writeLength(count_);
+    response.writeBlob(events_);
+  }
+
+ private:
+  void begin(const Event event, const std::size_t index) {
+    ++count_;
+    encoder_.writeEnum(event);
+    encoder_.writeUInt(static_cast<std::uint32_t>(index));
+  }
+
+  Bytes events_;
+  Encoder encoder_{&events_};
+  std::size_t count_{0};
+};
+
+void writeEntityReference(Encoder& encoder, const EntityReference& entityReference) {
+  encoder.writeStr(entityReference.toString());
+}
+}  // namespace
+
+RemoteManagerServerPtr RemoteManagerServer::make(managerApi::ManagerInterfacePtr managerInterface,
+                                                 managerApi::HostSessionPtr hostSession,
+                                                 const Str& channelName,
+                                                 const std::size_t capacity) {
+  if (!managerInterface) {
+    throw errors::InputValidationException{"RemoteManagerServer: Manager interface is null"};
+  }
+  if (!hostSession) {
+    throw errors::InputValidationException{"RemoteManagerServer: Host session is null"};
+  }
+  return RemoteManagerServerPtr{
+      new RemoteManagerServer{std::move(managerInterface), std::move(hostSession),
+                              SharedMemoryChannel::create(channelName, capacity)}};
+}
+
+RemoteManagerServer::RemoteManagerServer(managerApi::ManagerInterfacePtr managerInterface,
+                                         managerApi::HostSessionPtr hostSession,
+                                         std::unique_ptr<SharedMemoryChannel> channel)
+    : managerInterface_{std::move(managerInterface)},
+      hostSession_{std::move(hostSession)},
+      channel_{std::move(channel)} {}
+
+RemoteManagerServer::~RemoteManagerServer() = default;
+
+void RemoteManagerServer::stop() { channel_->close(); }
+
+void RemoteManagerServer::serve() {
+  Bytes request;
+  Bytes response;
+  while (channel_->receive(&request)) {
+    response.clear();
+    Encoder encoder{&response};
+    encoder.writeEnum(Status::kOk);
+    try {
+      Decoder decoder{request.data(), request.size()};
+      const auto requestKind = decoder.readEnum<Request>();
+
+      const auto readContext = [&] {
+        ContextPtr context = Context::make(decoder.readTraitsData());
+        if (!context->locale) {
+          context->locale = trait::TraitsData::make();
+        }
+        if (managerInterface_->hasCapability(ManagerInterface::Capability::kStatefulContexts)) {
+          context->managerState = managerInterface_->createState(hostSession_);
+        }
+        return context;
+      };
+
+      switch (requestKind) {
+        case Request::kDescribe: {
+          encoder.writeStr(managerInterface_->identifier());
+          encoder.writeStr(managerInterface_->displayName());
+          encoder.writeInfoDictionary(managerInterface_->info());
+          std::uint32_t capabilities = 0;
+          for (const ManagerInterface::Capability capability : remoteManager::kCapabilities) {
+            if (managerInterface_->hasCapability(capability)) {
+              capabilities |= remoteManager::capabilityBit(capability);
+            }
+          }
+          encoder.writeUInt(capabilities);
+          break;
+        }
+        case Request::kInitialize:
+          managerInterface_->initialize(decoder.readInfoDictionary(), hostSession_);
+          break;
+        case Request::kSettings:
+          encoder.writeInfoDictionary(managerInterface_->settings(hostSession_));
+          break;
+        case Request::kFlushCaches:
+          managerInterface_->flushCaches(hostSession_);
+          break;
+        case Request::kFlushEntityCaches:
+          managerInterface_->flushEntityCaches(decoder.readEntityReferences(), hostSession_);
+          break;
+        case Request::kFlushCachesWithPrefix:
+          managerInterface_->flushCachesWithPrefix(Str{decoder.readStr()}, hostSession_);
+          break;
+        case Request::kManagementPolicy: {
+          const trait::TraitSets traitSets = decoder.readTraitSets();
+          const auto policyAccess = decoder.readEnum<access::PolicyAccess>();
+          encoder.writeTraitsDatas(managerInterface_->managementPolicy(
+              traitSets, policyAccess, readContext(), hostSession_));
+          break;
+        }
+        case Request::kIsEntityReferenceString:
+          encoder.writeUInt(static_cast<std::uint8_t>(
+              managerInterface_->isEntityReferenceString(Str{decoder.readStr()}, hostSession_)));
+          break;
+        case Request::kEntityExists: {
+          const EntityReferences entityReferences = decoder.readEntityReferences();
+          const ContextPtr context = readContext();
+          EventWriter events;
+          const auto writeBool = [](Encoder& valueEncoder, const bool value) {
+            valueEncoder.writeUInt(static_cast<std::uint8_t>(value));
+          };
+          managerInterface_->entityExists(entityReferences, context, hostSession_,
+                                          events.success<bool>(writeBool), events.error());
+          events.writeTo(encoder);
+          break;
+        }
+        case Request::kEntityTraits: {
+          const EntityReferences entityReferences = decoder.readEntityReferences();
+          const auto entityTraitsAccess = decoder.readEnum<access::EntityTraitsAccess>();
+          const ContextPtr context = readContext();
+          EventWriter events;
+          const auto writeTraitSet = [](Encoder& valueEncoder, const trait::TraitSet& value) {
+            valueEncoder.writeTraitSet(value);
+          };
+          managerInterface_->entityTraits(entityReferences, entityTraitsAccess, context,
+                                          hostSession_,
+                                          events.success<trait::TraitSet>(writeTraitSet),
+                                          events.error());
+          events.writeTo(encoder);
+          break;
+        }
+        case Request::kResolve: {
+          const EntityReferences entityReferences = decoder.readEntityReferences();
+          const trait::TraitSet traitSet = decoder.readTraitSet();
+          const auto resolveAccess = decoder.readEnum<access::ResolveAccess>();
+          const ContextPtr context = readContext();
+          EventWriter events;
+          const auto writeTraitsData = [](Encoder& valueEncoder,
+                                          const trait::TraitsDataPtr& value) {
+            valueEncoder.writeTraitsData(value);
+          };
+          managerInterface_->resolve(entityReferences, traitSet, resolveAccess, context,
+                                     hostSession_,
+                                     events.success<trait::TraitsDataPtr>(writeTraitsData),
+                                     events.error());
+          events.writeTo(encoder);
+          break;
+        }
+        case Request::kDefaultEntityReference: {
+          const trait::TraitSets traitSets = decoder.readTraitSets();
+          const auto defaultEntityAccess = decoder.readEnum<access::DefaultEntityAccess>();
+          const ContextPtr context = readContext();
+          EventWriter events;
+          const auto writeOptional = [](Encoder& valueEncoder,
+                                        const std::optional<EntityReference>& value) {
+            valueEncoder.writeUInt(static_cast<std::uint8_t>(value.has_value()));
+            if (value) {
+              writeEntityReference(valueEncoder, *value);
+            }
+          };
+          managerInterface_->defaultEntityReference(
+              traitSets, defaultEntityAccess, context, hostSession_,
+              events.success<std::optional<EntityReference>>(writeOptional), events.error());
+          events.writeTo(encoder);
+          break;
+        }
+        case Request::kPreflight:
+        case Request::kRegister: {
+          const EntityReferences entityReferences = decoder.readEntityReferences();
+          const trait::TraitsDatas traitsDatas = decoder.readTraitsDatas();
+          const auto publishingAccess = decoder.readEnum<access::PublishingAccess>();
+          const ContextPtr context = readContext();
+          EventWriter events;
+          if (requestKind == Request::kPreflight) {
+            managerInterface_->preflight(
+                entityReferences, traitsDatas, publishingAccess, context, hostSession_,
+                events.success<EntityReference>(writeEntityReference), events.error());
+          } else {
+            managerInterface_->register_(
+                entityReferences, traitsDatas, publishingAccess, context, hostSession_,
+                events.success<EntityReference>(writeEntityReference), events.error());
+          }
+          events.writeTo(encoder);
+          break;
+        }
+        default:
+          throw errors::InputValidationException{"RemoteManagerServer: Unknown request"};
+      }
+    } catch (const std::exception& exc) {
+      response.clear();
+      encoder.writeEnum(Status::kException);
+      encoder.writeStr(exc.what());
+    }
+    if (!channel_->send(response)) {
+      return;
+    }
+  }
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "RequestScheduler.hpp"
+
+#include <chrono>
+#include <cstddef>
+
+#include <openassetio/CancellationToken.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+/// Number of admissions held by the current thread, across all
+/// schedulers.
+thread_local std::size_t tlsAdmissionDepth = 0;
+
+/// Interval at which waiting calls check for cancellation.
+constexpr std::chrono::milliseconds kCancellationPollInterval{10};
+}  // namespace
+
+RequestScheduler::Admission::Admission(RequestScheduler* scheduler,
+                                       const Context::Priority priority)
+    : scheduler_{scheduler}, priority_{priority} {
+  ++tlsAdmissionDepth;
+}
+
+RequestScheduler::Admission::Admission(Admission&& other) noexcept
+    : scheduler_{other.scheduler_}, priority_{other.priority_} {
+  other.scheduler_ = nullptr;
+}
+
+RequestScheduler::Admission::~Admission() {
+  if (scheduler_) {
+    --tlsAdmissionDepth;
+    scheduler_->release(priority_);
+  }
+}
+
+RequestScheduler::Admission RequestScheduler::admit(const ContextConstPtr& context) {
+  const Context::Priority priority = context ? context->priority : Context::Priority::kNormal;
+  std::unique_lock lock{mutex_};
+  if (tlsAdmissionDepth == 0) {
+    while (!released_.wait_for(lock, kCancellationPollInterval,
+                               [&] { return !isPreempted(priority); })) {
+      if (context && context->cancellationToken && context->cancellationToken->isCancelled()) {
+        break;
+      }
+    }
+  }
+  ++inFlight_[static_cast<std::size_t>(priority)];
+  return Admission{this, priority};
+}
+
+std::size_t RequestScheduler::inFlight(const Context::Priority priority) {
+  const std::lock_guard lock{mutex_};
+  return inFlight_[static_cast<std::size_t>(priority)];
+}
+
+void RequestScheduler::release(const Context::Priority priority) {
+  {
+    const std::lock_guard lock{mutex_};
+    --inFlight_[static_cast<std::size_t>(priority)];
+  }
+  released_.notify_all();
+}
+
+bool RequestScheduler::isPreempted(const Context::Priority priority) const {
+  for (auto idx = static_cast<std::size_t>(priority) + 1; idx < kPriorityCount; ++idx) {
+    if (inFlight_[idx] != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Thread-safe gate ordering calls to a manager plugin by priority.
+ *
+ * Each call to the plugin is admitted for its duration. A call is only
+ * admitted once no calls of higher priority are in flight, so that
+ * chunked low priority batches yield to higher priority calls between
+ * chunks. Calls of the highest priority are admitted immediately.
+ *
+ * Calls made from a thread that is already within an admitted call,
+ * e.g. from a success callback, are admitted immediately, so as not to
+ * wait on themselves.
+ */
+class RequestScheduler {
+ public:
+  /// Registration of an admitted call, released on destruction.
+  class Admission {
+   public:
+    Admission(RequestScheduler* scheduler, Context::Priority priority);
+    Admission(const Admission&) = delete;
+    Admission& operator=(const Admission&) = delete;
+    Admission(Admission&& other) noexcept;
+    Admission& operator=(Admission&&) = delete;
+    ~Admission();
+
+   private:
+    RequestScheduler* scheduler_;
+    Context::Priority priority_;
+  };
+
+  /**
+   * Block until no calls of higher priority are in flight, or the
+   * Context's CancellationToken is cancelled, then admit a call.
+   *
+   * @param context Context of the call, whose priority and
+   * cancellation token are consulted. If null, the call is of normal
+   * priority.
+   * @return Admission, to be held for the duration of the call.
+   */
+  [[nodiscard]] Admission admit(const ContextConstPtr& context);
+
+  /// @return Number of admitted calls of the given priority.
+  [[nodiscard]] std::size_t inFlight(Context::Priority priority);
+
+ private:
+  static constexpr std::size_t kPriorityCount =
+      static_cast<std::size_t>(Context::Priority::kInteractive) + 1;
+
+  void release(Context::Priority priority);
+
+  /// Whether any calls of higher priority are in flight. Must be
+  /// called with mutex_ held.
+  [[nodiscard]] bool isPreempted(Context::Priority priority) const;
+
+  std::mutex mutex_;
+  std::condition_variable released_;
+  std::array<std::size_t, kPriorityCount> inFlight_{};
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,428 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
+
+#include "../internal/footprint.hpp"
+#include "../trait/hashing.hpp"
+#include "LruCache.hpp"
+#include "ResolveCacheKey.hpp"
+#include "SharedResolveTable.hpp"
+#include "managerTraffic.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+namespace footprint = internal::footprint;
+
+using Key = ResolveCacheKey;
+
+/**
+ * Encode a key for the shared tier, from the contents of its fields,
+ * in a canonical order, such that equal keys in any process have equal
+ * encodings.
+ *
+ * The key is prefixed with a hash of the identity of the manager that
+ * resolved it, so that processes using different managers, or
+ * settings, do not share entries.
+ *
+ * @return Empty if the key cannot be shared, since it has a manager
+ * state.
+ */
+trait::serialization::Bytes encodeSharedKey(const Key& key, const std::uint64_t managerHash) {
+  trait::serialization::Bytes encoded;
+  if (key.context.hasManagerState) {
+    return encoded;
+  }
+  managerTraffic::Encoder encoder{&encoded};
+  encoder.writeUInt(managerHash);
+  const auto writeSorted = [&encoder](const trait::TraitSet& traitSet) {
+    std::vector<trait::TraitId> sorted{traitSet.begin(), traitSet.end()};
+    std::sort(sorted.begin(), sorted.end());
+    encoder.writeLength(sorted.size());
+    for (const trait::TraitId& traitId : sorted) {
+      encoder.writeStr(traitId);
+    }
+    return sorted;
+  };
+
+  encoder.writeStr(key.entityReference.toString());
+  writeSorted(key.traitSet);
+  encoder.writeEnum(key.resolveAccess);
+  const trait::TraitsDataConstPtr& locale = key.context.locale;
+  encoder.writeUInt(static_cast<std::uint8_t>(locale != nullptr));
+  if (locale) {
+    for (const trait::TraitId& traitId : writeSorted(locale->traitSet())) {
+      std::map<trait::property::Key, trait::property::Value> properties;
+      locale->forEachProperty(
+          traitId, [&properties](const trait::property::Key& propertyKey,
+                                 const trait::property::Value& value) {
+            properties.emplace(propertyKey, value);
+          });
+      encoder.writeLength(properties.size());
+      for (const auto& [propertyKey, value] : properties) {
+        encoder.writeStr(propertyKey);
+        encoder.writeValue(value);
+      }
+    }
+  }
+  return encoded;
+}
+
+/**
+ * Independently locked LRU partition of the cache.
+ */
+class Shard {
+ public:
+  explicit Shard(const std::size_t capacity) : entries_{capacity} {}
+
+  trait::TraitsDataConstPtr lookup(const Key& key) {
+    const std::lock_guard lock{mutex_};
+    const trait::TraitsDataConstPtr* cached = entries_.find(key);
+    return cached ? *cached : nullptr;
+  }
+
+  /// @return Number of entries evicted.
+  std::size_t insert(Key key, trait::TraitsDataConstPtr value) {
+    const std::lock_guard lock{mutex_};
+    return entries_.insert(std::move(key), std::move(value));
+  }
+
+  void clear() {
+    const std::lock_guard lock{mutex_};
+    entries_.clear();
+  }
+
+  /// Remove the entries whose key satisfies a predicate.
+  template <class Predicate>
+  void eraseIf(const Predicate& predicate) {
+    const std::lock_guard lock{mutex_};
+    entries_.eraseIf([&](const Key& key, const auto&) { return predicate(key); });
+  }
+
+  std::size_t size() const {
+    const std::lock_guard lock{mutex_};
+    return entries_.size();
+  }
+
+  std::size_t memoryUsage() const {
+    const std::lock_guard lock{mutex_};
+    std::size_t bytes = sizeof(Shard) + entries_.heapBytes();
+    for (const auto& [key, value] : entries_.entries()) {
+      bytes += key.heapBytes() + value->memoryUsage();
+    }
+    return bytes;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  LruCache<Key, trait::TraitsDataConstPtr> entries_;
+};
+}  // namespace
+
+class ResolveCache::Impl {
+ public:
+  Impl(const std::size_t capacity, const std::size_t shardCount,
+       std::unique_ptr<SharedResolveTable> sharedTable)
+      : capacity_{capacity}, sharedTable_{std::move(sharedTable)} {
+    // Round up, so that the total capacity is at least that requested.
+    const std::size_t shardCapacity = (capacity + shardCount - 1) / shardCount;
+    shards_.reserve(shardCount);
+    for (std::size_t idx = 0; idx < shardCount; ++idx) {
+      shards_.push_back(std::make_unique<Shard>(shardCapacity));
+    }
+  }
+
+  trait::TraitsDataPtr lookup(const Key& key) {
+    const trait::TraitsDataConstPtr cached = shard(key).lookup(key);
+    if (!cached) {
+      return lookupShared(key);
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    // Copy-on-write, so this is cheap.
+    return trait::TraitsData::make(cached);
+  }
+
+  void insert(Key key, const trait::TraitsDataConstPtr& traitsData) {
+    if (!traitsData) {
+      return;
+    }
+    if (sharedTable_) {
+      if (const auto sharedKey = encodeSharedKey(key, managerHash());
+          !sharedKey.empty()) {
+        sharedTable_->insert(sharedKey, trait::serialization::serialize(*traitsData));
+      }
+    }
+    Shard& target = shard(key);
+    const std::size_t evicted = target.insert(std::move(key), trait::TraitsData::make(traitsData));
+    evictions_.fetch_add(evicted, std::memory_order_relaxed);
+  }
+
+  void clear() {
+    if (sharedTable_) {
+      sharedTable_->clear();
+    }
+    clearLocal();
+  }
+
+  void invalidate(const EntityReferences& entityReferences, const trait::TraitSet& traitSet) {
+    std::unordered_set<std::string_view> refs;
+    refs.reserve(entityReferences.size());
+    for (const EntityReference& entityReference : entityReferences) {
+      refs.insert(entityReference.toString());
+    }
+    eraseIf([&](const std::string_view ref, const auto& cachedTraitIds) {
+      if (refs.count(ref) == 0) {
+        return false;
+      }
+      if (traitSet.empty()) {
+        return true;
+      }
+      return std::any_of(cachedTraitIds.begin(), cachedTraitIds.end(),
+                         [&](const auto& traitId) { return traitSet.count(Str{traitId}) != 0; });
+    });
+  }
+
+  void invalidatePrefix(const std::string_view prefix) {
+    eraseIf([&](const std::string_view ref, const auto&) {
+      return ref.substr(0, prefix.size()) == prefix;
+    });
+  }
+
+  void setManagerIdentity(const Identifier& identifier, const InfoDictionary& settings) {
+    trait::serialization::Bytes encoded;
+    managerTraffic::Encoder encoder{&encoded};
+    encoder.writeStr(identifier);
+    encoder.writeInfoDictionary(settings);
+    const std::uint64_t identityHash = SharedResolveTable::hash(encoded);
+    // Entries resolved by a different manager are not valid.
+    if (managerHash_.exchange(identityHash, std::memory_order_relaxed) != identityHash) {
+      clearLocal();
+    }
+  }
+
+  void setValidityToken(const std::string_view token) {
+    if (sharedTable_) {
+      sharedTable_->validate(token);
+    }
+    const std::lock_guard lock{validityTokenMutex_};
+    if (validityToken_ && *validityToken_ != token) {
+      clearLocal();
+    }
+    validityToken_ = Str{token};
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    std::size_t total = 0;
+    for (const auto& shardPtr : shards_) {
+      total += shardPtr->size();
+    }
+    return total;
+  }
+
+  [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+  [[nodiscard]] std::size_t memoryUsage() const {
+    std::size_t bytes = sizeof(Impl) + footprint::heapBytes(shards_);
+    for (const auto& shardPtr : shards_) {
+      bytes += shardPtr->memoryUsage();
+    }
+    return bytes;
+  }
+
+  [[nodiscard]] Statistics statistics() const {
+    return {hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed),
+            evictions_.load(std::memory_order_relaxed),
+            sharedHits_.load(std::memory_order_relaxed)};
+  }
+
+ private:
+  /**
+   * Discard entries of both tiers for which the predicate, given the
+   * entity reference and trait IDs of the entry, returns true.
+   */
+  template <class Predicate>
+  void eraseIf(const Predicate& isAffected) {
+    if (sharedTable_) {
+      sharedTable_->eraseIf([&](const trait::serialization::Bytes& key) {
+        // See encodeSharedKey for the layout.
+        try {
+          managerTraffic::Decoder decoder{key.data(), key.size()};
+          if (decoder.readUInt<std::uint64_t>() != managerHash()) {
+            // Entries of other managers are unaffected.
+            return false;
+          }
+          const std::string_view ref = decoder.readStr();
+          std::vector<std::string_view> traitIds;
+          for (std::size_t count = decoder.readLength(); count > 0; --count) {
+            traitIds.push_back(decoder.readStr());
+          }
+          return isAffected(ref, traitIds);
+        } catch (const errors::InputValidationException&) {
+          // Unreadable, e.g. a corrupt file, so discard.
+          return true;
+        }
+      });
+    }
+    for (const auto& shardPtr : shards_) {
+      shardPtr->eraseIf(
+          [&](const Key& key) { return isAffected(key.entityReference.toString(), key.traitSet); });
+    }
+  }
+
+  Shard& shard(const Key& key) { return *shards_[key.hash % shards_.size()]; }
+
+  [[nodiscard]] std::uint64_t managerHash() const {
+    return managerHash_.load(std::memory_order_relaxed);
+  }
+
+  void clearLocal() {
+    for (const auto& shardPtr : shards_) {
+      shardPtr->clear();
+    }
+  }
+
+  /// Look up a local miss in the shared tier, caching any hit locally.
+  trait::TraitsDataPtr lookupShared(const Key& key) {
+    trait::serialization::Bytes value;
+    if (sharedTable_) {
+      if (const auto sharedKey = encodeSharedKey(key, managerHash());
+          !sharedKey.empty() && sharedTable_->lookup(sharedKey, &value)) {
+        trait::TraitsDataPtr traitsData;
+        try {
+          traitsData = trait::serialization::deserialize(value.data(), value.size());
+        } catch (const errors::InputValidationException&) {
+          // Unreadable, e.g. a corrupt file, so discard and treat as a
+          // miss.
+          sharedTable_->erase(sharedKey);
+          misses_.fetch_add(1, std::memory_order_relaxed);
+          return nullptr;
+        }
+        const std::size_t evicted = shard(key).insert(key, trait::TraitsData::make(traitsData));
+        evictions_.fetch_add(evicted, std::memory_order_relaxed);
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        sharedHits_.fetch_add(1, std::memory_order_relaxed);
+        return traitsData;
+      }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  const std::size_t capacity_;
+  std::unique_ptr<SharedResolveTable> sharedTable_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<std::size_t> hits_{0};
+  std::atomic<std::size_t> misses_{0};
+  std::atomic<std::size_t> evictions_{0};
+  std::atomic<std::size_t> sharedHits_{0};
+  /// Hash of the manager identity, or zero if not given.
+  std::atomic<std::uint64_t> managerHash_{0};
+  std::mutex validityTokenMutex_;
+  std::optional<Str> validityToken_;
+};
+
+namespace {
+std::unique_ptr<SharedResolveTable> openSharedTable(const ResolveCache::SharedTier& sharedTier) {
+  if (sharedTier.timeToLive.count() < 0) {
+    throw errors::InputValidationException{"ResolveCache time to live must not be negative"};
+  }
+  if (!sharedTier.path.empty()) {
+    return SharedResolveTable::openFile(sharedTier.path, sharedTier.slotCount,
+                                        sharedTier.slotSize, sharedTier.timeToLive);
+  }
+  return SharedResolveTable::open(sharedTier.name, sharedTier.slotCount, sharedTier.slotSize,
+                                  sharedTier.timeToLive);
+}
+
+void validateSizes(const std::size_t capacity, const std::size_t shardCount) {
+  if (capacity == 0) {
+    throw errors::InputValidationException{"ResolveCache capacity must be non-zero"};
+  }
+  if (shardCount == 0) {
+    throw errors::InputValidationException{"ResolveCache shard count must be non-zero"};
+  }
+}
+}  // namespace
+
+ResolveCachePtr ResolveCache::make(const std::size_t capacity, const std::size_t shardCount) {
+  validateSizes(capacity, shardCount);
+  return std::shared_ptr<ResolveCache>(new ResolveCache(capacity, shardCount, nullptr));
+}
+
+ResolveCachePtr ResolveCache::make(const std::size_t capacity, const SharedTier& sharedTier,
+                                   const std::size_t shardCount) {
+  validateSizes(capacity, shardCount);
+  return std::shared_ptr<ResolveCache>(new ResolveCache(capacity, shardCount, &sharedTier));
+}
+
+ResolveCache::ResolveCache(const std::size_t capacity, const std::size_t shardCount,
+                           const SharedTier* sharedTier)
+    : impl_{std::make_unique<Impl>(
+          capacity, shardCount,
+          sharedTier ? openSharedTable(*sharedTier) : nullptr)} {}
+
+ResolveCache::~ResolveCache() = default;
+
+std::size_t ResolveCache::capacity() const { return impl_->capacity(); }
+
+std::size_t ResolveCache::size() const { return impl_->size(); }
+
+ResolveCache::Statistics ResolveCache::statistics() const { return impl_->statistics(); }
+
+std::size_t ResolveCache::memoryUsage() const {
+  return sizeof(ResolveCache) + impl_->memoryUsage();
+}
+
+void ResolveCache::clear() { impl_->clear(); }
+
+void ResolveCache::invalidate(const EntityReferences& entityReferences,
+                              const trait::TraitSet& traitSet) {
+  impl_->invalidate(entityReferences, traitSet);
+}
+
+void ResolveCache::invalidatePrefix(const std::string_view prefix) {
+  impl_->invalidatePrefix(prefix);
+}
+
+void ResolveCache::setManagerIdentity(const Identifier& identifier,
+                                      const InfoDictionary& settings) {
+  impl_->setManagerIdentity(identifier, settings);
+}
+
+void ResolveCache::setValidityToken(const std::string_view token) {
+  impl_->setValidityToken(token);
+}
+
+trait::TraitsDataPtr ResolveCache::lookup(const EntityReference& entityReference,
+                                          const trait::TraitSet& traitSet,
+                                          const access::ResolveAccess resolveAccess,
+                                          const ContextConstPtr& context) {
+  return impl_->lookup(Key{entityReference, traitSet, resolveAccess, context});
+}
+
+void ResolveCache::insert(const EntityReference& entityReference, const trait::TraitSet& traitSet,
+                          const access::ResolveAccess resolveAccess,
+                          const ContextConstPtr& context,
+                          const trait::TraitsDataConstPtr& traitsData) {
+  impl_->insert(Key{entityReference, traitSet, resolveAccess, context}, traitsData);
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../internal/footprint.hpp"
+#include "../trait/hashing.hpp"
+#include "ContextKey.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Key of a resolve result, as cached by a ResolveCache.
+ */
+struct ResolveCacheKey {
+  ResolveCacheKey(const EntityReference& entityReference_, trait::TraitSet traitSet_,
+                  const access::ResolveAccess resolveAccess_, const ContextConstPtr& context_)
+      : entityReference{entityReference_},
+        traitSet{std::move(traitSet_)},
+        resolveAccess{resolveAccess_},
+        context{context_} {
+    // NOLINTBEGIN(readability-magic-numbers)
+    std::uint64_t combined = std::hash<Str>{}(entityReference.toString());
+    combined = combined * 31U + trait::TraitSetHash{}(traitSet);
+    combined = combined * 31U + static_cast<std::uint64_t>(resolveAccess);
+    combined = combined * 31U + context.hash;
+    // NOLINTEND(readability-magic-numbers)
+    hash = trait::mixHash(combined);
+  }
+
+  /// Heap bytes owned by this key.
+  [[nodiscard]] std::size_t heapBytes() const {
+    namespace footprint = internal::footprint;
+    return footprint::heapBytes(entityReference.toString()) + footprint::heapBytes(traitSet) +
+           context.heapBytes();
+  }
+
+  bool operator==(const ResolveCacheKey& other) const {
+    return hash == other.hash && entityReference == other.entityReference &&
+           resolveAccess == other.resolveAccess && traitSet == other.traitSet &&
+           context == other.context;
+  }
+
+  EntityReference entityReference;
+  trait::TraitSet traitSet;
+  access::ResolveAccess resolveAccess;
+  ContextKey context;
+  std::size_t hash = 0;
+};
+
+/// Hash of a ResolveCacheKey, for use in unordered containers.
+struct ResolveCacheKeyHash {
+  std::size_t operator()(const ResolveCacheKey& key) const noexcept { return key.hash; }
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ResolveCoalescer.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../errors/exceptionMessages.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+using Result = std::variant<errors::BatchElementError, trait::TraitsDataPtr>;
+
+/**
+ * Whether two contexts are equivalent for the purposes of a batch.
+ */
+bool equivalentContexts(const ContextConstPtr& lhs, const ContextConstPtr& rhs) {
+  if (lhs == rhs) {
+    return true;
+  }
+  if (!lhs || !rhs || lhs->managerState != rhs->managerState) {
+    return false;
+  }
+  if (!lhs->locale || !rhs->locale) {
+    return lhs->locale == rhs->locale;
+  }
+  return *lhs->locale == *rhs->locale;
+}
+
+/**
+ * A batch of requests that is being collected, or is in flight.
+ */
+struct Batch {
+  Batch(trait::TraitSet traitSetIn, const access::ResolveAccess resolveAccessIn,
+        ContextConstPtr contextIn)
+      : traitSet{std::move(traitSetIn)},
+        resolveAccess{resolveAccessIn},
+        context{std::move(contextIn)} {}
+
+  [[nodiscard]] bool accepts(const trait::TraitSet& otherTraitSet,
+                             const access::ResolveAccess otherResolveAccess,
+                             const ContextConstPtr& otherContext) const {
+    return resolveAccess == otherResolveAccess && traitSet == otherTraitSet &&
+           equivalentContexts(context, otherContext);
+  }
+
+  const trait::TraitSet traitSet;
+  const access::ResolveAccess resolveAccess;
+  const ContextConstPtr context;
+  EntityReferences entityReferences;
+  std::vector<std::promise<Result>> promises;
+  /// Signalled when the batch is full.
+  std::condition_variable full;
+};
+}  // namespace
+
+class ResolveCoalescer::Impl {
+ public:
+  Impl(ManagerPtr manager, const std::chrono::microseconds window,
+       const std::size_t maxBatchSize)
+      : manager_{std::move(manager)}, window_{window}, maxBatchSize_{maxBatchSize} {}
+
+  Result resolve(const EntityReference& entityReference, const trait::TraitSet& traitSet,
+                 const access::ResolveAccess resolveAccess, const ContextConstPtr& context) {
+    std::unique_lock lock{mutex_};
+
+    // Join a matching batch that is still being collected.
+    if (const auto iter = std::find_if(
+            openBatches_.begin(), openBatches_.end(),
+            [&](const auto& batch) { return batch->accepts(traitSet, resolveAccess, context); });
+        iter != openBatches_.end()) {
+      const std::shared_ptr<Batch> batch = *iter;
+      std::future<Result> future = enqueue(*batch, entityReference);
+      if (batch->entityReferences.size() >= maxBatchSize_) {
+        // Close the batch now, so no further requests join it while
+        // the leader wakes.
+        openBatches_.erase(iter);
+        batch->full.notify_one();
+      }
+      lock.unlock();
+      return future.get();
+    }
+
+    // Otherwise, start a new batch and lead it.
+    const auto batch = std::make_shared<Batch>(traitSet, resolveAccess, context);
+    std::future<Result> future = enqueue(*batch, entityReference);
+    if (maxBatchSize_ > 1) {
+      openBatches_.push_back(batch);
+      batch->full.wait_for(lock, window_,
+                           [&] { return batch->entityReferences.size() >= maxBatchSize_; });
+      // Batch may have already been closed by a follower that filled it.
+      if (const auto iter = std::find(openBatches_.begin(), openBatches_.end(), batch);
+          iter != openBatches_.end()) {
+        openBatches_.erase(iter);
+      }
+    }
+    lock.unlock();
+
+    dispatch(*batch);
+    return future.get();
+  }
+
+ private:
+  static std::future<Result> enqueue(Batch& batch, const EntityReference& entityReference) {
+    batch.entityReferences.push_back(entityReference);
+    return batch.promises.emplace_back().get_future();
+  }
+
+  /// Make the batch call and distribute results. Batch must be closed.
+  void dispatch(Batch& batch) const {
+    try {
+      std::vector<Result> results =
+          manager_->resolve(batch.entityReferences, batch.traitSet, batch.resolveAccess,
+                            batch.context, Manager::BatchElementErrorPolicyTag::kVariant);
+      for (std::size_t idx = 0; idx < results.size(); ++idx) {
+        batch.promises[idx].set_value(std::move(results[idx]));
+      }
+    } catch (...) {
+      const std::exception_ptr exception = std::current_exception();
+      for (std::promise<Result>& promise : batch.promises) {
+        promise.set_exception(exception);
+      }
+    }
+  }
+
+  const ManagerPtr manager_;
+  const std::chrono::microseconds window_;
+  const std::size_t maxBatchSize_;
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<Batch>> openBatches_;
+};
+
+ResolveCoalescerPtr ResolveCoalescer::make(ManagerPtr manager,
+                                           const std::chrono::microseconds window,
+                                           const std::size_t maxBatchSize) {
+  if (!manager) {
+    throw errors::InputValidationException{"ResolveCoalescer requires a Manager"};
+  }
+  if (maxBatchSize == 0) {
+    throw errors::InputValidationException{"ResolveCoalescer maximum batch size must be non-zero"};
+  }
+  return std::shared_ptr<ResolveCoalescer>(
+      new ResolveCoalescer(std::move(manager), window, maxBatchSize));
+}
+
+ResolveCoalescer::ResolveCoalescer(ManagerPtr manager, const std::chrono::microseconds window,
+                                   const std::size_t maxBatchSize)
+    : impl_{std::make_unique<Impl>(std::move(manager), window, maxBatchSize)} {}
+
+ResolveCoalescer::~ResolveCoalescer() = default;
+
+trait::TraitsDataPtr ResolveCoalescer::resolve(
+    const EntityReference& entityReference, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const Manager::BatchElementErrorPolicyTag::Exception& errorPolicyTag) {
+  Result result = impl_->resolve(entityReference, traitSet, resolveAccess, context);
+  if (auto* error = std::get_if<errors::BatchElementError>(&result)) {
+    throw errors::createBatchElementException(
+        std::move(*error), 0, entityReference,
+        static_cast<internal::access::Access>(resolveAccess));
+  }
+  return std::get<trait::TraitsDataPtr>(std::move(result));
+}
+
+std::variant<errors::BatchElementError, trait::TraitsDataPtr> ResolveCoalescer::resolve(
+    const EntityReference& entityReference, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const Manager::BatchElementErrorPolicyTag::Variant& errorPolicyTag) {
+  return impl_->resolve(entityReference, traitSet, resolveAccess, context);
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
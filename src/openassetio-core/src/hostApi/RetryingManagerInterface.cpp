@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <openassetio/CancellationToken.hpp>
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/RetryingManagerInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+/// Whether the Context's cancellation token has been cancelled.
+bool isCancelled(const ContextConstPtr& context) {
+  return context && context->cancellationToken && context->cancellationToken->isCancelled();
+}
+
+/// Wrap a batch callback to set a flag whenever it is called.
+template <class Callback>
+Callback reporting(std::atomic<bool>& reported, const Callback& callback) {
+  return [&reported, &callback](const std::size_t index, auto result) {
+    reported.store(true, std::memory_order_relaxed);
+    callback(index, std::move(result));
+  };
+}
+}  // namespace
+
+RetryingManagerInterfacePtr RetryingManagerInterface::make(
+    managerApi::ManagerInterfacePtr proxied, const std::size_t maxAttempts,
+    const std::chrono::milliseconds retryDelay) {
+  if (maxAttempts == 0) {
+    throw errors::InputValidationException{"Maximum number of attempts must be non-zero"};
+  }
+  return RetryingManagerInterfacePtr{
+      new RetryingManagerInterface{std::move(proxied), maxAttempts, retryDelay}};
+}
+
+RetryingManagerInterface::RetryingManagerInterface(managerApi::ManagerInterfacePtr proxied,
+                                                   const std::size_t maxAttempts,
+                                                   const std::chrono::milliseconds retryDelay)
+    : ProxyManagerInterface{std::move(proxied)},
+      maxAttempts_{maxAttempts},
+      retryDelay_{retryDelay} {}
+
+template <class Func>
+decltype(auto) RetryingManagerInterface::retry(const char* methodName,
+                                               const ContextConstPtr& context,
+                                               const managerApi::HostSessionPtr& hostSession,
+                                               const Func& func) const {
+  for (std::size_t attempt = 1;; ++attempt) {
+    std::atomic<bool> reported{false};
+    try {
+      return func(reported);
+    } catch (const errors::InputValidationException&) {
+      throw;
+    } catch (const errors::NotImplementedException&) {
+      throw;
+    } catch (const std::exception& exc) {
+      if (attempt >= maxAttempts_ || reported.load(std::memory_order_relaxed) ||
+          isCancelled(context)) {
+        throw;
+      }
+      hostSession->logger()->debug(fmt::format("Retrying '{}' after attempt {} failed: {}",
+                                               methodName, attempt, exc.what()));
+    }
+    std::this_thread::sleep_for(retryDelay_);
+  }
+}
+
+trait::TraitsDatas RetryingManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  return retry("managementPolicy", context, hostSession, [&](std::atomic<bool>&) {
+    return proxied()->managementPolicy(traitSets, policyAccess, context, hostSession);
+  });
+}
+
+void RetryingManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                            const ContextConstPtr& context,
+                                            const managerApi::HostSessionPtr& hostSession,
+                                            const ExistsSuccessCallback& successCallback,
+                                            const BatchElementErrorCallback& errorCallback) {
+  retry("entityExists", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->entityExists(entityReferences, context, hostSession,
+                            reporting(reported, successCallback),
+                            reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                            const access::EntityTraitsAccess entityTraitsAccess,
+                                            const ContextConstPtr& context,
+                                            const managerApi::HostSessionPtr& hostSession,
+                                            const EntityTraitsSuccessCallback& successCallback,
+                                            const BatchElementErrorCallback& errorCallback) {
+  retry("entityTraits", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->entityTraits(entityReferences, entityTraitsAccess, context, hostSession,
+                            reporting(reported, successCallback),
+                            reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                       const trait::TraitSet& traitSet,
+                                       const access::ResolveAccess resolveAccess,
+                                       const ContextConstPtr& context,
+                                       const managerApi::HostSessionPtr& hostSession,
+                                       const ResolveSuccessCallback& successCallback,
+                                       const BatchElementErrorCallback& errorCallback) {
+  retry("resolve", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                       reporting(reported, successCallback), reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  retry("defaultEntityReference", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession,
+                                      reporting(reported, successCallback),
+                                      reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  retry("getWithRelationship", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->getWithRelationship(entityReferences, relationshipTraitsData, resultTraitSet,
+                                   pageSize, relationsAccess, context, hostSession,
+                                   reporting(reported, successCallback),
+                                   reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  retry("getWithRelationships", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->getWithRelationships(entityReference, relationshipTraitsDatas, resultTraitSet,
+                                    pageSize, relationsAccess, context, hostSession,
+                                    reporting(reported, successCallback),
+                                    reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  retry("getWithRelationshipsMatrix", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                          resultTraitSet, pageSize, relationsAccess, context,
+                                          hostSession, reporting(reported, successCallback),
+                                          reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::traverseRelationships(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t maxDepth,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipTraversalSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  retry("traverseRelationships", context, hostSession, [&](std::atomic<bool>& reported) {
+    proxied()->traverseRelationships(entityReferences, relationshipTraitsDatas, resultTraitSet,
+                                     maxDepth, relationsAccess, context, hostSession,
+                                     reporting(reported, successCallback),
+                                     reporting(reported, errorCallback));
+  });
+}
+
+void RetryingManagerInterface::entityExistsAsync(const EntityReferences& entityReferences,
+                                                 const ContextConstPtr& context,
+                                                 const managerApi::HostSessionPtr& hostSession,
+                                                 ExistsSuccessCallback successCallback,
+                                                 BatchElementErrorCallback errorCallback,
+                                                 CompletionCallback completionCallback) {
+  ManagerInterface::entityExistsAsync(entityReferences, context, hostSession,
+                                      std::move(successCallback), std::move(errorCallback),
+                                      std::move(completionCallback));
+}
+
+void RetryingManagerInterface::entityTraitsAsync(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    EntityTraitsSuccessCallback successCallback, BatchElementErrorCallback errorCallback,
+    CompletionCallback completionCallback) {
+  ManagerInterface::entityTraitsAsync(entityReferences, entityTraitsAccess, context, hostSession,
+                                      std::move(successCallback), std::move(errorCallback),
+                                      std::move(completionCallback));
+}
+
+void RetryingManagerInterface::resolveAsync(const EntityReferences& entityReferences,
+                                            const trait::TraitSet& traitSet,
+                                            const access::ResolveAccess resolveAccess,
+                                            const ContextConstPtr& context,
+                                            const managerApi::HostSessionPtr& hostSession,
+                                            ResolveSuccessCallback successCallback,
+                                            BatchElementErrorCallback errorCallback,
+                                            CompletionCallback completionCallback) {
+  ManagerInterface::resolveAsync(entityReferences, traitSet, resolveAccess, context, hostSession,
+                                 std::move(successCallback), std::move(errorCallback),
+                                 std::move(completionCallback));
+}
+
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
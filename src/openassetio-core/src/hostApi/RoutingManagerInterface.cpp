@@ -0,0 +1,399 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/RoutingManagerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "EntityReferenceMatcher.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+/**
+ * Get a string value from a child's info dictionary, if present.
+ *
+ * @exception errors.ConfigurationException If the value is not a
+ * string.
+ */
+const Str* infoString(const InfoDictionary& info, const std::string_view key,
+                      const Identifier& childIdentifier) {
+  const auto iter = info.find(Str{key});
+  if (iter == info.end()) {
+    return nullptr;
+  }
+  const auto* value = std::get_if<Str>(&iter->second);
+  if (!value) {
+    throw errors::ConfigurationException{fmt::format(
+        "Manager '{}' provided '{}' with an invalid type: should be a string.", childIdentifier,
+        key)};
+  }
+  return value;
+}
+
+/**
+ * Construct a recogniser for a child's entity references from its
+ * info dictionary.
+ *
+ * @exception errors.ConfigurationException If the info dictionary
+ * does not declare a valid prefix, prefixes or pattern.
+ */
+std::unique_ptr<EntityReferenceMatcher> matcherFromInfo(const InfoDictionary& info,
+                                                        const Identifier& childIdentifier) {
+  auto matcher = std::make_unique<EntityReferenceMatcher>();
+
+  if (const Str* prefix =
+          infoString(info, constants::kInfoKey_EntityReferencesMatchPrefix, childIdentifier)) {
+    matcher->addPrefix(*prefix);
+  }
+
+  if (const Str* prefixes =
+          infoString(info, constants::kInfoKey_EntityReferencesMatchPrefixes, childIdentifier)) {
+    std::string_view remaining = *prefixes;
+    while (!remaining.empty()) {
+      const std::size_t end = std::min(remaining.find('\n'), remaining.size());
+      if (end > 0) {
+        matcher->addPrefix(remaining.substr(0, end));
+      }
+      remaining.remove_prefix(std::min(end + 1, remaining.size()));
+    }
+  }
+
+  if (const Str* pattern =
+          infoString(info, constants::kInfoKey_EntityReferencesMatchPattern, childIdentifier)) {
+    try {
+      matcher->setPattern(*pattern);
+    } catch (const std::regex_error& exc) {
+      throw errors::ConfigurationException{
+          fmt::format("Manager '{}' provided an invalid entity reference pattern '{}': {}",
+                      childIdentifier, *pattern, exc.what())};
+    }
+  }
+
+  if (matcher->empty()) {
+    throw errors::ConfigurationException{fmt::format(
+        "Manager '{}' does not declare an entity reference prefix or pattern, so entity "
+        "references cannot be routed to it.",
+        childIdentifier)};
+  }
+  return matcher;
+}
+}  // namespace
+
+struct RoutingManagerInterface::Partition {
+  /// Index of the child to route to.
+  std::size_t childIdx;
+  /// Caller's index of each reference in the partition.
+  std::vector<std::size_t> indices;
+  /// References routed to the child.
+  EntityReferences entityReferences;
+};
+
+RoutingManagerInterfacePtr RoutingManagerInterface::make(
+    std::vector<managerApi::ManagerInterfacePtr> children, Identifier identifier,
+    Str displayName) {
+  if (children.empty()) {
+    throw errors::InputValidationException{"At least one child manager must be provided"};
+  }
+  if (std::any_of(children.begin(), children.end(),
+                  std::logical_not<managerApi::ManagerInterfacePtr>{})) {
+    throw errors::InputValidationException{"Child managers cannot be null"};
+  }
+  return RoutingManagerInterfacePtr{new RoutingManagerInterface{
+      std::move(children), std::move(identifier), std::move(displayName)}};
+}
+
+RoutingManagerInterface::RoutingManagerInterface(
+    std::vector<managerApi::ManagerInterfacePtr> children, Identifier identifier,
+    Str displayName)
+    : children_{std::move(children)},
+      identifier_{std::move(identifier)},
+      displayName_{std::move(displayName)} {}
+
+RoutingManagerInterface::~RoutingManagerInterface() = default;
+
+const std::vector<managerApi::ManagerInterfacePtr>& RoutingManagerInterface::children() const {
+  return children_;
+}
+
+Identifier RoutingManagerInterface::identifier() const { return identifier_; }
+
+Str RoutingManagerInterface::displayName() const { return displayName_; }
+
+bool RoutingManagerInterface::hasCapability(const Capability capability) {
+  if (capability == Capability::kStatefulContexts ||
+      capability == Capability::kCustomTerminology) {
+    return false;
+  }
+  return std::any_of(children_.begin(), children_.end(),
+                     [capability](const managerApi::ManagerInterfacePtr& child) {
+                       return child->hasCapability(capability);
+                     });
+}
+
+void RoutingManagerInterface::initialize(InfoDictionary managerSettings,
+                                         const managerApi::HostSessionPtr& hostSession) {
+  std::vector<std::unique_ptr<EntityReferenceMatcher>> matchers;
+  matchers.reserve(children_.size());
+  for (const managerApi::ManagerInterfacePtr& child : children_) {
+    child->initialize(managerSettings, hostSession);
+    matchers.push_back(matcherFromInfo(child->info(), child->identifier()));
+  }
+  matchers_ = std::move(matchers);
+}
+
+void RoutingManagerInterface::flushCaches(const managerApi::HostSessionPtr& hostSession) {
+  for (const managerApi::ManagerInterfacePtr& child : children_) {
+    child->flushCaches(hostSession);
+  }
+}
+
+void RoutingManagerInterface::flushEntityCaches(const EntityReferences& entityReferences,
+                                                const managerApi::HostSessionPtr& hostSession) {
+  // Unrecognised references cannot be cached by any child.
+  for (const Partition& part :
+       partition(entityReferences, [](std::size_t, const errors::BatchElementError&) {})) {
+    children_[part.childIdx]->flushEntityCaches(part.entityReferences, hostSession);
+  }
+}
+
+void RoutingManagerInterface::flushCachesWithPrefix(
+    const Str& prefix, const managerApi::HostSessionPtr& hostSession) {
+  for (const managerApi::ManagerInterfacePtr& child : children_) {
+    child->flushCachesWithPrefix(prefix, hostSession);
+  }
+}
+
+trait::TraitsDatas RoutingManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  return children_.front()->managementPolicy(traitSets, policyAccess, context, hostSession);
+}
+
+bool RoutingManagerInterface::isEntityReferenceString(
+    const Str& someString, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  return route(someString) < children_.size();
+}
+
+std::size_t RoutingManagerInterface::route(const Str& entityReferenceString) const {
+  if (matchers_.empty()) {
+    throw errors::InputValidationException{
+        "Routing manager must be initialized before entity references can be routed"};
+  }
+  const auto iter = std::find_if(matchers_.begin(), matchers_.end(),
+                                 [&](const std::unique_ptr<EntityReferenceMatcher>& matcher) {
+                                   return matcher->matches(entityReferenceString);
+                                 });
+  return static_cast<std::size_t>(iter - matchers_.begin());
+}
+
+std::vector<RoutingManagerInterface::Partition> RoutingManagerInterface::partition(
+    const EntityReferences& entityReferences,
+    const BatchElementErrorCallback& errorCallback) const {
+  std::vector<Partition> partitions(children_.size());
+  for (std::size_t childIdx = 0; childIdx < partitions.size(); ++childIdx) {
+    partitions[childIdx].childIdx = childIdx;
+  }
+
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& entityReferenceString = entityReferences[idx].toString();
+    const std::size_t childIdx = route(entityReferenceString);
+    if (childIdx == children_.size()) {
+      errorCallback(idx, errors::BatchElementError{
+                             errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+                             fmt::format("No manager recognises the entity reference '{}'",
+                                         entityReferenceString)});
+      continue;
+    }
+    partitions[childIdx].indices.push_back(idx);
+    partitions[childIdx].entityReferences.push_back(entityReferences[idx]);
+  }
+
+  partitions.erase(std::remove_if(partitions.begin(), partitions.end(),
+                                  [](const Partition& part) { return part.indices.empty(); }),
+                   partitions.end());
+  return partitions;
+}
+
+template <class SuccessCallback, class Func>
+void RoutingManagerInterface::dispatch(const EntityReferences& entityReferences,
+                                       const managerApi::HostSessionPtr& hostSession,
+                                       const SuccessCallback& successCallback,
+                                       const BatchElementErrorCallback& errorCallback,
+                                       const Func& func) const {
+  const std::vector<Partition> partitions = partition(entityReferences, errorCallback);
+  std::mutex callbackMutex;
+
+  const auto dispatchPartition = [&](const Partition& part) {
+    func(*children_[part.childIdx], part,
+         SuccessCallback{[&](const std::size_t partIdx, auto result) {
+           const std::lock_guard lock{callbackMutex};
+           successCallback(part.indices[partIdx], std::move(result));
+         }},
+         BatchElementErrorCallback{
+             [&](const std::size_t partIdx, errors::BatchElementError error) {
+               const std::lock_guard lock{callbackMutex};
+               errorCallback(part.indices[partIdx], std::move(error));
+             }});
+  };
+
+  // Avoid the overhead of the scheduler in the common case where all
+  // references are routed to the same child.
+  if (partitions.size() == 1) {
+    dispatchPartition(partitions.front());
+    return;
+  }
+  hostSession->host()->parallelFor(partitions.size(), [&](const std::size_t partIdx) {
+    dispatchPartition(partitions[partIdx]);
+  });
+}
+
+void RoutingManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                           const ContextConstPtr& context,
+                                           const managerApi::HostSessionPtr& hostSession,
+                                           const ExistsSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  dispatch(entityReferences, hostSession, successCallback, errorCallback,
+           [&](ManagerInterface& child, const Partition& part, const auto& onSuccess,
+               const auto& onError) {
+             child.entityExists(part.entityReferences, context, hostSession, onSuccess, onError);
+           });
+}
+
+void RoutingManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                           const access::EntityTraitsAccess entityTraitsAccess,
+                                           const ContextConstPtr& context,
+                                           const managerApi::HostSessionPtr& hostSession,
+                                           const EntityTraitsSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  dispatch(entityReferences, hostSession, successCallback, errorCallback,
+           [&](ManagerInterface& child, const Partition& part, const auto& onSuccess,
+               const auto& onError) {
+             child.entityTraits(part.entityReferences, entityTraitsAccess, context, hostSession,
+                                onSuccess, onError);
+           });
+}
+
+void RoutingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                      const trait::TraitSet& traitSet,
+                                      const access::ResolveAccess resolveAccess,
+                                      const ContextConstPtr& context,
+                                      const managerApi::HostSessionPtr& hostSession,
+                                      const ResolveSuccessCallback& successCallback,
+                                      const BatchElementErrorCallback& errorCallback) {
+  dispatch(entityReferences, hostSession, successCallback, errorCallback,
+           [&](ManagerInterface& child, const Partition& part, const auto& onSuccess,
+               const auto& onError) {
+             child.resolve(part.entityReferences, traitSet, resolveAccess, context, hostSession,
+                           onSuccess, onError);
+           });
+}
+
+void RoutingManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  children_.front()->defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession,
+                                            successCallback, errorCallback);
+}
+
+void RoutingManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  dispatch(entityReferences, hostSession, successCallback, errorCallback,
+           [&](ManagerInterface& child, const Partition& part, const auto& onSuccess,
+               const auto& onError) {
+             child.getWithRelationship(part.entityReferences, relationshipTraitsData,
+                                       resultTraitSet, pageSize, relationsAccess, context,
+                                       hostSession, onSuccess, onError);
+           });
+}
+
+void RoutingManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  const std::size_t childIdx = route(entityReference.toString());
+  if (childIdx == children_.size()) {
+    for (std::size_t idx = 0; idx < relationshipTraitsDatas.size(); ++idx) {
+      errorCallback(idx, errors::BatchElementError{
+                             errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+                             fmt::format("No manager recognises the entity reference '{}'",
+                                         entityReference.toString())});
+    }
+    return;
+  }
+  children_[childIdx]->getWithRelationships(entityReference, relationshipTraitsDatas,
+                                            resultTraitSet, pageSize, relationsAccess, context,
+                                            hostSession, successCallback, errorCallback);
+}
+
+void RoutingManagerInterface::preflight(const EntityReferences& entityReferences,
+                                        const trait::TraitsDatas& traitsHints,
+                                        const access::PublishingAccess publishingAccess,
+                                        const ContextConstPtr& context,
+                                        const managerApi::HostSessionPtr& hostSession,
+                                        const PreflightSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  dispatch(entityReferences, hostSession, successCallback, errorCallback,
+           [&](ManagerInterface& child, const Partition& part, const auto& onSuccess,
+               const auto& onError) {
+             trait::TraitsDatas partTraitsHints;
+             partTraitsHints.reserve(part.indices.size());
+             for (const std::size_t idx : part.indices) {
+               partTraitsHints.push_back(traitsHints[idx]);
+             }
+             child.preflight(part.entityReferences, partTraitsHints, publishingAccess, context,
+                             hostSession, onSuccess, onError);
+           });
+}
+
+void RoutingManagerInterface::register_(const EntityReferences& entityReferences,
+                                        const trait::TraitsDatas& entityTraitsDatas,
+                                        const access::PublishingAccess publishingAccess,
+                                        const ContextConstPtr& context,
+                                        const managerApi::HostSessionPtr& hostSession,
+                                        const RegisterSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  dispatch(entityReferences, hostSession, successCallback, errorCallback,
+           [&](ManagerInterface& child, const Partition& part, const auto& onSuccess,
+               const auto& onError) {
+             trait::TraitsDatas partTraitsDatas;
+             partTraitsDatas.reserve(part.indices.size());
+             for (const std::size_t idx : part.indices) {
+               partTraitsDatas.push_back(entityTraitsDatas[idx]);
+             }
+             child.register_(part.entityReferences, partTraitsDatas, publishingAccess, context,
+                             hostSession, onSuccess, onError);
+           });
+}
+
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
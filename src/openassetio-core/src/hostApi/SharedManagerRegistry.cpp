@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "SharedManagerRegistry.hpp"
+
+#include <algorithm>
+
+#include <openassetio/hostApi/Manager.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+SharedManagerRegistry& SharedManagerRegistry::instance() {
+  static SharedManagerRegistry registry;
+  return registry;
+}
+
+ManagerPtr SharedManagerRegistry::acquire(const Identifier& hostIdentifier,
+                                          const Identifier& managerIdentifier,
+                                          const InfoDictionary& settings,
+                                          const ManagerCreator& create) {
+  std::shared_ptr<Entry> entry;
+  {
+    const std::lock_guard lock{mutex_};
+    // Prune entries whose manager has been released, and which no
+    // other caller is currently populating.
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                  [](const auto& keyAndEntry) {
+                                    return keyAndEntry.second.use_count() == 1 &&
+                                           keyAndEntry.second->manager.expired();
+                                  }),
+                   entries_.end());
+
+    const auto iter =
+        std::find_if(entries_.begin(), entries_.end(), [&](const auto& keyAndEntry) {
+          const Key& key = keyAndEntry.first;
+          return key.managerIdentifier == managerIdentifier &&
+                 key.hostIdentifier == hostIdentifier && key.settings == settings;
+        });
+    if (iter != entries_.end()) {
+      entry = iter->second;
+    } else {
+      entry = std::make_shared<Entry>();
+      entries_.emplace_back(Key{hostIdentifier, managerIdentifier, settings}, entry);
+    }
+  }
+
+  // Create outside of the registry lock, such that slow manager
+  // initialization only blocks callers requesting the same manager.
+  const std::lock_guard lock{entry->mutex};
+  if (ManagerPtr manager = entry->manager.lock()) {
+    return manager;
+  }
+  ManagerPtr manager = create();
+  entry->manager = manager;
+  return manager;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
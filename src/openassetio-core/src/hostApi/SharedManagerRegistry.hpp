@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(hostApi, Manager)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Process-wide, thread-safe registry of shared, initialized managers.
+ *
+ * Managers are keyed on the identifier of the host, the identifier of
+ * the manager and the settings it was initialized with. Only weak
+ * references are held, so a manager is destroyed as normal once the
+ * last caller releases it, and a subsequent request creates anew.
+ */
+class SharedManagerRegistry final {
+ public:
+  /// Creates and initializes a new manager.
+  using ManagerCreator = std::function<ManagerPtr()>;
+
+  /// @return The process-wide registry.
+  static SharedManagerRegistry& instance();
+
+  /**
+   * Retrieve the live manager registered under the given key, or
+   * create and register one using @p create.
+   *
+   * Concurrent requests for the same key wait on a single creation.
+   * If creation throws, nothing is registered.
+   */
+  ManagerPtr acquire(const Identifier& hostIdentifier, const Identifier& managerIdentifier,
+                     const InfoDictionary& settings, const ManagerCreator& create);
+
+ private:
+  struct Key {
+    Identifier hostIdentifier;
+    Identifier managerIdentifier;
+    InfoDictionary settings;
+  };
+
+  struct Entry {
+    std::mutex mutex;
+    std::weak_ptr<Manager> manager;
+  };
+
+  std::mutex mutex_;
+  // Few shared managers are expected, and InfoDictionary is not
+  // hashable, so a linear search suffices.
+  std::vector<std::pair<Key, std::shared_ptr<Entry>>> entries_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,380 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <openassetio/errors/exceptions.hpp>
+
+#include "SharedMemoryChannel.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+#if defined(_WIN32)
+
+struct SharedMemoryChannel::Segment {};
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::create(const Str&, std::size_t) {
+  throw errors::NotImplementedException{
+      "SharedMemoryChannel: Shared memory channels are not supported on this platform"};
+}
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::open(const Str&) {
+  throw errors::NotImplementedException{
+      "SharedMemoryChannel: Shared memory channels are not supported on this platform"};
+}
+
+SharedMemoryChannel::~SharedMemoryChannel() = default;
+bool SharedMemoryChannel::send(const Bytes&) { return false; }
+bool SharedMemoryChannel::receive(Bytes*) { return false; }
+void SharedMemoryChannel::close() {}
+
+#else
+
+namespace {
+/// Identifies an initialized segment, "OACH".
+constexpr std::uint32_t kMagic = 0x4843414FU;
+constexpr std::uint32_t kVersion = 1;
+
+/// Interval at which blocked calls check that the peer is alive.
+constexpr long kPollIntervalNs = 50'000'000;
+constexpr long kNsPerSecond = 1'000'000'000;
+
+/// Ring carrying messages from the client to the server.
+constexpr std::size_t kToServer = 0;
+/// Ring carrying messages from the server to the client.
+constexpr std::size_t kToClient = 1;
+
+/// Alignment of the ring buffer data following the segment header.
+constexpr std::size_t kDataAlignment = 64;
+
+Str shmName(const Str& name) { return "/" + name; }
+
+[[noreturn]] void throwSystemError(const Str& name, const char* action) {
+  Str msg = "SharedMemoryChannel: Could not ";
+  msg += action;
+  msg += " '";
+  msg += name;
+  msg += "': ";
+  msg += std::strerror(errno);
+  throw errors::InputValidationException{msg};
+}
+
+bool isProcessAlive(const pid_t pid) {
+  // Signal 0 only checks whether the process exists.
+  return pid == 0 || ::kill(pid, 0) == 0 || errno == EPERM;
+}
+}  // namespace
+
+/// Header at the start of the shared memory, followed by the data of
+/// each ring.
+struct SharedMemoryChannel::Segment {
+  struct Ring {
+    pthread_cond_t readable;
+    pthread_cond_t writable;
+    /// Total bytes written to, and read from, the ring.
+    std::uint64_t written;
+    std::uint64_t read;
+  };
+
+  /// Offset of the ring data from the start of the segment.
+  static constexpr std::size_t dataOffset() {
+    return (sizeof(Segment) + kDataAlignment - 1) / kDataAlignment * kDataAlignment;
+  }
+
+  std::byte* data(const std::size_t ringIdx) {
+    // NOLINTNEXTLINE(*-reinterpret-cast,*-pointer-arithmetic)
+    return reinterpret_cast<std::byte*>(this) + dataOffset() + ringIdx * capacity;
+  }
+
+  /// Lock the mutex, recovering it if its previous owner died whilst
+  /// holding it, in which case the channel is closed.
+  void lock() { recover(pthread_mutex_lock(&mutex)); }
+
+  void unlock() { pthread_mutex_unlock(&mutex); }
+
+  void recover([[maybe_unused]] const int result) {
+#if defined(__linux__)
+    if (result == EOWNERDEAD) {
+      pthread_mutex_consistent(&mutex);
+      closeLocked();
+    }
+#endif
+  }
+
+  /// Close the channel, with the mutex held.
+  void closeLocked() {
+    closed = true;
+    for (Ring& ring : rings) {
+      pthread_cond_broadcast(&ring.readable);
+      pthread_cond_broadcast(&ring.writable);
+    }
+  }
+
+  /**
+   * Wait on `cond`, with the mutex held, until `isReady` returns true.
+   *
+   * @return `false` if the channel is closed, or the peer exits, first.
+   */
+  template <class IsReady>
+  bool waitUntil(pthread_cond_t* cond, const bool isServer, const IsReady& isReady) {
+    while (!isReady()) {
+      if (closed) {
+        return false;
+      }
+      if (!isProcessAlive(isServer ? clientPid : serverPid)) {
+        closeLocked();
+        return false;
+      }
+      timespec deadline{};
+      clock_gettime(CLOCK_REALTIME, &deadline);
+      deadline.tv_nsec += kPollIntervalNs;
+      if (deadline.tv_nsec >= kNsPerSecond) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= kNsPerSecond;
+      }
+      recover(pthread_cond_timedwait(cond, &mutex, &deadline));
+    }
+    return true;
+  }
+
+  std::uint32_t magic;
+  std::uint32_t version;
+  std::uint64_t capacity;
+  pthread_mutex_t mutex;
+  std::array<Ring, 2> rings;
+  pid_t serverPid;
+  pid_t clientPid;
+  bool closed;
+};
+
+namespace {
+/// Holds the lock of a segment for its lifetime.
+template <class Segment>
+class SegmentLock {
+ public:
+  explicit SegmentLock(Segment* segment) : segment_{segment} { segment_->lock(); }
+  ~SegmentLock() { segment_->unlock(); }
+
+  SegmentLock(const SegmentLock&) = delete;
+  SegmentLock(SegmentLock&&) noexcept = delete;
+  SegmentLock& operator=(const SegmentLock&) = delete;
+  SegmentLock& operator=(SegmentLock&&) noexcept = delete;
+
+ private:
+  Segment* segment_;
+};
+}  // namespace
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::create(const Str& name,
+                                                                 const std::size_t capacity) {
+  if (capacity == 0) {
+    throw errors::InputValidationException{"SharedMemoryChannel: Capacity must be non-zero"};
+  }
+  const Str path = shmName(name);
+  const int fileDescriptor =
+      ::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fileDescriptor < 0) {
+    throwSystemError(name, "create shared memory");
+  }
+  const std::size_t mappedSize = Segment::dataOffset() + 2 * capacity;
+  void* address = MAP_FAILED;
+  if (::ftruncate(fileDescriptor, static_cast<off_t>(mappedSize)) == 0) {
+    address =
+        ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+  }
+  ::close(fileDescriptor);
+  if (address == MAP_FAILED) {
+    ::shm_unlink(path.c_str());
+    throwSystemError(name, "map shared memory");
+  }
+
+  auto* segment = new (address) Segment{};
+  segment->capacity = capacity;
+  segment->serverPid = ::getpid();
+
+  pthread_mutexattr_t mutexAttr;
+  pthread_mutexattr_init(&mutexAttr);
+  pthread_mutexattr_setpshared(&mutexAttr, PTHREAD_PROCESS_SHARED);
+#if defined(__linux__)
+  pthread_mutexattr_setrobust(&mutexAttr, PTHREAD_MUTEX_ROBUST);
+#endif
+  pthread_mutex_init(&segment->mutex, &mutexAttr);
+  pthread_mutexattr_destroy(&mutexAttr);
+
+  pthread_condattr_t condAttr;
+  pthread_condattr_init(&condAttr);
+  pthread_condattr_setpshared(&condAttr, PTHREAD_PROCESS_SHARED);
+  for (Segment::Ring& ring : segment->rings) {
+    pthread_cond_init(&ring.readable, &condAttr);
+    pthread_cond_init(&ring.writable, &condAttr);
+  }
+  pthread_condattr_destroy(&condAttr);
+
+  segment->version = kVersion;
+  segment->magic = kMagic;
+
+  return std::unique_ptr<SharedMemoryChannel>{
+      new SharedMemoryChannel{name, segment, mappedSize, true}};
+}
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::open(const Str& name) {
+  const int fileDescriptor = ::shm_open(shmName(name).c_str(), O_RDWR, 0);
+  if (fileDescriptor < 0) {
+    throwSystemError(name, "open shared memory");
+  }
+  struct stat status {};
+  void* address = MAP_FAILED;
+  if (::fstat(fileDescriptor, &status) == 0 &&
+      static_cast<std::size_t>(status.st_size) > Segment::dataOffset()) {
+    address = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fileDescriptor, 0);
+  }
+  ::close(fileDescriptor);
+  if (address == MAP_FAILED) {
+    throwSystemError(name, "map shared memory");
+  }
+  const auto mappedSize = static_cast<std::size_t>(status.st_size);
+  auto* segment = static_cast<Segment*>(address);
+
+  const auto reject = [&](const char* reason) {
+    ::munmap(address, mappedSize);
+    Str msg = "SharedMemoryChannel: Could not connect to '";
+    msg += name;
+    msg += "': ";
+    msg += reason;
+    throw errors::InputValidationException{msg};
+  };
+  if (segment->magic != kMagic || segment->version != kVersion ||
+      Segment::dataOffset() + 2 * segment->capacity != mappedSize) {
+    reject("channel is invalid or incompatible");
+  }
+  const char* rejection = nullptr;
+  {
+    const SegmentLock lock{segment};
+    if (segment->closed) {
+      rejection = "channel is closed";
+    } else if (segment->clientPid != 0 && isProcessAlive(segment->clientPid)) {
+      rejection = "channel already has a client";
+    } else {
+      segment->clientPid = ::getpid();
+    }
+  }
+  if (rejection) {
+    reject(rejection);
+  }
+  return std::unique_ptr<SharedMemoryChannel>{
+      new SharedMemoryChannel{name, segment, mappedSize, false}};
+}
+
+SharedMemoryChannel::~SharedMemoryChannel() {
+  close();
+  ::munmap(segment_, mappedSize_);
+  if (isServer_) {
+    ::shm_unlink(shmName(name_).c_str());
+  }
+}
+
+bool SharedMemoryChannel::send(const Bytes& message) {
+  std::array<std::byte, sizeof(std::uint32_t)> header{};
+  const auto length = static_cast<std::uint32_t>(message.size());
+  for (std::size_t byteIdx = 0; byteIdx < header.size(); ++byteIdx) {
+    header[byteIdx] = static_cast<std::byte>((length >> (byteIdx * 8U)) & 0xFFU);
+  }
+  return write(header.data(), header.size()) && write(message.data(), message.size());
+}
+
+bool SharedMemoryChannel::receive(Bytes* message) {
+  std::array<std::byte, sizeof(std::uint32_t)> header{};
+  if (!read(header.data(), header.size())) {
+    return false;
+  }
+  std::uint32_t length = 0;
+  for (std::size_t byteIdx = 0; byteIdx < header.size(); ++byteIdx) {
+    length |= static_cast<std::uint32_t>(header[byteIdx]) << (byteIdx * 8U);
+  }
+  message->resize(length);
+  return read(message->data(), message->size());
+}
+
+void SharedMemoryChannel::close() {
+  const SegmentLock lock{segment_};
+  segment_->closeLocked();
+}
+
+bool SharedMemoryChannel::write(const std::byte* data, std::size_t size) {
+  const std::size_t ringIdx = isServer_ ? kToClient : kToServer;
+  Segment::Ring& ring = segment_->rings[ringIdx];
+  std::byte* ringData = segment_->data(ringIdx);
+  const std::uint64_t capacity = segment_->capacity;
+
+  const SegmentLock lock{segment_};
+  while (size > 0) {
+    if (segment_->closed || !segment_->waitUntil(&ring.writable, isServer_, [&] {
+          return ring.written - ring.read < capacity;
+        })) {
+      return false;
+    }
+    const std::uint64_t offset = ring.written % capacity;
+    const std::size_t count =
+        std::min<std::uint64_t>({size, capacity - (ring.written - ring.read), capacity - offset});
+    std::memcpy(ringData + offset, data, count);  // NOLINT(*-pointer-arithmetic)
+    ring.written += count;
+    data += count;  // NOLINT(*-pointer-arithmetic)
+    size -= count;
+    pthread_cond_broadcast(&ring.readable);
+  }
+  return true;
+}
+
+bool SharedMemoryChannel::read(std::byte* data, std::size_t size) {
+  const std::size_t ringIdx = isServer_ ? kToServer : kToClient;
+  Segment::Ring& ring = segment_->rings[ringIdx];
+  const std::byte* ringData = segment_->data(ringIdx);
+  const std::uint64_t capacity = segment_->capacity;
+
+  const SegmentLock lock{segment_};
+  while (size > 0) {
+    // Data already sent is still delivered after the channel closes.
+    if (!segment_->waitUntil(&ring.readable, isServer_,
+                             [&] { return ring.written != ring.read; })) {
+      return false;
+    }
+    const std::uint64_t offset = ring.read % capacity;
+    const std::size_t count =
+        std::min<std::uint64_t>({size, ring.written - ring.read, capacity - offset});
+    std::memcpy(data, ringData + offset, count);  // NOLINT(*-pointer-arithmetic)
+    ring.read += count;
+    data += count;  // NOLINT(*-pointer-arithmetic)
+    size -= count;
+    pthread_cond_broadcast(&ring.writable);
+  }
+  return true;
+}
+
+#endif
+
+SharedMemoryChannel::SharedMemoryChannel(Str name, Segment* segment, const std::size_t mappedSize,
+                                         const bool isServer)
+    : name_{std::move(name)}, segment_{segment}, mappedSize_{mappedSize}, isServer_{isServer} {}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/serialization.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Message channel between a server and a client process, over a named
+ * shared memory segment.
+ *
+ * The segment holds a ring buffer in each direction, guarded by a
+ * process-shared mutex and condition variables. Messages are
+ * length-prefixed, and may be larger than a ring, in which case they
+ * are streamed through it, the sender blocking whilst it is full.
+ *
+ * The server creates the segment, and removes its name on destruction.
+ * A single client may be connected at a time. Either side may @ref
+ * close the channel, waking the other. Whilst waiting, each side
+ * periodically checks that the other's process is still alive, so
+ * that a crashed peer closes the channel, rather than hanging.
+ *
+ * Only supported on POSIX platforms.
+ */
+class SharedMemoryChannel final {
+ public:
+  using Bytes = trait::serialization::Bytes;
+
+  /**
+   * Create a channel, as the server.
+   *
+   * @param name Name of the channel, used by the client to connect.
+   * Should be short, and contain no slashes.
+   * @param capacity Size of the ring buffer in each direction, in
+   * bytes.
+   * @exception errors.InputValidationException If the channel cannot
+   * be created, e.g. the name is already in use.
+   * @exception errors.NotImplementedException If the platform is not
+   * supported.
+   */
+  static std::unique_ptr<SharedMemoryChannel> create(const Str& name, std::size_t capacity);
+
+  /**
+   * Connect to an existing channel, as the client.
+   *
+   * @exception errors.InputValidationException If the channel does not
+   * exist, is closed, or already has a client.
+   * @exception errors.NotImplementedException If the platform is not
+   * supported.
+   */
+  static std::unique_ptr<SharedMemoryChannel> open(const Str& name);
+
+  /// Closes the channel. The server also removes the channel's name.
+  ~SharedMemoryChannel();
+
+  SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+  SharedMemoryChannel(SharedMemoryChannel&&) noexcept = delete;
+  SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+  SharedMemoryChannel& operator=(SharedMemoryChannel&&) noexcept = delete;
+
+  /**
+   * Send a message to the peer, blocking whilst the ring is full.
+   *
+   * @return `false` if the channel was closed before the message was
+   * fully sent.
+   */
+  bool send(const Bytes& message);
+
+  /**
+   * Receive the next message from the peer, blocking until it arrives.
+   *
+   * @return `false` if the channel was closed before a message was
+   * fully received.
+   */
+  bool receive(Bytes* message);
+
+  /// Close the channel, waking any blocked calls on either side.
+  void close();
+
+ private:
+  struct Segment;
+
+  SharedMemoryChannel(Str name, Segment* segment, std::size_t mappedSize, bool isServer);
+
+  bool write(const std::byte* data, std::size_t size);
+  bool read(std::byte* data, std::size_t size);
+
+  Str name_;
+  Segment* segment_;
+  std::size_t mappedSize_;
+  bool isServer_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
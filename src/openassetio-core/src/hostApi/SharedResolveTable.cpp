@@ -0,0 +1,446 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <openassetio/errors/exceptions.hpp>
+
+#include "SharedResolveTable.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+/// Number of consecutive slots a key may occupy.
+constexpr std::size_t kWindowSize = 4;
+
+/// Alignment of each slot, avoiding false sharing between slots.
+constexpr std::size_t kSlotAlignment = 64;
+
+/// Identifies an initialized table, "OART".
+constexpr std::uint32_t kMagic = 0x5452414FU;
+
+/// Version of the table layout, which may persist in files.
+constexpr std::uint32_t kVersion = 2;
+
+/// Time to wait for another process to initialize a new table.
+constexpr std::chrono::seconds kInitializeTimeout{2};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Shared memory requires lock-free 64-bit atomics");
+
+/// FNV-1a, which, unlike `std::hash`, is stable across processes.
+template <class Bytes>
+std::uint64_t hashBytes(const Bytes& bytes) {
+  // NOLINTBEGIN(readability-magic-numbers)
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const auto byte : bytes) {
+    hash = (hash ^ static_cast<std::uint8_t>(byte)) * 0x100000001b3ULL;
+  }
+  // NOLINTEND(readability-magic-numbers)
+  return hash;
+}
+
+/// Seconds since the epoch, comparable between processes and runs.
+std::int64_t now() {
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+/// Milliseconds since the epoch, truncated, so only differences are
+/// meaningful.
+std::uint32_t nowMillis() {
+  return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                        std::chrono::system_clock::now().time_since_epoch())
+                                        .count());
+}
+
+/**
+ * Make a claim to write shared memory, identifying this process, so
+ * that other processes can tell whether it was abandoned, and the time
+ * of the claim, so that successive claims differ. Never zero.
+ */
+std::uint64_t makeClaim() {
+#if defined(_WIN32)
+  const std::uint64_t processId = 1;
+#else
+  const auto processId = static_cast<std::uint64_t>(::getpid());
+#endif
+  return (processId << 32U) | nowMillis();
+}
+
+/**
+ * Whether the process that made a claim has exited.
+ *
+ * A claim is never presumed abandoned merely by its age, since its
+ * process may simply be descheduled, and taking it over would then
+ * let two writers update the slot at once.
+ */
+bool isAbandoned(const std::uint64_t claim) {
+#if defined(_WIN32)
+  return false;
+#else
+  return ::kill(static_cast<pid_t>(claim >> 32U), 0) != 0 && errno == ESRCH;
+#endif
+}
+
+void validateSizes(const std::size_t slotCount, const std::size_t slotSize) {
+  if (slotCount == 0 || slotSize == 0 || slotSize > UINT32_MAX) {
+    throw errors::InputValidationException{
+        "SharedResolveTable: Slot count and size must be non-zero and within range"};
+  }
+}
+}  // namespace
+
+/// Start of the shared memory, initially zero.
+struct SharedResolveTable::Header {
+  /// Set once the remaining fields are initialized.
+  std::atomic<std::uint32_t> magic;
+  /// Version, slot count and slot size, set by the first process.
+  std::atomic<std::uint32_t> version;
+  std::atomic<std::uint64_t> slotSize;
+  std::atomic<std::uint64_t> slotCount;
+  /// Entries of other generations are invalid. Zero is never current.
+  std::atomic<std::uint64_t> generation;
+  /// Hash of the token given to @ref validate, or zero.
+  std::atomic<std::uint64_t> validityToken;
+  /// Claim of the process initializing the table, or zero.
+  std::atomic<std::uint64_t> initializer;
+};
+
+/// Slot header, followed by the key and value.
+struct SharedResolveTable::Slot {
+  /// Odd whilst the slot is being written.
+  std::atomic<std::uint64_t> sequence;
+  std::atomic<std::uint64_t> generation;
+  std::atomic<std::uint64_t> hash;
+  /// Time of writing, in seconds since the epoch.
+  std::atomic<std::int64_t> writeTime;
+  std::atomic<std::uint32_t> keySize;
+  std::atomic<std::uint32_t> valueSize;
+  /// Claim of the process writing the slot, or zero.
+  std::atomic<std::uint64_t> writer;
+
+  std::byte* data() {
+    return reinterpret_cast<std::byte*>(this) + sizeof(Slot);  // NOLINT
+  }
+};
+
+namespace {
+constexpr std::size_t alignUp(const std::size_t size) {
+  return (size + kSlotAlignment - 1) / kSlotAlignment * kSlotAlignment;
+}
+}  // namespace
+
+#if defined(_WIN32)
+
+std::unique_ptr<SharedResolveTable> SharedResolveTable::open(const Str&, std::size_t, std::size_t,
+                                                             std::chrono::seconds) {
+  throw errors::NotImplementedException{
+      "SharedResolveTable: Shared resolve caches are not supported on this platform"};
+}
+
+std::unique_ptr<SharedResolveTable> SharedResolveTable::openFile(const Str&, std::size_t,
+                                                                 std::size_t,
+                                                                 std::chrono::seconds) {
+  throw errors::NotImplementedException{
+      "SharedResolveTable: Persistent resolve caches are not supported on this platform"};
+}
+
+SharedResolveTable::~SharedResolveTable() = default;
+
+#else
+
+std::unique_ptr<SharedResolveTable> SharedResolveTable::open(
+    const Str& name, const std::size_t slotCount, const std::size_t slotSize,
+    const std::chrono::seconds timeToLive) {
+  validateSizes(slotCount, slotSize);
+  const int fileDescriptor =
+      ::shm_open(("/" + name).c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+  return map(fileDescriptor, name, slotCount, slotSize, timeToLive);
+}
+
+std::unique_ptr<SharedResolveTable> SharedResolveTable::openFile(
+    const Str& path, const std::size_t slotCount, const std::size_t slotSize,
+    const std::chrono::seconds timeToLive) {
+  validateSizes(slotCount, slotSize);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  const int fileDescriptor =
+      ::open(path.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+  return map(fileDescriptor, path, slotCount, slotSize, timeToLive);
+}
+
+std::unique_ptr<SharedResolveTable> SharedResolveTable::map(
+    const int fileDescriptor, const Str& name, const std::size_t slotCount,
+    const std::size_t slotSize, const std::chrono::seconds timeToLive) {
+  const std::size_t slotStride = alignUp(sizeof(Slot) + slotSize);
+  const std::size_t mappedSize = alignUp(sizeof(Header)) + slotCount * slotStride;
+
+  const auto fail = [&](const char* reason) {
+    Str msg = "SharedResolveTable: Could not open '";
+    msg += name;
+    msg += "': ";
+    msg += reason;
+    throw errors::InputValidationException{msg};
+  };
+
+  if (fileDescriptor < 0) {
+    fail(std::strerror(errno));
+  }
+  struct stat status {};
+  bool isSizeValid = ::fstat(fileDescriptor, &status) == 0;
+  // A new file is empty, and zeroed once sized, which is a valid empty
+  // table, so concurrent creators need not coordinate.
+  if (isSizeValid && status.st_size == 0) {
+    isSizeValid = ::ftruncate(fileDescriptor, static_cast<off_t>(mappedSize)) == 0;
+  } else if (isSizeValid) {
+    isSizeValid = static_cast<std::size_t>(status.st_size) == mappedSize;
+  }
+  void* address = MAP_FAILED;
+  if (isSizeValid) {
+    address =
+        ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+  }
+  ::close(fileDescriptor);
+  if (!isSizeValid) {
+    fail("table exists with a different size");
+  }
+  if (address == MAP_FAILED) {
+    fail(std::strerror(errno));
+  }
+
+  auto* header = static_cast<Header*>(address);
+  // The process that claims a new table initializes it, setting the
+  // magic number last. If it crashes before then, its claim is
+  // abandoned, and another process takes over.
+  const auto deadline = std::chrono::steady_clock::now() + kInitializeTimeout;
+  while (header->magic.load(std::memory_order_acquire) == 0 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::uint64_t claim = header->initializer.load(std::memory_order_relaxed);
+    if ((claim == 0 || isAbandoned(claim)) &&
+        header->initializer.compare_exchange_strong(claim, makeClaim(),
+                                                    std::memory_order_acquire)) {
+      header->version.store(kVersion, std::memory_order_relaxed);
+      header->slotSize.store(slotSize, std::memory_order_relaxed);
+      header->slotCount.store(slotCount, std::memory_order_relaxed);
+      header->generation.store(1, std::memory_order_relaxed);
+      header->magic.store(kMagic, std::memory_order_release);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  const std::uint32_t magic = header->magic.load(std::memory_order_acquire);
+  if (magic == 0) {
+    ::munmap(address, mappedSize);
+    fail("timed out waiting for another process to initialize the table");
+  }
+  if (magic != kMagic || header->version.load() != kVersion ||
+      header->slotSize.load() != slotSize || header->slotCount.load() != slotCount) {
+    ::munmap(address, mappedSize);
+    fail("table exists with a different version, slot count or size");
+  }
+
+  return std::unique_ptr<SharedResolveTable>{
+      new SharedResolveTable{header, mappedSize, slotCount, slotSize, timeToLive}};
+}
+
+SharedResolveTable::~SharedResolveTable() { ::munmap(header_, mappedSize_); }
+
+#endif
+
+SharedResolveTable::SharedResolveTable(Header* header, const std::size_t mappedSize,
+                                       const std::size_t slotCount, const std::size_t slotSize,
+                                       const std::chrono::seconds timeToLive)
+    : header_{header},
+      mappedSize_{mappedSize},
+      slotCount_{slotCount},
+      slotSize_{slotSize},
+      slotStride_{alignUp(sizeof(Slot) + slotSize)},
+      timeToLive_{timeToLive} {}
+
+std::uint64_t SharedResolveTable::hash(const Bytes& bytes) { return hashBytes(bytes); }
+
+SharedResolveTable::Slot& SharedResolveTable::slot(const std::size_t slotIdx) const {
+  auto* slots = reinterpret_cast<std::byte*>(header_) + alignUp(sizeof(Header));  // NOLINT
+  return *reinterpret_cast<Slot*>(slots + slotIdx * slotStride_);                 // NOLINT
+}
+
+bool SharedResolveTable::lookup(const Bytes& key, Bytes* value) const {
+  const std::uint64_t hash = hashBytes(key);
+  const std::uint64_t generation = header_->generation.load(std::memory_order_acquire);
+  Bytes copy;
+  for (std::size_t offset = 0; offset < kWindowSize; ++offset) {
+    Slot& candidate = slot((hash + offset) % slotCount_);
+    const std::uint64_t sequence = candidate.sequence.load(std::memory_order_acquire);
+    if ((sequence & 1U) != 0 ||
+        candidate.generation.load(std::memory_order_relaxed) != generation ||
+        candidate.hash.load(std::memory_order_relaxed) != hash || isExpired(candidate)) {
+      continue;
+    }
+    const std::size_t keySize = candidate.keySize.load(std::memory_order_relaxed);
+    const std::size_t valueSize = candidate.valueSize.load(std::memory_order_relaxed);
+    if (keySize != key.size() || keySize + valueSize > slotSize_) {
+      continue;
+    }
+    copy.resize(keySize + valueSize);
+    std::memcpy(copy.data(), candidate.data(), copy.size());
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (candidate.sequence.load(std::memory_order_relaxed) != sequence) {
+      // Overwritten whilst copying.
+      continue;
+    }
+    if (std::equal(key.begin(), key.end(), copy.begin())) {
+      value->assign(copy.begin() + static_cast<std::ptrdiff_t>(keySize), copy.end());
+      return true;
+    }
+  }
+  return false;
+}
+
+void SharedResolveTable::insert(const Bytes& key, const Bytes& value) {
+  if (key.size() + value.size() > slotSize_) {
+    return;
+  }
+  const std::uint64_t hash = hashBytes(key);
+  const std::uint64_t generation = header_->generation.load(std::memory_order_acquire);
+
+  // Prefer a slot holding this key, then an invalid or expired slot,
+  // otherwise overwrite an entry.
+  std::size_t target = kWindowSize;
+  for (std::size_t offset = 0; offset < kWindowSize && target == kWindowSize; ++offset) {
+    const Slot& candidate = slot((hash + offset) % slotCount_);
+    if (candidate.generation.load(std::memory_order_relaxed) == generation &&
+        candidate.hash.load(std::memory_order_relaxed) == hash) {
+      target = offset;
+    }
+  }
+  for (std::size_t offset = 0; offset < kWindowSize && target == kWindowSize; ++offset) {
+    const Slot& candidate = slot((hash + offset) % slotCount_);
+    if (candidate.generation.load(std::memory_order_relaxed) != generation ||
+        isExpired(candidate)) {
+      target = offset;
+    }
+  }
+  if (target == kWindowSize) {
+    target = victim_.fetch_add(1, std::memory_order_relaxed) % kWindowSize;
+  }
+
+  Slot& chosen = slot((hash + target) % slotCount_);
+  // If another writer holds the slot, skip, since caching is
+  // best-effort.
+  write(chosen, std::nullopt, [&] {
+    chosen.generation.store(generation, std::memory_order_relaxed);
+    chosen.hash.store(hash, std::memory_order_relaxed);
+    chosen.writeTime.store(now(), std::memory_order_relaxed);
+    chosen.keySize.store(static_cast<std::uint32_t>(key.size()), std::memory_order_relaxed);
+    chosen.valueSize.store(static_cast<std::uint32_t>(value.size()), std::memory_order_relaxed);
+    std::memcpy(chosen.data(), key.data(), key.size());
+    std::memcpy(chosen.data() + key.size(), value.data(), value.size());  // NOLINT
+  });
+}
+
+void SharedResolveTable::erase(const Bytes& key) {
+  const std::uint64_t hash = hashBytes(key);
+  for (std::size_t offset = 0; offset < kWindowSize; ++offset) {
+    Slot& candidate = slot((hash + offset) % slotCount_);
+    if (candidate.hash.load(std::memory_order_relaxed) == hash) {
+      write(candidate, std::nullopt,
+            [&] { candidate.generation.store(0, std::memory_order_relaxed); });
+    }
+  }
+}
+
+void SharedResolveTable::clear() { header_->generation.fetch_add(1, std::memory_order_acq_rel); }
+
+void SharedResolveTable::eraseIf(const std::function<bool(const Bytes& key)>& predicate) {
+  const std::uint64_t generation = header_->generation.load(std::memory_order_acquire);
+  Bytes key;
+  for (std::size_t slotIdx = 0; slotIdx < slotCount_; ++slotIdx) {
+    Slot& candidate = slot(slotIdx);
+    const std::uint64_t sequence = candidate.sequence.load(std::memory_order_acquire);
+    if ((sequence & 1U) != 0 ||
+        candidate.generation.load(std::memory_order_relaxed) != generation) {
+      continue;
+    }
+    const std::size_t keySize = candidate.keySize.load(std::memory_order_relaxed);
+    if (keySize > slotSize_) {
+      continue;
+    }
+    key.resize(keySize);
+    std::memcpy(key.data(), candidate.data(), keySize);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (candidate.sequence.load(std::memory_order_relaxed) != sequence || !predicate(key)) {
+      continue;
+    }
+    // Mark the slot invalid, unless it has since been rewritten.
+    write(candidate, sequence,
+          [&] { candidate.generation.store(0, std::memory_order_relaxed); });
+  }
+}
+
+void SharedResolveTable::validate(const std::string_view token) {
+  // Zero means no token has been given.
+  const std::uint64_t tokenHash = std::max<std::uint64_t>(hashBytes(token), 1);
+  std::uint64_t current = header_->validityToken.load(std::memory_order_acquire);
+  if (current != tokenHash &&
+      header_->validityToken.compare_exchange_strong(current, tokenHash,
+                                                     std::memory_order_acq_rel)) {
+    clear();
+  }
+}
+
+template <class Writer>
+void SharedResolveTable::write(Slot& slot, const std::optional<std::uint64_t> ifSequence,
+                               const Writer& writer) {
+  // Writers exclude each other by claiming the slot, rather than by
+  // the sequence alone, so that a claim abandoned by a crashed writer
+  // can be recognised and taken over.
+  std::uint64_t claim = 0;
+  const std::uint64_t ownClaim = makeClaim();
+  if (!slot.writer.compare_exchange_strong(claim, ownClaim, std::memory_order_acquire) &&
+      (!isAbandoned(claim) ||
+       !slot.writer.compare_exchange_strong(claim, ownClaim, std::memory_order_acquire))) {
+    return;
+  }
+  // Odd if a crashed writer left the slot part-written, in which case
+  // it stays odd until rewritten.
+  const std::uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  if (!ifSequence || *ifSequence == sequence) {
+    slot.sequence.store(sequence | 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    writer();
+    slot.sequence.store((sequence | 1U) + 1, std::memory_order_release);
+  }
+  // Release only our own claim, which is only taken over if this
+  // process has exited.
+  std::uint64_t expectedClaim = ownClaim;
+  slot.writer.compare_exchange_strong(expectedClaim, 0, std::memory_order_release,
+                                      std::memory_order_relaxed);
+}
+
+bool SharedResolveTable::isExpired(const Slot& slot) const {
+  return timeToLive_.count() > 0 &&
+         now() - slot.writeTime.load(std::memory_order_relaxed) > timeToLive_.count();
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
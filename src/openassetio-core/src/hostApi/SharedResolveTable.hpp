@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/serialization.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Fixed-size hash table of encoded key/value pairs, in a named shared
+ * memory segment, such that it can be shared by all processes on a
+ * host.
+ *
+ * Reads are lock-free. Each slot is guarded by a sequence counter
+ * (a "seqlock"): writers make its counter odd whilst writing, and
+ * readers discard any copy taken whilst the counter was odd or
+ * changed. Keys are compared in full, so hash collisions cannot
+ * return the wrong value.
+ *
+ * Writers never block. A writer records a claim, identifying its
+ * process, on the slot, and skips slots claimed by others. If a
+ * process dies mid-write, its claim is taken over by the next writer
+ * of that slot. Likewise, if the process creating the table dies
+ * before initializing it, another process initializes it. Claims of
+ * live processes are never taken over, so processes sharing a table
+ * must be able to see each other's process IDs, i.e. be in the same
+ * PID namespace.
+ *
+ * A key hashes to a short window of consecutive slots. Once the
+ * window is full, an insertion overwrites one of its entries, so the
+ * table never needs to be resized or compacted. Pairs too large for a
+ * slot are not stored.
+ *
+ * @ref clear advances a generation counter, invalidating the entries
+ * of all processes at once. @ref validate does the same whenever the
+ * given token differs from that of the previous call, and entries may
+ * also expire after a fixed time.
+ *
+ * The segment persists until removed from the system, e.g. on reboot,
+ * so that it outlives individual processes. Alternatively, the table
+ * may be mapped from a file, so that it also survives reboots, and a
+ * new process starts with a warm cache.
+ *
+ * Only supported on POSIX platforms.
+ */
+class SharedResolveTable final {
+ public:
+  using Bytes = trait::serialization::Bytes;
+
+  /**
+   * Hash bytes such that the hash is equal in every process, unlike
+   * `std::hash`.
+   */
+  static std::uint64_t hash(const Bytes& bytes);
+
+  /**
+   * Open the named table, creating it if it does not exist.
+   *
+   * @param name Name of the table. Should be short, and contain no
+   * slashes.
+   * @param slotCount Number of slots.
+   * @param slotSize Maximum size of an encoded key and value, in
+   * bytes.
+   * @param timeToLive Age after which entries are ignored, or zero if
+   * they never expire.
+   * @exception errors.InputValidationException If the table cannot be
+   * opened, or exists with a different slot count or size.
+   * @exception errors.NotImplementedException If the platform is not
+   * supported.
+   */
+  static std::unique_ptr<SharedResolveTable> open(const Str& name, std::size_t slotCount,
+                                                  std::size_t slotSize,
+                                                  std::chrono::seconds timeToLive = {});
+
+  /**
+   * Open a table stored in a file, creating it if it does not exist.
+   *
+   * Arguments and exceptions are as for @ref open. A file written by
+   * an incompatible version of the table is rejected.
+   *
+   * A new file is readable and writable by its owner only. Any process
+   * that can write to the file can provide resolved data that every
+   * reader trusts, so sharing it between users is an explicit opt-in,
+   * by creating the file, or changing its permissions, beforehand.
+   */
+  static std::unique_ptr<SharedResolveTable> openFile(const Str& path, std::size_t slotCount,
+                                                      std::size_t slotSize,
+                                                      std::chrono::seconds timeToLive = {});
+
+  /// Unmaps the table, leaving it in place for other processes.
+  ~SharedResolveTable();
+
+  SharedResolveTable(const SharedResolveTable&) = delete;
+  SharedResolveTable(SharedResolveTable&&) noexcept = delete;
+  SharedResolveTable& operator=(const SharedResolveTable&) = delete;
+  SharedResolveTable& operator=(SharedResolveTable&&) noexcept = delete;
+
+  /**
+   * Find the value stored for a key.
+   *
+   * @return `false` if no value is stored, or it was being written.
+   */
+  bool lookup(const Bytes& key, Bytes* value) const;
+
+  /// Store a value for a key, unless it is too large for a slot, or
+  /// the chosen slot is being written by another process.
+  void insert(const Bytes& key, const Bytes& value);
+
+  /// Invalidate any entry for a key, in all processes, e.g. if its
+  /// value is unreadable. Entries whose key has the same hash may also
+  /// be invalidated.
+  void erase(const Bytes& key);
+
+  /// Invalidate all entries, in all processes.
+  void clear();
+
+  /**
+   * Invalidate the entries whose key satisfies a predicate, in all
+   * processes.
+   *
+   * Visits every slot, so is linear in the size of the table. Entries
+   * being written concurrently may be missed.
+   */
+  void eraseIf(const std::function<bool(const Bytes& key)>& predicate);
+
+  /**
+   * Invalidate all entries if the token differs from that last given,
+   * by any process, to this table.
+   *
+   * Typically the token is supplied by the manager, and changes
+   * whenever previously resolved data may be stale.
+   */
+  void validate(std::string_view token);
+
+ private:
+  struct Header;
+  struct Slot;
+
+  SharedResolveTable(Header* header, std::size_t mappedSize, std::size_t slotCount,
+                     std::size_t slotSize, std::chrono::seconds timeToLive);
+
+  static std::unique_ptr<SharedResolveTable> map(int fileDescriptor, const Str& name,
+                                                 std::size_t slotCount, std::size_t slotSize,
+                                                 std::chrono::seconds timeToLive);
+
+  [[nodiscard]] Slot& slot(std::size_t slotIdx) const;
+
+  /**
+   * Claim a slot, and call the writer to update it, unless another
+   * writer holds the slot, or its sequence is not `ifSequence`, if
+   * given.
+   */
+  template <class Writer>
+  static void write(Slot& slot, std::optional<std::uint64_t> ifSequence, const Writer& writer);
+
+  [[nodiscard]] bool isExpired(const Slot& slot) const;
+
+  Header* header_;
+  std::size_t mappedSize_;
+  std::size_t slotCount_;
+  std::size_t slotSize_;
+  std::size_t slotStride_;
+  std::chrono::seconds timeToLive_;
+  /// Rotates the choice of entry overwritten when a window is full.
+  std::atomic<std::size_t> victim_{0};
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
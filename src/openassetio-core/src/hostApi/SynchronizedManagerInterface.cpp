@@ -0,0 +1,531 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/SynchronizedManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+/// Methods whose thread-safety can be declared, by bit position.
+enum class Method : std::uint32_t {
+  kIdentifier,
+  kDisplayName,
+  kHasCapability,
+  kInfo,
+  kUpdateTerminology,
+  kSettings,
+  kFlushCaches,
+  kManagementPolicy,
+  kCreateState,
+  kCreateChildState,
+  kPersistenceTokenForState,
+  kStateFromPersistenceToken,
+  kResetState,
+  kIsEntityReferenceString,
+  kAreEntityReferenceStrings,
+  kEntityExists,
+  kEntityTraits,
+  kResolve,
+  kDefaultEntityReference,
+  kGetWithRelationship,
+  kGetWithRelationships,
+  kGetWithRelationshipsMatrix,
+  kTraverseRelationships,
+  kPreflight,
+  kRegister,
+  kCount
+};
+
+/// Names of methods, as used in the info dictionary, by bit position.
+constexpr std::string_view kMethodNames[] = {
+    "identifier",
+    "displayName",
+    "hasCapability",
+    "info",
+    "updateTerminology",
+    "settings",
+    "flushCaches",
+    "managementPolicy",
+    "createState",
+    "createChildState",
+    "persistenceTokenForState",
+    "stateFromPersistenceToken",
+    "resetState",
+    "isEntityReferenceString",
+    "areEntityReferenceStrings",
+    "entityExists",
+    "entityTraits",
+    "resolve",
+    "defaultEntityReference",
+    "getWithRelationship",
+    "getWithRelationships",
+    "getWithRelationshipsMatrix",
+    "traverseRelationships",
+    "preflight",
+    "register",
+};
+static_assert(std::size(kMethodNames) == static_cast<std::size_t>(Method::kCount));
+
+constexpr std::uint32_t bit(const Method method) {
+  return std::uint32_t{1} << static_cast<std::uint32_t>(method);
+}
+
+/**
+ * Determine the thread-safe methods declared in a manager's info
+ * dictionary.
+ *
+ * @return Bitmask of thread-safe methods.
+ */
+std::uint32_t threadSafeMethodsFromInfo(const InfoDictionary& info) {
+  constexpr std::uint32_t kAll = bit(Method::kCount) - 1;
+
+  if (const auto iter = info.find(constants::kInfoKey_IsThreadSafe); iter != info.end()) {
+    if (const auto* isThreadSafe = std::get_if<Bool>(&iter->second);
+        isThreadSafe && *isThreadSafe) {
+      return kAll;
+    }
+  }
+
+  const auto iter = info.find(constants::kInfoKey_ThreadSafeMethods);
+  if (iter == info.end()) {
+    return 0;
+  }
+  const auto* methodNames = std::get_if<Str>(&iter->second);
+  if (!methodNames) {
+    return 0;
+  }
+
+  std::uint32_t threadSafeMethods = 0;
+  std::string_view remaining{*methodNames};
+  while (!remaining.empty()) {
+    const std::size_t end = remaining.find('\n');
+    const std::string_view name = remaining.substr(0, end);
+    for (std::uint32_t idx = 0; idx < std::size(kMethodNames); ++idx) {
+      if (kMethodNames[idx] == name) {
+        threadSafeMethods |= std::uint32_t{1} << idx;
+      }
+    }
+    remaining = end == std::string_view::npos ? std::string_view{} : remaining.substr(end + 1);
+  }
+  return threadSafeMethods;
+}
+}  // namespace
+
+SynchronizedManagerInterfacePtr SynchronizedManagerInterface::make(
+    managerApi::ManagerInterfacePtr managerInterface) {
+  if (!managerInterface) {
+    throw errors::InputValidationException{"Manager interface cannot be null"};
+  }
+  return SynchronizedManagerInterfacePtr{
+      new SynchronizedManagerInterface{std::move(managerInterface)}};
+}
+
+SynchronizedManagerInterface::SynchronizedManagerInterface(
+    managerApi::ManagerInterfacePtr managerInterface)
+    : managerInterface_{std::move(managerInterface)} {}
+
+bool SynchronizedManagerInterface::isThreadSafe(const std::uint32_t methodBit) const {
+  return (threadSafeMethods_.load(std::memory_order_acquire) & methodBit) != 0;
+}
+
+template <class Func>
+decltype(auto) SynchronizedManagerInterface::call(const std::uint32_t methodBit,
+                                                  const Func& func) const {
+  if (isThreadSafe(methodBit)) {
+    return func();
+  }
+  const std::lock_guard lock{mutex_};
+  return func();
+}
+
+Identifier SynchronizedManagerInterface::identifier() const {
+  return call(bit(Method::kIdentifier), [&] { return managerInterface_->identifier(); });
+}
+
+Str SynchronizedManagerInterface::displayName() const {
+  return call(bit(Method::kDisplayName), [&] { return managerInterface_->displayName(); });
+}
+
+bool SynchronizedManagerInterface::hasCapability(const Capability capability) {
+  return call(bit(Method::kHasCapability),
+              [&] { return managerInterface_->hasCapability(capability); });
+}
+
+InfoDictionary SynchronizedManagerInterface::info() {
+  InfoDictionary info = call(bit(Method::kInfo), [&] { return managerInterface_->info(); });
+  info[constants::kInfoKey_IsThreadSafe] = true;
+  return info;
+}
+
+StrMap SynchronizedManagerInterface::updateTerminology(
+    StrMap terms, const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kUpdateTerminology), [&] {
+    return managerInterface_->updateTerminology(std::move(terms), hostSession);
+  });
+}
+
+InfoDictionary SynchronizedManagerInterface::settings(
+    const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kSettings), [&] { return managerInterface_->settings(hostSession); });
+}
+
+void SynchronizedManagerInterface::initialize(InfoDictionary managerSettings,
+                                              const managerApi::HostSessionPtr& hostSession) {
+  const std::lock_guard lock{mutex_};
+  managerInterface_->initialize(std::move(managerSettings), hostSession);
+  threadSafeMethods_.store(threadSafeMethodsFromInfo(managerInterface_->info()),
+                           std::memory_order_release);
+}
+
+void SynchronizedManagerInterface::flushCaches(const managerApi::HostSessionPtr& hostSession) {
+  call(bit(Method::kFlushCaches), [&] { managerInterface_->flushCaches(hostSession); });
+}
+
+// Targeted flushes share the thread-safety declared for flushCaches.
+void SynchronizedManagerInterface::flushEntityCaches(
+    const EntityReferences& entityReferences, const managerApi::HostSessionPtr& hostSession) {
+  call(bit(Method::kFlushCaches),
+       [&] { managerInterface_->flushEntityCaches(entityReferences, hostSession); });
+}
+
+void SynchronizedManagerInterface::flushCachesWithPrefix(
+    const Str& prefix, const managerApi::HostSessionPtr& hostSession) {
+  call(bit(Method::kFlushCaches),
+       [&] { managerInterface_->flushCachesWithPrefix(prefix, hostSession); });
+}
+
+trait::TraitsDatas SynchronizedManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kManagementPolicy), [&] {
+    return managerInterface_->managementPolicy(traitSets, policyAccess, context, hostSession);
+  });
+}
+
+managerApi::ManagerStateBasePtr SynchronizedManagerInterface::createState(
+    const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kCreateState),
+              [&] { return managerInterface_->createState(hostSession); });
+}
+
+managerApi::ManagerStateBasePtr SynchronizedManagerInterface::createChildState(
+    const managerApi::ManagerStateBasePtr& parentState,
+    const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kCreateChildState),
+              [&] { return managerInterface_->createChildState(parentState, hostSession); });
+}
+
+Str SynchronizedManagerInterface::persistenceTokenForState(
+    const managerApi::ManagerStateBasePtr& state, const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kPersistenceTokenForState),
+              [&] { return managerInterface_->persistenceTokenForState(state, hostSession); });
+}
+
+managerApi::ManagerStateBasePtr SynchronizedManagerInterface::stateFromPersistenceToken(
+    const Str& token, const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kStateFromPersistenceToken),
+              [&] { return managerInterface_->stateFromPersistenceToken(token, hostSession); });
+}
+
+bool SynchronizedManagerInterface::resetState(const managerApi::ManagerStateBasePtr& state,
+                                              const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kResetState),
+              [&] { return managerInterface_->resetState(state, hostSession); });
+}
+
+bool SynchronizedManagerInterface::isEntityReferenceString(
+    const Str& someString, const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kIsEntityReferenceString), [&] {
+    return managerInterface_->isEntityReferenceString(someString, hostSession);
+  });
+}
+
+std::vector<bool> SynchronizedManagerInterface::areEntityReferenceStrings(
+    const std::vector<Str>& someStrings, const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kAreEntityReferenceStrings), [&] {
+    return managerInterface_->areEntityReferenceStrings(someStrings, hostSession);
+  });
+}
+
+void SynchronizedManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                                const ContextConstPtr& context,
+                                                const managerApi::HostSessionPtr& hostSession,
+                                                const ExistsSuccessCallback& successCallback,
+                                                const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kEntityExists), [&] {
+    managerInterface_->entityExists(entityReferences, context, hostSession, successCallback,
+                                    errorCallback);
+  });
+}
+
+managerApi::EntityExistenceFilterConstPtr SynchronizedManagerInterface::entityExistenceFilter(
+    const managerApi::HostSessionPtr& hostSession) {
+  return call(bit(Method::kEntityExists),
+              [&] { return managerInterface_->entityExistenceFilter(hostSession); });
+}
+
+void SynchronizedManagerInterface::entityTraits(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const EntityTraitsSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kEntityTraits), [&] {
+    managerInterface_->entityTraits(entityReferences, entityTraitsAccess, context, hostSession,
+                                    successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::resolve(const EntityReferences& entityReferences,
+                                           const trait::TraitSet& traitSet,
+                                           const access::ResolveAccess resolveAccess,
+                                           const ContextConstPtr& context,
+                                           const managerApi::HostSessionPtr& hostSession,
+                                           const ResolveSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kResolve), [&] {
+    managerInterface_->resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                               successCallback, errorCallback);
+  });
+}
+
+// Heterogeneous, projected and conditional resolves share the
+// thread-safety declared for resolve.
+void SynchronizedManagerInterface::resolveHeterogeneous(
+    const EntityReferences& entityReferences, const trait::TraitSets& traitSets,
+    const std::vector<std::size_t>& traitSetIndices, const access::ResolveAccess resolveAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kResolve), [&] {
+    managerInterface_->resolveHeterogeneous(entityReferences, traitSets, traitSetIndices,
+                                            resolveAccess, context, hostSession,
+                                            successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::resolveProjected(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const trait::PropertyProjection& propertyProjection, const access::ResolveAccess resolveAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kResolve), [&] {
+    managerInterface_->resolveProjected(entityReferences, traitSet, propertyProjection,
+                                        resolveAccess, context, hostSession, successCallback,
+                                        errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::resolveColumnar(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession, trait::TraitsDataTable& results,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kResolve), [&] {
+    managerInterface_->resolveColumnar(entityReferences, traitSet, resolveAccess, context,
+                                       hostSession, results, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::resolveIfChanged(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const std::vector<Str>& generationTokens,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const ConditionalResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kResolve), [&] {
+    managerInterface_->resolveIfChanged(entityReferences, traitSet, resolveAccess,
+                                        generationTokens, context, hostSession, successCallback,
+                                        errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kDefaultEntityReference), [&] {
+    managerInterface_->defaultEntityReference(traitSets, defaultEntityAccess, context,
+                                              hostSession, successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kGetWithRelationship), [&] {
+    managerInterface_->getWithRelationship(entityReferences, relationshipTraitsData,
+                                           resultTraitSet, pageSize, relationsAccess, context,
+                                           hostSession, successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kGetWithRelationships), [&] {
+    managerInterface_->getWithRelationships(entityReference, relationshipTraitsDatas,
+                                            resultTraitSet, pageSize, relationsAccess, context,
+                                            hostSession, successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kGetWithRelationshipsMatrix), [&] {
+    managerInterface_->getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                  resultTraitSet, pageSize, relationsAccess,
+                                                  context, hostSession, successCallback,
+                                                  errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::traverseRelationships(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t maxDepth,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipTraversalSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kTraverseRelationships), [&] {
+    managerInterface_->traverseRelationships(entityReferences, relationshipTraitsDatas,
+                                             resultTraitSet, maxDepth, relationsAccess, context,
+                                             hostSession, successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::preflight(const EntityReferences& entityReferences,
+                                             const trait::TraitsDatas& traitsHints,
+                                             const access::PublishingAccess publishingAccess,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             const PreflightSuccessCallback& successCallback,
+                                             const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kPreflight), [&] {
+    managerInterface_->preflight(entityReferences, traitsHints, publishingAccess, context,
+                                 hostSession, successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::register_(const EntityReferences& entityReferences,
+                                             const trait::TraitsDatas& entityTraitsDatas,
+                                             const access::PublishingAccess publishingAccess,
+                                             const ContextConstPtr& context,
+                                             const managerApi::HostSessionPtr& hostSession,
+                                             const RegisterSuccessCallback& successCallback,
+                                             const BatchElementErrorCallback& errorCallback) {
+  call(bit(Method::kRegister), [&] {
+    managerInterface_->register_(entityReferences, entityTraitsDatas, publishingAccess, context,
+                                 hostSession, successCallback, errorCallback);
+  });
+}
+
+void SynchronizedManagerInterface::entityExistsAsync(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession, ExistsSuccessCallback successCallback,
+    BatchElementErrorCallback errorCallback, CompletionCallback completionCallback) {
+  if (!isThreadSafe(bit(Method::kEntityExists))) {
+    ManagerInterface::entityExistsAsync(entityReferences, context, hostSession,
+                                        std::move(successCallback), std::move(errorCallback),
+                                        std::move(completionCallback));
+    return;
+  }
+  managerInterface_->entityExistsAsync(entityReferences, context, hostSession,
+                                       std::move(successCallback), std::move(errorCallback),
+                                       std::move(completionCallback));
+}
+
+void SynchronizedManagerInterface::entityTraitsAsync(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    EntityTraitsSuccessCallback successCallback, BatchElementErrorCallback errorCallback,
+    CompletionCallback completionCallback) {
+  if (!isThreadSafe(bit(Method::kEntityTraits))) {
+    ManagerInterface::entityTraitsAsync(entityReferences, entityTraitsAccess, context,
+                                        hostSession, std::move(successCallback),
+                                        std::move(errorCallback), std::move(completionCallback));
+    return;
+  }
+  managerInterface_->entityTraitsAsync(entityReferences, entityTraitsAccess, context, hostSession,
+                                       std::move(successCallback), std::move(errorCallback),
+                                       std::move(completionCallback));
+}
+
+void SynchronizedManagerInterface::resolveAsync(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession, ResolveSuccessCallback successCallback,
+    BatchElementErrorCallback errorCallback, CompletionCallback completionCallback) {
+  if (!isThreadSafe(bit(Method::kResolve))) {
+    ManagerInterface::resolveAsync(entityReferences, traitSet, resolveAccess, context,
+                                   hostSession, std::move(successCallback),
+                                   std::move(errorCallback), std::move(completionCallback));
+    return;
+  }
+  managerInterface_->resolveAsync(entityReferences, traitSet, resolveAccess, context, hostSession,
+                                  std::move(successCallback), std::move(errorCallback),
+                                  std::move(completionCallback));
+}
+
+void SynchronizedManagerInterface::preflightAsync(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+    const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession, PreflightSuccessCallback successCallback,
+    BatchElementErrorCallback errorCallback, CompletionCallback completionCallback) {
+  if (!isThreadSafe(bit(Method::kPreflight))) {
+    ManagerInterface::preflightAsync(entityReferences, traitsHints, publishingAccess, context,
+                                     hostSession, std::move(successCallback),
+                                     std::move(errorCallback), std::move(completionCallback));
+    return;
+  }
+  managerInterface_->preflightAsync(entityReferences, traitsHints, publishingAccess, context,
+                                    hostSession, std::move(successCallback),
+                                    std::move(errorCallback), std::move(completionCallback));
+}
+
+void SynchronizedManagerInterface::registerAsync(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& entityTraitsDatas,
+    const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession, RegisterSuccessCallback successCallback,
+    BatchElementErrorCallback errorCallback, CompletionCallback completionCallback) {
+  if (!isThreadSafe(bit(Method::kRegister))) {
+    ManagerInterface::registerAsync(entityReferences, entityTraitsDatas, publishingAccess,
+                                    context, hostSession, std::move(successCallback),
+                                    std::move(errorCallback), std::move(completionCallback));
+    return;
+  }
+  managerInterface_->registerAsync(entityReferences, entityTraitsDatas, publishingAccess, context,
+                                   hostSession, std::move(successCallback),
+                                   std::move(errorCallback), std::move(completionCallback));
+}
+
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
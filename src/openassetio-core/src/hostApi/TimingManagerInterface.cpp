@@ -0,0 +1,350 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include <openassetio/hostApi/TimingManagerInterface.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+namespace {
+/// Timed methods, by index.
+enum class Method : std::size_t {
+  kManagementPolicy,
+  kEntityExists,
+  kEntityTraits,
+  kResolve,
+  kDefaultEntityReference,
+  kGetWithRelationship,
+  kGetWithRelationships,
+  kGetWithRelationshipsMatrix,
+  kTraverseRelationships,
+  kPreflight,
+  kRegister,
+  kEntityExistsAsync,
+  kEntityTraitsAsync,
+  kResolveAsync,
+  kPreflightAsync,
+  kRegisterAsync,
+  kCount
+};
+
+/// Names of timed methods, by index.
+constexpr std::string_view kMethodNames[] = {
+    "managementPolicy",
+    "entityExists",
+    "entityTraits",
+    "resolve",
+    "defaultEntityReference",
+    "getWithRelationship",
+    "getWithRelationships",
+    "getWithRelationshipsMatrix",
+    "traverseRelationships",
+    "preflight",
+    "register",
+    "entityExistsAsync",
+    "entityTraitsAsync",
+    "resolveAsync",
+    "preflightAsync",
+    "registerAsync",
+};
+
+constexpr std::size_t index(const Method method) { return static_cast<std::size_t>(method); }
+
+static_assert(std::size(kMethodNames) == index(Method::kCount));
+
+using Clock = std::chrono::steady_clock;
+}  // namespace
+
+/// Per-method call counts and durations.
+struct TimingManagerInterface::Counters {
+  struct Counter {
+    std::atomic<std::size_t> calls{0};
+    std::atomic<std::int64_t> nanoseconds{0};
+  };
+
+  /// Record a call to `method` that started at `start`.
+  void record(const std::size_t method, const Clock::time_point start) {
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+    Counter& counter = counters[method];
+    counter.nanoseconds.fetch_add(duration.count(), std::memory_order_relaxed);
+    counter.calls.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Record the duration of a call on destruction, even if it threw.
+  class Stopwatch {
+   public:
+    Stopwatch(Counters& counters, const std::size_t method)
+        : counters_{counters}, method_{method}, start_{Clock::now()} {}
+    ~Stopwatch() { counters_.record(method_, start_); }
+    Stopwatch(const Stopwatch&) = delete;
+    Stopwatch& operator=(const Stopwatch&) = delete;
+    Stopwatch(Stopwatch&&) = delete;
+    Stopwatch& operator=(Stopwatch&&) = delete;
+
+   private:
+    Counters& counters_;
+    const std::size_t method_;
+    const Clock::time_point start_;
+  };
+
+  std::array<Counter, index(Method::kCount)> counters;
+};
+
+TimingManagerInterfacePtr TimingManagerInterface::make(managerApi::ManagerInterfacePtr proxied) {
+  return TimingManagerInterfacePtr{new TimingManagerInterface{std::move(proxied)}};
+}
+
+TimingManagerInterface::TimingManagerInterface(managerApi::ManagerInterfacePtr proxied)
+    : ProxyManagerInterface{std::move(proxied)}, counters_{std::make_shared<Counters>()} {}
+
+TimingManagerInterface::Statistics TimingManagerInterface::statistics() const {
+  Statistics statistics;
+  for (std::size_t idx = 0; idx < counters_->counters.size(); ++idx) {
+    const Counters::Counter& counter = counters_->counters[idx];
+    statistics[Str{kMethodNames[idx]}] = {
+        counter.calls.load(std::memory_order_relaxed),
+        std::chrono::nanoseconds{counter.nanoseconds.load(std::memory_order_relaxed)}};
+  }
+  return statistics;
+}
+
+void TimingManagerInterface::resetStatistics() {
+  for (Counters::Counter& counter : counters_->counters) {
+    counter.calls.store(0, std::memory_order_relaxed);
+    counter.nanoseconds.store(0, std::memory_order_relaxed);
+  }
+}
+
+template <class Func>
+decltype(auto) TimingManagerInterface::timed(const std::size_t method, const Func& func) {
+  const Counters::Stopwatch stopwatch{*counters_, method};
+  return func();
+}
+
+TimingManagerInterface::CompletionCallback TimingManagerInterface::timedCompletion(
+    const std::size_t method, CompletionCallback completionCallback) {
+  return [counters = counters_, method, start = Clock::now(),
+          completionCallback = std::move(completionCallback)](std::exception_ptr exception) {
+    counters->record(method, start);
+    completionCallback(std::move(exception));
+  };
+}
+
+trait::TraitsDatas TimingManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) {
+  return timed(index(Method::kManagementPolicy), [&] {
+    return proxied()->managementPolicy(traitSets, policyAccess, context, hostSession);
+  });
+}
+
+void TimingManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                          const ContextConstPtr& context,
+                                          const managerApi::HostSessionPtr& hostSession,
+                                          const ExistsSuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kEntityExists), [&] {
+    proxied()->entityExists(entityReferences, context, hostSession, successCallback,
+                            errorCallback);
+  });
+}
+
+void TimingManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                          const access::EntityTraitsAccess entityTraitsAccess,
+                                          const ContextConstPtr& context,
+                                          const managerApi::HostSessionPtr& hostSession,
+                                          const EntityTraitsSuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kEntityTraits), [&] {
+    proxied()->entityTraits(entityReferences, entityTraitsAccess, context, hostSession,
+                            successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                     const trait::TraitSet& traitSet,
+                                     const access::ResolveAccess resolveAccess,
+                                     const ContextConstPtr& context,
+                                     const managerApi::HostSessionPtr& hostSession,
+                                     const ResolveSuccessCallback& successCallback,
+                                     const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kResolve), [&] {
+    proxied()->resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                       successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kDefaultEntityReference), [&] {
+    proxied()->defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession,
+                                      successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kGetWithRelationship), [&] {
+    proxied()->getWithRelationship(entityReferences, relationshipTraitsData, resultTraitSet,
+                                   pageSize, relationsAccess, context, hostSession,
+                                   successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kGetWithRelationships), [&] {
+    proxied()->getWithRelationships(entityReference, relationshipTraitsDatas, resultTraitSet,
+                                    pageSize, relationsAccess, context, hostSession,
+                                    successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kGetWithRelationshipsMatrix), [&] {
+    proxied()->getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                          resultTraitSet, pageSize, relationsAccess, context,
+                                          hostSession, successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::traverseRelationships(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t maxDepth,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const managerApi::HostSessionPtr& hostSession,
+    const RelationshipTraversalSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kTraverseRelationships), [&] {
+    proxied()->traverseRelationships(entityReferences, relationshipTraitsDatas, resultTraitSet,
+                                     maxDepth, relationsAccess, context, hostSession,
+                                     successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::preflight(const EntityReferences& entityReferences,
+                                       const trait::TraitsDatas& traitsHints,
+                                       const access::PublishingAccess publishingAccess,
+                                       const ContextConstPtr& context,
+                                       const managerApi::HostSessionPtr& hostSession,
+                                       const PreflightSuccessCallback& successCallback,
+                                       const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kPreflight), [&] {
+    proxied()->preflight(entityReferences, traitsHints, publishingAccess, context, hostSession,
+                         successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::register_(const EntityReferences& entityReferences,
+                                       const trait::TraitsDatas& entityTraitsDatas,
+                                       const access::PublishingAccess publishingAccess,
+                                       const ContextConstPtr& context,
+                                       const managerApi::HostSessionPtr& hostSession,
+                                       const RegisterSuccessCallback& successCallback,
+                                       const BatchElementErrorCallback& errorCallback) {
+  timed(index(Method::kRegister), [&] {
+    proxied()->register_(entityReferences, entityTraitsDatas, publishingAccess, context,
+                         hostSession, successCallback, errorCallback);
+  });
+}
+
+void TimingManagerInterface::entityExistsAsync(const EntityReferences& entityReferences,
+                                               const ContextConstPtr& context,
+                                               const managerApi::HostSessionPtr& hostSession,
+                                               ExistsSuccessCallback successCallback,
+                                               BatchElementErrorCallback errorCallback,
+                                               CompletionCallback completionCallback) {
+  proxied()->entityExistsAsync(
+      entityReferences, context, hostSession, std::move(successCallback), std::move(errorCallback),
+      timedCompletion(index(Method::kEntityExistsAsync), std::move(completionCallback)));
+}
+
+void TimingManagerInterface::entityTraitsAsync(const EntityReferences& entityReferences,
+                                               const access::EntityTraitsAccess entityTraitsAccess,
+                                               const ContextConstPtr& context,
+                                               const managerApi::HostSessionPtr& hostSession,
+                                               EntityTraitsSuccessCallback successCallback,
+                                               BatchElementErrorCallback errorCallback,
+                                               CompletionCallback completionCallback) {
+  proxied()->entityTraitsAsync(
+      entityReferences, entityTraitsAccess, context, hostSession, std::move(successCallback),
+      std::move(errorCallback),
+      timedCompletion(index(Method::kEntityTraitsAsync), std::move(completionCallback)));
+}
+
+void TimingManagerInterface::resolveAsync(const EntityReferences& entityReferences,
+                                          const trait::TraitSet& traitSet,
+                                          const access::ResolveAccess resolveAccess,
+                                          const ContextConstPtr& context,
+                                          const managerApi::HostSessionPtr& hostSession,
+                                          ResolveSuccessCallback successCallback,
+                                          BatchElementErrorCallback errorCallback,
+                                          CompletionCallback completionCallback) {
+  proxied()->resolveAsync(
+      entityReferences, traitSet, resolveAccess, context, hostSession, std::move(successCallback),
+      std::move(errorCallback),
+      timedCompletion(index(Method::kResolveAsync), std::move(completionCallback)));
+}
+
+void TimingManagerInterface::preflightAsync(const EntityReferences& entityReferences,
+                                            const trait::TraitsDatas& traitsHints,
+                                            const access::PublishingAccess publishingAccess,
+                                            const ContextConstPtr& context,
+                                            const managerApi::HostSessionPtr& hostSession,
+                                            PreflightSuccessCallback successCallback,
+                                            BatchElementErrorCallback errorCallback,
+                                            CompletionCallback completionCallback) {
+  proxied()->preflightAsync(
+      entityReferences, traitsHints, publishingAccess, context, hostSession,
+      std::move(successCallback), std::move(errorCallback),
+      timedCompletion(index(Method::kPreflightAsync), std::move(completionCallback)));
+}
+
+void TimingManagerInterface::registerAsync(const EntityReferences& entityReferences,
+                                           const trait::TraitsDatas& entityTraitsDatas,
+                                           const access::PublishingAccess publishingAccess,
+                                           const ContextConstPtr& context,
+                                           const managerApi::HostSessionPtr& hostSession,
+                                           RegisterSuccessCallback successCallback,
+                                           BatchElementErrorCallback errorCallback,
+                                           CompletionCallback completionCallback) {
+  proxied()->registerAsync(
+      entityReferences, entityTraitsDatas, publishingAccess, context, hostSession,
+      std::move(successCallback), std::move(errorCallback),
+      timedCompletion(index(Method::kRegisterAsync), std::move(completionCallback)));
+}
+
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
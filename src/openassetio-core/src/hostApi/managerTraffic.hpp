@@ -0,0 +1,358 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Binary format of manager traffic logs, shared by the
+ * RecordingManagerInterface and ManagerTrafficReplayer.
+ *
+ * A log begins with an 8 byte header: the four byte magic `OAMT`, a
+ * little-endian `uint16` format version, and a reserved `uint16` that
+ * must be zero. The header is followed by any number of records, each
+ * prefixed by its `uint32` length in bytes.
+ *
+ * A record begins with a `uint8` @ref RecordKind.
+ *
+ * - A context record holds a `uint32` context ID, followed by the
+ *   Context's locale as a length-prefixed TraitsData serialisation
+ *   (see trait/serialization.hpp), or a zero length if it has no
+ *   locale. A context record precedes the first call that uses it.
+ * - A call record holds a `uint8` @ref Method, a `uint8` bitmask of
+ *   @ref CallFlags, the `uint64` start time of the call in nanoseconds
+ *   since recording began, its `uint64` duration in nanoseconds, the
+ *   `uint32` ID of its context (zero if null), the `uint32` number of
+ *   elements reported via the success and error callbacks, and the
+ *   method's arguments.
+ *
+ * Strings and blobs are a `uint32` length followed by their bytes. All
+ * multi-byte integers are little-endian.
+ *
+ * The Encoder and Decoder are also used for the messages exchanged
+ * with out-of-process managers, see remoteManagerProtocol.hpp.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/serialization.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi::managerTraffic {
+using Bytes = trait::serialization::Bytes;
+
+/// Magic bytes at the start of a log.
+constexpr std::array<char, 4> kMagic{'O', 'A', 'M', 'T'};
+
+/// Current version of the log format.
+constexpr std::uint16_t kFormatVersion = 1;
+
+/// Size of the header at the start of a log.
+constexpr std::size_t kHeaderSize = 8;
+
+/// Type of a record.
+enum class RecordKind : std::uint8_t { kContext, kCall };
+
+/// Recorded ManagerInterface methods, whose values form the format.
+enum class Method : std::uint8_t {
+  kManagementPolicy,
+  kEntityExists,
+  kEntityTraits,
+  kResolve,
+  kDefaultEntityReference,
+  kGetWithRelationship,
+  kGetWithRelationships,
+  kGetWithRelationshipsMatrix,
+  kPreflight,
+  kRegister,
+  kCount
+};
+
+/// Names of recorded methods, indexed by Method.
+constexpr std::array<std::string_view, static_cast<std::size_t>(Method::kCount)> kMethodNames{
+    "managementPolicy",
+    "entityExists",
+    "entityTraits",
+    "resolve",
+    "defaultEntityReference",
+    "getWithRelationship",
+    "getWithRelationships",
+    "getWithRelationshipsMatrix",
+    "preflight",
+    "register"};
+
+/// Bits of the flags of a call record.
+enum CallFlags : std::uint8_t {
+  /// The call failed with an exception.
+  kRaisedException = 1U << 0U,
+  /// The call was made via the asynchronous variant of the method.
+  kAsync = 1U << 1U,
+};
+
+/// Index of `T` in InfoDictionaryValue, used to tag encoded values.
+template <class T, std::size_t kIdx = 0>
+constexpr std::uint8_t infoValueIndex() {
+  if constexpr (std::is_same_v<std::variant_alternative_t<kIdx, InfoDictionaryValue>, T>) {
+    return kIdx;
+  } else {
+    return infoValueIndex<T, kIdx + 1>();
+  }
+}
+
+/**
+ * Encoding of little-endian values, appended to a buffer.
+ */
+class Encoder {
+ public:
+  explicit Encoder(Bytes* out) : out_{out} {}
+
+  template <class T>
+  void writeUInt(T value) {
+    static_assert(std::is_unsigned_v<T>);
+    for (std::size_t byteIdx = 0; byteIdx < sizeof(T); ++byteIdx) {
+      out_->push_back(static_cast<std::byte>((value >> (byteIdx * 8U)) & 0xFFU));
+    }
+  }
+
+  /// Write an enum by its underlying value.
+  template <class Enum>
+  void writeEnum(const Enum value) {
+    writeUInt(static_cast<std::uint8_t>(value));
+  }
+
+  void writeLength(const std::size_t length) {
+    writeUInt(static_cast<std::uint32_t>(length));
+  }
+
+  void writeStr(const std::string_view str) {
+    writeLength(str.size());
+    const auto* bytes = reinterpret_cast<const std::byte*>(  // NOLINT(*-reinterpret-cast)
+        str.data());
+    out_->insert(out_->end(), bytes, bytes + str.size());  // NOLINT(*-pointer-arithmetic)
+  }
+
+  void writeBlob(const Bytes& blob) {
+    writeLength(blob.size());
+    out_->insert(out_->end(), blob.begin(), blob.end());
+  }
+
+  void writeEntityReferences(const EntityReferences& entityReferences) {
+    writeLength(entityReferences.size());
+    for (const EntityReference& entityReference : entityReferences) {
+      writeStr(entityReference.toString());
+    }
+  }
+
+  void writeTraitSet(const trait::TraitSet& traitSet) {
+    writeLength(traitSet.size());
+    for (const trait::TraitId& traitId : traitSet) {
+      writeStr(traitId);
+    }
+  }
+
+  void writeTraitSets(const trait::TraitSets& traitSets) {
+    writeLength(traitSets.size());
+    for (const trait::TraitSet& traitSet : traitSets) {
+      writeTraitSet(traitSet);
+    }
+  }
+
+  /// Write a TraitsData, or an empty blob if null.
+  void writeTraitsData(const trait::TraitsDataPtr& traitsData) {
+    if (!traitsData) {
+      writeLength(0);
+      return;
+    }
+    writeBlob(trait::serialization::serialize(*traitsData));
+  }
+
+  /// Write a list of TraitsData, substituting empty instances for
+  /// null elements, which are not supported by the serialisation.
+  void writeTraitsDatas(const trait::TraitsDatas& traitsDatas) {
+    if (std::find(traitsDatas.begin(), traitsDatas.end(), nullptr) == traitsDatas.end()) {
+      writeBlob(trait::serialization::serialize(traitsDatas));
+      return;
+    }
+    trait::TraitsDatas nonNull = traitsDatas;
+    for (trait::TraitsDataPtr& traitsData : nonNull) {
+      if (!traitsData) {
+        traitsData = trait::TraitsData::make();
+      }
+    }
+    writeBlob(trait::serialization::serialize(nonNull));
+  }
+
+  /// Write a value, tagged with the index of its type in
+  /// InfoDictionaryValue, which is shared by trait property values.
+  void writeValue(const InfoDictionaryValue& value) {
+    writeUInt(static_cast<std::uint8_t>(value.index()));
+    std::visit(
+        [this](const auto& typedValue) {
+          using Value = std::decay_t<decltype(typedValue)>;
+          if constexpr (std::is_same_v<Value, Bool>) {
+            writeUInt(static_cast<std::uint8_t>(typedValue));
+          } else if constexpr (std::is_same_v<Value, Int>) {
+            writeUInt(static_cast<std::uint64_t>(typedValue));
+          } else if constexpr (std::is_same_v<Value, Float>) {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &typedValue, sizeof(bits));
+            writeUInt(bits);
+          } else {
+            writeStr(typedValue);
+          }
+        },
+        value);
+  }
+
+  void writeInfoDictionary(const InfoDictionary& infoDictionary) {
+    writeLength(infoDictionary.size());
+    for (const auto& [key, value] : infoDictionary) {
+      writeStr(key);
+      writeValue(value);
+    }
+  }
+
+ private:
+  Bytes* out_;
+};
+
+/**
+ * Bounds-checked decoding of little-endian values from a buffer.
+ */
+class Decoder {
+ public:
+  Decoder(const std::byte* data, const std::size_t size) : data_{data}, size_{size} {}
+
+  template <class T>
+  T readUInt() {
+    static_assert(std::is_unsigned_v<T>);
+    const std::byte* bytes = take(sizeof(T));
+    T value = 0;
+    for (std::size_t byteIdx = 0; byteIdx < sizeof(T); ++byteIdx) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      value |= static_cast<T>(static_cast<T>(bytes[byteIdx]) << (byteIdx * 8U));
+    }
+    return value;
+  }
+
+  template <class Enum>
+  Enum readEnum() {
+    return static_cast<Enum>(readUInt<std::uint8_t>());
+  }
+
+  std::size_t readLength() { return readUInt<std::uint32_t>(); }
+
+  std::string_view readStr() {
+    const std::size_t length = readLength();
+    return {reinterpret_cast<const char*>(take(length)),  // NOLINT(*-reinterpret-cast)
+            length};
+  }
+
+  /// Read a blob, returning a pointer to its start and its size.
+  std::pair<const std::byte*, std::size_t> readBlob() {
+    const std::size_t length = readLength();
+    return {take(length), length};
+  }
+
+  EntityReferences readEntityReferences() {
+    EntityReferences entityReferences;
+    const std::size_t count = readLength();
+    entityReferences.reserve(count);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      entityReferences.emplace_back(Str{readStr()});
+    }
+    return entityReferences;
+  }
+
+  trait::TraitSet readTraitSet() {
+    trait::TraitSet traitSet;
+    const std::size_t count = readLength();
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      traitSet.emplace(readStr());
+    }
+    return traitSet;
+  }
+
+  trait::TraitSets readTraitSets() {
+    trait::TraitSets traitSets;
+    const std::size_t count = readLength();
+    traitSets.reserve(count);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      traitSets.push_back(readTraitSet());
+    }
+    return traitSets;
+  }
+
+  /// Read a TraitsData, or null if the blob is empty.
+  trait::TraitsDataPtr readTraitsData() {
+    const auto [data, size] = readBlob();
+    if (size == 0) {
+      return nullptr;
+    }
+    return trait::serialization::deserialize(data, size);
+  }
+
+  trait::TraitsDatas readTraitsDatas() {
+    const auto [data, size] = readBlob();
+    return trait::serialization::deserializeMany(data, size);
+  }
+
+  InfoDictionary readInfoDictionary() {
+    InfoDictionary infoDictionary;
+    const std::size_t count = readLength();
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      Str key{readStr()};
+      switch (readUInt<std::uint8_t>()) {
+        case infoValueIndex<Bool>():
+          infoDictionary.emplace(std::move(key), readUInt<std::uint8_t>() != 0);
+          break;
+        case infoValueIndex<Int>():
+          infoDictionary.emplace(std::move(key), static_cast<Int>(readUInt<std::uint64_t>()));
+          break;
+        case infoValueIndex<Float>(): {
+          const auto bits = readUInt<std::uint64_t>();
+          Float value = 0;
+          std::memcpy(&value, &bits, sizeof(value));
+          infoDictionary.emplace(std::move(key), value);
+          break;
+        }
+        case infoValueIndex<Str>():
+          infoDictionary.emplace(std::move(key), Str{readStr()});
+          break;
+        default:
+          throw errors::InputValidationException{"Manager traffic record has an invalid value"};
+      }
+    }
+    return infoDictionary;
+  }
+
+ private:
+  const std::byte* take(const std::size_t count) {
+    if (count > size_ - pos_) {
+      throw errors::InputValidationException{"Manager traffic log record is truncated"};
+    }
+    const std::byte* bytes = data_ + pos_;  // NOLINT(*-pointer-arithmetic)
+    pos_ += count;
+    return bytes;
+  }
+
+  const std::byte* data_;
+  std::size_t size_;
+  std::size_t pos_{0};
+};
+}  // namespace hostApi::managerTraffic
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
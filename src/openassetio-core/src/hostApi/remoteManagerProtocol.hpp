@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Messages exchanged between a RemoteManagerInterface and a
+ * RemoteManagerServer over a SharedMemoryChannel.
+ *
+ * Values are encoded using the managerTraffic Encoder and Decoder.
+ *
+ * A request begins with a `uint8` @ref Request, followed by the
+ * arguments of the corresponding ManagerInterface method, in order,
+ * omitting the host session and callbacks. Access modes are encoded as
+ * a `uint8`, and a Context as its locale TraitsData.
+ *
+ * A response begins with a `uint8` @ref Status. If the method raised
+ * an exception, it is followed by the exception's message. Otherwise
+ * it is followed by the method's return value, if any, or for batch
+ * methods by the `uint32` number of @ref Event "events" and a blob
+ * holding them. Each event is a `uint8` @ref Event and the `uint32`
+ * index of its element, followed by either the success value, or the
+ * `uint32` BatchElementError code and its message.
+ *
+ * A @ref Request::kDescribe response holds the manager's identifier,
+ * display name, info and a `uint32` bitmask of its supported @ref
+ * kCapabilities.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <openassetio/export.h>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+#include "managerTraffic.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi::remoteManager {
+using managerTraffic::Bytes;
+using managerTraffic::Decoder;
+using managerTraffic::Encoder;
+
+/// Methods that may be requested, whose values form the protocol.
+enum class Request : std::uint8_t {
+  kDescribe,
+  kInitialize,
+  kSettings,
+  kFlushCaches,
+  kManagementPolicy,
+  kIsEntityReferenceString,
+  kEntityExists,
+  kEntityTraits,
+  kResolve,
+  kDefaultEntityReference,
+  kPreflight,
+  kRegister,
+  kFlushEntityCaches,
+  kFlushCachesWithPrefix
+};
+
+/// Outcome of a request.
+enum class Status : std::uint8_t { kOk, kException };
+
+/// Type of a batch element result.
+enum class Event : std::uint8_t { kSuccess, kError };
+
+/**
+ * Capabilities that may be served remotely.
+ *
+ * Manager state cannot cross process boundaries, and relationship
+ * queries return pagers that hold a live connection, so neither is
+ * supported.
+ */
+inline constexpr std::array kCapabilities{
+    managerApi::ManagerInterface::Capability::kEntityReferenceIdentification,
+    managerApi::ManagerInterface::Capability::kManagementPolicyQueries,
+    managerApi::ManagerInterface::Capability::kEntityTraitIntrospection,
+    managerApi::ManagerInterface::Capability::kResolution,
+    managerApi::ManagerInterface::Capability::kPublishing,
+    managerApi::ManagerInterface::Capability::kExistenceQueries,
+    managerApi::ManagerInterface::Capability::kDefaultEntityReferences};
+
+/// Bit of a capability in the mask of a describe response.
+constexpr std::uint32_t capabilityBit(const managerApi::ManagerInterface::Capability capability) {
+  return 1U << static_cast<std::uint32_t>(capability);
+}
+}  // namespace hostApi::remoteManager
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/terminology.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi::terminology {
+
+StrMap defaultTerminology() {
+  return {{Str{kTerm_Asset}, "Asset"},
+          {Str{kTerm_Assets}, "Assets"},
+          {Str{kTerm_Manager}, "Asset Manager"},
+          {Str{kTerm_Publish}, "Publish"},
+          {Str{kTerm_Publishing}, "Publishing"},
+          {Str{kTerm_Published}, "Published"},
+          {Str{kTerm_Shot}, "Shot"},
+          {Str{kTerm_Shots}, "Shots"}};
+}
+
+Template::Template(const std::string_view sourceStr) {
+  text_.reserve(sourceStr.size());
+  for (std::size_t idx = 0; idx < sourceStr.size(); ++idx) {
+    const char chr = sourceStr[idx];
+    if (chr == '}') {
+      continue;
+    }
+    if (chr != '{') {
+      text_.push_back(chr);
+      continue;
+    }
+    // A token extends to the next closing brace, unless another
+    // opening brace comes first, in which case this one is discarded.
+    const std::size_t end = sourceStr.find_first_of("{}", idx + 1);
+    if (end == std::string_view::npos || sourceStr[end] == '{') {
+      continue;
+    }
+    tokens_.push_back({text_.size(), end - idx - 1});
+    text_.append(sourceStr.substr(idx + 1, end - idx - 1));
+    idx = end;
+  }
+}
+
+MapperPtr Mapper::make(const ManagerPtr& manager, StrMap terminology) {
+  if (!manager) {
+    throw errors::InputValidationException{"Mapper requires a Manager"};
+  }
+  if (manager->hasCapability(Manager::Capability::kCustomTerminology)) {
+    terminology = manager->updateTerminology(std::move(terminology));
+  }
+  terminology.insert_or_assign(Str{kTerm_Manager}, manager->displayName());
+  return std::shared_ptr<Mapper>(new Mapper(std::move(terminology)));
+}
+
+Mapper::Mapper(StrMap terminology) : terminology_{std::move(terminology)} {}
+
+Str Mapper::replaceTerms(const std::string_view sourceStr) const {
+  return replaceTerms(Template{sourceStr});
+}
+
+Str Mapper::replaceTerms(const Template& sourceTemplate) const {
+  const std::string_view text = sourceTemplate.text_;
+  // Check all tokens are known, and size the result, before building
+  // it, so that only a single allocation is needed.
+  std::size_t size = text.size();
+  for (const Template::Token& token : sourceTemplate.tokens_) {
+    const auto iter = terminology_.find(text.substr(token.offset, token.length));
+    if (iter == terminology_.end()) {
+      return sourceTemplate.text_;
+    }
+    size = size - token.length + iter->second.size();
+  }
+
+  Str result;
+  result.reserve(size);
+  std::size_t literalStart = 0;
+  for (const Template::Token& token : sourceTemplate.tokens_) {
+    result.append(text.substr(literalStart, token.offset - literalStart));
+    result.append(terminology_.at(text.substr(token.offset, token.length)));
+    literalStart = token.offset + token.length;
+  }
+  result.append(text.substr(literalStart));
+  return result;
+}
+
+std::vector<Str> Mapper::replaceTerms(const std::vector<Str>& sourceStrs) const {
+  std::vector<Str> results;
+  results.reserve(sourceStrs.size());
+  for (const Str& sourceStr : sourceStrs) {
+    results.push_back(replaceTerms(sourceStr));
+  }
+  return results;
+}
+
+std::vector<Str> Mapper::replaceTerms(const std::vector<Template>& sourceTemplates) const {
+  std::vector<Str> results;
+  results.reserve(sourceTemplates.size());
+  for (const Template& sourceTemplate : sourceTemplates) {
+    results.push_back(replaceTerms(sourceTemplate));
+  }
+  return results;
+}
+
+Str Mapper::term(const std::string_view key, const std::string_view defaultValue) const {
+  if (const auto iter = terminology_.find(key); iter != terminology_.end()) {
+    return iter->second;
+  }
+  return Str{defaultValue};
+}
+}  // namespace hostApi::terminology
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
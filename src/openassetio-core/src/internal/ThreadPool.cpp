@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace internal {
+
+ThreadPool::ThreadPool(const std::size_t threadCount) {
+  threads_.reserve(threadCount);
+  for (std::size_t idx = 0; idx < threadCount; ++idx) {
+    threads_.emplace_back([this] { work(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard lock{mutex_};
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::submit(Task task) {
+  {
+    const std::lock_guard lock{mutex_};
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+void ThreadPool::parallelFor(const std::size_t count,
+                             const std::function<void(std::size_t)>& func) {
+  if (count == 0) {
+    return;
+  }
+
+  // Shared, since helper tasks may be dequeued after we return, if
+  // other participants have already claimed all the work. Such tasks
+  // must not touch `func`.
+  struct State {
+    std::atomic<std::size_t> next{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t completed = 0;
+    std::exception_ptr exception;
+  };
+  const auto state = std::make_shared<State>();
+
+  const auto drain = [count](State& shared, const std::function<void(std::size_t)>& fn) {
+    for (std::size_t idx = shared.next.fetch_add(1); idx < count;
+         idx = shared.next.fetch_add(1)) {
+      std::exception_ptr exception;
+      try {
+        fn(idx);
+      } catch (...) {
+        exception = std::current_exception();
+      }
+      const std::lock_guard lock{shared.mutex};
+      if (exception && !shared.exception) {
+        shared.exception = std::move(exception);
+      }
+      if (++shared.completed == count) {
+        shared.condition.notify_all();
+      }
+    }
+  };
+
+  const std::size_t helperCount = std::min(count - 1, threads_.size());
+  for (std::size_t idx = 0; idx < helperCount; ++idx) {
+    submit([state, drain, &func] { drain(*state, func); });
+  }
+  drain(*state, func);
+
+  std::unique_lock lock{state->mutex};
+  state->condition.wait(lock, [&] { return state->completed == count; });
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+ThreadPool& ThreadPool::defaultPool() {
+  // Deliberately leaked, since destruction would run the remaining
+  // queued tasks during static destruction.
+  static ThreadPool* const kPool = [] {
+    // Hardware concurrency may be reported as 0 if unknown, and we
+    // want some overlap even on a single core, e.g. whilst tasks block
+    // on I/O.
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* pool = new ThreadPool{std::max(2U, std::thread::hardware_concurrency())};
+    // Registered after any static constructed before the pool, so
+    // runs before such statics are destroyed.
+    std::atexit([] { defaultPool().abandon(); });
+    return pool;
+  }();
+  return *kPool;
+}
+
+void ThreadPool::abandon() {
+  {
+    const std::lock_guard lock{mutex_};
+    abandoned_ = true;
+  }
+  condition_.notify_all();
+}
+
+void ThreadPool::work() {
+  while (true) {
+    Task task;
+    {
+      std::unique_lock lock{mutex_};
+      condition_.wait(lock, [this] { return stopping_ || abandoned_ || !tasks_.empty(); });
+      if (abandoned_ || tasks_.empty()) {
+        // Abandoned, or stopping and queue drained.
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+}  // namespace internal
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace internal {
+/**
+ * Fixed-size pool of worker threads servicing a FIFO task queue.
+ *
+ * Used to adapt synchronous API methods into asynchronous ones, and
+ * to fan out large batches.
+ */
+class ThreadPool {
+ public:
+  /// Task signature. Tasks must not throw.
+  using Task = std::function<void()>;
+
+  explicit ThreadPool(std::size_t threadCount);
+
+  /// Run any remaining queued tasks, then join worker threads.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  /// Queue a task for execution on a worker thread.
+  void submit(Task task);
+
+  /**
+   * Call `func` with each index in `[0, count)`, concurrently across
+   * worker threads and the calling thread, blocking until all calls
+   * have completed.
+   *
+   * The calling thread participates in the work, so this is safe to
+   * call from a worker thread of the same pool without deadlock.
+   *
+   * If any call throws, the first exception is rethrown once all calls
+   * have completed.
+   */
+  void parallelFor(std::size_t count, const std::function<void(std::size_t)>& func);
+
+  /**
+   * Process-wide pool, sized by the hardware concurrency, created on
+   * first use.
+   *
+   * The pool is never destroyed. Instead, on exit, its workers stop
+   * taking queued tasks, so that no task starts during static
+   * destruction, when state it depends on may have been destroyed.
+   * Tasks already running are not waited for.
+   */
+  static ThreadPool& defaultPool();
+
+ private:
+  void work();
+
+  /// Stop workers taking further tasks, without waiting for them.
+  void abandon();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<Task> tasks_;
+  bool stopping_ = false;
+  bool abandoned_ = false;
+  std::vector<std::thread> threads_;
+};
+}  // namespace internal
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
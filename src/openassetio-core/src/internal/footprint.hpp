@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace internal::footprint {
+/**
+ * Estimates of the heap memory used by standard containers, for
+ * memory footprint reporting.
+ *
+ * Node overheads assume the layouts common to the mainstream standard
+ * libraries: doubly linked list nodes, and singly linked hash table
+ * nodes with a cached hash and an array of bucket pointers. Allocator
+ * bookkeeping is not included.
+ */
+
+/// Bytes of the `std::shared_ptr` control block allocated alongside
+/// an object by `std::make_shared`, i.e. vtable and reference counts.
+constexpr std::size_t kControlBlockBytes = 2 * sizeof(void*);
+
+/// Heap bytes of a string's buffer, or zero if the string is small
+/// enough to be held inline.
+inline std::size_t heapBytes(const Str& str) {
+  static const std::size_t kInlineCapacity = Str{}.capacity();
+  return str.capacity() > kInlineCapacity ? str.capacity() + 1 : 0;
+}
+
+/// Heap bytes of a vector's buffer, excluding any heap memory owned by
+/// its elements.
+template <class T, class Allocator>
+std::size_t heapBytes(const std::vector<T, Allocator>& vec) {
+  return vec.capacity() * sizeof(T);
+}
+
+/// Heap bytes of a list node holding an element of type `T`.
+template <class T>
+constexpr std::size_t listNodeBytes() {
+  return sizeof(T) + 2 * sizeof(void*);
+}
+
+/// Heap bytes of the nodes and bucket array of a hash table, excluding
+/// any heap memory owned by its elements.
+template <class HashTable>
+std::size_t hashTableBytes(const HashTable& table) {
+  return table.size() * (sizeof(typename HashTable::value_type) + 2 * sizeof(void*)) +
+         table.bucket_count() * sizeof(void*);
+}
+
+/// Heap bytes of a set of strings, including the strings themselves.
+inline std::size_t heapBytes(const std::unordered_set<Str>& strs) {
+  std::size_t bytes = hashTableBytes(strs);
+  for (const Str& str : strs) {
+    bytes += heapBytes(str);
+  }
+  return bytes;
+}
+}  // namespace internal::footprint
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
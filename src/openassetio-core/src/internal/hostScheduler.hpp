@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <utility>
+
+#include <openassetio/export.h>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+
+#include "ThreadPool.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace internal {
+/**
+ * Run a synchronous operation on the host's scheduler, signalling
+ * completion, or the exception that failed the operation, when done.
+ *
+ * Used by default implementations of asynchronous API methods, to
+ * adapt their synchronous counterparts.
+ *
+ * Falls back to the default thread pool if there is no host session.
+ */
+template <class Operation>
+void runOnHostScheduler(const managerApi::HostSessionPtr& hostSession, Operation operation,
+                        std::function<void(std::exception_ptr)> completionCallback) {
+  hostApi::HostInterface::Task task = [operation = std::move(operation),
+                                       completionCallback = std::move(completionCallback)] {
+    std::exception_ptr exception;
+    try {
+      operation();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    completionCallback(exception);
+  };
+  if (hostSession) {
+    hostSession->host()->submit(std::move(task));
+  } else {
+    ThreadPool::defaultPool().submit(std::move(task));
+  }
+}
+}  // namespace internal
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <openassetio/MemoryResource.hpp>
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace internal {
+/**
+ * Standard allocator drawing from a @ref MemoryResourceInterface, or
+ * the global heap if none.
+ *
+ * A default-constructed allocator captures the resource current on
+ * the calling thread (see @ref ScopedMemoryResource), as does a
+ * container copy. Containers otherwise keep the resource they were
+ * constructed with, i.e. the allocator does not propagate on
+ * assignment or swap.
+ */
+template <class T>
+class ResourceAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  ResourceAllocator() noexcept : resource_{ScopedMemoryResource::current()} {}
+
+  explicit ResourceAllocator(MemoryResourceInterface* resource) noexcept : resource_{resource} {}
+
+  template <class U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  ResourceAllocator(const ResourceAllocator<U>& other) noexcept : resource_{other.resource()} {}
+
+  T* allocate(const std::size_t count) {
+    if (resource_ == nullptr) {
+      return std::allocator<T>{}.allocate(count);
+    }
+    return static_cast<T*>(resource_->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, const std::size_t count) noexcept {
+    if (resource_ == nullptr) {
+      std::allocator<T>{}.deallocate(ptr, count);
+      return;
+    }
+    resource_->deallocate(ptr, count * sizeof(T), alignof(T));
+  }
+
+  /// Copies of containers use the resource current at the time of
+  /// copying, rather than that of the source.
+  [[nodiscard]] ResourceAllocator select_on_container_copy_construction() const noexcept {
+    return {};
+  }
+
+  [[nodiscard]] MemoryResourceInterface* resource() const noexcept { return resource_; }
+
+  template <class U>
+  bool operator==(const ResourceAllocator<U>& other) const noexcept {
+    return resource_ == other.resource();
+  }
+
+  template <class U>
+  bool operator!=(const ResourceAllocator<U>& other) const noexcept {
+    return resource_ != other.resource();
+  }
+
+ private:
+  MemoryResourceInterface* resource_;
+};
+}  // namespace internal
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
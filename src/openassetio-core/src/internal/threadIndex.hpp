@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace internal {
+/**
+ * Stable index of the current thread, unique within the process.
+ *
+ * Used to select a shard of counters, so that threads recording
+ * concurrently do not contend.
+ */
+inline std::size_t threadIndex() {
+  static std::atomic<std::size_t> nextThreadIndex{0};
+  thread_local const std::size_t kThreadIndex =
+      nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+  return kThreadIndex;
+}
+}  // namespace internal
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
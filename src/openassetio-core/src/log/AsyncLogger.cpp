@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/AsyncLogger.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+namespace {
+/// Avoid false sharing between producer and consumer state.
+constexpr std::size_t kCacheLineSize = 64;
+
+std::size_t nextPowerOfTwo(const std::size_t value) {
+  std::size_t result = 1;
+  while (result < value) {
+    result <<= 1U;
+  }
+  return result;
+}
+}  // namespace
+
+/**
+ * Bounded multi-producer single-consumer queue, after Dmitry Vyukov's
+ * bounded MPMC queue, drained by a worker thread.
+ *
+ * Each cell carries a sequence number that tells producers and the
+ * consumer whether the cell is free for writing, or holds a message
+ * ready to be read, for the current lap of the ring buffer.
+ */
+class AsyncLogger::Impl {
+ public:
+  Impl(LoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+       const OverflowPolicy overflowPolicy)
+      : upstreamLogger_{std::move(upstreamLogger)},
+        overflowPolicy_{overflowPolicy},
+        mask_{nextPowerOfTwo(capacity) - 1},
+        cells_{std::make_unique<Cell[]>(mask_ + 1)} {
+    for (std::size_t idx = 0; idx <= mask_; ++idx) {
+      cells_[idx].sequence.store(idx, std::memory_order_relaxed);
+    }
+    worker_ = std::thread{[this] { run(); }};
+  }
+
+  ~Impl() {
+    {
+      const std::lock_guard lock{mutex_};
+      isStopping_ = true;
+      isSleeping_.store(false);
+    }
+    wakeCondition_.notify_one();
+    worker_.join();
+  }
+
+  Impl(const Impl&) = delete;
+  Impl(Impl&&) noexcept = delete;
+  Impl& operator=(const Impl&) = delete;
+  Impl& operator=(Impl&&) noexcept = delete;
+
+  [[nodiscard]] const LoggerInterfacePtr& upstreamLogger() const { return upstreamLogger_; }
+
+  void log(const Severity severity, const Str& message, const InfoDictionary& fields) {
+    // Messages logged by the upstream logger back into this logger
+    // would otherwise deadlock when the queue is full.
+    if (std::this_thread::get_id() == worker_.get_id()) {
+      deliver(severity, message, fields);
+      return;
+    }
+
+    while (!tryEnqueue(severity, message, fields)) {
+      if (overflowPolicy_ == OverflowPolicy::kDrop) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      wake();
+      std::this_thread::yield();
+    }
+
+    // Pairs with the store to isSleeping_ in run(), such that either
+    // the worker sees the new message, or we see it is sleeping.
+    if (isSleeping_.load()) {
+      wake();
+    }
+  }
+
+  void flush() {
+    const std::size_t target = enqueuePos_.load();
+    std::unique_lock lock{mutex_};
+    ++flushWaiterCount_;
+    isSleeping_.store(false);
+    wakeCondition_.notify_one();
+    // Positions are compared by difference to handle wraparound.
+    flushCondition_.wait(lock, [&] {
+      return static_cast<std::ptrdiff_t>(deliveredPos_.load() - target) >= 0;
+    });
+    --flushWaiterCount_;
+  }
+
+  [[nodiscard]] std::size_t droppedCount() const {
+    return droppedCount_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    Severity severity{};
+    Str message;
+    InfoDictionary fields;
+  };
+
+  bool tryEnqueue(const Severity severity, const Str& message, const InfoDictionary& fields) {
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        // Cell is free for this lap, try to claim it. The claim must be
+        // sequentially consistent, see `log` and `run`.
+        if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // Cell still holds a message from the previous lap.
+        return false;
+      } else {
+        pos = enqueuePos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->severity = severity;
+    cell->message = message;
+    cell->fields = fields;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Pop a message, if one is ready. Must only be called by the worker.
+  bool tryDequeue(Severity& severity, Str& message, InfoDictionary& fields) {
+    const std::size_t pos = deliveredPos_.load(std::memory_order_relaxed);
+    Cell& cell = cells_[pos & mask_];
+    if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+      return false;
+    }
+    severity = cell.severity;
+    message = std::move(cell.message);
+    fields = std::move(cell.fields);
+    cell.fields.clear();
+    // Free the cell for the next lap before the (potentially slow)
+    // upstream logger is called.
+    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  [[nodiscard]] bool hasPending() const { return enqueuePos_.load() != deliveredPos_.load(); }
+
+  void wake() {
+    {
+      const std::lock_guard lock{mutex_};
+      isSleeping_.store(false);
+    }
+    wakeCondition_.notify_one();
+  }
+
+  void deliver(const Severity severity, const Str& message,
+               const InfoDictionary& fields) noexcept {
+    try {
+      if (fields.empty()) {
+        upstreamLogger_->log(severity, message);
+      } else {
+        upstreamLogger_->logStructured(severity, message, fields);
+      }
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+      // There is nowhere to report a failure to log, and an escaping
+      // exception would terminate the process.
+    }
+  }
+
+  void run() {
+    const std::size_t batchSize = mask_ + 1;
+    Severity severity{};
+    Str message;
+    InfoDictionary fields;
+
+    while (true) {
+      // Deliver a bounded batch, so that flushes are not starved by a
+      // continuous stream of messages.
+      std::size_t deliveredCount = 0;
+      while (deliveredCount < batchSize && tryDequeue(severity, message, fields)) {
+        // Advance only once delivered, so flush() also waits for the
+        // upstream logger to return.
+        deliver(severity, message, fields);
+        deliveredPos_.store(deliveredPos_.load(std::memory_order_relaxed) + 1);
+        ++deliveredCount;
+      }
+
+      reportDropped();
+
+      std::unique_lock lock{mutex_};
+      if (flushWaiterCount_ != 0) {
+        flushCondition_.notify_all();
+      }
+      if (deliveredCount != 0) {
+        continue;
+      }
+      if (hasPending()) {
+        // A producer has claimed a cell but not yet written to it.
+        lock.unlock();
+        std::this_thread::yield();
+        continue;
+      }
+      if (isStopping_) {
+        return;
+      }
+      isSleeping_.store(true);
+      // Re-check now that producers can see we're about to sleep.
+      if (hasPending()) {
+        isSleeping_.store(false);
+        continue;
+      }
+      wakeCondition_.wait(lock, [&] { return !isSleeping_.load(); });
+    }
+  }
+
+  void reportDropped() {
+    const std::size_t droppedCount = droppedCount_.load(std::memory_order_relaxed);
+    if (droppedCount == reportedDroppedCount_) {
+      return;
+    }
+    Str msg = "AsyncLogger: Dropped ";
+    msg += std::to_string(droppedCount - reportedDroppedCount_);
+    msg += " message(s) as the queue was full.";
+    reportedDroppedCount_ = droppedCount;
+    deliver(Severity::kWarning, msg, {});
+  }
+
+  const LoggerInterfacePtr upstreamLogger_;
+  const OverflowPolicy overflowPolicy_;
+  const std::size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+
+  alignas(kCacheLineSize) std::atomic<std::size_t> enqueuePos_{0};
+  alignas(kCacheLineSize) std::atomic<std::size_t> deliveredPos_{0};
+  std::atomic<std::size_t> droppedCount_{0};
+  /// Only accessed by the worker.
+  std::size_t reportedDroppedCount_{0};
+
+  alignas(kCacheLineSize) std::mutex mutex_;
+  std::condition_variable wakeCondition_;
+  std::condition_variable flushCondition_;
+  std::atomic<bool> isSleeping_{false};
+  bool isStopping_{false};
+  std::size_t flushWaiterCount_{0};
+
+  std::thread worker_;
+};
+
+AsyncLoggerPtr AsyncLogger::make(LoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+                                 const OverflowPolicy overflowPolicy) {
+  if (!upstreamLogger) {
+    throw errors::InputValidationException{"AsyncLogger cannot be constructed with null logger."};
+  }
+  if (capacity == 0) {
+    throw errors::InputValidationException{"AsyncLogger capacity must be greater than zero."};
+  }
+  return std::shared_ptr<AsyncLogger>(
+      new AsyncLogger(std::move(upstreamLogger), capacity, overflowPolicy));
+}
+
+AsyncLogger::AsyncLogger(LoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+                         const OverflowPolicy overflowPolicy)
+    : impl_{std::make_unique<Impl>(std::move(upstreamLogger), capacity, overflowPolicy)} {}
+
+AsyncLogger::~AsyncLogger() = default;
+
+LoggerInterfacePtr AsyncLogger::upstreamLogger() const { return impl_->upstreamLogger(); }
+
+void AsyncLogger::log(const Severity severity, const Str& message) {
+  impl_->log(severity, message, {});
+}
+
+void AsyncLogger::logStructured(const Severity severity, const Str& message,
+                                const InfoDictionary& fields) {
+  impl_->log(severity, message, fields);
+}
+
+bool AsyncLogger::isSeverityLogged(const Severity severity) const {
+  return impl_->upstreamLogger()->isSeverityLogged(severity);
+}
+
+void AsyncLogger::flush() { impl_->flush(); }
+
+std::size_t AsyncLogger::droppedCount() const { return impl_->droppedCount(); }
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/BufferedLogger.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+namespace {
+/// Innermost active scope on the current thread, if any.
+thread_local BufferedLogger::Scope* innermostScope = nullptr;
+}  // namespace
+
+BufferedLogger::Scope::Scope(const LoggerInterfacePtr& logger) {
+  BufferedLoggerPtr bufferedLogger = std::dynamic_pointer_cast<BufferedLogger>(logger);
+  if (!bufferedLogger || bufferedLogger->activeScope()) {
+    return;
+  }
+  logger_ = std::move(bufferedLogger);
+  outerScope_ = innermostScope;
+  innermostScope = this;
+}
+
+BufferedLogger::Scope::~Scope() {
+  if (!logger_) {
+    return;
+  }
+  // Unlink before relaying, so that anything the upstream logger logs
+  // in turn isn't buffered by this scope.
+  for (Scope** scope = &innermostScope; *scope; scope = &(*scope)->outerScope_) {
+    if (*scope == this) {
+      *scope = outerScope_;
+      break;
+    }
+  }
+  try {
+    flush();
+  } catch (...) {  // NOLINT(bugprone-empty-catch)
+    // There is nowhere to report a failure to log, and an escaping
+    // exception may terminate the process.
+  }
+}
+
+void BufferedLogger::Scope::flush() {
+  if (!logger_) {
+    return;
+  }
+  // Swap out the buffer, so that messages logged by the upstream
+  // logger whilst relaying are buffered afresh rather than
+  // invalidating the iteration.
+  std::vector<Message> messages;
+  messages.swap(messages_);
+  for (const Message& message : messages) {
+    logger_->relay(message);
+  }
+}
+
+BufferedLoggerPtr BufferedLogger::make(LoggerInterfacePtr upstreamLogger,
+                                       const std::size_t maxBufferedMessages) {
+  if (!upstreamLogger) {
+    throw errors::InputValidationException{
+        "BufferedLogger cannot be constructed with null logger."};
+  }
+  if (maxBufferedMessages == 0) {
+    throw errors::InputValidationException{
+        "BufferedLogger maximum buffered messages must be greater than zero."};
+  }
+  return std::shared_ptr<BufferedLogger>(
+      new BufferedLogger(std::move(upstreamLogger), maxBufferedMessages));
+}
+
+BufferedLogger::BufferedLogger(LoggerInterfacePtr upstreamLogger,
+                               const std::size_t maxBufferedMessages)
+    : upstreamLogger_{std::move(upstreamLogger)}, maxBufferedMessages_{maxBufferedMessages} {}
+
+LoggerInterfacePtr BufferedLogger::upstreamLogger() const { return upstreamLogger_; }
+
+void BufferedLogger::log(Severity severity, const Str& message) {
+  if (Scope* scope = activeScope()) {
+    buffer(*scope, {severity, message, {}});
+  } else {
+    upstreamLogger_->log(severity, message);
+  }
+}
+
+void BufferedLogger::logStructured(Severity severity, const Str& message,
+                                   const InfoDictionary& fields) {
+  if (Scope* scope = activeScope()) {
+    buffer(*scope, {severity, message, fields});
+  } else {
+    upstreamLogger_->logStructured(severity, message, fields);
+  }
+}
+
+bool BufferedLogger::isSeverityLogged(Severity severity) const {
+  return upstreamLogger_->isSeverityLogged(severity);
+}
+
+BufferedLogger::Scope* BufferedLogger::activeScope() const {
+  for (Scope* scope = innermostScope; scope; scope = scope->outerScope_) {
+    if (scope->logger_.get() == this) {
+      return scope;
+    }
+  }
+  return nullptr;
+}
+
+void BufferedLogger::buffer(Scope& scope, Message message) {
+  scope.messages_.push_back(std::move(message));
+  if (scope.messages_.size() >= maxBufferedMessages_) {
+    scope.flush();
+  }
+}
+
+void BufferedLogger::relay(const Message& message) {
+  if (message.fields.empty()) {
+    upstreamLogger_->log(message.severity, message.message);
+  } else {
+    upstreamLogger_->logStructured(message.severity, message.message, message.fields);
+  }
+}
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,8 +1,17 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
-#include <iomanip>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
 
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/log/ConsoleLogger.hpp>
 
 // Foreground ANSI color codes (combined with \033[<color>m)
@@ -11,27 +20,125 @@ constexpr const int kSeverityColors[] = {36, 32, 32, 0, 33, 31, 31};
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace log {
-ConsoleLoggerPtr ConsoleLogger::make(bool shouldColorOutput) {
-  return std::shared_ptr<ConsoleLogger>(new ConsoleLogger(shouldColorOutput));
+namespace {
+/// Size of pending output above which it is written, regardless of
+/// the flush interval.
+constexpr std::size_t kMaxBufferedBytes = 64 * 1024;
+
+/// Write to stderr, serialised across all instances.
+void writeToConsole(const fmt::memory_buffer& output) {
+  static std::mutex mutex;
+  const std::lock_guard lock{mutex};
+  std::cerr.write(output.data(), static_cast<std::streamsize>(output.size()));
 }
+}  // namespace
 
-ConsoleLogger::ConsoleLogger(bool shouldColorOutput) : shouldColorOutput_(shouldColorOutput) {}
+class ConsoleLogger::Buffer {
+ public:
+  explicit Buffer(const std::chrono::milliseconds flushInterval)
+      : thread_{[this, flushInterval] { run(flushInterval); }} {}
+
+  ~Buffer() {
+    {
+      const std::lock_guard lock{mutex_};
+      stopping_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+    writePending();
+  }
+
+  Buffer(const Buffer&) = delete;
+  Buffer(Buffer&&) noexcept = delete;
+  Buffer& operator=(const Buffer&) = delete;
+  Buffer& operator=(Buffer&&) noexcept = delete;
+
+  void append(const fmt::memory_buffer& line, const bool shouldFlush) {
+    const std::lock_guard lock{mutex_};
+    pending_.append(line.data(), line.data() + line.size());
+    if (shouldFlush || pending_.size() >= kMaxBufferedBytes) {
+      writePending();
+    }
+  }
+
+  void flush() {
+    const std::lock_guard lock{mutex_};
+    writePending();
+  }
+
+ private:
+  void run(const std::chrono::milliseconds flushInterval) {
+    std::unique_lock lock{mutex_};
+    // Remaining output is written by the destructor.
+    while (!condition_.wait_for(lock, flushInterval, [this] { return stopping_; })) {
+      writePending();
+    }
+  }
+
+  // Must be called with mutex_ held, or after the thread has stopped.
+  void writePending() {
+    if (pending_.size() == 0) {
+      return;
+    }
+    writeToConsole(pending_);
+    pending_.clear();
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  fmt::memory_buffer pending_;
+  bool stopping_ = false;
+  // Constructed last, since it uses the above.
+  std::thread thread_;
+};
+
+ConsoleLoggerPtr ConsoleLogger::make(bool shouldColorOutput,
+                                     const std::chrono::milliseconds flushInterval) {
+  if (flushInterval.count() < 0) {
+    throw errors::InputValidationException{"ConsoleLogger flush interval must not be negative."};
+  }
+  return std::shared_ptr<ConsoleLogger>(new ConsoleLogger(shouldColorOutput, flushInterval));
+}
+
+ConsoleLogger::ConsoleLogger(bool shouldColorOutput,
+                             const std::chrono::milliseconds flushInterval)
+    : shouldColorOutput_(shouldColorOutput),
+      buffer_{flushInterval.count() > 0 ? std::make_unique<Buffer>(flushInterval) : nullptr} {}
+
+ConsoleLogger::~ConsoleLogger() = default;
 
 void ConsoleLogger::log(Severity severity, const Str& message) {
   auto severityIdx = static_cast<std::size_t>(severity);
 
+  // Format the whole line up front, so that it can be written in one
+  // go, rather than a write per fragment to the unbuffered stderr.
+  fmt::memory_buffer line;
+  auto out = std::back_inserter(line);
+
   if (shouldColorOutput_) {
-    std::cerr << "\033[0;" << kSeverityColors[severityIdx] << "m";
+    fmt::format_to(out, "\033[0;{}m", kSeverityColors[severityIdx]);
   }
 
-  // NOLINTNEXTLINE(readability-magic-numbers)
-  std::cerr << std::setw(11) << kSeverityNames[severityIdx] << ": " << message;
+  fmt::format_to(out, "{:>11}: ", kSeverityNames[severityIdx]);
+  line.append(message.data(), message.data() + message.size());
 
   if (shouldColorOutput_) {
-    std::cerr << "\033[0m";
+    fmt::format_to(out, "\033[0m");
+  }
+
+  line.push_back('\n');
+
+  if (buffer_) {
+    buffer_->append(line, severity >= Severity::kWarning);
+  } else {
+    writeToConsole(line);
   }
+}
 
-  std::cerr << "\n";
+void ConsoleLogger::flush() {
+  if (buffer_) {
+    buffer_->flush();
+  }
 }
 }  // namespace log
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
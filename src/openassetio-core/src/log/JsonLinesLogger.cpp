@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/JsonLinesLogger.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+namespace {
+/// Append a JSON string literal, escaping as required by RFC 8259.
+void appendJsonString(Str& out, const Str& str) {
+  out += '"';
+  for (const char chr : str) {
+    switch (chr) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(chr) < 0x20) {
+          out += fmt::format("\\u{:04x}", static_cast<unsigned int>(chr));
+        } else {
+          out += chr;
+        }
+    }
+  }
+  out += '"';
+}
+
+void appendJsonValue(Str& out, const InfoDictionaryValue& value) {
+  std::visit(
+      [&out](const auto& val) {
+        using ValueType = std::decay_t<decltype(val)>;
+        if constexpr (std::is_same_v<ValueType, Bool>) {
+          out += val ? "true" : "false";
+        } else if constexpr (std::is_same_v<ValueType, Int>) {
+          out += fmt::format("{}", val);
+        } else if constexpr (std::is_same_v<ValueType, Float>) {
+          // JSON has no representation of NaN or infinity.
+          out += std::isfinite(val) ? fmt::format("{}", val) : "null";
+        } else {
+          appendJsonString(out, val);
+        }
+      },
+      value);
+}
+}  // namespace
+
+JsonLinesLoggerPtr JsonLinesLogger::make(const Str& path) {
+  std::ofstream stream{path, std::ios::out | std::ios::app | std::ios::binary};
+  if (!stream) {
+    Str msg = "JsonLinesLogger: Could not open '";
+    msg += path;
+    msg += "' for writing.";
+    throw errors::InputValidationException{msg};
+  }
+  return std::shared_ptr<JsonLinesLogger>(new JsonLinesLogger(std::move(stream)));
+}
+
+JsonLinesLogger::JsonLinesLogger(std::ofstream stream) : stream_{std::move(stream)} {}
+
+void JsonLinesLogger::log(Severity severity, const Str& message) {
+  logStructured(severity, message, {});
+}
+
+void JsonLinesLogger::logStructured(Severity severity, const Str& message,
+                                    const InfoDictionary& fields) {
+  const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+
+  // Build the line outside the lock, so concurrent loggers only
+  // serialise on the write itself.
+  Str line = fmt::format(R"({{"timestamp":{},"severity":"{}","thread":{},"message":)", timestamp,
+                         kSeverityNames[static_cast<std::size_t>(severity)],
+                         std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  appendJsonString(line, message);
+
+  if (!fields.empty()) {
+    // Sort for consistent output, regardless of hash order.
+    std::vector<const InfoDictionary::value_type*> sortedFields;
+    sortedFields.reserve(fields.size());
+    for (const auto& field : fields) {
+      sortedFields.push_back(&field);
+    }
+    std::sort(sortedFields.begin(), sortedFields.end(),
+              [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+    line += R"(,"fields":{)";
+    for (const auto* field : sortedFields) {
+      if (field != sortedFields.front()) {
+        line += ',';
+      }
+      appendJsonString(line, field->first);
+      line += ':';
+      appendJsonValue(line, field->second);
+    }
+    line += '}';
+  }
+  line += "}\n";
+
+  const std::lock_guard lock{mutex_};
+  stream_.write(line.data(), static_cast<std::streamsize>(line.size()));
+  if (severity >= Severity::kWarning) {
+    stream_.flush();
+  }
+}
+
+void JsonLinesLogger::flush() {
+  const std::lock_guard lock{mutex_};
+  stream_.flush();
+}
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,7 +1,13 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include <openassetio/log/LoggerInterface.hpp>
 
@@ -10,6 +16,46 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace log {
 LoggerInterface::~LoggerInterface() = default;
 
+bool LoggerInterface::isSeverityLogged([[maybe_unused]] Severity severity) const { return true; }
+
+void LoggerInterface::logStructured(Severity severity, const Str &message,
+                                    const InfoDictionary &fields) {
+  if (fields.empty()) {
+    log(severity, message);
+    return;
+  }
+
+  // Sort for a consistent message, regardless of hash order.
+  std::vector<const InfoDictionary::value_type *> sortedFields;
+  sortedFields.reserve(fields.size());
+  for (const auto &field : fields) {
+    sortedFields.push_back(&field);
+  }
+  std::sort(sortedFields.begin(), sortedFields.end(),
+            [](const auto *lhs, const auto *rhs) { return lhs->first < rhs->first; });
+
+  Str msg = message;
+  msg += " [";
+  for (const auto *field : sortedFields) {
+    if (field != sortedFields.front()) {
+      msg += ", ";
+    }
+    msg += field->first;
+    msg += '=';
+    std::visit(
+        [&msg](const auto &value) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(value)>, Bool>) {
+            msg += value ? "true" : "false";
+          } else {
+            msg += fmt::format("{}", value);
+          }
+        },
+        field->second);
+  }
+  msg += ']';
+  log(severity, msg);
+}
+
 void LoggerInterface::debugApi(const Str &message) { log(Severity::kDebugApi, message); }
 
 void LoggerInterface::debug(const Str &message) { log(Severity::kDebug, message); }
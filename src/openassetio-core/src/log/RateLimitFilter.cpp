@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/RateLimitFilter.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+namespace {
+std::int64_t nowNanoseconds() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace
+
+RateLimitFilterPtr RateLimitFilter::make(LoggerInterfacePtr upstreamLogger,
+                                         const std::size_t maxMessagesPerInterval,
+                                         const std::chrono::milliseconds interval,
+                                         const std::size_t sampleInterval) {
+  if (!upstreamLogger) {
+    throw errors::InputValidationException{
+        "RateLimitFilter cannot be constructed with null logger."};
+  }
+  if (interval.count() <= 0) {
+    throw errors::InputValidationException{"RateLimitFilter interval must be positive."};
+  }
+  return std::shared_ptr<RateLimitFilter>(new RateLimitFilter(
+      std::move(upstreamLogger), maxMessagesPerInterval, interval, sampleInterval));
+}
+
+RateLimitFilter::RateLimitFilter(LoggerInterfacePtr upstreamLogger,
+                                 const std::size_t maxMessagesPerInterval,
+                                 const std::chrono::milliseconds interval,
+                                 const std::size_t sampleInterval)
+    : upstreamLogger_{std::move(upstreamLogger)},
+      maxMessagesPerInterval_{maxMessagesPerInterval},
+      interval_{interval},
+      sampleInterval_{sampleInterval} {
+  const std::int64_t now = nowNanoseconds();
+  for (SeverityState& state : states_) {
+    state.intervalStart.store(now, std::memory_order_relaxed);
+  }
+}
+
+RateLimitFilter::~RateLimitFilter() {
+  for (std::size_t idx = 0; idx < states_.size(); ++idx) {
+    if (const std::size_t suppressed = states_[idx].suppressed.load()) {
+      reportSuppressed(static_cast<Severity>(idx), suppressed);
+    }
+  }
+}
+
+LoggerInterfacePtr RateLimitFilter::upstreamLogger() const { return upstreamLogger_; }
+
+void RateLimitFilter::log(Severity severity, const Str& message) {
+  if (shouldRelay(severity)) {
+    upstreamLogger_->log(severity, message);
+  }
+}
+
+void RateLimitFilter::logStructured(Severity severity, const Str& message,
+                                    const InfoDictionary& fields) {
+  if (shouldRelay(severity)) {
+    upstreamLogger_->logStructured(severity, message, fields);
+  }
+}
+
+bool RateLimitFilter::isSeverityLogged(Severity severity) const {
+  return upstreamLogger_->isSeverityLogged(severity);
+}
+
+std::size_t RateLimitFilter::suppressedCount() const {
+  return suppressedCount_.load(std::memory_order_relaxed);
+}
+
+bool RateLimitFilter::shouldRelay(Severity severity) {
+  SeverityState& state = states_[static_cast<std::size_t>(severity)];
+
+  const std::int64_t now = nowNanoseconds();
+  std::int64_t intervalStart = state.intervalStart.load(std::memory_order_relaxed);
+  if (now - intervalStart >= std::chrono::nanoseconds{interval_}.count() &&
+      state.intervalStart.compare_exchange_strong(intervalStart, now,
+                                                  std::memory_order_relaxed)) {
+    // We won the race to start a new interval. Messages counted by
+    // other threads between the exchange and the reset are forgiven.
+    state.count.store(0, std::memory_order_relaxed);
+    if (const std::size_t suppressed = state.suppressed.exchange(0, std::memory_order_relaxed)) {
+      reportSuppressed(severity, suppressed);
+    }
+  }
+
+  const std::size_t count = state.count.fetch_add(1, std::memory_order_relaxed) + 1;
+  if (count <= maxMessagesPerInterval_) {
+    return true;
+  }
+  if (sampleInterval_ != 0 && (count - maxMessagesPerInterval_) % sampleInterval_ == 0) {
+    return true;
+  }
+  state.suppressed.fetch_add(1, std::memory_order_relaxed);
+  suppressedCount_.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void RateLimitFilter::reportSuppressed(const Severity severity, const std::size_t suppressed) {
+  upstreamLogger_->log(severity,
+                       fmt::format("RateLimitFilter: Suppressed {} {} message(s) exceeding {} "
+                                   "per {}ms.",
+                                   suppressed, kSeverityNames[static_cast<std::size_t>(severity)],
+                                   maxMessagesPerInterval_, interval_.count()));
+}
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
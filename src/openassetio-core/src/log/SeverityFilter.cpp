@@ -1,13 +1,23 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <optional>
 
 #include <openassetio/log/SeverityFilter.hpp>
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace log {
+namespace {
+/// Sentinel for no global override. Stored as an int, rather than an
+/// `optional`, so that the atomic is lock-free.
+constexpr int kNoSeverityOverride = -1;
+
+std::atomic<int> processSeverityOverride{kNoSeverityOverride};
+}  // namespace
+
 SeverityFilterPtr SeverityFilter::make(LoggerInterfacePtr upstreamLogger) {
   return std::shared_ptr<SeverityFilter>(new SeverityFilter(std::move(upstreamLogger)));
 }
@@ -28,21 +38,60 @@ SeverityFilter::SeverityFilter(LoggerInterfacePtr upstreamLogger)
       msg += "' - ignoring.";
       upstreamLogger_->log(Severity::kError, msg);
     } else {
-      minSeverity_ = static_cast<Severity>(envSeverity);
+      minSeverity_.store(static_cast<Severity>(envSeverity), std::memory_order_relaxed);
     }
   }
 }
 
 void SeverityFilter::log(Severity severity, const Str& message) {
-  if (severity < minSeverity_) {
+  if (severity < effectiveSeverity()) {
     return;
   }
   upstreamLogger_->log(severity, message);
 }
 
-void SeverityFilter::setSeverity(LoggerInterface::Severity severity) { minSeverity_ = severity; }
+void SeverityFilter::logStructured(Severity severity, const Str& message,
+                                   const InfoDictionary& fields) {
+  if (severity < effectiveSeverity()) {
+    return;
+  }
+  upstreamLogger_->logStructured(severity, message, fields);
+}
+
+bool SeverityFilter::isSeverityLogged(Severity severity) const {
+  return severity >= effectiveSeverity() && upstreamLogger_->isSeverityLogged(severity);
+}
+
+void SeverityFilter::setSeverity(LoggerInterface::Severity severity) {
+  // Relaxed, as no other data is published along with the severity.
+  minSeverity_.store(severity, std::memory_order_relaxed);
+}
+
+LoggerInterface::Severity SeverityFilter::getSeverity() const {
+  return minSeverity_.load(std::memory_order_relaxed);
+}
 
-LoggerInterface::Severity SeverityFilter::getSeverity() const { return minSeverity_; }
+void SeverityFilter::setGlobalSeverityOverride(
+    const std::optional<LoggerInterface::Severity> severity) {
+  processSeverityOverride.store(severity ? static_cast<int>(*severity) : kNoSeverityOverride,
+                                std::memory_order_relaxed);
+}
+
+std::optional<LoggerInterface::Severity> SeverityFilter::globalSeverityOverride() {
+  const int severity = processSeverityOverride.load(std::memory_order_relaxed);
+  if (severity == kNoSeverityOverride) {
+    return std::nullopt;
+  }
+  return static_cast<Severity>(severity);
+}
+
+LoggerInterface::Severity SeverityFilter::effectiveSeverity() const {
+  const int severity = processSeverityOverride.load(std::memory_order_relaxed);
+  if (severity == kNoSeverityOverride) {
+    return minSeverity_.load(std::memory_order_relaxed);
+  }
+  return static_cast<Severity>(severity);
+}
 
 LoggerInterfacePtr SeverityFilter::upstreamLogger() const { return upstreamLogger_; }
 }  // namespace log
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <openassetio/managerApi/EntityExistenceFilter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+
+#include "../trait/hashing.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+namespace {
+constexpr std::size_t kBitsPerWord = 64;
+
+/// Upper bound on the number of bits set per entity, beyond which
+/// lookups become costly for little benefit.
+constexpr std::size_t kMaxHashCount = 32;
+
+/**
+ * Pair of independent hashes of a string, from which each bit index
+ * is derived by double hashing.
+ *
+ * FNV-1a is used, rather than `std::hash`, so that bit positions are
+ * stable across platforms and processes.
+ */
+struct Hashes {
+  explicit Hashes(const std::string_view str) {
+    // NOLINTBEGIN(readability-magic-numbers)
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char chr : str) {
+      hash ^= static_cast<unsigned char>(chr);
+      hash *= 0x100000001b3ULL;
+    }
+    first = trait::mixHash(hash);
+    // Odd, so that successive indices cycle through all bits.
+    second = trait::mixHash(hash ^ 0x9e3779b97f4a7c15ULL) | 1U;
+    // NOLINTEND(readability-magic-numbers)
+  }
+
+  [[nodiscard]] std::size_t bit(const std::size_t idx, const std::size_t bitCount) const {
+    return (first + idx * second) % bitCount;
+  }
+
+  std::size_t first;
+  std::size_t second;
+};
+}  // namespace
+
+EntityExistenceFilterPtr EntityExistenceFilter::make(const std::size_t expectedCount,
+                                                     const double falsePositiveRate) {
+  if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) {
+    throw errors::InputValidationException{fmt::format(
+        "Entity existence filter false positive rate must be between 0 and 1, got {}.",
+        falsePositiveRate)};
+  }
+  // Optimal sizing for a Bloom filter of n entities with false
+  // positive rate p: m = -n ln(p) / ln(2)^2 bits, and k = m/n ln(2)
+  // hashes.
+  const auto count = static_cast<double>(std::max<std::size_t>(expectedCount, 1));
+  const double ln2 = std::log(2.0);
+  const double bits = std::ceil(-count * std::log(falsePositiveRate) / (ln2 * ln2));
+  const auto bitCount = std::max<std::size_t>(static_cast<std::size_t>(bits), kBitsPerWord);
+  const auto hashCount = std::clamp<std::size_t>(
+      static_cast<std::size_t>(std::lround(bits / count * ln2)), 1, kMaxHashCount);
+  return std::shared_ptr<EntityExistenceFilter>(new EntityExistenceFilter(bitCount, hashCount));
+}
+
+EntityExistenceFilter::EntityExistenceFilter(const std::size_t bitCount,
+                                             const std::size_t hashCount)
+    : words_((bitCount + kBitsPerWord - 1) / kBitsPerWord, 0),
+      bitCount_{bitCount},
+      hashCount_{hashCount} {}
+
+void EntityExistenceFilter::insert(const std::string_view entityReferenceString) {
+  const Hashes hashes{entityReferenceString};
+  for (std::size_t idx = 0; idx < hashCount_; ++idx) {
+    const std::size_t bit = hashes.bit(idx, bitCount_);
+    words_[bit / kBitsPerWord] |= std::uint64_t{1} << (bit % kBitsPerWord);
+  }
+}
+
+bool EntityExistenceFilter::mayContain(const std::string_view entityReferenceString) const {
+  const Hashes hashes{entityReferenceString};
+  for (std::size_t idx = 0; idx < hashCount_; ++idx) {
+    const std::size_t bit = hashes.bit(idx, bitCount_);
+    if ((words_[bit / kBitsPerWord] & (std::uint64_t{1} << (bit % kBitsPerWord))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::size_t EntityExistenceFilter::bitCount() const { return bitCount_; }
+
+std::size_t EntityExistenceFilter::hashCount() const { return hashCount_; }
+
+std::size_t EntityExistenceFilter::memoryUsage() const {
+  return sizeof(EntityExistenceFilter) + words_.capacity() * sizeof(std::uint64_t);
+}
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
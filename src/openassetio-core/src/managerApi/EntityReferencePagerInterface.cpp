@@ -1,12 +1,82 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+
+#include "../internal/hostScheduler.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace managerApi {
 
 void EntityReferencePagerInterface::close([[maybe_unused]] const HostSessionPtr& hostSession) {}
+
+void EntityReferencePagerInterface::getInto(Page& page, const HostSessionPtr& hostSession) {
+  Page current = get(hostSession);
+  // Assign element-wise, rather than the whole vector, so that the
+  // storage of `page` is reused.
+  page.assign(std::make_move_iterator(current.begin()), std::make_move_iterator(current.end()));
+}
+
+std::optional<std::size_t> EntityReferencePagerInterface::sizeHint(
+    [[maybe_unused]] const HostSessionPtr& hostSession) {
+  return std::nullopt;
+}
+
+EntityReferencePagerInterface::Page EntityReferencePagerInterface::drainAll(
+    const std::size_t maxItems, const HostSessionPtr& hostSession) {
+  Page entityReferences;
+  if (const std::optional<std::size_t> hint = sizeHint(hostSession)) {
+    entityReferences.reserve(std::min(*hint, maxItems));
+  }
+  while (entityReferences.size() < maxItems) {
+    Page page = get(hostSession);
+    const std::size_t remaining = maxItems - entityReferences.size();
+    const auto count = static_cast<Page::difference_type>(std::min(page.size(), remaining));
+    entityReferences.insert(entityReferences.end(), std::make_move_iterator(page.begin()),
+                            std::make_move_iterator(page.begin() + count));
+    const bool more = hasNext(hostSession);
+    next(hostSession);
+    if (!more) {
+      break;
+    }
+  }
+  return entityReferences;
+}
+
+void EntityReferencePagerInterface::hasNextAsync(const HostSessionPtr& hostSession,
+                                                 HasNextSuccessCallback successCallback,
+                                                 CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession,
+      [this, hostSession, successCallback = std::move(successCallback)] {
+        successCallback(hasNext(hostSession));
+      },
+      std::move(completionCallback));
+}
+
+void EntityReferencePagerInterface::getAsync(const HostSessionPtr& hostSession,
+                                             GetSuccessCallback successCallback,
+                                             CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession,
+      [this, hostSession, successCallback = std::move(successCallback)] {
+        successCallback(get(hostSession));
+      },
+      std::move(completionCallback));
+}
+
+void EntityReferencePagerInterface::nextAsync(const HostSessionPtr& hostSession,
+                                              CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession, [this, hostSession] { next(hostSession); }, std::move(completionCallback));
+}
 }  // namespace managerApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -1,5 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 #include <openassetio/typedefs.hpp>
@@ -7,6 +12,29 @@
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace managerApi {
+namespace {
+/**
+ * Return the stored value, or query the host and store the result.
+ *
+ * The host is not queried under the lock, since it may be implemented
+ * in another language, and so need to acquire other locks (e.g. the
+ * Python GIL). Concurrent first use may therefore query the host more
+ * than once.
+ */
+template <class Value, class Query>
+Value cached(std::mutex& mutex, std::optional<Value>& stored, const Query& query) {
+  {
+    const std::lock_guard lock{mutex};
+    if (stored) {
+      return *stored;
+    }
+  }
+  Value value = query();
+  const std::lock_guard lock{mutex};
+  stored = value;
+  return value;
+}
+}  // namespace
 
 HostPtr Host::make(hostApi::HostInterfacePtr hostInterface) {
   return std::shared_ptr<Host>(new Host(std::move(hostInterface)));
@@ -14,9 +42,30 @@ HostPtr Host::make(hostApi::HostInterfacePtr hostInterface) {
 
 Host::Host(hostApi::HostInterfacePtr hostInterface) : hostInterface_{std::move(hostInterface)} {}
 
-Identifier Host::identifier() const { return hostInterface_->identifier(); }
-Str Host::displayName() const { return hostInterface_->displayName(); }
-InfoDictionary Host::info() { return hostInterface_->info(); }
+Identifier Host::identifier() const {
+  return cached(mutex_, identifier_, [this] { return hostInterface_->identifier(); });
+}
+
+Str Host::displayName() const {
+  return cached(mutex_, displayName_, [this] { return hostInterface_->displayName(); });
+}
+
+InfoDictionary Host::info() {
+  return cached(mutex_, info_, [this] { return hostInterface_->info(); });
+}
+
+void Host::refresh() {
+  const std::lock_guard lock{mutex_};
+  identifier_.reset();
+  displayName_.reset();
+  info_.reset();
+}
+
+void Host::submit(Task task) { hostInterface_->submit(std::move(task)); }
+
+void Host::parallelFor(const std::size_t count, const ParallelForBody& body) {
+  hostInterface_->parallelFor(count, body);
+}
 
 }  // namespace managerApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -2,6 +2,9 @@
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #include <openassetio/managerApi/HostSession.hpp>
 
+#include <algorithm>
+
+#include <openassetio/MemoryResource.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 
@@ -10,14 +13,64 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace managerApi {
 
 HostSessionPtr HostSession::make(HostPtr host, log::LoggerInterfacePtr logger) {
-  return std::shared_ptr<HostSession>(new HostSession(std::move(host), std::move(logger)));
+  return make(std::move(host), std::move(logger), nullptr);
+}
+
+HostSessionPtr HostSession::make(HostPtr host, log::LoggerInterfacePtr logger,
+                                 MemoryResourceInterfacePtr memoryResource) {
+  return std::shared_ptr<HostSession>(
+      new HostSession(std::move(host), std::move(logger), std::move(memoryResource)));
 }
 
-HostSession::HostSession(HostPtr host, log::LoggerInterfacePtr logger)
-    : host_{std::move(host)}, logger_{std::move(logger)} {}
+HostSession::HostSession(HostPtr host, log::LoggerInterfacePtr logger,
+                         MemoryResourceInterfacePtr memoryResource)
+    : host_{std::move(host)},
+      logger_{std::move(logger)},
+      memoryResource_{std::move(memoryResource)} {}
 
 const HostPtr& HostSession::host() const { return host_; }
 const log::LoggerInterfacePtr& HostSession::logger() const { return logger_; }
+const MemoryResourceInterfacePtr& HostSession::memoryResource() const {
+  return memoryResource_;
+}
+
+void HostSession::notifyEntitiesChanged(const EntityReferences& entityReferences,
+                                        const trait::TraitSet& traitSet) const {
+  if (entityReferences.empty()) {
+    return;
+  }
+  // Call outside the lock, so callbacks may take their own locks
+  // without risk of deadlock.
+  std::vector<std::shared_ptr<const EntityChangeCallback>> callbacks;
+  {
+    const std::lock_guard lock{subscribersMutex_};
+    callbacks.reserve(subscribers_.size());
+    for (const auto& [subscriptionId, callback] : subscribers_) {
+      callbacks.push_back(callback);
+    }
+  }
+  for (const auto& callback : callbacks) {
+    (*callback)(entityReferences, traitSet);
+  }
+}
+
+HostSession::SubscriptionId HostSession::subscribeToEntityChanges(
+    EntityChangeCallback callback) {
+  const std::lock_guard lock{subscribersMutex_};
+  const SubscriptionId subscriptionId = nextSubscriptionId_++;
+  subscribers_.emplace_back(subscriptionId,
+                            std::make_shared<const EntityChangeCallback>(std::move(callback)));
+  return subscriptionId;
+}
+
+void HostSession::unsubscribeFromEntityChanges(const SubscriptionId subscriptionId) {
+  const std::lock_guard lock{subscribersMutex_};
+  subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(),
+                                    [subscriptionId](const auto& subscriber) {
+                                      return subscriber.first == subscriptionId;
+                                    }),
+                     subscribers_.end());
+}
 
 }  // namespace managerApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -1,19 +1,94 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include <openassetio/CancellationToken.hpp>
+#include <openassetio/Context.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 
+#include "../internal/hostScheduler.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace managerApi {
 
+namespace {
+/// Page size of relationship queries made by the default
+/// traverseRelationships, whose pagers are drained in full.
+constexpr std::size_t kTraversalPageSize = 256;
+
+/**
+ * Derive a generation token from resolved data, such that tokens are
+ * equal if the data is equal, and differ (barring hash collisions)
+ * otherwise.
+ *
+ * A FNV-1a hash of the traits and properties, in sorted order, is
+ * used, rather than `TraitsData::hash`, so that tokens are stable
+ * across processes and may be persisted by hosts.
+ */
+Str generationTokenFor(const trait::TraitsData& traitsData) {
+  std::uint64_t hash = 0xcbf29ce484222325ULL;  // NOLINT(*-magic-numbers)
+  const auto mixBytes = [&hash](const void* data, const std::size_t size) {
+    for (std::size_t idx = 0; idx < size; ++idx) {
+      hash ^= static_cast<const unsigned char*>(data)[idx];
+      hash *= 0x100000001b3ULL;  // NOLINT(*-magic-numbers)
+    }
+  };
+  // Length-prefixed, so that adjacent strings cannot be confused.
+  const auto mixStr = [&mixBytes](const std::string_view str) {
+    const std::uint64_t size = str.size();
+    mixBytes(&size, sizeof(size));
+    mixBytes(str.data(), str.size());
+  };
+
+  const trait::TraitSet traitSet = traitsData.traitSet();
+  std::vector<trait::TraitId> traitIds{traitSet.begin(), traitSet.end()};
+  std::sort(traitIds.begin(), traitIds.end());
+  for (const trait::TraitId& traitId : traitIds) {
+    mixStr(traitId);
+    const trait::property::KeySet keySet = traitsData.traitPropertyKeys(traitId);
+    std::vector<trait::property::Key> keys(keySet.begin(), keySet.end());
+    std::sort(keys.begin(), keys.end());
+    for (const trait::property::Key& key : keys) {
+      mixStr(key);
+      trait::property::Value value;
+      traitsData.getTraitProperty(&value, traitId, key);
+      const auto typeIndex = static_cast<unsigned char>(value.index());
+      mixBytes(&typeIndex, sizeof(typeIndex));
+      std::visit(
+          [&](const auto& typedValue) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(typedValue)>, Str>) {
+              mixStr(typedValue);
+            } else {
+              mixBytes(&typedValue, sizeof(typedValue));
+            }
+          },
+          value);
+    }
+  }
+  return fmt::format("{:016x}", hash);
+}
+}  // namespace
+
 ManagerInterface::ManagerInterface() = default;
 
 #define UNIMPLEMENTED_ERROR(capability)                                                           \
@@ -47,6 +122,17 @@ InfoDictionary ManagerInterface::settings([[maybe_unused]] const HostSessionPtr&
 
 void ManagerInterface::flushCaches([[maybe_unused]] const HostSessionPtr& hostSession) {}
 
+void ManagerInterface::flushEntityCaches(
+    [[maybe_unused]] const EntityReferences& entityReferences,
+    const HostSessionPtr& hostSession) {
+  flushCaches(hostSession);
+}
+
+void ManagerInterface::flushCachesWithPrefix([[maybe_unused]] const Str& prefix,
+                                             const HostSessionPtr& hostSession) {
+  flushCaches(hostSession);
+}
+
 trait::TraitsDatas ManagerInterface::managementPolicy(
     [[maybe_unused]] const trait::TraitSets& traitSets,
     [[maybe_unused]] access::PolicyAccess policyAccess,
@@ -66,6 +152,11 @@ void ManagerInterface::entityExists(
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kExistenceQueries)};
 }
 
+EntityExistenceFilterConstPtr ManagerInterface::entityExistenceFilter(
+    [[maybe_unused]] const HostSessionPtr& hostSession) {
+  return nullptr;
+}
+
 void ManagerInterface::entityTraits(
     [[maybe_unused]] const EntityReferences& entityReferences,
     [[maybe_unused]] const access::EntityTraitsAccess entityTraitsAccess,
@@ -89,6 +180,100 @@ void ManagerInterface::resolve(
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kResolution)};
 }
 
+void ManagerInterface::resolveProjected(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    [[maybe_unused]] const trait::PropertyProjection& propertyProjection,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  resolve(entityReferences, traitSet, resolveAccess, context, hostSession, successCallback,
+          errorCallback);
+}
+
+void ManagerInterface::resolveColumnar(const EntityReferences& entityReferences,
+                                       const trait::TraitSet& traitSet,
+                                       const access::ResolveAccess resolveAccess,
+                                       const ContextConstPtr& context,
+                                       const HostSessionPtr& hostSession,
+                                       trait::TraitsDataTable& results,
+                                       const BatchElementErrorCallback& errorCallback) {
+  resolve(
+      entityReferences, traitSet, resolveAccess, context, hostSession,
+      [&](const std::size_t idx, const trait::TraitsDataPtr& traitsData) {
+        if (!results.setRow(idx, *traitsData)) {
+          errorCallback(idx, errors::BatchElementError{
+                                 errors::BatchElementError::ErrorCode::kUnknown,
+                                 "Property type does not match that of its results column"});
+        }
+      },
+      errorCallback);
+}
+
+void ManagerInterface::resolveHeterogeneous(
+    const EntityReferences& entityReferences, const trait::TraitSets& traitSets,
+    const std::vector<std::size_t>& traitSetIndices, const access::ResolveAccess resolveAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (traitSetIndices.size() != entityReferences.size()) {
+    throw errors::InputValidationException{
+        fmt::format("Parameter lists must be of the same length: {} entity references vs. {} "
+                    "trait set indices.",
+                    entityReferences.size(), traitSetIndices.size())};
+  }
+  // Group the entities by trait set, retaining their original indices.
+  std::vector<EntityReferences> groupedRefs(traitSets.size());
+  std::vector<std::vector<std::size_t>> groupedIndices(traitSets.size());
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const std::size_t traitSetIdx = traitSetIndices[idx];
+    if (traitSetIdx >= traitSets.size()) {
+      throw errors::InputValidationException{fmt::format(
+          "Trait set index {} is out of range for {} trait sets.", traitSetIdx, traitSets.size())};
+    }
+    groupedRefs[traitSetIdx].push_back(entityReferences[idx]);
+    groupedIndices[traitSetIdx].push_back(idx);
+  }
+
+  for (std::size_t traitSetIdx = 0; traitSetIdx < traitSets.size(); ++traitSetIdx) {
+    if (groupedRefs[traitSetIdx].empty()) {
+      continue;
+    }
+    const std::vector<std::size_t>& indices = groupedIndices[traitSetIdx];
+    resolve(
+        groupedRefs[traitSetIdx], traitSets[traitSetIdx], resolveAccess, context, hostSession,
+        [&](const std::size_t idx, trait::TraitsDataPtr traitsData) {
+          successCallback(indices[idx], std::move(traitsData));
+        },
+        [&](const std::size_t idx, errors::BatchElementError error) {
+          errorCallback(indices[idx], std::move(error));
+        });
+  }
+}
+
+void ManagerInterface::resolveIfChanged(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const std::vector<Str>& generationTokens,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const ConditionalResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (generationTokens.size() != entityReferences.size()) {
+    throw errors::InputValidationException{
+        fmt::format("Parameter lists must be of the same length: {} entity references vs. {} "
+                    "generation tokens.",
+                    entityReferences.size(), generationTokens.size())};
+  }
+  resolve(
+      entityReferences, traitSet, resolveAccess, context, hostSession,
+      [&](const std::size_t idx, trait::TraitsDataPtr traitsData) {
+        Str generationToken = generationTokenFor(*traitsData);
+        if (generationToken == generationTokens[idx]) {
+          traitsData = nullptr;
+        }
+        successCallback(idx, {std::move(traitsData), std::move(generationToken)});
+      },
+      errorCallback);
+}
+
 ManagerStateBasePtr ManagerInterface::createState(
     [[maybe_unused]] const HostSessionPtr& hostSession) {
   throw errors::NotImplementedException{
@@ -115,12 +300,27 @@ ManagerStateBasePtr ManagerInterface::stateFromPersistenceToken(
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kStatefulContexts)};
 }
 
+bool ManagerInterface::resetState([[maybe_unused]] const ManagerStateBasePtr& state,
+                                  [[maybe_unused]] const HostSessionPtr& hostSession) {
+  return false;
+}
+
 bool ManagerInterface::isEntityReferenceString(
     [[maybe_unused]] const Str& someString, [[maybe_unused]] const HostSessionPtr& hostSession) {
   throw errors::NotImplementedException{
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kEntityReferenceIdentification)};
 }
 
+std::vector<bool> ManagerInterface::areEntityReferenceStrings(const std::vector<Str>& someStrings,
+                                                              const HostSessionPtr& hostSession) {
+  std::vector<bool> result;
+  result.reserve(someStrings.size());
+  for (const Str& someString : someStrings) {
+    result.push_back(isEntityReferenceString(someString, hostSession));
+  }
+  return result;
+}
+
 // To avoid changing this to non-static in the not too distant, when we
 // add manager validation (see https://github.com/OpenAssetIO/OpenAssetIO/issues/553).
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
@@ -165,6 +365,134 @@ void ManagerInterface::getWithRelationships(
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kRelationshipQueries)};
 }
 
+void ManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  const std::size_t relationshipCount = relationshipTraitsDatas.size();
+  if (relationshipCount == 0) {
+    return;
+  }
+  for (std::size_t entityIdx = 0; entityIdx < entityReferences.size(); ++entityIdx) {
+    const std::size_t rowStart = entityIdx * relationshipCount;
+    getWithRelationships(
+        entityReferences[entityIdx], relationshipTraitsDatas, resultTraitSet, pageSize,
+        relationsAccess, context, hostSession,
+        [&](const std::size_t relationshipIdx, EntityReferencePagerInterfacePtr pager) {
+          successCallback(rowStart + relationshipIdx, std::move(pager));
+        },
+        [&](const std::size_t relationshipIdx, errors::BatchElementError error) {
+          errorCallback(rowStart + relationshipIdx, std::move(error));
+        });
+  }
+}
+
+void ManagerInterface::traverseRelationships(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t maxDepth,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession,
+    const RelationshipTraversalSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (relationshipTraitsDatas.empty()) {
+    return;
+  }
+
+  // Per input reference: entities reached at each hop, and all
+  // entities seen so far, including the input itself.
+  std::vector<std::vector<EntityReferences>> levels(entityReferences.size());
+  std::vector<std::unordered_set<Str>> visited(entityReferences.size());
+  std::vector<bool> failed(entityReferences.size(), false);
+
+  // Unique entities to query at the next hop, along with the indices
+  // of the input references that reached each.
+  EntityReferences frontier;
+  std::vector<std::vector<std::size_t>> frontierInputIdxs;
+  std::unordered_map<Str, std::size_t> frontierIdxs;
+  const auto addToFrontier = [&](const EntityReference& entityReference,
+                                 const std::size_t inputIdx) {
+    const auto [iter, inserted] =
+        frontierIdxs.try_emplace(entityReference.toString(), frontier.size());
+    if (inserted) {
+      frontier.push_back(entityReference);
+      frontierInputIdxs.emplace_back();
+    }
+    frontierInputIdxs[iter->second].push_back(inputIdx);
+  };
+
+  for (std::size_t inputIdx = 0; inputIdx < entityReferences.size(); ++inputIdx) {
+    visited[inputIdx].insert(entityReferences[inputIdx].toString());
+    addToFrontier(entityReferences[inputIdx], inputIdx);
+  }
+
+  for (std::size_t depth = 0; depth < maxDepth && !frontier.empty(); ++depth) {
+    if (context && context->cancellationToken && context->cancellationToken->isCancelled()) {
+      return;
+    }
+    const trait::TraitsDataPtr& relationshipTraitsData =
+        relationshipTraitsDatas[std::min(depth, relationshipTraitsDatas.size() - 1)];
+
+    // Pagers are drained once the query returns, rather than from
+    // within the callback, to avoid re-entering the manager.
+    std::vector<EntityReferencePagerInterfacePtr> pagers(frontier.size());
+    getWithRelationship(
+        frontier, relationshipTraitsData, resultTraitSet, kTraversalPageSize, relationsAccess,
+        context, hostSession,
+        [&](const std::size_t frontierIdx, EntityReferencePagerInterfacePtr pager) {
+          pagers[frontierIdx] = std::move(pager);
+        },
+        [&](const std::size_t frontierIdx, const errors::BatchElementError& error) {
+          for (const std::size_t inputIdx : frontierInputIdxs[frontierIdx]) {
+            if (!failed[inputIdx]) {
+              failed[inputIdx] = true;
+              errorCallback(inputIdx, error);
+            }
+          }
+        });
+
+    EntityReferences queried = std::move(frontier);
+    std::vector<std::vector<std::size_t>> queriedInputIdxs = std::move(frontierInputIdxs);
+    frontier.clear();
+    frontierInputIdxs.clear();
+    frontierIdxs.clear();
+
+    for (std::size_t queriedIdx = 0; queriedIdx < queried.size(); ++queriedIdx) {
+      if (!pagers[queriedIdx]) {
+        continue;
+      }
+      const EntityReferences related =
+          pagers[queriedIdx]->drainAll(std::numeric_limits<std::size_t>::max(), hostSession);
+      pagers[queriedIdx]->close(hostSession);
+
+      for (const std::size_t inputIdx : queriedInputIdxs[queriedIdx]) {
+        if (failed[inputIdx]) {
+          continue;
+        }
+        levels[inputIdx].resize(depth + 1);
+        for (const EntityReference& entityReference : related) {
+          if (visited[inputIdx].insert(entityReference.toString()).second) {
+            levels[inputIdx][depth].push_back(entityReference);
+            addToFrontier(entityReference, inputIdx);
+          }
+        }
+      }
+    }
+  }
+
+  for (std::size_t inputIdx = 0; inputIdx < entityReferences.size(); ++inputIdx) {
+    if (failed[inputIdx]) {
+      continue;
+    }
+    std::vector<EntityReferences>& inputLevels = levels[inputIdx];
+    while (!inputLevels.empty() && inputLevels.back().empty()) {
+      inputLevels.pop_back();
+    }
+    successCallback(inputIdx, std::move(inputLevels));
+  }
+}
+
 void ManagerInterface::preflight(
     [[maybe_unused]] const EntityReferences& entityReferences,
     [[maybe_unused]] const trait::TraitsDatas& traitsHints,
@@ -189,6 +517,92 @@ void ManagerInterface::register_(
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kPublishing)};
 }
 
+void ManagerInterface::entityExistsAsync(const EntityReferences& entityReferences,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         ExistsSuccessCallback successCallback,
+                                         BatchElementErrorCallback errorCallback,
+                                         CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession,
+      [this, entityReferences, context, hostSession, successCallback = std::move(successCallback),
+       errorCallback = std::move(errorCallback)] {
+        entityExists(entityReferences, context, hostSession, successCallback, errorCallback);
+      },
+      std::move(completionCallback));
+}
+
+void ManagerInterface::entityTraitsAsync(const EntityReferences& entityReferences,
+                                         const access::EntityTraitsAccess entityTraitsAccess,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         EntityTraitsSuccessCallback successCallback,
+                                         BatchElementErrorCallback errorCallback,
+                                         CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession,
+      [this, entityReferences, entityTraitsAccess, context, hostSession,
+       successCallback = std::move(successCallback), errorCallback = std::move(errorCallback)] {
+        entityTraits(entityReferences, entityTraitsAccess, context, hostSession, successCallback,
+                     errorCallback);
+      },
+      std::move(completionCallback));
+}
+
+void ManagerInterface::resolveAsync(const EntityReferences& entityReferences,
+                                    const trait::TraitSet& traitSet,
+                                    const access::ResolveAccess resolveAccess,
+                                    const ContextConstPtr& context,
+                                    const HostSessionPtr& hostSession,
+                                    ResolveSuccessCallback successCallback,
+                                    BatchElementErrorCallback errorCallback,
+                                    CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession,
+      [this, entityReferences, traitSet, resolveAccess, context, hostSession,
+       successCallback = std::move(successCallback), errorCallback = std::move(errorCallback)] {
+        resolve(entityReferences, traitSet, resolveAccess, context, hostSession, successCallback,
+                errorCallback);
+      },
+      std::move(completionCallback));
+}
+
+void ManagerInterface::preflightAsync(const EntityReferences& entityReferences,
+                                      const trait::TraitsDatas& traitsHints,
+                                      const access::PublishingAccess publishingAccess,
+                                      const ContextConstPtr& context,
+                                      const HostSessionPtr& hostSession,
+                                      PreflightSuccessCallback successCallback,
+                                      BatchElementErrorCallback errorCallback,
+                                      CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession,
+      [this, entityReferences, traitsHints, publishingAccess, context, hostSession,
+       successCallback = std::move(successCallback), errorCallback = std::move(errorCallback)] {
+        preflight(entityReferences, traitsHints, publishingAccess, context, hostSession,
+                  successCallback, errorCallback);
+      },
+      std::move(completionCallback));
+}
+
+void ManagerInterface::registerAsync(const EntityReferences& entityReferences,
+                                     const trait::TraitsDatas& entityTraitsDatas,
+                                     const access::PublishingAccess publishingAccess,
+                                     const ContextConstPtr& context,
+                                     const HostSessionPtr& hostSession,
+                                     RegisterSuccessCallback successCallback,
+                                     BatchElementErrorCallback errorCallback,
+                                     CompletionCallback completionCallback) {
+  internal::runOnHostScheduler(
+      hostSession,
+      [this, entityReferences, entityTraitsDatas, publishingAccess, context, hostSession,
+       successCallback = std::move(successCallback), errorCallback = std::move(errorCallback)] {
+        register_(entityReferences, entityTraitsDatas, publishingAccess, context, hostSession,
+                  successCallback, errorCallback);
+      },
+      std::move(completionCallback));
+}
+
 }  // namespace managerApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
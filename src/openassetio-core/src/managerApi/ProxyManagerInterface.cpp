@@ -0,0 +1,321 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/managerApi/ProxyManagerInterface.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+
+ProxyManagerInterface::ProxyManagerInterface(ManagerInterfacePtr proxied)
+    : proxied_{std::move(proxied)} {
+  if (!proxied_) {
+    throw errors::InputValidationException{"Proxied manager interface cannot be null"};
+  }
+}
+
+const ManagerInterfacePtr& ProxyManagerInterface::proxied() const { return proxied_; }
+
+Identifier ProxyManagerInterface::identifier() const {
+  return proxied_->identifier();
+}
+
+Str ProxyManagerInterface::displayName() const {
+  return proxied_->displayName();
+}
+
+bool ProxyManagerInterface::hasCapability(const Capability capability) {
+  return proxied_->hasCapability(capability);
+}
+
+InfoDictionary ProxyManagerInterface::info() {
+  return proxied_->info();
+}
+
+StrMap ProxyManagerInterface::updateTerminology(StrMap terms, const HostSessionPtr& hostSession) {
+  return proxied_->updateTerminology(std::move(terms), hostSession);
+}
+
+InfoDictionary ProxyManagerInterface::settings(const HostSessionPtr& hostSession) {
+  return proxied_->settings(hostSession);
+}
+
+void ProxyManagerInterface::initialize(InfoDictionary managerSettings,
+                                       const HostSessionPtr& hostSession) {
+  proxied_->initialize(std::move(managerSettings), hostSession);
+}
+
+void ProxyManagerInterface::flushCaches(const HostSessionPtr& hostSession) {
+  proxied_->flushCaches(hostSession);
+}
+
+void ProxyManagerInterface::flushEntityCaches(const EntityReferences& entityReferences,
+                                              const HostSessionPtr& hostSession) {
+  proxied_->flushEntityCaches(entityReferences, hostSession);
+}
+
+void ProxyManagerInterface::flushCachesWithPrefix(const Str& prefix,
+                                                  const HostSessionPtr& hostSession) {
+  proxied_->flushCachesWithPrefix(prefix, hostSession);
+}
+
+trait::TraitsDatas ProxyManagerInterface::managementPolicy(const trait::TraitSets& traitSets,
+                                                           const access::PolicyAccess policyAccess,
+                                                           const ContextConstPtr& context,
+                                                           const HostSessionPtr& hostSession) {
+  return proxied_->managementPolicy(traitSets, policyAccess, context, hostSession);
+}
+
+ManagerStateBasePtr ProxyManagerInterface::createState(const HostSessionPtr& hostSession) {
+  return proxied_->createState(hostSession);
+}
+
+ManagerStateBasePtr ProxyManagerInterface::createChildState(const ManagerStateBasePtr& parentState,
+                                                            const HostSessionPtr& hostSession) {
+  return proxied_->createChildState(parentState, hostSession);
+}
+
+Str ProxyManagerInterface::persistenceTokenForState(const ManagerStateBasePtr& state,
+                                                    const HostSessionPtr& hostSession) {
+  return proxied_->persistenceTokenForState(state, hostSession);
+}
+
+ManagerStateBasePtr ProxyManagerInterface::stateFromPersistenceToken(
+    const Str& token, const HostSessionPtr& hostSession) {
+  return proxied_->stateFromPersistenceToken(token, hostSession);
+}
+
+bool ProxyManagerInterface::resetState(const ManagerStateBasePtr& state,
+                                       const HostSessionPtr& hostSession) {
+  return proxied_->resetState(state, hostSession);
+}
+
+bool ProxyManagerInterface::isEntityReferenceString(const Str& someString,
+                                                    const HostSessionPtr& hostSession) {
+  return proxied_->isEntityReferenceString(someString, hostSession);
+}
+
+std::vector<bool> ProxyManagerInterface::areEntityReferenceStrings(
+    const std::vector<Str>& someStrings, const HostSessionPtr& hostSession) {
+  return proxied_->areEntityReferenceStrings(someStrings, hostSession);
+}
+
+void ProxyManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         const ExistsSuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback) {
+  proxied_->entityExists(entityReferences, context, hostSession, successCallback, errorCallback);
+}
+
+EntityExistenceFilterConstPtr ProxyManagerInterface::entityExistenceFilter(
+    const HostSessionPtr& hostSession) {
+  return proxied_->entityExistenceFilter(hostSession);
+}
+
+void ProxyManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                         const access::EntityTraitsAccess entityTraitsAccess,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         const EntityTraitsSuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback) {
+  proxied_->entityTraits(entityReferences, entityTraitsAccess, context, hostSession,
+                         successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::resolve(const EntityReferences& entityReferences,
+                                    const trait::TraitSet& traitSet,
+                                    const access::ResolveAccess resolveAccess,
+                                    const ContextConstPtr& context,
+                                    const HostSessionPtr& hostSession,
+                                    const ResolveSuccessCallback& successCallback,
+                                    const BatchElementErrorCallback& errorCallback) {
+  proxied_->resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                    successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::resolveHeterogeneous(
+    const EntityReferences& entityReferences, const trait::TraitSets& traitSets,
+    const std::vector<std::size_t>& traitSetIndices, const access::ResolveAccess resolveAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->resolveHeterogeneous(entityReferences, traitSets, traitSetIndices, resolveAccess,
+                                 context, hostSession, successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::resolveProjected(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const trait::PropertyProjection& propertyProjection, const access::ResolveAccess resolveAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->resolveProjected(entityReferences, traitSet, propertyProjection, resolveAccess,
+                             context, hostSession, successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::resolveColumnar(const EntityReferences& entityReferences,
+                                            const trait::TraitSet& traitSet,
+                                            const access::ResolveAccess resolveAccess,
+                                            const ContextConstPtr& context,
+                                            const HostSessionPtr& hostSession,
+                                            trait::TraitsDataTable& results,
+                                            const BatchElementErrorCallback& errorCallback) {
+  proxied_->resolveColumnar(entityReferences, traitSet, resolveAccess, context, hostSession,
+                            results, errorCallback);
+}
+
+void ProxyManagerInterface::resolveIfChanged(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const std::vector<Str>& generationTokens,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const ConditionalResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->resolveIfChanged(entityReferences, traitSet, resolveAccess, generationTokens,
+                             context, hostSession, successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession,
+                                   successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->getWithRelationship(entityReferences, relationshipTraitsData, resultTraitSet, pageSize,
+                                relationsAccess, context, hostSession, successCallback,
+                                errorCallback);
+}
+
+void ProxyManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->getWithRelationships(entityReference, relationshipTraitsDatas, resultTraitSet,
+                                 pageSize, relationsAccess, context, hostSession, successCallback,
+                                 errorCallback);
+}
+
+void ProxyManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas, resultTraitSet,
+                                       pageSize, relationsAccess, context, hostSession,
+                                       successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::traverseRelationships(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const std::size_t maxDepth,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipTraversalSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  proxied_->traverseRelationships(entityReferences, relationshipTraitsDatas, resultTraitSet,
+                                  maxDepth, relationsAccess, context, hostSession,
+                                  successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::preflight(const EntityReferences& entityReferences,
+                                      const trait::TraitsDatas& traitsHints,
+                                      const access::PublishingAccess publishingAccess,
+                                      const ContextConstPtr& context,
+                                      const HostSessionPtr& hostSession,
+                                      const PreflightSuccessCallback& successCallback,
+                                      const BatchElementErrorCallback& errorCallback) {
+  proxied_->preflight(entityReferences, traitsHints, publishingAccess, context, hostSession,
+                      successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::register_(const EntityReferences& entityReferences,
+                                      const trait::TraitsDatas& entityTraitsDatas,
+                                      const access::PublishingAccess publishingAccess,
+                                      const ContextConstPtr& context,
+                                      const HostSessionPtr& hostSession,
+                                      const RegisterSuccessCallback& successCallback,
+                                      const BatchElementErrorCallback& errorCallback) {
+  proxied_->register_(entityReferences, entityTraitsDatas, publishingAccess, context, hostSession,
+                      successCallback, errorCallback);
+}
+
+void ProxyManagerInterface::entityExistsAsync(const EntityReferences& entityReferences,
+                                              const ContextConstPtr& context,
+                                              const HostSessionPtr& hostSession,
+                                              ExistsSuccessCallback successCallback,
+                                              BatchElementErrorCallback errorCallback,
+                                              CompletionCallback completionCallback) {
+  proxied_->entityExistsAsync(entityReferences, context, hostSession, std::move(successCallback),
+                              std::move(errorCallback), std::move(completionCallback));
+}
+
+void ProxyManagerInterface::entityTraitsAsync(const EntityReferences& entityReferences,
+                                              const access::EntityTraitsAccess entityTraitsAccess,
+                                              const ContextConstPtr& context,
+                                              const HostSessionPtr& hostSession,
+                                              EntityTraitsSuccessCallback successCallback,
+                                              BatchElementErrorCallback errorCallback,
+                                              CompletionCallback completionCallback) {
+  proxied_->entityTraitsAsync(entityReferences, entityTraitsAccess, context, hostSession,
+                              std::move(successCallback), std::move(errorCallback),
+                              std::move(completionCallback));
+}
+
+void ProxyManagerInterface::resolveAsync(const EntityReferences& entityReferences,
+                                         const trait::TraitSet& traitSet,
+                                         const access::ResolveAccess resolveAccess,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         ResolveSuccessCallback successCallback,
+                                         BatchElementErrorCallback errorCallback,
+                                         CompletionCallback completionCallback) {
+  proxied_->resolveAsync(entityReferences, traitSet, resolveAccess, context, hostSession,
+                         std::move(successCallback), std::move(errorCallback),
+                         std::move(completionCallback));
+}
+
+void ProxyManagerInterface::preflightAsync(const EntityReferences& entityReferences,
+                                           const trait::TraitsDatas& traitsHints,
+                                           const access::PublishingAccess publishingAccess,
+                                           const ContextConstPtr& context,
+                                           const HostSessionPtr& hostSession,
+                                           PreflightSuccessCallback successCallback,
+                                           BatchElementErrorCallback errorCallback,
+                                           CompletionCallback completionCallback) {
+  proxied_->preflightAsync(entityReferences, traitsHints, publishingAccess, context, hostSession,
+                           std::move(successCallback), std::move(errorCallback),
+                           std::move(completionCallback));
+}
+
+void ProxyManagerInterface::registerAsync(const EntityReferences& entityReferences,
+                                          const trait::TraitsDatas& entityTraitsDatas,
+                                          const access::PublishingAccess publishingAccess,
+                                          const ContextConstPtr& context,
+                                          const HostSessionPtr& hostSession,
+                                          RegisterSuccessCallback successCallback,
+                                          BatchElementErrorCallback errorCallback,
+                                          CompletionCallback completionCallback) {
+  proxied_->registerAsync(entityReferences, entityTraitsDatas, publishingAccess, context,
+                          hostSession, std::move(successCallback), std::move(errorCallback),
+                          std::move(completionCallback));
+}
+
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/SyntheticManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/property.hpp>
+
+#include "../trait/hashing.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+
+namespace {
+/**
+ * FNV-1a hash of a string, continuing from `hash`.
+ *
+ * Unlike `std::hash`, the result is stable across processes and
+ * platforms, so synthesised data is reproducible.
+ */
+std::uint64_t fnv1a(const std::string_view str,
+                    std::uint64_t hash = 0xcbf29ce484222325ULL) {  // NOLINT(*-magic-numbers)
+  for (const char chr : str) {
+    hash ^= static_cast<unsigned char>(chr);
+    hash *= 0x100000001b3ULL;  // NOLINT(*-magic-numbers)
+  }
+  return hash;
+}
+
+/**
+ * Generate a string of `size` hex digits from `seed`.
+ */
+Str synthesiseValue(std::uint64_t seed, const std::size_t size) {
+  static constexpr std::string_view kDigits = "0123456789abcdef";
+  static constexpr std::size_t kBitsPerDigit = 4;
+  static constexpr std::size_t kDigitsPerWord = 64 / kBitsPerDigit;
+
+  Str value(size, '\0');
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    if (idx % kDigitsPerWord == 0) {
+      seed = trait::mixHash(seed + idx);
+    }
+    value[idx] = kDigits[seed & (kDigits.size() - 1)];
+    seed >>= kBitsPerDigit;
+  }
+  return value;
+}
+
+/// Get a non-negative integer setting, or throw.
+std::size_t sizeSetting(const std::string_view key, const InfoDictionaryValue& value) {
+  const auto* intValue = std::get_if<Int>(&value);
+  if (intValue == nullptr || *intValue < 0) {
+    throw errors::ConfigurationException{
+        fmt::format("SyntheticManager: '{}' must be a non-negative integer", key)};
+  }
+  return static_cast<std::size_t>(*intValue);
+}
+
+/// Get a trait set from a newline-separated list setting, or throw.
+trait::TraitSet traitSetSetting(const std::string_view key, const InfoDictionaryValue& value) {
+  const auto* strValue = std::get_if<Str>(&value);
+  if (strValue == nullptr) {
+    throw errors::ConfigurationException{
+        fmt::format("SyntheticManager: '{}' must be a newline-separated string", key)};
+  }
+  trait::TraitSet traitSet;
+  std::string_view remaining{*strValue};
+  while (!remaining.empty()) {
+    const std::size_t end = remaining.find('\n');
+    if (const std::string_view traitId = remaining.substr(0, end); !traitId.empty()) {
+      traitSet.emplace(traitId);
+    }
+    remaining = end == std::string_view::npos ? std::string_view{} : remaining.substr(end + 1);
+  }
+  return traitSet;
+}
+}  // namespace
+
+SyntheticManagerInterfacePtr SyntheticManagerInterface::make() {
+  return SyntheticManagerInterfacePtr{new SyntheticManagerInterface};
+}
+
+SyntheticManagerInterface::SyntheticManagerInterface() = default;
+
+Identifier SyntheticManagerInterface::identifier() const { return Identifier{kIdentifier}; }
+
+Str SyntheticManagerInterface::displayName() const { return "Synthetic Manager"; }
+
+bool SyntheticManagerInterface::hasCapability(const Capability capability) {
+  switch (capability) {
+    case Capability::kEntityReferenceIdentification:
+    case Capability::kManagementPolicyQueries:
+    case Capability::kEntityTraitIntrospection:
+    case Capability::kExistenceQueries:
+    case Capability::kResolution:
+      return true;
+    default:
+      return false;
+  }
+}
+
+InfoDictionary SyntheticManagerInterface::info() {
+  return {{Str{constants::kInfoKey_EntityReferencesMatchPrefix}, settings_.prefix},
+          {Str{constants::kInfoKey_IsThreadSafe}, true}};
+}
+
+InfoDictionary SyntheticManagerInterface::settings(
+    [[maybe_unused]] const HostSessionPtr& hostSession) {
+  Str joinedEntityTraitSet;
+  for (const trait::TraitId& traitId : settings_.entityTraitSet) {
+    if (!joinedEntityTraitSet.empty()) {
+      joinedEntityTraitSet += '\n';
+    }
+    joinedEntityTraitSet += traitId;
+  }
+  return {
+      {Str{kSettingsKey_Prefix}, settings_.prefix},
+      {Str{kSettingsKey_PropertyCount}, static_cast<Int>(settings_.propertyCount)},
+      {Str{kSettingsKey_PropertySize}, static_cast<Int>(settings_.propertySize)},
+      {Str{kSettingsKey_EntityTraitSet}, joinedEntityTraitSet},
+      {Str{kSettingsKey_CallLatencyMicroseconds}, settings_.callLatency.count()},
+      {Str{kSettingsKey_ElementLatencyMicroseconds}, settings_.elementLatency.count()}};
+}
+
+void SyntheticManagerInterface::initialize(InfoDictionary managerSettings,
+                                           [[maybe_unused]] const HostSessionPtr& hostSession) {
+  Settings settings;
+  for (auto& [key, value] : managerSettings) {
+    if (key == kSettingsKey_Prefix) {
+      auto* prefix = std::get_if<Str>(&value);
+      if (prefix == nullptr || prefix->empty()) {
+        throw errors::ConfigurationException{
+            fmt::format("SyntheticManager: '{}' must be a non-empty string", key)};
+      }
+      settings.prefix = std::move(*prefix);
+    } else if (key == kSettingsKey_PropertyCount) {
+      settings.propertyCount = sizeSetting(key, value);
+    } else if (key == kSettingsKey_PropertySize) {
+      settings.propertySize = sizeSetting(key, value);
+    } else if (key == kSettingsKey_EntityTraitSet) {
+      settings.entityTraitSet = traitSetSetting(key, value);
+    } else if (key == kSettingsKey_CallLatencyMicroseconds) {
+      settings.callLatency = std::chrono::microseconds{sizeSetting(key, value)};
+    } else if (key == kSettingsKey_ElementLatencyMicroseconds) {
+      settings.elementLatency = std::chrono::microseconds{sizeSetting(key, value)};
+    } else {
+      throw errors::ConfigurationException{
+          fmt::format("SyntheticManager: unknown setting '{}'", key)};
+    }
+  }
+  settings_ = std::move(settings);
+}
+
+trait::TraitsDatas SyntheticManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, [[maybe_unused]] const access::PolicyAccess policyAccess,
+    [[maybe_unused]] const ContextConstPtr& context,
+    [[maybe_unused]] const HostSessionPtr& hostSession) {
+  return trait::TraitsData::makeMany(traitSets.size());
+}
+
+bool SyntheticManagerInterface::isEntityReferenceString(
+    const Str& someString, [[maybe_unused]] const HostSessionPtr& hostSession) {
+  return someString.compare(0, settings_.prefix.size(), settings_.prefix) == 0;
+}
+
+void SyntheticManagerInterface::entityExists(
+    const EntityReferences& entityReferences, [[maybe_unused]] const ContextConstPtr& context,
+    [[maybe_unused]] const HostSessionPtr& hostSession,
+    const ExistsSuccessCallback& successCallback, const BatchElementErrorCallback& errorCallback) {
+  simulateLatency(entityReferences.size());
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (!isValid(entityReferences[idx])) {
+      errorCallback(idx, errors::BatchElementError{
+                             errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+                             "Unknown entity reference prefix"});
+      continue;
+    }
+    successCallback(idx, true);
+  }
+}
+
+void SyntheticManagerInterface::entityTraits(
+    const EntityReferences& entityReferences,
+    [[maybe_unused]] const access::EntityTraitsAccess entityTraitsAccess,
+    [[maybe_unused]] const ContextConstPtr& context,
+    [[maybe_unused]] const HostSessionPtr& hostSession,
+    const EntityTraitsSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  simulateLatency(entityReferences.size());
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (!isValid(entityReferences[idx])) {
+      errorCallback(idx, errors::BatchElementError{
+                             errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+                             "Unknown entity reference prefix"});
+      continue;
+    }
+    successCallback(idx, settings_.entityTraitSet);
+  }
+}
+
+void SyntheticManagerInterface::resolve(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    [[maybe_unused]] const access::ResolveAccess resolveAccess,
+    [[maybe_unused]] const ContextConstPtr& context,
+    [[maybe_unused]] const HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  simulateLatency(entityReferences.size());
+
+  // Keys are the same for every trait of every entity.
+  trait::property::KeyValues properties(settings_.propertyCount);
+  for (std::size_t keyIdx = 0; keyIdx < properties.size(); ++keyIdx) {
+    properties[keyIdx].first = fmt::format("p{}", keyIdx);
+  }
+
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const EntityReference& entityReference = entityReferences[idx];
+    if (!isValid(entityReference)) {
+      errorCallback(idx, errors::BatchElementError{
+                             errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+                             "Unknown entity reference prefix"});
+      continue;
+    }
+    const std::uint64_t refHash = fnv1a(entityReference.toString());
+    auto traitsData = trait::TraitsData::make(traitSet);
+    for (const trait::TraitId& traitId : traitSet) {
+      const std::uint64_t traitHash = fnv1a(traitId, refHash);
+      for (auto& [key, value] : properties) {
+        value = synthesiseValue(fnv1a(key, traitHash), settings_.propertySize);
+      }
+      traitsData->setTraitProperties(traitId, properties);
+    }
+    successCallback(idx, std::move(traitsData));
+  }
+}
+
+void SyntheticManagerInterface::simulateLatency(const std::size_t batchSize) const {
+  const auto latency =
+      settings_.callLatency + settings_.elementLatency * static_cast<std::int64_t>(batchSize);
+  if (latency.count() > 0) {
+    std::this_thread::sleep_for(latency);
+  }
+}
+
+bool SyntheticManagerInterface::isValid(const EntityReference& entityReference) const {
+  return entityReference.toString().compare(0, settings_.prefix.size(), settings_.prefix) == 0;
+}
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
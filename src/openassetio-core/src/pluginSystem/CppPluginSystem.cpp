@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/pluginSystem/CppPluginSystem.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemPlugin.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+namespace {
+#if defined(_WIN32)
+constexpr char kPathListSeparator = ';';
+constexpr std::string_view kLibraryExtension = ".dll";
+#elif defined(__APPLE__)
+constexpr char kPathListSeparator = ':';
+constexpr std::string_view kLibraryExtension = ".dylib";
+#else
+constexpr char kPathListSeparator = ':';
+constexpr std::string_view kLibraryExtension = ".so";
+#endif
+
+using EntryPoint = PluginFactory (*)();
+
+/**
+ * Load a shared library, returning its handle, or `nullptr` and
+ * populating `error` on failure.
+ */
+void* openLibrary(const std::filesystem::path& path, Str& error) {
+#if defined(_WIN32)
+  HMODULE handle = LoadLibraryW(path.c_str());
+  if (!handle) {
+    error = fmt::format("error code {}", GetLastError());
+  }
+  return reinterpret_cast<void*>(handle);
+#else
+  // Symbols are kept local, so that plugins with clashing symbols
+  // don't interfere with one another.
+  void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (!handle) {
+    const char* message = dlerror();
+    error = message ? message : "unknown error";
+  }
+  return handle;
+#endif
+}
+
+void* findSymbol(void* handle, const char* name) {
+#if defined(_WIN32)
+  return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name));
+#else
+  return dlsym(handle, name);
+#endif
+}
+
+void closeLibrary(void* handle) {
+#if defined(_WIN32)
+  FreeLibrary(static_cast<HMODULE>(handle));
+#else
+  dlclose(handle);
+#endif
+}
+}  // namespace
+
+CppPluginSystemPtr CppPluginSystem::make(log::LoggerInterfacePtr logger) {
+  return CppPluginSystemPtr{new CppPluginSystem{std::move(logger)}};
+}
+
+CppPluginSystem::CppPluginSystem(log::LoggerInterfacePtr logger) : logger_{std::move(logger)} {}
+
+void CppPluginSystem::reset() {
+  identifiers_.clear();
+  plugins_.clear();
+  paths_.clear();
+}
+
+void CppPluginSystem::scan(const std::string_view paths) {
+  logger_->debug(fmt::format("CppPluginSystem: Searching {}", paths));
+
+  std::size_t start = 0;
+  while (start <= paths.size()) {
+    const std::size_t end = std::min(paths.find(kPathListSeparator, start), paths.size());
+    const std::filesystem::path path{paths.substr(start, end - start)};
+    start = end + 1;
+
+    std::error_code errorCode;
+    if (path.empty() || !std::filesystem::is_directory(path, errorCode)) {
+      logger_->debug(
+          fmt::format("CppPluginSystem: Skipping as not a directory {}", path.string()));
+      continue;
+    }
+
+    std::vector<std::filesystem::path> libraryPaths;
+    try {
+      for (const std::filesystem::directory_entry& entry :
+           std::filesystem::directory_iterator{path}) {
+        if (entry.path().extension() != kLibraryExtension) {
+          logger_->debug(fmt::format("CppPluginSystem: Ignoring as not a shared library {}",
+                                     entry.path().string()));
+          continue;
+        }
+        libraryPaths.push_back(entry.path());
+      }
+    } catch (const std::filesystem::filesystem_error& exc) {
+      logger_->warning(
+          fmt::format("CppPluginSystem: Error searching {}: {}", path.string(), exc.what()));
+    }
+
+    // Directory iteration order is unspecified, so sort for
+    // consistent precedence between runs.
+    std::sort(libraryPaths.begin(), libraryPaths.end());
+    for (const std::filesystem::path& libraryPath : libraryPaths) {
+      load(libraryPath.string());
+    }
+  }
+}
+
+Identifiers CppPluginSystem::identifiers() const { return identifiers_; }
+
+CppPluginSystemPluginPtr CppPluginSystem::plugin(const Identifier& identifier) const {
+  if (const auto iter = plugins_.find(identifier); iter != plugins_.end()) {
+    return iter->second;
+  }
+  throw errors::InputValidationException{fmt::format(
+      "CppPluginSystem: No plug-in registered with the identifier '{}'", identifier)};
+}
+
+void CppPluginSystem::load(const Str& path) {
+  logger_->debug(fmt::format("CppPluginSystem: Attempting to load {}", path));
+
+  Str error;
+  void* handle = openLibrary(path, error);
+  if (!handle) {
+    logger_->error(fmt::format("CppPluginSystem: Error loading {}: {}", path, error));
+    return;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  const auto entryPoint = reinterpret_cast<EntryPoint>(findSymbol(handle, kPluginEntryPointName));
+  if (!entryPoint) {
+    closeLibrary(handle);
+    logger_->error(fmt::format(
+        "CppPluginSystem: No '{}' entry point in {}. It may not be a plugin, or have been built "
+        "against an incompatible version of OpenAssetIO",
+        kPluginEntryPointName, path));
+    return;
+  }
+
+  // From here on the library is never closed, since the plugin (or its
+  // destructor) may still be in use elsewhere.
+  CppPluginSystemPluginPtr plugin;
+  Identifier identifier;
+  try {
+    plugin = entryPoint()();
+    if (!plugin) {
+      logger_->error(fmt::format("CppPluginSystem: Null plugin returned by {}", path));
+      return;
+    }
+    identifier = plugin->identifier();
+  } catch (const std::exception& exc) {
+    logger_->error(
+        fmt::format("CppPluginSystem: Caught exception loading {}: {}", path, exc.what()));
+    return;
+  }
+
+  if (const auto iter = paths_.find(identifier); iter != paths_.end()) {
+    logger_->debug(
+        fmt::format("CppPluginSystem: Skipping '{}' defined in '{}'. Already registered by '{}'",
+                    identifier, path, iter->second));
+    return;
+  }
+
+  logger_->debug(fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}'", identifier,
+                             path));
+  identifiers_.push_back(identifier);
+  paths_.emplace(identifier, path);
+  plugins_.emplace(std::move(identifier), std::move(plugin));
+}
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/pluginSystem/CppPluginSystem.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerImplementationFactory.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerPlugin.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace pluginSystem {
+
+CppPluginSystemManagerImplementationFactoryPtr CppPluginSystemManagerImplementationFactory::make(
+    log::LoggerInterfacePtr logger) {
+  const char* paths = std::getenv(kPluginEnvVar);
+  return make(paths ? paths : "", std::move(logger));
+}
+
+CppPluginSystemManagerImplementationFactoryPtr CppPluginSystemManagerImplementationFactory::make(
+    Str paths, log::LoggerInterfacePtr logger) {
+  return CppPluginSystemManagerImplementationFactoryPtr{
+      new CppPluginSystemManagerImplementationFactory{std::move(paths), std::move(logger)}};
+}
+
+CppPluginSystemManagerImplementationFactory::CppPluginSystemManagerImplementationFactory(
+    Str paths, log::LoggerInterfacePtr logger)
+    : ManagerImplementationFactoryInterface{std::move(logger)}, paths_{std::move(paths)} {}
+
+CppPluginSystemManagerImplementationFactory::~CppPluginSystemManagerImplementationFactory() =
+    default;
+
+Identifiers CppPluginSystemManagerImplementationFactory::identifiers() {
+  const CppPluginSystemPtr& plugins = pluginSystem();
+
+  Identifiers identifiers;
+  for (Identifier& identifier : plugins->identifiers()) {
+    if (std::dynamic_pointer_cast<CppPluginSystemManagerPlugin>(plugins->plugin(identifier))) {
+      identifiers.push_back(std::move(identifier));
+    }
+  }
+  return identifiers;
+}
+
+managerApi::ManagerInterfacePtr CppPluginSystemManagerImplementationFactory::instantiate(
+    const Identifier& identifier) {
+  const CppPluginSystemPtr& plugins = pluginSystem();
+
+  logger_->debug(fmt::format("Instantiating {}", identifier));
+  const auto plugin =
+      std::dynamic_pointer_cast<CppPluginSystemManagerPlugin>(plugins->plugin(identifier));
+  if (!plugin) {
+    throw errors::InputValidationException{fmt::format(
+        "CppPluginSystem: Plug-in registered with the identifier '{}' is not a manager plugin",
+        identifier)};
+  }
+  return plugin->interface();
+}
+
+const CppPluginSystemPtr& CppPluginSystemManagerImplementationFactory::pluginSystem() {
+  const std::lock_guard lock{mutex_};
+  if (!pluginSystem_) {
+    // Construct this here, so we have this even if we early out
+    pluginSystem_ = CppPluginSystem::make(logger_);
+
+    if (paths_.empty()) {
+      logger_->warning(
+          fmt::format("No search paths specified, no plugins will load - check ${} is set.",
+                      kPluginEnvVar));
+    } else {
+      pluginSystem_->scan(paths_);
+    }
+  }
+  return pluginSystem_;
+}
+}  // namespace pluginSystem
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trace/RingBufferTracer.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trace {
+
+RingBufferTracerPtr RingBufferTracer::make(const std::size_t capacity) {
+  if (capacity == 0) {
+    throw errors::InputValidationException{"RingBufferTracer capacity must be greater than zero."};
+  }
+  return std::shared_ptr<RingBufferTracer>(new RingBufferTracer(capacity));
+}
+
+RingBufferTracer::RingBufferTracer(const std::size_t capacity) : capacity_{capacity} {}
+
+TracerInterface::SpanId RingBufferTracer::beginSpan(const Str& name,
+                                                    const InfoDictionary& attributes) {
+  ActiveSpan activeSpan{{name, attributes, std::chrono::system_clock::now(), {}},
+                        std::chrono::steady_clock::now()};
+
+  const std::lock_guard lock{mutex_};
+  const SpanId spanId = nextSpanId_++;
+  activeSpans_.emplace(spanId, std::move(activeSpan));
+  return spanId;
+}
+
+void RingBufferTracer::endSpan(const SpanId spanId, const InfoDictionary& attributes) {
+  const auto end = std::chrono::steady_clock::now();
+
+  const std::lock_guard lock{mutex_};
+  const auto iter = activeSpans_.find(spanId);
+  if (iter == activeSpans_.end()) {
+    return;
+  }
+  Span span = std::move(iter->second.span);
+  span.duration = end - iter->second.start;
+  activeSpans_.erase(iter);
+
+  for (const auto& [key, value] : attributes) {
+    span.attributes.insert_or_assign(key, value);
+  }
+
+  if (spans_.size() == capacity_) {
+    spans_.pop_front();
+  }
+  spans_.push_back(std::move(span));
+}
+
+std::vector<RingBufferTracer::Span> RingBufferTracer::spans() const {
+  const std::lock_guard lock{mutex_};
+  return {spans_.begin(), spans_.end()};
+}
+
+void RingBufferTracer::clear() {
+  const std::lock_guard lock{mutex_};
+  spans_.clear();
+}
+}  // namespace trace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <openassetio/trace/TracerInterface.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trace {
+namespace {
+TracerInterfacePtr processTracer;
+
+/// Whether `processTracer` is set, so that the common case of no
+/// tracer avoids the cost of an atomic `shared_ptr` load.
+std::atomic<bool> hasProcessTracer{false};
+
+/// Serialises setters, so that `hasProcessTracer` is consistent with
+/// `processTracer`.
+std::mutex processTracerMutex;
+}  // namespace
+
+TracerInterface::~TracerInterface() = default;
+
+void TracerInterface::setGlobalTracer(TracerInterfacePtr tracer) {
+  const std::lock_guard lock{processTracerMutex};
+  const bool hasTracer = static_cast<bool>(tracer);
+  std::atomic_store(&processTracer, std::move(tracer));
+  hasProcessTracer.store(hasTracer);
+}
+
+TracerInterfacePtr TracerInterface::globalTracer() {
+  if (!hasProcessTracer.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return std::atomic_load(&processTracer);
+}
+}  // namespace trace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
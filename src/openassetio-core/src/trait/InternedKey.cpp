@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+#include <openassetio/trait/InternedKey.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait::property {
+namespace {
+/**
+ * Process-wide store of interned strings.
+ *
+ * Elements of a node-based set have stable addresses, so pointers to
+ * them can be handed out as handles.
+ */
+struct Registry {
+  std::shared_mutex mutex;
+  std::unordered_set<Key> keys;
+};
+
+Registry& registry() {
+  // Deliberately leaked, so that handles held in static storage remain
+  // valid throughout static destruction.
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  static auto* const kRegistry = new Registry;
+  return *kRegistry;
+}
+
+/// Number of entries in each thread's cache of interned strings.
+constexpr std::size_t kThreadCacheSize = 64;
+
+/**
+ * Entry of this thread's cache of recently used interned strings that
+ * the given string would occupy.
+ *
+ * Interned strings are never released, so cached pointers remain
+ * valid, and the typically small vocabulary of trait IDs and property
+ * keys used by a thread can be found without locking the registry.
+ */
+const Key*& threadCacheEntry(const Key& key) {
+  thread_local std::array<const Key*, kThreadCacheSize> cache{};
+  return cache[std::hash<Key>{}(key) % kThreadCacheSize];
+}
+}  // namespace
+
+InternedKey::InternedKey(const Key& key) {
+  const Key*& cached = threadCacheEntry(key);
+  if (cached && *cached == key) {
+    key_ = cached;
+    return;
+  }
+  Registry& reg = registry();
+  {
+    const std::shared_lock lock{reg.mutex};
+    if (const auto iter = reg.keys.find(key); iter != reg.keys.end()) {
+      key_ = cached = &*iter;
+      return;
+    }
+  }
+  const std::unique_lock lock{reg.mutex};
+  key_ = cached = &*reg.keys.insert(key).first;
+}
+
+std::optional<InternedKey> InternedKey::find(const Key& key) {
+  const Key*& cached = threadCacheEntry(key);
+  if (cached && *cached == key) {
+    return InternedKey{cached};
+  }
+  Registry& reg = registry();
+  const std::shared_lock lock{reg.mutex};
+  if (const auto iter = reg.keys.find(key); iter != reg.keys.end()) {
+    cached = &*iter;
+    return InternedKey{cached};
+  }
+  return std::nullopt;
+}
+}  // namespace trait::property
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
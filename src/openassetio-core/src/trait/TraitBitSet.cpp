@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <bitset>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitBitSet.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+namespace {
+constexpr std::size_t kBitsPerWord = std::numeric_limits<std::uint64_t>::digits;
+}  // namespace
+
+void TraitBitSet::set(const std::size_t index) {
+  const std::size_t wordIdx = index / kBitsPerWord;
+  if (wordIdx >= words_.size()) {
+    words_.resize(wordIdx + 1);
+  }
+  words_[wordIdx] |= Word{1} << (index % kBitsPerWord);
+}
+
+void TraitBitSet::reset(const std::size_t index) {
+  const std::size_t wordIdx = index / kBitsPerWord;
+  if (wordIdx >= words_.size()) {
+    return;
+  }
+  words_[wordIdx] &= ~(Word{1} << (index % kBitsPerWord));
+  trim();
+}
+
+bool TraitBitSet::test(const std::size_t index) const {
+  const std::size_t wordIdx = index / kBitsPerWord;
+  return wordIdx < words_.size() && ((words_[wordIdx] >> (index % kBitsPerWord)) & Word{1}) != 0;
+}
+
+std::size_t TraitBitSet::count() const {
+  std::size_t result = 0;
+  for (const Word word : words_) {
+    result += std::bitset<kBitsPerWord>{word}.count();
+  }
+  return result;
+}
+
+bool TraitBitSet::isSubsetOf(const TraitBitSet& other) const {
+  // Canonical representation means a longer bitset has a set bit
+  // beyond the end of the shorter.
+  if (words_.size() > other.words_.size()) {
+    return false;
+  }
+  for (std::size_t wordIdx = 0; wordIdx < words_.size(); ++wordIdx) {
+    if ((words_[wordIdx] & ~other.words_[wordIdx]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TraitBitSet::intersects(const TraitBitSet& other) const {
+  const std::size_t numWords = std::min(words_.size(), other.words_.size());
+  for (std::size_t wordIdx = 0; wordIdx < numWords; ++wordIdx) {
+    if ((words_[wordIdx] & other.words_[wordIdx]) != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+TraitBitSet& TraitBitSet::operator|=(const TraitBitSet& other) {
+  if (other.words_.size() > words_.size()) {
+    words_.resize(other.words_.size());
+  }
+  for (std::size_t wordIdx = 0; wordIdx < other.words_.size(); ++wordIdx) {
+    words_[wordIdx] |= other.words_[wordIdx];
+  }
+  return *this;
+}
+
+TraitBitSet& TraitBitSet::operator&=(const TraitBitSet& other) {
+  if (words_.size() > other.words_.size()) {
+    words_.resize(other.words_.size());
+  }
+  for (std::size_t wordIdx = 0; wordIdx < words_.size(); ++wordIdx) {
+    words_[wordIdx] &= other.words_[wordIdx];
+  }
+  trim();
+  return *this;
+}
+
+void TraitBitSet::trim() {
+  while (!words_.empty() && words_.back() == 0) {
+    words_.pop_back();
+  }
+}
+
+class TraitRegistry::Impl {
+ public:
+  std::size_t index(const TraitId& traitId) {
+    if (const auto existing = find(traitId)) {
+      return *existing;
+    }
+    const std::unique_lock lock{mutex_};
+    // Another thread may have registered the trait in the meantime.
+    const auto [iter, inserted] = indices_.try_emplace(traitId, traitIds_.size());
+    if (inserted) {
+      traitIds_.push_back(traitId);
+    }
+    return iter->second;
+  }
+
+  [[nodiscard]] std::optional<std::size_t> find(const TraitId& traitId) const {
+    const std::shared_lock lock{mutex_};
+    if (const auto iter = indices_.find(traitId); iter != indices_.end()) {
+      return iter->second;
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] TraitId traitId(const std::size_t index) const {
+    const std::shared_lock lock{mutex_};
+    return lockedTraitId(index);
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    const std::shared_lock lock{mutex_};
+    return traitIds_.size();
+  }
+
+  [[nodiscard]] TraitSet toTraitSet(const std::vector<std::uint64_t>& words) const {
+    TraitSet traitSet;
+    const std::shared_lock lock{mutex_};
+    for (std::size_t wordIdx = 0; wordIdx < words.size(); ++wordIdx) {
+      for (std::uint64_t word = words[wordIdx]; word != 0; word &= word - 1) {
+        // Index of lowest set bit.
+        const auto bitIdx = std::bitset<kBitsPerWord>{(word & -word) - 1}.count();
+        traitSet.insert(lockedTraitId(wordIdx * kBitsPerWord + bitIdx));
+      }
+    }
+    return traitSet;
+  }
+
+ private:
+  [[nodiscard]] const TraitId& lockedTraitId(const std::size_t index) const {
+    if (index >= traitIds_.size()) {
+      throw errors::InputValidationException{
+          fmt::format("Trait bit index {} is not known to the registry", index)};
+    }
+    return traitIds_[index];
+  }
+
+  mutable std::shared_mutex mutex_;
+  std::vector<TraitId> traitIds_;
+  std::unordered_map<TraitId, std::size_t> indices_;
+};
+
+TraitRegistryPtr TraitRegistry::make() {
+  return std::shared_ptr<TraitRegistry>(new TraitRegistry());
+}
+
+TraitRegistry::TraitRegistry() : impl_{std::make_unique<Impl>()} {}
+
+TraitRegistry::~TraitRegistry() = default;
+
+std::size_t TraitRegistry::index(const TraitId& traitId) { return impl_->index(traitId); }
+
+std::optional<std::size_t> TraitRegistry::find(const TraitId& traitId) const {
+  return impl_->find(traitId);
+}
+
+TraitId TraitRegistry::traitId(const std::size_t index) const { return impl_->traitId(index); }
+
+std::size_t TraitRegistry::size() const { return impl_->size(); }
+
+TraitBitSet TraitRegistry::toBitSet(const TraitSet& traitSet) {
+  TraitBitSet bitSet;
+  for (const TraitId& traitId : traitSet) {
+    bitSet.set(impl_->index(traitId));
+  }
+  return bitSet;
+}
+
+TraitBitSet TraitRegistry::toBitSet(const TraitsData& traitsData) {
+  TraitBitSet bitSet;
+  traitsData.forEachTrait([&](const TraitId& traitId) { bitSet.set(impl_->index(traitId)); });
+  return bitSet;
+}
+
+TraitSet TraitRegistry::toTraitSet(const TraitBitSet& bitSet) const {
+  return impl_->toTraitSet(bitSet.words_);
+}
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
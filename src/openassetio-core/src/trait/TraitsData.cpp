@@ -1,15 +1,69 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 
+#include "../internal/footprint.hpp"
+#include "../internal/resourceAllocator.hpp"
+#include "hashing.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace trait {
 
+namespace {
+namespace footprint = internal::footprint;
+using internal::ResourceAllocator;
+using property::InternedKey;
+
+std::size_t traitHash(const InternedTraitId& traitId) {
+  return mixHash(std::hash<InternedTraitId>{}(traitId));
+}
+
+std::size_t propertyHash(const InternedTraitId& traitId, const InternedKey& propertyKey,
+                         const trait::property::Value& value) {
+  // NOLINTBEGIN(readability-magic-numbers)
+  std::uint64_t combined = std::hash<InternedTraitId>{}(traitId);
+  combined = combined * 31U + std::hash<InternedKey>{}(propertyKey);
+  combined = combined * 31U + std::hash<trait::property::Value>{}(value);
+  // NOLINTEND(readability-magic-numbers)
+  return mixHash(combined);
+}
+}  // namespace
+
+/**
+ * Storage for TraitsData.
+ *
+ * Traits and their properties are held in flat vectors kept sorted by
+ * (interned) trait ID, then property key, rather than nested hash
+ * maps. The vast majority of instances hold only a handful of
+ * traits/properties, so a binary search over contiguous storage is at
+ * least as fast as hashing, and avoids a heap allocation for every map
+ * node.
+ *
+ * IDs and keys are interned, such that comparisons during lookup are
+ * pointer comparisons, rather than string comparisons. Note that this
+ * means the sort order is arbitrary (but consistent within a process).
+ *
+ * A structural hash of the contents is maintained incrementally as
+ * elements are added/updated. This is the (wrapping) sum of hashes of
+ * each trait and each property, so is independent of element order.
+ *
+ * Storage is drawn from the memory resource current when the instance
+ * is constructed (or copied), if any, see ScopedMemoryResource.
+ */
 class TraitsData::Impl {
  public:
   Impl() = default;
@@ -22,114 +76,543 @@ class TraitsData::Impl {
 
   [[nodiscard]] trait::TraitSet traitSet() const {
     trait::TraitSet ids;
-    ids.reserve(data_.size());
-    for (const auto& item : data_) {
-      ids.insert(item.first);
+    ids.reserve(traitIds_.size());
+    for (const InternedTraitId& traitId : traitIds_) {
+      ids.insert(traitId.str());
     }
     return ids;
   }
 
-  [[nodiscard]] bool hasTrait(const trait::TraitId& traitId) const {
-    return static_cast<bool>(data_.count(traitId));
+  [[nodiscard]] bool hasTrait(const InternedTraitId& traitId) const {
+    return std::binary_search(traitIds_.begin(), traitIds_.end(), traitId);
   }
 
-  void addTrait(const trait::TraitId& traitId) { data_[traitId]; }
+  void addTrait(const InternedTraitId& traitId) {
+    const auto traitIter = std::lower_bound(traitIds_.begin(), traitIds_.end(), traitId);
+    if (traitIter == traitIds_.end() || *traitIter != traitId) {
+      traitIds_.insert(traitIter, traitId);
+      hash_ += traitHash(traitId);
+    }
+  }
 
   void addTraits(const trait::TraitSet& traitSet) {
+    traitIds_.reserve(traitIds_.size() + traitSet.size());
     for (const auto& traitId : traitSet) {
-      data_[traitId];
+      addTrait(InternedTraitId{traitId});
     }
   }
 
   // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-  bool getTraitProperty(trait::property::Value* out, const trait::TraitId& traitId,
-                        const trait::property::Key& propertyKey) const {
-    const auto& traitIter = data_.find(traitId);
-    if (traitIter == data_.end()) {
+  bool getTraitProperty(trait::property::Value* out, const InternedTraitId& traitId,
+                        const InternedKey& propertyKey) const {
+    const trait::property::Value* value = getTraitPropertyView(traitId, propertyKey);
+    if (value == nullptr) {
       return false;
     }
-    const auto& traitDict = traitIter->second;
-    const auto& propertyIter = traitDict.find(propertyKey);
-    if (propertyIter == traitDict.end()) {
-      return false;
-    }
-    *out = propertyIter->second;
+    *out = *value;
     return true;
   }
 
-  void setTraitProperty(const trait::TraitId& traitId, const trait::property::Key& propertyKey,
+  [[nodiscard]] const trait::property::Value* getTraitPropertyView(
+      const InternedTraitId& traitId, const InternedKey& propertyKey) const {
+    const auto propertyIter = findProperty(traitId, propertyKey);
+    if (propertyIter == properties_.end() || propertyIter->traitId != traitId ||
+        propertyIter->key != propertyKey) {
+      return nullptr;
+    }
+    return &propertyIter->value;
+  }
+
+  void setTraitProperty(const InternedTraitId& traitId, const InternedKey& propertyKey,
                         trait::property::Value propertyValue) {
-    // Use subscript to ensure the trait is added if it is missing
-    data_[traitId][propertyKey] = std::move(propertyValue);
+    // Ensure the trait is added if it is missing.
+    addTrait(traitId);
+
+    const auto propertyIter = findProperty(traitId, propertyKey);
+    if (propertyIter != properties_.end() && propertyIter->traitId == traitId &&
+        propertyIter->key == propertyKey) {
+      hash_ -= propertyHash(traitId, propertyKey, propertyIter->value);
+      hash_ += propertyHash(traitId, propertyKey, propertyValue);
+      propertyIter->value = std::move(propertyValue);
+      return;
+    }
+    hash_ += propertyHash(traitId, propertyKey, propertyValue);
+    properties_.insert(propertyIter,
+                       PropertyEntry{traitId, propertyKey, std::move(propertyValue)});
   }
 
-  [[nodiscard]] trait::property::KeySet traitPropertyKeys(const trait::TraitId& traitId) const {
-    const auto& traitEntry = data_.find(traitId);
-    if (traitEntry == data_.end()) {
-      return {};
+  void setTraitProperties(const InternedTraitId& traitId,
+                          const trait::property::KeyValues& properties) {
+    addTrait(traitId);
+    properties_.reserve(properties_.size() + properties.size());
+    for (const auto& [key, value] : properties) {
+      setTraitProperty(traitId, InternedKey{key}, value);
     }
+  }
+
+  bool getTraitProperties(trait::property::KeyValues* out, const InternedTraitId& traitId) const {
+    out->clear();
+    if (!hasTrait(traitId)) {
+      return false;
+    }
+    const auto [first, last] = traitProperties(traitId);
+    out->reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (auto propertyIter = first; propertyIter != last; ++propertyIter) {
+      out->emplace_back(propertyIter->key.str(), propertyIter->value);
+    }
+    return true;
+  }
+
+  [[nodiscard]] trait::property::KeySet traitPropertyKeys(const InternedTraitId& traitId) const {
+    const auto [first, last] = traitProperties(traitId);
     trait::property::KeySet propertyKeys;
-    propertyKeys.reserve(traitEntry->second.size());
-    for (const auto& propIter : traitEntry->second) {
-      propertyKeys.insert(propIter.first);
+    propertyKeys.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (auto propertyIter = first; propertyIter != last; ++propertyIter) {
+      propertyKeys.insert(propertyIter->key.str());
     }
     return propertyKeys;
   }
 
-  bool operator==(const Impl& other) const { return data_ == other.data_; }
+  void merge(const Impl& other, const MergePolicy policy) {
+    mergeTraits(other);
+    mergeProperties(other, policy);
+  }
+
+  void forEachTrait(const TraitVisitor& visitor) const {
+    for (const InternedTraitId& traitId : traitIds_) {
+      visitor(traitId.str());
+    }
+  }
+
+  void forEachTrait(const InternedTraitVisitor& visitor) const {
+    for (const InternedTraitId& traitId : traitIds_) {
+      visitor(traitId);
+    }
+  }
+
+  void forEachProperty(const InternedTraitId& traitId, const PropertyVisitor& visitor) const {
+    const auto [first, last] = traitProperties(traitId);
+    for (auto propertyIter = first; propertyIter != last; ++propertyIter) {
+      visitor(propertyIter->key.str(), propertyIter->value);
+    }
+  }
+
+  void forEachProperty(const InternedTraitId& traitId,
+                       const InternedPropertyVisitor& visitor) const {
+    const auto [first, last] = traitProperties(traitId);
+    for (auto propertyIter = first; propertyIter != last; ++propertyIter) {
+      visitor(propertyIter->key, propertyIter->value);
+    }
+  }
+
+  [[nodiscard]] std::size_t hash() const { return hash_; }
+
+  [[nodiscard]] std::size_t memoryUsage() const {
+    std::size_t bytes = footprint::kControlBlockBytes + sizeof(Impl) +
+                        footprint::heapBytes(traitIds_) + footprint::heapBytes(properties_);
+    for (const PropertyEntry& entry : properties_) {
+      if (const auto* str = std::get_if<Str>(&entry.value)) {
+        bytes += footprint::heapBytes(*str);
+      }
+    }
+    return bytes;
+  }
+
+  // Both containers are kept sorted, so element-wise comparison is
+  // sufficient to establish equality. Differing hashes allow unequal
+  // instances to be rejected early.
+  bool operator==(const Impl& other) const {
+    return hash_ == other.hash_ && traitIds_ == other.traitIds_ &&
+           properties_ == other.properties_;
+  }
+
+ private:
+  struct PropertyEntry {
+    InternedTraitId traitId;
+    InternedKey key;
+    trait::property::Value value;
+
+    bool operator==(const PropertyEntry& other) const {
+      return traitId == other.traitId && key == other.key && value == other.value;
+    }
+  };
+
+  using TraitIds = std::vector<InternedTraitId, ResourceAllocator<InternedTraitId>>;
+  using PropertyEntries = std::vector<PropertyEntry, ResourceAllocator<PropertyEntry>>;
+
+  /// Order of property entries, i.e. by trait ID, then property key.
+  static bool entryLess(const PropertyEntry& lhs, const PropertyEntry& rhs) {
+    return lhs.traitId < rhs.traitId || (lhs.traitId == rhs.traitId && lhs.key < rhs.key);
+  }
+
+  /// Sorted union of trait IDs.
+  void mergeTraits(const Impl& other) {
+    if (std::includes(traitIds_.begin(), traitIds_.end(), other.traitIds_.begin(),
+                      other.traitIds_.end())) {
+      return;
+    }
+    TraitIds merged{traitIds_.get_allocator()};
+    merged.reserve(traitIds_.size() + other.traitIds_.size());
+    auto ours = traitIds_.cbegin();
+    auto theirs = other.traitIds_.cbegin();
+    while (theirs != other.traitIds_.cend()) {
+      if (ours != traitIds_.cend() && *ours < *theirs) {
+        merged.push_back(*ours++);
+        continue;
+      }
+      if (ours == traitIds_.cend() || *theirs < *ours) {
+        hash_ += traitHash(*theirs);
+      } else {
+        ++ours;
+      }
+      merged.push_back(*theirs++);
+    }
+    merged.insert(merged.end(), ours, traitIds_.cend());
+    // Allocators compare equal, so storage is moved, not copied.
+    traitIds_ = std::move(merged);
+  }
+
+  /// Sorted union of property entries, resolving clashes by policy.
+  void mergeProperties(const Impl& other, const MergePolicy policy) {
+    if (std::includes(properties_.begin(), properties_.end(), other.properties_.begin(),
+                      other.properties_.end(), entryLess)) {
+      // No new entries, so values (if any) can be updated in place.
+      if (policy == MergePolicy::kOverwrite) {
+        auto ours = properties_.begin();
+        for (const PropertyEntry& entry : other.properties_) {
+          ours = std::lower_bound(ours, properties_.end(), entry, entryLess);
+          overwrite(*ours, entry);
+        }
+      }
+      return;
+    }
+    PropertyEntries merged{properties_.get_allocator()};
+    merged.reserve(properties_.size() + other.properties_.size());
+    auto ours = properties_.begin();
+    auto theirs = other.properties_.cbegin();
+    while (theirs != other.properties_.cend()) {
+      if (ours != properties_.end() && entryLess(*ours, *theirs)) {
+        merged.push_back(std::move(*ours++));
+        continue;
+      }
+      if (ours == properties_.end() || entryLess(*theirs, *ours)) {
+        hash_ += propertyHash(theirs->traitId, theirs->key, theirs->value);
+        merged.push_back(*theirs++);
+        continue;
+      }
+      if (policy == MergePolicy::kOverwrite) {
+        overwrite(*ours, *theirs);
+      }
+      merged.push_back(std::move(*ours++));
+      ++theirs;
+    }
+    std::move(ours, properties_.end(), std::back_inserter(merged));
+    properties_ = std::move(merged);
+  }
+
+  /// Replace the value of an entry with that of an equivalent entry.
+  void overwrite(PropertyEntry& entry, const PropertyEntry& other) {
+    if (entry.value == other.value) {
+      return;
+    }
+    hash_ -= propertyHash(entry.traitId, entry.key, entry.value);
+    hash_ += propertyHash(other.traitId, other.key, other.value);
+    entry.value = other.value;
+  }
+
+  /**
+   * Find the first property entry not ordered before the given
+   * trait/key pair, i.e. where it is, or where it should be inserted.
+   */
+  [[nodiscard]] PropertyEntries::const_iterator findProperty(
+      const InternedTraitId& traitId, const InternedKey& propertyKey) const {
+    return std::lower_bound(
+        properties_.begin(), properties_.end(), traitId,
+        [&propertyKey](const PropertyEntry& entry, const InternedTraitId& id) {
+          return entry.traitId < id || (entry.traitId == id && entry.key < propertyKey);
+        });
+  }
+
+  [[nodiscard]] PropertyEntries::iterator findProperty(const InternedTraitId& traitId,
+                                                       const InternedKey& propertyKey) {
+    const auto constIter = std::as_const(*this).findProperty(traitId, propertyKey);
+    return properties_.begin() + std::distance(properties_.cbegin(), constIter);
+  }
+
+  /// Range of property entries belonging to the given trait.
+  [[nodiscard]] std::pair<PropertyEntries::const_iterator, PropertyEntries::const_iterator>
+  traitProperties(const InternedTraitId& traitId) const {
+    struct TraitIdLess {
+      bool operator()(const PropertyEntry& entry, const InternedTraitId& id) const {
+        return entry.traitId < id;
+      }
+      bool operator()(const InternedTraitId& id, const PropertyEntry& entry) const {
+        return id < entry.traitId;
+      }
+    };
+    return std::equal_range(properties_.begin(), properties_.end(), traitId, TraitIdLess{});
+  }
+
+  /// Sorted trait IDs, including traits without any properties set.
+  TraitIds traitIds_;
+  /// Property entries, sorted by trait ID then property key.
+  PropertyEntries properties_;
+  /// Structural hash of traits and properties.
+  std::size_t hash_ = 0;
+};
+
+/**
+ * Single allocation holding both an instance and (via allocate_shared)
+ * its shared_ptr control block.
+ *
+ * Being a nested class, this has access to the private constructors.
+ */
+struct TraitsData::Block {
+  template <class... Args>
+  explicit Block(Args&&... args) : traitsData{std::forward<Args>(args)...} {}
+
+  TraitsData traitsData;
+};
+
+/**
+ * Single allocation holding many default-constructed instances.
+ *
+ * Elements are exposed using the aliasing constructor of shared_ptr,
+ * sharing the control block of the arena.
+ */
+struct TraitsData::Arena {
+  explicit Arena(const std::size_t count)
+      : count_{count}, traitsDatas_{allocator_.allocate(count)} {
+    // Default construction cannot throw.
+    for (std::size_t idx = 0; idx < count_; ++idx) {
+      new (&traitsDatas_[idx]) TraitsData{};
+    }
+  }
+
+  ~Arena() {
+    for (std::size_t idx = 0; idx < count_; ++idx) {
+      traitsDatas_[idx].~TraitsData();
+    }
+    allocator_.deallocate(traitsDatas_, count_);
+  }
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  Arena(Arena&&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  [[nodiscard]] TraitsData* at(const std::size_t idx) const { return &traitsDatas_[idx]; }
 
  private:
-  using Properties = std::unordered_map<trait::property::Key, trait::property::Value>;
-  using PropertiesByTrait = std::unordered_map<trait::TraitId, Properties>;
-  PropertiesByTrait data_;
+  ResourceAllocator<TraitsData> allocator_;
+  std::size_t count_;
+  TraitsData* traitsDatas_;
 };
 
-TraitsDataPtr TraitsData::make() { return std::shared_ptr<TraitsData>(new TraitsData()); }
+TraitsDataPtr TraitsData::make() {
+  auto block = std::allocate_shared<Block>(ResourceAllocator<Block>{});
+  return {block, &block->traitsData};
+}
 
 TraitsDataPtr TraitsData::make(const trait::TraitSet& traitSet) {
-  return std::shared_ptr<TraitsData>(new TraitsData(traitSet));
+  auto block = std::allocate_shared<Block>(ResourceAllocator<Block>{}, traitSet);
+  return {block, &block->traitsData};
 }
 
 TraitsDataPtr TraitsData::make(const TraitsDataConstPtr& other) {
   if (!other) {
     throw errors::InputValidationException("Cannot copy-construct from a null TraitsData");
   }
-  return std::shared_ptr<TraitsData>(new TraitsData(*other));
+  auto block = std::allocate_shared<Block>(ResourceAllocator<Block>{}, *other);
+  return {block, &block->traitsData};
 }
 
-TraitsData::TraitsData() : impl_{std::make_unique<Impl>()} {}
+TraitsDatas TraitsData::makeMany(const std::size_t count) {
+  TraitsDatas result;
+  if (count == 0) {
+    return result;
+  }
+  result.reserve(count);
+  const auto arena = std::allocate_shared<Arena>(ResourceAllocator<Arena>{}, count);
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    result.emplace_back(arena, arena->at(idx));
+  }
+  return result;
+}
+
+// Storage is allocated lazily, on first modification.
+TraitsData::TraitsData() = default;
 
 TraitsData::TraitsData(const trait::TraitSet& traitSet)
-    : impl_{std::make_unique<Impl>(traitSet)} {}
+    : impl_{traitSet.empty() ? nullptr
+                            : std::allocate_shared<Impl>(ResourceAllocator<Impl>{}, traitSet)} {}
 
-TraitsData::TraitsData(const TraitsData& other) : impl_{std::make_unique<Impl>(*other.impl_)} {}
+// Copies share storage until one of them is mutated, see mutableImpl.
+TraitsData::TraitsData(const TraitsData& other) : impl_{other.impl_} {}
 
 TraitsData::~TraitsData() = default;
 
-trait::TraitSet TraitsData::traitSet() const { return impl_->traitSet(); }
+const TraitsData::Impl& TraitsData::impl() const {
+  static const Impl kEmpty;
+  return impl_ ? *impl_ : kEmpty;
+}
+
+TraitsData::Impl& TraitsData::mutableImpl() {
+  if (!impl_) {
+    impl_ = std::allocate_shared<Impl>(ResourceAllocator<Impl>{});
+  } else if (impl_.use_count() > 1) {
+    // If storage is shared with another instance, then take a private
+    // copy before allowing modification. If another instance
+    // concurrently takes its own copy then we may copy unnecessarily,
+    // but never share mutable storage.
+    impl_ = std::allocate_shared<Impl>(ResourceAllocator<Impl>{}, *impl_);
+  } else {
+    // `use_count` is a relaxed load, so storage last shared with an
+    // instance just destroyed on another thread needs this fence to
+    // synchronise with the release of that reference, i.e. so that
+    // its final reads happen before our writes.
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  return *impl_;
+}
+
+trait::TraitSet TraitsData::traitSet() const { return impl().traitSet(); }
+
+void TraitsData::addTrait(const trait::TraitId& traitId) {
+  mutableImpl().addTrait(InternedTraitId{traitId});
+}
+
+void TraitsData::addTrait(const InternedTraitId& traitId) { mutableImpl().addTrait(traitId); }
 
-void TraitsData::addTrait(const trait::TraitId& traitId) { impl_->addTrait(traitId); }
+void TraitsData::addTraits(const trait::TraitSet& traitSet) {
+  mutableImpl().addTraits(traitSet);
+}
 
-void TraitsData::addTraits(const trait::TraitSet& traitSet) { impl_->addTraits(traitSet); }
+bool TraitsData::hasTrait(const trait::TraitId& traitId) const {
+  // If the ID has never been interned, then no instance can have it.
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  return internedTraitId && impl().hasTrait(*internedTraitId);
+}
 
-bool TraitsData::hasTrait(const trait::TraitId& traitId) const { return impl_->hasTrait(traitId); }
+bool TraitsData::hasTrait(const InternedTraitId& traitId) const {
+  return impl().hasTrait(traitId);
+}
 
 bool TraitsData::getTraitProperty(trait::property::Value* out, const trait::TraitId& traitId,
                                   const trait::property::Key& propertyKey) const {
-  return impl_->getTraitProperty(out, traitId, propertyKey);
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  if (!internedTraitId) {
+    return false;
+  }
+  const auto internedKey = InternedKey::find(propertyKey);
+  if (!internedKey) {
+    return false;
+  }
+  return impl().getTraitProperty(out, *internedTraitId, *internedKey);
+}
+
+bool TraitsData::getTraitProperty(trait::property::Value* out, const InternedTraitId& traitId,
+                                  const property::InternedKey& propertyKey) const {
+  return impl().getTraitProperty(out, traitId, propertyKey);
+}
+
+const trait::property::Value* TraitsData::getTraitPropertyView(
+    const trait::TraitId& traitId, const trait::property::Key& propertyKey) const {
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  if (!internedTraitId) {
+    return nullptr;
+  }
+  const auto internedKey = InternedKey::find(propertyKey);
+  if (!internedKey) {
+    return nullptr;
+  }
+  return impl().getTraitPropertyView(*internedTraitId, *internedKey);
+}
+
+const trait::property::Value* TraitsData::getTraitPropertyView(
+    const InternedTraitId& traitId, const property::InternedKey& propertyKey) const {
+  return impl().getTraitPropertyView(traitId, propertyKey);
 }
 
 void TraitsData::setTraitProperty(const trait::TraitId& traitId,
                                   const trait::property::Key& propertyKey,
                                   trait::property::Value propertyValue) {
-  impl_->setTraitProperty(traitId, propertyKey, std::move(propertyValue));
+  mutableImpl().setTraitProperty(InternedTraitId{traitId}, InternedKey{propertyKey},
+                                 std::move(propertyValue));
+}
+
+void TraitsData::setTraitProperty(const InternedTraitId& traitId,
+                                  const property::InternedKey& propertyKey,
+                                  trait::property::Value propertyValue) {
+  mutableImpl().setTraitProperty(traitId, propertyKey, std::move(propertyValue));
+}
+
+void TraitsData::setTraitProperties(const trait::TraitId& traitId,
+                                    const trait::property::KeyValues& properties) {
+  mutableImpl().setTraitProperties(InternedTraitId{traitId}, properties);
+}
+
+bool TraitsData::getTraitProperties(trait::property::KeyValues* out,
+                                    const trait::TraitId& traitId) const {
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  if (!internedTraitId) {
+    out->clear();
+    return false;
+  }
+  return impl().getTraitProperties(out, *internedTraitId);
 }
 
 trait::property::KeySet TraitsData::traitPropertyKeys(const trait::TraitId& traitId) const {
-  return impl_->traitPropertyKeys(traitId);
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  if (!internedTraitId) {
+    return {};
+  }
+  return impl().traitPropertyKeys(*internedTraitId);
+}
+
+trait::property::KeySet TraitsData::traitPropertyKeys(const InternedTraitId& traitId) const {
+  return impl().traitPropertyKeys(traitId);
 }
 
-bool TraitsData::operator==(const TraitsData& other) const { return *impl_ == *other.impl_; }
+void TraitsData::merge(const TraitsData& other, const MergePolicy policy) {
+  if (!other.impl_ || impl_ == other.impl_) {
+    return;
+  }
+  if (!impl_) {
+    // Nothing to merge into, so share storage as for a copy.
+    impl_ = other.impl_;
+    return;
+  }
+  mutableImpl().merge(*other.impl_, policy);
+}
+
+void TraitsData::forEachTrait(const TraitVisitor& visitor) const { impl().forEachTrait(visitor); }
+
+void TraitsData::forEachTrait(const InternedTraitVisitor& visitor) const {
+  impl().forEachTrait(visitor);
+}
+
+void TraitsData::forEachProperty(const trait::TraitId& traitId,
+                                 const PropertyVisitor& visitor) const {
+  if (const auto internedTraitId = InternedTraitId::find(traitId)) {
+    impl().forEachProperty(*internedTraitId, visitor);
+  }
+}
+
+void TraitsData::forEachProperty(const InternedTraitId& traitId,
+                                 const InternedPropertyVisitor& visitor) const {
+  impl().forEachProperty(traitId, visitor);
+}
+
+std::size_t TraitsData::hash() const { return impl().hash(); }
+
+std::size_t TraitsData::memoryUsage() const {
+  return sizeof(TraitsData) + (impl_ ? impl_->memoryUsage() : 0);
+}
+
+bool TraitsData::operator==(const TraitsData& other) const {
+  return impl_ == other.impl_ || impl() == other.impl();
+}
 }  // namespace trait
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
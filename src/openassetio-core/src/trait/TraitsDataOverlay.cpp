@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsDataOverlay.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+namespace {
+void validateLayer(const TraitsDataConstPtr& layer) {
+  if (!layer) {
+    throw errors::InputValidationException{"TraitsDataOverlay layers must not be null"};
+  }
+}
+}  // namespace
+
+TraitsDataOverlay::TraitsDataOverlay(Layers layers) : layers_{std::move(layers)} {
+  std::for_each(layers_.begin(), layers_.end(), validateLayer);
+}
+
+void TraitsDataOverlay::addLayer(TraitsDataConstPtr layer) {
+  validateLayer(layer);
+  layers_.push_back(std::move(layer));
+}
+
+bool TraitsDataOverlay::hasTrait(const TraitId& traitId) const {
+  // If the ID has never been interned, then no layer can have it.
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  return internedTraitId && hasTrait(*internedTraitId);
+}
+
+bool TraitsDataOverlay::hasTrait(const InternedTraitId& traitId) const {
+  return std::any_of(layers_.begin(), layers_.end(),
+                     [&traitId](const TraitsDataConstPtr& layer) {
+                       return layer->hasTrait(traitId);
+                     });
+}
+
+const property::Value* TraitsDataOverlay::getTraitPropertyView(
+    const TraitId& traitId, const property::Key& propertyKey) const {
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  if (!internedTraitId) {
+    return nullptr;
+  }
+  const auto internedKey = property::InternedKey::find(propertyKey);
+  if (!internedKey) {
+    return nullptr;
+  }
+  return getTraitPropertyView(*internedTraitId, *internedKey);
+}
+
+const property::Value* TraitsDataOverlay::getTraitPropertyView(
+    const InternedTraitId& traitId, const property::InternedKey& propertyKey) const {
+  for (auto layer = layers_.rbegin(); layer != layers_.rend(); ++layer) {
+    if (const property::Value* value = (*layer)->getTraitPropertyView(traitId, propertyKey)) {
+      return value;
+    }
+  }
+  return nullptr;
+}
+
+bool TraitsDataOverlay::getTraitProperty(property::Value* out, const TraitId& traitId,
+                                         const property::Key& propertyKey) const {
+  const property::Value* value = getTraitPropertyView(traitId, propertyKey);
+  if (value == nullptr) {
+    return false;
+  }
+  *out = *value;
+  return true;
+}
+
+TraitSet TraitsDataOverlay::traitSet() const {
+  TraitSet traitIds;
+  forEachTrait([&traitIds](const TraitId& traitId) { traitIds.insert(traitId); });
+  return traitIds;
+}
+
+void TraitsDataOverlay::forEachTrait(const TraitsData::TraitVisitor& visitor) const {
+  for (std::size_t layerIdx = 0; layerIdx < layers_.size(); ++layerIdx) {
+    layers_[layerIdx]->forEachTrait([&](const InternedTraitId& traitId) {
+      // Visit each trait in the lowest layer that has it.
+      for (std::size_t lowerIdx = 0; lowerIdx < layerIdx; ++lowerIdx) {
+        if (layers_[lowerIdx]->hasTrait(traitId)) {
+          return;
+        }
+      }
+      visitor(traitId.str());
+    });
+  }
+}
+
+void TraitsDataOverlay::forEachProperty(const TraitId& traitId,
+                                        const TraitsData::PropertyVisitor& visitor) const {
+  const auto internedTraitId = InternedTraitId::find(traitId);
+  if (!internedTraitId) {
+    return;
+  }
+  for (std::size_t layerIdx = 0; layerIdx < layers_.size(); ++layerIdx) {
+    layers_[layerIdx]->forEachProperty(
+        *internedTraitId,
+        [&](const property::InternedKey& propertyKey, const property::Value& value) {
+          if (!isShadowed(layerIdx, *internedTraitId, propertyKey)) {
+            visitor(propertyKey.str(), value);
+          }
+        });
+  }
+}
+
+TraitsDataPtr TraitsDataOverlay::flatten() const {
+  if (layers_.empty()) {
+    return TraitsData::make();
+  }
+  TraitsDataPtr result = TraitsData::make(layers_.front());
+  for (auto layer = std::next(layers_.begin()); layer != layers_.end(); ++layer) {
+    result->merge(**layer);
+  }
+  return result;
+}
+
+bool TraitsDataOverlay::isShadowed(const std::size_t layerIdx, const InternedTraitId& traitId,
+                                   const property::InternedKey& propertyKey) const {
+  for (std::size_t higherIdx = layerIdx + 1; higherIdx < layers_.size(); ++higherIdx) {
+    if (layers_[higherIdx]->getTraitPropertyView(traitId, propertyKey) != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/TraitsDataTable.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+namespace {
+constexpr std::size_t kBitsPerWord = std::numeric_limits<std::uint64_t>::digits;
+
+std::size_t wordCount(const std::size_t bitCount) {
+  return (bitCount + kBitsPerWord - 1) / kBitsPerWord;
+}
+
+bool testBit(const std::vector<std::uint64_t>& bits, const std::size_t index) {
+  return (bits[index / kBitsPerWord] >> (index % kBitsPerWord) & 1U) != 0;
+}
+
+void assignBit(std::vector<std::uint64_t>& bits, const std::size_t index, const bool value) {
+  const std::uint64_t mask = std::uint64_t{1} << (index % kBitsPerWord);
+  if (value) {
+    bits[index / kBitsPerWord] |= mask;
+  } else {
+    bits[index / kBitsPerWord] &= ~mask;
+  }
+}
+}  // namespace
+
+TraitsDataTable::TraitsDataTable(TraitSet traitSet) : traitSet_{std::move(traitSet)} {}
+
+void TraitsDataTable::addTraits(const TraitSet& traitSet) {
+  traitSet_.insert(traitSet.begin(), traitSet.end());
+}
+
+void TraitsDataTable::addTrait(const std::size_t row, const TraitId& traitId) {
+  assignBit(traitRows_[traitIndex(traitId)].membership, row, true);
+}
+
+bool TraitsDataTable::hasTrait(const std::size_t row, const TraitId& traitId) const {
+  const std::optional<std::size_t> traitIdx = findTrait(traitId);
+  return traitIdx && testBit(traitRows_[*traitIdx].membership, row);
+}
+
+void TraitsDataTable::reset(const std::size_t rowCount) {
+  rowCount_ = rowCount;
+  for (TraitRows& traitRows : traitRows_) {
+    traitRows.membership.assign(wordCount(rowCount), 0);
+  }
+  for (ColumnData& column : columns_) {
+    std::visit([rowCount](auto& values) { values.assign(rowCount, {}); }, column.values);
+    column.validity.assign(wordCount(rowCount), 0);
+  }
+}
+
+std::size_t TraitsDataTable::addColumn(const TraitId& traitId, const property::Key& propertyKey,
+                                       ColumnValues prototype) {
+  if (const std::optional<std::size_t> existing = findColumn(traitId, propertyKey)) {
+    if (columns_[*existing].values.index() != prototype.index()) {
+      throwTypeMismatch(*existing);
+    }
+    return *existing;
+  }
+  std::visit([this](auto& values) { values.resize(rowCount_); }, prototype);
+  const std::size_t traitIdx = traitIndex(traitId);
+  columns_.push_back(ColumnData{traitId, traitIdx, propertyKey, std::move(prototype),
+                                std::vector<std::uint64_t>(wordCount(rowCount_), 0)});
+  return columns_.size() - 1;
+}
+
+std::optional<std::size_t> TraitsDataTable::findTrait(const TraitId& traitId) const {
+  for (std::size_t idx = 0; idx < traitRows_.size(); ++idx) {
+    if (traitRows_[idx].traitId == traitId) {
+      return idx;
+    }
+  }
+  return std::nullopt;
+}
+
+std::size_t TraitsDataTable::traitIndex(const TraitId& traitId) {
+  if (const std::optional<std::size_t> existing = findTrait(traitId)) {
+    return *existing;
+  }
+  traitRows_.push_back(TraitRows{traitId, std::vector<std::uint64_t>(wordCount(rowCount_), 0)});
+  traitSet_.insert(traitId);
+  return traitRows_.size() - 1;
+}
+
+void TraitsDataTable::clearRow(const std::size_t row) {
+  for (TraitRows& traitRows : traitRows_) {
+    assignBit(traitRows.membership, row, false);
+  }
+  for (ColumnData& column : columns_) {
+    assignBit(column.validity, row, false);
+  }
+}
+
+std::optional<std::size_t> TraitsDataTable::findColumn(const TraitId& traitId,
+                                                       const property::Key& propertyKey) const {
+  return findColumnFrom(traitId, propertyKey, 0);
+}
+
+std::optional<std::size_t> TraitsDataTable::findColumnFrom(const TraitId& traitId,
+                                                           const property::Key& propertyKey,
+                                                           const std::size_t start) const {
+  for (std::size_t offset = 0; offset < columns_.size(); ++offset) {
+    const std::size_t idx = (start + offset) % columns_.size();
+    if (columns_[idx].propertyKey == propertyKey && columns_[idx].traitId == traitId) {
+      return idx;
+    }
+  }
+  return std::nullopt;
+}
+
+const TraitId& TraitsDataTable::columnTraitId(const std::size_t column) const {
+  return columns_[column].traitId;
+}
+
+const property::Key& TraitsDataTable::columnPropertyKey(const std::size_t column) const {
+  return columns_[column].propertyKey;
+}
+
+bool TraitsDataTable::setValue(const std::size_t row, const std::size_t column,
+                               property::Value value) {
+  ColumnData& columnData = columns_[column];
+  if (columnData.values.index() != value.index()) {
+    return false;
+  }
+  std::visit(
+      [&](auto& typedValue) {
+        using T = std::decay_t<decltype(typedValue)>;
+        std::get<Column<T>>(columnData.values)[row] = std::move(typedValue);
+      },
+      value);
+  assignBit(columnData.validity, row, true);
+  assignBit(traitRows_[columnData.traitIdx].membership, row, true);
+  return true;
+}
+
+bool TraitsDataTable::isValid(const std::size_t row, const std::size_t column) const {
+  return testBit(columns_[column].validity, row);
+}
+
+const std::vector<std::uint64_t>& TraitsDataTable::validity(const std::size_t column) const {
+  return columns_[column].validity;
+}
+
+bool TraitsDataTable::setRow(const std::size_t row, const TraitsData& traitsData) {
+  clearRow(row);
+  // Properties are visited in a consistent order, so once the schema
+  // is established, each lookup succeeds at the first attempt.
+  std::size_t nextColumn = 0;
+  bool isSet = true;
+  traitsData.forEachTrait([&](const TraitId& traitId) {
+    addTrait(row, traitId);
+    traitsData.forEachProperty(
+        traitId, [&](const property::Key& propertyKey, const property::Value& value) {
+          std::optional<std::size_t> column = findColumnFrom(traitId, propertyKey, nextColumn);
+          if (!column) {
+            column = std::visit(
+                [&](const auto& typedValue) {
+                  using T = std::decay_t<decltype(typedValue)>;
+                  return addColumn<T>(traitId, propertyKey);
+                },
+                value);
+          }
+          isSet = setValue(row, *column, value) && isSet;
+          nextColumn = *column + 1;
+        });
+  });
+  if (!isSet) {
+    clearRow(row);
+  }
+  return isSet;
+}
+
+std::vector<std::size_t> TraitsDataTable::setRows(const std::size_t firstRow,
+                                                  const TraitsDataTable& other) {
+  if (firstRow > rowCount_ || other.rowCount_ > rowCount_ - firstRow) {
+    throw errors::InputValidationException{
+        fmt::format("Cannot set {} rows from row {} of a table with {} rows", other.rowCount_,
+                    firstRow, rowCount_)};
+  }
+  addTraits(other.traitSet_);
+  for (const TraitRows& source : other.traitRows_) {
+    TraitRows& target = traitRows_[traitIndex(source.traitId)];
+    for (std::size_t row = 0; row < other.rowCount_; ++row) {
+      assignBit(target.membership, firstRow + row, testBit(source.membership, row));
+    }
+  }
+  // Rows of the other table holding a value in a column of a
+  // different type to ours cannot be copied.
+  std::vector<std::uint64_t> mismatched(wordCount(other.rowCount_), 0);
+  for (const ColumnData& source : other.columns_) {
+    const std::optional<std::size_t> existing = findColumn(source.traitId, source.propertyKey);
+    if (existing && columns_[*existing].values.index() != source.values.index()) {
+      std::transform(mismatched.begin(), mismatched.end(), source.validity.begin(),
+                     mismatched.begin(), std::bit_or<>{});
+      continue;
+    }
+    const std::size_t column = std::visit(
+        [&](const auto& sourceValues) {
+          using Values = std::decay_t<decltype(sourceValues)>;
+          return addColumn(source.traitId, source.propertyKey, ColumnValues{Values{}});
+        },
+        source.values);
+    ColumnData& target = columns_[column];
+    std::visit(
+        [&](const auto& sourceValues) {
+          using Values = std::decay_t<decltype(sourceValues)>;
+          std::copy(sourceValues.begin(), sourceValues.end(),
+                    std::get<Values>(target.values).begin() +
+                        static_cast<typename Values::difference_type>(firstRow));
+        },
+        source.values);
+    for (std::size_t row = 0; row < other.rowCount_; ++row) {
+      assignBit(target.validity, firstRow + row, testBit(source.validity, row));
+    }
+  }
+  std::vector<std::size_t> mismatchedRows;
+  for (std::size_t row = 0; row < other.rowCount_; ++row) {
+    if (testBit(mismatched, row)) {
+      clearRow(firstRow + row);
+      mismatchedRows.push_back(firstRow + row);
+    }
+  }
+  return mismatchedRows;
+}
+
+TraitsDataPtr TraitsDataTable::row(const std::size_t row) const {
+  TraitsDataPtr traitsData = TraitsData::make();
+  for (const TraitRows& traitRows : traitRows_) {
+    if (testBit(traitRows.membership, row)) {
+      traitsData->addTrait(traitRows.traitId);
+    }
+  }
+  for (const ColumnData& column : columns_) {
+    if (!testBit(column.validity, row)) {
+      continue;
+    }
+    std::visit(
+        [&](const auto& values) {
+          using Values = std::decay_t<decltype(values)>;
+          if constexpr (std::is_same_v<Values, Column<Bool>>) {
+            traitsData->setTraitProperty(column.traitId, column.propertyKey,
+                                         Bool{values[row] != 0});
+          } else {
+            traitsData->setTraitProperty(column.traitId, column.propertyKey, values[row]);
+          }
+        },
+        column.values);
+  }
+  return traitsData;
+}
+
+void TraitsDataTable::throwTypeMismatch(const std::size_t column) const {
+  throw errors::InputValidationException{
+      fmt::format("Property '{}' of trait '{}' is held in a column of a different type",
+                  columns_[column].propertyKey, columns_[column].traitId)};
+}
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
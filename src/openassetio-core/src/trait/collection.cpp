@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <functional>
+
+#include <openassetio/trait/collection.hpp>
+
+#include "hashing.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+std::size_t TraitSetHash::operator()(const TraitSet& traitSet) const noexcept {
+  // Order-independent, see mixHash.
+  std::size_t result = traitSet.size();
+  for (const TraitId& traitId : traitSet) {
+    result += mixHash(std::hash<TraitId>{}(traitId));
+  }
+  return result;
+}
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+/**
+ * Finalise a hash value to improve its distribution (splitmix64).
+ *
+ * Trait containers hash their elements and sum the results, giving a
+ * hash that does not depend on element order. Element hashes must
+ * therefore be well distributed to avoid collisions.
+ */
+inline std::size_t mixHash(std::uint64_t value) {
+  // NOLINTBEGIN(readability-magic-numbers)
+  value ^= value >> 30U;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27U;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31U;
+  // NOLINTEND(readability-magic-numbers)
+  return value;
+}
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
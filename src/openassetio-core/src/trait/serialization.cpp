@@ -0,0 +1,392 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait::serialization {
+namespace {
+constexpr std::array<char, 4> kMagic{'O', 'A', 'T', 'D'};
+
+// Type tags for property values. Values are part of the wire format,
+// so must never change.
+enum class TypeTag : std::uint8_t { kBool = 0, kInt = 1, kFloat = 2, kStr = 3 };
+
+[[noreturn]] void throwMalformed(const std::string_view reason) {
+  throw errors::InputValidationException{
+      fmt::format("Malformed serialised TraitsData: {}", reason)};
+}
+
+/**
+ * Append little-endian encoded values to a buffer.
+ */
+class Writer {
+ public:
+  explicit Writer(Bytes* out) : out_{out} {}
+
+  template <class T>
+  void writeUInt(T value) {
+    static_assert(std::is_unsigned_v<T>);
+    for (std::size_t byteIdx = 0; byteIdx < sizeof(T); ++byteIdx) {
+      out_->push_back(static_cast<std::byte>(value >> (byteIdx * 8U)));
+    }
+  }
+
+  void writeLength(const std::size_t length) {
+    if (length > std::numeric_limits<std::uint32_t>::max()) {
+      throw errors::InputValidationException{"TraitsData is too large to serialise"};
+    }
+    writeUInt(static_cast<std::uint32_t>(length));
+  }
+
+  void writeStr(const std::string_view str) {
+    writeLength(str.size());
+    const auto* begin = reinterpret_cast<const std::byte*>(str.data());
+    out_->insert(out_->end(), begin, begin + str.size());
+  }
+
+  void writeValue(const property::Value& value) {
+    std::visit(
+        [this](const auto& typedValue) {
+          using T = std::decay_t<decltype(typedValue)>;
+          if constexpr (std::is_same_v<T, Bool>) {
+            writeUInt(static_cast<std::uint8_t>(TypeTag::kBool));
+            writeUInt(static_cast<std::uint8_t>(typedValue ? 1 : 0));
+          } else if constexpr (std::is_same_v<T, Int>) {
+            writeUInt(static_cast<std::uint8_t>(TypeTag::kInt));
+            writeUInt(static_cast<std::uint64_t>(typedValue));
+          } else if constexpr (std::is_same_v<T, Float>) {
+            static_assert(sizeof(Float) == sizeof(std::uint64_t));
+            writeUInt(static_cast<std::uint8_t>(TypeTag::kFloat));
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &typedValue, sizeof(bits));
+            writeUInt(bits);
+          } else {
+            static_assert(std::is_same_v<T, Str>);
+            writeUInt(static_cast<std::uint8_t>(TypeTag::kStr));
+            writeStr(typedValue);
+          }
+        },
+        value);
+  }
+
+  void writeHeader() {
+    for (const char chr : kMagic) {
+      out_->push_back(static_cast<std::byte>(chr));
+    }
+    writeUInt(kFormatVersion);
+    writeUInt(std::uint16_t{0});
+  }
+
+  void writeRecord(const TraitsData& traitsData) {
+    std::size_t traitCount = 0;
+    traitsData.forEachTrait([&traitCount](const TraitId&) { ++traitCount; });
+    writeLength(traitCount);
+
+    traitsData.forEachTrait([&](const TraitId& traitId) {
+      writeStr(traitId);
+      // Property count is patched once the properties are written.
+      const std::size_t countPos = out_->size();
+      writeUInt(std::uint32_t{0});
+      std::uint32_t propertyCount = 0;
+      traitsData.forEachProperty(
+          traitId, [&](const property::Key& key, const property::Value& value) {
+            writeStr(key);
+            writeValue(value);
+            ++propertyCount;
+          });
+      patchUInt32(countPos, propertyCount);
+    });
+  }
+
+  [[nodiscard]] std::size_t pos() const { return out_->size(); }
+
+  void patchUInt32(const std::size_t pos, const std::uint32_t value) {
+    for (std::size_t byteIdx = 0; byteIdx < sizeof(value); ++byteIdx) {
+      (*out_)[pos + byteIdx] = static_cast<std::byte>(value >> (byteIdx * 8U));
+    }
+  }
+
+ private:
+  Bytes* out_;
+};
+
+/**
+ * Bounds-checked decoding of little-endian values from a buffer.
+ */
+class Reader {
+ public:
+  Reader(const std::byte* data, const std::size_t size) : data_{data}, size_{size} {}
+
+  template <class T>
+  T readUInt() {
+    static_assert(std::is_unsigned_v<T>);
+    const std::byte* bytes = take(sizeof(T));
+    T value = 0;
+    for (std::size_t byteIdx = 0; byteIdx < sizeof(T); ++byteIdx) {
+      value |= static_cast<T>(static_cast<T>(bytes[byteIdx]) << (byteIdx * 8U));
+    }
+    return value;
+  }
+
+  std::string_view readStr() {
+    const auto length = readUInt<std::uint32_t>();
+    const auto* chars = reinterpret_cast<const char*>(take(length));
+    return {chars, length};
+  }
+
+  /// Read a value, or just validate it if `out` is null.
+  void readValue(property::Value* out) {
+    switch (static_cast<TypeTag>(readUInt<std::uint8_t>())) {
+      case TypeTag::kBool: {
+        const auto byte = readUInt<std::uint8_t>();
+        if (byte > 1) {
+          throwMalformed("invalid Bool value");
+        }
+        if (out) {
+          *out = Bool{byte == 1};
+        }
+        return;
+      }
+      case TypeTag::kInt: {
+        const auto bits = readUInt<std::uint64_t>();
+        if (out) {
+          *out = static_cast<Int>(bits);
+        }
+        return;
+      }
+      case TypeTag::kFloat: {
+        const auto bits = readUInt<std::uint64_t>();
+        if (out) {
+          Float value{};
+          std::memcpy(&value, &bits, sizeof(value));
+          *out = value;
+        }
+        return;
+      }
+      case TypeTag::kStr: {
+        const std::string_view str = readStr();
+        if (out) {
+          *out = Str{str};
+        }
+        return;
+      }
+    }
+    throwMalformed("unknown property type");
+  }
+
+  void readHeader() {
+    const std::byte* magic = take(kMagic.size());
+    if (std::memcmp(magic, kMagic.data(), kMagic.size()) != 0) {
+      throwMalformed("bad magic number");
+    }
+    if (const auto version = readUInt<std::uint16_t>(); version != kFormatVersion) {
+      throw errors::InputValidationException{
+          fmt::format("Unsupported serialised TraitsData format version {}", version)};
+    }
+    if (readUInt<std::uint16_t>() != 0) {
+      throwMalformed("reserved header field is non-zero");
+    }
+  }
+
+  [[nodiscard]] const std::byte* cursor() const { return data_ + pos_; }
+  [[nodiscard]] std::size_t remaining() const { return size_ - pos_; }
+
+  const std::byte* take(const std::size_t count) {
+    if (count > remaining()) {
+      throwMalformed("unexpected end of buffer");
+    }
+    const std::byte* start = cursor();
+    pos_ += count;
+    return start;
+  }
+
+ private:
+  const std::byte* data_;
+  std::size_t size_;
+  std::size_t pos_ = 0;
+};
+
+/**
+ * Walk a record, calling `onTrait(traitId)` at each trait, and
+ * `onProperty(reader, traitId, key)` with the reader positioned at each
+ * property value, which the callback must consume. Returns the trait
+ * count.
+ *
+ * Used both to validate and to query records.
+ */
+template <class OnTrait, class OnProperty>
+std::size_t walkRecord(Reader& reader, OnTrait&& onTrait, OnProperty&& onProperty) {
+  const auto traitCount = reader.readUInt<std::uint32_t>();
+  for (std::uint32_t traitIdx = 0; traitIdx < traitCount; ++traitIdx) {
+    const std::string_view traitId = reader.readStr();
+    onTrait(traitId);
+    const auto propertyCount = reader.readUInt<std::uint32_t>();
+    for (std::uint32_t propertyIdx = 0; propertyIdx < propertyCount; ++propertyIdx) {
+      const std::string_view key = reader.readStr();
+      onProperty(reader, traitId, key);
+    }
+  }
+  return traitCount;
+}
+
+std::size_t validateRecord(const std::byte* record, const std::size_t size) {
+  Reader reader{record, size};
+  const std::size_t traitCount = walkRecord(
+      reader, [](std::string_view) {},
+      [](Reader& propReader, std::string_view, std::string_view) {
+        propReader.readValue(nullptr);
+      });
+  if (reader.remaining() != 0) {
+    throwMalformed("unexpected trailing bytes");
+  }
+  return traitCount;
+}
+}  // namespace
+
+Bytes serialize(const TraitsData& traitsData) {
+  Bytes bytes;
+  Writer writer{&bytes};
+  writer.writeHeader();
+  writer.writeRecord(traitsData);
+  return bytes;
+}
+
+Bytes serialize(const TraitsDatas& traitsDatas) {
+  Bytes bytes;
+  Writer writer{&bytes};
+  writer.writeHeader();
+  writer.writeLength(traitsDatas.size());
+  for (const TraitsDataPtr& traitsData : traitsDatas) {
+    if (!traitsData) {
+      throw errors::InputValidationException{"Cannot serialise a null TraitsData"};
+    }
+    const std::size_t lengthPos = writer.pos();
+    writer.writeUInt(std::uint32_t{0});
+    writer.writeRecord(*traitsData);
+    const std::size_t length = writer.pos() - lengthPos - sizeof(std::uint32_t);
+    if (length > std::numeric_limits<std::uint32_t>::max()) {
+      throw errors::InputValidationException{"TraitsData is too large to serialise"};
+    }
+    writer.patchUInt32(lengthPos, static_cast<std::uint32_t>(length));
+  }
+  return bytes;
+}
+
+TraitsDataPtr deserialize(const std::byte* data, const std::size_t size) {
+  return TraitsDataView{data, size}.toTraitsData();
+}
+
+TraitsDatas deserializeMany(const std::byte* data, const std::size_t size) {
+  const TraitsDatasView view{data, size};
+  TraitsDatas traitsDatas;
+  traitsDatas.reserve(view.size());
+  for (std::size_t idx = 0; idx < view.size(); ++idx) {
+    traitsDatas.push_back(view.at(idx).toTraitsData());
+  }
+  return traitsDatas;
+}
+
+TraitsDataView::TraitsDataView(const std::byte* data, const std::size_t size)
+    : record_{nullptr}, size_{0}, traitCount_{0} {
+  Reader reader{data, size};
+  reader.readHeader();
+  record_ = reader.cursor();
+  size_ = reader.remaining();
+  traitCount_ = validateRecord(record_, size_);
+}
+
+TraitsDataView::TraitsDataView(RecordTag, const std::byte* record, const std::size_t size)
+    : record_{record}, size_{size}, traitCount_{0} {
+  // Already validated by the TraitsDatasView, so just peek the count.
+  traitCount_ = Reader{record_, size_}.readUInt<std::uint32_t>();
+}
+
+bool TraitsDataView::hasTrait(const std::string_view traitId) const {
+  bool found = false;
+  forEachTrait([&](const std::string_view candidate) { found = found || candidate == traitId; });
+  return found;
+}
+
+void TraitsDataView::forEachTrait(const TraitVisitor& visitor) const {
+  Reader reader{record_, size_};
+  walkRecord(reader, visitor, [](Reader& propReader, std::string_view, std::string_view) {
+    propReader.readValue(nullptr);
+  });
+}
+
+bool TraitsDataView::getTraitProperty(property::Value* out, const std::string_view traitId,
+                                      const std::string_view propertyKey) const {
+  bool found = false;
+  Reader reader{record_, size_};
+  walkRecord(
+      reader, [](std::string_view) {},
+      [&](Reader& propReader, const std::string_view candidateTraitId,
+          const std::string_view candidateKey) {
+        if (!found && candidateTraitId == traitId && candidateKey == propertyKey) {
+          propReader.readValue(out);
+          found = true;
+        } else {
+          propReader.readValue(nullptr);
+        }
+      });
+  return found;
+}
+
+TraitsDataPtr TraitsDataView::toTraitsData() const {
+  TraitsDataPtr traitsData = TraitsData::make();
+  Reader reader{record_, size_};
+  walkRecord(
+      reader, [&](const std::string_view traitId) { traitsData->addTrait(TraitId{traitId}); },
+      [&](Reader& propReader, const std::string_view traitId, const std::string_view key) {
+        property::Value value;
+        propReader.readValue(&value);
+        traitsData->setTraitProperty(TraitId{traitId}, property::Key{key}, std::move(value));
+      });
+  return traitsData;
+}
+
+TraitsDatasView::TraitsDatasView(const std::byte* data, const std::size_t size) {
+  Reader reader{data, size};
+  reader.readHeader();
+  const auto count = reader.readUInt<std::uint32_t>();
+  // Guard against a corrupt count triggering a huge allocation: each
+  // record needs at least its length prefix and trait count.
+  if (count > reader.remaining() / (sizeof(std::uint32_t) * 2)) {
+    throwMalformed("record count exceeds buffer size");
+  }
+  records_.reserve(count);
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    const auto length = reader.readUInt<std::uint32_t>();
+    const std::byte* record = reader.take(length);
+    validateRecord(record, length);
+    records_.push_back({record, length});
+  }
+  if (reader.remaining() != 0) {
+    throwMalformed("unexpected trailing bytes");
+  }
+}
+
+TraitsDataView TraitsDatasView::at(const std::size_t index) const {
+  if (index >= records_.size()) {
+    throw errors::InputValidationException{
+        fmt::format("TraitsData index {} out of range (size {})", index, records_.size())};
+  }
+  const Record& record = records_[index];
+  return TraitsDataView{TraitsDataView::RecordTag{}, record.data, record.size};
+}
+}  // namespace trait::serialization
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
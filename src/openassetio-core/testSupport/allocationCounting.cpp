@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Replacement global allocation functions that count allocations.
+ *
+ * These are process-wide, so also count allocations made by the core
+ * library. All throwing, nothrow and aligned variants of `operator
+ * new` are replaced, along with the corresponding `operator delete`
+ * variants, which must match.
+ */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#include <testSupport/AllocationCounter.hpp>
+
+namespace {
+std::atomic<std::uint64_t> gProcessAllocations{0};
+// Trivially constructed, so safe to use during static initialization
+// and thread start-up.
+thread_local std::uint64_t tThreadAllocations = 0;
+
+void recordAllocation() {
+  ++tThreadAllocations;
+  gProcessAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* allocate(std::size_t size) {
+  recordAllocation();
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocateAligned(std::size_t size, const std::align_val_t alignment) {
+  recordAllocation();
+  const auto align = static_cast<std::size_t>(alignment);
+  size = size == 0 ? 1 : size;
+#if defined(_WIN32)
+  return _aligned_malloc(size, align);
+#else
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, align < sizeof(void*) ? sizeof(void*) : align, size) != 0) {
+    return nullptr;
+  }
+  return ptr;
+#endif
+}
+
+void deallocateAligned(void* ptr) {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+}  // namespace
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace testSupport {
+std::uint64_t threadAllocationCount() { return tThreadAllocations; }
+
+std::uint64_t processAllocationCount() {
+  return gProcessAllocations.load(std::memory_order_relaxed);
+}
+
+AllocationCounter::AllocationCounter(const Scope scope) : scope_{scope}, start_{total()} {}
+
+std::uint64_t AllocationCounter::count() const { return total() - start_; }
+
+void AllocationCounter::reset() { start_ = total(); }
+
+std::uint64_t AllocationCounter::total() const {
+  return scope_ == Scope::kThread ? threadAllocationCount() : processAllocationCount();
+}
+}  // namespace testSupport
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+// NOLINTBEGIN(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory)
+
+void* operator new(const std::size_t size) {
+  if (void* ptr = allocate(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void* operator new[](const std::size_t size) { return operator new(size); }
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+  if (void* ptr = allocateAligned(size, alignment)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment) {
+  return operator new(size, alignment);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+  return allocateAligned(size, alignment);
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return allocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { deallocateAligned(ptr); }
+
+void operator delete[](void* ptr, std::align_val_t) noexcept { deallocateAligned(ptr); }
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  deallocateAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  deallocateAligned(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+  deallocateAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+  deallocateAligned(ptr);
+}
+
+// NOLINTEND(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory)
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Count heap allocations, so that tests and benchmarks can guard hot
+ * paths against allocation regressions.
+ *
+ * Counting relies on replacement global `operator new` functions, so is
+ * only effective in executables that link the test support library.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace testSupport {
+/**
+ * Number of calls to any global `operator new` variant made by the
+ * calling thread since it started.
+ */
+std::uint64_t threadAllocationCount();
+
+/**
+ * Number of calls to any global `operator new` variant made by all
+ * threads since the process started.
+ */
+std::uint64_t processAllocationCount();
+
+/**
+ * Count allocations made since construction, or the last @ref reset.
+ *
+ * By default only allocations made by the constructing thread are
+ * counted, so that unrelated background threads (e.g. of a thread
+ * pool or logger) do not cause spurious failures. Use
+ * `Scope::kProcess` to include allocations made by other threads on
+ * behalf of the code under test.
+ *
+ * @code
+ * const AllocationCounter allocations;
+ * traitsData->getTraitProperty(&value, kTraitId, kKey);
+ * CHECK(allocations.count() == 0);
+ * @endcode
+ */
+class AllocationCounter final {
+ public:
+  /// Which allocations to count.
+  enum class Scope {
+    /// Allocations made by the constructing thread only.
+    kThread,
+    /// Allocations made by any thread.
+    kProcess
+  };
+
+  explicit AllocationCounter(Scope scope = Scope::kThread);
+
+  /**
+   * Number of allocations made since construction, or the last
+   * @ref reset.
+   *
+   * With `Scope::kThread`, must be called from the constructing
+   * thread.
+   */
+  [[nodiscard]] std::uint64_t count() const;
+
+  /// Restart counting from zero.
+  void reset();
+
+ private:
+  [[nodiscard]] std::uint64_t total() const;
+
+  Scope scope_;
+  std::uint64_t start_;
+};
+}  // namespace testSupport
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
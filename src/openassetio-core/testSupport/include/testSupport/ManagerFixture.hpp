@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Fixture providing a Manager wrapping mock dependencies.
+ *
+ * Requires the consuming target to link trompeloeil.
+ */
+#pragma once
+
+#include <memory>
+
+#include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
+
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace testSupport {
+/**
+ * Fixture providing a Manager instance injected with mock dependencies.
+ */
+struct ManagerFixture {
+  const std::shared_ptr<managerApi::ManagerInterface> managerInterface =
+      std::make_shared<MockManagerInterface>();
+
+  // For convenience, to avoid casting all the time in tests.
+  MockManagerInterface& mockManagerInterface =
+      static_cast<MockManagerInterface&>(*managerInterface);
+
+  // Create a HostSession with our mock HostInterface
+  const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+
+  // Create the Manager under test.
+  const hostApi::ManagerPtr manager = hostApi::Manager::make(managerInterface, hostSession);
+
+  // For convenience, since almost every method takes a Context.
+  const ContextPtr context{Context::make()};
+};
+
+/**
+ * Initialize a Manager wrapping a mock manager plugin, which reports
+ * the given info and every capability but stateful contexts.
+ *
+ * Leaving out stateful contexts means `createContext` needn't be
+ * mocked.
+ */
+inline void initializeManager(hostApi::Manager& manager,
+                              MockManagerInterface& mockManagerInterface,
+                              const InfoDictionary& info = {}) {
+  using trompeloeil::_;
+  using Capability = managerApi::ManagerInterface::Capability;
+
+  // For the identity of any shared resolve cache.
+  ALLOW_CALL(mockManagerInterface, identifier()).RETURN("org.openassetio.test.manager");
+  REQUIRE_CALL(mockManagerInterface, initialize(_, _));
+  ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(_1 != Capability::kStatefulContexts);
+  REQUIRE_CALL(mockManagerInterface, info()).RETURN(info);
+  manager.initialize({});
+}
+}  // namespace testSupport
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
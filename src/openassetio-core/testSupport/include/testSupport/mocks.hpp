@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Trompeloeil mocks of the interfaces implemented by hosts and manager
+ * plugins, for use as dependencies of the classes under test.
+ *
+ * Requires the consuming target to link trompeloeil.
+ */
+#pragma once
+
+#include <memory>
+
+#include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
+
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace testSupport {
+/**
+ * Mock implementation of a ManagerInterface.
+ *
+ * Only the core methods are mocked. The remaining methods keep their
+ * default implementations, most of which delegate to the mocked
+ * methods. Tests that need to intercept those can derive from this
+ * class and use `MAKE_MOCKn`.
+ */
+struct MockManagerInterface : trompeloeil::mock_interface<managerApi::ManagerInterface> {
+  IMPLEMENT_CONST_MOCK0(identifier);
+  IMPLEMENT_CONST_MOCK0(displayName);
+  IMPLEMENT_MOCK0(info);
+  IMPLEMENT_MOCK2(initialize);
+  IMPLEMENT_MOCK1(flushCaches);
+  IMPLEMENT_MOCK2(flushEntityCaches);
+  IMPLEMENT_MOCK2(flushCachesWithPrefix);
+  IMPLEMENT_MOCK1(hasCapability);
+  IMPLEMENT_MOCK4(managementPolicy);
+  IMPLEMENT_MOCK2(isEntityReferenceString);
+  IMPLEMENT_MOCK2(areEntityReferenceStrings);
+  IMPLEMENT_MOCK5(entityExists);
+  IMPLEMENT_MOCK6(entityTraits);
+  IMPLEMENT_MOCK7(resolve);
+  IMPLEMENT_MOCK6(defaultEntityReference);
+  IMPLEMENT_MOCK9(getWithRelationship);
+  IMPLEMENT_MOCK9(getWithRelationships);
+  IMPLEMENT_MOCK9(getWithRelationshipsMatrix);
+  IMPLEMENT_MOCK7(preflight);
+  IMPLEMENT_MOCK7(register_);  // NOLINT(readability-identifier-naming)
+};
+
+/**
+ * Mock implementation of a HostInterface.
+ *
+ * Used as constructor parameter to Host classes required as part of
+ * these tests.
+ */
+struct MockHostInterface : trompeloeil::mock_interface<hostApi::HostInterface> {
+  IMPLEMENT_CONST_MOCK0(identifier);
+  IMPLEMENT_CONST_MOCK0(displayName);
+  IMPLEMENT_MOCK0(info);
+};
+
+/**
+ * Mock implementation of a HostInterface that provides its own
+ * scheduler.
+ *
+ * Tests typically run scheduled work inline from side effects, to
+ * check that it is dispatched via the host.
+ */
+struct MockSchedulingHostInterface : MockHostInterface {
+  IMPLEMENT_MOCK1(submit);
+  IMPLEMENT_MOCK2(parallelFor);
+};
+
+/**
+ * Mock implementation of a LoggerInterface.
+ *
+ * Used as constructor parameter to HostSession classes required as
+ * part of these tests.
+ */
+struct MockLoggerInterface : trompeloeil::mock_interface<log::LoggerInterface> {
+  IMPLEMENT_MOCK2(log);
+
+  // Opt out of kDebugApi call tracing, so tests needn't expect it.
+  [[nodiscard]] bool isSeverityLogged(const Severity severity) const override {
+    return severity != Severity::kDebugApi;
+  }
+};
+
+/**
+ * Create a HostSession with a mock HostInterface and LoggerInterface.
+ *
+ * Any unexpected use of either fails the test.
+ */
+inline managerApi::HostSessionPtr makeMockHostSession() {
+  return managerApi::HostSession::make(
+      managerApi::Host::make(std::make_shared<MockHostInterface>()),
+      std::make_shared<MockLoggerInterface>());
+}
+}  // namespace testSupport
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
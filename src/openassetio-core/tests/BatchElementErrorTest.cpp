@@ -1,13 +1,17 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 
 #include <catch2/catch.hpp>
 
 #include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
 
 using openassetio::errors::BatchElementError;
+using openassetio::errors::BatchElementException;
 
 SCENARIO("BatchElementError usage") {
   GIVEN("BatchElementError is copyable") {
@@ -50,3 +54,50 @@ SCENARIO("BatchElementError usage") {
     }
   }
 }
+
+SCENARIO("BatchElementException with a lazily formatted message") {
+  GIVEN("an error and a message formatter that counts its calls") {
+    const BatchElementError error{BatchElementError::ErrorCode::kEntityResolutionError, "missing"};
+    std::size_t formatCount = 0;
+    const BatchElementException::MessageFormatter formatter =
+        [&formatCount](const std::size_t index, const BatchElementError& err) {
+          ++formatCount;
+          return err.message + " at " + std::to_string(index);
+        };
+
+    WHEN("an exception is constructed and its error queried") {
+      const BatchElementException exception{3, error, formatter};
+
+      THEN("the error is available without formatting the message") {
+        CHECK(exception.index == 3);
+        CHECK(exception.error == error);
+        CHECK(formatCount == 0);
+      }
+
+      AND_WHEN("the message of the exception and a copy are retrieved repeatedly") {
+        const BatchElementException copy = exception;  // NOLINT(*-unnecessary-copy-*)
+        const std::string message = exception.what();
+        const std::string copyMessage = copy.what();
+        const std::string repeatedMessage = exception.what();
+
+        THEN("the message is formatted once") {
+          CHECK(message == "missing at 3");
+          CHECK(copyMessage == message);
+          CHECK(repeatedMessage == message);
+          CHECK(formatCount == 1);
+        }
+      }
+    }
+
+    WHEN("an exception is constructed with a formatter that throws") {
+      const BatchElementException exception{
+          3, error, [](std::size_t, const BatchElementError&) -> std::string {
+            throw std::runtime_error{"formatting failed"};
+          }};
+
+      THEN("the message of the error is used instead") {
+        CHECK(std::string{exception.what()} == "missing");
+      }
+    }
+  }
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/CancellationToken.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+using openassetio::CancellationToken;
+using openassetio::CancellationTokenPtr;
+
+SCENARIO("CancellationToken constructor is private") {
+  STATIC_REQUIRE_FALSE(std::is_default_constructible_v<CancellationToken>);
+}
+
+SCENARIO("Cancelling a token") {
+  GIVEN("a token without a deadline") {
+    const CancellationTokenPtr token = CancellationToken::make();
+
+    THEN("it is not cancelled and has no deadline") {
+      CHECK_FALSE(token->isCancelled());
+      CHECK_FALSE(token->deadline());
+    }
+
+    WHEN("the token is cancelled") {
+      token->cancel();
+
+      THEN("it is cancelled") { CHECK(token->isCancelled()); }
+    }
+  }
+}
+
+SCENARIO("Token deadlines") {
+  using Clock = CancellationToken::Clock;
+
+  GIVEN("a token with a deadline in the future") {
+    const Clock::time_point deadline = Clock::now() + std::chrono::hours{1};
+    const CancellationTokenPtr token = CancellationToken::make(deadline);
+
+    THEN("it is not cancelled and reports its deadline") {
+      CHECK_FALSE(token->isCancelled());
+      CHECK(token->deadline() == deadline);
+    }
+
+    WHEN("the token is cancelled") {
+      token->cancel();
+
+      THEN("it is cancelled before its deadline") { CHECK(token->isCancelled()); }
+    }
+  }
+
+  GIVEN("a token with a deadline in the past") {
+    const CancellationTokenPtr token = CancellationToken::make(Clock::now());
+
+    THEN("it is cancelled") { CHECK(token->isCancelled()); }
+  }
+}
+
+SCENARIO("Child tokens") {
+  using Clock = CancellationToken::Clock;
+
+  GIVEN("a child of a token with a deadline") {
+    const Clock::time_point deadline = Clock::now() + std::chrono::hours{1};
+    const CancellationTokenPtr parent = CancellationToken::make(deadline);
+    const CancellationTokenPtr child = CancellationToken::makeChild(parent);
+
+    THEN("it is not cancelled and reports the deadline of its parent") {
+      CHECK_FALSE(child->isCancelled());
+      CHECK(child->deadline() == deadline);
+    }
+
+    WHEN("the parent is cancelled") {
+      parent->cancel();
+
+      THEN("the child is cancelled") { CHECK(child->isCancelled()); }
+    }
+
+    WHEN("the child is cancelled") {
+      child->cancel();
+
+      THEN("the parent is not cancelled") {
+        CHECK(child->isCancelled());
+        CHECK_FALSE(parent->isCancelled());
+      }
+    }
+  }
+
+  THEN("a null parent is rejected") {
+    CHECK_THROWS_AS(CancellationToken::makeChild(nullptr),
+                    openassetio::errors::InputValidationException);
+  }
+}
@@ -1,13 +1,14 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <cstddef>
 #include <type_traits>
+#include <variant>
 
 #include <catch2/catch.hpp>
 
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
-
-OPENASSETIO_FWD_DECLARE(trait, TraitsData)
-OPENASSETIO_FWD_DECLARE(managerApi, ManagerStateBase)
+#include <openassetio/managerApi/ManagerStateBase.hpp>
 
 using openassetio::Context;
 
@@ -23,3 +24,111 @@ SCENARIO("Default construction") {
     THEN("the locale is not null") { CHECK(context->locale); }
   }
 }
+
+SCENARIO("Context memory usage") {
+  GIVEN("a Context") {
+    const Context::Ptr context = Context::make();
+
+    THEN("usage includes the context and its locale") {
+      CHECK(context->memoryUsage() == sizeof(Context) + context->locale->memoryUsage());
+    }
+
+    WHEN("the locale is populated") {
+      const std::size_t before = context->memoryUsage();
+      context->locale->setTraitProperty("aTrait", "aKey", openassetio::Str(1000, 'x'));
+
+      THEN("usage increases") { CHECK(context->memoryUsage() > before + 1000); }
+    }
+
+    WHEN("the locale is null") {
+      context->locale = nullptr;
+
+      THEN("only the context itself is used") { CHECK(context->memoryUsage() == sizeof(Context)); }
+    }
+  }
+}
+
+SCENARIO("Context fingerprint") {
+  GIVEN("two Contexts with equal locales") {
+    const Context::Ptr context = Context::make();
+    const Context::Ptr other = Context::make();
+    context->locale->setTraitProperty("aTrait", "aKey", openassetio::Int{1});
+    other->locale->setTraitProperty("aTrait", "aKey", openassetio::Int{1});
+
+    THEN("their fingerprints are equal") { CHECK(context->fingerprint() == other->fingerprint()); }
+
+    WHEN("one locale is modified") {
+      other->locale->setTraitProperty("aTrait", "aKey", openassetio::Int{2});
+
+      THEN("their fingerprints differ") {
+        CHECK(context->fingerprint() != other->fingerprint());
+      }
+
+      AND_WHEN("the modification is reverted") {
+        other->locale->setTraitProperty("aTrait", "aKey", openassetio::Int{1});
+
+        THEN("their fingerprints are equal again") {
+          CHECK(context->fingerprint() == other->fingerprint());
+        }
+      }
+    }
+
+    WHEN("one has a manager state") {
+      other->managerState = std::make_shared<openassetio::managerApi::ManagerStateBase>();
+
+      THEN("their fingerprints differ") {
+        CHECK(context->fingerprint() != other->fingerprint());
+      }
+    }
+
+    WHEN("one locale is null") {
+      other->locale = nullptr;
+
+      THEN("their fingerprints differ") {
+        CHECK(context->fingerprint() != other->fingerprint());
+      }
+    }
+  }
+}
+
+SCENARIO("Context snapshots") {
+  GIVEN("a Context with a populated locale, manager state and cancellation token") {
+    const Context::Ptr context = Context::make();
+    context->locale->setTraitProperty("aTrait", "aKey", openassetio::Int{1});
+    context->managerState = std::make_shared<openassetio::managerApi::ManagerStateBase>();
+    context->cancellationToken = openassetio::CancellationToken::make();
+
+    WHEN("the context is frozen") {
+      const openassetio::ContextConstPtr snapshot = context->freeze();
+
+      THEN("the snapshot is equivalent, but holds its own locale") {
+        CHECK(snapshot != context);
+        CHECK(snapshot->locale != context->locale);
+        CHECK(*snapshot->locale == *context->locale);
+        CHECK(snapshot->managerState == context->managerState);
+        CHECK(snapshot->cancellationToken == context->cancellationToken);
+        CHECK(snapshot->fingerprint() == context->fingerprint());
+      }
+
+      AND_WHEN("the original context's locale is modified") {
+        context->locale->setTraitProperty("aTrait", "aKey", openassetio::Int{2});
+
+        THEN("the snapshot is unaffected") {
+          openassetio::trait::property::Value value;
+          snapshot->locale->getTraitProperty(&value, "aTrait", "aKey");
+          CHECK(std::get<openassetio::Int>(value) == 1);
+        }
+      }
+    }
+  }
+
+  GIVEN("a Context with a null locale") {
+    const Context::Ptr context = Context::make(nullptr);
+
+    WHEN("the context is frozen") {
+      const openassetio::ContextConstPtr snapshot = context->freeze();
+
+      THEN("the snapshot's locale is null") { CHECK_FALSE(snapshot->locale); }
+    }
+  }
+}
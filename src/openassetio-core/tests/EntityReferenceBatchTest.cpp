@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/EntityReferenceBatch.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+using openassetio::EntityReference;
+using openassetio::EntityReferenceBatch;
+using openassetio::EntityReferences;
+
+SCENARIO("Building an EntityReferenceBatch") {
+  GIVEN("an empty batch") {
+    EntityReferenceBatch batch;
+    CHECK(batch.empty());
+
+    WHEN("strings are appended") {
+      batch.reserve(3, 8);
+      batch.append("a://1");
+      batch.append("");
+      batch.append("b:2");
+
+      THEN("they are accessible by index, in order") {
+        REQUIRE(batch.size() == 3);
+        CHECK(batch[0] == "a://1");
+        CHECK(batch[1].empty());
+        CHECK(batch[2] == "b:2");
+      }
+
+      THEN("elements are views into a single contiguous buffer") {
+        CHECK(batch[0].data() + batch[0].size() == batch[2].data());
+      }
+
+      THEN("they can be converted to entity references") {
+        CHECK(batch.entityReference(2) == EntityReference{"b:2"});
+        CHECK(batch.toEntityReferences() ==
+              EntityReferences{EntityReference{"a://1"}, EntityReference{""},
+                               EntityReference{"b:2"}});
+      }
+
+      THEN("an out of range entity reference is an error") {
+        CHECK_THROWS_AS(batch.entityReference(3), openassetio::errors::InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a list of entity references") {
+    const EntityReferences refs{EntityReference{"a"}, EntityReference{"bc"}};
+
+    WHEN("a batch is constructed from them") {
+      const EntityReferenceBatch batch{refs};
+
+      THEN("the batch holds their strings") {
+        CHECK(batch.size() == 2);
+        CHECK(batch.toEntityReferences() == refs);
+      }
+
+      THEN("it is equal to an equivalent batch built by appending") {
+        EntityReferenceBatch appended;
+        appended.append("a");
+        appended.append("bc");
+        CHECK(batch == appended);
+
+        EntityReferenceBatch differentlySplit;
+        differentlySplit.append("ab");
+        differentlySplit.append("c");
+        CHECK_FALSE(batch == differentlySplit);
+      }
+    }
+  }
+}
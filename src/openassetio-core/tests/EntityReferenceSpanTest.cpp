@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/EntityReferenceSpan.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::EntityReferenceSpan;
+
+SCENARIO("EntityReferenceSpan is a cheap, trivially copyable view") {
+  STATIC_REQUIRE(std::is_trivially_copyable_v<EntityReferenceSpan>);
+}
+
+SCENARIO("Viewing entity references") {
+  GIVEN("a list of entity references") {
+    const EntityReferences refs{EntityReference{"a"}, EntityReference{"b"},
+                                EntityReference{"c"}};
+
+    WHEN("a span is constructed from the list") {
+      const EntityReferenceSpan span{refs};
+
+      THEN("it views the list's elements in place") {
+        CHECK(span.data() == refs.data());
+        CHECK(span.size() == 3);
+        CHECK_FALSE(span.empty());
+        CHECK(&span[1] == &refs[1]);
+        CHECK(EntityReferences(span.begin(), span.end()) == refs);
+        CHECK(span.toEntityReferences() == refs);
+      }
+
+      AND_WHEN("a sub-range is taken") {
+        const EntityReferenceSpan subspan = span.subspan(1, 2);
+
+        THEN("it views the sub-range in place") {
+          CHECK(subspan.data() == &refs[1]);
+          CHECK(subspan.toEntityReferences() == EntityReferences(refs.begin() + 1, refs.end()));
+        }
+      }
+
+      THEN("a sub-range extending beyond the span is rejected") {
+        CHECK(span.subspan(3, 0).empty());
+        CHECK_THROWS_AS(span.subspan(2, 2), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(span.subspan(4, 0), openassetio::errors::InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a single entity reference") {
+    const EntityReference ref{"a"};
+
+    WHEN("a span is constructed from its address") {
+      const EntityReferenceSpan span{&ref, 1};
+
+      THEN("it views the reference as a batch of one") {
+        CHECK(span.size() == 1);
+        CHECK(&span[0] == &ref);
+      }
+    }
+  }
+
+  GIVEN("a default-constructed span") {
+    const EntityReferenceSpan span;
+
+    THEN("it is empty") {
+      CHECK(span.empty());
+      CHECK(span.begin() == span.end());
+      CHECK(span.toEntityReferences().empty());
+    }
+  }
+}
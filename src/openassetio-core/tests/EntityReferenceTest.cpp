@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <functional>
+#include <unordered_set>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/EntityReference.hpp>
+
+using openassetio::EntityReference;
+
+SCENARIO("Hashing entity references") {
+  GIVEN("two entity references with the same string") {
+    const EntityReference ref1{"asset://a"};
+    const EntityReference ref2{"asset://a"};
+
+    THEN("their hashes are equal") {
+      CHECK(std::hash<EntityReference>{}(ref1) == std::hash<EntityReference>{}(ref2));
+    }
+  }
+
+  GIVEN("an unordered set of entity references") {
+    std::unordered_set<EntityReference> refs;
+
+    WHEN("duplicate references are inserted") {
+      refs.insert(EntityReference{"asset://a"});
+      refs.insert(EntityReference{"asset://b"});
+      refs.insert(EntityReference{"asset://a"});
+
+      THEN("duplicates are collapsed") {
+        CHECK(refs.size() == 2);
+        CHECK(refs.count(EntityReference{"asset://a"}) == 1);
+      }
+    }
+  }
+}
+
+SCENARIO("Copying entity references") {
+  GIVEN("an entity reference") {
+    const EntityReference ref{"asset://a"};
+
+    WHEN("the reference is copied") {
+      const EntityReference copy = ref;  // NOLINT(performance-unnecessary-copy-initialization)
+
+      THEN("the copy shares the original's string") {
+        CHECK(copy == ref);
+        CHECK(&copy.toString() == &ref.toString());
+      }
+    }
+
+    WHEN("a copy of the reference is moved from") {
+      EntityReference copy = ref;
+      const EntityReference moved = std::move(copy);
+
+      THEN("the original and moved-to references are unaffected") {
+        CHECK(ref.toString() == "asset://a");
+        CHECK(moved == ref);
+      }
+
+      AND_THEN("the moved-from reference holds an empty string") {
+        // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+        CHECK(copy.toString().empty());
+      }
+    }
+  }
+}
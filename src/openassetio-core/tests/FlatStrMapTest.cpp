@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/FlatStrMap.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+using openassetio::FlatStrMap;
+using openassetio::Int;
+using openassetio::Str;
+
+/// Keys of a map, in iteration order.
+template <class T>
+std::vector<Str> keysOf(const FlatStrMap<T>& map) {
+  std::vector<Str> keys;
+  for (const auto& [key, value] : map) {
+    keys.push_back(key);
+  }
+  return keys;
+}
+}  // namespace
+
+SCENARIO("FlatStrMap aliases") {
+  STATIC_REQUIRE(std::is_same_v<openassetio::StrMap, FlatStrMap<Str>>);
+  STATIC_REQUIRE(
+      std::is_same_v<openassetio::InfoDictionary, FlatStrMap<openassetio::InfoDictionaryValue>>);
+}
+
+SCENARIO("FlatStrMap construction and lookup") {
+  GIVEN("a map constructed from unordered entries with a duplicate key") {
+    const FlatStrMap<Int> map{{"c", 3}, {"a", 1}, {"b", 2}, {"a", 4}};
+
+    THEN("entries are unique and in key order, keeping the first duplicate") {
+      CHECK(map.size() == 3);
+      CHECK(keysOf(map) == std::vector<Str>{"a", "b", "c"});
+      CHECK(map.at("a") == 1);
+    }
+
+    THEN("entries can be looked up by key") {
+      CHECK(map.find("b")->second == 2);
+      CHECK(map.find("d") == map.end());
+      CHECK(map.count(std::string_view{"c"}) == 1);
+      CHECK(map.count("d") == 0);
+      CHECK_THROWS_AS(map.at("d"), std::out_of_range);
+    }
+
+    THEN("it compares equal to a map with the same entries") {
+      CHECK(map == FlatStrMap<Int>{{"a", 1}, {"b", 2}, {"c", 3}});
+      CHECK(map != FlatStrMap<Int>{{"a", 1}, {"b", 2}});
+    }
+  }
+}
+
+SCENARIO("FlatStrMap modification") {
+  GIVEN("a map") {
+    FlatStrMap<Int> map{{"b", 2}, {"d", 4}};
+
+    WHEN("entries are inserted") {
+      CHECK(map.insert({"c", 3}).second);
+      CHECK_FALSE(map.insert({"b", 5}).second);
+      CHECK(map.emplace("a", 1).second);
+      CHECK(map.try_emplace("e", 5).second);
+      map["f"] = 6;
+
+      THEN("new keys are added in order, and existing values are unchanged") {
+        CHECK(keysOf(map) == std::vector<Str>{"a", "b", "c", "d", "e", "f"});
+        CHECK(map.at("b") == 2);
+        CHECK(map["f"] == 6);
+      }
+    }
+
+    WHEN("entries are inserted or assigned") {
+      CHECK_FALSE(map.insert_or_assign("b", 5).second);
+      CHECK(map.insert_or_assign("a", 1).second);
+
+      THEN("existing values are replaced") {
+        CHECK(map == FlatStrMap<Int>{{"a", 1}, {"b", 5}, {"d", 4}});
+      }
+    }
+
+    WHEN("entries are erased") {
+      CHECK(map.erase("b") == 1);
+      CHECK(map.erase("x") == 0);
+
+      THEN("only the remaining entries are present") {
+        CHECK(keysOf(map) == std::vector<Str>{"d"});
+      }
+
+      AND_WHEN("the last entry is erased by position") {
+        const auto next = map.erase(map.cbegin());
+
+        THEN("the map is empty") {
+          CHECK(next == map.end());
+          CHECK(map.empty());
+        }
+      }
+    }
+
+    WHEN("another map is merged in") {
+      FlatStrMap<Int> other{{"a", 1}, {"b", 20}, {"c", 3}, {"d", 40}};
+      map.merge(other);
+
+      THEN("entries with new keys are moved") {
+        CHECK(map == FlatStrMap<Int>{{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}});
+      }
+
+      THEN("entries with existing keys are left in the source") {
+        CHECK(other == FlatStrMap<Int>{{"b", 20}, {"d", 40}});
+      }
+    }
+
+    WHEN("a range of entries is inserted") {
+      const std::vector<std::pair<Str, Int>> entries{{"e", 5}, {"b", 20}, {"a", 1}, {"e", 50}};
+      map.insert(entries.begin(), entries.end());
+
+      THEN("entries with new keys are added, keeping the first duplicate") {
+        CHECK(map == FlatStrMap<Int>{{"a", 1}, {"b", 2}, {"d", 4}, {"e", 5}});
+      }
+    }
+  }
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/FunctionRef.hpp>
+
+#include <testSupport/AllocationCounter.hpp>
+
+using openassetio::FunctionRef;
+using openassetio::testSupport::AllocationCounter;
+
+SCENARIO("FunctionRef is a cheap, trivially copyable reference") {
+  STATIC_REQUIRE(std::is_trivially_copyable_v<FunctionRef<void(std::size_t)>>);
+  STATIC_REQUIRE(sizeof(FunctionRef<void(std::size_t)>) == 2 * sizeof(void*));
+}
+
+SCENARIO("Calling a referenced callable") {
+  GIVEN("a callable with state") {
+    std::size_t total = 0;
+    const auto add = [&total](const std::size_t value) {
+      total += value;
+      return total;
+    };
+
+    WHEN("it is called via a FunctionRef") {
+      const FunctionRef<std::size_t(std::size_t)> ref{add};
+      const std::size_t first = ref(2);
+      const std::size_t second = ref(3);
+
+      THEN("the callable is called with the arguments, and its result returned") {
+        CHECK(first == 2);
+        CHECK(second == 5);
+        CHECK(total == 5);
+      }
+    }
+
+    WHEN("it is called via a FunctionRef with a void return type") {
+      const FunctionRef<void(std::size_t)> ref{add};
+      ref(4);
+
+      THEN("the callable is called, and its result discarded") { CHECK(total == 4); }
+    }
+  }
+
+  GIVEN("a FunctionRef to a callable taking an argument by value") {
+    std::string received;
+    const auto receive = [&received](std::string value) { received = std::move(value); };
+    const FunctionRef<void(std::string)> ref{receive};
+
+    WHEN("it is called") {
+      ref(std::string(64, 'x'));
+
+      THEN("the argument is forwarded") { CHECK(received == std::string(64, 'x')); }
+    }
+  }
+}
+
+SCENARIO("Passing a FunctionRef as a std::function") {
+  GIVEN("a callable with captures too large for std::function to store inline") {
+    std::array<std::size_t, 8> padding{};
+    std::size_t calls = 0;
+    const auto callable = [padding, &calls](std::size_t) { calls += padding.size(); };
+
+    WHEN("it is wrapped in a FunctionRef and converted to a std::function") {
+      const AllocationCounter allocations;
+      const std::function<void(std::size_t)> func{FunctionRef<void(std::size_t)>{callable}};
+      const auto allocationCount = allocations.count();
+      func(0);
+
+      THEN("no allocation is made, and the callable is called") {
+        CHECK(allocationCount == 0);
+        CHECK(calls == padding.size());
+      }
+    }
+  }
+}
@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/MemoryResource.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Int;
+using openassetio::MemoryResourceInterface;
+using openassetio::ScopedMemoryResource;
+using openassetio::access::ResolveAccess;
+using openassetio::testSupport::MockHostInterface;
+using openassetio::testSupport::MockLoggerInterface;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/// Resource forwarding to the global heap, counting outstanding
+/// allocations.
+struct CountingMemoryResource final : MemoryResourceInterface {
+  void* allocate(const std::size_t bytes, const std::size_t alignment) override {
+    ++allocations;
+    ++outstanding;
+    return ::operator new(bytes, std::align_val_t{alignment});
+  }
+
+  void deallocate(void* ptr, [[maybe_unused]] const std::size_t bytes,
+                  const std::size_t alignment) noexcept override {
+    --outstanding;
+    ::operator delete(ptr, std::align_val_t{alignment});
+  }
+
+  std::size_t allocations = 0;
+  std::ptrdiff_t outstanding = 0;
+};
+
+/// Resolve each entity to a TraitsData with a single property.
+void resolveToProperty(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const trait::TraitsDataPtr traitsData = trait::TraitsData::make();
+    traitsData->setTraitProperty("trait", "property", Int{1});
+    successCallback(idx, traitsData);
+  }
+}
+}  // namespace
+
+SCENARIO("Allocating TraitsData from a memory resource") {
+  const auto resource = std::make_shared<CountingMemoryResource>();
+
+  GIVEN("no current memory resource") {
+    REQUIRE(ScopedMemoryResource::current() == nullptr);
+
+    WHEN("a TraitsData is created and populated") {
+      const trait::TraitsDataPtr traitsData = trait::TraitsData::make();
+      traitsData->setTraitProperty("trait", "property", Int{1});
+
+      THEN("the resource is not used") { CHECK(resource->allocations == 0); }
+    }
+  }
+
+  GIVEN("a current memory resource") {
+    trait::TraitsDataPtr traitsData;
+    trait::TraitsDatas traitsDatas;
+    {
+      const ScopedMemoryResource scope{resource.get()};
+      CHECK(ScopedMemoryResource::current() == resource.get());
+
+      traitsData = trait::TraitsData::make();
+      traitsData->setTraitProperty("trait", "property", Int{1});
+      traitsDatas = trait::TraitsData::makeMany(3);
+      traitsDatas[0]->addTrait("trait");
+    }
+
+    THEN("the scope is restored on destruction") {
+      CHECK(ScopedMemoryResource::current() == nullptr);
+    }
+
+    THEN("instances, arenas and their storage are allocated from the resource") {
+      // At least a block, storage and its trait ID and property
+      // vectors, then an arena, storage and its trait ID vector.
+      CHECK(resource->allocations >= 7);
+      CHECK(traitsData->hasTrait("trait"));
+    }
+
+    WHEN("an instance is modified outside the scope") {
+      const std::size_t allocations = resource->allocations;
+      traitsData->setTraitProperty("trait", "other", Int{2});
+
+      THEN("existing storage continues to use the resource") {
+        CHECK(resource->allocations > allocations);
+      }
+    }
+
+    WHEN("the instances are destroyed") {
+      traitsData.reset();
+      traitsDatas.clear();
+
+      THEN("all memory is returned to the resource") { CHECK(resource->outstanding == 0); }
+    }
+  }
+
+  GIVEN("nested scopes") {
+    CountingMemoryResource inner;
+    const ScopedMemoryResource outerScope{resource.get()};
+
+    WHEN("an inner scope is given a null resource") {
+      const ScopedMemoryResource innerScope{nullptr};
+
+      THEN("the outer resource remains current") {
+        CHECK(ScopedMemoryResource::current() == resource.get());
+      }
+    }
+
+    WHEN("an inner scope is given another resource") {
+      {
+        const ScopedMemoryResource innerScope{&inner};
+        [[maybe_unused]] const trait::TraitsDataPtr traitsData =
+            trait::TraitsData::make({"trait"});
+
+        CHECK(ScopedMemoryResource::current() == &inner);
+      }
+
+      THEN("the inner resource is used until the inner scope ends") {
+        CHECK(inner.allocations > 0);
+        CHECK(resource->allocations == 0);
+        CHECK(ScopedMemoryResource::current() == resource.get());
+      }
+    }
+  }
+}
+
+SCENARIO("Manager allocates results from the host session's memory resource") {
+  GIVEN("a Manager whose host session has a memory resource") {
+    const auto resource = std::make_shared<CountingMemoryResource>();
+    const managerApi::HostSessionPtr hostSession = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>(), resource);
+    const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+    const hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterface, hostSession);
+
+    ALLOW_CALL(*mockManagerInterface, hasCapability(_)).RETURN(true);
+    ALLOW_CALL(*mockManagerInterface, resolve(_, _, _, _, hostSession, _, _))
+        .SIDE_EFFECT(resolveToProperty(_1, _6));
+
+    CHECK(hostSession->memoryResource() == resource);
+
+    WHEN("an entity is resolved") {
+      const std::size_t allocations = resource->allocations;
+      trait::TraitsDataPtr traitsData = manager->resolve(
+          EntityReference{"ref"}, {"trait"}, ResolveAccess::kRead, Context::make());
+
+      THEN("the result is allocated from the resource") {
+        CHECK(resource->allocations > allocations);
+        CHECK(ScopedMemoryResource::current() == nullptr);
+      }
+
+      AND_WHEN("the result is destroyed") {
+        traitsData.reset();
+
+        THEN("its memory is returned to the resource") { CHECK(resource->outstanding == 0); }
+      }
+    }
+  }
+}
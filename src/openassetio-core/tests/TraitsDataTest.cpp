@@ -1,6 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <catch2/catch.hpp>
 
@@ -9,6 +15,8 @@
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/trait/property.hpp>
 
+#include <testSupport/AllocationCounter.hpp>
+
 using openassetio::Int;
 using openassetio::trait::TraitsData;
 using openassetio::trait::TraitsDataPtr;
@@ -64,3 +72,644 @@ SCENARIO("TraitsData make from other creates a deep copy") {
     }
   }
 }
+
+SCENARIO("TraitsData property storage") {
+  using openassetio::Str;
+  using openassetio::trait::TraitSet;
+  using openassetio::trait::property::KeySet;
+
+  GIVEN("an instance with properties set in an arbitrary order") {
+    const TraitsDataPtr data = TraitsData::make({"c"});
+    data->setTraitProperty("b", "y", Int{2});
+    data->setTraitProperty("a", "z", Str{"3"});
+    data->setTraitProperty("b", "x", Int{1});
+    data->setTraitProperty("a", "w", true);
+
+    THEN("all traits are reported, including those without properties") {
+      CHECK(data->traitSet() == TraitSet{"a", "b", "c"});
+      CHECK(data->hasTrait("a"));
+      CHECK(data->hasTrait("c"));
+      CHECK_FALSE(data->hasTrait("d"));
+    }
+
+    THEN("property keys are reported per trait") {
+      CHECK(data->traitPropertyKeys("a") == KeySet{"w", "z"});
+      CHECK(data->traitPropertyKeys("b") == KeySet{"x", "y"});
+      CHECK(data->traitPropertyKeys("c").empty());
+      CHECK(data->traitPropertyKeys("d").empty());
+    }
+
+    THEN("unset properties are not found") {
+      Value value;
+      CHECK_FALSE(data->getTraitProperty(&value, "a", "x"));
+      CHECK_FALSE(data->getTraitProperty(&value, "c", "x"));
+      CHECK_FALSE(data->getTraitProperty(&value, "d", "x"));
+    }
+
+    WHEN("an existing property is overwritten") {
+      data->setTraitProperty("b", "x", Int{4});
+
+      THEN("the new value is returned") {
+        Value value;
+        REQUIRE(data->getTraitProperty(&value, "b", "x"));
+        CHECK(std::get<Int>(value) == Int{4});
+        CHECK(data->traitPropertyKeys("b") == KeySet{"x", "y"});
+      }
+    }
+
+    AND_GIVEN("an instance with the same data set in a different order") {
+      const TraitsDataPtr other = TraitsData::make();
+      other->setTraitProperty("a", "w", true);
+      other->setTraitProperty("b", "x", Int{1});
+      other->addTrait("c");
+      other->setTraitProperty("a", "z", Str{"3"});
+      other->setTraitProperty("b", "y", Int{2});
+
+      THEN("the instances compare equal") { CHECK(*data == *other); }
+
+      AND_WHEN("a property value differs") {
+        other->setTraitProperty("b", "y", Int{5});
+
+        THEN("the instances compare unequal") { CHECK_FALSE(*data == *other); }
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsData access using interned IDs and keys") {
+  using openassetio::trait::InternedTraitId;
+  using openassetio::trait::property::InternedKey;
+
+  GIVEN("an instance with a property set using strings") {
+    const TraitsDataPtr data = TraitsData::make();
+    data->setTraitProperty("interned.test.trait", "aKey", Int{1});
+
+    THEN("the property can be retrieved using interned handles") {
+      const InternedTraitId traitId{"interned.test.trait"};
+      const InternedKey key{"aKey"};
+      Value value;
+      CHECK(data->hasTrait(traitId));
+      REQUIRE(data->getTraitProperty(&value, traitId, key));
+      CHECK(std::get<Int>(value) == Int{1});
+      CHECK(data->traitPropertyKeys(traitId) == openassetio::trait::property::KeySet{"aKey"});
+    }
+  }
+
+  GIVEN("an instance with a property set using interned handles") {
+    const InternedTraitId traitId{"interned.test.otherTrait"};
+    const InternedKey key{"aKey"};
+    const TraitsDataPtr data = TraitsData::make();
+    data->setTraitProperty(traitId, key, Int{2});
+    data->addTrait(InternedTraitId{"interned.test.emptyTrait"});
+
+    THEN("the property can be retrieved using strings") {
+      Value value;
+      CHECK(data->hasTrait("interned.test.otherTrait"));
+      CHECK(data->hasTrait("interned.test.emptyTrait"));
+      REQUIRE(data->getTraitProperty(&value, "interned.test.otherTrait", "aKey"));
+      CHECK(std::get<Int>(value) == Int{2});
+    }
+
+    THEN("an unrelated handle is not found") {
+      Value value;
+      CHECK_FALSE(data->getTraitProperty(&value, traitId, InternedKey{"anotherKey"}));
+      CHECK_FALSE(data->hasTrait(InternedTraitId{"interned.test.missingTrait"}));
+    }
+  }
+}
+
+SCENARIO("TraitsData copies are independent") {
+  using openassetio::trait::TraitSet;
+
+  GIVEN("an instance and a copy of it") {
+    const TraitsDataPtr data = TraitsData::make();
+    data->setTraitProperty("a", "a", Int{1});
+    const TraitsDataPtr copy = TraitsData::make(data);
+
+    THEN("the copy compares equal") { CHECK(*copy == *data); }
+
+    WHEN("the copy is modified") {
+      copy->setTraitProperty("a", "a", Int{2});
+      copy->addTrait("b");
+
+      THEN("the original is unchanged") {
+        Value value;
+        REQUIRE(data->getTraitProperty(&value, "a", "a"));
+        CHECK(std::get<Int>(value) == Int{1});
+        CHECK(data->traitSet() == TraitSet{"a"});
+        CHECK_FALSE(*copy == *data);
+      }
+    }
+
+    AND_GIVEN("a copy of the copy") {
+      const TraitsDataPtr copyOfCopy = TraitsData::make(copy);
+
+      WHEN("the original is modified") {
+        data->addTraits({"c"});
+
+        THEN("neither copy is affected") {
+          CHECK(copy->traitSet() == TraitSet{"a"});
+          CHECK(copyOfCopy->traitSet() == TraitSet{"a"});
+          CHECK(*copy == *copyOfCopy);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsData bulk property access") {
+  using openassetio::Float;
+  using openassetio::Str;
+  using openassetio::trait::property::KeyValues;
+
+  GIVEN("an empty instance") {
+    const TraitsDataPtr data = TraitsData::make();
+
+    WHEN("multiple properties of a trait are set in a single call") {
+      data->setTraitProperties("bulk", {{"a", Int{1}}, {"b", Str{"two"}}, {"a", Float{3}}});
+
+      THEN("the trait is added and properties set, with the last duplicate winning") {
+        CHECK(data->hasTrait("bulk"));
+        Value value;
+        REQUIRE(data->getTraitProperty(&value, "bulk", "a"));
+        CHECK(std::get<Float>(value) == Float{3});
+        REQUIRE(data->getTraitProperty(&value, "bulk", "b"));
+        CHECK(std::get<Str>(value) == "two");
+      }
+
+      AND_WHEN("the properties are retrieved in a single call") {
+        KeyValues properties{{"stale", Int{0}}};
+        const bool hasTrait = data->getTraitProperties(&properties, "bulk");
+
+        THEN("the buffer is replaced with all properties of the trait") {
+          CHECK(hasTrait);
+          std::sort(properties.begin(), properties.end(),
+                    [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+          CHECK(properties == KeyValues{{"a", Float{3}}, {"b", Str{"two"}}});
+        }
+      }
+    }
+
+    WHEN("an empty list of properties is set") {
+      data->setTraitProperties("emptyBulk", {});
+
+      THEN("the trait is added without properties") {
+        KeyValues properties{{"stale", Int{0}}};
+        CHECK(data->getTraitProperties(&properties, "emptyBulk"));
+        CHECK(properties.empty());
+      }
+    }
+
+    THEN("retrieving properties of a missing trait returns false and clears the buffer") {
+      KeyValues properties{{"stale", Int{0}}};
+      CHECK_FALSE(data->getTraitProperties(&properties, "missingBulk"));
+      CHECK(properties.empty());
+    }
+  }
+}
+
+SCENARIO("TraitsData batch construction") {
+  using openassetio::trait::TraitsDatas;
+
+  GIVEN("many instances constructed in a single call") {
+    TraitsDatas datas = TraitsData::makeMany(3);
+
+    THEN("the requested number of distinct empty instances are created") {
+      REQUIRE(datas.size() == 3);
+      for (const auto& data : datas) {
+        REQUIRE(data);
+        CHECK(data->traitSet().empty());
+        CHECK(*data == *TraitsData::make());
+      }
+      CHECK(datas[0] != datas[1]);
+      CHECK(datas[1] != datas[2]);
+    }
+
+    WHEN("one instance is modified") {
+      datas[1]->setTraitProperty("a", "a", Int{1});
+
+      THEN("the other instances are unaffected") {
+        CHECK(datas[0]->traitSet().empty());
+        CHECK(datas[2]->traitSet().empty());
+        CHECK(datas[1]->hasTrait("a"));
+      }
+    }
+
+    WHEN("all but one instance is released") {
+      const TraitsDataPtr survivor = datas[2];
+      survivor->addTrait("b");
+      datas.clear();
+
+      THEN("the remaining instance is still valid") { CHECK(survivor->hasTrait("b")); }
+    }
+  }
+
+  THEN("requesting zero instances returns an empty list") {
+    CHECK(TraitsData::makeMany(0).empty());
+  }
+}
+
+SCENARIO("TraitsData property views") {
+  using openassetio::Str;
+  using openassetio::trait::InternedTraitId;
+  using openassetio::trait::property::InternedKey;
+
+  GIVEN("an instance with a string property") {
+    const TraitsDataPtr data = TraitsData::make();
+    data->setTraitProperty("view", "path", Str{"/some/long/path/to/a/file.exr"});
+
+    WHEN("a view of the property is retrieved") {
+      const Value* value = data->getTraitPropertyView("view", "path");
+
+      THEN("the stored value is referenced") {
+        REQUIRE(value != nullptr);
+        CHECK(std::get<Str>(*value) == "/some/long/path/to/a/file.exr");
+        CHECK(value == data->getTraitPropertyView(InternedTraitId{"view"}, InternedKey{"path"}));
+      }
+    }
+
+    THEN("views of unset properties are null") {
+      CHECK(data->getTraitPropertyView("view", "other") == nullptr);
+      CHECK(data->getTraitPropertyView("missingView", "path") == nullptr);
+      CHECK(TraitsData::make()->getTraitPropertyView("view", "path") == nullptr);
+    }
+
+    AND_GIVEN("a copy of the instance") {
+      const TraitsDataPtr copy = TraitsData::make(data);
+      const Value* value = data->getTraitPropertyView("view", "path");
+
+      WHEN("the copy is modified") {
+        copy->setTraitProperty("view", "path", Str{"other"});
+
+        THEN("a view of the original remains valid") {
+          CHECK(std::get<Str>(*value) == "/some/long/path/to/a/file.exr");
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsData property access allocations") {
+  using openassetio::Str;
+  using openassetio::testSupport::AllocationCounter;
+  using openassetio::trait::InternedTraitId;
+  using openassetio::trait::property::InternedKey;
+
+  GIVEN("an instance with int and string properties") {
+    const TraitsDataPtr data = TraitsData::make();
+    data->setTraitProperty("trait", "int", Int{3});
+    data->setTraitProperty("trait", "str", Str{"/some/long/path/to/a/file.exr"});
+    const InternedTraitId traitId{"trait"};
+    const InternedKey intKey{"int"};
+    Value value;
+
+    WHEN("an int property is retrieved") {
+      const AllocationCounter allocations;
+      const bool found = data->getTraitProperty(&value, "trait", "int");
+      const bool foundInterned = data->getTraitProperty(&value, traitId, intKey);
+      const auto count = allocations.count();
+
+      THEN("no allocations are made") {
+        CHECK(found);
+        CHECK(foundInterned);
+        CHECK(count == 0);
+      }
+    }
+
+    WHEN("a view of a string property is retrieved") {
+      const AllocationCounter allocations;
+      const Value* view = data->getTraitPropertyView("trait", "str");
+      const auto count = allocations.count();
+
+      THEN("no allocations are made") {
+        CHECK(view != nullptr);
+        CHECK(count == 0);
+      }
+    }
+
+    WHEN("traits are queried") {
+      const AllocationCounter allocations;
+      const bool hasTrait = data->hasTrait("trait");
+      const bool hasMissingTrait = data->hasTrait("missing");
+      const auto count = allocations.count();
+
+      THEN("no allocations are made") {
+        CHECK(hasTrait);
+        CHECK_FALSE(hasMissingTrait);
+        CHECK(count == 0);
+      }
+    }
+
+    WHEN("an existing int property is updated") {
+      const AllocationCounter allocations;
+      data->setTraitProperty(traitId, intKey, Int{4});
+      const auto count = allocations.count();
+
+      THEN("no allocations are made") { CHECK(count == 0); }
+    }
+
+    WHEN("traits and properties are visited with a visitor with large captures") {
+      // Larger than the small buffer of std::function.
+      const std::array<std::size_t, 8> largeCapture{};
+      std::size_t traitCount = 0;
+      std::size_t propertyCount = 0;
+      const AllocationCounter allocations;
+      data->forEachTrait([&, largeCapture](const InternedTraitId& visitedTraitId) {
+        static_cast<void>(largeCapture);
+        ++traitCount;
+        data->forEachProperty(visitedTraitId,
+                              [&, largeCapture](const InternedKey&, const Value&) {
+                                static_cast<void>(largeCapture);
+                                ++propertyCount;
+                              });
+      });
+      const auto count = allocations.count();
+
+      THEN("no allocations are made") {
+        CHECK(traitCount == 1);
+        CHECK(propertyCount == 2);
+        CHECK(count == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsData iteration") {
+  using openassetio::Str;
+  using openassetio::trait::TraitSet;
+  using openassetio::trait::property::KeyValues;
+
+  GIVEN("a populated instance") {
+    const TraitsDataPtr data = TraitsData::make({"visitEmpty"});
+    data->setTraitProperties("visit", {{"a", Int{1}}, {"b", Str{"b"}}});
+
+    WHEN("traits are visited") {
+      TraitSet visited;
+      data->forEachTrait([&visited](const openassetio::trait::TraitId& traitId) {
+        CHECK(visited.insert(traitId).second);
+      });
+
+      THEN("each trait is visited once") { CHECK(visited == data->traitSet()); }
+    }
+
+    WHEN("the properties of a trait are visited") {
+      KeyValues visited;
+      data->forEachProperty("visit", [&visited](const Key& key, const Value& value) {
+        visited.emplace_back(key, value);
+      });
+
+      THEN("each property is visited once") {
+        std::sort(visited.begin(), visited.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        CHECK(visited == KeyValues{{"a", Int{1}}, {"b", Str{"b"}}});
+      }
+    }
+
+    THEN("traits without properties, and missing traits, are not visited") {
+      std::size_t count = 0;
+      const auto visitor = [&count](const Key&, const Value&) { ++count; };
+      data->forEachProperty("visitEmpty", visitor);
+      data->forEachProperty("visitMissing", visitor);
+      CHECK(count == 0);
+    }
+  }
+}
+
+SCENARIO("TraitsData hashing") {
+  using openassetio::Str;
+
+  GIVEN("two instances with the same content populated in different orders") {
+    const TraitsDataPtr data = TraitsData::make({"hashEmpty"});
+    data->setTraitProperty("hash", "a", Int{1});
+    data->setTraitProperty("hash", "b", Str{"b"});
+
+    const TraitsDataPtr other = TraitsData::make();
+    other->setTraitProperty("hash", "b", Str{"b"});
+    other->addTrait("hashEmpty");
+    other->setTraitProperty("hash", "a", Int{0});
+    other->setTraitProperty("hash", "a", Int{1});
+
+    THEN("their hashes are equal") {
+      CHECK(data->hash() == other->hash());
+      CHECK(std::hash<TraitsData>{}(*data) == std::hash<TraitsData>{}(*other));
+    }
+
+    THEN("they can be used as equivalent keys in an unordered container") {
+      std::unordered_set<TraitsData*, std::function<std::size_t(const TraitsData*)>,
+                         std::function<bool(const TraitsData*, const TraitsData*)>>
+          set{0, [](const TraitsData* val) { return val->hash(); },
+              [](const TraitsData* lhs, const TraitsData* rhs) { return *lhs == *rhs; }};
+      set.insert(data.get());
+      CHECK_FALSE(set.insert(other.get()).second);
+    }
+
+    WHEN("a property value of one instance is changed") {
+      other->setTraitProperty("hash", "a", Int{2});
+
+      THEN("their hashes differ") { CHECK(data->hash() != other->hash()); }
+
+      AND_WHEN("it is changed back") {
+        other->setTraitProperty("hash", "a", Int{1});
+
+        THEN("their hashes are equal again") { CHECK(data->hash() == other->hash()); }
+      }
+    }
+
+    WHEN("a property value is changed to an equal value of a different type") {
+      other->setTraitProperty("hash", "a", openassetio::Float{1});
+
+      THEN("their hashes differ") { CHECK(data->hash() != other->hash()); }
+    }
+
+    WHEN("a trait is added to one instance") {
+      other->addTrait("hashAnother");
+
+      THEN("their hashes differ") { CHECK(data->hash() != other->hash()); }
+    }
+  }
+
+  THEN("empty instances have equal hashes") {
+    CHECK(TraitsData::make()->hash() == TraitsData::make(openassetio::trait::TraitSet{})->hash());
+  }
+}
+
+SCENARIO("TraitSet hashing") {
+  using openassetio::trait::TraitSet;
+  using openassetio::trait::TraitSetHash;
+
+  GIVEN("equal trait sets") {
+    TraitSet traitSet{"a", "b", "c", "d"};
+    TraitSet otherTraitSet;
+    otherTraitSet.reserve(100);
+    otherTraitSet.insert({"d", "c", "b", "a"});
+
+    THEN("their hashes are equal") {
+      CHECK(TraitSetHash{}(traitSet) == TraitSetHash{}(otherTraitSet));
+    }
+
+    THEN("they can be used as keys in an unordered container") {
+      std::unordered_map<TraitSet, int, TraitSetHash> map;
+      map[traitSet] = 1;
+      CHECK(map.at(otherTraitSet) == 1);
+    }
+  }
+
+  GIVEN("unequal trait sets") {
+    THEN("their hashes differ") {
+      CHECK(TraitSetHash{}({"a", "b"}) != TraitSetHash{}({"a", "c"}));
+      CHECK(TraitSetHash{}({"a"}) != TraitSetHash{}({"a", "b"}));
+      CHECK(TraitSetHash{}({}) != TraitSetHash{}({""}));
+    }
+  }
+}
+
+SCENARIO("TraitsData memory usage") {
+  GIVEN("an empty TraitsData") {
+    const TraitsDataPtr data = TraitsData::make();
+
+    THEN("only the instance itself is used") { CHECK(data->memoryUsage() == sizeof(TraitsData)); }
+
+    WHEN("traits and properties are added") {
+      data->addTrait("aTrait");
+      const std::size_t withTrait = data->memoryUsage();
+      data->setTraitProperty("aTrait", "aKey", Int{1});
+      const std::size_t withProperty = data->memoryUsage();
+
+      THEN("usage increases") {
+        CHECK(withTrait > sizeof(TraitsData));
+        CHECK(withProperty > withTrait);
+      }
+
+      AND_WHEN("a long string property is set") {
+        const openassetio::Str longString(1000, 'x');
+        data->setTraitProperty("aTrait", "aKey", longString);
+
+        THEN("usage includes the string buffer") {
+          CHECK(data->memoryUsage() >= withProperty + longString.size());
+        }
+      }
+
+      AND_WHEN("the instance is copied") {
+        const TraitsDataPtr copy = TraitsData::make(data);
+
+        THEN("the shared storage is included in the usage of both") {
+          CHECK(copy->memoryUsage() == data->memoryUsage());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsData merging") {
+  using openassetio::Str;
+  using openassetio::testSupport::AllocationCounter;
+  using MergePolicy = TraitsData::MergePolicy;
+
+  GIVEN("two overlapping instances") {
+    const TraitsDataPtr data = TraitsData::make({"mergeOnlyOurs"});
+    data->setTraitProperty("mergeShared", "a", Int{1});
+    data->setTraitProperty("mergeShared", "b", Str{"ours"});
+    const TraitsDataPtr other = TraitsData::make({"mergeOnlyTheirs"});
+    other->setTraitProperty("mergeShared", "b", Str{"theirs"});
+    other->setTraitProperty("mergeShared", "c", Int{3});
+
+    WHEN("the other is merged with the overwrite policy") {
+      data->merge(*other);
+
+      THEN("the result has the union of traits and properties") {
+        CHECK(data->traitSet() ==
+              openassetio::trait::TraitSet{"mergeOnlyOurs", "mergeOnlyTheirs", "mergeShared"});
+        CHECK(data->traitPropertyKeys("mergeShared") ==
+              openassetio::trait::property::KeySet{"a", "b", "c"});
+      }
+
+      THEN("the other's values take precedence") {
+        CHECK(*data->getTraitPropertyView("mergeShared", "a") == Value{Int{1}});
+        CHECK(*data->getTraitPropertyView("mergeShared", "b") == Value{Str{"theirs"}});
+        CHECK(*data->getTraitPropertyView("mergeShared", "c") == Value{Int{3}});
+      }
+
+      THEN("the result equals the same data populated property by property") {
+        const TraitsDataPtr expected = TraitsData::make({"mergeOnlyOurs", "mergeOnlyTheirs"});
+        expected->setTraitProperty("mergeShared", "a", Int{1});
+        expected->setTraitProperty("mergeShared", "b", Str{"theirs"});
+        expected->setTraitProperty("mergeShared", "c", Int{3});
+        CHECK(*data == *expected);
+        CHECK(data->hash() == expected->hash());
+      }
+
+      THEN("the other is unchanged") {
+        CHECK(!other->hasTrait("mergeOnlyOurs"));
+        CHECK(*other->getTraitPropertyView("mergeShared", "b") == Value{Str{"theirs"}});
+      }
+    }
+
+    WHEN("the other is merged with the keep existing policy") {
+      data->merge(*other, MergePolicy::kKeepExisting);
+
+      THEN("existing values take precedence") {
+        CHECK(*data->getTraitPropertyView("mergeShared", "b") == Value{Str{"ours"}});
+        CHECK(*data->getTraitPropertyView("mergeShared", "c") == Value{Int{3}});
+        CHECK(data->hasTrait("mergeOnlyTheirs"));
+      }
+    }
+
+    WHEN("an instance sharing storage with another is merged into") {
+      const TraitsDataPtr copy = TraitsData::make(data);
+      data->merge(*other);
+
+      THEN("the copy is unchanged") {
+        CHECK(*copy->getTraitPropertyView("mergeShared", "b") == Value{Str{"ours"}});
+        CHECK(!copy->hasTrait("mergeOnlyTheirs"));
+      }
+    }
+  }
+
+  GIVEN("an instance whose properties are a subset of an existing instance") {
+    const TraitsDataPtr data = TraitsData::make();
+    data->setTraitProperty("mergeInPlace", "a", Int{1});
+    data->setTraitProperty("mergeInPlace", "b", Int{2});
+    const TraitsDataPtr other = TraitsData::make();
+    other->setTraitProperty("mergeInPlace", "b", Int{3});
+
+    WHEN("the subset is merged") {
+      const AllocationCounter allocations;
+      data->merge(*other);
+      const auto count = allocations.count();
+
+      THEN("values are updated in place, without allocation") {
+        CHECK(count == 0);
+        CHECK(*data->getTraitPropertyView("mergeInPlace", "b") == Value{Int{3}});
+      }
+    }
+  }
+
+  GIVEN("an empty instance") {
+    const TraitsDataPtr data = TraitsData::make();
+    const TraitsDataPtr other = TraitsData::make();
+    other->setTraitProperty("mergeIntoEmpty", "a", Int{1});
+
+    WHEN("another instance is merged into it") {
+      data->merge(*other);
+
+      THEN("the result equals the other") { CHECK(*data == *other); }
+
+      AND_WHEN("the other is subsequently modified") {
+        other->setTraitProperty("mergeIntoEmpty", "a", Int{2});
+
+        THEN("the result is unchanged") {
+          CHECK(*data->getTraitPropertyView("mergeIntoEmpty", "a") == Value{Int{1}});
+        }
+      }
+    }
+
+    WHEN("an instance is merged with itself") {
+      other->merge(*other);
+
+      THEN("it is unchanged") {
+        CHECK(other->traitPropertyKeys("mergeIntoEmpty") ==
+              openassetio::trait::property::KeySet{"a"});
+      }
+    }
+  }
+}
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ApiAuditor.hpp>
+#include <openassetio/hostApi/AuditingManagerInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+using Api = hostApi::ApiAuditor::Api;
+using Method = hostApi::ApiAuditor::Method;
+
+/// Resolve each entity to an empty TraitsData.
+void resolveToEmpty(const EntityReferences& entityReferences,
+                    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, trait::TraitsData::make());
+  }
+}
+
+/// Enable and reset the process-wide auditor for the duration of a
+/// test, so that tests do not observe each other's calls.
+struct ScopedAuditor {
+  ScopedAuditor() {
+    auditor->reset();
+    auditor->setEnabled(true);
+  }
+  ~ScopedAuditor() {
+    auditor->setEnabled(false);
+    auditor->reset();
+  }
+  ScopedAuditor(const ScopedAuditor&) = delete;
+  ScopedAuditor& operator=(const ScopedAuditor&) = delete;
+  ScopedAuditor(ScopedAuditor&&) = delete;
+  ScopedAuditor& operator=(ScopedAuditor&&) = delete;
+
+  const hostApi::ApiAuditorPtr& auditor = hostApi::ApiAuditor::instance();
+};
+}  // namespace
+
+TEST_CASE("ApiAuditor method names are consistent with the Method enum") {
+  CHECK(hostApi::ApiAuditor::kMethodNames.size() ==
+        static_cast<std::size_t>(Method::kUpdateTerminology) + 1);
+  CHECK(Str{hostApi::ApiAuditor::kMethodNames[static_cast<std::size_t>(Method::kRegister)]} ==
+        "register");
+  CHECK(Str{hostApi::ApiAuditor::kApiNames[static_cast<std::size_t>(Api::kManagerInterface)]} ==
+        "ManagerInterface");
+}
+
+SCENARIO("Auditing API calls") {
+  const ScopedAuditor scope;
+  const hostApi::ApiAuditorPtr& auditor = scope.auditor;
+
+  GIVEN("a Manager wrapping an auditing layer") {
+    const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+    ALLOW_CALL(*mockManagerInterface, identifier()).RETURN("org.openassetio.test.manager");
+    ALLOW_CALL(*mockManagerInterface, displayName()).RETURN("Test Manager");
+    ALLOW_CALL(*mockManagerInterface, hasCapability(_)).RETURN(true);
+    ALLOW_CALL(*mockManagerInterface, resolve(_, _, _, _, _, _, _))
+        .SIDE_EFFECT(resolveToEmpty(_1, _6));
+
+    const auto auditingInterface = hostApi::AuditingManagerInterface::make(mockManagerInterface);
+    const hostApi::ManagerPtr manager =
+        hostApi::Manager::make(auditingInterface, makeMockHostSession());
+    // Ignore calls made during construction.
+    auditor->reset();
+
+    WHEN("entities are resolved") {
+      const auto resolve = [&] {
+        manager->resolve(
+            {EntityReference{"ref"}, EntityReference{"ref2"}}, {}, ResolveAccess::kRead,
+            Context::make(), [](std::size_t, const trait::TraitsDataPtr&) {},
+            [](std::size_t, const openassetio::errors::BatchElementError&) {});
+      };
+      resolve();
+      resolve();
+
+      THEN("each batch call is counted for both APIs") {
+        CHECK(auditor->callCount(Api::kManager, Method::kResolve) == 2);
+        CHECK(auditor->callCount(Api::kManagerInterface, Method::kResolve) == 2);
+        CHECK(auditor->callCount(Api::kManager, Method::kEntityExists) == 0);
+      }
+
+      THEN("coverage lists only the methods called") {
+        const hostApi::ApiAuditor::Coverage coverage = auditor->coverage();
+        CHECK(coverage.at("Manager").at("resolve") == 2);
+        CHECK(coverage.at("ManagerInterface").at("resolve") == 2);
+        CHECK(coverage.at("Manager").count("entityExists") == 0);
+      }
+
+      AND_WHEN("the auditor is reset") {
+        auditor->reset();
+
+        THEN("no calls are reported") { CHECK(auditor->coverage().empty()); }
+      }
+    }
+
+    WHEN("a convenience overload is called") {
+      [[maybe_unused]] const trait::TraitsDataPtr traitsData =
+          manager->resolve(EntityReference{"ref"}, {}, ResolveAccess::kRead, Context::make());
+
+      THEN("it is counted once, as its batch counterpart") {
+        CHECK(auditor->callCount(Api::kManager, Method::kResolve) == 1);
+      }
+    }
+
+    WHEN("the auditor is disabled and methods are called") {
+      auditor->setEnabled(false);
+      CHECK(manager->displayName() == "Test Manager");
+
+      THEN("no calls are counted") {
+        CHECK(auditor->callCount(Api::kManager, Method::kDisplayName) == 0);
+        CHECK(auditor->callCount(Api::kManagerInterface, Method::kDisplayName) == 0);
+      }
+    }
+  }
+
+  GIVEN("methods called concurrently from many threads") {
+    constexpr std::size_t kThreadCount = 8;
+    constexpr std::size_t kCallsPerThread = 1000;
+    std::vector<std::thread> threads;
+    threads.reserve(kThreadCount);
+    for (std::size_t threadIdx = 0; threadIdx < kThreadCount; ++threadIdx) {
+      threads.emplace_back([&] {
+        for (std::size_t callIdx = 0; callIdx < kCallsPerThread; ++callIdx) {
+          auditor->recordCall(Api::kManager, Method::kEntityExists);
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    THEN("every call is counted") {
+      CHECK(auditor->callCount(Api::kManager, Method::kEntityExists) ==
+            kThreadCount * kCallsPerThread);
+    }
+  }
+}
+
+TEST_CASE("AuditingManagerInterface requires a manager to proxy") {
+  CHECK_THROWS_AS(hostApi::AuditingManagerInterface::make(nullptr),
+                  openassetio::errors::InputValidationException);
+}
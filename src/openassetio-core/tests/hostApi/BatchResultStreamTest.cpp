@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <variant>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/BatchResultStream.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+using openassetio::errors::BatchElementError;
+using Stream = hostApi::BatchResultStream<int>;
+}  // namespace
+
+SCENARIO("BatchResultStream construction") {
+  THEN("a zero buffer size is rejected") {
+    CHECK_THROWS_AS(Stream{0}, openassetio::errors::InputValidationException);
+  }
+}
+
+SCENARIO("BatchResultStream delivery") {
+  GIVEN("a stream with a small buffer") {
+    constexpr std::size_t kBufferSize = 2;
+    constexpr std::size_t kResultCount = 100;
+    Stream stream{kBufferSize};
+
+    WHEN("results are written from another thread") {
+      std::thread producer{[writer = stream.writer()] {
+        for (std::size_t idx = 0; idx < kResultCount; ++idx) {
+          if (idx % 10 == 0) {
+            writer.write(idx, BatchElementError{
+                                  BatchElementError::ErrorCode::kEntityResolutionError, "bad"});
+          } else {
+            writer.write(idx, static_cast<int>(idx));
+          }
+        }
+        writer.close();
+      }};
+
+      THEN("all results are retrieved in order of production") {
+        std::size_t count = 0;
+        while (auto element = stream.next()) {
+          CHECK(element->first == count);
+          if (count % 10 == 0) {
+            CHECK(std::holds_alternative<BatchElementError>(element->second));
+          } else {
+            CHECK(std::get<int>(element->second) == static_cast<int>(count));
+          }
+          ++count;
+        }
+        CHECK(count == kResultCount);
+      }
+      producer.join();
+    }
+
+    WHEN("results are written on the creating thread") {
+      const Stream::Writer writer = stream.writer();
+      for (std::size_t idx = 0; idx < kBufferSize * 2; ++idx) {
+        writer.write(idx, static_cast<int>(idx));
+      }
+      writer.close();
+
+      THEN("the buffer is exceeded rather than blocking") {
+        std::size_t count = 0;
+        while (stream.next()) {
+          ++count;
+        }
+        CHECK(count == kBufferSize * 2);
+      }
+    }
+
+    WHEN("the batch fails after producing a result") {
+      const Stream::Writer writer = stream.writer();
+      writer.write(0, 1);
+      writer.close(std::make_exception_ptr(std::runtime_error{"batch failed"}));
+
+      THEN("the exception is rethrown once buffered results are retrieved") {
+        CHECK(stream.next());
+        CHECK_THROWS_WITH(stream.next(), "batch failed");
+        CHECK_FALSE(stream.next());
+      }
+    }
+  }
+
+  GIVEN("a blocked producer") {
+    auto stream = std::make_unique<Stream>(1);
+    bool accepted = true;
+    std::thread producer{[writer = stream->writer(), &accepted] {
+      writer.write(0, 0);
+      accepted = writer.write(1, 1);
+    }};
+
+    WHEN("the stream is destroyed") {
+      // Allow the producer to (probably) block on the full buffer.
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      stream.reset();
+      producer.join();
+
+      THEN("the producer is released and its result discarded") { CHECK_FALSE(accepted); }
+    }
+  }
+}
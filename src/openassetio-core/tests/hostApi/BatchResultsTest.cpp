@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <catch2/catch.hpp>
+
+#include <openassetio/hostApi/BatchResults.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace trait = openassetio::trait;
+using openassetio::errors::BatchElementError;
+}  // namespace
+
+SCENARIO("BatchResults reuse") {
+  GIVEN("a populated results container") {
+    hostApi::ResolveResults results;
+    results.reset(3);
+    const trait::TraitsDataPtr data = trait::TraitsData::make();
+    results.setValue(0, data);
+    results.setError(2, {BatchElementError::ErrorCode::kEntityResolutionError, "bad"});
+
+    THEN("results are reported per element") {
+      CHECK(results.size() == 3);
+      CHECK(results.succeeded(0));
+      CHECK(results.value(0) == data);
+      CHECK_FALSE(results.succeeded(1));
+      CHECK(results.error(1) == nullptr);
+      CHECK_FALSE(results.succeeded(2));
+      REQUIRE(results.error(2));
+      CHECK(results.error(2)->message == "bad");
+      CHECK_FALSE(results.allSucceeded());
+    }
+
+    WHEN("the container is reset for a smaller batch") {
+      const std::size_t capacity = results.values().capacity();
+      results.reset(2);
+
+      THEN("previous results are discarded and storage is retained") {
+        CHECK(results.size() == 2);
+        CHECK_FALSE(results.succeeded(0));
+        CHECK(results.value(0) == nullptr);
+        CHECK(results.indexedErrors().empty());
+        CHECK(results.values().capacity() == capacity);
+      }
+    }
+  }
+}
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/CachingManagerInterface.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/**
+ * Resolve each entity to a TraitsData with a trait named after the
+ * entity reference, except for "bad", which errors.
+ */
+void resolveToNamedTraits(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (entityReferences[idx].toString() == "bad") {
+      errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kUnknown, "bad"});
+    } else {
+      successCallback(idx, trait::TraitsData::make({entityReferences[idx].toString()}));
+    }
+  }
+}
+
+/// Resolve entities, returning the traits of each result, or "error".
+std::vector<trait::TraitSet> resolve(managerApi::ManagerInterface& managerInterface,
+                                     const EntityReferences& entityReferences,
+                                     const ContextConstPtr& context,
+                                     const managerApi::HostSessionPtr& hostSession) {
+  std::vector<trait::TraitSet> results(entityReferences.size());
+  managerInterface.resolve(
+      entityReferences, {}, ResolveAccess::kRead, context, hostSession,
+      [&](const std::size_t idx, const trait::TraitsDataPtr& data) {
+        results[idx] = data->traitSet();
+      },
+      [&](const std::size_t idx, const BatchElementError&) { results[idx] = {"error"}; });
+  return results;
+}
+}  // namespace
+
+SCENARIO("CachingManagerInterface construction") {
+  GIVEN("a null resolve cache") {
+    THEN("a caching layer cannot be constructed") {
+      CHECK_THROWS_AS(hostApi::CachingManagerInterface::make(
+                          std::make_shared<MockManagerInterface>(), nullptr),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+
+SCENARIO("Caching resolves with a CachingManagerInterface") {
+  GIVEN("a manager wrapped in a caching layer") {
+    const auto managerInterface = std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10, 1);
+    const auto cachingInterface = hostApi::CachingManagerInterface::make(managerInterface, cache);
+    const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+    const ContextConstPtr context = Context::make();
+
+    const EntityReference ref1{"ref1"};
+    const EntityReference ref2{"ref2"};
+    const EntityReference bad{"bad"};
+
+    /// Expect the given entities to be forwarded to the manager.
+    const auto expectResolve = [&](EntityReferences refs) {
+      return NAMED_REQUIRE_CALL(mockManagerInterface, resolve(std::move(refs), _, _, context,
+                                                              hostSession, _, _))
+          .SIDE_EFFECT(resolveToNamedTraits(_1, _6, _7));
+    };
+
+    CHECK(cachingInterface->resolveCache() == cache);
+
+    AND_GIVEN("an entity has previously been resolved, along with an error") {
+      {
+        REQUIRE_CALL(mockManagerInterface, initialize(_, hostSession));
+        REQUIRE_CALL(mockManagerInterface, info()).RETURN(InfoDictionary{});
+        cachingInterface->initialize({}, hostSession);
+      }
+      {
+        const auto expectation = expectResolve({ref1, bad});
+        resolve(*cachingInterface, {ref1, bad}, context, hostSession);
+      }
+      REQUIRE(cache->size() == 1);
+
+      WHEN("the entities are resolved again, with another") {
+        // Only uncached entities are forwarded.
+        const auto expectation = expectResolve({bad, ref2});
+
+        const std::vector<trait::TraitSet> results =
+            resolve(*cachingInterface, {bad, ref1, ref2}, context, hostSession);
+
+        THEN("results are mapped to the caller's indices") {
+          CHECK(results == std::vector<trait::TraitSet>{{"error"}, {"ref1"}, {"ref2"}});
+        }
+      }
+
+      WHEN("the entity is resolved asynchronously") {
+        const auto expectation = expectResolve({ref2});
+
+        std::vector<trait::TraitSet> results(2);
+        std::promise<void> done;
+        cachingInterface->resolveAsync(
+            {ref1, ref2}, {}, ResolveAccess::kRead, context, hostSession,
+            [&](const std::size_t idx, const trait::TraitsDataPtr& data) {
+              results[idx] = data->traitSet();
+            },
+            [](std::size_t, const BatchElementError&) {},
+            [&](const std::exception_ptr&) { done.set_value(); });
+        done.get_future().wait();
+
+        THEN("the cached result is served, and the new result cached") {
+          CHECK(results == std::vector<trait::TraitSet>{{"ref1"}, {"ref2"}});
+          CHECK(cache->size() == 2);
+        }
+      }
+
+      WHEN("caches are flushed") {
+        REQUIRE_CALL(mockManagerInterface, flushCaches(hostSession));
+
+        cachingInterface->flushCaches(hostSession);
+
+        THEN("the cache is emptied") { CHECK(cache->size() == 0); }
+      }
+
+      WHEN("caches are flushed for specific entities") {
+        {
+          const auto expectation = expectResolve({ref2});
+          resolve(*cachingInterface, {ref2}, context, hostSession);
+        }
+        REQUIRE_CALL(mockManagerInterface, flushEntityCaches(EntityReferences{ref1}, hostSession));
+
+        cachingInterface->flushEntityCaches({ref1}, hostSession);
+
+        THEN("only their entries are evicted") { CHECK(cache->size() == 1); }
+      }
+
+      WHEN("caches are flushed for a reference prefix") {
+        {
+          const auto expectation = expectResolve({ref2});
+          resolve(*cachingInterface, {ref2}, context, hostSession);
+        }
+        REQUIRE_CALL(mockManagerInterface, flushCachesWithPrefix("ref2", hostSession));
+
+        cachingInterface->flushCachesWithPrefix("ref2", hostSession);
+
+        THEN("only matching entries are evicted") {
+          CHECK(cache->size() == 1);
+          const auto expectation = expectResolve({ref2});
+          resolve(*cachingInterface, {ref1, ref2}, context, hostSession);
+        }
+      }
+
+      WHEN("the manager notifies the host of a change to the entity") {
+        {
+          const auto expectation = expectResolve({ref2});
+          resolve(*cachingInterface, {ref2}, context, hostSession);
+        }
+        REQUIRE(cache->size() == 2);
+        // No flush is expected.
+        hostSession->notifyEntitiesChanged({ref1});
+
+        THEN("only that entity is evicted") {
+          CHECK(cache->size() == 1);
+          const auto expectation = expectResolve({ref1});
+          resolve(*cachingInterface, {ref1, ref2}, context, hostSession);
+        }
+      }
+    }
+
+    AND_GIVEN("the manager declares that it caches resolve results itself") {
+      {
+        REQUIRE_CALL(mockManagerInterface, initialize(_, hostSession));
+        REQUIRE_CALL(mockManagerInterface, info())
+            .RETURN(InfoDictionary{{Str{openassetio::constants::kInfoKey_IsResolveCached}, true}});
+        cachingInterface->initialize({}, hostSession);
+      }
+
+      WHEN("an entity is resolved twice") {
+        // The cache is bypassed.
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(EntityReferences{ref1}, _, _, context, hostSession, _, _))
+            .TIMES(2)
+            .SIDE_EFFECT(resolveToNamedTraits(_1, _6, _7));
+
+        resolve(*cachingInterface, {ref1}, context, hostSession);
+        resolve(*cachingInterface, {ref1}, context, hostSession);
+
+        THEN("nothing is cached") { CHECK(cache->size() == 0); }
+      }
+    }
+  }
+}
@@ -0,0 +1,560 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+using openassetio::EntityReference;
+using openassetio::Str;
+using openassetio::testSupport::makeMockHostSession;
+
+/**
+ * Pager over a fixed number of single-entity pages, where the entity
+ * reference of each page is its index.
+ *
+ * Records the threads it is called from, and detects concurrent calls.
+ * Draining uses the default implementation, but is counted.
+ * If `failingPage` is set, fetching that page throws. If
+ * `providesSizeHint` is set, the exact number of remaining entity
+ * references is hinted.
+ */
+struct CountingPagerInterface : managerApi::EntityReferencePagerInterface {
+  explicit CountingPagerInterface(const std::size_t count) : pageCount{count} {}
+
+  bool hasNext(const managerApi::HostSessionPtr&) override {
+    const CallGuard guard{*this};
+    return currentPage + 1 < pageCount;
+  }
+
+  Page get(const managerApi::HostSessionPtr&) override {
+    const CallGuard guard{*this};
+    if (currentPage == failingPage) {
+      throw openassetio::errors::InputValidationException{"page failed"};
+    }
+    ++getCount;
+    if (currentPage >= pageCount) {
+      return {};
+    }
+    return {EntityReference{std::to_string(currentPage)}};
+  }
+
+  void next(const managerApi::HostSessionPtr&) override {
+    const CallGuard guard{*this};
+    ++currentPage;
+  }
+
+  std::optional<std::size_t> sizeHint(const managerApi::HostSessionPtr&) override {
+    const CallGuard guard{*this};
+    ++sizeHintCount;
+    if (!providesSizeHint) {
+      return std::nullopt;
+    }
+    return pageCount - std::min(currentPage, pageCount);
+  }
+
+  Page drainAll(const std::size_t maxItems,
+                const managerApi::HostSessionPtr& hostSession) override {
+    ++drainCount;
+    return EntityReferencePagerInterface::drainAll(maxItems, hostSession);
+  }
+
+  void close(const managerApi::HostSessionPtr&) override { ++closeCount; }
+
+  struct CallGuard {
+    explicit CallGuard(CountingPagerInterface& pagerInterface) : self{pagerInterface} {
+      if (self.inCall.exchange(true)) {
+        self.concurrentCall = true;
+      }
+      const std::lock_guard lock{self.mutex};
+      self.threads.insert(std::this_thread::get_id());
+    }
+    ~CallGuard() { self.inCall = false; }
+    CallGuard(const CallGuard&) = delete;
+    CallGuard& operator=(const CallGuard&) = delete;
+    CallGuard(CallGuard&&) = delete;
+    CallGuard& operator=(CallGuard&&) = delete;
+    CountingPagerInterface& self;
+  };
+
+  const std::size_t pageCount;
+  std::size_t failingPage = std::numeric_limits<std::size_t>::max();
+  std::size_t currentPage = 0;
+  bool providesSizeHint = false;
+  std::atomic<std::size_t> getCount{0};
+  std::atomic<std::size_t> closeCount{0};
+  std::atomic<std::size_t> drainCount{0};
+  std::atomic<std::size_t> sizeHintCount{0};
+  std::atomic<bool> inCall{false};
+  std::atomic<bool> concurrentCall{false};
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+};
+
+/**
+ * Pager whose asynchronous operations are completed manually by the
+ * test, rather than on a worker thread. Each operation is queued as
+ * its result and completion.
+ */
+struct NativeAsyncPagerInterface : managerApi::EntityReferencePagerInterface {
+  bool hasNext(const managerApi::HostSessionPtr&) override { return false; }
+  Page get(const managerApi::HostSessionPtr&) override { return {}; }
+  void next(const managerApi::HostSessionPtr&) override {}
+
+  void hasNextAsync(const managerApi::HostSessionPtr&, HasNextSuccessCallback successCallback,
+                    CompletionCallback completionCallback) override {
+    pending.emplace_back([successCallback = std::move(successCallback)] { successCallback(true); },
+                         std::move(completionCallback));
+  }
+
+  void getAsync(const managerApi::HostSessionPtr&, GetSuccessCallback successCallback,
+                CompletionCallback completionCallback) override {
+    pending.emplace_back(
+        [successCallback = std::move(successCallback)] {
+          successCallback({EntityReference{"native"}});
+        },
+        std::move(completionCallback));
+  }
+
+  void nextAsync(const managerApi::HostSessionPtr&,
+                 CompletionCallback completionCallback) override {
+    pending.emplace_back([] {}, std::move(completionCallback));
+  }
+
+  void close(const managerApi::HostSessionPtr&) override { ++closeCount; }
+
+  /// Complete the oldest pending operation.
+  void completeNext() {
+    auto [succeed, complete] = std::move(pending.front());
+    pending.pop_front();
+    succeed();
+    complete(nullptr);
+  }
+
+  std::deque<std::pair<std::function<void()>, CompletionCallback>> pending;
+  std::size_t closeCount = 0;
+};
+
+/// Wait, with timeout, for a condition set by a background thread.
+template <class Predicate>
+bool eventually(const Predicate& predicate) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  return true;
+}
+}  // namespace
+
+SCENARIO("EntityReferencePager read-ahead") {
+  GIVEN("a pager interface with several pages") {
+    const auto pagerInterface = std::make_shared<CountingPagerInterface>(5);
+    const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+
+    WHEN("a pager is created with a prefetch depth") {
+      auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession, 2);
+
+      THEN("pages are read ahead in the background") {
+        CHECK(eventually([&] { return pagerInterface->getCount == 3; }));
+        const std::lock_guard lock{pagerInterface->mutex};
+        CHECK(pagerInterface->threads.count(std::this_thread::get_id()) == 0);
+      }
+
+      AND_WHEN("all pages are traversed") {
+        std::vector<Str> refs;
+        while (true) {
+          for (const EntityReference& ref : pager->get()) {
+            refs.push_back(ref.toString());
+          }
+          if (!pager->hasNext()) {
+            break;
+          }
+          pager->next();
+        }
+
+        THEN("pages are returned in order, without concurrent interface calls") {
+          CHECK(refs == std::vector<Str>{"0", "1", "2", "3", "4"});
+          CHECK_FALSE(pagerInterface->concurrentCall);
+        }
+
+        AND_WHEN("the pager is advanced beyond the last page") {
+          pager->next();
+
+          THEN("an empty page is returned and there are no further pages") {
+            CHECK(pager->get().empty());
+            CHECK_FALSE(pager->hasNext());
+          }
+        }
+      }
+
+      AND_WHEN("the pager is destroyed") {
+        pager.reset();
+
+        THEN("the interface is closed once") {
+          CHECK(eventually([&] { return pagerInterface->closeCount == 1; }));
+        }
+      }
+    }
+
+    WHEN("a pager is created without a prefetch depth") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession);
+
+      THEN("no pages are fetched until requested") {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        CHECK(pagerInterface->getCount == 0);
+        CHECK(pager->get() == openassetio::EntityReferences{EntityReference{"0"}});
+        CHECK(pagerInterface->threads ==
+              std::set<std::thread::id>{std::this_thread::get_id()});
+      }
+    }
+  }
+
+  GIVEN("a pager interface that fails to fetch a page") {
+    const auto pagerInterface = std::make_shared<CountingPagerInterface>(5);
+    pagerInterface->failingPage = 1;
+    const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+
+    WHEN("a read-ahead pager is advanced to the failing page") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession, 3);
+      CHECK(pager->get() == openassetio::EntityReferences{EntityReference{"0"}});
+      CHECK(pager->hasNext());
+      pager->next();
+
+      THEN("the error is raised to the host") {
+        CHECK_THROWS_AS(pager->get(), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(pager->hasNext(), openassetio::errors::InputValidationException);
+      }
+    }
+  }
+}
+
+SCENARIO("Draining an EntityReferencePager") {
+  using openassetio::EntityReferences;
+
+  GIVEN("a pager interface with several pages") {
+    const auto pagerInterface = std::make_shared<CountingPagerInterface>(5);
+    const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+    const EntityReferences allRefs{EntityReference{"0"}, EntityReference{"1"},
+                                   EntityReference{"2"}, EntityReference{"3"},
+                                   EntityReference{"4"}};
+
+    AND_GIVEN("a pager without read-ahead") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession);
+
+      WHEN("the pager is drained") {
+        const EntityReferences refs = pager->drainAll();
+
+        THEN("all entity references are returned via the interface's drain") {
+          CHECK(refs == allRefs);
+          CHECK(pagerInterface->drainCount == 1);
+          CHECK(pager->get().empty());
+          CHECK_FALSE(pager->hasNext());
+        }
+      }
+
+      WHEN("the pager is drained with a maximum number of items") {
+        const EntityReferences refs = pager->drainAll(2);
+
+        THEN("only that many are returned, and the pager is on the following page") {
+          CHECK(refs == EntityReferences{EntityReference{"0"}, EntityReference{"1"}});
+          CHECK(pager->get() == EntityReferences{EntityReference{"2"}});
+        }
+      }
+    }
+
+    AND_GIVEN("a pager with read-ahead, advanced to its second page") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession, 2);
+      pager->next();
+      REQUIRE(eventually([&] { return pagerInterface->getCount == 4; }));
+
+      WHEN("the pager is drained") {
+        const EntityReferences refs = pager->drainAll();
+
+        THEN("buffered and remaining entity references are returned in order") {
+          CHECK(refs == EntityReferences(allRefs.begin() + 1, allRefs.end()));
+          CHECK(pagerInterface->drainCount == 1);
+          CHECK_FALSE(pagerInterface->concurrentCall);
+          CHECK(pager->get().empty());
+          CHECK_FALSE(pager->hasNext());
+        }
+      }
+
+      WHEN("the pager is drained with fewer items than are buffered") {
+        const EntityReferences refs = pager->drainAll(2);
+
+        THEN("the interface is not drained, and read-ahead continues") {
+          CHECK(refs == EntityReferences{EntityReference{"1"}, EntityReference{"2"}});
+          CHECK(pagerInterface->drainCount == 0);
+          CHECK(pager->get() == EntityReferences{EntityReference{"3"}});
+          CHECK(pager->hasNext());
+        }
+      }
+
+      WHEN("the pager is drained of exactly the remaining items") {
+        const EntityReferences refs = pager->drainAll(4);
+
+        THEN("read-ahead resumes from the following, empty, page") {
+          CHECK(refs == EntityReferences(allRefs.begin() + 1, allRefs.end()));
+          CHECK(pagerInterface->drainCount == 1);
+          CHECK(pager->get().empty());
+          CHECK_FALSE(pager->hasNext());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("EntityReferencePager size hints and page reuse") {
+  using openassetio::EntityReferences;
+
+  GIVEN("a pager interface with several pages that provides a size hint") {
+    const auto pagerInterface = std::make_shared<CountingPagerInterface>(5);
+    pagerInterface->providesSizeHint = true;
+    const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+
+    AND_GIVEN("a pager without read-ahead") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession);
+
+      THEN("the hint is the number of remaining entity references") {
+        CHECK(pager->sizeHint() == 5U);
+        pager->next();
+        CHECK(pager->sizeHint() == 4U);
+      }
+
+      WHEN("the pager is drained") {
+        const EntityReferences refs = pager->drainAll();
+
+        THEN("the list is sized according to the hint") {
+          CHECK(refs.size() == 5);
+          CHECK(refs.capacity() == 5);
+        }
+      }
+
+      WHEN("pages are retrieved into an existing list") {
+        EntityReferences page;
+        page.reserve(8);
+        const EntityReference* const storage = page.data();
+        pager->get(page);
+        pager->next();
+        pager->get(page);
+
+        THEN("the list holds the current page, in the original storage") {
+          CHECK(page == EntityReferences{EntityReference{"1"}});
+          CHECK(page.data() == storage);
+        }
+      }
+    }
+
+    AND_GIVEN("a pager with read-ahead, advanced to its second page") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession, 2);
+      pager->next();
+      REQUIRE(eventually([&] { return pagerInterface->getCount == 4; }));
+
+      THEN("the hint accounts for buffered pages") {
+        CHECK(pager->sizeHint() == 4U);
+        CHECK_FALSE(pagerInterface->concurrentCall);
+      }
+
+      WHEN("pages are retrieved into an existing list") {
+        EntityReferences page;
+        page.reserve(8);
+        const EntityReference* const storage = page.data();
+        pager->get(page);
+
+        THEN("the list holds the current page, in the original storage") {
+          CHECK(page == EntityReferences{EntityReference{"1"}});
+          CHECK(page.data() == storage);
+        }
+      }
+
+      WHEN("the buffered pages are consumed") {
+        pager->next();
+        pager->next();
+        pager->next();
+
+        THEN("the hint excludes consumed pages") {
+          CHECK(pager->get() == EntityReferences{EntityReference{"4"}});
+          CHECK(pager->sizeHint() == 1U);
+        }
+      }
+    }
+
+    AND_GIVEN("a pager with read-ahead of all pages") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession, 8);
+      REQUIRE(eventually([&] { return pagerInterface->getCount == 5; }));
+      const std::size_t sizeHintCount = pagerInterface->sizeHintCount;
+
+      THEN("the hint is exact, without querying the interface") {
+        CHECK(pager->sizeHint() == 5U);
+        CHECK(pagerInterface->sizeHintCount == sizeHintCount);
+      }
+    }
+  }
+
+  GIVEN("a pager interface that does not provide a size hint") {
+    const auto pagerInterface = std::make_shared<CountingPagerInterface>(5);
+    const auto pager = hostApi::EntityReferencePager::make(pagerInterface, makeMockHostSession());
+
+    THEN("the hint is empty") { CHECK_FALSE(pager->sizeHint()); }
+  }
+}
+
+SCENARIO("Asynchronous EntityReferencePager paging") {
+  using openassetio::EntityReferences;
+
+  GIVEN("a pager interface with several pages") {
+    const auto pagerInterface = std::make_shared<CountingPagerInterface>(3);
+    const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+
+    AND_GIVEN("a pager without read-ahead") {
+      auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession);
+
+      WHEN("all pages are traversed asynchronously") {
+        std::vector<Str> refs;
+        while (true) {
+          for (const EntityReference& ref : pager->getAsync().get()) {
+            refs.push_back(ref.toString());
+          }
+          if (!pager->hasNextAsync().get()) {
+            break;
+          }
+          pager->nextAsync().get();
+        }
+
+        THEN("pages are returned in order, from another thread") {
+          CHECK(refs == std::vector<Str>{"0", "1", "2"});
+          const std::lock_guard lock{pagerInterface->mutex};
+          CHECK(pagerInterface->threads.count(std::this_thread::get_id()) == 0);
+        }
+      }
+
+      WHEN("the current page is requested via callbacks") {
+        std::promise<EntityReferences> result;
+        std::promise<std::exception_ptr> completion;
+        pager->getAsync([&](EntityReferences page) { result.set_value(std::move(page)); },
+                        [&](std::exception_ptr exception) { completion.set_value(exception); });
+
+        THEN("the page is provided, then completion is signalled") {
+          CHECK(completion.get_future().get() == nullptr);
+          CHECK(result.get_future().get() == EntityReferences{EntityReference{"0"}});
+        }
+      }
+
+      WHEN("the host releases the pager whilst an operation is in progress") {
+        std::promise<void> release;
+        std::future<void> released = release.get_future();
+        std::promise<void> completion;
+        pager->getAsync([&](const EntityReferences&) { released.wait(); },
+                        [&](std::exception_ptr) { completion.set_value(); });
+        pager.reset();
+        const std::size_t closeCount = pagerInterface->closeCount;
+        release.set_value();
+        completion.get_future().wait();
+
+        THEN("the interface is closed only once the operation completes") {
+          CHECK(closeCount == 0);
+          CHECK(eventually([&] { return pagerInterface->closeCount == 1; }));
+        }
+      }
+    }
+
+    AND_GIVEN("a pager with read-ahead") {
+      const auto pager = hostApi::EntityReferencePager::make(pagerInterface, hostSession, 2);
+
+      WHEN("all pages are traversed asynchronously") {
+        std::vector<Str> refs;
+        while (true) {
+          for (const EntityReference& ref : pager->getAsync().get()) {
+            refs.push_back(ref.toString());
+          }
+          if (!pager->hasNextAsync().get()) {
+            break;
+          }
+          pager->nextAsync().get();
+        }
+
+        THEN("pages are returned in order, without concurrent interface calls") {
+          CHECK(refs == std::vector<Str>{"0", "1", "2"});
+          CHECK_FALSE(pagerInterface->concurrentCall);
+        }
+      }
+    }
+  }
+
+  GIVEN("a pager interface that fails to fetch a page") {
+    const auto pagerInterface = std::make_shared<CountingPagerInterface>(3);
+    pagerInterface->failingPage = 0;
+    const auto pager = hostApi::EntityReferencePager::make(pagerInterface, makeMockHostSession());
+
+    WHEN("the page is requested asynchronously") {
+      std::future<EntityReferences> page = pager->getAsync();
+
+      THEN("the future holds the error") {
+        CHECK_THROWS_AS(page.get(), openassetio::errors::InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a pager interface with native asynchronous paging") {
+    const auto pagerInterface = std::make_shared<NativeAsyncPagerInterface>();
+    auto pager = hostApi::EntityReferencePager::make(pagerInterface, makeMockHostSession());
+
+    WHEN("pages are requested asynchronously") {
+      std::future<bool> hasNext = pager->hasNextAsync();
+      std::future<EntityReferences> page = pager->getAsync();
+      std::future<void> advanced = pager->nextAsync();
+
+      THEN("the manager's implementation is used") {
+        REQUIRE(pagerInterface->pending.size() == 3);
+        CHECK(page.wait_for(std::chrono::seconds{0}) == std::future_status::timeout);
+        pagerInterface->completeNext();
+        pagerInterface->completeNext();
+        pagerInterface->completeNext();
+        CHECK(hasNext.get());
+        CHECK(page.get() == EntityReferences{EntityReference{"native"}});
+        advanced.get();
+      }
+    }
+
+    WHEN("the host releases the pager whilst an operation is in progress") {
+      std::future<void> advanced = pager->nextAsync();
+      pager.reset();
+
+      THEN("the pager is kept alive until the operation completes") {
+        CHECK(pagerInterface->closeCount == 0);
+        pagerInterface->completeNext();
+        advanced.get();
+        CHECK(pagerInterface->closeCount == 1);
+      }
+    }
+  }
+}
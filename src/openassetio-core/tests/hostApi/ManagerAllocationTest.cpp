@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Guards against allocation regressions in the host-side plumbing of
+ * the Manager's batch methods.
+ */
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/FunctionRef.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/AllocationCounter.hpp>
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReferences;
+using openassetio::FunctionRef;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::AllocationCounter;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::ManagerFixture;
+using trompeloeil::_;
+
+/**
+ * Resolve every entity to the same preallocated TraitsData, such that
+ * the mock manager plugin makes no allocations of its own.
+ */
+void resolveToPreallocated(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  static const trait::TraitsDataPtr kTraitsData = trait::TraitsData::make();
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, kTraitsData);
+  }
+}
+
+EntityReferences makeEntityReferences(const std::size_t count) {
+  EntityReferences refs;
+  refs.reserve(count);
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    refs.emplace_back("stub://" + std::to_string(idx));
+  }
+  return refs;
+}
+}  // namespace
+
+SCENARIO("Manager batch resolve allocations") {
+  GIVEN("a Manager wrapping a manager plugin that does not allocate") {
+    const ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    const auto& context = fixture.context;
+    initializeManager(*manager, fixture.mockManagerInterface);
+    const trait::TraitSet traitSet{"trait"};
+
+    ALLOW_CALL(fixture.mockManagerInterface, resolve(_, traitSet, ResolveAccess::kRead, _,
+                                                     fixture.hostSession, _, _))
+        .SIDE_EFFECT(resolveToPreallocated(_1, _6));
+
+    WHEN("batches of different sizes are resolved via callbacks") {
+      const auto allocationsFor = [&](const std::size_t batchSize) {
+        const EntityReferences refs = makeEntityReferences(batchSize);
+        const auto resolve = [&] {
+          manager->resolve(
+              refs, traitSet, ResolveAccess::kRead, context,
+              [](std::size_t, const trait::TraitsDataPtr&) {},
+              [](std::size_t, const BatchElementError&) {});
+        };
+        // Exclude one-time allocations, e.g. lazily created caches.
+        resolve();
+        const AllocationCounter allocations;
+        resolve();
+        return allocations.count();
+      };
+
+      const auto smallBatchAllocations = allocationsFor(10);
+      const auto largeBatchAllocations = allocationsFor(1000);
+
+      THEN("the number of allocations does not depend on the batch size") {
+        CHECK(largeBatchAllocations == smallBatchAllocations);
+      }
+    }
+
+    WHEN("a batch is resolved via callbacks with large captures, wrapped in FunctionRefs") {
+      const EntityReferences refs = makeEntityReferences(10);
+      const std::array<std::size_t, 8> padding{};
+      std::size_t successCount = 0;
+      const auto onSuccess = [padding, &successCount](std::size_t, const trait::TraitsDataPtr&) {
+        successCount += padding.size();
+      };
+      const auto onError = [padding](std::size_t, const BatchElementError&) {};
+      const auto resolve = [&](const auto& successCallback, const auto& errorCallback) {
+        manager->resolve(refs, traitSet, ResolveAccess::kRead, context, successCallback,
+                         errorCallback);
+      };
+      const auto onSmallSuccess = [](std::size_t, const trait::TraitsDataPtr&) {};
+      const auto onSmallError = [](std::size_t, const BatchElementError&) {};
+      resolve(onSmallSuccess, onSmallError);
+
+      const AllocationCounter smallCaptureAllocations;
+      resolve(onSmallSuccess, onSmallError);
+      const auto smallCaptureAllocationCount = smallCaptureAllocations.count();
+
+      const AllocationCounter largeCaptureAllocations;
+      resolve(FunctionRef<void(std::size_t, trait::TraitsDataPtr)>{onSuccess},
+              FunctionRef<void(std::size_t, BatchElementError)>{onError});
+      const auto largeCaptureAllocationCount = largeCaptureAllocations.count();
+
+      THEN("no more allocations are made than for captureless callbacks") {
+        CHECK(largeCaptureAllocationCount == smallCaptureAllocationCount);
+        CHECK(successCount == refs.size() * padding.size());
+      }
+    }
+
+    WHEN("batches of different sizes are resolved to a vector") {
+      const auto allocationsFor = [&](const std::size_t batchSize) {
+        const EntityReferences refs = makeEntityReferences(batchSize);
+        [[maybe_unused]] const auto warmup =
+            manager->resolve(refs, traitSet, ResolveAccess::kRead, context);
+        const AllocationCounter allocations;
+        [[maybe_unused]] const auto results =
+            manager->resolve(refs, traitSet, ResolveAccess::kRead, context);
+        return allocations.count();
+      };
+
+      const auto smallBatchAllocations = allocationsFor(10);
+      const auto largeBatchAllocations = allocationsFor(1000);
+
+      THEN("the number of allocations does not depend on the batch size") {
+        CHECK(largeBatchAllocations == smallBatchAllocations);
+      }
+    }
+  }
+}
@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerAwaitables.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+#ifndef OPENASSETIO_HAS_COROUTINES
+#error "Coroutine support is required to test Manager awaitables"
+#endif
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockLoggerInterface;
+using openassetio::testSupport::MockManagerInterface;
+using openassetio::testSupport::MockSchedulingHostInterface;
+using trompeloeil::_;
+
+/// Mock manager that overrides asynchronous resolution.
+struct MockAsyncManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK8(resolveAsync);
+};
+
+/**
+ * Complete an asynchronous resolve on a new thread, resolving each
+ * entity to a TraitsData with a trait named after the entity
+ * reference, except for "bad", which errors, and "fail", which fails
+ * the whole batch.
+ */
+void resolveOnThread(EntityReferences entityReferences,
+                     managerApi::ManagerInterface::ResolveSuccessCallback successCallback,
+                     managerApi::ManagerInterface::BatchElementErrorCallback errorCallback,
+                     managerApi::ManagerInterface::CompletionCallback completionCallback) {
+  std::thread{[entityReferences = std::move(entityReferences),
+               successCallback = std::move(successCallback),
+               errorCallback = std::move(errorCallback),
+               completionCallback = std::move(completionCallback)] {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      const Str& ref = entityReferences[idx].toString();
+      if (ref == "fail") {
+        completionCallback(std::make_exception_ptr(std::runtime_error{"failed"}));
+        return;
+      }
+      if (ref == "bad") {
+        errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kUnknown, ref});
+      } else {
+        successCallback(idx, trait::TraitsData::make({ref}));
+      }
+    }
+    completionCallback(nullptr);
+  }}.detach();
+}
+
+/// Report that every entity exists.
+void existsAll(const EntityReferences& entityReferences,
+               const managerApi::ManagerInterface::ExistsSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, true);
+  }
+}
+
+/**
+ * Minimal eagerly-started, fire-and-forget coroutine, for driving
+ * awaitables in tests. The frame is destroyed on completion.
+ */
+struct FireAndForget {
+  struct promise_type {
+    FireAndForget get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+/// Resolve entities from a coroutine, signalling `done` once resumed.
+FireAndForget resolveTask(
+    const hostApi::ManagerPtr& manager, EntityReferences entityReferences,
+    hostApi::ManagerAwaitableResumer resumer,
+    std::vector<std::variant<BatchElementError, trait::TraitsDataPtr>>& results,
+    std::exception_ptr& exception, std::promise<std::thread::id>& done) {
+  auto awaitable = hostApi::awaitResolve(manager, std::move(entityReferences), {"t"},
+                                         ResolveAccess::kRead, manager->createContext(),
+                                         std::move(resumer));
+  try {
+    results = co_await awaitable;
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  done.set_value(std::this_thread::get_id());
+}
+
+/// Query the existence of an entity from a coroutine.
+FireAndForget entityExistsTask(const hostApi::ManagerPtr& manager, EntityReference entityReference,
+                               std::optional<std::variant<BatchElementError, bool>>& result) {
+  result = co_await hostApi::awaitEntityExists(manager, std::move(entityReference),
+                                               manager->createContext());
+}
+}  // namespace
+
+SCENARIO("Awaiting Manager operations from coroutines") {
+  GIVEN("a manager whose asynchronous operations complete on another thread") {
+    const auto mockManagerInterface = std::make_shared<MockAsyncManagerInterface>();
+    const auto manager = hostApi::Manager::make(mockManagerInterface, makeMockHostSession());
+    initializeManager(*manager, *mockManagerInterface);
+    ALLOW_CALL(*mockManagerInterface, resolveAsync(_, _, ResolveAccess::kRead, _, _, _, _, _))
+        .SIDE_EFFECT(resolveOnThread(_1, _6, _7, _8));
+
+    std::vector<std::variant<BatchElementError, trait::TraitsDataPtr>> results;
+    std::exception_ptr exception;
+    std::promise<std::thread::id> done;
+
+    WHEN("a batch resolve is awaited") {
+      resolveTask(manager, {EntityReference{"a"}, EntityReference{"bad"}}, {}, results, exception,
+                  done);
+      done.get_future().wait();
+
+      THEN("the coroutine is resumed with each element's result") {
+        CHECK_FALSE(exception);
+        REQUIRE(results.size() == 2);
+        CHECK(std::get<trait::TraitsDataPtr>(results[0])->traitSet() == trait::TraitSet{"a"});
+        CHECK(std::get<BatchElementError>(results[1]).message == "bad");
+      }
+    }
+
+    WHEN("a batch resolve that fails is awaited") {
+      resolveTask(manager, {EntityReference{"fail"}}, {}, results, exception, done);
+      done.get_future().wait();
+
+      THEN("the exception is rethrown into the coroutine") {
+        REQUIRE(exception);
+        CHECK_THROWS_AS(std::rethrow_exception(exception), std::runtime_error);
+      }
+    }
+
+    WHEN("a batch resolve is awaited with a resumer") {
+      const auto pending = std::make_shared<std::promise<std::coroutine_handle<>>>();
+      resolveTask(
+          manager, {EntityReference{"a"}},
+          [pending](const std::coroutine_handle<> handle) { pending->set_value(handle); },
+          results, exception, done);
+      auto resumed = done.get_future();
+
+      THEN("the coroutine is resumed only when the resumer chooses") {
+        const std::coroutine_handle<> handle = pending->get_future().get();
+        CHECK(resumed.wait_for(std::chrono::milliseconds{0}) == std::future_status::timeout);
+
+        handle.resume();
+        CHECK(resumed.get() == std::this_thread::get_id());
+        CHECK(std::holds_alternative<trait::TraitsDataPtr>(results[0]));
+      }
+    }
+  }
+
+  GIVEN("a manager whose operations complete synchronously, via an inline host scheduler") {
+    const auto hostInterface = std::make_shared<MockSchedulingHostInterface>();
+    const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+    const auto manager = hostApi::Manager::make(
+        mockManagerInterface,
+        managerApi::HostSession::make(managerApi::Host::make(hostInterface),
+                                      std::make_shared<MockLoggerInterface>()));
+    initializeManager(*manager, *mockManagerInterface);
+
+    WHEN("a singular entityExists is awaited") {
+      REQUIRE_CALL(*hostInterface, submit(_)).SIDE_EFFECT(_1());
+      REQUIRE_CALL(*mockManagerInterface, entityExists(_, _, _, _, _))
+          .SIDE_EFFECT(existsAll(_1, _4));
+
+      std::optional<std::variant<BatchElementError, bool>> result;
+      entityExistsTask(manager, EntityReference{"a"}, result);
+
+      THEN("the coroutine completes without suspending, with the result") {
+        REQUIRE(result);
+        CHECK(std::get<bool>(*result));
+      }
+    }
+  }
+}
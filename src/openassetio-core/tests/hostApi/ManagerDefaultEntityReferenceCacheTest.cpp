@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::Str;
+using openassetio::access::DefaultEntityAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/**
+ * Report the default entity for each trait set as named after the
+ * set's first trait and the access mode. Trait sets containing "none"
+ * have no default, and those containing "fail" fail.
+ */
+void defaultsFromTraits(
+    const trait::TraitSets& traitSets, const DefaultEntityAccess defaultEntityAccess,
+    const managerApi::ManagerInterface::DefaultEntityReferenceSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < traitSets.size(); ++idx) {
+    if (traitSets[idx].count("fail") != 0) {
+      errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kUnknown, ""});
+    } else if (traitSets[idx].count("none") != 0) {
+      successCallback(idx, std::nullopt);
+    } else {
+      successCallback(idx, EntityReference{*traitSets[idx].begin() + ":" +
+                                           (defaultEntityAccess == DefaultEntityAccess::kRead
+                                                ? "read"
+                                                : "write")});
+    }
+  }
+}
+
+/**
+ * Fixture providing an initialized Manager with a default entity
+ * reference cache.
+ *
+ * The mock manager plugin records the trait sets of each batch of
+ * defaultEntityReference queries.
+ */
+struct DefaultEntityReferenceCacheFixture {
+  DefaultEntityReferenceCacheFixture() {
+    using Capability = managerApi::ManagerInterface::Capability;
+    auto& mock = *mockManagerInterface;
+    // Flushing all caches re-queries the plugin's capabilities and info.
+    expectations.push_back(NAMED_ALLOW_CALL(mock, flushCaches(hostSession)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mock, hasCapability(_)).RETURN(_1 != Capability::kStatefulContexts));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, info()).RETURN(openassetio::InfoDictionary{}));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, flushEntityCaches(_, hostSession)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mock, defaultEntityReference(_, _, _, hostSession, _, _))
+            .LR_SIDE_EFFECT(batches.push_back(_1))
+            .SIDE_EFFECT(defaultsFromTraits(_1, _2, _5, _6)));
+    initializeManager(*manager, mock);
+  }
+
+  const std::shared_ptr<MockManagerInterface> mockManagerInterface =
+      std::make_shared<MockManagerInterface>();
+  const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+  const hostApi::ManagerPtr manager =
+      hostApi::Manager::make(mockManagerInterface, hostSession, optionsWithCapacity(16));
+  std::vector<trait::TraitSets> batches;
+
+ private:
+  static hostApi::Manager::Options optionsWithCapacity(
+      const std::size_t defaultEntityReferenceCacheCapacity) {
+    hostApi::Manager::Options options;
+    options.defaultEntityReferenceCacheCapacity = defaultEntityReferenceCacheCapacity;
+    return options;
+  }
+
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+
+/// Result of an element of a batch: a default entity, no default, or
+/// an error.
+using Result = std::optional<std::optional<EntityReference>>;
+
+std::vector<Result> defaultEntityReference(const hostApi::ManagerPtr& manager,
+                                           const trait::TraitSets& traitSets,
+                                           const DefaultEntityAccess defaultEntityAccess,
+                                           const ContextConstPtr& context) {
+  std::vector<Result> results(traitSets.size());
+  manager->defaultEntityReference(
+      traitSets, defaultEntityAccess, context,
+      [&](const std::size_t idx, std::optional<EntityReference> entityReference) {
+        results[idx] = std::move(entityReference);
+      },
+      [](std::size_t, const BatchElementError&) {});
+  return results;
+}
+}  // namespace
+
+SCENARIO("Caching defaultEntityReference results") {
+  GIVEN("a manager with a default entity reference cache") {
+    DefaultEntityReferenceCacheFixture fixture;
+    const auto& manager = fixture.manager;
+    const auto& hostSession = fixture.hostSession;
+    const auto context = manager->createContext();
+
+    WHEN("a default is queried twice") {
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kWrite,
+                                               context));
+      const std::vector<Result> results =
+          defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kWrite, context);
+
+      THEN("the second query is served from the cache") {
+        CHECK(results == std::vector<Result>{EntityReference{"a:write"}});
+        CHECK(fixture.batches.size() == 1);
+        CHECK(manager->memoryUsage().defaultEntityReferenceCache > 0);
+      }
+    }
+
+    WHEN("a default is queried for read then for write") {
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kRead,
+                                               context));
+      const std::vector<Result> results =
+          defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kWrite, context);
+
+      THEN("each access mode is cached separately") {
+        CHECK(results == std::vector<Result>{EntityReference{"a:write"}});
+        CHECK(fixture.batches.size() == 2);
+      }
+    }
+
+    WHEN("the context's locale differs") {
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kRead,
+                                               context));
+      const auto otherContext = manager->createContext();
+      otherContext->locale = trait::TraitsData::make({"other"});
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kRead,
+                                               otherContext));
+
+      THEN("the default is queried again") { CHECK(fixture.batches.size() == 2); }
+    }
+
+    WHEN("a batch is queried that is partially cached") {
+      static_cast<void>(defaultEntityReference(manager, {{"b"}, {"none"}},
+                                               DefaultEntityAccess::kRead, context));
+      const std::vector<Result> results = defaultEntityReference(
+          manager, {{"a"}, {"b"}, {"none"}, {"fail"}}, DefaultEntityAccess::kRead, context);
+
+      THEN("only uncached trait sets are queried, and results keep their indices") {
+        CHECK(fixture.batches.back() == trait::TraitSets{{"a"}, {"fail"}});
+        CHECK(results == std::vector<Result>{EntityReference{"a:read"}, EntityReference{"b:read"},
+                                             std::optional<EntityReference>{}, std::nullopt});
+      }
+
+      AND_WHEN("the failed trait set is queried again") {
+        static_cast<void>(defaultEntityReference(manager, {{"fail"}}, DefaultEntityAccess::kRead,
+                                                 context));
+
+        THEN("errors were not cached") { CHECK(fixture.batches.size() == 3); }
+      }
+    }
+
+    WHEN("caches are flushed for the default entity") {
+      static_cast<void>(defaultEntityReference(manager, {{"a"}, {"b"}},
+                                               DefaultEntityAccess::kRead, context));
+      manager->flushCaches({EntityReference{"a:read"}});
+      static_cast<void>(defaultEntityReference(manager, {{"a"}, {"b"}},
+                                               DefaultEntityAccess::kRead, context));
+
+      THEN("only that default is queried again") {
+        CHECK(fixture.batches.back() == trait::TraitSets{{"a"}});
+      }
+    }
+
+    WHEN("the host is notified that any entity has changed") {
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kRead,
+                                               context));
+      hostSession->notifyEntitiesChanged({EntityReference{"unrelated"}});
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kRead,
+                                               context));
+
+      THEN("the default is queried again") { CHECK(fixture.batches.size() == 2); }
+    }
+
+    WHEN("all caches are flushed") {
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kRead,
+                                               context));
+      manager->flushCaches();
+      static_cast<void>(defaultEntityReference(manager, {{"a"}}, DefaultEntityAccess::kRead,
+                                               context));
+
+      THEN("the default is queried again") { CHECK(fixture.batches.size() == 2); }
+    }
+  }
+}
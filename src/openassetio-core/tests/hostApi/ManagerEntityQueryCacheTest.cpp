@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/EntityExistenceFilter.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::EntityTraitsAccess;
+using openassetio::access::PublishingAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/// Mock manager that also mocks its existence filter.
+struct MockFilteringManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK1(entityExistenceFilter);
+};
+
+/// Report entities as existing unless their reference is "missing".
+void existsUnlessMissing(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ExistsSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, entityReferences[idx].toString() != "missing");
+  }
+}
+
+/**
+ * Report each entity as having a trait named after its reference and
+ * the access mode, erroring for "missing".
+ */
+void traitsFromReferences(
+    const EntityReferences& entityReferences, const EntityTraitsAccess entityTraitsAccess,
+    const managerApi::ManagerInterface::EntityTraitsSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "missing") {
+      errorCallback(idx,
+                    BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError, ""});
+      continue;
+    }
+    successCallback(
+        idx, {ref + (entityTraitsAccess == EntityTraitsAccess::kRead ? ":read" : ":write")});
+  }
+}
+
+/// Register entities to their own references.
+void registerToSelf(const EntityReferences& entityReferences,
+                    const managerApi::ManagerInterface::RegisterSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, entityReferences[idx]);
+  }
+}
+
+/**
+ * Fixture providing an initialized Manager with the given entity
+ * traits cache capacity.
+ *
+ * The mock manager plugin provides `filter` as its existence filter,
+ * and records the entity references of each query batch. Registration
+ * succeeds, without updating the filter.
+ */
+struct QueryCacheFixture {
+  explicit QueryCacheFixture(const std::size_t entityTraitsCacheCapacity)
+      : manager{hostApi::Manager::make(mockManagerInterface, hostSession,
+                                       optionsWith(entityTraitsCacheCapacity))} {
+    using Capability = managerApi::ManagerInterface::Capability;
+    auto& mock = *mockManagerInterface;
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mock, identifier()).RETURN("org.openassetio.test.manager"));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, initialize(_, _)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mock, hasCapability(_)).RETURN(_1 != Capability::kStatefulContexts));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, info()).RETURN(openassetio::InfoDictionary{}));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, flushCaches(hostSession)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mock, entityExistenceFilter(hostSession)).LR_RETURN(filter));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, entityExists(_, _, hostSession, _, _))
+                               .LR_SIDE_EFFECT(batches.push_back(_1))
+                               .SIDE_EFFECT(existsUnlessMissing(_1, _4)));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, entityTraits(_, _, _, hostSession, _, _))
+                               .LR_SIDE_EFFECT(batches.push_back(_1))
+                               .SIDE_EFFECT(traitsFromReferences(_1, _2, _5, _6)));
+    expectations.push_back(NAMED_ALLOW_CALL(mock, register_(_, _, _, _, hostSession, _, _))
+                               .SIDE_EFFECT(registerToSelf(_1, _6)));
+  }
+
+  void initialize() const { manager->initialize({}); }
+
+  const std::shared_ptr<MockFilteringManagerInterface> mockManagerInterface =
+      std::make_shared<MockFilteringManagerInterface>();
+  const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+  const hostApi::ManagerPtr manager;
+  managerApi::EntityExistenceFilterConstPtr filter;
+  std::vector<EntityReferences> batches;
+
+ private:
+  static hostApi::Manager::Options optionsWith(const std::size_t entityTraitsCacheCapacity) {
+    hostApi::Manager::Options options;
+    options.entityTraitsCacheCapacity = entityTraitsCacheCapacity;
+    return options;
+  }
+
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+
+trait::TraitSet entityTraits(const hostApi::ManagerPtr& manager, const Str& ref,
+                             const EntityTraitsAccess entityTraitsAccess,
+                             const ContextConstPtr& context) {
+  trait::TraitSet result;
+  manager->entityTraits(
+      {EntityReference{ref}}, entityTraitsAccess, context,
+      [&](std::size_t, trait::TraitSet traitSet) { result = std::move(traitSet); },
+      [](std::size_t, const BatchElementError&) {});
+  return result;
+}
+
+std::vector<bool> entityExists(const hostApi::ManagerPtr& manager,
+                               const EntityReferences& entityReferences,
+                               const ContextConstPtr& context) {
+  std::vector<bool> exists(entityReferences.size(), true);
+  manager->entityExists(
+      entityReferences, context,
+      [&](const std::size_t idx, const bool entityExists) { exists[idx] = entityExists; },
+      [](std::size_t, const BatchElementError&) {});
+  return exists;
+}
+}  // namespace
+
+SCENARIO("Caching entityTraits results") {
+  GIVEN("a manager with an entity traits cache") {
+    QueryCacheFixture fixture{16};
+    fixture.initialize();
+    const auto& manager = fixture.manager;
+    const auto& hostSession = fixture.hostSession;
+    const auto context = manager->createContext();
+
+    WHEN("an entity's traits are queried twice") {
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+      const trait::TraitSet traitSet =
+          entityTraits(manager, "a", EntityTraitsAccess::kRead, context);
+
+      THEN("the second query is served from the cache") {
+        CHECK(traitSet == trait::TraitSet{"a:read"});
+        CHECK(fixture.batches.size() == 1);
+        CHECK(manager->memoryUsage().entityTraitsCache > 0);
+      }
+    }
+
+    WHEN("an entity's traits are queried for read then for write") {
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+      const trait::TraitSet traitSet =
+          entityTraits(manager, "a", EntityTraitsAccess::kWrite, context);
+
+      THEN("each access mode is cached separately") {
+        CHECK(traitSet == trait::TraitSet{"a:write"});
+        CHECK(fixture.batches.size() == 2);
+      }
+    }
+
+    WHEN("a batch is queried that is partially cached") {
+      static_cast<void>(entityTraits(manager, "b", EntityTraitsAccess::kRead, context));
+      std::vector<trait::TraitSet> traitSets(3);
+      std::vector<std::size_t> errorIdxs;
+      manager->entityTraits(
+          {EntityReference{"a"}, EntityReference{"b"}, EntityReference{"missing"}},
+          EntityTraitsAccess::kRead, context,
+          [&](const std::size_t idx, trait::TraitSet traitSet) {
+            traitSets[idx] = std::move(traitSet);
+          },
+          [&](const std::size_t idx, const BatchElementError&) { errorIdxs.push_back(idx); });
+
+      THEN("only uncached entities are queried, and results keep their indices") {
+        CHECK(fixture.batches.back() ==
+              EntityReferences{EntityReference{"a"}, EntityReference{"missing"}});
+        CHECK(traitSets[0] == trait::TraitSet{"a:read"});
+        CHECK(traitSets[1] == trait::TraitSet{"b:read"});
+        CHECK(errorIdxs == std::vector<std::size_t>{2});
+      }
+
+      AND_WHEN("the failed entity is queried again") {
+        manager->entityTraits(
+            {EntityReference{"missing"}}, EntityTraitsAccess::kRead, context,
+            [](std::size_t, const trait::TraitSet&) {},
+            [](std::size_t, const BatchElementError&) {});
+
+        THEN("errors were not cached") { CHECK(fixture.batches.size() == 3); }
+      }
+    }
+
+    WHEN("the host is notified that a cached entity has changed") {
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+      hostSession->notifyEntitiesChanged({EntityReference{"a"}});
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+
+      THEN("the entity is queried again") { CHECK(fixture.batches.size() == 2); }
+    }
+
+    WHEN("caches are flushed") {
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+      manager->flushCaches();
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+
+      THEN("the entity is queried again") { CHECK(fixture.batches.size() == 2); }
+    }
+  }
+
+  GIVEN("a manager without an entity traits cache") {
+    QueryCacheFixture fixture{0};
+    fixture.initialize();
+    const auto& manager = fixture.manager;
+    const auto context = manager->createContext();
+
+    WHEN("an entity's traits are queried twice") {
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+      static_cast<void>(entityTraits(manager, "a", EntityTraitsAccess::kRead, context));
+
+      THEN("both queries call the manager") { CHECK(fixture.batches.size() == 2); }
+    }
+  }
+}
+
+SCENARIO("Filtering entityExists queries") {
+  GIVEN("a manager providing an existence filter") {
+    QueryCacheFixture fixture{0};
+    const auto filter = managerApi::EntityExistenceFilter::make(16);
+    filter->insert("a");
+    fixture.filter = filter;
+    fixture.initialize();
+    const auto& manager = fixture.manager;
+    const auto context = manager->createContext();
+
+    WHEN("existence of entities within and without the filter is queried") {
+      const std::vector<bool> exists =
+          entityExists(manager, {EntityReference{"b"}, EntityReference{"a"}}, context);
+
+      THEN("definite negatives are answered without calling the manager") {
+        CHECK(exists == std::vector<bool>{false, true});
+        CHECK(fixture.batches == std::vector<EntityReferences>{{EntityReference{"a"}}});
+      }
+    }
+
+    WHEN("only entities outside the filter are queried") {
+      const std::vector<bool> exists = entityExists(manager, {EntityReference{"b"}}, context);
+
+      THEN("the manager is not called") {
+        CHECK(exists == std::vector<bool>{false});
+        CHECK(fixture.batches.empty());
+      }
+    }
+
+    WHEN("an entity outside the filter is registered, then its existence is queried") {
+      static_cast<void>(manager->register_(EntityReference{"b"}, trait::TraitsData::make(),
+                                           PublishingAccess::kWrite, context));
+      const std::vector<bool> exists = entityExists(manager, {EntityReference{"b"}}, context);
+
+      THEN("the manager is asked, rather than the stale filter") {
+        CHECK(exists == std::vector<bool>{true});
+        CHECK(fixture.batches == std::vector<EntityReferences>{{EntityReference{"b"}}});
+      }
+
+      AND_WHEN("caches are flushed") {
+        manager->flushCaches();
+        fixture.batches.clear();
+        const std::vector<bool> existsAfterFlush =
+            entityExists(manager, {EntityReference{"c"}}, context);
+
+        THEN("the reloaded filter is used again") {
+          CHECK(existsAfterFlush == std::vector<bool>{false});
+          CHECK(fixture.batches.empty());
+        }
+      }
+    }
+
+    WHEN("the manager provides a new filter and caches are flushed") {
+      const auto newFilter = managerApi::EntityExistenceFilter::make(16);
+      newFilter->insert("b");
+      fixture.filter = newFilter;
+      manager->flushCaches();
+      const std::vector<bool> exists =
+          entityExists(manager, {EntityReference{"b"}, EntityReference{"a"}}, context);
+
+      THEN("the new filter is used") {
+        CHECK(exists == std::vector<bool>{true, false});
+        CHECK(fixture.batches == std::vector<EntityReferences>{{EntityReference{"b"}}});
+      }
+    }
+  }
+
+  GIVEN("a manager that does not provide an existence filter") {
+    QueryCacheFixture fixture{0};
+    fixture.initialize();
+    const auto& manager = fixture.manager;
+
+    WHEN("existence is queried") {
+      const std::vector<bool> exists =
+          entityExists(manager, {EntityReference{"missing"}}, manager->createContext());
+
+      THEN("the manager is called") {
+        CHECK(exists == std::vector<bool>{false});
+        CHECK(fixture.batches.size() == 1);
+      }
+    }
+  }
+}
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReferenceSpan.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/AllocationCounter.hpp>
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::EntityReferenceSpan;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::AllocationCounter;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/// Resolve each entity to a trait named after the entity reference.
+void resolveToReferenceTrait(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, trait::TraitsData::make({entityReferences[idx].toString()}));
+  }
+}
+
+/// Report that every entity exists.
+void existsAll(const EntityReferences& entityReferences,
+               const managerApi::ManagerInterface::ExistsSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, true);
+  }
+}
+
+/**
+ * Fixture providing an initialized Manager whose mock manager plugin
+ * records the entity references of each batch it is given.
+ */
+struct SpanFixture {
+  explicit SpanFixture(hostApi::ResolveCachePtr resolveCache = nullptr)
+      : manager{hostApi::Manager::make(mockManagerInterface, makeMockHostSession(),
+                                       optionsWith(std::move(resolveCache)))} {
+    initializeManager(*manager, *mockManagerInterface);
+    expectations.push_back(
+        NAMED_ALLOW_CALL(*mockManagerInterface, resolve(_, _, ResolveAccess::kRead, _, _, _, _))
+            .LR_SIDE_EFFECT(batches.push_back(_1))
+            .SIDE_EFFECT(resolveToReferenceTrait(_1, _6)));
+    expectations.push_back(NAMED_ALLOW_CALL(*mockManagerInterface, entityExists(_, _, _, _, _))
+                               .LR_SIDE_EFFECT(batches.push_back(_1))
+                               .SIDE_EFFECT(existsAll(_1, _4)));
+  }
+
+  const std::shared_ptr<MockManagerInterface> mockManagerInterface =
+      std::make_shared<MockManagerInterface>();
+  const hostApi::ManagerPtr manager;
+  std::vector<EntityReferences> batches;
+
+ private:
+  static hostApi::Manager::Options optionsWith(hostApi::ResolveCachePtr resolveCache) {
+    hostApi::Manager::Options options;
+    options.resolveCache = std::move(resolveCache);
+    return options;
+  }
+
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+
+/// Resolve a span of entities, returning the traits of each result.
+std::vector<trait::TraitSet> resolve(const hostApi::ManagerPtr& manager,
+                                     const EntityReferenceSpan entityReferences) {
+  std::vector<trait::TraitSet> results(entityReferences.size());
+  manager->resolve(
+      entityReferences, {}, ResolveAccess::kRead, manager->createContext(),
+      [&](const std::size_t idx, const trait::TraitsDataPtr& data) {
+        results[idx] = data->traitSet();
+      },
+      [](std::size_t, const BatchElementError&) { FAIL(); });
+  return results;
+}
+}  // namespace
+
+SCENARIO("Querying a span of entity references") {
+  const EntityReferences refs{EntityReference{"a"}, EntityReference{"b"}, EntityReference{"c"},
+                              EntityReference{"d"}};
+  const EntityReferenceSpan middle = EntityReferenceSpan{refs}.subspan(1, 2);
+
+  GIVEN("a Manager without a resolve cache") {
+    SpanFixture fixture;
+    const auto& manager = fixture.manager;
+
+    WHEN("a sub-range of a batch is resolved") {
+      const std::vector<trait::TraitSet> results = resolve(manager, middle);
+
+      THEN("only the sub-range is resolved, with indices relative to it") {
+        CHECK(results == std::vector<trait::TraitSet>{{"b"}, {"c"}});
+        CHECK(fixture.batches == std::vector<EntityReferences>{{refs[1], refs[2]}});
+      }
+    }
+
+    WHEN("the existence of a sub-range of a batch is queried") {
+      std::vector<std::size_t> indices;
+      manager->entityExists(
+          middle, manager->createContext(),
+          [&](const std::size_t idx, bool) { indices.push_back(idx); },
+          [](std::size_t, const BatchElementError&) { FAIL(); });
+
+      THEN("only the sub-range is queried, with indices relative to it") {
+        CHECK(indices == std::vector<std::size_t>{0, 1});
+        CHECK(fixture.batches == std::vector<EntityReferences>{{refs[1], refs[2]}});
+      }
+    }
+  }
+
+  GIVEN("a Manager with a resolve cache, holding results for some entities") {
+    SpanFixture fixture{hostApi::ResolveCache::make(10)};
+    const auto& manager = fixture.manager;
+    resolve(manager, EntityReferenceSpan{&refs[1], 1});
+    fixture.batches.clear();
+
+    WHEN("a sub-range of a batch is resolved") {
+      const std::vector<trait::TraitSet> results = resolve(manager, middle);
+
+      THEN("cached results are served, and only the remainder forwarded") {
+        CHECK(results == std::vector<trait::TraitSet>{{"b"}, {"c"}});
+        CHECK(fixture.batches == std::vector<EntityReferences>{{refs[2]}});
+      }
+    }
+
+    WHEN("a cached entity is resolved singularly") {
+      const trait::TraitsDataPtr data =
+          manager->resolve(refs[1], {}, ResolveAccess::kRead, manager->createContext());
+
+      THEN("the cached result is served") {
+        CHECK(data->traitSet() == trait::TraitSet{"b"});
+        CHECK(fixture.batches.empty());
+      }
+    }
+
+    WHEN("a cached entity is resolved as a span of one, and as a list of one") {
+      const ContextConstPtr context = manager->createContext();
+      const auto allocationsFor = [&](const auto& makeBatch) {
+        const AllocationCounter allocations;
+        manager->resolve(
+            makeBatch(), {}, ResolveAccess::kRead, context,
+            [](std::size_t, const trait::TraitsDataPtr&) {},
+            [](std::size_t, const BatchElementError&) {});
+        return allocations.count();
+      };
+      const auto spanAllocations =
+          allocationsFor([&] { return EntityReferenceSpan{&refs[1], 1}; });
+      const auto listAllocations = allocationsFor([&] { return EntityReferences{refs[1]}; });
+
+      THEN("the span avoids allocating a list") { CHECK(spanAllocations < listAllocations); }
+    }
+  }
+}
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::ManagerFixture;
+using trompeloeil::_;
+using ErrorPolicyTag = hostApi::Manager::BatchElementErrorPolicyTag;
+
+/**
+ * Query existence as a manager plugin would, erroring for references
+ * beginning "missing", reporting errors in reverse order, and reporting
+ * references beginning "new" as not existing.
+ */
+void existsInReverse(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ExistsSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = entityReferences.size(); idx-- > 0;) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref.rfind("missing", 0) == 0) {
+      errorCallback(idx,
+                    BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError, ref});
+    } else {
+      successCallback(idx, ref.rfind("new", 0) != 0);
+    }
+  }
+}
+}  // namespace
+
+SCENARIO("Summarising errors of an entity existence query") {
+  GIVEN("a Manager and a batch with some failing elements") {
+    const ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    const auto& context = fixture.context;
+    initializeManager(*manager, fixture.mockManagerInterface);
+    const EntityReferences refs{EntityReference{"a"}, EntityReference{"missing1"},
+                                EntityReference{"new"}, EntityReference{"missing2"},
+                                EntityReference{"b"}};
+
+    REQUIRE_CALL(fixture.mockManagerInterface,
+                 entityExists(refs, context, fixture.hostSession, _, _))
+        .SIDE_EFFECT(existsInReverse(_1, _4, _5));
+
+    WHEN("entityExists is called with the ErrorSummary policy") {
+      const hostApi::Manager::ExistsSummary summary =
+          manager->entityExists(refs, context, ErrorPolicyTag::kErrorSummary);
+
+      THEN("existence of each entity is returned, with failed elements false") {
+        CHECK(summary.exists == std::vector<bool>{true, false, false, false, true});
+      }
+
+      THEN("only the errors are materialised, in index order") {
+        REQUIRE(summary.errors.size() == 2);
+        CHECK(summary.errors[0].first == 1);
+        CHECK(summary.errors[0].second.message == "missing1");
+        CHECK(summary.errors[1].first == 3);
+        CHECK(summary.errors[1].second.message == "missing2");
+      }
+    }
+  }
+}
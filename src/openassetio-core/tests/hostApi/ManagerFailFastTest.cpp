@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/CancellationToken.hpp>
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::CancellationToken;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::access::PublishingAccess;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::errors::BatchElementException;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::ManagerFixture;
+using trompeloeil::_;
+using ErrorPolicyTag = hostApi::Manager::BatchElementErrorPolicyTag;
+
+/**
+ * Process entities as a manager plugin would, erroring for references
+ * beginning "missing" and stopping once the Context's
+ * CancellationToken is cancelled.
+ *
+ * @return The number of entities processed.
+ */
+std::size_t processUntilCancelled(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    const std::function<void(std::size_t)>& succeed,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  std::size_t processed = 0;
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (context->cancellationToken && context->cancellationToken->isCancelled()) {
+      break;
+    }
+    ++processed;
+    if (entityReferences[idx].toString().rfind("missing", 0) == 0) {
+      errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError,
+                                           "missing"});
+    } else {
+      succeed(idx);
+    }
+  }
+  return processed;
+}
+
+std::size_t resolveUntilCancelled(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  return processUntilCancelled(
+      entityReferences, context,
+      [&](const std::size_t idx) { successCallback(idx, trait::TraitsData::make()); },
+      errorCallback);
+}
+
+std::size_t publishUntilCancelled(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    const managerApi::ManagerInterface::RegisterSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  return processUntilCancelled(
+      entityReferences, context,
+      [&](const std::size_t idx) { successCallback(idx, entityReferences[idx]); },
+      errorCallback);
+}
+
+/**
+ * Fixture providing an initialized Manager, whose mock manager plugin
+ * processes entities until cancelled, recording how many it processed
+ * and the Context it was given.
+ */
+struct FailFastFixture : ManagerFixture {
+  FailFastFixture() {
+    initializeManager(*manager, mockManagerInterface);
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mockManagerInterface, resolve(_, _, _, _, _, _, _))
+            .LR_SIDE_EFFECT(lastContext = _4)
+            .LR_SIDE_EFFECT(processed = resolveUntilCancelled(_1, _4, _6, _7)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mockManagerInterface, preflight(_, _, _, _, _, _, _))
+            .LR_SIDE_EFFECT(lastContext = _4)
+            .LR_SIDE_EFFECT(processed = publishUntilCancelled(_1, _4, _6, _7)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mockManagerInterface, register_(_, _, _, _, _, _, _))
+            .LR_SIDE_EFFECT(lastContext = _4)
+            .LR_SIDE_EFFECT(processed = publishUntilCancelled(_1, _4, _6, _7)));
+  }
+
+  std::size_t processed = 0;
+  ContextConstPtr lastContext;
+
+ private:
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+}  // namespace
+
+SCENARIO("Fail-fast batch methods stop the manager at the first error") {
+  GIVEN("a Manager and a batch with an error part way through") {
+    FailFastFixture fixture;
+    const auto& manager = fixture.manager;
+    const auto& context = fixture.context;
+    const EntityReferences refs{EntityReference{"a"}, EntityReference{"missing"},
+                                EntityReference{"b"}, EntityReference{"c"}};
+    const trait::TraitsDatas traitsDatas = trait::TraitsData::makeMany(refs.size());
+
+    WHEN("resolve is called with the Expected policy") {
+      auto result = manager->resolve(refs, {"trait"}, ResolveAccess::kRead, context,
+                                     ErrorPolicyTag::kExpected);
+
+      THEN("the first error is returned with its index") {
+        const auto* error = std::get_if<hostApi::Manager::IndexedBatchElementError>(&result);
+        REQUIRE(error != nullptr);
+        CHECK(error->first == 1);
+        CHECK(error->second.code == BatchElementError::ErrorCode::kEntityResolutionError);
+      }
+
+      THEN("the manager is asked to stop after the error") {
+        CHECK(fixture.processed == 2);
+      }
+
+      THEN("the caller's context is not cancelled") {
+        CHECK_FALSE(context->cancellationToken);
+      }
+    }
+
+    WHEN("resolve is called with the Exception policy") {
+      THEN("the first error is thrown after the manager returns") {
+        try {
+          manager->resolve(refs, {"trait"}, ResolveAccess::kRead, context,
+                           ErrorPolicyTag::kException);
+          FAIL("Expected BatchElementException");
+        } catch (const BatchElementException& exc) {
+          CHECK(exc.index == 1);
+        }
+        CHECK(fixture.processed == refs.size());
+        CHECK(fixture.lastContext == context);
+      }
+    }
+
+    WHEN("preflight and register are called with the Expected policy") {
+      auto preflightResult = manager->preflight(refs, traitsDatas, PublishingAccess::kWrite,
+                                                context, ErrorPolicyTag::kExpected);
+      const std::size_t preflightProcessed = fixture.processed;
+      auto registerResult = manager->register_(refs, traitsDatas, PublishingAccess::kWrite,
+                                               context, ErrorPolicyTag::kExpected);
+
+      THEN("the first error is returned and the manager is asked to stop") {
+        const auto* preflightError =
+            std::get_if<hostApi::Manager::IndexedBatchElementError>(&preflightResult);
+        REQUIRE(preflightError != nullptr);
+        CHECK(preflightError->first == 1);
+        CHECK(preflightProcessed == 2);
+
+        const auto* registerError =
+            std::get_if<hostApi::Manager::IndexedBatchElementError>(&registerResult);
+        REQUIRE(registerError != nullptr);
+        CHECK(registerError->first == 1);
+        CHECK(fixture.processed == 2);
+      }
+    }
+  }
+
+  GIVEN("a Manager and a batch without errors") {
+    FailFastFixture fixture;
+    const auto& manager = fixture.manager;
+    const auto& context = fixture.context;
+    const EntityReferences refs{EntityReference{"a"}, EntityReference{"b"}};
+
+    WHEN("resolve is called with the Expected policy") {
+      auto result = manager->resolve(refs, {"trait"}, ResolveAccess::kRead, context,
+                                     ErrorPolicyTag::kExpected);
+
+      THEN("all results are returned") {
+        const auto* datas = std::get_if<std::vector<trait::TraitsDataPtr>>(&result);
+        REQUIRE(datas != nullptr);
+        CHECK(datas->size() == 2);
+        CHECK((*datas)[0] != nullptr);
+        CHECK((*datas)[1] != nullptr);
+      }
+    }
+  }
+
+  GIVEN("a Manager and a context with a cancelled token") {
+    FailFastFixture fixture;
+    const auto& manager = fixture.manager;
+    const auto& context = fixture.context;
+    context->cancellationToken = CancellationToken::make();
+    context->cancellationToken->cancel();
+
+    WHEN("resolve is called with the Expected policy") {
+      auto result = manager->resolve({EntityReference{"a"}}, {"trait"}, ResolveAccess::kRead,
+                                     context, ErrorPolicyTag::kExpected);
+
+      THEN("the manager sees the caller's cancellation") {
+        CHECK(fixture.processed == 0);
+        CHECK(std::holds_alternative<hostApi::Manager::IndexedBatchElementError>(result));
+      }
+    }
+  }
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::MockLoggerInterface;
+using openassetio::testSupport::MockManagerInterface;
+using openassetio::testSupport::MockSchedulingHostInterface;
+using trompeloeil::_;
+
+/// Run a parallel loop inline, as a host's scheduler might.
+void parallelForInline(const std::size_t count,
+                       const hostApi::HostInterface::ParallelForBody& body) {
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    body(idx);
+  }
+}
+
+/// Resolve every entity to empty data.
+void resolveToEmpty(const EntityReferences& entityReferences,
+                    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, trait::TraitsData::make());
+  }
+}
+
+EntityReferences makeEntityReferences(const std::size_t count) {
+  EntityReferences refs;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    refs.emplace_back("stub://" + std::to_string(idx));
+  }
+  return refs;
+}
+}  // namespace
+
+SCENARIO("Manager work is scheduled on the host's scheduler") {
+  GIVEN("a Manager for a host with its own scheduler, configured to resolve in parallel") {
+    const auto hostInterface = std::make_shared<MockSchedulingHostInterface>();
+    const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+    hostApi::Manager::Options options;
+    options.resolveChunkSize = 2;
+    const auto manager = hostApi::Manager::make(
+        mockManagerInterface,
+        managerApi::HostSession::make(managerApi::Host::make(hostInterface),
+                                      std::make_shared<MockLoggerInterface>()),
+        options);
+    initializeManager(*manager, *mockManagerInterface,
+                      {{Str{openassetio::constants::kInfoKey_IsThreadSafe}, true}});
+    const EntityReferences refs = makeEntityReferences(5);
+
+    ALLOW_CALL(*mockManagerInterface, resolve(_, _, ResolveAccess::kRead, _, _, _, _))
+        .SIDE_EFFECT(resolveToEmpty(_1, _6));
+
+    WHEN("a batch larger than the chunk size is resolved") {
+      REQUIRE_CALL(*hostInterface, parallelFor(_, _)).SIDE_EFFECT(parallelForInline(_1, _2));
+
+      std::size_t successCount = 0;
+      manager->resolve(
+          refs, {}, ResolveAccess::kRead, manager->createContext(),
+          [&](std::size_t, const trait::TraitsDataPtr&) { ++successCount; },
+          [](std::size_t, const BatchElementError&) { FAIL(); });
+
+      THEN("the chunks are dispatched via the host's parallel loop") {
+        CHECK(successCount == refs.size());
+      }
+    }
+
+    WHEN("a batch is resolved asynchronously by a plugin with no native async support") {
+      REQUIRE_CALL(*hostInterface, submit(_)).SIDE_EFFECT(_1());
+
+      std::size_t successCount = 0;
+      std::promise<void> done;
+      manager->resolveAsync(
+          refs, {}, ResolveAccess::kRead, manager->createContext(),
+          [&](std::size_t, const trait::TraitsDataPtr&) { ++successCount; },
+          [](std::size_t, const BatchElementError&) {},
+          [&](const std::exception_ptr&) { done.set_value(); });
+      done.get_future().get();
+
+      THEN("the work is submitted to the host's scheduler") {
+        CHECK(successCount == refs.size());
+      }
+    }
+  }
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::InfoDictionary;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using trompeloeil::_;
+
+/**
+ * Mock manager whose initialize blocks until released, before
+ * forwarding to the mock.
+ *
+ * Trompeloeil holds a lock whilst handling a call, so blocking in a
+ * side effect would also block any concurrent queries.
+ */
+struct MockSlowManagerInterface : openassetio::testSupport::MockManagerInterface {
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override {
+    release.wait();
+    MockManagerInterface::initialize(std::move(managerSettings), hostSession);
+  }
+
+  std::shared_future<void> release;
+};
+
+constexpr std::chrono::milliseconds kShortWait{10};
+}  // namespace
+
+SCENARIO("Initializing a Manager asynchronously") {
+  const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+
+  GIVEN("a manager whose initialization blocks until released") {
+    const auto managerInterface = std::make_shared<MockSlowManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    std::promise<void> release;
+    managerInterface->release = release.get_future().share();
+    // Info reports whether initialize has completed.
+    std::atomic<bool> isInitialized{false};
+    ALLOW_CALL(mockManagerInterface, info())
+        .LR_RETURN(InfoDictionary{{"initialized", isInitialized.load()}});
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+    const hostApi::ManagerPtr manager = hostApi::Manager::make(managerInterface, hostSession);
+
+    WHEN("the manager is initialized asynchronously") {
+      REQUIRE_CALL(mockManagerInterface, initialize(_, hostSession))
+          .LR_SIDE_EFFECT(isInitialized = true);
+      const std::shared_future<void> initialization = manager->initializeAsync({});
+
+      THEN("control returns before initialization is complete") {
+        REQUIRE_CALL(mockManagerInterface, identifier()).RETURN("org.openassetio.test.manager");
+
+        CHECK(initialization.wait_for(kShortWait) == std::future_status::timeout);
+        CHECK(manager->identifier() == "org.openassetio.test.manager");
+        release.set_value();
+        initialization.wait();
+      }
+
+      AND_WHEN("the manager is queried before initialization is complete") {
+        std::future<InfoDictionary> info =
+            std::async(std::launch::async, [&] { return manager->info(); });
+
+        THEN("the query waits for initialization to complete") {
+          CHECK(info.wait_for(kShortWait) == std::future_status::timeout);
+          release.set_value();
+          CHECK(std::get<bool>(info.get().at("initialized")));
+          CHECK_NOTHROW(initialization.get());
+          CHECK_NOTHROW(manager->waitForInitialization());
+        }
+      }
+    }
+
+    WHEN("asynchronous initialization fails") {
+      REQUIRE_CALL(mockManagerInterface, initialize(_, hostSession))
+          .THROW(std::runtime_error{"backend unavailable"});
+      const std::shared_future<void> initialization = manager->initializeAsync({});
+      release.set_value();
+      initialization.wait();
+
+      THEN("the error is reported via the future and on waiting") {
+        CHECK_THROWS_AS(initialization.get(), std::runtime_error);
+        CHECK_THROWS_AS(manager->waitForInitialization(), std::runtime_error);
+      }
+
+      THEN("subsequent queries re-throw the error, without reaching the manager") {
+        const auto resolve = [&] {
+          manager->resolve(
+              {EntityReference{"ref"}}, {"trait"}, ResolveAccess::kRead, Context::make(),
+              [](std::size_t, const trait::TraitsDataPtr&) {},
+              [](std::size_t, const BatchElementError&) {});
+        };
+        CHECK_THROWS_AS(resolve(), std::runtime_error);
+        CHECK_THROWS_AS(resolve(), std::runtime_error);
+        CHECK_THROWS_AS(manager->info(), std::runtime_error);
+      }
+
+      AND_WHEN("the manager is then initialized successfully") {
+        REQUIRE_CALL(mockManagerInterface, initialize(_, hostSession))
+            .LR_SIDE_EFFECT(isInitialized = true);
+        manager->initialize({});
+
+        THEN("the error is no longer reported") {
+          CHECK(std::get<bool>(manager->info().at("initialized")));
+        }
+      }
+    }
+
+    WHEN("the manager is released before initialization is complete") {
+      REQUIRE_CALL(mockManagerInterface, initialize(_, hostSession))
+          .LR_SIDE_EFFECT(isInitialized = true);
+      std::shared_future<void> initialization =
+          hostApi::Manager::make(managerInterface, hostSession)->initializeAsync({});
+      release.set_value();
+
+      THEN("initialization still completes") {
+        CHECK_NOTHROW(initialization.get());
+        CHECK(isInitialized);
+      }
+    }
+  }
+
+  GIVEN("a manager that has not been initialized asynchronously") {
+    const hostApi::ManagerPtr manager =
+        hostApi::Manager::make(std::make_shared<MockSlowManagerInterface>(), hostSession);
+
+    THEN("waiting for initialization is a no-op") {
+      CHECK_NOTHROW(manager->waitForInitialization());
+    }
+  }
+}
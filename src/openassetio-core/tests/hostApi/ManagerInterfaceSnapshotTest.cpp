@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+using openassetio::InfoDictionary;
+using openassetio::Int;
+using Capability = openassetio::managerApi::ManagerInterface::Capability;
+using trompeloeil::_;
+}  // namespace
+
+SCENARIO("Serving manager capabilities and info from a snapshot") {
+  GIVEN("an uninitialized manager") {
+    const openassetio::testSupport::ManagerFixture fixture;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const hostApi::ManagerPtr& manager = fixture.manager;
+
+    WHEN("capabilities and info are queried") {
+      THEN("the manager plugin is queried") {
+        REQUIRE_CALL(mockManagerInterface, hasCapability(Capability::kResolution)).RETURN(true);
+        REQUIRE_CALL(mockManagerInterface, info()).RETURN(InfoDictionary{{"version", Int{1}}});
+
+        CHECK(manager->hasCapability(hostApi::Manager::Capability::kResolution));
+        CHECK(manager->info().size() == 1);
+      }
+    }
+
+    AND_GIVEN("the manager is initialized, supporting all but publishing and stateful contexts") {
+      ALLOW_CALL(mockManagerInterface, hasCapability(_))
+          .RETURN(_1 != Capability::kPublishing && _1 != Capability::kStatefulContexts);
+      {
+        REQUIRE_CALL(mockManagerInterface, initialize(_, fixture.hostSession));
+        REQUIRE_CALL(mockManagerInterface, info()).RETURN(InfoDictionary{{"version", Int{1}}});
+        manager->initialize({});
+      }
+
+      WHEN("capabilities and info are queried repeatedly") {
+        THEN("results are served without querying the manager plugin") {
+          FORBID_CALL(mockManagerInterface, hasCapability(_));
+          FORBID_CALL(mockManagerInterface, info());
+
+          CHECK(manager->hasCapability(hostApi::Manager::Capability::kResolution));
+          CHECK_FALSE(manager->hasCapability(hostApi::Manager::Capability::kPublishing));
+          CHECK_FALSE(manager->hasCapability(hostApi::Manager::Capability::kStatefulContexts));
+          manager->createContext();
+          CHECK(std::get<Int>(manager->info().at("version")) == 1);
+          CHECK(std::get<Int>(manager->info().at("version")) == 1);
+        }
+      }
+
+      WHEN("caches are flushed") {
+        {
+          REQUIRE_CALL(mockManagerInterface, flushCaches(fixture.hostSession));
+          REQUIRE_CALL(mockManagerInterface, info()).RETURN(InfoDictionary{{"version", Int{2}}});
+          manager->flushCaches();
+        }
+
+        THEN("the snapshot is refreshed") {
+          CHECK(std::get<Int>(manager->info().at("version")) == 2);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::errors::BatchElementError;
+using openassetio::access::EntityTraitsAccess;
+using openassetio::access::ResolveAccess;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::ManagerFixture;
+using trompeloeil::_;
+
+/// Report entities as existing, erroring for references beginning "missing".
+void existsUnlessMissing(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ExistsSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref.rfind("missing", 0) == 0) {
+      errorCallback(idx,
+                    BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError, ref});
+    } else {
+      successCallback(idx, true);
+    }
+  }
+}
+
+/// Report each entity as having a single trait named after its reference.
+void traitsFromReferences(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::EntityTraitsSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, {entityReferences[idx].toString()});
+  }
+}
+
+/// Resolve each entity to a single trait named after its reference.
+void resolveFromReferences(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const auto data = trait::TraitsData::make();
+    data->addTrait(entityReferences[idx].toString());
+    successCallback(idx, data);
+  }
+}
+
+EntityReferences makeEntityReferences(const std::size_t count) {
+  EntityReferences refs;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    refs.emplace_back((idx == 5 ? "missing" : "ref") + std::to_string(idx));
+  }
+  return refs;
+}
+}  // namespace
+
+SCENARIO("Splitting batches according to the manager's maximum batch size") {
+  const EntityReferences refs = makeEntityReferences(7);
+
+  GIVEN("a Manager whose plugin declares a maximum batch size") {
+    const ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    const auto& context = fixture.context;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    initializeManager(*manager, mockManagerInterface,
+                      {{Str{openassetio::constants::kInfoKey_MaxBatchSize}, Int{3}}});
+
+    // Size of each batch the manager plugin is given.
+    std::vector<std::size_t> batchSizes;
+
+    WHEN("entityExists is called with a larger batch") {
+      ALLOW_CALL(mockManagerInterface, entityExists(_, context, fixture.hostSession, _, _))
+          .LR_SIDE_EFFECT(batchSizes.push_back(_1.size()))
+          .SIDE_EFFECT(existsUnlessMissing(_1, _4, _5));
+
+      std::vector<bool> exists(refs.size(), false);
+      std::vector<std::size_t> errorIndices;
+      manager->entityExists(
+          refs, context, [&](const std::size_t idx, const bool value) { exists[idx] = value; },
+          [&](const std::size_t idx, const BatchElementError&) { errorIndices.push_back(idx); });
+
+      THEN("the batch is split into chunks of at most that size") {
+        CHECK(batchSizes == std::vector<std::size_t>{3, 3, 1});
+      }
+
+      THEN("results are reported against the original indices") {
+        CHECK(exists == std::vector<bool>{true, true, true, true, true, false, true});
+        CHECK(errorIndices == std::vector<std::size_t>{5});
+      }
+    }
+
+    WHEN("entityTraits is called with a larger batch") {
+      ALLOW_CALL(mockManagerInterface, entityTraits(_, EntityTraitsAccess::kRead, context,
+                                                    fixture.hostSession, _, _))
+          .LR_SIDE_EFFECT(batchSizes.push_back(_1.size()))
+          .SIDE_EFFECT(traitsFromReferences(_1, _5));
+
+      std::vector<trait::TraitSet> traitSets(refs.size());
+      manager->entityTraits(
+          refs, EntityTraitsAccess::kRead, context,
+          [&](const std::size_t idx, trait::TraitSet traitSet) {
+            traitSets[idx] = std::move(traitSet);
+          },
+          [](std::size_t, const BatchElementError&) {});
+
+      THEN("the batch is split and results are reported against the original indices") {
+        CHECK(batchSizes == std::vector<std::size_t>{3, 3, 1});
+        for (std::size_t idx = 0; idx < refs.size(); ++idx) {
+          CHECK(traitSets[idx] == trait::TraitSet{refs[idx].toString()});
+        }
+      }
+    }
+
+    WHEN("resolve is called with a larger batch") {
+      ALLOW_CALL(mockManagerInterface,
+                 resolve(_, _, ResolveAccess::kRead, context, fixture.hostSession, _, _))
+          .LR_SIDE_EFFECT(batchSizes.push_back(_1.size()))
+          .SIDE_EFFECT(resolveFromReferences(_1, _6));
+
+      std::vector<trait::TraitsDataPtr> datas(refs.size());
+      manager->resolve(
+          refs, {}, ResolveAccess::kRead, context,
+          [&](const std::size_t idx, trait::TraitsDataPtr data) { datas[idx] = std::move(data); },
+          [](std::size_t, const BatchElementError&) {});
+
+      THEN("the batch is split and results are reported against the original indices") {
+        CHECK(batchSizes == std::vector<std::size_t>{3, 3, 1});
+        for (std::size_t idx = 0; idx < refs.size(); ++idx) {
+          CHECK(datas[idx]->hasTrait(refs[idx].toString()));
+        }
+      }
+    }
+  }
+
+  GIVEN("a Manager whose plugin does not declare a maximum batch size") {
+    const ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    initializeManager(*manager, fixture.mockManagerInterface);
+
+    WHEN("entityExists is called") {
+      std::vector<std::size_t> batchSizes;
+      ALLOW_CALL(fixture.mockManagerInterface,
+                 entityExists(_, fixture.context, fixture.hostSession, _, _))
+          .LR_SIDE_EFFECT(batchSizes.push_back(_1.size()))
+          .SIDE_EFFECT(existsUnlessMissing(_1, _4, _5));
+
+      manager->entityExists(
+          refs, fixture.context, [](std::size_t, bool) {},
+          [](std::size_t, const BatchElementError&) {});
+
+      THEN("the batch is not split") {
+        CHECK(batchSizes == std::vector<std::size_t>{refs.size()});
+      }
+    }
+  }
+}
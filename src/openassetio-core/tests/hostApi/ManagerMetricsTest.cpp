@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ManagerMetrics.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::errors::BatchElementError;
+using openassetio::errors::InputValidationException;
+using openassetio::hostApi::ManagerMetrics;
+using Method = ManagerMetrics::Method;
+using ErrorCode = BatchElementError::ErrorCode;
+
+ManagerMetrics::ErrorCounts errorCounts(const ErrorCode code, const std::uint64_t count) {
+  ManagerMetrics::ErrorCounts counts{};
+  counts[ManagerMetrics::errorCodeIndex(code)] = count;
+  return counts;
+}
+}  // namespace
+
+SCENARIO("Constructing ManagerMetrics") {
+  GIVEN("a zero shard count") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(ManagerMetrics::make(0), InputValidationException,
+                           Catch::Message("ManagerMetrics shard count must be non-zero"));
+    }
+  }
+
+  GIVEN("a newly constructed registry") {
+    const auto metrics = ManagerMetrics::make();
+
+    THEN("all counters are zero") {
+      const ManagerMetrics::Snapshot snapshot = metrics->snapshot();
+      for (const ManagerMetrics::MethodStatistics& statistics : snapshot.methods) {
+        CHECK(statistics.calls == 0);
+        CHECK(statistics.exceptions == 0);
+        CHECK(statistics.successes == 0);
+        CHECK(statistics.errors == ManagerMetrics::ErrorCounts{});
+        CHECK(statistics.totalLatency == std::chrono::nanoseconds{0});
+      }
+    }
+  }
+}
+
+SCENARIO("Indexing error codes") {
+  THEN("known codes have distinct indices") {
+    CHECK(ManagerMetrics::errorCodeIndex(ErrorCode::kUnknown) == 0);
+    CHECK(ManagerMetrics::errorCodeIndex(ErrorCode::kEntityResolutionError) == 4);
+    CHECK(ManagerMetrics::errorCodeIndex(ErrorCode::kCancelled) ==
+          ManagerMetrics::kErrorCodeCount - 1);
+  }
+
+  THEN("unknown codes are attributed to kUnknown") {
+    CHECK(ManagerMetrics::errorCodeIndex(static_cast<ErrorCode>(-1)) == 0);
+    CHECK(ManagerMetrics::errorCodeIndex(static_cast<ErrorCode>(
+              static_cast<int>(ErrorCode::kCancelled) + 1)) == 0);
+  }
+}
+
+SCENARIO("Indexing batch sizes") {
+  THEN("batch sizes are counted in buckets bounded above by powers of four") {
+    CHECK(ManagerMetrics::batchSizeBucketIndex(0) == 0);
+    CHECK(ManagerMetrics::batchSizeBucketIndex(1) == 0);
+    CHECK(ManagerMetrics::batchSizeBucketIndex(2) == 1);
+    CHECK(ManagerMetrics::batchSizeBucketIndex(4) == 1);
+    CHECK(ManagerMetrics::batchSizeBucketIndex(5) == 2);
+    CHECK(ManagerMetrics::batchSizeBucketIndex(4096) == 6);
+    CHECK(ManagerMetrics::batchSizeBucketIndex(4097) == ManagerMetrics::kBatchSizeBucketCount);
+  }
+}
+
+SCENARIO("Estimating latency quantiles") {
+  GIVEN("a latency histogram") {
+    ManagerMetrics::LatencyBuckets buckets{};
+    buckets[0] = 90;
+    buckets[3] = 9;
+    buckets[ManagerMetrics::kLatencyBucketCount] = 1;
+
+    THEN("quantiles are estimated as the upper bound of their bucket") {
+      CHECK(ManagerMetrics::latencyQuantile(buckets, 0.0) == std::chrono::microseconds{1});
+      CHECK(ManagerMetrics::latencyQuantile(buckets, 0.5) == std::chrono::microseconds{1});
+      CHECK(ManagerMetrics::latencyQuantile(buckets, 0.9) == std::chrono::microseconds{1});
+      CHECK(ManagerMetrics::latencyQuantile(buckets, 0.91) == std::chrono::microseconds{8});
+      CHECK(ManagerMetrics::latencyQuantile(buckets, 0.99) == std::chrono::microseconds{8});
+      CHECK(ManagerMetrics::latencyQuantile(buckets, 1.0) ==
+            ManagerMetrics::latencyBucketUpperBound(ManagerMetrics::kLatencyBucketCount - 1));
+    }
+
+    THEN("out of range quantiles are rejected") {
+      CHECK_THROWS_AS(ManagerMetrics::latencyQuantile(buckets, -0.1), InputValidationException);
+      CHECK_THROWS_AS(ManagerMetrics::latencyQuantile(buckets, 1.1), InputValidationException);
+    }
+  }
+
+  GIVEN("an empty latency histogram") {
+    THEN("all quantiles are zero") {
+      CHECK(ManagerMetrics::latencyQuantile({}, 0.5) == std::chrono::nanoseconds{0});
+    }
+  }
+}
+
+SCENARIO("Recording Manager calls") {
+  GIVEN("a registry") {
+    const auto metrics = ManagerMetrics::make();
+
+    WHEN("calls are recorded") {
+      metrics->record(Method::kResolve, std::chrono::microseconds{1}, 3,
+                      errorCounts(ErrorCode::kEntityResolutionError, 2), false);
+      metrics->record(Method::kResolve, std::chrono::microseconds{3}, 1, {}, true);
+      metrics->record(Method::kResolve, std::chrono::seconds{60}, 0, {}, false);
+
+      THEN("the snapshot aggregates the calls of the method") {
+        const ManagerMetrics::Snapshot snapshot = metrics->snapshot();
+        const ManagerMetrics::MethodStatistics& statistics = snapshot.at(Method::kResolve);
+        CHECK(statistics.calls == 3);
+        CHECK(statistics.exceptions == 1);
+        CHECK(statistics.successes == 4);
+        CHECK(statistics.errors == errorCounts(ErrorCode::kEntityResolutionError, 2));
+        CHECK(statistics.totalLatency == std::chrono::seconds{60} + std::chrono::microseconds{4});
+      }
+
+      THEN("latencies are counted in buckets bounded above by powers of two microseconds") {
+        const ManagerMetrics::Snapshot snapshot = metrics->snapshot();
+        const auto& buckets = snapshot.at(Method::kResolve).latencyBuckets;
+        CHECK(buckets[0] == 1);
+        CHECK(buckets[1] == 0);
+        CHECK(buckets[2] == 1);
+        CHECK(buckets[ManagerMetrics::kLatencyBucketCount] == 1);
+      }
+
+      THEN("other methods are unaffected") {
+        CHECK(metrics->snapshot().at(Method::kPreflight).calls == 0);
+      }
+    }
+
+    WHEN("calls with different batch sizes are recorded") {
+      metrics->record(Method::kResolve, std::chrono::microseconds{1}, 1, {}, false, 1);
+      metrics->record(Method::kResolve, std::chrono::microseconds{3}, 3, {}, false, 3);
+      metrics->record(Method::kResolve, std::chrono::microseconds{30}, 4, {}, false, 4);
+
+      THEN("durations are broken down by batch size") {
+        const ManagerMetrics::Snapshot snapshot = metrics->snapshot();
+        const ManagerMetrics::MethodStatistics& statistics = snapshot.at(Method::kResolve);
+        CHECK(statistics.calls == 3);
+
+        const ManagerMetrics::BatchSizeStatistics& single = statistics.batchSizes[0];
+        CHECK(single.calls == 1);
+        CHECK(single.latencyBuckets[0] == 1);
+        CHECK(single.totalLatency == std::chrono::microseconds{1});
+
+        const ManagerMetrics::BatchSizeStatistics& small = statistics.batchSizes[1];
+        CHECK(small.calls == 2);
+        CHECK(small.latencyBuckets[2] == 1);
+        CHECK(small.latencyBuckets[5] == 1);
+        CHECK(small.totalLatency == std::chrono::microseconds{33});
+
+        CHECK(statistics.batchSizes[2].calls == 0);
+      }
+    }
+
+    WHEN("calls are recorded between two snapshots") {
+      metrics->record(Method::kResolve, std::chrono::microseconds{1}, 1, {}, false, 1);
+      const ManagerMetrics::Snapshot earlier = metrics->snapshot();
+      metrics->record(Method::kResolve, std::chrono::microseconds{3}, 2,
+                      errorCounts(ErrorCode::kEntityAccessError, 1), true, 3);
+      const ManagerMetrics::Snapshot later = metrics->snapshot();
+
+      THEN("the interval between the snapshots holds only the later calls") {
+        const ManagerMetrics::Snapshot interval = later.since(earlier);
+        const ManagerMetrics::MethodStatistics& statistics = interval.at(Method::kResolve);
+        CHECK(statistics.calls == 1);
+        CHECK(statistics.exceptions == 1);
+        CHECK(statistics.successes == 2);
+        CHECK(statistics.errors == errorCounts(ErrorCode::kEntityAccessError, 1));
+        CHECK(statistics.latencyBuckets[0] == 0);
+        CHECK(statistics.latencyBuckets[2] == 1);
+        CHECK(statistics.totalLatency == std::chrono::microseconds{3});
+        CHECK(statistics.batchSizes[0].calls == 0);
+        CHECK(statistics.batchSizes[1].calls == 1);
+      }
+    }
+
+    WHEN("calls are recorded from multiple threads") {
+      constexpr std::size_t kThreadCount = 8;
+      constexpr std::size_t kCallsPerThread = 1000;
+
+      std::vector<std::thread> threads;
+      threads.reserve(kThreadCount);
+      for (std::size_t threadIdx = 0; threadIdx < kThreadCount; ++threadIdx) {
+        threads.emplace_back([&metrics] {
+          for (std::size_t callIdx = 0; callIdx < kCallsPerThread; ++callIdx) {
+            metrics->record(Method::kEntityExists, std::chrono::microseconds{1}, 2, {}, false);
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      THEN("no calls are lost") {
+        const ManagerMetrics::Snapshot snapshot = metrics->snapshot();
+        const ManagerMetrics::MethodStatistics& statistics = snapshot.at(Method::kEntityExists);
+        CHECK(statistics.calls == kThreadCount * kCallsPerThread);
+        CHECK(statistics.successes == 2 * kThreadCount * kCallsPerThread);
+      }
+    }
+  }
+}
+
+SCENARIO("Exporting ManagerMetrics as Prometheus text") {
+  GIVEN("a registry with a recorded call") {
+    const auto metrics = ManagerMetrics::make();
+    metrics->record(Method::kResolve, std::chrono::microseconds{3}, 2,
+                    errorCounts(ErrorCode::kEntityAccessError, 1), false);
+
+    WHEN("the snapshot is exported") {
+      const Str text = ManagerMetrics::toPrometheusText(metrics->snapshot(), R"(my"manager)");
+      const Str labels = R"(manager="my\"manager",method="resolve")";
+
+      THEN("counters are exported with escaped labels") {
+        CHECK_THAT(text, Catch::Contains("# TYPE openassetio_manager_calls_total counter\n"
+                                         "openassetio_manager_calls_total{" +
+                                         labels + "} 1\n"));
+        CHECK_THAT(text, Catch::Contains("openassetio_manager_elements_total{" + labels +
+                                         R"(,outcome="success"} 2)"));
+        CHECK_THAT(text, Catch::Contains("openassetio_manager_elements_total{" + labels +
+                                         R"(,outcome="entityAccessError"} 1)"));
+      }
+
+      THEN("durations are exported as a cumulative histogram in seconds") {
+        const Str histogram = "openassetio_manager_call_duration_seconds";
+        CHECK_THAT(text, Catch::Contains(histogram + "_bucket{" + labels + R"(,le="2e-06"} 0)"));
+        CHECK_THAT(text, Catch::Contains(histogram + "_bucket{" + labels + R"(,le="4e-06"} 1)"));
+        CHECK_THAT(text, Catch::Contains(histogram + "_bucket{" + labels + R"(,le="+Inf"} 1)"));
+        CHECK_THAT(text, Catch::Contains(histogram + "_count{" + labels + "} 1"));
+      }
+
+      THEN("methods that have not been called are omitted") {
+        CHECK_THAT(text, !Catch::Contains(R"(method="preflight")"));
+      }
+    }
+  }
+}
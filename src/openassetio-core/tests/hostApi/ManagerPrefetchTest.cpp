@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/**
+ * Mock manager whose resolve, given a batch containing "block",
+ * signals `entered`, then waits for `unblock` before forwarding to the
+ * mock.
+ *
+ * Blocking happens before the mock is called, since trompeloeil
+ * serialises calls to mocks.
+ */
+struct MockBlockingManagerInterface : MockManagerInterface {
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               const ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    if (std::find(entityReferences.begin(), entityReferences.end(), EntityReference{"block"}) !=
+        entityReferences.end()) {
+      entered.set_value();
+      unblock.wait();
+    }
+    MockManagerInterface::resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                                  successCallback, errorCallback);
+  }
+
+  std::promise<void> entered;
+  std::shared_future<void> unblock;
+};
+
+/**
+ * Resolve each entity to a TraitsData with a trait named after the
+ * entity reference. A batch containing "fail" fails with an exception.
+ */
+void resolveToReferenceTrait(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "fail") {
+      throw std::runtime_error{"failed"};
+    }
+    successCallback(idx, trait::TraitsData::make({ref}));
+  }
+}
+
+hostApi::ManagerPtr makeManager(const std::shared_ptr<MockManagerInterface>& mockManagerInterface,
+                                hostApi::ResolveCachePtr resolveCache) {
+  hostApi::Manager::Options options;
+  options.resolveCache = std::move(resolveCache);
+  auto manager = hostApi::Manager::make(mockManagerInterface, makeMockHostSession(), options);
+  initializeManager(*manager, *mockManagerInterface);
+  return manager;
+}
+
+trait::TraitsDataPtr resolve(const hostApi::ManagerPtr& manager, const Str& ref,
+                             const ContextConstPtr& context) {
+  return manager->resolve(EntityReference{ref}, {"t"}, ResolveAccess::kRead, context);
+}
+}  // namespace
+
+SCENARIO("Prefetching resolves into the resolve cache") {
+  GIVEN("a manager with a resolve cache") {
+    const auto mockManagerInterface = std::make_shared<MockBlockingManagerInterface>();
+    const auto manager = makeManager(mockManagerInterface, hostApi::ResolveCache::make(16));
+    const auto context = manager->createContext();
+
+    // Number of entities resolved by the manager plugin.
+    std::atomic<std::size_t> resolveCount{0};
+    ALLOW_CALL(*mockManagerInterface, resolve(_, _, ResolveAccess::kRead, _, _, _, _))
+        .SIDE_EFFECT(resolveToReferenceTrait(_1, _6))
+        .LR_SIDE_EFFECT(resolveCount += _1.size());
+
+    WHEN("entities are prefetched") {
+      manager->prefetch({EntityReference{"a"}, EntityReference{"b"}}, {"t"}, context).get();
+
+      THEN("subsequent resolves are served from the cache") {
+        CHECK(resolveCount == 2);
+        CHECK(resolve(manager, "a", context)->traitSet() == trait::TraitSet{"a"});
+        CHECK(resolve(manager, "b", context)->traitSet() == trait::TraitSet{"b"});
+        CHECK(resolveCount == 2);
+      }
+    }
+
+    WHEN("an entity is resolved whilst its prefetch is in flight") {
+      std::promise<void> unblock;
+      mockManagerInterface->unblock = unblock.get_future().share();
+
+      auto prefetched = manager->prefetch({EntityReference{"block"}}, {"t"}, context);
+      mockManagerInterface->entered.get_future().wait();
+      auto resolved =
+          std::async(std::launch::async, [&] { return resolve(manager, "block", context); });
+
+      THEN("the resolve waits for, and is given, the prefetched result") {
+        CHECK(resolved.wait_for(std::chrono::milliseconds{50}) == std::future_status::timeout);
+
+        unblock.set_value();
+        prefetched.get();
+        CHECK(resolved.get()->traitSet() == trait::TraitSet{"block"});
+        CHECK(resolveCount == 1);
+      }
+    }
+
+    WHEN("a prefetch fails with an exception") {
+      auto prefetched = manager->prefetch({EntityReference{"fail"}}, {"t"}, context);
+
+      THEN("the exception is held by the future") {
+        CHECK_THROWS_AS(prefetched.get(), std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN("a manager without a resolve cache") {
+    const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+    const auto manager = makeManager(mockManagerInterface, nullptr);
+
+    WHEN("entities are prefetched") {
+      THEN("the manager plugin is not queried") {
+        FORBID_CALL(*mockManagerInterface, resolve(_, _, _, _, _, _, _));
+
+        manager->prefetch({EntityReference{"a"}}, {"t"}, manager->createContext()).get();
+      }
+    }
+  }
+}
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::ContextConstPtr;
+using openassetio::ContextPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/**
+ * Mock manager whose resolve, given a batch containing "block",
+ * signals `entered`, then waits for `unblock` before forwarding to the
+ * mock.
+ *
+ * Blocking happens before the mock is called, since trompeloeil
+ * serialises calls to mocks.
+ */
+struct MockBlockingManagerInterface : MockManagerInterface {
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               const ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    if (std::find(entityReferences.begin(), entityReferences.end(), EntityReference{"block"}) !=
+        entityReferences.end()) {
+      entered.set_value();
+      unblock.wait();
+    }
+    MockManagerInterface::resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                                  successCallback, errorCallback);
+  }
+
+  std::promise<void> entered;
+  std::shared_future<void> unblock;
+};
+
+/// Resolve every entity to empty data.
+void resolveToEmpty(const EntityReferences& entityReferences,
+                    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, trait::TraitsData::make());
+  }
+}
+
+/**
+ * Fixture providing an initialized Manager with the given background
+ * chunk size, whose mock manager plugin records the size and priority
+ * of each resolve batch it is given.
+ */
+struct PriorityFixture {
+  explicit PriorityFixture(const std::size_t backgroundChunkSize)
+      : manager{hostApi::Manager::make(mockManagerInterface, makeMockHostSession(),
+                                       optionsWith(backgroundChunkSize))} {
+    initializeManager(*manager, *mockManagerInterface);
+    resolveExpectation =
+        NAMED_ALLOW_CALL(*mockManagerInterface, resolve(_, _, ResolveAccess::kRead, _, _, _, _))
+            .LR_SIDE_EFFECT(record(_1.size(), _4->priority))
+            .SIDE_EFFECT(resolveToEmpty(_1, _6));
+  }
+
+  void record(const std::size_t batchSize, const Context::Priority priority) {
+    const std::lock_guard lock{mutex};
+    batches.emplace_back(batchSize, priority);
+  }
+
+  std::size_t batchCount() {
+    const std::lock_guard lock{mutex};
+    return batches.size();
+  }
+
+  const std::shared_ptr<MockBlockingManagerInterface> mockManagerInterface =
+      std::make_shared<MockBlockingManagerInterface>();
+  const hostApi::ManagerPtr manager;
+  std::mutex mutex;
+  std::vector<std::pair<std::size_t, Context::Priority>> batches;
+
+ private:
+  static hostApi::Manager::Options optionsWith(const std::size_t backgroundChunkSize) {
+    hostApi::Manager::Options options;
+    options.backgroundChunkSize = backgroundChunkSize;
+    return options;
+  }
+
+  std::unique_ptr<trompeloeil::expectation> resolveExpectation;
+};
+
+void resolve(const hostApi::ManagerPtr& manager, const EntityReferences& entityReferences,
+             const ContextConstPtr& context,
+             const hostApi::Manager::ResolveSuccessCallback& successCallback =
+                 [](std::size_t, const trait::TraitsDataPtr&) {}) {
+  manager->resolve(entityReferences, {}, ResolveAccess::kRead, context, successCallback,
+                   [](std::size_t, const BatchElementError&) {});
+}
+
+const EntityReferences kFourRefs{EntityReference{"a"}, EntityReference{"b"},
+                                 EntityReference{"c"}, EntityReference{"d"}};
+}  // namespace
+
+SCENARIO("Context priority") {
+  GIVEN("a manager and a context created by it") {
+    PriorityFixture fixture{0};
+    const auto& manager = fixture.manager;
+    const ContextPtr context = manager->createContext();
+
+    THEN("the context is of normal priority") {
+      CHECK(context->priority == Context::Priority::kNormal);
+    }
+
+    WHEN("the context is given background priority") {
+      context->priority = Context::Priority::kBackground;
+
+      THEN("child contexts and snapshots inherit the priority") {
+        CHECK(manager->createChildContext(context)->priority == Context::Priority::kBackground);
+        CHECK(context->freeze()->priority == Context::Priority::kBackground);
+      }
+    }
+  }
+}
+
+SCENARIO("Scheduling Manager requests by priority") {
+  GIVEN("a manager that schedules requests, with a background chunk size of 2") {
+    PriorityFixture fixture{2};
+    const auto& manager = fixture.manager;
+    const ContextPtr context = manager->createContext();
+
+    WHEN("a background batch is resolved") {
+      context->priority = Context::Priority::kBackground;
+      resolve(manager, kFourRefs, context);
+
+      THEN("the batch is dispatched in chunks") {
+        using Batches = std::vector<std::pair<std::size_t, Context::Priority>>;
+        CHECK(fixture.batches == Batches{{2, Context::Priority::kBackground},
+                                                   {2, Context::Priority::kBackground}});
+      }
+    }
+
+    WHEN("an interactive batch is resolved") {
+      context->priority = Context::Priority::kInteractive;
+      resolve(manager, kFourRefs, context);
+
+      THEN("the batch is dispatched whole") {
+        REQUIRE(fixture.batches.size() == 1);
+        CHECK(fixture.batches[0].first == 4);
+      }
+    }
+
+    WHEN("a background batch is resolved whilst an interactive batch is in flight") {
+      std::promise<void> unblock;
+      fixture.mockManagerInterface->unblock = unblock.get_future().share();
+      const ContextPtr interactiveContext = manager->createContext();
+      interactiveContext->priority = Context::Priority::kInteractive;
+      context->priority = Context::Priority::kBackground;
+
+      std::thread interactiveThread{
+          [&] { resolve(manager, {EntityReference{"block"}}, interactiveContext); }};
+      fixture.mockManagerInterface->entered.get_future().wait();
+      auto background =
+          std::async(std::launch::async, [&] { resolve(manager, kFourRefs, context); });
+
+      THEN("the background batch waits until the interactive batch completes") {
+        CHECK(background.wait_for(std::chrono::milliseconds{50}) ==
+              std::future_status::timeout);
+        // The interactive batch is blocked before reaching the mock.
+        CHECK(fixture.batchCount() == 0);
+
+        unblock.set_value();
+        interactiveThread.join();
+        background.get();
+        CHECK(fixture.batches.size() == 3);
+      }
+    }
+
+    WHEN("a background batch is resolved from within an interactive call's callback") {
+      const ContextPtr interactiveContext = manager->createContext();
+      interactiveContext->priority = Context::Priority::kInteractive;
+      context->priority = Context::Priority::kBackground;
+
+      resolve(manager, {EntityReference{"a"}}, interactiveContext,
+              [&](std::size_t, const trait::TraitsDataPtr&) {
+                resolve(manager, kFourRefs, context);
+              });
+
+      THEN("the nested batch is not blocked by its caller") {
+        CHECK(fixture.batches.size() == 3);
+      }
+    }
+  }
+
+  GIVEN("a manager that does not schedule requests") {
+    PriorityFixture fixture{0};
+    const auto& manager = fixture.manager;
+    const ContextPtr context = manager->createContext();
+    context->priority = Context::Priority::kBackground;
+
+    WHEN("a background batch is resolved") {
+      resolve(manager, kFourRefs, context);
+
+      THEN("the batch is dispatched whole") {
+        REQUIRE(fixture.batches.size() == 1);
+        CHECK(fixture.batches[0].first == 4);
+      }
+    }
+  }
+}
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/TraitsDataTable.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::InfoDictionary;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/**
+ * Resolve the "location" of a "content" trait to the entity reference,
+ * and its "size" to the length of the reference. Entities named
+ * "broken" fail.
+ */
+void resolveToContent(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "broken") {
+      errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kUnknown, ref});
+      continue;
+    }
+    const auto data = trait::TraitsData::make(traitSet);
+    data->setTraitProperty("content", "location", ref);
+    data->setTraitProperty("content", "size", static_cast<Int>(ref.size()));
+    successCallback(idx, data);
+  }
+}
+
+/// As resolveToContent, but writing results straight to the table.
+void resolveColumnarToContent(
+    const EntityReferences& entityReferences, trait::TraitsDataTable& results,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  const std::size_t locationColumn = results.addColumn<Str>("content", "location");
+  const std::size_t sizeColumn = results.addColumn<Int>("content", "size");
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "broken") {
+      errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kUnknown, ref});
+      continue;
+    }
+    results.setValue(idx, locationColumn, ref);
+    results.setValue(idx, sizeColumn, static_cast<Int>(ref.size()));
+  }
+}
+
+/// Mock manager that also mocks populating a table directly.
+struct MockColumnarManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK7(resolveColumnar);
+};
+
+/// Resolve entities into a table, returning the indices of errors.
+std::vector<std::size_t> resolveColumnar(const hostApi::ManagerPtr& manager,
+                                         const EntityReferences& entityReferences,
+                                         trait::TraitsDataTable& results) {
+  std::vector<std::size_t> errorIndices;
+  manager->resolveColumnar(
+      entityReferences, {"content"}, ResolveAccess::kRead, manager->createContext(), results,
+      [&](const std::size_t idx, const BatchElementError&) { errorIndices.push_back(idx); });
+  return errorIndices;
+}
+}  // namespace
+
+SCENARIO("Resolving into a columnar table") {
+  const EntityReferences refs{EntityReference{"a"}, EntityReference{"broken"},
+                              EntityReference{"ccc"}};
+
+  GIVEN("a Manager whose plugin populates the table directly, with a maximum batch size") {
+    const auto mockManagerInterface = std::make_shared<MockColumnarManagerInterface>();
+    const auto manager = hostApi::Manager::make(mockManagerInterface, makeMockHostSession());
+    initializeManager(
+        *manager, *mockManagerInterface,
+        InfoDictionary{{Str{openassetio::constants::kInfoKey_MaxBatchSize}, Int{2}}});
+
+    const trait::TraitSet traitSet{"content"};
+    std::vector<std::size_t> batchSizes;
+    ALLOW_CALL(*mockManagerInterface, resolveColumnar(_, traitSet, _, _, _, _, _))
+        .LR_SIDE_EFFECT(batchSizes.push_back(_1.size()))
+        .SIDE_EFFECT(resolveColumnarToContent(_1, _6, _7));
+
+    WHEN("entities are resolved into a table") {
+      trait::TraitsDataTable results;
+      const std::vector<std::size_t> errorIndices = resolveColumnar(manager, refs, results);
+
+      THEN("each row holds the properties of the corresponding entity") {
+        CHECK(batchSizes == std::vector<std::size_t>{2, 1});
+        CHECK(results.rowCount() == 3);
+        CHECK(results.traitSet() == trait::TraitSet{"content"});
+        const std::size_t sizeColumn = *results.findColumn("content", "size");
+        CHECK(results.values<Int>(sizeColumn)[0] == 1);
+        CHECK(results.values<Int>(sizeColumn)[2] == 3);
+        const std::size_t locationColumn = *results.findColumn("content", "location");
+        CHECK(results.values<Str>(locationColumn)[2] == "ccc");
+      }
+
+      THEN("failed entities are reported at their index, and their rows are left unset") {
+        CHECK(errorIndices == std::vector<std::size_t>{1});
+        CHECK_FALSE(results.isValid(1, *results.findColumn("content", "size")));
+        CHECK(*results.row(1) == *trait::TraitsData::make());
+      }
+
+      AND_WHEN("the table is reused for another batch") {
+        static_cast<void>(resolveColumnar(manager, {EntityReference{"dd"}}, results));
+
+        THEN("it holds only the new results") {
+          CHECK(results.rowCount() == 1);
+          CHECK(results.columnCount() == 2);
+          CHECK(results.values<Str>(*results.findColumn("content", "location"))[0] == "dd");
+        }
+      }
+    }
+
+    WHEN("entities are resolved into a table with a column of a different type") {
+      trait::TraitsDataTable results;
+      static_cast<void>(results.addColumn<Str>("content", "size"));
+      const std::vector<std::size_t> errorIndices = resolveColumnar(manager, refs, results);
+
+      THEN("the entities are reported as failed, and their rows are left empty") {
+        CHECK(errorIndices == std::vector<std::size_t>{1, 0, 2});
+        for (std::size_t row = 0; row < results.rowCount(); ++row) {
+          CHECK(*results.row(row) == *trait::TraitsData::make());
+        }
+      }
+    }
+  }
+
+  GIVEN("a Manager whose plugin does not populate the table directly") {
+    const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+    const auto manager = hostApi::Manager::make(mockManagerInterface, makeMockHostSession());
+    initializeManager(*manager, *mockManagerInterface);
+
+    ALLOW_CALL(*mockManagerInterface, resolve(_, trait::TraitSet{"content"}, _, _, _, _, _))
+        .SIDE_EFFECT(resolveToContent(_1, _2, _6, _7));
+
+    WHEN("entities are resolved into a table") {
+      trait::TraitsDataTable results;
+      const std::vector<std::size_t> errorIndices = resolveColumnar(manager, refs, results);
+
+      THEN("the rows of the table match the results of resolve") {
+        CHECK(errorIndices == std::vector<std::size_t>{1});
+        const trait::TraitsDataPtr expected = trait::TraitsData::make({"content"});
+        expected->setTraitProperty("content", "location", Str{"ccc"});
+        expected->setTraitProperty("content", "size", Int{3});
+        CHECK(*results.row(2) == *expected);
+        CHECK(*results.row(1) == *trait::TraitsData::make());
+      }
+    }
+
+    WHEN("entities are resolved into a table with a column of a different type") {
+      trait::TraitsDataTable results;
+      static_cast<void>(results.addColumn<Str>("content", "size"));
+      const std::vector<std::size_t> errorIndices = resolveColumnar(manager, refs, results);
+
+      THEN("the entities are reported as failed, and their rows are left empty") {
+        CHECK(errorIndices == std::vector<std::size_t>{0, 1, 2});
+        for (std::size_t row = 0; row < results.rowCount(); ++row) {
+          CHECK(*results.row(row) == *trait::TraitsData::make());
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/**
+ * Resolve each entity to the requested traits, plus a trait named
+ * after the entity reference.
+ */
+void resolveWithReferenceTrait(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const auto data = trait::TraitsData::make(traitSet);
+    data->addTrait(entityReferences[idx].toString());
+    successCallback(idx, data);
+  }
+}
+
+/**
+ * Fixture providing an initialized Manager whose mock manager plugin
+ * implements only resolve, recording the trait set of each batch it is
+ * given.
+ */
+struct HeterogeneousFixture {
+  explicit HeterogeneousFixture(hostApi::ResolveCachePtr resolveCache = nullptr)
+      : manager{hostApi::Manager::make(mockManagerInterface, makeMockHostSession(),
+                                       optionsWith(std::move(resolveCache)))} {
+    initializeManager(*manager, *mockManagerInterface);
+    resolveExpectation = NAMED_ALLOW_CALL(*mockManagerInterface,
+                                          resolve(_, _, ResolveAccess::kRead, _, _, _, _))
+                             .LR_SIDE_EFFECT(resolvedTraitSets.push_back(_2))
+                             .SIDE_EFFECT(resolveWithReferenceTrait(_1, _2, _6));
+  }
+
+  const std::shared_ptr<MockManagerInterface> mockManagerInterface =
+      std::make_shared<MockManagerInterface>();
+  const hostApi::ManagerPtr manager;
+  std::vector<trait::TraitSet> resolvedTraitSets;
+
+ private:
+  static hostApi::Manager::Options optionsWith(hostApi::ResolveCachePtr resolveCache) {
+    hostApi::Manager::Options options;
+    options.resolveCache = std::move(resolveCache);
+    return options;
+  }
+
+  std::unique_ptr<trompeloeil::expectation> resolveExpectation;
+};
+
+/// Resolve entities with per-entity trait sets, returning each result.
+trait::TraitsDatas resolveHeterogeneous(const hostApi::ManagerPtr& manager,
+                                        const EntityReferences& entityReferences,
+                                        const trait::TraitSets& traitSets,
+                                        const std::vector<std::size_t>& traitSetIndices) {
+  trait::TraitsDatas results(entityReferences.size());
+  manager->resolveHeterogeneous(
+      entityReferences, traitSets, traitSetIndices, ResolveAccess::kRead,
+      manager->createContext(),
+      [&](const std::size_t idx, trait::TraitsDataPtr data) { results[idx] = std::move(data); },
+      [](std::size_t, const BatchElementError&) { FAIL(); });
+  return results;
+}
+}  // namespace
+
+SCENARIO("Resolving entities with a trait set per entity") {
+  const EntityReferences refs{EntityReference{"img"}, EntityReference{"geo"},
+                              EntityReference{"img2"}};
+  const trait::TraitSets traitSets{{"image"}, {"geometry"}};
+  const std::vector<std::size_t> traitSetIndices{0, 1, 0};
+
+  GIVEN("a Manager whose plugin implements only resolve") {
+    HeterogeneousFixture fixture;
+    const auto& manager = fixture.manager;
+
+    WHEN("a heterogeneous batch is resolved") {
+      const trait::TraitsDatas results =
+          resolveHeterogeneous(manager, refs, traitSets, traitSetIndices);
+
+      THEN("each entity is resolved with its own trait set, in one call per trait set") {
+        CHECK(results[0]->traitSet() == trait::TraitSet{"image", "img"});
+        CHECK(results[1]->traitSet() == trait::TraitSet{"geometry", "geo"});
+        CHECK(results[2]->traitSet() == trait::TraitSet{"image", "img2"});
+        CHECK(fixture.resolvedTraitSets == traitSets);
+      }
+    }
+
+    THEN("mismatched or out of range indices are rejected") {
+      CHECK_THROWS_AS(resolveHeterogeneous(manager, refs, traitSets, {0, 1}),
+                      openassetio::errors::InputValidationException);
+      CHECK_THROWS_AS(resolveHeterogeneous(manager, refs, traitSets, {0, 1, 2}),
+                      openassetio::errors::InputValidationException);
+      CHECK(fixture.resolvedTraitSets.empty());
+    }
+  }
+
+  GIVEN("a Manager with a resolve cache") {
+    HeterogeneousFixture fixture{hostApi::ResolveCache::make(10)};
+    const auto& manager = fixture.manager;
+
+    AND_GIVEN("a heterogeneous batch has been resolved") {
+      resolveHeterogeneous(manager, refs, traitSets, traitSetIndices);
+      fixture.resolvedTraitSets.clear();
+
+      WHEN("the batch is resolved again, with an entity's trait set changed") {
+        const trait::TraitsDatas results =
+            resolveHeterogeneous(manager, refs, traitSets, {0, 1, 1});
+
+        THEN("only the changed entity is resolved, with cached results for the others") {
+          CHECK(fixture.resolvedTraitSets == trait::TraitSets{{"geometry"}});
+          CHECK(results[0]->traitSet() == trait::TraitSet{"image", "img"});
+          CHECK(results[2]->traitSet() == trait::TraitSet{"geometry", "img2"});
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/ConditionalResolveResult.hpp>
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::ConditionalResolveResult;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::ManagerFixture;
+using trompeloeil::_;
+
+/**
+ * Resolve each entity to a "version" property taken from `versions`,
+ * erroring for "missing".
+ */
+void resolveVersions(
+    const EntityReferences& entityReferences, const std::map<Str, Int>& versions,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "missing") {
+      errorCallback(idx,
+                    BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError, ref});
+      continue;
+    }
+    const auto data = trait::TraitsData::make();
+    data->setTraitProperty("stub", "version", versions.at(ref));
+    successCallback(idx, data);
+  }
+}
+
+/**
+ * Resolve each entity to the same traits and properties, added in
+ * ascending order for "forward" and descending order otherwise.
+ */
+void resolveInInsertionOrder(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  std::vector<Str> traitIds;
+  for (Int traitIdx = 0; traitIdx < 16; ++traitIdx) {
+    traitIds.push_back("trait" + std::to_string(traitIdx));
+  }
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const auto data = trait::TraitsData::make();
+    const auto setProperty = [&data](const Str& traitId) {
+      data->setTraitProperty(traitId, "property", traitId);
+    };
+    if (entityReferences[idx].toString() == "forward") {
+      std::for_each(traitIds.begin(), traitIds.end(), setProperty);
+    } else {
+      std::for_each(traitIds.rbegin(), traitIds.rend(), setProperty);
+    }
+    successCallback(idx, data);
+  }
+}
+
+/// Extract the "version" property of a result.
+Int version(const ConditionalResolveResult& result) {
+  return std::get<Int>(*result.traitsData->getTraitPropertyView("stub", "version"));
+}
+
+/// Conditionally resolve entities, returning each result, or a
+/// default-constructed result on error.
+std::vector<ConditionalResolveResult> resolveIfChanged(const hostApi::ManagerPtr& manager,
+                                                       const EntityReferences& entityReferences,
+                                                       const std::vector<Str>& generationTokens) {
+  std::vector<ConditionalResolveResult> results(entityReferences.size());
+  manager->resolveIfChanged(
+      entityReferences, {"stub"}, ResolveAccess::kRead, generationTokens,
+      manager->createContext(),
+      [&](const std::size_t idx, ConditionalResolveResult result) {
+        results[idx] = std::move(result);
+      },
+      [](std::size_t, const BatchElementError&) {});
+  return results;
+}
+}  // namespace
+
+SCENARIO("Conditionally resolving entities using generation tokens") {
+  GIVEN("a Manager whose plugin implements only resolve, with a maximum batch size") {
+    const ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    initializeManager(*manager, fixture.mockManagerInterface,
+                      {{Str{openassetio::constants::kInfoKey_MaxBatchSize}, Int{2}}});
+
+    std::map<Str, Int> versions{{"a", 1}, {"b", 1}, {"c", 1}};
+    // Size of each batch the manager plugin is given.
+    std::vector<std::size_t> batchSizes;
+    ALLOW_CALL(fixture.mockManagerInterface,
+               resolve(_, _, ResolveAccess::kRead, _, fixture.hostSession, _, _))
+        .LR_SIDE_EFFECT(batchSizes.push_back(_1.size()))
+        .LR_SIDE_EFFECT(resolveVersions(_1, versions, _6, _7));
+
+    const EntityReferences refs{EntityReference{"a"}, EntityReference{"b"},
+                                EntityReference{"c"}};
+
+    WHEN("entities are resolved without prior tokens") {
+      const std::vector<ConditionalResolveResult> first =
+          resolveIfChanged(manager, refs, {"", "", ""});
+
+      THEN("data and a non-empty token is returned for each") {
+        for (const ConditionalResolveResult& result : first) {
+          REQUIRE(result.traitsData);
+          CHECK(version(result) == 1);
+          CHECK_FALSE(result.generationToken.empty());
+        }
+      }
+
+      THEN("the batch is split according to the maximum batch size") {
+        CHECK(batchSizes == std::vector<std::size_t>{2, 1});
+      }
+
+      AND_WHEN("one entity changes and they are resolved again with their tokens") {
+        versions["c"] = 2;
+        const std::vector<ConditionalResolveResult> second = resolveIfChanged(
+            manager, refs,
+            {first[0].generationToken, first[1].generationToken, first[2].generationToken});
+
+        THEN("only the changed entity's data is returned, with a new token") {
+          CHECK_FALSE(second[0].traitsData);
+          CHECK(second[0].generationToken == first[0].generationToken);
+          CHECK_FALSE(second[1].traitsData);
+          CHECK(second[1].generationToken == first[1].generationToken);
+          REQUIRE(second[2].traitsData);
+          CHECK(version(second[2]) == 2);
+          CHECK(second[2].generationToken != first[2].generationToken);
+        }
+      }
+    }
+
+    WHEN("an entity fails to resolve") {
+      std::vector<std::size_t> errorIndices;
+      manager->resolveIfChanged(
+          {EntityReference{"a"}, EntityReference{"missing"}}, {"stub"}, ResolveAccess::kRead,
+          {"", ""}, manager->createContext(), [](std::size_t, ConditionalResolveResult) {},
+          [&](const std::size_t idx, const BatchElementError&) { errorIndices.push_back(idx); });
+
+      THEN("the error is reported against its index") {
+        CHECK(errorIndices == std::vector<std::size_t>{1});
+      }
+    }
+
+    THEN("a mismatched number of tokens is rejected") {
+      CHECK_THROWS_AS(resolveIfChanged(manager, refs, {""}),
+                      openassetio::errors::InputValidationException);
+      CHECK(batchSizes.empty());
+    }
+  }
+
+  GIVEN("a Manager whose plugin builds equal data with traits added in different orders") {
+    const ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    initializeManager(*manager, fixture.mockManagerInterface);
+
+    ALLOW_CALL(fixture.mockManagerInterface,
+               resolve(_, _, ResolveAccess::kRead, _, fixture.hostSession, _, _))
+        .SIDE_EFFECT(resolveInInsertionOrder(_1, _6));
+
+    WHEN("entities are resolved without prior tokens") {
+      const std::vector<ConditionalResolveResult> results = resolveIfChanged(
+          manager, {EntityReference{"forward"}, EntityReference{"backward"}}, {"", ""});
+
+      THEN("their tokens are equal") {
+        REQUIRE(results[0].traitsData);
+        REQUIRE(results[1].traitsData);
+        CHECK(*results[0].traitsData == *results[1].traitsData);
+        CHECK(results[0].generationToken == results[1].generationToken);
+      }
+    }
+  }
+}
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::ManagerFixture;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/// Mock manager that overrides projected resolution.
+struct MockProjectingManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK8(resolveProjected);
+};
+
+/**
+ * Resolve each requested trait to "location" and "size" properties,
+ * populating only those in the projection, if any.
+ */
+void populate(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+              const trait::PropertyProjection& propertyProjection,
+              const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const auto data = trait::TraitsData::make();
+    for (const trait::TraitId& traitId : traitSet) {
+      data->addTrait(traitId);
+      const auto projected = propertyProjection.find(traitId);
+      const auto isRequired = [&](const trait::property::Key& key) {
+        return projected == propertyProjection.end() || projected->second.count(key) != 0;
+      };
+      if (isRequired("location")) {
+        data->setTraitProperty(traitId, "location", entityReferences[idx].toString());
+      }
+      if (isRequired("size")) {
+        data->setTraitProperty(traitId, "size", Int{1});
+      }
+    }
+    successCallback(idx, data);
+  }
+}
+
+/// Resolve entities with a projection, returning each result.
+trait::TraitsDatas resolveProjected(const hostApi::ManagerPtr& manager,
+                                    const EntityReferences& entityReferences,
+                                    const trait::PropertyProjection& propertyProjection) {
+  trait::TraitsDatas results(entityReferences.size());
+  manager->resolveProjected(
+      entityReferences, {"content", "stats"}, propertyProjection, ResolveAccess::kRead,
+      manager->createContext(),
+      [&](const std::size_t idx, trait::TraitsDataPtr data) { results[idx] = std::move(data); },
+      [](std::size_t, const BatchElementError&) { FAIL(); });
+  return results;
+}
+}  // namespace
+
+SCENARIO("Resolving a projection of trait properties") {
+  const EntityReferences refs{EntityReference{"a"}, EntityReference{"b"}, EntityReference{"c"}};
+
+  GIVEN("a Manager whose plugin supports projection, with a maximum batch size") {
+    const auto mockManagerInterface = std::make_shared<MockProjectingManagerInterface>();
+    const managerApi::HostSessionPtr hostSession = makeMockHostSession();
+    const auto manager = hostApi::Manager::make(mockManagerInterface, hostSession);
+    initializeManager(*manager, *mockManagerInterface,
+                      {{Str{openassetio::constants::kInfoKey_MaxBatchSize}, Int{2}}});
+
+    WHEN("entities are resolved with a projection of one trait") {
+      // Size of each batch the manager plugin is given.
+      std::vector<std::size_t> batchSizes;
+      ALLOW_CALL(*mockManagerInterface,
+                 resolveProjected(_, _, _, ResolveAccess::kRead, _, hostSession, _, _))
+          .LR_SIDE_EFFECT(batchSizes.push_back(_1.size()))
+          .SIDE_EFFECT(populate(_1, _2, _3, _7));
+
+      const trait::TraitsDatas results =
+          resolveProjected(manager, refs, {{"content", {"location"}}});
+
+      THEN("only the projected properties of that trait are populated") {
+        for (std::size_t idx = 0; idx < refs.size(); ++idx) {
+          CHECK(results[idx]->traitSet() == trait::TraitSet{"content", "stats"});
+          CHECK(results[idx]->traitPropertyKeys("content") == trait::property::KeySet{"location"});
+          CHECK(results[idx]->traitPropertyKeys("stats") ==
+                trait::property::KeySet{"location", "size"});
+        }
+      }
+
+      THEN("the batch is split according to the maximum batch size") {
+        CHECK(batchSizes == std::vector<std::size_t>{2, 1});
+      }
+    }
+  }
+
+  GIVEN("a Manager whose plugin does not support projection") {
+    const ManagerFixture fixture;
+    initializeManager(*fixture.manager, fixture.mockManagerInterface);
+
+    WHEN("entities are resolved with a projection") {
+      REQUIRE_CALL(fixture.mockManagerInterface,
+                   resolve(refs, _, ResolveAccess::kRead, _, fixture.hostSession, _, _))
+          .SIDE_EFFECT(populate(_1, _2, {}, _6));
+
+      const trait::TraitsDatas results =
+          resolveProjected(fixture.manager, refs, {{"content", {"location"}}});
+
+      THEN("every property is populated") {
+        CHECK(results[0]->traitPropertyKeys("content") ==
+              trait::property::KeySet{"location", "size"});
+      }
+    }
+  }
+}
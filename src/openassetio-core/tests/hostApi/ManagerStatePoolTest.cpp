@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+using openassetio::ContextPtr;
+using trompeloeil::_;
+
+struct StubManagerState : managerApi::ManagerStateBase {};
+
+/// Mock manager that creates states, using the default resetState.
+struct MockStateCreatingManagerInterface : openassetio::testSupport::MockManagerInterface {
+  IMPLEMENT_MOCK1(createState);
+};
+
+/// Mock manager that creates and resets states.
+struct MockStatefulManagerInterface : MockStateCreatingManagerInterface {
+  IMPLEMENT_MOCK2(resetState);
+};
+
+hostApi::ManagerPtr makeManager(managerApi::ManagerInterfacePtr managerInterface,
+                                const managerApi::HostSessionPtr& hostSession,
+                                const std::size_t managerStatePoolCapacity) {
+  hostApi::Manager::Options options;
+  options.managerStatePoolCapacity = managerStatePoolCapacity;
+  return hostApi::Manager::make(std::move(managerInterface), hostSession, options);
+}
+}  // namespace
+
+SCENARIO("Reusing manager states of released contexts") {
+  const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+
+  GIVEN("a stateful manager with a manager state pool") {
+    const auto managerInterface = std::make_shared<MockStatefulManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+    const hostApi::ManagerPtr manager = makeManager(managerInterface, hostSession, 2);
+
+    WHEN("a context is created, released, and another created") {
+      REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+          .RETURN(std::make_shared<StubManagerState>());
+      REQUIRE_CALL(mockManagerInterface, resetState(_, hostSession)).RETURN(true);
+
+      const managerApi::ManagerStateBase* firstState = nullptr;
+      {
+        const ContextPtr context = manager->createContext();
+        firstState = context->managerState.get();
+      }
+      const ContextPtr context = manager->createContext();
+
+      THEN("the released state is reset and reused") {
+        CHECK(context->managerState.get() == firstState);
+      }
+    }
+
+    WHEN("contexts are created whilst others are alive") {
+      REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+          .TIMES(2)
+          .RETURN(std::make_shared<StubManagerState>());
+      FORBID_CALL(mockManagerInterface, resetState(_, _));
+
+      const ContextPtr context1 = manager->createContext();
+      const ContextPtr context2 = manager->createContext();
+
+      THEN("each has a distinct new state") {
+        CHECK(context1->managerState != context2->managerState);
+      }
+    }
+
+    WHEN("more contexts are released than the pool capacity") {
+      THEN("only the pool capacity worth of states are reused") {
+        REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+            .TIMES(4)
+            .RETURN(std::make_shared<StubManagerState>());
+        REQUIRE_CALL(mockManagerInterface, resetState(_, hostSession)).TIMES(2).RETURN(true);
+
+        {
+          const ContextPtr context1 = manager->createContext();
+          const ContextPtr context2 = manager->createContext();
+          const ContextPtr context3 = manager->createContext();
+        }
+        const ContextPtr context1 = manager->createContext();
+        const ContextPtr context2 = manager->createContext();
+        const ContextPtr context3 = manager->createContext();
+      }
+    }
+
+    WHEN("the manager refuses to reset released states") {
+      THEN("the released state is discarded and a new state created") {
+        REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+            .TIMES(3)
+            .RETURN(std::make_shared<StubManagerState>());
+        REQUIRE_CALL(mockManagerInterface, resetState(_, hostSession)).TIMES(2).RETURN(false);
+
+        manager->createContext();
+        manager->createContext();
+        const ContextPtr context = manager->createContext();
+      }
+    }
+
+    WHEN("caches are flushed after a context is released") {
+      THEN("the released state is not reused") {
+        REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+            .TIMES(2)
+            .RETURN(std::make_shared<StubManagerState>());
+        REQUIRE_CALL(mockManagerInterface, flushCaches(hostSession));
+        FORBID_CALL(mockManagerInterface, resetState(_, _));
+
+        manager->createContext();
+        manager->flushCaches();
+        manager->createContext();
+      }
+    }
+
+    WHEN("a context outlives its manager") {
+      ContextPtr context;
+      {
+        REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+            .RETURN(std::make_shared<StubManagerState>());
+        context = makeManager(managerInterface, hostSession, 2)->createContext();
+      }
+
+      THEN("its state can still be released") { CHECK_NOTHROW(context.reset()); }
+    }
+  }
+
+  GIVEN("a stateful manager using the default resetState") {
+    const auto managerInterface = std::make_shared<MockStateCreatingManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+    const hostApi::ManagerPtr manager = makeManager(managerInterface, hostSession, 2);
+
+    WHEN("a context is created, released, and another created") {
+      THEN("the released state is not reused") {
+        REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+            .TIMES(2)
+            .RETURN(std::make_shared<StubManagerState>());
+
+        manager->createContext();
+        manager->createContext();
+      }
+    }
+  }
+
+  GIVEN("a stateful manager without a manager state pool") {
+    const auto managerInterface = std::make_shared<MockStatefulManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+    const hostApi::ManagerPtr manager = makeManager(managerInterface, hostSession, 0);
+
+    WHEN("a context is created, released, and another created") {
+      THEN("a new state is created each time") {
+        REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+            .TIMES(2)
+            .RETURN(std::make_shared<StubManagerState>());
+        FORBID_CALL(mockManagerInterface, resetState(_, _));
+
+        manager->createContext();
+        manager->createContext();
+      }
+    }
+  }
+}
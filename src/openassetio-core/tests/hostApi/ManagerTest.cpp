@@ -1,5 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <exception>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
 #include <type_traits>
 #include <variant>
 
@@ -8,82 +13,24 @@
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
 
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
 #include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 
-namespace openassetio {
-inline namespace OPENASSETIO_CORE_ABI_VERSION {
-namespace {
-/**
- * Mock implementation of a ManagerInterface.
- *
- * Used as constructor parameter to the Manager under test.
- */
-struct MockManagerInterface : trompeloeil::mock_interface<managerApi::ManagerInterface> {
-  IMPLEMENT_CONST_MOCK0(identifier);
-  IMPLEMENT_CONST_MOCK0(displayName);
-  IMPLEMENT_MOCK0(info);
-  IMPLEMENT_MOCK2(initialize);
-  IMPLEMENT_MOCK1(hasCapability);
-  IMPLEMENT_MOCK4(managementPolicy);
-  IMPLEMENT_MOCK2(isEntityReferenceString);
-  IMPLEMENT_MOCK5(entityExists);
-  IMPLEMENT_MOCK7(resolve);
-  IMPLEMENT_MOCK7(preflight);
-  IMPLEMENT_MOCK7(register_);  // NOLINT(readability-identifier-naming)
-};
-/**
- * Mock implementation of a HostInterface.
- *
- * Used as constructor parameter to Host classes required as part of these tests
- */
-struct MockHostInterface : trompeloeil::mock_interface<hostApi::HostInterface> {
-  IMPLEMENT_CONST_MOCK0(identifier);
-  IMPLEMENT_CONST_MOCK0(displayName);
-  IMPLEMENT_MOCK0(info);
-};
-/**
- * Mock implementation of a LoggerInterface
- *
- * Used as constructor parameter to Host classes required as part of these tests
- */
-struct MockLoggerInterface : trompeloeil::mock_interface<log::LoggerInterface> {
-  IMPLEMENT_MOCK2(log);
-};
-
-/**
- * Fixture providing a Manager instance injected with mock dependencies.
- */
-struct ManagerFixture {
-  const std::shared_ptr<managerApi::ManagerInterface> managerInterface =
-      std::make_shared<openassetio::MockManagerInterface>();
-
-  // For convenience, to avoid casting all the time in tests.
-  MockManagerInterface& mockManagerInterface =
-      static_cast<openassetio::MockManagerInterface&>(*managerInterface);
-
-  // Create a HostSession with our mock HostInterface
-  const managerApi::HostSessionPtr hostSession = managerApi::HostSession::make(
-      managerApi::Host::make(std::make_shared<openassetio::MockHostInterface>()),
-      std::make_shared<openassetio::MockLoggerInterface>());
-
-  // Create the Manager under test.
-  const hostApi::ManagerPtr manager = hostApi::Manager::make(managerInterface, hostSession);
-
-  // For convenience, since almost every method takes a Context.
-  const openassetio::ContextPtr context{openassetio::Context::make()};
-};
-
-}  // namespace
-}  // namespace OPENASSETIO_CORE_ABI_VERSION
-}  // namespace openassetio
+#include <testSupport/ManagerFixture.hpp>
 
 namespace {
 /* Oft-reused predicate to check if an error matches an exception by
@@ -109,7 +56,7 @@ SCENARIO("Resolving entities") {
 
   GIVEN("a configured Manager instance") {
     const openassetio::trait::TraitSet traits = {"fakeTrait", "secondFakeTrait"};
-    const openassetio::ManagerFixture fixture;
+    const openassetio::testSupport::ManagerFixture fixture;
     const auto& manager = fixture.manager;
     auto& mockManagerInterface = fixture.mockManagerInterface;
     const auto& context = fixture.context;
@@ -195,6 +142,15 @@ SCENARIO("Resolving entities") {
           }
         }
       }
+      WHEN("batch resolve is called with a results container") {
+        hostApi::ResolveResults results;
+        manager->resolve(refs, traits, resolveAccess, context, results);
+        THEN("the container holds the expected TraitsDatas") {
+          CHECK(results.allSucceeded());
+          CHECK(results.values() == expectedVec);
+          CHECK(results.indexedErrors().empty());
+        }
+      }
     }
     GIVEN("manager plugin successfully resolves multiple entity references in a non-index order") {
       const openassetio::EntityReferences refs = {openassetio::EntityReference{"testReference1"},
@@ -342,12 +298,737 @@ SCENARIO("Resolving entities") {
           CHECK(std::get<openassetio::trait::TraitsDataPtr>(actualVec[2]) == expectedValue2);
         }
       }
+      WHEN("batch resolve is called with a results container") {
+        hostApi::ResolveResults results;
+        manager->resolve(refs, traits, resolveAccess, context, results);
+        THEN("the container holds the expected objects") {
+          REQUIRE(results.size() == 3);
+          CHECK_FALSE(results.allSucceeded());
+          CHECK_FALSE(results.succeeded(0));
+          CHECK_FALSE(results.succeeded(1));
+          REQUIRE(results.succeeded(2));
+          CHECK(results.value(2) == expectedValue2);
+
+          REQUIRE(results.error(0));
+          CHECK(*results.error(0) == expectedError0);
+          REQUIRE(results.error(1));
+          CHECK(*results.error(1) == expectedError1);
+          CHECK(results.error(2) == nullptr);
+          CHECK(results.indexedErrors().size() == 2);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Resolving entities with a ResolveCache") {
+  namespace hostApi = openassetio::hostApi;
+  using trompeloeil::_;
+
+  GIVEN("a Manager instance configured with a ResolveCache") {
+    const openassetio::trait::TraitSet traits = {"fakeTrait"};
+    const openassetio::testSupport::ManagerFixture fixture;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& context = fixture.context;
+    const auto& hostSession = fixture.hostSession;
+    const auto resolveAccess = openassetio::access::ResolveAccess::kRead;
+
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10);
+    hostApi::Manager::Options options;
+    options.resolveCache = cache;
+    const hostApi::ManagerPtr manager =
+        hostApi::Manager::make(fixture.managerInterface, hostSession, options);
+
+    const openassetio::EntityReference ref1{"testReference1"};
+    const openassetio::EntityReference ref2{"testReference2"};
+    const openassetio::EntityReferences refs{ref1, ref2};
+    const openassetio::EntityReferences uncachedRefs{ref2};
+    const openassetio::trait::TraitsDataPtr expected1 = openassetio::trait::TraitsData::make();
+    expected1->addTrait("aTestTrait1");
+    const openassetio::errors::BatchElementError expectedError2{
+        openassetio::errors::BatchElementError::ErrorCode::kEntityResolutionError, "Some error"};
+
+    AND_GIVEN("the first entity has previously been successfully resolved") {
+      {
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(refs, traits, resolveAccess, context, hostSession, _, _))
+            .LR_SIDE_EFFECT(_6(0, expected1))
+            .LR_SIDE_EFFECT(_7(1, expectedError2));
+
+        const auto actualVec = manager->resolve(
+            refs, traits, resolveAccess, context,
+            hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+
+        REQUIRE(std::get<openassetio::trait::TraitsDataPtr>(actualVec[0]) == expected1);
+        REQUIRE(std::get<openassetio::errors::BatchElementError>(actualVec[1]) == expectedError2);
+        REQUIRE(cache->size() == 1);
+      }
+
+      WHEN("both entities are resolved again") {
+        const openassetio::trait::TraitsDataPtr expected2 =
+            openassetio::trait::TraitsData::make();
+        expected2->addTrait("aTestTrait2");
+
+        // Only the uncached entity should be forwarded to the plugin,
+        // with the index mapped back to the caller's index.
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(uncachedRefs, traits, resolveAccess, context, hostSession, _, _))
+            .LR_SIDE_EFFECT(_6(0, expected2));
+
+        const std::vector<openassetio::trait::TraitsDataPtr> actualVec =
+            manager->resolve(refs, traits, resolveAccess, context);
+
+        THEN("the cached result is served from the cache") {
+          CHECK(*actualVec[0] == *expected1);
+          CHECK(actualVec[1] == expected2);
+        }
+      }
+
+      WHEN("only the cached entity is resolved again") {
+        FORBID_CALL(mockManagerInterface, resolve(_, _, _, _, _, _, _));
+
+        const openassetio::trait::TraitsDataPtr actual =
+            manager->resolve(ref1, traits, resolveAccess, context);
+
+        THEN("the manager plugin is not called") { CHECK(*actual == *expected1); }
+      }
+
+      WHEN("caches are flushed") {
+        REQUIRE_CALL(mockManagerInterface, flushCaches(hostSession));
+        manager->flushCaches();
+
+        THEN("the cache is emptied") { CHECK(cache->size() == 0); }
+      }
+    }
+
+    AND_GIVEN("the manager plugin declares that it caches resolve results") {
+      openassetio::InfoDictionary info;
+      info[openassetio::Str{openassetio::constants::kInfoKey_IsResolveCached}] = true;
+      {
+        // For the identity of the cached results.
+        REQUIRE_CALL(mockManagerInterface, identifier()).RETURN("org.openassetio.test");
+        REQUIRE_CALL(mockManagerInterface, initialize(_, _));
+        ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+        REQUIRE_CALL(mockManagerInterface, info()).RETURN(info);
+        manager->initialize({});
+      }
+
+      WHEN("an entity is resolved twice") {
+        const openassetio::EntityReferences singleRef{ref1};
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(singleRef, traits, resolveAccess, context, hostSession, _, _))
+            .TIMES(2)
+            .LR_SIDE_EFFECT(_6(0, expected1));
+
+        manager->resolve(ref1, traits, resolveAccess, context);
+        manager->resolve(ref1, traits, resolveAccess, context);
+
+        THEN("the cache is bypassed") { CHECK(cache->size() == 0); }
+      }
+    }
+  }
+}
+
+SCENARIO("Resolving entities asynchronously") {
+  namespace hostApi = openassetio::hostApi;
+  using trompeloeil::_;
+
+  GIVEN("a configured Manager instance") {
+    const openassetio::trait::TraitSet traits = {"fakeTrait"};
+    const openassetio::testSupport::ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& context = fixture.context;
+    const auto& hostSession = fixture.hostSession;
+    const auto resolveAccess = openassetio::access::ResolveAccess::kRead;
+
+    const openassetio::EntityReferences refs{openassetio::EntityReference{"testReference1"},
+                                             openassetio::EntityReference{"testReference2"}};
+
+    AND_GIVEN("manager plugin has a synchronous resolve implementation") {
+      const openassetio::trait::TraitsDataPtr expected1 = openassetio::trait::TraitsData::make();
+      expected1->addTrait("aTestTrait1");
+      const openassetio::errors::BatchElementError expectedError2{
+          openassetio::errors::BatchElementError::ErrorCode::kEntityResolutionError,
+          "Some error"};
+
+      // The default resolveAsync adapts the synchronous resolve.
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(refs, traits, resolveAccess, context, hostSession, _, _))
+          .LR_SIDE_EFFECT(_7(1, expectedError2))
+          .LR_SIDE_EFFECT(_6(0, expected1));
+
+      WHEN("future-returning resolveAsync is called") {
+        auto future = manager->resolveAsync(refs, traits, resolveAccess, context);
+        const auto results = future.get();
+
+        THEN("future holds results in index order") {
+          REQUIRE(results.size() == 2);
+          CHECK(std::get<openassetio::trait::TraitsDataPtr>(results[0]) == expected1);
+          CHECK(std::get<openassetio::errors::BatchElementError>(results[1]) == expectedError2);
+        }
+      }
+
+      WHEN("callback-based resolveAsync is called") {
+        std::promise<void> completed;
+        openassetio::trait::TraitsDataPtr actual1;
+        std::optional<openassetio::errors::BatchElementError> actualError2;
+        std::exception_ptr actualException;
+
+        manager->resolveAsync(
+            refs, traits, resolveAccess, context,
+            [&](std::size_t idx, openassetio::trait::TraitsDataPtr data) {
+              CHECK(idx == 0);
+              actual1 = std::move(data);
+            },
+            [&](std::size_t idx, openassetio::errors::BatchElementError error) {
+              CHECK(idx == 1);
+              actualError2 = std::move(error);
+            },
+            [&](std::exception_ptr exception) {
+              actualException = std::move(exception);
+              completed.set_value();
+            });
+        completed.get_future().wait();
+
+        THEN("callbacks are called before completion") {
+          CHECK(actual1 == expected1);
+          CHECK(actualError2 == expectedError2);
+          CHECK_FALSE(actualException);
+        }
+      }
+
+      WHEN("resolveStream is called with a single element buffer") {
+        auto stream = manager->resolveStream(refs, traits, resolveAccess, context, 1);
+        auto first = stream.next();
+        auto second = stream.next();
+        auto end = stream.next();
+
+        THEN("results are streamed in the order they were produced") {
+          REQUIRE(first);
+          CHECK(first->first == 1);
+          CHECK(std::get<openassetio::errors::BatchElementError>(first->second) ==
+                expectedError2);
+          REQUIRE(second);
+          CHECK(second->first == 0);
+          CHECK(std::get<openassetio::trait::TraitsDataPtr>(second->second) == expected1);
+          CHECK_FALSE(end);
+        }
+      }
+    }
+
+    AND_GIVEN("manager plugin fails the whole batch") {
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(refs, traits, resolveAccess, context, hostSession, _, _))
+          .THROW(openassetio::errors::InputValidationException{"Some whole batch error"});
+
+      WHEN("future-returning resolveAsync is called") {
+        auto future = manager->resolveAsync(refs, traits, resolveAccess, context);
+
+        THEN("future holds the exception") {
+          CHECK_THROWS_MATCHES(
+              future.get(), openassetio::errors::InputValidationException,
+              Catch::Message("Some whole batch error"));
+        }
+      }
+
+      WHEN("resolveStream is called") {
+        auto stream = manager->resolveStream(refs, traits, resolveAccess, context);
+
+        THEN("the stream rethrows the exception") {
+          CHECK_THROWS_MATCHES(stream.next(), openassetio::errors::InputValidationException,
+                               Catch::Message("Some whole batch error"));
+          CHECK_FALSE(stream.next());
+        }
+      }
     }
   }
 }
 
 using ErrorCode = openassetio::errors::BatchElementError::ErrorCode;
 
+SCENARIO("Resolving large batches in parallel chunks") {
+  namespace hostApi = openassetio::hostApi;
+  using trompeloeil::_;
+
+  GIVEN("a Manager instance configured with a resolve chunk size") {
+    const openassetio::trait::TraitSet traits = {"fakeTrait"};
+    const openassetio::testSupport::ManagerFixture fixture;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& context = fixture.context;
+    const auto& hostSession = fixture.hostSession;
+    const auto resolveAccess = openassetio::access::ResolveAccess::kRead;
+
+    hostApi::Manager::Options options;
+    options.resolveChunkSize = 2;
+    const hostApi::ManagerPtr manager =
+        hostApi::Manager::make(fixture.managerInterface, hostSession, options);
+
+    const openassetio::EntityReference ref0{"testReference0"};
+    const openassetio::EntityReference ref1{"testReference1"};
+    const openassetio::EntityReference ref2{"testReference2"};
+    const openassetio::EntityReference ref3{"testReference3"};
+    const openassetio::EntityReference ref4{"testReference4"};
+    const openassetio::EntityReferences refs{ref0, ref1, ref2, ref3, ref4};
+
+    const openassetio::trait::TraitsDataPtr expected0 = openassetio::trait::TraitsData::make();
+    const openassetio::trait::TraitsDataPtr expected1 = openassetio::trait::TraitsData::make();
+    const openassetio::trait::TraitsDataPtr expected2 = openassetio::trait::TraitsData::make();
+    const openassetio::trait::TraitsDataPtr expected4 = openassetio::trait::TraitsData::make();
+    const openassetio::errors::BatchElementError expectedError3{
+        openassetio::errors::BatchElementError::ErrorCode::kEntityResolutionError, "Some error"};
+
+    AND_GIVEN("the manager plugin declares itself thread-safe") {
+      openassetio::InfoDictionary info;
+      info[openassetio::Str{openassetio::constants::kInfoKey_IsThreadSafe}] = true;
+      {
+        REQUIRE_CALL(mockManagerInterface, initialize(_, _));
+        ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+        REQUIRE_CALL(mockManagerInterface, info()).RETURN(info);
+        manager->initialize({});
+      }
+
+      WHEN("a batch larger than the chunk size is resolved") {
+        const openassetio::EntityReferences chunk0{ref0, ref1};
+        const openassetio::EntityReferences chunk1{ref2, ref3};
+        const openassetio::EntityReferences chunk2{ref4};
+
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(chunk0, traits, resolveAccess, context, hostSession, _, _))
+            .LR_SIDE_EFFECT(_6(1, expected1))
+            .LR_SIDE_EFFECT(_6(0, expected0));
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(chunk1, traits, resolveAccess, context, hostSession, _, _))
+            .LR_SIDE_EFFECT(_6(0, expected2))
+            .LR_SIDE_EFFECT(_7(1, expectedError3));
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(chunk2, traits, resolveAccess, context, hostSession, _, _))
+            .LR_SIDE_EFFECT(_6(0, expected4));
+
+        const auto actualVec = manager->resolve(
+            refs, traits, resolveAccess, context,
+            hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+
+        THEN("chunk results are mapped back to the original indices") {
+          REQUIRE(actualVec.size() == 5);
+          CHECK(std::get<openassetio::trait::TraitsDataPtr>(actualVec[0]) == expected0);
+          CHECK(std::get<openassetio::trait::TraitsDataPtr>(actualVec[1]) == expected1);
+          CHECK(std::get<openassetio::trait::TraitsDataPtr>(actualVec[2]) == expected2);
+          CHECK(std::get<openassetio::errors::BatchElementError>(actualVec[3]) ==
+                expectedError3);
+          CHECK(std::get<openassetio::trait::TraitsDataPtr>(actualVec[4]) == expected4);
+        }
+      }
+
+      WHEN("a batch no larger than the chunk size is resolved") {
+        const openassetio::EntityReferences smallRefs{ref0, ref1};
+
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(smallRefs, traits, resolveAccess, context, hostSession, _, _))
+            .LR_SIDE_EFFECT(_6(0, expected0))
+            .LR_SIDE_EFFECT(_6(1, expected1));
+
+        const std::vector<openassetio::trait::TraitsDataPtr> actualVec =
+            manager->resolve(smallRefs, traits, resolveAccess, context);
+
+        THEN("the batch is forwarded unchanged") {
+          CHECK(actualVec[0] == expected0);
+          CHECK(actualVec[1] == expected1);
+        }
+      }
+    }
+
+    AND_GIVEN("the manager plugin does not declare itself thread-safe") {
+      {
+        REQUIRE_CALL(mockManagerInterface, initialize(_, _));
+        ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+        REQUIRE_CALL(mockManagerInterface, info()).RETURN(openassetio::InfoDictionary{});
+        manager->initialize({});
+      }
+
+      WHEN("a batch larger than the chunk size is resolved") {
+        REQUIRE_CALL(mockManagerInterface,
+                     resolve(refs, traits, resolveAccess, context, hostSession, _, _));
+
+        manager->resolve(
+            refs, traits, resolveAccess, context, [](auto&&...) {}, [](auto&&...) {});
+
+        THEN("the whole batch is forwarded in a single call") {}
+      }
+    }
+  }
+}
+
+SCENARIO("Classifying entity reference strings with a cache") {
+  namespace hostApi = openassetio::hostApi;
+  using trompeloeil::_;
+
+  GIVEN("a Manager instance configured with an entity reference string cache") {
+    const openassetio::testSupport::ManagerFixture fixture;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& hostSession = fixture.hostSession;
+
+    hostApi::Manager::Options options;
+    options.entityReferenceStringCacheCapacity = 10;
+    const hostApi::ManagerPtr manager =
+        hostApi::Manager::make(fixture.managerInterface, hostSession, options);
+
+    const openassetio::Str refString = "asset://a";
+    const openassetio::Str pathString = "/some/path";
+
+    AND_GIVEN("a string has previously been classified") {
+      {
+        REQUIRE_CALL(mockManagerInterface, isEntityReferenceString(refString, hostSession))
+            .RETURN(true);
+        CHECK(manager->isEntityReferenceString(refString));
+      }
+
+      WHEN("the same string is classified again") {
+        FORBID_CALL(mockManagerInterface, isEntityReferenceString(_, _));
+        const bool actual = manager->isEntityReferenceString(refString);
+
+        THEN("the cached result is returned") { CHECK(actual); }
+      }
+
+      WHEN("a batch including the string is classified") {
+        const std::vector<openassetio::Str> strings{refString, pathString};
+        const std::vector<openassetio::Str> uncachedStrings{pathString};
+        const std::vector<bool> uncachedResult{false};
+
+        REQUIRE_CALL(mockManagerInterface, areEntityReferenceStrings(uncachedStrings, hostSession))
+            .RETURN(uncachedResult);
+
+        const std::vector<bool> actual = manager->areEntityReferenceStrings(strings);
+
+        THEN("only the uncached string is queried in a single call") {
+          const std::vector<bool> expected{true, false};
+          CHECK(actual == expected);
+        }
+      }
+    }
+
+    WHEN("the manager plugin returns the wrong number of results") {
+      const std::vector<openassetio::Str> strings{refString, pathString};
+      const std::vector<bool> badResult{true};
+
+      REQUIRE_CALL(mockManagerInterface, areEntityReferenceStrings(strings, hostSession))
+          .RETURN(badResult);
+      ALLOW_CALL(mockManagerInterface, identifier()).RETURN("mock");
+
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(manager->areEntityReferenceStrings(strings),
+                        openassetio::errors::OpenAssetIOException);
+      }
+    }
+  }
+}
+
+SCENARIO("Querying management policy with memoisation") {
+  namespace access = openassetio::access;
+  namespace hostApi = openassetio::hostApi;
+  namespace trait = openassetio::trait;
+  using trompeloeil::_;
+
+  GIVEN("a Manager instance") {
+    const openassetio::testSupport::ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& hostSession = fixture.hostSession;
+    const auto& context = fixture.context;
+
+    const trait::TraitSet traitSetA{"a"};
+    const trait::TraitSet traitSetB{"b"};
+    const trait::TraitSets traitSets{traitSetA, traitSetB};
+
+    const trait::TraitsDataPtr policyA = trait::TraitsData::make();
+    policyA->addTrait("managedA");
+    const trait::TraitsDataPtr policyB = trait::TraitsData::make();
+    policyB->addTrait("managedB");
+    const trait::TraitsDatas policies{policyA, policyB};
+
+    AND_GIVEN("policy has previously been queried for some trait sets") {
+      const trait::TraitSets queriedTraitSets{traitSetA};
+      const trait::TraitsDatas queriedPolicies{policyA};
+      {
+        REQUIRE_CALL(mockManagerInterface, managementPolicy(queriedTraitSets,
+                                                            access::PolicyAccess::kRead, context,
+                                                            hostSession))
+            .RETURN(queriedPolicies);
+        const trait::TraitsDatas actual =
+            manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, context);
+        CHECK(*actual[0] == *policyA);
+      }
+
+      WHEN("policy is queried for a superset of the trait sets") {
+        const trait::TraitSets uncachedTraitSets{traitSetB};
+        const trait::TraitsDatas uncachedPolicies{policyB};
+
+        REQUIRE_CALL(mockManagerInterface,
+                     managementPolicy(uncachedTraitSets, access::PolicyAccess::kRead, context,
+                                      hostSession))
+            .RETURN(uncachedPolicies);
+
+        const trait::TraitsDatas actual =
+            manager->managementPolicy(traitSets, access::PolicyAccess::kRead, context);
+
+        THEN("only the uncached trait sets are queried") {
+          REQUIRE(actual.size() == 2);
+          CHECK(*actual[0] == *policyA);
+          CHECK(*actual[1] == *policyB);
+        }
+      }
+
+      WHEN("policy is queried for the same trait sets with a different access mode") {
+        const trait::TraitsDatas writePolicies{policyB};
+
+        REQUIRE_CALL(mockManagerInterface,
+                     managementPolicy(queriedTraitSets, access::PolicyAccess::kWrite, context,
+                                      hostSession))
+            .RETURN(writePolicies);
+
+        const trait::TraitsDatas actual =
+            manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kWrite, context);
+
+        THEN("the manager is queried") { CHECK(*actual[0] == *policyB); }
+      }
+
+      WHEN("policy is queried for the same trait sets with a different context") {
+        FORBID_CALL(mockManagerInterface, managementPolicy(_, _, _, _));
+        const openassetio::ContextPtr otherContext =
+            openassetio::Context::make(trait::TraitsData::make({"aLocaleTrait"}));
+
+        const trait::TraitsDatas actual =
+            manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, otherContext);
+
+        THEN("the cached policy is returned") { CHECK(*actual[0] == *policyA); }
+      }
+
+      WHEN("a cached policy is modified by the caller and queried again") {
+        FORBID_CALL(mockManagerInterface, managementPolicy(_, _, _, _));
+        manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, context)[0]
+            ->addTrait("modified");
+
+        const trait::TraitsDatas actual =
+            manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, context);
+
+        THEN("the cached policy is unaffected") { CHECK(*actual[0] == *policyA); }
+      }
+
+      AND_WHEN("caches are flushed") {
+        REQUIRE_CALL(mockManagerInterface, flushCaches(hostSession));
+        manager->flushCaches();
+
+        THEN("the manager is queried again") {
+          REQUIRE_CALL(mockManagerInterface, managementPolicy(queriedTraitSets,
+                                                              access::PolicyAccess::kRead,
+                                                              context, hostSession))
+              .RETURN(queriedPolicies);
+          CHECK(manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, context)
+                    .size() == 1);
+        }
+      }
+    }
+
+    AND_GIVEN("the manager declares that policy is context-sensitive") {
+      openassetio::InfoDictionary info;
+      info[openassetio::Str{openassetio::constants::kInfoKey_IsManagementPolicyContextSensitive}] =
+          true;
+      {
+        REQUIRE_CALL(mockManagerInterface, initialize(_, _));
+        ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+        REQUIRE_CALL(mockManagerInterface, info()).RETURN(info);
+        manager->initialize({});
+      }
+
+      WHEN("policy is queried for the same trait sets with different contexts") {
+        const openassetio::ContextPtr otherContext =
+            openassetio::Context::make(trait::TraitsData::make({"aLocaleTrait"}));
+
+        REQUIRE_CALL(mockManagerInterface, managementPolicy(traitSets, access::PolicyAccess::kRead,
+                                                            context, hostSession))
+            .RETURN(policies);
+        REQUIRE_CALL(mockManagerInterface,
+                     managementPolicy(traitSets, access::PolicyAccess::kRead,
+                                      openassetio::ContextConstPtr{otherContext}, hostSession))
+            .RETURN(policies);
+
+        const trait::TraitsDatas actual =
+            manager->managementPolicy(traitSets, access::PolicyAccess::kRead, context);
+        const trait::TraitsDatas otherActual =
+            manager->managementPolicy(traitSets, access::PolicyAccess::kRead, otherContext);
+
+        THEN("the manager is queried for each context") {
+          CHECK(*actual[0] == *policyA);
+          CHECK(*otherActual[1] == *policyB);
+        }
+      }
+
+      // Matches the (internal) default capacity of the memo.
+      constexpr std::size_t kMemoCapacity = 1024;
+      const trait::TraitSets queriedTraitSets{traitSetA};
+      const trait::TraitsDatas queriedPolicies{policyA};
+      const auto makeLocaleContext = [](const std::size_t idx) {
+        return openassetio::Context::make(
+            trait::TraitsData::make({"aLocaleTrait" + std::to_string(idx)}));
+      };
+
+      AND_GIVEN("policy has previously been queried for a context") {
+        {
+          REQUIRE_CALL(mockManagerInterface, managementPolicy(queriedTraitSets,
+                                                              access::PolicyAccess::kRead, context,
+                                                              hostSession))
+              .RETURN(queriedPolicies);
+          manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, context);
+        }
+
+        WHEN("policy is then queried for as many other contexts as the memo holds") {
+          ALLOW_CALL(mockManagerInterface, managementPolicy(queriedTraitSets,
+                                                            access::PolicyAccess::kRead, _,
+                                                            hostSession))
+              .RETURN(queriedPolicies);
+
+          for (std::size_t idx = 0; idx < kMemoCapacity; ++idx) {
+            manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead,
+                                      makeLocaleContext(idx));
+          }
+
+          THEN("the least recently used context has been evicted") {
+            REQUIRE_CALL(mockManagerInterface, managementPolicy(queriedTraitSets,
+                                                                access::PolicyAccess::kRead,
+                                                                context, hostSession))
+                .RETURN(queriedPolicies);
+            manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, context);
+          }
+        }
+
+        WHEN("policy is then queried for contexts whose manager state is later destroyed") {
+          struct ManagerState final : openassetio::managerApi::ManagerStateBase {};
+
+          ALLOW_CALL(mockManagerInterface, managementPolicy(queriedTraitSets,
+                                                            access::PolicyAccess::kRead, _,
+                                                            hostSession))
+              .RETURN(queriedPolicies);
+
+          for (std::size_t idx = 0; idx < kMemoCapacity - 1; ++idx) {
+            const openassetio::ContextPtr stateContext = openassetio::Context::make(
+                context->locale, std::make_shared<ManagerState>());
+            manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, stateContext);
+          }
+
+          AND_WHEN("policy is queried for further contexts") {
+            for (std::size_t idx = 0; idx < 2; ++idx) {
+              manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead,
+                                        makeLocaleContext(idx));
+            }
+
+            THEN("expired entries were pruned rather than evicting the live context") {
+              FORBID_CALL(mockManagerInterface, managementPolicy(queriedTraitSets,
+                                                                 access::PolicyAccess::kRead,
+                                                                 context, hostSession));
+              manager->managementPolicy(queriedTraitSets, access::PolicyAccess::kRead, context);
+            }
+          }
+        }
+      }
+    }
+
+    WHEN("the manager plugin returns the wrong number of results") {
+      const trait::TraitsDatas badPolicies{policyA};
+
+      REQUIRE_CALL(mockManagerInterface,
+                   managementPolicy(traitSets, access::PolicyAccess::kRead, context, hostSession))
+          .RETURN(badPolicies);
+      ALLOW_CALL(mockManagerInterface, identifier()).RETURN("mock");
+
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(
+            manager->managementPolicy(traitSets, access::PolicyAccess::kRead, context),
+            openassetio::errors::OpenAssetIOException);
+      }
+    }
+  }
+}
+
+SCENARIO("Cancelling batch operations") {
+  namespace errors = openassetio::errors;
+  namespace hostApi = openassetio::hostApi;
+  using trompeloeil::_;
+
+  GIVEN("a Manager instance and a context with a cancellation token") {
+    const openassetio::trait::TraitSet traits = {"fakeTrait"};
+    const openassetio::testSupport::ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& context = fixture.context;
+    const auto& hostSession = fixture.hostSession;
+    const auto resolveAccess = openassetio::access::ResolveAccess::kRead;
+
+    context->cancellationToken = openassetio::CancellationToken::make();
+
+    const openassetio::EntityReferences refs{openassetio::EntityReference{"testReference0"},
+                                             openassetio::EntityReference{"testReference1"}};
+    const openassetio::trait::TraitsDataPtr expected0 = openassetio::trait::TraitsData::make();
+
+    WHEN("a batch is resolved after the token is cancelled") {
+      context->cancellationToken->cancel();
+      FORBID_CALL(mockManagerInterface, resolve(_, _, _, _, _, _, _));
+
+      const auto actualVec = manager->resolve(
+          refs, traits, resolveAccess, context,
+          hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+
+      THEN("all elements are reported as cancelled without calling the plugin") {
+        REQUIRE(actualVec.size() == 2);
+        CHECK(std::get<errors::BatchElementError>(actualVec[0]).code ==
+              errors::BatchElementError::ErrorCode::kCancelled);
+        CHECK(std::get<errors::BatchElementError>(actualVec[1]).code ==
+              errors::BatchElementError::ErrorCode::kCancelled);
+      }
+    }
+
+    WHEN("the token is cancelled whilst the plugin is resolving") {
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(refs, traits, resolveAccess, _, hostSession, _, _))
+          .LR_SIDE_EFFECT(_6(0, expected0))
+          .LR_SIDE_EFFECT(context->cancellationToken->cancel());
+
+      const auto actualVec = manager->resolve(
+          refs, traits, resolveAccess, context,
+          hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+
+      THEN("elements not reported by the plugin are reported as cancelled") {
+        REQUIRE(actualVec.size() == 2);
+        CHECK(std::get<openassetio::trait::TraitsDataPtr>(actualVec[0]) == expected0);
+        CHECK(std::get<errors::BatchElementError>(actualVec[1]).code ==
+              errors::BatchElementError::ErrorCode::kCancelled);
+      }
+    }
+
+    WHEN("the token is not cancelled and the plugin omits an element") {
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(refs, traits, resolveAccess, _, hostSession, _, _))
+          .LR_SIDE_EFFECT(_6(0, expected0));
+
+      const auto actualVec = manager->resolve(
+          refs, traits, resolveAccess, context,
+          hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+
+      THEN("the omitted element is not reported as cancelled") {
+        REQUIRE(actualVec.size() == 2);
+        CHECK(std::get<openassetio::trait::TraitsDataPtr>(actualVec[1]) == nullptr);
+      }
+    }
+
+    WHEN("a child context is created") {
+      const openassetio::ContextPtr childContext = manager->createChildContext(context);
+
+      THEN("the child shares the parent's token") {
+        CHECK(childContext->cancellationToken == context->cancellationToken);
+      }
+    }
+  }
+}
+
 SCENARIO("Preflighting entities") {
   namespace hostApi = openassetio::hostApi;
   using trompeloeil::_;
@@ -363,7 +1044,7 @@ SCENARIO("Preflighting entities") {
         openassetio::trait::TraitsData::make({"fakeTrait", "secondFakeTrait"});
     const openassetio::trait::TraitsDatas threeTraitsDatas{traitsData, traitsData, traitsData};
 
-    const openassetio::ManagerFixture fixture;
+    const openassetio::testSupport::ManagerFixture fixture;
     const auto& manager = fixture.manager;
     auto& mockManagerInterface = fixture.mockManagerInterface;
     const auto& context = fixture.context;
@@ -587,7 +1268,7 @@ SCENARIO("Registering entities") {
   using trompeloeil::_;
 
   GIVEN("a configured Manager instance") {
-    const openassetio::ManagerFixture fixture;
+    const openassetio::testSupport::ManagerFixture fixture;
     const auto& manager = fixture.manager;
     auto& mockManagerInterface = fixture.mockManagerInterface;
     const auto& context = fixture.context;
@@ -832,3 +1513,166 @@ SCENARIO("Registering entities") {
     }
   }
 }
+
+SCENARIO("Deduplicating entity references in a batch") {
+  namespace errors = openassetio::errors;
+  namespace hostApi = openassetio::hostApi;
+  namespace trait = openassetio::trait;
+  using trompeloeil::_;
+
+  GIVEN("a Manager configured to deduplicate entity references") {
+    const openassetio::testSupport::ManagerFixture fixture;
+    const auto& managerInterface = fixture.managerInterface;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& hostSession = fixture.hostSession;
+    const auto& context = fixture.context;
+    const auto resolveAccess = openassetio::access::ResolveAccess::kRead;
+    const trait::TraitSet traits = {"fakeTrait"};
+
+    hostApi::Manager::Options options;
+    options.deduplicateEntityReferences = true;
+    const hostApi::ManagerPtr manager =
+        hostApi::Manager::make(managerInterface, hostSession, options);
+
+    const openassetio::EntityReference refA{"testReferenceA"};
+    const openassetio::EntityReference refB{"testReferenceB"};
+    const openassetio::EntityReferences refs{refA, refB, refA, refA};
+    const openassetio::EntityReferences uniqueRefs{refA, refB};
+
+    WHEN("a batch containing repeated references is resolved") {
+      const trait::TraitsDataPtr expectedA = trait::TraitsData::make();
+      expectedA->addTrait("resolvedA");
+
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(uniqueRefs, traits, resolveAccess, _, hostSession, _, _))
+          .LR_SIDE_EFFECT(_6(0, expectedA))
+          .LR_SIDE_EFFECT(_7(1, errors::BatchElementError{
+                                    errors::BatchElementError::ErrorCode::kEntityResolutionError,
+                                    "some error"}));
+
+      const auto actualVec = manager->resolve(
+          refs, traits, resolveAccess, context,
+          hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+
+      THEN("each unique reference is resolved once and reported at every index") {
+        REQUIRE(actualVec.size() == 4);
+        CHECK(*std::get<trait::TraitsDataPtr>(actualVec[0]) == *expectedA);
+        CHECK(*std::get<trait::TraitsDataPtr>(actualVec[2]) == *expectedA);
+        CHECK(*std::get<trait::TraitsDataPtr>(actualVec[3]) == *expectedA);
+        CHECK(std::get<errors::BatchElementError>(actualVec[1]).message == "some error");
+      }
+
+      AND_THEN("repeated elements do not share data") {
+        CHECK(std::get<trait::TraitsDataPtr>(actualVec[0]) !=
+              std::get<trait::TraitsDataPtr>(actualVec[2]));
+        CHECK(std::get<trait::TraitsDataPtr>(actualVec[2]) !=
+              std::get<trait::TraitsDataPtr>(actualVec[3]));
+      }
+    }
+
+    WHEN("existence is queried for a batch containing repeated references") {
+      REQUIRE_CALL(mockManagerInterface, entityExists(uniqueRefs, _, hostSession, _, _))
+          .LR_SIDE_EFFECT(_4(0, true))
+          .LR_SIDE_EFFECT(_4(1, false));
+
+      std::vector<bool> actual(refs.size(), false);
+      manager->entityExists(
+          refs, context, [&](const std::size_t idx, const bool exists) { actual[idx] = exists; },
+          [](std::size_t, errors::BatchElementError) { FAIL_CHECK("Unexpected error"); });
+
+      THEN("each unique reference is queried once and reported at every index") {
+        CHECK(actual == std::vector<bool>{true, false, true, true});
+      }
+    }
+
+    WHEN("a batch without repeated references is resolved") {
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(uniqueRefs, traits, resolveAccess, _, hostSession, _, _))
+          .LR_SIDE_EFFECT(_6(0, trait::TraitsData::make()))
+          .LR_SIDE_EFFECT(_6(1, trait::TraitsData::make()));
+
+      const auto actualVec = manager->resolve(
+          uniqueRefs, traits, resolveAccess, context,
+          hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+
+      THEN("the batch is passed to the plugin unmodified") { CHECK(actualVec.size() == 2); }
+    }
+  }
+}
+
+SCENARIO("Querying relationships of many entities") {
+  namespace errors = openassetio::errors;
+  namespace hostApi = openassetio::hostApi;
+  namespace managerApi = openassetio::managerApi;
+  namespace trait = openassetio::trait;
+  using trompeloeil::_;
+
+  struct NoPagesPagerInterface : managerApi::EntityReferencePagerInterface {
+    bool hasNext([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+      return false;
+    }
+    Page get([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+      return {};
+    }
+    void next([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {}
+  };
+
+  GIVEN("a Manager instance") {
+    const openassetio::testSupport::ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& hostSession = fixture.hostSession;
+    const auto& context = fixture.context;
+    const auto relationsAccess = openassetio::access::RelationsAccess::kRead;
+
+    const openassetio::EntityReferences refs{openassetio::EntityReference{"testReference0"},
+                                             openassetio::EntityReference{"testReference1"}};
+    const trait::TraitsDatas relationships{trait::TraitsData::make(),
+                                           trait::TraitsData::make()};
+    const trait::TraitSet resultTraitSet{"aResultTrait"};
+    const std::size_t pageSize = 3;
+
+    WHEN("relationships are queried for many entities") {
+      const errors::BatchElementError expectedError{
+          errors::BatchElementError::ErrorCode::kEntityAccessError, "some error"};
+
+      REQUIRE_CALL(mockManagerInterface,
+                   getWithRelationshipsMatrix(refs, relationships, resultTraitSet, pageSize,
+                                              relationsAccess, _, hostSession, _, _))
+          .LR_SIDE_EFFECT(_8(0, std::make_shared<NoPagesPagerInterface>()))
+          .LR_SIDE_EFFECT(_8(3, std::make_shared<NoPagesPagerInterface>()))
+          .LR_SIDE_EFFECT(_9(2, expectedError))
+          .LR_SIDE_EFFECT(_9(1, expectedError));
+
+      std::vector<std::size_t> successIdxs;
+      std::vector<std::size_t> errorIdxs;
+
+      manager->getWithRelationshipsMatrix(
+          refs, relationships, pageSize, relationsAccess, context,
+          [&](const std::size_t idx, const hostApi::EntityReferencePagerPtr& pager) {
+            CHECK(pager);
+            successIdxs.push_back(idx);
+          },
+          [&](const std::size_t idx, const errors::BatchElementError& error) {
+            CHECK(error == expectedError);
+            errorIdxs.push_back(idx);
+          },
+          resultTraitSet);
+
+      THEN("results are reported with row-major indices and host pagers") {
+        CHECK(successIdxs == std::vector<std::size_t>{0, 3});
+        CHECK(errorIdxs == std::vector<std::size_t>{2, 1});
+      }
+    }
+
+    WHEN("relationships are queried with a zero page size") {
+      THEN("an InputValidationException is thrown") {
+        CHECK_THROWS_AS(manager->getWithRelationshipsMatrix(
+                            refs, relationships, 0, relationsAccess, context,
+                            [](std::size_t, const hostApi::EntityReferencePagerPtr&) {},
+                            [](std::size_t, const errors::BatchElementError&) {}),
+                        errors::InputValidationException);
+      }
+    }
+  }
+}
@@ -0,0 +1,314 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerMetrics.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trace/RingBufferTracer.hpp>
+#include <openassetio/trace/TracerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/TraitsDataTable.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Float;
+using openassetio::InfoDictionary;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::MockHostInterface;
+using openassetio::testSupport::MockManagerInterface;
+using openassetio::trace::RingBufferTracer;
+using openassetio::trace::TracerInterface;
+using trompeloeil::_;
+using Severity = openassetio::log::LoggerInterface::Severity;
+
+/**
+ * Mock logger that also mocks structured logging and severity
+ * filtering, which are under test.
+ */
+struct MockStructuredLoggerInterface
+    : trompeloeil::mock_interface<openassetio::log::LoggerInterface> {
+  IMPLEMENT_MOCK2(log);
+  IMPLEMENT_MOCK3(logStructured);
+  IMPLEMENT_CONST_MOCK1(isSeverityLogged);
+};
+
+/**
+ * Resolve each entity to an empty TraitsData.
+ *
+ * The reference "error" leads to an element error, and "throw" fails
+ * the whole batch.
+ */
+void resolveByReference(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "throw") {
+      throw openassetio::errors::InputValidationException{"batch failed"};
+    }
+    if (ref == "error") {
+      errorCallback(idx, {BatchElementError::ErrorCode::kEntityResolutionError, "bad entity"});
+      continue;
+    }
+    successCallback(idx, trait::TraitsData::make());
+  }
+}
+
+/**
+ * Fixture providing a Manager whose logger is a mock. kDebugApi
+ * messages are presented, and recorded, only if `isDebugApiLogged` is
+ * set.
+ */
+struct TraceFixture {
+  explicit TraceFixture(const bool isDebugApiLogged,
+                        hostApi::ManagerMetricsPtr metrics = nullptr)
+      : manager{hostApi::Manager::make(
+            managerInterface,
+            managerApi::HostSession::make(
+                managerApi::Host::make(std::make_shared<MockHostInterface>()), logger),
+            optionsWith(std::move(metrics)))} {
+    expectations.push_back(NAMED_ALLOW_CALL(*logger, isSeverityLogged(_))
+                               .RETURN(_1 != Severity::kDebugApi || isDebugApiLogged));
+    if (isDebugApiLogged) {
+      expectations.push_back(NAMED_ALLOW_CALL(*logger, logStructured(Severity::kDebugApi, _, _))
+                                 .LR_SIDE_EFFECT(messages.emplace_back(_2, _3)));
+    } else {
+      expectations.push_back(NAMED_FORBID_CALL(*logger, logStructured(_, _, _)));
+    }
+    expectations.push_back(NAMED_ALLOW_CALL(*managerInterface, identifier())
+                               .RETURN("org.openassetio.test.manager"));
+    expectations.push_back(NAMED_ALLOW_CALL(*managerInterface, resolve(_, _, _, _, _, _, _))
+                               .SIDE_EFFECT(resolveByReference(_1, _6, _7)));
+  }
+
+  const std::shared_ptr<MockManagerInterface> managerInterface =
+      std::make_shared<MockManagerInterface>();
+  const std::shared_ptr<MockStructuredLoggerInterface> logger =
+      std::make_shared<MockStructuredLoggerInterface>();
+  const hostApi::ManagerPtr manager;
+
+  // kDebugApi messages, in the order they were logged.
+  std::vector<std::pair<Str, InfoDictionary>> messages;
+
+ private:
+  static hostApi::Manager::Options optionsWith(hostApi::ManagerMetricsPtr metrics) {
+    hostApi::Manager::Options options;
+    options.metrics = std::move(metrics);
+    return options;
+  }
+
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+
+void resolve(const hostApi::ManagerPtr& manager, const EntityReferences& entityReferences) {
+  manager->resolve(
+      entityReferences, {"aTrait"}, ResolveAccess::kRead, Context::make(),
+      [](std::size_t, const trait::TraitsDataPtr&) {}, [](std::size_t, BatchElementError) {});
+}
+
+void resolveColumnar(const hostApi::ManagerPtr& manager,
+                     const EntityReferences& entityReferences) {
+  trait::TraitsDataTable results;
+  manager->resolveColumnar(entityReferences, {"aTrait"}, ResolveAccess::kRead, Context::make(),
+                           results, [](std::size_t, BatchElementError) {});
+}
+}  // namespace
+
+SCENARIO("Tracing Manager API calls") {
+  GIVEN("a manager whose logger presents kDebugApi messages") {
+    TraceFixture fixture{true};
+    const hostApi::ManagerPtr& manager = fixture.manager;
+
+    WHEN("a batch is resolved") {
+      resolve(manager, {EntityReference{"a"}, EntityReference{"error"}, EntityReference{"b"}});
+
+      THEN("entry and exit of the call are logged, with the outcome of the batch") {
+        REQUIRE(fixture.messages.size() == 2);
+
+        const auto& [entryMessage, entryFields] = fixture.messages[0];
+        CHECK(entryMessage == "-> resolve");
+        CHECK(entryFields == InfoDictionary{{"method", Str{"resolve"}},
+                                            {"manager", Str{"org.openassetio.test.manager"}},
+                                            {"batchSize", Int{3}}});
+
+        const auto& [exitMessage, exitFields] = fixture.messages[1];
+        CHECK(exitMessage == "<- resolve");
+        CHECK(std::get<Int>(exitFields.at("batchSize")) == 3);
+        CHECK(std::get<Int>(exitFields.at("successCount")) == 2);
+        CHECK(std::get<Int>(exitFields.at("errorCount")) == 1);
+        CHECK(std::get<Str>(exitFields.at("outcome")) == "returned");
+        CHECK(std::get<Float>(exitFields.at("elapsedMs")) >= 0.0);
+      }
+    }
+
+    WHEN("a batch is resolved into a columnar table") {
+      resolveColumnar(manager,
+                      {EntityReference{"a"}, EntityReference{"error"}, EntityReference{"b"}});
+
+      THEN("the call is logged, with entities not reported as errors as successes") {
+        REQUIRE(fixture.messages.size() == 2);
+        CHECK(fixture.messages[0].first == "-> resolve");
+        const auto& [exitMessage, exitFields] = fixture.messages[1];
+        CHECK(exitMessage == "<- resolve");
+        CHECK(std::get<Int>(exitFields.at("successCount")) == 2);
+        CHECK(std::get<Int>(exitFields.at("errorCount")) == 1);
+        CHECK(std::get<Str>(exitFields.at("outcome")) == "returned");
+      }
+    }
+
+    WHEN("a batch fails with an exception") {
+      CHECK_THROWS_AS(resolve(manager, {EntityReference{"a"}, EntityReference{"throw"}}),
+                      openassetio::errors::InputValidationException);
+
+      THEN("the exit of the call is logged with the exception outcome") {
+        REQUIRE(fixture.messages.size() == 2);
+        const InfoDictionary& exitFields = fixture.messages[1].second;
+        CHECK(std::get<Int>(exitFields.at("successCount")) == 1);
+        CHECK(std::get<Str>(exitFields.at("outcome")) == "exception");
+      }
+    }
+  }
+
+  GIVEN("a manager whose logger does not present kDebugApi messages") {
+    TraceFixture fixture{false};
+    const hostApi::ManagerPtr& manager = fixture.manager;
+
+    WHEN("a batch is resolved") {
+      resolve(manager, {EntityReference{"a"}});
+
+      THEN("no trace is logged") { CHECK(fixture.messages.empty()); }
+    }
+  }
+}
+
+SCENARIO("Reporting Manager API calls as spans") {
+  GIVEN("a manager, and a global tracer") {
+    TraceFixture fixture{false};
+    const hostApi::ManagerPtr& manager = fixture.manager;
+    const auto tracer = RingBufferTracer::make();
+    TracerInterface::setGlobalTracer(tracer);
+
+    WHEN("a batch is resolved") {
+      resolve(manager, {EntityReference{"a"}, EntityReference{"error"}});
+
+      THEN("a span is reported with attributes describing the call") {
+        const std::vector<RingBufferTracer::Span> spans = tracer->spans();
+        REQUIRE(spans.size() == 1);
+        CHECK(spans[0].name == "Manager.resolve");
+        const InfoDictionary& attributes = spans[0].attributes;
+        CHECK(std::get<Str>(attributes.at("manager")) == "org.openassetio.test.manager");
+        CHECK(std::get<Int>(attributes.at("batchSize")) == 2);
+        CHECK(std::get<Int>(attributes.at("successCount")) == 1);
+        CHECK(std::get<Int>(attributes.at("errorCount")) == 1);
+        CHECK(std::get<Str>(attributes.at("outcome")) == "returned");
+      }
+
+      THEN("kDebugApi messages are not logged") { CHECK(fixture.messages.empty()); }
+    }
+
+    TracerInterface::setGlobalTracer(nullptr);
+  }
+}
+
+SCENARIO("Recording Manager API calls to metrics") {
+  GIVEN("a manager with metrics") {
+    const auto metrics = hostApi::ManagerMetrics::make();
+    TraceFixture fixture{false, metrics};
+    const hostApi::ManagerPtr& manager = fixture.manager;
+
+    WHEN("batches are resolved") {
+      resolve(manager, {EntityReference{"a"}, EntityReference{"error"}, EntityReference{"b"}});
+      CHECK_THROWS_AS(resolve(manager, {EntityReference{"throw"}}),
+                      openassetio::errors::InputValidationException);
+
+      THEN("the outcome of each call is recorded") {
+        const hostApi::ManagerMetrics::Snapshot snapshot = metrics->snapshot();
+        const hostApi::ManagerMetrics::MethodStatistics& statistics =
+            snapshot.at(hostApi::ManagerMetrics::Method::kResolve);
+        CHECK(statistics.calls == 2);
+        CHECK(statistics.exceptions == 1);
+        CHECK(statistics.successes == 2);
+        CHECK(statistics.errors[hostApi::ManagerMetrics::errorCodeIndex(
+                  BatchElementError::ErrorCode::kEntityResolutionError)] == 1);
+      }
+
+      THEN("the duration of each call is recorded against its batch size") {
+        const hostApi::ManagerMetrics::Snapshot snapshot = metrics->snapshot();
+        const hostApi::ManagerMetrics::MethodStatistics& statistics =
+            snapshot.at(hostApi::ManagerMetrics::Method::kResolve);
+        CHECK(statistics.batchSizes[hostApi::ManagerMetrics::batchSizeBucketIndex(1)].calls == 1);
+        CHECK(statistics.batchSizes[hostApi::ManagerMetrics::batchSizeBucketIndex(3)].calls == 1);
+      }
+
+      THEN("kDebugApi messages are not logged") { CHECK(fixture.messages.empty()); }
+
+      AND_WHEN("statistics are retrieved") {
+        const auto statistics = manager->statistics();
+
+        THEN("the calls since construction are reported") {
+          REQUIRE(statistics);
+          CHECK(statistics->at(hostApi::ManagerMetrics::Method::kResolve).calls == 2);
+        }
+
+        AND_WHEN("statistics are retrieved again") {
+          resolve(manager, {EntityReference{"a"}});
+          const auto nextStatistics = manager->statistics();
+
+          THEN("only calls since the previous retrieval are reported") {
+            REQUIRE(nextStatistics);
+            CHECK(nextStatistics->at(hostApi::ManagerMetrics::Method::kResolve).calls == 1);
+          }
+
+          THEN("the registry's counters are not reset") {
+            CHECK(metrics->snapshot().at(hostApi::ManagerMetrics::Method::kResolve).calls == 3);
+          }
+        }
+      }
+    }
+
+    WHEN("a batch is resolved into a columnar table") {
+      resolveColumnar(manager, {EntityReference{"a"}, EntityReference{"error"}});
+
+      THEN("the outcome of the call is recorded") {
+        const hostApi::ManagerMetrics::MethodStatistics& statistics =
+            metrics->snapshot().at(hostApi::ManagerMetrics::Method::kResolve);
+        CHECK(statistics.calls == 1);
+        CHECK(statistics.successes == 1);
+        CHECK(statistics.errors[hostApi::ManagerMetrics::errorCodeIndex(
+                  BatchElementError::ErrorCode::kEntityResolutionError)] == 1);
+      }
+    }
+  }
+
+  GIVEN("a manager without metrics") {
+    TraceFixture fixture{false};
+    const hostApi::ManagerPtr& manager = fixture.manager;
+
+    THEN("no statistics are available") { CHECK_FALSE(manager->statistics()); }
+  }
+}
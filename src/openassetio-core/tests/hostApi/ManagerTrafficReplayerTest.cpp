@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerTrafficReplayer.hpp>
+#include <openassetio/hostApi/RecordingManagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::PublishingAccess;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::errors::InputValidationException;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/// Whether the manager plugin should fail to resolve the entity.
+bool isMissing(const EntityReference& entityReference) {
+  return entityReference.toString().rfind("missing", 0) == 0;
+}
+
+/// Resolve entities, erroring for references beginning "missing".
+void resolveUnlessMissing(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    if (isMissing(entityReferences[idx])) {
+      errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError,
+                                           "missing"});
+    } else {
+      successCallback(idx, trait::TraitsData::make());
+    }
+  }
+}
+
+/// Register entities to their own references.
+void registerToSelf(const EntityReferences& entityReferences,
+                    const managerApi::ManagerInterface::RegisterSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, entityReferences[idx]);
+  }
+}
+
+/// Whether the locale of the context has the given trait.
+bool localeHasTrait(const ContextConstPtr& context, const Str& traitId) {
+  return context->locale->hasTrait(traitId);
+}
+
+/// Manager wrapping the given interface, initialized via the mock.
+hostApi::ManagerPtr makeManager(managerApi::ManagerInterfacePtr managerInterface,
+                                MockManagerInterface& mockManagerInterface) {
+  auto manager = hostApi::Manager::make(std::move(managerInterface), makeMockHostSession());
+  initializeManager(*manager, mockManagerInterface);
+  return manager;
+}
+
+/// Temporary file, removed on destruction.
+struct TempFile {
+  TempFile()
+      : path{(std::filesystem::temp_directory_path() /
+              ("openassetio-ManagerTrafficReplayerTest-" + std::to_string(++counter()) +
+               ".oamt"))
+                 .string()} {
+    std::filesystem::remove(path);
+  }
+  ~TempFile() { std::filesystem::remove(path); }
+
+  TempFile(const TempFile&) = delete;
+  TempFile(TempFile&&) noexcept = delete;
+  TempFile& operator=(const TempFile&) = delete;
+  TempFile& operator=(TempFile&&) noexcept = delete;
+
+  void write(const Str& contents) const {
+    std::ofstream stream{path, std::ios::binary};
+    stream << contents;
+  }
+
+  static std::size_t& counter() {
+    static std::size_t count = 0;
+    return count;
+  }
+
+  Str path;
+};
+}  // namespace
+
+SCENARIO("Recording and replaying manager traffic") {
+  const TempFile logFile;
+
+  GIVEN("traffic recorded from a Manager") {
+    {
+      const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+      const auto recordingInterface =
+          hostApi::RecordingManagerInterface::make(mockManagerInterface, logFile.path);
+      const auto manager = makeManager(recordingInterface, *mockManagerInterface);
+
+      const auto context = manager->createContext();
+      context->locale->addTrait("locale.trait");
+      const auto noop = [](std::size_t, const auto&) {};
+
+      ALLOW_CALL(*mockManagerInterface, resolve(_, _, _, _, _, _, _))
+          .SIDE_EFFECT(resolveUnlessMissing(_1, _6, _7));
+      REQUIRE_CALL(*mockManagerInterface, entityExists(_, _, _, _, _))
+          .THROW(std::runtime_error{"backend unavailable"});
+      REQUIRE_CALL(*mockManagerInterface, register_(_, _, _, _, _, _, _))
+          .SIDE_EFFECT(registerToSelf(_1, _6));
+
+      manager->resolve({EntityReference{"a"}, EntityReference{"missing"}}, {"trait"},
+                       ResolveAccess::kRead, context, noop, noop);
+      manager->resolve({EntityReference{"b"}}, {"other"}, ResolveAccess::kRead, context, noop,
+                       noop);
+      CHECK_THROWS(manager->entityExists({EntityReference{"a"}}, context, noop, noop));
+      manager->register_({EntityReference{"c"}}, {trait::TraitsData::make()},
+                         PublishingAccess::kWrite, context, noop, noop);
+      recordingInterface->flush();
+    }
+
+    AND_GIVEN("a Manager to replay to") {
+      const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+      const auto manager = makeManager(mockManagerInterface, *mockManagerInterface);
+
+      const EntityReferences firstEntityReferences{EntityReference{"a"},
+                                                   EntityReference{"missing"}};
+      const trait::TraitSet firstTraitSet{"trait"};
+      const EntityReferences secondEntityReferences{EntityReference{"b"}};
+      const trait::TraitSet secondTraitSet{"other"};
+
+      REQUIRE_CALL(*mockManagerInterface,
+                   resolve(firstEntityReferences, firstTraitSet, ResolveAccess::kRead, _, _, _, _))
+          .WITH(localeHasTrait(_4, "locale.trait"))
+          .SIDE_EFFECT(resolveUnlessMissing(_1, _6, _7));
+      REQUIRE_CALL(*mockManagerInterface, resolve(secondEntityReferences, secondTraitSet,
+                                                  ResolveAccess::kRead, _, _, _, _))
+          .WITH(localeHasTrait(_4, "locale.trait"))
+          .SIDE_EFFECT(resolveUnlessMissing(_1, _6, _7));
+      REQUIRE_CALL(*mockManagerInterface, entityExists(_, _, _, _, _))
+          .THROW(std::runtime_error{"backend unavailable"});
+
+      WHEN("the traffic is replayed") {
+        FORBID_CALL(*mockManagerInterface, register_(_, _, _, _, _, _, _));
+
+        const hostApi::ManagerTrafficReplayer::Report report =
+            hostApi::ManagerTrafficReplayer::make(manager, 0)->replay(logFile.path);
+
+        THEN("the outcome of each method is reported") {
+          const auto& resolveReport = report.at("resolve");
+          CHECK(resolveReport.calls == 2);
+          CHECK(resolveReport.successes == 2);
+          CHECK(resolveReport.errors == 1);
+          CHECK(resolveReport.exceptions == 0);
+          CHECK(resolveReport.recordedDuration > std::chrono::nanoseconds{0});
+          CHECK(resolveReport.replayedDuration > std::chrono::nanoseconds{0});
+
+          const auto& existsReport = report.at("entityExists");
+          CHECK(existsReport.calls == 1);
+          CHECK(existsReport.exceptions == 1);
+        }
+
+        THEN("publishing calls are skipped") {
+          CHECK(report.at("register").calls == 0);
+          CHECK(report.at("register").skipped == 1);
+        }
+      }
+
+      WHEN("the traffic is replayed including publishing calls") {
+        const EntityReferences registeredEntityReferences{EntityReference{"c"}};
+        REQUIRE_CALL(*mockManagerInterface, register_(registeredEntityReferences, _,
+                                                      PublishingAccess::kWrite, _, _, _, _))
+            .SIDE_EFFECT(registerToSelf(_1, _6));
+
+        const hostApi::ManagerTrafficReplayer::Report report =
+            hostApi::ManagerTrafficReplayer::make(manager, 0, true)->replay(logFile.path);
+
+        THEN("publishing calls are reissued to the manager") {
+          CHECK(report.at("register").calls == 1);
+          CHECK(report.at("register").successes == 1);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Manager traffic replay errors") {
+  const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+  const auto manager = makeManager(mockManagerInterface, *mockManagerInterface);
+  const auto replayer = hostApi::ManagerTrafficReplayer::make(manager);
+  const TempFile logFile;
+  GIVEN("a file that is not a manager traffic log") {
+    logFile.write("not a log");
+
+    THEN("replay throws") {
+      CHECK_THROWS_AS(replayer->replay(logFile.path), InputValidationException);
+    }
+  }
+
+  GIVEN("a log that is truncated part way through a record") {
+    {
+      // Only the header is written.
+      const auto recordingInterface =
+          hostApi::RecordingManagerInterface::make(mockManagerInterface, logFile.path);
+    }
+    std::ofstream{logFile.path, std::ios::binary | std::ios::app} << "\x10\x00";
+
+    THEN("replay throws") {
+      CHECK_THROWS_AS(replayer->replay(logFile.path), InputValidationException);
+    }
+  }
+
+  GIVEN("a log file that does not exist") {
+    THEN("replay throws") {
+      CHECK_THROWS_AS(replayer->replay(logFile.path), InputValidationException);
+    }
+  }
+
+  GIVEN("invalid arguments to make") {
+    THEN("construction throws") {
+      CHECK_THROWS_AS(hostApi::ManagerTrafficReplayer::make(nullptr), InputValidationException);
+      CHECK_THROWS_AS(hostApi::ManagerTrafficReplayer::make(manager, -1),
+                      InputValidationException);
+      CHECK_THROWS_AS(hostApi::RecordingManagerInterface::make(nullptr, logFile.path),
+                      InputValidationException);
+    }
+  }
+}
@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::RelationsAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/// Pager returning a fixed list of entities as a single page.
+struct SinglePagePagerInterface : managerApi::EntityReferencePagerInterface {
+  explicit SinglePagePagerInterface(EntityReferences entityReferences)
+      : entityReferences_{std::move(entityReferences)} {}
+
+  bool hasNext(const managerApi::HostSessionPtr&) override { return false; }
+  Page get(const managerApi::HostSessionPtr&) override { return entityReferences_; }
+  void next(const managerApi::HostSessionPtr&) override { entityReferences_.clear(); }
+
+ private:
+  EntityReferences entityReferences_;
+};
+
+/// Relationships between entities, keyed by the relationship's trait.
+using Graph = std::map<Str, std::map<Str, EntityReferences>>;
+
+/**
+ * Report the entities related to each input in the graph, under the
+ * relationship's trait. Queries of "broken" fail.
+ */
+void relationsFromGraph(
+    const Graph& graph, const EntityReferences& entityReferences,
+    const trait::TraitsDataPtr& relationshipTraitsData,
+    const managerApi::ManagerInterface::RelationshipQuerySuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  const auto edgesIter = graph.find(*relationshipTraitsData->traitSet().begin());
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "broken") {
+      errorCallback(idx, BatchElementError{BatchElementError::ErrorCode::kUnknown, ref});
+      continue;
+    }
+    EntityReferences related;
+    if (edgesIter != graph.end()) {
+      if (const auto iter = edgesIter->second.find(ref); iter != edgesIter->second.end()) {
+        related = iter->second;
+      }
+    }
+    successCallback(idx, std::make_shared<SinglePagePagerInterface>(std::move(related)));
+  }
+}
+
+/// Mock manager that also mocks native relationship traversal.
+struct MockTraversingManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK9(traverseRelationships);
+};
+
+EntityReferences refs(const std::vector<Str>& strs) {
+  EntityReferences entityReferences;
+  for (const Str& str : strs) {
+    entityReferences.emplace_back(str);
+  }
+  return entityReferences;
+}
+
+trait::TraitsDatas relationships(const std::vector<Str>& traitIds) {
+  trait::TraitsDatas traitsDatas;
+  for (const Str& traitId : traitIds) {
+    traitsDatas.push_back(trait::TraitsData::make({traitId}));
+  }
+  return traitsDatas;
+}
+
+/// Result of traversing from an input: the entities of each hop, or
+/// an error.
+using Result = std::optional<std::vector<EntityReferences>>;
+
+std::vector<Result> traverse(const hostApi::ManagerPtr& manager,
+                             const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& relationshipTraitsDatas,
+                             const std::size_t maxDepth) {
+  std::vector<Result> results(entityReferences.size());
+  manager->traverseRelationships(
+      entityReferences, relationshipTraitsDatas, maxDepth, RelationsAccess::kRead,
+      manager->createContext(),
+      [&](const std::size_t idx, std::vector<EntityReferences> levels) {
+        results[idx] = std::move(levels);
+      },
+      [](std::size_t, const BatchElementError&) {});
+  return results;
+}
+
+hostApi::ManagerPtr makeManager(
+    const std::shared_ptr<MockManagerInterface>& mockManagerInterface) {
+  auto manager = hostApi::Manager::make(mockManagerInterface, makeMockHostSession());
+  initializeManager(*manager, *mockManagerInterface);
+  return manager;
+}
+}  // namespace
+
+SCENARIO("Traversing relationships host-side") {
+  GIVEN("a manager with a graph of dependencies and an ownership relationship") {
+    const auto mockManagerInterface = std::make_shared<MockManagerInterface>();
+    const auto manager = makeManager(mockManagerInterface);
+    // a -> b -> c -> a, a -> d, x -> b, b owned by "owner".
+    Graph graph;
+    graph["dependsOn"] = {{"a", refs({"b", "d"})},
+                          {"b", refs({"c"})},
+                          {"c", refs({"a"})},
+                          {"x", refs({"b", "broken"})}};
+    graph["ownedBy"] = {{"b", refs({"owner"})}, {"d", refs({"owner"})}};
+
+    std::vector<EntityReferences> batches;
+    ALLOW_CALL(*mockManagerInterface, getWithRelationship(_, _, _, _, _, _, _, _, _))
+        .LR_SIDE_EFFECT(batches.push_back(_1))
+        .LR_SIDE_EFFECT(relationsFromGraph(graph, _1, _2, _8, _9));
+
+    WHEN("a single relationship is traversed recursively") {
+      const std::vector<Result> results =
+          traverse(manager, refs({"a"}), relationships({"dependsOn"}), 10);
+
+      THEN("entities are grouped by first hop, excluding the input and cycles") {
+        CHECK(results ==
+              std::vector<Result>{std::vector<EntityReferences>{refs({"b", "d"}), refs({"c"})}});
+      }
+    }
+
+    WHEN("the traversal is limited in depth") {
+      const std::vector<Result> results =
+          traverse(manager, refs({"a"}), relationships({"dependsOn"}), 1);
+
+      THEN("only that many hops are followed") {
+        CHECK(results == std::vector<Result>{std::vector<EntityReferences>{refs({"b", "d"})}});
+      }
+    }
+
+    WHEN("a chain of relationships is traversed") {
+      const std::vector<Result> results =
+          traverse(manager, refs({"a"}), relationships({"dependsOn", "ownedBy"}), 2);
+
+      THEN("each hop follows the corresponding relationship") {
+        CHECK(results == std::vector<Result>{std::vector<EntityReferences>{refs({"b", "d"}),
+                                                                           refs({"owner"})}});
+      }
+    }
+
+    WHEN("several entities are traversed") {
+      const std::vector<Result> results =
+          traverse(manager, refs({"a", "c"}), relationships({"dependsOn"}), 10);
+
+      THEN("each hop is a single query covering all entities, without duplicates") {
+        CHECK(batches ==
+              std::vector<EntityReferences>{refs({"a", "c"}), refs({"b", "d", "a"}),
+                                            refs({"c", "b", "d"})});
+        CHECK(results ==
+              std::vector<Result>{
+                  std::vector<EntityReferences>{refs({"b", "d"}), refs({"c"})},
+                  std::vector<EntityReferences>{refs({"a"}), refs({"b", "d"})}});
+      }
+    }
+
+    WHEN("an entity reached from an input fails to be queried") {
+      const std::vector<Result> results =
+          traverse(manager, refs({"x", "a"}), relationships({"dependsOn"}), 10);
+
+      THEN("the traversal from that input fails, and others succeed") {
+        CHECK_FALSE(results[0]);
+        CHECK(results[1] == std::vector<EntityReferences>{refs({"b", "d"}), refs({"c"})});
+      }
+    }
+
+    WHEN("an entity with no relations is traversed") {
+      const std::vector<Result> results =
+          traverse(manager, refs({"owner"}), relationships({"dependsOn"}), 10);
+
+      THEN("the traversal is empty") {
+        CHECK(results == std::vector<Result>{std::vector<EntityReferences>{}});
+      }
+    }
+
+    WHEN("an empty chain of relationships is traversed") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(traverse(manager, refs({"a"}), {}, 10),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a manager that traverses natively") {
+    const auto mockManagerInterface = std::make_shared<MockTraversingManagerInterface>();
+    const auto manager = makeManager(mockManagerInterface);
+
+    WHEN("relationships are traversed") {
+      const std::vector<EntityReferences> native{refs({"native"})};
+      REQUIRE_CALL(*mockManagerInterface, traverseRelationships(_, _, _, _, _, _, _, _, _))
+          .LR_SIDE_EFFECT(_8(0, native));
+
+      const std::vector<Result> results =
+          traverse(manager, refs({"a"}), relationships({"dependsOn"}), 10);
+
+      THEN("the manager's implementation is used, without querying each hop") {
+        CHECK(results ==
+              std::vector<Result>{std::vector<EntityReferences>{refs({"native"})}});
+      }
+    }
+  }
+}
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+using openassetio::ContextPtr;
+using openassetio::Str;
+using trompeloeil::_;
+
+/// State that simply wraps its persistence token.
+struct StubManagerState : managerApi::ManagerStateBase {
+  explicit StubManagerState(Str token) : token{std::move(token)} {}
+  Str token;
+};
+
+/// Mock stateful manager, supporting persistence of its states.
+struct MockStatefulManagerInterface : openassetio::testSupport::MockManagerInterface {
+  IMPLEMENT_MOCK1(createState);
+  IMPLEMENT_MOCK2(persistenceTokenForState);
+  IMPLEMENT_MOCK2(stateFromPersistenceToken);
+};
+
+Str tokenOf(const managerApi::ManagerStateBasePtr& state) {
+  return std::static_pointer_cast<StubManagerState>(state)->token;
+}
+
+hostApi::ManagerPtr makeManager(managerApi::ManagerInterfacePtr managerInterface,
+                                const managerApi::HostSessionPtr& hostSession,
+                                const std::size_t persistenceTokenCacheCapacity) {
+  hostApi::Manager::Options options;
+  options.persistenceTokenCacheCapacity = persistenceTokenCacheCapacity;
+  return hostApi::Manager::make(std::move(managerInterface), hostSession, options);
+}
+}  // namespace
+
+SCENARIO("Caching manager states restored from persistence tokens") {
+  const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+  const auto managerInterface = std::make_shared<MockStatefulManagerInterface>();
+  auto& mockManagerInterface = *managerInterface;
+  ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(true);
+
+  GIVEN("a stateful manager with a persistence token cache") {
+    const hostApi::ManagerPtr manager = makeManager(managerInterface, hostSession, 2);
+
+    WHEN("contexts are restored from the same token") {
+      // The manager is queried once.
+      REQUIRE_CALL(mockManagerInterface, stateFromPersistenceToken("a", hostSession))
+          .RETURN(std::make_shared<StubManagerState>(_1));
+
+      const ContextPtr context1 = manager->contextFromPersistenceToken("a");
+      const ContextPtr context2 = manager->contextFromPersistenceToken("a");
+
+      THEN("the restored state is shared") {
+        CHECK(context1->managerState == context2->managerState);
+      }
+
+      AND_WHEN("the token of a restored context is requested") {
+        FORBID_CALL(mockManagerInterface, persistenceTokenForState(_, _));
+
+        const Str token = manager->persistenceTokenForContext(context2);
+
+        THEN("the token is returned without querying the manager") { CHECK(token == "a"); }
+      }
+    }
+
+    WHEN("the token of a created context is requested") {
+      REQUIRE_CALL(mockManagerInterface, createState(hostSession))
+          .RETURN(std::make_shared<StubManagerState>("new"));
+      REQUIRE_CALL(mockManagerInterface, persistenceTokenForState(_, hostSession))
+          .RETURN(tokenOf(_1));
+
+      const Str token = manager->persistenceTokenForContext(manager->createContext());
+
+      THEN("the manager is queried") { CHECK(token == "new"); }
+    }
+
+    WHEN("more distinct tokens are restored than the cache capacity") {
+      REQUIRE_CALL(mockManagerInterface, stateFromPersistenceToken(_, hostSession))
+          .TIMES(4)
+          .RETURN(std::make_shared<StubManagerState>(_1));
+      REQUIRE_CALL(mockManagerInterface, persistenceTokenForState(_, hostSession))
+          .RETURN(tokenOf(_1));
+
+      const ContextPtr contextA = manager->contextFromPersistenceToken("a");
+      manager->contextFromPersistenceToken("b");
+      manager->contextFromPersistenceToken("c");
+
+      THEN("the least recently used state is evicted") {
+        CHECK(manager->contextFromPersistenceToken("a")->managerState != contextA->managerState);
+        CHECK(manager->persistenceTokenForContext(contextA) == "a");
+      }
+    }
+
+    WHEN("caches are flushed after a context is restored") {
+      THEN("the manager is queried again") {
+        REQUIRE_CALL(mockManagerInterface, stateFromPersistenceToken("a", hostSession))
+            .TIMES(2)
+            .RETURN(std::make_shared<StubManagerState>(_1));
+        REQUIRE_CALL(mockManagerInterface, flushCaches(hostSession));
+
+        manager->contextFromPersistenceToken("a");
+        manager->flushCaches();
+        manager->contextFromPersistenceToken("a");
+      }
+    }
+
+    WHEN("an empty token is restored") {
+      FORBID_CALL(mockManagerInterface, stateFromPersistenceToken(_, _));
+
+      const ContextPtr context = manager->contextFromPersistenceToken("");
+
+      THEN("the context has no manager state") { CHECK_FALSE(context->managerState); }
+    }
+  }
+
+  GIVEN("a stateful manager without a persistence token cache") {
+    const hostApi::ManagerPtr manager = makeManager(managerInterface, hostSession, 0);
+
+    WHEN("contexts are restored from the same token") {
+      // The manager is queried each time.
+      REQUIRE_CALL(mockManagerInterface, stateFromPersistenceToken("a", hostSession))
+          .TIMES(2)
+          .RETURN(std::make_shared<StubManagerState>(_1));
+
+      const ContextPtr context1 = manager->contextFromPersistenceToken("a");
+      const ContextPtr context2 = manager->contextFromPersistenceToken("a");
+
+      THEN("the states are distinct") { CHECK(context1->managerState != context2->managerState); }
+    }
+
+    WHEN("many tokens are restored in a batch") {
+      // Each distinct token is restored once.
+      REQUIRE_CALL(mockManagerInterface, stateFromPersistenceToken("a", hostSession))
+          .RETURN(std::make_shared<StubManagerState>(_1));
+      REQUIRE_CALL(mockManagerInterface, stateFromPersistenceToken("b", hostSession))
+          .RETURN(std::make_shared<StubManagerState>(_1));
+
+      const std::vector<ContextPtr> contexts =
+          manager->contextsFromPersistenceTokens({"a", "b", "", "a"});
+
+      THEN("the restored contexts are in order") {
+        REQUIRE(contexts.size() == 4);
+        CHECK(tokenOf(contexts[0]->managerState) == "a");
+        CHECK(tokenOf(contexts[1]->managerState) == "b");
+        CHECK_FALSE(contexts[2]->managerState);
+        CHECK(contexts[3]->managerState == contexts[0]->managerState);
+      }
+    }
+  }
+}
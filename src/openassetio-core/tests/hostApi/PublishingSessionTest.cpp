@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <memory>
+#include <optional>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/PublishingSession.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::PublishingAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::ManagerFixture;
+using trompeloeil::_;
+
+/**
+ * Respond to a publishing batch as a manager plugin would, mapping each
+ * entity to its reference with the given suffix.
+ *
+ * The reference "error" leads to an element error, and "throw" fails
+ * the whole batch.
+ */
+void respond(const EntityReferences& entityReferences, const Str& suffix,
+             const managerApi::ManagerInterface::RegisterSuccessCallback& successCallback,
+             const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "throw") {
+      throw openassetio::errors::InputValidationException{"batch failed"};
+    }
+    if (ref == "error") {
+      errorCallback(idx, {BatchElementError::ErrorCode::kEntityAccessError, "bad entity"});
+      continue;
+    }
+    successCallback(idx, EntityReference{ref + suffix});
+  }
+}
+
+/**
+ * Fixture providing a Manager whose mock manager plugin counts batch
+ * calls, preflighting each entity to "<ref>/working" and registering
+ * each to "<ref>/final".
+ */
+struct PublishingFixture : ManagerFixture {
+  PublishingFixture() {
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mockManagerInterface,
+                         preflight(_, _, PublishingAccess::kWrite, _, hostSession, _, _))
+            .LR_SIDE_EFFECT(++preflightCount)
+            .SIDE_EFFECT(respond(_1, "/working", _6, _7)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(mockManagerInterface,
+                         register_(_, _, PublishingAccess::kWrite, _, hostSession, _, _))
+            .LR_SIDE_EFFECT(++registerCount)
+            .SIDE_EFFECT(respond(_1, "/final", _6, _7)));
+  }
+
+  // Only modified by mock side effects, which are serialised.
+  std::size_t preflightCount = 0;
+  std::size_t registerCount = 0;
+
+ private:
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+
+EntityReferences makeRefs(const std::size_t count) {
+  EntityReferences refs;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    refs.emplace_back("test:///" + std::to_string(idx));
+  }
+  return refs;
+}
+}  // namespace
+
+SCENARIO("PublishingSession construction") {
+  const PublishingFixture fixture;
+
+  THEN("a null manager or context, or zero chunk size is rejected") {
+    CHECK_THROWS_AS(
+        hostApi::PublishingSession::make(nullptr, PublishingAccess::kWrite, Context::make()),
+        openassetio::errors::InputValidationException);
+    CHECK_THROWS_AS(
+        hostApi::PublishingSession::make(fixture.manager, PublishingAccess::kWrite, nullptr),
+        openassetio::errors::InputValidationException);
+    CHECK_THROWS_AS(hostApi::PublishingSession::make(fixture.manager, PublishingAccess::kWrite,
+                                                     Context::make(), 0),
+                    openassetio::errors::InputValidationException);
+  }
+}
+
+SCENARIO("PublishingSession publishing") {
+  GIVEN("a session with a small chunk size") {
+    const PublishingFixture fixture;
+    const hostApi::PublishingSessionPtr session = hostApi::PublishingSession::make(
+        fixture.manager, PublishingAccess::kWrite, fixture.context, 4);
+    const EntityReferences refs = makeRefs(10);
+    const trait::TraitsDatas hints(refs.size(), trait::TraitsData::make());
+
+    WHEN("entities are preflighted") {
+      auto stream = session->preflight(refs, hints);
+      std::vector<std::optional<EntityReference>> working(refs.size());
+      while (auto element = stream.next()) {
+        working[element->first] = std::get<EntityReference>(element->second);
+      }
+
+      THEN("working references are streamed for every entity, in chunks") {
+        for (std::size_t idx = 0; idx < refs.size(); ++idx) {
+          REQUIRE(working[idx]);
+          CHECK(working[idx]->toString() == refs[idx].toString() + "/working");
+        }
+        CHECK(fixture.preflightCount == 3);
+      }
+
+      AND_WHEN("each is registered from multiple threads and the session finished") {
+        std::vector<std::thread> threads;
+        for (std::size_t threadIdx = 0; threadIdx < 2; ++threadIdx) {
+          threads.emplace_back([&, threadIdx] {
+            for (std::size_t idx = threadIdx; idx < refs.size(); idx += 2) {
+              session->register_(idx, *working[idx], trait::TraitsData::make());
+            }
+          });
+        }
+        for (auto& thread : threads) {
+          thread.join();
+        }
+        const std::vector<hostApi::PublishingSession::Element> results = session->finish();
+
+        THEN("final references are returned in index order, in grouped batches") {
+          REQUIRE(results.size() == refs.size());
+          for (std::size_t idx = 0; idx < refs.size(); ++idx) {
+            CHECK(results[idx].first == idx);
+            CHECK(std::get<EntityReference>(results[idx].second).toString() ==
+                  refs[idx].toString() + "/working/final");
+          }
+          CHECK(fixture.registerCount == 3);
+        }
+
+        AND_THEN("a further finish returns nothing") { CHECK(session->finish().empty()); }
+      }
+    }
+
+    WHEN("an entity fails to register") {
+      session->register_(0, EntityReference{"error"}, trait::TraitsData::make());
+      session->register_(1, EntityReference{"ok"}, trait::TraitsData::make());
+      const std::vector<hostApi::PublishingSession::Element> results = session->finish();
+
+      THEN("its error is returned alongside the other results") {
+        REQUIRE(results.size() == 2);
+        CHECK(std::get<BatchElementError>(results[0].second).code ==
+              BatchElementError::ErrorCode::kEntityAccessError);
+        CHECK(std::get<EntityReference>(results[1].second).toString() == "ok/final");
+      }
+    }
+
+    WHEN("a registration batch fails as a whole") {
+      session->register_(0, EntityReference{"throw"}, trait::TraitsData::make());
+
+      THEN("finish rethrows the exception") {
+        CHECK_THROWS_AS(session->finish(), openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("a preflight chunk fails as a whole") {
+      EntityReferences failingRefs = refs;
+      failingRefs[5] = EntityReference{"throw"};
+      auto stream = session->preflight(failingRefs, hints);
+
+      THEN("results of earlier chunks are streamed, then the exception is rethrown") {
+        std::size_t count = 0;
+        CHECK_THROWS_AS(
+            [&] {
+              while (stream.next()) {
+                ++count;
+              }
+            }(),
+            openassetio::errors::InputValidationException);
+        CHECK(count == 5);
+        CHECK(fixture.preflightCount == 2);
+      }
+    }
+
+    THEN("batches of differing length are rejected") {
+      CHECK_THROWS_AS(session->preflight(refs, {}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
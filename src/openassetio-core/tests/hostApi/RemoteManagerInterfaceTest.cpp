@@ -0,0 +1,372 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#if !defined(_WIN32)
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/RemoteManagerInterface.hpp>
+#include <openassetio/hostApi/RemoteManagerServer.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::access::PublishingAccess;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::errors::BatchElementException;
+using openassetio::errors::OpenAssetIOException;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+using ErrorPolicyTag = hostApi::Manager::BatchElementErrorPolicyTag;
+using Capability = managerApi::ManagerInterface::Capability;
+
+/// Mock manager, also mocking the settings sent to it.
+struct MockRemoteManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK1(settings);
+};
+
+/**
+ * Resolve the reference and the locale's "frame" into a trait
+ * property, erroring for references beginning "missing" and raising for
+ * references beginning "raise".
+ */
+void resolveWithLocale(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref.rfind("raise", 0) == 0) {
+      throw openassetio::errors::InputValidationException{"Mock failure"};
+    }
+    if (ref.rfind("missing", 0) == 0) {
+      errorCallback(idx,
+                    BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError, ref});
+      continue;
+    }
+    openassetio::trait::property::Value frame;
+    context->locale->getTraitProperty(&frame, "locale", "frame");
+    auto traitsData = trait::TraitsData::make();
+    traitsData->setTraitProperty("resolved", "ref", ref);
+    traitsData->setTraitProperty("resolved", "frame", frame);
+    successCallback(idx, traitsData);
+  }
+}
+
+/// Report entities as existing unless their reference begins "missing".
+void existsUnlessMissing(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ExistsSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, entityReferences[idx].toString().rfind("missing", 0) != 0);
+  }
+}
+
+/// Register entities to a new version of their reference.
+void registerNewVersion(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::RegisterSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, EntityReference{entityReferences[idx].toString() + "#v1"});
+  }
+}
+
+/// Unique channel name, such that concurrent test runs do not clash.
+Str channelName(const Str& suffix) {
+  return "openassetio-test-" + std::to_string(::getpid()) + "-" + suffix;
+}
+
+/**
+ * Server of a mock manager, run on a background thread.
+ *
+ * The mock is allowed all calls made by the tests below, such that
+ * tests need only expect calls specific to them.
+ */
+struct ServerThread {
+  explicit ServerThread(const Str& name,
+                        std::size_t capacity = hostApi::RemoteManagerServer::kDefaultCapacity)
+      : server{hostApi::RemoteManagerServer::make(mockManagerInterface, makeMockHostSession(),
+                                                  name, capacity)} {
+    expectations.push_back(NAMED_ALLOW_CALL(*mockManagerInterface, identifier())
+                               .RETURN("org.openassetio.test.manager"));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(*mockManagerInterface, displayName()).RETURN("Test Manager"));
+    expectations.push_back(NAMED_ALLOW_CALL(*mockManagerInterface, info())
+                               .RETURN(InfoDictionary{{"answer", openassetio::Int{42}}}));
+    expectations.push_back(NAMED_ALLOW_CALL(*mockManagerInterface, hasCapability(_))
+                               .RETURN(_1 != Capability::kStatefulContexts &&
+                                       _1 != Capability::kRelationshipQueries));
+    expectations.push_back(NAMED_ALLOW_CALL(*mockManagerInterface, initialize(_, _))
+                               .LR_SIDE_EFFECT(settings = _1));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(*mockManagerInterface, settings(_)).LR_RETURN(settings));
+    expectations.push_back(NAMED_ALLOW_CALL(*mockManagerInterface, isEntityReferenceString(_, _))
+                               .RETURN(_1.rfind("stub://", 0) == 0));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(*mockManagerInterface, entityExists(_, _, _, _, _))
+            .SIDE_EFFECT(existsUnlessMissing(_1, _4)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(*mockManagerInterface, resolve(_, _, ResolveAccess::kRead, _, _, _, _))
+            .SIDE_EFFECT(resolveWithLocale(_1, _4, _6, _7)));
+    expectations.push_back(
+        NAMED_ALLOW_CALL(*mockManagerInterface,
+                         register_(_, _, PublishingAccess::kWrite, _, _, _, _))
+            .SIDE_EFFECT(registerNewVersion(_1, _6)));
+
+    thread = std::thread{[this] { server->serve(); }};
+  }
+
+  ~ServerThread() {
+    server->stop();
+    thread.join();
+  }
+
+  ServerThread(const ServerThread&) = delete;
+  ServerThread(ServerThread&&) noexcept = delete;
+  ServerThread& operator=(const ServerThread&) = delete;
+  ServerThread& operator=(ServerThread&&) noexcept = delete;
+
+  const std::shared_ptr<MockRemoteManagerInterface> mockManagerInterface =
+      std::make_shared<MockRemoteManagerInterface>();
+  hostApi::RemoteManagerServerPtr server;
+  std::thread thread;
+
+ private:
+  // Settings most recently given to the mock manager.
+  InfoDictionary settings;
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+}  // namespace
+
+SCENARIO("Calls are forwarded to a remote manager") {
+  GIVEN("a Manager wrapping a RemoteManagerInterface connected to a server") {
+    const Str name = channelName("forward");
+    ServerThread serverThread{name};
+    const auto managerInterface = hostApi::RemoteManagerInterface::make({name});
+    const auto manager = hostApi::Manager::make(managerInterface, makeMockHostSession());
+    manager->initialize({{"setting", Str{"value"}}});
+
+    THEN("the remote manager's identity and capabilities are reported") {
+      CHECK(manager->identifier() == "org.openassetio.test.manager");
+      CHECK(manager->displayName() == "Test Manager");
+      CHECK(std::get<openassetio::Int>(manager->info().at("answer")) == 42);
+      const Str threadSafeKey{openassetio::constants::kInfoKey_IsThreadSafe};
+      CHECK(std::get<bool>(manager->info().at(threadSafeKey)));
+      CHECK(manager->hasCapability(hostApi::Manager::Capability::kResolution));
+      CHECK_FALSE(manager->hasCapability(hostApi::Manager::Capability::kRelationshipQueries));
+    }
+
+    THEN("the settings were sent to the remote manager") {
+      CHECK(std::get<Str>(manager->settings().at("setting")) == "value");
+    }
+
+    WHEN("caches are flushed for specific entities, and by prefix") {
+      const EntityReferences entityReferences{EntityReference{"stub://a"}};
+
+      THEN("the targeted flushes are sent to the remote manager") {
+        auto& mockManagerInterface = *serverThread.mockManagerInterface;
+        REQUIRE_CALL(mockManagerInterface, flushEntityCaches(entityReferences, _));
+        REQUIRE_CALL(mockManagerInterface, flushCachesWithPrefix("stub://", _));
+
+        manager->flushCaches(entityReferences);
+        manager->flushCachesWithPrefix("stub://");
+      }
+    }
+
+    WHEN("an entity is resolved with a locale") {
+      const auto context = manager->createContext();
+      context->locale->setTraitProperty("locale", "frame", openassetio::Int{1001});
+      const auto traitsData = manager->resolve(EntityReference{"stub://a"}, {"resolved"},
+                                               ResolveAccess::kRead, context);
+
+      THEN("the result is computed remotely from the locale") {
+        openassetio::trait::property::Value value;
+        REQUIRE(traitsData->getTraitProperty(&value, "resolved", "ref"));
+        CHECK(std::get<Str>(value) == "stub://a");
+        REQUIRE(traitsData->getTraitProperty(&value, "resolved", "frame"));
+        CHECK(std::get<openassetio::Int>(value) == 1001);
+      }
+    }
+
+    WHEN("a batch with an error is resolved") {
+      const auto context = manager->createContext();
+      const auto results = manager->resolve(
+          {EntityReference{"stub://a"}, EntityReference{"missing"}}, {"resolved"},
+          ResolveAccess::kRead, context, ErrorPolicyTag::kVariant);
+
+      THEN("the error is reported for its element") {
+        CHECK(std::holds_alternative<trait::TraitsDataPtr>(results[0]));
+        const auto& error = std::get<BatchElementError>(results[1]);
+        CHECK(error.code == BatchElementError::ErrorCode::kEntityResolutionError);
+        CHECK(error.message == "missing");
+      }
+    }
+
+    WHEN("the remote manager raises an exception") {
+      const auto context = manager->createContext();
+
+      THEN("an exception with the same message is raised") {
+        CHECK_THROWS_MATCHES(
+            manager->resolve(EntityReference{"raise"}, {"resolved"}, ResolveAccess::kRead,
+                             context),
+            OpenAssetIOException, Catch::Message("Mock failure"));
+      }
+
+      AND_THEN("subsequent calls succeed") {
+        CHECK(manager->isEntityReferenceString("stub://a"));
+      }
+    }
+
+    WHEN("other queries are made") {
+      const auto context = manager->createContext();
+      const auto exists =
+          manager->entityExists({EntityReference{"stub://a"}, EntityReference{"missing"}},
+                                context, ErrorPolicyTag::kErrorSummary);
+      const auto registered =
+          manager->register_(EntityReference{"stub://a"}, trait::TraitsData::make(),
+                             PublishingAccess::kWrite, context);
+
+      THEN("their results are returned") {
+        CHECK(exists.exists == std::vector<bool>{true, false});
+        CHECK(exists.errors.empty());
+        CHECK(registered.toString() == "stub://a#v1");
+        CHECK_FALSE(manager->isEntityReferenceString("other://a"));
+      }
+    }
+  }
+}
+
+SCENARIO("Messages larger than the channel's buffer are streamed") {
+  GIVEN("a server with a small buffer") {
+    const Str name = channelName("small");
+    ServerThread serverThread{name, 64};
+    const auto manager = hostApi::Manager::make(hostApi::RemoteManagerInterface::make({name}),
+                                                makeMockHostSession());
+    manager->initialize({});
+
+    WHEN("a large batch is resolved") {
+      const auto context = manager->createContext();
+      EntityReferences refs;
+      for (std::size_t idx = 0; idx < 100; ++idx) {
+        refs.emplace_back("stub://" + std::to_string(idx));
+      }
+      const auto results =
+          manager->resolve(refs, {"resolved"}, ResolveAccess::kRead, context);
+
+      THEN("all results are received intact") {
+        REQUIRE(results.size() == refs.size());
+        openassetio::trait::property::Value value;
+        REQUIRE(results[99]->getTraitProperty(&value, "resolved", "ref"));
+        CHECK(std::get<Str>(value) == "stub://99");
+      }
+    }
+  }
+}
+
+SCENARIO("Concurrent calls are spread across remote managers") {
+  GIVEN("a RemoteManagerInterface connected to several servers") {
+    const Str firstName = channelName("pool-1");
+    const Str secondName = channelName("pool-2");
+    ServerThread firstServer{firstName};
+    ServerThread secondServer{secondName};
+    const auto manager = hostApi::Manager::make(
+        hostApi::RemoteManagerInterface::make({firstName, secondName}), makeMockHostSession());
+    manager->initialize({});
+
+    WHEN("many threads resolve concurrently") {
+      constexpr std::size_t kThreadCount = 4;
+      constexpr std::size_t kCallCount = 50;
+      std::vector<std::size_t> successes(kThreadCount, 0);
+      std::vector<std::thread> threads;
+      for (std::size_t threadIdx = 0; threadIdx < kThreadCount; ++threadIdx) {
+        threads.emplace_back([&, threadIdx] {
+          const auto context = manager->createContext();
+          for (std::size_t callIdx = 0; callIdx < kCallCount; ++callIdx) {
+            const auto traitsData = manager->resolve(EntityReference{"stub://a"}, {"resolved"},
+                                                     ResolveAccess::kRead, context);
+            successes[threadIdx] += traitsData->hasTrait("resolved") ? 1 : 0;
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      THEN("all calls succeed") {
+        for (const std::size_t count : successes) {
+          CHECK(count == kCallCount);
+        }
+      }
+    }
+
+    WHEN("a server stops") {
+      firstServer.server->stop();
+
+      THEN("calls fail once its channel is dropped, then succeed on the rest") {
+        const auto context = manager->createContext();
+        std::size_t failures = 0;
+        for (std::size_t callIdx = 0; callIdx < 4; ++callIdx) {
+          try {
+            manager->resolve(EntityReference{"stub://a"}, {"resolved"}, ResolveAccess::kRead,
+                             context);
+          } catch (const OpenAssetIOException&) {
+            ++failures;
+          }
+        }
+        CHECK(failures <= 1);
+      }
+    }
+  }
+}
+
+SCENARIO("Connecting to a remote manager") {
+  GIVEN("no server") {
+    THEN("connecting fails") {
+      CHECK_THROWS_AS(hostApi::RemoteManagerInterface::make({channelName("absent")}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  GIVEN("a server with a connected client") {
+    const Str name = channelName("single");
+    ServerThread serverThread{name};
+    const auto managerInterface = hostApi::RemoteManagerInterface::make({name});
+
+    THEN("a second client cannot connect") {
+      CHECK_THROWS_AS(hostApi::RemoteManagerInterface::make({name}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  GIVEN("no channel names") {
+    THEN("construction fails") {
+      CHECK_THROWS_AS(hostApi::RemoteManagerInterface::make({}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+#endif
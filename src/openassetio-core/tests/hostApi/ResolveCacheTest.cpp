@@ -0,0 +1,529 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::access::ResolveAccess;
+
+struct TestState : openassetio::managerApi::ManagerStateBase {};
+
+std::vector<char> readFile(const std::string& path) {
+  std::ifstream file{path, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+void writeFile(const std::string& path, const std::vector<char>& contents) {
+  std::ofstream file{path, std::ios::binary};
+  file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+}  // namespace
+
+SCENARIO("ResolveCache construction") {
+  THEN("zero capacity or shard count is rejected") {
+    CHECK_THROWS_AS(hostApi::ResolveCache::make(0),
+                    openassetio::errors::InputValidationException);
+    CHECK_THROWS_AS(hostApi::ResolveCache::make(1, 0),
+                    openassetio::errors::InputValidationException);
+  }
+}
+
+SCENARIO("ResolveCache lookup") {
+  GIVEN("a cache with an entry") {
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10);
+    const EntityReference ref{"test:///a"};
+    const trait::TraitSet traitSet{"aTrait"};
+    const openassetio::ContextPtr context = Context::make();
+    context->locale->addTrait("aLocaleTrait");
+
+    const trait::TraitsDataPtr data = trait::TraitsData::make();
+    data->setTraitProperty("aTrait", "aKey", openassetio::Int{1});
+    cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+
+    THEN("an identical lookup finds a copy of the entry") {
+      const trait::TraitsDataPtr cached =
+          cache->lookup(ref, traitSet, ResolveAccess::kRead, context);
+      REQUIRE(cached);
+      CHECK(cached != data);
+      CHECK(*cached == *data);
+      CHECK(cache->size() == 1);
+      CHECK(cache->statistics().hits == 1);
+    }
+
+    THEN("modifying the original does not affect the cache") {
+      data->setTraitProperty("aTrait", "aKey", openassetio::Int{2});
+      const trait::TraitsDataPtr cached =
+          cache->lookup(ref, traitSet, ResolveAccess::kRead, context);
+      openassetio::trait::property::Value value;
+      cached->getTraitProperty(&value, "aTrait", "aKey");
+      CHECK(value == openassetio::trait::property::Value{openassetio::Int{1}});
+    }
+
+    THEN("an equivalent context also finds the entry") {
+      const openassetio::ContextPtr otherContext = Context::make();
+      otherContext->locale->addTrait("aLocaleTrait");
+      CHECK(cache->lookup(ref, traitSet, ResolveAccess::kRead, otherContext));
+    }
+
+    THEN("lookups that differ in any key component miss") {
+      CHECK_FALSE(cache->lookup(EntityReference{"test:///b"}, traitSet, ResolveAccess::kRead,
+                                context));
+      CHECK_FALSE(cache->lookup(ref, {"aTrait", "bTrait"}, ResolveAccess::kRead, context));
+      CHECK_FALSE(cache->lookup(ref, traitSet, ResolveAccess::kWrite, context));
+      CHECK_FALSE(cache->lookup(ref, traitSet, ResolveAccess::kRead, Context::make()));
+      CHECK_FALSE(cache->lookup(ref, traitSet, ResolveAccess::kRead,
+                                Context::make(context->locale, std::make_shared<TestState>())));
+      CHECK(cache->statistics().misses == 5);
+    }
+
+    WHEN("the cache is cleared") {
+      cache->clear();
+
+      THEN("the entry is gone") {
+        CHECK(cache->size() == 0);
+        CHECK_FALSE(cache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+      }
+    }
+  }
+
+  GIVEN("an entry cached against a manager state") {
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10);
+    const EntityReference ref{"test:///a"};
+    const auto state = std::make_shared<TestState>();
+    const openassetio::ContextPtr context = Context::make(trait::TraitsData::make(), state);
+    cache->insert(ref, {}, ResolveAccess::kRead, context, trait::TraitsData::make());
+
+    THEN("the cache does not retain the state") {
+      CHECK(state.use_count() == 2);  // Fixture and context.
+    }
+
+    THEN("the same state finds the entry") {
+      CHECK(cache->lookup(ref, {}, ResolveAccess::kRead,
+                          Context::make(trait::TraitsData::make(), state)));
+    }
+  }
+}
+
+SCENARIO("ResolveCache eviction") {
+  GIVEN("a single shard cache at capacity") {
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(2, 1);
+    const openassetio::ContextPtr context = Context::make();
+    const trait::TraitsDataPtr data = trait::TraitsData::make();
+    cache->insert(EntityReference{"a"}, {}, ResolveAccess::kRead, context, data);
+    cache->insert(EntityReference{"b"}, {}, ResolveAccess::kRead, context, data);
+
+    WHEN("the oldest entry is used, and a new entry is inserted") {
+      CHECK(cache->lookup(EntityReference{"a"}, {}, ResolveAccess::kRead, context));
+      cache->insert(EntityReference{"c"}, {}, ResolveAccess::kRead, context, data);
+
+      THEN("the least recently used entry is evicted") {
+        CHECK(cache->size() == 2);
+        CHECK(cache->statistics().evictions == 1);
+        CHECK(cache->lookup(EntityReference{"a"}, {}, ResolveAccess::kRead, context));
+        CHECK_FALSE(cache->lookup(EntityReference{"b"}, {}, ResolveAccess::kRead, context));
+        CHECK(cache->lookup(EntityReference{"c"}, {}, ResolveAccess::kRead, context));
+      }
+    }
+  }
+}
+
+SCENARIO("ResolveCache invalidation") {
+  GIVEN("a cache with entries for several entities and trait sets") {
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10);
+    const openassetio::ContextPtr context = Context::make();
+    const trait::TraitsDataPtr data = trait::TraitsData::make();
+    const EntityReference refA{"a"};
+    const EntityReference refB{"b"};
+    cache->insert(refA, {"aTrait"}, ResolveAccess::kRead, context, data);
+    cache->insert(refA, {"bTrait"}, ResolveAccess::kRead, context, data);
+    cache->insert(refB, {"aTrait"}, ResolveAccess::kRead, context, data);
+
+    WHEN("an entity is invalidated") {
+      cache->invalidate({refA});
+
+      THEN("only its entries are discarded") {
+        CHECK(cache->size() == 1);
+        CHECK(cache->lookup(refB, {"aTrait"}, ResolveAccess::kRead, context));
+      }
+    }
+
+    WHEN("an entity is invalidated for a set of traits") {
+      cache->invalidate({refA}, {"bTrait", "cTrait"});
+
+      THEN("only its entries resolving any of those traits are discarded") {
+        CHECK(cache->size() == 2);
+        CHECK(cache->lookup(refA, {"aTrait"}, ResolveAccess::kRead, context));
+        CHECK_FALSE(cache->lookup(refA, {"bTrait"}, ResolveAccess::kRead, context));
+      }
+    }
+
+    WHEN("entities are invalidated by reference prefix") {
+      cache->insert(EntityReference{"ab"}, {}, ResolveAccess::kRead, context, data);
+      cache->invalidatePrefix("a");
+
+      THEN("only entries of entities with that prefix are discarded") {
+        CHECK(cache->size() == 1);
+        CHECK(cache->lookup(refB, {"aTrait"}, ResolveAccess::kRead, context));
+      }
+    }
+  }
+}
+
+#if !defined(_WIN32)
+SCENARIO("ResolveCache shared tier") {
+  GIVEN("two caches sharing a tier, as if in separate processes") {
+    const hostApi::ResolveCache::SharedTier sharedTier{
+        "openassetio-test-resolve-" + std::to_string(::getpid()), 64};
+    ::shm_unlink(("/" + sharedTier.name).c_str());
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10, sharedTier);
+    const hostApi::ResolveCachePtr otherCache = hostApi::ResolveCache::make(10, sharedTier);
+
+    const EntityReference ref{"test:///a"};
+    const trait::TraitSet traitSet{"aTrait", "bTrait"};
+    const openassetio::ContextPtr context = Context::make();
+    context->locale->setTraitProperty("aLocaleTrait", "frame", openassetio::Int{1001});
+    const trait::TraitsDataPtr data = trait::TraitsData::make();
+    data->setTraitProperty("aTrait", "aKey", openassetio::Str{"aValue"});
+
+    WHEN("one cache inserts an entry") {
+      cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+
+      THEN("the other finds it with an equivalent context") {
+        const openassetio::ContextPtr otherContext = Context::make();
+        otherContext->locale->setTraitProperty("aLocaleTrait", "frame",
+                                               openassetio::Int{1001});
+        const trait::TraitsDataPtr cached =
+            otherCache->lookup(ref, traitSet, ResolveAccess::kRead, otherContext);
+        REQUIRE(cached);
+        CHECK(*cached == *data);
+        CHECK(otherCache->statistics().hits == 1);
+        CHECK(otherCache->statistics().sharedHits == 1);
+
+        AND_THEN("the entry is subsequently found locally") {
+          CHECK(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, otherContext));
+          CHECK(otherCache->statistics().sharedHits == 1);
+          CHECK(otherCache->size() == 1);
+        }
+      }
+
+      THEN("the other misses with a different locale") {
+        const openassetio::ContextPtr otherContext = Context::make();
+        otherContext->locale->setTraitProperty("aLocaleTrait", "frame",
+                                               openassetio::Int{1002});
+        CHECK_FALSE(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, otherContext));
+        CHECK(otherCache->statistics().misses == 1);
+      }
+
+      AND_WHEN("the first cache is cleared") {
+        cache->clear();
+
+        THEN("the other no longer finds the entry") {
+          CHECK_FALSE(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        }
+      }
+
+      AND_WHEN("the other cache invalidates the entity, having found it") {
+        REQUIRE(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        otherCache->invalidate({ref}, {"bTrait"});
+
+        THEN("the entry is discarded from its local and the shared tier") {
+          CHECK(otherCache->size() == 0);
+          const hostApi::ResolveCachePtr newCache = hostApi::ResolveCache::make(10, sharedTier);
+          CHECK_FALSE(newCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        }
+      }
+    }
+
+    WHEN("the caches are for different managers, or manager settings") {
+      const openassetio::InfoDictionary settings{{"aSetting", openassetio::Int{1}}};
+      cache->setManagerIdentity("org.openassetio.test.a", settings);
+      otherCache->setManagerIdentity("org.openassetio.test.b", settings);
+      cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+
+      THEN("entries are not shared") {
+        CHECK_FALSE(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+
+        otherCache->setManagerIdentity("org.openassetio.test.a",
+                                       {{"aSetting", openassetio::Int{2}}});
+        CHECK_FALSE(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+      }
+
+      AND_WHEN("the other cache invalidates the entity") {
+        otherCache->invalidate({ref});
+
+        THEN("the entry of the first cache is retained") {
+          const hostApi::ResolveCachePtr newCache = hostApi::ResolveCache::make(10, sharedTier);
+          newCache->setManagerIdentity("org.openassetio.test.a", settings);
+          CHECK(newCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        }
+      }
+
+      AND_WHEN("the other cache is given the same manager and settings") {
+        otherCache->setManagerIdentity("org.openassetio.test.a", settings);
+
+        THEN("entries are shared") {
+          CHECK(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        }
+      }
+    }
+
+    WHEN("a cache's manager changes") {
+      cache->setManagerIdentity("org.openassetio.test.a", {});
+      cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+      cache->setManagerIdentity("org.openassetio.test.b", {});
+
+      THEN("its entries are discarded") { CHECK(cache->size() == 0); }
+    }
+
+    WHEN("an entry is inserted against a manager state") {
+      const openassetio::ContextPtr stateContext =
+          Context::make(context->locale, std::make_shared<TestState>());
+      cache->insert(ref, traitSet, ResolveAccess::kRead, stateContext, data);
+
+      THEN("it is not shared") {
+        CHECK_FALSE(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, stateContext));
+      }
+    }
+
+    WHEN("an entry is too large for a slot") {
+      const trait::TraitsDataPtr largeData = trait::TraitsData::make();
+      largeData->setTraitProperty("aTrait", "aKey",
+                                  openassetio::Str(sharedTier.slotSize, 'x'));
+      cache->insert(ref, traitSet, ResolveAccess::kRead, context, largeData);
+
+      THEN("it is only cached locally") {
+        CHECK(cache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        CHECK_FALSE(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+      }
+    }
+
+    THEN("opening the tier with a different size fails") {
+      hostApi::ResolveCache::SharedTier otherTier = sharedTier;
+      otherTier.slotCount = 32;
+      CHECK_THROWS_AS(hostApi::ResolveCache::make(10, otherTier),
+                      openassetio::errors::InputValidationException);
+    }
+
+    ::shm_unlink(("/" + sharedTier.name).c_str());
+  }
+}
+
+SCENARIO("ResolveCache persistent tier") {
+  GIVEN("a tier held in a file") {
+    hostApi::ResolveCache::SharedTier sharedTier{};
+    sharedTier.path = (std::filesystem::temp_directory_path() /
+                       ("openassetio-test-resolve-" + std::to_string(::getpid()) + ".cache"))
+                          .string();
+    sharedTier.slotCount = 64;
+    std::filesystem::remove(sharedTier.path);
+
+    const EntityReference ref{"test:///a"};
+    const trait::TraitSet traitSet{"aTrait"};
+    const openassetio::ContextPtr context = Context::make();
+    const trait::TraitsDataPtr data = trait::TraitsData::make();
+    data->setTraitProperty("aTrait", "aKey", openassetio::Str{"aValue"});
+
+    WHEN("a cache inserts an entry and is destroyed") {
+      hostApi::ResolveCache::make(10, sharedTier)
+          ->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+
+      THEN("a new cache starts warm") {
+        const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10, sharedTier);
+        const trait::TraitsDataPtr cached =
+            cache->lookup(ref, traitSet, ResolveAccess::kRead, context);
+        REQUIRE(cached);
+        CHECK(*cached == *data);
+        CHECK(cache->statistics().sharedHits == 1);
+      }
+
+      AND_WHEN("the entry is corrupted in the file") {
+        const openassetio::trait::serialization::Bytes serialized =
+            openassetio::trait::serialization::serialize(*data);
+        std::vector<char> contents = readFile(sharedTier.path);
+        const auto valueIter =
+            std::search(contents.begin(), contents.end(), serialized.begin(), serialized.end(),
+                        [](const char lhs, const std::byte rhs) {
+                          return static_cast<std::byte>(lhs) == rhs;
+                        });
+        REQUIRE(valueIter != contents.end());
+        const auto valueOffset = static_cast<std::size_t>(valueIter - contents.begin());
+        const char original = contents[valueOffset];
+        contents[valueOffset] = static_cast<char>(~original);
+        writeFile(sharedTier.path, contents);
+
+        THEN("a new cache misses, and discards the entry") {
+          const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10, sharedTier);
+          CHECK_FALSE(cache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+          CHECK(cache->statistics().sharedHits == 0);
+
+          contents = readFile(sharedTier.path);
+          contents[valueOffset] = original;
+          writeFile(sharedTier.path, contents);
+          const hostApi::ResolveCachePtr laterCache = hostApi::ResolveCache::make(10, sharedTier);
+          CHECK_FALSE(laterCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        }
+      }
+
+      AND_WHEN("a new cache is given a validity token") {
+        const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10, sharedTier);
+        cache->setValidityToken("v1");
+
+        THEN("the entry is discarded") {
+          CHECK_FALSE(cache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+        }
+
+        AND_WHEN("an entry is inserted and a later cache gives the same token") {
+          cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+          const hostApi::ResolveCachePtr laterCache =
+              hostApi::ResolveCache::make(10, sharedTier);
+          laterCache->setValidityToken("v1");
+
+          THEN("the entry is retained") {
+            CHECK(laterCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+          }
+        }
+
+        AND_WHEN("a later cache gives a different token") {
+          cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+          const hostApi::ResolveCachePtr laterCache =
+              hostApi::ResolveCache::make(10, sharedTier);
+          laterCache->setValidityToken("v2");
+
+          THEN("the entry is discarded by both caches") {
+            CHECK_FALSE(laterCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+            cache->setValidityToken("v2");
+            CHECK_FALSE(cache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+          }
+        }
+      }
+    }
+
+    WHEN("entries have a time to live") {
+      sharedTier.timeToLive = std::chrono::seconds{1};
+      const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10, sharedTier);
+      cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+
+      THEN("they are found by other caches until they expire") {
+        const hostApi::ResolveCachePtr otherCache = hostApi::ResolveCache::make(10, sharedTier);
+        CHECK(otherCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+
+        std::this_thread::sleep_for(std::chrono::seconds{2});
+        const hostApi::ResolveCachePtr laterCache = hostApi::ResolveCache::make(10, sharedTier);
+        CHECK_FALSE(laterCache->lookup(ref, traitSet, ResolveAccess::kRead, context));
+      }
+    }
+
+    WHEN("the creator of the table is still initializing it") {
+      static_cast<void>(hostApi::ResolveCache::make(10, sharedTier));
+      // Clear the magic number, which is set last, leaving this
+      // process's claim to initialize the table.
+      std::vector<char> contents = readFile(sharedTier.path);
+      std::fill_n(contents.begin(), 4, '\0');
+      writeFile(sharedTier.path, contents);
+
+      THEN("a new cache does not take over initializing it") {
+        CHECK_THROWS_AS(hostApi::ResolveCache::make(10, sharedTier),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("the creator of the table exited before initializing it") {
+      const pid_t creator = ::fork();
+      REQUIRE(creator != -1);
+      if (creator == 0) {
+        static_cast<void>(hostApi::ResolveCache::make(10, sharedTier));
+        std::vector<char> contents = readFile(sharedTier.path);
+        std::fill_n(contents.begin(), 4, '\0');
+        writeFile(sharedTier.path, contents);
+        ::_exit(0);
+      }
+      int status = 0;
+      REQUIRE(::waitpid(creator, &status, 0) == creator);
+      REQUIRE(WIFEXITED(status));
+
+      THEN("a new cache takes over initializing it") {
+        hostApi::ResolveCachePtr cache;
+        CHECK_NOTHROW(cache = hostApi::ResolveCache::make(10, sharedTier));
+        REQUIRE(cache);
+        cache->insert(ref, traitSet, ResolveAccess::kRead, context, data);
+        CHECK(hostApi::ResolveCache::make(10, sharedTier)
+                  ->lookup(ref, traitSet, ResolveAccess::kRead, context));
+      }
+    }
+
+    WHEN("a cache creates the file") {
+      static_cast<void>(hostApi::ResolveCache::make(10, sharedTier));
+
+      THEN("it is only accessible to its owner") {
+        using std::filesystem::perms;
+        const perms permissions = std::filesystem::status(sharedTier.path).permissions();
+        CHECK((permissions & (perms::group_all | perms::others_all)) == perms::none);
+      }
+    }
+
+    THEN("a negative time to live is rejected") {
+      sharedTier.timeToLive = std::chrono::seconds{-1};
+      CHECK_THROWS_AS(hostApi::ResolveCache::make(10, sharedTier),
+                      openassetio::errors::InputValidationException);
+    }
+
+    std::filesystem::remove(sharedTier.path);
+  }
+}
+#endif
+
+SCENARIO("ResolveCache memory usage") {
+  GIVEN("an empty cache") {
+    const hostApi::ResolveCachePtr cache = hostApi::ResolveCache::make(10);
+    const std::size_t emptyUsage = cache->memoryUsage();
+    const openassetio::ContextPtr context = Context::make();
+
+    WHEN("an entry is inserted") {
+      const trait::TraitsDataPtr data = trait::TraitsData::make();
+      data->setTraitProperty("aTrait", "aKey", openassetio::Str(1000, 'x'));
+      cache->insert(EntityReference{"test:///a"}, {"aTrait"}, ResolveAccess::kRead, context,
+                    data);
+
+      THEN("usage includes the cached result") {
+        CHECK(cache->memoryUsage() >= emptyUsage + data->memoryUsage());
+      }
+
+      AND_WHEN("the cache is cleared") {
+        const std::size_t populatedUsage = cache->memoryUsage();
+        cache->clear();
+
+        THEN("the cached result is no longer included") {
+          CHECK(cache->memoryUsage() <= populatedUsage - data->memoryUsage());
+        }
+      }
+    }
+  }
+}
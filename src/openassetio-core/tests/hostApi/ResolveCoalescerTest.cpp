@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveCoalescer.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::ManagerFixture;
+using trompeloeil::_;
+
+/**
+ * Resolve each entity to a TraitsData with a trait named after its
+ * entity reference, except the reference "error", which leads to an
+ * element error.
+ */
+void resolveToNamedTraits(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback,
+    const managerApi::ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    const Str& ref = entityReferences[idx].toString();
+    if (ref == "error") {
+      errorCallback(idx, {BatchElementError::ErrorCode::kEntityResolutionError, "bad entity"});
+      continue;
+    }
+    const trait::TraitsDataPtr data = trait::TraitsData::make();
+    data->addTrait(ref);
+    successCallback(idx, data);
+  }
+}
+}  // namespace
+
+SCENARIO("ResolveCoalescer construction") {
+  const ManagerFixture fixture;
+
+  THEN("a null manager or zero batch size is rejected") {
+    CHECK_THROWS_AS(hostApi::ResolveCoalescer::make(nullptr),
+                    openassetio::errors::InputValidationException);
+    CHECK_THROWS_AS(
+        hostApi::ResolveCoalescer::make(fixture.manager, std::chrono::microseconds{0}, 0),
+        openassetio::errors::InputValidationException);
+  }
+}
+
+SCENARIO("ResolveCoalescer resolving") {
+  GIVEN("a coalescer with a long window") {
+    const ManagerFixture fixture;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    constexpr std::size_t kThreadCount = 8;
+    const hostApi::ResolveCoalescerPtr coalescer =
+        hostApi::ResolveCoalescer::make(fixture.manager, std::chrono::seconds{10}, kThreadCount);
+    const ContextConstPtr& context = fixture.context;
+    const trait::TraitSet traitSet{"aTrait"};
+
+    WHEN("a full batch of requests is made concurrently") {
+      // The requests are served by a single batch call without waiting
+      // for the window.
+      REQUIRE_CALL(mockManagerInterface, resolve(_, traitSet, ResolveAccess::kRead, context,
+                                                 fixture.hostSession, _, _))
+          .WITH(_1.size() == kThreadCount)
+          .SIDE_EFFECT(resolveToNamedTraits(_1, _6, _7));
+
+      std::vector<trait::TraitsDataPtr> results(kThreadCount);
+      std::vector<std::thread> threads;
+      for (std::size_t idx = 0; idx < kThreadCount; ++idx) {
+        threads.emplace_back([&, idx] {
+          results[idx] = coalescer->resolve(EntityReference{std::to_string(idx)}, traitSet,
+                                            ResolveAccess::kRead, context);
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      THEN("each request receives its own result") {
+        for (std::size_t idx = 0; idx < kThreadCount; ++idx) {
+          REQUIRE(results[idx]);
+          CHECK(results[idx]->hasTrait(std::to_string(idx)));
+        }
+      }
+    }
+  }
+
+  GIVEN("a coalescer with a short window") {
+    const ManagerFixture fixture;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const hostApi::ResolveCoalescerPtr coalescer =
+        hostApi::ResolveCoalescer::make(fixture.manager, std::chrono::microseconds{1});
+    const ContextConstPtr& context = fixture.context;
+    const trait::TraitSet traitSet{"aTrait"};
+
+    WHEN("a single entity is resolved") {
+      const EntityReferences refs{EntityReference{"a"}};
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, traitSet, ResolveAccess::kRead, context,
+                                                 fixture.hostSession, _, _))
+          .SIDE_EFFECT(resolveToNamedTraits(_1, _6, _7));
+
+      const trait::TraitsDataPtr result =
+          coalescer->resolve(EntityReference{"a"}, traitSet, ResolveAccess::kRead, context);
+
+      THEN("the result is returned once the window expires") { CHECK(result->hasTrait("a")); }
+    }
+
+    WHEN("an entity fails to resolve") {
+      const EntityReferences refs{EntityReference{"error"}};
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, traitSet, ResolveAccess::kRead, context,
+                                                 fixture.hostSession, _, _))
+          .SIDE_EFFECT(resolveToNamedTraits(_1, _6, _7));
+
+      THEN("the exception variant throws") {
+        CHECK_THROWS_AS(
+            coalescer->resolve(EntityReference{"error"}, traitSet, ResolveAccess::kRead, context),
+            openassetio::errors::BatchElementException);
+      }
+
+      AND_THEN("the variant policy returns the error") {
+        const auto result =
+            coalescer->resolve(EntityReference{"error"}, traitSet, ResolveAccess::kRead, context,
+                               hostApi::Manager::BatchElementErrorPolicyTag::kVariant);
+        REQUIRE(std::holds_alternative<BatchElementError>(result));
+        CHECK(std::get<BatchElementError>(result).code ==
+              BatchElementError::ErrorCode::kEntityResolutionError);
+      }
+    }
+
+    WHEN("the manager fails the batch") {
+      REQUIRE_CALL(mockManagerInterface, resolve(_, traitSet, ResolveAccess::kRead, context,
+                                                 fixture.hostSession, _, _))
+          .THROW(openassetio::errors::InputValidationException{"batch failed"});
+
+      THEN("the exception is propagated") {
+        CHECK_THROWS_WITH(
+            coalescer->resolve(EntityReference{"throw"}, traitSet, ResolveAccess::kRead, context),
+            "batch failed");
+      }
+    }
+  }
+}
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/CancellationToken.hpp>
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/RetryingManagerInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::ContextConstPtr;
+using openassetio::ContextPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::access::PublishingAccess;
+using openassetio::access::ResolveAccess;
+using openassetio::log::LoggerInterface;
+using openassetio::testSupport::MockHostInterface;
+using openassetio::testSupport::MockLoggerInterface;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/// Resolve each entity to an empty TraitsData.
+void resolveAll(const EntityReferences& entityReferences,
+                const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, trait::TraitsData::make());
+  }
+}
+
+/// Resolve two entities, returning the number of results reported.
+std::size_t resolve(managerApi::ManagerInterface& managerInterface,
+                    const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession) {
+  std::size_t results = 0;
+  managerInterface.resolve(
+      {EntityReference{"ref1"}, EntityReference{"ref2"}}, {}, ResolveAccess::kRead, context,
+      hostSession, [&](std::size_t, const trait::TraitsDataPtr&) { ++results; },
+      [](std::size_t, const openassetio::errors::BatchElementError&) {});
+  return results;
+}
+}  // namespace
+
+SCENARIO("RetryingManagerInterface construction") {
+  GIVEN("a manager interface") {
+    const auto managerInterface = std::make_shared<MockManagerInterface>();
+
+    THEN("a retrying layer cannot be constructed with zero attempts") {
+      CHECK_THROWS_AS(hostApi::RetryingManagerInterface::make(managerInterface, 0),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  GIVEN("a null manager interface") {
+    THEN("a retrying layer cannot be constructed") {
+      CHECK_THROWS_AS(hostApi::RetryingManagerInterface::make(nullptr),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+
+SCENARIO("Retrying failed manager plugin queries") {
+  GIVEN("a manager wrapped in a retrying layer with three attempts") {
+    const auto managerInterface = std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    const auto retryingInterface = hostApi::RetryingManagerInterface::make(managerInterface, 3);
+    const auto logger = std::make_shared<MockLoggerInterface>();
+    const managerApi::HostSessionPtr hostSession = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()), logger);
+    const ContextPtr context = Context::make();
+    const EntityReferences refs{EntityReference{"ref1"}, EntityReference{"ref2"}};
+
+    WHEN("a resolve fails fewer times than the maximum attempts") {
+      // Expectations are matched most recent first, so the failures
+      // precede the success.
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, _, context, hostSession, _, _))
+          .SIDE_EFFECT(resolveAll(_1, _6));
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, _, context, hostSession, _, _))
+          .TIMES(2)
+          .THROW(std::runtime_error{"backend unavailable"});
+      REQUIRE_CALL(*logger, log(LoggerInterface::Severity::kDebug, _)).TIMES(2);
+
+      const std::size_t results = resolve(*retryingInterface, context, hostSession);
+
+      THEN("the resolve is retried until it succeeds") { CHECK(results == 2); }
+    }
+
+    WHEN("a resolve fails as many times as the maximum attempts") {
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, _, context, hostSession, _, _))
+          .TIMES(3)
+          .THROW(std::runtime_error{"backend unavailable"});
+      REQUIRE_CALL(*logger, log(LoggerInterface::Severity::kDebug, _)).TIMES(2);
+
+      THEN("the last error is propagated") {
+        CHECK_THROWS_AS(resolve(*retryingInterface, context, hostSession), std::runtime_error);
+      }
+    }
+
+    WHEN("a resolve fails after reporting a result") {
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, _, context, hostSession, _, _))
+          .SIDE_EFFECT(_6(0, trait::TraitsData::make()))
+          .THROW(std::runtime_error{"backend unavailable"});
+
+      THEN("the resolve is not retried") {
+        CHECK_THROWS_AS(resolve(*retryingInterface, context, hostSession), std::runtime_error);
+      }
+    }
+
+    WHEN("a resolve fails input validation") {
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, _, context, hostSession, _, _))
+          .THROW(openassetio::errors::InputValidationException{"invalid"});
+
+      THEN("the resolve is not retried") {
+        CHECK_THROWS_AS(resolve(*retryingInterface, context, hostSession),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("a resolve fails after the context is cancelled") {
+      context->cancellationToken = openassetio::CancellationToken::make();
+      context->cancellationToken->cancel();
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, _, context, hostSession, _, _))
+          .THROW(std::runtime_error{"backend unavailable"});
+
+      THEN("the resolve is not retried") {
+        CHECK_THROWS_AS(resolve(*retryingInterface, context, hostSession), std::runtime_error);
+      }
+    }
+
+    WHEN("a register fails") {
+      REQUIRE_CALL(mockManagerInterface, register_(_, _, PublishingAccess::kWrite, context,
+                                                   hostSession, _, _))
+          .THROW(std::runtime_error{"backend unavailable"});
+
+      THEN("the register is not retried") {
+        CHECK_THROWS_AS(
+            retryingInterface->register_(
+                {EntityReference{"ref"}}, {trait::TraitsData::make()}, PublishingAccess::kWrite,
+                context, hostSession, [](std::size_t, const EntityReference&) {},
+                [](std::size_t, const openassetio::errors::BatchElementError&) {}),
+            std::runtime_error);
+      }
+    }
+
+    WHEN("a resolve that fails once is made asynchronously") {
+      const EntityReferences singleRef{EntityReference{"ref"}};
+      REQUIRE_CALL(mockManagerInterface, resolve(singleRef, _, _, context, hostSession, _, _))
+          .SIDE_EFFECT(resolveAll(_1, _6));
+      REQUIRE_CALL(mockManagerInterface, resolve(singleRef, _, _, context, hostSession, _, _))
+          .THROW(std::runtime_error{"backend unavailable"});
+      REQUIRE_CALL(*logger, log(LoggerInterface::Severity::kDebug, _));
+
+      std::size_t results = 0;
+      std::promise<std::exception_ptr> done;
+      retryingInterface->resolveAsync(
+          singleRef, {}, ResolveAccess::kRead, context, hostSession,
+          [&](std::size_t, const trait::TraitsDataPtr&) { ++results; },
+          [](std::size_t, const openassetio::errors::BatchElementError&) {},
+          [&](std::exception_ptr exception) { done.set_value(std::move(exception)); });
+
+      THEN("the resolve is retried in the background") {
+        CHECK_FALSE(done.get_future().get());
+        CHECK(results == 1);
+      }
+    }
+  }
+}
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/RoutingManagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace access = openassetio::access;
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+InfoDictionary prefixInfo(Str prefix) {
+  return {{Str{openassetio::constants::kInfoKey_EntityReferencesMatchPrefix}, std::move(prefix)}};
+}
+
+/**
+ * Mock child manager, allowed to be initialized with the given info,
+ * and reporting every capability but stateful contexts.
+ */
+struct MockChild {
+  explicit MockChild(InfoDictionary info) {
+    using Capability = managerApi::ManagerInterface::Capability;
+    expectations.push_back(
+        NAMED_ALLOW_CALL(*mock, identifier()).RETURN("org.openassetio.test.manager"));
+    expectations.push_back(NAMED_ALLOW_CALL(*mock, initialize(_, _)));
+    expectations.push_back(NAMED_ALLOW_CALL(*mock, info()).RETURN(info));
+    expectations.push_back(NAMED_ALLOW_CALL(*mock, hasCapability(_))
+                               .RETURN(_1 != Capability::kStatefulContexts));
+  }
+
+  const std::shared_ptr<MockManagerInterface> mock = std::make_shared<MockManagerInterface>();
+
+ private:
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+};
+
+/// Resolve each entity to a TraitsData with a trait named after the
+/// entity reference.
+void resolveToReferenceTrait(
+    const EntityReferences& entityReferences,
+    const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, trait::TraitsData::make({entityReferences[idx].toString()}));
+  }
+}
+
+/// Preflight each entity to its traits hint's first trait.
+void preflightToFirstTrait(
+    const trait::TraitsDatas& traitsHints,
+    const managerApi::ManagerInterface::PreflightSuccessCallback& successCallback) {
+  for (std::size_t idx = 0; idx < traitsHints.size(); ++idx) {
+    successCallback(idx, EntityReference{*traitsHints[idx]->traitSet().begin()});
+  }
+}
+
+/// Result of an element of a batch: a trait set, entity reference or
+/// error code.
+using Result = std::variant<std::monostate, trait::TraitSet, EntityReference,
+                            BatchElementError::ErrorCode>;
+}  // namespace
+
+SCENARIO("RoutingManagerInterface construction") {
+  THEN("construction without children is rejected") {
+    CHECK_THROWS_AS(hostApi::RoutingManagerInterface::make({}),
+                    openassetio::errors::InputValidationException);
+  }
+
+  THEN("construction with a null child is rejected") {
+    const auto child = std::make_shared<MockManagerInterface>();
+    CHECK_THROWS_AS(hostApi::RoutingManagerInterface::make({child, nullptr}),
+                    openassetio::errors::InputValidationException);
+  }
+
+  GIVEN("a child that does not declare an entity reference prefix") {
+    const MockChild childA{prefixInfo("a:")};
+    const MockChild childB{InfoDictionary{}};
+    const auto routing = hostApi::RoutingManagerInterface::make({childA.mock, childB.mock});
+
+    THEN("initialization fails") {
+      CHECK_THROWS_AS(routing->initialize({}, makeMockHostSession()),
+                      openassetio::errors::ConfigurationException);
+    }
+  }
+}
+
+SCENARIO("Routing batches to child managers by entity reference prefix") {
+  GIVEN("a Manager wrapping a routing layer over two children with distinct prefixes") {
+    const MockChild childA{prefixInfo("a:")};
+    const MockChild childB{
+        InfoDictionary{{Str{openassetio::constants::kInfoKey_EntityReferencesMatchPrefixes},
+                        Str{"b:\nbb:"}}}};
+    const auto routing = hostApi::RoutingManagerInterface::make({childA.mock, childB.mock});
+    const auto manager = hostApi::Manager::make(routing, makeMockHostSession());
+    manager->initialize({});
+    const auto context = manager->createContext();
+
+    const EntityReferences refs{EntityReference{"a:1"}, EntityReference{"bb:1"},
+                                EntityReference{"c:1"}, EntityReference{"a:2"}};
+
+    THEN("entity references are recognised if any child recognises them") {
+      CHECK(manager->isEntityReferenceString("a:1"));
+      CHECK(manager->isEntityReferenceString("b:1"));
+      CHECK_FALSE(manager->isEntityReferenceString("c:1"));
+    }
+
+    WHEN("a mixed batch is resolved") {
+      const EntityReferences childARefs{refs[0], refs[3]};
+      const EntityReferences childBRefs{refs[1]};
+      REQUIRE_CALL(*childA.mock, resolve(childARefs, _, access::ResolveAccess::kRead, _, _, _, _))
+          .SIDE_EFFECT(resolveToReferenceTrait(_1, _6));
+      REQUIRE_CALL(*childB.mock, resolve(childBRefs, _, access::ResolveAccess::kRead, _, _, _, _))
+          .SIDE_EFFECT(resolveToReferenceTrait(_1, _6));
+
+      std::vector<Result> results(refs.size());
+      manager->resolve(
+          refs, {}, access::ResolveAccess::kRead, context,
+          [&](const std::size_t idx, const trait::TraitsDataPtr& data) {
+            results[idx] = data->traitSet();
+          },
+          [&](const std::size_t idx, const BatchElementError& error) {
+            results[idx] = error.code;
+          });
+
+      THEN("results are reported against the original indices") {
+        CHECK(results == std::vector<Result>{trait::TraitSet{"a:1"}, trait::TraitSet{"bb:1"},
+                                             BatchElementError::ErrorCode::kInvalidEntityReference,
+                                             trait::TraitSet{"a:2"}});
+      }
+    }
+
+    WHEN("a mixed batch is preflighted") {
+      const EntityReferences childARefs{refs[3]};
+      const EntityReferences childBRefs{refs[1]};
+      REQUIRE_CALL(*childA.mock,
+                   preflight(childARefs, _, access::PublishingAccess::kWrite, _, _, _, _))
+          .WITH(_2.size() == 1 && _2[0]->hasTrait("x"))
+          .SIDE_EFFECT(preflightToFirstTrait(_2, _6));
+      REQUIRE_CALL(*childB.mock,
+                   preflight(childBRefs, _, access::PublishingAccess::kWrite, _, _, _, _))
+          .WITH(_2.size() == 1 && _2[0]->hasTrait("y"))
+          .SIDE_EFFECT(preflightToFirstTrait(_2, _6));
+
+      std::vector<Result> results(refs.size());
+      manager->preflight(
+          {refs[3], refs[1]}, {trait::TraitsData::make({"x"}), trait::TraitsData::make({"y"})},
+          access::PublishingAccess::kWrite, context,
+          [&](const std::size_t idx, EntityReference ref) { results[idx] = std::move(ref); },
+          [](std::size_t, const BatchElementError&) {});
+
+      THEN("each child is given the traits hints of its own references") {
+        CHECK(results[0] == Result{EntityReference{"x"}});
+        CHECK(results[1] == Result{EntityReference{"y"}});
+      }
+    }
+
+    WHEN("a child fails its sub-batch") {
+      THEN("the exception is propagated, after the other sub-batches complete") {
+        REQUIRE_CALL(*childA.mock, resolve(_, _, _, _, _, _, _))
+            .SIDE_EFFECT(resolveToReferenceTrait(_1, _6));
+        REQUIRE_CALL(*childB.mock, resolve(_, _, _, _, _, _, _))
+            .THROW(std::runtime_error{"failed"});
+
+        CHECK_THROWS_AS(manager->resolve(
+                            refs, {}, access::ResolveAccess::kRead, context,
+                            [](std::size_t, const trait::TraitsDataPtr&) {},
+                            [](std::size_t, const BatchElementError&) {}),
+                        std::runtime_error);
+      }
+    }
+
+    WHEN("the management policy is queried") {
+      THEN("the query is forwarded to the primary child") {
+        REQUIRE_CALL(*childA.mock, managementPolicy(_, access::PolicyAccess::kRead, _, _))
+            .RETURN(trait::TraitsData::makeMany(_1.size()));
+        FORBID_CALL(*childB.mock, managementPolicy(_, _, _, _));
+
+        static_cast<void>(
+            manager->managementPolicy({{"t"}}, access::PolicyAccess::kRead, context));
+      }
+    }
+  }
+}
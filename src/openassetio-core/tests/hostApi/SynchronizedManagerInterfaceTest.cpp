@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/SynchronizedManagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using trompeloeil::_;
+
+/// Tracks the peak number of threads concurrently inside a scope.
+struct ConcurrencyCounter {
+  struct Scope {
+    explicit Scope(ConcurrencyCounter& counter) : self{counter} {
+      const std::size_t current = ++self.current;
+      std::size_t peak = self.peak;
+      while (current > peak && !self.peak.compare_exchange_weak(peak, current)) {
+      }
+    }
+    ~Scope() { --self.current; }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(Scope&&) = delete;
+    ConcurrencyCounter& self;
+  };
+
+  /**
+   * Wait, with timeout, for another thread to enter the scope, so that
+   * concurrency is observed if permitted.
+   */
+  void awaitCompany() const {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds{200};
+    while (current < 2 && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+  }
+
+  std::atomic<std::size_t> current{0};
+  std::atomic<std::size_t> peak{0};
+};
+
+/**
+ * Manager that records how many threads are concurrently within
+ * `resolve` and `entityExists`.
+ *
+ * Trompeloeil serialises calls to mocked methods, so these two are
+ * implemented directly in order to observe concurrency.
+ */
+struct ConcurrencyRecordingManagerInterface : openassetio::testSupport::MockManagerInterface {
+  MAKE_MOCK6(entityExistsAsync,
+             void(const EntityReferences&, const ContextConstPtr&,
+                  const managerApi::HostSessionPtr&, ExistsSuccessCallback,
+                  BatchElementErrorCallback, CompletionCallback),
+             override);
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet&, ResolveAccess,
+               const ContextConstPtr&, const managerApi::HostSessionPtr&,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback&) override {
+    const ConcurrencyCounter::Scope scope{resolveCounter};
+    resolveCounter.awaitCompany();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      successCallback(idx, trait::TraitsData::make());
+    }
+  }
+
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr&,
+                    const managerApi::HostSessionPtr&,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback&) override {
+    const ConcurrencyCounter::Scope scope{existsCounter};
+    existsCounter.awaitCompany();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      successCallback(idx, true);
+    }
+  }
+
+  ConcurrencyCounter resolveCounter;
+  ConcurrencyCounter existsCounter;
+};
+
+/// Call `func` from several threads at once.
+template <class Func>
+void callConcurrently(const Func& func) {
+  std::vector<std::thread> threads;
+  for (std::size_t idx = 0; idx < 4; ++idx) {
+    threads.emplace_back(func);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+}  // namespace
+
+SCENARIO("Synchronizing a partially thread-safe manager") {
+  GIVEN("a synchronized manager interface wrapping a partially thread-safe manager") {
+    const auto managerInterface = std::make_shared<ConcurrencyRecordingManagerInterface>();
+    const auto synchronized = hostApi::SynchronizedManagerInterface::make(managerInterface);
+    const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+    const ContextConstPtr context = Context::make();
+    const EntityReferences refs{EntityReference{"a"}};
+
+    const auto resolve = [&] {
+      synchronized->resolve(
+          refs, {}, ResolveAccess::kRead, context, hostSession,
+          [](std::size_t, const trait::TraitsDataPtr&) {},
+          [](std::size_t, const openassetio::errors::BatchElementError&) {});
+    };
+    const auto entityExists = [&] {
+      synchronized->entityExists(
+          refs, context, hostSession, [](std::size_t, bool) {},
+          [](std::size_t, const openassetio::errors::BatchElementError&) {});
+    };
+
+    WHEN("the manager has not been initialized and methods are called concurrently") {
+      callConcurrently(resolve);
+
+      THEN("all calls are serialised") { CHECK(managerInterface->resolveCounter.peak == 1); }
+    }
+
+    AND_GIVEN("the manager has been initialized, declaring `resolve` (only) as thread-safe") {
+      ALLOW_CALL(*managerInterface, info())
+          .RETURN(InfoDictionary{{Str{openassetio::constants::kInfoKey_ThreadSafeMethods},
+                                  Str{"isEntityReferenceString\nresolve"}}});
+      {
+        REQUIRE_CALL(*managerInterface, initialize(_, hostSession));
+        synchronized->initialize({}, hostSession);
+      }
+
+      WHEN("methods are called concurrently") {
+        callConcurrently([&] {
+          resolve();
+          entityExists();
+        });
+
+        THEN("thread-safe methods run concurrently") {
+          CHECK(managerInterface->resolveCounter.peak > 1);
+        }
+
+        AND_THEN("other methods are serialised") {
+          CHECK(managerInterface->existsCounter.peak == 1);
+        }
+      }
+
+      WHEN("the asynchronous variant of a non-thread-safe method is called") {
+        FORBID_CALL(*managerInterface, entityExistsAsync(_, _, _, _, _, _));
+        std::promise<std::exception_ptr> completed;
+        synchronized->entityExistsAsync(
+            refs, context, hostSession, [](std::size_t, bool) {},
+            [](std::size_t, const openassetio::errors::BatchElementError&) {},
+            [&](std::exception_ptr error) { completed.set_value(std::move(error)); });
+
+        THEN("the serialised synchronous method is run in the background") {
+          CHECK(completed.get_future().get() == nullptr);
+          CHECK(managerInterface->existsCounter.peak == 1);
+        }
+      }
+
+      THEN("the wrapper reports itself as thread-safe") {
+        const InfoDictionary info = synchronized->info();
+        CHECK(std::get<openassetio::Bool>(
+            info.at(Str{openassetio::constants::kInfoKey_IsThreadSafe})));
+        CHECK(info.count(Str{openassetio::constants::kInfoKey_ThreadSafeMethods}) == 1);
+      }
+    }
+  }
+
+  WHEN("a synchronized manager interface is constructed without a manager") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(hostApi::SynchronizedManagerInterface::make(nullptr),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
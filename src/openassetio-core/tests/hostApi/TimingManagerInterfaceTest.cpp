@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/TimingManagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::access::ResolveAccess;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+constexpr std::chrono::milliseconds kResolveDuration{2};
+
+/// Resolve each entity to an empty TraitsData, taking a while.
+void resolveSlowly(const EntityReferences& entityReferences,
+                   const managerApi::ManagerInterface::ResolveSuccessCallback& successCallback) {
+  std::this_thread::sleep_for(kResolveDuration);
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    successCallback(idx, trait::TraitsData::make());
+  }
+}
+
+void resolve(managerApi::ManagerInterface& managerInterface,
+             const managerApi::HostSessionPtr& hostSession) {
+  managerInterface.resolve(
+      {EntityReference{"ref"}}, {}, ResolveAccess::kRead, Context::make(), hostSession,
+      [](std::size_t, const trait::TraitsDataPtr&) {},
+      [](std::size_t, const openassetio::errors::BatchElementError&) {});
+}
+}  // namespace
+
+SCENARIO("Timing manager plugin methods") {
+  GIVEN("a manager wrapped in a timing layer") {
+    const auto managerInterface = std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    const auto timingInterface = hostApi::TimingManagerInterface::make(managerInterface);
+    const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+
+    THEN("all timed methods are reported as uncalled") {
+      const hostApi::TimingManagerInterface::Statistics statistics =
+          timingInterface->statistics();
+      CHECK(statistics.size() == 16);
+      CHECK(statistics.count("register") == 1);
+      for (const auto& [name, methodStatistics] : statistics) {
+        CHECK(methodStatistics.calls == 0);
+        CHECK(methodStatistics.totalDuration == std::chrono::nanoseconds{0});
+      }
+    }
+
+    WHEN("entities are resolved") {
+      REQUIRE_CALL(mockManagerInterface, resolve(_, _, _, _, hostSession, _, _))
+          .TIMES(2)
+          .SIDE_EFFECT(resolveSlowly(_1, _6));
+      resolve(*timingInterface, hostSession);
+      resolve(*timingInterface, hostSession);
+
+      THEN("the calls and time spent are recorded") {
+        const auto statistics = timingInterface->statistics().at("resolve");
+        CHECK(statistics.calls == 2);
+        CHECK(statistics.totalDuration >= 2 * kResolveDuration);
+        CHECK(timingInterface->statistics().at("entityExists").calls == 0);
+      }
+
+      AND_WHEN("statistics are reset") {
+        timingInterface->resetStatistics();
+
+        THEN("no calls are reported") {
+          CHECK(timingInterface->statistics().at("resolve").calls == 0);
+        }
+      }
+    }
+
+    WHEN("a method fails") {
+      REQUIRE_CALL(mockManagerInterface, entityExists(_, _, hostSession, _, _))
+          .THROW(std::runtime_error{"backend unavailable"});
+      CHECK_THROWS_AS(timingInterface->entityExists(
+                          {EntityReference{"ref"}}, Context::make(), hostSession,
+                          [](std::size_t, bool) {},
+                          [](std::size_t, const openassetio::errors::BatchElementError&) {}),
+                      std::runtime_error);
+
+      THEN("the call is still recorded") {
+        CHECK(timingInterface->statistics().at("entityExists").calls == 1);
+      }
+    }
+
+    WHEN("entities are resolved asynchronously") {
+      REQUIRE_CALL(mockManagerInterface, resolve(_, _, _, _, hostSession, _, _))
+          .SIDE_EFFECT(resolveSlowly(_1, _6));
+      std::promise<void> done;
+      timingInterface->resolveAsync(
+          {EntityReference{"ref"}}, {}, ResolveAccess::kRead, Context::make(), hostSession,
+          [](std::size_t, const trait::TraitsDataPtr&) {},
+          [](std::size_t, const openassetio::errors::BatchElementError&) {},
+          [&](const std::exception_ptr&) { done.set_value(); });
+      done.get_future().wait();
+
+      THEN("the call is recorded separately, timed until completion") {
+        const auto statistics = timingInterface->statistics().at("resolveAsync");
+        CHECK(statistics.calls == 1);
+        CHECK(statistics.totalDuration >= kResolveDuration);
+        CHECK(timingInterface->statistics().at("resolve").calls == 0);
+      }
+    }
+  }
+}
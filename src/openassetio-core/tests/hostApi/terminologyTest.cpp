@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/terminology.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+#include <testSupport/ManagerFixture.hpp>
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace terminology = hostApi::terminology;
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::StrMap;
+using openassetio::testSupport::initializeManager;
+using openassetio::testSupport::makeMockHostSession;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+using Capability = managerApi::ManagerInterface::Capability;
+
+/// Mock manager that also mocks custom terminology.
+struct MockTerminologyManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK2(updateTerminology);
+};
+
+/// Call assets "Products".
+StrMap withProducts(StrMap terms) {
+  terms[terminology::kTerm_Asset] = "Product";
+  return terms;
+}
+}  // namespace
+
+SCENARIO("Mapping terminology") {
+  GIVEN("a Manager whose plugin customizes terminology") {
+    const auto mockManagerInterface = std::make_shared<MockTerminologyManagerInterface>();
+    const auto manager = hostApi::Manager::make(mockManagerInterface, makeMockHostSession());
+    initializeManager(*manager, *mockManagerInterface);
+
+    // Flushing caches re-queries the plugin's capabilities and info.
+    ALLOW_CALL(*mockManagerInterface, flushCaches(_));
+    ALLOW_CALL(*mockManagerInterface, hasCapability(_))
+        .RETURN(_1 != Capability::kStatefulContexts);
+    ALLOW_CALL(*mockManagerInterface, info()).RETURN(InfoDictionary{});
+    ALLOW_CALL(*mockManagerInterface, displayName()).RETURN("Test Manager");
+
+    std::size_t updateTerminologyCallCount = 0;
+    ALLOW_CALL(*mockManagerInterface, updateTerminology(_, _))
+        .LR_SIDE_EFFECT(++updateTerminologyCallCount)
+        .RETURN(withProducts(_1));
+
+    WHEN("a Mapper is constructed with the default terminology") {
+      const terminology::MapperPtr mapper = terminology::Mapper::make(manager);
+
+      THEN("terms are provided by the manager, falling back to the defaults") {
+        CHECK(mapper->term(terminology::kTerm_Asset) == "Product");
+        CHECK(mapper->term(terminology::kTerm_Publish) == "Publish");
+        CHECK(mapper->term(terminology::kTerm_Manager) == "Test Manager");
+        CHECK(mapper->term("unknown", "default") == "default");
+      }
+
+      THEN("known terms are substituted, and braces are removed") {
+        CHECK(mapper->replaceTerms("{publish} {asset} to {manager}...") ==
+              "Publish Product to Test Manager...");
+        CHECK(mapper->replaceTerms("{asset}} {{shot}") == "Product Shot");
+        CHECK(mapper->replaceTerms("no terms") == "no terms");
+      }
+
+      THEN("if any term is unknown, none are substituted") {
+        CHECK(mapper->replaceTerms("{publish} {unknown}") == "publish unknown");
+      }
+
+      THEN("batches of strings and pre-parsed strings are substituted") {
+        CHECK(mapper->replaceTerms(std::vector<Str>{"{asset}", "{shots}"}) ==
+              std::vector<Str>{"Product", "Shots"});
+        const std::vector<terminology::Template> templates{
+            terminology::Template{"{asset}s"}, terminology::Template{"{unknown} {asset}"}};
+        CHECK(mapper->replaceTerms(templates) == std::vector<Str>{"Products", "unknown asset"});
+      }
+
+      AND_WHEN("another Mapper is constructed with the same terminology") {
+        const terminology::MapperPtr otherMapper = terminology::Mapper::make(manager);
+
+        THEN("the manager's terminology is reused") {
+          CHECK(updateTerminologyCallCount == 1);
+          CHECK(otherMapper->terminology() == mapper->terminology());
+        }
+      }
+
+      AND_WHEN("caches are flushed and another Mapper is constructed") {
+        manager->flushCaches();
+        static_cast<void>(terminology::Mapper::make(manager));
+
+        THEN("the manager is queried again") {
+          CHECK(updateTerminologyCallCount == 2);
+        }
+      }
+
+      AND_WHEN("a Mapper is constructed with different terminology") {
+        const terminology::MapperPtr otherMapper =
+            terminology::Mapper::make(manager, StrMap{{"take", "Take"}});
+
+        THEN("the manager is queried for the new terms") {
+          CHECK(updateTerminologyCallCount == 2);
+          CHECK(otherMapper->replaceTerms("{take} of {asset}") == "Take of Product");
+        }
+      }
+    }
+  }
+
+  GIVEN("a Manager whose plugin does not customize terminology") {
+    const auto mockManagerInterface = std::make_shared<MockTerminologyManagerInterface>();
+    const auto manager = hostApi::Manager::make(mockManagerInterface, makeMockHostSession());
+    {
+      ALLOW_CALL(*mockManagerInterface, identifier()).RETURN("org.openassetio.test.manager");
+      REQUIRE_CALL(*mockManagerInterface, initialize(_, _));
+      ALLOW_CALL(*mockManagerInterface, hasCapability(_))
+          .RETURN(_1 != Capability::kStatefulContexts && _1 != Capability::kCustomTerminology);
+      REQUIRE_CALL(*mockManagerInterface, info()).RETURN(InfoDictionary{});
+      manager->initialize({});
+    }
+
+    ALLOW_CALL(*mockManagerInterface, displayName()).RETURN("Test Manager");
+
+    WHEN("a Mapper is constructed") {
+      FORBID_CALL(*mockManagerInterface, updateTerminology(_, _));
+      const terminology::MapperPtr mapper = terminology::Mapper::make(manager);
+
+      THEN("the given terminology is used, without querying the manager") {
+        CHECK(mapper->replaceTerms("{publish} {asset}") == "Publish Asset");
+      }
+    }
+  }
+
+  GIVEN("no Manager") {
+    THEN("a Mapper cannot be constructed") {
+      CHECK_THROWS_AS(terminology::Mapper::make(nullptr),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
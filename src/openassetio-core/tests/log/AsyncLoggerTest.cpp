@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/AsyncLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::errors::InputValidationException;
+using openassetio::log::AsyncLogger;
+using openassetio::log::LoggerInterface;
+using Severity = LoggerInterface::Severity;
+using Messages = std::vector<std::pair<Severity, Str>>;
+
+/// Logger that records messages, optionally blocking until released.
+struct RecordingLoggerInterface : LoggerInterface {
+  void log(Severity severity, const Str& message) override {
+    std::unique_lock lock{mutex};
+    condition.wait(lock, [&] { return !isBlocked; });
+    messages.emplace_back(severity, message);
+    threadIds.push_back(std::this_thread::get_id());
+  }
+
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override {
+    return severity != Severity::kDebugApi;
+  }
+
+  void logStructured(Severity severity, const Str& message,
+                     const openassetio::InfoDictionary& fields) override {
+    log(severity, message);
+    const std::lock_guard lock{mutex};
+    fieldsByMessage.emplace_back(message, fields);
+  }
+
+  void setBlocked(const bool blocked) {
+    {
+      const std::lock_guard lock{mutex};
+      isBlocked = blocked;
+    }
+    condition.notify_all();
+  }
+
+  Messages recorded() {
+    const std::lock_guard lock{mutex};
+    return messages;
+  }
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool isBlocked = false;
+  Messages messages;
+  std::vector<std::thread::id> threadIds;
+  std::vector<std::pair<Str, openassetio::InfoDictionary>> fieldsByMessage;
+};
+}  // namespace
+
+SCENARIO("Constructing an AsyncLogger") {
+  GIVEN("a null upstream logger") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          AsyncLogger::make(nullptr), InputValidationException,
+          Catch::Message("AsyncLogger cannot be constructed with null logger."));
+    }
+  }
+
+  GIVEN("a zero capacity") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          AsyncLogger::make(std::make_shared<RecordingLoggerInterface>(), 0),
+          InputValidationException,
+          Catch::Message("AsyncLogger capacity must be greater than zero."));
+    }
+  }
+
+  GIVEN("an upstream logger") {
+    const auto upstreamLogger = std::make_shared<RecordingLoggerInterface>();
+
+    THEN("the upstream logger is retained and queried") {
+      const auto logger = AsyncLogger::make(upstreamLogger);
+      CHECK(logger->upstreamLogger() == upstreamLogger);
+      CHECK(logger->isSeverityLogged(Severity::kInfo));
+      CHECK_FALSE(logger->isSeverityLogged(Severity::kDebugApi));
+    }
+  }
+}
+
+SCENARIO("Logging asynchronously") {
+  GIVEN("an AsyncLogger wrapping a logger") {
+    const auto upstreamLogger = std::make_shared<RecordingLoggerInterface>();
+    const auto logger = AsyncLogger::make(upstreamLogger);
+
+    WHEN("messages are logged and flushed") {
+      logger->log(Severity::kInfo, "first");
+      logger->log(Severity::kError, "second");
+      logger->flush();
+
+      THEN("messages are delivered in order on a background thread") {
+        CHECK(upstreamLogger->recorded() ==
+              Messages{{Severity::kInfo, "first"}, {Severity::kError, "second"}});
+        CHECK(upstreamLogger->threadIds[0] != std::this_thread::get_id());
+      }
+    }
+
+    WHEN("a structured message is logged and flushed") {
+      const openassetio::InfoDictionary fields{{"batchSize", openassetio::Int{3}}};
+      logger->logStructured(Severity::kInfo, "structured", fields);
+      logger->flush();
+
+      THEN("the message is delivered with its fields") {
+        CHECK(upstreamLogger->recorded() == Messages{{Severity::kInfo, "structured"}});
+        CHECK(upstreamLogger->fieldsByMessage ==
+              std::vector<std::pair<Str, openassetio::InfoDictionary>>{{"structured", fields}});
+      }
+    }
+
+    WHEN("messages are logged from many threads") {
+      const auto blockingLogger =
+          AsyncLogger::make(upstreamLogger, 64, AsyncLogger::OverflowPolicy::kBlock);
+      constexpr std::size_t kThreadCount = 8;
+      constexpr std::size_t kMessageCount = 500;
+
+      std::vector<std::thread> threads;
+      threads.reserve(kThreadCount);
+      for (std::size_t threadIdx = 0; threadIdx < kThreadCount; ++threadIdx) {
+        threads.emplace_back([&, threadIdx] {
+          for (std::size_t msgIdx = 0; msgIdx < kMessageCount; ++msgIdx) {
+            blockingLogger->log(Severity::kInfo, std::to_string(threadIdx));
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+      blockingLogger->flush();
+
+      THEN("all messages are delivered") {
+        CHECK(upstreamLogger->recorded().size() == kThreadCount * kMessageCount);
+      }
+    }
+  }
+
+  GIVEN("an AsyncLogger that has queued messages") {
+    const auto upstreamLogger = std::make_shared<RecordingLoggerInterface>();
+    auto logger = AsyncLogger::make(upstreamLogger);
+    upstreamLogger->setBlocked(true);
+    logger->log(Severity::kInfo, "first");
+    logger->log(Severity::kInfo, "second");
+
+    WHEN("the AsyncLogger is destroyed") {
+      upstreamLogger->setBlocked(false);
+      logger.reset();
+
+      THEN("queued messages are delivered") {
+        CHECK(upstreamLogger->recorded() ==
+              Messages{{Severity::kInfo, "first"}, {Severity::kInfo, "second"}});
+      }
+    }
+  }
+}
+
+SCENARIO("Logging to a full AsyncLogger") {
+  GIVEN("a blocked upstream logger") {
+    const auto upstreamLogger = std::make_shared<RecordingLoggerInterface>();
+    upstreamLogger->setBlocked(true);
+
+    AND_GIVEN("an AsyncLogger configured to drop messages") {
+      const auto logger =
+          AsyncLogger::make(upstreamLogger, 2, AsyncLogger::OverflowPolicy::kDrop);
+
+      WHEN("more messages are logged than can be queued") {
+        // One message may be taken by the (blocked) background thread,
+        // so up to three messages are in flight.
+        for (std::size_t msgIdx = 0; msgIdx < 5; ++msgIdx) {
+          logger->log(Severity::kInfo, std::to_string(msgIdx));
+        }
+        const std::size_t droppedCount = logger->droppedCount();
+        upstreamLogger->setBlocked(false);
+        logger->flush();
+
+        THEN("excess messages are dropped and reported") {
+          CHECK(droppedCount >= 2);
+          CHECK(logger->droppedCount() == droppedCount);
+
+          const Messages messages = upstreamLogger->recorded();
+          CHECK(messages.size() == 5 - droppedCount + 1);
+          const std::pair<Severity, Str> expectedWarning{
+              Severity::kWarning, "AsyncLogger: Dropped " + std::to_string(droppedCount) +
+                                      " message(s) as the queue was full."};
+          CHECK(std::find(messages.begin(), messages.end(), expectedWarning) != messages.end());
+        }
+      }
+    }
+
+    AND_GIVEN("an AsyncLogger configured to block") {
+      const auto logger =
+          AsyncLogger::make(upstreamLogger, 2, AsyncLogger::OverflowPolicy::kBlock);
+
+      WHEN("more messages are logged than can be queued") {
+        std::thread producer{[&] {
+          for (std::size_t msgIdx = 0; msgIdx < 5; ++msgIdx) {
+            logger->log(Severity::kInfo, std::to_string(msgIdx));
+          }
+        }};
+        upstreamLogger->setBlocked(false);
+        producer.join();
+        logger->flush();
+
+        THEN("no messages are dropped") {
+          CHECK(logger->droppedCount() == 0);
+          CHECK(upstreamLogger->recorded() == Messages{{Severity::kInfo, "0"},
+                                                       {Severity::kInfo, "1"},
+                                                       {Severity::kInfo, "2"},
+                                                       {Severity::kInfo, "3"},
+                                                       {Severity::kInfo, "4"}});
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/BufferedLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::errors::InputValidationException;
+using openassetio::log::BufferedLogger;
+using openassetio::log::LoggerInterface;
+using Severity = LoggerInterface::Severity;
+using Messages = std::vector<std::pair<Severity, Str>>;
+
+/// Logger that records messages.
+struct RecordingLoggerInterface : LoggerInterface {
+  void log(Severity severity, const Str& message) override {
+    messages.emplace_back(severity, message);
+  }
+
+  Messages messages;
+};
+}  // namespace
+
+SCENARIO("Constructing a BufferedLogger") {
+  GIVEN("a null upstream logger") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          BufferedLogger::make(nullptr), InputValidationException,
+          Catch::Message("BufferedLogger cannot be constructed with null logger."));
+    }
+  }
+
+  GIVEN("a zero maximum number of buffered messages") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          BufferedLogger::make(std::make_shared<RecordingLoggerInterface>(), 0),
+          InputValidationException,
+          Catch::Message("BufferedLogger maximum buffered messages must be greater than zero."));
+    }
+  }
+
+  GIVEN("an upstream logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+
+    THEN("the upstream logger is retained") {
+      CHECK(BufferedLogger::make(logger)->upstreamLogger() == logger);
+    }
+  }
+}
+
+SCENARIO("Buffering log messages") {
+  GIVEN("a buffered logger wrapping a logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto bufferedLogger = BufferedLogger::make(logger, 3);
+
+    WHEN("a message is logged outside of a scope") {
+      bufferedLogger->log(Severity::kInfo, "message");
+
+      THEN("the message is relayed immediately") {
+        CHECK(logger->messages == Messages{{Severity::kInfo, "message"}});
+      }
+    }
+
+    WHEN("messages are logged within a scope") {
+      std::optional<BufferedLogger::Scope> scope{std::in_place, bufferedLogger};
+      bufferedLogger->log(Severity::kInfo, "first");
+      bufferedLogger->logStructured(Severity::kWarning, "second", {{"key", Str{"value"}}});
+
+      THEN("the messages are buffered") { CHECK(logger->messages.empty()); }
+
+      AND_WHEN("the scope ends") {
+        scope.reset();
+
+        THEN("the messages are relayed in order") {
+          CHECK(logger->messages ==
+                Messages{{Severity::kInfo, "first"}, {Severity::kWarning, "second [key=value]"}});
+        }
+      }
+
+      AND_WHEN("the scope is flushed") {
+        scope->flush();
+
+        THEN("the messages are relayed without ending the scope") {
+          CHECK(logger->messages.size() == 2);
+          bufferedLogger->log(Severity::kInfo, "third");
+          CHECK(logger->messages.size() == 2);
+        }
+      }
+
+      AND_WHEN("a nested scope ends") {
+        { const BufferedLogger::Scope nestedScope{bufferedLogger}; }
+
+        THEN("the messages remain buffered by the outer scope") {
+          CHECK(logger->messages.empty());
+        }
+      }
+
+      AND_WHEN("the maximum number of buffered messages is reached") {
+        bufferedLogger->log(Severity::kInfo, "third");
+
+        THEN("the messages are relayed early") { CHECK(logger->messages.size() == 3); }
+      }
+
+      AND_WHEN("a message is logged on another thread") {
+        std::thread{[&] { bufferedLogger->log(Severity::kInfo, "other thread"); }}.join();
+
+        THEN("the message is relayed immediately") {
+          CHECK(logger->messages == Messages{{Severity::kInfo, "other thread"}});
+        }
+      }
+    }
+  }
+
+  GIVEN("a logger that is not a buffered logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+
+    WHEN("a message is logged within a scope for the logger") {
+      const BufferedLogger::Scope scope{logger};
+      logger->log(Severity::kInfo, "message");
+
+      THEN("the scope has no effect") {
+        CHECK(logger->messages == Messages{{Severity::kInfo, "message"}});
+      }
+    }
+  }
+}
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/ConsoleLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::errors::InputValidationException;
+using openassetio::log::ConsoleLogger;
+using Severity = openassetio::log::LoggerInterface::Severity;
+
+/// String buffer that can be read whilst another thread writes to it.
+/// Recursive, since `xsputn` may call `overflow`.
+class LockingStringBuf final : public std::stringbuf {
+ public:
+  [[nodiscard]] Str lockedStr() const {
+    const std::lock_guard lock{mutex_};
+    return str();
+  }
+
+ protected:
+  std::streamsize xsputn(const char* chars, const std::streamsize count) override {
+    const std::lock_guard lock{mutex_};
+    return std::stringbuf::xsputn(chars, count);
+  }
+
+  int_type overflow(const int_type chr) override {
+    const std::lock_guard lock{mutex_};
+    return std::stringbuf::overflow(chr);
+  }
+
+ private:
+  mutable std::recursive_mutex mutex_;
+};
+
+/// Capture std::cerr for the lifetime of the instance.
+struct CapturedStderr {
+  CapturedStderr() : original{std::cerr.rdbuf(&captured)} {}
+  ~CapturedStderr() { std::cerr.rdbuf(original); }
+
+  CapturedStderr(const CapturedStderr&) = delete;
+  CapturedStderr(CapturedStderr&&) noexcept = delete;
+  CapturedStderr& operator=(const CapturedStderr&) = delete;
+  CapturedStderr& operator=(CapturedStderr&&) noexcept = delete;
+
+  [[nodiscard]] Str str() const { return captured.lockedStr(); }
+
+  LockingStringBuf captured;
+  std::streambuf* original;
+};
+}  // namespace
+
+SCENARIO("ConsoleLogger output formatting") {
+  CapturedStderr stderrCapture;
+
+  GIVEN("a ConsoleLogger without color") {
+    const auto logger = ConsoleLogger::make(false);
+
+    WHEN("messages are logged") {
+      logger->log(Severity::kDebugApi, "A message");
+      logger->log(Severity::kWarning, "Another message");
+
+      THEN("each is written on a line, with its right-aligned severity") {
+        CHECK(stderrCapture.str() ==
+              "   debugApi: A message\n"
+              "    warning: Another message\n");
+      }
+    }
+  }
+
+  GIVEN("a ConsoleLogger with color") {
+    const auto logger = ConsoleLogger::make(true);
+
+    WHEN("a message is logged") {
+      logger->log(Severity::kError, "A message");
+
+      THEN("the message is colored by its severity") {
+        CHECK(stderrCapture.str() == "\033[0;31m      error: A message\033[0m\n");
+      }
+    }
+  }
+}
+
+SCENARIO("ConsoleLogger concurrent logging") {
+  CapturedStderr stderrCapture;
+  constexpr std::size_t kNumThreads = 4;
+  constexpr std::size_t kNumMessages = 200;
+
+  const auto logger = ConsoleLogger::make(false);
+
+  std::vector<std::thread> threads;
+  for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+    threads.emplace_back([&logger, threadIdx] {
+      const Str message = "Message from thread " + std::to_string(threadIdx);
+      for (std::size_t messageIdx = 0; messageIdx < kNumMessages; ++messageIdx) {
+        logger->log(Severity::kInfo, message);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Lines must be whole, i.e. not interleaved mid-line.
+  std::istringstream output{stderrCapture.str()};
+  std::size_t numLines = 0;
+  for (Str line; std::getline(output, line); ++numLines) {
+    CHECK(line.rfind("       info: Message from thread ", 0) == 0);
+    CHECK(line.size() == 34);
+  }
+  CHECK(numLines == kNumThreads * kNumMessages);
+}
+
+SCENARIO("ConsoleLogger buffered output") {
+  CapturedStderr stderrCapture;
+
+  GIVEN("a ConsoleLogger with a long flush interval") {
+    auto logger = ConsoleLogger::make(false, std::chrono::hours{1});
+
+    WHEN("a message below warning severity is logged") {
+      logger->log(Severity::kDebug, "A message");
+
+      THEN("it is not yet written") { CHECK(stderrCapture.str().empty()); }
+
+      AND_WHEN("the logger is flushed") {
+        logger->flush();
+
+        THEN("it is written") { CHECK(stderrCapture.str() == "      debug: A message\n"); }
+      }
+
+      AND_WHEN("a warning is logged") {
+        logger->log(Severity::kWarning, "Another message");
+
+        THEN("both messages are written, in order") {
+          CHECK(stderrCapture.str() ==
+                "      debug: A message\n"
+                "    warning: Another message\n");
+        }
+      }
+
+      AND_WHEN("the logger is destroyed") {
+        logger.reset();
+
+        THEN("it is written") { CHECK(stderrCapture.str() == "      debug: A message\n"); }
+      }
+    }
+  }
+
+  GIVEN("a ConsoleLogger with a short flush interval") {
+    const auto logger = ConsoleLogger::make(false, std::chrono::milliseconds{1});
+
+    WHEN("a message below warning severity is logged") {
+      logger->log(Severity::kDebug, "A message");
+
+      THEN("it is written once the interval elapses") {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+        Str output;
+        while ((output = stderrCapture.str()).empty() &&
+               std::chrono::steady_clock::now() < deadline) {
+          std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        CHECK(output == "      debug: A message\n");
+      }
+    }
+  }
+
+  GIVEN("a negative flush interval") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(ConsoleLogger::make(false, std::chrono::milliseconds{-1}),
+                           InputValidationException,
+                           Catch::Message("ConsoleLogger flush interval must not be negative."));
+    }
+  }
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/JsonLinesLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+namespace {
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::errors::InputValidationException;
+using openassetio::log::JsonLinesLogger;
+using Severity = openassetio::log::LoggerInterface::Severity;
+
+/// Temporary file, removed on destruction.
+struct TempFile {
+  TempFile()
+      : path{(std::filesystem::temp_directory_path() /
+              ("openassetio-JsonLinesLoggerTest-" + std::to_string(++counter()) + ".jsonl"))
+                 .string()} {
+    std::filesystem::remove(path);
+  }
+  ~TempFile() { std::filesystem::remove(path); }
+
+  TempFile(const TempFile&) = delete;
+  TempFile(TempFile&&) noexcept = delete;
+  TempFile& operator=(const TempFile&) = delete;
+  TempFile& operator=(TempFile&&) noexcept = delete;
+
+  [[nodiscard]] std::vector<Str> lines() const {
+    std::ifstream stream{path};
+    std::vector<Str> result;
+    for (Str line; std::getline(stream, line);) {
+      result.push_back(line);
+    }
+    return result;
+  }
+
+  static std::size_t& counter() {
+    static std::size_t count = 0;
+    return count;
+  }
+
+  Str path;
+};
+
+/// Strip the timestamp and thread, which vary between runs.
+Str withoutPreamble(const Str& line) {
+  const std::size_t severityPos = line.find(R"("severity")");
+  const std::size_t messagePos = line.find(R"("message")");
+  REQUIRE(line.rfind(R"({"timestamp":)", 0) == 0);
+  REQUIRE(severityPos != Str::npos);
+  REQUIRE(messagePos != Str::npos);
+  const std::size_t threadPos = line.find(R"(,"thread":)");
+  REQUIRE(threadPos != Str::npos);
+  return "{" + line.substr(severityPos, threadPos - severityPos) + "," + line.substr(messagePos);
+}
+}  // namespace
+
+SCENARIO("Constructing a JsonLinesLogger") {
+  GIVEN("a path that cannot be opened") {
+    const Str path = (std::filesystem::temp_directory_path() / "non-existent-dir" / "log.jsonl")
+                         .string();
+
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(JsonLinesLogger::make(path), InputValidationException,
+                           Catch::Message("JsonLinesLogger: Could not open '" + path +
+                                          "' for writing."));
+    }
+  }
+}
+
+SCENARIO("Logging JSON lines") {
+  GIVEN("a JsonLinesLogger") {
+    const TempFile file;
+    auto logger = JsonLinesLogger::make(file.path);
+
+    WHEN("a message is logged") {
+      logger->log(Severity::kInfo, "A \"quoted\"\tmessage\n");
+      logger->flush();
+
+      THEN("a line is written with the escaped message") {
+        const std::vector<Str> lines = file.lines();
+        REQUIRE(lines.size() == 1);
+        CHECK(withoutPreamble(lines[0]) ==
+              R"({"severity":"info","message":"A \"quoted\"\tmessage\n"})");
+      }
+    }
+
+    WHEN("a structured message is logged") {
+      using openassetio::Float;
+      const InfoDictionary fields{{"method", Str{"resolve"}},
+                                  {"batchSize", openassetio::Int{100}},
+                                  {"elapsed", Float{1.5}},
+                                  {"isSuccess", true},
+                                  {"invalid", std::numeric_limits<Float>::infinity()}};
+      logger->logStructured(Severity::kDebugApi, "Called", fields);
+      logger->flush();
+
+      THEN("a line is written with the fields in key order") {
+        const std::vector<Str> lines = file.lines();
+        REQUIRE(lines.size() == 1);
+        CHECK(withoutPreamble(lines[0]) ==
+              R"({"severity":"debugApi","message":"Called","fields":{"batchSize":100,)"
+              R"("elapsed":1.5,"invalid":null,"isSuccess":true,"method":"resolve"}})");
+      }
+    }
+
+    WHEN("a warning is logged") {
+      logger->log(Severity::kWarning, "warning");
+
+      THEN("the line is written without an explicit flush") {
+        CHECK(file.lines().size() == 1);
+      }
+    }
+
+    WHEN("the logger is destroyed") {
+      logger->log(Severity::kDebug, "first");
+      logger->log(Severity::kDebug, "second");
+      logger.reset();
+
+      THEN("buffered lines are written") { CHECK(file.lines().size() == 2); }
+    }
+  }
+
+  GIVEN("an existing log file") {
+    const TempFile file;
+    {
+      std::ofstream stream{file.path};
+      stream << "existing\n";
+    }
+
+    WHEN("a JsonLinesLogger logs to the file") {
+      JsonLinesLogger::make(file.path)->log(Severity::kInfo, "message");
+
+      THEN("the line is appended") {
+        const std::vector<Str> lines = file.lines();
+        REQUIRE(lines.size() == 2);
+        CHECK(lines[0] == "existing");
+      }
+    }
+  }
+}
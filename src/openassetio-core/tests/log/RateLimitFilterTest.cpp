@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/log/RateLimitFilter.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::errors::InputValidationException;
+using openassetio::log::LoggerInterface;
+using openassetio::log::RateLimitFilter;
+using Severity = LoggerInterface::Severity;
+using Messages = std::vector<std::pair<Severity, Str>>;
+
+/// Logger that records messages.
+struct RecordingLoggerInterface : LoggerInterface {
+  void log(Severity severity, const Str& message) override {
+    messages.emplace_back(severity, message);
+  }
+
+  Messages messages;
+};
+
+/// An interval long enough that it cannot elapse during a test.
+constexpr std::chrono::milliseconds kLongInterval = std::chrono::hours{1};
+}  // namespace
+
+SCENARIO("Constructing a RateLimitFilter") {
+  GIVEN("a null upstream logger") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          RateLimitFilter::make(nullptr), InputValidationException,
+          Catch::Message("RateLimitFilter cannot be constructed with null logger."));
+    }
+  }
+
+  GIVEN("a non-positive interval") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          RateLimitFilter::make(std::make_shared<RecordingLoggerInterface>(), 1,
+                                std::chrono::milliseconds{0}),
+          InputValidationException,
+          Catch::Message("RateLimitFilter interval must be positive."));
+    }
+  }
+
+  GIVEN("an upstream logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+
+    THEN("the upstream logger is retained") {
+      CHECK(RateLimitFilter::make(logger)->upstreamLogger() == logger);
+    }
+  }
+}
+
+SCENARIO("Rate limiting log messages") {
+  GIVEN("a rate limit filter wrapping a logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    auto filter = RateLimitFilter::make(logger, 2, kLongInterval);
+
+    WHEN("messages within the limit are logged") {
+      filter->log(Severity::kWarning, "first");
+      filter->log(Severity::kWarning, "second");
+
+      THEN("messages are relayed") {
+        CHECK(logger->messages ==
+              Messages{{Severity::kWarning, "first"}, {Severity::kWarning, "second"}});
+        CHECK(filter->suppressedCount() == 0);
+      }
+    }
+
+    WHEN("more messages than the limit are logged") {
+      for (std::size_t idx = 0; idx < 5; ++idx) {
+        filter->log(Severity::kWarning, std::to_string(idx));
+      }
+
+      THEN("excess messages are suppressed") {
+        CHECK(logger->messages ==
+              Messages{{Severity::kWarning, "0"}, {Severity::kWarning, "1"}});
+        CHECK(filter->suppressedCount() == 3);
+      }
+
+      AND_WHEN("messages of another severity are logged") {
+        filter->log(Severity::kError, "error");
+        filter->logStructured(Severity::kError, "structured", {{"key", Str{"value"}}});
+
+        THEN("they are relayed, since limits are per severity") {
+          CHECK(logger->messages == Messages{{Severity::kWarning, "0"},
+                                             {Severity::kWarning, "1"},
+                                             {Severity::kError, "error"},
+                                             {Severity::kError, "structured [key=value]"}});
+        }
+      }
+
+      AND_WHEN("the filter is destroyed") {
+        filter.reset();
+
+        THEN("the suppressed count is reported") {
+          REQUIRE(logger->messages.size() == 3);
+          CHECK(logger->messages.back() ==
+                std::pair{Severity::kWarning,
+                          Str{"RateLimitFilter: Suppressed 3 warning message(s) exceeding 2 per "
+                              "3600000ms."}});
+        }
+      }
+    }
+  }
+
+  GIVEN("a rate limit filter with a short interval") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto filter = RateLimitFilter::make(logger, 1, std::chrono::milliseconds{10});
+
+    WHEN("more messages than the limit are logged, then the interval elapses") {
+      filter->log(Severity::kInfo, "first");
+      filter->log(Severity::kInfo, "second");
+      const std::size_t suppressedCount = filter->suppressedCount();
+      std::this_thread::sleep_for(std::chrono::milliseconds{50});
+      filter->log(Severity::kInfo, "third");
+
+      THEN("the suppressed count is reported and messages are relayed again") {
+        // Under a heavily loaded machine, the interval may elapse
+        // between the first two messages.
+        if (suppressedCount == 1) {
+          CHECK(logger->messages ==
+                Messages{{Severity::kInfo, "first"},
+                         {Severity::kInfo,
+                          "RateLimitFilter: Suppressed 1 info message(s) exceeding 1 per 10ms."},
+                         {Severity::kInfo, "third"}});
+        } else {
+          CHECK(logger->messages == Messages{{Severity::kInfo, "first"},
+                                             {Severity::kInfo, "second"},
+                                             {Severity::kInfo, "third"}});
+        }
+      }
+    }
+  }
+
+  GIVEN("a rate limit filter that samples suppressed messages") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto filter = RateLimitFilter::make(logger, 1, kLongInterval, 3);
+
+    WHEN("more messages than the limit are logged") {
+      for (std::size_t idx = 0; idx < 8; ++idx) {
+        filter->log(Severity::kDebug, std::to_string(idx));
+      }
+
+      THEN("one in every sample interval excess messages is relayed") {
+        CHECK(logger->messages ==
+              Messages{{Severity::kDebug, "0"}, {Severity::kDebug, "3"}, {Severity::kDebug, "6"}});
+        CHECK(filter->suppressedCount() == 5);
+      }
+    }
+  }
+}
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/log/SeverityFilter.hpp>
+
+namespace {
+using openassetio::Str;
+using openassetio::log::LoggerInterface;
+using openassetio::log::SeverityFilter;
+using Severity = LoggerInterface::Severity;
+
+/// Logger that records messages, optionally discarding some itself.
+struct RecordingLoggerInterface : LoggerInterface {
+  void log(Severity severity, const Str& message) override {
+    messages.emplace_back(severity, message);
+  }
+
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override {
+    return severity != discardedSeverity;
+  }
+
+  void logStructured(Severity severity, const Str& message,
+                     const openassetio::InfoDictionary& fields) override {
+    structuredMessages.push_back({severity, message, fields});
+  }
+
+  std::vector<std::pair<Severity, Str>> messages;
+  std::vector<std::tuple<Severity, Str, openassetio::InfoDictionary>> structuredMessages;
+  Severity discardedSeverity = Severity::kCritical;
+};
+
+/// Thread-safe logger that discards all messages.
+struct DiscardingLoggerInterface : LoggerInterface {
+  void log([[maybe_unused]] Severity severity, [[maybe_unused]] const Str& message) override {}
+};
+}  // namespace
+
+SCENARIO("Querying whether a severity is logged") {
+  GIVEN("a severity filter wrapping a logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto filter = SeverityFilter::make(logger);
+    filter->setSeverity(Severity::kInfo);
+
+    THEN("severities below the filter severity are not logged") {
+      CHECK_FALSE(filter->isSeverityLogged(Severity::kDebugApi));
+      CHECK_FALSE(filter->isSeverityLogged(Severity::kDebug));
+      CHECK(filter->isSeverityLogged(Severity::kInfo));
+      CHECK(filter->isSeverityLogged(Severity::kError));
+    }
+
+    THEN("severities discarded by the wrapped logger are not logged") {
+      CHECK_FALSE(filter->isSeverityLogged(Severity::kCritical));
+    }
+  }
+}
+
+SCENARIO("Lazily constructing log messages") {
+  GIVEN("a severity filter wrapping a logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const std::shared_ptr<LoggerInterface> filter = SeverityFilter::make(logger);
+    std::size_t constructedCount = 0;
+    const auto messageFn = [&] {
+      ++constructedCount;
+      return Str{"message"};
+    };
+
+    WHEN("a message of a filtered severity is logged lazily") {
+      filter->logLazily(Severity::kDebug, messageFn);
+
+      THEN("the message is not constructed") {
+        CHECK(constructedCount == 0);
+        CHECK(logger->messages.empty());
+      }
+    }
+
+    WHEN("a message of an unfiltered severity is logged lazily") {
+      filter->logLazily(Severity::kWarning, messageFn);
+
+      THEN("the message is constructed and logged") {
+        CHECK(constructedCount == 1);
+        CHECK(logger->messages == std::vector<std::pair<Severity, Str>>{
+                                      {Severity::kWarning, "message"}});
+      }
+    }
+  }
+}
+
+SCENARIO("Filtering structured log messages") {
+  GIVEN("a severity filter wrapping a logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto filter = SeverityFilter::make(logger);
+    filter->setSeverity(Severity::kInfo);
+    const openassetio::InfoDictionary fields{{"method", Str{"resolve"}}};
+
+    WHEN("structured messages are logged") {
+      filter->logStructured(Severity::kDebug, "filtered", fields);
+      filter->logStructured(Severity::kInfo, "relayed", fields);
+
+      THEN("messages of the filter severity or above are relayed with their fields") {
+        REQUIRE(logger->structuredMessages.size() == 1);
+        CHECK(logger->structuredMessages[0] ==
+              std::tuple{Severity::kInfo, Str{"relayed"}, fields});
+        CHECK(logger->messages.empty());
+      }
+    }
+  }
+}
+
+SCENARIO("Overriding the severity of all filters") {
+  GIVEN("severity filters wrapping a logger") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto filterA = SeverityFilter::make(logger);
+    const auto filterB = SeverityFilter::make(logger);
+    filterA->setSeverity(Severity::kWarning);
+    filterB->setSeverity(Severity::kError);
+
+    CHECK_FALSE(SeverityFilter::globalSeverityOverride().has_value());
+
+    WHEN("a global severity override is set") {
+      SeverityFilter::setGlobalSeverityOverride(Severity::kDebug);
+
+      THEN("all filters use the overridden severity") {
+        CHECK(SeverityFilter::globalSeverityOverride() == Severity::kDebug);
+        CHECK(filterA->isSeverityLogged(Severity::kDebug));
+        CHECK(filterB->isSeverityLogged(Severity::kDebug));
+        CHECK_FALSE(filterB->isSeverityLogged(Severity::kDebugApi));
+
+        filterB->log(Severity::kDebug, "message");
+        CHECK(logger->messages ==
+              std::vector<std::pair<Severity, Str>>{{Severity::kDebug, "message"}});
+      }
+
+      THEN("each filter retains its own severity") {
+        CHECK(filterA->getSeverity() == Severity::kWarning);
+        CHECK(filterB->getSeverity() == Severity::kError);
+      }
+
+      THEN("the effective severity of each filter is the overridden severity") {
+        CHECK(filterA->effectiveSeverity() == Severity::kDebug);
+        CHECK(filterB->effectiveSeverity() == Severity::kDebug);
+      }
+
+      AND_WHEN("the global severity override is cleared") {
+        SeverityFilter::setGlobalSeverityOverride(std::nullopt);
+
+        THEN("each filter uses its own severity") {
+          CHECK_FALSE(SeverityFilter::globalSeverityOverride().has_value());
+          CHECK(filterB->effectiveSeverity() == Severity::kError);
+          CHECK(filterA->isSeverityLogged(Severity::kWarning));
+          CHECK_FALSE(filterB->isSeverityLogged(Severity::kWarning));
+        }
+      }
+
+      SeverityFilter::setGlobalSeverityOverride(std::nullopt);
+    }
+  }
+}
+
+SCENARIO("Changing filter severity whilst logging") {
+  GIVEN("a severity filter wrapping a logger that discards messages") {
+    const auto filter = SeverityFilter::make(std::make_shared<DiscardingLoggerInterface>());
+
+    WHEN("the severity is changed whilst other threads log") {
+      std::atomic<bool> isDone{false};
+      std::vector<std::thread> threads;
+      for (std::size_t threadIdx = 0; threadIdx < 4; ++threadIdx) {
+        threads.emplace_back([&] {
+          while (!isDone.load()) {
+            filter->log(Severity::kInfo, "message");
+          }
+        });
+      }
+      for (std::size_t idx = 0; idx < 1000; ++idx) {
+        filter->setSeverity(idx % 2 == 0 ? Severity::kDebug : Severity::kError);
+        SeverityFilter::setGlobalSeverityOverride(
+            idx % 3 == 0 ? std::optional{Severity::kInfo} : std::nullopt);
+      }
+      isDone = true;
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+      SeverityFilter::setGlobalSeverityOverride(std::nullopt);
+
+      THEN("the final severity is retained") { CHECK(filter->getSeverity() == Severity::kError); }
+    }
+  }
+}
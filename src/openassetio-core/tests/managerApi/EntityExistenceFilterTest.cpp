@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/EntityExistenceFilter.hpp>
+
+namespace {
+using openassetio::managerApi::EntityExistenceFilter;
+
+constexpr std::size_t kCount = 1000;
+
+std::string present(const std::size_t idx) { return "present:" + std::to_string(idx); }
+std::string absent(const std::size_t idx) { return "absent:" + std::to_string(idx); }
+}  // namespace
+
+SCENARIO("EntityExistenceFilter construction") {
+  THEN("false positive rates outside of (0, 1) are rejected") {
+    CHECK_THROWS_AS(EntityExistenceFilter::make(1, 0.0),
+                    openassetio::errors::InputValidationException);
+    CHECK_THROWS_AS(EntityExistenceFilter::make(1, 1.0),
+                    openassetio::errors::InputValidationException);
+  }
+
+  THEN("a lower false positive rate uses more bits") {
+    CHECK(EntityExistenceFilter::make(kCount, 0.001)->bitCount() >
+          EntityExistenceFilter::make(kCount, 0.1)->bitCount());
+  }
+
+  GIVEN("an empty filter") {
+    const auto filter = EntityExistenceFilter::make(kCount);
+
+    THEN("it contains nothing") { CHECK_FALSE(filter->mayContain(present(0))); }
+  }
+}
+
+SCENARIO("EntityExistenceFilter membership") {
+  GIVEN("a filter populated with the expected number of entities") {
+    const auto filter = EntityExistenceFilter::make(kCount, 0.01);
+    for (std::size_t idx = 0; idx < kCount; ++idx) {
+      filter->insert(present(idx));
+    }
+
+    THEN("every inserted entity may be contained") {
+      for (std::size_t idx = 0; idx < kCount; ++idx) {
+        CHECK(filter->mayContain(present(idx)));
+      }
+    }
+
+    THEN("entities that were not inserted are mostly rejected") {
+      std::size_t falsePositiveCount = 0;
+      for (std::size_t idx = 0; idx < kCount; ++idx) {
+        if (filter->mayContain(absent(idx))) {
+          ++falsePositiveCount;
+        }
+      }
+      // Generous bound, to avoid relying on the exact hash function.
+      CHECK(falsePositiveCount < kCount / 20);
+    }
+  }
+}
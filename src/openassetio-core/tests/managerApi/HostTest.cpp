@@ -1,14 +1,150 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
 
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 
-OPENASSETIO_FWD_DECLARE(hostApi, HostInterface)
+#include <testSupport/mocks.hpp>
+
+namespace {
+using openassetio::Identifier;
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::testSupport::MockHostInterface;
+using openassetio::testSupport::MockSchedulingHostInterface;
+using trompeloeil::_;
+
+/// Host that counts how many times it is queried.
+struct CountingHostInterface : openassetio::hostApi::HostInterface {
+  [[nodiscard]] Identifier identifier() const override {
+    ++identifierCalls;
+    return "org.openassetio.test.host";
+  }
+  [[nodiscard]] Str displayName() const override {
+    ++displayNameCalls;
+    return displayNameValue;
+  }
+  [[nodiscard]] InfoDictionary info() override {
+    ++infoCalls;
+    return {{"version", Str{"1.0"}}};
+  }
+
+  Str displayNameValue = "Test Host";
+  mutable std::size_t identifierCalls = 0;
+  mutable std::size_t displayNameCalls = 0;
+  std::size_t infoCalls = 0;
+};
+
+/// Run a parallel loop inline, as a host's scheduler might.
+void parallelForInline(const std::size_t count,
+                       const openassetio::hostApi::HostInterface::ParallelForBody& body) {
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    body(idx);
+  }
+}
+}  // namespace
 
 SCENARIO("Host constructor is private") {
   STATIC_REQUIRE_FALSE(std::is_constructible_v<openassetio::managerApi::Host,
                                                openassetio::hostApi::HostInterfacePtr>);
 }
+
+SCENARIO("Host information is queried once") {
+  GIVEN("a Host") {
+    const auto hostInterface = std::make_shared<CountingHostInterface>();
+    const auto host = openassetio::managerApi::Host::make(hostInterface);
+
+    WHEN("host information is queried repeatedly") {
+      for (int idx = 0; idx < 3; ++idx) {
+        CHECK(host->identifier() == "org.openassetio.test.host");
+        CHECK(host->displayName() == "Test Host");
+        CHECK(host->info() == InfoDictionary{{"version", Str{"1.0"}}});
+      }
+
+      THEN("the host is only queried once") {
+        CHECK(hostInterface->identifierCalls == 1);
+        CHECK(hostInterface->displayNameCalls == 1);
+        CHECK(hostInterface->infoCalls == 1);
+      }
+
+      AND_WHEN("the host information changes and the Host is refreshed") {
+        hostInterface->displayNameValue = "Renamed Host";
+        host->refresh();
+
+        THEN("the host is queried again") {
+          CHECK(host->displayName() == "Renamed Host");
+          CHECK(host->identifier() == "org.openassetio.test.host");
+          CHECK(hostInterface->displayNameCalls == 2);
+          CHECK(hostInterface->identifierCalls == 2);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Scheduling work via the Host") {
+  GIVEN("a Host wrapping a host interface with the default scheduler") {
+    const auto host = openassetio::managerApi::Host::make(std::make_shared<MockHostInterface>());
+
+    WHEN("a task is submitted") {
+      std::promise<void> ran;
+      host->submit([&ran] { ran.set_value(); });
+
+      THEN("the task is run") { ran.get_future().get(); }
+    }
+
+    WHEN("a parallel loop is run") {
+      std::vector<std::atomic<std::size_t>> calls(100);
+      host->parallelFor(calls.size(), [&calls](const std::size_t idx) { ++calls[idx]; });
+
+      THEN("the body is called once with each index") {
+        for (const std::atomic<std::size_t>& callCount : calls) {
+          CHECK(callCount == 1);
+        }
+      }
+    }
+
+    WHEN("a parallel loop body throws") {
+      THEN("the exception is rethrown") {
+        CHECK_THROWS_AS(host->parallelFor(10,
+                                          [](const std::size_t idx) {
+                                            if (idx == 5) {
+                                              throw std::runtime_error{"failed"};
+                                            }
+                                          }),
+                        std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN("a Host wrapping a host interface with its own scheduler") {
+    const auto hostInterface = std::make_shared<MockSchedulingHostInterface>();
+    const auto host = openassetio::managerApi::Host::make(hostInterface);
+
+    WHEN("work is scheduled") {
+      THEN("it is run by the host's scheduler") {
+        REQUIRE_CALL(*hostInterface, submit(_)).SIDE_EFFECT(_1());
+        REQUIRE_CALL(*hostInterface, parallelFor(4, _)).SIDE_EFFECT(parallelForInline(_1, _2));
+
+        bool ran = false;
+        host->submit([&ran] { ran = true; });
+        std::size_t sum = 0;
+        host->parallelFor(4, [&sum](const std::size_t idx) { sum += idx; });
+
+        CHECK(ran);
+        CHECK(sum == 6);
+      }
+    }
+  }
+}
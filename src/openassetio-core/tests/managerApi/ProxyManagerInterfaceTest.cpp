@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+#include <openassetio/ConditionalResolveResult.hpp>
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ProxyManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/TraitsDataTable.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::testSupport::MockManagerInterface;
+using trompeloeil::_;
+
+/**
+ * Mock manager that additionally mocks the resolve variants, so that
+ * their forwarding can be verified.
+ */
+struct MockResolveVariantsManagerInterface : MockManagerInterface {
+  IMPLEMENT_MOCK8(resolveHeterogeneous);
+  IMPLEMENT_MOCK8(resolveProjected);
+  IMPLEMENT_MOCK7(resolveColumnar);
+  IMPLEMENT_MOCK8(resolveIfChanged);
+  IMPLEMENT_MOCK8(resolveAsync);
+};
+
+/// Layer that forwards everything.
+struct PassThroughManagerInterface : managerApi::ProxyManagerInterface {
+  explicit PassThroughManagerInterface(managerApi::ManagerInterfacePtr proxied)
+      : ProxyManagerInterface{std::move(proxied)} {}
+};
+
+/// Layer that adds a trait to every resolve result.
+struct TaggingManagerInterface : managerApi::ProxyManagerInterface {
+  explicit TaggingManagerInterface(managerApi::ManagerInterfacePtr proxied)
+      : ProxyManagerInterface{std::move(proxied)} {}
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               const ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    ProxyManagerInterface::resolve(
+        entityReferences, traitSet, resolveAccess, context, hostSession,
+        [&](const std::size_t idx, trait::TraitsDataPtr data) {
+          data->addTrait("tagged");
+          successCallback(idx, std::move(data));
+        },
+        errorCallback);
+  }
+};
+
+/// Populate the first row of a single column, as a manager would.
+void populateColumn(trait::TraitsDataTable& results) {
+  results.setValue(0, results.addColumn<Str>("columnar", "key"), Str{"value"});
+}
+
+/// Resolve a single entity synchronously.
+trait::TraitsDataPtr resolveOne(managerApi::ManagerInterface& managerInterface,
+                                const managerApi::HostSessionPtr& hostSession) {
+  trait::TraitsDataPtr result;
+  managerInterface.resolve(
+      {EntityReference{"ref"}}, {}, ResolveAccess::kRead, Context::make(), hostSession,
+      [&](std::size_t, trait::TraitsDataPtr data) { result = std::move(data); },
+      [](std::size_t, const openassetio::errors::BatchElementError&) { FAIL(); });
+  return result;
+}
+}  // namespace
+
+SCENARIO("ProxyManagerInterface construction") {
+  STATIC_REQUIRE_FALSE(
+      std::is_constructible_v<managerApi::ProxyManagerInterface, managerApi::ManagerInterfacePtr>);
+
+  GIVEN("a null manager interface") {
+    THEN("a proxy cannot be constructed") {
+      CHECK_THROWS_AS(PassThroughManagerInterface{nullptr},
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+
+SCENARIO("Forwarding calls through a ProxyManagerInterface") {
+  GIVEN("a manager wrapped in a pass-through proxy") {
+    const auto managerInterface = std::make_shared<MockResolveVariantsManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    const auto proxy = std::make_shared<PassThroughManagerInterface>(managerInterface);
+    const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+    const EntityReferences refs{EntityReference{"ref"}};
+
+    WHEN("the manager is queried") {
+      const InfoDictionary info{{"someKey", Str{"someValue"}}};
+      REQUIRE_CALL(mockManagerInterface, identifier()).RETURN("org.openassetio.test.manager");
+      REQUIRE_CALL(mockManagerInterface, displayName()).RETURN("Test Manager");
+      REQUIRE_CALL(mockManagerInterface, info()).RETURN(info);
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, _, _, hostSession, _, _))
+          .SIDE_EFFECT(_6(0, trait::TraitsData::make({"ref"})));
+
+      THEN("queries are forwarded to the proxied manager") {
+        CHECK(proxy->identifier() == "org.openassetio.test.manager");
+        CHECK(proxy->displayName() == "Test Manager");
+        CHECK(proxy->info() == info);
+        CHECK(resolveOne(*proxy, hostSession)->hasTrait("ref"));
+      }
+    }
+
+    WHEN("caches are flushed for specific entities, and by prefix") {
+      THEN("the targeted flushes are forwarded to the proxied manager") {
+        REQUIRE_CALL(mockManagerInterface, flushEntityCaches(refs, hostSession));
+        REQUIRE_CALL(mockManagerInterface, flushCachesWithPrefix("prefix", hostSession));
+
+        proxy->flushEntityCaches(refs, hostSession);
+        proxy->flushCachesWithPrefix("prefix", hostSession);
+      }
+    }
+
+    WHEN("entities are resolved with a trait set each") {
+      THEN("the trait set indices are forwarded to the proxied manager") {
+        const std::vector<std::size_t> traitSetIndices{1, 0};
+        REQUIRE_CALL(mockManagerInterface,
+                     resolveHeterogeneous(_, _, traitSetIndices, _, _, hostSession, _, _));
+
+        proxy->resolveHeterogeneous(
+            {EntityReference{"a"}, EntityReference{"b"}}, {{"x"}, {"y"}}, traitSetIndices,
+            ResolveAccess::kRead, Context::make(), hostSession,
+            [](std::size_t, const trait::TraitsDataPtr&) {},
+            [](std::size_t, const openassetio::errors::BatchElementError&) {});
+      }
+    }
+
+    WHEN("an entity is resolved with a property projection") {
+      THEN("the projection is forwarded to the proxied manager") {
+        const trait::PropertyProjection projection{{"a", {"key"}}};
+        REQUIRE_CALL(mockManagerInterface,
+                     resolveProjected(refs, _, projection, _, _, hostSession, _, _));
+
+        proxy->resolveProjected(
+            refs, {"a"}, projection, ResolveAccess::kRead, Context::make(), hostSession,
+            [](std::size_t, const trait::TraitsDataPtr&) {},
+            [](std::size_t, const openassetio::errors::BatchElementError&) {});
+      }
+    }
+
+    WHEN("entities are resolved into a columnar table") {
+      REQUIRE_CALL(mockManagerInterface, resolveColumnar(refs, _, _, _, hostSession, _, _))
+          .SIDE_EFFECT(populateColumn(_6));
+
+      trait::TraitsDataTable results;
+      results.reset(1);
+      proxy->resolveColumnar(refs, {}, ResolveAccess::kRead, Context::make(), hostSession,
+                             results,
+                             [](std::size_t, const openassetio::errors::BatchElementError&) {});
+
+      THEN("the table is populated by the proxied manager") {
+        CHECK(results.findColumn("columnar", "key"));
+      }
+    }
+
+    WHEN("an entity is conditionally resolved") {
+      const std::vector<Str> generationTokens{"token"};
+      REQUIRE_CALL(mockManagerInterface,
+                   resolveIfChanged(refs, _, _, generationTokens, _, hostSession, _, _))
+          .SIDE_EFFECT(_7(0, openassetio::ConditionalResolveResult{nullptr, _4[0]}));
+
+      openassetio::ConditionalResolveResult result;
+      proxy->resolveIfChanged(
+          refs, {}, ResolveAccess::kRead, generationTokens, Context::make(), hostSession,
+          [&](std::size_t, openassetio::ConditionalResolveResult value) {
+            result = std::move(value);
+          },
+          [](std::size_t, const openassetio::errors::BatchElementError&) {});
+
+      THEN("the proxied manager's result is returned") {
+        CHECK_FALSE(result.traitsData);
+        CHECK(result.generationToken == "token");
+      }
+    }
+
+    WHEN("an entity is resolved asynchronously") {
+      // The proxied manager's asynchronous implementation is used.
+      REQUIRE_CALL(mockManagerInterface, resolveAsync(refs, _, _, _, hostSession, _, _, _))
+          .SIDE_EFFECT(_8(nullptr));
+
+      bool completed = false;
+      proxy->resolveAsync(
+          refs, {}, ResolveAccess::kRead, Context::make(), hostSession,
+          [](std::size_t, const trait::TraitsDataPtr&) {},
+          [](std::size_t, const openassetio::errors::BatchElementError&) {},
+          [&](const std::exception_ptr& exception) { completed = !exception; });
+
+      THEN("completion is signalled") { CHECK(completed); }
+    }
+  }
+
+  GIVEN("a manager wrapped in a stack of proxies") {
+    const auto managerInterface = std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = *managerInterface;
+    const auto proxy = std::make_shared<PassThroughManagerInterface>(
+        std::make_shared<TaggingManagerInterface>(managerInterface));
+    const managerApi::HostSessionPtr hostSession = openassetio::testSupport::makeMockHostSession();
+
+    WHEN("an entity is resolved") {
+      REQUIRE_CALL(mockManagerInterface, resolve(_, _, _, _, hostSession, _, _))
+          .SIDE_EFFECT(_6(0, trait::TraitsData::make({"ref"})));
+
+      const trait::TraitsDataPtr data = resolveOne(*proxy, hostSession);
+
+      THEN("each layer contributes to the result") {
+        CHECK(data->hasTrait("ref"));
+        CHECK(data->hasTrait("tagged"));
+      }
+    }
+  }
+}
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <variant>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/SyntheticManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <testSupport/mocks.hpp>
+
+namespace {
+namespace hostApi = openassetio::hostApi;
+namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+using openassetio::Context;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::InfoDictionary;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::access::PolicyAccess;
+using openassetio::access::ResolveAccess;
+using openassetio::constants::kInfoKey_EntityReferencesMatchPrefix;
+using openassetio::constants::kInfoKey_IsThreadSafe;
+using openassetio::errors::BatchElementError;
+using openassetio::testSupport::makeMockHostSession;
+using SyntheticManagerInterface = managerApi::SyntheticManagerInterface;
+
+const trait::TraitSet kTraitSet{"traitA", "traitB"};
+
+/// Result of resolving a single entity.
+struct ResolveResult {
+  trait::TraitsDataPtr data;
+  std::optional<BatchElementError> error;
+};
+
+ResolveResult resolveOne(SyntheticManagerInterface& manager, const Str& entityReference,
+                         const managerApi::HostSessionPtr& hostSession) {
+  ResolveResult result;
+  manager.resolve(
+      {EntityReference{entityReference}}, kTraitSet, ResolveAccess::kRead, Context::make(),
+      hostSession,
+      [&](std::size_t, trait::TraitsDataPtr data) { result.data = std::move(data); },
+      [&](std::size_t, BatchElementError error) { result.error = std::move(error); });
+  return result;
+}
+}  // namespace
+
+SCENARIO("SyntheticManagerInterface configuration") {
+  GIVEN("a synthetic manager") {
+    const auto manager = SyntheticManagerInterface::make();
+    const auto hostSession = makeMockHostSession();
+
+    THEN("it has the expected identity and capabilities") {
+      CHECK(manager->identifier() == "org.openassetio.synthetic");
+      CHECK(manager->hasCapability(SyntheticManagerInterface::Capability::kResolution));
+      CHECK(manager->hasCapability(SyntheticManagerInterface::Capability::kExistenceQueries));
+      CHECK_FALSE(manager->hasCapability(SyntheticManagerInterface::Capability::kPublishing));
+    }
+
+    THEN("default settings are reported") {
+      const InfoDictionary settings = manager->settings(hostSession);
+      CHECK(std::get<Str>(settings.at("prefix")) == "synthetic://");
+      CHECK(std::get<Int>(settings.at("propertyCount")) == 1);
+      CHECK(std::get<Int>(settings.at("propertySize")) == 16);
+      CHECK(std::get<Str>(settings.at("entityTraitSet")).empty());
+      CHECK(std::get<Int>(settings.at("callLatencyMicroseconds")) == 0);
+      CHECK(std::get<Int>(settings.at("elementLatencyMicroseconds")) == 0);
+    }
+
+    WHEN("it is initialized with a custom prefix") {
+      manager->initialize({{"prefix", Str{"test:"}}}, hostSession);
+
+      THEN("the prefix is advertised and used to identify references") {
+        const InfoDictionary info = manager->info();
+        CHECK(std::get<Str>(info.at(Str{kInfoKey_EntityReferencesMatchPrefix})) == "test:");
+        CHECK(std::get<bool>(info.at(Str{kInfoKey_IsThreadSafe})));
+        CHECK(manager->isEntityReferenceString("test:a", hostSession));
+        CHECK_FALSE(manager->isEntityReferenceString("synthetic://a", hostSession));
+      }
+    }
+
+    WHEN("it is initialized with invalid settings") {
+      manager->initialize({{"propertyCount", Int{3}}}, hostSession);
+
+      THEN("an exception is thrown and existing settings are retained") {
+        CHECK_THROWS_AS(manager->initialize({{"propertyCount", Int{-1}}}, hostSession),
+                        openassetio::errors::ConfigurationException);
+        CHECK_THROWS_AS(manager->initialize({{"propertySize", Str{"big"}}}, hostSession),
+                        openassetio::errors::ConfigurationException);
+        CHECK_THROWS_AS(manager->initialize({{"prefix", Str{}}}, hostSession),
+                        openassetio::errors::ConfigurationException);
+        CHECK_THROWS_AS(manager->initialize({{"unknown", Int{1}}}, hostSession),
+                        openassetio::errors::ConfigurationException);
+        CHECK(std::get<Int>(manager->settings(hostSession).at("propertyCount")) == 3);
+      }
+    }
+  }
+}
+
+SCENARIO("SyntheticManagerInterface data synthesis") {
+  GIVEN("a synthetic manager configured with a property count and size") {
+    const auto manager = SyntheticManagerInterface::make();
+    const auto hostSession = makeMockHostSession();
+    manager->initialize({{"propertyCount", Int{3}}, {"propertySize", Int{40}}}, hostSession);
+
+    WHEN("an entity is resolved") {
+      const ResolveResult result = resolveOne(*manager, "synthetic://a", hostSession);
+
+      THEN("every requested trait has the configured properties") {
+        REQUIRE(result.data);
+        CHECK(result.data->traitSet() == kTraitSet);
+        for (const auto& traitId : kTraitSet) {
+          CHECK(result.data->traitPropertyKeys(traitId) ==
+                trait::property::KeySet{"p0", "p1", "p2"});
+          trait::property::Value value;
+          REQUIRE(result.data->getTraitProperty(&value, traitId, "p1"));
+          CHECK(std::get<Str>(value).size() == 40);
+        }
+      }
+
+      AND_WHEN("the same entity is resolved again") {
+        const ResolveResult again = resolveOne(*manager, "synthetic://a", hostSession);
+
+        THEN("the data is identical") { CHECK(*again.data == *result.data); }
+      }
+
+      AND_WHEN("a different entity is resolved") {
+        const ResolveResult other = resolveOne(*manager, "synthetic://b", hostSession);
+
+        THEN("the data differs") { CHECK_FALSE(*other.data == *result.data); }
+      }
+    }
+
+    WHEN("a reference with a different prefix is resolved") {
+      const ResolveResult result = resolveOne(*manager, "other://a", hostSession);
+
+      THEN("an invalid entity reference error is reported") {
+        CHECK_FALSE(result.data);
+        REQUIRE(result.error);
+        CHECK(result.error->code == BatchElementError::ErrorCode::kInvalidEntityReference);
+      }
+    }
+
+    WHEN("entity existence is queried") {
+      std::size_t existCount = 0;
+      std::size_t errorCount = 0;
+      manager->entityExists(
+          {EntityReference{"synthetic://a"}, EntityReference{"other://b"}}, Context::make(),
+          hostSession, [&](std::size_t, bool exists) { existCount += exists ? 1 : 0; },
+          [&](std::size_t, const BatchElementError&) { ++errorCount; });
+
+      THEN("references with the prefix exist, and others are errors") {
+        CHECK(existCount == 1);
+        CHECK(errorCount == 1);
+      }
+    }
+
+    WHEN("entity traits are queried") {
+      manager->initialize({{"entityTraitSet", Str{"traitA\ntraitB\n"}}}, hostSession);
+      trait::TraitSet traitSet;
+      manager->entityTraits(
+          {EntityReference{"synthetic://a"}}, openassetio::access::EntityTraitsAccess::kRead,
+          Context::make(), hostSession,
+          [&](std::size_t, trait::TraitSet result) { traitSet = std::move(result); },
+          [](std::size_t, const BatchElementError&) {});
+
+      THEN("the configured trait set is reported") { CHECK(traitSet == kTraitSet); }
+    }
+
+    WHEN("management policy is queried") {
+      const trait::TraitsDatas policies =
+          manager->managementPolicy({kTraitSet, kTraitSet}, PolicyAccess::kRead,
+                                    Context::make(), hostSession);
+
+      THEN("an empty policy is returned for each trait set") {
+        REQUIRE(policies.size() == 2);
+        CHECK(policies[0]->traitSet().empty());
+        CHECK(policies[1]->traitSet().empty());
+      }
+    }
+  }
+
+  GIVEN("a synthetic manager configured with a latency") {
+    const auto manager = SyntheticManagerInterface::make();
+    const auto hostSession = makeMockHostSession();
+    manager->initialize(
+        {{"callLatencyMicroseconds", Int{1000}}, {"elementLatencyMicroseconds", Int{500}}},
+        hostSession);
+
+    WHEN("a batch is resolved") {
+      const auto start = std::chrono::steady_clock::now();
+      std::size_t resolved = 0;
+      manager->resolve(
+          {EntityReference{"synthetic://a"}, EntityReference{"synthetic://b"}}, kTraitSet,
+          ResolveAccess::kRead, Context::make(), hostSession,
+          [&](std::size_t, const trait::TraitsDataPtr&) { ++resolved; },
+          [](std::size_t, const BatchElementError&) {});
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+
+      THEN("the call takes at least the configured latency") {
+        CHECK(resolved == 2);
+        CHECK(elapsed >= std::chrono::microseconds{2000});
+      }
+    }
+  }
+
+  GIVEN("a synthetic manager used by a host") {
+    const auto manager = hostApi::Manager::make(SyntheticManagerInterface::make(),
+                                                makeMockHostSession());
+    manager->initialize({{"propertyCount", Int{2}}});
+
+    THEN("entity references are validated and resolved via the host API") {
+      const EntityReference ref = manager->createEntityReference("synthetic://a");
+      const trait::TraitsDataPtr data =
+          manager->resolve(ref, kTraitSet, ResolveAccess::kRead, manager->createContext());
+      CHECK(data->traitPropertyKeys("traitA") == trait::property::KeySet{"p0", "p1"});
+    }
+  }
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/pluginSystem/CppPluginSystem.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerImplementationFactory.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerPlugin.hpp>
+
+namespace {
+namespace pluginSystem = openassetio::pluginSystem;
+using openassetio::Identifier;
+using openassetio::Identifiers;
+using openassetio::Str;
+
+/**
+ * Root directory of the test plugin libraries, containing `pathA` and
+ * `pathB` subdirectories, see tests/CMakeLists.txt.
+ */
+const Str kPluginRoot{OPENASSETIO_CORE_TEST_CPP_PLUGIN_DIR};
+const Str kPathA = kPluginRoot + "/pathA";
+const Str kPathB = kPluginRoot + "/pathB";
+
+#if defined(_WIN32)
+constexpr char kPathSeparator = ';';
+#else
+constexpr char kPathSeparator = ':';
+#endif
+
+const Identifier kManagerPluginId = "org.openassetio.test.pluginSystem.managerPlugin";
+const Identifier kManagerPluginBId = "org.openassetio.test.pluginSystem.managerPluginB";
+const Identifier kBasicPluginId = "org.openassetio.test.pluginSystem.basicPlugin";
+
+struct RecordingLoggerInterface : openassetio::log::LoggerInterface {
+  void log(Severity severity, const Str& message) override {
+    messages.emplace_back(severity, message);
+  }
+
+  [[nodiscard]] bool logged(Severity severity) const {
+    return std::any_of(messages.begin(), messages.end(),
+                       [&](const auto& message) { return message.first == severity; });
+  }
+
+  std::vector<std::pair<Severity, Str>> messages;
+};
+
+Identifiers sorted(Identifiers identifiers) {
+  std::sort(identifiers.begin(), identifiers.end());
+  return identifiers;
+}
+}  // namespace
+
+SCENARIO("Loading C++ plugins") {
+  GIVEN("a C++ plugin system") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const pluginSystem::CppPluginSystemPtr cppPluginSystem =
+        pluginSystem::CppPluginSystem::make(logger);
+
+    THEN("no plugins are known") { CHECK(cppPluginSystem->identifiers().empty()); }
+
+    WHEN("a path containing plugins is scanned") {
+      cppPluginSystem->scan(kPathA);
+
+      THEN("plugins are registered") {
+        CHECK(sorted(cppPluginSystem->identifiers()) ==
+              Identifiers{kBasicPluginId, kManagerPluginId});
+        CHECK(cppPluginSystem->plugin(kManagerPluginId)->identifier() == kManagerPluginId);
+      }
+
+      THEN("libraries without an entry point are reported") {
+        CHECK(logger->logged(RecordingLoggerInterface::Severity::kError));
+      }
+
+      AND_WHEN("the plugin system is reset") {
+        cppPluginSystem->reset();
+
+        THEN("no plugins are known") { CHECK(cppPluginSystem->identifiers().empty()); }
+      }
+    }
+
+    WHEN("multiple paths providing the same identifier are scanned") {
+      cppPluginSystem->scan(kPathB + kPathSeparator + kPathA);
+
+      THEN("the plugin from the leftmost path is used") {
+        CHECK(sorted(cppPluginSystem->identifiers()) ==
+              Identifiers{kBasicPluginId, kManagerPluginId, kManagerPluginBId});
+
+        const auto managerPlugin =
+            std::dynamic_pointer_cast<pluginSystem::CppPluginSystemManagerPlugin>(
+                cppPluginSystem->plugin(kManagerPluginId));
+        REQUIRE(managerPlugin);
+        CHECK(managerPlugin->interface()->displayName() == "Plugin B");
+      }
+    }
+
+    WHEN("a path that does not exist is scanned") {
+      cppPluginSystem->scan(kPluginRoot + "/missing");
+
+      THEN("no plugins are registered") { CHECK(cppPluginSystem->identifiers().empty()); }
+    }
+
+    WHEN("an unknown plugin is requested") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(cppPluginSystem->plugin("unknown"),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+}
+
+SCENARIO("Instantiating managers from C++ plugins") {
+  GIVEN("a C++ manager implementation factory searching multiple paths") {
+    const auto logger = std::make_shared<RecordingLoggerInterface>();
+    const auto factory = pluginSystem::CppPluginSystemManagerImplementationFactory::make(
+        kPathA + kPathSeparator + kPathB, logger);
+
+    THEN("only manager plugins are listed") {
+      CHECK(sorted(factory->identifiers()) == Identifiers{kManagerPluginId, kManagerPluginBId});
+    }
+
+    WHEN("a manager is instantiated") {
+      const openassetio::managerApi::ManagerInterfacePtr managerInterface =
+          factory->instantiate(kManagerPluginId);
+
+      THEN("the interface from the leftmost path is returned") {
+        CHECK(managerInterface->identifier() == kManagerPluginId);
+        CHECK(managerInterface->displayName() == "Plugin A");
+      }
+    }
+
+    WHEN("a plugin that is not a manager plugin is instantiated") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(factory->instantiate(kBasicPluginId),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+}
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Test C++ plugin that is not a manager plugin.
+ */
+#include <memory>
+
+#include <openassetio/pluginSystem/CppPluginSystemPlugin.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+struct TestBasicPlugin : openassetio::pluginSystem::CppPluginSystemPlugin {
+  static openassetio::pluginSystem::CppPluginSystemPluginPtr make() {
+    return std::make_shared<TestBasicPlugin>();
+  }
+
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return "org.openassetio.test.pluginSystem.basicPlugin";
+  }
+};
+}  // namespace
+
+OPENASSETIO_CPP_PLUGIN_ENTRY_POINT(TestBasicPlugin::make)
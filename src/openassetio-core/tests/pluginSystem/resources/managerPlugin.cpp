@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Test C++ manager plugin.
+ *
+ * Built multiple times into different plugin search paths, with the
+ * identifier and display name given by the
+ * OPENASSETIO_TEST_PLUGIN_IDENTIFIER and
+ * OPENASSETIO_TEST_PLUGIN_DISPLAY_NAME compile definitions, such that
+ * precedence of search paths can be verified.
+ */
+#include <memory>
+
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerPlugin.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace {
+using openassetio::Identifier;
+using openassetio::Str;
+namespace managerApi = openassetio::managerApi;
+namespace pluginSystem = openassetio::pluginSystem;
+
+struct TestManagerInterface : managerApi::ManagerInterface {
+  [[nodiscard]] Identifier identifier() const override {
+    return OPENASSETIO_TEST_PLUGIN_IDENTIFIER;
+  }
+  [[nodiscard]] Str displayName() const override { return OPENASSETIO_TEST_PLUGIN_DISPLAY_NAME; }
+  bool hasCapability(Capability) override { return false; }
+};
+
+struct TestManagerPlugin : pluginSystem::CppPluginSystemManagerPlugin {
+  static pluginSystem::CppPluginSystemPluginPtr make() {
+    return std::make_shared<TestManagerPlugin>();
+  }
+
+  [[nodiscard]] Identifier identifier() const override {
+    return OPENASSETIO_TEST_PLUGIN_IDENTIFIER;
+  }
+
+  managerApi::ManagerInterfacePtr interface() override {
+    return std::make_shared<TestManagerInterface>();
+  }
+};
+}  // namespace
+
+OPENASSETIO_CPP_PLUGIN_ENTRY_POINT(TestManagerPlugin::make)
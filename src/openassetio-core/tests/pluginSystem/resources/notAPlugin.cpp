@@ -0,0 +1,6 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Test shared library that does not expose a plugin entry point.
+ */
+extern "C" int openassetioTestNotAPlugin() { return 0; }
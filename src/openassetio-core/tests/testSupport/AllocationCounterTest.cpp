@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <testSupport/AllocationCounter.hpp>
+
+using openassetio::testSupport::AllocationCounter;
+
+namespace {
+/// Prevent the compiler from eliding an allocation.
+void escape(const void* ptr) {
+  static const void* volatile sink;
+  sink = ptr;
+}
+}  // namespace
+
+// Note that Catch2 sections allocate, so counts are taken within a
+// single section and checked afterwards.
+
+SCENARIO("Counting allocations") {
+  WHEN("no objects are allocated") {
+    const AllocationCounter allocations;
+    const auto count = allocations.count();
+
+    THEN("the count is zero") { CHECK(count == 0); }
+  }
+
+  WHEN("objects are allocated") {
+    AllocationCounter allocations;
+    const auto single = std::make_unique<int>(1);
+    const auto array = std::make_unique<int[]>(3);
+    const std::unique_ptr<int> nothrow{new (std::nothrow) int{1}};
+    escape(single.get());
+    escape(array.get());
+    escape(nothrow.get());
+    const auto count = allocations.count();
+    allocations.reset();
+    const auto countAfterReset = allocations.count();
+
+    THEN("each allocation is counted") { CHECK(count == 3); }
+
+    THEN("the count is zero after a reset") { CHECK(countAfterReset == 0); }
+  }
+
+  WHEN("an over-aligned object is allocated") {
+    struct alignas(64) OverAligned {
+      char data[64];
+    };
+    const AllocationCounter allocations;
+    const auto overAligned = std::make_unique<OverAligned>();
+    escape(overAligned.get());
+    const auto count = allocations.count();
+
+    THEN("the allocation is counted and correctly aligned") {
+      CHECK(count == 1);
+      CHECK(reinterpret_cast<std::uintptr_t>(overAligned.get()) % 64 == 0);
+    }
+  }
+
+  WHEN("a vector is populated with reserved capacity") {
+    const AllocationCounter allocations;
+    std::vector<int> values;
+    values.reserve(100);
+    for (int idx = 0; idx < 100; ++idx) {
+      values.push_back(idx);
+    }
+    escape(values.data());
+    const auto count = allocations.count();
+
+    THEN("only the reservation is counted") { CHECK(count == 1); }
+  }
+
+  WHEN("another thread allocates") {
+    const AllocationCounter threadAllocations;
+    const AllocationCounter processAllocations{AllocationCounter::Scope::kProcess};
+    std::thread{[] { escape(std::make_unique<int>(1).get()); }}.join();
+    const auto threadCount = threadAllocations.count();
+    const auto processCount = processAllocations.count();
+
+    THEN("only the process scoped counter includes the allocation") {
+      // Starting the thread may itself allocate on this thread.
+      CHECK(processCount > threadCount);
+    }
+  }
+}
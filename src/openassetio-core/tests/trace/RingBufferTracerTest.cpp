@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trace/RingBufferTracer.hpp>
+#include <openassetio/trace/TracerInterface.hpp>
+
+namespace {
+using openassetio::InfoDictionary;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::errors::InputValidationException;
+using openassetio::trace::RingBufferTracer;
+using openassetio::trace::TracerInterface;
+}  // namespace
+
+SCENARIO("Constructing a RingBufferTracer") {
+  GIVEN("a zero capacity") {
+    THEN("construction fails") {
+      CHECK_THROWS_MATCHES(
+          RingBufferTracer::make(0), InputValidationException,
+          Catch::Message("RingBufferTracer capacity must be greater than zero."));
+    }
+  }
+}
+
+SCENARIO("Recording spans") {
+  GIVEN("a ring buffer tracer") {
+    const auto tracer = RingBufferTracer::make(2);
+
+    WHEN("a span is begun") {
+      const TracerInterface::SpanId spanId =
+          tracer->beginSpan("span", {{"begin", Str{"beginValue"}}});
+
+      THEN("the span is not yet retained") { CHECK(tracer->spans().empty()); }
+
+      AND_WHEN("the span is ended") {
+        tracer->endSpan(spanId, {{"end", Int{1}}});
+
+        THEN("the span is retained with attributes from begin and end") {
+          const std::vector<RingBufferTracer::Span> spans = tracer->spans();
+          REQUIRE(spans.size() == 1);
+          CHECK(spans[0].name == "span");
+          CHECK(spans[0].attributes ==
+                InfoDictionary{{"begin", Str{"beginValue"}}, {"end", Int{1}}});
+          CHECK(spans[0].duration >= std::chrono::nanoseconds{0});
+        }
+
+        AND_WHEN("the span is ended again") {
+          tracer->endSpan(spanId, {});
+
+          THEN("it is ignored") { CHECK(tracer->spans().size() == 1); }
+        }
+
+        AND_WHEN("the tracer is cleared") {
+          tracer->clear();
+
+          THEN("no spans are retained") { CHECK(tracer->spans().empty()); }
+        }
+      }
+    }
+
+    WHEN("more spans than the capacity are ended") {
+      for (const char* name : {"first", "second", "third"}) {
+        tracer->endSpan(tracer->beginSpan(name, {}), {});
+      }
+
+      THEN("the oldest spans are discarded") {
+        const std::vector<RingBufferTracer::Span> spans = tracer->spans();
+        REQUIRE(spans.size() == 2);
+        CHECK(spans[0].name == "second");
+        CHECK(spans[1].name == "third");
+      }
+    }
+  }
+}
+
+SCENARIO("Setting the global tracer") {
+  CHECK_FALSE(TracerInterface::globalTracer());
+
+  GIVEN("a tracer") {
+    const auto tracer = RingBufferTracer::make();
+
+    WHEN("the tracer is set as the global tracer") {
+      TracerInterface::setGlobalTracer(tracer);
+
+      THEN("it is returned as the global tracer") {
+        CHECK(TracerInterface::globalTracer() == tracer);
+      }
+
+      AND_WHEN("the global tracer is cleared") {
+        TracerInterface::setGlobalTracer(nullptr);
+
+        THEN("there is no global tracer") { CHECK_FALSE(TracerInterface::globalTracer()); }
+      }
+
+      TracerInterface::setGlobalTracer(nullptr);
+    }
+  }
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/trait/InternedKey.hpp>
+
+using openassetio::trait::property::InternedKey;
+
+SCENARIO("InternedKey is lightweight") {
+  STATIC_REQUIRE(std::is_trivially_copyable_v<InternedKey>);
+  STATIC_REQUIRE(sizeof(InternedKey) == sizeof(void*));
+}
+
+SCENARIO("Interning strings") {
+  GIVEN("a string that has been interned") {
+    const InternedKey key{"openassetio.test.interned.a"};
+
+    THEN("the handle exposes the interned string") {
+      CHECK(key.str() == "openassetio.test.interned.a");
+    }
+
+    WHEN("an equal string is interned") {
+      const InternedKey otherKey{"openassetio.test.interned.a"};
+
+      THEN("the handles compare equal and share storage") {
+        CHECK(key == otherKey);
+        CHECK_FALSE(key != otherKey);
+        CHECK(&key.str() == &otherKey.str());
+        CHECK(std::hash<InternedKey>{}(key) == std::hash<InternedKey>{}(otherKey));
+      }
+    }
+
+    WHEN("a different string is interned") {
+      const InternedKey otherKey{"openassetio.test.interned.b"};
+
+      THEN("the handles compare unequal") {
+        CHECK(key != otherKey);
+        CHECK((key < otherKey) != (otherKey < key));
+      }
+    }
+
+    WHEN("the string is looked up") {
+      const auto found = InternedKey::find("openassetio.test.interned.a");
+
+      THEN("the existing handle is returned") {
+        REQUIRE(found);
+        CHECK(*found == key);
+      }
+    }
+  }
+
+  GIVEN("a string that has never been interned") {
+    THEN("lookup does not find it") {
+      CHECK_FALSE(InternedKey::find("openassetio.test.interned.never"));
+    }
+  }
+
+  GIVEN("more strings than a thread caches") {
+    std::vector<InternedKey> keys;
+    for (int idx = 0; idx < 1000; ++idx) {
+      keys.emplace_back("openassetio.test.interned.many." + std::to_string(idx));
+    }
+
+    THEN("each is repeatedly found and re-interned as the same handle") {
+      for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+          const std::string str = "openassetio.test.interned.many." + std::to_string(idx);
+          const auto found = InternedKey::find(str);
+          REQUIRE(found);
+          CHECK(*found == keys[idx]);
+          CHECK(InternedKey{str} == keys[idx]);
+        }
+      }
+    }
+
+    THEN("a string interned by another thread is found") {
+      std::thread{[] { InternedKey{"openassetio.test.interned.otherThread"}; }}.join();
+
+      const auto found = InternedKey::find("openassetio.test.interned.otherThread");
+      REQUIRE(found);
+      CHECK(found->str() == "openassetio.test.interned.otherThread");
+    }
+  }
+
+  GIVEN("many threads interning the same strings") {
+    std::vector<std::vector<InternedKey>> results(4);
+    std::vector<std::thread> threads;
+    for (auto& result : results) {
+      threads.emplace_back([&result] {
+        for (int idx = 0; idx < 100; ++idx) {
+          result.emplace_back("openassetio.test.interned.threaded." + std::to_string(idx));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    THEN("all threads received the same handles") {
+      for (const auto& result : results) {
+        CHECK(result == results.front());
+      }
+      CHECK(std::unordered_set<InternedKey>(results.front().begin(), results.front().end())
+                .size() == 100);
+    }
+  }
+}
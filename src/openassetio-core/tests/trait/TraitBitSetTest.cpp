@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitBitSet.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace trait = openassetio::trait;
+
+SCENARIO("TraitBitSet set algebra") {
+  GIVEN("an empty bitset") {
+    trait::TraitBitSet bitSet;
+
+    THEN("it has no bits set") {
+      CHECK(bitSet.empty());
+      CHECK(bitSet.count() == 0);
+      CHECK_FALSE(bitSet.test(0));
+      CHECK_FALSE(bitSet.test(1000));
+    }
+
+    WHEN("bits are set either side of a word boundary") {
+      bitSet.set(3);
+      bitSet.set(130);
+
+      THEN("those bits are set") {
+        CHECK_FALSE(bitSet.empty());
+        CHECK(bitSet.count() == 2);
+        CHECK(bitSet.test(3));
+        CHECK(bitSet.test(130));
+        CHECK_FALSE(bitSet.test(4));
+      }
+
+      AND_WHEN("the high bit is reset") {
+        bitSet.reset(130);
+
+        THEN("bitset compares equal to one with only the low bit set") {
+          trait::TraitBitSet expected;
+          expected.set(3);
+          CHECK(bitSet == expected);
+        }
+      }
+    }
+  }
+
+  GIVEN("overlapping bitsets of differing lengths") {
+    trait::TraitBitSet small;
+    small.set(1);
+    trait::TraitBitSet large;
+    large.set(1);
+    large.set(200);
+
+    THEN("subset and intersection tests are correct") {
+      CHECK(small.isSubsetOf(large));
+      CHECK_FALSE(large.isSubsetOf(small));
+      CHECK(small.isSubsetOf(small));
+      CHECK(trait::TraitBitSet{}.isSubsetOf(small));
+      CHECK(small.intersects(large));
+      CHECK(large.intersects(small));
+      CHECK_FALSE(trait::TraitBitSet{}.intersects(large));
+    }
+
+    WHEN("they are intersected") {
+      trait::TraitBitSet result = large;
+      result &= small;
+
+      THEN("only the common bits remain") { CHECK(result == small); }
+    }
+
+    WHEN("they are unioned") {
+      trait::TraitBitSet result = small;
+      result |= large;
+
+      THEN("all bits are set") { CHECK(result == large); }
+    }
+  }
+}
+
+SCENARIO("TraitRegistry mapping") {
+  GIVEN("a registry") {
+    const trait::TraitRegistryPtr registry = trait::TraitRegistry::make();
+
+    THEN("it is empty") {
+      CHECK(registry->size() == 0);
+      CHECK_FALSE(registry->find("a").has_value());
+    }
+
+    WHEN("trait IDs are registered") {
+      const std::size_t aIdx = registry->index("a");
+      const std::size_t bIdx = registry->index("b");
+
+      THEN("indices are sequential and stable") {
+        CHECK(aIdx == 0);
+        CHECK(bIdx == 1);
+        CHECK(registry->index("a") == aIdx);
+        CHECK(registry->find("b") == bIdx);
+        CHECK(registry->size() == 2);
+        CHECK(registry->traitId(aIdx) == "a");
+      }
+
+      THEN("an unallocated index is rejected") {
+        CHECK_THROWS_AS(registry->traitId(2), openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("a trait set is round-tripped through a bitset") {
+      const trait::TraitSet traitSet{"a", "b", "c"};
+      const trait::TraitBitSet bitSet = registry->toBitSet(traitSet);
+
+      THEN("the bitset has a bit per trait") {
+        CHECK(bitSet.count() == 3);
+        CHECK(registry->size() == 3);
+      }
+
+      THEN("the original trait set is recovered") {
+        CHECK(registry->toTraitSet(bitSet) == traitSet);
+      }
+    }
+
+    WHEN("a TraitsData is converted to a bitset") {
+      const trait::TraitsDataPtr traitsData = trait::TraitsData::make({"a", "b"});
+      const trait::TraitBitSet bitSet = registry->toBitSet(*traitsData);
+
+      THEN("the bitset is a subset of a superset of its traits") {
+        CHECK(bitSet.isSubsetOf(registry->toBitSet(trait::TraitSet{"a", "b", "c"})));
+        CHECK_FALSE(bitSet.isSubsetOf(registry->toBitSet(trait::TraitSet{"a"})));
+      }
+    }
+
+    WHEN("a bitset with an unallocated bit is converted") {
+      trait::TraitBitSet bitSet;
+      bitSet.set(5);
+
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(registry->toTraitSet(bitSet),
+                        openassetio::errors::InputValidationException);
+      }
+    }
+  }
+}
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/trait/TraitView.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace {
+namespace trait = openassetio::trait;
+using openassetio::Int;
+using openassetio::Str;
+using trait::TraitPropertyStatus;
+
+struct TestTrait {
+  static constexpr std::string_view kId{"openassetio.test.TraitView"};
+  static constexpr trait::TraitPropertyDescriptor<Str> kLocation{"location"};
+  static constexpr trait::TraitPropertyDescriptor<Int> kFrame{"frame"};
+};
+
+using TestTraitView = trait::TraitView<TestTrait>;
+}  // namespace
+
+SCENARIO("TraitView property types are known at compile time") {
+  STATIC_REQUIRE(TestTraitView::id() == "openassetio.test.TraitView");
+  STATIC_REQUIRE(std::is_same_v<TestTraitView::PropertyType<TestTrait::kLocation>, Str>);
+  STATIC_REQUIRE(
+      std::is_same_v<decltype(std::declval<TestTraitView>().get<TestTrait::kFrame>()),
+                     std::optional<Int>>);
+}
+
+SCENARIO("Accessing properties through a TraitView") {
+  GIVEN("a view on data without the trait") {
+    const trait::TraitsDataPtr traitsData = trait::TraitsData::make();
+    const TestTraitView view{traitsData};
+
+    THEN("the trait is not imbued and properties are missing") {
+      CHECK_FALSE(view.isImbued());
+      CHECK_FALSE(view.get<TestTrait::kLocation>());
+      CHECK(view.getView<TestTrait::kLocation>() == nullptr);
+      Str location;
+      CHECK(view.get<TestTrait::kLocation>(&location) == TraitPropertyStatus::kMissing);
+    }
+
+    WHEN("the view is imbued") {
+      view.imbue();
+
+      THEN("the data has the trait, using its string ID") {
+        CHECK(view.isImbued());
+        CHECK(traitsData->hasTrait("openassetio.test.TraitView"));
+      }
+    }
+
+    WHEN("properties are set through the view") {
+      view.set<TestTrait::kLocation>("/a/b");
+      view.set<TestTrait::kFrame>(3);
+
+      THEN("they are retrievable through the view and by string") {
+        CHECK(view.isImbued());
+        CHECK(view.get<TestTrait::kLocation>() == Str{"/a/b"});
+        CHECK(*view.getView<TestTrait::kLocation>() == "/a/b");
+        Int frame = 0;
+        CHECK(view.get<TestTrait::kFrame>(&frame) == TraitPropertyStatus::kFound);
+        CHECK(frame == 3);
+
+        trait::property::Value value;
+        CHECK(traitsData->getTraitProperty(&value, "openassetio.test.TraitView", "location"));
+        CHECK(value == trait::property::Value{Str{"/a/b"}});
+      }
+    }
+
+    WHEN("a property is set by string with a value of the wrong type") {
+      traitsData->setTraitProperty("openassetio.test.TraitView", "frame", Str{"three"});
+
+      THEN("the view reports it as invalid") {
+        Int frame = 0;
+        CHECK(view.get<TestTrait::kFrame>(&frame) == TraitPropertyStatus::kInvalidValue);
+        CHECK(frame == 0);
+        CHECK_FALSE(view.get<TestTrait::kFrame>());
+        CHECK(view.getView<TestTrait::kFrame>() == nullptr);
+      }
+    }
+  }
+}
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/TraitsDataOverlay.hpp>
+#include <openassetio/trait/property.hpp>
+
+namespace {
+namespace trait = openassetio::trait;
+using openassetio::Int;
+using openassetio::Str;
+using trait::TraitsData;
+using trait::TraitsDataOverlay;
+using trait::TraitsDataPtr;
+using trait::property::KeyValues;
+using trait::property::Value;
+}  // namespace
+
+SCENARIO("Reading through a TraitsDataOverlay") {
+  GIVEN("an overlay of studio, shot and task layers") {
+    const TraitsDataPtr studio = TraitsData::make({"overlayStudio"});
+    studio->setTraitProperty("overlayShared", "a", Str{"studio"});
+    studio->setTraitProperty("overlayShared", "b", Str{"studio"});
+    studio->setTraitProperty("overlayShared", "c", Str{"studio"});
+    const TraitsDataPtr shot = TraitsData::make();
+    shot->setTraitProperty("overlayShared", "b", Str{"shot"});
+    shot->setTraitProperty("overlayShared", "c", Str{"shot"});
+    const TraitsDataPtr task = TraitsData::make({"overlayTask"});
+    task->setTraitProperty("overlayShared", "c", Str{"task"});
+
+    const TraitsDataOverlay overlay{{studio, shot, task}};
+
+    THEN("the overlay has the union of traits") {
+      CHECK(overlay.hasTrait("overlayStudio"));
+      CHECK(overlay.hasTrait("overlayTask"));
+      CHECK(overlay.hasTrait("overlayShared"));
+      CHECK(!overlay.hasTrait("overlayMissing"));
+      CHECK(overlay.traitSet() ==
+            trait::TraitSet{"overlayStudio", "overlayTask", "overlayShared"});
+    }
+
+    THEN("properties are read from the highest layer that sets them") {
+      CHECK(*overlay.getTraitPropertyView("overlayShared", "a") == Value{Str{"studio"}});
+      CHECK(*overlay.getTraitPropertyView("overlayShared", "b") == Value{Str{"shot"}});
+      CHECK(*overlay.getTraitPropertyView("overlayShared", "c") == Value{Str{"task"}});
+      CHECK(overlay.getTraitPropertyView("overlayShared", "overlayMissing") == nullptr);
+
+      Value value;
+      CHECK(overlay.getTraitProperty(&value, "overlayShared", "b"));
+      CHECK(value == Value{Str{"shot"}});
+    }
+
+    THEN("values are not copied") {
+      CHECK(overlay.getTraitPropertyView("overlayShared", "c") ==
+            task->getTraitPropertyView("overlayShared", "c"));
+    }
+
+    THEN("each trait is visited once") {
+      trait::TraitSet visited;
+      overlay.forEachTrait(
+          [&visited](const trait::TraitId& traitId) { CHECK(visited.insert(traitId).second); });
+      CHECK(visited == overlay.traitSet());
+    }
+
+    THEN("each property is visited once, with its effective value") {
+      KeyValues visited;
+      overlay.forEachProperty("overlayShared", [&visited](const auto& key, const Value& value) {
+        visited.emplace_back(key, value);
+      });
+      std::sort(visited.begin(), visited.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+      CHECK(visited ==
+            KeyValues{{"a", Str{"studio"}}, {"b", Str{"shot"}}, {"c", Str{"task"}}});
+    }
+
+    THEN("the flattened overlay equals the layers merged in order") {
+      const TraitsDataPtr merged = TraitsData::make(studio);
+      merged->merge(*shot);
+      merged->merge(*task);
+      CHECK(*overlay.flatten() == *merged);
+    }
+
+    WHEN("a layer is subsequently modified") {
+      shot->setTraitProperty("overlayShared", "a", Int{1});
+
+      THEN("the modification is visible through the overlay") {
+        CHECK(*overlay.getTraitPropertyView("overlayShared", "a") == Value{Int{1}});
+      }
+    }
+  }
+
+  GIVEN("an overlay with no layers") {
+    TraitsDataOverlay overlay;
+
+    THEN("it has no traits") {
+      CHECK(overlay.traitSet().empty());
+      CHECK(overlay.flatten()->traitSet().empty());
+    }
+
+    WHEN("a layer is added") {
+      const TraitsDataPtr layer = TraitsData::make({"overlayAdded"});
+      overlay.addLayer(layer);
+
+      THEN("the overlay has its traits") {
+        CHECK(overlay.layers().size() == 1);
+        CHECK(overlay.hasTrait("overlayAdded"));
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsDataOverlay layers must not be null") {
+  CHECK_THROWS_AS(TraitsDataOverlay({TraitsData::make(), nullptr}),
+                  openassetio::errors::InputValidationException);
+
+  TraitsDataOverlay overlay;
+  CHECK_THROWS_AS(overlay.addLayer(nullptr), openassetio::errors::InputValidationException);
+}
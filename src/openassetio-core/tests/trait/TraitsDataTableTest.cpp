@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/TraitsDataTable.hpp>
+
+namespace {
+namespace trait = openassetio::trait;
+using openassetio::Bool;
+using openassetio::Float;
+using openassetio::Int;
+using openassetio::Str;
+using trait::TraitsDataTable;
+}  // namespace
+
+SCENARIO("TraitsDataTable columns") {
+  GIVEN("a table with rows and a column per property type") {
+    TraitsDataTable table{{"a", "b"}};
+    table.reset(3);
+    const std::size_t boolColumn = table.addColumn<Bool>("a", "flag");
+    const std::size_t intColumn = table.addColumn<Int>("a", "count");
+    const std::size_t floatColumn = table.addColumn<Float>("b", "ratio");
+    const std::size_t strColumn = table.addColumn<Str>("b", "name");
+
+    THEN("columns can be found by trait and property") {
+      CHECK(table.columnCount() == 4);
+      CHECK(table.findColumn("a", "count") == intColumn);
+      CHECK_FALSE(table.findColumn("b", "count"));
+      CHECK(table.columnTraitId(floatColumn) == "b");
+      CHECK(table.columnPropertyKey(floatColumn) == "ratio");
+    }
+
+    THEN("all values are initially invalid") {
+      for (std::size_t row = 0; row < table.rowCount(); ++row) {
+        CHECK_FALSE(table.isValid(row, intColumn));
+      }
+    }
+
+    WHEN("values are set") {
+      table.setValue(0, boolColumn, true);
+      table.setValue(2, boolColumn, false);
+      table.setValue(1, intColumn, Int{7});
+      table.setValue(2, floatColumn, Float{0.5});
+      table.setValue(0, strColumn, Str{"x"});
+
+      THEN("each column holds contiguous values and a validity bitmap") {
+        CHECK(table.values<Bool>(boolColumn) == std::vector<std::uint8_t>{1, 0, 0});
+        CHECK(table.values<Int>(intColumn) == std::vector<Int>{0, 7, 0});
+        CHECK(table.values<Float>(floatColumn)[2] == Float{0.5});
+        CHECK(table.values<Str>(strColumn)[0] == "x");
+        CHECK(table.validity(boolColumn) == std::vector<std::uint64_t>{0b101});
+        CHECK(table.isValid(1, intColumn));
+        CHECK_FALSE(table.isValid(0, intColumn));
+      }
+
+      THEN("each row can be viewed as a TraitsData") {
+        const trait::TraitsDataPtr row = table.row(0);
+        CHECK(row->traitSet() == trait::TraitSet{"a", "b"});
+        CHECK(row->traitPropertyKeys("a") == trait::property::KeySet{"flag"});
+        trait::property::Value value;
+        CHECK(row->getTraitProperty(&value, "a", "flag"));
+        CHECK(value == trait::property::Value{true});
+        CHECK(row->getTraitProperty(&value, "b", "name"));
+        CHECK(value == trait::property::Value{Str{"x"}});
+      }
+
+      THEN("each row has only the traits of its own values") {
+        CHECK(table.hasTrait(1, "a"));
+        CHECK_FALSE(table.hasTrait(1, "b"));
+        CHECK(table.row(1)->traitSet() == trait::TraitSet{"a"});
+        CHECK(table.traitSet() == trait::TraitSet{"a", "b"});
+      }
+
+      AND_WHEN("the table is reset") {
+        table.reset(2);
+
+        THEN("the columns are retained, without values") {
+          CHECK(table.rowCount() == 2);
+          CHECK(table.columnCount() == 4);
+          CHECK_FALSE(table.isValid(0, boolColumn));
+          CHECK_FALSE(table.hasTrait(0, "a"));
+          CHECK(table.values<Int>(intColumn).size() == 2);
+        }
+      }
+    }
+
+    THEN("mismatched types are rejected") {
+      CHECK_FALSE(table.setValue(0, intColumn, Float{1.0}));
+      CHECK_FALSE(table.isValid(0, intColumn));
+      CHECK_FALSE(table.hasTrait(0, "a"));
+      CHECK_THROWS_AS(table.values<Float>(intColumn),
+                      openassetio::errors::InputValidationException);
+      CHECK_THROWS_AS(table.addColumn<Str>("a", "count"),
+                      openassetio::errors::InputValidationException);
+      CHECK(table.addColumn<Int>("a", "count") == intColumn);
+    }
+  }
+}
+
+SCENARIO("TraitsDataTable rows") {
+  GIVEN("an empty table and a TraitsData") {
+    TraitsDataTable table;
+    table.reset(2);
+    const trait::TraitsDataPtr data = trait::TraitsData::make({"a", "empty"});
+    data->setTraitProperty("a", "count", Int{3});
+    data->setTraitProperty("a", "name", Str{"n"});
+
+    WHEN("the TraitsData is set as a row") {
+      table.setRow(1, *data);
+
+      THEN("columns are added and the row round-trips") {
+        CHECK(table.traitSet() == trait::TraitSet{"a", "empty"});
+        CHECK(table.columnCount() == 2);
+        CHECK(*table.row(1) == *data);
+        CHECK(table.hasTrait(1, "empty"));
+      }
+
+      THEN("other rows have no traits") {
+        CHECK(*table.row(0) == *trait::TraitsData::make());
+      }
+
+      AND_WHEN("a row with fewer properties replaces it") {
+        table.setRow(1, *trait::TraitsData::make({"a"}));
+
+        THEN("the previous values and traits are invalidated") {
+          CHECK(*table.row(1) == *trait::TraitsData::make({"a"}));
+        }
+      }
+
+      AND_WHEN("a row with a property of a different type replaces it") {
+        const trait::TraitsDataPtr mismatched = trait::TraitsData::make({"b"});
+        mismatched->setTraitProperty("a", "count", Str{"three"});
+        const bool isSet = table.setRow(1, *mismatched);
+
+        THEN("the row is rejected and left empty") {
+          CHECK_FALSE(isSet);
+          CHECK(*table.row(1) == *trait::TraitsData::make());
+        }
+      }
+    }
+
+    WHEN("rows are copied from another table") {
+      TraitsDataTable other;
+      other.reset(1);
+      other.setRow(0, *data);
+      const std::vector<std::size_t> mismatchedRows = table.setRows(1, other);
+
+      THEN("they are placed at the given offset") {
+        CHECK(mismatchedRows.empty());
+        CHECK(*table.row(1) == *data);
+        CHECK(*table.row(0) == *trait::TraitsData::make());
+      }
+
+      THEN("rows that don't fit are rejected") {
+        CHECK_THROWS_AS(table.setRows(2, other), openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("rows are copied from a table whose column has a different type") {
+      table.setRow(0, *data);
+      TraitsDataTable other;
+      other.reset(2);
+      const trait::TraitsDataPtr mismatched = trait::TraitsData::make({"b"});
+      mismatched->setTraitProperty("a", "count", Str{"three"});
+      other.setRow(0, *mismatched);
+      other.setRow(1, *trait::TraitsData::make({"b"}));
+      const std::vector<std::size_t> mismatchedRows = table.setRows(0, other);
+
+      THEN("rows holding a value of that column are reported and left empty") {
+        CHECK(mismatchedRows == std::vector<std::size_t>{0});
+        CHECK(*table.row(0) == *trait::TraitsData::make());
+        CHECK(*table.row(1) == *trait::TraitsData::make({"b"}));
+        CHECK(table.values<Int>(*table.findColumn("a", "count")).size() == 2);
+      }
+    }
+  }
+}
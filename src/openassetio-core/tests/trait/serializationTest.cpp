@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/serialization.hpp>
+
+namespace trait = openassetio::trait;
+namespace serialization = openassetio::trait::serialization;
+using openassetio::errors::InputValidationException;
+
+namespace {
+trait::TraitsDataPtr makePopulatedTraitsData() {
+  trait::TraitsDataPtr traitsData = trait::TraitsData::make({"emptyTrait"});
+  traitsData->setTraitProperty("aTrait", "aBool", true);
+  traitsData->setTraitProperty("aTrait", "anInt", openassetio::Int{-123});
+  traitsData->setTraitProperty("aTrait", "aFloat", 1.5);
+  traitsData->setTraitProperty("anotherTrait", "aStr", openassetio::Str{"some ✨ string"});
+  return traitsData;
+}
+}  // namespace
+
+SCENARIO("Round-tripping TraitsData through the binary format") {
+  GIVEN("a populated TraitsData") {
+    const trait::TraitsDataPtr traitsData = makePopulatedTraitsData();
+
+    WHEN("it is serialised") {
+      const serialization::Bytes bytes = serialization::serialize(*traitsData);
+
+      THEN("buffer starts with the versioned header") {
+        REQUIRE(bytes.size() > 8);
+        CHECK(std::string_view{reinterpret_cast<const char*>(bytes.data()), 4} == "OATD");
+        CHECK(bytes[4] == std::byte{serialization::kFormatVersion});
+        CHECK(bytes[5] == std::byte{0});
+      }
+
+      AND_WHEN("it is deserialised") {
+        const trait::TraitsDataPtr result = serialization::deserialize(bytes.data(), bytes.size());
+
+        THEN("result is equal to the original") { CHECK(*result == *traitsData); }
+      }
+
+      AND_WHEN("it is viewed") {
+        const serialization::TraitsDataView view{bytes.data(), bytes.size()};
+
+        THEN("traits and properties can be queried without deserialising") {
+          CHECK(view.traitCount() == 3);
+          CHECK(view.hasTrait("emptyTrait"));
+          CHECK_FALSE(view.hasTrait("missingTrait"));
+
+          trait::property::Value value;
+          CHECK(view.getTraitProperty(&value, "anotherTrait", "aStr"));
+          CHECK(value == trait::property::Value{openassetio::Str{"some ✨ string"}});
+          CHECK(view.getTraitProperty(&value, "aTrait", "anInt"));
+          CHECK(value == trait::property::Value{openassetio::Int{-123}});
+          CHECK_FALSE(view.getTraitProperty(&value, "aTrait", "missing"));
+        }
+
+        THEN("view can be converted to an equal TraitsData") {
+          CHECK(*view.toTraitsData() == *traitsData);
+        }
+      }
+    }
+  }
+
+  GIVEN("an empty TraitsData") {
+    const trait::TraitsDataPtr traitsData = trait::TraitsData::make();
+
+    THEN("it round-trips") {
+      const serialization::Bytes bytes = serialization::serialize(*traitsData);
+      CHECK(*serialization::deserialize(bytes.data(), bytes.size()) == *traitsData);
+    }
+  }
+}
+
+SCENARIO("Round-tripping a list of TraitsData through the binary format") {
+  GIVEN("a list of TraitsData") {
+    const trait::TraitsDatas traitsDatas{makePopulatedTraitsData(), trait::TraitsData::make(),
+                                         trait::TraitsData::make({"a"})};
+
+    WHEN("the list is serialised and then deserialised") {
+      const serialization::Bytes bytes = serialization::serialize(traitsDatas);
+      const trait::TraitsDatas result = serialization::deserializeMany(bytes.data(), bytes.size());
+
+      THEN("each element is equal to the original") {
+        REQUIRE(result.size() == traitsDatas.size());
+        for (std::size_t idx = 0; idx < result.size(); ++idx) {
+          CHECK(*result[idx] == *traitsDatas[idx]);
+        }
+      }
+    }
+
+    WHEN("the serialised list is viewed") {
+      const serialization::Bytes bytes = serialization::serialize(traitsDatas);
+      const serialization::TraitsDatasView view{bytes.data(), bytes.size()};
+
+      THEN("records can be accessed individually") {
+        REQUIRE(view.size() == 3);
+        CHECK(view.at(2).hasTrait("a"));
+        CHECK(view.at(1).traitCount() == 0);
+        CHECK_THROWS_AS(view.at(3), InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a list containing a null TraitsData") {
+    const trait::TraitsDatas traitsDatas{trait::TraitsData::make(), nullptr};
+
+    THEN("serialisation fails") {
+      CHECK_THROWS_AS(serialization::serialize(traitsDatas), InputValidationException);
+    }
+  }
+}
+
+SCENARIO("Rejecting malformed buffers") {
+  const serialization::Bytes bytes = serialization::serialize(*makePopulatedTraitsData());
+
+  GIVEN("a truncated buffer") {
+    THEN("deserialisation fails") {
+      for (std::size_t size = 0; size < bytes.size(); ++size) {
+        CHECK_THROWS_AS(serialization::deserialize(bytes.data(), size), InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a buffer with trailing bytes") {
+    serialization::Bytes extended = bytes;
+    extended.push_back(std::byte{0});
+
+    THEN("deserialisation fails") {
+      CHECK_THROWS_AS(serialization::deserialize(extended.data(), extended.size()),
+                      InputValidationException);
+    }
+  }
+
+  GIVEN("a buffer with an unsupported version") {
+    serialization::Bytes future = bytes;
+    future[4] = std::byte{serialization::kFormatVersion + 1};
+
+    THEN("deserialisation fails") {
+      CHECK_THROWS_WITH(serialization::deserialize(future.data(), future.size()),
+                        "Unsupported serialised TraitsData format version 2");
+    }
+  }
+
+  GIVEN("a single TraitsData buffer") {
+    THEN("it cannot be read as a list") {
+      CHECK_THROWS_AS(serialization::deserializeMany(bytes.data(), bytes.size()),
+                      InputValidationException);
+    }
+  }
+}
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of a C++ host calling a trivial manager implemented in
+ * Python, versus the same manager implemented in C++, such that the
+ * difference is the cost of crossing the Python/C++ boundary.
+ *
+ * Each benchmark is run over a range of batch sizes. The time for a
+ * batch of one gives the per-call overhead, and the items-per-second
+ * rate of large batches gives the per-element overhead.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+
+#include <benchmark/benchmark.h>
+#include <pybind11/embed.h>
+
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/python/converter.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+
+#include <NullManagerInterface.hpp>
+
+#include "counters.hpp"
+
+namespace {
+namespace py = pybind11;
+using openassetio::access::PolicyAccess;
+using openassetio::access::ResolveAccess;
+using openassetio::benchmarks::makeEntityReferences;
+using openassetio::benchmarks::makeManager;
+using openassetio::benchmarks::NullManagerInterface;
+using openassetio::errors::BatchElementError;
+using openassetio::managerApi::ManagerInterface;
+using openassetio::managerApi::ManagerInterfacePtr;
+using openassetio::trait::TraitSet;
+using openassetio::trait::TraitSets;
+using openassetio::trait::TraitsDataPtr;
+
+const TraitSet kTraitSet{"openassetio-mediacreation:content.LocatableContent"};
+
+/// Implementation of the null manager to benchmark.
+enum class Impl {
+  /// C++ implementation.
+  kCpp,
+  /// Python implementation, calling callbacks per element.
+  kPython,
+  /// Python implementation, returning batch results in bulk.
+  kPythonBulk
+};
+
+ManagerInterfacePtr makeManagerInterface(const Impl impl) {
+  if (impl == Impl::kCpp) {
+    return std::make_shared<NullManagerInterface>();
+  }
+  const py::gil_scoped_acquire gil{};
+  const py::object pyClass = py::module_::import("nullManagerInterface").attr("NullManagerInterface");
+  const py::object pyManagerInterface = pyClass(impl == Impl::kPythonBulk);
+  return openassetio::python::converter::castFromPyObject<ManagerInterface>(
+      pyManagerInterface.ptr());
+}
+
+/**
+ * Snapshot of the counters, from which the per-call and per-element
+ * deltas are reported as benchmark counters.
+ */
+class CounterSnapshot {
+ public:
+  CounterSnapshot()
+      : gil_{openassetio::benchmarks::gilAcquisitionCount()},
+        cppAllocations_{openassetio::benchmarks::cppAllocationCount()},
+        pyAllocations_{openassetio::benchmarks::pyAllocationCount()} {}
+
+  /// Report counts since this snapshot was taken.
+  void report(benchmark::State& state, const std::size_t batchSize) const {
+    const CounterSnapshot now;
+    const auto numCalls = static_cast<double>(state.iterations());
+    const double numElements = numCalls * static_cast<double>(batchSize);
+
+    if (gil_ && now.gil_) {
+      state.counters["gil/call"] = static_cast<double>(*now.gil_ - *gil_) / numCalls;
+    }
+    state.counters["cppAllocs/elem"] =
+        static_cast<double>(now.cppAllocations_ - cppAllocations_) / numElements;
+    state.counters["pyAllocs/elem"] =
+        static_cast<double>(now.pyAllocations_ - pyAllocations_) / numElements;
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(batchSize));
+  }
+
+ private:
+  std::optional<std::uint64_t> gil_;
+  std::uint64_t cppAllocations_;
+  std::uint64_t pyAllocations_;
+};
+
+void BM_resolve(benchmark::State& state, const Impl impl) {
+  const auto manager = makeManager(makeManagerInterface(impl));
+  const auto context = manager->createContext();
+  const auto batchSize = static_cast<std::size_t>(state.range(0));
+  const auto refs = makeEntityReferences(batchSize);
+
+  const CounterSnapshot counters;
+  for ([[maybe_unused]] auto _ : state) {
+    manager->resolve(
+        refs, kTraitSet, ResolveAccess::kRead, context,
+        [](std::size_t, TraitsDataPtr traitsData) { benchmark::DoNotOptimize(traitsData); },
+        [](std::size_t, const BatchElementError&) { std::abort(); });
+  }
+  counters.report(state, batchSize);
+}
+
+void BM_entityExists(benchmark::State& state, const Impl impl) {
+  const auto manager = makeManager(makeManagerInterface(impl));
+  const auto context = manager->createContext();
+  const auto batchSize = static_cast<std::size_t>(state.range(0));
+  const auto refs = makeEntityReferences(batchSize);
+
+  const CounterSnapshot counters;
+  for ([[maybe_unused]] auto _ : state) {
+    manager->entityExists(
+        refs, context, [](std::size_t, bool exists) { benchmark::DoNotOptimize(exists); },
+        [](std::size_t, const BatchElementError&) { std::abort(); });
+  }
+  counters.report(state, batchSize);
+}
+
+void BM_managementPolicy(benchmark::State& state, const Impl impl) {
+  const auto manager = makeManager(makeManagerInterface(impl));
+  const auto context = manager->createContext();
+  const auto batchSize = static_cast<std::size_t>(state.range(0));
+  const TraitSets traitSets(batchSize, kTraitSet);
+
+  const CounterSnapshot counters;
+  for ([[maybe_unused]] auto _ : state) {
+    auto policies = manager->managementPolicy(traitSets, PolicyAccess::kRead, context);
+    benchmark::DoNotOptimize(policies);
+  }
+  counters.report(state, batchSize);
+}
+
+/// Batch sizes from 1 to 100k, in powers of ten.
+void batchSizes(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("batch")->RangeMultiplier(10)->Range(1, 100'000)->UseRealTime();
+}
+
+BENCHMARK_CAPTURE(BM_resolve, cpp, Impl::kCpp)->Apply(batchSizes);
+BENCHMARK_CAPTURE(BM_resolve, python, Impl::kPython)->Apply(batchSizes);
+BENCHMARK_CAPTURE(BM_resolve, pythonBulk, Impl::kPythonBulk)->Apply(batchSizes);
+BENCHMARK_CAPTURE(BM_entityExists, cpp, Impl::kCpp)->Apply(batchSizes);
+BENCHMARK_CAPTURE(BM_entityExists, python, Impl::kPython)->Apply(batchSizes);
+BENCHMARK_CAPTURE(BM_entityExists, pythonBulk, Impl::kPythonBulk)->Apply(batchSizes);
+BENCHMARK_CAPTURE(BM_managementPolicy, cpp, Impl::kCpp)->Apply(batchSizes);
+BENCHMARK_CAPTURE(BM_managementPolicy, python, Impl::kPython)->Apply(batchSizes);
+}  // namespace
@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of the critical path of every tool launch: creating and
+ * initializing the default manager, via the Python plugin system.
+ *
+ * The path is broken down into its phases, each benchmarked
+ * separately, along with the end-to-end total:
+ *
+ * - `configLoad`: parsing the default manager TOML config.
+ * - `pluginScan`: discovering all plugins on the search path.
+ * - `instantiate`: instantiating the manager plugin by identifier.
+ * - `initialize`: initializing the instantiated manager.
+ * - `total`: `ManagerFactory::defaultManagerForInterface`.
+ *
+ * Phases that depend on the plugin system are run with a range of
+ * additional (dummy) plugins on the search path, ahead of the target
+ * manager plugin, which wraps the Python null manager.
+ *
+ * "Cold" runs use a new plugin system each iteration, and so must
+ * search for and import plugin modules. "Warm" runs reuse a single
+ * plugin system, which caches the plugins it has found. Note that
+ * the interpreter itself is warm in both cases, i.e. modules imported
+ * by plugins (such as `openassetio`) remain imported.
+ */
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <benchmark/benchmark.h>
+#include <pybind11/embed.h>
+
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerFactory.hpp>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/python/hostApi.hpp>
+
+#include <NullManagerInterface.hpp>
+
+namespace {
+namespace py = pybind11;
+namespace fs = std::filesystem;
+using openassetio::Str;
+using openassetio::benchmarks::NullHostInterface;
+using openassetio::benchmarks::NullLogger;
+using openassetio::hostApi::Manager;
+using openassetio::hostApi::ManagerFactory;
+using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
+using openassetio::managerApi::Host;
+using openassetio::managerApi::HostSession;
+
+/// Identifier of the Python null manager, see nullManagerInterface.py.
+constexpr std::string_view kManagerIdentifier = "org.openassetio.benchmark.null.python";
+
+/// Source of the target manager plugin.
+constexpr std::string_view kManagerPluginSource = R"(
+from openassetio.pluginSystem import PythonPluginSystemManagerPlugin
+
+import nullManagerInterface
+
+
+class NullManagerPlugin(PythonPluginSystemManagerPlugin):
+    @classmethod
+    def identifier(cls):
+        return "org.openassetio.benchmark.null.python"
+
+    @classmethod
+    def interface(cls):
+        return nullManagerInterface.NullManagerInterface()
+
+
+plugin = NullManagerPlugin
+)";
+
+/// Source of a dummy plugin, with a placeholder for its index.
+constexpr std::string_view kDummyPluginSource = R"(
+from openassetio.pluginSystem import PythonPluginSystemManagerPlugin
+
+
+class DummyPlugin(PythonPluginSystemManagerPlugin):
+    @classmethod
+    def identifier(cls):
+        return "org.openassetio.benchmark.startup.dummy{}"
+
+    @classmethod
+    def interface(cls):
+        raise NotImplementedError
+
+
+plugin = DummyPlugin
+)";
+
+/// Separator of paths in a search path, i.e. Python's `os.pathsep`.
+#ifdef _WIN32
+constexpr char kPathListSeparator = ';';
+#else
+constexpr char kPathListSeparator = ':';
+#endif
+
+void writeFile(const fs::path& path, const std::string_view contents) {
+  std::ofstream{path} << contents;
+}
+
+/**
+ * Temporary plugin search path and default manager config, holding the
+ * target manager plugin and a number of dummy plugins.
+ */
+class StartupEnvironment {
+ public:
+  explicit StartupEnvironment(const std::size_t dummyPluginCount)
+      : root_{fs::temp_directory_path() /
+              ("openassetio-StartupBenchmark-" + std::to_string(dummyPluginCount))} {
+    fs::remove_all(root_);
+    const fs::path dummyDir = root_ / "dummies";
+    const fs::path managerDir = root_ / "manager";
+    fs::create_directories(dummyDir);
+    fs::create_directories(managerDir);
+
+    Str dummyPlaceholder{kDummyPluginSource};
+    const std::size_t placeholderPos = dummyPlaceholder.find("{}");
+    for (std::size_t idx = 0; idx < dummyPluginCount; ++idx) {
+      Str source = dummyPlaceholder;
+      source.replace(placeholderPos, 2, std::to_string(idx));
+      writeFile(dummyDir / ("dummyPlugin" + std::to_string(idx) + ".py"), source);
+    }
+    writeFile(managerDir / "nullManagerPlugin.py", kManagerPluginSource);
+
+    Str config = "[manager]\nidentifier = \"";
+    config += kManagerIdentifier;
+    config += "\"\n";
+    configPath_ = (root_ / "openassetio_config.toml").string();
+    writeFile(configPath_, config);
+
+    // Dummy plugins take precedence, so must be imported before the
+    // target is found.
+    searchPath_ = dummyDir.string();
+    searchPath_ += kPathListSeparator;
+    searchPath_ += managerDir.string();
+  }
+
+  ~StartupEnvironment() {
+    std::error_code error;
+    fs::remove_all(root_, error);
+  }
+
+  StartupEnvironment(const StartupEnvironment&) = delete;
+  StartupEnvironment(StartupEnvironment&&) noexcept = delete;
+  StartupEnvironment& operator=(const StartupEnvironment&) = delete;
+  StartupEnvironment& operator=(StartupEnvironment&&) noexcept = delete;
+
+  /// Get the environment for a number of dummy plugins, created once.
+  static const StartupEnvironment& forDummyPluginCount(const std::size_t dummyPluginCount) {
+    static std::map<std::size_t, std::unique_ptr<StartupEnvironment>> environments;
+    auto& environment = environments[dummyPluginCount];
+    if (!environment) {
+      environment = std::make_unique<StartupEnvironment>(dummyPluginCount);
+    }
+    return *environment;
+  }
+
+  /**
+   * Create a new Python plugin system that searches only this
+   * environment's plugin search path.
+   */
+  [[nodiscard]] ManagerImplementationFactoryInterfacePtr createPluginSystem() const {
+    {
+      // The plugin system reads its configuration from the environment
+      // on construction.
+      const py::gil_scoped_acquire gil{};
+      const py::object pyEnviron = py::module_::import("os").attr("environ");
+      pyEnviron["OPENASSETIO_PLUGIN_PATH"] = searchPath_;
+      pyEnviron["OPENASSETIO_DISABLE_ENTRYPOINTS_PLUGINS"] = "1";
+      pyEnviron.attr("pop")("OPENASSETIO_PLUGIN_DISCOVERY_CACHE", py::none());
+      pyEnviron.attr("pop")("OPENASSETIO_PLUGIN_INDEX", py::none());
+    }
+    return openassetio::python::hostApi::createPythonPluginSystemManagerImplementationFactory(
+        std::make_shared<NullLogger>());
+  }
+
+  [[nodiscard]] const Str& configPath() const { return configPath_; }
+
+ private:
+  fs::path root_;
+  Str configPath_;
+  Str searchPath_;
+};
+
+std::size_t dummyPluginCount(const benchmark::State& state) {
+  return static_cast<std::size_t>(state.range(0));
+}
+
+openassetio::managerApi::HostSessionPtr makeHostSession() {
+  return HostSession::make(Host::make(std::make_shared<NullHostInterface>()),
+                           std::make_shared<NullLogger>());
+}
+
+void BM_startup_configLoad(benchmark::State& state) {
+  const StartupEnvironment& environment = StartupEnvironment::forDummyPluginCount(0);
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto config = ManagerFactory::loadDefaultManagerConfig(environment.configPath());
+    benchmark::DoNotOptimize(config);
+  }
+}
+
+void BM_startup_pluginScan_cold(benchmark::State& state) {
+  const StartupEnvironment& environment =
+      StartupEnvironment::forDummyPluginCount(dummyPluginCount(state));
+
+  ManagerImplementationFactoryInterfacePtr pluginSystem;
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    pluginSystem = environment.createPluginSystem();
+    state.ResumeTiming();
+
+    auto identifiers = pluginSystem->identifiers();
+    benchmark::DoNotOptimize(identifiers);
+  }
+}
+
+void BM_startup_pluginScan_warm(benchmark::State& state) {
+  const StartupEnvironment& environment =
+      StartupEnvironment::forDummyPluginCount(dummyPluginCount(state));
+  const ManagerImplementationFactoryInterfacePtr pluginSystem = environment.createPluginSystem();
+  [[maybe_unused]] const auto identifiers = pluginSystem->identifiers();
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto warmIdentifiers = pluginSystem->identifiers();
+    benchmark::DoNotOptimize(warmIdentifiers);
+  }
+}
+
+/// Instantiation from an unscanned plugin system, so includes the
+/// search for, and import of, plugins up to and including the target.
+void BM_startup_instantiate_cold(benchmark::State& state) {
+  const StartupEnvironment& environment =
+      StartupEnvironment::forDummyPluginCount(dummyPluginCount(state));
+  const Str identifier{kManagerIdentifier};
+
+  ManagerImplementationFactoryInterfacePtr pluginSystem;
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    pluginSystem = environment.createPluginSystem();
+    state.ResumeTiming();
+
+    auto managerInterface = pluginSystem->instantiate(identifier);
+    benchmark::DoNotOptimize(managerInterface);
+  }
+}
+
+void BM_startup_instantiate_warm(benchmark::State& state) {
+  const StartupEnvironment& environment =
+      StartupEnvironment::forDummyPluginCount(dummyPluginCount(state));
+  const Str identifier{kManagerIdentifier};
+  const ManagerImplementationFactoryInterfacePtr pluginSystem = environment.createPluginSystem();
+  [[maybe_unused]] const auto identifiers = pluginSystem->identifiers();
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto managerInterface = pluginSystem->instantiate(identifier);
+    benchmark::DoNotOptimize(managerInterface);
+  }
+}
+
+void BM_startup_initialize(benchmark::State& state) {
+  const StartupEnvironment& environment = StartupEnvironment::forDummyPluginCount(0);
+  const Str identifier{kManagerIdentifier};
+  const ManagerImplementationFactoryInterfacePtr pluginSystem = environment.createPluginSystem();
+  const auto hostSession = makeHostSession();
+
+  openassetio::hostApi::ManagerPtr manager;
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    manager = Manager::make(pluginSystem->instantiate(identifier), hostSession);
+    state.ResumeTiming();
+
+    manager->initialize({});
+  }
+}
+
+void BM_startup_total_cold(benchmark::State& state) {
+  const StartupEnvironment& environment =
+      StartupEnvironment::forDummyPluginCount(dummyPluginCount(state));
+  const auto hostInterface = std::make_shared<NullHostInterface>();
+  const auto logger = std::make_shared<NullLogger>();
+
+  ManagerImplementationFactoryInterfacePtr pluginSystem;
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    pluginSystem = environment.createPluginSystem();
+    state.ResumeTiming();
+
+    auto manager = ManagerFactory::defaultManagerForInterface(
+        environment.configPath(), hostInterface, pluginSystem, logger);
+    benchmark::DoNotOptimize(manager);
+  }
+}
+
+void BM_startup_total_warm(benchmark::State& state) {
+  const StartupEnvironment& environment =
+      StartupEnvironment::forDummyPluginCount(dummyPluginCount(state));
+  const auto hostInterface = std::make_shared<NullHostInterface>();
+  const auto logger = std::make_shared<NullLogger>();
+  const ManagerImplementationFactoryInterfacePtr pluginSystem = environment.createPluginSystem();
+  [[maybe_unused]] const auto identifiers = pluginSystem->identifiers();
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto manager = ManagerFactory::defaultManagerForInterface(
+        environment.configPath(), hostInterface, pluginSystem, logger);
+    benchmark::DoNotOptimize(manager);
+  }
+}
+
+/// Number of dummy plugins on the search path: none, 10 and 100.
+void dummyPluginCounts(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("plugins")->Arg(0)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(BM_startup_configLoad)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_startup_pluginScan_cold)->Apply(dummyPluginCounts);
+BENCHMARK(BM_startup_pluginScan_warm)->Apply(dummyPluginCounts);
+BENCHMARK(BM_startup_instantiate_cold)->Apply(dummyPluginCounts);
+BENCHMARK(BM_startup_instantiate_warm)->Apply(dummyPluginCounts);
+BENCHMARK(BM_startup_initialize)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_startup_total_cold)->Apply(dummyPluginCounts);
+BENCHMARK(BM_startup_total_warm)->Apply(dummyPluginCounts);
+}  // namespace
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Python module exposing benchmark-only utilities to the pytest-based
+ * benchmarks.
+ */
+#include <memory>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+#include <NullManagerInterface.hpp>
+
+#include "counters.hpp"
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(_openassetio_benchmark, mod) {
+  using openassetio::benchmarks::NullManagerInterface;
+  using openassetio::managerApi::ManagerInterface;
+
+  // Ensure the base class is registered with pybind.
+  py::module_::import("openassetio");
+
+  py::class_<NullManagerInterface, ManagerInterface, std::shared_ptr<NullManagerInterface>>(
+      mod, "NullManagerInterface",
+      "C++ implementation of a ManagerInterface that does as little as possible.")
+      .def(py::init<bool>(), py::arg("advertisePrefix") = false);
+
+  openassetio::benchmarks::installPyAllocationHooks();
+  mod.def("pyAllocationCount", &openassetio::benchmarks::pyAllocationCount,
+          "Number of Python allocations made since this module was imported.");
+}
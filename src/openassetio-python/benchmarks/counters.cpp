@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <Python.h>
+
+#include "counters.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace benchmarks {
+namespace {
+std::atomic<std::uint64_t> gPyAllocations{0};
+
+/// Allocators that were current before the hooks were installed, used
+/// as the `ctx` of the corresponding hook.
+std::array<PyMemAllocatorEx, 2> gWrappedAllocators{};
+
+constexpr std::array<PyMemAllocatorDomain, 2> kHookedDomains{PYMEM_DOMAIN_MEM, PYMEM_DOMAIN_OBJ};
+
+void* countingMalloc(void* ctx, const std::size_t size) {
+  gPyAllocations.fetch_add(1, std::memory_order_relaxed);
+  auto* wrapped = static_cast<PyMemAllocatorEx*>(ctx);
+  return wrapped->malloc(wrapped->ctx, size);
+}
+
+void* countingCalloc(void* ctx, const std::size_t nelem, const std::size_t elsize) {
+  gPyAllocations.fetch_add(1, std::memory_order_relaxed);
+  auto* wrapped = static_cast<PyMemAllocatorEx*>(ctx);
+  return wrapped->calloc(wrapped->ctx, nelem, elsize);
+}
+
+void* countingRealloc(void* ctx, void* ptr, const std::size_t newSize) {
+  gPyAllocations.fetch_add(1, std::memory_order_relaxed);
+  auto* wrapped = static_cast<PyMemAllocatorEx*>(ctx);
+  return wrapped->realloc(wrapped->ctx, ptr, newSize);
+}
+
+void forwardingFree(void* ctx, void* ptr) {
+  auto* wrapped = static_cast<PyMemAllocatorEx*>(ctx);
+  wrapped->free(wrapped->ctx, ptr);
+}
+}  // namespace
+
+void installPyAllocationHooks() {
+  // Only ever called with the GIL held, so no further synchronisation
+  // is required.
+  static bool installed = false;
+  if (installed) {
+    return;
+  }
+  installed = true;
+
+  for (std::size_t idx = 0; idx < kHookedDomains.size(); ++idx) {
+    PyMem_GetAllocator(kHookedDomains[idx], &gWrappedAllocators[idx]);
+    PyMemAllocatorEx hook{&gWrappedAllocators[idx], countingMalloc, countingCalloc,
+                          countingRealloc, forwardingFree};
+    PyMem_SetAllocator(kHookedDomains[idx], &hook);
+  }
+}
+
+std::uint64_t pyAllocationCount() { return gPyAllocations.load(std::memory_order_relaxed); }
+}  // namespace benchmarks
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
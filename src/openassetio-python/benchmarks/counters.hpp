@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Process-wide event counters, used to attribute the cost of crossing
+ * the Python/C++ boundary, in addition to timings.
+ */
+#include <cstdint>
+#include <optional>
+
+#include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace benchmarks {
+/**
+ * Install hooks that count allocations made via Python's memory
+ * allocators, i.e. `PyMem_*` and `PyObject_*` (de)allocators.
+ *
+ * The hooks wrap, rather than replace, the current allocators, so can
+ * be installed after the interpreter is initialized. Subsequent calls
+ * are no-ops.
+ *
+ * The GIL must be held.
+ */
+void installPyAllocationHooks();
+
+/**
+ * Number of Python allocations (including reallocations) made since
+ * @ref installPyAllocationHooks was called.
+ */
+std::uint64_t pyAllocationCount();
+
+/**
+ * Number of calls to the global C++ `operator new`.
+ *
+ * Only available in the benchmark executable, where `operator new` is
+ * replaced.
+ */
+std::uint64_t cppAllocationCount();
+
+/**
+ * Number of times a thread has acquired the GIL, i.e. excluding nested
+ * acquisitions by a thread that already holds it.
+ *
+ * Only available in the benchmark executable, and only on platforms
+ * where the Python C API functions that acquire the GIL can be
+ * interposed (Linux with a shared libpython).
+ *
+ * @return Count, or `std::nullopt` if not supported.
+ */
+std::optional<std::uint64_t> gilAcquisitionCount();
+}  // namespace benchmarks
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
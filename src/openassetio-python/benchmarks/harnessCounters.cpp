@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+/**
+ * Counters that rely on replacing or interposing functions, which is
+ * only effective when linked into the benchmark executable.
+ */
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+
+#include <Python.h>
+
+#ifdef OPENASSETIO_BENCHMARK_COUNT_GIL
+#include <dlfcn.h>
+#endif
+
+#include <testSupport/AllocationCounter.hpp>
+
+#include "counters.hpp"
+
+namespace {
+#ifdef OPENASSETIO_BENCHMARK_COUNT_GIL
+std::atomic<std::uint64_t> gGilAcquisitions{0};
+
+/// Look up the libpython implementation of an interposed function.
+template <class Fn>
+Fn nextSymbol(const char* name) {
+  void* symbol = dlsym(RTLD_NEXT, name);
+  if (symbol == nullptr) {
+    std::abort();
+  }
+  return reinterpret_cast<Fn>(symbol);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+#endif
+}  // namespace
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace benchmarks {
+// Global allocation functions are replaced by the linked test support
+// library. These are process-wide, so also count allocations made by
+// the core library and the Python extension module.
+std::uint64_t cppAllocationCount() { return testSupport::processAllocationCount(); }
+
+std::optional<std::uint64_t> gilAcquisitionCount() {
+#ifdef OPENASSETIO_BENCHMARK_COUNT_GIL
+  return gGilAcquisitions.load(std::memory_order_relaxed);
+#else
+  return std::nullopt;
+#endif
+}
+}  // namespace benchmarks
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+#ifdef OPENASSETIO_BENCHMARK_COUNT_GIL
+/*
+ * Interpose the Python C API functions through which pybind11 (and so
+ * our bindings) acquire the GIL. The executable exports its symbols,
+ * so these definitions take precedence over libpython's for calls from
+ * the extension module. Calls internal to libpython are not affected.
+ */
+
+extern "C" {
+void PyEval_AcquireThread(PyThreadState* tstate) {
+  static const auto next = nextSymbol<void (*)(PyThreadState*)>("PyEval_AcquireThread");
+  gGilAcquisitions.fetch_add(1, std::memory_order_relaxed);
+  next(tstate);
+}
+
+PyGILState_STATE PyGILState_Ensure() {
+  static const auto next = nextSymbol<PyGILState_STATE (*)()>("PyGILState_Ensure");
+  // Nested calls by a thread that already holds the GIL are cheap.
+  if (PyGILState_Check() == 0) {
+    gGilAcquisitions.fetch_add(1, std::memory_order_relaxed);
+  }
+  return next();
+}
+}
+#endif
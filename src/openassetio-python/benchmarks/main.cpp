@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <exception>
+#include <iostream>
+
+#include <benchmark/benchmark.h>
+#include <pybind11/embed.h>
+
+#include "counters.hpp"
+
+namespace py = pybind11;
+
+int main(int argc, char* argv[]) {
+  try {
+    const py::scoped_interpreter guard{};
+    openassetio::benchmarks::installPyAllocationHooks();
+
+    // Cause the openassetio-python lib to be loaded so pybind can cast.
+    py::module_::import("openassetio");
+    // Make the Python null manager importable.
+    py::module_::import("sys").attr("path").attr("insert")(
+        0, OPENASSETIO_PYTHON_BENCHMARK_RESOURCES_DIR);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+      return 1;
+    }
+    {
+      // Call the API as a C++ host would, i.e. without holding the GIL.
+      const py::gil_scoped_release gil{};
+      benchmark::RunSpecifiedBenchmarks();
+    }
+    benchmark::Shutdown();
+    return 0;
+  } catch (const std::exception& exc) {
+    std::cerr << exc.what() << "\n";
+    return 1;
+  }
+}
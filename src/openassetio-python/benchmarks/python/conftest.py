@@ -0,0 +1,80 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Shared fixtures for pytest-benchmark cases.
+"""
+# pylint: disable=missing-function-docstring,redefined-outer-name
+# pylint: disable=invalid-name,missing-class-docstring
+import pytest
+
+from openassetio.hostApi import HostInterface, Manager
+from openassetio.log import LoggerInterface
+from openassetio.managerApi import Host, HostSession
+
+# pylint: disable=no-name-in-module
+from openassetio import _openassetio_benchmark
+
+import nullManagerInterface
+
+
+class NullHostInterface(HostInterface):
+    def identifier(self):
+        return "org.openassetio.benchmark"
+
+    def displayName(self):
+        return "Benchmark Host"
+
+
+class NullLogger(LoggerInterface):
+    def log(self, severity, message):
+        pass
+
+
+def make_manager_interface(impl):
+    """
+    Construct a null manager of the given implementation, one of
+    "cpp", "python" or "pythonBulk".
+    """
+    if impl == "cpp":
+        return _openassetio_benchmark.NullManagerInterface()
+    return nullManagerInterface.NullManagerInterface(bulk=impl == "pythonBulk")
+
+
+@pytest.fixture
+def make_manager():
+    def maker(impl):
+        host_session = HostSession(Host(NullHostInterface()), NullLogger())
+        manager = Manager(make_manager_interface(impl), host_session)
+        manager.initialize({})
+        return manager
+
+    return maker
+
+
+@pytest.fixture
+def count_py_allocations():
+    """
+    Count the Python allocations made by a single call to the given
+    function, which must have been called at least once previously, so
+    that one-time initialisation is excluded.
+    """
+
+    def counter(fn):
+        before = _openassetio_benchmark.pyAllocationCount()
+        fn()
+        return _openassetio_benchmark.pyAllocationCount() - before
+
+    return counter
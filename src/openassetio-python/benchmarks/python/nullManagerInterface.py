@@ -0,0 +1,94 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+A ManagerInterface implementation that does as little as possible, such
+that benchmarks measure the overhead of crossing the Python/C++
+boundary, rather than of the manager itself.
+
+Mirrors the C++ `openassetio::benchmarks::NullManagerInterface`.
+"""
+# pylint: disable=invalid-name,unused-argument
+# pylint: disable=missing-function-docstring
+
+from openassetio.managerApi import ManagerInterface
+from openassetio.trait import TraitsData
+
+
+PREFIX = "null://"
+
+
+class NullManagerInterface(ManagerInterface):
+    """
+    Every entity exists, resolves to an empty TraitsData with the
+    requested traits, and has an empty management policy.
+
+    @param bulk If True, batch methods return their results in bulk as
+    a list of `(index, result)` tuples, rather than calling the success
+    callback per element.
+    """
+
+    __capabilities = (
+        ManagerInterface.Capability.kEntityReferenceIdentification,
+        ManagerInterface.Capability.kManagementPolicyQueries,
+        ManagerInterface.Capability.kEntityTraitIntrospection,
+        ManagerInterface.Capability.kExistenceQueries,
+        ManagerInterface.Capability.kResolution,
+    )
+
+    def __init__(self, bulk=False):
+        super().__init__()
+        self.__bulk = bulk
+
+    def identifier(self):
+        return "org.openassetio.benchmark.null.python"
+
+    def displayName(self):
+        return "Null Manager (Python)"
+
+    def hasCapability(self, capability):
+        return capability in self.__capabilities
+
+    def initialize(self, managerSettings, hostSession):
+        pass
+
+    def managementPolicy(self, traitSets, access, context, hostSession):
+        return [TraitsData() for _ in traitSets]
+
+    def isEntityReferenceString(self, someString, hostSession):
+        return someString.startswith(PREFIX)
+
+    def entityExists(self, entityReferences, context, hostSession, successCallback, errorCallback):
+        if self.__bulk:
+            return [(idx, True) for idx in range(len(entityReferences))]
+        for idx in range(len(entityReferences)):
+            successCallback(idx, True)
+        return None
+
+    def resolve(
+        self,
+        entityReferences,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        if self.__bulk:
+            return [(idx, TraitsData(traitSet)) for idx in range(len(entityReferences))]
+        for idx in range(len(entityReferences)):
+            successCallback(idx, TraitsData(traitSet))
+        return None
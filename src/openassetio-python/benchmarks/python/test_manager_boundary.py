@@ -0,0 +1,96 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Benchmarks of a Python host calling a trivial manager implemented in
+Python, versus the same manager implemented in C++.
+
+Each benchmark is run over a range of batch sizes. The time for a batch
+of one gives the per-call overhead, and the time for large batches, per
+element, gives the per-element overhead. The number of Python
+allocations per element is recorded in the `extra_info` of each result.
+"""
+# pylint: disable=missing-function-docstring,redefined-outer-name
+# pylint: disable=invalid-name
+import pytest
+
+from openassetio import EntityReference
+from openassetio.access import PolicyAccess, ResolveAccess
+
+from nullManagerInterface import PREFIX
+
+
+# Batch sizes to benchmark, from 1 to 100k in powers of ten.
+BATCH_SIZES = [10**exponent for exponent in range(6)]
+
+TRAIT_SET = {"openassetio-mediacreation:content.LocatableContent"}
+
+
+def make_entity_references(batch_size):
+    return [EntityReference(f"{PREFIX}asset{idx}") for idx in range(batch_size)]
+
+
+def fail(idx, error):
+    raise RuntimeError(f"Unexpected error for element {idx}: {error}")
+
+
+def run_benchmark(benchmark, count_py_allocations, fn, batch_size):
+    fn()
+    benchmark.extra_info["pyAllocs/elem"] = count_py_allocations(fn) / batch_size
+    benchmark(fn)
+
+
+@pytest.mark.parametrize("batch_size", BATCH_SIZES)
+@pytest.mark.parametrize("impl", ["cpp", "python", "pythonBulk"])
+def test_resolve(benchmark, make_manager, count_py_allocations, impl, batch_size):
+    benchmark.group = f"resolve/{batch_size}"
+    manager = make_manager(impl)
+    context = manager.createContext()
+    refs = make_entity_references(batch_size)
+
+    def resolve():
+        manager.resolve(
+            refs, TRAIT_SET, ResolveAccess.kRead, context, lambda idx, data: None, fail
+        )
+
+    run_benchmark(benchmark, count_py_allocations, resolve, batch_size)
+
+
+@pytest.mark.parametrize("batch_size", BATCH_SIZES)
+@pytest.mark.parametrize("impl", ["cpp", "python", "pythonBulk"])
+def test_entityExists(benchmark, make_manager, count_py_allocations, impl, batch_size):
+    benchmark.group = f"entityExists/{batch_size}"
+    manager = make_manager(impl)
+    context = manager.createContext()
+    refs = make_entity_references(batch_size)
+
+    def entityExists():
+        manager.entityExists(refs, context, lambda idx, exists: None, fail)
+
+    run_benchmark(benchmark, count_py_allocations, entityExists, batch_size)
+
+
+@pytest.mark.parametrize("batch_size", BATCH_SIZES)
+@pytest.mark.parametrize("impl", ["cpp", "python"])
+def test_managementPolicy(benchmark, make_manager, count_py_allocations, impl, batch_size):
+    benchmark.group = f"managementPolicy/{batch_size}"
+    manager = make_manager(impl)
+    context = manager.createContext()
+    trait_sets = [TRAIT_SET] * batch_size
+
+    def managementPolicy():
+        manager.managementPolicy(trait_sets, PolicyAccess.kRead, context)
+
+    run_benchmark(benchmark, count_py_allocations, managementPolicy, batch_size)
@@ -4,6 +4,9 @@
 
 #include <Python.h>
 
+#include <type_traits>
+#include <vector>
+
 #include <openassetio/export.h>
 #include <openassetio/python/export.h>
 #include <openassetio/typedefs.hpp>
@@ -100,6 +103,102 @@ OPENASSETIO_PYTHON_BRIDGE_EXPORT PyObject* castToPyObject(const T& objectPtr);
 template <typename T>
 OPENASSETIO_PYTHON_BRIDGE_EXPORT typename T::Ptr castFromPyObject(PyObject* pyObject);
 
+/**
+ * The C++ type of each element of a batch conversion of the API type
+ * `T`.
+ *
+ * This is `T::Ptr` for OpenAssetIO pointer types, as returned by
+ * @ref castFromPyObject, and `T` itself for value types such as
+ * @ref EntityReference.
+ */
+template <typename T, typename = void>
+struct BatchElement {
+  /// Value type.
+  using type = T;
+};
+
+/// Specialization for OpenAssetIO pointer types.
+template <typename T>
+struct BatchElement<T, std::void_t<typename T::Ptr>> {
+  /// Pointer type.
+  using type = typename T::Ptr;
+};
+
+/**
+ * Casts a list of C++ API objects to a Python list of the equivalent
+ * Python objects.
+ *
+ * This is the batch equivalent of @ref castToPyObject, for converting
+ * many objects at once. The GIL is acquired, and the Python type
+ * registered for the C++ type is looked up, once for the whole batch,
+ * rather than once per element. Polymorphic types (e.g. @ref
+ * managerApi::ManagerInterface) are the exception, since the Python
+ * type of each element depends on its most-derived C++ type.
+ *
+ * This template is explicitly instantiated to only the OpenAssetIO
+ * pointer types supported by @ref castToPyObject, plus
+ * @ref EntityReference, which is copied.
+ *
+ * As for @ref castToPyObject, each Python element takes shared
+ * ownership of its C++ instance, and null pointers become `None`.
+ *
+ * @note This function acquires the GIL, if not already held.
+ *
+ * @warning A Python environment, with `openassetio` imported, must be
+ *          available in order to use this function.
+ *
+ * @param objects C++ objects to convert, e.g. @ref EntityReferences or
+ * a vector of @ref trait::TraitsDataPtr.
+ *
+ * @return A `PyObject` pointer to a new Python `list`, in the same
+ * order as \p objects. The caller owns the returned reference, and
+ * must decrement it when done.
+ *
+ * @throws errors.InputValidationException if the cast fails.
+ */
+template <typename T>
+OPENASSETIO_PYTHON_BRIDGE_EXPORT PyObject* castToPyList(const std::vector<T>& objects);
+
+/**
+ * Casts a Python list of API objects to a list of the equivalent C++
+ * API objects.
+ *
+ * This is the batch equivalent of @ref castFromPyObject, for
+ * converting many objects at once. The GIL is acquired, and the C++
+ * type's Python type registration is looked up, once for the whole
+ * batch, rather than once per element.
+ *
+ * This template is explicitly instantiated to only the OpenAssetIO
+ * types supported by @ref castFromPyObject, plus
+ * @ref EntityReference, which is copied.
+ *
+ * @code{.cpp}
+ * std::vector<TraitsDataPtr> traitsDatas =
+ *     castFromPyList<TraitsData>(pyTraitsDatas);
+ * @endcode
+ *
+ * As for @ref castFromPyObject, each returned pointer keeps its
+ * Python object alive, and `None` elements become null pointers.
+ * `None` is not a valid value type element.
+ *
+ * @note This function acquires the GIL, if not already held.
+ *
+ * @warning A Python environment, with `openassetio` imported, must be
+ *          available in order to use this function.
+ *
+ * @param pyList A `PyObject` pointer to a Python `list` or `tuple`,
+ * whose elements must be of equivalent type to the template argument.
+ *
+ * @return C++ objects cast from the elements of \p pyList, in the
+ * same order.
+ *
+ * @throws errors.InputValidationException if \p pyList is null or not
+ * a `list` or `tuple`, or if any element cannot be cast.
+ */
+template <typename T>
+OPENASSETIO_PYTHON_BRIDGE_EXPORT std::vector<typename BatchElement<T>::type> castFromPyList(
+    PyObject* pyList);
+
 }  // namespace python::converter
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -19,10 +19,50 @@ namespace hostApi {
 /**
  * Retrieve an instance of the the Python plugin system implementation.
  *
+ * Plugins are loaded into the main (embedded or hosting) interpreter,
+ * so calls to Python managers from multiple host threads are
+ * serialised by the GIL, unless using a free-threaded (PEP 703) build
+ * of Python.
+ *
+ * Python objects (e.g. manager states) whose last C++ reference is
+ * dropped by a thread that doesn't hold the GIL are released later, in
+ * bulk, by a thread that does. Should many such releases accumulate,
+ * the dropping thread will acquire the GIL to release them, unless the
+ * `OPENASSETIO_PYTHON_NONBLOCKING_RELEASE` environment variable is set
+ * (to a value other than `0`), in which case C++ threads never block
+ * on the GIL merely to release a Python object.
+ *
+ * @param logger Logger for the plugin system to report to.
  * @return Python plugin system.
  */
 OPENASSETIO_PYTHON_BRIDGE_EXPORT openassetio::hostApi::ManagerImplementationFactoryInterfacePtr
 createPythonPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger);
+
+/**
+ * Retrieve an instance of the Python plugin system implementation
+ * that defers initializing Python until a plugin is instantiated.
+ *
+ * Unlike @ref createPythonPluginSystemManagerImplementationFactory,
+ * this does not require an initialized interpreter. Hosts that may not
+ * end up using a Python manager therefore avoid the cost of starting
+ * Python, and of importing the plugin system.
+ *
+ * If the `OPENASSETIO_PLUGIN_INDEX` environment variable names a
+ * readable plugin index, as written by `python -m
+ * openassetio.pluginSystem --write-index`, then `identifiers` and
+ * `details` are served from the index without Python. Otherwise, or
+ * for plugins whose details are not indexed, they are delegated to the
+ * Python plugin system, as is `instantiate`.
+ *
+ * When Python is first needed, the embedded interpreter is initialized
+ * if the host has not already done so, without installing signal
+ * handlers. It is then never finalized by OpenAssetIO.
+ *
+ * @param logger Logger for the plugin system to report to.
+ * @return Lazily initialized Python plugin system.
+ */
+OPENASSETIO_PYTHON_BRIDGE_EXPORT openassetio::hostApi::ManagerImplementationFactoryInterfacePtr
+createLazyPythonPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger);
 }  // namespace hostApi
 }  // namespace python
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -2,9 +2,16 @@
 // Copyright 2022 The Foundry Visionmongers Ltd
 #include <openassetio/python/converter.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include <pybind11/embed.h>
 
 #include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
@@ -27,6 +34,48 @@ namespace py = pybind11;
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace python::converter {
+namespace {
+/// The C++ API class of a batch element type.
+template <typename Element>
+struct ElementClass {
+  using type = Element;
+};
+
+template <typename Class>
+struct ElementClass<std::shared_ptr<Class>> {
+  using type = Class;
+};
+
+/**
+ * Cast a batch element to Python, reusing the Python type registration
+ * looked up for the batch.
+ *
+ * This mirrors what `py::cast` does, minus the registration lookup.
+ * Polymorphic classes must still be looked up per instance, since the
+ * most-derived registered type is used.
+ */
+template <typename Element>
+py::object castElementToPython(const Element& element, const py::detail::type_info* typeInfo) {
+  using Class = typename ElementClass<Element>::type;
+  if constexpr (std::is_polymorphic_v<Class>) {
+    return py::cast(element);
+  } else if constexpr (std::is_same_v<Element, Class>) {
+    // Value type, so give Python its own copy.
+    return py::reinterpret_steal<py::object>(py::detail::type_caster_generic::cast(
+        &element, py::return_value_policy::copy, py::handle{}, typeInfo,
+        [](const void* source) -> void* {
+          return new Class(*static_cast<const Class*>(source));
+        },
+        nullptr));
+  } else {
+    // Pointer type, so Python shares ownership via a copy of the holder.
+    return py::reinterpret_steal<py::object>(py::detail::type_caster_generic::cast(
+        element.get(), py::return_value_policy::take_ownership, py::handle{}, typeInfo, nullptr,
+        nullptr, &element));
+  }
+}
+}  // namespace
+
 
 template <typename T>
 PyObject* castToPyObject(const T& objectPtr) {
@@ -77,13 +126,95 @@ typename T::Ptr castFromPyObject(PyObject* pyObject) {
   }
 }
 
+template <typename T>
+PyObject* castToPyList(const std::vector<T>& objects) {
+  using Class = typename ElementClass<T>::type;
+  const py::gil_scoped_acquire gil{};
+  // See castToPyObject.
+  const py::error_scope previousErrorState;
+
+  const py::detail::type_info* typeInfo = py::detail::get_type_info(typeid(Class));
+  if (typeInfo == nullptr) {
+    throw errors::InputValidationException("Unregistered type : " + py::type_id<Class>());
+  }
+
+  py::list pyList{objects.size()};
+  for (std::size_t idx = 0; idx < objects.size(); ++idx) {
+    py::object pyObject = castElementToPython(objects[idx], typeInfo);
+    if (!pyObject) {
+      const py::error_scope castErrorState;
+      throw errors::InputValidationException(
+          castErrorState.value != nullptr
+              ? static_cast<std::string>(py::str(castErrorState.value))
+              : "Unable to cast C++ object at index " + std::to_string(idx) + " to Python");
+    }
+    // Steals the reference.
+    PyList_SET_ITEM(pyList.ptr(), static_cast<Py_ssize_t>(idx), pyObject.release().ptr());
+  }
+  return pyList.release().ptr();
+}
+
+template <typename T>
+std::vector<typename BatchElement<T>::type> castFromPyList(PyObject* pyList) {
+  if (pyList == nullptr) {
+    throw errors::InputValidationException(
+        "Attempting to cast a nullptr PyObject in "
+        "openassetio::python::converter::castFromPyList");
+  }
+  const py::gil_scoped_acquire gil{};
+  if (!PyList_Check(pyList) && !PyTuple_Check(pyList)) {
+    throw errors::InputValidationException(
+        "Attempting to cast a PyObject that is not a list or tuple in "
+        "openassetio::python::converter::castFromPyList");
+  }
+
+  const Py_ssize_t size = PySequence_Fast_GET_SIZE(pyList);
+  PyObject** const items = PySequence_Fast_ITEMS(pyList);
+
+  // Constructing the caster looks up the type registration, so reuse
+  // it for every element.
+  py::detail::make_caster<T> caster;
+
+  std::vector<typename BatchElement<T>::type> objects;
+  objects.reserve(static_cast<std::size_t>(size));
+  for (Py_ssize_t idx = 0; idx < size; ++idx) {
+    const py::handle item{items[idx]};
+    T* cppInstancePtr = nullptr;
+    if (caster.load(item, /* convert= */ true)) {
+      cppInstancePtr = py::detail::cast_op<T*>(caster);
+    }
+    if constexpr (std::is_same_v<typename BatchElement<T>::type, T>) {
+      if (cppInstancePtr == nullptr) {
+        throw errors::InputValidationException(
+            "Unable to cast Python instance at index " + std::to_string(idx) +
+            " to C++ type '" + py::type_id<T>() + "'");
+      }
+      objects.push_back(*cppInstancePtr);
+    } else {
+      if (cppInstancePtr == nullptr && !item.is_none()) {
+        throw errors::InputValidationException(
+            "Unable to cast Python instance at index " + std::to_string(idx) +
+            " to C++ type '" + py::type_id<T>() + "'");
+      }
+      // See castFromPyObject.
+      objects.push_back(pointers::createPyRetainingPtr<typename T::Ptr>(
+          py::reinterpret_borrow<py::object>(item), cppInstancePtr));
+    }
+  }
+  return objects;
+}
+
 // To/from explicit specialization convenience.
 // As these specializations are being used across library boundaries,
 // we must export them to prevent undefined-symbol link errors.
-#define OPENASSETIO_SPECIALIZE_PYTHON_CONVERSIONS(Class)                          \
-  template OPENASSETIO_PYTHON_BRIDGE_EXPORT PyObject* castToPyObject<Class::Ptr>( \
-      const Class::Ptr&);                                                         \
-  template OPENASSETIO_PYTHON_BRIDGE_EXPORT Class::Ptr castFromPyObject<Class>(PyObject*);
+#define OPENASSETIO_SPECIALIZE_PYTHON_CONVERSIONS(Class)                                   \
+  template OPENASSETIO_PYTHON_BRIDGE_EXPORT PyObject* castToPyObject<Class::Ptr>(          \
+      const Class::Ptr&);                                                                  \
+  template OPENASSETIO_PYTHON_BRIDGE_EXPORT Class::Ptr castFromPyObject<Class>(PyObject*); \
+  template OPENASSETIO_PYTHON_BRIDGE_EXPORT PyObject* castToPyList<Class::Ptr>(            \
+      const std::vector<Class::Ptr>&);                                                     \
+  template OPENASSETIO_PYTHON_BRIDGE_EXPORT std::vector<Class::Ptr> castFromPyList<Class>( \
+      PyObject*);
 
 OPENASSETIO_SPECIALIZE_PYTHON_CONVERSIONS(openassetio::Context)
 OPENASSETIO_SPECIALIZE_PYTHON_CONVERSIONS(trait::TraitsData)
@@ -99,6 +230,12 @@ OPENASSETIO_SPECIALIZE_PYTHON_CONVERSIONS(managerApi::HostSession)
 OPENASSETIO_SPECIALIZE_PYTHON_CONVERSIONS(managerApi::ManagerInterface)
 OPENASSETIO_SPECIALIZE_PYTHON_CONVERSIONS(managerApi::ManagerStateBase)
 
+// Value types only support batch conversion.
+template OPENASSETIO_PYTHON_BRIDGE_EXPORT PyObject* castToPyList<EntityReference>(
+    const EntityReferences&);
+template OPENASSETIO_PYTHON_BRIDGE_EXPORT EntityReferences castFromPyList<EntityReference>(
+    PyObject*);
+
 }  // namespace python::converter
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
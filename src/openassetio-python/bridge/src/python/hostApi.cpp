@@ -2,15 +2,23 @@
 // Copyright 2022 The Foundry Visionmongers Ltd
 #include <openassetio/python/hostApi.hpp>
 
+#include <cstdlib>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 
 #include <pybind11/embed.h>
 
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
 // Private headers
 #include <openassetio/private/python/pointers.hpp>
 
+#include "pluginIndex.hpp"
+
 namespace py = pybind11;
 
 namespace openassetio {
@@ -20,8 +28,21 @@ namespace python::hostApi {
 using openassetio::hostApi::ManagerImplementationFactoryInterface;
 using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
 
-ManagerImplementationFactoryInterfacePtr createPythonPluginSystemManagerImplementationFactory(
-    log::LoggerInterfacePtr logger) {  // NOLINT(performance-unnecessary-value-param)
+namespace {
+/// Environment variable read by the Python plugin system for the path
+/// to a plugin index.
+constexpr const char* kPluginIndexEnvVar = "OPENASSETIO_PLUGIN_INDEX";
+
+/**
+ * Construct the Python plugin system.
+ *
+ * @param logger Logger for the plugin system to report to.
+ * @param indexPath Path to a plugin index to use in place of the
+ * environment, if any.
+ */
+ManagerImplementationFactoryInterfacePtr createPluginSystem(
+    log::LoggerInterfacePtr logger,  // NOLINT(performance-unnecessary-value-param)
+    const std::optional<Str>& indexPath) {
   // Caller might not hold the GIL, which is required for `import`s.
   const py::gil_scoped_acquire gil{};
 
@@ -32,7 +53,9 @@ ManagerImplementationFactoryInterfacePtr createPythonPluginSystemManagerImplemen
           .attr("PythonPluginSystemManagerImplementationFactory");
 
   // Instantiate Python object.
-  const py::object pyInstance = pyClass(std::move(logger));
+  const py::object pyInstance = indexPath
+                                    ? pyClass(std::move(logger), py::arg("indexPath") = *indexPath)
+                                    : pyClass(std::move(logger));
 
   // Extract the underlying C++ base class pointer.
   auto* cppInstancePtr = py::cast<ManagerImplementationFactoryInterface*>(pyInstance);
@@ -42,6 +65,120 @@ ManagerImplementationFactoryInterfacePtr createPythonPluginSystemManagerImplemen
   return pointers::createPyRetainingPtr<ManagerImplementationFactoryInterfacePtr>(pyInstance,
                                                                                   cppInstancePtr);
 }
+
+/**
+ * Initialize the embedded interpreter, if the host has not already.
+ *
+ * The interpreter is never finalized, since Python objects (e.g.
+ * manager plugins) may outlive any particular owner.
+ */
+void ensureInterpreterInitialized() {
+  static std::once_flag initialized;
+  std::call_once(initialized, [] {
+    if (Py_IsInitialized()) {
+      return;
+    }
+    // Leave signal handling to the host.
+    py::initialize_interpreter(/* init_signal_handlers= */ false);
+    // Release the GIL, which is held by the initializing thread, so
+    // that any thread may subsequently acquire it.
+    PyEval_SaveThread();
+  });
+}
+
+/**
+ * Python plugin system that defers initializing Python, and importing
+ * the plugin system, until a manager plugin is instantiated.
+ *
+ * Identifiers and details are served from the plugin index named by
+ * `OPENASSETIO_PLUGIN_INDEX`, if available, without Python. Otherwise,
+ * they are delegated to the Python plugin system.
+ */
+class LazyPythonPluginSystemManagerImplementationFactory final
+    : public ManagerImplementationFactoryInterface {
+ public:
+  explicit LazyPythonPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger)
+      : ManagerImplementationFactoryInterface{std::move(logger)} {}
+
+  Identifiers identifiers() override {
+    if (const PluginIndex* index = pluginIndex()) {
+      return index->identifiers;
+    }
+    return pluginSystem()->identifiers();
+  }
+
+  managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override {
+    return pluginSystem()->instantiate(identifier);
+  }
+
+  std::optional<ManagerDetail> details(const Identifier& identifier) override {
+    if (const PluginIndex* index = pluginIndex()) {
+      if (const auto iter = index->details.find(identifier); iter != index->details.end()) {
+        return iter->second;
+      }
+    }
+    return pluginSystem()->details(identifier);
+  }
+
+ private:
+  /// @return The plugin index, or nullptr if unavailable.
+  const PluginIndex* pluginIndex() {
+    std::call_once(indexRead_, [this] {
+      const char* indexPath = std::getenv(kPluginIndexEnvVar);
+      if (indexPath == nullptr || *indexPath == '\0') {
+        return;
+      }
+      try {
+        index_ = readPluginIndex(indexPath);
+        indexPath_ = indexPath;
+      } catch (const std::exception& exc) {
+        // The Python plugin system will warn, should it be needed.
+        logger_->debug(Str{"LazyPythonPluginSystem: Ignoring unusable plug-in index "} +
+                       indexPath + ": " + exc.what());
+      }
+    });
+    return index_ ? &*index_ : nullptr;
+  }
+
+  /// @return The Python plugin system, initializing Python if needed.
+  ManagerImplementationFactoryInterfacePtr pluginSystem() {
+    {
+      const std::lock_guard lock{mutex_};
+      if (pluginSystem_) {
+        return pluginSystem_;
+      }
+    }
+    // Ensure both layers agree on the index.
+    static_cast<void>(pluginIndex());
+    ensureInterpreterInitialized();
+    // Don't hold the lock whilst acquiring the GIL, which could
+    // deadlock with a Python thread calling into this factory.
+    ManagerImplementationFactoryInterfacePtr pluginSystem =
+        createPluginSystem(logger_, indexPath_);
+    const std::lock_guard lock{mutex_};
+    if (!pluginSystem_) {
+      pluginSystem_ = std::move(pluginSystem);
+    }
+    return pluginSystem_;
+  }
+
+  std::once_flag indexRead_;
+  std::optional<PluginIndex> index_;
+  std::optional<Str> indexPath_;
+  std::mutex mutex_;
+  ManagerImplementationFactoryInterfacePtr pluginSystem_;
+};
+}  // namespace
+
+ManagerImplementationFactoryInterfacePtr createPythonPluginSystemManagerImplementationFactory(
+    log::LoggerInterfacePtr logger) {
+  return createPluginSystem(std::move(logger), std::nullopt);
+}
+
+ManagerImplementationFactoryInterfacePtr createLazyPythonPluginSystemManagerImplementationFactory(
+    log::LoggerInterfacePtr logger) {
+  return std::make_shared<LazyPythonPluginSystemManagerImplementationFactory>(std::move(logger));
+}
 }  // namespace python::hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -0,0 +1,398 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include "pluginIndex.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi {
+namespace {
+/// Version of the index format written by the Python plugin system.
+constexpr Int kIndexVersion = 1;
+
+struct JsonValue;
+using JsonArray = std::vector<JsonValue>;
+using JsonObject = std::vector<std::pair<Str, JsonValue>>;
+
+/// A parsed JSON value, where `null` is `std::monostate`.
+struct JsonValue {
+  std::variant<std::monostate, bool, Int, Float, Str, JsonArray, JsonObject> value;
+};
+
+/**
+ * Minimal JSON parser, sufficient for files written by Python's `json`
+ * module, including its non-standard `NaN` and `Infinity` literals.
+ */
+class JsonParser {
+ public:
+  explicit JsonParser(std::string_view text) : text_{text} {}
+
+  JsonValue parseDocument() {
+    JsonValue value = parseValue();
+    skipWhitespace();
+    if (pos_ != text_.size()) {
+      fail("unexpected trailing characters");
+    }
+    return value;
+  }
+
+ private:
+  [[noreturn]] void fail(std::string_view reason) const {
+    throw std::runtime_error{"invalid JSON at offset " + std::to_string(pos_) + ": " +
+                             Str{reason}};
+  }
+
+  void skipWhitespace() {
+    while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t' ||
+                                   text_[pos_] == '\n' || text_[pos_] == '\r')) {
+      ++pos_;
+    }
+  }
+
+  [[nodiscard]] char peek() const { return pos_ < text_.size() ? text_[pos_] : '\0'; }
+
+  void expect(const char chr) {
+    if (peek() != chr) {
+      fail(Str{"expected '"} + chr + "'");
+    }
+    ++pos_;
+  }
+
+  bool consumeLiteral(std::string_view literal) {
+    if (text_.substr(pos_, literal.size()) != literal) {
+      return false;
+    }
+    pos_ += literal.size();
+    return true;
+  }
+
+  JsonValue parseValue() {
+    skipWhitespace();
+    switch (peek()) {
+      case '{':
+        return {parseObject()};
+      case '[':
+        return {parseArray()};
+      case '"':
+        return {parseString()};
+      default:
+        break;
+    }
+    if (consumeLiteral("null")) {
+      return {std::monostate{}};
+    }
+    if (consumeLiteral("true")) {
+      return {true};
+    }
+    if (consumeLiteral("false")) {
+      return {false};
+    }
+    if (consumeLiteral("NaN")) {
+      return {std::numeric_limits<Float>::quiet_NaN()};
+    }
+    if (consumeLiteral("Infinity")) {
+      return {std::numeric_limits<Float>::infinity()};
+    }
+    if (consumeLiteral("-Infinity")) {
+      return {-std::numeric_limits<Float>::infinity()};
+    }
+    return parseNumber();
+  }
+
+  JsonObject parseObject() {
+    expect('{');
+    JsonObject object;
+    skipWhitespace();
+    if (peek() == '}') {
+      ++pos_;
+      return object;
+    }
+    while (true) {
+      skipWhitespace();
+      Str key = parseString();
+      skipWhitespace();
+      expect(':');
+      object.emplace_back(std::move(key), parseValue());
+      skipWhitespace();
+      if (peek() == '}') {
+        ++pos_;
+        return object;
+      }
+      expect(',');
+    }
+  }
+
+  JsonArray parseArray() {
+    expect('[');
+    JsonArray array;
+    skipWhitespace();
+    if (peek() == ']') {
+      ++pos_;
+      return array;
+    }
+    while (true) {
+      array.push_back(parseValue());
+      skipWhitespace();
+      if (peek() == ']') {
+        ++pos_;
+        return array;
+      }
+      expect(',');
+    }
+  }
+
+  Str parseString() {
+    expect('"');
+    Str result;
+    while (true) {
+      if (pos_ >= text_.size()) {
+        fail("unterminated string");
+      }
+      const char chr = text_[pos_++];
+      if (chr == '"') {
+        return result;
+      }
+      if (chr != '\\') {
+        result.push_back(chr);
+        continue;
+      }
+      switch (peek()) {
+        case '"':
+        case '\\':
+        case '/':
+          result.push_back(text_[pos_]);
+          break;
+        case 'b':
+          result.push_back('\b');
+          break;
+        case 'f':
+          result.push_back('\f');
+          break;
+        case 'n':
+          result.push_back('\n');
+          break;
+        case 'r':
+          result.push_back('\r');
+          break;
+        case 't':
+          result.push_back('\t');
+          break;
+        case 'u':
+          ++pos_;
+          appendUtf8(result, parseCodePoint());
+          continue;
+        default:
+          fail("invalid escape");
+      }
+      ++pos_;
+    }
+  }
+
+  /// Parse the hex digits of a `\u` escape, combining surrogate pairs.
+  std::uint32_t parseCodePoint() {
+    std::uint32_t codePoint = parseHex4();
+    if (codePoint >= 0xD800 && codePoint < 0xDC00 && consumeLiteral("\\u")) {
+      const std::uint32_t low = parseHex4();
+      if (low < 0xDC00 || low >= 0xE000) {
+        fail("invalid surrogate pair");
+      }
+      codePoint = 0x10000 + ((codePoint - 0xD800) << 10U) + (low - 0xDC00);
+    }
+    return codePoint;
+  }
+
+  std::uint32_t parseHex4() {
+    std::uint32_t value = 0;
+    const std::string_view digits = text_.substr(pos_, 4);
+    const auto [end, errc] =
+        std::from_chars(digits.data(), digits.data() + digits.size(), value, 16);
+    if (errc != std::errc{} || end != digits.data() + 4) {
+      fail("invalid unicode escape");
+    }
+    pos_ += 4;
+    return value;
+  }
+
+  static void appendUtf8(Str& out, const std::uint32_t codePoint) {
+    if (codePoint < 0x80) {
+      out.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+      out.push_back(static_cast<char>(0xC0 | (codePoint >> 6U)));
+      out.push_back(static_cast<char>(0x80 | (codePoint & 0x3FU)));
+    } else if (codePoint < 0x10000) {
+      out.push_back(static_cast<char>(0xE0 | (codePoint >> 12U)));
+      out.push_back(static_cast<char>(0x80 | ((codePoint >> 6U) & 0x3FU)));
+      out.push_back(static_cast<char>(0x80 | (codePoint & 0x3FU)));
+    } else {
+      out.push_back(static_cast<char>(0xF0 | (codePoint >> 18U)));
+      out.push_back(static_cast<char>(0x80 | ((codePoint >> 12U) & 0x3FU)));
+      out.push_back(static_cast<char>(0x80 | ((codePoint >> 6U) & 0x3FU)));
+      out.push_back(static_cast<char>(0x80 | (codePoint & 0x3FU)));
+    }
+  }
+
+  JsonValue parseNumber() {
+    const std::size_t start = pos_;
+    bool isFloat = false;
+    if (peek() == '-') {
+      ++pos_;
+    }
+    for (; pos_ < text_.size(); ++pos_) {
+      const char chr = text_[pos_];
+      if (chr == '.' || chr == 'e' || chr == 'E' || chr == '+' || chr == '-') {
+        isFloat = true;
+      } else if (chr < '0' || chr > '9') {
+        break;
+      }
+    }
+    const std::string_view number = text_.substr(start, pos_ - start);
+    if (number.empty() || number == "-") {
+      fail("unexpected character");
+    }
+    if (!isFloat) {
+      Int value = 0;
+      const auto [end, errc] =
+          std::from_chars(number.data(), number.data() + number.size(), value);
+      if (errc == std::errc{} && end == number.data() + number.size()) {
+        return {value};
+      }
+      // Out of range for Int, so fall through to a (lossy) Float.
+    }
+    // std::from_chars for floating point is not universally available,
+    // and std::stod depends on the global locale.
+    std::istringstream stream{Str{number}};
+    stream.imbue(std::locale::classic());
+    Float value = 0;
+    stream >> value;
+    if (stream.fail() || stream.peek() != std::char_traits<char>::eof()) {
+      fail("invalid number");
+    }
+    return {value};
+  }
+
+  std::string_view text_;
+  std::size_t pos_{0};
+};
+
+/// Look up a key, as Python does, where the last duplicate wins.
+const JsonValue* find(const JsonObject& object, std::string_view key) {
+  const JsonValue* found = nullptr;
+  for (const auto& [entryKey, entryValue] : object) {
+    if (entryKey == key) {
+      found = &entryValue;
+    }
+  }
+  return found;
+}
+
+template <class T>
+const T& get(const JsonObject& object, std::string_view key) {
+  const JsonValue* value = find(object, key);
+  if (value == nullptr) {
+    throw std::runtime_error{"missing '" + Str{key} + "'"};
+  }
+  const T* typed = std::get_if<T>(&value->value);
+  if (typed == nullptr) {
+    throw std::runtime_error{"unexpected type of '" + Str{key} + "'"};
+  }
+  return *typed;
+}
+
+InfoDictionary toInfoDictionary(const JsonObject& object) {
+  InfoDictionary info;
+  for (const auto& [key, value] : object) {
+    std::visit(
+        [&, &key = key](const auto& typed) {
+          using T = std::decay_t<decltype(typed)>;
+          if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, Int> ||
+                        std::is_same_v<T, Float> || std::is_same_v<T, Str>) {
+            info.insert_or_assign(key, typed);
+          } else {
+            throw std::runtime_error{"unsupported type of info key '" + key + "'"};
+          }
+        },
+        value.value);
+  }
+  return info;
+}
+}  // namespace
+
+PluginIndex readPluginIndex(const Str& indexPath) {
+  std::ifstream file{indexPath, std::ios::binary};
+  if (!file) {
+    throw std::runtime_error{"unable to open '" + indexPath + "'"};
+  }
+  const Str text{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  if (file.bad()) {
+    throw std::runtime_error{"unable to read '" + indexPath + "'"};
+  }
+
+  const JsonValue document = JsonParser{text}.parseDocument();
+  const auto* root = std::get_if<JsonObject>(&document.value);
+  if (root == nullptr) {
+    throw std::runtime_error{"index is not an object"};
+  }
+  const JsonValue* version = find(*root, "version");
+  const Int* versionNumber = version ? std::get_if<Int>(&version->value) : nullptr;
+  if (versionNumber == nullptr || *versionNumber != kIndexVersion) {
+    throw std::runtime_error{"unsupported version"};
+  }
+
+  PluginIndex index;
+  std::unordered_set<Identifier> seenIdentifiers;
+  for (const JsonValue& entryValue : get<JsonArray>(*root, "plugins")) {
+    const auto* entry = std::get_if<JsonObject>(&entryValue.value);
+    if (entry == nullptr) {
+      throw std::runtime_error{"plugin entry is not an object"};
+    }
+    const Str& identifier = get<Str>(*entry, "identifier");
+    // Required, as for the Python plugin system, though only used by
+    // Python when the plugin is imported.
+    static_cast<void>(get<Str>(*entry, "path"));
+
+    if (!seenIdentifiers.insert(identifier).second) {
+      continue;
+    }
+    index.identifiers.push_back(identifier);
+
+    const JsonValue* metadata = find(*entry, "metadata");
+    const auto* metadataObject = metadata ? std::get_if<JsonObject>(&metadata->value) : nullptr;
+    const JsonValue* details = metadataObject ? find(*metadataObject, "details") : nullptr;
+    if (details == nullptr) {
+      continue;
+    }
+    if (std::holds_alternative<std::monostate>(details->value)) {
+      index.details.emplace(identifier, std::nullopt);
+      continue;
+    }
+    const auto* detailsObject = std::get_if<JsonObject>(&details->value);
+    if (detailsObject == nullptr) {
+      throw std::runtime_error{"details of '" + identifier + "' are not an object"};
+    }
+    const Str& displayName = get<Str>(*detailsObject, "displayName");
+    InfoDictionary info = toInfoDictionary(get<JsonObject>(*detailsObject, "info"));
+    index.details.emplace(identifier,
+                          PluginIndex::ManagerDetail{identifier, displayName, std::move(info)});
+  }
+  return index;
+}
+}  // namespace python::hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
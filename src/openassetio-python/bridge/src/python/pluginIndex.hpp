@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi {
+/**
+ * The plugins listed in a Python plugin index file, as written by
+ * `PythonPluginSystemManagerImplementationFactory.writeIndex`.
+ *
+ * Reading the index does not require Python.
+ */
+struct PluginIndex {
+  using ManagerDetail =
+      openassetio::hostApi::ManagerImplementationFactoryInterface::ManagerDetail;
+
+  /// Identifiers of indexed plugins, in index order, without
+  /// duplicates.
+  Identifiers identifiers;
+
+  /**
+   * Details of indexed plugins, keyed by identifier.
+   *
+   * Plugins whose details were not recorded in the index are absent.
+   * Plugins that were recorded as declaring no details map to an empty
+   * value.
+   */
+  std::unordered_map<Identifier, std::optional<ManagerDetail>> details;
+};
+
+/**
+ * Read a Python plugin index file.
+ *
+ * As for the Python plugin system, where a plugin is listed more than
+ * once, the first entry wins.
+ *
+ * @param indexPath Path to the index file.
+ * @return The indexed plugins.
+ * @exception std::runtime_error If the file cannot be read, is not
+ * valid JSON, or is not an index of a supported version.
+ */
+PluginIndex readPluginIndex(const Str& indexPath);
+}  // namespace python::hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
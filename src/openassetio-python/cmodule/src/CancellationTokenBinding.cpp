@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+
+#include <openassetio/CancellationToken.hpp>
+
+#include "_openassetio.hpp"
+
+void registerCancellationToken(const py::module& mod) {
+  using openassetio::CancellationToken;
+  using openassetio::CancellationTokenPtr;
+
+  py::class_<CancellationToken, CancellationTokenPtr>{mod, "CancellationToken", py::is_final()}
+      .def(py::init([]() { return CancellationToken::make(); }))
+      .def(py::init([](const std::chrono::duration<double> timeout) {
+             return CancellationToken::make(
+                 CancellationToken::Clock::now() +
+                 std::chrono::duration_cast<CancellationToken::Clock::duration>(timeout));
+           }),
+           py::arg("timeout"))
+      .def_static("makeChild", &CancellationToken::makeChild, py::arg("parent").none(false))
+      .def("cancel", &CancellationToken::cancel)
+      .def("isCancelled", &CancellationToken::isCancelled);
+}
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <utility>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/ConditionalResolveResult.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "_openassetio.hpp"
+
+void registerConditionalResolveResult(const py::module& mod) {
+  using openassetio::ConditionalResolveResult;
+  using openassetio::Str;
+  using openassetio::trait::TraitsDataPtr;
+
+  py::class_<ConditionalResolveResult>{mod, "ConditionalResolveResult", py::is_final()}
+      .def(py::init([](TraitsDataPtr traitsData, Str generationToken) {
+             return ConditionalResolveResult{std::move(traitsData), std::move(generationToken)};
+           }),
+           py::arg("traitsData"), py::arg("generationToken"))
+      .def_readwrite("traitsData", &ConditionalResolveResult::traitsData)
+      .def_readwrite("generationToken", &ConditionalResolveResult::generationToken);
+}
@@ -3,6 +3,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
 #include <openassetio/managerApi/ManagerStateBase.hpp>
 #include <openassetio/trait/TraitsData.hpp>
@@ -22,6 +23,11 @@ void registerContext(const py::module& mod) {
 
   py::class_<Context, ContextPtr> context{mod, "Context", py::is_final()};
 
+  py::enum_<Context::Priority>{context, "Priority"}
+      .value("kBackground", Context::Priority::kBackground)
+      .value("kNormal", Context::Priority::kNormal)
+      .value("kInteractive", Context::Priority::kInteractive);
+
   context
       .def(py::init(
                [](PyRetainingTraitsDataPtr locale, PyRetainingManagerStateBasePtr managerState) {
@@ -39,5 +45,29 @@ void registerContext(const py::module& mod) {
           "managerState", [](const Context& self) { return self.managerState; },
           [](Context& self, PyRetainingManagerStateBasePtr managerState) {
             self.managerState = std::move(managerState);
-          });
+          })
+      .def_readwrite("cancellationToken", &Context::cancellationToken)
+      .def_readwrite("priority", &Context::priority)
+      .def("memoryUsage", &Context::memoryUsage)
+      .def("fingerprint", &Context::fingerprint)
+      .def("freeze", &Context::freeze)
+      // Only the locale is pickled. The manager state is opaque, and
+      // must instead be persisted via the manager, whilst the
+      // cancellation token is only meaningful within this process.
+      .def(py::pickle(
+          [](const Context& self) {
+            if (self.managerState) {
+              throw py::type_error{
+                  "Cannot pickle a Context with a managerState, use"
+                  " Manager.persistenceTokenForContext instead"};
+            }
+            return py::make_tuple(self.locale);
+          },
+          [](const py::tuple& state) {
+            if (state.size() != 1) {
+              throw py::value_error{"Invalid Context state"};
+            }
+            return Context::make(state[0].cast<openassetio::trait::TraitsDataPtr>(),
+                                 ManagerStateBasePtr{});
+          }));
 }
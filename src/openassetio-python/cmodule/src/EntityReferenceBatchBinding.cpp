@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+
+#include <pybind11/operators.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/EntityReferenceBatch.hpp>
+
+#include "_openassetio.hpp"
+
+void registerEntityReferenceBatch(const py::module& mod) {
+  using openassetio::EntityReferenceBatch;
+  using openassetio::EntityReferences;
+
+  py::class_<EntityReferenceBatch>{mod, "EntityReferenceBatch", py::is_final()}
+      .def(py::init())
+      .def(py::init<const EntityReferences&>(), py::arg("entityReferences"))
+      .def("reserve", &EntityReferenceBatch::reserve, py::arg("count"), py::arg("totalLength"))
+      .def("append", &EntityReferenceBatch::append, py::arg("entityReferenceString"))
+      .def("entityReference", &EntityReferenceBatch::entityReference, py::arg("index"))
+      .def("toEntityReferences", &EntityReferenceBatch::toEntityReferences)
+      .def("__len__", &EntityReferenceBatch::size)
+      .def("__getitem__",
+           [](const EntityReferenceBatch& self, const std::size_t index) -> std::string_view {
+             if (index >= self.size()) {
+               throw py::index_error{};
+             }
+             return self[index];
+           })
+      .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
+}
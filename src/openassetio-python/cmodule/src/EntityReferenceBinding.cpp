@@ -1,5 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <functional>
+#include <utility>
+
 #include <fmt/format.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
@@ -19,5 +22,11 @@ void registerEntityReference(const py::module& mod) {
            [](const EntityReference& self) {
              return fmt::format("<openassetio.EntityReference {}>", self.toString());
            })
-      .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
+      .def(py::self == py::self)  // NOLINT(misc-redundant-expression)
+      .def("__hash__",
+           [](const EntityReference& self) { return std::hash<EntityReference>{}(self); })
+      .def(py::pickle([](const EntityReference& self) { return self.toString(); },
+                      [](openassetio::Str entityReferenceString) {
+                        return EntityReference{std::move(entityReferenceString)};
+                      }));
 }
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines EntityReferencesView, a read-only Python sequence that wraps
+ * a batch of entity references without copying it, and
+ * EntityReferencesViewArg, for giving such a view to Python overrides.
+ */
+#include <memory>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/EntityReference.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python {
+/**
+ * Read-only view of a batch of entity references, exposed to Python
+ * as a sequence, whose elements are only converted to Python objects
+ * when accessed.
+ *
+ * A view may either own its references or borrow them from a vector
+ * that is owned elsewhere. A borrowing view must not outlive the
+ * vector, unless it is first @ref detach "detached".
+ */
+class EntityReferencesView final {
+ public:
+  /// Construct a view that owns the given references.
+  explicit EntityReferencesView(EntityReferences entityReferences)
+      : owned_{std::move(entityReferences)}, entityReferences_{&owned_} {}
+
+  /// Construct a view that borrows the given references.
+  explicit EntityReferencesView(const EntityReferences* entityReferences)
+      : entityReferences_{entityReferences} {}
+
+  EntityReferencesView(const EntityReferencesView&) = delete;
+  EntityReferencesView(EntityReferencesView&&) noexcept = delete;
+  EntityReferencesView& operator=(const EntityReferencesView&) = delete;
+  EntityReferencesView& operator=(EntityReferencesView&&) noexcept = delete;
+  ~EntityReferencesView() = default;
+
+  /// @return The viewed references.
+  [[nodiscard]] const EntityReferences& entityReferences() const { return *entityReferences_; }
+
+  /// Take a copy of borrowed references, such that the view no longer
+  /// depends on the lifetime of the vector it was constructed with.
+  void detach() {
+    if (entityReferences_ != &owned_) {
+      owned_ = *entityReferences_;
+      entityReferences_ = &owned_;
+    }
+  }
+
+ private:
+  EntityReferences owned_;
+  const EntityReferences* entityReferences_;
+};
+
+/**
+ * Argument of a trampoline override that gives a Python override an
+ * EntityReferencesView, rather than a `list` of copies of every
+ * reference, and gives the C++ (base class) implementation the
+ * original `EntityReferences`.
+ *
+ * A borrowing view is created on conversion to Python. When the
+ * argument is destroyed, i.e. once the override has returned, the view
+ * is detached if the override retained a reference to it, so that it
+ * remains valid. Otherwise the references are never copied.
+ *
+ * Since this is designed to be used as a temporary, it must not
+ * outlive the references it is constructed with.
+ */
+class EntityReferencesViewArg final {
+ public:
+  explicit EntityReferencesViewArg(const EntityReferences& entityReferences)
+      : entityReferences_{entityReferences} {}
+
+  EntityReferencesViewArg(const EntityReferencesViewArg&) = delete;
+  EntityReferencesViewArg(EntityReferencesViewArg&&) noexcept = delete;
+  EntityReferencesViewArg& operator=(const EntityReferencesViewArg&) = delete;
+  EntityReferencesViewArg& operator=(EntityReferencesViewArg&&) noexcept = delete;
+
+  ~EntityReferencesViewArg() {
+    if (!pyView_) {
+      return;
+    }
+    // May be destroyed after the GIL has been released, e.g. by
+    // `callBatchOverride`.
+    const pybind11::gil_scoped_acquire gil{};
+    if (pyView_.ref_count() > 1) {
+      view_->detach();
+    }
+    pyView_ = pybind11::object{};
+  }
+
+  /// Convert to the references, for the C++ implementation.
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  operator const EntityReferences&() const { return entityReferences_; }
+
+  /**
+   * Get the view for the Python implementation, creating it if this
+   * is the first call. The GIL must be held.
+   *
+   * @return New reference to the view.
+   */
+  [[nodiscard]] pybind11::handle toPython() const {
+    if (!pyView_) {
+      auto view = std::make_unique<EntityReferencesView>(&entityReferences_);
+      view_ = view.get();
+      pyView_ = pybind11::cast(std::move(view));
+    }
+    return pyView_.inc_ref();
+  }
+
+ private:
+  const EntityReferences& entityReferences_;
+  mutable EntityReferencesView* view_ = nullptr;
+  mutable pybind11::object pyView_;
+};
+}  // namespace python
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+namespace pybind11::detail {
+/**
+ * Custom type caster for EntityReferencesViewArg, which can only be
+ * converted from C++ to Python.
+ */
+template <>
+struct type_caster<openassetio::python::EntityReferencesViewArg> {
+  static constexpr auto name = const_name("EntityReferencesView");
+
+  static handle cast(const openassetio::python::EntityReferencesViewArg& src,
+                     [[maybe_unused]] return_value_policy policy, [[maybe_unused]] handle parent) {
+    return src.toPython();
+  }
+};
+}  // namespace pybind11::detail
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/EntityReference.hpp>
+
+#include "EntityReferencesView.hpp"
+#include "_openassetio.hpp"
+
+void registerEntityReferencesView(const py::module& mod) {
+  using openassetio::EntityReference;
+  using openassetio::EntityReferences;
+  using openassetio::python::EntityReferencesView;
+
+  // Resolve a (possibly negative) index, raising IndexError if out of
+  // range.
+  const auto elementIndex = [](const EntityReferencesView& self, const py::ssize_t index) {
+    const auto size = static_cast<py::ssize_t>(self.entityReferences().size());
+    const py::ssize_t resolvedIndex = index < 0 ? index + size : index;
+    if (resolvedIndex < 0 || resolvedIndex >= size) {
+      throw py::index_error{};
+    }
+    return static_cast<std::size_t>(resolvedIndex);
+  };
+
+  py::class_<EntityReferencesView>{mod, "EntityReferencesView", py::is_final()}
+      .def(py::init<EntityReferences>(), py::arg("entityReferences"))
+      .def("__len__",
+           [](const EntityReferencesView& self) { return self.entityReferences().size(); })
+      .def("__getitem__",
+           [elementIndex](const EntityReferencesView& self, const py::ssize_t index) {
+             return self.entityReferences()[elementIndex(self, index)];
+           })
+      .def("__getitem__",
+           [](const EntityReferencesView& self, const py::slice& slice) {
+             const EntityReferences& entityReferences = self.entityReferences();
+             std::size_t start = 0;
+             std::size_t stop = 0;
+             std::size_t step = 0;
+             std::size_t length = 0;
+             if (!slice.compute(entityReferences.size(), &start, &stop, &step, &length)) {
+               throw py::error_already_set{};
+             }
+             py::list elements{length};
+             for (std::size_t idx = 0; idx < length; ++idx) {
+               elements[idx] = py::cast(entityReferences[start]);
+               start += step;
+             }
+             return elements;
+           })
+      .def("toStrings",
+           [](const EntityReferencesView& self) {
+             const EntityReferences& entityReferences = self.entityReferences();
+             py::list strings{entityReferences.size()};
+             for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+               strings[idx] = py::str{entityReferences[idx].toString()};
+             }
+             return strings;
+           })
+      .def(
+          "__eq__",
+          [](const EntityReferencesView& self, const EntityReferences& other) {
+            return self.entityReferences() == other;
+          },
+          py::is_operator());
+}
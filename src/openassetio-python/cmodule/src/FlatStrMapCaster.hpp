@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines a type caster for FlatStrMap, and hence InfoDictionary and
+ * StrMap, converting to and from a Python dict.
+ */
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/FlatStrMap.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace pybind11::detail {
+/**
+ * Custom type caster for FlatStrMap, reusing pybind11's caster for
+ * STL maps, so that FlatStrMap converts to and from a Python dict in
+ * the same way as `std::unordered_map`.
+ *
+ * This must be visible wherever a FlatStrMap is converted, so is
+ * included via `_openassetio.hpp`.
+ */
+template <class T>
+struct type_caster<openassetio::FlatStrMap<T>>
+    : map_caster<openassetio::FlatStrMap<T>, openassetio::Str, T> {};
+}  // namespace pybind11::detail
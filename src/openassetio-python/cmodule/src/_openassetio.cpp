@@ -3,7 +3,16 @@
 
 #include "_openassetio.hpp"
 
+// Free-threaded (PEP 703) builds of Python re-enable the GIL when
+// importing an extension module that doesn't declare that it can run
+// without it. Our bindings don't rely on the GIL for mutual exclusion,
+// but pybind11 itself is only safe to use without the GIL from v2.13,
+// where the declaration is ignored by builds that have a GIL.
+#if PYBIND11_VERSION_HEX >= 0x020D0000
+PYBIND11_MODULE(_openassetio, mod, pybind11::mod_gil_not_used()) {
+#else
 PYBIND11_MODULE(_openassetio, mod) {
+#endif
   namespace py = pybind11;
 
   // Note: the `register` functions here should be called in dependency
@@ -18,26 +27,44 @@ PYBIND11_MODULE(_openassetio, mod) {
   const py::module log = mod.def_submodule("log");
   const py::module constants = mod.def_submodule("constants");
   const py::module errors = mod.def_submodule("errors");
+  const py::module trace = mod.def_submodule("trace");
   const py::module trait = mod.def_submodule("trait");
 
   registerAccess(access);
   registerConstants(constants);
   registerLoggerInterface(log);
+  registerBufferedLogger(log);
   registerConsoleLogger(log);
+  registerJsonLinesLogger(log);
   registerSeverityFilter(log);
+  registerRateLimitFilter(log);
+  registerTracerInterface(trace);
+  registerRingBufferTracer(trace);
   registerTraitsData(trait);
   registerManagerStateBase(managerApi);
+  registerCancellationToken(mod);
   registerContext(mod);
   registerBatchElementError(errors);
   registerExceptions(errors);
   registerEntityReference(mod);
+  registerEntityReferenceBatch(mod);
+  registerEntityReferencesView(mod);
+  registerConditionalResolveResult(mod);
   registerHostInterface(hostApi);
   registerHost(managerApi);
   registerHostSession(managerApi);
   registerEntityReferencePagerInterface(managerApi);
   registerEntityReferencePager(hostApi);
+  registerEntityExistenceFilter(managerApi);
   registerManagerInterface(managerApi);
   registerManagerImplementationFactoryInterface(hostApi);
+  registerBatchResultStreams(hostApi);
+  registerResolveCache(hostApi);
+  registerManagerMetrics(hostApi);
+  registerApiAuditor(hostApi);
   registerManager(hostApi);
+  registerManagerTrafficReplayer(hostApi);
+  registerResolveCoalescer(hostApi);
+  registerPublishingSession(hostApi);
   registerManagerFactory(hostApi);
 }
@@ -11,6 +11,7 @@
 
 #include <openassetio/typedefs.hpp>
 
+#include "FlatStrMapCaster.hpp"
 #include "PyRetainingSharedPtr.hpp"
 
 OPENASSETIO_FWD_DECLARE(ManagerStateBase)
@@ -52,12 +53,30 @@ void registerConstants(const py::module& mod);
 /// Register the LoggerInterface class with Python.
 void registerLoggerInterface(const py::module& mod);
 
+/// Register the BufferedLogger class with Python.
+void registerBufferedLogger(const py::module& mod);
+
 /// Register the ConsoleLogger class with Python.
 void registerConsoleLogger(const py::module& mod);
 
+/// Register the JsonLinesLogger class with Python.
+void registerJsonLinesLogger(const py::module& mod);
+
+/// Register the RateLimitFilter class with Python.
+void registerRateLimitFilter(const py::module& mod);
+
 /// Register the SeverityFilter class with Python.
 void registerSeverityFilter(const py::module& mod);
 
+/// Register the TracerInterface class with Python.
+void registerTracerInterface(const py::module& mod);
+
+/// Register the RingBufferTracer class with Python.
+void registerRingBufferTracer(const py::module& mod);
+
+/// Register the CancellationToken class with Python.
+void registerCancellationToken(const py::module& mod);
+
 /// Register the Context class with Python.
 void registerContext(const py::module& mod);
 
@@ -70,6 +89,9 @@ void registerHost(const py::module& mod);
 /// Register the HostSession class with Python.
 void registerHostSession(const py::module& mod);
 
+/// Register the EntityExistenceFilter class with Python.
+void registerEntityExistenceFilter(const py::module& mod);
+
 /// Register the ManagerInterface class with Python.
 void registerManagerInterface(const py::module& mod);
 
@@ -91,12 +113,42 @@ void registerManagerStateBase(const py::module& mod);
 /// Register the EntityReference type with Python.
 void registerEntityReference(const py::module& mod);
 
+/// Register the EntityReferenceBatch type with Python.
+void registerEntityReferenceBatch(const py::module& mod);
+
+/// Register the EntityReferencesView type with Python.
+void registerEntityReferencesView(const py::module& mod);
+
+/// Register the ConditionalResolveResult type with Python.
+void registerConditionalResolveResult(const py::module& mod);
+
 /// Register the BatchElementError type with Python.
 void registerBatchElementError(const py::module& mod);
 
 // Register exceptions, including BatchElementExceptions.
 void registerExceptions(const py::module& mod);
 
+/// Register the BatchResultStream class template instances with Python.
+void registerBatchResultStreams(const py::module& mod);
+
+/// Register the ResolveCache class with Python.
+void registerResolveCache(const py::module& mod);
+
+/// Register the ManagerMetrics class with Python.
+void registerManagerMetrics(const py::module& mod);
+
+/// Register the ApiAuditor class with Python.
+void registerApiAuditor(const py::module& mod);
+
+/// Register the ManagerTrafficReplayer class with Python.
+void registerManagerTrafficReplayer(const py::module& mod);
+
+/// Register the ResolveCoalescer class with Python.
+void registerResolveCoalescer(const py::module& mod);
+
+/// Register the PublishingSession class with Python.
+void registerPublishingSession(const py::module& mod);
+
 /// Register the EntityReferencePager class with Python.
 void registerEntityReferencePager(const py::module& mod);
 
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Support for Python implementations of batch methods returning their
+ * results in bulk, rather than calling a callback per element.
+ */
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+#include "overrideCache.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python {
+
+/// Value type given to a batch success callback.
+template <class SuccessCallback>
+struct BatchSuccessValue;
+
+template <class Value>
+struct BatchSuccessValue<std::function<void(std::size_t, Value)>> {
+  using Type = Value;
+};
+
+/**
+ * Call the Python override of a batch method, then dispatch any
+ * results it returned in bulk.
+ *
+ * The Python override may report results by calling the callbacks, as
+ * usual, and/or by returning a `list` of `(index, result)` tuples,
+ * where `result` is either a BatchElementError, for the error
+ * callback, or a value for the success callback. Any other return
+ * value is ignored, as it is for non-batch overrides returning `void`.
+ *
+ * Returned results are converted to C++ whilst the GIL is held, and
+ * the callbacks are subsequently called, in order, with the GIL
+ * released. Hence, unlike calling the callbacks from Python, there is
+ * no per-element overhead of calling a bound function.
+ *
+ * @tparam kMethodIdx Index of the method in the trampoline's
+ * OverrideCache, if any, see overrideCacheIndex.
+ * @tparam Class Type registered with pybind11.
+ * @param self Trampoline instance whose override should be called.
+ * @param name Name of the Python method.
+ * @param successCallback Callback for successful elements.
+ * @param errorCallback Callback for failed elements.
+ * @param args Arguments to the Python override.
+ * @return `false` if there is no Python override, in which case the
+ * caller should fall back to the C++ implementation.
+ * @exception errors.InputValidationException If an element of the
+ * returned list is not as described.
+ */
+template <std::size_t kMethodIdx, class Class, class Trampoline, class SuccessCallback,
+          class ErrorCallback, class... Args>
+bool callBatchOverride(const Trampoline* self, const char* name,
+                       const SuccessCallback& successCallback, const ErrorCallback& errorCallback,
+                       Args&&... args) {
+  namespace py = pybind11;
+  using Value = typename BatchSuccessValue<SuccessCallback>::Type;
+  using Result = std::variant<Value, errors::BatchElementError>;
+
+  std::vector<std::pair<std::size_t, Result>> results;
+  {
+    const py::gil_scoped_acquire gil{};
+    const py::function override = getOverride<kMethodIdx, Class>(self, name);
+    if (!override) {
+      return false;
+    }
+    const py::object returned = override(std::forward<Args>(args)...);
+    if (!py::isinstance<py::list>(returned)) {
+      return true;
+    }
+
+    const auto returnedList = py::reinterpret_borrow<py::list>(returned);
+    results.reserve(returnedList.size());
+    try {
+      for (const py::handle item : returnedList) {
+        const auto pair = item.cast<py::tuple>();
+        if (pair.size() != 2) {
+          throw py::cast_error{};
+        }
+        const py::object value = pair[1];
+        if (py::isinstance<errors::BatchElementError>(value)) {
+          results.emplace_back(pair[0].cast<std::size_t>(),
+                               value.cast<errors::BatchElementError>());
+        } else {
+          results.emplace_back(pair[0].cast<std::size_t>(), value.cast<Value>());
+        }
+      }
+    } catch (const py::cast_error&) {
+      throw errors::InputValidationException{
+          std::string{"Results returned from '"} + name +
+          "' must be (index, result) tuples, where each result is a BatchElementError or a"
+          " valid success value."};
+    }
+  }
+
+  for (auto& [idx, result] : results) {
+    if (auto* error = std::get_if<errors::BatchElementError>(&result)) {
+      errorCallback(idx, std::move(*error));
+    } else {
+      successCallback(idx, std::move(std::get<Value>(result)));
+    }
+  }
+  return true;
+}
+}  // namespace python
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -12,6 +12,17 @@ void registerConstants(const py::module_ &mod) {
   mod.attr("kInfoKey_SmallIcon") = openassetio::constants::kInfoKey_SmallIcon;
   mod.attr("kInfoKey_EntityReferencesMatchPrefix") =
       openassetio::constants::kInfoKey_EntityReferencesMatchPrefix;
+  mod.attr("kInfoKey_EntityReferencesMatchPrefixes") =
+      openassetio::constants::kInfoKey_EntityReferencesMatchPrefixes;
+  mod.attr("kInfoKey_EntityReferencesMatchPattern") =
+      openassetio::constants::kInfoKey_EntityReferencesMatchPattern;
+  mod.attr("kInfoKey_IsManagementPolicyContextSensitive") =
+      openassetio::constants::kInfoKey_IsManagementPolicyContextSensitive;
+  mod.attr("kInfoKey_IsResolveCached") = openassetio::constants::kInfoKey_IsResolveCached;
+  mod.attr("kInfoKey_ResolveCacheToken") = openassetio::constants::kInfoKey_ResolveCacheToken;
+  mod.attr("kInfoKey_IsThreadSafe") = openassetio::constants::kInfoKey_IsThreadSafe;
+  mod.attr("kInfoKey_ThreadSafeMethods") = openassetio::constants::kInfoKey_ThreadSafeMethods;
+  mod.attr("kInfoKey_MaxBatchSize") = openassetio::constants::kInfoKey_MaxBatchSize;
   // TODO(DF): @deprecated
   mod.attr("kField_Icon") = openassetio::constants::kInfoKey_Icon;
   mod.attr("kField_SmallIcon") = openassetio::constants::kInfoKey_SmallIcon;
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/stl.h>
+
+#include <openassetio/hostApi/ApiAuditor.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerApiAuditor(const py::module& mod) {
+  using openassetio::hostApi::ApiAuditor;
+  using openassetio::hostApi::ApiAuditorPtr;
+  using Api = ApiAuditor::Api;
+  using Method = ApiAuditor::Method;
+
+  py::class_<ApiAuditor, ApiAuditorPtr> pyApiAuditor{mod, "ApiAuditor", py::is_final()};
+
+  py::enum_<Api>{pyApiAuditor, "Api"}
+      .value("kManager", Api::kManager)
+      .value("kManagerInterface", Api::kManagerInterface);
+
+  py::enum_<Method>{pyApiAuditor, "Method"}
+      .value("kAreEntityReferenceStrings", Method::kAreEntityReferenceStrings)
+      .value("kContextFromPersistenceToken", Method::kContextFromPersistenceToken)
+      .value("kContextsFromPersistenceTokens", Method::kContextsFromPersistenceTokens)
+      .value("kCreateChildContext", Method::kCreateChildContext)
+      .value("kCreateChildState", Method::kCreateChildState)
+      .value("kCreateContext", Method::kCreateContext)
+      .value("kCreateEntityReference", Method::kCreateEntityReference)
+      .value("kCreateEntityReferenceIfValid", Method::kCreateEntityReferenceIfValid)
+      .value("kCreateState", Method::kCreateState)
+      .value("kDefaultEntityReference", Method::kDefaultEntityReference)
+      .value("kDisplayName", Method::kDisplayName)
+      .value("kEntityExistenceFilter", Method::kEntityExistenceFilter)
+      .value("kEntityExists", Method::kEntityExists)
+      .value("kEntityExistsAsync", Method::kEntityExistsAsync)
+      .value("kEntityTraits", Method::kEntityTraits)
+      .value("kEntityTraitsAsync", Method::kEntityTraitsAsync)
+      .value("kEntityTraitsStream", Method::kEntityTraitsStream)
+      .value("kFlushCaches", Method::kFlushCaches)
+      .value("kFlushCachesWithPrefix", Method::kFlushCachesWithPrefix)
+      .value("kFlushEntityCaches", Method::kFlushEntityCaches)
+      .value("kGetWithRelationship", Method::kGetWithRelationship)
+      .value("kGetWithRelationships", Method::kGetWithRelationships)
+      .value("kGetWithRelationshipsMatrix", Method::kGetWithRelationshipsMatrix)
+      .value("kHasCapability", Method::kHasCapability)
+      .value("kIdentifier", Method::kIdentifier)
+      .value("kInfo", Method::kInfo)
+      .value("kInitialize", Method::kInitialize)
+      .value("kInitializeAsync", Method::kInitializeAsync)
+      .value("kIsEntityReferenceString", Method::kIsEntityReferenceString)
+      .value("kManagementPolicy", Method::kManagementPolicy)
+      .value("kPersistenceTokenForContext", Method::kPersistenceTokenForContext)
+      .value("kPersistenceTokenForState", Method::kPersistenceTokenForState)
+      .value("kPrefetch", Method::kPrefetch)
+      .value("kPreflight", Method::kPreflight)
+      .value("kPreflightAsync", Method::kPreflightAsync)
+      .value("kRegister", Method::kRegister)
+      .value("kRegisterAsync", Method::kRegisterAsync)
+      .value("kResetState", Method::kResetState)
+      .value("kResolve", Method::kResolve)
+      .value("kResolveAsync", Method::kResolveAsync)
+      .value("kResolveColumnar", Method::kResolveColumnar)
+      .value("kResolveHeterogeneous", Method::kResolveHeterogeneous)
+      .value("kResolveIfChanged", Method::kResolveIfChanged)
+      .value("kResolveProjected", Method::kResolveProjected)
+      .value("kResolveStream", Method::kResolveStream)
+      .value("kSettings", Method::kSettings)
+      .value("kStateFromPersistenceToken", Method::kStateFromPersistenceToken)
+      .value("kTraverseRelationships", Method::kTraverseRelationships)
+      .value("kUpdateTerminology", Method::kUpdateTerminology);
+
+  pyApiAuditor
+      .def_static("instance", &ApiAuditor::instance)
+      .def_readonly_static("kApiNames", &ApiAuditor::kApiNames)
+      .def_readonly_static("kMethodNames", &ApiAuditor::kMethodNames)
+      .def("isEnabled", &ApiAuditor::isEnabled)
+      .def("setEnabled", &ApiAuditor::setEnabled, py::arg("enabled"))
+      .def("recordCall", &ApiAuditor::recordCall, py::arg("api"), py::arg("method"))
+      .def("callCount", &ApiAuditor::callCount, py::arg("api"), py::arg("method"))
+      .def("coverage", &ApiAuditor::coverage)
+      .def("reset", &ApiAuditor::reset);
+}
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/stl.h>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/hostApi/BatchResultStream.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+
+#include "../_openassetio.hpp"
+
+namespace {
+template <class T>
+void registerBatchResultStream(const py::module& mod, const char* name) {
+  using Stream = openassetio::hostApi::BatchResultStream<T>;
+
+  py::class_<Stream>{mod, name}
+      .def("__iter__", [](Stream& self) -> Stream& { return self; })
+      .def("__next__",
+           [](Stream& self) {
+             std::optional<typename Stream::Element> element;
+             {
+               const py::gil_scoped_release release{};
+               element = self.next();
+             }
+             if (!element) {
+               throw py::stop_iteration{};
+             }
+             return std::move(*element);
+           })
+      .def_readonly_static("kDefaultBufferSize", &Stream::kDefaultBufferSize);
+}
+}  // namespace
+
+void registerBatchResultStreams(const py::module& mod) {
+  registerBatchResultStream<openassetio::trait::TraitsDataPtr>(mod, "ResolveResultStream");
+  registerBatchResultStream<openassetio::trait::TraitSet>(mod, "EntityTraitsResultStream");
+  registerBatchResultStream<openassetio::EntityReference>(mod, "EntityReferenceResultStream");
+}
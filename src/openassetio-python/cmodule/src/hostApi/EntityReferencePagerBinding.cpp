@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #include <algorithm>
+#include <cstddef>
+#include <limits>
 
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
@@ -21,8 +23,13 @@ void registerEntityReferencePager(const py::module& mod) {
   py::class_<EntityReferencePager, EntityReferencePagerPtr>{mod, "EntityReferencePager"}
       .def(py::init(RetainCommonPyArgs::forFn<&EntityReferencePager::make>()),
            py::arg("entityReferencePagerInterface").none(false),
-           py::arg("hostSession").none(false))
+           py::arg("hostSession").none(false), py::arg("prefetchDepth") = 0)
       .def("hasNext", &EntityReferencePager::hasNext, py::call_guard<py::gil_scoped_release>{})
-      .def("get", &EntityReferencePager::get, py::call_guard<py::gil_scoped_release>{})
-      .def("next", &EntityReferencePager::next, py::call_guard<py::gil_scoped_release>{});
+      .def("get", py::overload_cast<>(&EntityReferencePager::get),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("next", &EntityReferencePager::next, py::call_guard<py::gil_scoped_release>{})
+      .def("sizeHint", &EntityReferencePager::sizeHint, py::call_guard<py::gil_scoped_release>{})
+      .def("drainAll", &EntityReferencePager::drainAll,
+           py::arg("maxItems") = std::numeric_limits<std::size_t>::max(),
+           py::call_guard<py::gil_scoped_release>{});
 }
@@ -1,5 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+
+#include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/InfoDictionary.hpp>
@@ -31,6 +35,14 @@ struct PyHostInterface : HostInterface {
   [[nodiscard]] InfoDictionary info() override {
     OPENASSETIO_PYBIND11_OVERRIDE(InfoDictionary, HostInterface, info, /* no args */);
   }
+
+  void submit(Task task) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(void, HostInterface, submit, std::move(task));
+  }
+
+  void parallelFor(const std::size_t count, const ParallelForBody& body) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(void, HostInterface, parallelFor, count, body);
+  }
 };
 
 }  // namespace hostApi
@@ -46,5 +58,9 @@ void registerHostInterface(const py::module& mod) {
       .def(py::init())
       .def("identifier", &HostInterface::identifier, py::call_guard<py::gil_scoped_release>{})
       .def("displayName", &HostInterface::displayName, py::call_guard<py::gil_scoped_release>{})
-      .def("info", &HostInterface::info, py::call_guard<py::gil_scoped_release>{});
+      .def("info", &HostInterface::info, py::call_guard<py::gil_scoped_release>{})
+      .def("submit", &HostInterface::submit, py::arg("task").none(false),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("parallelFor", &HostInterface::parallelFor, py::arg("count"),
+           py::arg("body").none(false), py::call_guard<py::gil_scoped_release>{});
 }
@@ -1,14 +1,23 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
 #include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/Context.hpp>
+#include <openassetio/EntityReferenceBatch.hpp>
 #include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerMetrics.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/trait/TraitsData.hpp>
@@ -30,6 +39,81 @@ void validateTraitsDatas(const TraitsDatas& traitsDatas) {
     throw openassetio::errors::InputValidationException{"Traits data cannot be None"};
   }
 }
+
+/**
+ * Start an asynchronous batch operation, returning an `asyncio.Future`
+ * that is fulfilled with its results.
+ *
+ * Must be called from a thread running an asyncio event loop. The
+ * operation is started with the GIL released, and its per-element
+ * results gathered without the GIL. Once the batch is complete, the
+ * future is resolved on the event loop's thread via a single
+ * `call_soon_threadsafe`, with a list of results or
+ * `BatchElementError`s, in the same order as the input, or the
+ * exception that failed the whole batch. Results are discarded if the
+ * future has been cancelled.
+ *
+ * @tparam Value Type of a successful per-element result.
+ * @param batchSize Number of elements in the batch.
+ * @param start Callable that starts the operation, given success,
+ * error and completion callbacks.
+ * @return The future.
+ */
+template <class Value, class Start>
+py::object startWithAsyncioFuture(const std::size_t batchSize, const Start& start) {
+  using Results = std::vector<std::variant<openassetio::errors::BatchElementError, Value>>;
+
+  // Python objects are only touched with the GIL held, and are moved
+  // out on completion, so that the state can be safely released by
+  // whichever thread drops the last reference.
+  struct State {
+    Results results;
+    py::object loop;
+    py::object future;
+  };
+  auto state = std::make_shared<State>();
+  state->results.resize(batchSize);
+  state->loop = py::module_::import("asyncio").attr("get_running_loop")();
+  state->future = state->loop.attr("create_future")();
+  py::object future = state->future;
+
+  const py::gil_scoped_release release{};
+  start(
+      [state](const std::size_t idx, Value value) { state->results[idx] = std::move(value); },
+      [state](const std::size_t idx, openassetio::errors::BatchElementError error) {
+        state->results[idx] = std::move(error);
+      },
+      [state](std::exception_ptr exception) {
+        const py::gil_scoped_acquire acquire{};
+        const py::object loop = std::move(state->loop);
+        py::cpp_function settle{[future = std::move(state->future),
+                                 results = std::move(state->results),
+                                 exception = std::move(exception)]() mutable {
+          if (future.attr("done")().cast<bool>()) {
+            return;
+          }
+          if (!exception) {
+            future.attr("set_result")(std::move(results));
+            return;
+          }
+          // Route the exception through pybind11's exception
+          // translators, to get the equivalent Python exception.
+          const py::cpp_function rethrow{[&exception] { std::rethrow_exception(exception); }};
+          try {
+            rethrow();
+          } catch (py::error_already_set& error) {
+            future.attr("set_exception")(error.value());
+          }
+        }};
+        try {
+          loop.attr("call_soon_threadsafe")(std::move(settle));
+        } catch (py::error_already_set& error) {
+          // E.g. the event loop has since been closed.
+          error.discard_as_unraisable("resolving an asyncio future for a Manager operation");
+        }
+      });
+  return future;
+}
 }  // namespace
 
 void registerManager(const py::module& mod) {
@@ -37,10 +121,14 @@ void registerManager(const py::module& mod) {
   namespace trait = openassetio::trait;
   using openassetio::ContextConstPtr;
   using openassetio::EntityReference;
+  using openassetio::EntityReferenceBatch;
   using openassetio::EntityReferences;
   using openassetio::errors::BatchElementError;
+  using openassetio::hostApi::BatchResultStream;
   using openassetio::hostApi::Manager;
+  using openassetio::hostApi::ManagerMetricsPtr;
   using openassetio::hostApi::ManagerPtr;
+  using openassetio::hostApi::ResolveCachePtr;
   using openassetio::managerApi::HostSessionPtr;
   using openassetio::managerApi::ManagerInterfacePtr;
   using openassetio::trait::TraitsDataPtr;
@@ -62,6 +150,17 @@ void registerManager(const py::module& mod) {
       .def_readonly_static("kException", &Manager::BatchElementErrorPolicyTag::kException)
       .def_readonly_static("kVariant", &Manager::BatchElementErrorPolicyTag::kVariant);
 
+  py::class_<Manager::MemoryUsage>{pyManager, "MemoryUsage"}
+      .def_readonly("resolveCache", &Manager::MemoryUsage::resolveCache)
+      .def_readonly("managementPolicyCache", &Manager::MemoryUsage::managementPolicyCache)
+      .def_readonly("entityReferenceStringCache",
+                    &Manager::MemoryUsage::entityReferenceStringCache)
+      .def_readonly("persistenceTokenCache", &Manager::MemoryUsage::persistenceTokenCache)
+      .def_readonly("entityTraitsCache", &Manager::MemoryUsage::entityTraitsCache)
+      .def_readonly("defaultEntityReferenceCache",
+                    &Manager::MemoryUsage::defaultEntityReferenceCache)
+      .def_readonly("total", &Manager::MemoryUsage::total);
+
   py::enum_<Manager::Capability>{pyManager, "Capability"}
       .value("kStatefulContexts", Manager::Capability::kStatefulContexts)
       .value("kCustomTerminology", Manager::Capability::kCustomTerminology)
@@ -71,16 +170,81 @@ void registerManager(const py::module& mod) {
       .value("kExistenceQueries", Manager::Capability::kExistenceQueries)
       .value("kDefaultEntityReferences", Manager::Capability::kDefaultEntityReferences);
 
+  py::class_<Manager::Options>{pyManager, "Options"}
+      .def(py::init([](ResolveCachePtr resolveCache, std::size_t resolveChunkSize,
+                       std::size_t entityReferenceStringCacheCapacity,
+                       bool deduplicateEntityReferences, std::size_t pagerPrefetchDepth,
+                       std::size_t managerStatePoolCapacity,
+                       std::size_t persistenceTokenCacheCapacity, ManagerMetricsPtr metrics,
+                       std::size_t backgroundChunkSize, std::size_t entityTraitsCacheCapacity,
+                       std::size_t defaultEntityReferenceCacheCapacity) {
+             Manager::Options options;
+             options.resolveCache = std::move(resolveCache);
+             options.resolveChunkSize = resolveChunkSize;
+             options.entityReferenceStringCacheCapacity = entityReferenceStringCacheCapacity;
+             options.deduplicateEntityReferences = deduplicateEntityReferences;
+             options.pagerPrefetchDepth = pagerPrefetchDepth;
+             options.managerStatePoolCapacity = managerStatePoolCapacity;
+             options.persistenceTokenCacheCapacity = persistenceTokenCacheCapacity;
+             options.metrics = std::move(metrics);
+             options.backgroundChunkSize = backgroundChunkSize;
+             options.entityTraitsCacheCapacity = entityTraitsCacheCapacity;
+             options.defaultEntityReferenceCacheCapacity = defaultEntityReferenceCacheCapacity;
+             return options;
+           }),
+           py::arg("resolveCache") = nullptr, py::arg("resolveChunkSize") = 0,
+           py::arg("entityReferenceStringCacheCapacity") = 0,
+           py::arg("deduplicateEntityReferences") = false, py::arg("pagerPrefetchDepth") = 0,
+           py::arg("managerStatePoolCapacity") = 0, py::arg("persistenceTokenCacheCapacity") = 0,
+           py::arg("metrics") = nullptr, py::arg("backgroundChunkSize") = 0,
+           py::arg("entityTraitsCacheCapacity") = 0,
+           py::arg("defaultEntityReferenceCacheCapacity") = 0)
+      .def_readwrite("resolveCache", &Manager::Options::resolveCache)
+      .def_readwrite("resolveChunkSize", &Manager::Options::resolveChunkSize)
+      .def_readwrite("entityReferenceStringCacheCapacity",
+                     &Manager::Options::entityReferenceStringCacheCapacity)
+      .def_readwrite("deduplicateEntityReferences",
+                     &Manager::Options::deduplicateEntityReferences)
+      .def_readwrite("pagerPrefetchDepth", &Manager::Options::pagerPrefetchDepth)
+      .def_readwrite("managerStatePoolCapacity", &Manager::Options::managerStatePoolCapacity)
+      .def_readwrite("persistenceTokenCacheCapacity",
+                     &Manager::Options::persistenceTokenCacheCapacity)
+      .def_readwrite("metrics", &Manager::Options::metrics)
+      .def_readwrite("backgroundChunkSize", &Manager::Options::backgroundChunkSize)
+      .def_readwrite("entityTraitsCacheCapacity", &Manager::Options::entityTraitsCacheCapacity)
+      .def_readwrite("defaultEntityReferenceCacheCapacity",
+                     &Manager::Options::defaultEntityReferenceCacheCapacity);
+
   pyManager
-      .def(py::init(RetainCommonPyArgs::forFn<&Manager::make>()),
-           py::arg("managerInterface").none(false), py::arg("hostSession").none(false))
+      .def(py::init(RetainCommonPyArgs::forFn<
+                    static_cast<ManagerPtr (*)(ManagerInterfacePtr, HostSessionPtr,
+                                               Manager::Options)>(&Manager::make)>()),
+           py::arg("managerInterface").none(false), py::arg("hostSession").none(false),
+           py::arg("options") = Manager::Options{})
       .def("identifier", &Manager::identifier, py::call_guard<py::gil_scoped_release>{})
       .def("displayName", &Manager::displayName, py::call_guard<py::gil_scoped_release>{})
       .def("info", &Manager::info, py::call_guard<py::gil_scoped_release>{})
       .def("settings", &Manager::settings, py::call_guard<py::gil_scoped_release>{})
       .def("initialize", &Manager::initialize, py::arg("managerSettings"),
            py::call_guard<py::gil_scoped_release>{})
-      .def("flushCaches", &Manager::flushCaches, py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "initializeAsync",
+          [](Manager& self, openassetio::InfoDictionary managerSettings) {
+            // Futures are not exposed to Python, so readiness must be
+            // awaited via waitForInitialization.
+            static_cast<void>(self.initializeAsync(std::move(managerSettings)));
+          },
+          py::arg("managerSettings"), py::call_guard<py::gil_scoped_release>{})
+      .def("waitForInitialization", &Manager::waitForInitialization,
+           py::call_guard<py::gil_scoped_release>{})
+      .def("flushCaches", py::overload_cast<>(&Manager::flushCaches),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("flushCaches", py::overload_cast<const EntityReferences&>(&Manager::flushCaches),
+           py::arg("entityReferences"), py::call_guard<py::gil_scoped_release>{})
+      .def("flushCachesWithPrefix", &Manager::flushCachesWithPrefix, py::arg("prefix"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("statistics", &Manager::statistics, py::call_guard<py::gil_scoped_release>{})
+      .def("memoryUsage", &Manager::memoryUsage, py::call_guard<py::gil_scoped_release>{})
       .def("managementPolicy", &Manager::managementPolicy, py::arg("traitSets"),
            py::arg("policyAccess"), py::arg("context").none(false),
            py::call_guard<py::gil_scoped_release>{})
@@ -91,19 +255,62 @@ void registerManager(const py::module& mod) {
            py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
       .def("contextFromPersistenceToken", &Manager::contextFromPersistenceToken, py::arg("token"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("contextsFromPersistenceTokens", &Manager::contextsFromPersistenceTokens,
+           py::arg("tokens"), py::call_guard<py::gil_scoped_release>{})
       .def("isEntityReferenceString", &Manager::isEntityReferenceString, py::arg("someString"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("areEntityReferenceStrings", &Manager::areEntityReferenceStrings,
+           py::arg("someStrings"), py::call_guard<py::gil_scoped_release>{})
       .def("createEntityReference", &Manager::createEntityReference,
            py::arg("entityReferenceString"), py::call_guard<py::gil_scoped_release>{})
       .def("createEntityReferenceIfValid", &Manager::createEntityReferenceIfValid,
            py::arg("entityReferenceString"), py::call_guard<py::gil_scoped_release>{})
-      .def("entityExists", &Manager::entityExists, py::arg("entityReferences"),
-           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
+      .def("entityExists",
+           py::overload_cast<const EntityReferences&, const ContextConstPtr&,
+                             const Manager::ExistsSuccessCallback&,
+                             const Manager::BatchElementErrorCallback&>(&Manager::entityExists),
+           py::arg("entityReferences"), py::arg("context").none(false),
+           py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("entityExists",
+           py::overload_cast<const EntityReferenceBatch&, const ContextConstPtr&,
+                             const Manager::ExistsSuccessCallback&,
+                             const Manager::BatchElementErrorCallback&>(&Manager::entityExists),
+           py::arg("entityReferences"), py::arg("context").none(false),
+           py::arg("successCallback"), py::arg("errorCallback"),
            py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "entityExistsAsync",
+          [](const ManagerPtr& self, const EntityReferences& entityReferences,
+             const ContextConstPtr& context) {
+            return startWithAsyncioFuture<bool>(
+                entityReferences.size(), [&](auto success, auto error, auto completion) {
+                  self->entityExistsAsync(entityReferences, context, std::move(success),
+                                          std::move(error), std::move(completion));
+                });
+          },
+          py::arg("entityReferences"), py::arg("context").none(false))
       .def("entityTraits", &Manager::entityTraits, py::arg("entityReferences"),
            py::arg("entityTraitsAccess"), py::arg("context").none(false),
            py::arg("successCallback"), py::arg("errorCallback"),
            py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "entityTraitsAsync",
+          [](const ManagerPtr& self, const EntityReferences& entityReferences,
+             const access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context) {
+            return startWithAsyncioFuture<trait::TraitSet>(
+                entityReferences.size(), [&](auto success, auto error, auto completion) {
+                  self->entityTraitsAsync(entityReferences, entityTraitsAccess, context,
+                                          std::move(success), std::move(error),
+                                          std::move(completion));
+                });
+          },
+          py::arg("entityReferences"), py::arg("entityTraitsAccess"),
+          py::arg("context").none(false))
+      .def("entityTraitsStream", &Manager::entityTraitsStream, py::arg("entityReferences"),
+           py::arg("entityTraitsAccess"), py::arg("context").none(false),
+           py::arg("bufferSize") = BatchResultStream<trait::TraitSet>::kDefaultBufferSize,
+           py::call_guard<py::gil_scoped_release>{})
       .def("hasCapability", &Manager::hasCapability, py::arg("capability"),
            py::call_guard<py::gil_scoped_release>{})
       .def("updateTerminology", &Manager::updateTerminology, py::arg("terms"),
@@ -116,6 +323,14 @@ void registerManager(const py::module& mod) {
           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
           py::call_guard<py::gil_scoped_release>{})
+      .def("resolve",
+           py::overload_cast<const EntityReferenceBatch&, const trait::TraitSet&,
+                             access::ResolveAccess, const ContextConstPtr&,
+                             const Manager::ResolveSuccessCallback&,
+                             const Manager::BatchElementErrorCallback&>(&Manager::resolve),
+           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("successCallback"),
+           py::arg("errorCallback"), py::call_guard<py::gil_scoped_release>{})
       .def("resolve",
            py::overload_cast<const EntityReference&, const trait::TraitSet&, access::ResolveAccess,
                              const ContextConstPtr&,
@@ -176,10 +391,50 @@ void registerManager(const py::module& mod) {
           },
           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
           py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def("resolveHeterogeneous", &Manager::resolveHeterogeneous, py::arg("entityReferences"),
+           py::arg("traitSets"), py::arg("traitSetIndices"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("resolveProjected", &Manager::resolveProjected, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("propertyProjection"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("resolveIfChanged", &Manager::resolveIfChanged, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("resolveAccess"), py::arg("generationTokens"),
+           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "resolveAsync",
+          [](const ManagerPtr& self, const EntityReferences& entityReferences,
+             const trait::TraitSet& traitSet, const access::ResolveAccess resolveAccess,
+             const ContextConstPtr& context) {
+            return startWithAsyncioFuture<TraitsDataPtr>(
+                entityReferences.size(), [&](auto success, auto error, auto completion) {
+                  self->resolveAsync(entityReferences, traitSet, resolveAccess, context,
+                                     std::move(success), std::move(error),
+                                     std::move(completion));
+                });
+          },
+          py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
+          py::arg("context").none(false))
+      .def("resolveStream", &Manager::resolveStream, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("resolveAccess"), py::arg("context").none(false),
+           py::arg("bufferSize") = BatchResultStream<trait::TraitsDataPtr>::kDefaultBufferSize,
+           py::call_guard<py::gil_scoped_release>{})
       .def("defaultEntityReference", &Manager::defaultEntityReference, py::arg("traitSets"),
            py::arg("defaultEntityAccess"), py::arg("context").none(false),
            py::arg("successCallback"), py::arg("errorCallback"),
            py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "prefetch",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitSet& traitSet, const ContextConstPtr& context) {
+            // Futures are not exposed to Python, so prefetches are
+            // fire-and-forget.
+            static_cast<void>(self.prefetch(entityReferences, traitSet, context));
+          },
+          py::arg("entityReferences"), py::arg("traitSet"), py::arg("context").none(false),
+          py::call_guard<py::gil_scoped_release>{})
       .def("getWithRelationship", &Manager::getWithRelationship, py::arg("entityReferences"),
            py::arg("relationshipTraitsData").none(false), py::arg("pageSize"),
            py::arg("relationsAccess"), py::arg("context").none(false), py::arg("successCallback"),
@@ -202,6 +457,55 @@ void registerManager(const py::module& mod) {
           py::arg("relationsAccess"), py::arg("context").none(false), py::arg("successCallback"),
           py::arg("errorCallback"), py::arg("resultTraitSet") = trait::TraitSet{},
           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "getWithRelationshipsMatrix",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitsDatas& relationshipTraitsDatas, size_t pageSize,
+             const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+             const Manager::RelationshipQuerySuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback,
+             const trait::TraitSet& resultTraitSet) {
+            validateTraitsDatas(relationshipTraitsDatas);
+            self.getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas, pageSize,
+                                            relationsAccess, context, successCallback,
+                                            errorCallback, resultTraitSet);
+          },
+          py::arg("entityReferences"), py::arg("relationshipTraitsDatas"), py::arg("pageSize"),
+          py::arg("relationsAccess"), py::arg("context").none(false), py::arg("successCallback"),
+          py::arg("errorCallback"), py::arg("resultTraitSet") = trait::TraitSet{},
+          py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "traverseRelationships",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitsDatas& relationshipTraitsDatas, std::size_t maxDepth,
+             const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+             const Manager::RelationshipTraversalSuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback,
+             const trait::TraitSet& resultTraitSet) {
+            validateTraitsDatas(relationshipTraitsDatas);
+            self.traverseRelationships(entityReferences, relationshipTraitsDatas, maxDepth,
+                                       relationsAccess, context, successCallback, errorCallback,
+                                       resultTraitSet);
+          },
+          py::arg("entityReferences"), py::arg("relationshipTraitsDatas"), py::arg("maxDepth"),
+          py::arg("relationsAccess"), py::arg("context").none(false), py::arg("successCallback"),
+          py::arg("errorCallback"), py::arg("resultTraitSet") = trait::TraitSet{},
+          py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "preflightAsync",
+          [](const ManagerPtr& self, const EntityReferences& entityReferences,
+             const trait::TraitsDatas& traitsHints,
+             const access::PublishingAccess publishingAccess, const ContextConstPtr& context) {
+            validateTraitsDatas(traitsHints);
+            return startWithAsyncioFuture<EntityReference>(
+                entityReferences.size(), [&](auto success, auto error, auto completion) {
+                  self->preflightAsync(entityReferences, traitsHints, publishingAccess, context,
+                                       std::move(success), std::move(error),
+                                       std::move(completion));
+                });
+          },
+          py::arg("entityReferences"), py::arg("traitsHints"), py::arg("publishAccess"),
+          py::arg("context").none(false))
       .def(
           "preflight",
           [](Manager& self, const EntityReferences& entityReferences,
@@ -275,6 +579,21 @@ void registerManager(const py::module& mod) {
           },
           py::arg("entityReferences"), py::arg("traitsHints"), py::arg("publishAccess"),
           py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "registerAsync",
+          [](const ManagerPtr& self, const EntityReferences& entityReferences,
+             const TraitsDatas& entityTraitsDatas, const access::PublishingAccess publishingAccess,
+             const ContextConstPtr& context) {
+            validateTraitsDatas(entityTraitsDatas);
+            return startWithAsyncioFuture<EntityReference>(
+                entityReferences.size(), [&](auto success, auto error, auto completion) {
+                  self->registerAsync(entityReferences, entityTraitsDatas, publishingAccess,
+                                      context, std::move(success), std::move(error),
+                                      std::move(completion));
+                });
+          },
+          py::arg("entityReferences"), py::arg("entityTraitsDatas"), py::arg("publishAccess"),
+          py::arg("context").none(false))
       .def(
           "register",
           [](Manager& self, const EntityReferences& entityReferences,
@@ -1,5 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <optional>
+
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
@@ -7,22 +10,27 @@
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 
 #include "../_openassetio.hpp"
 
 void registerManagerFactory(const py::module& mod) {
   using openassetio::hostApi::HostInterfacePtr;
+  using openassetio::hostApi::Manager;
   using openassetio::hostApi::ManagerFactory;
   using openassetio::hostApi::ManagerFactoryPtr;
   using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
   using openassetio::hostApi::ManagerPtr;
+  using openassetio::hostApi::ResolveCache;
   using openassetio::log::LoggerInterfacePtr;
 
   // TODO(DF): `py::final()` once ManagerFactory is fully C++.
   py::class_<ManagerFactory, ManagerFactoryPtr> managerFactory(mod, "ManagerFactory");
   managerFactory
-      .def(py::init(RetainCommonPyArgs::forFn<&ManagerFactory::make>()),
+      .def(py::init(RetainCommonPyArgs::forFn<static_cast<ManagerFactoryPtr (*)(
+                        HostInterfacePtr, ManagerImplementationFactoryInterfacePtr,
+                        LoggerInterfacePtr)>(&ManagerFactory::make)>()),
            py::arg("hostInterface").none(false),
            py::arg("managerImplementationFactory").none(false), py::arg("logger").none(false))
       .def("identifiers", &ManagerFactory::identifiers, py::call_guard<py::gil_scoped_release>{});
@@ -35,18 +43,36 @@ void registerManagerFactory(const py::module& mod) {
       .def_readwrite("info", &ManagerFactory::ManagerDetail::info)
       .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
 
+  py::class_<ManagerFactory::ResolveCacheConfig>(managerFactory, "ResolveCacheConfig")
+      .def(py::init<std::size_t, std::optional<ResolveCache::SharedTier>>(), py::arg("capacity"),
+           py::arg("sharedTier") = std::nullopt)
+      .def_readwrite("capacity", &ManagerFactory::ResolveCacheConfig::capacity)
+      .def_readwrite("sharedTier", &ManagerFactory::ResolveCacheConfig::sharedTier)
+      .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
+
+  py::class_<ManagerFactory::DefaultManagerConfig>(managerFactory, "DefaultManagerConfig")
+      .def(py::init<openassetio::Identifier, openassetio::InfoDictionary,
+                    std::optional<ManagerFactory::ResolveCacheConfig>>(),
+           py::arg("identifier"), py::arg("settings"), py::arg("resolveCache") = std::nullopt)
+      .def_readwrite("identifier", &ManagerFactory::DefaultManagerConfig::identifier)
+      .def_readwrite("settings", &ManagerFactory::DefaultManagerConfig::settings)
+      .def_readwrite("resolveCache", &ManagerFactory::DefaultManagerConfig::resolveCache)
+      .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
+
   managerFactory
       .def("availableManagers", &ManagerFactory::availableManagers,
            py::call_guard<py::gil_scoped_release>{})
       .def_readonly_static("kDefaultManagerConfigEnvVarName",
                            &ManagerFactory::kDefaultManagerConfigEnvVarName)
       .def("createManager", &ManagerFactory::createManager, py::arg("identifier"),
+           py::arg("managerOptions") = Manager::Options{},
            py::call_guard<py::gil_scoped_release>{})
       .def_static("createManagerForInterface",
                   RetainCommonPyArgs::forFn<&ManagerFactory::createManagerForInterface>(),
                   py::arg("identifier"), py::arg("hostInterface").none(false),
                   py::arg("managerImplementationFactory").none(false),
-                  py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{})
+                  py::arg("logger").none(false), py::arg("managerOptions") = Manager::Options{},
+                  py::call_guard<py::gil_scoped_release>{})
       .def_static("defaultManagerForInterface",
                   RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
                       std::string_view, const HostInterfacePtr&,
@@ -55,11 +81,29 @@ void registerManagerFactory(const py::module& mod) {
                   py::arg("configPath"), py::arg("hostInterface").none(false),
                   py::arg("managerImplementationFactory").none(false),
                   py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def_static("defaultManagerForInterface",
+                  RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
+                      const ManagerFactory::DefaultManagerConfig&, const HostInterfacePtr&,
+                      const ManagerImplementationFactoryInterfacePtr&, const LoggerInterfacePtr&,
+                      Manager::Options)>(&ManagerFactory::defaultManagerForInterface)>(),
+                  py::arg("config"), py::arg("hostInterface").none(false),
+                  py::arg("managerImplementationFactory").none(false),
+                  py::arg("logger").none(false), py::arg("managerOptions") = Manager::Options{},
+                  py::call_guard<py::gil_scoped_release>{})
       .def_static("defaultManagerForInterface",
                   RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
                       const HostInterfacePtr&, const ManagerImplementationFactoryInterfacePtr&,
                       const LoggerInterfacePtr&)>(&ManagerFactory::defaultManagerForInterface)>(),
                   py::arg("hostInterface").none(false),
                   py::arg("managerImplementationFactory").none(false),
+                  py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def_static("loadDefaultManagerConfig", &ManagerFactory::loadDefaultManagerConfig,
+                  py::arg("configPath"), py::call_guard<py::gil_scoped_release>{})
+      .def("sharedManager", &ManagerFactory::sharedManager, py::arg("config"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def_static("sharedManagerForInterface",
+                  RetainCommonPyArgs::forFn<&ManagerFactory::sharedManagerForInterface>(),
+                  py::arg("config"), py::arg("hostInterface").none(false),
+                  py::arg("managerImplementationFactory").none(false),
                   py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{});
 }
@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <optional>
+
 #include <pybind11/stl.h>
 
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
@@ -35,6 +37,11 @@ struct PyManagerImplementationFactoryInterface : ManagerImplementationFactoryInt
                                        identifier);
   }
 
+  [[nodiscard]] std::optional<ManagerDetail> details(const Identifier& identifier) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(std::optional<ManagerDetail>,
+                                  ManagerImplementationFactoryInterface, details, identifier);
+  }
+
   using ManagerImplementationFactoryInterface::logger_;
 };
 
@@ -57,5 +64,7 @@ void registerManagerImplementationFactoryInterface(const py::module& mod) {
            py::call_guard<py::gil_scoped_release>{})
       .def("instantiate", &ManagerImplementationFactoryInterface::instantiate,
            py::arg("identifier"), py::call_guard<py::gil_scoped_release>{})
+      .def("details", &ManagerImplementationFactoryInterface::details, py::arg("identifier"),
+           py::call_guard<py::gil_scoped_release>{})
       .def_readonly("_logger", &PyManagerImplementationFactoryInterface::logger_);
 }
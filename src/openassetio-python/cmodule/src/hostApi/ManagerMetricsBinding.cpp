@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+#include <pybind11/chrono.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/ManagerMetrics.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerManagerMetrics(const py::module& mod) {
+  using openassetio::errors::BatchElementError;
+  using openassetio::hostApi::ManagerMetrics;
+  using openassetio::hostApi::ManagerMetricsPtr;
+  using Method = ManagerMetrics::Method;
+
+  py::class_<ManagerMetrics, ManagerMetricsPtr> pyManagerMetrics{mod, "ManagerMetrics"};
+
+  py::enum_<Method>{pyManagerMetrics, "Method"}
+      .value("kEntityExists", Method::kEntityExists)
+      .value("kEntityTraits", Method::kEntityTraits)
+      .value("kResolve", Method::kResolve)
+      .value("kDefaultEntityReference", Method::kDefaultEntityReference)
+      .value("kGetWithRelationship", Method::kGetWithRelationship)
+      .value("kGetWithRelationships", Method::kGetWithRelationships)
+      .value("kGetWithRelationshipsMatrix", Method::kGetWithRelationshipsMatrix)
+      .value("kTraverseRelationships", Method::kTraverseRelationships)
+      .value("kPreflight", Method::kPreflight)
+      .value("kRegister", Method::kRegister);
+
+  py::class_<ManagerMetrics::BatchSizeStatistics>{pyManagerMetrics, "BatchSizeStatistics"}
+      .def_readonly("calls", &ManagerMetrics::BatchSizeStatistics::calls)
+      .def_readonly("latencyBuckets", &ManagerMetrics::BatchSizeStatistics::latencyBuckets)
+      .def_readonly("totalLatency", &ManagerMetrics::BatchSizeStatistics::totalLatency);
+
+  py::class_<ManagerMetrics::MethodStatistics>{pyManagerMetrics, "MethodStatistics"}
+      .def_readonly("calls", &ManagerMetrics::MethodStatistics::calls)
+      .def_readonly("exceptions", &ManagerMetrics::MethodStatistics::exceptions)
+      .def_readonly("successes", &ManagerMetrics::MethodStatistics::successes)
+      .def_property_readonly(
+          "errors",
+          [](const ManagerMetrics::MethodStatistics& statistics) {
+            // Keyed by code, rather than index, for convenience.
+            std::map<BatchElementError::ErrorCode, std::uint64_t> errors;
+            for (std::size_t codeIdx = 0; codeIdx < ManagerMetrics::kErrorCodeCount; ++codeIdx) {
+              errors.emplace(static_cast<BatchElementError::ErrorCode>(
+                                 static_cast<int>(BatchElementError::ErrorCode::kUnknown) +
+                                 static_cast<int>(codeIdx)),
+                             statistics.errors[codeIdx]);
+            }
+            return errors;
+          })
+      .def_readonly("latencyBuckets", &ManagerMetrics::MethodStatistics::latencyBuckets)
+      .def_readonly("totalLatency", &ManagerMetrics::MethodStatistics::totalLatency)
+      .def_readonly("batchSizes", &ManagerMetrics::MethodStatistics::batchSizes);
+
+  py::class_<ManagerMetrics::Snapshot>{pyManagerMetrics, "Snapshot"}
+      .def_readonly("methods", &ManagerMetrics::Snapshot::methods)
+      .def("at", &ManagerMetrics::Snapshot::at, py::arg("method"))
+      .def("since", &ManagerMetrics::Snapshot::since, py::arg("earlier"));
+
+  pyManagerMetrics
+      .def(py::init(&ManagerMetrics::make),
+           py::arg("shardCount") = ManagerMetrics::kDefaultShardCount)
+      .def_readonly_static("kDefaultShardCount", &ManagerMetrics::kDefaultShardCount)
+      .def_readonly_static("kErrorCodeCount", &ManagerMetrics::kErrorCodeCount)
+      .def_readonly_static("kLatencyBucketCount", &ManagerMetrics::kLatencyBucketCount)
+      .def_readonly_static("kBatchSizeBucketCount", &ManagerMetrics::kBatchSizeBucketCount)
+      .def_readonly_static("kMethodNames", &ManagerMetrics::kMethodNames)
+      .def_static("errorCodeIndex", &ManagerMetrics::errorCodeIndex, py::arg("code"))
+      .def_static("latencyBucketUpperBound", &ManagerMetrics::latencyBucketUpperBound,
+                  py::arg("bucketIndex"))
+      .def_static("batchSizeBucketUpperBound", &ManagerMetrics::batchSizeBucketUpperBound,
+                  py::arg("bucketIndex"))
+      .def_static("batchSizeBucketIndex", &ManagerMetrics::batchSizeBucketIndex,
+                  py::arg("batchSize"))
+      .def_static("latencyQuantile", &ManagerMetrics::latencyQuantile, py::arg("latencyBuckets"),
+                  py::arg("quantile"))
+      .def("record", &ManagerMetrics::record, py::arg("method"), py::arg("latency"),
+           py::arg("successes"), py::arg("errors"), py::arg("raisedException"),
+           py::arg("batchSize") = 1)
+      .def("snapshot", &ManagerMetrics::snapshot)
+      .def_static("toPrometheusText", &ManagerMetrics::toPrometheusText, py::arg("snapshot"),
+                  py::arg("managerIdentifier"));
+}
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerTrafficReplayer.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerManagerTrafficReplayer(const py::module& mod) {
+  using openassetio::hostApi::ManagerTrafficReplayer;
+  using openassetio::hostApi::ManagerTrafficReplayerPtr;
+  using MethodReport = ManagerTrafficReplayer::MethodReport;
+
+  py::class_<ManagerTrafficReplayer, ManagerTrafficReplayerPtr> pyManagerTrafficReplayer{
+      mod, "ManagerTrafficReplayer"};
+
+  py::class_<MethodReport>{pyManagerTrafficReplayer, "MethodReport"}
+      .def_readonly("calls", &MethodReport::calls)
+      .def_readonly("skipped", &MethodReport::skipped)
+      .def_readonly("exceptions", &MethodReport::exceptions)
+      .def_readonly("successes", &MethodReport::successes)
+      .def_readonly("errors", &MethodReport::errors)
+      .def_readonly("recordedDuration", &MethodReport::recordedDuration)
+      .def_readonly("replayedDuration", &MethodReport::replayedDuration);
+
+  pyManagerTrafficReplayer
+      .def(py::init(&ManagerTrafficReplayer::make), py::arg("manager").none(false),
+           py::arg("rate") = 1.0, py::arg("replayPublishing") = false)
+      .def("replay", &ManagerTrafficReplayer::replay, py::arg("logPath"),
+           py::call_guard<py::gil_scoped_release>{});
+}
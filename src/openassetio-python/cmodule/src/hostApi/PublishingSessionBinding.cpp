@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/stl.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/PublishingSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerPublishingSession(const py::module& mod) {
+  using openassetio::EntityReference;
+  using openassetio::hostApi::BatchResultStream;
+  using openassetio::hostApi::PublishingSession;
+  using openassetio::hostApi::PublishingSessionPtr;
+
+  py::class_<PublishingSession, PublishingSessionPtr>{mod, "PublishingSession"}
+      .def(py::init(&PublishingSession::make), py::arg("manager").none(false),
+           py::arg("publishingAccess"), py::arg("context").none(false),
+           py::arg("chunkSize") = PublishingSession::kDefaultChunkSize)
+      .def_readonly_static("kDefaultChunkSize", &PublishingSession::kDefaultChunkSize)
+      .def("preflight", &PublishingSession::preflight, py::arg("entityReferences"),
+           py::arg("traitsHints"),
+           py::arg("bufferSize") = BatchResultStream<EntityReference>::kDefaultBufferSize,
+           py::call_guard<py::gil_scoped_release>{})
+      .def("register_", &PublishingSession::register_, py::arg("index"),
+           py::arg("workingReference"), py::arg("entityTraitsData").none(false),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("finish", &PublishingSession::finish, py::call_guard<py::gil_scoped_release>{});
+}
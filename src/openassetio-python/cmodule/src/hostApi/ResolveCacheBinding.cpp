@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+#include <pybind11/chrono.h>
+#include <pybind11/operators.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/hostApi/ResolveCache.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerResolveCache(const py::module& mod) {
+  using openassetio::hostApi::ResolveCache;
+  using openassetio::hostApi::ResolveCachePtr;
+
+  py::class_<ResolveCache, ResolveCachePtr> pyResolveCache{mod, "ResolveCache"};
+
+  py::class_<ResolveCache::Statistics>{pyResolveCache, "Statistics"}
+      .def_readonly("hits", &ResolveCache::Statistics::hits)
+      .def_readonly("misses", &ResolveCache::Statistics::misses)
+      .def_readonly("evictions", &ResolveCache::Statistics::evictions)
+      .def_readonly("sharedHits", &ResolveCache::Statistics::sharedHits);
+
+  py::class_<ResolveCache::SharedTier>{pyResolveCache, "SharedTier"}
+      .def(py::init([](openassetio::Str name, const std::size_t slotCount,
+                       const std::size_t slotSize, openassetio::Str path,
+                       const std::chrono::seconds timeToLive) {
+             return ResolveCache::SharedTier{std::move(name), slotCount, slotSize,
+                                             std::move(path), timeToLive};
+           }),
+           py::arg("name"), py::arg("slotCount"),
+           py::arg("slotSize") = ResolveCache::kDefaultSharedSlotSize,
+           py::arg("path") = openassetio::Str{},
+           py::arg("timeToLive") = std::chrono::seconds{0})
+      .def_readwrite("name", &ResolveCache::SharedTier::name)
+      .def_readwrite("slotCount", &ResolveCache::SharedTier::slotCount)
+      .def_readwrite("slotSize", &ResolveCache::SharedTier::slotSize)
+      .def_readwrite("path", &ResolveCache::SharedTier::path)
+      .def_readwrite("timeToLive", &ResolveCache::SharedTier::timeToLive)
+      .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
+
+  pyResolveCache
+      .def(py::init(py::overload_cast<std::size_t, std::size_t>(&ResolveCache::make)),
+           py::arg("capacity"), py::arg("shardCount") = ResolveCache::kDefaultShardCount)
+      .def(py::init(py::overload_cast<std::size_t, const ResolveCache::SharedTier&, std::size_t>(
+               &ResolveCache::make)),
+           py::arg("capacity"), py::arg("sharedTier"),
+           py::arg("shardCount") = ResolveCache::kDefaultShardCount)
+      .def_readonly_static("kDefaultShardCount", &ResolveCache::kDefaultShardCount)
+      .def_readonly_static("kDefaultSharedSlotSize", &ResolveCache::kDefaultSharedSlotSize)
+      .def("capacity", &ResolveCache::capacity)
+      .def("size", &ResolveCache::size)
+      .def("statistics", &ResolveCache::statistics)
+      .def("memoryUsage", &ResolveCache::memoryUsage)
+      .def("clear", &ResolveCache::clear, py::call_guard<py::gil_scoped_release>{})
+      .def("invalidate", &ResolveCache::invalidate, py::arg("entityReferences"),
+           py::arg("traitSet") = openassetio::trait::TraitSet{},
+           py::call_guard<py::gil_scoped_release>{})
+      .def("invalidatePrefix", &ResolveCache::invalidatePrefix, py::arg("prefix"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("setManagerIdentity", &ResolveCache::setManagerIdentity, py::arg("identifier"),
+           py::arg("settings"), py::call_guard<py::gil_scoped_release>{})
+      .def("setValidityToken", &ResolveCache::setValidityToken, py::arg("token"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("lookup", &ResolveCache::lookup, py::arg("entityReference"), py::arg("traitSet"),
+           py::arg("resolveAccess"), py::arg("context").none(false),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("insert", &ResolveCache::insert, py::arg("entityReference"), py::arg("traitSet"),
+           py::arg("resolveAccess"), py::arg("context").none(false),
+           py::arg("traitsData").none(false), py::call_guard<py::gil_scoped_release>{});
+}
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveCoalescer.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerResolveCoalescer(const py::module& mod) {
+  using openassetio::ContextConstPtr;
+  using openassetio::EntityReference;
+  using openassetio::access::ResolveAccess;
+  using openassetio::hostApi::Manager;
+  using openassetio::hostApi::ResolveCoalescer;
+  using openassetio::hostApi::ResolveCoalescerPtr;
+  namespace trait = openassetio::trait;
+
+  py::class_<ResolveCoalescer, ResolveCoalescerPtr>{mod, "ResolveCoalescer"}
+      .def(py::init(&ResolveCoalescer::make), py::arg("manager").none(false),
+           py::arg("window") = ResolveCoalescer::kDefaultWindow,
+           py::arg("maxBatchSize") = ResolveCoalescer::kDefaultMaxBatchSize)
+      .def_readonly_static("kDefaultWindow", &ResolveCoalescer::kDefaultWindow)
+      .def_readonly_static("kDefaultMaxBatchSize", &ResolveCoalescer::kDefaultMaxBatchSize)
+      .def("resolve",
+           py::overload_cast<const EntityReference&, const trait::TraitSet&, ResolveAccess,
+                             const ContextConstPtr&,
+                             const Manager::BatchElementErrorPolicyTag::Exception&>(
+               &ResolveCoalescer::resolve),
+           py::arg("entityReference"), py::arg("traitSet"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("errorPolicyTag"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("resolve",
+           py::overload_cast<const EntityReference&, const trait::TraitSet&, ResolveAccess,
+                             const ContextConstPtr&,
+                             const Manager::BatchElementErrorPolicyTag::Variant&>(
+               &ResolveCoalescer::resolve),
+           py::arg("entityReference"), py::arg("traitSet"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("errorPolicyTag"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "resolve",
+          [](ResolveCoalescer& self, const EntityReference& entityReference,
+             const trait::TraitSet& traitSet, const ResolveAccess resolveAccess,
+             const ContextConstPtr& context) {
+            return self.resolve(entityReference, traitSet, resolveAccess, context);
+          },
+          py::arg("entityReference"), py::arg("traitSet"), py::arg("resolveAccess"),
+          py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{});
+}
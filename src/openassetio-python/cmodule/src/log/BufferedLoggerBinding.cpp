@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/log/BufferedLogger.hpp>
+
+#include "../PyRetainingSharedPtr.hpp"
+#include "../_openassetio.hpp"
+
+void registerBufferedLogger(const py::module& mod) {
+  using openassetio::log::BufferedLogger;
+  using openassetio::log::BufferedLoggerPtr;
+  using openassetio::log::LoggerInterface;
+
+  py::class_<BufferedLogger, LoggerInterface, BufferedLoggerPtr>(mod, "BufferedLogger",
+                                                                 py::is_final())
+      .def(py::init(RetainCommonPyArgs::forFn<&BufferedLogger::make>()),
+           py::arg("upstreamLogger").none(false),
+           py::arg("maxBufferedMessages") = BufferedLogger::kDefaultMaxBufferedMessages)
+      .def("upstreamLogger", &BufferedLogger::upstreamLogger);
+}
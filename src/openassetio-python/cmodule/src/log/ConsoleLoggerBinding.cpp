@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -14,5 +15,7 @@ void registerConsoleLogger(const py::module& mod) {
 
   py::class_<ConsoleLogger, LoggerInterface, ConsoleLoggerPtr>(mod, "ConsoleLogger",
                                                                py::is_final())
-      .def(py::init(&ConsoleLogger::make), py::arg("shouldColorOutput") = true);
+      .def(py::init(&ConsoleLogger::make), py::arg("shouldColorOutput") = true,
+           py::arg("flushInterval") = std::chrono::milliseconds{0})
+      .def("flush", &ConsoleLogger::flush, py::call_guard<py::gil_scoped_release>{});
 }
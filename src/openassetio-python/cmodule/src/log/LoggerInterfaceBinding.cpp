@@ -3,6 +3,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/InfoDictionary.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 
 #include "../_openassetio.hpp"
@@ -21,6 +22,16 @@ struct PyLoggerInterface : LoggerInterface {
   void log(Severity severity, const Str& message) override {
     OPENASSETIO_PYBIND11_OVERRIDE_PURE(void, LoggerInterface, log, severity, message);
   }
+
+  void logStructured(Severity severity, const Str& message,
+                     const InfoDictionary& fields) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(void, LoggerInterface, logStructured, severity, message,
+                                  fields);
+  }
+
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override {
+    OPENASSETIO_PYBIND11_OVERRIDE(bool, LoggerInterface, isSeverityLogged, severity);
+  }
 };
 }  // namespace log
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -50,6 +61,10 @@ void registerLoggerInterface(const py::module& mod) {
   loggerInterface.def(py::init())
       .def("log", &LoggerInterface::log, py::arg("severity"), py::arg("message"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("logStructured", &LoggerInterface::logStructured, py::arg("severity"),
+           py::arg("message"), py::arg("fields"), py::call_guard<py::gil_scoped_release>{})
+      .def("isSeverityLogged", &LoggerInterface::isSeverityLogged, py::arg("severity"),
+           py::call_guard<py::gil_scoped_release>{})
       .def("debugApi", &LoggerInterface::debugApi, py::arg("message"),
            py::call_guard<py::gil_scoped_release>{})
       .def("debug", &LoggerInterface::debug, py::arg("message"),
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/log/RateLimitFilter.hpp>
+
+#include "../PyRetainingSharedPtr.hpp"
+#include "../_openassetio.hpp"
+
+void registerRateLimitFilter(const py::module& mod) {
+  using openassetio::log::LoggerInterface;
+  using openassetio::log::RateLimitFilter;
+  using openassetio::log::RateLimitFilterPtr;
+
+  py::class_<RateLimitFilter, LoggerInterface, RateLimitFilterPtr>(mod, "RateLimitFilter",
+                                                                   py::is_final())
+      .def(py::init(RetainCommonPyArgs::forFn<&RateLimitFilter::make>()),
+           py::arg("upstreamLogger").none(false),
+           py::arg("maxMessagesPerInterval") = RateLimitFilter::kDefaultMaxMessagesPerInterval,
+           py::arg("interval") = RateLimitFilter::kDefaultInterval,
+           py::arg("sampleInterval") = 0)
+      .def("suppressedCount", &RateLimitFilter::suppressedCount)
+      .def("upstreamLogger", &RateLimitFilter::upstreamLogger);
+}
@@ -3,14 +3,56 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/InfoDictionary.hpp>
 #include <openassetio/log/SeverityFilter.hpp>
+#include <openassetio/typedefs.hpp>
 
 #include "../PyRetainingSharedPtr.hpp"
 #include "../_openassetio.hpp"
 
+namespace {
+using openassetio::InfoDictionary;
+using openassetio::Str;
+using openassetio::log::SeverityFilter;
+using Severity = openassetio::log::LoggerInterface::Severity;
+
+/*
+ * Python managers log copiously at debug severities, and most of these
+ * messages are discarded by the filter. The default LoggerInterface
+ * bindings convert the message and release the GIL before the filter
+ * gets to discard it, so the following check the filter's severity
+ * first, whilst still holding the GIL, and only pay for conversion and
+ * the GIL round-trip if the message is to be relayed.
+ */
+
+void logIfRelayed(SeverityFilter& filter, const Severity severity, const py::str& message) {
+  if (severity < filter.effectiveSeverity()) {
+    return;
+  }
+  const auto messageStr = message.cast<Str>();
+  const py::gil_scoped_release release{};
+  filter.log(severity, messageStr);
+}
+
+void logStructuredIfRelayed(SeverityFilter& filter, const Severity severity,
+                             const py::str& message, const py::object& fields) {
+  if (severity < filter.effectiveSeverity()) {
+    return;
+  }
+  const auto messageStr = message.cast<Str>();
+  const auto fieldsDict = fields.cast<InfoDictionary>();
+  const py::gil_scoped_release release{};
+  filter.logStructured(severity, messageStr, fieldsDict);
+}
+
+template <Severity kSeverity>
+void logAtSeverity(SeverityFilter& filter, const py::str& message) {
+  logIfRelayed(filter, kSeverity, message);
+}
+}  // namespace
+
 void registerSeverityFilter(const py::module& mod) {
   using openassetio::log::LoggerInterface;
-  using openassetio::log::SeverityFilter;
   using openassetio::log::SeverityFilterPtr;
 
   py::class_<SeverityFilter, LoggerInterface, SeverityFilterPtr>(mod, "SeverityFilter",
@@ -19,5 +61,19 @@ void registerSeverityFilter(const py::module& mod) {
            py::arg("upstreamLogger").none(false))
       .def("getSeverity", &SeverityFilter::getSeverity)
       .def("setSeverity", &SeverityFilter::setSeverity, py::arg("severity"))
-      .def("upstreamLogger", &SeverityFilter::upstreamLogger);
+      .def("effectiveSeverity", &SeverityFilter::effectiveSeverity)
+      .def_static("setGlobalSeverityOverride", &SeverityFilter::setGlobalSeverityOverride,
+                  py::arg("severity").none(true))
+      .def_static("globalSeverityOverride", &SeverityFilter::globalSeverityOverride)
+      .def("upstreamLogger", &SeverityFilter::upstreamLogger)
+      .def("log", &logIfRelayed, py::arg("severity"), py::arg("message"))
+      .def("logStructured", &logStructuredIfRelayed, py::arg("severity"), py::arg("message"),
+           py::arg("fields"))
+      .def("debugApi", &logAtSeverity<Severity::kDebugApi>, py::arg("message"))
+      .def("debug", &logAtSeverity<Severity::kDebug>, py::arg("message"))
+      .def("info", &logAtSeverity<Severity::kInfo>, py::arg("message"))
+      .def("progress", &logAtSeverity<Severity::kProgress>, py::arg("message"))
+      .def("warning", &logAtSeverity<Severity::kWarning>, py::arg("message"))
+      .def("error", &logAtSeverity<Severity::kError>, py::arg("message"))
+      .def("critical", &logAtSeverity<Severity::kCritical>, py::arg("message"));
 }
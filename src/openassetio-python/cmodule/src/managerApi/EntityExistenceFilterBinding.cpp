@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <openassetio/managerApi/EntityExistenceFilter.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerEntityExistenceFilter(const py::module& mod) {
+  using openassetio::managerApi::EntityExistenceFilter;
+  using openassetio::managerApi::EntityExistenceFilterPtr;
+
+  py::class_<EntityExistenceFilter, EntityExistenceFilterPtr>(mod, "EntityExistenceFilter",
+                                                              py::is_final())
+      .def(py::init(&EntityExistenceFilter::make), py::arg("expectedCount"),
+           py::arg("falsePositiveRate") = 0.01)
+      .def("insert", &EntityExistenceFilter::insert, py::arg("entityReferenceString"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("mayContain", &EntityExistenceFilter::mayContain, py::arg("entityReferenceString"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("bitCount", &EntityExistenceFilter::bitCount)
+      .def("hashCount", &EntityExistenceFilter::hashCount)
+      .def("memoryUsage", &EntityExistenceFilter::memoryUsage);
+}
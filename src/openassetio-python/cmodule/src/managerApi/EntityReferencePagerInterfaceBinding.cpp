@@ -1,5 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <optional>
+
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
@@ -34,6 +37,17 @@ struct PyEntityReferencePagerInterface : EntityReferencePagerInterface {
     OPENASSETIO_PYBIND11_OVERRIDE_PURE(void, EntityReferencePagerInterface, next, hostSession);
   }
 
+  std::optional<std::size_t> sizeHint(const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(std::optional<std::size_t>, EntityReferencePagerInterface,
+                                  sizeHint, hostSession);
+  }
+
+  EntityReferencePagerInterface::Page drainAll(std::size_t maxItems,
+                                               const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(EntityReferencePagerInterface::Page,
+                                  EntityReferencePagerInterface, drainAll, maxItems, hostSession);
+  }
+
   void close(const HostSessionPtr& hostSession) override {
     OPENASSETIO_PYBIND11_OVERRIDE(void, EntityReferencePagerInterface, close, hostSession);
   }
@@ -57,6 +71,10 @@ void registerEntityReferencePagerInterface(const py::module& mod) {
            py::call_guard<py::gil_scoped_release>{})
       .def("next", &EntityReferencePagerInterface::next, py::arg("hostSession").none(false),
            py::call_guard<py::gil_scoped_release>{})
+      .def("sizeHint", &EntityReferencePagerInterface::sizeHint,
+           py::arg("hostSession").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def("drainAll", &EntityReferencePagerInterface::drainAll, py::arg("maxItems"),
+           py::arg("hostSession").none(false), py::call_guard<py::gil_scoped_release>{})
       .def("close", &EntityReferencePagerInterface::close, py::arg("hostSession").none(false),
            py::call_guard<py::gil_scoped_release>{});
 }
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/hostApi/HostInterface.hpp>
@@ -17,5 +18,10 @@ void registerHost(const py::module& mod) {
            py::arg("hostInterface").none(false))
       .def("identifier", &Host::identifier, py::call_guard<py::gil_scoped_release>{})
       .def("displayName", &Host::displayName, py::call_guard<py::gil_scoped_release>{})
-      .def("info", &Host::info, py::call_guard<py::gil_scoped_release>{});
+      .def("info", &Host::info, py::call_guard<py::gil_scoped_release>{})
+      .def("refresh", &Host::refresh, py::call_guard<py::gil_scoped_release>{})
+      .def("submit", &Host::submit, py::arg("task").none(false),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("parallelFor", &Host::parallelFor, py::arg("count"), py::arg("body").none(false),
+           py::call_guard<py::gil_scoped_release>{});
 }
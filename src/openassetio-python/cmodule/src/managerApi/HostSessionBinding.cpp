@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/log/LoggerInterface.hpp>
@@ -10,12 +11,22 @@
 #include "../_openassetio.hpp"
 
 void registerHostSession(const py::module& mod) {
+  using openassetio::log::LoggerInterfacePtr;
+  using openassetio::managerApi::HostPtr;
   using openassetio::managerApi::HostSession;
   using openassetio::managerApi::HostSessionPtr;
 
   py::class_<HostSession, HostSessionPtr>(mod, "HostSession", py::is_final())
-      .def(py::init(RetainCommonPyArgs::forFn<&HostSession::make>()), py::arg("host").none(false),
-           py::arg("logger").none(false))
+      .def(py::init(RetainCommonPyArgs::forFn<static_cast<HostSessionPtr (*)(
+                        HostPtr, LoggerInterfacePtr)>(&HostSession::make)>()),
+           py::arg("host").none(false), py::arg("logger").none(false))
       .def("host", &HostSession::host)
-      .def("logger", &HostSession::logger);
+      .def("logger", &HostSession::logger)
+      .def("notifyEntitiesChanged", &HostSession::notifyEntitiesChanged,
+           py::arg("entityReferences"), py::arg("traitSet") = openassetio::trait::TraitSet{},
+           py::call_guard<py::gil_scoped_release>{})
+      .def("subscribeToEntityChanges", &HostSession::subscribeToEntityChanges,
+           py::arg("callback").none(false))
+      .def("unsubscribeFromEntityChanges", &HostSession::unsubscribeFromEntityChanges,
+           py::arg("subscriptionId"), py::call_guard<py::gil_scoped_release>{});
 }
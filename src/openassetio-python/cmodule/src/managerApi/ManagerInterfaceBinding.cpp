@@ -1,11 +1,15 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
+#include <array>
+#include <string_view>
+
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/Context.hpp>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/managerApi/EntityExistenceFilter.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
@@ -14,7 +18,9 @@
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
+#include "../EntityReferencesView.hpp"
 #include "../_openassetio.hpp"
+#include "../overrideCache.hpp"
 #include "../overrideMacros.hpp"
 
 namespace openassetio {
@@ -30,6 +36,49 @@ struct PyManagerInterface : ManagerInterface {
 
   using PyRetainingManagerStateBasePtr = PyRetainingSharedPtr<ManagerStateBase>;
 
+  /**
+   * Python names of methods whose override lookup is cached.
+   *
+   * Each override below should be listed here, otherwise the override
+   * is looked up by name, with the GIL acquired, on every call.
+   */
+  static constexpr std::array<std::string_view, 32> kOverridableMethods{
+      "identifier",
+      "displayName",
+      "hasCapability",
+      "info",
+      "settings",
+      "initialize",
+      "flushCaches",
+      "flushEntityCaches",
+      "flushCachesWithPrefix",
+      "managementPolicy",
+      "createState",
+      "createChildState",
+      "persistenceTokenForState",
+      "stateFromPersistenceToken",
+      "resetState",
+      "isEntityReferenceString",
+      "areEntityReferenceStrings",
+      "entityExists",
+      "entityExistenceFilter",
+      "updateTerminology",
+      "resolve",
+      "resolveHeterogeneous",
+      "resolveProjected",
+      "resolveIfChanged",
+      "entityTraits",
+      "defaultEntityReference",
+      "getWithRelationship",
+      "getWithRelationships",
+      "getWithRelationshipsMatrix",
+      "traverseRelationships",
+      "preflight",
+      "register"};
+
+  /// Cache of the Python overrides of the above methods.
+  python::OverrideCache<kOverridableMethods.size()> overrideCache_;
+
   [[nodiscard]] Identifier identifier() const override {
     OPENASSETIO_PYBIND11_OVERRIDE_PURE(Identifier, ManagerInterface, identifier, /* no args */);
   }
@@ -55,6 +104,17 @@ struct PyManagerInterface : ManagerInterface {
     OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, flushCaches, hostSession);
   }
 
+  void flushEntityCaches(const EntityReferences& entityReferences,
+                         const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, flushEntityCaches, entityReferences,
+                                  hostSession);
+  }
+
+  void flushCachesWithPrefix(const Str& prefix, const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, flushCachesWithPrefix, prefix,
+                                  hostSession);
+  }
+
   [[nodiscard]] trait::TraitsDatas managementPolicy(const trait::TraitSets& traitSets,
                                                     access::PolicyAccess policyAccess,
                                                     const ContextConstPtr& context,
@@ -86,18 +146,36 @@ struct PyManagerInterface : ManagerInterface {
                                   stateFromPersistenceToken, token, hostSession);
   }
 
+  bool resetState(const ManagerStateBasePtr& state, const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(bool, ManagerInterface, resetState, state, hostSession);
+  }
+
   [[nodiscard]] bool isEntityReferenceString(const Str& someString,
                                              const HostSessionPtr& hostSession) override {
     OPENASSETIO_PYBIND11_OVERRIDE(bool, ManagerInterface, isEntityReferenceString, someString,
                                   hostSession);
   }
 
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(
+      const std::vector<Str>& someStrings, const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(std::vector<bool>, ManagerInterface, areEntityReferenceStrings,
+                                  someStrings, hostSession);
+  }
+
   void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
                     const HostSessionPtr& hostSession,
                     const ExistsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityExists, entityReferences, context,
-                                  hostSession, successCallback, errorCallback);
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, entityExists, successCallback,
+                                        errorCallback,
+                                        python::EntityReferencesViewArg{entityReferences},
+                                        context, hostSession, successCallback, errorCallback);
+  }
+
+  [[nodiscard]] EntityExistenceFilterConstPtr entityExistenceFilter(
+      const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(EntityExistenceFilterConstPtr, ManagerInterface,
+                                  entityExistenceFilter, hostSession);
   }
 
   [[nodiscard]] bool hasCapability(ManagerInterface::Capability capability) override {
@@ -114,9 +192,51 @@ struct PyManagerInterface : ManagerInterface {
                const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
                const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
                const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, resolve, entityReferences, traitSet,
-                                  resolveAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, resolve, successCallback, errorCallback,
+                                        python::EntityReferencesViewArg{entityReferences},
+                                        traitSet, resolveAccess, context, hostSession,
+                                        successCallback, errorCallback);
+  }
+
+  void resolveHeterogeneous(const EntityReferences& entityReferences,
+                            const trait::TraitSets& traitSets,
+                            const std::vector<std::size_t>& traitSetIndices,
+                            const access::ResolveAccess resolveAccess,
+                            const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                            const ResolveSuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, resolveHeterogeneous, successCallback,
+                                        errorCallback,
+                                        python::EntityReferencesViewArg{entityReferences},
+                                        traitSets, traitSetIndices, resolveAccess, context,
+                                        hostSession, successCallback, errorCallback);
+  }
+
+  void resolveProjected(const EntityReferences& entityReferences,
+                        const trait::TraitSet& traitSet,
+                        const trait::PropertyProjection& propertyProjection,
+                        const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+                        const HostSessionPtr& hostSession,
+                        const ResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, resolveProjected, successCallback,
+                                        errorCallback,
+                                        python::EntityReferencesViewArg{entityReferences},
+                                        traitSet, propertyProjection, resolveAccess, context,
+                                        hostSession, successCallback, errorCallback);
+  }
+
+  void resolveIfChanged(const EntityReferences& entityReferences,
+                        const trait::TraitSet& traitSet, const access::ResolveAccess resolveAccess,
+                        const std::vector<Str>& generationTokens, const ContextConstPtr& context,
+                        const HostSessionPtr& hostSession,
+                        const ConditionalResolveSuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, resolveIfChanged, successCallback,
+                                        errorCallback,
+                                        python::EntityReferencesViewArg{entityReferences},
+                                        traitSet, resolveAccess, generationTokens, context,
+                                        hostSession, successCallback, errorCallback);
   }
 
   void entityTraits(const EntityReferences& entityReferences,
@@ -124,9 +244,11 @@ struct PyManagerInterface : ManagerInterface {
                     const ContextConstPtr& context, const HostSessionPtr& hostSession,
                     const EntityTraitsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityTraits, entityReferences,
-                                  entityTraitsAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, entityTraits, successCallback,
+                                        errorCallback,
+                                        python::EntityReferencesViewArg{entityReferences},
+                                        entityTraitsAccess, context, hostSession,
+                                        successCallback, errorCallback);
   }
 
   void defaultEntityReference(const trait::TraitSets& traitSets,
@@ -134,9 +256,9 @@ struct PyManagerInterface : ManagerInterface {
                               const ContextConstPtr& context, const HostSessionPtr& hostSession,
                               const DefaultEntityReferenceSuccessCallback& successCallback,
                               const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, defaultEntityReference, traitSets,
-                                  defaultEntityAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, defaultEntityReference, successCallback,
+                                        errorCallback, traitSets, defaultEntityAccess, context,
+                                        hostSession, successCallback, errorCallback);
   }
 
   void getWithRelationship(
@@ -150,8 +272,9 @@ struct PyManagerInterface : ManagerInterface {
         void, ManagerInterface, getWithRelationship,
         (entityReferences, relationshipTraitsData, resultTraitSet, pageSize, relationsAccess,
          context, hostSession, successCallback, errorCallback),
-        entityReferences, relationshipTraitsData, resultTraitSet, pageSize, relationsAccess,
-        context, hostSession, RetainCommonPyArgs::forFn(successCallback), errorCallback);
+        python::EntityReferencesViewArg{entityReferences}, relationshipTraitsData,
+        resultTraitSet, pageSize, relationsAccess, context, hostSession,
+        RetainCommonPyArgs::forFn(successCallback), errorCallback);
   }
 
   void getWithRelationships(
@@ -169,23 +292,59 @@ struct PyManagerInterface : ManagerInterface {
         context, hostSession, RetainCommonPyArgs::forFn(successCallback), errorCallback);
   }
 
+  void getWithRelationshipsMatrix(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+      const trait::TraitSet& resultTraitSet, size_t pageSize,
+      const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+      const HostSessionPtr& hostSession,
+      const ManagerInterface::RelationshipQuerySuccessCallback& successCallback,
+      const ManagerInterface::BatchElementErrorCallback& errorCallback) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_ARGS(
+        void, ManagerInterface, getWithRelationshipsMatrix,
+        (entityReferences, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
+         context, hostSession, successCallback, errorCallback),
+        python::EntityReferencesViewArg{entityReferences}, relationshipTraitsDatas,
+        resultTraitSet, pageSize, relationsAccess, context, hostSession,
+        RetainCommonPyArgs::forFn(successCallback), errorCallback);
+  }
+
+  void traverseRelationships(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+      const trait::TraitSet& resultTraitSet, std::size_t maxDepth,
+      const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+      const HostSessionPtr& hostSession,
+      const ManagerInterface::RelationshipTraversalSuccessCallback& successCallback,
+      const ManagerInterface::BatchElementErrorCallback& errorCallback) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_ARGS(
+        void, ManagerInterface, traverseRelationships,
+        (entityReferences, relationshipTraitsDatas, resultTraitSet, maxDepth, relationsAccess,
+         context, hostSession, successCallback, errorCallback),
+        python::EntityReferencesViewArg{entityReferences}, relationshipTraitsDatas,
+        resultTraitSet, maxDepth, relationsAccess, context, hostSession,
+        RetainCommonPyArgs::forFn(successCallback), errorCallback);
+  }
+
   void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
                  const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
                  const HostSessionPtr& hostSession,
                  const PreflightSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, preflight, entityReferences, traitsHints,
-                                  publishingAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ManagerInterface, preflight, successCallback,
+                                        errorCallback,
+                                        python::EntityReferencesViewArg{entityReferences},
+                                        traitsHints, publishingAccess, context, hostSession,
+                                        successCallback, errorCallback);
   }
 
   void register_(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsDatas,
                  const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
                  const HostSessionPtr& hostSession, const RegisterSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_NAME(void, ManagerInterface, "register", register_,
-                                       entityReferences, traitsDatas, publishingAccess, context,
-                                       hostSession, successCallback, errorCallback);
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH_NAME(ManagerInterface, "register", register_,
+                                             successCallback, errorCallback,
+                                             python::EntityReferencesViewArg{entityReferences},
+                                             traitsDatas, publishingAccess, context, hostSession,
+                                             successCallback, errorCallback);
   }
 
   // Hoist protected members
@@ -235,6 +394,12 @@ void registerManagerInterface(const py::module& mod) {
            py::arg("hostSession").none(false), py::call_guard<py::gil_scoped_release>{})
       .def("flushCaches", &ManagerInterface::flushCaches, py::arg("hostSession").none(false),
            py::call_guard<py::gil_scoped_release>{})
+      .def("flushEntityCaches", &ManagerInterface::flushEntityCaches,
+           py::arg("entityReferences"), py::arg("hostSession").none(false),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("flushCachesWithPrefix", &ManagerInterface::flushCachesWithPrefix,
+           py::arg("prefix"), py::arg("hostSession").none(false),
+           py::call_guard<py::gil_scoped_release>{})
       .def("managementPolicy", &ManagerInterface::managementPolicy, py::arg("traitSets"),
            py::arg("policyAccess"), py::arg("context").none(false),
            py::arg("hostSession").none(false), py::call_guard<py::gil_scoped_release>{})
@@ -250,13 +415,20 @@ void registerManagerInterface(const py::module& mod) {
       .def("stateFromPersistenceToken", &ManagerInterface::stateFromPersistenceToken,
            py::arg("token"), py::arg("hostSession").none(false),
            py::call_guard<py::gil_scoped_release>{})
+      .def("resetState", &ManagerInterface::resetState, py::arg("state").none(false),
+           py::arg("hostSession").none(false), py::call_guard<py::gil_scoped_release>{})
       .def("isEntityReferenceString", &ManagerInterface::isEntityReferenceString,
            py::arg("someString"), py::arg("hostSession").none(false),
            py::call_guard<py::gil_scoped_release>{})
+      .def("areEntityReferenceStrings", &ManagerInterface::areEntityReferenceStrings,
+           py::arg("someStrings"), py::arg("hostSession").none(false),
+           py::call_guard<py::gil_scoped_release>{})
       .def("entityExists", &ManagerInterface::entityExists, py::arg("entityReferences"),
            py::arg("context").none(false), py::arg("hostSession").none(false),
            py::arg("successCallback"), py::arg("errorCallback"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("entityExistenceFilter", &ManagerInterface::entityExistenceFilter,
+           py::arg("hostSession").none(false), py::call_guard<py::gil_scoped_release>{})
       .def("entityTraits", &ManagerInterface::entityTraits, py::arg("entityReferences"),
            py::arg("entityTraitsAccess"), py::arg("context").none(false),
            py::arg("hostSession").none(false), py::arg("successCallback"),
@@ -269,6 +441,21 @@ void registerManagerInterface(const py::module& mod) {
            py::arg("resolveAcess"), py::arg("context").none(false),
            py::arg("hostSession").none(false), py::arg("successCallback"),
            py::arg("errorCallback"), py::call_guard<py::gil_scoped_release>{})
+      .def("resolveHeterogeneous", &ManagerInterface::resolveHeterogeneous,
+           py::arg("entityReferences"), py::arg("traitSets"), py::arg("traitSetIndices"),
+           py::arg("resolveAccess"), py::arg("context").none(false),
+           py::arg("hostSession").none(false), py::arg("successCallback"),
+           py::arg("errorCallback"), py::call_guard<py::gil_scoped_release>{})
+      .def("resolveProjected", &ManagerInterface::resolveProjected, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("propertyProjection"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("hostSession").none(false),
+           py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("resolveIfChanged", &ManagerInterface::resolveIfChanged, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("resolveAccess"), py::arg("generationTokens"),
+           py::arg("context").none(false), py::arg("hostSession").none(false),
+           py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
       .def("defaultEntityReference", &ManagerInterface::defaultEntityReference,
            py::arg("traitSets"), py::arg("defaultEntityAccess"), py::arg("context").none(false),
            py::arg("hostSession").none(false), py::arg("successCallback"),
@@ -285,6 +472,18 @@ void registerManagerInterface(const py::module& mod) {
            py::arg("context").none(false), py::arg("hostSession").none(false),
            py::arg("successCallback"), py::arg("errorCallback"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("getWithRelationshipsMatrix", &ManagerInterface::getWithRelationshipsMatrix,
+           py::arg("entityReferences"), py::arg("relationshipTraitsDatas"),
+           py::arg("resultTraitSet"), py::arg("pageSize"), py::arg("relationsAccess"),
+           py::arg("context").none(false), py::arg("hostSession").none(false),
+           py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("traverseRelationships", &ManagerInterface::traverseRelationships,
+           py::arg("entityReferences"), py::arg("relationshipTraitsDatas"),
+           py::arg("resultTraitSet"), py::arg("maxDepth"), py::arg("relationsAccess"),
+           py::arg("context").none(false), py::arg("hostSession").none(false),
+           py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
       .def("preflight", &ManagerInterface::preflight, py::arg("entityReferences"),
            py::arg("traitsHints"), py::arg("publishingAccess"), py::arg("context").none(false),
            py::arg("hostSession").none(false), py::arg("successCallback"),
@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Support for trampolines to cache the lookup of Python overrides.
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#include <pybind11/pybind11.h>
+
+#include <frameobject.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python {
+
+/**
+ * Per-instance cache of the Python overrides of the methods of a
+ * trampoline.
+ *
+ * pybind11's override lookup must acquire the GIL on every call, and
+ * resolve the method by name, via the type's MRO, creating a new
+ * bound method object each time.
+ *
+ * This cache looks up each method once, on its first call, and
+ * records whether it is overridden. Subsequent calls of a method that
+ * is not overridden then go directly to the C++ implementation,
+ * without acquiring the GIL. For a method that is overridden by a
+ * regular Python method, the underlying (unbound) function is cached,
+ * such that subsequent calls need only bind it to the instance,
+ * without any name resolution.
+ *
+ * Only the unbound function is retained, since a bound method would
+ * hold a reference to the Python instance, which (indirectly) owns
+ * this cache, and so would create a reference cycle that is not
+ * visible to the garbage collector.
+ *
+ * The cache cannot be populated on construction, since the Python
+ * instance is not yet associated with the C++ instance at that point.
+ * Concurrent first calls may each perform the lookup, which is benign
+ * since they will all reach the same conclusion. Only the first to
+ * complete publishes its result, which is then immutable, so the cache
+ * does not rely on the GIL for mutual exclusion, and is safe for use
+ * with free-threaded (PEP 703) builds of Python. In such builds,
+ * "holding the GIL" should be read as "having an attached thread
+ * state", as provided by `gil_scoped_acquire`.
+ *
+ * Overrides are treated as static from their first call, i.e.
+ * methods assigned to (or removed from) the Python instance or its
+ * class after their first call are not detected.
+ *
+ * A trampoline opts in by declaring a `static constexpr`
+ * `kOverridableMethods` array of the Python names of the methods to
+ * cache, along with an `overrideCache_` member of this type, sized
+ * accordingly. The `OPENASSETIO_PYBIND11_OVERRIDE*` macros (see
+ * overrideMacros.hpp) then consult the cache, if available.
+ *
+ * @tparam N Number of methods to cache.
+ */
+template <std::size_t N>
+class OverrideCache {
+ public:
+  OverrideCache() = default;
+  OverrideCache(const OverrideCache&) = delete;
+  OverrideCache(OverrideCache&&) noexcept = delete;
+  OverrideCache& operator=(const OverrideCache&) = delete;
+  OverrideCache& operator=(OverrideCache&&) noexcept = delete;
+
+  ~OverrideCache() {
+    // Cached functions must be released with the GIL held, but we may
+    // be destroyed in a non-Python thread. See createPyRetainingPtr
+    // for the caveats of checking _Py_IsFinalizing.
+    const bool hasCachedFunction =
+        std::any_of(entries_.begin(), entries_.end(),
+                    [](const Entry& entry) { return static_cast<bool>(entry.function); });
+    if (!hasCachedFunction) {
+      return;
+    }
+    if (_Py_IsFinalizing()) {
+      // The interpreter is gone, so don't attempt to clean up.
+      for (Entry& entry : entries_) {
+        entry.function.release();
+      }
+      return;
+    }
+    const pybind11::gil_scoped_acquire gil{};
+    for (Entry& entry : entries_) {
+      entry.function = pybind11::object{};
+    }
+  }
+
+  /**
+   * Determine whether a method is overridden in Python, consulting
+   * the cache if possible.
+   *
+   * The GIL is only acquired if the method has not yet been looked up.
+   *
+   * @param self Instance to query, as the type registered with
+   * pybind11.
+   * @param methodIdx Index of the method in `kOverridableMethods`.
+   * @param name Name of the Python method.
+   * @return `false` only if the method is known not to be overridden.
+   */
+  template <class Class>
+  bool hasOverride(const Class* self, const std::size_t methodIdx, const char* name) const {
+    Entry& entry = entries_[methodIdx];
+    State state = entry.state.load(std::memory_order_acquire);
+    if (!isPublished(state)) {
+      const pybind11::gil_scoped_acquire gil{};
+      state = lookUp(entry, pySelf(self), name).state;
+    }
+    return state == State::kOverridden;
+  }
+
+  /**
+   * Get the Python override of a method, consulting the cache if
+   * possible.
+   *
+   * As for `pybind11::get_override`, no override is returned if the
+   * method is being called from within its own override (e.g. via
+   * `super()`), so that the C++ implementation is used instead.
+   *
+   * The GIL must be held.
+   *
+   * @param self Instance to query, as the type registered with
+   * pybind11.
+   * @param methodIdx Index of the method in `kOverridableMethods`.
+   * @param name Name of the Python method.
+   * @return Override bound to the instance, or a null function if
+   * there is no override.
+   */
+  template <class Class>
+  pybind11::function getOverride(const Class* self, const std::size_t methodIdx,
+                                 const char* name) const {
+    Entry& entry = entries_[methodIdx];
+    const pybind11::object instance = pySelf(self);
+    const Override override = findOverride(entry, instance, name);
+    if (override.state == State::kNotOverridden) {
+      return {};
+    }
+    // Overrides that are not regular methods are not cached, and the
+    // recursion check is non-trivial, so defer to pybind11.
+    if (!override.function || isCalledFromWithin(override.function)) {
+      return pybind11::get_override(self, name);
+    }
+    PyObject* boundMethod = PyMethod_New(override.function.ptr(), instance.ptr());
+    if (boundMethod == nullptr) {
+      throw pybind11::error_already_set{};
+    }
+    return pybind11::reinterpret_steal<pybind11::function>(boundMethod);
+  }
+
+ private:
+  enum class State : std::uint8_t { kUnknown, kPublishing, kOverridden, kNotOverridden };
+
+  struct Entry {
+    std::atomic<State> state{State::kUnknown};
+    /// Unbound function of the override, if it is a regular Python
+    /// method. Written once, before `state` is published, and only
+    /// accessed whilst the GIL is held.
+    pybind11::object function;
+  };
+
+  /// Result of the lookup of a method.
+  struct Override {
+    State state;
+    pybind11::object function;
+  };
+
+  static constexpr bool isPublished(const State state) {
+    return state == State::kOverridden || state == State::kNotOverridden;
+  }
+
+  template <class Class>
+  static pybind11::object pySelf(const Class* self) {
+    return pybind11::cast(self, pybind11::return_value_policy::reference);
+  }
+
+  /**
+   * Get the published result of the lookup of a method, or else look
+   * it up. The GIL must be held.
+   */
+  static Override findOverride(Entry& entry, const pybind11::object& instance,
+                               const char* name) {
+    if (const State state = entry.state.load(std::memory_order_acquire); isPublished(state)) {
+      return {state, entry.function};
+    }
+    return lookUp(entry, instance, name);
+  }
+
+  /**
+   * Look up a method and publish the result, unless another thread
+   * has already begun to do so. The GIL must be held.
+   *
+   * Overrides are detected as pybind11 does, except that there is no
+   * check for whether the method is being called from within its own
+   * override, which would otherwise cache an override as absent.
+   */
+  static Override lookUp(Entry& entry, const pybind11::object& instance, const char* name) {
+    namespace py = pybind11;
+
+    const py::object method = py::getattr(instance, name, py::none());
+    Override override{State::kOverridden, {}};
+    if (PyMethod_Check(method.ptr()) && PyMethod_GET_SELF(method.ptr()) == instance.ptr() &&
+        PyFunction_Check(PyMethod_GET_FUNCTION(method.ptr()))) {
+      override.function =
+          py::reinterpret_borrow<py::object>(PyMethod_GET_FUNCTION(method.ptr()));
+    } else if (PyCallable_Check(method.ptr()) != 0 &&
+               py::reinterpret_borrow<py::function>(method).is_cpp_function()) {
+      override.state = State::kNotOverridden;
+    }
+
+    State expected = State::kUnknown;
+    if (entry.state.compare_exchange_strong(expected, State::kPublishing,
+                                            std::memory_order_relaxed)) {
+      entry.function = override.function;
+      entry.state.store(override.state, std::memory_order_release);
+    }
+    return override;
+  }
+
+  /// Whether the currently executing Python frame is that of the
+  /// given function. The GIL must be held.
+  static bool isCalledFromWithin(const pybind11::object& function) {
+    PyFrameObject* frame = PyEval_GetFrame();
+    if (frame == nullptr) {
+      return false;
+    }
+    const PyObject* functionCode = PyFunction_GET_CODE(function.ptr());
+#if PY_VERSION_HEX >= 0x03090000
+    PyCodeObject* frameCode = PyFrame_GetCode(frame);
+    const bool isWithin = reinterpret_cast<PyObject*>(frameCode) == functionCode;
+    Py_DECREF(frameCode);
+    return isWithin;
+#else
+    return reinterpret_cast<PyObject*>(frame->f_code) == functionCode;
+#endif
+  }
+
+  mutable std::array<Entry, N> entries_{};
+};
+
+/// Index signifying that a method's override is not cached.
+inline constexpr std::size_t kUncachedOverride = std::numeric_limits<std::size_t>::max();
+
+/// Whether the given trampoline has opted in to an OverrideCache.
+template <class Trampoline, class = void>
+struct HasOverrideCache : std::false_type {};
+
+template <class Trampoline>
+struct HasOverrideCache<Trampoline, std::void_t<decltype(Trampoline::kOverridableMethods)>>
+    : std::true_type {};
+
+/**
+ * Get the index of a method in the `kOverridableMethods` of a
+ * trampoline.
+ *
+ * @return Index of the method, or kUncachedOverride if the trampoline
+ * has no OverrideCache or the method is not listed.
+ */
+template <class Trampoline>
+constexpr std::size_t overrideCacheIndex(const std::string_view name) {
+  if constexpr (HasOverrideCache<Trampoline>::value) {
+    for (std::size_t methodIdx = 0; methodIdx < Trampoline::kOverridableMethods.size();
+         ++methodIdx) {
+      if (Trampoline::kOverridableMethods[methodIdx] == name) {
+        return methodIdx;
+      }
+    }
+  }
+  return kUncachedOverride;
+}
+
+/**
+ * Determine whether a method of a trampoline may be overridden in
+ * Python, and so whether the override lookup is required.
+ *
+ * @tparam kMethodIdx Index from overrideCacheIndex.
+ * @tparam Class Type registered with pybind11.
+ * @param self Trampoline instance.
+ * @param name Name of the Python method.
+ * @return `false` only if the method is known not to be overridden.
+ */
+template <std::size_t kMethodIdx, class Class, class Trampoline>
+bool mayHaveOverride(const Trampoline* self, const char* name) {
+  if constexpr (kMethodIdx == kUncachedOverride) {
+    static_cast<void>(self);
+    static_cast<void>(name);
+    return true;
+  } else {
+    return self->overrideCache_.hasOverride(static_cast<const Class*>(self), kMethodIdx, name);
+  }
+}
+
+/**
+ * Get the Python override of a method of a trampoline, using its
+ * OverrideCache, if available, or `pybind11::get_override` otherwise.
+ *
+ * The GIL must be held.
+ *
+ * @tparam kMethodIdx Index from overrideCacheIndex.
+ * @tparam Class Type registered with pybind11.
+ * @param self Trampoline instance.
+ * @param name Name of the Python method.
+ * @return Override bound to the instance, or a null function if
+ * there is no override.
+ */
+template <std::size_t kMethodIdx, class Class, class Trampoline>
+pybind11::function getOverride(const Trampoline* self, const char* name) {
+  const auto* instance = static_cast<const Class*>(self);
+  if constexpr (kMethodIdx == kUncachedOverride) {
+    return pybind11::get_override(instance, name);
+  } else {
+    return self->overrideCache_.getOverride(instance, kMethodIdx, name);
+  }
+}
+}  // namespace python
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,26 +1,75 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
+#include <type_traits>
+
 #include <pybind11/pybind11.h>
 
 #include <openassetio/private/python/exceptions.hpp>
 
+#include "batchResults.hpp"
+#include "overrideCache.hpp"
+
 /// @note Update errorsTest.cpp if adding more override macros below.
 
+/**
+ * Index of the given method in the trampoline's OverrideCache, or
+ * `python::kUncachedOverride` if it has none. See python::OverrideCache.
+ */
+#define OPENASSETIO_PYBIND11_OVERRIDE_CACHE_INDEX(name)              \
+  openassetio::python::overrideCacheIndex<                           \
+      std::remove_cv_t<std::remove_pointer_t<decltype(this)>>>(name)
+
+/**
+ * Return the result of the given C++ fallback (base class) call,
+ * without acquiring the GIL, if the trampoline's OverrideCache (where
+ * available) records that the method is not overridden in Python.
+ *
+ * Used by the override macros below, prior to the usual lookup.
+ */
+#define OPENASSETIO_PYBIND11_RETURN_IF_NOT_OVERRIDDEN(cname, name, fallback)                   \
+  do {                                                                                         \
+    if (!openassetio::python::mayHaveOverride<OPENASSETIO_PYBIND11_OVERRIDE_CACHE_INDEX(name), \
+                                              cname>(this, name)) {                            \
+      return fallback;                                                                         \
+    }                                                                                          \
+  } while (false)
+
+/**
+ * Equivalent to PYBIND11_OVERRIDE_IMPL, except that the override is
+ * retrieved via the trampoline's OverrideCache, where available.
+ */
+#define OPENASSETIO_PYBIND11_OVERRIDE_IMPL(ret_type, cname, name, ...)                          \
+  do {                                                                                          \
+    if constexpr (OPENASSETIO_PYBIND11_OVERRIDE_CACHE_INDEX(name) ==                            \
+                  openassetio::python::kUncachedOverride) {                                     \
+      PYBIND11_OVERRIDE_IMPL(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), name, __VA_ARGS__); \
+    } else {                                                                                    \
+      const pybind11::gil_scoped_acquire gil{};                                                 \
+      if (const pybind11::function override = openassetio::python::getOverride<                 \
+              OPENASSETIO_PYBIND11_OVERRIDE_CACHE_INDEX(name), cname>(this, name)) {            \
+        return override(__VA_ARGS__).cast<ret_type>();                                          \
+      }                                                                                         \
+    }                                                                                           \
+  } while (false)
+
 /**
  * Decorate PYBIND11_OVERRIDE_NAME with exception type translation.
  */
-#define OPENASSETIO_PYBIND11_OVERRIDE_NAME(ret_type, cname, name, fn, ...)            \
-  do {                                                                                \
-    /* Must explicitly specify decorated lambda return type, since    */              \
-    /* PYBIND11_OVERRIDE_IMPL return type can be PyRetainingSharedPtr,*/              \
-    /* which confuses the compiler.                                   */              \
-    return openassetio::python::exceptions::decorateWithExceptionConverter(           \
-        [&]() -> decltype(cname::fn(__VA_ARGS__)) {                                   \
-          PYBIND11_OVERRIDE_IMPL(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), name, \
-                                 __VA_ARGS__);                                        \
-          return cname::fn(__VA_ARGS__);                                              \
-        });                                                                           \
+#define OPENASSETIO_PYBIND11_OVERRIDE_NAME(ret_type, cname, name, fn, ...)                  \
+  do {                                                                                      \
+    OPENASSETIO_PYBIND11_RETURN_IF_NOT_OVERRIDDEN(PYBIND11_TYPE(cname), name,               \
+                                                  cname::fn(__VA_ARGS__));                  \
+    /* Must explicitly specify decorated lambda return type, since    */                    \
+    /* PYBIND11_OVERRIDE_IMPL return type can be PyRetainingSharedPtr,*/                    \
+    /* which confuses the compiler.                                   */                    \
+    return openassetio::python::exceptions::decorateWithExceptionConverter(                 \
+        [&]() -> decltype(cname::fn(__VA_ARGS__)) {                                         \
+          OPENASSETIO_PYBIND11_OVERRIDE_IMPL(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), \
+                                             name, __VA_ARGS__);                            \
+          return cname::fn(__VA_ARGS__);                                                    \
+        });                                                                                 \
   } while (false)
 
 /**
@@ -47,15 +96,53 @@
  * parentheses-enclosed) are passed to the Python override
  * implementation, if one exists.
  */
-#define OPENASSETIO_PYBIND11_OVERRIDE_ARGS(Ret, Class, Fn, CppArgs, ... /* PyArgs */)         \
-  do {                                                                                        \
-    return openassetio::python::exceptions::decorateWithExceptionConverter(                   \
-        [&]() -> decltype(Class::Fn CppArgs) {                                                \
-          PYBIND11_OVERRIDE_IMPL(PYBIND11_TYPE(Ret), PYBIND11_TYPE(Class), #Fn, __VA_ARGS__); \
-          return Class::Fn CppArgs;                                                           \
-        });                                                                                   \
+#define OPENASSETIO_PYBIND11_OVERRIDE_ARGS(Ret, Class, Fn, CppArgs, ... /* PyArgs */)       \
+  do {                                                                                      \
+    OPENASSETIO_PYBIND11_RETURN_IF_NOT_OVERRIDDEN(PYBIND11_TYPE(Class), #Fn,                \
+                                                  Class::Fn CppArgs);                       \
+    return openassetio::python::exceptions::decorateWithExceptionConverter(                 \
+        [&]() -> decltype(Class::Fn CppArgs) {                                              \
+          OPENASSETIO_PYBIND11_OVERRIDE_IMPL(PYBIND11_TYPE(Ret), PYBIND11_TYPE(Class), #Fn, \
+                                             __VA_ARGS__);                                  \
+          return Class::Fn CppArgs;                                                         \
+        });                                                                                 \
+  } while (false)
+
+/**
+ * Similar to OPENASSETIO_PYBIND11_OVERRIDE_NAME, for batch methods
+ * whose Python implementation may return its results in bulk, rather
+ * than calling the success/error callbacks for each element.
+ *
+ * The SuccessCallback and ErrorCallback parameters name the callbacks
+ * that returned results are given to. They must also be included in
+ * the remaining arguments, which are passed to both the Python
+ * override and C++ fallback (base class) implementation.
+ *
+ * See `python::callBatchOverride` for the accepted return values.
+ */
+#define OPENASSETIO_PYBIND11_OVERRIDE_BATCH_NAME(cname, name, fn, SuccessCallback, ErrorCallback, \
+                                                 ...)                                             \
+  do {                                                                                            \
+    OPENASSETIO_PYBIND11_RETURN_IF_NOT_OVERRIDDEN(PYBIND11_TYPE(cname), name,                     \
+                                                  cname::fn(__VA_ARGS__));                        \
+    return openassetio::python::exceptions::decorateWithExceptionConverter([&]() {                \
+      if (openassetio::python::callBatchOverride<OPENASSETIO_PYBIND11_OVERRIDE_CACHE_INDEX(name), \
+                                                 cname>(this, name, SuccessCallback,              \
+                                                        ErrorCallback, __VA_ARGS__)) {            \
+        return;                                                                                   \
+      }                                                                                           \
+      cname::fn(__VA_ARGS__);                                                                     \
+    });                                                                                           \
   } while (false)
 
+/**
+ * Decorate OPENASSETIO_PYBIND11_OVERRIDE_BATCH_NAME, using the name of
+ * the C++ method as the name of the Python method.
+ */
+#define OPENASSETIO_PYBIND11_OVERRIDE_BATCH(cname, fn, SuccessCallback, ErrorCallback, ...) \
+  OPENASSETIO_PYBIND11_OVERRIDE_BATCH_NAME(PYBIND11_TYPE(cname), #fn, fn, SuccessCallback,  \
+                                           ErrorCallback, __VA_ARGS__)
+
 /**
  * Work around https://github.com/pybind/pybind11/issues/4878 and
  * decorate PYBIND11_OVERRIDE_PURE_NAME with exception type translation.
@@ -75,8 +162,8 @@
   do {                                                                                            \
     return openassetio::python::exceptions::decorateWithExceptionConverter(                       \
         [&]() -> decltype(cname::fn(__VA_ARGS__)) {                                               \
-          PYBIND11_OVERRIDE_IMPL(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), name,             \
-                                 __VA_ARGS__);                                                    \
+          OPENASSETIO_PYBIND11_OVERRIDE_IMPL(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), name, \
+                                             __VA_ARGS__);                                        \
           const pybind11::gil_scoped_acquire gil{};                                               \
           pybind11::pybind11_fail(                                                                \
               "Tried to call pure virtual function \"" PYBIND11_STRINGIFY(cname) "::" name "\""); \
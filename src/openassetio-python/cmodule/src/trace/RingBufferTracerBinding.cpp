@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/trace/RingBufferTracer.hpp>
+#include <openassetio/trace/TracerInterface.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerRingBufferTracer(const py::module& mod) {
+  using openassetio::trace::RingBufferTracer;
+  using openassetio::trace::RingBufferTracerPtr;
+  using openassetio::trace::TracerInterface;
+
+  py::class_<RingBufferTracer, TracerInterface, RingBufferTracerPtr> ringBufferTracer{
+      mod, "RingBufferTracer", py::is_final()};
+
+  py::class_<RingBufferTracer::Span>{ringBufferTracer, "Span"}
+      .def_readonly("name", &RingBufferTracer::Span::name)
+      .def_readonly("attributes", &RingBufferTracer::Span::attributes)
+      .def_readonly("startTime", &RingBufferTracer::Span::startTime)
+      .def_readonly("duration", &RingBufferTracer::Span::duration);
+
+  ringBufferTracer
+      .def(py::init(&RingBufferTracer::make),
+           py::arg("capacity") = RingBufferTracer::kDefaultCapacity)
+      .def("spans", &RingBufferTracer::spans, py::call_guard<py::gil_scoped_release>{})
+      .def("clear", &RingBufferTracer::clear, py::call_guard<py::gil_scoped_release>{});
+}
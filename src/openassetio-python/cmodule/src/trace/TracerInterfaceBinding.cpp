@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2023 The Foundry Visionmongers Ltd
+#include <utility>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/trace/TracerInterface.hpp>
+
+#include "../PyRetainingSharedPtr.hpp"
+#include "../_openassetio.hpp"
+#include "../overrideMacros.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trace {
+/**
+ * Trampoline class required for pybind to bind pure virtual methods
+ * and allow C++ -> Python calls via a C++ instance.
+ */
+struct PyTracerInterface : TracerInterface {
+  using TracerInterface::TracerInterface;
+
+  SpanId beginSpan(const Str& name, const InfoDictionary& attributes) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_PURE(SpanId, TracerInterface, beginSpan, name, attributes);
+  }
+
+  void endSpan(SpanId spanId, const InfoDictionary& attributes) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_PURE(void, TracerInterface, endSpan, spanId, attributes);
+  }
+};
+}  // namespace trace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+void registerTracerInterface(const py::module& mod) {
+  using openassetio::trace::PyTracerInterface;
+  using openassetio::trace::TracerInterface;
+  using openassetio::trace::TracerInterfacePtr;
+  using PyRetainingTracerInterfacePtr = openassetio::PyRetainingSharedPtr<TracerInterface>;
+
+  py::class_<TracerInterface, PyTracerInterface, TracerInterfacePtr>{mod, "TracerInterface"}
+      .def(py::init())
+      .def("beginSpan", &TracerInterface::beginSpan, py::arg("name"), py::arg("attributes"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("endSpan", &TracerInterface::endSpan, py::arg("spanId"), py::arg("attributes"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def_static(
+          "setGlobalTracer",
+          [](PyRetainingTracerInterfacePtr tracer) {
+            TracerInterface::setGlobalTracer(std::move(tracer));
+          },
+          py::arg("tracer").none(true), py::call_guard<py::gil_scoped_release>{})
+      .def_static("globalTracer", &TracerInterface::globalTracer,
+                  py::call_guard<py::gil_scoped_release>{});
+}
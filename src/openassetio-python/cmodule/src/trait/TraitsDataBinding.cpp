@@ -1,15 +1,80 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/serialization.hpp>
 
 #include "../_openassetio.hpp"
 
+namespace {
+using openassetio::trait::TraitsDatas;
+namespace property = openassetio::trait::property;
+
+/**
+ * Read-only, contiguous, one-dimensional array of values, exposed to
+ * Python via the buffer protocol, such that it can be wrapped (e.g. by
+ * `memoryview` or `numpy.asarray`) without copying.
+ *
+ * `bool` elements are stored as bytes, since `std::vector<bool>` is
+ * not contiguous.
+ */
+struct PropertyBuffer {
+  std::variant<std::vector<std::uint8_t>, std::vector<openassetio::Int>,
+               std::vector<openassetio::Float>>
+      elements;
+  /// Buffer protocol (`struct` module) format of each element.
+  std::string format;
+};
+
+/**
+ * Extract a property of a given type from each of a list of
+ * TraitsData.
+ *
+ * @tparam T Property value type.
+ * @tparam Element Storage type of each value in the buffer.
+ * @return Tuple of the values buffer and a `bool` buffer indicating
+ * whether each element had the property with the given type. Values
+ * of invalid elements are zero.
+ */
+template <class T, class Element = T>
+py::tuple extractTraitProperty(const TraitsDatas& traitsDatas,
+                               const openassetio::trait::TraitId& traitId,
+                               const property::Key& propertyKey, std::string format) {
+  std::vector<Element> values(traitsDatas.size());
+  std::vector<std::uint8_t> valid(traitsDatas.size());
+
+  for (std::size_t idx = 0; idx < traitsDatas.size(); ++idx) {
+    if (!traitsDatas[idx]) {
+      continue;
+    }
+    const property::Value* value = traitsDatas[idx]->getTraitPropertyView(traitId, propertyKey);
+    if (value == nullptr) {
+      continue;
+    }
+    if (const T* typedValue = std::get_if<T>(value)) {
+      values[idx] = static_cast<Element>(*typedValue);
+      valid[idx] = 1;
+    }
+  }
+
+  return py::make_tuple(PropertyBuffer{std::move(values), std::move(format)},
+                        PropertyBuffer{std::move(valid), "?"});
+}
+}  // namespace
+
 void registerTraitsData(const py::module& mod) {
   using openassetio::trait::TraitsData;
   using openassetio::trait::TraitsDataConstPtr;
@@ -18,28 +83,104 @@ void registerTraitsData(const py::module& mod) {
   namespace property = openassetio::trait::property;
   using MaybeValue = std::optional<property::Value>;
 
-  py::class_<TraitsData, TraitsDataPtr>(mod, "TraitsData", py::is_final())
+  py::class_<TraitsData, TraitsDataPtr> traitsData{mod, "TraitsData", py::is_final()};
+
+  py::enum_<TraitsData::MergePolicy>{traitsData, "MergePolicy"}
+      .value("kOverwrite", TraitsData::MergePolicy::kOverwrite)
+      .value("kKeepExisting", TraitsData::MergePolicy::kKeepExisting);
+
+  traitsData
       .def(py::init(static_cast<TraitsDataPtr (*)()>(&TraitsData::make)))
       .def(py::init(static_cast<TraitsDataPtr (*)(const trait::TraitSet&)>(&TraitsData::make)),
            py::arg("traitSet"))
       .def(py::init(static_cast<TraitsDataPtr (*)(const TraitsDataConstPtr&)>(&TraitsData::make)),
            py::arg("other").none(false))
       .def("traitSet", &TraitsData::traitSet)
-      .def("hasTrait", &TraitsData::hasTrait, py::arg("traitId"))
-      .def("addTrait", &TraitsData::addTrait, py::arg("traitId"))
+      .def("hasTrait",
+           static_cast<bool (TraitsData::*)(const trait::TraitId&) const>(&TraitsData::hasTrait),
+           py::arg("traitId"))
+      .def("addTrait",
+           static_cast<void (TraitsData::*)(const trait::TraitId&)>(&TraitsData::addTrait),
+           py::arg("traitId"))
       .def("addTraits", &TraitsData::addTraits, py::arg("traitSet"))
-      .def("setTraitProperty", &TraitsData::setTraitProperty, py::arg("traitId"),
-           py::arg("propertyKey"), py::arg("propertyValue").none(false))
+      .def("setTraitProperty",
+           static_cast<void (TraitsData::*)(const trait::TraitId&, const property::Key&,
+                                            property::Value)>(&TraitsData::setTraitProperty),
+           py::arg("traitId"), py::arg("propertyKey"), py::arg("propertyValue").none(false))
       .def(
           "getTraitProperty",
           [](const TraitsData& self, const trait::TraitId& traitId,
              const property::Key& propertyKey) -> MaybeValue {
-            if (property::Value out; self.getTraitProperty(&out, traitId, propertyKey)) {
-              return out;
+            // Use a view to avoid an intermediate copy of the value.
+            if (const property::Value* value = self.getTraitPropertyView(traitId, propertyKey)) {
+              return *value;
             }
             return {};
           },
           py::arg("traitId"), py::arg("propertyKey"))
-      .def("traitPropertyKeys", &TraitsData::traitPropertyKeys, py::arg("traitId"))
-      .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
+      .def("traitPropertyKeys",
+           static_cast<property::KeySet (TraitsData::*)(const trait::TraitId&) const>(
+               &TraitsData::traitPropertyKeys),
+           py::arg("traitId"))
+      .def("merge", &TraitsData::merge, py::arg("other"),
+           py::arg("policy") = TraitsData::MergePolicy::kOverwrite)
+      .def("memoryUsage", &TraitsData::memoryUsage)
+      .def(py::self == py::self)  // NOLINT(misc-redundant-expression)
+      // Pickle via the binary serialisation format.
+      .def(py::pickle(
+          [](const TraitsData& self) {
+            const trait::serialization::Bytes bytes = trait::serialization::serialize(self);
+            return py::bytes(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+          },
+          [](const py::bytes& state) {
+            const auto data = static_cast<std::string_view>(state);
+            return trait::serialization::deserialize(
+                reinterpret_cast<const std::byte*>(data.data()), data.size());
+          }));
+
+  py::class_<PropertyBuffer>(mod, "PropertyBuffer", py::is_final(), py::buffer_protocol())
+      .def("__len__",
+           [](const PropertyBuffer& self) {
+             return std::visit([](const auto& elements) { return elements.size(); },
+                               self.elements);
+           })
+      .def_buffer([](PropertyBuffer& self) {
+        return std::visit(
+            [&self](auto& elements) {
+              const auto itemSize = static_cast<py::ssize_t>(
+                  sizeof(typename std::decay_t<decltype(elements)>::value_type));
+              return py::buffer_info{elements.data(),
+                                     itemSize,
+                                     self.format,
+                                     1,
+                                     {static_cast<py::ssize_t>(elements.size())},
+                                     {itemSize},
+                                     /* readonly= */ true};
+            },
+            self.elements);
+      });
+
+  mod.def(
+      "extractTraitProperty",
+      [](const trait::TraitsDatas& traitsDatas, const trait::TraitId& traitId,
+         const property::Key& propertyKey, const py::handle& propertyType) {
+        if (propertyType.ptr() == reinterpret_cast<PyObject*>(&PyBool_Type)) {
+          return extractTraitProperty<openassetio::Bool, std::uint8_t>(traitsDatas, traitId,
+                                                                        propertyKey, "?");
+        }
+        if (propertyType.ptr() == reinterpret_cast<PyObject*>(&PyLong_Type)) {
+          return extractTraitProperty<openassetio::Int>(
+              traitsDatas, traitId, propertyKey,
+              py::format_descriptor<openassetio::Int>::format());
+        }
+        if (propertyType.ptr() == reinterpret_cast<PyObject*>(&PyFloat_Type)) {
+          return extractTraitProperty<openassetio::Float>(
+              traitsDatas, traitId, propertyKey,
+              py::format_descriptor<openassetio::Float>::format());
+        }
+        throw openassetio::errors::InputValidationException{
+            "Property type must be one of bool, int or float"};
+      },
+      py::arg("traitsDatas"), py::arg("traitId"), py::arg("propertyKey"),
+      py::arg("propertyType"));
 }
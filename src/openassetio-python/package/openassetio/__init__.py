@@ -69,12 +69,23 @@ The documentation for OpenAssetIO can be found here:
 """
 
 # pylint: disable=wrong-import-position,import-error,no-name-in-module
+import collections.abc as _collections_abc
+
 from ._openassetio import (
     constants,
+    CancellationToken,
+    ConditionalResolveResult,
     Context,
     EntityReference,
+    EntityReferenceBatch,
+    EntityReferencesView,
 )
 
+# Views are read-only sequences, so should be recognised as such.
+_collections_abc.Sequence.register(EntityReferencesView)
+
+del _collections_abc
+
 
 #
 # Deprecated: https://github.com/OpenAssetIO/OpenAssetIO/issues/1127
@@ -28,12 +28,13 @@ the @fqref{log.LoggerInterface.log} "LoggerInterface.log" signature. This
 callback will be used to output debug information. If no callback is
 set, no debug output will be produced.
 
-@todo The current logging implementation doesn't have any global
-'display severity' concept (for good reasons), this has precluded any of
-the optimisations we used to make earlying-out when we're at kInfo or
-less. Once we port this implementation to cpp, then we may wish to
-adjust how we enable/disable this functionality to avoid any unwanted
-overhead per-call.
+@note The C++ @fqref{hostApi.Manager} "Manager" natively traces its
+batch API calls as structured messages at
+@fqref{log.LoggerInterface.Severity.kDebugApi} "kDebugApi" severity,
+querying @fqref{log.LoggerInterface.isSeverityLogged}
+"isSeverityLogged" once per call to avoid any overhead when such
+messages would not be presented. These decorators remain for any
+remaining Python-only code paths.
 """
 
 # For private decorator implementation methods
@@ -30,3 +30,9 @@ ManagerFactory = _openassetio.hostApi.ManagerFactory
 HostInterface = _openassetio.hostApi.HostInterface
 ManagerImplementationFactoryInterface = _openassetio.hostApi.ManagerImplementationFactoryInterface
 EntityReferencePager = _openassetio.hostApi.EntityReferencePager
+ResolveCache = _openassetio.hostApi.ResolveCache
+ManagerMetrics = _openassetio.hostApi.ManagerMetrics
+ApiAuditor = _openassetio.hostApi.ApiAuditor
+ManagerTrafficReplayer = _openassetio.hostApi.ManagerTrafficReplayer
+ResolveCoalescer = _openassetio.hostApi.ResolveCoalescer
+PublishingSession = _openassetio.hostApi.PublishingSession
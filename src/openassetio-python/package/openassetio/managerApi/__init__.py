@@ -27,3 +27,4 @@ Host = _openassetio.managerApi.Host
 HostSession = _openassetio.managerApi.HostSession
 ManagerStateBase = _openassetio.managerApi.ManagerStateBase
 EntityReferencePagerInterface = _openassetio.managerApi.EntityReferencePagerInterface
+EntityExistenceFilter = _openassetio.managerApi.EntityExistenceFilter
@@ -18,13 +18,17 @@
 A single-class module, providing the PythonPluginSystem class.
 """
 
+import concurrent.futures
 import os.path
 import importlib.util
 import hashlib
+import json
 import sys
+import time
 import traceback
 
-from ..errors import InputValidationException
+from ..errors import ConfigurationException, InputValidationException
+from .PythonPluginSystemStartupReport import PythonPluginSystemStartupReport
 
 
 __all__ = ["PythonPluginSystem"]
@@ -42,6 +46,14 @@ class PythonPluginSystem(object):
 
     __validModuleExtensions = (".py", ".pyc")
 
+    ## Version of the persisted discovery cache format. Caches written
+    ## with a different version are ignored.
+    __discoveryCacheVersion = 1
+
+    ## Version of the plugin index format. Indexes written with a
+    ## different version are ignored.
+    __indexVersion = 1
+
     def __init__(self, logger):
         self.__logger = logger
         self.reset()
@@ -52,8 +64,26 @@ class PythonPluginSystem(object):
         """
         self.__map = {}
         self.__paths = {}
+        self.__indexMetadata = {}
+        self.__loadedPaths = set()
+        self.__loadedEntryPoints = set()
+        self.__indexLoadTime = 0.0
+        self.__startupReport = PythonPluginSystemStartupReport()
+
+    def startupReport(self):
+        """
+        Returns the time spent discovering and importing each candidate
+        plugin module since construction, or the last @ref reset.
+
+        The time taken to import each module is also logged at the
+        `kDebugApi` severity as it is loaded.
+
+        @return @ref openassetio.pluginSystem.PythonPluginSystemStartupReport
+        "PythonPluginSystemStartupReport"
+        """
+        return self.__startupReport
 
-    def scan(self, paths):
+    def scan(self, paths, maxWorkers=1, discoveryCachePath=None, identifier=None):
         """
         Searches the supplied paths for modules that define a
         PythonPluginSystemPlugin through a top-level `plugin` variable.
@@ -68,41 +98,75 @@ class PythonPluginSystem(object):
 
         @param paths `str` A list of paths to search, delimited by
         `os.pathsep`.
+
+        @param maxWorkers `int` The maximum number of threads used to
+        crawl the search paths for candidate modules. This can
+        significantly reduce scan times on high-latency (e.g. network)
+        filesystems. Candidate modules are always imported sequentially,
+        in precedence order.
+
+        @param discoveryCachePath `str` Optional path to a file used to
+        persist the candidate modules found under each search path,
+        such that subsequent scans, including those in other processes,
+        need not crawl unchanged directories. Entries are invalidated
+        by a change in the modification time of a search path or any of
+        its sub-directories. The file is created if it does not exist.
+
+        @param identifier `str` Optional identifier of the only plugin
+        of interest. If supplied, the scan stops as soon as a plugin
+        with this identifier is registered, such that no subsequent
+        modules are imported (or, when searching sequentially, paths
+        searched). Modules imported by a previous scan are not imported
+        again, so the remainder can be loaded by a later scan.
+
+        @return `bool` True if `identifier` was supplied and its plugin
+        is registered, False otherwise.
         """
         self.__logger.debug(f"PythonPluginSystem: Searching {paths}")
-
-        for path in paths.split(os.pathsep):
-            if not os.path.isdir(path):
-                self.__logger.debug(f"PythonPluginSystem: Skipping as not a directory {path}")
-
-            for item in os.listdir(path):
-                itemPath = os.path.join(path, item)
-
-                if os.path.isdir(itemPath):
-                    # The directory could be a package, check for __init__.py
-                    initFile = os.path.join(itemPath, "__init__.py")
-                    if os.path.exists(initFile):
-                        itemPath = initFile
-                    else:
-                        self.__logger.debug(
-                            "PythonPluginSystem: Ignoring as it is not a python package "
-                            f"contianing __init__.py {itemPath}"
-                        )
-                        continue
-                else:
-                    # Its a file, check if it is a .py/.pyc module
-                    _, ext = os.path.splitext(itemPath)
-                    if ext not in self.__validModuleExtensions:
-                        self.__logger.debug(
-                            f"PythonPluginSystem: Ignoring as its not a python module {itemPath}"
-                        )
-                        continue
-
+        if identifier is not None and identifier in self.__map:
+            return True
+
+        searchPaths = paths.split(os.pathsep)
+        cache = self.__readDiscoveryCache(discoveryCachePath) if discoveryCachePath else {}
+
+        def discover(path):
+            start = time.perf_counter()
+            entry, messages = self.__discover(path, cache.get(path))
+            return entry, messages, time.perf_counter() - start
+
+        if maxWorkers > 1 and len(searchPaths) > 1:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=maxWorkers) as executor:
+                discoveries = list(executor.map(discover, searchPaths))
+        else:
+            # Search lazily, so a targeted scan can stop early.
+            discoveries = (discover(path) for path in searchPaths)
+
+        updatedCache = dict(cache)
+        isFound = False
+        for path, (entry, messages, discoverTime) in zip(searchPaths, discoveries):
+            # Crawling may happen on other threads, so log here.
+            for message in messages:
+                self.__logger.debug(message)
+            updatedCache[path] = entry
+
+            for itemPath in entry["modules"]:
                 self.__logger.debug(f"PythonPluginSystem: Attempting to load {itemPath}")
+                self.__load(itemPath, discoverTime)
+                if identifier is not None and identifier in self.__map:
+                    isFound = True
+                    break
+            if isFound:
+                self.__logger.debug(
+                    f"PythonPluginSystem: Found '{identifier}', skipping remaining plug-ins"
+                )
+                break
 
-                self.__load(itemPath)
+        if discoveryCachePath and updatedCache != cache:
+            self.__writeDiscoveryCache(discoveryCachePath, updatedCache)
 
-    def scan_entry_points(self, entryPointName):
+        return isFound
+
+    def scan_entry_points(self, entryPointName, identifier=None):
         """
         Searches packages for entry points that define a
         PythonPluginSystemPlugin through a top-level `plugin` variable.
@@ -113,6 +177,10 @@ class PythonPluginSystem(object):
         @param entryPointName `str` The entry point name to search for
         (see: importlib_metadata.entry_points group).
 
+        @param identifier `str` Optional identifier of the only plugin
+        of interest. If supplied, no further entry points are loaded
+        once a plugin with this identifier is registered. See @ref scan.
+
         @returns True if entry point discovery is possible, False if
         there was a problem loading importlib_metadata.
         """
@@ -135,8 +203,22 @@ class PythonPluginSystem(object):
             f"PythonPluginSystem: Searching packages for '{entryPointName}' entry points."
         )
 
-        for entryPoint in importlib_metadata.entry_points(group=entryPointName):
+        start = time.perf_counter()
+        entryPoints = importlib_metadata.entry_points(group=entryPointName)
+        discoverTime = time.perf_counter() - start
+
+        for entryPoint in entryPoints:
+            if identifier is not None and identifier in self.__map:
+                self.__logger.debug(
+                    f"PythonPluginSystem: Found '{identifier}', skipping remaining entry points"
+                )
+                break
+            if entryPoint.value in self.__loadedEntryPoints:
+                continue
+            self.__loadedEntryPoints.add(entryPoint.value)
+
             self.__logger.debug(f"PythonPluginSystem: Found entry point in {entryPoint.name}")
+            start = time.perf_counter()
             try:
                 module = entryPoint.load()
             except Exception:  # pylint: disable=broad-except
@@ -144,18 +226,117 @@ class PythonPluginSystem(object):
                     f"PythonPluginSystem: Caught exception loading {entryPoint.name}:\n"
                     + traceback.format_exc()
                 )
+                self.__recordImport(entryPoint.name, None, discoverTime, start)
                 continue
 
             if not hasattr(module, "plugin"):
                 self.__logger.error(
                     f"PythonPluginSystem: No top-level 'plugin' variable {module.__file__}"
                 )
+                self.__recordImport(module.__file__, None, discoverTime, start)
                 continue
 
+            self.__recordImport(module.__file__, module.plugin, discoverTime, start)
             self.register(module.plugin, module.__file__)
 
         return True
 
+    def loadIndex(self, indexPath):
+        """
+        Registers the plugins listed in an index file, as written by
+        @ref writeIndex, without searching for or importing them.
+
+        The module providing each plugin is only imported when the
+        plugin is first retrieved via @ref plugin. Plugins already
+        registered take precedence over those in the index.
+
+        @param indexPath `str` Path to the index file.
+
+        @return `bool` True if the index was loaded, False if it is
+        missing or unreadable, in which case a warning is logged.
+        """
+        start = time.perf_counter()
+        try:
+            with open(indexPath, "r", encoding="utf-8") as indexFile:
+                index = json.load(indexFile)
+            if not isinstance(index, dict) or index.get("version") != self.__indexVersion:
+                raise ValueError("unsupported version")
+            entries = [
+                (entry["identifier"], entry["path"], entry.get("metadata"))
+                for entry in index["plugins"]
+            ]
+        except (OSError, ValueError, KeyError, TypeError) as exc:
+            self.__logger.warning(
+                f"PythonPluginSystem: Ignoring unreadable plug-in index {indexPath}: {exc}"
+            )
+            return False
+
+        for identifier, path, metadata in entries:
+            if identifier in self.__map:
+                self.__logger.debug(
+                    f"PythonPluginSystem: Skipping indexed plug-in '{identifier}' at '{path}'. "
+                    f"Already registered by '{self.__paths[identifier]}'"
+                )
+                continue
+            # The plugin is imported on first use.
+            self.__map[identifier] = None
+            self.__paths[identifier] = path
+            self.__indexMetadata[identifier] = metadata
+
+        self.__indexLoadTime = time.perf_counter() - start
+        self.__logger.debug(
+            f"PythonPluginSystem: Registered {len(entries)} plug-in(s) from index {indexPath}"
+        )
+        return True
+
+    def writeIndex(self, indexPath, metadata=None):
+        """
+        Writes an index of the registered plugins, and the modules that
+        provide them, such that they can later be registered by @ref
+        loadIndex without searching for them.
+
+        Plugins registered manually via @ref register, rather than
+        loaded from a module, are omitted.
+
+        @param indexPath `str` Path to the index file. The file is
+        replaced atomically.
+
+        @param metadata `Callable[[PythonPluginSystemPlugin], dict]`
+        Optional callable returning JSON-serializable static metadata
+        to store alongside each plugin in the index. See @ref
+        indexMetadata.
+
+        @exception OSError Raised if the index could not be written.
+        """
+        plugins = []
+        for identifier in self.identifiers():
+            path = self.__paths[identifier]
+            if not os.path.isfile(path):
+                self.__logger.debug(
+                    f"PythonPluginSystem: Not indexing '{identifier}' as it was not loaded "
+                    "from a module"
+                )
+                continue
+            entry = {"identifier": identifier, "path": os.path.abspath(path)}
+            if metadata is not None:
+                entry["metadata"] = metadata(self.plugin(identifier))
+            plugins.append(entry)
+
+        tmpPath = f"{indexPath}.{os.getpid()}.tmp"
+        with open(tmpPath, "w", encoding="utf-8") as indexFile:
+            json.dump({"version": self.__indexVersion, "plugins": plugins}, indexFile, indent=2)
+        os.replace(tmpPath, indexPath)
+
+    def indexMetadata(self, identifier):
+        """
+        Returns the static metadata stored alongside a plugin in the
+        index it was registered from.
+
+        @return `dict` or `None` if the plugin was not registered from
+        an index, or has no metadata.
+        """
+        return self.__indexMetadata.get(identifier)
+
     def identifiers(self):
         """
         Returns the identifiers known to the plugin system.
@@ -181,7 +362,11 @@ class PythonPluginSystem(object):
             msg = "PythonPluginSystem: No plug-in registered with the identifier '%s'" % identifier
             raise InputValidationException(msg)
 
-        return self.__map[identifier]
+        cls = self.__map[identifier]
+        if cls is None:
+            cls = self.__loadIndexed(identifier)
+
+        return cls
 
     def register(self, cls, path="<unknown>"):
         """
@@ -211,15 +396,168 @@ class PythonPluginSystem(object):
         self.__map[identifier] = cls
         self.__paths[identifier] = path
 
-    def __load(self, path):
+    def __discover(self, path, cachedEntry):
+        """
+        Finds the candidate plugin modules in a search path, reusing a
+        previously cached discovery if still valid.
+
+        This is safe to call concurrently, so messages are returned for
+        logging by the caller, rather than logged directly.
+
+        @param path `str` Directory to search.
+
+        @param cachedEntry `dict` or `None` A previous result of this
+        method for the same path.
+
+        @return `Tuple[dict, List[str]]` The discovery, suitable for
+        caching, and any debug messages.
+        """
+        messages = []
+        if not os.path.isdir(path):
+            messages.append(f"PythonPluginSystem: Skipping as not a directory {path}")
+
+        if cachedEntry is not None and self.__isDiscoveryValid(path, cachedEntry):
+            messages.append(f"PythonPluginSystem: Using cached discovery for {path}")
+            return cachedEntry, messages
+
+        modules = []
+        dirMtimes = {}
+        for item in os.listdir(path):
+            itemPath = os.path.join(path, item)
+
+            if os.path.isdir(itemPath):
+                dirMtimes[itemPath] = os.stat(itemPath).st_mtime_ns
+                # The directory could be a package, check for __init__.py
+                initFile = os.path.join(itemPath, "__init__.py")
+                if os.path.exists(initFile):
+                    itemPath = initFile
+                else:
+                    messages.append(
+                        "PythonPluginSystem: Ignoring as it is not a python package "
+                        f"contianing __init__.py {itemPath}"
+                    )
+                    continue
+            else:
+                # Its a file, check if it is a .py/.pyc module
+                _, ext = os.path.splitext(itemPath)
+                if ext not in self.__validModuleExtensions:
+                    messages.append(
+                        f"PythonPluginSystem: Ignoring as its not a python module {itemPath}"
+                    )
+                    continue
+
+            modules.append(itemPath)
+
+        entry = {"mtime": os.stat(path).st_mtime_ns, "dirs": dirMtimes, "modules": modules}
+        return entry, messages
+
+    @staticmethod
+    def __isDiscoveryValid(path, entry):
+        """
+        Checks whether a cached discovery reflects the current state of
+        the filesystem.
+        """
+        try:
+            if os.stat(path).st_mtime_ns != entry["mtime"]:
+                return False
+            for dirPath, mtime in entry["dirs"].items():
+                if os.stat(dirPath).st_mtime_ns != mtime:
+                    return False
+        except (OSError, KeyError, AttributeError):
+            return False
+        return True
+
+    def __readDiscoveryCache(self, cachePath):
+        """
+        Reads a persisted discovery cache, treating a missing or
+        unreadable cache as empty.
+        """
+        try:
+            with open(cachePath, "r", encoding="utf-8") as cacheFile:
+                cache = json.load(cacheFile)
+        except FileNotFoundError:
+            return {}
+        except (OSError, ValueError) as exc:
+            self.__logger.warning(
+                f"PythonPluginSystem: Ignoring unreadable discovery cache {cachePath}: {exc}"
+            )
+            return {}
+
+        if not isinstance(cache, dict) or cache.get("version") != self.__discoveryCacheVersion:
+            return {}
+        return cache.get("paths", {})
+
+    def __writeDiscoveryCache(self, cachePath, paths):
+        """
+        Persists the discovery cache. The file is replaced atomically,
+        so concurrent processes never observe a partially written cache.
+        """
+        tmpPath = f"{cachePath}.{os.getpid()}.tmp"
+        try:
+            with open(tmpPath, "w", encoding="utf-8") as cacheFile:
+                json.dump({"version": self.__discoveryCacheVersion, "paths": paths}, cacheFile)
+            os.replace(tmpPath, cachePath)
+        except OSError as exc:
+            self.__logger.warning(
+                f"PythonPluginSystem: Unable to write discovery cache {cachePath}: {exc}"
+            )
+
+    def __load(self, path, discoverTime):
         """
         Loads the specified python file and registers it's plugin.
         The file must expose a top-level 'plugin' variable.
 
         @param path `str` This can be either a single-file module,
         or the __init__.py at the root of a package.
+
+        @param discoverTime `float` The time taken to find the file,
+        for the startup report.
+        """
+        if path in self.__loadedPaths:
+            self.__logger.debug(f"PythonPluginSystem: Skipping as already loaded {path}")
+            return
+        self.__loadedPaths.add(path)
+
+        start = time.perf_counter()
+        plugin = self.__importPlugin(path)
+        self.__recordImport(path, plugin, discoverTime, start)
+        if plugin is not None:
+            self.register(plugin, path)
+
+    def __loadIndexed(self, identifier):
+        """
+        Imports the module providing a plugin registered from an index.
+
+        @exception errors.ConfigurationException Raised if the module
+        does not provide the plugin, e.g. if the index is out of date.
+        """
+        path = self.__paths[identifier]
+        self.__logger.debug(f"PythonPluginSystem: Loading indexed plug-in '{identifier}'")
+        start = time.perf_counter()
+        plugin = self.__importPlugin(path)
+        self.__recordImport(path, plugin, self.__indexLoadTime, start)
+
+        if plugin is None:
+            raise ConfigurationException(
+                f"PythonPluginSystem: Unable to load plug-in '{identifier}' from '{path}'"
+            )
+        if plugin.identifier() != identifier:
+            raise ConfigurationException(
+                f"PythonPluginSystem: Plug-in index is out of date, '{path}' provides "
+                f"'{plugin.identifier()}' rather than '{identifier}'"
+            )
+
+        self.__map[identifier] = plugin
+        return plugin
+
+    def __importPlugin(self, path):
         """
+        Imports the specified python file, returning its top-level
+        'plugin' variable.
 
+        @return The plugin, or `None` if the module failed to import or
+        has no plugin, in which case an error is logged.
+        """
         # Make a unique namespace to ensure the plugin identifier is
         # all that really matters
         moduleName = hashlib.md5(path.encode("utf-8")).hexdigest()
@@ -241,15 +579,31 @@ class PythonPluginSystem(object):
             self.__logger.error(
                 f"PythonPluginSystem: Caught exception loading {path}:\n" + traceback.format_exc()
             )
-            return
+            return None
 
         if not hasattr(module, "plugin"):
             self.__logger.error(f"PythonPluginSystem: No top-level 'plugin' variable {path}")
-            return
+            return None
 
         # Store where this plugin was loaded from. Not entirely
         # accurate, but more useful for debugging than it not being
         # there.
         module.plugin.__file__ = path
 
-        self.register(module.plugin, path)
+        return module.plugin
+
+    def __recordImport(self, path, plugin, discoverTime, start):
+        """
+        Adds a module that was imported from `start` until now to the
+        startup report, logging the time taken.
+
+        @param plugin The module's plugin, or `None` if it failed to
+        provide one.
+        """
+        importTime = time.perf_counter() - start
+        identifier = plugin.identifier() if plugin is not None else None
+        self.__startupReport.addEntry(path, identifier, discoverTime, importTime)
+        self.__logger.debugApi(
+            f"PythonPluginSystem: Imported {path} in {importTime * 1000:.3f}ms "
+            f"(discovered in {discoverTime * 1000:.3f}ms)"
+        )
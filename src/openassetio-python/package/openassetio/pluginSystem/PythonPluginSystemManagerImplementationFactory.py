@@ -20,8 +20,9 @@ PythonPluginSystemManagerImplementationFactory class.
 """
 
 import os
+import time
 
-from ..hostApi import ManagerImplementationFactoryInterface
+from ..hostApi import ManagerFactory, ManagerImplementationFactoryInterface
 
 from .PythonPluginSystem import PythonPluginSystem
 
@@ -58,18 +59,52 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
     it is not in use, to avoid unnecessary filesystem access during
     library initialization. **OPENASSETIO_PLUGIN_PATH** plugins take
     precedence over any entry point based ones.
+
+    @envvar **OPENASSETIO_PLUGIN_DISCOVERY_CACHE** *str* Path to a file
+    used to persist the results of searching
+    **OPENASSETIO_PLUGIN_PATH** between processes, such that unchanged
+    directories need not be crawled again. See @ref
+    openassetio.pluginSystem.PythonPluginSystem.PythonPluginSystem.scan
+    "PythonPluginSystem.scan".
+
+    When only a single plugin is required, and @ref identifiers has not
+    been called, @ref instantiate stops searching as soon as that
+    plugin is found, leaving any remaining plugins unloaded. Hosts
+    using the @fqref{hostApi.ManagerFactory.defaultManagerForInterface}
+    "default manager config" therefore only load the configured plugin.
+
+    @envvar **OPENASSETIO_PLUGIN_INDEX** *str* Path to a plugin index
+    file, as written by @ref writeIndex. When set, and the index is
+    readable, the plugins listed in the index are used instead of
+    searching **OPENASSETIO_PLUGIN_PATH** and package entry points,
+    such that @ref identifiers and @ref details need not touch the
+    plugin directories at all. Each plugin is only imported when it is
+    first instantiated. The index can be generated with
+    `python -m openassetio.pluginSystem --write-index <path>`.
     """
 
     ## The Environment Variable to read the plug-in search path from
     kPluginEnvVar = "OPENASSETIO_PLUGIN_PATH"
     ## The Environment Variable to control the discovery of entry point based plugins
     kDisableEntryPointsEnvVar = "OPENASSETIO_DISABLE_ENTRYPOINTS_PLUGINS"
+    ## The Environment Variable to read the plug-in discovery cache path from
+    kDiscoveryCacheEnvVar = "OPENASSETIO_PLUGIN_DISCOVERY_CACHE"
+    ## The Environment Variable to read the plug-in index path from
+    kPluginIndexEnvVar = "OPENASSETIO_PLUGIN_INDEX"
 
     ## The name of the ManagerPlugin entry point for entry point
     ## discovered plugins.
     kPackageEntryPointGroup = "openassetio.manager_plugin"
 
-    def __init__(self, logger, paths=None, disableEntryPointsPlugins=None):
+    def __init__(
+        self,
+        logger,
+        paths=None,
+        disableEntryPointsPlugins=None,
+        maxScanWorkers=1,
+        discoveryCachePath=None,
+        indexPath=None,
+    ):
         """
         Creates a new factory. The factory scans for plugins lazily on
         the first invocation of @ref identifiers or @ref instantiate.
@@ -85,11 +120,23 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
         package entry point based plugin discovery is allowed. Defaults
         to False unless the @ref kDisableEntryPointsEnvVar environment
         variable is set.
+
+        @param maxScanWorkers `int` The maximum number of threads used
+        to search paths concurrently.
+
+        @param discoveryCachePath `str` Path to a file used to persist
+        path search results between processes. Defaults to the value of
+        the @ref kDiscoveryCacheEnvVar environment variable, if set.
+
+        @param indexPath `str` Path to a plugin index file to use in
+        place of searching for plugins. Defaults to the value of the
+        @ref kPluginIndexEnvVar environment variable, if set.
         """
 
         super(PythonPluginSystemManagerImplementationFactory, self).__init__(logger)
 
         self.__pluginManager = None
+        self.__isFullyScanned = False
 
         if paths is None:
             paths = os.environ.get(self.kPluginEnvVar, "")
@@ -99,32 +146,66 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
             disableEntryPointsPlugins = os.environ.get(self.kDisableEntryPointsEnvVar, False)
         self.__disableEntryPointsPlugins = disableEntryPointsPlugins
 
-    def __scan(self):
+        self.__maxScanWorkers = maxScanWorkers
+
+        if discoveryCachePath is None:
+            discoveryCachePath = os.environ.get(self.kDiscoveryCacheEnvVar) or None
+        self.__discoveryCachePath = discoveryCachePath
+
+        if indexPath is None:
+            indexPath = os.environ.get(self.kPluginIndexEnvVar) or None
+        self.__indexPath = indexPath
+
+    def __scan(self, identifier=None):
         """
         Scans for PythonPluginSystemManagerPlugins, and registers them
         with the factory instance.
+
+        @param identifier `str` If supplied, the scan stops as soon as
+        the plugin with this identifier is registered, and may be
+        resumed by a subsequent call.
         """
-        # Construct this here, so we have this even if we early out
-        self.__pluginManager = PythonPluginSystem(self._logger)
-
-        if not self.__paths and self.__disableEntryPointsPlugins:
-            self._logger.log(
-                self._logger.Severity.kWarning,
-                "No search paths specified and entry point plugins are disabled, no plugins "
-                f"will load - check ${self.kPluginEnvVar} is set.",
-            )
-            return
+        if self.__pluginManager is None:
+            # Construct this here, so we have this even if we early out
+            self.__pluginManager = PythonPluginSystem(self._logger)
+
+            # Falls back to searching if the index is unusable.
+            if self.__indexPath and self.__pluginManager.loadIndex(self.__indexPath):
+                self.__isFullyScanned = True
+                return
+
+            if not self.__paths and self.__disableEntryPointsPlugins:
+                self._logger.log(
+                    self._logger.Severity.kWarning,
+                    "No search paths specified and entry point plugins are disabled, no plugins "
+                    f"will load - check ${self.kPluginEnvVar} is set.",
+                )
+                self.__isFullyScanned = True
+                return
 
         # We scan custom paths first, so they take precedence over entry
         # point plugins
 
         if self.__paths:
-            self.__pluginManager.scan(self.__paths)
+            isFound = self.__pluginManager.scan(
+                self.__paths,
+                maxWorkers=self.__maxScanWorkers,
+                discoveryCachePath=self.__discoveryCachePath,
+                identifier=identifier,
+            )
+            if isFound:
+                return
 
         if self.__disableEntryPointsPlugins:
             self._logger.debug("Entry point based plugins are disabled")
         else:
-            self.__pluginManager.scan_entry_points(self.kPackageEntryPointGroup)
+            self.__pluginManager.scan_entry_points(
+                self.kPackageEntryPointGroup, identifier=identifier
+            )
+            if identifier is not None and identifier in self.__pluginManager.identifiers():
+                return
+
+        self.__isFullyScanned = True
 
     def identifiers(self):
         """
@@ -132,7 +213,7 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
         @see @ref openassetio.pluginSystem.PythonPluginSystemManagerPlugin
         "PythonPluginSystemManagerPlugin"
         """
-        if not self.__pluginManager:
+        if not self.__isFullyScanned:
             self.__scan()
 
         return self.__pluginManager.identifiers()
@@ -155,11 +236,102 @@ class PythonPluginSystemManagerImplementationFactory(ManagerImplementationFactor
         no `interface` method.
         """
 
-        if not self.__pluginManager:
-            self.__scan()
+        if not self.__isFullyScanned and (
+            self.__pluginManager is None or identifier not in self.__pluginManager.identifiers()
+        ):
+            self.__scan(identifier)
 
         self._logger.log(self._logger.Severity.kDebug, f"Instantiating {identifier}")
         plugin = self.__pluginManager.plugin(identifier)
+
+        start = time.perf_counter()
         interface = plugin.interface()
+        instantiateTime = time.perf_counter() - start
+
+        self.__pluginManager.startupReport().recordInstantiation(identifier, instantiateTime)
+        self._logger.log(
+            self._logger.Severity.kDebugApi,
+            f"Instantiated {identifier} in {instantiateTime * 1000:.3f}ms",
+        )
 
         return interface
+
+    def startupReport(self):
+        """
+        Retrieves the time spent discovering, importing and
+        instantiating each plugin loaded by the factory. If no plugins
+        have been loaded yet, they are first scanned for.
+
+        @returns @ref openassetio.pluginSystem.PythonPluginSystemStartupReport
+        "PythonPluginSystemStartupReport"
+
+        @see @ref openassetio.pluginSystem.PythonPluginSystem.PythonPluginSystem.startupReport
+        "PythonPluginSystem.startupReport"
+        """
+        if self.__pluginManager is None:
+            self.__scan()
+
+        return self.__pluginManager.startupReport()
+
+    def details(self, identifier):
+        """
+        Retrieves the details of the
+        @fqref{managerApi.ManagerInterface}"ManagerInterface"
+        with the specified identifier, as declared by its plugin,
+        without instantiating it.
+
+        @param identifier `str` The identifier of the ManagerInterface
+        to describe.
+
+        @returns @fqref{hostApi.ManagerFactory.ManagerDetail}
+        "ManagerDetail" or `None` if the plugin doesn't declare its
+        details.
+
+        @throws PluginError if the requested identifier has not been
+        registered.
+
+        @see @ref openassetio.pluginSystem.PythonPluginSystemManagerPlugin
+        "PythonPluginSystemManagerPlugin"
+        """
+        if not self.__isFullyScanned:
+            self.__scan()
+
+        metadata = self.__pluginManager.indexMetadata(identifier)
+        if metadata is not None and "details" in metadata:
+            details = metadata["details"]
+            if details is None:
+                return None
+            return ManagerFactory.ManagerDetail(
+                identifier, details["displayName"], details["info"]
+            )
+
+        plugin = self.__pluginManager.plugin(identifier)
+        # Tolerate plugins that don't derive from
+        # PythonPluginSystemManagerPlugin.
+        details = getattr(plugin, "details", None)
+        if details is None:
+            return None
+
+        return details()
+
+    def writeIndex(self, indexPath):
+        """
+        Writes an index of the plugins known to the factory, along with
+        their @ref details, for use via the @ref kPluginIndexEnvVar
+        environment variable. The index should be regenerated whenever
+        the installed plugins change.
+
+        @param indexPath `str` Path to the index file.
+
+        @exception OSError Raised if the index could not be written.
+        """
+        if not self.__isFullyScanned:
+            self.__scan()
+
+        def metadata(plugin):
+            details = self.details(plugin.identifier())
+            if details is None:
+                return {"details": None}
+            return {"details": {"displayName": details.displayName, "info": dict(details.info)}}
+
+        self.__pluginManager.writeIndex(indexPath, metadata)
@@ -19,8 +19,10 @@ A single-class module, providing the PythonPluginSystemManagerPlugin
 class.
 """
 
+import importlib
+
 from .PythonPluginSystemPlugin import PythonPluginSystemPlugin
-from ..errors import NotImplementedException
+from ..errors import ConfigurationException, InputValidationException, NotImplementedException
 
 
 # As this is an abstract interface, these are expected
@@ -44,6 +46,11 @@ class PythonPluginSystemManagerPlugin(PythonPluginSystemPlugin):
     In order to register a new asset management system, simply place a
     python package on the appropriate search path, that has a top-level
     attribute called 'plugin', that holds a class derived from this.
+
+    Plugin modules are imported when the plugin system searches for
+    plugins, so should be cheap to import. Plugins whose implementation
+    has expensive dependencies can use @ref declare to only import it
+    when the interface is first constructed.
     """
 
     @staticmethod
@@ -77,3 +84,107 @@ class PythonPluginSystemManagerPlugin(PythonPluginSystemPlugin):
         @return ManagerInterface instance
         """
         raise NotImplementedException("interface not implemented")
+
+    @classmethod
+    def details(cls):
+        """
+        Returns the details of the
+        @fqref{managerApi.ManagerInterface} "ManagerInterface", without
+        constructing it.
+
+        Plugins whose @ref interface is expensive to construct (e.g.
+        due to deferred imports or connecting to a backend) should
+        override this, so that hosts can list the available managers
+        cheaply. The details must match those that the constructed
+        interface would report.
+
+        @return @fqref{hostApi.ManagerFactory.ManagerDetail}
+        "ManagerDetail" or `None` if unknown, in which case the
+        interface will be constructed to query its details.
+        """
+        return None
+
+    @classmethod
+    def declare(cls, identifier, entryPoint, package=None, details=None):
+        """
+        Creates a plugin class that defers importing the module
+        implementing the manager until @ref interface is first called.
+
+        This allows a plugin module to be a lightweight declaration,
+        such that the cost of importing the implementation, and its
+        dependencies, is only paid by hosts that use the manager. For
+        example, in a plugin package's `__init__.py`:
+
+        @code{.py}
+        plugin = PythonPluginSystemManagerPlugin.declare(
+            "org.myorg.manager", ".implementation:MyManagerInterface", package=__name__
+        )
+        @endcode
+
+        @param identifier `str` The plugin's @ref identifier.
+
+        @param entryPoint `str` The callable that constructs the
+        @fqref{managerApi.ManagerInterface} "ManagerInterface", in the
+        form `module:attribute`, as for package entry points. The
+        attribute may be a dotted path, and is called with no
+        arguments, e.g. a ManagerInterface-derived class.
+
+        @param package `str` The name of the package that relative
+        `entryPoint` modules are resolved against. Usually `__name__`
+        of the declaring package.
+
+        @param details @fqref{hostApi.ManagerFactory.ManagerDetail}
+        "ManagerDetail" Optional details returned by @ref details,
+        such that the manager can be listed without importing its
+        implementation.
+
+        @return `type` A class derived from this class.
+
+        @exception errors.InputValidationException Raised if
+        `entryPoint` is malformed, or is relative without a `package`.
+        """
+        moduleName, _, attributePath = entryPoint.partition(":")
+        if not moduleName or not attributePath:
+            raise InputValidationException(
+                f"Plug-in entry point '{entryPoint}' is not of the form 'module:attribute'"
+            )
+        if moduleName.startswith(".") and package is None:
+            raise InputValidationException(
+                f"Plug-in entry point '{entryPoint}' is relative, but no package was given"
+            )
+
+        # Concurrent first calls may both resolve the entry point, which
+        # is harmless as Python's import machinery is thread safe.
+        resolved = []
+
+        def resolve():
+            if not resolved:
+                try:
+                    target = importlib.import_module(moduleName, package)
+                    for attributeName in attributePath.split("."):
+                        target = getattr(target, attributeName)
+                except Exception as exc:
+                    raise ConfigurationException(
+                        f"Unable to load entry point '{entryPoint}' of plug-in '{identifier}': "
+                        f"{exc}"
+                    ) from exc
+                resolved.append(target)
+            return resolved[0]
+
+        class DeclaredPlugin(cls):
+            # pylint: disable=missing-class-docstring
+
+            @classmethod
+            def identifier(cls):
+                return identifier
+
+            @classmethod
+            def interface(cls):
+                return resolve()()
+
+            @classmethod
+            def details(cls):
+                return details
+
+        DeclaredPlugin.__name__ = DeclaredPlugin.__qualname__ = f"DeclaredPlugin[{identifier}]"
+        return DeclaredPlugin
@@ -0,0 +1,113 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+@namespace openassetio.pluginSystem.PythonPluginSystemStartupReport
+A single-class module, providing the PythonPluginSystemStartupReport
+class.
+"""
+
+__all__ = ["PythonPluginSystemStartupReport"]
+
+
+class PythonPluginSystemStartupReport(object):
+    """
+    A per-plugin breakdown of the time spent by the @ref
+    openassetio.pluginSystem.PythonPluginSystem "PythonPluginSystem"
+    bringing up plugins, to help identify plugins that are slow to
+    start.
+
+    All times are in seconds.
+    """
+
+    class Entry(object):
+        """
+        The startup times of a single candidate plugin module.
+        """
+
+        def __init__(self, path, identifier, discoverTime, importTime):
+            ## `str` The module or entry point the plugin was loaded
+            ## from.
+            self.path = path
+            ## `str` The identifier of the plugin, or `None` if the
+            ## module failed to provide a plugin.
+            self.identifier = identifier
+            ## `float` The time taken to find the plugin's module. For
+            ## search path plugins, this is the time taken to search
+            ## the path containing it. For entry point plugins, this is
+            ## the time taken to query the available entry points.
+            self.discoverTime = discoverTime
+            ## `float` The time taken to import the plugin's module.
+            self.importTime = importTime
+            ## `float` The time taken to construct the plugin's
+            ## interface, or `None` if it has not been instantiated.
+            self.instantiateTime = None
+
+        def __repr__(self):
+            return (
+                f"Entry(path={self.path!r}, identifier={self.identifier!r}, "
+                f"discoverTime={self.discoverTime}, importTime={self.importTime}, "
+                f"instantiateTime={self.instantiateTime})"
+            )
+
+    def __init__(self):
+        self.__entries = []
+
+    def entries(self):
+        """
+        Returns the startup times of each candidate plugin module, in
+        the order they were loaded.
+
+        @return `List[Entry]`
+        """
+        return list(self.__entries)
+
+    def entry(self, identifier):
+        """
+        Returns the startup times of the plugin registered with the
+        given identifier.
+
+        @return `Entry` or `None` if no plugin with the identifier has
+        been loaded.
+        """
+        for entry in self.__entries:
+            # Only the first plugin with any given identifier is
+            # registered.
+            if entry.identifier == identifier:
+                return entry
+        return None
+
+    def addEntry(self, path, identifier, discoverTime, importTime):
+        """
+        Records the startup times of a candidate plugin module.
+
+        @return `Entry` The new entry.
+        """
+        entry = self.Entry(path, identifier, discoverTime, importTime)
+        self.__entries.append(entry)
+        return entry
+
+    def recordInstantiation(self, identifier, instantiateTime):
+        """
+        Records the time taken to construct the interface of the plugin
+        registered with the given identifier. Subsequent instantiations
+        overwrite the time recorded.
+
+        Plugins that were registered manually, rather than loaded by
+        the plugin system, are ignored.
+        """
+        entry = self.entry(identifier)
+        if entry is not None:
+            entry.instantiateTime = instantiateTime
@@ -23,6 +23,7 @@ openassetio package.
 from .PythonPluginSystemManagerPlugin import PythonPluginSystemManagerPlugin
 from .PythonPluginSystem import PythonPluginSystem
 from .PythonPluginSystemPlugin import PythonPluginSystemPlugin
+from .PythonPluginSystemStartupReport import PythonPluginSystemStartupReport
 from .PythonPluginSystemManagerImplementationFactory import (
     PythonPluginSystemManagerImplementationFactory,
 )
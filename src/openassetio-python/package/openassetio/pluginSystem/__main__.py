@@ -0,0 +1,63 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Entry point for command-line generation of a Python manager plugin
+index.
+"""
+
+# pylint: disable=invalid-name
+
+import argparse
+import inspect
+import sys
+
+from openassetio.log import ConsoleLogger, SeverityFilter
+from openassetio.pluginSystem import PythonPluginSystemManagerImplementationFactory
+
+
+cmdline = argparse.ArgumentParser(
+    prog="openassetio.pluginSystem",
+    formatter_class=argparse.RawDescriptionHelpFormatter,
+    description=inspect.cleandoc(
+        """
+                Writes an index of the manager plugins found under
+                OPENASSETIO_PLUGIN_PATH and package entry points, such that
+                subsequent processes can list and load them without searching
+                for them, by setting OPENASSETIO_PLUGIN_INDEX to the index path.
+
+                The index must be regenerated whenever the installed plugins
+                change.
+                """
+    ),
+)
+
+cmdline.add_argument(
+    "-o", "--write-index", metavar="FILE", required=True, help="Path to write the index to"
+)
+
+#
+# Main
+#
+
+args = cmdline.parse_args(sys.argv[1:])
+
+# Never generate an index from an existing index.
+factory = PythonPluginSystemManagerImplementationFactory(
+    SeverityFilter(ConsoleLogger()), indexPath=""
+)
+factory.writeIndex(args.write_index)
+
+print(f"Indexed {len(factory.identifiers())} plugin(s) to {args.write_index}")
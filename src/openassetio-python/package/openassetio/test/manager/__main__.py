@@ -22,9 +22,10 @@ harness.
 
 import argparse
 import inspect
+import json
 import sys
 
-from openassetio.test.manager import harness, apiComplianceSuite
+from openassetio.test.manager import benchmark, harness, apiComplianceSuite
 
 
 cmdline = argparse.ArgumentParser(
@@ -73,6 +74,22 @@ cmdline = argparse.ArgumentParser(
 
                 NOTE: Fixture names should only contain alpha-numeric characters
                 and underscores.
+
+                When executed with --workers N, the suite's test cases are sharded
+                across N worker processes, each with its own manager, and their
+                results combined. This can greatly reduce the run time against
+                managers with high per-call latency.
+
+                When executed with --benchmark, the compliance suite is not run.
+                Instead, batched API calls built from the same fixtures are issued
+                by one or more concurrent clients, and a JSON report of throughput,
+                latency percentiles and memory growth is written. See
+                openassetio.test.manager.benchmark for the report structure.
+
+                When executed with --replay, a log of manager traffic, captured
+                from a host by a RecordingManagerInterface, is instead replayed
+                against the manager, and a JSON report of each method's calls and
+                durations is written.
                 """
     ),
 )
@@ -81,6 +98,76 @@ cmdline.add_argument(
     "-f", "--fixtures", metavar="FILE", required=True, help="Path to Python fixtures file"
 )
 
+cmdline.add_argument(
+    "-j",
+    "--workers",
+    metavar="N",
+    type=int,
+    default=1,
+    help="Number of worker processes to run the test suite's test cases across, each with its "
+    "own manager (default: %(default)s)",
+)
+
+benchmarkArgs = cmdline.add_argument_group("benchmark mode")
+benchmarkArgs.add_argument(
+    "--benchmark",
+    action="store_true",
+    help="Profile the manager under load rather than running the test suite",
+)
+benchmarkArgs.add_argument(
+    "--batch-sizes",
+    metavar="N",
+    type=int,
+    nargs="+",
+    default=list(benchmark.kDefaultBatchSizes),
+    help="Number of elements in each batched call (default: %(default)s)",
+)
+benchmarkArgs.add_argument(
+    "--clients",
+    metavar="N",
+    type=int,
+    default=1,
+    help="Number of concurrent client threads (default: %(default)s)",
+)
+benchmarkArgs.add_argument(
+    "--iterations",
+    metavar="N",
+    type=int,
+    default=20,
+    help="Timed calls per client, per workload and batch size (default: %(default)s)",
+)
+benchmarkArgs.add_argument(
+    "--warmup",
+    metavar="N",
+    type=int,
+    default=2,
+    help="Untimed calls per client before timing begins (default: %(default)s)",
+)
+benchmarkArgs.add_argument(
+    "--report",
+    metavar="FILE",
+    help="Path to write the JSON report to (default: standard out)",
+)
+
+replayArgs = cmdline.add_argument_group("replay mode")
+replayArgs.add_argument(
+    "--replay",
+    metavar="LOG",
+    help="Replay a log of recorded manager traffic rather than running the test suite",
+)
+replayArgs.add_argument(
+    "--replay-rate",
+    metavar="RATE",
+    type=float,
+    default=1.0,
+    help="Multiple of the recorded rate to replay at, or 0 for no delay (default: %(default)s)",
+)
+replayArgs.add_argument(
+    "--replay-publishing",
+    action="store_true",
+    help="Replay preflight and register calls, which are skipped by default",
+)
+
 # The following "argument" is just a dummy for the help text. If
 # additional arguments are provided, `args.extraArgs` will be
 # `True`, yet those arguments will still go in the
@@ -94,6 +181,34 @@ cmdline.add_argument("extraArgs", action="store_true", help="Arguments to pass t
 args, extraArgs = cmdline.parse_known_args(sys.argv[1:])
 
 fixtures = harness.fixturesFromPyFile(args.fixtures)
-isSuccessful = harness.executeSuite(apiComplianceSuite, fixtures, extraArgs)
+
+if args.benchmark or args.replay:
+    if args.replay:
+        report = benchmark.executeReplay(
+            fixtures,
+            args.replay,
+            rate=args.replay_rate,
+            replayPublishing=args.replay_publishing,
+        )
+        isSuccessful = True
+    else:
+        report = benchmark.executeBenchmark(
+            fixtures,
+            batchSizes=args.batch_sizes,
+            clients=args.clients,
+            iterations=args.iterations,
+            warmupIterations=args.warmup,
+        )
+        isSuccessful = not any(result["errors"] for result in report["results"])
+    if args.report:
+        with open(args.report, "w", encoding="utf-8") as reportFile:
+            json.dump(report, reportFile, indent=2)
+    else:
+        json.dump(report, sys.stdout, indent=2)
+        sys.stdout.write("\n")
+else:
+    isSuccessful = harness.executeSuite(
+        apiComplianceSuite, fixtures, extraArgs, workers=args.workers
+    )
 
 sys.exit(int(not isSuccessful))
@@ -18,6 +18,12 @@
 Private implementation classes for the manager test framework.
 @private
 """
+import concurrent.futures
+import importlib
+import io
+import sys
+import time
+import traceback
 import unittest
 
 from openassetio import hostApi, log, pluginSystem
@@ -25,7 +31,7 @@ from openassetio.trait import TraitsData
 from .. import kTestHarnessTraitId, kCasePropertyKey
 
 
-__all__ = ["createHarness"]
+__all__ = ["createHarness", "createManagerFactory", "executeTestsInParallel"]
 
 
 def createHarness(managerIdentifier, settings=None):
@@ -33,6 +39,20 @@ def createHarness(managerIdentifier, settings=None):
     Create the test harness used begin test case execution.
     @private
     """
+    loader = _ValidatorTestLoader(createManagerFactory(managerIdentifier, settings))
+    return _ValidatorHarness(unittest.main, loader)
+
+
+def createManagerFactory(managerIdentifier, settings=None):
+    """
+    Create a callable that constructs new @fqref{hostApi.Manager}
+    "Manager" instances for the specified manager plugin, using the
+    harness host.
+
+    @return A callable taking one kwarg 'initialize', see
+    _ValidatorTestLoader.
+    @private
+    """
     if settings is None:
         settings = {}
 
@@ -50,8 +70,181 @@ def createHarness(managerIdentifier, settings=None):
             manager.initialize(settings)
         return manager
 
-    loader = _ValidatorTestLoader(createManager)
-    return _ValidatorHarness(unittest.main, loader)
+    return createManager
+
+
+def executeTestsInParallel(module, fixtures, extraArgs, workers):
+    """
+    Run the test cases in the provided `module`, sharded by test case
+    class across worker processes, writing the combined output to
+    `stderr`.
+
+    Each worker process creates its own harness, and so its own
+    manager(s), from the fixtures. Test case classes are handed out to
+    workers as they become free, and each class's output is written
+    once it completes, in name order, as for unittest.
+
+    @param module `types.ModuleType` Python module containing the test
+    cases to execute. It must be importable by name, or have been
+    loaded from a file, in each worker process.
+
+    @param fixtures `dict` Fixtures for the tests, which must be
+    picklable. See harness.executeSuite for structure.
+
+    @param extraArgs `List[str]` Arguments to pass to the unittest
+    runner in each worker. Test names cannot be given, but `-k` may be
+    used to select tests.
+
+    @param workers `int` The maximum number of worker processes.
+
+    @return `bool` `True` if all tests succeeded, `False` otherwise.
+    @private
+    """
+    plainLoader = unittest.loader.TestLoader()
+    testCaseNames = [
+        name
+        for name, value in vars(module).items()
+        if isinstance(value, type)
+        and issubclass(value, unittest.TestCase)
+        and plainLoader.getTestCaseNames(value)
+    ]
+    testCaseNames.sort()
+
+    _workerState["parentModule"] = module
+    try:
+        return _executeTestCasesInWorkers(module, fixtures, extraArgs, workers, testCaseNames)
+    finally:
+        _workerState.pop("parentModule", None)
+
+
+def _executeTestCasesInWorkers(module, fixtures, extraArgs, workers, testCaseNames):
+    """
+    Implementation of executeTestsInParallel, once the test case
+    classes are known.
+
+    @private
+    """
+    stream = sys.stderr
+    totals = dict.fromkeys(
+        ("testsRun", "failures", "errors", "skipped", "expectedFailures", "unexpectedSuccesses"),
+        0,
+    )
+    isSuccessful = True
+    start = time.perf_counter()
+
+    with concurrent.futures.ProcessPoolExecutor(
+        max_workers=max(1, min(workers, len(testCaseNames))),
+        initializer=_initWorker,
+        initargs=(module.__name__, getattr(module, "__file__", None), fixtures),
+    ) as executor:
+        futures = [
+            executor.submit(_executeTestCase, testCaseName, extraArgs)
+            for testCaseName in testCaseNames
+        ]
+        for testCaseName, future in zip(testCaseNames, futures):
+            try:
+                shard = future.result()
+            except Exception:  # pylint: disable=broad-except
+                # E.g. the worker could not create a manager, or died.
+                shard = dict.fromkeys(totals, 0)
+                shard["errors"] = 1
+                shard["wasSuccessful"] = False
+                shard["output"] = (
+                    f"ERROR: Unable to run {testCaseName} in a worker process:\n"
+                    + traceback.format_exc()
+                )
+            # Omit classes whose tests were all deselected, e.g. by -k.
+            if shard["testsRun"] or not shard["wasSuccessful"]:
+                stream.write(shard["output"])
+            isSuccessful = isSuccessful and shard["wasSuccessful"]
+            for key in totals:
+                totals[key] += shard[key]
+
+    elapsed = time.perf_counter() - start
+    stream.write(unittest.TextTestResult.separator1 + "\n")
+    stream.write(
+        f"Ran {totals['testsRun']} test{'' if totals['testsRun'] == 1 else 's'} from "
+        f"{len(testCaseNames)} test cases in "
+        f"{elapsed:.3f}s using up to {workers} worker processes\n\n"
+    )
+    counts = ", ".join(
+        f"{key}={totals[key]}"
+        for key in ("failures", "errors", "skipped", "expectedFailures", "unexpectedSuccesses")
+        if totals[key]
+    )
+    status = "OK" if isSuccessful else "FAILED"
+    stream.write(f"{status} ({counts})\n" if counts else f"{status}\n")
+    stream.flush()
+    return isSuccessful
+
+
+## State of a parallel test worker process, see _initWorker.
+_workerState = {}
+
+
+def _initWorker(moduleName, modulePath, fixtures):
+    """
+    Initializes a parallel test worker process, creating the harness
+    loader, and so shared manager, used for all of its test cases.
+
+    @private
+    """
+    # When worker processes are forked, the parent's module is
+    # inherited, otherwise find the same module by name or file.
+    module = _workerState.get("parentModule")
+    if module is None:
+        try:
+            module = importlib.import_module(moduleName)
+        except ImportError:
+            module = None
+        if module is None or getattr(module, "__file__", None) != modulePath:
+            if modulePath is None:
+                raise ImportError(f"Unable to import test suite module '{moduleName}'")
+            # Deferred to avoid a circular import.
+            from .harness import moduleFromFile  # pylint: disable=import-outside-toplevel
+
+            module = moduleFromFile(modulePath)
+
+    loader = _ValidatorTestLoader(
+        createManagerFactory(fixtures["identifier"], fixtures.get("settings"))
+    )
+    loader.setFixtures(fixtures)
+    _workerState["module"] = module
+    _workerState["loader"] = loader
+
+
+def _executeTestCase(testCaseName, extraArgs):
+    """
+    Runs the tests of a single test case class in a parallel test
+    worker process.
+
+    @return `dict` The output and counts of the test run, such that
+    they can be returned to the parent process.
+    @private
+    """
+    stream = io.StringIO()
+    argv = [_ValidatorHarness._kValidatorHarnessProgramName]  # pylint: disable=protected-access
+    if extraArgs:
+        argv.extend(extraArgs)
+    argv.append(testCaseName)
+    program = unittest.main(
+        module=_workerState["module"],
+        argv=argv,
+        testLoader=_workerState["loader"],
+        testRunner=unittest.TextTestRunner(stream=stream, verbosity=2),
+        exit=False,
+    )
+    result = program.result
+    return {
+        "output": stream.getvalue(),
+        "testsRun": result.testsRun,
+        "failures": len(result.failures),
+        "errors": len(result.errors),
+        "skipped": len(result.skipped),
+        "expectedFailures": len(result.expectedFailures),
+        "unexpectedSuccesses": len(result.unexpectedSuccesses),
+        "wasSuccessful": result.wasSuccessful(),
+    }
 
 
 class _ValidatorHarness:
@@ -0,0 +1,528 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+@namespace openassetio.test.manager.benchmark
+A load-testing counterpart to the @ref harness, that profiles the
+performance of a @ref manager plugin using the same fixtures as the
+API compliance suite.
+
+Each workload issues batched API calls built from the entity references
+in the fixtures, replicated up to a configurable batch size, from one
+or more concurrent client threads sharing a single manager. Per-call
+latency, element throughput and process memory growth are recorded and
+returned as a JSON-serializable report.
+
+Alternatively, @ref executeReplay replays traffic captured from a real
+host by a `RecordingManagerInterface`, so that a manager can be
+profiled under a production load rather than a synthetic one.
+"""
+
+import gc
+import os
+import platform
+import threading
+import time
+
+from . import _implementation
+from .. import kTestHarnessTraitId, kCasePropertyKey
+from ...access import PolicyAccess, ResolveAccess
+from ...errors import InputValidationException
+from ...hostApi import Manager, ManagerTrafficReplayer
+from ...trait import TraitsData
+
+
+__all__ = ["executeBenchmark", "executeReplay", "kReportSchemaVersion"]
+
+
+## Version of the structure of the report returned by executeBenchmark.
+kReportSchemaVersion = 1
+
+## Default batch sizes used by executeBenchmark.
+kDefaultBatchSizes = (1, 10, 100, 1000)
+
+
+def executeBenchmark(
+    fixtures, batchSizes=kDefaultBatchSizes, clients=1, iterations=20, warmupIterations=2
+):
+    """
+    Profiles the manager specified by the supplied fixtures under a
+    load of batched API calls.
+
+    A workload is benchmarked for each API method below, at each of the
+    requested batch sizes. Workloads whose fixtures are not present, or
+    whose capability the manager does not advertise, are skipped.
+
+    - `resolve`: `Test_resolve` `a_reference_to_a_readable_entity` and
+      `a_set_of_valid_traits`.
+    - `entityExists`: `Test_entityExists`
+      `a_reference_to_an_existing_entity`.
+    - `isEntityReferenceString`: `Test_isEntityReferenceString`
+      `a_valid_reference`.
+    - `managementPolicy`: no fixtures required.
+
+    @param fixtures `dict` The fixtures for the manager, in the same
+    form as used by @ref harness.executeSuite.
+
+    @param batchSizes `List[int]` The number of elements in each call.
+
+    @param clients `int` The number of threads concurrently issuing
+    calls to the manager.
+
+    @param iterations `int` The number of timed calls made by each
+    client, per workload and batch size.
+
+    @param warmupIterations `int` The number of untimed calls made by
+    each client before timing begins, to exclude one-time costs such as
+    cache population.
+
+    @return `dict` A JSON-serializable report of the form:
+
+    @code{.py}
+    {
+        "schemaVersion": kReportSchemaVersion,
+        "manager": {"identifier": str, "displayName": str},
+        "environment": {"python": str, "platform": str, "cpuCount": int},
+        "config": {
+            "batchSizes": [int], "clients": int,
+            "iterations": int, "warmupIterations": int
+        },
+        "results": [
+            {
+                "workload": str,
+                "batchSize": int,
+                "calls": int,
+                "elements": int,
+                "errors": int,
+                "wallTimeSeconds": float,
+                "throughputElementsPerSecond": float,
+                "latencyNs": {
+                    "min": int, "p50": int, "p99": int, "max": int, "mean": float
+                },
+                # None if process memory usage cannot be queried.
+                "memoryGrowthBytes": Optional[int]
+            },
+            ...
+        ],
+        "skipped": [{"workload": str, "reason": str}, ...]
+    }
+    @endcode
+
+    Where `errors` counts batch element errors, calls that raised an
+    exception and, for `isEntityReferenceString`, fixture references
+    that were not recognized.
+
+    @exception errors.InputValidationException If any of the numeric
+    arguments are out of range.
+    """
+    batchSizes = list(batchSizes)
+    if not batchSizes or any(size < 1 for size in batchSizes):
+        raise InputValidationException("Batch sizes must be a non-empty list of positive integers")
+    if clients < 1:
+        raise InputValidationException("The number of clients must be at least one")
+    if iterations < 1:
+        raise InputValidationException("The number of iterations must be at least one")
+    if warmupIterations < 0:
+        raise InputValidationException("The number of warmup iterations must not be negative")
+
+    createManager = _implementation.createManagerFactory(
+        fixtures["identifier"], fixtures.get("settings")
+    )
+    manager = createManager(initialize=True)
+
+    report = {
+        "schemaVersion": kReportSchemaVersion,
+        "manager": {"identifier": manager.identifier(), "displayName": manager.displayName()},
+        "environment": {
+            "python": platform.python_version(),
+            "platform": platform.platform(),
+            "cpuCount": os.cpu_count(),
+        },
+        "config": {
+            "batchSizes": batchSizes,
+            "clients": clients,
+            "iterations": iterations,
+            "warmupIterations": warmupIterations,
+        },
+        "results": [],
+        "skipped": [],
+    }
+
+    for workload in _kWorkloads:
+        reasonToSkip = workload.reasonToSkip(manager, fixtures)
+        if reasonToSkip is not None:
+            report["skipped"].append({"workload": workload.name, "reason": reasonToSkip})
+            continue
+        for batchSize in batchSizes:
+            report["results"].append(
+                _runWorkload(
+                    manager, workload, fixtures, batchSize, clients, iterations, warmupIterations
+                )
+            )
+
+    return report
+
+
+def executeReplay(fixtures, logPath, rate=1.0, replayPublishing=False):
+    """
+    Replays a log of manager traffic against the manager specified by
+    the supplied fixtures.
+
+    Only the `identifier` and `settings` of the fixtures are used. See
+    @ref openassetio.hostApi.ManagerTrafficReplayer for how calls are
+    replayed.
+
+    @param fixtures `dict` The fixtures for the manager, in the same
+    form as used by @ref harness.executeSuite.
+
+    @param logPath `str` Path of a log written by a
+    `RecordingManagerInterface`.
+
+    @param rate `float` Multiple of the recorded rate at which to issue
+    calls, or zero to issue calls as fast as possible.
+
+    @param replayPublishing `bool` Whether to replay `preflight` and
+    `register` calls, rather than skipping them.
+
+    @return `dict` A JSON-serializable report of the form:
+
+    @code{.py}
+    {
+        "schemaVersion": kReportSchemaVersion,
+        "manager": {"identifier": str, "displayName": str},
+        "environment": {"python": str, "platform": str, "cpuCount": int},
+        "config": {"log": str, "rate": float, "replayPublishing": bool},
+        "methods": {
+            str: {
+                "calls": int,
+                "skipped": int,
+                "exceptions": int,
+                "successes": int,
+                "errors": int,
+                "recordedSeconds": float,
+                "replayedSeconds": float
+            },
+            ...
+        }
+    }
+    @endcode
+
+    @exception errors.InputValidationException If the rate is negative,
+    or the log cannot be read.
+    """
+    createManager = _implementation.createManagerFactory(
+        fixtures["identifier"], fixtures.get("settings")
+    )
+    manager = createManager(initialize=True)
+    replayer = ManagerTrafficReplayer(manager, rate, replayPublishing)
+
+    return {
+        "schemaVersion": kReportSchemaVersion,
+        "manager": {"identifier": manager.identifier(), "displayName": manager.displayName()},
+        "environment": {
+            "python": platform.python_version(),
+            "platform": platform.platform(),
+            "cpuCount": os.cpu_count(),
+        },
+        "config": {"log": str(logPath), "rate": rate, "replayPublishing": replayPublishing},
+        "methods": {
+            name: {
+                "calls": methodReport.calls,
+                "skipped": methodReport.skipped,
+                "exceptions": methodReport.exceptions,
+                "successes": methodReport.successes,
+                "errors": methodReport.errors,
+                "recordedSeconds": methodReport.recordedDuration.total_seconds(),
+                "replayedSeconds": methodReport.replayedDuration.total_seconds(),
+            }
+            for name, methodReport in replayer.replay(str(logPath)).items()
+        },
+    }
+
+
+def _runWorkload(manager, workload, fixtures, batchSize, clients, iterations, warmupIterations):
+    """
+    Run a single workload at the given batch size across all clients
+    and summarize the measurements.
+    """
+    # pylint: disable=too-many-arguments,too-many-locals
+    clientResults = [None] * clients
+    # Clients and this thread rendezvous once warmup is complete, and
+    # again to start timing together.
+    warmedUp = threading.Barrier(clients + 1)
+    started = threading.Barrier(clients + 1)
+
+    # Create each client's call up front, so that any errors in
+    # constructing the batch are raised here rather than in a thread.
+    locale = TraitsData({kTestHarnessTraitId})
+    locale.setTraitProperty(kTestHarnessTraitId, kCasePropertyKey, f"benchmark.{workload.name}")
+    clientCalls = []
+    for _ in range(clients):
+        context = manager.createContext()
+        context.locale = locale
+        clientCalls.append(workload.createCall(manager, context, fixtures, batchSize))
+
+    def client(clientIdx):
+        call = clientCalls[clientIdx]
+        errors = 0
+        for _ in range(warmupIterations):
+            errors += _invoke(call)
+        # Warmup errors are counted, but not timed.
+        warmedUp.wait()
+        started.wait()
+
+        latencies = []
+        for _ in range(iterations):
+            start = time.perf_counter_ns()
+            errors += _invoke(call)
+            latencies.append(time.perf_counter_ns() - start)
+        clientResults[clientIdx] = (latencies, errors)
+
+    threads = [threading.Thread(target=client, args=(idx,)) for idx in range(clients)]
+    for thread in threads:
+        thread.start()
+
+    # Take the memory baseline after warmup, so that one-time
+    # allocations are excluded.
+    warmedUp.wait()
+    gc.collect()
+    rssBefore = _residentSetSize()
+    start = time.perf_counter_ns()
+    started.wait()
+    for thread in threads:
+        thread.join()
+    wallTimeNs = time.perf_counter_ns() - start
+    gc.collect()
+    rssAfter = _residentSetSize()
+
+    latencies = sorted(
+        latency for clientLatencies, _ in clientResults for latency in clientLatencies
+    )
+    calls = len(latencies)
+    elements = calls * batchSize
+    wallTimeSeconds = wallTimeNs / 1e9
+
+    return {
+        "workload": workload.name,
+        "batchSize": batchSize,
+        "calls": calls,
+        "elements": elements,
+        "errors": sum(errors for _, errors in clientResults),
+        "wallTimeSeconds": wallTimeSeconds,
+        "throughputElementsPerSecond": elements / wallTimeSeconds if wallTimeSeconds else 0.0,
+        "latencyNs": {
+            "min": latencies[0],
+            "p50": _percentile(latencies, 50),
+            "p99": _percentile(latencies, 99),
+            "max": latencies[-1],
+            "mean": sum(latencies) / calls,
+        },
+        "memoryGrowthBytes": (
+            rssAfter - rssBefore if rssBefore is not None and rssAfter is not None else None
+        ),
+    }
+
+
+def _invoke(call):
+    """
+    Invoke a workload call, returning the number of errors.
+    """
+    try:
+        return call()
+    except Exception:  # pylint: disable=broad-except
+        return 1
+
+
+def _percentile(sortedValues, percent):
+    """
+    Nearest-rank percentile of an ascending list of values.
+    """
+    rank = -(-percent * len(sortedValues) // 100)  # ceil
+    return sortedValues[max(rank, 1) - 1]
+
+
+def _residentSetSize():
+    """
+    The current resident set size of this process in bytes, or `None`
+    if it cannot be determined on this platform.
+    """
+    try:
+        with open("/proc/self/statm", encoding="ascii") as statm:
+            return int(statm.read().split()[1]) * os.sysconf("SC_PAGE_SIZE")
+    except (OSError, ValueError, IndexError, AttributeError):
+        return None
+
+
+def _requireFixture(fixtures, className, fixtureName):
+    """
+    Look up a fixture for the given test case class, using the same
+    inheritance as the harness test loader. Since the benchmark is not
+    associated with a particular test method, the first method that
+    defines the fixture is used as a fallback.
+
+    @return The fixture value, or `None` if it is not defined.
+    """
+    classFixtures = fixtures.get(className, {})
+    for scope in (classFixtures.get("shared", {}), fixtures.get("shared", {})):
+        if fixtureName in scope:
+            return scope[fixtureName]
+    for methodName, methodFixtures in classFixtures.items():
+        if methodName != "shared" and fixtureName in methodFixtures:
+            return methodFixtures[fixtureName]
+    return None
+
+
+class _Workload:
+    """
+    A benchmark workload, that makes batched calls to one API method.
+
+    @private
+    """
+
+    def __init__(self, name, className, fixtureNames, capability, callFactory):
+        """
+        @param name `str` The name of the workload, as reported.
+
+        @param className `str` The apiComplianceSuite test case class
+        whose fixtures are used by this workload.
+
+        @param fixtureNames `List[str]` The fixtures required.
+
+        @param capability `Optional[Manager.Capability]` Capability the
+        manager must have, if any.
+
+        @param callFactory A callable taking the manager, context,
+        dict of required fixture values and batch size, returning a
+        callable that makes a single call and returns the number of
+        element errors.
+        """
+        # pylint: disable=too-many-arguments
+        self.name = name
+        self.__className = className
+        self.__fixtureNames = fixtureNames
+        self.__capability = capability
+        self.__callFactory = callFactory
+
+    def reasonToSkip(self, manager, fixtures):
+        """
+        @return `Optional[str]` Why this workload cannot be run, or
+        `None` if it can.
+        """
+        if self.__capability is not None and not manager.hasCapability(self.__capability):
+            return f"Manager does not have capability {self.__capability.name}"
+        for fixtureName in self.__fixtureNames:
+            if _requireFixture(fixtures, self.__className, fixtureName) is None:
+                return f"Missing fixture '{fixtureName}' for {self.__className}"
+        return None
+
+    def createCall(self, manager, context, fixtures, batchSize):
+        """
+        @return A callable that makes a single call of `batchSize`
+        elements, returning the number of element errors.
+        """
+        values = {
+            fixtureName: _requireFixture(fixtures, self.__className, fixtureName)
+            for fixtureName in self.__fixtureNames
+        }
+        return self.__callFactory(manager, context, values, batchSize)
+
+
+class _ErrorCounter:
+    """
+    Batch element error callback that counts the errors it receives.
+
+    @private
+    """
+
+    # pylint: disable=too-few-public-methods
+
+    def __init__(self):
+        self.count = 0
+
+    def __call__(self, _idx, _error):
+        self.count += 1
+
+
+def _noop(_idx, _value):
+    pass
+
+
+def _resolveCall(manager, context, values, batchSize):
+    refs = [manager.createEntityReference(values["a_reference_to_a_readable_entity"])] * batchSize
+    traitSet = values["a_set_of_valid_traits"]
+
+    def call():
+        errorCounter = _ErrorCounter()
+        manager.resolve(refs, traitSet, ResolveAccess.kRead, context, _noop, errorCounter)
+        return errorCounter.count
+
+    return call
+
+
+def _entityExistsCall(manager, context, values, batchSize):
+    refs = [manager.createEntityReference(values["a_reference_to_an_existing_entity"])] * batchSize
+
+    def call():
+        errorCounter = _ErrorCounter()
+        manager.entityExists(refs, context, _noop, errorCounter)
+        return errorCounter.count
+
+    return call
+
+
+def _isEntityReferenceStringCall(manager, _context, values, batchSize):
+    refString = values["a_valid_reference"]
+
+    def call():
+        # Not a batch method, so a batch is a series of calls.
+        return sum(not manager.isEntityReferenceString(refString) for _ in range(batchSize))
+
+    return call
+
+
+def _managementPolicyCall(manager, context, _values, batchSize):
+    traitSets = [{"entity"}] * batchSize
+
+    def call():
+        policies = manager.managementPolicy(traitSets, PolicyAccess.kRead, context)
+        return 0 if len(policies) == batchSize else 1
+
+    return call
+
+
+_kWorkloads = (
+    _Workload(
+        "resolve",
+        "Test_resolve",
+        ["a_reference_to_a_readable_entity", "a_set_of_valid_traits"],
+        Manager.Capability.kResolution,
+        _resolveCall,
+    ),
+    _Workload(
+        "entityExists",
+        "Test_entityExists",
+        ["a_reference_to_an_existing_entity"],
+        Manager.Capability.kExistenceQueries,
+        _entityExistsCall,
+    ),
+    _Workload(
+        "isEntityReferenceString",
+        "Test_isEntityReferenceString",
+        ["a_valid_reference"],
+        None,
+        _isEntityReferenceStringCall,
+    ),
+    _Workload("managementPolicy", "Test_managementPolicy", [], None, _managementPolicyCall),
+)
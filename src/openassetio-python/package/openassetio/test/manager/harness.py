@@ -37,7 +37,7 @@ from ...errors import ConfigurationException, InputValidationException
 __all__ = ["executeSuite", "fixturesFromPyFile", "moduleFromFile", "FixtureAugmentedTestCase"]
 
 
-def executeSuite(testSuiteModule, fixtures, unittestExtraArgs=None):
+def executeSuite(testSuiteModule, fixtures, unittestExtraArgs=None, workers=1):
     """
     Executes the supplied test suite with the given fixtures, optionally
     passing extra arguments to the underlying unittest framework.
@@ -51,6 +51,15 @@ def executeSuite(testSuiteModule, fixtures, unittestExtraArgs=None):
     @param unittestExtraArgs `List[str]` Additional args to pass to the
     `unittest` framework, see `unittest.main` `argv` for more details.
 
+    @param workers `int` The number of worker processes to run the
+    suite's test case classes across. When greater than one, each
+    worker process creates its own manager from the fixtures, and the
+    results of all workers are combined. This reduces the run time of
+    suites dominated by manager latency, e.g. for remote managers. In
+    this case, the fixtures must be picklable, and test names cannot be
+    given in `unittestExtraArgs`, though `-k` may be used to select
+    tests.
+
     @return `bool` True if the suite passed, False if there was one or
     more failures.
 
@@ -91,6 +100,14 @@ def executeSuite(testSuiteModule, fixtures, unittestExtraArgs=None):
     should only contain alpha-numeric characters and underscores.
     """
 
+    if workers < 1:
+        raise InputValidationException(f"workers must be at least 1, got {workers}")
+
+    if workers > 1:
+        return _implementation.executeTestsInParallel(
+            testSuiteModule, fixtures, unittestExtraArgs, workers
+        )
+
     managerIdentifier = fixtures["identifier"]
     settings = fixtures.get("settings")
     harness = _implementation.createHarness(managerIdentifier, settings)
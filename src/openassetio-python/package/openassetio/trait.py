@@ -22,3 +22,5 @@ from . import _openassetio  # pylint: disable=no-name-in-module
 
 
 TraitsData = _openassetio.trait.TraitsData
+PropertyBuffer = _openassetio.trait.PropertyBuffer
+extractTraitProperty = _openassetio.trait.extractTraitProperty
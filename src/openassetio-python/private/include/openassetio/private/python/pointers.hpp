@@ -1,7 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
 #pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
 #include <memory>
+#include <string_view>
 #include <utility>
 
 #include <Python.h>
@@ -14,6 +18,126 @@ namespace py = pybind11;
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace python::pointers {
+namespace detail {
+/// Environment variable that, if set to a value other than "0", opts
+/// in to non-blocking releases. See DeferredDecRefs.
+inline constexpr const char* kNonBlockingReleaseEnvVar = "OPENASSETIO_PYTHON_NONBLOCKING_RELEASE";
+
+/**
+ * Python object reference retained by a Python-retaining pointer.
+ *
+ * Doubles as the node of the DeferredDecRefs queue, so that deferring
+ * a release doesn't require an allocation.
+ */
+struct RetainedPyObject {
+  explicit RetainedPyObject(py::object pyObject) : object{std::move(pyObject)} {}
+
+  py::object object;
+  RetainedPyObject* next = nullptr;
+};
+
+/**
+ * Lock-free queue of Python object references, dropped by
+ * Python-retaining pointers in threads that did not hold the GIL,
+ * pending release.
+ *
+ * Rather than acquire the GIL in every such deleter, references are
+ * queued and released in bulk by a thread that holds the GIL. That is,
+ * the next thread to create or destroy a Python-retaining pointer
+ * whilst holding the GIL, or else the main thread, via a Python
+ * "pending call" scheduled for the purpose.
+ *
+ * By default, should the queue grow to kMaxPending references, the
+ * thread that fills it acquires the GIL and releases them, which
+ * bounds the delay in the case of a (rare) host that does no further
+ * Python work. Hosts whose worker threads must never block on the GIL
+ * can opt out of this by setting the kNonBlockingReleaseEnvVar
+ * environment variable, at the cost of references (and so Python
+ * objects) being retained until Python next runs.
+ */
+class DeferredDecRefs {
+ public:
+  /// Number of queued references that triggers an immediate release,
+  /// unless non-blocking.
+  static constexpr std::size_t kMaxPending = 64;
+
+  static DeferredDecRefs& instance() {
+    // Intentionally leaked, since deleters may run during static
+    // destruction.
+    static auto* const queue = new DeferredDecRefs;
+    return *queue;
+  }
+
+  /**
+   * Queue a reference to be released, taking ownership of the node.
+   * The GIL must not be held.
+   */
+  void push(RetainedPyObject* node) {
+    node->next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    const std::size_t numPending = numPending_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (!nonBlocking_ && numPending >= kMaxPending) {
+      const py::gil_scoped_acquire gil;
+      releaseAll();
+      return;
+    }
+    if (releaseScheduled_.exchange(true, std::memory_order_relaxed)) {
+      return;
+    }
+    // Py_AddPendingCall doesn't require the GIL, but can fail if
+    // Python's own queue is full, in which case rely on the next
+    // opportunistic release, unless permitted to block.
+    if (Py_AddPendingCall(&DeferredDecRefs::releasePendingCall, this) != 0) {
+      releaseScheduled_.store(false, std::memory_order_relaxed);
+      if (!nonBlocking_) {
+        const py::gil_scoped_acquire gil;
+        releaseAll();
+      }
+    }
+  }
+
+  /// Release any queued references. The GIL must be held.
+  void releaseAll() {
+    if (head_.load(std::memory_order_relaxed) == nullptr) {
+      return;
+    }
+    // Reset before taking the queue, so that a subsequent push
+    // schedules another release.
+    releaseScheduled_.store(false, std::memory_order_relaxed);
+    RetainedPyObject* node = head_.exchange(nullptr, std::memory_order_acquire);
+    // Releasing may run arbitrary Python code, including destructors
+    // that re-enter this function, so the queue has been detached.
+    std::size_t numReleased = 0;
+    while (node != nullptr) {
+      RetainedPyObject* next = node->next;
+      delete node;
+      node = next;
+      ++numReleased;
+    }
+    numPending_.fetch_sub(numReleased, std::memory_order_relaxed);
+  }
+
+ private:
+  DeferredDecRefs() {
+    const char* nonBlocking = std::getenv(kNonBlockingReleaseEnvVar);
+    nonBlocking_ = nonBlocking != nullptr && *nonBlocking != '\0' &&
+                   std::string_view{nonBlocking} != "0";
+  }
+
+  static int releasePendingCall(void* queue) {
+    static_cast<DeferredDecRefs*>(queue)->releaseAll();
+    return 0;
+  }
+
+  std::atomic<RetainedPyObject*> head_{nullptr};
+  std::atomic<std::size_t> numPending_{0};
+  std::atomic<bool> releaseScheduled_{false};
+  bool nonBlocking_ = false;
+};
+}  // namespace detail
 /**
  * Get a shared_ptr-compatible smart pointer that controls the lifetime
  * of a Python object reference, but dereferences to a C++ object.
@@ -30,6 +154,16 @@ namespace python::pointers {
  * In this way the lifetimes of the two shared_ptr "endpoints" are
  * linked by the Python object refcount.
  *
+ * If the most recent pointer created in this thread retains the same
+ * Python object, and is still alive, then its control block is reused,
+ * rather than allocating another, e.g. when a Python manager returns
+ * the same state object from successive calls.
+ *
+ * If the last pointer sharing a control block is destroyed in a thread
+ * that doesn't hold the GIL, then the Python object reference is
+ * released later, in bulk, by a thread that does, rather than
+ * acquiring the GIL for each. See detail::DeferredDecRefs.
+ *
  * @see PyRetainingSharedPtr
  * @see createPythonPluginSystemManagerImplementationFactory
  *
@@ -44,31 +178,58 @@ template <typename Ptr>
 Ptr createPyRetainingPtr(const py::object& pyInstance,
                          typename Ptr::element_type* cppInstancePtr) {
   // Custom deleter for shared_ptr below.
-  const auto deleter = [](py::object* pyObjectPtr) {
+  const auto deleter = [](detail::RetainedPyObject* retained) {
     // TODO(DF): Technically we have a race condition here with
     //  _Py_IsFinalizing if multiple threads are involved, but that is
     //  a corner case of a corner case, and difficult to solve.
     if (_Py_IsFinalizing()) {
       // If the Python interpreter is gone, clear the internal PyObject*
       // so pybind11 won't attempt to clean it up.
-      pyObjectPtr->release();
-      delete pyObjectPtr;
-    } else {
-      // Acquire the GIL, in case deleter runs in a non-Python thread.
+      retained->object.release();
+      delete retained;
+      return;
+    }
+    auto& deferredDecRefs = detail::DeferredDecRefs::instance();
+    if (PyGILState_Check() == 0) {
+      // Deleter runs in a thread without the GIL, so defer the release
+      // rather than acquire the GIL.
       // TODO(DF): We may be inside the destructor of some parent
       //  object, and yet it is possible that pybind11 will throw an
       //  exception here trying to acquire the GIL (though only in
       //  catastrophic cases). Tricky to test, though.
-      const py::gil_scoped_acquire gil;
-      delete pyObjectPtr;
+      deferredDecRefs.push(retained);
+      return;
     }
+    deferredDecRefs.releaseAll();
+    delete retained;
   };
 
-  // Use a shared_ptr to bump the PyObject refcount, and decrement
-  // again when the shared_ptr chain is cleaned up. This may result in
-  // destruction of the PyObject and hence decrementing the refcount
-  // of the original shared_ptr holder stored on the PyObject.
-  auto pyInstancePtr = std::shared_ptr<py::object>{new py::object{pyInstance}, deleter};
+  // The GIL is held, so take the opportunity to release any deferred
+  // references.
+  detail::DeferredDecRefs::instance().releaseAll();
+
+  // Reuse the control block of the most recent pointer created in this
+  // thread, if it retains the same Python object and is still alive.
+  // If so, the Python object must be alive, so its address is not
+  // stale.
+  thread_local PyObject* lastPyObject = nullptr;
+  thread_local std::weak_ptr<detail::RetainedPyObject> lastPyInstancePtr;
+  std::shared_ptr<detail::RetainedPyObject> pyInstancePtr;
+  if (lastPyObject == pyInstance.ptr()) {
+    pyInstancePtr = lastPyInstancePtr.lock();
+  }
+
+  if (!pyInstancePtr) {
+    // Use a shared_ptr to bump the PyObject refcount, and decrement
+    // again when the shared_ptr chain is cleaned up. This may result
+    // in destruction of the PyObject and hence decrementing the
+    // refcount of the original shared_ptr holder stored on the
+    // PyObject.
+    pyInstancePtr = std::shared_ptr<detail::RetainedPyObject>{
+        new detail::RetainedPyObject{pyInstance}, deleter};
+    lastPyObject = pyInstance.ptr();
+    lastPyInstancePtr = pyInstancePtr;
+  }
 
   // We use the shared_ptr aliasing constructor to track the lifetime of
   // the py::object, but dereference to the C++ instance. When this
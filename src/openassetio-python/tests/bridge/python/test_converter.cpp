@@ -11,6 +11,8 @@
 #include <openassetio/python/converter.hpp>
 
 #include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
@@ -191,6 +193,130 @@ SCENARIO("Attempting to cast from an incorrect Python type") {
   }
 }
 
+SCENARIO("Batch casting to and from Python lists") {
+  namespace converter = openassetio::python::converter;
+  py::module_::import("openassetio");
+
+  GIVEN("a list of C++ objects, including a null pointer") {
+    const std::vector<trait::TraitsDataPtr> traitsDatas{trait::TraitsData::make(), nullptr,
+                                                        trait::TraitsData::make()};
+
+    WHEN("the list is cast to a Python list") {
+      PyObject* pyTraitsDatas = converter::castToPyList(traitsDatas);
+      REQUIRE(pyTraitsDatas != nullptr);
+
+      THEN("a new Python list of the same length is returned") {
+        CHECK(PyList_Check(pyTraitsDatas));
+        CHECK(Py_REFCNT(pyTraitsDatas) == 1);
+        CHECK(PyList_GET_SIZE(pyTraitsDatas) == 3);
+        CHECK(PyList_GET_ITEM(pyTraitsDatas, 1) == Py_None);
+      }
+
+      AND_WHEN("data is set via a C++ object") {
+        traitsDatas[2]->addTrait(kTestTraitId);
+
+        THEN("the corresponding Python element reflects that data set") {
+          PyObject* resultBool = PyObject_CallMethod(PyList_GET_ITEM(pyTraitsDatas, 2),
+                                                     "hasTrait", "s", kTestTraitId);
+          CHECK(PyObject_IsTrue(resultBool));
+          Py_DECREF(resultBool);
+        }
+      }
+      Py_DECREF(pyTraitsDatas);
+    }
+  }
+
+  GIVEN("a Python list of Python objects, including None") {
+    const py::object pyClass = py::module_::import("openassetio.trait").attr("TraitsData");
+    const py::list pyTraitsDatas;
+    pyTraitsDatas.append(pyClass());
+    pyTraitsDatas.append(py::none());
+    pyTraitsDatas.append(pyClass());
+
+    WHEN("the list is cast to C++ objects") {
+      std::vector<trait::TraitsDataPtr> traitsDatas =
+          converter::castFromPyList<trait::TraitsData>(pyTraitsDatas.ptr());
+
+      THEN("objects are returned in the same order, with None as null") {
+        REQUIRE(traitsDatas.size() == 3);
+        CHECK(traitsDatas[0] != nullptr);
+        CHECK(traitsDatas[1] == nullptr);
+        CHECK(traitsDatas[2] != nullptr);
+      }
+
+      THEN("each C++ object retains its Python object") {
+        PyObject* pyTraitsData = PyList_GET_ITEM(pyTraitsDatas.ptr(), 0);
+        CHECK(Py_REFCNT(pyTraitsData) == 2);
+        traitsDatas.clear();
+        CHECK(Py_REFCNT(pyTraitsData) == 1);
+      }
+
+      AND_WHEN("data is set via a Python object") {
+        pyTraitsDatas[2].attr("addTrait")(kTestTraitId);
+
+        THEN("the corresponding C++ object reflects that data set") {
+          CHECK(traitsDatas[2]->hasTrait(kTestTraitId));
+        }
+      }
+    }
+  }
+
+  GIVEN("a list of entity references") {
+    const EntityReferences entityReferences{EntityReference{"first"},
+                                            EntityReference{"second"}};
+
+    WHEN("the list is round-tripped through Python") {
+      PyObject* pyEntityReferences = converter::castToPyList(entityReferences);
+      const EntityReferences result =
+          converter::castFromPyList<EntityReference>(pyEntityReferences);
+
+      THEN("entity references are copied in order") {
+        CHECK(py::str(PyList_GET_ITEM(pyEntityReferences, 1)).cast<Str>() == "second");
+        CHECK(result == entityReferences);
+      }
+      Py_DECREF(pyEntityReferences);
+    }
+  }
+
+  GIVEN("a Python list containing an element of the wrong type") {
+    const py::list pyList;
+    pyList.append(py::module_::import("openassetio").attr("EntityReference")("ref"));
+    pyList.append(py::int_(1));
+
+    WHEN("the list is cast to C++ objects") {
+      THEN("the offending element is reported") {
+        REQUIRE_THROWS_WITH(converter::castFromPyList<EntityReference>(pyList.ptr()),
+                            Catch::Matchers::StartsWith(
+                                "Unable to cast Python instance at index 1 to C++ type"));
+      }
+    }
+  }
+
+  GIVEN("a Python list containing None") {
+    const py::list pyList;
+    pyList.append(py::none());
+
+    WHEN("the list is cast to C++ value types") {
+      THEN("the element is reported as not castable") {
+        REQUIRE_THROWS_WITH(converter::castFromPyList<EntityReference>(pyList.ptr()),
+                            Catch::Matchers::StartsWith(
+                                "Unable to cast Python instance at index 0 to C++ type"));
+      }
+    }
+  }
+
+  GIVEN("a Python object that is not a list") {
+    const py::dict pyDict;
+
+    WHEN("the object is cast to C++ objects") {
+      THEN("cast throws expected exception") {
+        REQUIRE_THROWS_AS(converter::castFromPyList<trait::TraitsData>(pyDict.ptr()),
+                          errors::InputValidationException);
+      }
+    }
+  }
+}
+
 // NB: This test is excluded by default and is executed by explicitly
 // specifying the [no_openassetio_module] tag to the Catch2 runner
 // executable.
@@ -284,5 +410,22 @@ TEMPLATE_LIST_TEST_CASE("Appropriate classes have castToPyObject functions", "",
   const typename TestType::Ptr empty = nullptr;
   CHECK(openassetio::python::converter::castToPyObject(empty) == Py_None);
 }
+
+TEMPLATE_LIST_TEST_CASE("Appropriate classes have castFromPyList functions", "",
+                        CastableClasses) {
+  PyObject* empty = nullptr;
+  REQUIRE_THROWS_WITH(openassetio::python::converter::castFromPyList<TestType>(empty),
+                      std::string("Attempting to cast a nullptr PyObject in "
+                                  "openassetio::python::converter::castFromPyList"));
+}
+
+TEMPLATE_LIST_TEST_CASE("Appropriate classes have castToPyList functions", "", CastableClasses) {
+  // An empty list requires only that the type is registered.
+  py::module_::import("openassetio");
+  const std::vector<typename TestType::Ptr> empty;
+  PyObject* pyList = openassetio::python::converter::castToPyList(empty);
+  CHECK(PyList_GET_SIZE(pyList) == 0);
+  Py_DECREF(pyList);
+}
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -1,6 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022 The Foundry Visionmongers Ltd
 
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+#include <pybind11/embed.h>
 #include <pybind11/gil.h>
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
@@ -14,6 +19,27 @@ struct MockLogger : trompeloeil::mock_interface<openassetio::log::LoggerInterfac
   IMPLEMENT_MOCK2(log);
 };
 using trompeloeil::_;
+
+/// Set an environment variable for the lifetime of this object, via
+/// Python so that both Python and C++ observe it.
+class ScopedEnvVar {
+ public:
+  ScopedEnvVar(const char* name, const openassetio::Str& value) : name_{name} {
+    const pybind11::gil_scoped_acquire gil{};
+    pybind11::module_::import("os").attr("environ")[name_] = value;
+  }
+  ~ScopedEnvVar() {
+    const pybind11::gil_scoped_acquire gil{};
+    pybind11::module_::import("os").attr("environ").attr("pop")(name_, pybind11::none());
+  }
+  ScopedEnvVar(const ScopedEnvVar&) = delete;
+  ScopedEnvVar& operator=(const ScopedEnvVar&) = delete;
+  ScopedEnvVar(ScopedEnvVar&&) = delete;
+  ScopedEnvVar& operator=(ScopedEnvVar&&) = delete;
+
+ private:
+  const char* name_;
+};
 }  // namespace
 
 SCENARIO("Accessing the Python plugin system from C++") {
@@ -43,3 +69,65 @@ SCENARIO("Accessing the Python plugin system from C++") {
     }
   }
 }
+
+SCENARIO("Lazily accessing the Python plugin system from C++") {
+  using ManagerDetail =
+      openassetio::hostApi::ManagerImplementationFactoryInterface::ManagerDetail;
+
+  GIVEN("a logger") {
+    // Release the GIL to ensure GIL-safe handling of Python import.
+    const pybind11::gil_scoped_release gil{};
+
+    const openassetio::log::LoggerInterfacePtr logger = std::make_shared<MockLogger>();
+    auto& mockLogger = static_cast<MockLogger&>(*logger);
+
+    ALLOW_CALL(mockLogger, log(_, _));
+
+    AND_GIVEN("a plugin index listing a plugin that is not on the search path") {
+      const std::filesystem::path indexPath =
+          std::filesystem::temp_directory_path() / "openassetio-bridge-test-index.json";
+      std::ofstream{indexPath} << R"({"version": 1, "plugins": [
+        {"identifier": "org.openassetio.test.indexed", "path": "/nonexistent/indexed.py",
+         "metadata": {"details": {"displayName": "Indexed", "info": {"answer": 42}}}}]})";
+      const ScopedEnvVar envVar{"OPENASSETIO_PLUGIN_INDEX", indexPath.string()};
+
+      AND_GIVEN("a lazy Python plugin system manager factory") {
+        const openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory =
+            openassetio::python::hostApi::createLazyPythonPluginSystemManagerImplementationFactory(
+                logger);
+
+        WHEN("the list of plugin identifiers and their details are queried") {
+          const openassetio::Identifiers identifiers = factory->identifiers();
+          const std::optional<ManagerDetail> details =
+              factory->details("org.openassetio.test.indexed");
+
+          THEN("they are served from the index") {
+            CHECK(identifiers == openassetio::Identifiers{"org.openassetio.test.indexed"});
+            REQUIRE(details.has_value());
+            CHECK(*details == ManagerDetail{"org.openassetio.test.indexed",
+                                            "Indexed",
+                                            {{"answer", openassetio::Int{42}}}});
+          }
+        }
+      }
+      std::filesystem::remove(indexPath);
+    }
+
+    AND_GIVEN("no plugin index") {
+      AND_GIVEN("a lazy Python plugin system manager factory") {
+        const openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory =
+            openassetio::python::hostApi::createLazyPythonPluginSystemManagerImplementationFactory(
+                logger);
+
+        WHEN("the list of plugin identifiers is queried") {
+          const openassetio::Identifiers identifiers = factory->identifiers();
+
+          THEN("the Python plugin system is searched") {
+            CHECK(identifiers == openassetio::Identifiers{
+                                     "org.openassetio.test.pluginSystem.resources.modulePlugin"});
+          }
+        }
+      }
+    }
+  }
+}
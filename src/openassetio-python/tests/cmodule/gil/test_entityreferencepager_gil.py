@@ -58,6 +58,15 @@ class Test_EntityReferencePagerInterface_gil:
     def test_close(self, a_threaded_entity_ref_pager_interface, a_host_session):
         a_threaded_entity_ref_pager_interface.close(a_host_session)
 
+    def test_drainAll(
+        self,
+        mock_entity_reference_pager_interface,
+        a_threaded_entity_ref_pager_interface,
+        a_host_session,
+    ):
+        mock_entity_reference_pager_interface.mock.drainAll.return_value = []
+        a_threaded_entity_ref_pager_interface.drainAll(1, a_host_session)
+
     def test_get(
         self,
         mock_entity_reference_pager_interface,
@@ -79,6 +88,15 @@ class Test_EntityReferencePagerInterface_gil:
     def test_next(self, a_threaded_entity_ref_pager_interface, a_host_session):
         a_threaded_entity_ref_pager_interface.next(a_host_session)
 
+    def test_sizeHint(
+        self,
+        mock_entity_reference_pager_interface,
+        a_threaded_entity_ref_pager_interface,
+        a_host_session,
+    ):
+        mock_entity_reference_pager_interface.mock.sizeHint.return_value = None
+        a_threaded_entity_ref_pager_interface.sizeHint(a_host_session)
+
 
 class Test_EntityReferencePager_gil:
     """
@@ -107,6 +125,10 @@ class Test_EntityReferencePager_gil:
 
         assert unimplemented == []
 
+    def test_drainAll(self, a_threaded_entity_ref_pager, mock_entity_reference_pager_interface):
+        mock_entity_reference_pager_interface.mock.drainAll.return_value = []
+        a_threaded_entity_ref_pager.drainAll()
+
     def test_get(self, a_threaded_entity_ref_pager, mock_entity_reference_pager_interface):
         mock_entity_reference_pager_interface.mock.get.return_value = []
         a_threaded_entity_ref_pager.get()
@@ -118,6 +140,10 @@ class Test_EntityReferencePager_gil:
     def test_next(self, a_threaded_entity_ref_pager):
         a_threaded_entity_ref_pager.next()
 
+    def test_sizeHint(self, a_threaded_entity_ref_pager, mock_entity_reference_pager_interface):
+        mock_entity_reference_pager_interface.mock.sizeHint.return_value = None
+        a_threaded_entity_ref_pager.sizeHint()
+
 
 @pytest.fixture
 def a_threaded_entity_ref_pager(a_threaded_entity_ref_pager_interface, a_host_session):
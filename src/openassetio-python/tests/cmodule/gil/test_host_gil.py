@@ -66,6 +66,12 @@ class Test_HostInterface_gil:
         mock_host_interface.mock.info.return_value = {}
         a_threaded_host_interface.info()
 
+    def test_parallelFor(self, a_threaded_host_interface):
+        a_threaded_host_interface.parallelFor(2, lambda _idx: None)
+
+    def test_submit(self, a_threaded_host_interface):
+        a_threaded_host_interface.submit(lambda: None)
+
 
 class Test_Host_gil:
     """
@@ -106,6 +112,15 @@ class Test_Host_gil:
         mock_host_interface.mock.info.return_value = {}
         a_threaded_host.info()
 
+    def test_parallelFor(self, a_threaded_host):
+        a_threaded_host.parallelFor(2, lambda _idx: None)
+
+    def test_refresh(self, a_threaded_host):
+        a_threaded_host.refresh()
+
+    def test_submit(self, a_threaded_host):
+        a_threaded_host.submit(lambda: None)
+
 
 @pytest.fixture
 def a_threaded_host(a_threaded_host_interface):
@@ -68,9 +68,15 @@ class Test_LoggerInterface_gil:
     def test_info(self, a_threaded_logger_interface):
         a_threaded_logger_interface.info("")
 
+    def test_isSeverityLogged(self, a_threaded_logger_interface):
+        a_threaded_logger_interface.isSeverityLogged(LoggerInterface.Severity.kInfo)
+
     def test_log(self, a_threaded_logger_interface):
         a_threaded_logger_interface.log(LoggerInterface.Severity.kInfo, "")
 
+    def test_logStructured(self, a_threaded_logger_interface):
+        a_threaded_logger_interface.logStructured(LoggerInterface.Severity.kInfo, "", {})
+
     def test_progress(self, a_threaded_logger_interface):
         a_threaded_logger_interface.progress("")
 
@@ -19,6 +19,8 @@ Testing that Manager methods release the GIL.
 # pylint: disable=redefined-outer-name,too-many-public-methods
 # pylint: disable=invalid-name,c-extension-no-member
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import asyncio
+
 import pytest
 
 # pylint: disable=no-name-in-module
@@ -63,12 +65,21 @@ class Test_Manager_gil:
 
         assert unimplemented == []
 
+    def test_areEntityReferenceStrings(self, a_threaded_manager):
+        a_threaded_manager.areEntityReferenceStrings([])
+
     def test_contextFromPersistenceToken(
         self, mock_manager_interface, a_context, a_threaded_manager
     ):
         mock_manager_interface.mock.stateFromPersistenceToken.return_value = a_context
         a_threaded_manager.contextFromPersistenceToken("")
 
+    def test_contextsFromPersistenceTokens(
+        self, mock_manager_interface, a_context, a_threaded_manager
+    ):
+        mock_manager_interface.mock.stateFromPersistenceToken.return_value = a_context
+        a_threaded_manager.contextsFromPersistenceTokens([""])
+
     def test_createChildContext(self, a_threaded_manager, a_context, a_traits_data):
         a_context.locale = a_traits_data
         a_threaded_manager.createChildContext(a_context)
@@ -111,6 +122,9 @@ class Test_Manager_gil:
 
         a_threaded_manager.entityExists([], a_context, fail, fail)
 
+    def test_entityExistsAsync(self, a_threaded_manager, a_context):
+        run_in_event_loop(lambda: a_threaded_manager.entityExistsAsync([], a_context))
+
     def test_entityTraits(self, a_threaded_manager, a_context):
         # Defend against forgetting to include convenience signatures in
         # this test, once added.
@@ -118,8 +132,22 @@ class Test_Manager_gil:
 
         a_threaded_manager.entityTraits([], access.EntityTraitsAccess.kRead, a_context, fail, fail)
 
+    def test_entityTraitsAsync(self, a_threaded_manager, a_context):
+        run_in_event_loop(
+            lambda: a_threaded_manager.entityTraitsAsync(
+                [], access.EntityTraitsAccess.kRead, a_context
+            )
+        )
+
+    def test_entityTraitsStream(self, a_threaded_manager, a_context):
+        list(a_threaded_manager.entityTraitsStream([], access.EntityTraitsAccess.kRead, a_context))
+
     def test_flushCaches(self, a_threaded_manager):
         a_threaded_manager.flushCaches()
+        a_threaded_manager.flushCaches([])
+
+    def test_flushCachesWithPrefix(self, a_threaded_manager):
+        a_threaded_manager.flushCachesWithPrefix("asset://")
 
     def test_getWithRelationship(self, a_threaded_manager, a_traits_data, a_context):
         # Defend against forgetting to include convenience signatures in
@@ -151,6 +179,17 @@ class Test_Manager_gil:
             fail,
         )
 
+    def test_getWithRelationshipsMatrix(self, a_threaded_manager, a_context):
+        a_threaded_manager.getWithRelationshipsMatrix(
+            [],
+            [],
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            fail,
+            fail,
+        )
+
     def test_hasCapability(self, a_threaded_manager):
         a_threaded_manager.hasCapability(Manager.Capability.kExistenceQueries)
 
@@ -164,6 +203,10 @@ class Test_Manager_gil:
     def test_initialize(self, a_threaded_manager):
         a_threaded_manager.initialize({})
 
+    def test_initializeAsync(self, a_threaded_manager):
+        a_threaded_manager.initializeAsync({})
+        a_threaded_manager.waitForInitialization()
+
     def test_isEntityReferenceString(self, a_threaded_manager):
         a_threaded_manager.isEntityReferenceString("")
 
@@ -183,6 +226,13 @@ class Test_Manager_gil:
         a_threaded_manager.preflight([], [], an_access, a_context, tag.kException)
         a_threaded_manager.preflight([], [], an_access, a_context, tag.kVariant)
 
+    def test_preflightAsync(self, a_threaded_manager, a_context):
+        run_in_event_loop(
+            lambda: a_threaded_manager.preflightAsync(
+                [], [], access.PublishingAccess.kWrite, a_context
+            )
+        )
+
     def test_register(self, a_threaded_manager, an_entity_reference, a_traits_data, a_context):
         an_access = access.PublishingAccess.kWrite
         tag = Manager.BatchElementErrorPolicyTag
@@ -196,6 +246,13 @@ class Test_Manager_gil:
         a_threaded_manager.register([], [], an_access, a_context, tag.kException)
         a_threaded_manager.register([], [], an_access, a_context, tag.kVariant)
 
+    def test_registerAsync(self, a_threaded_manager, a_context):
+        run_in_event_loop(
+            lambda: a_threaded_manager.registerAsync(
+                [], [], access.PublishingAccess.kWrite, a_context
+            )
+        )
+
     def test_resolve(self, a_threaded_manager, an_entity_reference, a_context):
         an_access = access.ResolveAccess.kRead
         tag = Manager.BatchElementErrorPolicyTag
@@ -213,19 +270,71 @@ class Test_Manager_gil:
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kException)
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kVariant)
 
+    def test_resolveAsync(self, a_threaded_manager, a_context):
+        run_in_event_loop(
+            lambda: a_threaded_manager.resolveAsync(
+                [], set(), access.ResolveAccess.kRead, a_context
+            )
+        )
+
+    def test_resolveHeterogeneous(self, a_threaded_manager, a_context):
+        a_threaded_manager.resolveHeterogeneous(
+            [], [], [], access.ResolveAccess.kRead, a_context, fail, fail
+        )
+
+    def test_resolveProjected(self, a_threaded_manager, a_context):
+        a_threaded_manager.resolveProjected(
+            [], set(), {}, access.ResolveAccess.kRead, a_context, fail, fail
+        )
+
+    def test_resolveIfChanged(self, a_threaded_manager, a_context):
+        a_threaded_manager.resolveIfChanged(
+            [], set(), access.ResolveAccess.kRead, [], a_context, fail, fail
+        )
+
+    def test_resolveStream(self, a_threaded_manager, a_context):
+        list(a_threaded_manager.resolveStream([], set(), access.ResolveAccess.kRead, a_context))
+
     def test_settings(self, mock_manager_interface, a_threaded_manager):
         mock_manager_interface.mock.settings.return_value = {}
         a_threaded_manager.settings()
 
+    def test_traverseRelationships(self, a_threaded_manager, a_context):
+        a_threaded_manager.traverseRelationships(
+            [],
+            [],
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            fail,
+            fail,
+        )
+
     def test_updateTerminology(self, mock_manager_interface, a_threaded_manager):
         mock_manager_interface.mock.updateTerminology.return_value = {}
         a_threaded_manager.updateTerminology({})
 
+    def test_waitForInitialization(self, a_threaded_manager):
+        a_threaded_manager.initializeAsync({})
+        a_threaded_manager.waitForInitialization()
+
 
 def fail(*_):
     pytest.fail("shouldn't have been called")
 
 
+def run_in_event_loop(start):
+    """
+    Start an asynchronous operation from within a new event loop, and
+    wait for its result.
+    """
+
+    async def main():
+        return await start()
+
+    return asyncio.run(main())
+
+
 @pytest.fixture
 def a_threaded_manager(a_threaded_mock_manager_interface, a_host_session):
     return Manager(a_threaded_mock_manager_interface, a_host_session)
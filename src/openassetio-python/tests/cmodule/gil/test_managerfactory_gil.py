@@ -56,6 +56,9 @@ class Test_ManagerImplementationFactoryInterface_gil:
 
         assert unimplemented == []
 
+    def test_details(self, a_threaded_manager_impl_factory, mock_manager_impl_factory):
+        a_threaded_manager_impl_factory.details("")
+
     def test_identifiers(self, a_threaded_manager_impl_factory, mock_manager_impl_factory):
         mock_manager_impl_factory.mock.identifiers.return_value = []
         a_threaded_manager_impl_factory.identifiers()
@@ -189,6 +192,19 @@ class Test_ManagerFactory_gil:
 
         mock_manager_impl_factory.mock.instantiate.assert_called()
 
+        # Third overload
+
+        mock_manager_impl_factory.mock.instantiate.reset_mock()
+
+        ManagerFactory.defaultManagerForInterface(
+            ManagerFactory.DefaultManagerConfig("something", {}),
+            mock_host_interface,
+            a_threaded_manager_impl_factory,
+            mock_logger,
+        )
+
+        mock_manager_impl_factory.mock.instantiate.assert_called()
+
     def test_identifiers(
         self,
         a_threaded_manager_factory,
@@ -200,6 +216,50 @@ class Test_ManagerFactory_gil:
 
         mock_manager_impl_factory.mock.identifiers.assert_called()
 
+    def test_loadDefaultManagerConfig(self, tmp_path):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text('[manager]\nidentifier = "something"')
+
+        config = ManagerFactory.loadDefaultManagerConfig(str(config_path))
+
+        assert config.identifier == "something"
+
+    def test_sharedManager(
+        self,
+        a_threaded_manager_factory,
+        mock_host_interface,
+        mock_manager_impl_factory,
+        mock_manager_interface,
+    ):
+        mock_host_interface.mock.identifier.return_value = "a.host"
+        mock_manager_impl_factory.mock.instantiate.return_value = mock_manager_interface
+
+        a_threaded_manager_factory.sharedManager(
+            ManagerFactory.DefaultManagerConfig("gil.sharedManager", {})
+        )
+
+        mock_manager_impl_factory.mock.instantiate.assert_called()
+
+    def test_sharedManagerForInterface(
+        self,
+        a_threaded_manager_impl_factory,
+        mock_logger,
+        mock_host_interface,
+        mock_manager_impl_factory,
+        mock_manager_interface,
+    ):
+        mock_host_interface.mock.identifier.return_value = "a.host"
+        mock_manager_impl_factory.mock.instantiate.return_value = mock_manager_interface
+
+        ManagerFactory.sharedManagerForInterface(
+            ManagerFactory.DefaultManagerConfig("gil.sharedManagerForInterface", {}),
+            mock_host_interface,
+            a_threaded_manager_impl_factory,
+            mock_logger,
+        )
+
+        mock_manager_impl_factory.mock.instantiate.assert_called()
+
 
 @pytest.fixture
 def a_threaded_manager_factory(mock_host_interface, a_threaded_manager_impl_factory, mock_logger):
@@ -229,9 +289,14 @@ class MockManagerImplFactoryInterface(ManagerImplementationFactoryInterface):
         self.mock = mock.create_autospec(
             ManagerImplementationFactoryInterface, spec_set=True, instance=True
         )
+        # Details are unknown by default, as per the base class.
+        self.mock.details.return_value = None
 
     def identifiers(self):
         return self.mock.identifiers()
 
     def instantiate(self, identifier):
         return self.mock.instantiate(identifier)
+
+    def details(self, identifier):
+        return self.mock.details(identifier)
@@ -82,6 +82,9 @@ class Test_ManagerInterface_gil:
 
         assert unimplemented == []
 
+    def test_areEntityReferenceStrings(self, a_threaded_mock_manager_interface, a_host_session):
+        a_threaded_mock_manager_interface.areEntityReferenceStrings([], a_host_session)
+
     def test_createChildState(
         self, mock_manager_interface, a_threaded_mock_manager_interface, a_host_session
     ):
@@ -122,6 +125,12 @@ class Test_ManagerInterface_gil:
     def test_flushCaches(self, a_threaded_mock_manager_interface, a_host_session):
         a_threaded_mock_manager_interface.flushCaches(a_host_session)
 
+    def test_flushEntityCaches(self, a_threaded_mock_manager_interface, a_host_session):
+        a_threaded_mock_manager_interface.flushEntityCaches([], a_host_session)
+
+    def test_flushCachesWithPrefix(self, a_threaded_mock_manager_interface, a_host_session):
+        a_threaded_mock_manager_interface.flushCachesWithPrefix("asset://", a_host_session)
+
     def test_getWithRelationship(
         self, a_threaded_mock_manager_interface, a_traits_data, a_context, a_host_session
     ):
@@ -152,6 +161,36 @@ class Test_ManagerInterface_gil:
             fail,
         )
 
+    def test_getWithRelationshipsMatrix(
+        self, a_threaded_mock_manager_interface, a_context, a_host_session
+    ):
+        a_threaded_mock_manager_interface.getWithRelationshipsMatrix(
+            [],
+            [],
+            set(),
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            a_host_session,
+            fail,
+            fail,
+        )
+
+    def test_traverseRelationships(
+        self, a_threaded_mock_manager_interface, a_context, a_host_session
+    ):
+        a_threaded_mock_manager_interface.traverseRelationships(
+            [],
+            [],
+            set(),
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            a_host_session,
+            fail,
+            fail,
+        )
+
     def test_hasCapability(self, a_threaded_mock_manager_interface):
         a_threaded_mock_manager_interface.hasCapability(
             ManagerInterface.Capability.kManagementPolicyQueries
@@ -193,11 +232,34 @@ class Test_ManagerInterface_gil:
             [], [], access.PublishingAccess.kWrite, a_context, a_host_session, fail, fail
         )
 
+    def test_resetState(
+        self, mock_manager_interface, a_threaded_mock_manager_interface, a_host_session
+    ):
+        mock_manager_interface.mock.resetState.return_value = False
+        a_threaded_mock_manager_interface.resetState(ManagerStateBase(), a_host_session)
+
     def test_resolve(self, a_threaded_mock_manager_interface, a_context, a_host_session):
         a_threaded_mock_manager_interface.resolve(
             [], set(), access.ResolveAccess.kRead, a_context, a_host_session, fail, fail
         )
 
+    def test_resolveHeterogeneous(
+        self, a_threaded_mock_manager_interface, a_context, a_host_session
+    ):
+        a_threaded_mock_manager_interface.resolveHeterogeneous(
+            [], [], [], access.ResolveAccess.kRead, a_context, a_host_session, fail, fail
+        )
+
+    def test_resolveProjected(self, a_threaded_mock_manager_interface, a_context, a_host_session):
+        a_threaded_mock_manager_interface.resolveProjected(
+            [], set(), {}, access.ResolveAccess.kRead, a_context, a_host_session, fail, fail
+        )
+
+    def test_resolveIfChanged(self, a_threaded_mock_manager_interface, a_context, a_host_session):
+        a_threaded_mock_manager_interface.resolveIfChanged(
+            [], set(), access.ResolveAccess.kRead, [], a_context, a_host_session, fail, fail
+        )
+
     def test_settings(
         self, mock_manager_interface, a_threaded_mock_manager_interface, a_host_session
     ):
@@ -0,0 +1,76 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Testing that TracerInterface methods release the GIL.
+"""
+# pylint: disable=redefined-outer-name
+# pylint: disable=invalid-name,c-extension-no-member
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import pytest
+
+# pylint: disable=no-name-in-module
+from openassetio import _openassetio_test
+from openassetio.trace import TracerInterface
+
+
+class Test_TracerInterface_gil:
+    """
+    Check all methods release the GIL during C++ function body
+    execution.
+
+    See docstring for similar test under `gil/Test_ManagerInterface.py`
+    for details on how these tests are structured.
+    """
+
+    def test_all_methods_covered(self, find_unimplemented_test_cases):
+        """
+        Ensure this test class covers all methods.
+        """
+        unimplemented = find_unimplemented_test_cases(TracerInterface, self)
+
+        if unimplemented:
+            print("\nSome test cases not implemented. Method templates can be found below:\n")
+            for method in unimplemented:
+                print(
+                    f"""
+    def test_{method}(self, a_threaded_tracer_interface):
+        a_threaded_tracer_interface.{method}()
+"""
+                )
+
+        assert unimplemented == []
+
+    def test_beginSpan(self, a_threaded_tracer_interface):
+        a_threaded_tracer_interface.beginSpan("", {})
+
+    def test_endSpan(self, a_threaded_tracer_interface):
+        a_threaded_tracer_interface.endSpan(0, {})
+
+    def test_globalTracer(self, a_threaded_tracer_interface):
+        TracerInterface.setGlobalTracer(a_threaded_tracer_interface)
+        try:
+            assert TracerInterface.globalTracer() is not None
+        finally:
+            TracerInterface.setGlobalTracer(None)
+
+    def test_setGlobalTracer(self, a_threaded_tracer_interface):
+        TracerInterface.setGlobalTracer(a_threaded_tracer_interface)
+        TracerInterface.setGlobalTracer(None)
+
+
+@pytest.fixture
+def a_threaded_tracer_interface(mock_tracer):
+    return _openassetio_test.gil.wrapInThreadedTracerInterface(mock_tracer)
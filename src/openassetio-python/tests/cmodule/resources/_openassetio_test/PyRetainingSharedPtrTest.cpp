@@ -4,6 +4,8 @@
  * Bindings used for testing PyRetainingSharedPtr behaviour.
  */
 #include <memory>
+#include <thread>
+#include <utility>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -272,7 +274,17 @@ void registerPyRetainingSharedPtrTestTypes(py::module_& mod) {
       .def(py::init([](std::vector<openassetio::PyRetainingSharedPtr<SimpleBaseCppType>> list) {
         return RetainingSimpleCppListContainer{{list.begin(), list.end()}};
       }))
-      .def("heldObjects", &RetainingSimpleCppListContainer::heldObjects);
+      .def("heldObjects", &RetainingSimpleCppListContainer::heldObjects)
+      .def("heldObjectsShareOwnership", [](const RetainingSimpleCppListContainer& self) {
+        const auto heldObjects = self.heldObjects();
+        for (const auto& heldObject : heldObjects) {
+          if (heldObject.owner_before(heldObjects.front()) ||
+              heldObjects.front().owner_before(heldObject)) {
+            return false;
+          }
+        }
+        return true;
+      });
 
   py::class_<RetainingSimpleBaseCppFactory, PyRetainingSimpleBaseCppFactory>(
       mod, "PyRetainingSimpleBaseCppFactory")
@@ -286,6 +298,14 @@ void registerPyRetainingSharedPtrTestTypes(py::module_& mod) {
       .def(py::init<py::function>())
       .def("value", &SimpleBaseCppType::value);
 
+  mod.def(
+      "releaseInThreadWithoutGil",
+      [](openassetio::PyRetainingSharedPtr<SimpleBaseCppType> heldObject) {
+        std::thread{[heldObject = std::move(heldObject)]() mutable { heldObject.reset(); }}
+            .join();
+      },
+      py::call_guard<py::gil_scoped_release>{});
+
   mod.def("setSimplePyRetainedSingleton",
           [](openassetio::PyRetainingSharedPtr<SimpleBaseCppType> newSingleton) {
             setSimpleSingleton(std::move(newSingleton));
@@ -6,7 +6,10 @@
  *
  * See tests/cmodule/test_errors.py
  */
+#include <cstddef>
+#include <functional>
 
+#include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
 
 #include <overrideMacros.hpp>
@@ -297,11 +300,16 @@ void executeFnAndCatchAndRethrow(Fn&& func, const std::string& catchExceptionNam
  * macro.
  */
 struct ExceptionThrower {
+  using SuccessCallback = std::function<void(std::size_t, bool)>;
+  using ErrorCallback = std::function<void(std::size_t, openassetio::errors::BatchElementError)>;
+
   virtual ~ExceptionThrower() = default;
   virtual void throwFromOverride() {}
   virtual void throwFromOverridePure() = 0;
   virtual void throwFromOverrideName() {}
   virtual void throwFromOverrideArgs() {}
+  virtual void throwFromOverrideBatch(const SuccessCallback& /*successCallback*/,
+                                      const ErrorCallback& /*errorCallback*/) {}
 };
 
 /**
@@ -325,6 +333,11 @@ struct PyExceptionThrower : ExceptionThrower {
   void throwFromOverrideArgs() override {
     OPENASSETIO_PYBIND11_OVERRIDE_ARGS(void, ExceptionThrower, throwFromOverrideArgs, (), );
   }
+  void throwFromOverrideBatch(const SuccessCallback& successCallback,
+                              const ErrorCallback& errorCallback) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_BATCH(ExceptionThrower, throwFromOverrideBatch, successCallback,
+                                        errorCallback, successCallback, errorCallback);
+  }
 };
 
 /**
@@ -391,7 +404,14 @@ void registerExceptionThrower(py::module_& mod) {
                executeFnAndCatch([&] { exceptionThrower.throwFromOverrideName(); },
                                  catchExceptionName) &&
                executeFnAndCatch([&] { exceptionThrower.throwFromOverridePure(); },
-                                 catchExceptionName);
+                                 catchExceptionName) &&
+               executeFnAndCatch(
+                   [&] {
+                     exceptionThrower.throwFromOverrideBatch(
+                         [](std::size_t, bool) {},
+                         [](std::size_t, const openassetio::errors::BatchElementError&) {});
+                   },
+                   catchExceptionName);
       },
       py::arg("exceptionThrower"), py::arg("catchExceptionName"),
       py::call_guard<py::gil_scoped_release>{});
@@ -430,5 +450,7 @@ void registerExceptionThrower(py::module_& mod) {
       .def("throwFromOverride", &ExceptionThrower::throwFromOverride)
       .def("throwFromOverridePure", &ExceptionThrower::throwFromOverridePure)
       .def("throwFromOverrideName", &ExceptionThrower::throwFromOverrideName)
-      .def("throwFromOverrideArgs", &ExceptionThrower::throwFromOverrideArgs);
+      .def("throwFromOverrideArgs", &ExceptionThrower::throwFromOverrideArgs)
+      .def("throwFromOverrideBatch", &ExceptionThrower::throwFromOverrideBatch,
+           py::arg("successCallback"), py::arg("errorCallback"));
 }
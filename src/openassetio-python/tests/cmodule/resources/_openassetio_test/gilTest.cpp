@@ -13,6 +13,7 @@
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trace/TracerInterface.hpp>
 
 /*
  * Hack trompeloeil to make use of its internals, but provide our own
@@ -97,18 +98,27 @@ struct ThreadedManagerInterface : managerApi::ManagerInterface {
   IMPLEMENT_MOCK1(settings);
   IMPLEMENT_MOCK2(initialize);
   IMPLEMENT_MOCK1(flushCaches);
+  IMPLEMENT_MOCK2(flushEntityCaches);
+  IMPLEMENT_MOCK2(flushCachesWithPrefix);
   IMPLEMENT_MOCK4(managementPolicy);
   IMPLEMENT_MOCK1(createState);
   IMPLEMENT_MOCK2(createChildState);
   IMPLEMENT_MOCK2(persistenceTokenForState);
   IMPLEMENT_MOCK2(stateFromPersistenceToken);
+  IMPLEMENT_MOCK2(resetState);
   IMPLEMENT_MOCK2(isEntityReferenceString);
+  IMPLEMENT_MOCK2(areEntityReferenceStrings);
   IMPLEMENT_MOCK5(entityExists);
   IMPLEMENT_MOCK6(entityTraits);
   IMPLEMENT_MOCK7(resolve);
+  IMPLEMENT_MOCK8(resolveHeterogeneous);
+  IMPLEMENT_MOCK8(resolveProjected);
+  IMPLEMENT_MOCK8(resolveIfChanged);
   IMPLEMENT_MOCK6(defaultEntityReference);
   IMPLEMENT_MOCK9(getWithRelationship);
   IMPLEMENT_MOCK9(getWithRelationships);
+  IMPLEMENT_MOCK9(getWithRelationshipsMatrix);
+  IMPLEMENT_MOCK9(traverseRelationships);
   IMPLEMENT_MOCK7(preflight);
   IMPLEMENT_MOCK7(register_);
 };
@@ -124,6 +134,8 @@ struct ThreadedEntityReferencePagerInterface : managerApi::EntityReferencePagerI
   IMPLEMENT_MOCK1(hasNext);
   IMPLEMENT_MOCK1(get);
   IMPLEMENT_MOCK1(next);
+  IMPLEMENT_MOCK1(sizeHint);
+  IMPLEMENT_MOCK2(drainAll);
   IMPLEMENT_MOCK1(close);
 };
 
@@ -140,6 +152,8 @@ struct ThreadedHostInterface : hostApi::HostInterface {
   IMPLEMENT_CONST_MOCK0(identifier);
   IMPLEMENT_CONST_MOCK0(displayName);
   IMPLEMENT_MOCK0(info);
+  IMPLEMENT_MOCK1(submit);
+  IMPLEMENT_MOCK2(parallelFor);
 };
 
 namespace log = openassetio::log;
@@ -153,6 +167,22 @@ struct ThreadedLoggerInterface : log::LoggerInterface {
   Ptr wrapped_;
 
   IMPLEMENT_MOCK2(log);
+  IMPLEMENT_MOCK3(logStructured);
+  IMPLEMENT_CONST_MOCK1(isSeverityLogged);
+};
+
+namespace trace = openassetio::trace;
+
+struct ThreadedTracerInterface : trace::TracerInterface {
+  using Base = TracerInterface;
+  static Ptr make(Ptr wrapped) {
+    return std::make_shared<ThreadedTracerInterface>(std::move(wrapped));
+  }
+  explicit ThreadedTracerInterface(Ptr wrapped) : wrapped_{std::move(wrapped)} {}
+  Ptr wrapped_;
+
+  IMPLEMENT_MOCK2(beginSpan);
+  IMPLEMENT_MOCK2(endSpan);
 };
 
 struct ThreadedManagerImplFactory : hostApi::ManagerImplementationFactoryInterface {
@@ -166,6 +196,7 @@ struct ThreadedManagerImplFactory : hostApi::ManagerImplementationFactoryInterfa
 
   IMPLEMENT_MOCK0(identifiers);
   IMPLEMENT_MOCK1(instantiate);
+  IMPLEMENT_MOCK1(details);
 };
 }  // namespace
 
@@ -220,4 +251,5 @@ void registerRunInThread(py::module_& mod) {
   gil.def("wrapInThreadedHostInterface", &ThreadedHostInterface::make);
   gil.def("wrapInThreadedLoggerInterface", &ThreadedLoggerInterface::make);
   gil.def("wrapInThreadedManagerImplFactory", &ThreadedManagerImplFactory::make);
+  gil.def("wrapInThreadedTracerInterface", &ThreadedTracerInterface::make);
 }
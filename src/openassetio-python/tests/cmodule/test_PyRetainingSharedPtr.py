@@ -20,6 +20,7 @@ shouldn't be included in the main sources.
 
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import time
 import weakref
 from unittest import mock
 
@@ -136,6 +137,19 @@ class Test_PyRetainingSharedPtr_arg:
         assert elements[0].value() == 2
         assert elements[1].value() == 2
 
+    def test_when_same_object_retained_repeatedly_then_ownership_is_shared(self):
+        element = SimpleCppType()
+        container = _openassetio_test.PyRetainingSimpleCppListContainer([element, element])
+
+        assert container.heldObjectsShareOwnership()
+
+    def test_when_different_objects_retained_then_ownership_is_not_shared(self):
+        container = _openassetio_test.PyRetainingSimpleCppListContainer(
+            [SimpleCppType(), SimpleCppType()]
+        )
+
+        assert not container.heldObjectsShareOwnership()
+
 
 class Test_PyRetainingSharedPtr_return:
     def test_when_not_using_PyRetainingSharedPtr_then_python_implementation_is_lost(self):
@@ -249,6 +263,27 @@ class Test_PyRetainingSharedPtr_cleanup:
         self.death_watcher.assert_called()
 
 
+    def test_when_released_in_thread_without_gil_then_python_object_destroyed_later(self):
+        death_watcher = mock.Mock()
+
+        def create_then_release_element():
+            element = DeathwatchedSimpleCppType(death_watcher)
+            _openassetio_test.releaseInThreadWithoutGil(element)
+            return weakref.ref(element)
+
+        weak_ref = create_then_release_element()
+
+        # The release is deferred until the main thread next runs
+        # Python's pending calls.
+        for _ in range(100):
+            if weak_ref() is None:
+                break
+            time.sleep(0.01)
+
+        assert weak_ref() is None
+        death_watcher.assert_called()
+
+
 class Test_PyRetainingSharedPtr_static:
     def test_when_interpreter_dies_before_object_then_cleanup_happens_gracefully(self):
         # This will store a bound C++ object in a static (i.e. global)
@@ -168,6 +168,9 @@ class PyExceptionThrower(_openassetio_test.ExceptionThrower):
     def throwFromOverrideArgs(self):
         self.callee()
 
+    def throwFromOverrideBatch(self, successCallback, errorCallback):
+        self.callee()
+
 
 @pytest.fixture
 def exception_thrower():
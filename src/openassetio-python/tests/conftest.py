@@ -23,7 +23,7 @@ import sys
 
 import pytest
 
-from openassetio import Context, EntityReference
+from openassetio import Context, EntityReference, EntityReferencesView
 from openassetio.access import (
     PolicyAccess,
     ResolveAccess,
@@ -40,6 +40,7 @@ from openassetio.managerApi import (
     EntityReferencePagerInterface,
 )
 from openassetio.hostApi import HostInterface
+from openassetio.trace import TracerInterface
 from openassetio.trait import TraitsData
 
 
@@ -79,6 +80,14 @@ def mock_logger():
     return MockLogger()
 
 
+@pytest.fixture
+def mock_tracer():
+    """
+    Fixture providing a mock that conforms to the TracerInterface.
+    """
+    return MockTracer()
+
+
 @pytest.fixture
 def mock_host_interface():
     """
@@ -175,6 +184,16 @@ class ValidatingMockManagerInterface(ManagerInterface):
     def flushCaches(self, hostSession):
         return self.mock.flushCaches(hostSession)
 
+    def flushEntityCaches(self, entityReferences, hostSession):
+        self.__assertIsIterableOf(entityReferences, EntityReference)
+        assert isinstance(hostSession, HostSession)
+        return self.mock.flushEntityCaches(entityReferences, hostSession)
+
+    def flushCachesWithPrefix(self, prefix, hostSession):
+        assert isinstance(prefix, str)
+        assert isinstance(hostSession, HostSession)
+        return self.mock.flushCachesWithPrefix(prefix, hostSession)
+
     def defaultEntityReference(
         self, traitSets, defaultEntityAccess, context, hostSession, successCallback, errorCallback
     ):
@@ -227,6 +246,9 @@ class ValidatingMockManagerInterface(ManagerInterface):
     def stateFromPersistenceToken(self, token, hostSession):
         return self.mock.stateFromPersistenceToken(token, hostSession)
 
+    def resetState(self, state, hostSession):
+        return self.mock.resetState(state, hostSession)
+
     def identifier(self):
         return self.mock.identifier()
 
@@ -308,6 +330,95 @@ class ValidatingMockManagerInterface(ManagerInterface):
             errorCallback,
         )
 
+    def resolveHeterogeneous(
+        self,
+        entityRefs,
+        traitSets,
+        traitSetIndices,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        self.__assertIsIterableOf(entityRefs, EntityReference)
+        self.__assertIsIterableOf(traitSets, set)
+        self.__assertIsIterableOf(traitSetIndices, int)
+        assert len(traitSetIndices) == len(entityRefs)
+        assert isinstance(resolveAccess, ResolveAccess)
+        self.__assertCallingContext(context, hostSession)
+        assert callable(successCallback)
+        assert callable(errorCallback)
+        return self.mock.resolveHeterogeneous(
+            entityRefs,
+            traitSets,
+            traitSetIndices,
+            resolveAccess,
+            context,
+            hostSession,
+            successCallback,
+            errorCallback,
+        )
+
+    def resolveProjected(
+        self,
+        entityRefs,
+        traitSet,
+        propertyProjection,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        self.__assertIsIterableOf(entityRefs, EntityReference)
+        self.__assertIsIterableOf(traitSet, str)
+        assert isinstance(propertyProjection, dict)
+        assert isinstance(resolveAccess, ResolveAccess)
+        self.__assertCallingContext(context, hostSession)
+        assert callable(successCallback)
+        assert callable(errorCallback)
+        return self.mock.resolveProjected(
+            entityRefs,
+            traitSet,
+            propertyProjection,
+            resolveAccess,
+            context,
+            hostSession,
+            successCallback,
+            errorCallback,
+        )
+
+    def resolveIfChanged(
+        self,
+        entityRefs,
+        traitSet,
+        resolveAccess,
+        generationTokens,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        self.__assertIsIterableOf(entityRefs, EntityReference)
+        self.__assertIsIterableOf(traitSet, str)
+        assert isinstance(resolveAccess, ResolveAccess)
+        self.__assertIsIterableOf(generationTokens, str)
+        assert len(generationTokens) == len(entityRefs)
+        self.__assertCallingContext(context, hostSession)
+        assert callable(successCallback)
+        assert callable(errorCallback)
+        return self.mock.resolveIfChanged(
+            entityRefs,
+            traitSet,
+            resolveAccess,
+            generationTokens,
+            context,
+            hostSession,
+            successCallback,
+            errorCallback,
+        )
+
     def getWithRelationship(
         self,
         entityReferences,
@@ -411,7 +522,7 @@ class ValidatingMockManagerInterface(ManagerInterface):
         # str itself fits this criteria since we could iterate over it
         # and each element (character) would be a str. So just be
         # explicit on the types that we accept.
-        assert isinstance(iterable, (list, tuple, set))
+        assert isinstance(iterable, (list, tuple, set, EntityReferencesView))
         for elem in iterable:
             assert isinstance(elem, expectedElemType)
 
@@ -455,6 +566,24 @@ class MockLogger(LoggerInterface):
         self.mock.log(severity, message)
 
 
+class MockTracer(TracerInterface):
+    """
+    `TracerInterface` implementation that delegates all calls to a
+    public `Mock` instance.
+    """
+
+    def __init__(self):
+        TracerInterface.__init__(self)
+        self.mock = mock.create_autospec(TracerInterface, spec_set=True, instance=True)
+        self.mock.beginSpan.return_value = 0
+
+    def beginSpan(self, name, attributes):
+        return self.mock.beginSpan(name, attributes)
+
+    def endSpan(self, spanId, attributes):
+        self.mock.endSpan(spanId, attributes)
+
+
 class MockEntityReferencePagerInterface(EntityReferencePagerInterface):
     """
     `EntityReferencePagerInterface` implementation that delegates all
@@ -476,6 +605,12 @@ class MockEntityReferencePagerInterface(EntityReferencePagerInterface):
     def next(self, hostSession):
         self.mock.next(hostSession)
 
+    def sizeHint(self, hostSession):
+        return self.mock.sizeHint(hostSession)
+
+    def drainAll(self, maxItems, hostSession):
+        return self.mock.drainAll(maxItems, hostSession)
+
     def close(self, hostSession):
         self.mock.close(hostSession)
 
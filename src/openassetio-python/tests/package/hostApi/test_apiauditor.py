@@ -0,0 +1,86 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.hostApi.ApiAuditor class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import pytest
+
+from openassetio.hostApi import ApiAuditor, Manager
+
+
+class Test_ApiAuditor_instance:
+    def test_returns_same_instance(self):
+        assert ApiAuditor.instance() is ApiAuditor.instance()
+
+
+class Test_ApiAuditor_names:
+    def test_method_names_are_indexed_by_method(self):
+        assert len(ApiAuditor.kMethodNames) == len(ApiAuditor.Method.__members__)
+        assert ApiAuditor.kMethodNames[int(ApiAuditor.Method.kRegister)] == "register"
+
+    def test_api_names_are_indexed_by_api(self):
+        assert ApiAuditor.kApiNames == ["Manager", "ManagerInterface"]
+
+
+class Test_ApiAuditor_recordCall:
+    def test_when_enabled_then_calls_are_counted(self, auditor):
+        auditor.recordCall(ApiAuditor.Api.kManager, ApiAuditor.Method.kResolve)
+        auditor.recordCall(ApiAuditor.Api.kManager, ApiAuditor.Method.kResolve)
+
+        assert auditor.callCount(ApiAuditor.Api.kManager, ApiAuditor.Method.kResolve) == 2
+        assert auditor.callCount(ApiAuditor.Api.kManagerInterface, ApiAuditor.Method.kResolve) == 0
+
+    def test_when_disabled_then_calls_are_not_counted(self, auditor):
+        auditor.setEnabled(False)
+
+        auditor.recordCall(ApiAuditor.Api.kManager, ApiAuditor.Method.kResolve)
+
+        assert not auditor.isEnabled()
+        assert auditor.callCount(ApiAuditor.Api.kManager, ApiAuditor.Method.kResolve) == 0
+
+
+class Test_ApiAuditor_coverage:
+    def test_when_manager_methods_called_then_coverage_includes_them(
+        self, auditor, mock_manager_interface, a_host_session
+    ):
+        mock_manager_interface.mock.displayName.return_value = "Stub"
+        manager = Manager(mock_manager_interface, a_host_session)
+        auditor.reset()
+
+        manager.displayName()
+        manager.displayName()
+
+        assert auditor.coverage() == {"Manager": {"displayName": 2}}
+
+    def test_when_reset_then_coverage_is_empty(self, auditor):
+        auditor.recordCall(ApiAuditor.Api.kManager, ApiAuditor.Method.kResolve)
+
+        auditor.reset()
+
+        assert auditor.coverage() == {}
+
+
+@pytest.fixture
+def auditor():
+    auditor = ApiAuditor.instance()
+    auditor.reset()
+    auditor.setEnabled(True)
+    yield auditor
+    auditor.setEnabled(False)
+    auditor.reset()
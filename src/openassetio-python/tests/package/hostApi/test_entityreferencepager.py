@@ -94,6 +94,125 @@ class Test_EntityReferencePager_get:
         method.assert_called_once_with(a_host_session)
 
 
+class Test_EntityReferencePager_prefetchDepth:
+    def test_when_prefetching_then_pages_returned_in_order(self, a_host_session):
+        pager = EntityReferencePager(
+            CountingEntityReferencePagerInterface(4), a_host_session, prefetchDepth=2
+        )
+
+        pages = [pager.get()]
+        while pager.hasNext():
+            pager.next()
+            pages.append(pager.get())
+
+        assert pages == [[EntityReference(str(idx))] for idx in range(4)]
+
+    def test_when_prefetching_and_advanced_beyond_last_page_then_page_is_empty(
+        self, a_host_session
+    ):
+        pager = EntityReferencePager(
+            CountingEntityReferencePagerInterface(1), a_host_session, prefetchDepth=2
+        )
+
+        pager.next()
+
+        assert pager.get() == []
+        assert pager.hasNext() is False
+
+    def test_when_prefetching_and_fetch_fails_then_error_raised_to_host(self, a_host_session):
+        pager_interface = CountingEntityReferencePagerInterface(3)
+        pager_interface.failing_page = 1
+        pager = EntityReferencePager(pager_interface, a_host_session, prefetchDepth=1)
+
+        pager.next()
+
+        with pytest.raises(RuntimeError, match="page failed"):
+            pager.get()
+
+
+class Test_EntityReferencePager_sizeHint:
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self, an_entity_reference_pager, mock_entity_reference_pager_interface, a_host_session
+    ):
+        method = mock_entity_reference_pager_interface.mock.sizeHint
+        method.return_value = 7
+
+        actual = an_entity_reference_pager.sizeHint()
+
+        method.assert_called_once_with(a_host_session)
+        assert actual == 7
+
+    def test_when_interface_does_not_provide_hint_then_returns_None(self, a_host_session):
+        pager = EntityReferencePager(CountingEntityReferencePagerInterface(3), a_host_session)
+
+        assert pager.sizeHint() is None
+
+
+class Test_EntityReferencePager_drainAll:
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self, an_entity_reference_pager, mock_entity_reference_pager_interface, a_host_session
+    ):
+        expected = [EntityReference("a"), EntityReference("b")]
+        method = mock_entity_reference_pager_interface.mock.drainAll
+        method.return_value = expected
+
+        actual = an_entity_reference_pager.drainAll(5)
+
+        method.assert_called_once_with(5, a_host_session)
+        assert actual == expected
+
+    def test_when_maxItems_not_provided_then_all_pages_drained(self, a_host_session):
+        pager = EntityReferencePager(CountingEntityReferencePagerInterface(3), a_host_session)
+
+        assert pager.drainAll() == [EntityReference(str(idx)) for idx in range(3)]
+        assert pager.get() == []
+        assert pager.hasNext() is False
+
+    def test_when_maxItems_reached_then_drain_stops_at_following_page(self, a_host_session):
+        pager = EntityReferencePager(CountingEntityReferencePagerInterface(4), a_host_session)
+
+        assert pager.drainAll(2) == [EntityReference("0"), EntityReference("1")]
+        assert pager.get() == [EntityReference("2")]
+
+    @pytest.mark.parametrize("max_items", (2, 5))
+    def test_when_prefetching_then_buffered_and_remaining_pages_drained(
+        self, a_host_session, max_items
+    ):
+        pager = EntityReferencePager(
+            CountingEntityReferencePagerInterface(4), a_host_session, prefetchDepth=1
+        )
+        pager.next()
+
+        expected = [EntityReference(str(idx)) for idx in range(1, 4)][:max_items]
+        assert pager.drainAll(max_items) == expected
+
+
+class CountingEntityReferencePagerInterface(EntityReferencePagerInterface):
+    """
+    Pager over a fixed number of single-entity pages, where the entity
+    reference of each page is its index.
+    """
+
+    def __init__(self, page_count):
+        EntityReferencePagerInterface.__init__(self)
+        self.page_count = page_count
+        self.current_page = 0
+        self.failing_page = None
+
+    def hasNext(self, _hostSession):
+        return self.current_page + 1 < self.page_count
+
+    def get(self, _hostSession):
+        if self.current_page == self.failing_page:
+            raise RuntimeError("page failed")
+        if self.current_page >= self.page_count:
+            return []
+        return [EntityReference(str(self.current_page))]
+
+    def next(self, _hostSession):
+        self.current_page += 1
+
+
 class FakeEntityReferencePagerInterface(EntityReferencePagerInterface):
     """
     Throwaway pager interface def, so we can create a temporary
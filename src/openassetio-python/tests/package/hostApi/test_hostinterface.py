@@ -19,6 +19,8 @@ Tests that cover the openassetio.hostApi.HostInterface class.
 
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import threading
+
 import pytest
 
 from openassetio.hostApi import HostInterface
@@ -36,6 +38,31 @@ class Test_HostInterface_displayName:
             an_unimplemented_host_interface.displayName()
 
 
+class Test_HostInterface_submit:
+    def test_when_not_overridden_then_task_is_run(self, an_unimplemented_host_interface):
+        ran = threading.Event()
+
+        an_unimplemented_host_interface.submit(ran.set)
+
+        assert ran.wait(timeout=5)
+
+
+class Test_HostInterface_parallelFor:
+    def test_when_not_overridden_then_body_is_called_with_each_index(
+        self, an_unimplemented_host_interface
+    ):
+        indices = []
+        lock = threading.Lock()
+
+        def body(idx):
+            with lock:
+                indices.append(idx)
+
+        an_unimplemented_host_interface.parallelFor(10, body)
+
+        assert sorted(indices) == list(range(10))
+
+
 @pytest.fixture
 def an_unimplemented_host_interface():
     return HostInterface()
@@ -17,18 +17,27 @@
 Tests that cover the openassetio.hostApi.Manager wrapper class.
 """
 import itertools
+import os
 
 # pylint: disable=invalid-name,redefined-outer-name,unused-argument
 # pylint: disable=too-many-lines,too-many-locals
 # pylint: disable=missing-class-docstring,missing-function-docstring
 from unittest import mock
+import asyncio
 import re
+import sys
+import threading
+import time
 
 import pytest
 
 from openassetio import (
+    CancellationToken,
+    ConditionalResolveResult,
     Context,
     EntityReference,
+    EntityReferenceBatch,
+    EntityReferencesView,
     managerApi,
     constants,
     access,
@@ -40,7 +49,7 @@ from openassetio.errors import (
     InputValidationException,
     ConfigurationException,
 )
-from openassetio.hostApi import Manager, EntityReferencePager
+from openassetio.hostApi import Manager, EntityReferencePager, ManagerMetrics, ResolveCache
 from openassetio.managerApi import EntityReferencePagerInterface, ManagerInterface
 from openassetio.trait import TraitsData
 
@@ -67,6 +76,37 @@ class Test_Manager_init:
             Manager(None, a_host_session)
 
 
+class Test_Manager_Options:
+    def test_when_default_constructed_then_all_options_are_disabled(self):
+        options = Manager.Options()
+
+        assert options.resolveCache is None
+        assert options.resolveChunkSize == 0
+        assert options.entityReferenceStringCacheCapacity == 0
+        assert options.deduplicateEntityReferences is False
+        assert options.pagerPrefetchDepth == 0
+        assert options.managerStatePoolCapacity == 0
+        assert options.persistenceTokenCacheCapacity == 0
+        assert options.metrics is None
+        assert options.backgroundChunkSize == 0
+        assert options.entityTraitsCacheCapacity == 0
+        assert options.defaultEntityReferenceCacheCapacity == 0
+
+    def test_when_constructed_with_kwargs_then_options_are_set(self):
+        options = Manager.Options(resolveChunkSize=2, deduplicateEntityReferences=True)
+
+        assert options.resolveChunkSize == 2
+        assert options.deduplicateEntityReferences is True
+        assert options.entityTraitsCacheCapacity == 0
+
+    def test_options_are_writable(self):
+        options = Manager.Options()
+
+        options.entityTraitsCacheCapacity = 10
+
+        assert options.entityTraitsCacheCapacity == 10
+
+
 class Test_Manager_identifier:
     def test_method_defined_in_cpp(self, method_introspector):
         assert not method_introspector.is_defined_in_python(Manager.identifier)
@@ -178,6 +218,30 @@ class Test_Manager_updateTerminology:
         _ret = manager.updateTerminology(input_dict)
         assert input_dict == {"k": "v"}
 
+    def test_when_called_again_with_same_terms_then_result_is_cached(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        method = mock_manager_interface.mock.updateTerminology
+        method.return_value = {"k": "w"}
+
+        manager.updateTerminology({"k": "v"})
+        ret = manager.updateTerminology({"k": "v"})
+
+        assert ret == {"k": "w"}
+        method.assert_called_once_with({"k": "v"}, a_host_session)
+
+    def test_when_caches_flushed_then_manager_is_queried_again(
+        self, manager, mock_manager_interface
+    ):
+        method = mock_manager_interface.mock.updateTerminology
+        method.return_value = {"k": "w"}
+
+        manager.updateTerminology({"k": "v"})
+        manager.flushCaches()
+        manager.updateTerminology({"k": "v"})
+
+        assert method.call_count == 2
+
 
 class Test_Manager_settings:
     def test_method_defined_in_cpp(self, method_introspector):
@@ -241,6 +305,22 @@ class Test_Manager_initialize:
             "Entity reference prefix given but is an invalid type: should be a string.",
         )
 
+    def test_when_entity_ref_pattern_invalid_then_warning_printed(
+        self, manager, mock_manager_interface, mock_logger
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPattern: "asset(://"
+        }
+
+        manager.initialize({})
+
+        mock_logger.mock.log.assert_called_once()
+        severity, message = mock_logger.mock.log.call_args[0]
+        assert severity == mock_logger.Severity.kWarning
+        assert message.startswith(
+            "Entity reference pattern 'asset(://' is invalid and will be ignored: "
+        )
+
 
 required_capabilities = [
     ManagerInterface.Capability.kEntityReferenceIdentification,
@@ -258,6 +338,51 @@ required_capabilities_powerset = list(
 )
 
 
+class Test_Manager_initializeAsync:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.initializeAsync)
+        assert method_introspector.is_implemented_once(Manager, "initializeAsync")
+
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        a_dict = {"k": "v"}
+
+        manager.initializeAsync(a_dict)
+        manager.waitForInitialization()
+
+        mock_manager_interface.mock.initialize.assert_called_once_with(a_dict, a_host_session)
+
+    def test_when_queried_then_waits_for_initialization(self, manager, mock_manager_interface):
+        initialized = threading.Event()
+
+        def initialize(*_):
+            time.sleep(0.01)
+            initialized.set()
+            return mock.DEFAULT
+
+        mock_manager_interface.mock.initialize.side_effect = initialize
+        mock_manager_interface.mock.settings.return_value = {}
+
+        manager.initializeAsync({})
+        manager.settings()
+
+        assert initialized.is_set()
+
+
+class Test_Manager_waitForInitialization:
+    def test_when_not_initialized_asynchronously_then_returns(self, manager):
+        manager.waitForInitialization()
+
+    def test_when_initialization_fails_then_error_raised(self, manager, mock_manager_interface):
+        mock_manager_interface.mock.initialize.side_effect = ConfigurationException("oops")
+
+        manager.initializeAsync({})
+
+        with pytest.raises(ConfigurationException, match="oops"):
+            manager.waitForInitialization()
+
+
 class Test_Manager_initialize_capablility_check:
     def test_has_capability_called_after_initialize(
         self, manager, a_host_session, mock_manager_interface
@@ -345,6 +470,28 @@ class Test_Manager_hasCapability:
         method.assert_called_once_with(managerinterface_capability)
         assert actual_return_value == return_value
 
+    @pytest.mark.parametrize("return_value", (True, False))
+    def test_when_initialized_then_interface_not_called(
+        self, manager, mock_manager_interface, return_value
+    ):
+        required_capabilities = (
+            ManagerInterface.Capability.kEntityReferenceIdentification,
+            ManagerInterface.Capability.kManagementPolicyQueries,
+            ManagerInterface.Capability.kEntityTraitIntrospection,
+        )
+
+        def has_capability(capability):
+            return return_value or capability in required_capabilities
+
+        mock_manager_interface.mock.hasCapability.side_effect = has_capability
+        manager.initialize({})
+        mock_manager_interface.mock.hasCapability.reset_mock()
+
+        assert manager.hasCapability(Manager.Capability.kResolution) == return_value
+        assert manager.info() == mock_manager_interface.mock.info.return_value
+        mock_manager_interface.mock.hasCapability.assert_not_called()
+        mock_manager_interface.mock.info.assert_called_once()
+
 
 class Test_Manager_flushCaches:
     def test_method_defined_in_cpp(self, method_introspector):
@@ -358,6 +505,31 @@ class Test_Manager_flushCaches:
         manager.flushCaches()
         method.assert_called_once_with(a_host_session)
 
+    def test_when_given_entities_then_wraps_flushEntityCaches_of_the_held_interface(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        refs = [EntityReference("asset://a")]
+
+        manager.flushCaches(refs)
+
+        mock_manager_interface.mock.flushEntityCaches.assert_called_once_with(refs, a_host_session)
+        mock_manager_interface.mock.flushCaches.assert_not_called()
+
+
+class Test_Manager_flushCachesWithPrefix:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.flushCachesWithPrefix)
+        assert method_introspector.is_implemented_once(Manager, "flushCachesWithPrefix")
+
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        manager.flushCachesWithPrefix("asset://shot010/")
+
+        mock_manager_interface.mock.flushCachesWithPrefix.assert_called_once_with(
+            "asset://shot010/", a_host_session
+        )
+
 
 class Test_Manager_isEntityReferenceString:
     def test_method_defined_in_cpp(self, method_introspector):
@@ -399,6 +571,134 @@ class Test_Manager_isEntityReferenceString:
         assert not mock_manager_interface.mock.isEntityReferenceString.called
         assert actual is expected
 
+    @pytest.mark.parametrize(
+        "entity_ref,expected",
+        (
+            ("asset://my_asset", True),
+            ("shot://my_shot", True),
+            ("sh", False),
+            ("/home/user/my_asset", False),
+        ),
+    )
+    def test_when_prefixes_given_in_info_then_prefixes_used_and_interface_not_called(
+        self, manager, mock_manager_interface, entity_ref, expected
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefixes: "asset://\nshot://"
+        }
+        manager.initialize({})
+
+        actual = manager.isEntityReferenceString(entity_ref)
+
+        assert not mock_manager_interface.mock.isEntityReferenceString.called
+        assert actual is expected
+
+    @pytest.mark.parametrize(
+        "entity_ref,expected",
+        (
+            ("asset://my_asset", True),
+            ("v2.asset://my_asset", True),
+            ("shot://my_shot", True),
+            ("/asset://my_asset", False),
+            ("v.asset://my_asset", False),
+        ),
+    )
+    def test_when_pattern_given_in_info_then_pattern_used_and_interface_not_called(
+        self, manager, mock_manager_interface, entity_ref, expected
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefix: "shot://",
+            constants.kInfoKey_EntityReferencesMatchPattern: r"(v[0-9]+\.)?asset://",
+        }
+        manager.initialize({})
+
+        actual = manager.isEntityReferenceString(entity_ref)
+
+        assert not mock_manager_interface.mock.isEntityReferenceString.called
+        assert actual is expected
+
+
+class Test_Manager_isEntityReferenceString_with_cache:
+    def test_when_queried_twice_then_interface_called_once(
+        self, mock_manager_interface, a_host_session, a_ref_string
+    ):
+        manager = Manager(
+            mock_manager_interface,
+            a_host_session,
+            Manager.Options(entityReferenceStringCacheCapacity=10),
+        )
+        method = mock_manager_interface.mock.isEntityReferenceString
+        method.return_value = False
+
+        assert manager.isEntityReferenceString(a_ref_string) is False
+        assert manager.isEntityReferenceString(a_ref_string) is False
+        method.assert_called_once_with(a_ref_string, a_host_session)
+
+    def test_when_caches_flushed_then_interface_called_again(
+        self, mock_manager_interface, a_host_session, a_ref_string
+    ):
+        manager = Manager(
+            mock_manager_interface,
+            a_host_session,
+            Manager.Options(entityReferenceStringCacheCapacity=10),
+        )
+        method = mock_manager_interface.mock.isEntityReferenceString
+        method.return_value = True
+
+        manager.isEntityReferenceString(a_ref_string)
+        manager.flushCaches()
+        manager.isEntityReferenceString(a_ref_string)
+
+        assert method.call_count == 2
+
+
+class Test_Manager_areEntityReferenceStrings:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.areEntityReferenceStrings)
+        assert method_introspector.is_implemented_once(Manager, "areEntityReferenceStrings")
+
+    def test_when_interface_has_no_batch_implementation_then_singular_method_used(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        method = mock_manager_interface.mock.isEntityReferenceString
+        method.side_effect = lambda someString, _: someString.startswith("asset://")
+
+        actual = manager.areEntityReferenceStrings(["asset://a", "/some/path", "asset://b"])
+
+        assert actual == [True, False, True]
+        assert method.call_count == 3
+
+    def test_when_prefix_given_in_info_then_prefix_used_and_interface_not_called(
+        self, manager, mock_manager_interface
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefix: "asset://"
+        }
+        manager.initialize({})
+
+        actual = manager.areEntityReferenceStrings(["asset://a", "/some/path"])
+
+        assert not mock_manager_interface.mock.isEntityReferenceString.called
+        assert actual == [True, False]
+
+    def test_when_cache_configured_then_only_uncached_strings_queried(
+        self, mock_manager_interface, a_host_session
+    ):
+        manager = Manager(
+            mock_manager_interface,
+            a_host_session,
+            Manager.Options(entityReferenceStringCacheCapacity=10),
+        )
+        method = mock_manager_interface.mock.isEntityReferenceString
+        method.side_effect = lambda someString, _: someString.startswith("asset://")
+        manager.isEntityReferenceString("asset://a")
+        method.reset_mock()
+
+        actual = manager.areEntityReferenceStrings(["asset://a", "/some/path"])
+
+        assert actual == [True, False]
+        method.assert_called_once_with("/some/path", a_host_session)
+
 
 class Test_Manager_createEntityReference:
     def test_method_defined_in_cpp(self, method_introspector):
@@ -498,6 +798,45 @@ class Test_Manager_entityExists:
         error_callback.assert_called_once_with(456, a_batch_element_error)
 
 
+class Test_Manager_entityExists_with_EntityReferenceBatch:
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        a_context,
+        invoke_entityExists_success_cb,
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+        method = mock_manager_interface.mock.entityExists
+        method.side_effect = lambda *_args: invoke_entityExists_success_cb(1, True)
+
+        manager.entityExists(
+            EntityReferenceBatch(some_refs), a_context, success_callback, error_callback
+        )
+
+        method.assert_called_once_with(some_refs, a_context, a_host_session, mock.ANY, mock.ANY)
+        success_callback.assert_called_once_with(1, True)
+        error_callback.assert_not_called()
+
+
+class Test_Manager_entityExists_with_returned_results:
+    def test_when_interface_returns_results_then_results_given_to_callbacks(
+        self, manager, mock_manager_interface, some_refs, a_context, a_batch_element_error
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+        method = mock_manager_interface.mock.entityExists
+        method.return_value = [(1, True), (0, a_batch_element_error)]
+
+        manager.entityExists(some_refs, a_context, success_callback, error_callback)
+
+        success_callback.assert_called_once_with(1, True)
+        error_callback.assert_called_once_with(0, a_batch_element_error)
+
+
 class Test_Manager_defaultEntityReference:
     def test_method_defined_in_cpp(self, method_introspector):
         assert not method_introspector.is_defined_in_python(Manager.defaultEntityReference)
@@ -546,6 +885,36 @@ class Test_Manager_defaultEntityReference:
         success_callback.assert_has_calls([mock.call(1, None), mock.call(0, a_ref)])
         error_callback.assert_called_once_with(2, a_batch_element_error)
 
+    def test_when_cache_configured_then_repeated_query_served_from_cache(
+        self,
+        mock_manager_interface,
+        a_host_session,
+        a_context,
+        a_ref,
+        invoke_defaultEntityReference_success_cb,
+    ):
+        manager = Manager(
+            mock_manager_interface,
+            a_host_session,
+            Manager.Options(defaultEntityReferenceCacheCapacity=10),
+        )
+        method = mock_manager_interface.mock.defaultEntityReference
+        method.side_effect = lambda *_args: invoke_defaultEntityReference_success_cb(0, a_ref)
+        success_callback = mock.Mock()
+
+        for _ in range(2):
+            manager.defaultEntityReference(
+                [{"a_trait"}],
+                access.DefaultEntityAccess.kWrite,
+                a_context,
+                success_callback,
+                mock.Mock(),
+            )
+
+        method.assert_called_once()
+        success_callback.assert_has_calls([mock.call(0, a_ref)] * 2)
+        assert manager.memoryUsage().defaultEntityReferenceCache > 0
+
 
 class FakeEntityReferencePagerInterface(EntityReferencePagerInterface):
     """
@@ -881,74 +1250,266 @@ class Test_Manager_getWithRelationships:
             )
 
 
-class Test_Manager_BatchElementErrorPolicyTag:
-    def test_unique(self):
-        assert (
-            Manager.BatchElementErrorPolicyTag.kVariant
-            is not Manager.BatchElementErrorPolicyTag.kException
-        )
-
-
-class Test_Manager_resolve_with_callback_signature:
+class Test_Manager_getWithRelationshipsMatrix:
     def test_method_defined_in_cpp(self, method_introspector):
-        assert not method_introspector.is_defined_in_python(Manager.resolve)
-        assert method_introspector.is_implemented_once(Manager, "resolve")
+        assert not method_introspector.is_defined_in_python(Manager.getWithRelationshipsMatrix)
+        assert method_introspector.is_implemented_once(Manager, "getWithRelationshipsMatrix")
 
-    def test_wraps_the_corresponding_method_of_the_held_interface(
+    def test_when_interface_has_no_matrix_implementation_then_queries_each_entity(
         self,
         manager,
         mock_manager_interface,
         a_host_session,
         some_refs,
+        a_batch_element_error,
+        an_empty_traitsdata,
         an_entity_trait_set,
+        mock_entity_reference_pager_interface,
         a_context,
-        a_traitsdata,
-        a_batch_element_error,
-        invoke_resolve_success_cb,
-        invoke_resolve_error_cb,
+        invoke_getWithRelationships_success_cb,
+        invoke_getWithRelationships_error_cb,
     ):
+        two_datas = [an_empty_traitsdata, an_empty_traitsdata]
+        page_size = 3
+
         success_callback = mock.Mock()
         error_callback = mock.Mock()
 
-        method = mock_manager_interface.mock.resolve
+        method = mock_manager_interface.mock.getWithRelationships
 
         def call_callbacks(*_args):
-            invoke_resolve_success_cb(123, a_traitsdata)
-            invoke_resolve_error_cb(456, a_batch_element_error)
+            invoke_getWithRelationships_success_cb(0, mock_entity_reference_pager_interface)
+            invoke_getWithRelationships_error_cb(1, a_batch_element_error)
 
         method.side_effect = call_callbacks
 
-        manager.resolve(
+        manager.getWithRelationshipsMatrix(
             some_refs,
-            an_entity_trait_set,
-            access.ResolveAccess.kRead,
+            two_datas,
+            page_size,
+            access.RelationsAccess.kRead,
             a_context,
             success_callback,
             error_callback,
+            resultTraitSet=an_entity_trait_set,
         )
 
-        method.assert_called_once_with(
-            some_refs,
-            an_entity_trait_set,
-            access.ResolveAccess.kRead,
-            a_context,
-            a_host_session,
-            mock.ANY,
-            mock.ANY,
-        )
+        assert method.call_args_list == [
+            mock.call(
+                ref,
+                two_datas,
+                an_entity_trait_set,
+                page_size,
+                access.RelationsAccess.kRead,
+                a_context,
+                a_host_session,
+                mock.ANY,
+                mock.ANY,
+            )
+            for ref in some_refs
+        ]
 
-        success_callback.assert_called_once_with(123, a_traitsdata)
-        error_callback.assert_called_once_with(456, a_batch_element_error)
+        assert [call[0][0] for call in success_callback.call_args_list] == [0, 2]
+        for call in success_callback.call_args_list:
+            assert isinstance(call[0][1], EntityReferencePager)
+        assert error_callback.call_args_list == [
+            mock.call(1, a_batch_element_error),
+            mock.call(3, a_batch_element_error),
+        ]
 
+    def test_when_zero_pageSize_then_InputValidationException_is_raised(
+        self, manager, some_refs, an_empty_traitsdata, a_context
+    ):
+        with pytest.raises(InputValidationException):
+            manager.getWithRelationshipsMatrix(
+                some_refs,
+                [an_empty_traitsdata],
+                0,
+                access.RelationsAccess.kRead,
+                a_context,
+                mock.Mock(),
+                mock.Mock(),
+            )
 
-batch_element_error_codes = [
-    BatchElementError.ErrorCode.kUnknown,
-    BatchElementError.ErrorCode.kInvalidEntityReference,
-    BatchElementError.ErrorCode.kMalformedEntityReference,
-    BatchElementError.ErrorCode.kEntityAccessError,
-    BatchElementError.ErrorCode.kEntityResolutionError,
+    def test_when_traitsdata_is_none_then_InputValidationException_is_raised(
+        self, manager, some_refs, a_context
+    ):
+        with pytest.raises(InputValidationException, match="Traits data cannot be None"):
+            manager.getWithRelationshipsMatrix(
+                some_refs,
+                [None],
+                1,
+                access.RelationsAccess.kRead,
+                a_context,
+                mock.Mock(),
+                mock.Mock(),
+            )
+
+
+class Test_Manager_traverseRelationships:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.traverseRelationships)
+        assert method_introspector.is_implemented_once(Manager, "traverseRelationships")
+
+    def test_when_interface_has_no_traversal_implementation_then_queries_each_hop_in_one_batch(
+        self, manager, mock_manager_interface, an_empty_traitsdata, a_context
+    ):
+        graph = {"a": ["b", "c"], "b": ["a", "d"]}
+
+        class ListPager(EntityReferencePagerInterface):
+            def __init__(self, refs):
+                EntityReferencePagerInterface.__init__(self)
+                self.__refs = refs
+
+            def hasNext(self, _hostSession):
+                return False
+
+            def get(self, _hostSession):
+                return self.__refs
+
+            def next(self, _hostSession):
+                self.__refs = []
+
+        def call_callbacks(entityReferences, *args):
+            success_cb = args[-2]
+            for idx, ref in enumerate(entityReferences):
+                success_cb(
+                    idx,
+                    ListPager([EntityReference(r) for r in graph.get(ref.toString(), [])]),
+                )
+
+        method = mock_manager_interface.mock.getWithRelationship
+        method.side_effect = call_callbacks
+
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+
+        manager.traverseRelationships(
+            [EntityReference("a")],
+            [an_empty_traitsdata],
+            10,
+            access.RelationsAccess.kRead,
+            a_context,
+            success_callback,
+            error_callback,
+        )
+
+        assert [list(call[0][0]) for call in method.call_args_list] == [
+            [EntityReference("a")],
+            [EntityReference("b"), EntityReference("c")],
+            [EntityReference("d")],
+        ]
+        success_callback.assert_called_once_with(
+            0,
+            [
+                [EntityReference("b"), EntityReference("c")],
+                [EntityReference("d")],
+            ],
+        )
+        error_callback.assert_not_called()
+
+    def test_when_relationshipTraitsDatas_is_empty_then_InputValidationException_is_raised(
+        self, manager, some_refs, a_context
+    ):
+        with pytest.raises(InputValidationException):
+            manager.traverseRelationships(
+                some_refs,
+                [],
+                1,
+                access.RelationsAccess.kRead,
+                a_context,
+                mock.Mock(),
+                mock.Mock(),
+            )
+
+
+class Test_Manager_BatchElementErrorPolicyTag:
+    def test_unique(self):
+        assert (
+            Manager.BatchElementErrorPolicyTag.kVariant
+            is not Manager.BatchElementErrorPolicyTag.kException
+        )
+
+
+class Test_Manager_resolve_with_callback_signature:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.resolve)
+        assert method_introspector.is_implemented_once(Manager, "resolve")
+
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        a_traitsdata,
+        a_batch_element_error,
+        invoke_resolve_success_cb,
+        invoke_resolve_error_cb,
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+
+        method = mock_manager_interface.mock.resolve
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(123, a_traitsdata)
+            invoke_resolve_error_cb(456, a_batch_element_error)
+
+        method.side_effect = call_callbacks
+
+        manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            success_callback,
+            error_callback,
+        )
+
+        method.assert_called_once_with(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+        success_callback.assert_called_once_with(123, a_traitsdata)
+        error_callback.assert_called_once_with(456, a_batch_element_error)
+
+    def test_interface_receives_view_that_remains_valid_after_call(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            mock.Mock(),
+            mock.Mock(),
+        )
+
+        # The mock retains the arguments, so the view must have taken a
+        # copy of the references before the call returned.
+        received_refs = mock_manager_interface.mock.resolve.call_args.args[0]
+        assert isinstance(received_refs, EntityReferencesView)
+        assert list(received_refs) == some_refs
+
+
+batch_element_error_codes = [
+    BatchElementError.ErrorCode.kUnknown,
+    BatchElementError.ErrorCode.kInvalidEntityReference,
+    BatchElementError.ErrorCode.kMalformedEntityReference,
+    BatchElementError.ErrorCode.kEntityAccessError,
+    BatchElementError.ErrorCode.kEntityResolutionError,
     BatchElementError.ErrorCode.kInvalidPreflightHint,
     BatchElementError.ErrorCode.kInvalidTraitSet,
+    BatchElementError.ErrorCode.kCancelled,
 ]
 
 
@@ -1167,211 +1728,1022 @@ class Test_Manager_resolve_with_batch_default_overload:
 
         method.side_effect = call_callbacks
 
-        actual_traitsdatas = manager.resolve(
-            some_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+        actual_traitsdatas = manager.resolve(
+            some_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+        )
+
+        method.assert_called_once_with(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+        assert len(actual_traitsdatas) == 2
+        assert actual_traitsdatas[0] is some_entity_traitsdatas[0]
+        assert actual_traitsdatas[1] is some_entity_traitsdatas[1]
+
+
+class Test_Manager_resolve_with_batch_throwing_overload:
+    def test_when_success_then_multiple_TraitsDatas_returned(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        some_entity_traitsdatas,
+        invoke_resolve_success_cb,
+    ):
+        method = mock_manager_interface.mock.resolve
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(0, some_entity_traitsdatas[0])
+            invoke_resolve_success_cb(1, some_entity_traitsdatas[1])
+
+        method.side_effect = call_callbacks
+
+        actual_traitsdatas = manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kException,
+        )
+
+        method.assert_called_once_with(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+        assert len(actual_traitsdatas) == 2
+        assert actual_traitsdatas[0] is some_entity_traitsdatas[0]
+        assert actual_traitsdatas[1] is some_entity_traitsdatas[1]
+
+    def test_when_success_out_of_order_then_TraitsDatas_returned_in_order(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        some_entity_traitsdatas,
+        invoke_resolve_success_cb,
+    ):
+        method = mock_manager_interface.mock.resolve
+
+        def call_callbacks(*_args):
+            # Success
+            invoke_resolve_success_cb(1, some_entity_traitsdatas[1])
+            invoke_resolve_success_cb(0, some_entity_traitsdatas[0])
+
+        method.side_effect = call_callbacks
+
+        actual_traitsdatas = manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kException,
+        )
+
+        method.assert_called_once_with(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+        assert len(actual_traitsdatas) == 2
+        assert actual_traitsdatas[0] is some_entity_traitsdatas[0]
+        assert actual_traitsdatas[1] is some_entity_traitsdatas[1]
+
+
+class Test_Manager_resolve_with_batch_variant_overload:
+    @pytest.mark.parametrize("error_code", batch_element_error_codes)
+    def test_when_mixed_output_then_returned_list_contains_output(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        a_traitsdata,
+        error_code,
+        invoke_resolve_success_cb,
+        invoke_resolve_error_cb,
+    ):
+        method = mock_manager_interface.mock.resolve
+        batch_element_error = BatchElementError(error_code, "some string ✨")
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(0, a_traitsdata)
+            invoke_resolve_error_cb(1, batch_element_error)
+
+        method.side_effect = call_callbacks
+
+        actual_traitsdata_and_error = manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        )
+
+        method.assert_called_once_with(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+        assert len(actual_traitsdata_and_error) == 2
+        assert actual_traitsdata_and_error[0] is a_traitsdata
+        assert actual_traitsdata_and_error[1] == batch_element_error
+
+    def test_when_mixed_output_out_of_order_then_output_returned_in_order(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        a_ref,
+        an_entity_trait_set,
+        a_context,
+        invoke_resolve_success_cb,
+        invoke_resolve_error_cb,
+    ):
+        method = mock_manager_interface.mock.resolve
+
+        entity_refs = [a_ref] * 4
+
+        batch_element_error0 = BatchElementError(
+            BatchElementError.ErrorCode.kEntityResolutionError, "0 some string ✨"
+        )
+        traitsdata1 = TraitsData({"trait1"})
+        batch_element_error2 = BatchElementError(
+            BatchElementError.ErrorCode.kEntityResolutionError, "0 some string ✨"
+        )
+        traitsdata3 = TraitsData({"trait3"})
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(1, traitsdata1)
+            invoke_resolve_error_cb(0, batch_element_error0)
+            invoke_resolve_success_cb(3, traitsdata3)
+            invoke_resolve_error_cb(2, batch_element_error2)
+
+        method.side_effect = call_callbacks
+
+        actual_traitsdata_and_error = manager.resolve(
+            entity_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        )
+
+        method.assert_called_once_with(
+            entity_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+        assert len(actual_traitsdata_and_error) == 4
+        assert actual_traitsdata_and_error[0] == batch_element_error0
+        assert actual_traitsdata_and_error[1] is traitsdata1
+        assert actual_traitsdata_and_error[2] == batch_element_error2
+        assert actual_traitsdata_and_error[3] is traitsdata3
+
+
+class Test_Manager_resolve_with_cache:
+    def test_when_resolved_twice_then_second_resolve_served_from_cache(
+        self,
+        mock_manager_interface,
+        a_host_session,
+        an_entity_trait_set,
+        a_context,
+        invoke_resolve_success_cb,
+    ):
+        cache = ResolveCache(10)
+        manager = Manager(
+            mock_manager_interface, a_host_session, Manager.Options(resolveCache=cache)
+        )
+        a_ref = EntityReference("asset://a")
+        a_traitsdata = TraitsData({"a_trait"})
+
+        method = mock_manager_interface.mock.resolve
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(0, a_traitsdata)
+
+        method.side_effect = call_callbacks
+
+        first = manager.resolve(a_ref, an_entity_trait_set, access.ResolveAccess.kRead, a_context)
+        second = manager.resolve(a_ref, an_entity_trait_set, access.ResolveAccess.kRead, a_context)
+
+        method.assert_called_once()
+        assert first is a_traitsdata
+        assert second == a_traitsdata
+        assert cache.size() == 1
+        assert cache.statistics().hits == 1
+
+    def test_when_caches_flushed_then_cache_is_cleared(
+        self, mock_manager_interface, a_host_session, a_context
+    ):
+        cache = ResolveCache(10)
+        manager = Manager(
+            mock_manager_interface, a_host_session, Manager.Options(resolveCache=cache)
+        )
+        cache.insert(
+            EntityReference("asset://a"),
+            set(),
+            access.ResolveAccess.kRead,
+            a_context,
+            TraitsData(),
+        )
+
+        manager.flushCaches()
+
+        assert cache.size() == 0
+
+    def test_when_caches_flushed_with_prefix_then_only_matching_entries_are_evicted(
+        self, mock_manager_interface, a_host_session, a_context
+    ):
+        cache = ResolveCache(10)
+        manager = Manager(
+            mock_manager_interface, a_host_session, Manager.Options(resolveCache=cache)
+        )
+        for ref in ("asset://shot010/a", "asset://shot020/a"):
+            cache.insert(
+                EntityReference(ref), set(), access.ResolveAccess.kRead, a_context, TraitsData()
+            )
+
+        manager.flushCachesWithPrefix("asset://shot010/")
+
+        assert cache.size() == 1
+        assert cache.lookup(
+            EntityReference("asset://shot020/a"), set(), access.ResolveAccess.kRead, a_context
+        )
+
+    def test_when_entities_changed_then_only_those_entities_are_evicted(
+        self, mock_manager_interface, a_host_session, a_context
+    ):
+        cache = ResolveCache(10)
+        # Retain the manager, whose lifetime bounds the subscription.
+        _manager = Manager(
+            mock_manager_interface, a_host_session, Manager.Options(resolveCache=cache)
+        )
+        for ref in ("asset://a", "asset://b"):
+            cache.insert(
+                EntityReference(ref), set(), access.ResolveAccess.kRead, a_context, TraitsData()
+            )
+
+        a_host_session.notifyEntitiesChanged([EntityReference("asset://a")])
+
+        assert cache.size() == 1
+        assert cache.lookup(
+            EntityReference("asset://b"), set(), access.ResolveAccess.kRead, a_context
+        )
+
+    @pytest.mark.skipif(sys.platform == "win32", reason="Shared memory requires POSIX")
+    def test_when_caches_share_a_tier_then_entries_are_shared(self, a_context):
+        shared_tier = ResolveCache.SharedTier(f"openassetio-test-resolve-{os.getpid()}", 16)
+        cache = ResolveCache(10, shared_tier)
+        other_cache = ResolveCache(10, shared_tier)
+        a_traitsdata = TraitsData({"a_trait"})
+        cache.clear()
+
+        cache.insert(
+            EntityReference("asset://a"),
+            set(),
+            access.ResolveAccess.kRead,
+            a_context,
+            a_traitsdata,
+        )
+        cached = other_cache.lookup(
+            EntityReference("asset://a"), set(), access.ResolveAccess.kRead, a_context
+        )
+
+        assert cached == a_traitsdata
+        assert other_cache.statistics().sharedHits == 1
+
+    @pytest.mark.skipif(sys.platform == "win32", reason="Shared memory requires POSIX")
+    def test_when_caches_are_for_different_managers_then_entries_are_not_shared(
+        self, a_context
+    ):
+        shared_tier = ResolveCache.SharedTier(f"openassetio-test-resolve-{os.getpid()}", 16)
+        cache = ResolveCache(10, shared_tier)
+        other_cache = ResolveCache(10, shared_tier)
+        cache.setManagerIdentity("org.openassetio.test.a", {"a_setting": 1})
+        other_cache.setManagerIdentity("org.openassetio.test.b", {"a_setting": 1})
+        cache.clear()
+
+        cache.insert(
+            EntityReference("asset://a"),
+            set(),
+            access.ResolveAccess.kRead,
+            a_context,
+            TraitsData({"a_trait"}),
+        )
+
+        assert (
+            other_cache.lookup(
+                EntityReference("asset://a"), set(), access.ResolveAccess.kRead, a_context
+            )
+            is None
+        )
+
+    def test_when_resolve_cache_token_changes_then_cache_is_cleared(
+        self, mock_manager_interface, a_host_session, a_context
+    ):
+        cache = ResolveCache(10)
+        manager = Manager(
+            mock_manager_interface, a_host_session, Manager.Options(resolveCache=cache)
+        )
+        mock_manager_interface.mock.identifier.return_value = "org.openassetio.test"
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_ResolveCacheToken: "v1"
+        }
+        manager.initialize({})
+        cache.insert(
+            EntityReference("asset://a"),
+            set(),
+            access.ResolveAccess.kRead,
+            a_context,
+            TraitsData(),
+        )
+
+        manager.initialize({})
+
+        assert cache.size() == 1
+
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_ResolveCacheToken: "v2"
+        }
+        manager.initialize({})
+
+        assert cache.size() == 0
+
+    @pytest.mark.skipif(sys.platform == "win32", reason="Memory-mapped files require POSIX")
+    def test_when_cache_is_persistent_then_entries_survive_the_cache(self, a_context, tmp_path):
+        shared_tier = ResolveCache.SharedTier("", 16, path=str(tmp_path / "resolves.cache"))
+        a_traitsdata = TraitsData({"a_trait"})
+        ResolveCache(10, shared_tier).insert(
+            EntityReference("asset://a"),
+            set(),
+            access.ResolveAccess.kRead,
+            a_context,
+            a_traitsdata,
+        )
+
+        cached = ResolveCache(10, shared_tier).lookup(
+            EntityReference("asset://a"), set(), access.ResolveAccess.kRead, a_context
+        )
+
+        assert cached == a_traitsdata
+
+
+class Test_Manager_resolve_with_metrics:
+    def test_when_resolved_then_outcome_recorded_to_metrics(
+        self,
+        mock_manager_interface,
+        a_host_session,
+        an_entity_trait_set,
+        a_context,
+        invoke_resolve_success_cb,
+        invoke_resolve_error_cb,
+    ):
+        metrics = ManagerMetrics()
+        manager = Manager(mock_manager_interface, a_host_session, Manager.Options(metrics=metrics))
+        a_ref = EntityReference("asset://a")
+        an_error = BatchElementError(BatchElementError.ErrorCode.kEntityResolutionError, "bad")
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(0, TraitsData())
+            invoke_resolve_error_cb(1, an_error)
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        manager.resolve(
+            [a_ref, a_ref],
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            lambda _idx, _data: None,
+            lambda _idx, _error: None,
+        )
+
+        statistics = metrics.snapshot().at(ManagerMetrics.Method.kResolve)
+        assert statistics.calls == 1
+        assert statistics.exceptions == 0
+        assert statistics.successes == 1
+        assert statistics.errors[BatchElementError.ErrorCode.kEntityResolutionError] == 1
+        assert sum(statistics.latencyBuckets) == 1
+
+    def test_when_statistics_retrieved_then_calls_since_previous_retrieval_returned(
+        self, mock_manager_interface, a_host_session, an_entity_trait_set, a_context
+    ):
+        metrics = ManagerMetrics()
+        manager = Manager(mock_manager_interface, a_host_session, Manager.Options(metrics=metrics))
+
+        def resolve():
+            manager.resolve(
+                [EntityReference("asset://a")],
+                an_entity_trait_set,
+                access.ResolveAccess.kRead,
+                a_context,
+                lambda _idx, _data: None,
+                lambda _idx, _error: None,
+            )
+
+        resolve()
+        resolve()
+        first = manager.statistics()
+        resolve()
+        second = manager.statistics()
+
+        assert first.at(ManagerMetrics.Method.kResolve).calls == 2
+        assert second.at(ManagerMetrics.Method.kResolve).calls == 1
+        assert metrics.snapshot().at(ManagerMetrics.Method.kResolve).calls == 3
+
+    def test_when_no_metrics_then_statistics_is_None(self, mock_manager_interface, a_host_session):
+        manager = Manager(mock_manager_interface, a_host_session)
+
+        assert manager.statistics() is None
+
+
+class Test_Manager_memoryUsage:
+    def test_when_no_resolve_cache_then_resolve_cache_usage_is_zero(
+        self, mock_manager_interface, a_host_session
+    ):
+        manager = Manager(mock_manager_interface, a_host_session)
+
+        usage = manager.memoryUsage()
+
+        assert usage.resolveCache == 0
+        assert usage.entityTraitsCache == 0
+        assert usage.defaultEntityReferenceCache == 0
+        assert usage.total == (
+            usage.managementPolicyCache
+            + usage.entityReferenceStringCache
+            + usage.persistenceTokenCache
+        )
+
+    def test_when_resolve_cache_populated_then_usage_includes_cached_results(
+        self, mock_manager_interface, a_host_session, a_context
+    ):
+        cache = ResolveCache(10)
+        manager = Manager(
+            mock_manager_interface, a_host_session, Manager.Options(resolveCache=cache)
+        )
+        a_traitsdata = TraitsData()
+        a_traitsdata.setTraitProperty("a_trait", "a_key", "x" * 1000)
+        before = manager.memoryUsage()
+
+        cache.insert(
+            EntityReference("asset://a"),
+            set(),
+            access.ResolveAccess.kRead,
+            a_context,
+            a_traitsdata,
+        )
+
+        after = manager.memoryUsage()
+        assert after.resolveCache == cache.memoryUsage()
+        assert after.resolveCache >= before.resolveCache + a_traitsdata.memoryUsage()
+        assert after.total - before.total == after.resolveCache - before.resolveCache
+
+
+class Test_Manager_resolve_with_returned_results:
+    def test_when_interface_returns_results_then_results_given_to_callbacks(
+        self,
+        manager,
+        mock_manager_interface,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        invoke_resolve_success_cb,
+    ):
+        a_traitsdata = TraitsData({"a_trait"})
+        another_traitsdata = TraitsData({"another_trait"})
+        results = []
+        method = mock_manager_interface.mock.resolve
+
+        def call_callback_and_return_results(*_args):
+            invoke_resolve_success_cb(0, a_traitsdata)
+            return [(1, another_traitsdata)]
+
+        method.side_effect = call_callback_and_return_results
+
+        manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            lambda idx, data: results.append((idx, data)),
+            lambda idx, error: results.append((idx, error)),
+        )
+
+        assert results == [(0, a_traitsdata), (1, another_traitsdata)]
+
+    def test_when_interface_returns_malformed_results_then_raises_InputValidationException(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        mock_manager_interface.mock.resolve.return_value = [(0, "not a TraitsData")]
+
+        with pytest.raises(
+            InputValidationException,
+            match=r"Results returned from 'resolve' must be \(index, result\) tuples",
+        ):
+            manager.resolve(
+                some_refs,
+                an_entity_trait_set,
+                access.ResolveAccess.kRead,
+                a_context,
+                lambda _idx, _data: None,
+                lambda _idx, _error: None,
+            )
+
+
+class Test_Manager_resolve_with_cancellation:
+    def test_when_cancelled_before_call_then_interface_not_called_and_all_cancelled(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        a_context.cancellationToken = CancellationToken()
+        a_context.cancellationToken.cancel()
+
+        actual = manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        )
+
+        mock_manager_interface.mock.resolve.assert_not_called()
+        for result in actual:
+            assert result.code == BatchElementError.ErrorCode.kCancelled
+
+    def test_when_cancelled_during_call_then_unreported_elements_cancelled(
+        self,
+        manager,
+        mock_manager_interface,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        a_traitsdata,
+        invoke_resolve_success_cb,
+    ):
+        a_context.cancellationToken = CancellationToken()
+
+        def stop_early(*_args):
+            invoke_resolve_success_cb(0, a_traitsdata)
+            a_context.cancellationToken.cancel()
+
+        mock_manager_interface.mock.resolve.side_effect = stop_early
+
+        actual = manager.resolve(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        )
+
+        assert actual[0] is a_traitsdata
+        for result in actual[1:]:
+            assert result.code == BatchElementError.ErrorCode.kCancelled
+
+    def test_when_deadline_passed_then_interface_not_called(
+        self, manager, mock_manager_interface, a_ref, an_entity_trait_set, a_context
+    ):
+        a_context.cancellationToken = CancellationToken(timeout=0)
+
+        with pytest.raises(BatchElementException) as exc:
+            manager.resolve(a_ref, an_entity_trait_set, access.ResolveAccess.kRead, a_context)
+
+        mock_manager_interface.mock.resolve.assert_not_called()
+        assert exc.value.error.code == BatchElementError.ErrorCode.kCancelled
+
+
+class Test_Manager_resolve_with_EntityReferenceBatch:
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        invoke_resolve_success_cb,
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+        a_traitsdata = TraitsData({"a_trait"})
+        method = mock_manager_interface.mock.resolve
+        method.side_effect = lambda *_args: invoke_resolve_success_cb(0, a_traitsdata)
+
+        manager.resolve(
+            EntityReferenceBatch(some_refs),
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            success_callback,
+            error_callback,
+        )
+
+        method.assert_called_once_with(
+            some_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+        success_callback.assert_called_once_with(0, a_traitsdata)
+        error_callback.assert_not_called()
+
+
+class Test_Manager_resolve_with_deduplication:
+    def test_when_refs_repeated_then_interface_called_with_unique_refs(
+        self,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        an_entity_trait_set,
+        a_context,
+        invoke_resolve_success_cb,
+    ):
+        manager = Manager(
+            mock_manager_interface,
+            a_host_session,
+            Manager.Options(deduplicateEntityReferences=True),
+        )
+        method = mock_manager_interface.mock.resolve
+        a_traitsdata = TraitsData({"a_trait"})
+        another_traitsdata = TraitsData({"another_trait"})
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(0, a_traitsdata)
+            invoke_resolve_success_cb(1, another_traitsdata)
+
+        method.side_effect = call_callbacks
+
+        refs = [some_refs[0], some_refs[1], some_refs[0]]
+        actual = manager.resolve(refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context)
+
+        method.assert_called_once()
+        assert method.call_args[0][0] == some_refs
+        assert actual == [a_traitsdata, another_traitsdata, a_traitsdata]
+        assert actual[0] is not actual[2]
+
+    def test_when_not_configured_then_repeated_refs_passed_through(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        method = mock_manager_interface.mock.resolve
+
+        refs = [some_refs[0], some_refs[0]]
+        manager.resolve(
+            refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        )
+
+        method.assert_called_once()
+        assert method.call_args[0][0] == refs
+
+
+class Test_Manager_resolveHeterogeneous:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.resolveHeterogeneous)
+        assert method_introspector.is_implemented_once(Manager, "resolveHeterogeneous")
+
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self, manager, mock_manager_interface, a_host_session, some_refs, a_context
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+        trait_sets = [{"a_trait"}, {"another_trait"}]
+        a_result = TraitsData()
+
+        method = mock_manager_interface.mock.resolveHeterogeneous
+        method.side_effect = lambda *args: args[6](1, a_result)
+
+        manager.resolveHeterogeneous(
+            some_refs,
+            trait_sets,
+            [1, 0],
+            access.ResolveAccess.kRead,
+            a_context,
+            success_callback,
+            error_callback,
         )
 
         method.assert_called_once_with(
             some_refs,
-            an_entity_trait_set,
+            trait_sets,
+            [1, 0],
             access.ResolveAccess.kRead,
             a_context,
             a_host_session,
             mock.ANY,
             mock.ANY,
         )
+        success_callback.assert_called_once_with(1, a_result)
+        error_callback.assert_not_called()
 
-        assert len(actual_traitsdatas) == 2
-        assert actual_traitsdatas[0] is some_entity_traitsdatas[0]
-        assert actual_traitsdatas[1] is some_entity_traitsdatas[1]
+    def test_when_index_out_of_range_then_raises_InputValidationException(
+        self, manager, mock_manager_interface, some_refs, a_context
+    ):
+        with pytest.raises(InputValidationException):
+            manager.resolveHeterogeneous(
+                some_refs,
+                [set()],
+                [0, 1],
+                access.ResolveAccess.kRead,
+                a_context,
+                mock.Mock(),
+                mock.Mock(),
+            )
 
+        mock_manager_interface.mock.resolveHeterogeneous.assert_not_called()
 
-class Test_Manager_resolve_with_batch_throwing_overload:
-    def test_when_success_then_multiple_TraitsDatas_returned(
-        self,
-        manager,
-        mock_manager_interface,
-        a_host_session,
-        some_refs,
-        an_entity_trait_set,
-        a_context,
-        some_entity_traitsdatas,
-        invoke_resolve_success_cb,
-    ):
-        method = mock_manager_interface.mock.resolve
 
-        def call_callbacks(*_args):
-            invoke_resolve_success_cb(0, some_entity_traitsdatas[0])
-            invoke_resolve_success_cb(1, some_entity_traitsdatas[1])
+class Test_Manager_resolveProjected:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.resolveProjected)
+        assert method_introspector.is_implemented_once(Manager, "resolveProjected")
 
-        method.side_effect = call_callbacks
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self, manager, mock_manager_interface, a_host_session, some_refs, a_context
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+        projection = {"a_trait": {"a_key"}}
+        a_result = TraitsData()
 
-        actual_traitsdatas = manager.resolve(
+        method = mock_manager_interface.mock.resolveProjected
+        method.side_effect = lambda *args: args[6](0, a_result)
+
+        manager.resolveProjected(
             some_refs,
-            an_entity_trait_set,
+            {"a_trait"},
+            projection,
             access.ResolveAccess.kRead,
             a_context,
-            Manager.BatchElementErrorPolicyTag.kException,
+            success_callback,
+            error_callback,
         )
 
         method.assert_called_once_with(
             some_refs,
-            an_entity_trait_set,
+            {"a_trait"},
+            projection,
             access.ResolveAccess.kRead,
             a_context,
             a_host_session,
             mock.ANY,
             mock.ANY,
         )
+        success_callback.assert_called_once_with(0, a_result)
+        error_callback.assert_not_called()
 
-        assert len(actual_traitsdatas) == 2
-        assert actual_traitsdatas[0] is some_entity_traitsdatas[0]
-        assert actual_traitsdatas[1] is some_entity_traitsdatas[1]
 
-    def test_when_success_out_of_order_then_TraitsDatas_returned_in_order(
-        self,
-        manager,
-        mock_manager_interface,
-        a_host_session,
-        some_refs,
-        an_entity_trait_set,
-        a_context,
-        some_entity_traitsdatas,
-        invoke_resolve_success_cb,
-    ):
-        method = mock_manager_interface.mock.resolve
+class Test_Manager_resolveIfChanged:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.resolveIfChanged)
+        assert method_introspector.is_implemented_once(Manager, "resolveIfChanged")
 
-        def call_callbacks(*_args):
-            # Success
-            invoke_resolve_success_cb(1, some_entity_traitsdatas[1])
-            invoke_resolve_success_cb(0, some_entity_traitsdatas[0])
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self, manager, mock_manager_interface, a_host_session, some_refs, a_context
+    ):
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+        tokens = ["token1", "token2"]
+        a_result = ConditionalResolveResult(None, "token1")
 
-        method.side_effect = call_callbacks
+        method = mock_manager_interface.mock.resolveIfChanged
+        method.side_effect = lambda *args: args[6](0, a_result)
 
-        actual_traitsdatas = manager.resolve(
+        manager.resolveIfChanged(
             some_refs,
-            an_entity_trait_set,
+            {"a_trait"},
             access.ResolveAccess.kRead,
+            tokens,
             a_context,
-            Manager.BatchElementErrorPolicyTag.kException,
+            success_callback,
+            error_callback,
         )
 
         method.assert_called_once_with(
             some_refs,
-            an_entity_trait_set,
+            {"a_trait"},
             access.ResolveAccess.kRead,
+            tokens,
             a_context,
             a_host_session,
             mock.ANY,
             mock.ANY,
         )
+        success_callback.assert_called_once()
+        idx, result = success_callback.call_args[0]
+        assert idx == 0
+        assert result.traitsData is None
+        assert result.generationToken == "token1"
+        error_callback.assert_not_called()
+
+    def test_when_token_count_mismatched_then_raises_InputValidationException(
+        self, manager, mock_manager_interface, some_refs, a_context
+    ):
+        with pytest.raises(InputValidationException):
+            manager.resolveIfChanged(
+                some_refs,
+                set(),
+                access.ResolveAccess.kRead,
+                [],
+                a_context,
+                mock.Mock(),
+                mock.Mock(),
+            )
 
-        assert len(actual_traitsdatas) == 2
-        assert actual_traitsdatas[0] is some_entity_traitsdatas[0]
-        assert actual_traitsdatas[1] is some_entity_traitsdatas[1]
+        mock_manager_interface.mock.resolveIfChanged.assert_not_called()
 
 
-class Test_Manager_resolve_with_batch_variant_overload:
-    @pytest.mark.parametrize("error_code", batch_element_error_codes)
-    def test_when_mixed_output_then_returned_list_contains_output(
+class Test_Manager_resolveStream:
+    def test_when_iterated_then_yields_index_result_pairs_in_production_order(
         self,
         manager,
         mock_manager_interface,
-        a_host_session,
         some_refs,
         an_entity_trait_set,
         a_context,
-        a_traitsdata,
-        error_code,
+        a_batch_element_error,
         invoke_resolve_success_cb,
         invoke_resolve_error_cb,
     ):
+        a_traitsdata = TraitsData({"a_trait"})
         method = mock_manager_interface.mock.resolve
-        batch_element_error = BatchElementError(error_code, "some string ✨")
 
         def call_callbacks(*_args):
+            invoke_resolve_error_cb(1, a_batch_element_error)
             invoke_resolve_success_cb(0, a_traitsdata)
-            invoke_resolve_error_cb(1, batch_element_error)
 
         method.side_effect = call_callbacks
 
-        actual_traitsdata_and_error = manager.resolve(
-            some_refs,
-            an_entity_trait_set,
-            access.ResolveAccess.kRead,
-            a_context,
-            Manager.BatchElementErrorPolicyTag.kVariant,
+        stream = manager.resolveStream(
+            some_refs[:2], an_entity_trait_set, access.ResolveAccess.kRead, a_context, 1
         )
+        results = list(stream)
 
-        method.assert_called_once_with(
-            some_refs,
-            an_entity_trait_set,
-            access.ResolveAccess.kRead,
-            a_context,
-            a_host_session,
-            mock.ANY,
-            mock.ANY,
+        method.assert_called_once()
+        assert results == [(1, a_batch_element_error), (0, a_traitsdata)]
+
+    def test_when_batch_fails_then_iteration_raises(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        mock_manager_interface.mock.resolve.side_effect = InputValidationException("batch failed")
+
+        stream = manager.resolveStream(
+            some_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
         )
 
-        assert len(actual_traitsdata_and_error) == 2
-        assert actual_traitsdata_and_error[0] is a_traitsdata
-        assert actual_traitsdata_and_error[1] == batch_element_error
+        with pytest.raises(InputValidationException, match="batch failed"):
+            next(stream)
 
-    def test_when_mixed_output_out_of_order_then_output_returned_in_order(
+
+class Test_Manager_resolveAsync:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.resolveAsync)
+        assert method_introspector.is_implemented_once(Manager, "resolveAsync")
+
+    def test_when_awaited_then_returns_results_and_errors_in_input_order(
         self,
         manager,
         mock_manager_interface,
-        a_host_session,
-        a_ref,
+        some_refs,
         an_entity_trait_set,
         a_context,
-        invoke_resolve_success_cb,
-        invoke_resolve_error_cb,
+        a_batch_element_error,
     ):
-        method = mock_manager_interface.mock.resolve
+        a_traitsdata = TraitsData({"a_trait"})
 
-        entity_refs = [a_ref] * 4
+        def call_callbacks(*args):
+            args[6](1, a_batch_element_error)
+            args[5](0, a_traitsdata)
 
-        batch_element_error0 = BatchElementError(
-            BatchElementError.ErrorCode.kEntityResolutionError, "0 some string ✨"
-        )
-        traitsdata1 = TraitsData({"trait1"})
-        batch_element_error2 = BatchElementError(
-            BatchElementError.ErrorCode.kEntityResolutionError, "0 some string ✨"
-        )
-        traitsdata3 = TraitsData({"trait3"})
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
 
-        def call_callbacks(*_args):
-            invoke_resolve_success_cb(1, traitsdata1)
-            invoke_resolve_error_cb(0, batch_element_error0)
-            invoke_resolve_success_cb(3, traitsdata3)
-            invoke_resolve_error_cb(2, batch_element_error2)
+        async def main():
+            return await manager.resolveAsync(
+                some_refs[:2], an_entity_trait_set, access.ResolveAccess.kRead, a_context
+            )
 
-        method.side_effect = call_callbacks
+        results = asyncio.run(main())
 
-        actual_traitsdata_and_error = manager.resolve(
-            entity_refs,
-            an_entity_trait_set,
-            access.ResolveAccess.kRead,
-            a_context,
-            Manager.BatchElementErrorPolicyTag.kVariant,
-        )
+        mock_manager_interface.mock.resolve.assert_called_once()
+        assert results == [a_traitsdata, a_batch_element_error]
 
-        method.assert_called_once_with(
-            entity_refs,
-            an_entity_trait_set,
-            access.ResolveAccess.kRead,
-            a_context,
-            a_host_session,
-            mock.ANY,
-            mock.ANY,
+    def test_when_many_awaited_concurrently_then_all_complete(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        mock_manager_interface.mock.resolve.side_effect = lambda *args: args[5](
+            0, TraitsData({args[0][0].toString()})
         )
 
-        assert len(actual_traitsdata_and_error) == 4
-        assert actual_traitsdata_and_error[0] == batch_element_error0
-        assert actual_traitsdata_and_error[1] is traitsdata1
-        assert actual_traitsdata_and_error[2] == batch_element_error2
-        assert actual_traitsdata_and_error[3] is traitsdata3
+        async def main():
+            return await asyncio.gather(
+                *(
+                    manager.resolveAsync(
+                        [ref], an_entity_trait_set, access.ResolveAccess.kRead, a_context
+                    )
+                    for ref in some_refs
+                )
+            )
+
+        results = asyncio.run(main())
+
+        assert [result[0].traitSet() for result in results] == [
+            {ref.toString()} for ref in some_refs
+        ]
+
+    def test_when_batch_fails_then_awaiting_raises(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        mock_manager_interface.mock.resolve.side_effect = InputValidationException("batch failed")
+
+        async def main():
+            return await manager.resolveAsync(
+                some_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+            )
+
+        with pytest.raises(InputValidationException, match="batch failed"):
+            asyncio.run(main())
+
+    def test_when_no_event_loop_is_running_then_raises_RuntimeError(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        with pytest.raises(RuntimeError):
+            manager.resolveAsync(
+                some_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+            )
+
+        mock_manager_interface.mock.resolve.assert_not_called()
+
+
+class Test_Manager_prefetch:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.prefetch)
+        assert method_introspector.is_implemented_once(Manager, "prefetch")
+
+    def test_when_no_resolve_cache_then_manager_not_queried(
+        self, manager, mock_manager_interface, some_refs, an_entity_trait_set, a_context
+    ):
+        manager.prefetch(some_refs, an_entity_trait_set, a_context)
+
+        mock_manager_interface.mock.resolve.assert_not_called()
+
+
+class Test_Manager_entityExistsAsync:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.entityExistsAsync)
+        assert method_introspector.is_implemented_once(Manager, "entityExistsAsync")
+
+    def test_when_awaited_then_returns_results_and_errors_in_input_order(
+        self, manager, mock_manager_interface, some_refs, a_context, a_batch_element_error
+    ):
+        def call_callbacks(*args):
+            args[3](0, True)
+            args[4](1, a_batch_element_error)
+
+        mock_manager_interface.mock.entityExists.side_effect = call_callbacks
+
+        async def main():
+            return await manager.entityExistsAsync(some_refs[:2], a_context)
+
+        assert asyncio.run(main()) == [True, a_batch_element_error]
 
 
 class Test_Manager_entityTraits:
@@ -1418,6 +2790,35 @@ class Test_Manager_entityTraits:
         success_callback.assert_called_once_with(123, an_entity_trait_set)
         error_callback.assert_called_once_with(456, a_batch_element_error)
 
+    def test_when_cache_configured_then_repeated_query_served_from_cache(
+        self,
+        mock_manager_interface,
+        a_host_session,
+        a_ref,
+        an_entity_trait_set,
+        a_context,
+        invoke_entityTraits_success_cb,
+    ):
+        manager = Manager(
+            mock_manager_interface, a_host_session, Manager.Options(entityTraitsCacheCapacity=10)
+        )
+        method = mock_manager_interface.mock.entityTraits
+        method.side_effect = lambda *_args: invoke_entityTraits_success_cb(0, an_entity_trait_set)
+        success_callback = mock.Mock()
+
+        for _ in range(2):
+            manager.entityTraits(
+                [a_ref],
+                access.EntityTraitsAccess.kRead,
+                a_context,
+                success_callback,
+                mock.Mock(),
+            )
+
+        method.assert_called_once()
+        success_callback.assert_has_calls([mock.call(0, an_entity_trait_set)] * 2)
+        assert manager.memoryUsage().entityTraitsCache > 0
+
 
 class Test_Manager_managementPolicy:
     def test_method_defined_in_cpp(self, method_introspector):
@@ -1444,6 +2845,65 @@ class Test_Manager_managementPolicy:
             some_entity_trait_sets, access.PolicyAccess.kWrite, a_context, a_host_session
         )
 
+    def test_when_queried_twice_then_interface_called_once(
+        self, manager, mock_manager_interface, some_entity_trait_sets, a_context
+    ):
+        method = mock_manager_interface.mock.managementPolicy
+        method.return_value = [TraitsData(), TraitsData()]
+
+        manager.managementPolicy(some_entity_trait_sets, access.PolicyAccess.kRead, a_context)
+        manager.managementPolicy(some_entity_trait_sets, access.PolicyAccess.kRead, a_context)
+
+        method.assert_called_once()
+
+    def test_when_partially_cached_then_only_uncached_trait_sets_queried(
+        self, manager, mock_manager_interface, a_host_session, a_context
+    ):
+        data1 = TraitsData({"t1"})
+        data2 = TraitsData({"t2"})
+        method = mock_manager_interface.mock.managementPolicy
+        method.return_value = [data1]
+        manager.managementPolicy([{"a"}], access.PolicyAccess.kRead, a_context)
+        method.reset_mock()
+        method.return_value = [data2]
+
+        actual = manager.managementPolicy([{"a"}, {"b"}], access.PolicyAccess.kRead, a_context)
+
+        assert actual == [data1, data2]
+        method.assert_called_once_with(
+            [{"b"}], access.PolicyAccess.kRead, a_context, a_host_session
+        )
+
+    def test_when_caches_flushed_then_interface_called_again(
+        self, manager, mock_manager_interface, some_entity_trait_sets, a_context
+    ):
+        method = mock_manager_interface.mock.managementPolicy
+        method.return_value = [TraitsData(), TraitsData()]
+
+        manager.managementPolicy(some_entity_trait_sets, access.PolicyAccess.kRead, a_context)
+        manager.flushCaches()
+        manager.managementPolicy(some_entity_trait_sets, access.PolicyAccess.kRead, a_context)
+
+        assert method.call_count == 2
+
+    def test_when_policy_context_sensitive_then_interface_called_per_context(
+        self, manager, mock_manager_interface, some_entity_trait_sets
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_IsManagementPolicyContextSensitive: True
+        }
+        manager.initialize({})
+        method = mock_manager_interface.mock.managementPolicy
+        method.return_value = [TraitsData(), TraitsData()]
+        context1 = Context(TraitsData({"locale1"}))
+        context2 = Context(TraitsData({"locale2"}))
+
+        manager.managementPolicy(some_entity_trait_sets, access.PolicyAccess.kRead, context1)
+        manager.managementPolicy(some_entity_trait_sets, access.PolicyAccess.kRead, context2)
+        manager.managementPolicy(some_entity_trait_sets, access.PolicyAccess.kRead, context1)
+
+        assert method.call_count == 2
+
 
 class Test_Manager_preflight_callback_signature:
     def test_method_defined_in_cpp(self, method_introspector):
@@ -2579,6 +4039,13 @@ class Test_Manager_createChildContext:
         assert not method_introspector.is_defined_in_python(Manager.createChildContext)
         assert method_introspector.is_implemented_once(Manager, "createChildContext")
 
+    def test_when_parent_has_cancellation_token_then_child_shares_token(self, manager, a_context):
+        a_context.cancellationToken = CancellationToken()
+
+        child = manager.createChildContext(a_context)
+
+        assert child.cancellationToken is a_context.cancellationToken
+
     def test_when_called_with_parent_then_props_copied_and_createState_called_with_parent_state(
         self, manager, mock_manager_interface, a_host_session
     ):
@@ -2690,6 +4157,30 @@ class Test_Manager_contextFromPersistenceToken:
         mock_manager_interface.mock.stateFromPersistenceToken.assert_not_called()
 
 
+class Test_Manager_contextsFromPersistenceTokens:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.contextsFromPersistenceTokens)
+        assert method_introspector.is_implemented_once(Manager, "contextsFromPersistenceTokens")
+
+    def test_when_called_then_each_distinct_token_is_restored_once(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        expected_state = managerApi.ManagerStateBase()
+        mock_manager_interface.mock.stateFromPersistenceToken.return_value = expected_state
+
+        a_token = "a_persistence_token"
+        contexts = manager.contextsFromPersistenceTokens([a_token, "", a_token])
+
+        assert len(contexts) == 3
+        assert contexts[0].managerState is expected_state
+        assert contexts[1].managerState is None
+        assert contexts[2].managerState is expected_state
+
+        mock_manager_interface.mock.stateFromPersistenceToken.assert_called_once_with(
+            a_token, a_host_session
+        )
+
+
 batch_element_error_codes_names = [
     "unknown",
     "invalidEntityReference",
@@ -2698,6 +4189,7 @@ batch_element_error_codes_names = [
     "entityResolutionError",
     "invalidPreflightHint",
     "invalidTraitSet",
+    "cancelled",
 ]
 
 
@@ -19,6 +19,7 @@ Tests that cover the openassetio.hostApi.ManagerFactory class.
 
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
 import os
 import pathlib
 from unittest import mock
@@ -26,7 +27,12 @@ from unittest import mock
 import pytest
 
 from openassetio import _openassetio, errors  # pylint: disable=no-name-in-module
-from openassetio.hostApi import ManagerFactory, Manager, ManagerImplementationFactoryInterface
+from openassetio.hostApi import (
+    ManagerFactory,
+    Manager,
+    ManagerImplementationFactoryInterface,
+    ResolveCache,
+)
 from openassetio.log import LoggerInterface
 
 
@@ -60,6 +66,28 @@ class Test_ManagerFactory_ManagerDetail_equality:
         assert managerDetails != otherManagerDetail
 
 
+class Test_ManagerFactory_DefaultManagerConfig_equality:
+    def test_when_other_is_equal_then_compares_equal(self):
+        assert ManagerFactory.DefaultManagerConfig("a", {"b": 1}) == (
+            ManagerFactory.DefaultManagerConfig("a", {"b": 1})
+        )
+
+    @pytest.mark.parametrize(
+        "other_config",
+        [
+            ManagerFactory.DefaultManagerConfig("z", {"b": 1}),
+            ManagerFactory.DefaultManagerConfig("a", {"b": 2}),
+        ],
+    )
+    def test_when_other_has_unequal_field_then_object_compares_unequal(self, other_config):
+        assert ManagerFactory.DefaultManagerConfig("a", {"b": 1}) != other_config
+
+    def test_when_other_has_unequal_resolve_cache_then_object_compares_unequal(self):
+        assert ManagerFactory.DefaultManagerConfig(
+            "a", {}, ManagerFactory.ResolveCacheConfig(10)
+        ) != ManagerFactory.DefaultManagerConfig("a", {}, ManagerFactory.ResolveCacheConfig(20))
+
+
 class Test_ManagerFactory_identifiers:
     def test_wraps_the_corresponding_method_of_the_held_interface(
         self, mock_manager_implementation_factory, a_manager_factory
@@ -128,6 +156,37 @@ class Test_ManagerFactory_availableManagers:
 
         assert actual == expected
 
+    def test_when_implementation_details_known_then_implementation_not_instantiated(
+        self, create_mock_manager_interface, mock_manager_implementation_factory, a_manager_factory
+    ):
+        identifiers = ["first.identifier", "second.identifier"]
+        mock_manager_implementation_factory.mock.identifiers.return_value = identifiers
+
+        first_detail = ManagerFactory.ManagerDetail(
+            identifier="first.identifier", displayName="First", info={"first": "info"}
+        )
+        mock_manager_implementation_factory.mock.details.side_effect = [first_detail, None]
+
+        second_manager_interface = create_mock_manager_interface()
+        second_manager_interface.mock.identifier.return_value = "second.identifier"
+        second_manager_interface.mock.displayName.return_value = "Second"
+        second_manager_interface.mock.info.return_value = {"second": "info"}
+        mock_manager_implementation_factory.mock.instantiate.side_effect = [
+            second_manager_interface
+        ]
+
+        actual = a_manager_factory.availableManagers()
+
+        assert actual == {
+            "first.identifier": first_detail,
+            "second.identifier": ManagerFactory.ManagerDetail(
+                identifier="second.identifier", displayName="Second", info={"second": "info"}
+            ),
+        }
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with(
+            "second.identifier"
+        )
+
 
 class Test_ManagerFactory_kDefaultManagerConfigEnvVarName:
     def test_has_expected_value(self):
@@ -425,6 +484,274 @@ class Test_ManagerFactory_defaultManagerForInterface:
             )
 
 
+class Test_ManagerFactory_defaultManagerForInterface_config:
+    def test_when_config_given_then_expected_manager_returned_with_expected_settings(
+        self,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        create_mock_manager_interface,
+    ):
+        expected_manager_identifier = "identifier.from.config"
+        expected_settings = {"a_string": "Hello 🐈"}
+
+        mock_manager_interface = create_mock_manager_interface()
+        mock_manager_interface.mock.identifier.return_value = expected_manager_identifier
+        mock_manager_implementation_factory.mock.instantiate.return_value = mock_manager_interface
+
+        manager = ManagerFactory.defaultManagerForInterface(
+            ManagerFactory.DefaultManagerConfig(expected_manager_identifier, expected_settings),
+            mock_host_interface,
+            mock_manager_implementation_factory,
+            mock_logger,
+        )
+
+        assert manager.identifier() == expected_manager_identifier
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with(
+            expected_manager_identifier
+        )
+        mock_manager_interface.mock.initialize.assert_called_once()
+        assert mock_manager_interface.mock.initialize.call_args[0][0] == expected_settings
+
+    def test_when_resolve_cache_configured_then_manager_has_resolve_cache(
+        self,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        create_mock_manager_interface,
+    ):
+        mock_manager_implementation_factory.mock.instantiate.return_value = (
+            create_mock_manager_interface()
+        )
+
+        manager = ManagerFactory.defaultManagerForInterface(
+            ManagerFactory.DefaultManagerConfig("a", {}, ManagerFactory.ResolveCacheConfig(10)),
+            mock_host_interface,
+            mock_manager_implementation_factory,
+            mock_logger,
+        )
+
+        assert manager.memoryUsage().resolveCache > 0
+
+
+class Test_ManagerFactory_loadDefaultManagerConfig:
+    def test_when_valid_path_then_expected_config_returned(self, resources_dir):
+        config = ManagerFactory.loadDefaultManagerConfig(
+            os.path.join(resources_dir, "default_manager.toml")
+        )
+
+        assert config == ManagerFactory.DefaultManagerConfig(
+            "identifier.from.toml.file",
+            {
+                "a_string": "Hello 🐈",
+                "a_float": 3.141579,
+                "a_bool": False,
+                "a_int": 42,
+                "a_config_path_twice": f"{resources_dir}/my/🐈/{resources_dir}",
+            },
+        )
+
+    def test_when_resolve_cache_given_then_resolve_cache_config_returned(self, tmp_path):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text(
+            "[manager]\n"
+            'identifier = "a"\n'
+            "[manager.resolve_cache]\n"
+            "capacity = 100\n"
+            'path = "${config_dir}/resolves.cache"\n'
+            "slot_count = 64\n"
+            "time_to_live = 60\n"
+        )
+
+        config = ManagerFactory.loadDefaultManagerConfig(str(config_path))
+
+        assert config.resolveCache == ManagerFactory.ResolveCacheConfig(
+            100,
+            ResolveCache.SharedTier(
+                "",
+                64,
+                path=f"{tmp_path.resolve()}/resolves.cache",
+                timeToLive=datetime.timedelta(seconds=60),
+            ),
+        )
+
+    def test_when_no_resolve_cache_given_then_no_resolve_cache_config_returned(self, tmp_path):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text('[manager]\nidentifier = "a"')
+
+        assert ManagerFactory.loadDefaultManagerConfig(str(config_path)).resolveCache is None
+
+    @pytest.mark.parametrize(
+        "cache_table",
+        [
+            "slot_count = 64",
+            "capacity = 0",
+            'capacity = "many"',
+            'capacity = 10\nshared_name = "a"',
+            'capacity = 10\nshared_name = "a"\npath = "b"\nslot_count = 64',
+            'capacity = 10\nshared_name = "a"\nslot_count = 64\ntime_to_live = -1',
+        ],
+    )
+    def test_when_resolve_cache_invalid_then_ConfigurationException_raised(
+        self, tmp_path, cache_table
+    ):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text(
+            f'[manager]\nidentifier = "a"\n[manager.resolve_cache]\n{cache_table}\n'
+        )
+
+        with pytest.raises(errors.ConfigurationException):
+            ManagerFactory.loadDefaultManagerConfig(str(config_path))
+
+    def test_when_file_unchanged_then_same_config_returned(self, tmp_path):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text('[manager]\nidentifier = "first"')
+
+        first = ManagerFactory.loadDefaultManagerConfig(str(config_path))
+        second = ManagerFactory.loadDefaultManagerConfig(str(config_path))
+
+        assert first == second
+
+    def test_when_file_modified_then_config_reloaded(self, tmp_path):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text('[manager]\nidentifier = "first"')
+        original_mtime = config_path.stat().st_mtime_ns
+
+        assert ManagerFactory.loadDefaultManagerConfig(str(config_path)).identifier == "first"
+
+        config_path.write_text('[manager]\nidentifier = "second"')
+        # Ensure mtime differs even on filesystems with coarse resolution.
+        os.utime(config_path, ns=(original_mtime + 10**9, original_mtime + 10**9))
+
+        assert ManagerFactory.loadDefaultManagerConfig(str(config_path)).identifier == "second"
+
+    def test_when_file_removed_then_InputValidationException_raised(self, tmp_path):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text('[manager]\nidentifier = "first"')
+        ManagerFactory.loadDefaultManagerConfig(str(config_path))
+
+        config_path.unlink()
+
+        with pytest.raises(errors.InputValidationException):
+            ManagerFactory.loadDefaultManagerConfig(str(config_path))
+
+    def test_when_directory_then_InputValidationException_raised(self, tmp_path):
+        with pytest.raises(
+            errors.InputValidationException, match="must be a TOML file not a directory"
+        ):
+            ManagerFactory.loadDefaultManagerConfig(str(tmp_path))
+
+
+class Test_ManagerFactory_sharedManagerForInterface:
+    def test_when_same_config_then_manager_created_and_initialized_once(
+        self,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        mock_manager_interface,
+    ):
+        mock_host_interface.mock.identifier.return_value = "a.host"
+        config = ManagerFactory.DefaultManagerConfig("shared.same", {"a": 1})
+
+        first = ManagerFactory.sharedManagerForInterface(
+            config, mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+        second = ManagerFactory.sharedManagerForInterface(
+            config, mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+
+        assert first is second
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with(
+            "shared.same"
+        )
+        mock_manager_interface.mock.initialize.assert_called_once()
+
+    @pytest.mark.parametrize(
+        "other_config,other_host_identifier",
+        [
+            (ManagerFactory.DefaultManagerConfig("shared.differs", {"a": 2}), "a.host"),
+            (ManagerFactory.DefaultManagerConfig("shared.differs.other", {"a": 1}), "a.host"),
+            (ManagerFactory.DefaultManagerConfig("shared.differs", {"a": 1}), "other.host"),
+        ],
+    )
+    def test_when_config_or_host_differ_then_separate_managers_created(
+        self,
+        other_config,
+        other_host_identifier,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+    ):
+        mock_host_interface.mock.identifier.return_value = "a.host"
+        first = ManagerFactory.sharedManagerForInterface(
+            ManagerFactory.DefaultManagerConfig("shared.differs", {"a": 1}),
+            mock_host_interface,
+            mock_manager_implementation_factory,
+            mock_logger,
+        )
+
+        mock_host_interface.mock.identifier.return_value = other_host_identifier
+        second = ManagerFactory.sharedManagerForInterface(
+            other_config, mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+
+        assert first is not second
+        assert mock_manager_implementation_factory.mock.instantiate.call_count == 2
+
+    def test_when_all_references_released_then_new_manager_created(
+        self, mock_manager_implementation_factory, mock_host_interface, mock_logger
+    ):
+        mock_host_interface.mock.identifier.return_value = "a.host"
+        config = ManagerFactory.DefaultManagerConfig("shared.released", {})
+
+        manager = ManagerFactory.sharedManagerForInterface(
+            config, mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+        del manager
+        ManagerFactory.sharedManagerForInterface(
+            config, mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+
+        assert mock_manager_implementation_factory.mock.instantiate.call_count == 2
+
+    def test_when_initialize_fails_then_next_call_creates_new_manager(
+        self,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        mock_manager_interface,
+    ):
+        mock_host_interface.mock.identifier.return_value = "a.host"
+        config = ManagerFactory.DefaultManagerConfig("shared.failing", {})
+        mock_manager_interface.mock.initialize.side_effect = [RuntimeError("oops"), None]
+
+        with pytest.raises(RuntimeError):
+            ManagerFactory.sharedManagerForInterface(
+                config, mock_host_interface, mock_manager_implementation_factory, mock_logger
+            )
+        ManagerFactory.sharedManagerForInterface(
+            config, mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+
+        assert mock_manager_interface.mock.initialize.call_count == 2
+
+
+class Test_ManagerFactory_sharedManager:
+    def test_when_same_config_then_same_manager_returned(
+        self, a_manager_factory, mock_host_interface, mock_manager_implementation_factory
+    ):
+        mock_host_interface.mock.identifier.return_value = "a.host"
+        config = ManagerFactory.DefaultManagerConfig("shared.instance", {})
+
+        first = a_manager_factory.sharedManager(config)
+        second = a_manager_factory.sharedManager(config)
+
+        assert first is second
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with(
+            "shared.instance"
+        )
+
+
 class Test_ManagerFactory_createManager:
     def test_returns_a_manager(self, a_manager_factory):
         manager = a_manager_factory.createManager("a.manager")
@@ -611,9 +938,14 @@ class MockManagerImplementationFactory(ManagerImplementationFactoryInterface):
         self.mock = mock.create_autospec(
             ManagerImplementationFactoryInterface, spec_set=True, instance=True
         )
+        # Details are unknown by default, as per the base class.
+        self.mock.details.return_value = None
 
     def identifiers(self):
         return self.mock.identifiers()
 
     def instantiate(self, identifier):
         return self.mock.instantiate(identifier)
+
+    def details(self, identifier):
+        return self.mock.details(identifier)
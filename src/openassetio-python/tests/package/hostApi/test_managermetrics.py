@@ -0,0 +1,145 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.hostApi.ManagerMetrics class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
+
+import pytest
+
+from openassetio.errors import BatchElementError, InputValidationException
+from openassetio.hostApi import ManagerMetrics
+
+
+class Test_ManagerMetrics_init:
+    def test_when_shard_count_is_zero_then_raises_InputValidationException(self):
+        with pytest.raises(
+            InputValidationException, match="ManagerMetrics shard count must be non-zero"
+        ):
+            ManagerMetrics(0)
+
+    def test_when_constructed_then_all_counters_are_zero(self):
+        snapshot = ManagerMetrics().snapshot()
+
+        assert len(snapshot.methods) == len(ManagerMetrics.kMethodNames)
+        for statistics in snapshot.methods:
+            assert statistics.calls == 0
+            assert set(statistics.errors.values()) == {0}
+            assert statistics.totalLatency == datetime.timedelta(0)
+
+
+class Test_ManagerMetrics_record:
+    def test_when_recorded_then_snapshot_holds_aggregated_statistics(self):
+        metrics = ManagerMetrics()
+        errors = [0] * ManagerMetrics.kErrorCodeCount
+        errors[ManagerMetrics.errorCodeIndex(BatchElementError.ErrorCode.kInvalidTraitSet)] = 2
+
+        metrics.record(
+            ManagerMetrics.Method.kPreflight, datetime.timedelta(microseconds=3), 1, errors, True
+        )
+
+        statistics = metrics.snapshot().at(ManagerMetrics.Method.kPreflight)
+        assert statistics.calls == 1
+        assert statistics.exceptions == 1
+        assert statistics.successes == 1
+        assert statistics.errors[BatchElementError.ErrorCode.kInvalidTraitSet] == 2
+        assert statistics.latencyBuckets[2] == 1
+        assert statistics.totalLatency == datetime.timedelta(microseconds=3)
+
+
+class Test_ManagerMetrics_latencyBucketUpperBound:
+    def test_bounds_are_powers_of_two_microseconds(self):
+        assert ManagerMetrics.latencyBucketUpperBound(0) == datetime.timedelta(microseconds=1)
+        assert ManagerMetrics.latencyBucketUpperBound(10) == datetime.timedelta(microseconds=1024)
+
+
+class Test_ManagerMetrics_batchSizes:
+    def test_when_recorded_with_batch_size_then_durations_broken_down_by_batch_size(self):
+        metrics = ManagerMetrics()
+        no_errors = [0] * ManagerMetrics.kErrorCodeCount
+
+        metrics.record(
+            ManagerMetrics.Method.kResolve,
+            datetime.timedelta(microseconds=3),
+            5,
+            no_errors,
+            False,
+            5,
+        )
+
+        statistics = metrics.snapshot().at(ManagerMetrics.Method.kResolve)
+        assert len(statistics.batchSizes) == ManagerMetrics.kBatchSizeBucketCount + 1
+        batch_size_statistics = statistics.batchSizes[ManagerMetrics.batchSizeBucketIndex(5)]
+        assert batch_size_statistics.calls == 1
+        assert batch_size_statistics.latencyBuckets[2] == 1
+        assert batch_size_statistics.totalLatency == datetime.timedelta(microseconds=3)
+
+    def test_bounds_are_powers_of_four(self):
+        assert ManagerMetrics.batchSizeBucketUpperBound(0) == 1
+        assert ManagerMetrics.batchSizeBucketUpperBound(3) == 64
+        assert ManagerMetrics.batchSizeBucketIndex(64) == 3
+        assert ManagerMetrics.batchSizeBucketIndex(65) == 4
+
+
+class Test_ManagerMetrics_latencyQuantile:
+    def test_quantile_is_upper_bound_of_containing_bucket(self):
+        buckets = [0] * (ManagerMetrics.kLatencyBucketCount + 1)
+        buckets[1] = 99
+        buckets[4] = 1
+
+        assert ManagerMetrics.latencyQuantile(buckets, 0.5) == datetime.timedelta(microseconds=2)
+        assert ManagerMetrics.latencyQuantile(buckets, 1.0) == datetime.timedelta(microseconds=16)
+
+    def test_when_quantile_out_of_range_then_raises_InputValidationException(self):
+        buckets = [0] * (ManagerMetrics.kLatencyBucketCount + 1)
+
+        with pytest.raises(InputValidationException):
+            ManagerMetrics.latencyQuantile(buckets, 2.0)
+
+
+class Test_ManagerMetrics_Snapshot_since:
+    def test_when_called_with_earlier_snapshot_then_holds_only_later_calls(self):
+        metrics = ManagerMetrics()
+        no_errors = [0] * ManagerMetrics.kErrorCodeCount
+        latency = datetime.timedelta(microseconds=1)
+        metrics.record(ManagerMetrics.Method.kResolve, latency, 1, no_errors, False)
+        earlier = metrics.snapshot()
+        metrics.record(ManagerMetrics.Method.kResolve, latency, 2, no_errors, False)
+
+        statistics = metrics.snapshot().since(earlier).at(ManagerMetrics.Method.kResolve)
+
+        assert statistics.calls == 1
+        assert statistics.successes == 2
+
+
+class Test_ManagerMetrics_toPrometheusText:
+    def test_when_method_called_then_series_exported_for_method(self):
+        metrics = ManagerMetrics()
+        metrics.record(
+            ManagerMetrics.Method.kResolve,
+            datetime.timedelta(microseconds=1),
+            1,
+            [0] * ManagerMetrics.kErrorCodeCount,
+            False,
+        )
+
+        text = ManagerMetrics.toPrometheusText(metrics.snapshot(), "my.manager")
+
+        assert 'openassetio_manager_calls_total{manager="my.manager",method="resolve"} 1\n' in text
+        assert 'method="preflight"' not in text
@@ -0,0 +1,81 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.hostApi.ManagerTrafficReplayer class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import struct
+
+import pytest
+
+from openassetio.errors import InputValidationException
+from openassetio.hostApi import Manager, ManagerTrafficReplayer
+
+
+kHeader = b"OAMT" + struct.pack("<HH", 1, 0)
+kRegisterMethod = 9
+
+
+class Test_ManagerTrafficReplayer_init:
+    def test_when_manager_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError):
+            ManagerTrafficReplayer(None)
+
+    def test_when_rate_is_negative_then_raises_InputValidationException(self, manager):
+        with pytest.raises(InputValidationException, match="Rate cannot be negative"):
+            ManagerTrafficReplayer(manager, rate=-1)
+
+
+class Test_ManagerTrafficReplayer_replay:
+    def test_when_log_is_empty_then_returns_empty_report(self, manager, tmp_path):
+        logPath = tmp_path / "empty.oamt"
+        logPath.write_bytes(kHeader)
+
+        assert ManagerTrafficReplayer(manager).replay(str(logPath)) == {}
+
+    def test_when_log_has_publishing_call_then_call_is_skipped(
+        self, manager, mock_manager_interface, tmp_path
+    ):
+        logPath = tmp_path / "register.oamt"
+        record = struct.pack("<BBBQQII", 1, kRegisterMethod, 0, 0, 1000, 0, 0)
+        logPath.write_bytes(kHeader + struct.pack("<I", len(record)) + record)
+
+        report = ManagerTrafficReplayer(manager, rate=0).replay(str(logPath))
+
+        assert list(report.keys()) == ["register"]
+        assert report["register"].calls == 0
+        assert report["register"].skipped == 1
+        mock_manager_interface.mock.register.assert_not_called()
+
+    def test_when_file_is_not_a_log_then_raises_InputValidationException(self, manager, tmp_path):
+        logPath = tmp_path / "invalid.oamt"
+        logPath.write_bytes(b"not a log")
+
+        with pytest.raises(InputValidationException, match="not a valid manager traffic log"):
+            ManagerTrafficReplayer(manager).replay(str(logPath))
+
+    def test_when_file_does_not_exist_then_raises_InputValidationException(
+        self, manager, tmp_path
+    ):
+        with pytest.raises(InputValidationException, match="Could not open"):
+            ManagerTrafficReplayer(manager).replay(str(tmp_path / "missing.oamt"))
+
+
+@pytest.fixture
+def manager(mock_manager_interface, a_host_session):
+    return Manager(mock_manager_interface, a_host_session)
@@ -0,0 +1,52 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.managerApi.EntityExistenceFilter class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+
+import pytest
+
+from openassetio import errors
+from openassetio.managerApi import EntityExistenceFilter
+
+
+class Test_EntityExistenceFilter_init:
+    def test_when_false_positive_rate_out_of_range_then_raises(self):
+        with pytest.raises(errors.InputValidationException):
+            EntityExistenceFilter(10, 1.0)
+
+    def test_when_constructed_then_sized_for_expected_count(self):
+        existenceFilter = EntityExistenceFilter(100)
+
+        assert existenceFilter.bitCount() >= 100
+        assert existenceFilter.hashCount() >= 1
+        assert existenceFilter.memoryUsage() >= existenceFilter.bitCount() // 8
+
+
+class Test_EntityExistenceFilter_mayContain:
+    def test_when_inserted_then_may_contain(self):
+        existenceFilter = EntityExistenceFilter(10)
+        existenceFilter.insert("asset://a")
+
+        assert existenceFilter.mayContain("asset://a") is True
+
+    def test_when_empty_then_contains_nothing(self):
+        existenceFilter = EntityExistenceFilter(10)
+
+        assert existenceFilter.mayContain("asset://a") is False
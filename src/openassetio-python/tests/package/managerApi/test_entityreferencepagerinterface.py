@@ -22,6 +22,7 @@ wrapper class.
 # pylint: disable=missing-class-docstring,missing-function-docstring
 import pytest
 
+from openassetio import EntityReference
 from openassetio.managerApi import EntityReferencePagerInterface
 
 
@@ -43,6 +44,60 @@ class Test_EntityReferencePagerInterface_get:
             an_unimplemented_entity_ref_pager_interface.get(a_host_session)
 
 
+class Test_EntityReferencePagerInterface_sizeHint:
+    def test_when_not_overridden_then_returns_None(
+        self, an_unimplemented_entity_ref_pager_interface, a_host_session
+    ):
+        assert an_unimplemented_entity_ref_pager_interface.sizeHint(a_host_session) is None
+
+
+class Test_EntityReferencePagerInterface_drainAll:
+    def test_when_not_overridden_then_all_pages_concatenated(self, a_host_session):
+        pager_interface = ListEntityReferencePagerInterface([["a", "b"], ["c"], ["d", "e"]])
+
+        actual = pager_interface.drainAll(100, a_host_session)
+
+        assert actual == [EntityReference(ref) for ref in "abcde"]
+        assert pager_interface.current_page == 3
+
+    def test_when_maxItems_reached_then_truncated_page_is_skipped(self, a_host_session):
+        pager_interface = ListEntityReferencePagerInterface([["a", "b"], ["c", "d"], ["e"]])
+
+        actual = pager_interface.drainAll(3, a_host_session)
+
+        assert actual == [EntityReference(ref) for ref in "abc"]
+        assert pager_interface.current_page == 2
+
+    def test_when_maxItems_is_zero_then_pager_not_advanced(self, a_host_session):
+        pager_interface = ListEntityReferencePagerInterface([["a"]])
+
+        assert pager_interface.drainAll(0, a_host_session) == []
+        assert pager_interface.current_page == 0
+
+
+class ListEntityReferencePagerInterface(EntityReferencePagerInterface):
+    """
+    Pager interface over a fixed list of pages of entity reference
+    strings, relying on the default `drainAll`.
+    """
+
+    def __init__(self, pages):
+        EntityReferencePagerInterface.__init__(self)
+        self.pages = pages
+        self.current_page = 0
+
+    def hasNext(self, _hostSession):
+        return self.current_page + 1 < len(self.pages)
+
+    def get(self, _hostSession):
+        if self.current_page >= len(self.pages):
+            return []
+        return [EntityReference(ref) for ref in self.pages[self.current_page]]
+
+    def next(self, _hostSession):
+        self.current_page = min(self.current_page + 1, len(self.pages))
+
+
 @pytest.fixture
 def an_unimplemented_entity_ref_pager_interface():
     return EntityReferencePagerInterface()
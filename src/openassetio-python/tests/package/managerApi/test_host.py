@@ -20,9 +20,12 @@ Tests that cover the openassetio.managerApi.host class.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import threading
+
 import pytest
 
 from openassetio import Context
+from openassetio.hostApi import HostInterface
 from openassetio.managerApi import Host
 
 
@@ -119,3 +122,107 @@ class Test_Host_info:
             host.info()
 
         assert str(err.value).startswith("Unable to cast Python instance")
+
+
+class Test_Host_submit:
+    def test_wraps_the_corresponding_method_of_the_held_interface(self):
+        host_interface = SchedulingHostInterface()
+        host = Host(host_interface)
+        calls = []
+
+        host.submit(lambda: calls.append("task"))
+
+        assert host_interface.submitted == 1
+        assert calls == ["task"]
+
+    def test_when_not_overridden_then_task_is_run(self, host):
+        ran = threading.Event()
+
+        host.submit(ran.set)
+
+        assert ran.wait(timeout=5)
+
+
+class Test_Host_parallelFor:
+    def test_wraps_the_corresponding_method_of_the_held_interface(self):
+        host_interface = SchedulingHostInterface()
+        host = Host(host_interface)
+        indices = []
+
+        host.parallelFor(3, indices.append)
+
+        assert host_interface.parallel_loops == 1
+        assert indices == [0, 1, 2]
+
+    def test_when_not_overridden_then_body_is_called_with_each_index(self, host):
+        indices = []
+        lock = threading.Lock()
+
+        def body(idx):
+            with lock:
+                indices.append(idx)
+
+        host.parallelFor(10, body)
+
+        assert sorted(indices) == list(range(10))
+
+    def test_when_body_raises_then_exception_is_propagated(self, host):
+        def body(idx):
+            if idx == 1:
+                raise ValueError("failed")
+
+        with pytest.raises(ValueError, match="failed"):
+            host.parallelFor(3, body)
+
+
+class SchedulingHostInterface(HostInterface):
+    """
+    Host interface that runs scheduled work inline, counting calls.
+    """
+
+    def __init__(self):
+        super().__init__()
+        self.submitted = 0
+        self.parallel_loops = 0
+
+    def identifier(self):
+        return "org.openassetio.test.host"
+
+    def displayName(self):
+        return "Test Host"
+
+    def submit(self, task):
+        self.submitted += 1
+        task()
+
+    def parallelFor(self, count, body):
+        self.parallel_loops += 1
+        for idx in range(count):
+            body(idx)
+
+
+class Test_Host_refresh:
+    def test_when_not_refreshed_then_host_info_is_queried_once(self, host, mock_host_interface):
+        mock_host_interface.mock.identifier.return_value = "some identifier"
+        mock_host_interface.mock.displayName.return_value = "some display name"
+        mock_host_interface.mock.info.return_value = {"some": "info"}
+
+        for _ in range(2):
+            host.identifier()
+            host.displayName()
+            host.info()
+
+        mock_host_interface.mock.identifier.assert_called_once_with()
+        mock_host_interface.mock.displayName.assert_called_once_with()
+        mock_host_interface.mock.info.assert_called_once_with()
+
+    def test_when_refreshed_then_host_info_is_queried_again(self, host, mock_host_interface):
+        mock_host_interface.mock.displayName.return_value = "some display name"
+        host.displayName()
+        mock_host_interface.mock.displayName.return_value = "another display name"
+
+        host.refresh()
+        actual = host.displayName()
+
+        assert actual == "another display name"
+        assert mock_host_interface.mock.displayName.call_count == 2
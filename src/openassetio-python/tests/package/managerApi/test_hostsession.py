@@ -22,6 +22,7 @@ Tests that cover the openassetio.managerApi.HostSession class.
 
 import pytest
 
+from openassetio import EntityReference
 from openassetio.managerApi import HostSession
 
 
@@ -71,3 +72,29 @@ class Test_HostSession_logger:
         actual_logger = a_host_session.logger()
 
         assert actual_logger is mock_logger
+
+
+class Test_HostSession_notifyEntitiesChanged:
+    def test_when_subscribed_then_callback_receives_changes(self, a_host_session):
+        received = []
+        subscription_id = a_host_session.subscribeToEntityChanges(
+            lambda refs, trait_set: received.append((refs, trait_set))
+        )
+        a_ref = EntityReference("asset://a")
+
+        a_host_session.notifyEntitiesChanged([a_ref], {"a_trait"})
+
+        assert received == [([a_ref], {"a_trait"})]
+
+        a_host_session.unsubscribeFromEntityChanges(subscription_id)
+        a_host_session.notifyEntitiesChanged([a_ref])
+
+        assert len(received) == 1
+
+    def test_when_no_traits_given_then_trait_set_is_empty(self, a_host_session):
+        received = []
+        a_host_session.subscribeToEntityChanges(lambda _, trait_set: received.append(trait_set))
+
+        a_host_session.notifyEntitiesChanged([EntityReference("asset://a")])
+
+        assert received == [set()]
@@ -20,12 +20,18 @@ Tests for the default implementations of ManagerInterface methods.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import gc
+import threading
+import weakref
+
 import pytest
 
 from openassetio import EntityReference, Context, errors, access
+from openassetio.hostApi import Manager
 from openassetio.managerApi import (
     ManagerInterface,
     ManagerStateBase,
+    EntityExistenceFilter,
     EntityReferencePagerInterface,
 )
 from openassetio.trait import TraitsData
@@ -178,6 +184,24 @@ class Test_ManagerInterface_isEntityReferenceString:
             manager_interface.isEntityReferenceString("", a_host_session)
 
 
+class Test_ManagerInterface_areEntityReferenceStrings:
+    def test_default_implementation_raises_NotImplementedException(
+        self, manager_interface, a_host_session, unimplemented_method_error_msg
+    ):
+        with pytest.raises(
+            errors.NotImplementedException,
+            match=unimplemented_method_error_msg.format(
+                "isEntityReferenceString", "entityReferenceIdentification"
+            ),
+        ):
+            manager_interface.areEntityReferenceStrings([""], a_host_session)
+
+    def test_default_implementation_of_empty_batch_returns_empty_list(
+        self, manager_interface, a_host_session
+    ):
+        assert manager_interface.areEntityReferenceStrings([], a_host_session) == []
+
+
 class Test_ManagerInterface_initialize:
     def test_when_settings_not_provided_then_default_implementation_ok(
         self, manager_interface, a_host_session
@@ -217,6 +241,45 @@ class Test_ManagerInterface_flushCaches:
         ManagerInterface().flushCaches(a_host_session)
 
 
+class FlushRecordingManagerInterface(ManagerInterface):
+    """
+    Manager interface recording calls to flushCaches.
+    """
+
+    def __init__(self):
+        super().__init__()
+        self.flushed_sessions = []
+
+    def flushCaches(self, hostSession):
+        self.flushed_sessions.append(hostSession)
+
+
+class Test_ManagerInterface_flushEntityCaches:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(ManagerInterface.flushEntityCaches)
+        assert method_introspector.is_implemented_once(ManagerInterface, "flushEntityCaches")
+
+    def test_default_implementation_flushes_all_caches(self, a_host_session):
+        manager_interface = FlushRecordingManagerInterface()
+
+        manager_interface.flushEntityCaches([EntityReference("a")], a_host_session)
+
+        assert manager_interface.flushed_sessions == [a_host_session]
+
+
+class Test_ManagerInterface_flushCachesWithPrefix:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(ManagerInterface.flushCachesWithPrefix)
+        assert method_introspector.is_implemented_once(ManagerInterface, "flushCachesWithPrefix")
+
+    def test_default_implementation_flushes_all_caches(self, a_host_session):
+        manager_interface = FlushRecordingManagerInterface()
+
+        manager_interface.flushCachesWithPrefix("asset://", a_host_session)
+
+        assert manager_interface.flushed_sessions == [a_host_session]
+
+
 class Test_ManagerInterface_createState:
     def test_method_defined_in_cpp(self, method_introspector):
         assert not method_introspector.is_defined_in_python(ManagerInterface.createState)
@@ -301,6 +364,19 @@ class Test_ManagerInterface_stateFromPersistenceToken:
             ManagerInterface().stateFromPersistenceToken(None, a_host_session)
 
 
+class Test_ManagerInterface_resetState:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(ManagerInterface.resetState)
+        assert method_introspector.is_implemented_once(ManagerInterface, "resetState")
+
+    def test_default_implementation_returns_false(self, manager_interface, a_host_session):
+        assert manager_interface.resetState(ManagerStateBase(), a_host_session) is False
+
+    def test_when_none_is_supplied_then_TypeError_is_raised(self, a_host_session):
+        with pytest.raises(TypeError):
+            ManagerInterface().resetState(None, a_host_session)
+
+
 class Test_ManagerInterface_defaultEntityReference:
     def test_method_defined_in_cpp(self, method_introspector):
         assert not method_introspector.is_defined_in_python(
@@ -339,6 +415,119 @@ class Test_ManagerInterface_entityExists:
             manager_interface.entityExists([], a_context, a_host_session, fail, fail)
 
 
+class Test_ManagerInterface_entityExistenceFilter:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(
+            ManagerInterface.entityExistenceFilter
+        )
+        assert method_introspector.is_implemented_once(ManagerInterface, "entityExistenceFilter")
+
+    def test_default_implementation_returns_none(self, manager_interface, a_host_session):
+        assert manager_interface.entityExistenceFilter(a_host_session) is None
+
+    def test_when_overridden_then_manager_answers_definite_negatives_host_side(
+        self, a_context, a_host_session
+    ):
+        interface = FilteringManagerInterface(["a"])
+        manager = Manager(interface, a_host_session)
+        manager.initialize({})
+
+        results = check_entity_exists(manager, ["a", "b"], a_context)
+
+        assert results == [True, False]
+        assert interface.queried == [["a"]]
+
+    def test_when_entity_registered_then_manager_asked_whether_it_exists(
+        self, a_context, a_host_session
+    ):
+        interface = FilteringManagerInterface(["a"])
+        manager = Manager(interface, a_host_session)
+        manager.initialize({})
+
+        registered = []
+        manager.register(
+            [EntityReference("b")],
+            [TraitsData()],
+            access.PublishingAccess.kWrite,
+            a_context,
+            lambda _idx, ref: registered.append(ref),
+            lambda _idx, err: pytest.fail(err.message),
+        )
+
+        results = check_entity_exists(manager, [r.toString() for r in registered], a_context)
+
+        assert results == [True]
+        assert interface.queried == [["b"]]
+
+
+class FilteringManagerInterface(ManagerInterface):
+    """
+    Manager that provides an existence filter of the given entities, and
+    records the references that it is asked about.
+    """
+
+    def __init__(self, existing):
+        ManagerInterface.__init__(self)
+        self.existing = set(existing)
+        self.queried = []
+
+    def identifier(self):
+        return "org.openassetio.test.filtering"
+
+    def displayName(self):
+        return "Filtering"
+
+    def hasCapability(self, capability):
+        return capability in (
+            ManagerInterface.Capability.kEntityReferenceIdentification,
+            ManagerInterface.Capability.kManagementPolicyQueries,
+            ManagerInterface.Capability.kEntityTraitIntrospection,
+            ManagerInterface.Capability.kExistenceQueries,
+            ManagerInterface.Capability.kPublishing,
+        )
+
+    def entityExistenceFilter(self, hostSession):
+        existenceFilter = EntityExistenceFilter(len(self.existing))
+        for ref in self.existing:
+            existenceFilter.insert(ref)
+        return existenceFilter
+
+    def entityExists(self, entityRefs, context, hostSession, successCallback, errorCallback):
+        self.queried.append([ref.toString() for ref in entityRefs])
+        for idx, ref in enumerate(entityRefs):
+            successCallback(idx, ref.toString() in self.existing)
+
+    # pylint: disable=too-many-arguments
+    def register(
+        self,
+        targetEntityRefs,
+        entityTraitsDatas,
+        publishingAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        for idx, ref in enumerate(targetEntityRefs):
+            self.existing.add(ref.toString())
+            successCallback(idx, ref)
+
+
+def check_entity_exists(manager, refStrings, context):
+    results = [None] * len(refStrings)
+
+    def success(idx, exists):
+        results[idx] = exists
+
+    manager.entityExists(
+        [EntityReference(s) for s in refStrings],
+        context,
+        success,
+        lambda _idx, err: pytest.fail(err.message),
+    )
+    return results
+
+
 class Test_ManagerInterface_entityTraits:
     def test_default_implementation_raises_NotImplementedException(
         self, manager_interface, a_context, a_host_session, unimplemented_method_error_msg
@@ -373,6 +562,170 @@ class Test_ManagerInterface_resolve:
             )
 
 
+class VersionedManagerInterface(ManagerInterface):
+    """
+    Manager interface resolving each entity to a "version" property,
+    taken from `versions`.
+    """
+
+    def __init__(self):
+        super().__init__()
+        self.versions = {}
+
+    def resolve(
+        self,
+        entityReferences,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        for idx, ref in enumerate(entityReferences):
+            data = TraitsData()
+            data.setTraitProperty("stub", "version", self.versions[ref.toString()])
+            successCallback(idx, data)
+
+
+class Test_ManagerInterface_resolveHeterogeneous:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(ManagerInterface.resolveHeterogeneous)
+        assert method_introspector.is_implemented_once(ManagerInterface, "resolveHeterogeneous")
+
+    def test_default_implementation_calls_resolve_per_trait_set(self, a_context, a_host_session):
+        def fail(*_):
+            pytest.fail("No error callbacks should be called")
+
+        class TraitRecordingManagerInterface(ManagerInterface):
+            def __init__(self):
+                super().__init__()
+                self.trait_sets = []
+
+            def resolve(
+                self,
+                entityReferences,
+                traitSet,
+                resolveAccess,
+                context,
+                hostSession,
+                successCallback,
+                errorCallback,
+            ):
+                self.trait_sets.append(traitSet)
+                for idx, ref in enumerate(entityReferences):
+                    successCallback(idx, TraitsData(traitSet | {ref.toString()}))
+
+        manager_interface = TraitRecordingManagerInterface()
+        results = {}
+
+        manager_interface.resolveHeterogeneous(
+            [EntityReference("a"), EntityReference("b"), EntityReference("c")],
+            [{"x"}, {"y"}],
+            [1, 0, 1],
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            lambda idx, data: results.update({idx: data.traitSet()}),
+            fail,
+        )
+
+        assert manager_interface.trait_sets == [{"x"}, {"y"}]
+        assert results == {0: {"y", "a"}, 1: {"x", "b"}, 2: {"y", "c"}}
+
+
+class Test_ManagerInterface_resolveProjected:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(ManagerInterface.resolveProjected)
+        assert method_introspector.is_implemented_once(ManagerInterface, "resolveProjected")
+
+    def test_default_implementation_ignores_projection_and_calls_resolve(
+        self, a_context, a_host_session
+    ):
+        def fail(*_):
+            pytest.fail("No error callbacks should be called")
+
+        manager_interface = VersionedManagerInterface()
+        manager_interface.versions = {"a": 1}
+        results = []
+
+        manager_interface.resolveProjected(
+            [EntityReference("a")],
+            {"stub"},
+            {"stub": set()},
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            lambda idx, data: results.append(data),
+            fail,
+        )
+
+        assert len(results) == 1
+        assert results[0].getTraitProperty("stub", "version") == 1
+
+
+class Test_ManagerInterface_resolveIfChanged:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(ManagerInterface.resolveIfChanged)
+        assert method_introspector.is_implemented_once(ManagerInterface, "resolveIfChanged")
+
+    def test_default_implementation_returns_only_changed_data(self, a_context, a_host_session):
+        def fail(*_):
+            pytest.fail("No error callbacks should be called")
+
+        manager_interface = VersionedManagerInterface()
+        manager_interface.versions = {"a": 1, "b": 1}
+        refs = [EntityReference("a"), EntityReference("b")]
+
+        def resolve_if_changed(tokens):
+            results = [None] * len(refs)
+
+            def success_cb(idx, result):
+                results[idx] = result
+
+            manager_interface.resolveIfChanged(
+                refs,
+                {"stub"},
+                access.ResolveAccess.kRead,
+                tokens,
+                a_context,
+                a_host_session,
+                success_cb,
+                fail,
+            )
+            return results
+
+        first = resolve_if_changed(["", ""])
+        assert all(result.traitsData is not None for result in first)
+        assert all(result.generationToken for result in first)
+
+        manager_interface.versions["b"] = 2
+        second = resolve_if_changed([result.generationToken for result in first])
+
+        assert second[0].traitsData is None
+        assert second[0].generationToken == first[0].generationToken
+        assert second[1].traitsData.getTraitProperty("stub", "version") == 2
+        assert second[1].generationToken != first[1].generationToken
+
+    def test_when_token_count_mismatched_then_raises_InputValidationException(
+        self, a_context, a_host_session
+    ):
+        def fail(*_):
+            pytest.fail("No callbacks should be called")
+
+        with pytest.raises(errors.InputValidationException):
+            VersionedManagerInterface().resolveIfChanged(
+                [EntityReference("a")],
+                set(),
+                access.ResolveAccess.kRead,
+                [],
+                a_context,
+                a_host_session,
+                fail,
+                fail,
+            )
+
+
 class Test_ManagerInterface_getWithRelationship:
     def test_method_defined_in_cpp(self, method_introspector):
         assert not method_introspector.is_defined_in_python(ManagerInterface.getWithRelationship)
@@ -433,6 +786,184 @@ class Test_ManagerInterface_getWithRelationships:
             )
 
 
+class Test_ManagerInterface_getWithRelationshipsMatrix:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(
+            ManagerInterface.getWithRelationshipsMatrix
+        )
+        assert method_introspector.is_implemented_once(
+            ManagerInterface, "getWithRelationshipsMatrix"
+        )
+
+    def test_default_implementation_raises_NotImplementedException(
+        self, manager_interface, a_context, a_host_session, unimplemented_method_error_msg
+    ):
+        def fail(*_):
+            pytest.fail("No callbacks should be called")
+
+        with pytest.raises(
+            errors.NotImplementedException,
+            match=unimplemented_method_error_msg.format(
+                "getWithRelationships", "relationshipQueries"
+            ),
+        ):
+            manager_interface.getWithRelationshipsMatrix(
+                [EntityReference("")],
+                [TraitsData()],
+                set(),
+                1,
+                access.RelationsAccess.kRead,
+                a_context,
+                a_host_session,
+                fail,
+                fail,
+            )
+
+    def test_default_implementation_calls_getWithRelationships_with_row_major_indices(
+        self, a_context, a_host_session
+    ):
+        class RelationshipsManagerInterface(ManagerInterface):
+            # pylint: disable=too-many-arguments
+            def getWithRelationships(
+                self,
+                entityReference,
+                relationshipTraitsDatas,
+                resultTraitSet,
+                pageSize,
+                relationsAccess,
+                context,
+                hostSession,
+                successCallback,
+                errorCallback,
+            ):
+                calls.append(entityReference)
+                successCallback(0, EntityReferencePagerInterface())
+                errorCallback(
+                    1,
+                    errors.BatchElementError(
+                        errors.BatchElementError.ErrorCode.kUnknown, entityReference.toString()
+                    ),
+                )
+
+        calls = []
+        successes = []
+        errs = []
+        refs = [EntityReference("a"), EntityReference("b")]
+
+        RelationshipsManagerInterface().getWithRelationshipsMatrix(
+            refs,
+            [TraitsData(), TraitsData()],
+            set(),
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            a_host_session,
+            lambda idx, _pager: successes.append(idx),
+            lambda idx, err: errs.append((idx, err.message)),
+        )
+
+        assert calls == refs
+        assert successes == [0, 2]
+        assert errs == [(1, "a"), (3, "b")]
+
+
+class Test_ManagerInterface_traverseRelationships:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(
+            ManagerInterface.traverseRelationships
+        )
+        assert method_introspector.is_implemented_once(ManagerInterface, "traverseRelationships")
+
+    def test_default_implementation_raises_NotImplementedException(
+        self, manager_interface, a_context, a_host_session, unimplemented_method_error_msg
+    ):
+        def fail(*_):
+            pytest.fail("No callbacks should be called")
+
+        with pytest.raises(
+            errors.NotImplementedException,
+            match=unimplemented_method_error_msg.format(
+                "getWithRelationship", "relationshipQueries"
+            ),
+        ):
+            manager_interface.traverseRelationships(
+                [EntityReference("")],
+                [TraitsData()],
+                set(),
+                1,
+                access.RelationsAccess.kRead,
+                a_context,
+                a_host_session,
+                fail,
+                fail,
+            )
+
+    def test_default_implementation_fails_inputs_that_reach_a_failing_entity(
+        self, a_context, a_host_session
+    ):
+        graph = {"a": ["b"], "b": ["broken"], "c": ["d"]}
+
+        class ListPager(EntityReferencePagerInterface):
+            def __init__(self, refs):
+                EntityReferencePagerInterface.__init__(self)
+                self.__refs = refs
+
+            def hasNext(self, _hostSession):
+                return False
+
+            def get(self, _hostSession):
+                return self.__refs
+
+            def next(self, _hostSession):
+                self.__refs = []
+
+        class RelationshipsManagerInterface(ManagerInterface):
+            # pylint: disable=too-many-arguments
+            def getWithRelationship(
+                self,
+                entityReferences,
+                relationshipTraitsData,
+                resultTraitSet,
+                pageSize,
+                relationsAccess,
+                context,
+                hostSession,
+                successCallback,
+                errorCallback,
+            ):
+                for idx, ref in enumerate(entityReferences):
+                    if ref.toString() == "broken":
+                        errorCallback(
+                            idx,
+                            errors.BatchElementError(
+                                errors.BatchElementError.ErrorCode.kUnknown, ref.toString()
+                            ),
+                        )
+                        continue
+                    successCallback(
+                        idx,
+                        ListPager([EntityReference(r) for r in graph.get(ref.toString(), [])]),
+                    )
+
+        successes = []
+        errs = []
+
+        RelationshipsManagerInterface().traverseRelationships(
+            [EntityReference("a"), EntityReference("c")],
+            [TraitsData()],
+            set(),
+            10,
+            access.RelationsAccess.kRead,
+            a_context,
+            a_host_session,
+            lambda idx, levels: successes.append((idx, levels)),
+            lambda idx, err: errs.append((idx, err.message)),
+        )
+
+        assert successes == [(1, [[EntityReference("d")]])]
+        assert errs == [(0, "broken")]
+
+
 def assert_is_default_pager(a_host_session, pager):
     # The default pager behaviour is to return no data and
     # report no new pages.
@@ -504,6 +1035,104 @@ class Test_ManagerInterface_register:
             )
 
 
+class Test_ManagerInterface_overrides:
+    def test_when_method_not_overridden_then_cpp_implementation_called_repeatedly(
+        self, a_host_session
+    ):
+        class PartialManagerInterface(ManagerInterface):
+            pass
+
+        manager = Manager(PartialManagerInterface(), a_host_session)
+
+        assert manager.settings() == {}
+        assert manager.settings() == {}
+
+    def test_when_method_overridden_then_override_called_repeatedly(self, a_host_session):
+        class PartialManagerInterface(ManagerInterface):
+            def settings(self, hostSession):
+                return {"a": 1}
+
+        manager = Manager(PartialManagerInterface(), a_host_session)
+
+        assert manager.settings() == {"a": 1}
+        assert manager.settings() == {"a": 1}
+
+    def test_when_override_first_calls_super_then_override_still_called_via_cpp(
+        self, a_host_session
+    ):
+        class PartialManagerInterface(ManagerInterface):
+            def __init__(self):
+                ManagerInterface.__init__(self)
+                self.calls = 0
+
+            def settings(self, hostSession):
+                self.calls += 1
+                return super().settings(hostSession)
+
+        interface = PartialManagerInterface()
+        manager = Manager(interface, a_host_session)
+
+        # Calling from Python first means the C++ implementation's
+        # first call comes from within the override, via `super()`.
+        assert interface.settings(a_host_session) == {}
+        assert manager.settings() == {}
+
+        assert interface.calls == 2
+
+    def test_when_override_is_instance_attribute_then_override_called(self, a_host_session):
+        class PartialManagerInterface(ManagerInterface):
+            pass
+
+        interface = PartialManagerInterface()
+        interface.settings = lambda hostSession: {"a": 1}
+        manager = Manager(interface, a_host_session)
+
+        assert manager.settings() == {"a": 1}
+        assert manager.settings() == {"a": 1}
+
+    def test_when_overrides_called_then_instance_can_be_garbage_collected(self, a_host_session):
+        class PartialManagerInterface(ManagerInterface):
+            def settings(self, hostSession):
+                return {}
+
+        interface = PartialManagerInterface()
+        interface_ref = weakref.ref(interface)
+        manager = Manager(interface, a_host_session)
+        manager.settings()
+
+        del manager
+        del interface
+        gc.collect()
+
+        assert interface_ref() is None
+
+    def test_when_first_called_concurrently_then_override_called_by_every_thread(
+        self, a_host_session
+    ):
+        class PartialManagerInterface(ManagerInterface):
+            def settings(self, hostSession):
+                return {"a": 1}
+
+        manager = Manager(PartialManagerInterface(), a_host_session)
+        num_threads = 8
+        barrier = threading.Barrier(num_threads)
+        results = [None] * num_threads
+
+        def call_settings(idx):
+            barrier.wait()
+            results[idx] = manager.settings()
+
+        threads = [
+            threading.Thread(target=call_settings, args=(idx,)) for idx in range(num_threads)
+        ]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        assert results == [{"a": 1}] * num_threads
+
+
 @pytest.fixture
 def manager_interface():
     return ManagerInterface()
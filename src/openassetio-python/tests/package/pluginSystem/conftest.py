@@ -20,6 +20,7 @@ Helper fixtures for testing the Python plugin system
 # pylint: disable=invalid-name
 
 import os
+import sys
 
 import pytest
 
@@ -34,6 +35,11 @@ def package_plugin_identifier():
     return "org.openassetio.test.pluginSystem.resources.packagePlugin"
 
 
+@pytest.fixture
+def declared_plugin_identifier():
+    return "org.openassetio.test.pluginSystem.resources.declaredPlugin"
+
+
 @pytest.fixture
 def entry_point_plugin_identifier(package_plugin_identifier):
     return package_plugin_identifier
@@ -54,6 +60,17 @@ def a_package_plugin_path(the_resources_directory_path):
     return os.path.join(the_resources_directory_path, "pathB")
 
 
+@pytest.fixture
+def a_declared_plugin_path(the_resources_directory_path):
+    path = os.path.join(the_resources_directory_path, "pathD")
+    yield path
+    # Forget imported modules, so subsequent tests can check whether
+    # the plugin's implementation is imported.
+    for name, module in list(sys.modules.items()):
+        if (getattr(module, "__file__", None) or "").startswith(path):
+            del sys.modules[name]
+
+
 @pytest.fixture
 def broken_plugins_path(the_resources_directory_path):
     return os.path.join(the_resources_directory_path, "broken", "site-packages")
@@ -2,6 +2,7 @@
 Provides a test PythonPluginSystemPlugin implementation.
 """
 
+from openassetio.hostApi import ManagerFactory
 from openassetio.pluginSystem import PythonPluginSystemManagerPlugin
 
 
@@ -17,3 +18,9 @@ class PackagePlugin(PythonPluginSystemManagerPlugin):
         # This is nonsense, but allows us to check where this was
         # loaded from in precedence checks.
         return {"file": __file__}
+
+    @classmethod
+    def details(cls):
+        return ManagerFactory.ManagerDetail(
+            identifier=cls.identifier(), displayName="Package Plugin", info={"file": __file__}
+        )
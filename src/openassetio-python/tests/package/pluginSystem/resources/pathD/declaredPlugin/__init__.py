@@ -0,0 +1,20 @@
+"""
+Provides a test PythonPluginSystemPlugin that is declared without
+importing its implementation.
+"""
+
+from openassetio.hostApi import ManagerFactory
+from openassetio.pluginSystem import PythonPluginSystemManagerPlugin
+
+
+# pylint: disable=invalid-name
+plugin = PythonPluginSystemManagerPlugin.declare(
+    "org.openassetio.test.pluginSystem.resources.declaredPlugin",
+    ".implementation:DeclaredManagerInterface",
+    package=__name__,
+    details=ManagerFactory.ManagerDetail(
+        identifier="org.openassetio.test.pluginSystem.resources.declaredPlugin",
+        displayName="Declared Plugin",
+        info={},
+    ),
+)
@@ -0,0 +1,13 @@
+"""
+Provides the implementation of the declared test plugin, which is
+only imported when its interface is constructed.
+"""
+
+
+class DeclaredManagerInterface(dict):
+    # pylint: disable=missing-class-docstring
+
+    def __init__(self):
+        # This is nonsense, but allows us to check where this was
+        # loaded from.
+        super().__init__(file=__file__)
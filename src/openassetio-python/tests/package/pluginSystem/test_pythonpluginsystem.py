@@ -20,6 +20,7 @@ These tests check the functionality of the PythonPluginSystem class.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import json
 import os
 import sys
 from typing import List
@@ -133,6 +134,166 @@ class Test_PythonPluginSystem_scan:
         )
 
 
+class Test_PythonPluginSystem_scan_identifier:
+    def test_when_plugin_found_then_remaining_paths_not_searched(
+        self,
+        a_plugin_system,
+        a_module_plugin_path,
+        a_package_plugin_path,
+        module_plugin_identifier,
+        monkeypatch,
+    ):
+        listed_paths = []
+        listdir = os.listdir
+
+        def recording_listdir(path):
+            listed_paths.append(path)
+            return listdir(path)
+
+        monkeypatch.setattr(os, "listdir", recording_listdir)
+
+        is_found = a_plugin_system.scan(
+            os.pathsep.join((a_module_plugin_path, a_package_plugin_path)),
+            identifier=module_plugin_identifier,
+        )
+
+        assert is_found is True
+        assert a_plugin_system.identifiers() == [module_plugin_identifier]
+        assert listed_paths == [a_module_plugin_path]
+
+    def test_when_plugin_found_in_parallel_then_remaining_modules_not_imported(
+        self,
+        a_plugin_system,
+        a_module_plugin_path,
+        a_package_plugin_path,
+        module_plugin_identifier,
+    ):
+        a_plugin_system.scan(
+            os.pathsep.join((a_module_plugin_path, a_package_plugin_path)),
+            maxWorkers=2,
+            identifier=module_plugin_identifier,
+        )
+
+        assert a_plugin_system.identifiers() == [module_plugin_identifier]
+        assert len(a_plugin_system.startupReport().entries()) == 1
+
+    def test_when_plugin_not_found_then_all_plugins_loaded(
+        self,
+        a_plugin_system,
+        a_module_plugin_path,
+        a_package_plugin_path,
+        package_plugin_identifier,
+        module_plugin_identifier,
+    ):
+        is_found = a_plugin_system.scan(
+            os.pathsep.join((a_module_plugin_path, a_package_plugin_path)),
+            identifier="nonexistent",
+        )
+
+        assert is_found is False
+        assert set(a_plugin_system.identifiers()) == {
+            module_plugin_identifier,
+            package_plugin_identifier,
+        }
+
+    def test_when_scanned_again_then_only_remaining_modules_imported(
+        self,
+        a_plugin_system,
+        a_module_plugin_path,
+        a_package_plugin_path,
+        package_plugin_identifier,
+        module_plugin_identifier,
+    ):
+        paths = os.pathsep.join((a_module_plugin_path, a_package_plugin_path))
+        a_plugin_system.scan(paths, identifier=module_plugin_identifier)
+        a_plugin_system.scan(paths)
+
+        assert a_plugin_system.identifiers() == [
+            module_plugin_identifier,
+            package_plugin_identifier,
+        ]
+        assert len(a_plugin_system.startupReport().entries()) == 2
+
+
+class Test_PythonPluginSystem_scan_parallel:
+    def test_when_multiple_plugins_share_identifiers_then_leftmost_is_used(
+        self, a_plugin_system, the_resources_directory_path, module_plugin_identifier
+    ):
+        path_a = os.path.join(the_resources_directory_path, "pathA")
+        path_b = os.path.join(the_resources_directory_path, "pathB")
+        path_c = os.path.join(the_resources_directory_path, "pathC")
+
+        a_plugin_system.scan(paths=os.pathsep.join((path_c, path_b, path_a)), maxWorkers=3)
+
+        assert len(a_plugin_system.identifiers()) == 2
+        assert "pathC" in a_plugin_system.plugin(module_plugin_identifier).__file__
+
+
+class Test_PythonPluginSystem_scan_discoveryCachePath:
+    def test_when_cache_does_not_exist_then_plugins_loaded_and_cache_written(
+        self, a_plugin_system, a_module_plugin_path, module_plugin_identifier, a_cache_path
+    ):
+        a_plugin_system.scan(a_module_plugin_path, discoveryCachePath=a_cache_path)
+
+        assert a_plugin_system.identifiers() == [module_plugin_identifier]
+        assert os.path.exists(a_cache_path)
+
+    def test_when_cache_valid_then_path_not_crawled(
+        self,
+        a_plugin_system,
+        a_module_plugin_path,
+        module_plugin_identifier,
+        a_cache_path,
+        monkeypatch,
+    ):
+        a_plugin_system.scan(a_module_plugin_path, discoveryCachePath=a_cache_path)
+        a_plugin_system.reset()
+
+        def fail_listdir(path):
+            raise AssertionError(f"Unexpected listdir of {path}")
+
+        monkeypatch.setattr(os, "listdir", fail_listdir)
+        a_plugin_system.scan(a_module_plugin_path, discoveryCachePath=a_cache_path)
+
+        assert a_plugin_system.identifiers() == [module_plugin_identifier]
+
+    def test_when_path_modified_then_path_crawled_again(
+        self, a_plugin_system, tmp_path, a_module_plugin_path, module_plugin_identifier
+    ):
+        plugin_dir = tmp_path / "plugins"
+        plugin_dir.mkdir()
+        cache_path = str(tmp_path / "cache.json")
+
+        a_plugin_system.scan(str(plugin_dir), discoveryCachePath=cache_path)
+        assert a_plugin_system.identifiers() == []
+
+        with open(os.path.join(a_module_plugin_path, "modulePlugin.py"), encoding="utf-8") as src:
+            (plugin_dir / "modulePlugin.py").write_text(src.read(), encoding="utf-8")
+        # Ensure the change is visible regardless of mtime granularity.
+        stat = os.stat(plugin_dir)
+        os.utime(plugin_dir, ns=(stat.st_atime_ns, stat.st_mtime_ns + 1_000_000_000))
+
+        a_plugin_system.scan(str(plugin_dir), discoveryCachePath=cache_path)
+        assert a_plugin_system.identifiers() == [module_plugin_identifier]
+
+    def test_when_cache_corrupt_then_warning_logged_and_plugins_loaded(
+        self, a_module_plugin_path, module_plugin_identifier, a_cache_path, mock_logger
+    ):
+        with open(a_cache_path, "w", encoding="utf-8") as cache_file:
+            cache_file.write("not json")
+
+        plugin_system = PythonPluginSystem(mock_logger)
+        plugin_system.scan(a_module_plugin_path, discoveryCachePath=a_cache_path)
+
+        assert plugin_system.identifiers() == [module_plugin_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            StringContaining(
+                [f"PythonPluginSystem: Ignoring unreadable discovery cache {a_cache_path}"]
+            ),
+        )
+
+
 class Test_PythonPluginSystem_scan_entry_points:
     def test_when_no_package_with_entry_point_installed_then_nothing_loaded_and_true_returned(
         self, a_plugin_system
@@ -198,6 +359,214 @@ class Test_PythonPluginSystem_scan_entry_points:
         )
 
 
+class Test_PythonPluginSystem_writeIndex:
+    def test_when_plugins_loaded_then_index_lists_identifiers_and_paths(
+        self, a_plugin_system, a_module_plugin_path, module_plugin_identifier, an_index_path
+    ):
+        a_plugin_system.scan(a_module_plugin_path)
+        a_plugin_system.writeIndex(an_index_path)
+
+        with open(an_index_path, encoding="utf-8") as index_file:
+            index = json.load(index_file)
+
+        assert index["plugins"] == [
+            {
+                "identifier": module_plugin_identifier,
+                "path": os.path.join(a_module_plugin_path, "modulePlugin.py"),
+            }
+        ]
+
+    def test_when_metadata_provided_then_stored_in_index(
+        self, a_plugin_system, a_module_plugin_path, module_plugin_identifier, an_index_path
+    ):
+        a_plugin_system.scan(a_module_plugin_path)
+        a_plugin_system.writeIndex(an_index_path, lambda plugin: {"id": plugin.identifier()})
+
+        a_plugin_system.reset()
+        a_plugin_system.loadIndex(an_index_path)
+
+        assert a_plugin_system.indexMetadata(module_plugin_identifier) == {
+            "id": module_plugin_identifier
+        }
+
+    def test_when_plugin_registered_manually_then_omitted(self, a_plugin_system, an_index_path):
+        class ManualPlugin:
+            @staticmethod
+            def identifier():
+                return "manual"
+
+        a_plugin_system.register(ManualPlugin)
+        a_plugin_system.writeIndex(an_index_path)
+
+        with open(an_index_path, encoding="utf-8") as index_file:
+            assert json.load(index_file)["plugins"] == []
+
+
+class Test_PythonPluginSystem_loadIndex:
+    def test_when_index_valid_then_plugins_registered_without_searching(
+        self,
+        a_plugin_system,
+        a_module_plugin_path,
+        module_plugin_identifier,
+        an_index_path,
+        monkeypatch,
+    ):
+        a_plugin_system.scan(a_module_plugin_path)
+        a_plugin_system.writeIndex(an_index_path)
+        a_plugin_system.reset()
+
+        def fail_listdir(path):
+            raise AssertionError(f"Unexpected listdir of {path}")
+
+        monkeypatch.setattr(os, "listdir", fail_listdir)
+
+        assert a_plugin_system.loadIndex(an_index_path) is True
+        assert a_plugin_system.identifiers() == [module_plugin_identifier]
+        assert a_plugin_system.startupReport().entries() == []
+        assert a_plugin_system.indexMetadata(module_plugin_identifier) is None
+
+    def test_when_indexed_plugin_retrieved_then_imported(
+        self, a_plugin_system, a_module_plugin_path, module_plugin_identifier, an_index_path
+    ):
+        a_plugin_system.scan(a_module_plugin_path)
+        a_plugin_system.writeIndex(an_index_path)
+        a_plugin_system.reset()
+        a_plugin_system.loadIndex(an_index_path)
+
+        plugin = a_plugin_system.plugin(module_plugin_identifier)
+
+        assert plugin.identifier() == module_plugin_identifier
+        assert a_plugin_system.startupReport().entry(module_plugin_identifier) is not None
+
+    def test_when_index_out_of_date_then_raises_ConfigurationException(
+        self, a_plugin_system, a_module_plugin_path, an_index_path
+    ):
+        plugin_path = os.path.join(a_module_plugin_path, "modulePlugin.py")
+        write_index(an_index_path, [{"identifier": "renamed", "path": plugin_path}])
+        a_plugin_system.loadIndex(an_index_path)
+
+        with pytest.raises(
+            errors.ConfigurationException,
+            match="PythonPluginSystem: Plug-in index is out of date",
+        ):
+            a_plugin_system.plugin("renamed")
+
+    def test_when_indexed_module_missing_then_raises_ConfigurationException(
+        self, tmp_path, an_index_path, mock_logger
+    ):
+        missing_path = str(tmp_path / "missing.py")
+        write_index(an_index_path, [{"identifier": "missing", "path": missing_path}])
+        plugin_system = PythonPluginSystem(mock_logger)
+        plugin_system.loadIndex(an_index_path)
+
+        with pytest.raises(
+            errors.ConfigurationException,
+            match="PythonPluginSystem: Unable to load plug-in 'missing'",
+        ):
+            plugin_system.plugin("missing")
+
+    def test_when_plugin_already_registered_then_index_entry_skipped(
+        self,
+        a_plugin_system,
+        the_resources_directory_path,
+        module_plugin_identifier,
+        an_index_path,
+    ):
+        path_c_plugin = os.path.join(the_resources_directory_path, "pathC", "modulePlugin.py")
+        write_index(
+            an_index_path, [{"identifier": module_plugin_identifier, "path": path_c_plugin}]
+        )
+
+        a_plugin_system.scan(os.path.join(the_resources_directory_path, "pathA"))
+        a_plugin_system.loadIndex(an_index_path)
+
+        assert "pathA" in a_plugin_system.plugin(module_plugin_identifier).__file__
+
+    def test_when_index_corrupt_then_warning_logged_and_false_returned(
+        self, an_index_path, mock_logger
+    ):
+        with open(an_index_path, "w", encoding="utf-8") as index_file:
+            index_file.write("not json")
+
+        plugin_system = PythonPluginSystem(mock_logger)
+
+        assert plugin_system.loadIndex(an_index_path) is False
+        assert plugin_system.identifiers() == []
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            StringContaining(
+                [f"PythonPluginSystem: Ignoring unreadable plug-in index {an_index_path}"]
+            ),
+        )
+
+    def test_when_index_version_unsupported_then_false_returned(
+        self, a_plugin_system, an_index_path
+    ):
+        with open(an_index_path, "w", encoding="utf-8") as index_file:
+            json.dump({"version": 0, "plugins": []}, index_file)
+
+        assert a_plugin_system.loadIndex(an_index_path) is False
+
+
+class Test_PythonPluginSystem_startupReport:
+    def test_when_not_scanned_then_empty(self, a_plugin_system):
+        assert a_plugin_system.startupReport().entries() == []
+
+    def test_when_path_scanned_then_plugin_times_recorded(
+        self, a_plugin_system, a_module_plugin_path, module_plugin_identifier
+    ):
+        a_plugin_system.scan(a_module_plugin_path)
+
+        entry = a_plugin_system.startupReport().entry(module_plugin_identifier)
+        assert entry.path == os.path.join(a_module_plugin_path, "modulePlugin.py")
+        assert entry.discoverTime >= 0
+        assert entry.importTime >= 0
+        assert entry.instantiateTime is None
+
+    def test_when_path_scanned_then_import_times_logged(self, a_module_plugin_path, mock_logger):
+        plugin_system = PythonPluginSystem(mock_logger)
+        plugin_system.scan(a_module_plugin_path)
+
+        plugin_path = os.path.join(a_module_plugin_path, "modulePlugin.py")
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebugApi,
+            StringContaining([f"PythonPluginSystem: Imported {plugin_path} in ", "ms"]),
+        )
+
+    def test_when_plugins_broken_then_recorded_without_identifiers(
+        self, a_plugin_system, broken_plugins_path
+    ):
+        a_plugin_system.scan(broken_plugins_path)
+
+        entries = a_plugin_system.startupReport().entries()
+        assert sorted(os.path.basename(entry.path) for entry in entries) == [
+            "missing_plugin.py",
+            "raises_exception.py",
+        ]
+        assert all(entry.identifier is None for entry in entries)
+
+    def test_when_entry_point_loaded_then_plugin_times_recorded(
+        self,
+        a_plugin_system,
+        an_entry_point_package_plugin_root,
+        entry_point_plugin_identifier,
+        monkeypatch,
+    ):
+        monkeypatch.syspath_prepend(an_entry_point_package_plugin_root)
+        a_plugin_system.scan_entry_points(PLUGIN_ENTRY_POINT_GROUP)
+
+        entry = a_plugin_system.startupReport().entry(entry_point_plugin_identifier)
+        assert an_entry_point_package_plugin_root in entry.path
+        assert entry.discoverTime >= 0
+        assert entry.importTime >= 0
+
+    def test_when_reset_then_empty(self, a_plugin_system, a_module_plugin_path):
+        a_plugin_system.scan(a_module_plugin_path)
+        a_plugin_system.reset()
+
+        assert a_plugin_system.startupReport().entries() == []
+
+
 class Test_PythonPluginSystem_plugin:
     def test_when_plugin_not_found_then_raises_InputValidationException(self, a_plugin_system):
         with pytest.raises(
@@ -212,6 +581,21 @@ def a_plugin_system(a_logger):
     return PythonPluginSystem(a_logger)
 
 
+@pytest.fixture
+def a_cache_path(tmp_path):
+    return str(tmp_path / "discovery_cache.json")
+
+
+@pytest.fixture
+def an_index_path(tmp_path):
+    return str(tmp_path / "plugin_index.json")
+
+
+def write_index(path, plugins):
+    with open(path, "w", encoding="utf-8") as index_file:
+        json.dump({"version": 1, "plugins": plugins}, index_file)
+
+
 # We use a real logger vs a mock, as it makes debugging test failures
 # easier as it surfaces any actual in-flight errors from the plugin
 # system.
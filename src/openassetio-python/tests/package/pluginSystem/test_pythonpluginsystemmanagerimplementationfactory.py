@@ -23,6 +23,10 @@ ManagerImplementationFactoryInterface implementation.
 # pylint: disable=missing-class-docstring,missing-function-docstring
 # pylint: disable=use-implicit-booleaness-not-comparison
 
+import importlib.util
+import os
+import sys
+
 import pytest
 
 from openassetio.log import ConsoleLogger
@@ -42,6 +46,18 @@ class Test_PythonPluginSystemManagerImplementationFactory:
             == "OPENASSETIO_DISABLE_ENTRYPOINTS_PLUGINS"
         )
 
+    def test_exposes_discovery_cache_var_name_with_expected_value(self):
+        assert (
+            PythonPluginSystemManagerImplementationFactory.kDiscoveryCacheEnvVar
+            == "OPENASSETIO_PLUGIN_DISCOVERY_CACHE"
+        )
+
+    def test_exposes_plugin_index_var_name_with_expected_value(self):
+        assert (
+            PythonPluginSystemManagerImplementationFactory.kPluginIndexEnvVar
+            == "OPENASSETIO_PLUGIN_INDEX"
+        )
+
     def test_exposes_entry_point_group_with_expected_value(self):
         assert (
             PythonPluginSystemManagerImplementationFactory.kPackageEntryPointGroup
@@ -164,6 +180,254 @@ class Test_PythonPluginSystemManagerImplementationFactory_init:
         assert a_package_plugin_path in factory.instantiate(package_plugin_identifier)["file"]
 
 
+class Test_PythonPluginSystemManagerImplementationFactory_instantiate:
+    def test_when_not_scanned_then_only_requested_plugin_loaded(
+        self,
+        a_module_plugin_path,
+        a_package_plugin_path,
+        module_plugin_identifier,
+        package_plugin_identifier,
+        mock_logger,
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger,
+            paths=os.pathsep.join((a_module_plugin_path, a_package_plugin_path)),
+            disableEntryPointsPlugins=True,
+        )
+
+        assert a_module_plugin_path in factory.instantiate(module_plugin_identifier)["file"]
+        assert [entry.identifier for entry in factory.startupReport().entries()] == [
+            module_plugin_identifier
+        ]
+
+        assert factory.identifiers() == [module_plugin_identifier, package_plugin_identifier]
+
+    def test_when_requested_plugin_in_later_path_then_found(
+        self,
+        a_module_plugin_path,
+        a_package_plugin_path,
+        package_plugin_identifier,
+        mock_logger,
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger,
+            paths=os.pathsep.join((a_module_plugin_path, a_package_plugin_path)),
+            disableEntryPointsPlugins=True,
+        )
+
+        assert a_package_plugin_path in factory.instantiate(package_plugin_identifier)["file"]
+
+    def test_when_requested_entry_point_plugin_then_found(
+        self,
+        prepended_sys_path_with_entry_point_plugin,
+        a_module_plugin_path,
+        entry_point_plugin_identifier,
+        mock_logger,
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_module_plugin_path, disableEntryPointsPlugins=False
+        )
+
+        assert factory.instantiate(entry_point_plugin_identifier) is not None
+
+
+class Test_PythonPluginSystemManagerImplementationFactory_discoveryCachePath:
+    def test_when_cache_env_set_then_search_results_persisted(
+        self, a_module_plugin_path, module_plugin_identifier, mock_logger, tmp_path, monkeypatch
+    ):
+        cache_path = tmp_path / "discovery_cache.json"
+        monkeypatch.setenv(
+            PythonPluginSystemManagerImplementationFactory.kDiscoveryCacheEnvVar, str(cache_path)
+        )
+
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_module_plugin_path, disableEntryPointsPlugins=True
+        )
+
+        assert factory.identifiers() == [module_plugin_identifier]
+        assert cache_path.exists()
+
+
+class Test_PythonPluginSystemManagerImplementationFactory_details:
+    def test_when_plugin_declares_details_then_details_returned(
+        self, a_package_plugin_path, package_plugin_identifier, mock_logger
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_package_plugin_path, disableEntryPointsPlugins=True
+        )
+
+        details = factory.details(package_plugin_identifier)
+
+        assert details.identifier == package_plugin_identifier
+        assert details.displayName == "Package Plugin"
+        assert a_package_plugin_path in details.info["file"]
+
+    def test_when_plugin_does_not_declare_details_then_returns_none(
+        self, a_module_plugin_path, module_plugin_identifier, mock_logger
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_module_plugin_path, disableEntryPointsPlugins=True
+        )
+
+        assert factory.details(module_plugin_identifier) is None
+
+
+class Test_PythonPluginSystemManagerImplementationFactory_declaredPlugin:
+    def test_when_listed_then_implementation_not_imported(
+        self, a_declared_plugin_path, declared_plugin_identifier, mock_logger
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_declared_plugin_path, disableEntryPointsPlugins=True
+        )
+
+        assert factory.identifiers() == [declared_plugin_identifier]
+        assert factory.details(declared_plugin_identifier).displayName == "Declared Plugin"
+        assert not is_imported(declared_implementation_path(a_declared_plugin_path))
+
+    def test_when_instantiated_then_implementation_imported(
+        self, a_declared_plugin_path, declared_plugin_identifier, mock_logger
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_declared_plugin_path, disableEntryPointsPlugins=True
+        )
+        implementation_path = declared_implementation_path(a_declared_plugin_path)
+
+        interface = factory.instantiate(declared_plugin_identifier)
+
+        assert interface["file"] == implementation_path
+        assert is_imported(implementation_path)
+
+
+class Test_PythonPluginSystemManagerImplementationFactory_indexPath:
+    def test_when_index_env_set_then_plugins_listed_without_searching(
+        self, an_indexed_package_plugin, package_plugin_identifier, mock_logger, monkeypatch
+    ):
+        monkeypatch.setenv(
+            PythonPluginSystemManagerImplementationFactory.kPluginIndexEnvVar,
+            an_indexed_package_plugin,
+        )
+
+        def fail_listdir(path):
+            raise AssertionError(f"Unexpected listdir of {path}")
+
+        monkeypatch.setattr(os, "listdir", fail_listdir)
+
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths="/nonexistent", disableEntryPointsPlugins=False
+        )
+
+        assert factory.identifiers() == [package_plugin_identifier]
+
+    def test_when_index_used_then_details_served_without_importing(
+        self,
+        an_indexed_package_plugin,
+        a_package_plugin_path,
+        package_plugin_identifier,
+        mock_logger,
+        monkeypatch,
+    ):
+        def fail_import(name, path, *args, **kwargs):
+            raise AssertionError(f"Unexpected import of {path}")
+
+        monkeypatch.setattr(importlib.util, "spec_from_file_location", fail_import)
+
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, indexPath=an_indexed_package_plugin
+        )
+        details = factory.details(package_plugin_identifier)
+
+        assert details.identifier == package_plugin_identifier
+        assert details.displayName == "Package Plugin"
+        assert a_package_plugin_path in details.info["file"]
+
+    def test_when_index_used_then_plugin_imported_on_instantiate(
+        self, an_indexed_package_plugin, a_package_plugin_path, package_plugin_identifier
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            ConsoleLogger(), indexPath=an_indexed_package_plugin
+        )
+
+        assert a_package_plugin_path in factory.instantiate(package_plugin_identifier)["file"]
+
+    def test_when_plugin_has_no_details_then_index_records_none(
+        self, a_module_plugin_path, module_plugin_identifier, mock_logger, tmp_path
+    ):
+        index_path = str(tmp_path / "plugin_index.json")
+        PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_module_plugin_path, disableEntryPointsPlugins=True
+        ).writeIndex(index_path)
+
+        factory = PythonPluginSystemManagerImplementationFactory(mock_logger, indexPath=index_path)
+
+        assert factory.details(module_plugin_identifier) is None
+
+    def test_when_index_unreadable_then_plugins_searched_for(
+        self, a_module_plugin_path, module_plugin_identifier, mock_logger, tmp_path
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger,
+            paths=a_module_plugin_path,
+            disableEntryPointsPlugins=True,
+            indexPath=str(tmp_path / "missing.json"),
+        )
+
+        assert factory.identifiers() == [module_plugin_identifier]
+
+
+class Test_PythonPluginSystemManagerImplementationFactory_startupReport:
+    def test_when_not_instantiated_then_instantiate_time_not_recorded(
+        self, a_module_plugin_path, module_plugin_identifier, mock_logger
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_module_plugin_path, disableEntryPointsPlugins=True
+        )
+
+        entry = factory.startupReport().entry(module_plugin_identifier)
+        assert entry.importTime >= 0
+        assert entry.instantiateTime is None
+
+    def test_when_instantiated_then_instantiate_time_recorded_and_logged(
+        self, a_module_plugin_path, module_plugin_identifier, mock_logger
+    ):
+        factory = PythonPluginSystemManagerImplementationFactory(
+            mock_logger, paths=a_module_plugin_path, disableEntryPointsPlugins=True
+        )
+        factory.instantiate(module_plugin_identifier)
+
+        assert factory.startupReport().entry(module_plugin_identifier).instantiateTime >= 0
+        debug_api_messages = [
+            args[1]
+            for args, _ in mock_logger.mock.log.call_args_list
+            if args[0] == mock_logger.Severity.kDebugApi
+        ]
+        assert any(
+            message.startswith(f"Instantiated {module_plugin_identifier} in ")
+            for message in debug_api_messages
+        )
+
+
 @pytest.fixture
 def prepended_sys_path_with_entry_point_plugin(an_entry_point_package_plugin_root, monkeypatch):
     monkeypatch.syspath_prepend(an_entry_point_package_plugin_root)
+
+
+@pytest.fixture
+def an_indexed_package_plugin(a_package_plugin_path, tmp_path):
+    """
+    Writes an index of the package plugin, returning the index path.
+    """
+    index_path = str(tmp_path / "plugin_index.json")
+    PythonPluginSystemManagerImplementationFactory(
+        ConsoleLogger(), paths=a_package_plugin_path, disableEntryPointsPlugins=True
+    ).writeIndex(index_path)
+    return index_path
+
+
+def declared_implementation_path(plugin_path):
+    return os.path.join(plugin_path, "declaredPlugin", "implementation.py")
+
+
+def is_imported(path):
+    return any(
+        getattr(module, "__file__", None) == path for module in list(sys.modules.values())
+    )
@@ -0,0 +1,112 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.pluginSystem.PythonPluginSystemManagerPlugin
+class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import collections
+import sys
+
+import pytest
+
+from openassetio.errors import ConfigurationException, InputValidationException
+from openassetio.pluginSystem import PythonPluginSystemManagerPlugin
+
+
+class Test_PythonPluginSystemManagerPlugin_declare:
+    def test_returns_plugin_with_identifier_and_no_details(self):
+        plugin = PythonPluginSystemManagerPlugin.declare("a.manager", "collections:OrderedDict")
+
+        assert issubclass(plugin, PythonPluginSystemManagerPlugin)
+        assert plugin.identifier() == "a.manager"
+        assert plugin.details() is None
+
+    def test_when_details_given_then_details_returned(self):
+        details = object()
+
+        plugin = PythonPluginSystemManagerPlugin.declare(
+            "a.manager", "collections:OrderedDict", details=details
+        )
+
+        assert plugin.details() is details
+
+    def test_when_interface_called_then_entry_point_called(self):
+        plugin = PythonPluginSystemManagerPlugin.declare("a.manager", "collections:OrderedDict")
+
+        assert isinstance(plugin.interface(), collections.OrderedDict)
+
+    def test_when_attribute_is_dotted_then_resolved(self):
+        plugin = PythonPluginSystemManagerPlugin.declare(
+            "a.manager", "collections:OrderedDict.fromkeys"
+        )
+
+        with pytest.raises(TypeError):
+            # fromkeys requires an argument, so was resolved.
+            plugin.interface()
+
+    def test_implementation_imported_on_first_interface_call_only(self, an_implementation_module):
+        plugin = PythonPluginSystemManagerPlugin.declare(
+            "a.manager", f"{an_implementation_module}:make"
+        )
+
+        assert an_implementation_module not in sys.modules
+
+        assert plugin.interface() == 1
+        assert an_implementation_module in sys.modules
+
+        # Check the module isn't imported again.
+        del sys.modules[an_implementation_module]
+        assert plugin.interface() == 2
+
+    @pytest.mark.parametrize("entryPoint", ["module", "module:", ":attribute", ""])
+    def test_when_entry_point_malformed_then_raises(self, entryPoint):
+        with pytest.raises(InputValidationException, match="not of the form"):
+            PythonPluginSystemManagerPlugin.declare("a.manager", entryPoint)
+
+    def test_when_entry_point_relative_without_package_then_raises(self):
+        with pytest.raises(InputValidationException, match="no package was given"):
+            PythonPluginSystemManagerPlugin.declare("a.manager", ".module:attribute")
+
+    def test_when_entry_point_unloadable_then_interface_raises(self):
+        plugin = PythonPluginSystemManagerPlugin.declare(
+            "a.manager", "openassetio_nonexistent_module:attribute"
+        )
+
+        with pytest.raises(
+            ConfigurationException,
+            match="Unable to load entry point 'openassetio_nonexistent_module:attribute' of "
+            "plug-in 'a.manager'",
+        ):
+            plugin.interface()
+
+
+@pytest.fixture
+def an_implementation_module(tmp_path, monkeypatch):
+    name = "openassetio_test_declared_implementation"
+    (tmp_path / f"{name}.py").write_text(
+        "calls = 0\n"
+        "def make():\n"
+        "    global calls\n"
+        "    calls += 1\n"
+        "    return calls\n",
+        encoding="utf-8",
+    )
+    monkeypatch.syspath_prepend(str(tmp_path))
+    yield name
+    sys.modules.pop(name, None)
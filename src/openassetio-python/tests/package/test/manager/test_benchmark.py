@@ -0,0 +1,187 @@
+#
+#   Copyright 2013-2022 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests for the load-testing mode of the manager test harness.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+
+import struct
+
+import pytest
+
+from openassetio.errors import InputValidationException
+from openassetio.test.manager.benchmark import (
+    executeBenchmark,
+    executeReplay,
+    kReportSchemaVersion,
+)
+
+
+class Test_executeBenchmark_report:
+    def test_has_schema_version_and_manager_details(self, stub_manager_fixtures):
+        report = executeBenchmark(stub_manager_fixtures, batchSizes=[1], iterations=1)
+
+        assert report["schemaVersion"] == kReportSchemaVersion
+        assert report["manager"] == {
+            "identifier": "org.openassetio.test.manager.stubManager",
+            "displayName": "Stub Manager",
+        }
+
+    def test_config_matches_arguments(self, stub_manager_fixtures):
+        report = executeBenchmark(
+            stub_manager_fixtures, batchSizes=[2, 3], clients=2, iterations=4, warmupIterations=0
+        )
+
+        assert report["config"] == {
+            "batchSizes": [2, 3],
+            "clients": 2,
+            "iterations": 4,
+            "warmupIterations": 0,
+        }
+
+
+class Test_executeBenchmark_results:
+    def test_when_clients_and_iterations_given_then_calls_and_elements_are_totals(
+        self, stub_manager_fixtures
+    ):
+        report = executeBenchmark(
+            stub_manager_fixtures, batchSizes=[1, 5], clients=3, iterations=4
+        )
+
+        results = results_for(report, "managementPolicy")
+        assert [result["batchSize"] for result in results] == [1, 5]
+        assert [result["calls"] for result in results] == [12, 12]
+        assert [result["elements"] for result in results] == [12, 60]
+        assert all(result["errors"] == 0 for result in results)
+
+    def test_latencies_are_ordered_and_throughput_is_positive(self, stub_manager_fixtures):
+        report = executeBenchmark(stub_manager_fixtures, batchSizes=[10], iterations=10)
+
+        (result,) = results_for(report, "managementPolicy")
+        latency = result["latencyNs"]
+        assert 0 <= latency["min"] <= latency["p50"] <= latency["p99"] <= latency["max"]
+        assert latency["min"] <= latency["mean"] <= latency["max"]
+        assert result["wallTimeSeconds"] > 0
+        assert result["throughputElementsPerSecond"] > 0
+
+    def test_when_reference_not_recognized_then_errors_are_counted(self, stub_manager_fixtures):
+        # StubManager does not recognize any entity references.
+        stub_manager_fixtures["Test_isEntityReferenceString"] = {
+            "shared": {"a_valid_reference": "stub://entity"}
+        }
+
+        report = executeBenchmark(
+            stub_manager_fixtures, batchSizes=[3], iterations=2, warmupIterations=1
+        )
+
+        (result,) = results_for(report, "isEntityReferenceString")
+        assert result["errors"] == 9
+
+
+class Test_executeBenchmark_skipped:
+    def test_when_capability_missing_then_workload_skipped(self, stub_manager_fixtures):
+        stub_manager_fixtures["Test_resolve"] = {
+            "shared": {
+                "a_reference_to_a_readable_entity": "stub://entity",
+                "a_set_of_valid_traits": {"a_trait"},
+            }
+        }
+
+        report = executeBenchmark(stub_manager_fixtures, batchSizes=[1], iterations=1)
+
+        assert results_for(report, "resolve") == []
+        assert {
+            "workload": "resolve",
+            "reason": "Manager does not have capability kResolution",
+        } in report["skipped"]
+
+    def test_when_fixture_missing_then_workload_skipped(self, stub_manager_fixtures):
+        report = executeBenchmark(stub_manager_fixtures, batchSizes=[1], iterations=1)
+
+        assert results_for(report, "isEntityReferenceString") == []
+        assert {
+            "workload": "isEntityReferenceString",
+            "reason": "Missing fixture 'a_valid_reference' for Test_isEntityReferenceString",
+        } in report["skipped"]
+
+
+class Test_executeBenchmark_arguments:
+    @pytest.mark.parametrize(
+        "kwargs",
+        [
+            {"batchSizes": []},
+            {"batchSizes": [0]},
+            {"clients": 0},
+            {"iterations": 0},
+            {"warmupIterations": -1},
+        ],
+    )
+    def test_when_out_of_range_then_raises(self, stub_manager_fixtures, kwargs):
+        with pytest.raises(InputValidationException):
+            executeBenchmark(stub_manager_fixtures, **kwargs)
+
+
+class Test_executeReplay:
+    def test_when_log_replayed_then_report_holds_config_and_method_outcomes(
+        self, stub_manager_fixtures, a_register_log
+    ):
+        report = executeReplay(stub_manager_fixtures, a_register_log, rate=0)
+
+        assert report["schemaVersion"] == kReportSchemaVersion
+        assert report["manager"]["identifier"] == "org.openassetio.test.manager.stubManager"
+        assert report["config"] == {
+            "log": str(a_register_log),
+            "rate": 0,
+            "replayPublishing": False,
+        }
+        assert report["methods"] == {
+            "register": {
+                "calls": 0,
+                "skipped": 1,
+                "exceptions": 0,
+                "successes": 0,
+                "errors": 0,
+                "recordedSeconds": 0,
+                "replayedSeconds": 0,
+            }
+        }
+
+    def test_when_rate_is_negative_then_raises(self, stub_manager_fixtures, a_register_log):
+        with pytest.raises(InputValidationException):
+            executeReplay(stub_manager_fixtures, a_register_log, rate=-1)
+
+
+@pytest.fixture
+def a_register_log(tmp_path):
+    """
+    A manager traffic log holding a single `register` call record,
+    without arguments, since skipped calls are not decoded.
+    """
+    path = tmp_path / "traffic.oamt"
+    record = struct.pack("<BBBQQII", 1, 9, 0, 0, 0, 0, 0)
+    path.write_bytes(b"OAMT" + struct.pack("<HH", 1, 0) + struct.pack("<I", len(record)) + record)
+    return path
+
+
+@pytest.fixture
+def stub_manager_fixtures():
+    return {"identifier": "org.openassetio.test.manager.stubManager"}
+
+
+def results_for(report, workload):
+    return [result for result in report["results"] if result["workload"] == workload]
@@ -142,6 +142,46 @@ class Test_executeSuite:
         assert "test_that_will_always_pass" in dummyStderr.getvalue()
 
 
+class Test_executeSuite_workers:
+    def test_when_called_with_failing_module_then_false_is_returned(
+        self, a_failing_tests_module, executeSuiteTests_fixtures
+    ):
+        assert (
+            executeSuite(a_failing_tests_module, executeSuiteTests_fixtures, workers=2) is False
+        )
+
+    def test_when_called_with_passing_module_then_true_is_returned(
+        self, a_passing_tests_module, executeSuiteTests_fixtures
+    ):
+        assert executeSuite(a_passing_tests_module, executeSuiteTests_fixtures, workers=2) is True
+
+    def test_when_called_with_executeSuiteTests_module_then_all_tests_pass(
+        self, executeSuiteTests_module, executeSuiteTests_fixtures
+    ):
+        assert (
+            executeSuite(executeSuiteTests_module, executeSuiteTests_fixtures, workers=2) is True
+        )
+
+    def test_when_called_then_combined_results_written_to_stderr(
+        self, monkeypatch, executeSuiteTests_module, executeSuiteTests_fixtures
+    ):
+        dummyStderr = io.StringIO()
+        monkeypatch.setattr(sys, "stderr", dummyStderr)
+
+        executeSuite(executeSuiteTests_module, executeSuiteTests_fixtures, workers=2)
+
+        output = dummyStderr.getvalue()
+        assert "test_fixtures_include_those_for_the_test" in output
+        assert "using up to 2 worker processes" in output
+        assert output.endswith("OK\n")
+
+    def test_when_workers_less_than_one_then_raises(
+        self, a_passing_tests_module, executeSuiteTests_fixtures
+    ):
+        with pytest.raises(errors.InputValidationException):
+            executeSuite(a_passing_tests_module, executeSuiteTests_fixtures, workers=0)
+
+
 class Test_FixtureAugmentedTestCase:
     def test_when_constructed_then_objects_are_exposed_via_protected_members(
         self, a_fixture_dict, a_locale, mock_manager
@@ -20,6 +20,7 @@ Integration tests for CLI operation of the manager test harness.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import json
 import os
 import subprocess
 import sys
@@ -79,6 +80,49 @@ class Test_CLI_arguments:
         assert result.returncode == 0
         assert "test_is_correct_type" in str(result.stderr)
 
+    def test_when_called_with_workers_then_tests_run_in_parallel(self, a_passing_fixtures_file):
+        result = execute_cli(a_passing_fixtures_file, "--workers", "2")
+        assert result.returncode == 0
+        assert "using up to 2 worker processes" in str(result.stderr)
+
+
+class Test_CLI_benchmark:
+    def test_when_benchmark_flag_given_then_json_report_written_to_stdout(
+        self, a_passing_fixtures_file
+    ):
+        result = execute_cli(
+            a_passing_fixtures_file, "--benchmark", "--batch-sizes", "1", "2", "--iterations", "3"
+        )
+
+        assert result.returncode == 0
+        report = json.loads(result.stdout)
+        assert report["manager"]["identifier"] == "org.openassetio.test.manager.stubManager"
+        assert report["config"]["batchSizes"] == [1, 2]
+        assert report["config"]["iterations"] == 3
+
+    def test_when_benchmark_flag_given_then_test_suite_not_run(self, a_passing_fixtures_file):
+        assert "Ran" not in str(execute_cli(a_passing_fixtures_file, "--benchmark").stderr)
+
+    def test_when_clients_given_then_calls_made_by_each_client(self, a_passing_fixtures_file):
+        result = execute_cli(
+            a_passing_fixtures_file, "--benchmark", "--clients", "2", "--iterations", "3"
+        )
+
+        report = json.loads(result.stdout)
+        assert all(entry["calls"] == 6 for entry in report["results"])
+
+    def test_when_report_path_given_then_json_report_written_to_file(
+        self, a_passing_fixtures_file, tmp_path
+    ):
+        report_path = tmp_path / "report.json"
+
+        result = execute_cli(a_passing_fixtures_file, "--benchmark", "--report", report_path)
+
+        assert result.returncode == 0
+        assert result.stdout == b""
+        with open(report_path, encoding="utf-8") as report_file:
+            assert json.load(report_file)["schemaVersion"] == 1
+
 
 @pytest.fixture
 def a_passing_fixtures_file(resources_dir):
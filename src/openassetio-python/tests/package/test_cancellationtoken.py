@@ -0,0 +1,62 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.CancellationToken class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
+
+import pytest
+
+from openassetio import CancellationToken
+
+
+class Test_CancellationToken_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(CancellationToken):
+                pass
+
+
+class Test_CancellationToken_init:
+    def test_when_constructed_with_no_args_then_not_cancelled(self):
+        assert not CancellationToken().isCancelled()
+
+    def test_when_constructed_with_future_timeout_then_not_cancelled(self):
+        assert not CancellationToken(timeout=3600).isCancelled()
+
+    def test_when_constructed_with_elapsed_timeout_then_cancelled(self):
+        assert CancellationToken(timeout=datetime.timedelta(0)).isCancelled()
+
+
+class Test_CancellationToken_cancel:
+    def test_when_cancelled_then_isCancelled_is_true(self):
+        token = CancellationToken()
+
+        token.cancel()
+
+        assert token.isCancelled()
+
+    def test_when_cancelled_twice_then_isCancelled_is_true(self):
+        token = CancellationToken(timeout=3600)
+
+        token.cancel()
+        token.cancel()
+
+        assert token.isCancelled()
@@ -26,3 +26,14 @@ def test():
     assert constants.kInfoKey_SmallIcon == "smallIcon"
     assert constants.kInfoKey_Icon == "icon"
     assert constants.kInfoKey_EntityReferencesMatchPrefix == "entityReferencesMatchPrefix"
+    assert constants.kInfoKey_EntityReferencesMatchPrefixes == "entityReferencesMatchPrefixes"
+    assert constants.kInfoKey_EntityReferencesMatchPattern == "entityReferencesMatchPattern"
+    assert (
+        constants.kInfoKey_IsManagementPolicyContextSensitive
+        == "isManagementPolicyContextSensitive"
+    )
+    assert constants.kInfoKey_IsResolveCached == "isResolveCached"
+    assert constants.kInfoKey_ResolveCacheToken == "resolveCacheToken"
+    assert constants.kInfoKey_IsThreadSafe == "isThreadSafe"
+    assert constants.kInfoKey_ThreadSafeMethods == "threadSafeMethods"
+    assert constants.kInfoKey_MaxBatchSize == "maxBatchSize"
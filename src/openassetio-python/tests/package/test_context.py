@@ -19,9 +19,11 @@ Tests that cover the openassetio.Context class.
 
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import pickle
+
 import pytest
 
-from openassetio import Context, managerApi
+from openassetio import CancellationToken, Context, managerApi
 from openassetio.trait import TraitsData
 
 
@@ -30,6 +32,7 @@ class Test_Context_init:
         context = Context()
         assert isinstance(context.locale, TraitsData)
         assert context.managerState is None
+        assert context.cancellationToken is None
         # Ensure we're not re-using the same instance.
         assert Context().locale is not context.locale
 
@@ -101,6 +104,108 @@ class Test_Context_managerState:
         assert actual_data is expected_data
 
 
+
+class Test_Context_cancellationToken:
+    def test_when_set_to_None_then_returns_None(self, a_context):
+        a_context.cancellationToken = None
+
+        assert a_context.cancellationToken is None
+
+    def test_when_set_to_valid_token_then_holds_reference_to_that_token(self, a_context):
+        expected_token = CancellationToken()
+        a_context.cancellationToken = expected_token
+
+        actual_token = a_context.cancellationToken
+
+        assert actual_token is expected_token
+
+
+class Test_Context_priority:
+    def test_when_default_constructed_then_is_normal(self, a_context):
+        assert a_context.priority == Context.Priority.kNormal
+
+    def test_when_set_then_returns_new_priority(self, a_context):
+        a_context.priority = Context.Priority.kBackground
+
+        assert a_context.priority == Context.Priority.kBackground
+
+    def test_when_frozen_then_snapshot_has_same_priority(self, a_context):
+        a_context.priority = Context.Priority.kInteractive
+
+        assert a_context.freeze().priority == Context.Priority.kInteractive
+
+
+class Test_Context_fingerprint:
+    def test_when_locales_equal_then_fingerprints_equal(self):
+        a_locale = TraitsData({"a_trait"})
+        another_locale = TraitsData({"a_trait"})
+
+        assert Context(a_locale).fingerprint() == Context(another_locale).fingerprint()
+
+    def test_when_locale_modified_then_fingerprint_changes(self, a_context):
+        before = a_context.fingerprint()
+
+        a_context.locale.setTraitProperty("a_trait", "a_property", 1)
+
+        assert a_context.fingerprint() != before
+
+    def test_when_manager_state_differs_then_fingerprints_differ(self):
+        class TestState(managerApi.ManagerStateBase):
+            pass
+
+        context = Context(TraitsData(), TestState())
+        other_context = Context(TraitsData(), TestState())
+
+        assert context.fingerprint() != other_context.fingerprint()
+
+
+class Test_Context_freeze:
+    def test_when_frozen_then_snapshot_has_equal_locale_and_same_state_and_token(self):
+        class TestState(managerApi.ManagerStateBase):
+            pass
+
+        locale = TraitsData({"a_trait"})
+        state = TestState()
+        token = CancellationToken()
+        context = Context(locale, state)
+        context.cancellationToken = token
+
+        snapshot = context.freeze()
+
+        assert snapshot is not context
+        assert snapshot.locale == locale
+        assert snapshot.managerState is state
+        assert snapshot.cancellationToken is token
+
+    def test_when_original_locale_modified_then_snapshot_unaffected(self, a_context):
+        snapshot = a_context.freeze()
+
+        a_context.locale.setTraitProperty("a_trait", "a_property", 1)
+
+        assert snapshot.locale == TraitsData()
+
+
+class Test_Context_pickle:
+    def test_when_round_tripped_then_locale_is_equal(self):
+        locale = TraitsData({"a_trait"})
+        locale.setTraitProperty("a_trait", "a_property", "a value")
+        context = Context(locale)
+
+        unpickled = pickle.loads(pickle.dumps(context))
+
+        assert unpickled.locale == locale
+        assert unpickled.managerState is None
+
+    def test_when_context_has_manager_state_then_raises(self):
+        class TestState(managerApi.ManagerStateBase):
+            pass
+
+        context = Context(TraitsData(), TestState())
+
+        with pytest.raises(TypeError, match="persistenceTokenForContext"):
+            pickle.dumps(context)
+
+
 @pytest.fixture
 def a_context():
     return Context()
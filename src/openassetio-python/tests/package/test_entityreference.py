@@ -21,6 +21,8 @@ Tests for the EntityReference type.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import pickle
+
 import pytest
 
 from openassetio import EntityReference
@@ -57,7 +59,24 @@ class Test_EntityReference_equality:
         assert EntityReference("something") != EntityReference("something else")
 
 
+class Test_EntityReference_hash:
+    def test_when_same_then_hashes_equal(self):
+        assert hash(EntityReference("something")) == hash(EntityReference("something"))
+
+    def test_when_used_as_set_element_then_duplicates_collapsed(self):
+        refs = {EntityReference("a"), EntityReference("b"), EntityReference("a")}
+
+        assert refs == {EntityReference("a"), EntityReference("b")}
+
+
 class Test_EntityReference_string_equivalence:
     def test_when_used_with_format_then_result_contains_toString_value(self):
         a_ref = EntityReference("Some 🍟 with that?")
         assert f"{a_ref}" == a_ref.toString()
+
+
+class Test_EntityReference_pickle:
+    def test_when_round_tripped_then_equal(self):
+        ref = EntityReference("some://ref")
+
+        assert pickle.loads(pickle.dumps(ref)) == ref
@@ -0,0 +1,93 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.EntityReferenceBatch class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import pytest
+
+from openassetio import EntityReference, EntityReferenceBatch
+from openassetio.errors import InputValidationException
+
+
+class Test_EntityReferenceBatch_init:
+    def test_when_default_constructed_then_empty(self):
+        assert len(EntityReferenceBatch()) == 0
+
+    def test_when_constructed_from_references_then_holds_their_strings(self):
+        batch = EntityReferenceBatch([EntityReference("a://1"), EntityReference("b://22")])
+
+        assert len(batch) == 2
+        assert batch[0] == "a://1"
+        assert batch[1] == "b://22"
+
+
+class Test_EntityReferenceBatch_append:
+    def test_appended_strings_are_retrievable_in_order(self):
+        batch = EntityReferenceBatch()
+        batch.reserve(3, 6)
+        for string in ("a", "", "bcdef"):
+            batch.append(string)
+
+        assert [batch[idx] for idx in range(len(batch))] == ["a", "", "bcdef"]
+
+
+class Test_EntityReferenceBatch_getitem:
+    def test_when_index_out_of_range_then_IndexError_raised(self):
+        batch = EntityReferenceBatch([EntityReference("a")])
+
+        with pytest.raises(IndexError):
+            _ = batch[1]
+
+    def test_supports_iteration(self):
+        batch = EntityReferenceBatch([EntityReference("a"), EntityReference("b")])
+
+        assert list(batch) == ["a", "b"]
+
+
+class Test_EntityReferenceBatch_entityReference:
+    def test_returns_reference_for_element(self):
+        batch = EntityReferenceBatch([EntityReference("a"), EntityReference("b")])
+
+        assert batch.entityReference(1) == EntityReference("b")
+
+    def test_when_index_out_of_range_then_raises(self):
+        with pytest.raises(InputValidationException, match="out of range"):
+            EntityReferenceBatch().entityReference(0)
+
+
+class Test_EntityReferenceBatch_toEntityReferences:
+    def test_returns_reference_for_each_element(self):
+        refs = [EntityReference("a"), EntityReference("b"), EntityReference("c")]
+
+        assert EntityReferenceBatch(refs).toEntityReferences() == refs
+
+
+class Test_EntityReferenceBatch_eq:
+    def test_when_same_strings_then_equal(self):
+        batch = EntityReferenceBatch()
+        batch.append("a")
+        batch.append("b")
+
+        assert batch == EntityReferenceBatch([EntityReference("a"), EntityReference("b")])
+
+    def test_when_split_differently_then_not_equal(self):
+        batch = EntityReferenceBatch()
+        batch.append("ab")
+
+        assert batch != EntityReferenceBatch([EntityReference("a"), EntityReference("b")])
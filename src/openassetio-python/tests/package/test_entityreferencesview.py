@@ -0,0 +1,75 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.EntityReferencesView class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import collections.abc
+
+import pytest
+
+from openassetio import EntityReference, EntityReferencesView
+
+
+@pytest.fixture
+def refs():
+    return [EntityReference("a://1"), EntityReference("b://2"), EntityReference("c://3")]
+
+
+class Test_EntityReferencesView_init:
+    def test_when_constructed_from_references_then_holds_them(self, refs):
+        view = EntityReferencesView(refs)
+
+        assert len(view) == 3
+        assert view[0] == refs[0]
+        assert view[2] == refs[2]
+
+    def test_is_a_sequence(self, refs):
+        assert isinstance(EntityReferencesView(refs), collections.abc.Sequence)
+
+
+class Test_EntityReferencesView_getitem:
+    def test_when_index_negative_then_indexes_from_end(self, refs):
+        assert EntityReferencesView(refs)[-1] == refs[2]
+
+    @pytest.mark.parametrize("index", [3, -4])
+    def test_when_index_out_of_range_then_IndexError_raised(self, refs, index):
+        view = EntityReferencesView(refs)
+
+        with pytest.raises(IndexError):
+            _ = view[index]
+
+    def test_when_sliced_then_returns_list_of_references(self, refs):
+        assert EntityReferencesView(refs)[::2] == refs[::2]
+
+    def test_supports_iteration(self, refs):
+        assert list(EntityReferencesView(refs)) == refs
+
+
+class Test_EntityReferencesView_toStrings:
+    def test_returns_string_of_each_reference(self, refs):
+        assert EntityReferencesView(refs).toStrings() == ["a://1", "b://2", "c://3"]
+
+
+class Test_EntityReferencesView_eq:
+    def test_when_compared_to_equal_list_then_equal(self, refs):
+        assert EntityReferencesView(refs) == refs
+        assert refs == EntityReferencesView(refs)
+
+    def test_when_compared_to_different_list_then_not_equal(self, refs):
+        assert EntityReferencesView(refs) != refs[:2]
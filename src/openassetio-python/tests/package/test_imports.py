@@ -49,12 +49,21 @@ class Test_package_imports:
     def test_importing_constants_succeeds(self):
         from openassetio import constants
 
+    def test_importing_CancellationToken_succeeds(self):
+        from openassetio import CancellationToken
+
     def test_importing_Context_succeeds(self):
         from openassetio import Context
 
     def test_importing_EntityReference_succeeds(self):
         from openassetio import EntityReference
 
+    def test_importing_EntityReferenceBatch_succeeds(self):
+        from openassetio import EntityReferenceBatch
+
+    def test_importing_EntityReferencesView_succeeds(self):
+        from openassetio import EntityReferencesView
+
     def test_importing_log_succeeds(self):
         from openassetio import log
 
@@ -80,6 +89,18 @@ class Test_hostApi_imports:
     def test_importing_ManagerImplementationFactoryInterface_succeeds(self):
         from openassetio.hostApi import ManagerImplementationFactoryInterface
 
+    def test_importing_ManagerMetrics_succeeds(self):
+        from openassetio.hostApi import ManagerMetrics
+
+    def test_importing_ManagerTrafficReplayer_succeeds(self):
+        from openassetio.hostApi import ManagerTrafficReplayer
+
+    def test_importing_ResolveCache_succeeds(self):
+        from openassetio.hostApi import ResolveCache
+
+    def test_importing_ResolveCoalescer_succeeds(self):
+        from openassetio.hostApi import ResolveCoalescer
+
     def test_importing_terminology_succeeds(self):
         from openassetio.hostApi import terminology
 
@@ -135,6 +156,12 @@ class Test_trait_imports:
     def test_importing_TraitsData_succeeds(self):
         from openassetio.trait import TraitsData
 
+    def test_importing_PropertyBuffer_succeeds(self):
+        from openassetio.trait import PropertyBuffer
+
+    def test_importing_extractTraitProperty_succeeds(self):
+        from openassetio.trait import extractTraitProperty
+
 
 class Test_test_imports:
     def test_importing_manager_succeeds(self):
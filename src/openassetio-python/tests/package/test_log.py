@@ -20,8 +20,12 @@ Tests that cover the openassetio.log module.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import datetime
+import json
+
 import pytest
 
+from openassetio.errors import InputValidationException
 import openassetio.log as lg
 
 
@@ -40,6 +44,12 @@ def severity_filter(mock_logger):
     return lg.SeverityFilter(mock_logger)
 
 
+@pytest.fixture
+def reset_global_severity_override():
+    yield
+    lg.SeverityFilter.setGlobalSeverityOverride(None)
+
+
 # Ordered by increasing severity value
 all_severities = (
     lg.LoggerInterface.Severity.kDebugApi,
@@ -109,6 +119,26 @@ class Test_ConsoleLogger:
 
         assert "\033[0m" not in output.err
 
+    def test_when_flushInterval_negative_then_raises_InputValidationException(self):
+        with pytest.raises(InputValidationException):
+            lg.ConsoleLogger(flushInterval=datetime.timedelta(milliseconds=-1))
+
+    def test_when_buffered_then_messages_written_on_warning_or_flush(self, capfd):
+        _ = capfd.readouterr()
+        logger = lg.ConsoleLogger(
+            shouldColorOutput=False, flushInterval=datetime.timedelta(hours=1)
+        )
+
+        logger.log(lg.LoggerInterface.Severity.kDebug, "A message")
+        assert capfd.readouterr().err == ""
+
+        logger.log(lg.LoggerInterface.Severity.kWarning, "Another message")
+        assert capfd.readouterr().err == "      debug: A message\n    warning: Another message\n"
+
+        logger.log(lg.LoggerInterface.Severity.kInfo, "A message")
+        logger.flush()
+        assert capfd.readouterr().err == "       info: A message\n"
+
 
 class Test_LoggerInterface:
     def test_severity_names(self):
@@ -140,6 +170,10 @@ class Test_LoggerInterface:
         for index, severity in enumerate(all_severities):
             assert severity.value == index
 
+    def test_isSeverityLogged_returns_true_for_all_severities_by_default(self, mock_logger):
+        for severity in all_severities:
+            assert mock_logger.isSeverityLogged(severity) is True
+
     def test_debugApi_calls_log_with_expected_severity_and_message(self, mock_logger):
         message = "a debugApi message"
         mock_logger.debugApi(message)
@@ -182,6 +216,60 @@ class Test_LoggerInterface:
         )
 
 
+    def test_logStructured_calls_log_with_fields_appended_in_key_order(self, mock_logger):
+        mock_logger.logStructured(
+            lg.LoggerInterface.Severity.kDebugApi,
+            "a message",
+            {"method": "resolve", "batchSize": 3, "isSuccess": True, "elapsed": 0.5},
+        )
+        mock_logger.mock.log.assert_called_once_with(
+            lg.LoggerInterface.Severity.kDebugApi,
+            "a message [batchSize=3, elapsed=0.5, isSuccess=true, method=resolve]",
+        )
+
+    def test_logStructured_without_fields_calls_log_with_message(self, mock_logger):
+        mock_logger.logStructured(lg.LoggerInterface.Severity.kInfo, "a message", {})
+        mock_logger.mock.log.assert_called_once_with(
+            lg.LoggerInterface.Severity.kInfo, "a message"
+        )
+
+
+class Test_JsonLinesLogger_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(lg.JsonLinesLogger):
+                pass
+
+
+class Test_JsonLinesLogger_log:
+    def test_when_path_cannot_be_opened_then_raises_InputValidationException(self, tmp_path):
+        path = str(tmp_path / "missing" / "log.jsonl")
+        with pytest.raises(InputValidationException):
+            lg.JsonLinesLogger(path)
+
+    def test_when_structured_message_logged_then_json_line_written(self, tmp_path):
+        path = tmp_path / "log.jsonl"
+        logger = lg.JsonLinesLogger(str(path))
+
+        logger.log(lg.LoggerInterface.Severity.kInfo, "first")
+        logger.logStructured(
+            lg.LoggerInterface.Severity.kDebugApi, "second", {"method": "resolve", "batchSize": 3}
+        )
+        logger.flush()
+
+        lines = [json.loads(line) for line in path.read_text().splitlines()]
+        assert len(lines) == 2
+        assert lines[0]["severity"] == "info"
+        assert lines[0]["message"] == "first"
+        assert "fields" not in lines[0]
+        assert lines[1]["severity"] == "debugApi"
+        assert lines[1]["message"] == "second"
+        assert lines[1]["fields"] == {"method": "resolve", "batchSize": 3}
+        assert isinstance(lines[1]["timestamp"], int)
+        assert isinstance(lines[1]["thread"], int)
+
+
 class Test_SeverityFilter_inheritance:
     def test_class_is_final(self):
         with pytest.raises(TypeError):
@@ -258,6 +346,35 @@ class Test_SeverityFilter_setSeverity_getSeverity:
             assert severity_filter.getSeverity() == severity
 
 
+class Test_SeverityFilter_globalSeverityOverride:
+    def test_when_not_set_then_returns_None(self):
+        assert lg.SeverityFilter.globalSeverityOverride() is None
+
+    def test_when_set_then_returns_the_new_value(self, reset_global_severity_override):
+        for severity in all_severities:
+            lg.SeverityFilter.setGlobalSeverityOverride(severity)
+            assert lg.SeverityFilter.globalSeverityOverride() == severity
+
+    def test_when_set_then_overrides_filter_severity(
+        self, severity_filter, reset_global_severity_override
+    ):
+        severity_filter.setSeverity(lg.LoggerInterface.Severity.kError)
+        lg.SeverityFilter.setGlobalSeverityOverride(lg.LoggerInterface.Severity.kDebug)
+
+        assert severity_filter.getSeverity() == lg.LoggerInterface.Severity.kError
+        assert severity_filter.isSeverityLogged(lg.LoggerInterface.Severity.kDebug) is True
+
+    def test_when_cleared_then_filter_severity_is_used(
+        self, severity_filter, reset_global_severity_override
+    ):
+        severity_filter.setSeverity(lg.LoggerInterface.Severity.kError)
+        lg.SeverityFilter.setGlobalSeverityOverride(lg.LoggerInterface.Severity.kDebug)
+        lg.SeverityFilter.setGlobalSeverityOverride(None)
+
+        assert lg.SeverityFilter.globalSeverityOverride() is None
+        assert severity_filter.isSeverityLogged(lg.LoggerInterface.Severity.kDebug) is False
+
+
 class Test_SeverityFilter_log:
     def test_only_messages_of_equal_or_greater_severity_are_relayed(self, severity_filter):
 
@@ -277,8 +394,164 @@ class Test_SeverityFilter_log:
                 else:
                     mock_logger.mock.log.assert_not_called()
 
+    def test_conveniences_only_relay_messages_of_equal_or_greater_severity(self, severity_filter):
+        mock_logger = severity_filter.upstreamLogger()
+        severity_filter.setSeverity(lg.LoggerInterface.Severity.kWarning)
+
+        severity_filter.debug("A debug message")
+        severity_filter.info("An info message")
+        mock_logger.mock.log.assert_not_called()
+
+        severity_filter.error("An error message")
+        mock_logger.mock.log.assert_called_once_with(
+            lg.LoggerInterface.Severity.kError, "An error message"
+        )
+
+    def test_logStructured_only_relays_messages_of_equal_or_greater_severity(
+        self, severity_filter
+    ):
+        mock_logger = severity_filter.upstreamLogger()
+        severity_filter.setSeverity(lg.LoggerInterface.Severity.kWarning)
+
+        severity_filter.logStructured(lg.LoggerInterface.Severity.kDebug, "A message", {"a": 1})
+        mock_logger.mock.log.assert_not_called()
+
+        severity_filter.logStructured(lg.LoggerInterface.Severity.kError, "A message", {"a": 1})
+        mock_logger.mock.log.assert_called_once_with(
+            lg.LoggerInterface.Severity.kError, "A message [a=1]"
+        )
+
+    def test_when_message_is_not_a_string_then_raises_TypeError(self, severity_filter):
+        with pytest.raises(TypeError):
+            severity_filter.log(lg.LoggerInterface.Severity.kError, 1)
+
+
+class Test_SeverityFilter_effectiveSeverity:
+    def test_when_no_override_then_returns_filter_severity(self, severity_filter):
+        severity_filter.setSeverity(lg.LoggerInterface.Severity.kError)
+        assert severity_filter.effectiveSeverity() == lg.LoggerInterface.Severity.kError
+
+    def test_when_override_set_then_returns_overridden_severity(
+        self, severity_filter, reset_global_severity_override
+    ):
+        severity_filter.setSeverity(lg.LoggerInterface.Severity.kError)
+        lg.SeverityFilter.setGlobalSeverityOverride(lg.LoggerInterface.Severity.kDebug)
+        assert severity_filter.effectiveSeverity() == lg.LoggerInterface.Severity.kDebug
+
+
+class Test_SeverityFilter_isSeverityLogged:
+    def test_only_equal_or_greater_severities_are_logged(self, severity_filter):
+        for filter_severity in all_severities:
+            severity_filter.setSeverity(filter_severity)
+
+            for severity in all_severities:
+                assert severity_filter.isSeverityLogged(severity) == (severity >= filter_severity)
+
+    def test_when_upstream_logger_discards_severity_then_not_logged(self):
+        class DiscardingLogger(lg.LoggerInterface):
+            def log(self, severity, message):
+                pass
+
+            def isSeverityLogged(self, severity):
+                return severity != lg.LoggerInterface.Severity.kError
+
+        a_filter = lg.SeverityFilter(DiscardingLogger())
+
+        assert a_filter.isSeverityLogged(lg.LoggerInterface.Severity.kWarning) is True
+        assert a_filter.isSeverityLogged(lg.LoggerInterface.Severity.kError) is False
+
 
 class Test_SeverityFilter_upstreamLogger:
     def test_returns_the_constructor_supplied_logger(self, mock_logger):
         a_filter = lg.SeverityFilter(mock_logger)
         assert a_filter.upstreamLogger() is mock_logger
+
+
+class Test_RateLimitFilter_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(lg.RateLimitFilter):
+                pass
+
+
+class Test_RateLimitFilter_init:
+    def test_when_logger_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError):
+            lg.RateLimitFilter(None)
+
+    def test_when_interval_not_positive_then_raises_InputValidationException(self, mock_logger):
+        with pytest.raises(InputValidationException):
+            lg.RateLimitFilter(mock_logger, interval=datetime.timedelta(0))
+
+
+class Test_RateLimitFilter_log:
+    def test_when_limit_exceeded_then_messages_suppressed(self, mock_logger):
+        a_filter = lg.RateLimitFilter(
+            mock_logger, maxMessagesPerInterval=2, interval=datetime.timedelta(hours=1)
+        )
+
+        for _ in range(5):
+            a_filter.log(lg.LoggerInterface.Severity.kWarning, "A message")
+
+        assert mock_logger.mock.log.call_count == 2
+        assert a_filter.suppressedCount() == 3
+
+    def test_when_sampling_then_one_in_sample_interval_suppressed_messages_relayed(
+        self, mock_logger
+    ):
+        a_filter = lg.RateLimitFilter(
+            mock_logger,
+            maxMessagesPerInterval=1,
+            interval=datetime.timedelta(hours=1),
+            sampleInterval=3,
+        )
+
+        for _ in range(8):
+            a_filter.log(lg.LoggerInterface.Severity.kWarning, "A message")
+
+        assert mock_logger.mock.log.call_count == 3
+        assert a_filter.suppressedCount() == 5
+
+
+class Test_RateLimitFilter_upstreamLogger:
+    def test_returns_the_constructor_supplied_logger(self, mock_logger):
+        a_filter = lg.RateLimitFilter(mock_logger)
+        assert a_filter.upstreamLogger() is mock_logger
+
+
+class Test_BufferedLogger_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(lg.BufferedLogger):
+                pass
+
+
+class Test_BufferedLogger_init:
+    def test_when_logger_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError):
+            lg.BufferedLogger(None)
+
+    def test_when_max_buffered_messages_is_zero_then_raises_InputValidationException(
+        self, mock_logger
+    ):
+        with pytest.raises(InputValidationException):
+            lg.BufferedLogger(mock_logger, maxBufferedMessages=0)
+
+
+class Test_BufferedLogger_log:
+    def test_when_no_scope_active_then_message_relayed_immediately(self, mock_logger):
+        a_logger = lg.BufferedLogger(mock_logger)
+
+        a_logger.log(lg.LoggerInterface.Severity.kInfo, "A message")
+
+        mock_logger.mock.log.assert_called_once_with(
+            lg.LoggerInterface.Severity.kInfo, "A message"
+        )
+
+
+class Test_BufferedLogger_upstreamLogger:
+    def test_returns_the_constructor_supplied_logger(self, mock_logger):
+        a_logger = lg.BufferedLogger(mock_logger)
+        assert a_logger.upstreamLogger() is mock_logger
@@ -0,0 +1,92 @@
+#
+#   Copyright 2023 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.trace module.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
+
+import pytest
+
+from openassetio.errors import InputValidationException
+from openassetio.hostApi import ManagerFactory
+from openassetio.trace import RingBufferTracer, TracerInterface
+
+
+class Test_TracerInterface_globalTracer:
+    def test_when_not_set_then_returns_None(self):
+        assert TracerInterface.globalTracer() is None
+
+    def test_when_set_then_returns_the_tracer(self, mock_tracer, reset_global_tracer):
+        TracerInterface.setGlobalTracer(mock_tracer)
+        assert TracerInterface.globalTracer() is mock_tracer
+
+    def test_when_set_then_api_calls_are_traced(self, mock_tracer, reset_global_tracer, tmp_path):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text('[manager]\nidentifier = "something"')
+        TracerInterface.setGlobalTracer(mock_tracer)
+
+        ManagerFactory.loadDefaultManagerConfig(str(config_path))
+
+        mock_tracer.mock.beginSpan.assert_called_once_with(
+            "ManagerFactory.loadDefaultManagerConfig", {"configPath": str(config_path)}
+        )
+        mock_tracer.mock.endSpan.assert_called_once_with(0, {"outcome": "returned"})
+
+
+class Test_RingBufferTracer_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(RingBufferTracer):
+                pass
+
+
+class Test_RingBufferTracer_init:
+    def test_when_capacity_is_zero_then_raises_InputValidationException(self):
+        with pytest.raises(InputValidationException):
+            RingBufferTracer(0)
+
+
+class Test_RingBufferTracer_spans:
+    def test_when_spans_ended_then_most_recent_spans_retained(self):
+        tracer = RingBufferTracer(capacity=2)
+
+        for name in ("first", "second", "third"):
+            span_id = tracer.beginSpan(name, {"begin": 1})
+            tracer.endSpan(span_id, {"end": "value"})
+
+        spans = tracer.spans()
+        assert [span.name for span in spans] == ["second", "third"]
+        assert spans[0].attributes == {"begin": 1, "end": "value"}
+        assert isinstance(spans[0].startTime, datetime.datetime)
+        assert isinstance(spans[0].duration, datetime.timedelta)
+
+    def test_when_cleared_then_no_spans_retained(self):
+        tracer = RingBufferTracer()
+        tracer.endSpan(tracer.beginSpan("span", {}), {})
+
+        tracer.clear()
+
+        assert tracer.spans() == []
+
+
+@pytest.fixture
+def reset_global_tracer():
+    yield
+    TracerInterface.setGlobalTracer(None)
@@ -4,11 +4,15 @@ Tests for the traits data container
 # pylint: disable=invalid-name,missing-class-docstring
 # pylint: disable=redefined-outer-name
 # pylint: disable=missing-function-docstring
+import copy
+import pickle
+
 import pytest
 
 # TODO(DF): @pylint - re-enable once Python dev vs. install mess sorted.
 # pylint: disable=no-name-in-module
-from openassetio.trait import TraitsData
+from openassetio.errors import InputValidationException
+from openassetio.trait import TraitsData, extractTraitProperty
 
 
 class Test_TraitsData_Inheritance:
@@ -183,6 +187,99 @@ class Test_TraitsData_equality:
         assert data_a != data_b
 
 
+class Test_TraitsData_merge:
+    def test_when_merged_then_has_union_with_other_taking_precedence(self):
+        data = TraitsData({"a_trait"})
+        data.setTraitProperty("shared_trait", "a_property", 1)
+        data.setTraitProperty("shared_trait", "another_property", "ours")
+        other = TraitsData({"another_trait"})
+        other.setTraitProperty("shared_trait", "another_property", "theirs")
+
+        data.merge(other)
+
+        assert data.traitSet() == {"a_trait", "another_trait", "shared_trait"}
+        assert data.getTraitProperty("shared_trait", "a_property") == 1
+        assert data.getTraitProperty("shared_trait", "another_property") == "theirs"
+        assert other.traitSet() == {"another_trait", "shared_trait"}
+
+    def test_when_keep_existing_policy_then_existing_values_take_precedence(self):
+        data = TraitsData()
+        data.setTraitProperty("a_trait", "a_property", "ours")
+        other = TraitsData()
+        other.setTraitProperty("a_trait", "a_property", "theirs")
+        other.setTraitProperty("a_trait", "another_property", "theirs")
+
+        data.merge(other, TraitsData.MergePolicy.kKeepExisting)
+
+        assert data.getTraitProperty("a_trait", "a_property") == "ours"
+        assert data.getTraitProperty("a_trait", "another_property") == "theirs"
+
+
+class Test_TraitsData_pickle:
+    def test_when_round_tripped_then_equal(self):
+        data = TraitsData({"a_trait", "another_trait"})
+        data.setTraitProperty("a_trait", "a_bool", True)
+        data.setTraitProperty("a_trait", "an_int", -3)
+        data.setTraitProperty("a_trait", "a_float", 1.5)
+        data.setTraitProperty("another_trait", "a_str", "some string")
+
+        assert pickle.loads(pickle.dumps(data)) == data
+
+    def test_when_deep_copied_then_data_is_decoupled(self):
+        data = TraitsData()
+        data.setTraitProperty("a_trait", "a_property", 1)
+
+        data_copy = copy.deepcopy(data)
+        data_copy.setTraitProperty("a_trait", "a_property", 2)
+
+        assert data.getTraitProperty("a_trait", "a_property") == 1
+
+
+class Test_extractTraitProperty:
+    @pytest.mark.parametrize(
+        "property_type,value_a,value_b,fmt",
+        [(bool, True, False, "?"), (int, 3, -4, "q"), (float, 1.5, 2.25, "d")],
+    )
+    def test_returns_buffer_of_values_with_validity_mask(
+        self, property_type, value_a, value_b, fmt
+    ):
+        data_a = TraitsData()
+        data_a.setTraitProperty("a_trait", "a_property", value_a)
+        data_missing = TraitsData({"a_trait"})
+        data_b = TraitsData()
+        data_b.setTraitProperty("a_trait", "a_property", value_b)
+
+        values, valid = extractTraitProperty(
+            [data_a, data_missing, data_b], "a_trait", "a_property", property_type
+        )
+
+        values_view = memoryview(values)
+        assert values_view.readonly
+        assert values_view.format == fmt
+        assert values_view.tolist() == [value_a, property_type(), value_b]
+        assert memoryview(valid).tolist() == [True, False, True]
+        assert len(values) == len(valid) == 3
+
+    def test_when_property_has_different_type_then_element_is_invalid(self):
+        data = TraitsData()
+        data.setTraitProperty("a_trait", "a_property", "not an int")
+
+        values, valid = extractTraitProperty([data], "a_trait", "a_property", int)
+
+        assert memoryview(values).tolist() == [0]
+        assert memoryview(valid).tolist() == [False]
+
+    def test_when_empty_then_buffers_are_empty(self):
+        values, valid = extractTraitProperty([], "a_trait", "a_property", float)
+
+        assert len(values) == 0
+        assert len(valid) == 0
+
+    def test_when_property_type_unsupported_then_raises(self):
+        with pytest.raises(InputValidationException, match="bool, int or float"):
+            extractTraitProperty([TraitsData()], "a_trait", "a_property", str)
+
+
 @pytest.fixture
 def a_traitsdata():
     return TraitsData({"first_trait", "second_trait"})